@@ -16,7 +16,9 @@ macro(setup_default_compiler_flags _project_name)
 		endif()
 
 		if(USE_SIMD_INSTRUCTIONS)
-			if(USE_AVX2_INSTRUCTIONS)
+			if(USE_AVX512_INSTRUCTIONS)
+				target_compile_options(${_project_name} PRIVATE "/arch:AVX512")
+			elseif(USE_AVX2_INSTRUCTIONS)
 				target_compile_options(${_project_name} PRIVATE "/arch:AVX2")
 			elseif(USE_AVX_INSTRUCTIONS)
 				target_compile_options(${_project_name} PRIVATE "/arch:AVX")
@@ -39,7 +41,16 @@ macro(setup_default_compiler_flags _project_name)
 
 		if(CPU_INSTRUCTION_SET MATCHES "x86" OR CPU_INSTRUCTION_SET MATCHES "x64")
 			if(USE_SIMD_INSTRUCTIONS)
-				if(USE_AVX2_INSTRUCTIONS)
+				if(USE_AVX512_INSTRUCTIONS)
+					target_compile_options(${_project_name} PRIVATE "-mavx512f")
+					target_compile_options(${_project_name} PRIVATE "-mavx512dq")
+					target_compile_options(${_project_name} PRIVATE "-mavx512vl")
+					target_compile_options(${_project_name} PRIVATE "-mavx512bw")
+					target_compile_options(${_project_name} PRIVATE "-mavx2")
+					target_compile_options(${_project_name} PRIVATE "-mavx")
+					target_compile_options(${_project_name} PRIVATE "-mbmi")
+					target_compile_options(${_project_name} PRIVATE "-mfma")
+				elseif(USE_AVX2_INSTRUCTIONS)
 					target_compile_options(${_project_name} PRIVATE "-mavx2")
 					target_compile_options(${_project_name} PRIVATE "-mavx")
 					target_compile_options(${_project_name} PRIVATE "-mbmi")
@@ -50,9 +61,19 @@ macro(setup_default_compiler_flags _project_name)
 				else()
 					target_compile_options(${_project_name} PRIVATE "-msse4.1")
 				endif()
-			else()
-				add_definitions(-DRTM_NO_INTRINSICS)
 			endif()
+		elseif(CPU_INSTRUCTION_SET MATCHES "wasm")
+			if(USE_SIMD_INSTRUCTIONS)
+				target_compile_options(${_project_name} PRIVATE "-msimd128")
+				target_compile_options(${_project_name} PRIVATE "-msse2")	# Emscripten implements SSE2 with SIMD128
+			endif()
+		endif()
+
+		if(NOT USE_SIMD_INSTRUCTIONS)
+			add_definitions(-DRTM_NO_INTRINSICS)
+
+			# The scalar code path relies on auto-vectorization, sqrt cannot be vectorized if it has to set errno
+			target_compile_options(${_project_name} PRIVATE -fno-math-errno)
 		endif()
 
 		target_compile_options(${_project_name} PRIVATE -Wall -Wextra)		# Enable all warnings
@@ -61,4 +82,54 @@ macro(setup_default_compiler_flags _project_name)
 
 		target_compile_options(${_project_name} PRIVATE -g)					# Enable debug symbols
 	endif()
+
+	if(USE_SIMD_INSTRUCTIONS AND USE_FMA)
+		target_compile_definitions(${_project_name} PRIVATE RTM_USE_FMA)
+	endif()
+endmacro()
+
+# Compiles the provided source file as the AVX2 batch dispatch variant when the project
+# doesn't already target AVX2 or AVX-512, see rtm/batch/dispatch.h
+macro(setup_batch_dispatch_variant _project_name _avx2_source_file)
+	if(USE_SIMD_INSTRUCTIONS AND NOT USE_AVX2_INSTRUCTIONS AND NOT USE_AVX512_INSTRUCTIONS AND CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|i.86" AND NOT CPU_INSTRUCTION_SET MATCHES "arm|wasm")
+		if(MSVC)
+			set_source_files_properties(${_avx2_source_file} PROPERTIES COMPILE_FLAGS "/arch:AVX2")
+		else()
+			set_source_files_properties(${_avx2_source_file} PROPERTIES COMPILE_FLAGS "-mavx2 -mfma -mf16c")
+		endif()
+
+		target_compile_definitions(${_project_name} PRIVATE RTM_DISPATCH_AVX2)
+	endif()
+endmacro()
+
+# Compiles the RTM_DETERMINISTIC test variants with their instruction sets and without
+# floating point contraction, see docs/determinism.md
+macro(setup_determinism_variants _source_dir)
+	if(NOT MSVC)
+		set_source_files_properties(${_source_dir}/test_determinism_scalar.cpp ${_source_dir}/test_determinism_default.cpp PROPERTIES COMPILE_FLAGS "-ffp-contract=off")
+	endif()
+
+	if(USE_SIMD_INSTRUCTIONS AND CMAKE_SYSTEM_PROCESSOR MATCHES "x86_64|AMD64|i.86" AND NOT CPU_INSTRUCTION_SET MATCHES "arm|wasm")
+		if(MSVC)
+			set_source_files_properties(${_source_dir}/test_determinism_avx2.cpp PROPERTIES COMPILE_FLAGS "/arch:AVX2")
+		else()
+			# The SLP vectorizer emits vfmaddsub for the scalar reference even without contraction
+			# when the project targets FMA, the reference must not use it
+			set_source_files_properties(${_source_dir}/test_determinism_scalar.cpp PROPERTIES COMPILE_FLAGS "-ffp-contract=off -mno-fma")
+			set_source_files_properties(${_source_dir}/test_determinism_sse4.cpp PROPERTIES COMPILE_FLAGS "-msse4.1 -ffp-contract=off")
+			set_source_files_properties(${_source_dir}/test_determinism_avx2.cpp PROPERTIES COMPILE_FLAGS "-mavx2 -mfma -mf16c -ffp-contract=off")
+		endif()
+	elseif(NOT MSVC)
+		set_source_files_properties(${_source_dir}/test_determinism_sse4.cpp ${_source_dir}/test_determinism_avx2.cpp PROPERTIES COMPILE_FLAGS "-ffp-contract=off")
+	endif()
+endmacro()
+
+# Precompiles the core RTM headers when USE_PRECOMPILED_HEADERS is enabled (requires CMake 3.16).
+# The extra arguments are the sources that configure RTM before including it, they
+# are compiled without the precompiled headers.
+macro(setup_precompiled_headers _project_name)
+	if(USE_PRECOMPILED_HEADERS AND NOT CMAKE_VERSION VERSION_LESS 3.16)
+		target_precompile_headers(${_project_name} PRIVATE <rtm/scalarf.h> <rtm/vector4f.h> <rtm/quatf.h> <rtm/qvvf.h> <rtm/matrix3x4f.h>)
+		set_source_files_properties(${ARGN} PROPERTIES SKIP_PRECOMPILE_HEADERS ON)
+	endif()
 endmacro()
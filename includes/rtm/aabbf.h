@@ -0,0 +1,154 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/qvsf.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an axis aligned bounding box from its center and its half extent along each axis.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_set(vector4f_arg0 center, vector4f_arg1 extent) RTM_NO_EXCEPT
+	{
+		return aabbf{ center, extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates an axis aligned bounding box from its minimum and maximum corners.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_from_min_max(vector4f_arg0 min_point, vector4f_arg1 max_point) RTM_NO_EXCEPT
+	{
+		const vector4f center = vector_mul(vector_add(min_point, max_point), 0.5F);
+		const vector4f extent = vector_mul(vector_sub(max_point, min_point), 0.5F);
+		return aabbf{ center, extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the minimum corner of an axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL aabb_get_min(aabbf_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_sub(input.center, input.extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the maximum corner of an axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL aabb_get_max(aabbf_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_add(input.center, input.extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest axis aligned bounding box that contains both inputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_merge(aabbf_arg0 lhs, aabbf_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const vector4f min_point = vector_min(aabb_get_min(lhs), aabb_get_min(rhs));
+		const vector4f max_point = vector_max(aabb_get_max(lhs), aabb_get_max(rhs));
+		return aabb_from_min_max(min_point, max_point);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest axis aligned bounding box that contains the input box and the point.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_merge_point(aabbf_arg0 input, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		const vector4f min_point = vector_min(aabb_get_min(input), point);
+		const vector4f max_point = vector_max(aabb_get_max(input), point);
+		return aabb_from_min_max(min_point, max_point);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Grows an axis aligned bounding box by the provided amount on every side.
+	// A negative amount shrinks the box, the extent must remain positive or zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_expand(aabbf_arg0 input, float amount) RTM_NO_EXCEPT
+	{
+		return aabbf{ input.center, vector_add(input.extent, vector_set(amount)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the 3D point is inside or on the surface of the box, false otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL aabb_contains_point(aabbf_arg0 input, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		return vector_all_less_equal3(vector_abs(vector_sub(point, input.center)), input.extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if both boxes overlap or touch, false otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL aabb_intersects(aabbf_arg0 lhs, aabbf_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector_all_less_equal3(vector_abs(vector_sub(lhs.center, rhs.center)), vector_add(lhs.extent, rhs.extent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms an axis aligned bounding box and returns the box that contains the result.
+	// Multiplication order is as follow: world_bounds = aabb_mul(local_bounds, local_to_world)
+	// The new extent is the old one projected on the absolute value of each matrix axis.
+	// See: Transforming Axis-Aligned Bounding Boxes (James Arvo, Graphics Gems)
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_mul(aabbf_arg0 input, matrix3x4f_arg1 transform) RTM_NO_EXCEPT
+	{
+		const vector4f center = matrix_mul_point3(input.center, transform);
+
+		vector4f extent = vector_mul(vector_dup_x(input.extent), vector_abs(transform.x_axis));
+		extent = vector_mul_add(vector_dup_y(input.extent), vector_abs(transform.y_axis), extent);
+		extent = vector_mul_add(vector_dup_z(input.extent), vector_abs(transform.z_axis), extent);
+
+		return aabbf{ center, extent };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms an axis aligned bounding box and returns the box that contains the result.
+	// Multiplication order is as follow: world_bounds = aabb_mul(local_bounds, local_to_world)
+	// Negative scale is supported, the sign of the axes does not matter.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_mul(aabbf_arg0 input, qvvf_arg1 transform) RTM_NO_EXCEPT
+	{
+		return aabb_mul(input, matrix_from_qvv(transform));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms an axis aligned bounding box and returns the box that contains the result.
+	// Multiplication order is as follow: world_bounds = aabb_mul(local_bounds, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_mul(aabbf_arg0 input, qvsf_arg1 transform) RTM_NO_EXCEPT
+	{
+		return aabb_mul(input, matrix_from_qvs(transform));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,199 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/aabbf.h"
+#include "rtm/scalarf.h"
+#include "rtm/spheref.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Reduces 8 3D points stored as structure of arrays into a single point.
+		// Each lane of the result holds the smallest component over the 8 points.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL aabb_reduce_min(vector3x8f_arg0 input) RTM_NO_EXCEPT
+		{
+			vector4f x = vector_min(vector_get_low(input.x), vector_get_high(input.x));
+			vector4f y = vector_min(vector_get_low(input.y), vector_get_high(input.y));
+			vector4f z = vector_min(vector_get_low(input.z), vector_get_high(input.z));
+			vector4f w = z;
+
+			// Once transposed, every vector holds one point and its [w] is a duplicate of [z]
+			vector_transpose4x4(x, y, z, w);
+			return vector_min(vector_min(x, y), vector_min(z, w));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reduces 8 3D points stored as structure of arrays into a single point.
+		// Each lane of the result holds the largest component over the 8 points.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL aabb_reduce_max(vector3x8f_arg0 input) RTM_NO_EXCEPT
+		{
+			vector4f x = vector_max(vector_get_low(input.x), vector_get_high(input.x));
+			vector4f y = vector_max(vector_get_low(input.y), vector_get_high(input.y));
+			vector4f z = vector_max(vector_get_low(input.z), vector_get_high(input.z));
+			vector4f w = z;
+
+			vector_transpose4x4(x, y, z, w);
+			return vector_max(vector_max(x, y), vector_max(z, w));
+		}
+
+		inline void RTM_SIMD_CALL aabb_accumulate(vector3x8f_arg0 points, vector3x8f& min_points, vector3x8f& max_points) RTM_NO_EXCEPT
+		{
+			min_points.x = vector_min(min_points.x, points.x);
+			min_points.y = vector_min(min_points.y, points.y);
+			min_points.z = vector_min(min_points.z, points.z);
+			max_points.x = vector_max(max_points.x, points.x);
+			max_points.y = vector_max(max_points.y, points.y);
+			max_points.z = vector_max(max_points.z, points.z);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest axis aligned bounding box that contains 'num_points' packed 3D points.
+	// Points are deinterleaved and reduced 8 at a time, each component in its own accumulator.
+	// The input does not need to be aligned and it must hold at least one point.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf aabb_from_points(const float3f* points, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::aabb_from_points", num_points, num_points * sizeof(float3f));
+		RTM_ASSERT(num_points != 0, "At least one point is required");
+
+		vector4f min_point = vector_load3(points);
+		vector4f max_point = min_point;
+		uint32_t point_index = 0;
+
+		if (num_points >= 8)
+		{
+			vector3x8f min_points = vector3x8_load(points);
+			vector3x8f max_points = min_points;
+
+			for (point_index = 8; point_index + 8 <= num_points; point_index += 8)
+				rtm_impl::aabb_accumulate(vector3x8_load(points + point_index), min_points, max_points);
+
+			min_point = rtm_impl::aabb_reduce_min(min_points);
+			max_point = rtm_impl::aabb_reduce_max(max_points);
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const vector4f point = vector_load3(points + point_index);
+			min_point = vector_min(min_point, point);
+			max_point = vector_max(max_point, point);
+		}
+
+		return aabb_from_min_max(min_point, max_point);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest axis aligned bounding box that contains 'num_points' 3D points
+	// stored as structure of arrays. Points are reduced 8 at a time.
+	// The input must hold at least one point.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf aabb_from_points_soa(const const_float3f_soa& points, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::aabb_from_points_soa", num_points, num_points * sizeof(float) * 3);
+		RTM_ASSERT(num_points != 0, "At least one point is required");
+
+		vector4f min_point = vector_set(points.x[0], points.y[0], points.z[0]);
+		vector4f max_point = min_point;
+		uint32_t point_index = 0;
+
+		if (num_points >= 8)
+		{
+			vector3x8f min_points = vector3x8_load(points, 0);
+			vector3x8f max_points = min_points;
+
+			for (point_index = 8; point_index + 8 <= num_points; point_index += 8)
+				rtm_impl::aabb_accumulate(vector3x8_load(points, point_index), min_points, max_points);
+
+			min_point = rtm_impl::aabb_reduce_min(min_points);
+			max_point = rtm_impl::aabb_reduce_max(max_points);
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const vector4f point = vector_set(points.x[point_index], points.y[point_index], points.z[point_index]);
+			min_point = vector_min(min_point, point);
+			max_point = vector_max(max_point, point);
+		}
+
+		return aabb_from_min_max(min_point, max_point);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a bounding sphere that contains 'num_points' packed 3D points.
+	// The sphere is centered on the bounding box of the points and its radius is the distance
+	// to the farthest point. It is never larger than the sphere around that bounding box but
+	// it is not the minimal bounding sphere.
+	// The input does not need to be aligned and it must hold at least one point.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref sphere_from_points(const float3f* points, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::sphere_from_points", num_points, num_points * sizeof(float3f));
+		const aabbf bounds = aabb_from_points(points, num_points);
+		const vector4f center = bounds.center;
+
+		float max_distance_sq = 0.0F;
+		uint32_t point_index = 0;
+
+		if (num_points >= 8)
+		{
+			const vector3x8f center8 = vector3x8f{ vector8_set(float(vector_get_x(center))), vector8_set(float(vector_get_y(center))), vector8_set(float(vector_get_z(center))) };
+			vector8f max_distances_sq = vector8_zero();
+
+			for (; point_index + 8 <= num_points; point_index += 8)
+			{
+				const vector8f distance_sq = vector_length_squared3(vector_sub(vector3x8_load(points + point_index), center8));
+				max_distances_sq = vector_max(max_distances_sq, distance_sq);
+			}
+
+			const vector4f max_distance_sq4 = vector_max(vector_get_low(max_distances_sq), vector_get_high(max_distances_sq));
+			max_distance_sq = scalar_max(scalar_max(float(vector_get_x(max_distance_sq4)), float(vector_get_y(max_distance_sq4))), scalar_max(float(vector_get_z(max_distance_sq4)), float(vector_get_w(max_distance_sq4))));
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const float distance_sq = vector_length_squared3(vector_sub(vector_load3(points + point_index), center));
+			max_distance_sq = scalar_max(max_distance_sq, distance_sq);
+		}
+
+		return sphere_set(center, scalar_sqrt(max_distance_sq));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,349 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/quat8f.h"
+#include "rtm/quatf.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/batch/qvvf.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Number of QVV transforms per array of structures of arrays block.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint32_t k_qvv_aosoa_width = 8;
+
+	//////////////////////////////////////////////////////////////////////////
+	// 8 QVV transforms stored as an array of structures of arrays (AoSoA) block:
+	// each of the 10 components holds 8 lanes. A block is 320 bytes, exactly 5 cache lines.
+	// Batch kernels load every component with a single 8 wide load while accessing one
+	// transform at random only touches its block.
+	// Arrays of blocks hold every transform, the unused lanes of the last block are padding.
+	//////////////////////////////////////////////////////////////////////////
+	struct alignas(64) qvvf_aosoa8
+	{
+		float rotation_x[k_qvv_aosoa_width];
+		float rotation_y[k_qvv_aosoa_width];
+		float rotation_z[k_qvv_aosoa_width];
+		float rotation_w[k_qvv_aosoa_width];
+		float translation_x[k_qvv_aosoa_width];
+		float translation_y[k_qvv_aosoa_width];
+		float translation_z[k_qvv_aosoa_width];
+		float scale_x[k_qvv_aosoa_width];
+		float scale_y[k_qvv_aosoa_width];
+		float scale_z[k_qvv_aosoa_width];
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of blocks needed to hold 'num_transforms' QVV transforms.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint32_t qvv_aosoa_num_blocks(uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		return (num_transforms + k_qvv_aosoa_width - 1) / k_qvv_aosoa_width;
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// 8 QVV transforms stored as structure of arrays, one 8 wide register per component.
+		//////////////////////////////////////////////////////////////////////////
+		struct qvvf_soa8
+		{
+			quat8f rotation;
+			vector3x8f translation;
+			vector3x8f scale;
+		};
+
+		inline qvvf_soa8 qvv_load_aosoa8(const qvvf_aosoa8& input) RTM_NO_EXCEPT
+		{
+			qvvf_soa8 result;
+			result.rotation = quat8f{ vector8_load(input.rotation_x), vector8_load(input.rotation_y), vector8_load(input.rotation_z), vector8_load(input.rotation_w) };
+			result.translation = vector3x8f{ vector8_load(input.translation_x), vector8_load(input.translation_y), vector8_load(input.translation_z) };
+			result.scale = vector3x8f{ vector8_load(input.scale_x), vector8_load(input.scale_y), vector8_load(input.scale_z) };
+			return result;
+		}
+
+		inline void qvv_store_aosoa8(const qvvf_soa8& input, qvvf_aosoa8& output) RTM_NO_EXCEPT
+		{
+			vector_store(input.rotation.x, output.rotation_x);
+			vector_store(input.rotation.y, output.rotation_y);
+			vector_store(input.rotation.z, output.rotation_z);
+			vector_store(input.rotation.w, output.rotation_w);
+			vector_store(input.translation.x, output.translation_x);
+			vector_store(input.translation.y, output.translation_y);
+			vector_store(input.translation.z, output.translation_z);
+			vector_store(input.scale.x, output.scale_x);
+			vector_store(input.scale.y, output.scale_y);
+			vector_store(input.scale.z, output.scale_z);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads and stores the 4 lanes of a block starting at 'lane_offset' (0 or 4).
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_load_aosoa4(const qvvf_aosoa8& input, uint32_t lane_offset) RTM_NO_EXCEPT
+		{
+			qvvf_soa4 result;
+			result.rotation_x = vector_load(input.rotation_x + lane_offset);
+			result.rotation_y = vector_load(input.rotation_y + lane_offset);
+			result.rotation_z = vector_load(input.rotation_z + lane_offset);
+			result.rotation_w = vector_load(input.rotation_w + lane_offset);
+			result.translation_x = vector_load(input.translation_x + lane_offset);
+			result.translation_y = vector_load(input.translation_y + lane_offset);
+			result.translation_z = vector_load(input.translation_z + lane_offset);
+			result.scale_x = vector_load(input.scale_x + lane_offset);
+			result.scale_y = vector_load(input.scale_y + lane_offset);
+			result.scale_z = vector_load(input.scale_z + lane_offset);
+			return result;
+		}
+
+		inline void qvv_store_aosoa4(const qvvf_soa4& input, qvvf_aosoa8& output, uint32_t lane_offset) RTM_NO_EXCEPT
+		{
+			vector_store(input.rotation_x, output.rotation_x + lane_offset);
+			vector_store(input.rotation_y, output.rotation_y + lane_offset);
+			vector_store(input.rotation_z, output.rotation_z + lane_offset);
+			vector_store(input.rotation_w, output.rotation_w + lane_offset);
+			vector_store(input.translation_x, output.translation_x + lane_offset);
+			vector_store(input.translation_y, output.translation_y + lane_offset);
+			vector_store(input.translation_z, output.translation_z + lane_offset);
+			vector_store(input.scale_x, output.scale_x + lane_offset);
+			vector_store(input.scale_y, output.scale_y + lane_offset);
+			vector_store(input.scale_z, output.scale_z + lane_offset);
+		}
+
+		inline bool qvv_aosoa_any_negative_scale(const qvvf_aosoa8* transforms, uint32_t num_blocks) RTM_NO_EXCEPT
+		{
+			vector8f min_scale = vector8_set(1.0F);
+			for (uint32_t block_index = 0; block_index < num_blocks; ++block_index)
+			{
+				const qvvf_aosoa8& block = transforms[block_index];
+				min_scale = vector_min(min_scale, vector_min(vector8_load(block.scale_x), vector_min(vector8_load(block.scale_y), vector8_load(block.scale_z))));
+			}
+
+			return mask_any_true(vector_less_than(min_scale, vector8_zero()));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the QVV transform at 'transform_index' from an array of blocks.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf qvv_aosoa_get(const qvvf_aosoa8* transforms, uint32_t transform_index) RTM_NO_EXCEPT
+	{
+		const qvvf_aosoa8& block = transforms[transform_index / k_qvv_aosoa_width];
+		const uint32_t lane_index = transform_index % k_qvv_aosoa_width;
+
+		const quatf rotation = quat_set(block.rotation_x[lane_index], block.rotation_y[lane_index], block.rotation_z[lane_index], block.rotation_w[lane_index]);
+		const vector4f translation = vector_set(block.translation_x[lane_index], block.translation_y[lane_index], block.translation_z[lane_index], 0.0F);
+		const vector4f scale = vector_set(block.scale_x[lane_index], block.scale_y[lane_index], block.scale_z[lane_index], 0.0F);
+		return qvv_set(rotation, translation, scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the QVV transform at 'transform_index' in an array of blocks.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_aosoa_set(qvvf_aosoa8* transforms, uint32_t transform_index, qvvf_arg0 transform) RTM_NO_EXCEPT
+	{
+		qvvf_aosoa8& block = transforms[transform_index / k_qvv_aosoa_width];
+		const uint32_t lane_index = transform_index % k_qvv_aosoa_width;
+
+		block.rotation_x[lane_index] = quat_get_x(transform.rotation);
+		block.rotation_y[lane_index] = quat_get_y(transform.rotation);
+		block.rotation_z[lane_index] = quat_get_z(transform.rotation);
+		block.rotation_w[lane_index] = quat_get_w(transform.rotation);
+		block.translation_x[lane_index] = vector_get_x(transform.translation);
+		block.translation_y[lane_index] = vector_get_y(transform.translation);
+		block.translation_z[lane_index] = vector_get_z(transform.translation);
+		block.scale_x[lane_index] = vector_get_x(transform.scale);
+		block.scale_y[lane_index] = vector_get_y(transform.scale);
+		block.scale_z[lane_index] = vector_get_z(transform.scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_transforms' QVV transforms into qvv_aosoa_num_blocks(num_transforms) blocks.
+	// The padding lanes of the last block are set to the identity transform.
+	// Transforms are transposed 4 at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_pack_aosoa(const qvvf* input, uint32_t num_transforms, qvvf_aosoa8* output) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_pack_aosoa", num_transforms, num_transforms * sizeof(float) * 20);
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 qvv4 = rtm_impl::qvv_gather4(input[transform_index + 0], input[transform_index + 1], input[transform_index + 2], input[transform_index + 3], true);
+			rtm_impl::qvv_store_aosoa4(qvv4, output[transform_index / k_qvv_aosoa_width], transform_index % k_qvv_aosoa_width);
+		}
+
+		const uint32_t padded_size = qvv_aosoa_num_blocks(num_transforms) * k_qvv_aosoa_width;
+		for (; transform_index < padded_size; ++transform_index)
+			qvv_aosoa_set(output, transform_index, transform_index < num_transforms ? input[transform_index] : qvv_identity());
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_transforms' QVV transforms from an array of blocks.
+	// Transforms are transposed 4 at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_unpack_aosoa(const qvvf_aosoa8* input, uint32_t num_transforms, qvvf* output) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_unpack_aosoa", num_transforms, num_transforms * sizeof(float) * 20);
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 qvv4 = rtm_impl::qvv_load_aosoa4(input[transform_index / k_qvv_aosoa_width], transform_index % k_qvv_aosoa_width);
+			rtm_impl::qvv_scatter4(qvv4, output[transform_index + 0], output[transform_index + 1], output[transform_index + 2], output[transform_index + 3]);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+			output[transform_index] = qvv_aosoa_get(input, transform_index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_transforms' pairs of QVV transforms stored as blocks:
+	// output[i] = qvv_mul(lhs[i], rhs[i]).
+	// Whole blocks are processed, padding lanes included, 8 at a time when no scale is
+	// negative. Otherwise, the matrix code path of qvv_mul is blended in 4 lanes at a time
+	// like qvv_mul_aos. Zero scale is not supported.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_aosoa(const qvvf_aosoa8* lhs, const qvvf_aosoa8* rhs, qvvf_aosoa8* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_aosoa", num_transforms, num_transforms * sizeof(float) * 30);
+
+		const uint32_t num_blocks = qvv_aosoa_num_blocks(num_transforms);
+		if (rtm_impl::qvv_aosoa_any_negative_scale(lhs, num_blocks) || rtm_impl::qvv_aosoa_any_negative_scale(rhs, num_blocks))
+		{
+			for (uint32_t block_index = 0; block_index < num_blocks; ++block_index)
+			{
+				for (uint32_t lane_offset = 0; lane_offset < k_qvv_aosoa_width; lane_offset += 4)
+				{
+					const rtm_impl::qvvf_soa4 lhs4 = rtm_impl::qvv_load_aosoa4(lhs[block_index], lane_offset);
+					const rtm_impl::qvvf_soa4 rhs4 = rtm_impl::qvv_load_aosoa4(rhs[block_index], lane_offset);
+					rtm_impl::qvv_store_aosoa4(rtm_impl::qvv_mul_signed_scale_soa4(lhs4, rhs4), output[block_index], lane_offset);
+				}
+			}
+
+			return;
+		}
+
+		for (uint32_t block_index = 0; block_index < num_blocks; ++block_index)
+		{
+			const rtm_impl::qvvf_soa8 lhs8 = rtm_impl::qvv_load_aosoa8(lhs[block_index]);
+			const rtm_impl::qvvf_soa8 rhs8 = rtm_impl::qvv_load_aosoa8(rhs[block_index]);
+
+			rtm_impl::qvvf_soa8 result;
+			result.rotation = quat_mul(lhs8.rotation, rhs8.rotation);
+			result.translation = vector_add(quat_mul_vector3(vector_mul(lhs8.translation, rhs8.scale), rhs8.rotation), rhs8.translation);
+			result.scale = vector_mul(lhs8.scale, rhs8.scale);
+			rtm_impl::qvv_store_aosoa8(result, output[block_index]);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_transforms' pairs of QVV transforms stored as blocks ignoring 3D scale:
+	// output[i] = qvv_mul_no_scale(lhs[i], rhs[i]).
+	// The resulting QVV transforms have a [1,1,1] 3D scale.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_no_scale_aosoa(const qvvf_aosoa8* lhs, const qvvf_aosoa8* rhs, qvvf_aosoa8* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_no_scale_aosoa", num_transforms, num_transforms * sizeof(float) * 30);
+
+		const uint32_t num_blocks = qvv_aosoa_num_blocks(num_transforms);
+		const vector8f one = vector8_set(1.0F);
+
+		for (uint32_t block_index = 0; block_index < num_blocks; ++block_index)
+		{
+			const rtm_impl::qvvf_soa8 lhs8 = rtm_impl::qvv_load_aosoa8(lhs[block_index]);
+			const rtm_impl::qvvf_soa8 rhs8 = rtm_impl::qvv_load_aosoa8(rhs[block_index]);
+
+			rtm_impl::qvvf_soa8 result;
+			result.rotation = quat_mul(lhs8.rotation, rhs8.rotation);
+			result.translation = vector_add(quat_mul_vector3(lhs8.translation, rhs8.rotation), rhs8.translation);
+			result.scale = vector3x8f{ one, one, one };
+			rtm_impl::qvv_store_aosoa8(result, output[block_index]);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverts 'num_transforms' QVV transforms stored as blocks: output[i] = qvv_inverse(input[i]).
+	// Whole blocks are processed 8 at a time, padding lanes included. Zero scale is not supported.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_inverse_aosoa(const qvvf_aosoa8* input, qvvf_aosoa8* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_inverse_aosoa", num_transforms, num_transforms * sizeof(float) * 20);
+
+		const uint32_t num_blocks = qvv_aosoa_num_blocks(num_transforms);
+		for (uint32_t block_index = 0; block_index < num_blocks; ++block_index)
+		{
+			const rtm_impl::qvvf_soa8 input8 = rtm_impl::qvv_load_aosoa8(input[block_index]);
+
+			rtm_impl::qvvf_soa8 result;
+			result.rotation = quat_conjugate(input8.rotation);
+			result.scale = vector3x8f{ vector_reciprocal(input8.scale.x), vector_reciprocal(input8.scale.y), vector_reciprocal(input8.scale.z) };
+
+			const vector3x8f rotated_translation = quat_mul_vector3(vector_mul(input8.translation, result.scale), result.rotation);
+			result.translation = vector3x8f{ vector_neg(rotated_translation.x), vector_neg(rotated_translation.y), vector_neg(rotated_translation.z) };
+			rtm_impl::qvv_store_aosoa8(result, output[block_index]);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'num_points' 3D points, each by its matching QVV transform stored as blocks:
+	// output[i] = qvv_mul_point3(points[i], transforms[i]).
+	// Points are processed 8 at a time with a scalar remainder.
+	// The output can safely alias the input points.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_point3_aosoa(const qvvf_aosoa8* transforms, const float3f* points, float3f* output, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_point3_aosoa", num_points, num_points * sizeof(float) * 16);
+
+		uint32_t point_index = 0;
+		for (; point_index + k_qvv_aosoa_width <= num_points; point_index += k_qvv_aosoa_width)
+		{
+			const rtm_impl::qvvf_soa8 transform8 = rtm_impl::qvv_load_aosoa8(transforms[point_index / k_qvv_aosoa_width]);
+			const vector3x8f points8 = vector3x8_load(points + point_index);
+			const vector3x8f result = vector_add(quat_mul_vector3(vector_mul(transform8.scale, points8), transform8.rotation), transform8.translation);
+			vector_store(result, output + point_index);
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const vector4f point = vector_load3(points + point_index);
+			vector_store3(qvv_mul_point3(point, qvv_aosoa_get(transforms, point_index)), output + point_index);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,565 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4f.h"
+#include "rtm/batch/qvvf.h"
+#include "rtm/batch/range.h"
+#include "rtm/batch/soa.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// A pose archive is a binary container of transform and sample blocks laid out the way
+	// the batch functions consume them. Once loaded or memory mapped, the blocks are used
+	// in place: there is nothing to parse nor to convert.
+	//
+	// Layout, every offset is relative to the start of the archive:
+	//    archive_header          64 bytes
+	//    archive_block[N]        72 bytes each
+	//    block data              every block starts on 64 bytes
+	//
+	// Structure of arrays blocks store each stream padded to 64 bytes with the padding
+	// zeroed (the identity transform for qvvf_soa blocks). The archive is little endian,
+	// the header magic does not match when read on a big endian platform.
+	//////////////////////////////////////////////////////////////////////////
+
+	constexpr uint32_t k_archive_magic = 0x414D5452;	// 'RTMA'
+	constexpr uint32_t k_archive_version = 1;
+
+	//////////////////////////////////////////////////////////////////////////
+	// The archive and every block in it are aligned to a cache line.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr size_t k_archive_alignment = 64;
+
+	//////////////////////////////////////////////////////////////////////////
+	// How the data of a block is laid out.
+	//////////////////////////////////////////////////////////////////////////
+	enum class archive_block_layout : uint32_t
+	{
+		float3f_soa = 0,		// 3 float streams, see const_float3f_soa
+		float4f_soa = 1,		// 4 float streams, see const_float4f_soa
+		qvvf_soa = 2,			// 10 float streams: rotation [xyzw], translation [xyz], scale [xyz]
+		qvvf_aos = 3,			// An array of qvvf
+		qvvf_packed_aos = 4,	// An array of qvvf_packed
+		quantized3_soa = 5,		// 3 uint16 streams quantized with pack_range_reduce_unorm_soa
+		quantized4_soa = 6,		// 4 uint16 streams quantized with pack_range_reduce_unorm_soa
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// The reasons an archive can be rejected when it is opened.
+	//////////////////////////////////////////////////////////////////////////
+	enum class archive_error
+	{
+		none,
+		misaligned,				// The buffer is not aligned to k_archive_alignment
+		truncated,				// The buffer is smaller than the archive
+		invalid_magic,			// Not an archive or not little endian
+		unsupported_version,
+		invalid_block,			// A block is out of bounds, misaligned, or has an unknown layout
+	};
+
+	struct archive_header
+	{
+		uint32_t magic;
+		uint32_t version;
+		uint64_t size;				// The size of the whole archive in bytes
+		uint32_t num_blocks;
+		uint32_t reserved[11];
+	};
+
+	struct archive_block
+	{
+		uint32_t id;				// Chosen by the writer, e.g. a hash of the block name
+		archive_block_layout layout;
+		uint32_t num_elements;
+		uint32_t stream_stride;		// The number of entries between two streams, 0 for arrays
+		uint64_t offset;
+		uint64_t size;
+		uint32_t num_bits;			// Quantized blocks only, 0 otherwise
+		uint32_t reserved;
+		float range_min[4];			// Quantized blocks only
+		float range_extent[4];		// Quantized blocks only
+	};
+
+	static_assert(sizeof(archive_header) == 64, "Unexpected archive header size");
+	static_assert(sizeof(archive_block) == 72, "Unexpected archive block size");
+
+	namespace rtm_impl
+	{
+		constexpr uint32_t archive_get_num_streams(archive_block_layout layout) RTM_NO_EXCEPT
+		{
+			return layout == archive_block_layout::float3f_soa || layout == archive_block_layout::quantized3_soa ? 3
+				: layout == archive_block_layout::float4f_soa || layout == archive_block_layout::quantized4_soa ? 4
+				: layout == archive_block_layout::qvvf_soa ? 10
+				: 0;
+		}
+
+		constexpr bool archive_is_quantized(archive_block_layout layout) RTM_NO_EXCEPT
+		{
+			return layout == archive_block_layout::quantized3_soa || layout == archive_block_layout::quantized4_soa;
+		}
+
+		constexpr bool archive_is_layout_valid(uint32_t layout) RTM_NO_EXCEPT
+		{
+			return layout <= uint32_t(archive_block_layout::quantized4_soa);
+		}
+
+		inline void archive_copy_stream(const float* input, uint32_t num_elements, uint32_t stream_stride, float padding_value, float* output) RTM_NO_EXCEPT
+		{
+			std::memcpy(output, input, num_elements * sizeof(float));
+			for (uint32_t element_index = num_elements; element_index < stream_stride; ++element_index)
+				output[element_index] = padding_value;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of entries between two streams of a structure of arrays block:
+	// every stream starts on k_archive_alignment. Arrays of structures have no streams, 0 is returned.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint32_t archive_get_stream_stride(archive_block_layout layout, uint32_t num_elements) RTM_NO_EXCEPT
+	{
+		return rtm_impl::archive_is_quantized(layout) ? ((num_elements + 31) / 32) * 32
+			: rtm_impl::archive_get_num_streams(layout) != 0 ? soa_padded_size(num_elements)
+			: 0;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the size in bytes of the data of a block, padding included.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint64_t archive_get_block_size(archive_block_layout layout, uint32_t num_elements) RTM_NO_EXCEPT
+	{
+		return layout == archive_block_layout::qvvf_aos ? ((uint64_t(num_elements) * sizeof(qvvf) + k_archive_alignment - 1) & ~uint64_t(k_archive_alignment - 1))
+			: layout == archive_block_layout::qvvf_packed_aos ? ((uint64_t(num_elements) * sizeof(qvvf_packed) + k_archive_alignment - 1) & ~uint64_t(k_archive_alignment - 1))
+			: uint64_t(archive_get_stream_stride(layout, num_elements)) * rtm_impl::archive_get_num_streams(layout) * (rtm_impl::archive_is_quantized(layout) ? sizeof(uint16_t) : sizeof(float));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the size in bytes of the header and block table of an archive of 'num_blocks' blocks.
+	// The data of the first block follows.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint64_t archive_get_header_size(uint32_t num_blocks) RTM_NO_EXCEPT
+	{
+		return (sizeof(archive_header) + uint64_t(num_blocks) * sizeof(archive_block) + k_archive_alignment - 1) & ~uint64_t(k_archive_alignment - 1);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the range minimum and extent of a quantized block, as expected by unpack_range_expand_unorm_soa.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f archive_get_range_min(const archive_block& block) RTM_NO_EXCEPT
+	{
+		return vector_load(&block.range_min[0]);
+	}
+
+	inline vector4f archive_get_range_extent(const archive_block& block) RTM_NO_EXCEPT
+	{
+		return vector_load(&block.range_extent[0]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes an archive into a caller provided buffer aligned to k_archive_alignment.
+	// The number of blocks is reserved up front to place the block table, fewer can be added.
+	// The buffer must hold archive_get_header_size(max_num_blocks) plus the archive_get_block_size(..)
+	// of every block: adding a block that does not fit returns false and leaves the archive unchanged.
+	// Call finalize() once every block is added, the buffer then holds the archive.
+	//////////////////////////////////////////////////////////////////////////
+	class archive_writer
+	{
+	public:
+		archive_writer(void* buffer, size_t buffer_size, uint32_t max_num_blocks) RTM_NO_EXCEPT
+			: m_buffer(static_cast<uint8_t*>(buffer))
+			, m_buffer_size(buffer_size)
+			, m_size(archive_get_header_size(max_num_blocks))
+			, m_max_num_blocks(max_num_blocks)
+			, m_num_blocks(0)
+		{
+			RTM_ASSERT(rtm_impl::is_aligned_to(buffer, k_archive_alignment), "The archive buffer must be aligned to 64 bytes");
+			RTM_ASSERT(m_size <= buffer_size, "The buffer is too small for the block table");
+		}
+
+		archive_writer(const archive_writer&) = delete;
+		archive_writer& operator=(const archive_writer&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Adds 'num_elements' samples stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		bool add_float3f_soa(uint32_t id, const const_float3f_soa& input, uint32_t num_elements) RTM_NO_EXCEPT
+		{
+			archive_block* block = add_block(id, archive_block_layout::float3f_soa, num_elements);
+			if (block == nullptr)
+				return false;
+
+			float* streams = reinterpret_cast<float*>(m_buffer + block->offset);
+			const uint32_t stream_stride = block->stream_stride;
+			rtm_impl::archive_copy_stream(input.x, num_elements, stream_stride, 0.0F, streams);
+			rtm_impl::archive_copy_stream(input.y, num_elements, stream_stride, 0.0F, streams + stream_stride);
+			rtm_impl::archive_copy_stream(input.z, num_elements, stream_stride, 0.0F, streams + stream_stride * 2);
+			return true;
+		}
+
+		bool add_float4f_soa(uint32_t id, const const_float4f_soa& input, uint32_t num_elements) RTM_NO_EXCEPT
+		{
+			archive_block* block = add_block(id, archive_block_layout::float4f_soa, num_elements);
+			if (block == nullptr)
+				return false;
+
+			float* streams = reinterpret_cast<float*>(m_buffer + block->offset);
+			const uint32_t stream_stride = block->stream_stride;
+			rtm_impl::archive_copy_stream(input.x, num_elements, stream_stride, 0.0F, streams);
+			rtm_impl::archive_copy_stream(input.y, num_elements, stream_stride, 0.0F, streams + stream_stride);
+			rtm_impl::archive_copy_stream(input.z, num_elements, stream_stride, 0.0F, streams + stream_stride * 2);
+			rtm_impl::archive_copy_stream(input.w, num_elements, stream_stride, 0.0F, streams + stream_stride * 3);
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Adds 'num_elements' QVV transforms transposed into structure of arrays streams.
+		//////////////////////////////////////////////////////////////////////////
+		bool add_qvvf_soa(uint32_t id, const qvvf* input, uint32_t num_elements) RTM_NO_EXCEPT
+		{
+			archive_block* block = add_block(id, archive_block_layout::qvvf_soa, num_elements);
+			if (block == nullptr)
+				return false;
+
+			soa_pack(input, num_elements, get_qvvf_soa_streams(*block));
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Adds an array of 'num_elements' QVV transforms, as is or packed without their padding.
+		//////////////////////////////////////////////////////////////////////////
+		bool add_qvvf_array(uint32_t id, const qvvf* input, uint32_t num_elements) RTM_NO_EXCEPT
+		{
+			archive_block* block = add_block(id, archive_block_layout::qvvf_aos, num_elements);
+			if (block == nullptr)
+				return false;
+
+			std::memcpy(m_buffer + block->offset, input, num_elements * sizeof(qvvf));
+			return true;
+		}
+
+		bool add_qvvf_packed_array(uint32_t id, const qvvf* input, uint32_t num_elements) RTM_NO_EXCEPT
+		{
+			archive_block* block = add_block(id, archive_block_layout::qvvf_packed_aos, num_elements);
+			if (block == nullptr)
+				return false;
+
+			qvv_store_array(input, reinterpret_cast<qvvf_packed*>(m_buffer + block->offset), num_elements);
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Adds 'num_elements' samples stored as structure of arrays quantized on 'num_bits' bits
+		// (between 1 and 16) over their range. The range is stored in the block.
+		//////////////////////////////////////////////////////////////////////////
+		bool add_quantized_soa(uint32_t id, const const_float3f_soa& input, uint32_t num_elements, uint32_t num_bits) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(num_bits >= 1 && num_bits <= 16, "The number of bits must be between 1 and 16");
+
+			archive_block* block = add_block(id, archive_block_layout::quantized3_soa, num_elements);
+			if (block == nullptr)
+				return false;
+
+			vector4f range_min = vector_zero();
+			vector4f range_extent = vector_zero();
+			if (num_elements != 0)
+				vector_range_soa(input, num_elements, range_min, range_extent);
+
+			set_quantization(*block, num_bits, range_min, range_extent);
+			pack_range_reduce_unorm_soa(input, range_min, range_extent, num_bits, get_quantized_streams(*block), num_elements);
+			return true;
+		}
+
+		bool add_quantized_soa(uint32_t id, const const_float4f_soa& input, uint32_t num_elements, uint32_t num_bits) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(num_bits >= 1 && num_bits <= 16, "The number of bits must be between 1 and 16");
+
+			archive_block* block = add_block(id, archive_block_layout::quantized4_soa, num_elements);
+			if (block == nullptr)
+				return false;
+
+			vector4f range_min = vector_zero();
+			vector4f range_extent = vector_zero();
+			if (num_elements != 0)
+				vector_range_soa(input, num_elements, range_min, range_extent);
+
+			set_quantization(*block, num_bits, range_min, range_extent);
+			pack_range_reduce_unorm_soa(input, range_min, range_extent, num_bits, get_quantized_streams(*block), num_elements);
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the header and returns the size of the archive in bytes.
+		//////////////////////////////////////////////////////////////////////////
+		size_t finalize() RTM_NO_EXCEPT
+		{
+			archive_header* header = reinterpret_cast<archive_header*>(m_buffer);
+			std::memset(header, 0, sizeof(archive_header));
+			header->magic = k_archive_magic;
+			header->version = k_archive_version;
+			header->size = m_size;
+			header->num_blocks = m_num_blocks;
+
+			// The unused part of the block table is zeroed to keep the output deterministic
+			const size_t block_table_end = sizeof(archive_header) + m_num_blocks * sizeof(archive_block);
+			std::memset(m_buffer + block_table_end, 0, size_t(archive_get_header_size(m_max_num_blocks)) - block_table_end);
+
+			return size_t(m_size);
+		}
+
+		uint32_t get_num_blocks() const RTM_NO_EXCEPT { return m_num_blocks; }
+		size_t get_size() const RTM_NO_EXCEPT { return size_t(m_size); }
+
+	private:
+		archive_block* add_block(uint32_t id, archive_block_layout layout, uint32_t num_elements) RTM_NO_EXCEPT
+		{
+			const uint64_t block_size = archive_get_block_size(layout, num_elements);
+			if (m_num_blocks >= m_max_num_blocks || m_size > m_buffer_size || block_size > m_buffer_size - m_size)
+				return nullptr;
+
+			archive_block* block = reinterpret_cast<archive_block*>(m_buffer + sizeof(archive_header)) + m_num_blocks;
+			std::memset(block, 0, sizeof(archive_block));
+			block->id = id;
+			block->layout = layout;
+			block->num_elements = num_elements;
+			block->stream_stride = archive_get_stream_stride(layout, num_elements);
+			block->offset = m_size;
+			block->size = block_size;
+
+			// Arrays of structures are padded to the next block, zero it
+			const uint64_t data_size = layout == archive_block_layout::qvvf_aos ? uint64_t(num_elements) * sizeof(qvvf)
+				: layout == archive_block_layout::qvvf_packed_aos ? uint64_t(num_elements) * sizeof(qvvf_packed)
+				: block_size;
+			std::memset(m_buffer + m_size + data_size, 0, size_t(block_size - data_size));
+
+			m_num_blocks++;
+			m_size += block_size;
+			return block;
+		}
+
+		qvvf_soa get_qvvf_soa_streams(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			float* streams = reinterpret_cast<float*>(m_buffer + block.offset);
+			const uint32_t stride = block.stream_stride;
+			return qvvf_soa{
+				float4f_soa{ streams, streams + stride, streams + stride * 2, streams + stride * 3 },
+				float3f_soa{ streams + stride * 4, streams + stride * 5, streams + stride * 6 },
+				float3f_soa{ streams + stride * 7, streams + stride * 8, streams + stride * 9 } };
+		}
+
+		quantized4_soa get_quantized_streams(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			uint16_t* streams = reinterpret_cast<uint16_t*>(m_buffer + block.offset);
+			const uint32_t stride = block.stream_stride;
+
+			// The padding of every stream is zeroed, the last is only written with 4 streams
+			std::memset(streams, 0, size_t(block.size));
+			return quantized4_soa{ streams, streams + stride, streams + stride * 2, block.layout == archive_block_layout::quantized4_soa ? streams + stride * 3 : nullptr };
+		}
+
+		static void set_quantization(archive_block& block, uint32_t num_bits, vector4f_arg0 range_min, vector4f_arg1 range_extent) RTM_NO_EXCEPT
+		{
+			block.num_bits = num_bits;
+			vector_store(range_min, &block.range_min[0]);
+			vector_store(range_extent, &block.range_extent[0]);
+		}
+
+		uint8_t*	m_buffer;
+		size_t		m_buffer_size;
+		uint64_t	m_size;
+		uint32_t	m_max_num_blocks;
+		uint32_t	m_num_blocks;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Reads an archive in place, typically from a memory mapped file (see rtm/batch/archive_file.h).
+	// Opening an archive validates its header and block table, the data is never read nor
+	// copied: the views returned point into the buffer and are used directly by the batch
+	// functions. The buffer must outlive the reader.
+	//////////////////////////////////////////////////////////////////////////
+	class archive_reader
+	{
+	public:
+		archive_reader() RTM_NO_EXCEPT
+			: m_buffer(nullptr)
+			, m_num_blocks(0)
+		{}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Validates the archive stored in a buffer aligned to k_archive_alignment.
+		// On failure, the reader is left closed.
+		//////////////////////////////////////////////////////////////////////////
+		archive_error open(const void* buffer, size_t buffer_size) RTM_NO_EXCEPT
+		{
+			m_buffer = nullptr;
+			m_num_blocks = 0;
+
+			if (!rtm_impl::is_aligned_to(buffer, k_archive_alignment))
+				return archive_error::misaligned;
+
+			if (buffer_size < sizeof(archive_header))
+				return archive_error::truncated;
+
+			const archive_header* header = static_cast<const archive_header*>(buffer);
+			if (header->magic != k_archive_magic)
+				return archive_error::invalid_magic;
+
+			if (header->version != k_archive_version)
+				return archive_error::unsupported_version;
+
+			const uint64_t header_size = archive_get_header_size(header->num_blocks);
+			if (header->size > buffer_size || header_size > header->size)
+				return archive_error::truncated;
+
+			const archive_block* blocks = reinterpret_cast<const archive_block*>(header + 1);
+			for (uint32_t block_index = 0; block_index < header->num_blocks; ++block_index)
+			{
+				const archive_block& block = blocks[block_index];
+				if (!rtm_impl::archive_is_layout_valid(uint32_t(block.layout)))
+					return archive_error::invalid_block;
+
+				const bool is_in_bounds = block.offset >= header_size && block.offset <= header->size && block.size <= header->size - block.offset;
+				const bool is_aligned = (block.offset % k_archive_alignment) == 0;
+				const bool is_size_valid = block.size >= archive_get_block_size(block.layout, block.num_elements) && block.stream_stride == archive_get_stream_stride(block.layout, block.num_elements);
+				const bool is_quantization_valid = !rtm_impl::archive_is_quantized(block.layout) || (block.num_bits >= 1 && block.num_bits <= 16);
+				if (!is_in_bounds || !is_aligned || !is_size_valid || !is_quantization_valid)
+					return archive_error::invalid_block;
+			}
+
+			m_buffer = static_cast<const uint8_t*>(buffer);
+			m_num_blocks = header->num_blocks;
+			return archive_error::none;
+		}
+
+		bool is_open() const RTM_NO_EXCEPT { return m_buffer != nullptr; }
+		uint32_t get_num_blocks() const RTM_NO_EXCEPT { return m_num_blocks; }
+
+		const archive_block& get_block(uint32_t block_index) const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(block_index < m_num_blocks, "Invalid block index");
+			return get_blocks()[block_index];
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the first block with the provided identifier or nullptr.
+		//////////////////////////////////////////////////////////////////////////
+		const archive_block* find_block(uint32_t id) const RTM_NO_EXCEPT
+		{
+			const archive_block* blocks = get_blocks();
+			for (uint32_t block_index = 0; block_index < m_num_blocks; ++block_index)
+			{
+				if (blocks[block_index].id == id)
+					return &blocks[block_index];
+			}
+
+			return nullptr;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns views over the data of a block, its layout must match.
+		// Structure of arrays streams hold block.stream_stride entries: kernels can
+		// process them in groups of 16 without a remainder.
+		//////////////////////////////////////////////////////////////////////////
+		const_float3f_soa get_float3f_soa(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(block.layout == archive_block_layout::float3f_soa, "Unexpected block layout");
+			const float* streams = get_data<float>(block);
+			return const_float3f_soa{ streams, streams + block.stream_stride, streams + block.stream_stride * 2 };
+		}
+
+		const_float4f_soa get_float4f_soa(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(block.layout == archive_block_layout::float4f_soa, "Unexpected block layout");
+			const float* streams = get_data<float>(block);
+			return const_float4f_soa{ streams, streams + block.stream_stride, streams + block.stream_stride * 2, streams + block.stream_stride * 3 };
+		}
+
+		const_qvvf_soa get_qvvf_soa(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(block.layout == archive_block_layout::qvvf_soa, "Unexpected block layout");
+			const float* streams = get_data<float>(block);
+			const uint32_t stride = block.stream_stride;
+			return const_qvvf_soa{
+				const_float4f_soa{ streams, streams + stride, streams + stride * 2, streams + stride * 3 },
+				const_float3f_soa{ streams + stride * 4, streams + stride * 5, streams + stride * 6 },
+				const_float3f_soa{ streams + stride * 7, streams + stride * 8, streams + stride * 9 } };
+		}
+
+		const qvvf* get_qvvf_array(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(block.layout == archive_block_layout::qvvf_aos, "Unexpected block layout");
+			return get_data<qvvf>(block);
+		}
+
+		const qvvf_packed* get_qvvf_packed_array(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(block.layout == archive_block_layout::qvvf_packed_aos, "Unexpected block layout");
+			return get_data<qvvf_packed>(block);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the streams of a quantized block, the [w] stream is null with 3 streams.
+		// Use archive_get_range_min(..), archive_get_range_extent(..), and block.num_bits
+		// to dequantize them with unpack_range_expand_unorm_soa.
+		//////////////////////////////////////////////////////////////////////////
+		const_quantized4_soa get_quantized_soa(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(rtm_impl::archive_is_quantized(block.layout), "Unexpected block layout");
+			const uint16_t* streams = get_data<uint16_t>(block);
+			const uint32_t stride = block.stream_stride;
+			return const_quantized4_soa{ streams, streams + stride, streams + stride * 2, block.layout == archive_block_layout::quantized4_soa ? streams + stride * 3 : nullptr };
+		}
+
+	private:
+		const archive_block* get_blocks() const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(is_open(), "The archive is not open");
+			return reinterpret_cast<const archive_block*>(m_buffer + sizeof(archive_header));
+		}
+
+		template<typename data_type>
+		const data_type* get_data(const archive_block& block) const RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(is_open(), "The archive is not open");
+			return reinterpret_cast<const data_type*>(m_buffer + block.offset);
+		}
+
+		const uint8_t*	m_buffer;
+		uint32_t		m_num_blocks;
+	};
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,173 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(_WIN32)
+	#if !defined(NOMINMAX)
+		#define NOMINMAX
+		#define RTM_IMPL_UNDEF_NOMINMAX
+	#endif
+
+	#include <windows.h>
+
+	#if defined(RTM_IMPL_UNDEF_NOMINMAX)
+		#undef NOMINMAX
+		#undef RTM_IMPL_UNDEF_NOMINMAX
+	#endif
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Maps a file in memory as read only, e.g. an archive for archive_reader.
+	// Nothing is read when the file is opened: the OS loads the pages as they are
+	// first touched and can evict them under memory pressure. Mappings start on a
+	// page boundary and satisfy k_archive_alignment.
+	// This header includes the OS headers, it is not included by rtm/batch/archive.h.
+	//////////////////////////////////////////////////////////////////////////
+	class archive_file
+	{
+	public:
+		archive_file() RTM_NO_EXCEPT
+			: m_data(nullptr)
+			, m_size(0)
+#if defined(_WIN32)
+			, m_mapping(nullptr)
+#endif
+		{}
+
+		~archive_file() RTM_NO_EXCEPT { close(); }
+
+		archive_file(const archive_file&) = delete;
+		archive_file& operator=(const archive_file&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Maps the whole file, returns false if it cannot be opened, is empty, or cannot be mapped.
+		//////////////////////////////////////////////////////////////////////////
+		bool open(const char* filename) RTM_NO_EXCEPT
+		{
+			close();
+
+#if defined(_WIN32)
+			const HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE)
+				return false;
+
+			LARGE_INTEGER file_size;
+			if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0 || uint64_t(file_size.QuadPart) > uint64_t(SIZE_MAX))
+			{
+				CloseHandle(file);
+				return false;
+			}
+
+			// The mapping keeps the file open
+			const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			CloseHandle(file);
+			if (mapping == nullptr)
+				return false;
+
+			void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			if (data == nullptr)
+			{
+				CloseHandle(mapping);
+				return false;
+			}
+
+			m_mapping = mapping;
+			m_data = data;
+			m_size = size_t(file_size.QuadPart);
+#else
+			const int file = ::open(filename, O_RDONLY);
+			if (file < 0)
+				return false;
+
+			struct stat file_stat;
+			if (fstat(file, &file_stat) != 0 || file_stat.st_size <= 0 || uint64_t(file_stat.st_size) > uint64_t(SIZE_MAX))
+			{
+				::close(file);
+				return false;
+			}
+
+			// The mapping keeps the file open
+			void* data = mmap(nullptr, size_t(file_stat.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+			::close(file);
+			if (data == MAP_FAILED)
+				return false;
+
+			m_data = data;
+			m_size = size_t(file_stat.st_size);
+#endif
+
+			return true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unmaps the file, the pointers returned by get_data() and the views of the readers
+		// using it become invalid.
+		//////////////////////////////////////////////////////////////////////////
+		void close() RTM_NO_EXCEPT
+		{
+			if (m_data == nullptr)
+				return;
+
+#if defined(_WIN32)
+			UnmapViewOfFile(m_data);
+			CloseHandle(m_mapping);
+			m_mapping = nullptr;
+#else
+			munmap(m_data, m_size);
+#endif
+
+			m_data = nullptr;
+			m_size = 0;
+		}
+
+		bool is_open() const RTM_NO_EXCEPT { return m_data != nullptr; }
+		const void* get_data() const RTM_NO_EXCEPT { return m_data; }
+		size_t get_size() const RTM_NO_EXCEPT { return m_size; }
+
+	private:
+		void*	m_data;
+		size_t	m_size;
+#if defined(_WIN32)
+		HANDLE	m_mapping;
+#endif
+	};
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
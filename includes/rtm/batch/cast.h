@@ -0,0 +1,170 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4d.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/quatd.h"
+#include "rtm/quatf.h"
+#include "rtm/qvvd.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4d.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Subtracts the origin from the input in double precision and narrows the result.
+		// The subtraction happens before the narrowing to keep the precision of large
+		// coordinates close to the origin.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE vector4f RTM_SIMD_CALL vector_cast_relative(const vector4d& input, const vector4d& origin) RTM_NO_EXCEPT
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			const float64x2_t xy = vsubq_f64(vld1q_f64(&input.x), vld1q_f64(&origin.x));
+			const float64x2_t zw = vsubq_f64(vld1q_f64(&input.z), vld1q_f64(&origin.z));
+			return vcombine_f32(vcvt_f32_f64(xy), vcvt_f32_f64(zw));
+#else
+			// With AVX, this is a single _mm256_sub_pd followed by _mm256_cvtpd_ps
+			return vector_cast(vector_sub(input, origin));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Narrows a vector without an origin, see vector_cast_relative.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE vector4f RTM_SIMD_CALL vector_cast_narrow(const vector4d& input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vcombine_f32(vcvt_f32_f64(vld1q_f64(&input.x)), vcvt_f32_f64(vld1q_f64(&input.z)));
+#else
+			return vector_cast(input);
+#endif
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_vectors' double precision vectors into single precision vectors
+	// relative to an origin: output[i] = vector_cast(input[i] - origin).
+	// The origin is subtracted in double precision before narrowing, large world
+	// coordinates near the origin (e.g. the camera) keep their precision.
+	// The [w] component of the origin is ignored, it is treated as zero.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon.
+	// The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_cast_relative_array(const vector4d* input, const vector4d& origin, vector4f* output, uint32_t num_vectors, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_cast_relative_array", num_vectors, num_vectors * (sizeof(vector4d) + sizeof(vector4f)));
+
+		const vector4d origin3 = vector_set_w(origin, 0.0);
+		const size_t input_size = size_t(num_vectors) * sizeof(vector4d);
+
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, vector_index * sizeof(vector4d), input_size, prefetch_distance);
+
+			rtm_impl::batch_store(rtm_impl::vector_cast_relative(input[vector_index], origin3), reinterpret_cast<float*>(output + vector_index), mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_transforms' double precision QVV transforms into single precision
+	// transforms relative to an origin: the origin is subtracted from the translation
+	// in double precision before narrowing. The rotation and the scale are narrowed as-is.
+	// The [w] component of the origin is ignored, it is treated as zero.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon.
+	// The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_cast_relative_array(const qvvd* input, const vector4d& origin, qvvf* output, uint32_t num_transforms, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_cast_relative_array", num_transforms, num_transforms * (sizeof(qvvd) + sizeof(qvvf)));
+
+		const vector4d origin3 = vector_set_w(origin, 0.0);
+		const size_t input_size = size_t(num_transforms) * sizeof(qvvd);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, transform_index * sizeof(qvvd), input_size, prefetch_distance);
+
+			const qvvd& transform = input[transform_index];
+			float* output_ptr = reinterpret_cast<float*>(output + transform_index);
+			rtm_impl::batch_store(rtm_impl::vector_cast_narrow(quat_to_vector(transform.rotation)), output_ptr + 0, mode);
+			rtm_impl::batch_store(rtm_impl::vector_cast_relative(transform.translation, origin3), output_ptr + 4, mode);
+			rtm_impl::batch_store(rtm_impl::vector_cast_narrow(transform.scale), output_ptr + 8, mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_matrices' double precision affine matrices into single precision
+	// matrices relative to an origin: the origin is subtracted from the translation
+	// (the w axis) in double precision before narrowing. The other axes are narrowed as-is.
+	// The [w] component of the origin is ignored, it is treated as zero.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon.
+	// The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_cast_relative_array(const matrix3x4d* input, const vector4d& origin, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_cast_relative_array", num_matrices, num_matrices * (sizeof(matrix3x4d) + sizeof(matrix3x4f)));
+
+		const vector4d origin3 = vector_set_w(origin, 0.0);
+		const size_t input_size = size_t(num_matrices) * sizeof(matrix3x4d);
+
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, matrix_index * sizeof(matrix3x4d), input_size, prefetch_distance);
+
+			const matrix3x4d& mtx = input[matrix_index];
+			float* output_ptr = reinterpret_cast<float*>(output + matrix_index);
+			rtm_impl::batch_store(rtm_impl::vector_cast_narrow(mtx.x_axis), output_ptr + 0, mode);
+			rtm_impl::batch_store(rtm_impl::vector_cast_narrow(mtx.y_axis), output_ptr + 4, mode);
+			rtm_impl::batch_store(rtm_impl::vector_cast_narrow(mtx.z_axis), output_ptr + 8, mode);
+			rtm_impl::batch_store(rtm_impl::vector_cast_relative(mtx.w_axis, origin3), output_ptr + 12, mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
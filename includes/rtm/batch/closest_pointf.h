@@ -0,0 +1,358 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/closest_pointf.h"
+#include "rtm/mask4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Closest point queries between one primitive and many primitives stored as structure of arrays.
+	// They match closest_point_on_segment, closest_point_on_triangle, and closest_points_between_segments
+	// but every region and degenerate case is evaluated and selected per lane without branching.
+	// Primitives are processed 4 at a time, the query primitive is broadcast once.
+	//////////////////////////////////////////////////////////////////////////
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// 4 points stored as structure of arrays, one vector4f per component.
+		//////////////////////////////////////////////////////////////////////////
+		struct point_soa4
+		{
+			vector4f x;
+			vector4f y;
+			vector4f z;
+		};
+
+		inline point_soa4 RTM_SIMD_CALL point_soa4_broadcast(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			return point_soa4{ vector_dup_x(input), vector_dup_y(input), vector_dup_z(input) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads up to 4 points, the last one is repeated in the unused lanes.
+		//////////////////////////////////////////////////////////////////////////
+		inline point_soa4 point_soa4_load_partial(const const_float3f_soa& input, uint32_t offset, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			if (num_values >= 4)
+				return point_soa4{ vector_load(input.x + offset), vector_load(input.y + offset), vector_load(input.z + offset) };
+
+			const uint32_t index1 = offset + (num_values > 1 ? 1 : 0);
+			const uint32_t index2 = offset + (num_values > 2 ? 2 : num_values - 1);
+			const uint32_t index3 = offset + num_values - 1;
+			return point_soa4{
+				vector_set(input.x[offset], input.x[index1], input.x[index2], input.x[index3]),
+				vector_set(input.y[offset], input.y[index1], input.y[index2], input.y[index3]),
+				vector_set(input.z[offset], input.z[index1], input.z[index2], input.z[index3])
+			};
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the first 'num_values' lanes.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL closest_point_store_partial(vector4f_arg0 input, float* output, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			if (num_values >= 4)
+			{
+				vector_store(input, output);
+				return;
+			}
+
+			output[0] = vector_get_x(input);
+			if (num_values >= 2)
+				output[1] = vector_get_y(input);
+			if (num_values >= 3)
+				output[2] = vector_get_z(input);
+		}
+
+		inline void closest_point_store_partial(const point_soa4& input, const float3f_soa& output, uint32_t offset, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			closest_point_store_partial(input.x, output.x + offset, num_values);
+			closest_point_store_partial(input.y, output.y + offset, num_values);
+			closest_point_store_partial(input.z, output.z + offset, num_values);
+		}
+
+		inline vector4f RTM_SIMD_CALL closest_point_dot3(vector4f_arg0 lhs_x, vector4f_arg1 lhs_y, vector4f_arg2 lhs_z, vector4f_arg3 rhs_x, vector4f_arg4 rhs_y, vector4f_arg5 rhs_z) RTM_NO_EXCEPT
+		{
+			return vector_mul_add(lhs_z, rhs_z, vector_mul_add(lhs_y, rhs_y, vector_mul(lhs_x, rhs_x)));
+		}
+
+		inline vector4f RTM_SIMD_CALL closest_point_distance_squared(const point_soa4& lhs, const point_soa4& rhs) RTM_NO_EXCEPT
+		{
+			const vector4f offset_x = vector_sub(lhs.x, rhs.x);
+			const vector4f offset_y = vector_sub(lhs.y, rhs.y);
+			const vector4f offset_z = vector_sub(lhs.z, rhs.z);
+			return closest_point_dot3(offset_x, offset_y, offset_z, offset_x, offset_y, offset_z);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the point on every segment lane closest to the matching point lane.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE point_soa4 closest_point_on_segment_soa4(const point_soa4& point, const point_soa4& start, const point_soa4& end) RTM_NO_EXCEPT
+		{
+			const vector4f direction_x = vector_sub(end.x, start.x);
+			const vector4f direction_y = vector_sub(end.y, start.y);
+			const vector4f direction_z = vector_sub(end.z, start.z);
+			const vector4f length_squared = closest_point_dot3(direction_x, direction_y, direction_z, direction_x, direction_y, direction_z);
+			const vector4f projection = closest_point_dot3(vector_sub(point.x, start.x), vector_sub(point.y, start.y), vector_sub(point.z, start.z), direction_x, direction_y, direction_z);
+
+			// Zero length segments divide by zero, their start is selected
+			const vector4f zero = vector_zero();
+			const vector4f t = vector_select(vector_less_equal(length_squared, zero), zero, vector_clamp(vector_div(projection, length_squared), zero, vector_set(1.0F)));
+			return point_soa4{ vector_mul_add(direction_x, t, start.x), vector_mul_add(direction_y, t, start.y), vector_mul_add(direction_z, t, start.z) };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the point on every triangle lane closest to the matching point lane.
+		// The closest point is vertex0 + edge01 * s + edge02 * t. It is the projection on the plane when
+		// it falls inside the triangle, otherwise the closest of the three edge points. This picks the same
+		// point as the Voronoi regions of closest_point_on_triangle with fewer selections.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE point_soa4 closest_point_on_triangle_soa4(const point_soa4& point, const point_soa4& vertex0, const point_soa4& vertex1, const point_soa4& vertex2) RTM_NO_EXCEPT
+		{
+			const vector4f edge01_x = vector_sub(vertex1.x, vertex0.x);
+			const vector4f edge01_y = vector_sub(vertex1.y, vertex0.y);
+			const vector4f edge01_z = vector_sub(vertex1.z, vertex0.z);
+			const vector4f edge02_x = vector_sub(vertex2.x, vertex0.x);
+			const vector4f edge02_y = vector_sub(vertex2.y, vertex0.y);
+			const vector4f edge02_z = vector_sub(vertex2.z, vertex0.z);
+			const vector4f offset_x = vector_sub(point.x, vertex0.x);
+			const vector4f offset_y = vector_sub(point.y, vertex0.y);
+			const vector4f offset_z = vector_sub(point.z, vertex0.z);
+
+			const vector4f edge01_sq = closest_point_dot3(edge01_x, edge01_y, edge01_z, edge01_x, edge01_y, edge01_z);
+			const vector4f edge02_sq = closest_point_dot3(edge02_x, edge02_y, edge02_z, edge02_x, edge02_y, edge02_z);
+			const vector4f edge01_02 = closest_point_dot3(edge01_x, edge01_y, edge01_z, edge02_x, edge02_y, edge02_z);
+			const vector4f d1 = closest_point_dot3(edge01_x, edge01_y, edge01_z, offset_x, offset_y, offset_z);
+			const vector4f d2 = closest_point_dot3(edge02_x, edge02_y, edge02_z, offset_x, offset_y, offset_z);
+
+			// Every edge parameter only needs the products above, edge12 runs from vertex1 to vertex2
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+			const vector4f two = vector_set(2.0F);
+			const vector4f edge12_sq = vector_add(vector_neg_mul_sub(two, edge01_02, edge01_sq), edge02_sq);
+			const vector4f d12 = vector_add(vector_sub(d2, d1), vector_sub(edge01_sq, edge01_02));
+			const vector4f offset_sq = closest_point_dot3(offset_x, offset_y, offset_z, offset_x, offset_y, offset_z);
+			const vector4f offset1_sq = vector_add(vector_neg_mul_sub(two, d1, offset_sq), edge01_sq);
+
+			const vector4f s01 = vector_clamp(vector_div(d1, edge01_sq), zero, one);
+			const vector4f t02 = vector_clamp(vector_div(d2, edge02_sq), zero, one);
+			const vector4f t12 = vector_clamp(vector_div(d12, edge12_sq), zero, one);
+
+			// Squared distances to each edge point: |offset|^2 - 2 * u * dot + u^2 * |edge|^2
+			const vector4f distance01_sq = vector_neg_mul_sub(s01, vector_neg_mul_sub(s01, edge01_sq, vector_mul(two, d1)), offset_sq);
+			const vector4f distance02_sq = vector_neg_mul_sub(t02, vector_neg_mul_sub(t02, edge02_sq, vector_mul(two, d2)), offset_sq);
+			const vector4f distance12_sq = vector_neg_mul_sub(t12, vector_neg_mul_sub(t12, edge12_sq, vector_mul(two, d12)), offset1_sq);
+
+			const mask4f is_edge02 = vector_less_than(distance02_sq, distance01_sq);
+			vector4f s = vector_select(is_edge02, zero, s01);
+			vector4f t = vector_select(is_edge02, t02, zero);
+			const mask4f is_edge12 = vector_less_than(distance12_sq, vector_min(distance01_sq, distance02_sq));
+			s = vector_select(is_edge12, vector_sub(one, t12), s);
+			t = vector_select(is_edge12, t12, t);
+
+			// The projection on the plane wins when it is inside the triangle
+			const vector4f inv_area = vector_div(one, vector_neg_mul_sub(edge01_02, edge01_02, vector_mul(edge01_sq, edge02_sq)));
+			const vector4f face_s = vector_mul(vector_neg_mul_sub(edge01_02, d2, vector_mul(edge02_sq, d1)), inv_area);
+			const vector4f face_t = vector_mul(vector_neg_mul_sub(edge01_02, d1, vector_mul(edge01_sq, d2)), inv_area);
+			const mask4f is_face = mask_and(mask_and(vector_greater_equal(face_s, zero), vector_greater_equal(face_t, zero)), vector_less_equal(vector_add(face_s, face_t), one));
+			s = vector_select(is_face, face_s, s);
+			t = vector_select(is_face, face_t, t);
+
+			return point_soa4{
+				vector_mul_add(edge02_x, t, vector_mul_add(edge01_x, s, vertex0.x)),
+				vector_mul_add(edge02_y, t, vector_mul_add(edge01_y, s, vertex0.y)),
+				vector_mul_add(edge02_z, t, vector_mul_add(edge01_z, s, vertex0.z))
+			};
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the squared distance between every pair of segment lanes, like closest_points_between_segments.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE vector4f segment_segment_distance_squared_soa4(const point_soa4& start0, const point_soa4& end0, const point_soa4& start1, const point_soa4& end1) RTM_NO_EXCEPT
+		{
+			const vector4f direction0_x = vector_sub(end0.x, start0.x);
+			const vector4f direction0_y = vector_sub(end0.y, start0.y);
+			const vector4f direction0_z = vector_sub(end0.z, start0.z);
+			const vector4f direction1_x = vector_sub(end1.x, start1.x);
+			const vector4f direction1_y = vector_sub(end1.y, start1.y);
+			const vector4f direction1_z = vector_sub(end1.z, start1.z);
+			const vector4f offset_x = vector_sub(start0.x, start1.x);
+			const vector4f offset_y = vector_sub(start0.y, start1.y);
+			const vector4f offset_z = vector_sub(start0.z, start1.z);
+
+			const vector4f a = closest_point_dot3(direction0_x, direction0_y, direction0_z, direction0_x, direction0_y, direction0_z);
+			const vector4f b = closest_point_dot3(direction0_x, direction0_y, direction0_z, direction1_x, direction1_y, direction1_z);
+			const vector4f c = closest_point_dot3(direction0_x, direction0_y, direction0_z, offset_x, offset_y, offset_z);
+			const vector4f e = closest_point_dot3(direction1_x, direction1_y, direction1_z, direction1_x, direction1_y, direction1_z);
+			const vector4f f = closest_point_dot3(direction1_x, direction1_y, direction1_z, offset_x, offset_y, offset_z);
+
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+			const vector4f inv_a = vector_div(one, a);
+			const vector4f inv_e = vector_div(one, e);
+
+			// The closest point of the infinite lines, parallel lines start at the first start
+			const vector4f denominator = vector_neg_mul_sub(b, b, vector_mul(a, e));
+			const vector4f line_s = vector_clamp(vector_div(vector_neg_mul_sub(c, e, vector_mul(b, f)), denominator), zero, one);
+			vector4f s = vector_select(vector_greater_than(denominator, zero), line_s, zero);
+
+			// When the point on the second segment is clamped, the point on the first segment moves with it
+			const vector4f unclamped_t = vector_mul(vector_mul_add(b, s, f), inv_e);
+			vector4f t = vector_clamp(unclamped_t, zero, one);
+			const mask4f is_t_clamped = mask_or(vector_less_than(unclamped_t, zero), vector_greater_than(unclamped_t, one));
+			s = vector_select(is_t_clamped, vector_clamp(vector_mul(vector_sub(vector_mul(b, t), c), inv_a), zero, one), s);
+
+			// Zero length segments are points, they divide by zero above
+			const mask4f is_point1 = vector_less_equal(e, zero);
+			s = vector_select(is_point1, vector_clamp(vector_mul(vector_neg(c), inv_a), zero, one), s);
+			t = vector_select(is_point1, zero, t);
+
+			const mask4f is_point0 = vector_less_equal(a, zero);
+			s = vector_select(is_point0, zero, s);
+			t = vector_select(is_point0, vector_select(is_point1, zero, vector_clamp(vector_mul(f, inv_e), zero, one)), t);
+
+			const point_soa4 point0 = { vector_mul_add(direction0_x, s, start0.x), vector_mul_add(direction0_y, s, start0.y), vector_mul_add(direction0_z, s, start0.z) };
+			const point_soa4 point1 = { vector_mul_add(direction1_x, t, start1.x), vector_mul_add(direction1_y, t, start1.y), vector_mul_add(direction1_z, t, start1.z) };
+			return closest_point_distance_squared(point0, point1);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the squared distance between one point and 'num_segments' segments stored as structure of arrays.
+	// output_distances_squared[i] = point_segment_distance_squared(point, starts[i], ends[i]).
+	// Compare them with squared radii to test capsules without a square root.
+	//////////////////////////////////////////////////////////////////////////
+	inline void point_segment_distance_squared_soa(vector4f_arg0 point, const const_float3f_soa& starts, const const_float3f_soa& ends, float* output_distances_squared, uint32_t num_segments) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::point_segment_distance_squared_soa", num_segments, num_segments * sizeof(float) * 7);
+
+		const rtm_impl::point_soa4 point4 = rtm_impl::point_soa4_broadcast(point);
+		for (uint32_t segment_index = 0; segment_index < num_segments; segment_index += 4)
+		{
+			const uint32_t num_values = num_segments - segment_index;
+			const rtm_impl::point_soa4 start = rtm_impl::point_soa4_load_partial(starts, segment_index, num_values);
+			const rtm_impl::point_soa4 end = rtm_impl::point_soa4_load_partial(ends, segment_index, num_values);
+
+			const rtm_impl::point_soa4 closest = rtm_impl::closest_point_on_segment_soa4(point4, start, end);
+			rtm_impl::closest_point_store_partial(rtm_impl::closest_point_distance_squared(point4, closest), output_distances_squared + segment_index, num_values);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the point on each of 'num_segments' segments stored as structure of arrays closest to one point.
+	// output_points[i] = closest_point_on_segment(point, starts[i], ends[i]).
+	//////////////////////////////////////////////////////////////////////////
+	inline void closest_point_on_segments_soa(vector4f_arg0 point, const const_float3f_soa& starts, const const_float3f_soa& ends, const float3f_soa& output_points, uint32_t num_segments) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::closest_point_on_segments_soa", num_segments, num_segments * sizeof(float) * 9);
+
+		const rtm_impl::point_soa4 point4 = rtm_impl::point_soa4_broadcast(point);
+		for (uint32_t segment_index = 0; segment_index < num_segments; segment_index += 4)
+		{
+			const uint32_t num_values = num_segments - segment_index;
+			const rtm_impl::point_soa4 start = rtm_impl::point_soa4_load_partial(starts, segment_index, num_values);
+			const rtm_impl::point_soa4 end = rtm_impl::point_soa4_load_partial(ends, segment_index, num_values);
+
+			rtm_impl::closest_point_store_partial(rtm_impl::closest_point_on_segment_soa4(point4, start, end), output_points, segment_index, num_values);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the squared distance between one point and 'num_triangles' triangles stored as structure of arrays.
+	// output_distances_squared[i] = point_triangle_distance_squared(point, vertices0[i], vertices1[i], vertices2[i]).
+	// The triangles must not be degenerate.
+	//////////////////////////////////////////////////////////////////////////
+	inline void point_triangle_distance_squared_soa(vector4f_arg0 point, const const_float3f_soa& vertices0, const const_float3f_soa& vertices1, const const_float3f_soa& vertices2, float* output_distances_squared, uint32_t num_triangles) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::point_triangle_distance_squared_soa", num_triangles, num_triangles * sizeof(float) * 10);
+
+		const rtm_impl::point_soa4 point4 = rtm_impl::point_soa4_broadcast(point);
+		for (uint32_t triangle_index = 0; triangle_index < num_triangles; triangle_index += 4)
+		{
+			const uint32_t num_values = num_triangles - triangle_index;
+			const rtm_impl::point_soa4 vertex0 = rtm_impl::point_soa4_load_partial(vertices0, triangle_index, num_values);
+			const rtm_impl::point_soa4 vertex1 = rtm_impl::point_soa4_load_partial(vertices1, triangle_index, num_values);
+			const rtm_impl::point_soa4 vertex2 = rtm_impl::point_soa4_load_partial(vertices2, triangle_index, num_values);
+
+			const rtm_impl::point_soa4 closest = rtm_impl::closest_point_on_triangle_soa4(point4, vertex0, vertex1, vertex2);
+			rtm_impl::closest_point_store_partial(rtm_impl::closest_point_distance_squared(point4, closest), output_distances_squared + triangle_index, num_values);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the point on each of 'num_triangles' triangles stored as structure of arrays closest to one point.
+	// output_points[i] = closest_point_on_triangle(point, vertices0[i], vertices1[i], vertices2[i]).
+	// The triangles must not be degenerate.
+	//////////////////////////////////////////////////////////////////////////
+	inline void closest_point_on_triangles_soa(vector4f_arg0 point, const const_float3f_soa& vertices0, const const_float3f_soa& vertices1, const const_float3f_soa& vertices2, const float3f_soa& output_points, uint32_t num_triangles) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::closest_point_on_triangles_soa", num_triangles, num_triangles * sizeof(float) * 12);
+
+		const rtm_impl::point_soa4 point4 = rtm_impl::point_soa4_broadcast(point);
+		for (uint32_t triangle_index = 0; triangle_index < num_triangles; triangle_index += 4)
+		{
+			const uint32_t num_values = num_triangles - triangle_index;
+			const rtm_impl::point_soa4 vertex0 = rtm_impl::point_soa4_load_partial(vertices0, triangle_index, num_values);
+			const rtm_impl::point_soa4 vertex1 = rtm_impl::point_soa4_load_partial(vertices1, triangle_index, num_values);
+			const rtm_impl::point_soa4 vertex2 = rtm_impl::point_soa4_load_partial(vertices2, triangle_index, num_values);
+
+			rtm_impl::closest_point_store_partial(rtm_impl::closest_point_on_triangle_soa4(point4, vertex0, vertex1, vertex2), output_points, triangle_index, num_values);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the squared distance between one segment and 'num_segments' segments stored as structure of arrays.
+	// output_distances_squared[i] = segment_segment_distance_squared(start, end, starts[i], ends[i]).
+	// Compare them with the squared sum of the radii to test capsules against capsules.
+	//////////////////////////////////////////////////////////////////////////
+	inline void segment_segment_distance_squared_soa(vector4f_arg0 start, vector4f_arg1 end, const const_float3f_soa& starts, const const_float3f_soa& ends, float* output_distances_squared, uint32_t num_segments) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::segment_segment_distance_squared_soa", num_segments, num_segments * sizeof(float) * 7);
+
+		const rtm_impl::point_soa4 start4 = rtm_impl::point_soa4_broadcast(start);
+		const rtm_impl::point_soa4 end4 = rtm_impl::point_soa4_broadcast(end);
+		for (uint32_t segment_index = 0; segment_index < num_segments; segment_index += 4)
+		{
+			const uint32_t num_values = num_segments - segment_index;
+			const rtm_impl::point_soa4 other_start = rtm_impl::point_soa4_load_partial(starts, segment_index, num_values);
+			const rtm_impl::point_soa4 other_end = rtm_impl::point_soa4_load_partial(ends, segment_index, num_values);
+
+			const vector4f distance_squared = rtm_impl::segment_segment_distance_squared_soa4(start4, end4, other_start, other_end);
+			rtm_impl::closest_point_store_partial(distance_squared, output_distances_squared + segment_index, num_values);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,362 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/color.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector4i.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Widens 4 RGBA8 pixels to one vector of 32 bit integers per pixel.
+		//////////////////////////////////////////////////////////////////////////
+		inline void color_unpack_rgba8x4(const uint8_t* input, vector4i (&out_pixels)[4]) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+			const __m128i zero = _mm_setzero_si128();
+			const __m128i pixels01 = _mm_unpacklo_epi8(bytes, zero);
+			const __m128i pixels23 = _mm_unpackhi_epi8(bytes, zero);
+			out_pixels[0] = _mm_unpacklo_epi16(pixels01, zero);
+			out_pixels[1] = _mm_unpackhi_epi16(pixels01, zero);
+			out_pixels[2] = _mm_unpacklo_epi16(pixels23, zero);
+			out_pixels[3] = _mm_unpackhi_epi16(pixels23, zero);
+#elif defined(RTM_NEON_INTRINSICS)
+			const uint8x16_t bytes = vld1q_u8(input);
+			const uint16x8_t pixels01 = vmovl_u8(vget_low_u8(bytes));
+			const uint16x8_t pixels23 = vmovl_u8(vget_high_u8(bytes));
+			out_pixels[0] = RTM_IMPL_VECTOR4i_SET(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(pixels01))));
+			out_pixels[1] = RTM_IMPL_VECTOR4i_SET(vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(pixels01))));
+			out_pixels[2] = RTM_IMPL_VECTOR4i_SET(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(pixels23))));
+			out_pixels[3] = RTM_IMPL_VECTOR4i_SET(vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(pixels23))));
+#else
+			for (uint32_t pixel_index = 0; pixel_index < 4; ++pixel_index)
+			{
+				const uint8_t* pixel = input + pixel_index * 4;
+				out_pixels[pixel_index] = vector_set(int32_t(pixel[0]), int32_t(pixel[1]), int32_t(pixel[2]), int32_t(pixel[3]));
+			}
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Narrows 4 pixels of 32 bit integers within [0, 255] to RGBA8.
+		//////////////////////////////////////////////////////////////////////////
+		inline void color_pack_rgba8x4(const vector4i (&pixels)[4], uint8_t* output) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			const __m128i pixels01 = _mm_packs_epi32(pixels[0], pixels[1]);
+			const __m128i pixels23 = _mm_packs_epi32(pixels[2], pixels[3]);
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_packus_epi16(pixels01, pixels23));
+#elif defined(RTM_NEON_INTRINSICS)
+			const uint16x8_t pixels01 = vcombine_u16(vqmovun_s32(RTM_IMPL_VECTOR4i_GET(pixels[0])), vqmovun_s32(RTM_IMPL_VECTOR4i_GET(pixels[1])));
+			const uint16x8_t pixels23 = vcombine_u16(vqmovun_s32(RTM_IMPL_VECTOR4i_GET(pixels[2])), vqmovun_s32(RTM_IMPL_VECTOR4i_GET(pixels[3])));
+			vst1q_u8(output, vcombine_u8(vqmovn_u16(pixels01), vqmovn_u16(pixels23)));
+#else
+			for (uint32_t pixel_index = 0; pixel_index < 4; ++pixel_index)
+			{
+				int32_t values[4];
+				vector_store(pixels[pixel_index], &values[0]);
+				for (uint32_t component_index = 0; component_index < 4; ++component_index)
+					output[pixel_index * 4 + component_index] = static_cast<uint8_t>(values[component_index]);
+			}
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads and stores groups of 4 registers worth of pixels: 4 pixels with vector4f
+		// and 8 with vector8f. RGBA8 pixels are normalized to [0.0, 1.0] and back.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		struct color_pixels;
+
+		template<>
+		struct color_pixels<4>
+		{
+			static constexpr uint32_t k_num_pixels = 4;
+
+			static void load(const uint8_t* input, vector4f (&out_pixels)[4]) RTM_NO_EXCEPT
+			{
+				vector4i values[4];
+				color_unpack_rgba8x4(input, values);
+
+				for (uint32_t pixel_index = 0; pixel_index < 4; ++pixel_index)
+					out_pixels[pixel_index] = vector_mul(vector_int_to_float(values[pixel_index]), 1.0F / 255.0F);
+			}
+
+			static void load(const float4f* input, vector4f (&out_pixels)[4]) RTM_NO_EXCEPT
+			{
+				for (uint32_t pixel_index = 0; pixel_index < 4; ++pixel_index)
+					out_pixels[pixel_index] = vector_load(input + pixel_index);
+			}
+
+			static void store(const vector4f (&pixels)[4], uint8_t* output) RTM_NO_EXCEPT
+			{
+				const vector4f zero = vector_zero();
+				const vector4f one = vector_set(1.0F);
+
+				vector4i values[4];
+				for (uint32_t pixel_index = 0; pixel_index < 4; ++pixel_index)
+					values[pixel_index] = vector_round_to_int(vector_mul(vector_min(vector_max(pixels[pixel_index], zero), one), 255.0F));
+
+				color_pack_rgba8x4(values, output);
+			}
+
+			static void store(const vector4f (&pixels)[4], float4f* output) RTM_NO_EXCEPT
+			{
+				for (uint32_t pixel_index = 0; pixel_index < 4; ++pixel_index)
+					vector_store(pixels[pixel_index], output + pixel_index);
+			}
+		};
+
+#if defined(RTM_AVX2_INTRINSICS)
+		template<>
+		struct color_pixels<8>
+		{
+			static constexpr uint32_t k_num_pixels = 8;
+
+			static void load(const uint8_t* input, vector8f (&out_pixels)[4]) RTM_NO_EXCEPT
+			{
+				const __m128i pixels0123 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+				const __m128i pixels4567 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + 16));
+				const __m256 scale = _mm256_set1_ps(1.0F / 255.0F);
+
+				out_pixels[0] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pixels0123)), scale);
+				out_pixels[1] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(pixels0123, 8))), scale);
+				out_pixels[2] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pixels4567)), scale);
+				out_pixels[3] = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_srli_si128(pixels4567, 8))), scale);
+			}
+
+			static void load(const float4f* input, vector8f (&out_pixels)[4]) RTM_NO_EXCEPT
+			{
+				for (uint32_t register_index = 0; register_index < 4; ++register_index)
+					out_pixels[register_index] = vector8_load(&input[register_index * 2].x);
+			}
+
+			static void store(const vector8f (&pixels)[4], uint8_t* output) RTM_NO_EXCEPT
+			{
+				const __m256 zero = _mm256_setzero_ps();
+				const __m256 one = _mm256_set1_ps(1.0F);
+				const __m256 scale = _mm256_set1_ps(255.0F);
+
+				__m256i values[4];
+				for (uint32_t register_index = 0; register_index < 4; ++register_index)
+					values[register_index] = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(pixels[register_index], zero), one), scale));
+
+				// Packing works within each 128 bit half, the pixels come out as [0, 2, 4, 6, 1, 3, 5, 7]
+				const __m256i pixels0246_1357 = _mm256_packus_epi16(_mm256_packs_epi32(values[0], values[1]), _mm256_packs_epi32(values[2], values[3]));
+				const __m256i pixels01234567 = _mm256_permutevar8x32_epi32(pixels0246_1357, _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(output), pixels01234567);
+			}
+
+			static void store(const vector8f (&pixels)[4], float4f* output) RTM_NO_EXCEPT
+			{
+				for (uint32_t register_index = 0; register_index < 4; ++register_index)
+					vector_store(pixels[register_index], &output[register_index * 2].x);
+			}
+		};
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of values per pixel and the address of a pixel for each pixel format.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t color_num_values_per_pixel(const uint8_t*) RTM_NO_EXCEPT { return 4; }
+		constexpr uint32_t color_num_values_per_pixel(const float4f*) RTM_NO_EXCEPT { return 1; }
+
+		template<typename pixel_type>
+		constexpr pixel_type* color_pixel_offset(pixel_type* pixels, uint32_t pixel_index) RTM_NO_EXCEPT
+		{
+			return pixels + pixel_index * color_num_values_per_pixel(pixels);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// The conversions applied to pixels by color_convert_pixels(..), for any register width.
+		//////////////////////////////////////////////////////////////////////////
+		template<bool premultiply>
+		struct color_srgb_to_linear_kernel
+		{
+			template<uint32_t num_lanes>
+			static typename color_register<num_lanes>::vector_type apply(const typename color_register<num_lanes>::vector_type& rgba) RTM_NO_EXCEPT
+			{
+				const typename color_register<num_lanes>::vector_type linear = color_register<num_lanes>::keep_alpha(color_srgb_to_linear_lanes<num_lanes>(rgba), rgba);
+				return static_condition<premultiply>::test() ? color_premultiply_pixels<num_lanes>(linear) : linear;
+			}
+		};
+
+		template<bool unpremultiply>
+		struct color_linear_to_srgb_kernel
+		{
+			template<uint32_t num_lanes>
+			static typename color_register<num_lanes>::vector_type apply(const typename color_register<num_lanes>::vector_type& rgba) RTM_NO_EXCEPT
+			{
+				const typename color_register<num_lanes>::vector_type straight = static_condition<unpremultiply>::test() ? color_unpremultiply_pixels<num_lanes>(rgba) : rgba;
+				return color_register<num_lanes>::keep_alpha(color_linear_to_srgb_lanes<num_lanes>(straight), straight);
+			}
+		};
+
+		// Co and Cg are stored with a bias of 128 / 255: zero chroma is 128
+		struct color_rgb_to_ycocg8_kernel
+		{
+			template<uint32_t num_lanes>
+			static typename color_register<num_lanes>::vector_type apply(const typename color_register<num_lanes>::vector_type& rgba) RTM_NO_EXCEPT
+			{
+				const float bias = 128.0F / 255.0F;
+				return vector_add(color_rgb_to_ycocg_pixels<num_lanes>(rgba), color_register<num_lanes>::broadcast_pixel(0.0F, bias, bias, 0.0F));
+			}
+		};
+
+		struct color_ycocg8_to_rgb_kernel
+		{
+			template<uint32_t num_lanes>
+			static typename color_register<num_lanes>::vector_type apply(const typename color_register<num_lanes>::vector_type& ycocg) RTM_NO_EXCEPT
+			{
+				const float bias = 128.0F / 255.0F;
+				return color_ycocg_to_rgb_pixels<num_lanes>(vector_sub(ycocg, color_register<num_lanes>::broadcast_pixel(0.0F, bias, bias, 0.0F)));
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts 'num_pixels' pixels, a group of registers at a time.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename kernel_type, uint32_t num_lanes, typename input_type, typename output_type>
+		inline void color_convert_group(const input_type* input, output_type* output) RTM_NO_EXCEPT
+		{
+			typename color_register<num_lanes>::vector_type pixels[4];
+			color_pixels<num_lanes>::load(input, pixels);
+
+			for (uint32_t register_index = 0; register_index < 4; ++register_index)
+				pixels[register_index] = kernel_type::template apply<num_lanes>(pixels[register_index]);
+
+			color_pixels<num_lanes>::store(pixels, output);
+		}
+
+		template<typename kernel_type, typename input_type, typename output_type>
+		inline void color_convert_pixels(const input_type* input, output_type* output, uint32_t num_pixels) RTM_NO_EXCEPT
+		{
+			uint32_t pixel_index = 0;
+
+#if defined(RTM_AVX2_INTRINSICS)
+			for (; pixel_index + 8 <= num_pixels; pixel_index += 8)
+				color_convert_group<kernel_type, 8>(color_pixel_offset(input, pixel_index), color_pixel_offset(output, pixel_index));
+#endif
+
+			for (; pixel_index + 4 <= num_pixels; pixel_index += 4)
+				color_convert_group<kernel_type, 4>(color_pixel_offset(input, pixel_index), color_pixel_offset(output, pixel_index));
+
+			if (pixel_index < num_pixels)
+			{
+				// The last pixels are copied into padded buffers to run the same code
+				input_type input_buffer[4 * color_num_values_per_pixel(static_cast<const input_type*>(nullptr))] = {};
+				output_type output_buffer[4 * color_num_values_per_pixel(static_cast<const output_type*>(nullptr))];
+
+				const uint32_t num_remaining = num_pixels - pixel_index;
+				std::memcpy(input_buffer, color_pixel_offset(input, pixel_index), sizeof(input_type) * color_num_values_per_pixel(input) * num_remaining);
+				color_convert_group<kernel_type, 4>(input_buffer, output_buffer);
+				std::memcpy(color_pixel_offset(output, pixel_index), output_buffer, sizeof(output_type) * color_num_values_per_pixel(output) * num_remaining);
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decodes 'num_pixels' interleaved RGBA8 pixels from sRGB to linear floats.
+	// The alpha is linear, it is normalized to [0.0, 1.0]. See vector_srgb_to_linear(..).
+	// With AVX2, 8 pixels are converted at a time.
+	// Buffers do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void color_srgb8_to_linear(const uint8_t* input, float4f* output, uint32_t num_pixels) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::color_srgb8_to_linear", num_pixels, num_pixels * (4 + sizeof(float4f)));
+		rtm_impl::color_convert_pixels<rtm_impl::color_srgb_to_linear_kernel<false>>(input, output, num_pixels);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decodes 'num_pixels' interleaved RGBA8 pixels from sRGB to linear floats and
+	// premultiplies them by their alpha, ready to be blended.
+	// See color_srgb8_to_linear(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline void color_srgb8_to_linear_premultiplied(const uint8_t* input, float4f* output, uint32_t num_pixels) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::color_srgb8_to_linear_premultiplied", num_pixels, num_pixels * (4 + sizeof(float4f)));
+		rtm_impl::color_convert_pixels<rtm_impl::color_srgb_to_linear_kernel<true>>(input, output, num_pixels);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Encodes 'num_pixels' linear float pixels to interleaved RGBA8 sRGB pixels.
+	// Every component is clamped to [0.0, 1.0] and rounded to the nearest 8 bit value, the
+	// alpha stays linear. See vector_linear_to_srgb(..). With AVX2, 8 pixels are converted at a time.
+	// Buffers do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void color_linear_to_srgb8(const float4f* input, uint8_t* output, uint32_t num_pixels) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::color_linear_to_srgb8", num_pixels, num_pixels * (4 + sizeof(float4f)));
+		rtm_impl::color_convert_pixels<rtm_impl::color_linear_to_srgb_kernel<false>>(input, output, num_pixels);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Divides 'num_pixels' premultiplied linear float pixels by their alpha and encodes
+	// them to interleaved RGBA8 sRGB pixels. Fully transparent pixels are black.
+	// See color_linear_to_srgb8(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline void color_linear_premultiplied_to_srgb8(const float4f* input, uint8_t* output, uint32_t num_pixels) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::color_linear_premultiplied_to_srgb8", num_pixels, num_pixels * (4 + sizeof(float4f)));
+		rtm_impl::color_convert_pixels<rtm_impl::color_linear_to_srgb_kernel<true>>(input, output, num_pixels);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_pixels' interleaved RGBA8 pixels to YCoCg, see color_rgb_to_ycocg(..).
+	// Co and Cg are stored with a bias of 128, the alpha is unchanged. Each value is
+	// rounded to 8 bits: converting back yields components within 1 of the originals.
+	// The input and output can be the same buffer. With AVX2, 8 pixels are converted at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void color_rgba8_to_ycocg8(const uint8_t* input, uint8_t* output, uint32_t num_pixels) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::color_rgba8_to_ycocg8", num_pixels, num_pixels * 8);
+		rtm_impl::color_convert_pixels<rtm_impl::color_rgb_to_ycocg8_kernel>(input, output, num_pixels);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_pixels' interleaved YCoCg pixels written by color_rgba8_to_ycocg8(..)
+	// back to RGBA8. The input and output can be the same buffer.
+	//////////////////////////////////////////////////////////////////////////
+	inline void color_ycocg8_to_rgba8(const uint8_t* input, uint8_t* output, uint32_t num_pixels) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::color_ycocg8_to_rgba8", num_pixels, num_pixels * 8);
+		rtm_impl::color_convert_pixels<rtm_impl::color_ycocg8_to_rgb_kernel>(input, output, num_pixels);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,432 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/impl/batch_kernel_table.h"
+#include "rtm/impl/batch_kernels.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+	#define RTM_IMPL_DISPATCH_X86
+
+	#if defined(_MSC_VER)
+		#include <intrin.h>
+	#else
+		#include <cpuid.h>
+	#endif
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Opt-in runtime dispatch of the batch functions.
+//
+// The batch functions in rtm/batch/ are compiled for the instruction set of the
+// translation unit that includes them. A binary built for SSE2 thus never uses the
+// SSE4, AVX, or FMA paths even when the CPU running it supports them.
+//
+// With dispatch, the same batch kernels can also be compiled in a dedicated translation
+// unit with more instruction sets enabled (e.g. -mavx2 -mfma -mf16c or /arch:AVX2). That
+// translation unit includes rtm/batch/dispatch_variant.h and nothing else from RTM.
+// Every translation unit that includes this header must then define the matching
+// RTM_DISPATCH_SSE4, RTM_DISPATCH_AVX, or RTM_DISPATCH_AVX2 macro.
+//
+// The first dispatched call queries the CPU with CPUID. It then selects the most capable
+// variant the CPU supports, falling back to the kernels compiled in the including
+// translation unit. The inline single value API is unaffected.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Instruction sets batch kernels can be compiled for, from least to most capable.
+	//////////////////////////////////////////////////////////////////////////
+	enum class cpu_isa
+	{
+		scalar,
+		sse2,
+		sse4,
+		avx,
+		avx2,			// Along with FMA and F16C
+		neon,
+	};
+
+	namespace rtm_impl
+	{
+		constexpr uint32_t k_num_cpu_isa = uint32_t(cpu_isa::neon) + 1;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the instruction set the current translation unit is compiled for.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr cpu_isa get_compiled_isa() RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX2_INTRINSICS)
+			return cpu_isa::avx2;
+#elif defined(RTM_AVX_INTRINSICS)
+			return cpu_isa::avx;
+#elif defined(RTM_SSE4_INTRINSICS)
+			return cpu_isa::sse4;
+#elif defined(RTM_SSE2_INTRINSICS)
+			return cpu_isa::sse2;
+#elif defined(RTM_NEON_INTRINSICS)
+			return cpu_isa::neon;
+#else
+			return cpu_isa::scalar;
+#endif
+		}
+
+#if defined(RTM_IMPL_DISPATCH_X86)
+		//////////////////////////////////////////////////////////////////////////
+		// Executes CPUID for the provided leaf, the output holds EAX, EBX, ECX, and EDX.
+		//////////////////////////////////////////////////////////////////////////
+		inline void cpu_query(uint32_t leaf, uint32_t (&out_registers)[4]) RTM_NO_EXCEPT
+		{
+#if defined(_MSC_VER)
+			int registers[4];
+			__cpuidex(registers, int(leaf), 0);
+			out_registers[0] = uint32_t(registers[0]);
+			out_registers[1] = uint32_t(registers[1]);
+			out_registers[2] = uint32_t(registers[2]);
+			out_registers[3] = uint32_t(registers[3]);
+#else
+			unsigned int eax = 0;
+			unsigned int ebx = 0;
+			unsigned int ecx = 0;
+			unsigned int edx = 0;
+			if (leaf <= __get_cpuid_max(0, nullptr))
+				__cpuid_count(leaf, 0, eax, ebx, ecx, edx);
+			out_registers[0] = eax;
+			out_registers[1] = ebx;
+			out_registers[2] = ecx;
+			out_registers[3] = edx;
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the OS saves the XMM and YMM registers on context switches.
+		// Must only be called when CPUID reports OSXSAVE.
+		//////////////////////////////////////////////////////////////////////////
+		inline bool cpu_is_ymm_state_enabled() RTM_NO_EXCEPT
+		{
+#if defined(_MSC_VER)
+			const uint64_t xcr0 = _xgetbv(0);
+#else
+			uint32_t xcr0_lo;
+			uint32_t xcr0_hi;
+			__asm__ __volatile__("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+			const uint64_t xcr0 = (uint64_t(xcr0_hi) << 32) | xcr0_lo;
+#endif
+			return (xcr0 & 0x6) == 0x6;
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the running CPU and OS support the provided instruction set.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool cpu_supports(cpu_isa isa) RTM_NO_EXCEPT
+	{
+#if defined(RTM_IMPL_DISPATCH_X86)
+		uint32_t leaf1[4];
+		rtm_impl::cpu_query(1, leaf1);
+
+		const uint32_t leaf1_ecx = leaf1[2];
+		const uint32_t leaf1_edx = leaf1[3];
+
+		const bool has_sse2 = (leaf1_edx & (1U << 26)) != 0;
+		const bool has_sse4 = has_sse2 && (leaf1_ecx & (1U << 19)) != 0;
+		const bool has_osxsave = (leaf1_ecx & (1U << 27)) != 0;
+		const bool has_avx = has_sse4 && has_osxsave && (leaf1_ecx & (1U << 28)) != 0 && rtm_impl::cpu_is_ymm_state_enabled();
+
+		switch (isa)
+		{
+		case cpu_isa::scalar:
+			return true;
+		case cpu_isa::sse2:
+			return has_sse2;
+		case cpu_isa::sse4:
+			return has_sse4;
+		case cpu_isa::avx:
+			return has_avx;
+		case cpu_isa::avx2:
+		{
+			if (!has_avx)
+				return false;
+
+			uint32_t leaf7[4];
+			rtm_impl::cpu_query(7, leaf7);
+
+			const bool has_fma = (leaf1_ecx & (1U << 12)) != 0;
+			const bool has_f16c = (leaf1_ecx & (1U << 29)) != 0;
+			const bool has_avx2 = (leaf7[1] & (1U << 5)) != 0;
+			return has_avx2 && has_fma && has_f16c;
+		}
+		default:
+			return false;
+		}
+#else
+		// Without CPUID, only what the translation unit is compiled for is known to be supported
+		return isa == cpu_isa::scalar || isa == rtm_impl::get_compiled_isa();
+#endif
+	}
+
+	namespace rtm_impl
+	{
+		// Implemented in the translation units that include rtm/batch/dispatch_variant.h
+#if defined(RTM_DISPATCH_SSE4)
+		void get_batch_kernels_sse4(batch_kernel_table& out_table);
+#endif
+#if defined(RTM_DISPATCH_AVX)
+		void get_batch_kernels_avx(batch_kernel_table& out_table);
+#endif
+#if defined(RTM_DISPATCH_AVX2)
+		void get_batch_kernels_avx2(batch_kernel_table& out_table);
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Holds every batch kernel variant usable on the running CPU.
+		//////////////////////////////////////////////////////////////////////////
+		struct batch_kernel_registry
+		{
+			batch_kernel_table tables[k_num_cpu_isa];
+			bool is_available[k_num_cpu_isa];
+			const batch_kernel_table* selected;
+			cpu_isa selected_isa;
+		};
+
+		inline batch_kernel_registry make_batch_kernel_registry() RTM_NO_EXCEPT
+		{
+			batch_kernel_registry registry = {};
+
+			// The kernels of this translation unit are always usable since it is running
+			const cpu_isa compiled_isa = get_compiled_isa();
+			fill_batch_kernel_table(registry.tables[uint32_t(compiled_isa)]);
+			registry.is_available[uint32_t(compiled_isa)] = true;
+
+#if defined(RTM_DISPATCH_SSE4)
+			if (cpu_supports(cpu_isa::sse4))
+			{
+				get_batch_kernels_sse4(registry.tables[uint32_t(cpu_isa::sse4)]);
+				registry.is_available[uint32_t(cpu_isa::sse4)] = true;
+			}
+#endif
+
+#if defined(RTM_DISPATCH_AVX)
+			if (cpu_supports(cpu_isa::avx))
+			{
+				get_batch_kernels_avx(registry.tables[uint32_t(cpu_isa::avx)]);
+				registry.is_available[uint32_t(cpu_isa::avx)] = true;
+			}
+#endif
+
+#if defined(RTM_DISPATCH_AVX2)
+			if (cpu_supports(cpu_isa::avx2))
+			{
+				get_batch_kernels_avx2(registry.tables[uint32_t(cpu_isa::avx2)]);
+				registry.is_available[uint32_t(cpu_isa::avx2)] = true;
+			}
+#endif
+
+			// Select the most capable variant
+			for (uint32_t isa_index = 0; isa_index < k_num_cpu_isa; ++isa_index)
+			{
+				if (registry.is_available[isa_index])
+				{
+					registry.selected = &registry.tables[isa_index];
+					registry.selected_isa = cpu_isa(isa_index);
+				}
+			}
+
+			return registry;
+		}
+
+		inline batch_kernel_registry& get_batch_kernel_registry() RTM_NO_EXCEPT
+		{
+			static batch_kernel_registry registry = make_batch_kernel_registry();
+			return registry;
+		}
+
+		inline const batch_kernel_table& get_dispatch_kernels() RTM_NO_EXCEPT
+		{
+			return *get_batch_kernel_registry().selected;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if batch kernels compiled for the provided instruction set are
+	// built in and supported by the running CPU.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool is_dispatch_isa_available(cpu_isa isa) RTM_NO_EXCEPT
+	{
+		return uint32_t(isa) < rtm_impl::k_num_cpu_isa && rtm_impl::get_batch_kernel_registry().is_available[uint32_t(isa)];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the instruction set of the batch kernels used by the dispatched functions.
+	//////////////////////////////////////////////////////////////////////////
+	inline cpu_isa get_dispatch_isa() RTM_NO_EXCEPT
+	{
+		return rtm_impl::get_batch_kernel_registry().selected_isa;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the name of the batch kernels used by the dispatched functions (e.g. "avx2").
+	//////////////////////////////////////////////////////////////////////////
+	inline const char* get_dispatch_name() RTM_NO_EXCEPT
+	{
+		return rtm_impl::get_dispatch_kernels().name;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Overrides the batch kernels used by the dispatched functions.
+	// Returns false and leaves the selection unchanged if the instruction set isn't available.
+	// This isn't thread safe, it is meant to be called at startup or by benchmarks.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool set_dispatch_isa(cpu_isa isa) RTM_NO_EXCEPT
+	{
+		if (!is_dispatch_isa_available(isa))
+			return false;
+
+		rtm_impl::batch_kernel_registry& registry = rtm_impl::get_batch_kernel_registry();
+		registry.selected = &registry.tables[uint32_t(isa)];
+		registry.selected_isa = isa;
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Dispatched batch functions, see the batch function of the same name for details.
+	//////////////////////////////////////////////////////////////////////////
+
+	inline void quat_mul_soa_dispatch(const const_float4f_soa& lhs, const const_float4f_soa& rhs, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().quat_mul_soa(&lhs, &rhs, &output, num_quats);
+	}
+
+	inline void quat_lerp_soa_dispatch(const const_float4f_soa& start, const const_float4f_soa& end, const float* alphas, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().quat_lerp_soa(&start, &end, alphas, &output, num_quats);
+	}
+
+	inline void quat_slerp_fast_soa_dispatch(const const_float4f_soa& start, const const_float4f_soa& end, const float* alphas, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().quat_slerp_fast_soa(&start, &end, alphas, &output, num_quats);
+	}
+
+	inline void matrix_from_quat_aos_dispatch(const quatf* input, matrix3x4f* output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().matrix_from_quat_aos(input, output, num_quats);
+	}
+
+	inline void quat_from_matrix_aos_dispatch(const matrix3x4f* input, quatf* output, uint32_t num_matrices) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().quat_from_matrix_aos(input, output, num_matrices);
+	}
+
+	inline void matrix_mul_aos_dispatch(const matrix3x4f* lhs, const matrix3x4f* rhs, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().matrix_mul_aos(lhs, rhs, output, num_matrices, uint32_t(mode));
+	}
+
+	inline void qvv_mul_aos_dispatch(const qvvf* lhs, const qvvf* rhs, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().qvv_mul_aos(lhs, rhs, output, num_transforms);
+	}
+
+	inline void matrix_from_qvv_aos_dispatch(const qvvf* input, float3x4f* output, uint32_t num_transforms, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().matrix_from_qvv_aos(input, output, num_transforms, uint32_t(mode));
+	}
+
+	inline void qvv_mul_point3_aos_dispatch(const qvvf& transform, const float3f* points, float3f* output, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().qvv_mul_point3_aos(&transform, points, output, num_points);
+	}
+
+	inline void qvv_mul_point3_indexed_aos_dispatch(const qvvf* transforms, const uint32_t* transform_indices, const float3f* points, float3f* output, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().qvv_mul_point3_indexed_aos(transforms, transform_indices, points, output, num_points);
+	}
+
+	inline void qvv_load_array_dispatch(const qvvf_packed* input, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().qvv_load_packed_array(input, output, num_transforms);
+	}
+
+	inline void qvv_store_array_dispatch(const qvvf* input, qvvf_packed* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().qvv_store_packed_array(input, output, num_transforms);
+	}
+
+	inline void vector_range_soa_dispatch(const const_float4f_soa& samples, uint32_t num_samples, vector4f& out_range_min, vector4f& out_range_extent) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().vector_range_soa(&samples, 4, num_samples, &out_range_min, &out_range_extent);
+	}
+
+	inline void vector_range_soa_dispatch(const const_float3f_soa& samples, uint32_t num_samples, vector4f& out_range_min, vector4f& out_range_extent) RTM_NO_EXCEPT
+	{
+		const const_float4f_soa samples4 = { samples.x, samples.y, samples.z, nullptr };
+		rtm_impl::get_dispatch_kernels().vector_range_soa(&samples4, 3, num_samples, &out_range_min, &out_range_extent);
+	}
+
+	inline void RTM_SIMD_CALL pack_range_reduce_unorm_soa_dispatch(const const_float4f_soa& samples, vector4f_arg0 range_min, vector4f_arg1 range_extent, uint32_t num_bits, const quantized4_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		const vector4f range_min_ = range_min;
+		const vector4f range_extent_ = range_extent;
+		rtm_impl::get_dispatch_kernels().pack_range_reduce_unorm_soa(&samples, 4, &range_min_, &range_extent_, num_bits, &output, num_samples);
+	}
+
+	inline void RTM_SIMD_CALL pack_range_reduce_unorm_soa_dispatch(const const_float3f_soa& samples, vector4f_arg0 range_min, vector4f_arg1 range_extent, uint32_t num_bits, const quantized4_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		const const_float4f_soa samples4 = { samples.x, samples.y, samples.z, nullptr };
+		const vector4f range_min_ = range_min;
+		const vector4f range_extent_ = range_extent;
+		rtm_impl::get_dispatch_kernels().pack_range_reduce_unorm_soa(&samples4, 3, &range_min_, &range_extent_, num_bits, &output, num_samples);
+	}
+
+	inline void RTM_SIMD_CALL unpack_range_expand_unorm_soa_dispatch(const const_quantized4_soa& input, uint32_t num_bits, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float4f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		const vector4f range_min_ = range_min;
+		const vector4f range_extent_ = range_extent;
+		rtm_impl::get_dispatch_kernels().unpack_range_expand_unorm_soa(&input, 4, num_bits, &range_min_, &range_extent_, &output, num_samples);
+	}
+
+	inline void RTM_SIMD_CALL unpack_range_expand_unorm_soa_dispatch(const const_quantized4_soa& input, uint32_t num_bits, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float3f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		const float4f_soa output4 = { output.x, output.y, output.z, nullptr };
+		const vector4f range_min_ = range_min;
+		const vector4f range_extent_ = range_extent;
+		rtm_impl::get_dispatch_kernels().unpack_range_expand_unorm_soa(&input, 3, num_bits, &range_min_, &range_extent_, &output4, num_samples);
+	}
+
+	inline void dualquat_blend4_aos_dispatch(const dualquatf* palette, const uint16_t* bone_indices, const float* bone_weights, dualquatf* output, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		rtm_impl::get_dispatch_kernels().dualquat_blend4_aos(palette, bone_indices, bone_weights, output, num_vertices);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,88 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// Compiles the batch kernels for runtime dispatch, see rtm/batch/dispatch.h.
+//
+// Include this header in its own translation unit, before anything else and
+// without any other RTM header. Compile that translation unit with the instruction
+// sets of the variant enabled: SSE4.1 (-msse4.1), AVX (-mavx or /arch:AVX), or
+// AVX2 (-mavx2 -mfma -mf16c or /arch:AVX2). The variant is named after them.
+//
+// The RTM functions are inline and would otherwise be emitted under the same names
+// as in the rest of the program. Since they are compiled here with different
+// instructions, the linker could pick these copies and run them on CPUs that don't
+// support them. To avoid this, the rtm namespace is renamed while the kernels are
+// compiled and everything stays private to the variant.
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(RTM_NO_INTRINSICS)
+	#error "Batch dispatch variants require intrinsics"
+#endif
+
+#if defined(__AVX2__)
+	#define RTM_IMPL_DISPATCH_VARIANT avx2
+#elif defined(__AVX__)
+	#define RTM_IMPL_DISPATCH_VARIANT avx
+#elif defined(__SSE4_1__)
+	#define RTM_IMPL_DISPATCH_VARIANT sse4
+#else
+	#error "Batch dispatch variants must be compiled with SSE4.1, AVX, or AVX2 enabled"
+#endif
+
+// Standard headers included by RTM are included first so they are not affected by the renaming
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "rtm/impl/batch_kernel_table.h"
+
+#define RTM_IMPL_DISPATCH_CONCAT_IMPL(prefix, suffix) prefix ## suffix
+#define RTM_IMPL_DISPATCH_CONCAT(prefix, suffix) RTM_IMPL_DISPATCH_CONCAT_IMPL(prefix, suffix)
+#define RTM_IMPL_DISPATCH_NAMESPACE RTM_IMPL_DISPATCH_CONCAT(rtm_dispatch_, RTM_IMPL_DISPATCH_VARIANT)
+
+#define rtm RTM_IMPL_DISPATCH_NAMESPACE
+#include "rtm/impl/batch_kernels.h"
+#undef rtm
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		void RTM_IMPL_DISPATCH_CONCAT(get_batch_kernels_, RTM_IMPL_DISPATCH_VARIANT)(batch_kernel_table& out_table)
+		{
+			RTM_IMPL_DISPATCH_NAMESPACE::rtm_impl::fill_batch_kernel_table(out_table);
+		}
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/dualquatf.h"
+#include "rtm/quatf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Blends the dual quaternions of 'num_vertices' vertices with 4 influences each.
+	// 'bone_indices' and 'bone_weights' hold 4 entries per vertex that reference
+	// the normalized dual quaternions of the 'palette'. Influences in the opposite
+	// hemisphere of the first influence are flipped and the result is normalized,
+	// it can then be used with dualquat_mul_point3(..).
+	// Unused influences must have a zero weight and the weights of a vertex cannot
+	// all be zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline void dualquat_blend4_aos(const dualquatf* palette, const uint16_t* bone_indices, const float* bone_weights, dualquatf* output, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::dualquat_blend4_aos", num_vertices, num_vertices * ((sizeof(uint16_t) + sizeof(float)) * 4 + sizeof(dualquatf)));
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		{
+			const uint16_t* vertex_bone_indices = bone_indices + (vertex_index * 4);
+
+			const dualquatf& influence0 = palette[vertex_bone_indices[0]];
+			const dualquatf& influence1 = palette[vertex_bone_indices[1]];
+			const dualquatf& influence2 = palette[vertex_bone_indices[2]];
+			const dualquatf& influence3 = palette[vertex_bone_indices[3]];
+
+			const vector4f real0 = quat_to_vector(influence0.real);
+			const vector4f real1 = quat_to_vector(influence1.real);
+			const vector4f real2 = quat_to_vector(influence2.real);
+			const vector4f real3 = quat_to_vector(influence3.real);
+
+			// The 4 dot products with the first influence are reduced together with a transpose
+			vector4f dot0 = vector_mul(real0, real0);
+			vector4f dot1 = vector_mul(real1, real0);
+			vector4f dot2 = vector_mul(real2, real0);
+			vector4f dot3 = vector_mul(real3, real0);
+			vector_transpose4x4(dot0, dot1, dot2, dot3);
+			const vector4f dots = vector_add(vector_add(dot0, dot1), vector_add(dot2, dot3));
+
+			// Influences in the opposite hemisphere of the first one are flipped to take the shortest path
+			const vector4f weights = vector_load(bone_weights + (vertex_index * 4));
+			const vector4f signed_weights = vector_select(vector_less_than(dots, vector_zero()), vector_neg(weights), weights);
+
+			const vector4f weight0 = vector_dup_x(signed_weights);
+			const vector4f weight1 = vector_dup_y(signed_weights);
+			const vector4f weight2 = vector_dup_z(signed_weights);
+			const vector4f weight3 = vector_dup_w(signed_weights);
+
+			const vector4f real = vector_mul_add(real3, weight3, vector_mul_add(real2, weight2, vector_mul_add(real1, weight1, vector_mul(real0, weight0))));
+
+			vector4f dual = vector_mul(quat_to_vector(influence0.dual), weight0);
+			dual = vector_mul_add(quat_to_vector(influence1.dual), weight1, dual);
+			dual = vector_mul_add(quat_to_vector(influence2.dual), weight2, dual);
+			dual = vector_mul_add(quat_to_vector(influence3.dual), weight3, dual);
+
+			output[vertex_index] = dualquat_normalize(dualquatf{ vector_to_quat(real), vector_to_quat(dual) });
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
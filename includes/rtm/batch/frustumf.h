@@ -0,0 +1,212 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/frustumf.h"
+#include "rtm/matrix4x4x8f.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Tests 'num_spheres' spheres stored as structure of arrays against the frustum.
+	// The output holds one bit per sphere, set when it is inside or intersects the frustum:
+	// sphere 'i' maps to bit 'i % 32' of output_bits[i / 32].
+	// The output must hold (num_spheres + 31) / 32 entries, unused bits of the last entry are cleared.
+	// The planes are broadcast once and each iteration tests 8 spheres (4 without AVX).
+	//////////////////////////////////////////////////////////////////////////
+	inline void frustum_cull_spheres_soa(const frustumf& frustum, const const_float3f_soa& centers, const float* radii, uint32_t* output_bits, uint32_t num_spheres) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::frustum_cull_spheres_soa", num_spheres, num_spheres * sizeof(float) * 4);
+		const uint32_t num_words = (num_spheres + 31) / 32;
+		for (uint32_t word_index = 0; word_index < num_words; ++word_index)
+			output_bits[word_index] = 0;
+
+		uint32_t sphere_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+		{
+			const rtm_impl::frustum_planes8 planes = rtm_impl::frustum_to_planes8(frustum);
+			const vector8f zero = vector8_zero();
+
+			for (; sphere_index + 8 <= num_spheres; sphere_index += 8)
+			{
+				const vector3x8f center = vector3x8_load(centers, sphere_index);
+				const vector8f radius = vector8_load(radii + sphere_index);
+				const vector8f distance = rtm_impl::frustum_sphere_distance(planes, center.x, center.y, center.z, radius);
+
+				// Groups of 8 never straddle two output entries
+				output_bits[sphere_index / 32] |= mask_get_bits(vector_greater_equal(distance, zero)) << (sphere_index % 32);
+			}
+		}
+#endif
+
+		{
+			const rtm_impl::frustum_planes4 planes = rtm_impl::frustum_to_planes4(frustum);
+			const vector4f zero = vector_zero();
+
+			for (; sphere_index + 4 <= num_spheres; sphere_index += 4)
+			{
+				const vector4f center_x = vector_load(centers.x + sphere_index);
+				const vector4f center_y = vector_load(centers.y + sphere_index);
+				const vector4f center_z = vector_load(centers.z + sphere_index);
+				const vector4f radius = vector_load(radii + sphere_index);
+				const vector4f distance = rtm_impl::frustum_sphere_distance(planes, center_x, center_y, center_z, radius);
+
+				output_bits[sphere_index / 32] |= mask_get_bits(vector_greater_equal(distance, zero)) << (sphere_index % 32);
+			}
+		}
+
+		for (; sphere_index < num_spheres; ++sphere_index)
+		{
+			const vector4f center = vector_set(centers.x[sphere_index], centers.y[sphere_index], centers.z[sphere_index]);
+			if (frustum_intersects_sphere(frustum, center, radii[sphere_index]))
+				output_bits[sphere_index / 32] |= 1U << (sphere_index % 32);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Tests 'num_boxes' axis aligned bounding boxes stored as structure of arrays against the frustum.
+	// Each box is described by its center and its half extent along each axis.
+	// The output holds one bit per box, set when it is inside or intersects the frustum:
+	// box 'i' maps to bit 'i % 32' of output_bits[i / 32].
+	// The output must hold (num_boxes + 31) / 32 entries, unused bits of the last entry are cleared.
+	// The planes are broadcast once and each iteration tests 8 boxes (4 without AVX).
+	//////////////////////////////////////////////////////////////////////////
+	inline void frustum_cull_aabbs_soa(const frustumf& frustum, const const_float3f_soa& centers, const const_float3f_soa& extents, uint32_t* output_bits, uint32_t num_boxes) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::frustum_cull_aabbs_soa", num_boxes, num_boxes * sizeof(float) * 6);
+		const uint32_t num_words = (num_boxes + 31) / 32;
+		for (uint32_t word_index = 0; word_index < num_words; ++word_index)
+			output_bits[word_index] = 0;
+
+		uint32_t box_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+		{
+			const rtm_impl::frustum_planes8 planes = rtm_impl::frustum_to_planes8(frustum);
+			const vector8f zero = vector8_zero();
+
+			for (; box_index + 8 <= num_boxes; box_index += 8)
+			{
+				const vector3x8f center = vector3x8_load(centers, box_index);
+				const vector3x8f extent = vector3x8_load(extents, box_index);
+				const vector8f distance = rtm_impl::frustum_aabb_distance(planes, center.x, center.y, center.z, extent.x, extent.y, extent.z);
+
+				// Groups of 8 never straddle two output entries
+				output_bits[box_index / 32] |= mask_get_bits(vector_greater_equal(distance, zero)) << (box_index % 32);
+			}
+		}
+#endif
+
+		{
+			const rtm_impl::frustum_planes4 planes = rtm_impl::frustum_to_planes4(frustum);
+			const vector4f zero = vector_zero();
+
+			for (; box_index + 4 <= num_boxes; box_index += 4)
+			{
+				const vector4f center_x = vector_load(centers.x + box_index);
+				const vector4f center_y = vector_load(centers.y + box_index);
+				const vector4f center_z = vector_load(centers.z + box_index);
+				const vector4f extent_x = vector_load(extents.x + box_index);
+				const vector4f extent_y = vector_load(extents.y + box_index);
+				const vector4f extent_z = vector_load(extents.z + box_index);
+				const vector4f distance = rtm_impl::frustum_aabb_distance(planes, center_x, center_y, center_z, extent_x, extent_y, extent_z);
+
+				output_bits[box_index / 32] |= mask_get_bits(vector_greater_equal(distance, zero)) << (box_index % 32);
+			}
+		}
+
+		for (; box_index < num_boxes; ++box_index)
+		{
+			const vector4f center = vector_set(centers.x[box_index], centers.y[box_index], centers.z[box_index]);
+			const vector4f extent = vector_set(extents.x[box_index], extents.y[box_index], extents.z[box_index]);
+			if (frustum_intersects_aabb(frustum, center, extent))
+				output_bits[box_index / 32] |= 1U << (box_index % 32);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the frustum planes of 'num_frustums' world to clip space matrices, at most 8.
+	// Each plane is computed lane-wise from the matrix columns, see frustum_from_matrix(..).
+	// e.g. the 6 faces of a cube map or the cascades of a shadow map.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL frustum_from_matrix(matrix4x4x8f_arg0 world_to_clip, frustumf* output, uint32_t num_frustums, clip_depth_range depth_range = clip_depth_range::zero_to_one) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_frustums <= 8, "At most 8 frustums can be extracted");
+
+		// Every clip space component is the dot product of the point with a column of the matrix
+		const vector4x8f column_x{ world_to_clip.x_axis.x, world_to_clip.y_axis.x, world_to_clip.z_axis.x, world_to_clip.w_axis.x };
+		const vector4x8f column_y{ world_to_clip.x_axis.y, world_to_clip.y_axis.y, world_to_clip.z_axis.y, world_to_clip.w_axis.y };
+		const vector4x8f column_z{ world_to_clip.x_axis.z, world_to_clip.y_axis.z, world_to_clip.z_axis.z, world_to_clip.w_axis.z };
+		const vector4x8f column_w{ world_to_clip.x_axis.w, world_to_clip.y_axis.w, world_to_clip.z_axis.w, world_to_clip.w_axis.w };
+
+		vector4x8f planes[6] =
+		{
+			vector4x8f{ vector_add(column_w.x, column_x.x), vector_add(column_w.y, column_x.y), vector_add(column_w.z, column_x.z), vector_add(column_w.w, column_x.w) },	// Left: x >= -w
+			vector4x8f{ vector_sub(column_w.x, column_x.x), vector_sub(column_w.y, column_x.y), vector_sub(column_w.z, column_x.z), vector_sub(column_w.w, column_x.w) },	// Right: x <= w
+			vector4x8f{ vector_add(column_w.x, column_y.x), vector_add(column_w.y, column_y.y), vector_add(column_w.z, column_y.z), vector_add(column_w.w, column_y.w) },	// Bottom: y >= -w
+			vector4x8f{ vector_sub(column_w.x, column_y.x), vector_sub(column_w.y, column_y.y), vector_sub(column_w.z, column_y.z), vector_sub(column_w.w, column_y.w) },	// Top: y <= w
+			depth_range == clip_depth_range::zero_to_one ? column_z	// Near: z >= 0 or z >= -w
+				: vector4x8f{ vector_add(column_w.x, column_z.x), vector_add(column_w.y, column_z.y), vector_add(column_w.z, column_z.z), vector_add(column_w.w, column_z.w) },
+			vector4x8f{ vector_sub(column_w.x, column_z.x), vector_sub(column_w.y, column_z.y), vector_sub(column_w.z, column_z.z), vector_sub(column_w.w, column_z.w) },	// Far: z <= w
+		};
+
+		const vector8f one = vector8_set(1.0F);
+		for (vector4x8f& plane : planes)
+		{
+			const vector8f length_reciprocal = vector_div(one, vector_sqrt(vector_mul_add(plane.z, plane.z, vector_mul_add(plane.y, plane.y, vector_mul(plane.x, plane.x)))));
+			plane = vector4x8f{ vector_mul(plane.x, length_reciprocal), vector_mul(plane.y, length_reciprocal), vector_mul(plane.z, length_reciprocal), vector_mul(plane.w, length_reciprocal) };
+		}
+
+		// Two planes per row, after the transpose each row holds both planes of a frustum
+		frustumf frustums[8];
+		for (uint32_t plane_index = 0; plane_index < 6; plane_index += 2)
+		{
+			const vector4x8f& plane0 = planes[plane_index + 0];
+			const vector4x8f& plane1 = planes[plane_index + 1];
+			vector8f rows[8] = { plane0.x, plane0.y, plane0.z, plane0.w, plane1.x, plane1.y, plane1.z, plane1.w };
+			vector_transpose8x8(rows[0], rows[1], rows[2], rows[3], rows[4], rows[5], rows[6], rows[7]);
+
+			for (uint32_t frustum_index = 0; frustum_index < 8; ++frustum_index)
+			{
+				frustums[frustum_index].planes[plane_index + 0] = vector_get_low(rows[frustum_index]);
+				frustums[frustum_index].planes[plane_index + 1] = vector_get_high(rows[frustum_index]);
+			}
+		}
+
+		for (uint32_t frustum_index = 0; frustum_index < num_frustums; ++frustum_index)
+			output[frustum_index] = frustums[frustum_index];
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,663 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x3f.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		// How many matrices ahead we prefetch, each matrix3x4f spans a single 64 byte cache line
+		constexpr uint32_t k_matrix_mul_prefetch_distance = 4;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the axes of a matrix as a matrix3x4f.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_batch_store(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, vector4f_arg3 w_axis, matrix3x4f* output, store_mode mode) RTM_NO_EXCEPT
+		{
+			float* output_ptr = reinterpret_cast<float*>(output);
+			batch_store(x_axis, output_ptr + 0, mode);
+			batch_store(y_axis, output_ptr + 4, mode);
+			batch_store(z_axis, output_ptr + 8, mode);
+			batch_store(w_axis, output_ptr + 12, mode);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the axes of a matrix as the transposed float3x4f layout.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_batch_store(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, vector4f_arg3 w_axis, float3x4f* output, store_mode mode) RTM_NO_EXCEPT
+		{
+			// The last row only holds the [w] components of the axes, it is discarded
+			vector4f x_row = x_axis;
+			vector4f y_row = y_axis;
+			vector4f z_row = z_axis;
+			vector4f w_row = w_axis;
+			vector_transpose4x4(x_row, y_row, z_row, w_row);
+
+			batch_store(x_row, &output->x_row.x, mode);
+			batch_store(y_row, &output->y_row.x, mode);
+			batch_store(z_row, &output->z_row.x, mode);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 'num_matrices' matrices, the rhs advances by 'rhs_stride' matrices
+		// per output which allows a single rhs to be shared with a stride of 0.
+		// When 'lhs_indices' isn't null, the lhs matrices are gathered by index instead.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename OutputType>
+		inline void matrix_mul_aos_impl(const matrix3x4f* lhs, const uint32_t* lhs_indices, const matrix3x4f* rhs, uint32_t rhs_stride, OutputType* output, uint32_t num_matrices, store_mode mode) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+			for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			{
+				if (matrix_index + k_matrix_mul_prefetch_distance < num_matrices)
+				{
+					if (lhs_indices != nullptr)
+						batch_prefetch_indexed(lhs, lhs_indices, matrix_index, num_matrices, k_matrix_mul_prefetch_distance);
+					else
+						batch_prefetch(lhs + matrix_index + k_matrix_mul_prefetch_distance);
+					batch_prefetch(rhs + (matrix_index + k_matrix_mul_prefetch_distance) * rhs_stride);
+				}
+
+				const matrix3x4f* lhs_mtx = lhs + (lhs_indices != nullptr ? lhs_indices[matrix_index] : matrix_index);
+				const matrix3x4f* rhs_mtx = rhs + matrix_index * rhs_stride;
+
+#if defined(RTM_AVX_INTRINSICS)
+				// Two lhs axes per register, the rhs axes are broadcast to both halves
+				const float* lhs_ptr = reinterpret_cast<const float*>(lhs_mtx);
+				const vector8f lhs_xy = _mm256_loadu_ps(lhs_ptr + 0);
+				const vector8f lhs_zw = _mm256_loadu_ps(lhs_ptr + 8);
+
+				const float* rhs_ptr = reinterpret_cast<const float*>(rhs_mtx);
+				const vector8f rhs_x = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs_ptr + 0));
+				const vector8f rhs_y = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs_ptr + 4));
+				const vector8f rhs_z = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(rhs_ptr + 8));
+				const vector8f rhs_w = _mm256_insertf128_ps(_mm256_setzero_ps(), _mm_loadu_ps(rhs_ptr + 12), 1);
+
+				vector8f result_xy = vector_mul(_mm256_permute_ps(lhs_xy, _MM_SHUFFLE(0, 0, 0, 0)), rhs_x);
+				result_xy = vector_mul_add(_mm256_permute_ps(lhs_xy, _MM_SHUFFLE(1, 1, 1, 1)), rhs_y, result_xy);
+				result_xy = vector_mul_add(_mm256_permute_ps(lhs_xy, _MM_SHUFFLE(2, 2, 2, 2)), rhs_z, result_xy);
+
+				vector8f result_zw = vector_mul(_mm256_permute_ps(lhs_zw, _MM_SHUFFLE(0, 0, 0, 0)), rhs_x);
+				result_zw = vector_mul_add(_mm256_permute_ps(lhs_zw, _MM_SHUFFLE(1, 1, 1, 1)), rhs_y, result_zw);
+				result_zw = vector_mul_add(_mm256_permute_ps(lhs_zw, _MM_SHUFFLE(2, 2, 2, 2)), rhs_z, result_zw);
+				result_zw = vector_add(rhs_w, result_zw);
+
+				matrix_batch_store(vector_get_low(result_xy), vector_get_high(result_xy), vector_get_low(result_zw), vector_get_high(result_zw), output + matrix_index, mode);
+#else
+				const matrix3x4f result = matrix_mul(*lhs_mtx, *rhs_mtx);
+				matrix_batch_store(result.x_axis, result.y_axis, result.z_axis, result.w_axis, output + matrix_index, mode);
+#endif
+			}
+
+			batch_store_fence(mode);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 'num_matrices' matrices whose 3x3 part is orthogonal, with or without uniform scale.
+		//////////////////////////////////////////////////////////////////////////
+		template<bool with_scale>
+		inline void matrix_inverse_orthogonal_aos_impl(const matrix3x4f* input, matrix3x4f* output, uint32_t num_matrices, store_mode mode) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+			const vector4f one = vector_set(1.0F);
+
+			for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			{
+				if (matrix_index + k_matrix_mul_prefetch_distance < num_matrices)
+					batch_prefetch(input + matrix_index + k_matrix_mul_prefetch_distance);
+
+				const matrix3x4f& mtx = input[matrix_index];
+
+				vector4f inv_scale_sq = one;
+				if (static_condition<with_scale>::test())
+				{
+					const scalarf scale_sq = vector_length_squared3(mtx.x_axis);
+					inv_scale_sq = vector_set(scalar_reciprocal(scale_sq));
+				}
+
+				vector4f x_axis;
+				vector4f y_axis;
+				vector4f z_axis;
+				vector4f w_axis;
+				matrix_inverse_orthogonal(mtx.x_axis, mtx.y_axis, mtx.z_axis, mtx.w_axis, inv_scale_sq, x_axis, y_axis, z_axis, w_axis);
+				matrix_batch_store(x_axis, y_axis, z_axis, w_axis, output + matrix_index, mode);
+			}
+
+			batch_store_fence(mode);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the orthonormalized axes of a matrix, the translation of a 3x4 matrix is retained.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_batch_store_orthonormal(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, const matrix3x4f& input, matrix3x4f* output, store_mode mode) RTM_NO_EXCEPT
+		{
+			matrix_batch_store(x_axis, y_axis, z_axis, input.w_axis, output, mode);
+		}
+
+		inline void RTM_SIMD_CALL matrix_batch_store_orthonormal(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, const matrix3x3f& input, matrix3x3f* output, store_mode mode) RTM_NO_EXCEPT
+		{
+			(void)input;
+
+			float* output_ptr = reinterpret_cast<float*>(output);
+			batch_store(x_axis, output_ptr + 0, mode);
+			batch_store(y_axis, output_ptr + 4, mode);
+			batch_store(z_axis, output_ptr + 8, mode);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Normalizes 3 component vectors stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_normalize3_soa4(vector4f& x, vector4f& y, vector4f& z) RTM_NO_EXCEPT
+		{
+			const vector4f length_sq = vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x)));
+			const vector4f inv_length = vector_div(vector_set(1.0F), vector_sqrt(length_sq));
+			x = vector_mul(x, inv_length);
+			y = vector_mul(y, inv_length);
+			z = vector_mul(z, inv_length);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Orthonormalizes 'num_matrices' matrices with Gram-Schmidt, 4 at a time as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename matrix_type>
+		inline void matrix_orthonormalize_aos_impl(const matrix_type* input, matrix_type* output, uint32_t num_matrices, store_mode mode) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+			const vector4f zero = vector_zero();
+
+			uint32_t matrix_index = 0;
+			for (; matrix_index + 4 <= num_matrices; matrix_index += 4)
+			{
+				if (matrix_index + 4 + k_matrix_mul_prefetch_distance <= num_matrices)
+				{
+					for (uint32_t prefetch_index = 0; prefetch_index < 4; ++prefetch_index)
+						batch_prefetch(input + matrix_index + k_matrix_mul_prefetch_distance + prefetch_index);
+				}
+
+				const matrix_type* input_mtx = input + matrix_index;
+
+				// Transpose the axes of 4 matrices, the [w] components are unused
+				vector4f x_axis_x = input_mtx[0].x_axis;
+				vector4f x_axis_y = input_mtx[1].x_axis;
+				vector4f x_axis_z = input_mtx[2].x_axis;
+				vector4f x_axis_w = input_mtx[3].x_axis;
+				vector_transpose4x4(x_axis_x, x_axis_y, x_axis_z, x_axis_w);
+
+				vector4f y_axis_x = input_mtx[0].y_axis;
+				vector4f y_axis_y = input_mtx[1].y_axis;
+				vector4f y_axis_z = input_mtx[2].y_axis;
+				vector4f y_axis_w = input_mtx[3].y_axis;
+				vector_transpose4x4(y_axis_x, y_axis_y, y_axis_z, y_axis_w);
+
+				vector4f z_axis_x = input_mtx[0].z_axis;
+				vector4f z_axis_y = input_mtx[1].z_axis;
+				vector4f z_axis_z = input_mtx[2].z_axis;
+				vector4f z_axis_w = input_mtx[3].z_axis;
+				vector_transpose4x4(z_axis_x, z_axis_y, z_axis_z, z_axis_w);
+
+				matrix_normalize3_soa4(x_axis_x, x_axis_y, x_axis_z);
+
+				const vector4f y_dot_x = vector_mul_add(y_axis_z, x_axis_z, vector_mul_add(y_axis_y, x_axis_y, vector_mul(y_axis_x, x_axis_x)));
+				y_axis_x = vector_neg_mul_sub(x_axis_x, y_dot_x, y_axis_x);
+				y_axis_y = vector_neg_mul_sub(x_axis_y, y_dot_x, y_axis_y);
+				y_axis_z = vector_neg_mul_sub(x_axis_z, y_dot_x, y_axis_z);
+				matrix_normalize3_soa4(y_axis_x, y_axis_y, y_axis_z);
+
+				// The cross product is already normalized, its sign retains reflections
+				vector4f cross_x = vector_neg_mul_sub(x_axis_z, y_axis_y, vector_mul(x_axis_y, y_axis_z));
+				vector4f cross_y = vector_neg_mul_sub(x_axis_x, y_axis_z, vector_mul(x_axis_z, y_axis_x));
+				vector4f cross_z = vector_neg_mul_sub(x_axis_y, y_axis_x, vector_mul(x_axis_x, y_axis_y));
+
+				const vector4f z_sign = vector_mul_add(z_axis_z, cross_z, vector_mul_add(z_axis_y, cross_y, vector_mul(z_axis_x, cross_x)));
+				const mask4f is_reflection = vector_less_than(z_sign, zero);
+				cross_x = vector_select(is_reflection, vector_neg(cross_x), cross_x);
+				cross_y = vector_select(is_reflection, vector_neg(cross_y), cross_y);
+				cross_z = vector_select(is_reflection, vector_neg(cross_z), cross_z);
+
+				// Transpose back, the [w] components end up zero
+				x_axis_w = zero;
+				vector_transpose4x4(x_axis_x, x_axis_y, x_axis_z, x_axis_w);
+				y_axis_w = zero;
+				vector_transpose4x4(y_axis_x, y_axis_y, y_axis_z, y_axis_w);
+				z_axis_w = zero;
+				vector_transpose4x4(cross_x, cross_y, cross_z, z_axis_w);
+
+				matrix_batch_store_orthonormal(x_axis_x, y_axis_x, cross_x, input_mtx[0], output + matrix_index + 0, mode);
+				matrix_batch_store_orthonormal(x_axis_y, y_axis_y, cross_y, input_mtx[1], output + matrix_index + 1, mode);
+				matrix_batch_store_orthonormal(x_axis_z, y_axis_z, cross_z, input_mtx[2], output + matrix_index + 2, mode);
+				matrix_batch_store_orthonormal(x_axis_w, y_axis_w, z_axis_w, input_mtx[3], output + matrix_index + 3, mode);
+			}
+
+			for (; matrix_index < num_matrices; ++matrix_index)
+			{
+				const matrix_type& mtx = input[matrix_index];
+
+				vector4f x_axis;
+				vector4f y_axis;
+				vector4f z_axis;
+				matrix_orthonormalize(mtx.x_axis, mtx.y_axis, mtx.z_axis, x_axis, y_axis, z_axis);
+				matrix_batch_store_orthonormal(x_axis, y_axis, z_axis, mtx, output + matrix_index, mode);
+			}
+
+			batch_store_fence(mode);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 'num_matrices' 3x4 affine matrices, 4 at a time as structure of arrays.
+		// With a fallback, lanes whose determinant is below the threshold are replaced by it.
+		//////////////////////////////////////////////////////////////////////////
+		template<bool with_fallback>
+		inline void matrix_inverse_aos_impl(const matrix3x4f* input, matrix3x4f* output, uint32_t num_matrices, const matrix3x4f& fallback, float threshold, store_mode mode) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+			const vector4f zero = vector_zero();
+			const vector4f threshold4 = vector_set(threshold);
+
+			uint32_t matrix_index = 0;
+			for (; matrix_index + 4 <= num_matrices; matrix_index += 4)
+			{
+				if (matrix_index + 4 + k_matrix_mul_prefetch_distance <= num_matrices)
+				{
+					for (uint32_t prefetch_index = 0; prefetch_index < 4; ++prefetch_index)
+						batch_prefetch(input + matrix_index + k_matrix_mul_prefetch_distance + prefetch_index);
+				}
+
+				const matrix3x4f* input_mtx = input + matrix_index;
+
+				// Transpose the axes of 4 matrices, the [w] components are unused
+				vector4f m00 = input_mtx[0].x_axis;
+				vector4f m01 = input_mtx[1].x_axis;
+				vector4f m02 = input_mtx[2].x_axis;
+				vector4f unused = input_mtx[3].x_axis;
+				vector_transpose4x4(m00, m01, m02, unused);
+
+				vector4f m10 = input_mtx[0].y_axis;
+				vector4f m11 = input_mtx[1].y_axis;
+				vector4f m12 = input_mtx[2].y_axis;
+				unused = input_mtx[3].y_axis;
+				vector_transpose4x4(m10, m11, m12, unused);
+
+				vector4f m20 = input_mtx[0].z_axis;
+				vector4f m21 = input_mtx[1].z_axis;
+				vector4f m22 = input_mtx[2].z_axis;
+				unused = input_mtx[3].z_axis;
+				vector_transpose4x4(m20, m21, m22, unused);
+
+				vector4f m30 = input_mtx[0].w_axis;
+				vector4f m31 = input_mtx[1].w_axis;
+				vector4f m32 = input_mtx[2].w_axis;
+				unused = input_mtx[3].w_axis;
+				vector_transpose4x4(m30, m31, m32, unused);
+
+				// Cofactors of the 3x3 portion, transposed
+				vector4f x_axis_x = vector_neg_mul_sub(m12, m21, vector_mul(m11, m22));
+				vector4f x_axis_y = vector_neg_mul_sub(m01, m22, vector_mul(m02, m21));
+				vector4f x_axis_z = vector_neg_mul_sub(m02, m11, vector_mul(m01, m12));
+				vector4f y_axis_x = vector_neg_mul_sub(m10, m22, vector_mul(m12, m20));
+				vector4f y_axis_y = vector_neg_mul_sub(m02, m20, vector_mul(m00, m22));
+				vector4f y_axis_z = vector_neg_mul_sub(m00, m12, vector_mul(m02, m10));
+				vector4f z_axis_x = vector_neg_mul_sub(m11, m20, vector_mul(m10, m21));
+				vector4f z_axis_y = vector_neg_mul_sub(m00, m21, vector_mul(m01, m20));
+				vector4f z_axis_z = vector_neg_mul_sub(m01, m10, vector_mul(m00, m11));
+
+				const vector4f det = vector_mul_add(m02, z_axis_x, vector_mul_add(m01, y_axis_x, vector_mul(m00, x_axis_x)));
+				const vector4f inv_det = vector_reciprocal(det);
+
+				x_axis_x = vector_mul(x_axis_x, inv_det);
+				x_axis_y = vector_mul(x_axis_y, inv_det);
+				x_axis_z = vector_mul(x_axis_z, inv_det);
+				y_axis_x = vector_mul(y_axis_x, inv_det);
+				y_axis_y = vector_mul(y_axis_y, inv_det);
+				y_axis_z = vector_mul(y_axis_z, inv_det);
+				z_axis_x = vector_mul(z_axis_x, inv_det);
+				z_axis_y = vector_mul(z_axis_y, inv_det);
+				z_axis_z = vector_mul(z_axis_z, inv_det);
+
+				// Invert the translation
+				vector4f w_axis_x = vector_neg(vector_mul_add(m30, x_axis_x, vector_mul_add(m31, y_axis_x, vector_mul(m32, z_axis_x))));
+				vector4f w_axis_y = vector_neg(vector_mul_add(m30, x_axis_y, vector_mul_add(m31, y_axis_y, vector_mul(m32, z_axis_y))));
+				vector4f w_axis_z = vector_neg(vector_mul_add(m30, x_axis_z, vector_mul_add(m31, y_axis_z, vector_mul(m32, z_axis_z))));
+
+				// Transpose back, the [w] components end up zero
+				vector4f x_axis_w = zero;
+				vector_transpose4x4(x_axis_x, x_axis_y, x_axis_z, x_axis_w);
+				vector4f y_axis_w = zero;
+				vector_transpose4x4(y_axis_x, y_axis_y, y_axis_z, y_axis_w);
+				vector4f z_axis_w = zero;
+				vector_transpose4x4(z_axis_x, z_axis_y, z_axis_z, z_axis_w);
+				vector4f w_axis_w = zero;
+				vector_transpose4x4(w_axis_x, w_axis_y, w_axis_z, w_axis_w);
+
+				if (static_condition<with_fallback>::test())
+				{
+					// Most groups are invertible, only the singular lanes are replaced
+					const mask4f is_singular = vector_less_than(vector_abs(det), threshold4);
+					if (mask_any_true(is_singular))
+					{
+						const vector4f x_axis[4] = { x_axis_x, x_axis_y, x_axis_z, x_axis_w };
+						const vector4f y_axis[4] = { y_axis_x, y_axis_y, y_axis_z, y_axis_w };
+						const vector4f z_axis[4] = { z_axis_x, z_axis_y, z_axis_z, z_axis_w };
+						const vector4f w_axis[4] = { w_axis_x, w_axis_y, w_axis_z, w_axis_w };
+						const uint32_t is_singular_lane[4] = { mask_get_x(is_singular), mask_get_y(is_singular), mask_get_z(is_singular), mask_get_w(is_singular) };
+
+						for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+						{
+							if (is_singular_lane[lane_index] != 0)
+								matrix_batch_store(fallback.x_axis, fallback.y_axis, fallback.z_axis, fallback.w_axis, output + matrix_index + lane_index, mode);
+							else
+								matrix_batch_store(x_axis[lane_index], y_axis[lane_index], z_axis[lane_index], w_axis[lane_index], output + matrix_index + lane_index, mode);
+						}
+						continue;
+					}
+				}
+
+				matrix_batch_store(x_axis_x, y_axis_x, z_axis_x, w_axis_x, output + matrix_index + 0, mode);
+				matrix_batch_store(x_axis_y, y_axis_y, z_axis_y, w_axis_y, output + matrix_index + 1, mode);
+				matrix_batch_store(x_axis_z, y_axis_z, z_axis_z, w_axis_z, output + matrix_index + 2, mode);
+				matrix_batch_store(x_axis_w, y_axis_w, z_axis_w, w_axis_w, output + matrix_index + 3, mode);
+			}
+
+			for (; matrix_index < num_matrices; ++matrix_index)
+			{
+				const matrix3x4f result = with_fallback ? matrix_inverse(input[matrix_index], fallback, threshold) : matrix_inverse(input[matrix_index]);
+				matrix_batch_store(result.x_axis, result.y_axis, result.z_axis, result.w_axis, output + matrix_index, mode);
+			}
+
+			batch_store_fence(mode);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Orthonormalizes 'num_matrices' matrices with their polar decomposition.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename matrix_type>
+		inline void matrix_orthonormalize_polar_aos_impl(const matrix_type* input, matrix_type* output, uint32_t num_matrices, uint32_t max_iterations, store_mode mode) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+			for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			{
+				if (matrix_index + k_matrix_mul_prefetch_distance < num_matrices)
+					batch_prefetch(input + matrix_index + k_matrix_mul_prefetch_distance);
+
+				const matrix_type& mtx = input[matrix_index];
+
+				vector4f x_axis;
+				vector4f y_axis;
+				vector4f z_axis;
+				matrix_orthonormalize_polar(mtx.x_axis, mtx.y_axis, mtx.z_axis, max_iterations, x_axis, y_axis, z_axis);
+				matrix_batch_store_orthonormal(x_axis, y_axis, z_axis, mtx, output + matrix_index, mode);
+			}
+
+			batch_store_fence(mode);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_matrices' pairs of 3x4 affine matrices: output[i] = matrix_mul(lhs[i], rhs[i]).
+	// e.g. to build a skinning palette from the inverse bind and the object space poses.
+	// Upcoming matrices are prefetched. The output can safely alias either input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_mul_aos(const matrix3x4f* lhs, const matrix3x4f* rhs, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_mul_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 3);
+		rtm_impl::matrix_mul_aos_impl(lhs, nullptr, rhs, 1, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_matrices' pairs of 3x4 affine matrices: output[i] = matrix_mul(lhs[i], rhs[i]).
+	// The output is written transposed as float3x4f, ready to be uploaded to the GPU.
+	// Upcoming matrices are prefetched. The output must not overlap the inputs.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_mul_aos(const matrix3x4f* lhs, const matrix3x4f* rhs, float3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_mul_aos", num_matrices, num_matrices * (sizeof(matrix3x4f) * 2 + sizeof(float3x4f)));
+		rtm_impl::matrix_mul_aos_impl(lhs, nullptr, rhs, 1, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_matrices' 3x4 affine matrices with a shared one: output[i] = matrix_mul(lhs[i], rhs).
+	// Upcoming matrices are prefetched. The output can safely alias the lhs input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_mul_aos(const matrix3x4f* lhs, matrix3x4f_arg0 rhs, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_mul_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+		rtm_impl::matrix_mul_aos_impl(lhs, nullptr, &rhs, 0, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_matrices' 3x4 affine matrices with a shared one: output[i] = matrix_mul(lhs[i], rhs).
+	// The output is written transposed as float3x4f, ready to be uploaded to the GPU.
+	// Upcoming matrices are prefetched. The output must not overlap the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_mul_aos(const matrix3x4f* lhs, matrix3x4f_arg0 rhs, float3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_mul_aos", num_matrices, num_matrices * (sizeof(matrix3x4f) + sizeof(float3x4f)));
+		rtm_impl::matrix_mul_aos_impl(lhs, nullptr, &rhs, 0, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_matrices' 3x4 affine matrices gathered by index with their matching
+	// rhs matrix: output[i] = matrix_mul(lhs[lhs_indices[i]], rhs[i]).
+	// e.g. to build a skinning palette for a LOD skeleton from the full rig.
+	// Upcoming matrices are prefetched. The output can safely alias the rhs input but
+	// not the lhs input. With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_mul_indexed_aos(const matrix3x4f* lhs, const uint32_t* lhs_indices, const matrix3x4f* rhs, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_mul_indexed_aos", num_matrices, num_matrices * (sizeof(matrix3x4f) * 3 + sizeof(uint32_t)));
+		rtm_impl::matrix_mul_aos_impl(lhs, lhs_indices, rhs, 1, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'num_points' 3D points, each by a 3x4 affine matrix gathered by index:
+	// output[i] = matrix_mul_point3(points[i], matrices[matrix_indices[i]]).
+	// e.g. to skin vertices influenced by a single bone with a skinning palette.
+	// The matrix 'prefetch_distance' indices ahead is prefetched, 0 disables it.
+	// The output can safely alias the input points.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_mul_point3_indexed_aos(const matrix3x4f* matrices, const uint32_t* matrix_indices, const float3f* points, float3f* output, uint32_t num_points, uint32_t prefetch_distance = rtm_impl::k_default_gather_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_mul_point3_indexed_aos", num_points, num_points * (sizeof(matrix3x4f) + sizeof(float3f) * 2 + sizeof(uint32_t)));
+
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		{
+			rtm_impl::batch_prefetch_indexed(matrices, matrix_indices, point_index, num_points, prefetch_distance);
+			const vector4f point = vector_load3(points + point_index);
+			vector_store3(matrix_mul_point3(point, matrices[matrix_indices[point_index]]), output + point_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'num_matrices' 3x4 affine matrices: output[i] = matrix_inverse(input[i]).
+	// e.g. to compute inverse bind poses with non-uniform scale or shear.
+	// 4 matrices are processed at a time as structure of arrays. If a matrix is not invertible,
+	// its result is undefined. Upcoming matrices are prefetched. The output can safely alias the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_aos(const matrix3x4f* input, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_inverse_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+		rtm_impl::matrix_inverse_aos_impl<false>(input, output, num_matrices, matrix_identity(), 0.0F, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'num_matrices' 3x4 affine matrices: output[i] = matrix_inverse(input[i], fallback, threshold).
+	// The determinant is checked per lane: matrices whose determinant has an absolute value
+	// below the threshold are replaced by the fallback value.
+	// Upcoming matrices are prefetched. The output can safely alias the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_aos(const matrix3x4f* input, matrix3x4f* output, uint32_t num_matrices, const matrix3x4f& fallback, float threshold = 1.0E-8F, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_inverse_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+		rtm_impl::matrix_inverse_aos_impl<true>(input, output, num_matrices, fallback, threshold, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'num_matrices' 3x4 affine matrices that only contain a rotation and a translation:
+	// output[i] = matrix_inverse_rigid(input[i]).
+	// Upcoming matrices are prefetched. The output can safely alias the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_rigid_aos(const matrix3x4f* input, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_inverse_rigid_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+		rtm_impl::matrix_inverse_orthogonal_aos_impl<false>(input, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'num_matrices' 3x4 affine matrices that contain a rotation, a uniform scale,
+	// and a translation: output[i] = matrix_inverse_uniform_scale(input[i]).
+	// Upcoming matrices are prefetched. The output can safely alias the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_uniform_scale_aos(const matrix3x4f* input, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_inverse_uniform_scale_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+		rtm_impl::matrix_inverse_orthogonal_aos_impl<true>(input, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orthonormalizes 'num_matrices' 3x4 affine matrices with Gram-Schmidt:
+	// output[i] = matrix_orthonormalize(input[i]).
+	// 4 matrices are processed at a time as structure of arrays, the translation is retained.
+	// Upcoming matrices are prefetched. The output can safely alias the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_orthonormalize_aos(const matrix3x4f* input, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_orthonormalize_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+		rtm_impl::matrix_orthonormalize_aos_impl(input, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orthonormalizes 'num_matrices' 3x3 matrices with Gram-Schmidt:
+	// output[i] = matrix_orthonormalize(input[i]).
+	// 4 matrices are processed at a time as structure of arrays.
+	// Upcoming matrices are prefetched. The output can safely alias the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_orthonormalize_aos(const matrix3x3f* input, matrix3x3f* output, uint32_t num_matrices, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_orthonormalize_aos", num_matrices, num_matrices * sizeof(matrix3x3f) * 2);
+		rtm_impl::matrix_orthonormalize_aos_impl(input, output, num_matrices, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orthonormalizes 'num_matrices' 3x4 affine matrices with their polar decomposition:
+	// output[i] = matrix_orthonormalize_polar(input[i], max_iterations).
+	// The translation is retained. Upcoming matrices are prefetched. The output can safely alias the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_orthonormalize_polar_aos(const matrix3x4f* input, matrix3x4f* output, uint32_t num_matrices, uint32_t max_iterations = 8, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_orthonormalize_polar_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+		rtm_impl::matrix_orthonormalize_polar_aos_impl(input, output, num_matrices, max_iterations, mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compares 'num_matrices' 3x4 affine matrices with their value on the previous frame and returns
+	// how many changed. A matrix is clean when every component of its 3 axes is within 'axis_threshold'
+	// and every component of its translation is within 'translation_threshold', like vector_all_near_equal3.
+	// The output holds one bit per matrix, set when it changed:
+	// matrix 'i' maps to bit 'i % 32' of dirty_bits[i / 32].
+	// The output must hold (num_matrices + 31) / 32 entries, unused bits of the last entry are cleared.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t matrix_detect_changes_aos(const matrix3x4f* current, const matrix3x4f* previous, uint32_t num_matrices, float axis_threshold, float translation_threshold, uint32_t* dirty_bits) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_detect_changes_aos", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+		const vector4f axis_threshold_v = vector_set(axis_threshold);
+		const vector4f translation_threshold_v = vector_set(translation_threshold);
+		const mask4f w_mask = vector_less_than(vector_set(0.0F, 0.0F, 0.0F, -1.0F), vector_zero());	// Only [w] is set
+
+		uint32_t num_changed = 0;
+		for (uint32_t word_index = 0, matrix_index = 0; matrix_index < num_matrices; ++word_index)
+		{
+			// Bits are accumulated in a register and each entry is written once
+			const uint32_t word_end = matrix_index + 32 <= num_matrices ? matrix_index + 32 : num_matrices;
+			uint32_t word = 0;
+
+			for (uint32_t bit_index = 0; matrix_index < word_end; ++matrix_index, ++bit_index)
+			{
+				const matrix3x4f& current_matrix = current[matrix_index];
+				const matrix3x4f& previous_matrix = previous[matrix_index];
+
+				const vector4f x_axis_delta = vector_abs(vector_sub(current_matrix.x_axis, previous_matrix.x_axis));
+				const vector4f y_axis_delta = vector_abs(vector_sub(current_matrix.y_axis, previous_matrix.y_axis));
+				const vector4f z_axis_delta = vector_abs(vector_sub(current_matrix.z_axis, previous_matrix.z_axis));
+				const vector4f translation_delta = vector_abs(vector_sub(current_matrix.w_axis, previous_matrix.w_axis));
+
+				// The [w] lane is ignored, the masks are combined before a single movemask
+				const mask4f axes_clean = mask_and(mask_and(vector_less_equal(x_axis_delta, axis_threshold_v), vector_less_equal(y_axis_delta, axis_threshold_v)), vector_less_equal(z_axis_delta, axis_threshold_v));
+				const mask4f is_clean = mask_or(mask_and(axes_clean, vector_less_equal(translation_delta, translation_threshold_v)), w_mask);
+
+				if (mask_get_bits(is_clean) != 0xF)
+				{
+					word |= 1U << bit_index;
+					num_changed++;
+				}
+			}
+
+			dirty_bits[word_index] = word;
+		}
+
+		return num_changed;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orthonormalizes 'num_matrices' 3x3 matrices with their polar decomposition:
+	// output[i] = matrix_orthonormalize_polar(input[i], max_iterations).
+	// Upcoming matrices are prefetched. The output can safely alias the input.
+	// With store_mode::non_temporal, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_orthonormalize_polar_aos(const matrix3x3f* input, matrix3x3f* output, uint32_t num_matrices, uint32_t max_iterations = 8, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_orthonormalize_polar_aos", num_matrices, num_matrices * sizeof(matrix3x3f) * 2);
+		rtm_impl::matrix_orthonormalize_polar_aos_impl(input, output, num_matrices, max_iterations, mode);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
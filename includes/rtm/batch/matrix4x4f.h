@@ -0,0 +1,417 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/mask4f.h"
+#include "rtm/matrix4x4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// A 4x4 matrix with each component broadcast in every lane.
+		//////////////////////////////////////////////////////////////////////////
+		struct matrix4x4f_broadcast4
+		{
+			vector4f x_axis[4];
+			vector4f y_axis[4];
+			vector4f z_axis[4];
+			vector4f w_axis[4];
+		};
+
+		inline matrix4x4f_broadcast4 RTM_SIMD_CALL matrix_broadcast4(matrix4x4f_arg0 input) RTM_NO_EXCEPT
+		{
+			return matrix4x4f_broadcast4{
+				{ vector_dup_x(input.x_axis), vector_dup_y(input.x_axis), vector_dup_z(input.x_axis), vector_dup_w(input.x_axis) },
+				{ vector_dup_x(input.y_axis), vector_dup_y(input.y_axis), vector_dup_z(input.y_axis), vector_dup_w(input.y_axis) },
+				{ vector_dup_x(input.z_axis), vector_dup_y(input.z_axis), vector_dup_z(input.z_axis), vector_dup_w(input.z_axis) },
+				{ vector_dup_x(input.w_axis), vector_dup_y(input.w_axis), vector_dup_z(input.w_axis), vector_dup_w(input.w_axis) },
+			};
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 4 3D points stored as structure of arrays with the matrix, [w] is implicitly 1.0.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_project_points_soa4(const matrix4x4f_broadcast4& mtx, vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			out_x = vector_mul_add(z, mtx.z_axis[0], vector_mul_add(y, mtx.y_axis[0], vector_mul_add(x, mtx.x_axis[0], mtx.w_axis[0])));
+			out_y = vector_mul_add(z, mtx.z_axis[1], vector_mul_add(y, mtx.y_axis[1], vector_mul_add(x, mtx.x_axis[1], mtx.w_axis[1])));
+			out_z = vector_mul_add(z, mtx.z_axis[2], vector_mul_add(y, mtx.y_axis[2], vector_mul_add(x, mtx.x_axis[2], mtx.w_axis[2])));
+			out_w = vector_mul_add(z, mtx.z_axis[3], vector_mul_add(y, mtx.y_axis[3], vector_mul_add(x, mtx.x_axis[3], mtx.w_axis[3])));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane whether a clip space point lies between the near and far planes.
+		//////////////////////////////////////////////////////////////////////////
+		inline mask4f RTM_SIMD_CALL matrix_clip_depth_soa4(vector4f_arg0 clip_z, vector4f_arg1 clip_w, clip_depth_range depth_range) RTM_NO_EXCEPT
+		{
+			const vector4f near_limit = depth_range == clip_depth_range::zero_to_one ? vector_zero() : vector_neg(clip_w);
+			return mask_and(vector_greater_equal(clip_z, near_limit), vector_less_equal(clip_z, clip_w));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads up to 4 packed 3D points as structure of arrays.
+		// The last point is repeated in the unused lanes.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_load_points_partial(const float3f* input, uint32_t num_points, vector4f& out_x, vector4f& out_y, vector4f& out_z) RTM_NO_EXCEPT
+		{
+			float3f points[4];
+			for (uint32_t point_index = 0; point_index < 4; ++point_index)
+				points[point_index] = input[point_index < num_points ? point_index : (num_points - 1)];
+
+			vector_deinterleave3(&points[0], out_x, out_y, out_z);
+		}
+
+		inline void matrix_clear_bits(uint32_t* output_bits, uint32_t num_bits) RTM_NO_EXCEPT
+		{
+			const uint32_t num_words = (num_bits + 31) / 32;
+			for (uint32_t word_index = 0; word_index < num_words; ++word_index)
+				output_bits[word_index] = 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 'num_matrices' 4x4 matrices, 4 at a time as structure of arrays.
+		// With a fallback, lanes whose determinant is below the threshold are replaced by it.
+		//////////////////////////////////////////////////////////////////////////
+		template<bool with_fallback>
+		inline void matrix_inverse_aos_impl(const matrix4x4f* input, matrix4x4f* output, uint32_t num_matrices, const matrix4x4f& fallback, float threshold) RTM_NO_EXCEPT
+		{
+			const vector4f threshold4 = vector_set(threshold);
+
+			uint32_t matrix_index = 0;
+			for (; matrix_index + 4 <= num_matrices; matrix_index += 4)
+			{
+				const matrix4x4f* input_mtx = input + matrix_index;
+
+				// Transpose the axes of 4 matrices: mRC holds the component C of the axis R
+				vector4f m00 = input_mtx[0].x_axis;
+				vector4f m01 = input_mtx[1].x_axis;
+				vector4f m02 = input_mtx[2].x_axis;
+				vector4f m03 = input_mtx[3].x_axis;
+				vector_transpose4x4(m00, m01, m02, m03);
+
+				vector4f m10 = input_mtx[0].y_axis;
+				vector4f m11 = input_mtx[1].y_axis;
+				vector4f m12 = input_mtx[2].y_axis;
+				vector4f m13 = input_mtx[3].y_axis;
+				vector_transpose4x4(m10, m11, m12, m13);
+
+				vector4f m20 = input_mtx[0].z_axis;
+				vector4f m21 = input_mtx[1].z_axis;
+				vector4f m22 = input_mtx[2].z_axis;
+				vector4f m23 = input_mtx[3].z_axis;
+				vector_transpose4x4(m20, m21, m22, m23);
+
+				vector4f m30 = input_mtx[0].w_axis;
+				vector4f m31 = input_mtx[1].w_axis;
+				vector4f m32 = input_mtx[2].w_axis;
+				vector4f m33 = input_mtx[3].w_axis;
+				vector_transpose4x4(m30, m31, m32, m33);
+
+				// 2x2 sub-determinants of the first two and the last two axes
+				const vector4f s0 = vector_neg_mul_sub(m10, m01, vector_mul(m00, m11));
+				const vector4f s1 = vector_neg_mul_sub(m10, m02, vector_mul(m00, m12));
+				const vector4f s2 = vector_neg_mul_sub(m10, m03, vector_mul(m00, m13));
+				const vector4f s3 = vector_neg_mul_sub(m11, m02, vector_mul(m01, m12));
+				const vector4f s4 = vector_neg_mul_sub(m11, m03, vector_mul(m01, m13));
+				const vector4f s5 = vector_neg_mul_sub(m12, m03, vector_mul(m02, m13));
+
+				const vector4f c0 = vector_neg_mul_sub(m30, m21, vector_mul(m20, m31));
+				const vector4f c1 = vector_neg_mul_sub(m30, m22, vector_mul(m20, m32));
+				const vector4f c2 = vector_neg_mul_sub(m30, m23, vector_mul(m20, m33));
+				const vector4f c3 = vector_neg_mul_sub(m31, m22, vector_mul(m21, m32));
+				const vector4f c4 = vector_neg_mul_sub(m31, m23, vector_mul(m21, m33));
+				const vector4f c5 = vector_neg_mul_sub(m32, m23, vector_mul(m22, m33));
+
+				const vector4f det = vector_mul_add(s5, c0, vector_neg_mul_sub(s4, c1, vector_mul_add(s3, c2, vector_mul_add(s2, c3, vector_neg_mul_sub(s1, c4, vector_mul(s0, c5))))));
+				const vector4f inv_det = vector_reciprocal(det);
+
+				vector4f x_axis_x = vector_mul(vector_mul_add(m13, c3, vector_neg_mul_sub(m12, c4, vector_mul(m11, c5))), inv_det);
+				vector4f x_axis_y = vector_mul(vector_neg_mul_sub(m03, c3, vector_mul_add(m02, c4, vector_neg(vector_mul(m01, c5)))), inv_det);
+				vector4f x_axis_z = vector_mul(vector_mul_add(m33, s3, vector_neg_mul_sub(m32, s4, vector_mul(m31, s5))), inv_det);
+				vector4f x_axis_w = vector_mul(vector_neg_mul_sub(m23, s3, vector_mul_add(m22, s4, vector_neg(vector_mul(m21, s5)))), inv_det);
+
+				vector4f y_axis_x = vector_mul(vector_neg_mul_sub(m13, c1, vector_mul_add(m12, c2, vector_neg(vector_mul(m10, c5)))), inv_det);
+				vector4f y_axis_y = vector_mul(vector_mul_add(m03, c1, vector_neg_mul_sub(m02, c2, vector_mul(m00, c5))), inv_det);
+				vector4f y_axis_z = vector_mul(vector_neg_mul_sub(m33, s1, vector_mul_add(m32, s2, vector_neg(vector_mul(m30, s5)))), inv_det);
+				vector4f y_axis_w = vector_mul(vector_mul_add(m23, s1, vector_neg_mul_sub(m22, s2, vector_mul(m20, s5))), inv_det);
+
+				vector4f z_axis_x = vector_mul(vector_mul_add(m13, c0, vector_neg_mul_sub(m11, c2, vector_mul(m10, c4))), inv_det);
+				vector4f z_axis_y = vector_mul(vector_neg_mul_sub(m03, c0, vector_mul_add(m01, c2, vector_neg(vector_mul(m00, c4)))), inv_det);
+				vector4f z_axis_z = vector_mul(vector_mul_add(m33, s0, vector_neg_mul_sub(m31, s2, vector_mul(m30, s4))), inv_det);
+				vector4f z_axis_w = vector_mul(vector_neg_mul_sub(m23, s0, vector_mul_add(m21, s2, vector_neg(vector_mul(m20, s4)))), inv_det);
+
+				vector4f w_axis_x = vector_mul(vector_neg_mul_sub(m12, c0, vector_mul_add(m11, c1, vector_neg(vector_mul(m10, c3)))), inv_det);
+				vector4f w_axis_y = vector_mul(vector_mul_add(m02, c0, vector_neg_mul_sub(m01, c1, vector_mul(m00, c3))), inv_det);
+				vector4f w_axis_z = vector_mul(vector_neg_mul_sub(m32, s0, vector_mul_add(m31, s1, vector_neg(vector_mul(m30, s3)))), inv_det);
+				vector4f w_axis_w = vector_mul(vector_mul_add(m22, s0, vector_neg_mul_sub(m21, s1, vector_mul(m20, s3))), inv_det);
+
+				// Transpose back
+				vector_transpose4x4(x_axis_x, x_axis_y, x_axis_z, x_axis_w);
+				vector_transpose4x4(y_axis_x, y_axis_y, y_axis_z, y_axis_w);
+				vector_transpose4x4(z_axis_x, z_axis_y, z_axis_z, z_axis_w);
+				vector_transpose4x4(w_axis_x, w_axis_y, w_axis_z, w_axis_w);
+
+				matrix4x4f result[4] =
+				{
+					matrix_set(x_axis_x, y_axis_x, z_axis_x, w_axis_x),
+					matrix_set(x_axis_y, y_axis_y, z_axis_y, w_axis_y),
+					matrix_set(x_axis_z, y_axis_z, z_axis_z, w_axis_z),
+					matrix_set(x_axis_w, y_axis_w, z_axis_w, w_axis_w),
+				};
+
+				if (static_condition<with_fallback>::test())
+				{
+					// Most groups are invertible, only the singular lanes are replaced
+					const mask4f is_singular = vector_less_than(vector_abs(det), threshold4);
+					if (mask_any_true(is_singular))
+					{
+						if (mask_get_x(is_singular) != 0)
+							result[0] = fallback;
+						if (mask_get_y(is_singular) != 0)
+							result[1] = fallback;
+						if (mask_get_z(is_singular) != 0)
+							result[2] = fallback;
+						if (mask_get_w(is_singular) != 0)
+							result[3] = fallback;
+					}
+				}
+
+				output[matrix_index + 0] = result[0];
+				output[matrix_index + 1] = result[1];
+				output[matrix_index + 2] = result[2];
+				output[matrix_index + 3] = result[3];
+			}
+
+			for (; matrix_index < num_matrices; ++matrix_index)
+				output[matrix_index] = with_fallback ? matrix_inverse(input[matrix_index], fallback, threshold) : matrix_inverse(input[matrix_index]);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Projects 'num_points' packed 3D points in clip space: output[i] = matrix_mul_vector(point[i] with w = 1.0, world_to_clip).
+	// Points are deinterleaved and projected 4 at a time with the matrix broadcast once.
+	// The inputs and outputs do not need to be aligned, they must not overlap.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_project_points_aos(const float3f* points, matrix4x4f_arg0 world_to_clip, float4f* output, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_project_points_aos", num_points, num_points * (sizeof(float3f) + sizeof(float4f)));
+		const rtm_impl::matrix4x4f_broadcast4 mtx = rtm_impl::matrix_broadcast4(world_to_clip);
+
+		for (uint32_t point_index = 0; point_index < num_points; point_index += 4)
+		{
+			const uint32_t num_values = num_points - point_index;
+
+			vector4f x, y, z;
+			if (num_values >= 4)
+				vector_deinterleave3(points + point_index, x, y, z);
+			else
+				rtm_impl::matrix_load_points_partial(points + point_index, num_values, x, y, z);
+
+			vector4f clip_x, clip_y, clip_z, clip_w;
+			rtm_impl::matrix_project_points_soa4(mtx, x, y, z, clip_x, clip_y, clip_z, clip_w);
+
+			// Once transposed, every vector holds one point
+			vector_transpose4x4(clip_x, clip_y, clip_z, clip_w);
+
+			float4f* point_output = output + point_index;
+			vector_store(clip_x, point_output);
+			if (num_values >= 2)
+				vector_store(clip_y, point_output + 1);
+			if (num_values >= 3)
+				vector_store(clip_z, point_output + 2);
+			if (num_values >= 4)
+				vector_store(clip_w, point_output + 3);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Projects 'num_points' packed 3D points in normalized device coordinates.
+	// Each point is transformed in clip space and divided by its [w] component.
+	// When 'output_visible_bits' is not null, point 'i' maps to bit 'i % 32' of output_visible_bits[i / 32],
+	// set when the point lies between the near and far planes. It must then hold (num_points + 31) / 32 entries.
+	// Points behind the camera are divided as well, use the visible bits to reject them.
+	// Points are deinterleaved and projected 4 at a time with the matrix broadcast once.
+	// The inputs and outputs do not need to be aligned, they must not overlap.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_project_points_aos(const float3f* points, matrix4x4f_arg0 world_to_clip, float3f* output, uint32_t* output_visible_bits, uint32_t num_points, clip_depth_range depth_range = clip_depth_range::zero_to_one) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_project_points_aos", num_points, num_points * sizeof(float3f) * 2);
+		if (output_visible_bits != nullptr)
+			rtm_impl::matrix_clear_bits(output_visible_bits, num_points);
+
+		const rtm_impl::matrix4x4f_broadcast4 mtx = rtm_impl::matrix_broadcast4(world_to_clip);
+		const vector4f one = vector_set(1.0F);
+
+		for (uint32_t point_index = 0; point_index < num_points; point_index += 4)
+		{
+			const uint32_t num_values = num_points - point_index;
+
+			vector4f x, y, z;
+			if (num_values >= 4)
+				vector_deinterleave3(points + point_index, x, y, z);
+			else
+				rtm_impl::matrix_load_points_partial(points + point_index, num_values, x, y, z);
+
+			vector4f clip_x, clip_y, clip_z, clip_w;
+			rtm_impl::matrix_project_points_soa4(mtx, x, y, z, clip_x, clip_y, clip_z, clip_w);
+
+			const vector4f inv_w = vector_div(one, clip_w);
+			const vector4f ndc_x = vector_mul(clip_x, inv_w);
+			const vector4f ndc_y = vector_mul(clip_y, inv_w);
+			const vector4f ndc_z = vector_mul(clip_z, inv_w);
+
+			if (num_values >= 4)
+				vector_interleave3(ndc_x, ndc_y, ndc_z, output + point_index);
+			else
+			{
+				float3f ndc_points[4];
+				vector_interleave3(ndc_x, ndc_y, ndc_z, &ndc_points[0]);
+				for (uint32_t value_index = 0; value_index < 3 && value_index < num_values; ++value_index)
+					output[point_index + value_index] = ndc_points[value_index];
+			}
+
+			if (output_visible_bits != nullptr)
+			{
+				// Groups of 4 never straddle two output entries
+				const uint32_t used_bits = num_values >= 4 ? 0xFU : ((1U << num_values) - 1);
+				const uint32_t visible_bits = mask_get_bits(rtm_impl::matrix_clip_depth_soa4(clip_z, clip_w, depth_range)) & used_bits;
+				output_visible_bits[point_index / 32] |= visible_bits << (point_index % 32);
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Projects 'num_points' 3D points stored as structure of arrays in clip space.
+	// Points are projected 4 at a time with the matrix broadcast once.
+	// The output can safely alias the input streams.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_project_points_soa(const const_float3f_soa& points, matrix4x4f_arg0 world_to_clip, const float4f_soa& output, uint32_t num_points) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_project_points_soa", num_points, num_points * sizeof(float) * 7);
+		const rtm_impl::matrix4x4f_broadcast4 mtx = rtm_impl::matrix_broadcast4(world_to_clip);
+
+		uint32_t point_index = 0;
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			vector4f clip_x, clip_y, clip_z, clip_w;
+			rtm_impl::matrix_project_points_soa4(mtx, vector_load(points.x + point_index), vector_load(points.y + point_index), vector_load(points.z + point_index), clip_x, clip_y, clip_z, clip_w);
+
+			vector_store(clip_x, output.x + point_index);
+			vector_store(clip_y, output.y + point_index);
+			vector_store(clip_z, output.z + point_index);
+			vector_store(clip_w, output.w + point_index);
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			vector4f clip_x, clip_y, clip_z, clip_w;
+			rtm_impl::matrix_project_points_soa4(mtx, vector_set(points.x[point_index]), vector_set(points.y[point_index]), vector_set(points.z[point_index]), clip_x, clip_y, clip_z, clip_w);
+
+			output.x[point_index] = vector_get_x(clip_x);
+			output.y[point_index] = vector_get_x(clip_y);
+			output.z[point_index] = vector_get_x(clip_z);
+			output.w[point_index] = vector_get_x(clip_w);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Projects 'num_points' 3D points stored as structure of arrays in normalized device coordinates.
+	// Each point is transformed in clip space and divided by its [w] component.
+	// The visible bits follow the same layout as the packed variant, they are optional.
+	// Points are projected 4 at a time with the matrix broadcast once.
+	// The output can safely alias the input streams.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_project_points_soa(const const_float3f_soa& points, matrix4x4f_arg0 world_to_clip, const float3f_soa& output, uint32_t* output_visible_bits, uint32_t num_points, clip_depth_range depth_range = clip_depth_range::zero_to_one) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_project_points_soa", num_points, num_points * sizeof(float) * 6);
+		if (output_visible_bits != nullptr)
+			rtm_impl::matrix_clear_bits(output_visible_bits, num_points);
+
+		const rtm_impl::matrix4x4f_broadcast4 mtx = rtm_impl::matrix_broadcast4(world_to_clip);
+		const vector4f one = vector_set(1.0F);
+
+		uint32_t point_index = 0;
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			vector4f clip_x, clip_y, clip_z, clip_w;
+			rtm_impl::matrix_project_points_soa4(mtx, vector_load(points.x + point_index), vector_load(points.y + point_index), vector_load(points.z + point_index), clip_x, clip_y, clip_z, clip_w);
+
+			const vector4f inv_w = vector_div(one, clip_w);
+			vector_store(vector_mul(clip_x, inv_w), output.x + point_index);
+			vector_store(vector_mul(clip_y, inv_w), output.y + point_index);
+			vector_store(vector_mul(clip_z, inv_w), output.z + point_index);
+
+			if (output_visible_bits != nullptr)
+				output_visible_bits[point_index / 32] |= mask_get_bits(rtm_impl::matrix_clip_depth_soa4(clip_z, clip_w, depth_range)) << (point_index % 32);
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			vector4f clip_x, clip_y, clip_z, clip_w;
+			rtm_impl::matrix_project_points_soa4(mtx, vector_set(points.x[point_index]), vector_set(points.y[point_index]), vector_set(points.z[point_index]), clip_x, clip_y, clip_z, clip_w);
+
+			const vector4f inv_w = vector_div(one, clip_w);
+			output.x[point_index] = vector_get_x(vector_mul(clip_x, inv_w));
+			output.y[point_index] = vector_get_x(vector_mul(clip_y, inv_w));
+			output.z[point_index] = vector_get_x(vector_mul(clip_z, inv_w));
+
+			if (output_visible_bits != nullptr)
+				output_visible_bits[point_index / 32] |= (mask_get_bits(rtm_impl::matrix_clip_depth_soa4(clip_z, clip_w, depth_range)) & 1) << (point_index % 32);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'num_matrices' 4x4 matrices: output[i] = matrix_inverse(input[i]).
+	// 4 matrices are processed at a time as structure of arrays. If a matrix is not invertible,
+	// its result is undefined. The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_aos(const matrix4x4f* input, matrix4x4f* output, uint32_t num_matrices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_inverse_aos", num_matrices, num_matrices * sizeof(matrix4x4f) * 2);
+		rtm_impl::matrix_inverse_aos_impl<false>(input, output, num_matrices, matrix_identity(), 0.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses 'num_matrices' 4x4 matrices: output[i] = matrix_inverse(input[i], fallback, threshold).
+	// The determinant is checked per lane: matrices whose determinant has an absolute value
+	// below the threshold are replaced by the fallback value. The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_inverse_aos(const matrix4x4f* input, matrix4x4f* output, uint32_t num_matrices, const matrix4x4f& fallback, float threshold = 1.0E-8F) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_inverse_aos", num_matrices, num_matrices * sizeof(matrix4x4f) * 2);
+		rtm_impl::matrix_inverse_aos_impl<true>(input, output, num_matrices, fallback, threshold);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,336 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/mask4f.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// Recomputes the vertex normals and tangents of a deformed triangle mesh.
+//
+// Triangles are described by 3 vertex indices each. The work is split in two passes:
+//    - The face pass computes one area weighted normal (and tangent) per triangle.
+//    - The vertex pass sums the vectors of the triangles that use each vertex and normalizes them.
+//
+// Rather than scattering each face into its 3 vertices, the vertex pass gathers its faces
+// from a vertex to faces adjacency built once with mesh_build_vertex_faces(..) since the
+// topology does not change when the mesh deforms. Every vertex is thus written by a single
+// iteration: both passes can be split in chunks processed by any number of threads
+// without conflicts, see rtm/batch/parallel.h, and the faces are always summed in the same order.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The faces that use each vertex, in compressed sparse row form.
+	// The faces of vertex 'i' are face_indices[offsets[i]] to face_indices[offsets[i + 1] - 1],
+	// 'offsets' thus holds one more entry than there are vertices.
+	// Offsetting the 'offsets' pointer yields the adjacency of a range of vertices.
+	//////////////////////////////////////////////////////////////////////////
+	struct mesh_vertex_faces
+	{
+		const uint32_t* offsets;
+		const uint32_t* face_indices;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Builds the vertex to faces adjacency of a triangle mesh with 3 indices per face.
+	// 'out_offsets' must hold 'num_vertices' + 1 entries and 'out_face_indices' must
+	// hold 3 entries per face. The faces of a vertex are sorted in increasing order.
+	//////////////////////////////////////////////////////////////////////////
+	inline void mesh_build_vertex_faces(const uint32_t* indices, uint32_t num_faces, uint32_t num_vertices, uint32_t* out_offsets, uint32_t* out_face_indices) RTM_NO_EXCEPT
+	{
+		for (uint32_t vertex_index = 0; vertex_index <= num_vertices; ++vertex_index)
+			out_offsets[vertex_index] = 0;
+
+		// Count the faces of each vertex, shifted by one entry
+		const uint32_t num_indices = num_faces * 3;
+		for (uint32_t index = 0; index < num_indices; ++index)
+		{
+			RTM_ASSERT(indices[index] < num_vertices, "Vertex index out of bounds");
+			out_offsets[indices[index] + 1]++;
+		}
+
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+			out_offsets[vertex_index + 1] += out_offsets[vertex_index];
+
+		// Fill every vertex range in face order, the offsets are used as insertion points
+		// and end up shifted by one entry which the last loop undoes
+		for (uint32_t index = 0; index < num_indices; ++index)
+			out_face_indices[out_offsets[indices[index]]++] = index / 3;
+
+		for (uint32_t vertex_index = num_vertices; vertex_index > 0; --vertex_index)
+			out_offsets[vertex_index] = out_offsets[vertex_index - 1];
+
+		out_offsets[0] = 0;
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Sums the face vectors of up to 4 vertices and returns them as structure of arrays, unused lanes are zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline void mesh_sum_vertex_faces4(const float4f* face_vectors, const mesh_vertex_faces& vertex_faces, uint32_t vertex_index, uint32_t num_values,
+			vector4f& out_x, vector4f& out_y, vector4f& out_z) RTM_NO_EXCEPT
+		{
+			vector4f sums[4] = { vector_zero(), vector_zero(), vector_zero(), vector_zero() };
+
+			const uint32_t num_lanes = num_values < 4 ? num_values : 4;
+			for (uint32_t lane_index = 0; lane_index < num_lanes; ++lane_index)
+			{
+				const uint32_t faces_end = vertex_faces.offsets[vertex_index + lane_index + 1];
+				vector4f sum = vector_zero();
+				for (uint32_t offset = vertex_faces.offsets[vertex_index + lane_index]; offset < faces_end; ++offset)
+					sum = vector_add(sum, vector_load(face_vectors + vertex_faces.face_indices[offset]));
+
+				sums[lane_index] = sum;
+			}
+
+			vector_transpose4x4(sums[0], sums[1], sums[2], sums[3]);
+			out_x = sums[0];
+			out_y = sums[1];
+			out_z = sums[2];
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the inverse length of 4 vectors, 0.0 for zero length vectors which thus stay zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL mesh_inverse_length(vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z) RTM_NO_EXCEPT
+		{
+			const vector4f length_sq = vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x)));
+			const vector4f inv_length = vector_div(vector_set(1.0F), vector_sqrt(length_sq));
+			return vector_select(vector_greater_than(length_sq, vector_zero()), inv_length, vector_zero());
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads up to 4 values, unused lanes are zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f mesh_load_partial(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			if (num_values >= 4)
+				return vector_load(input);
+
+			return vector_set(input[0], num_values >= 2 ? input[1] : 0.0F, num_values >= 3 ? input[2] : 0.0F, 0.0F);
+		}
+
+		inline void RTM_SIMD_CALL mesh_store_partial(vector4f_arg0 input, float* output, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			if (num_values >= 4)
+			{
+				vector_store(input, output);
+				return;
+			}
+
+			output[0] = vector_get_x(input);
+			if (num_values >= 2)
+				output[1] = vector_get_y(input);
+			if (num_values >= 3)
+				output[2] = vector_get_z(input);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the normal of 'num_faces' triangles with 3 vertex indices each: cross(p1 - p0, p2 - p0).
+	// The normals are not normalized, their length is twice the triangle area which weights
+	// them when they are summed per vertex. Triangles are wound counter clockwise.
+	// The face normals are stored as one float4f per face, the [w] component is 0.0, for the
+	// vertex pass to fetch each with a single load.
+	// The positions are fetched through the indices one component at a time: packing them into
+	// SIMD lanes costs more than the cross product saves, each face is computed with scalar math.
+	//////////////////////////////////////////////////////////////////////////
+	inline void mesh_face_normals_soa(const const_float3f_soa& positions, const uint32_t* indices, float4f* output_face_normals, uint32_t num_faces) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::mesh_face_normals_soa", num_faces, num_faces * (sizeof(uint32_t) * 3 + sizeof(float) * 9 + sizeof(float4f)));
+
+		for (uint32_t face_index = 0; face_index < num_faces; ++face_index)
+		{
+			const uint32_t* face_indices = indices + face_index * 3;
+			const uint32_t index0 = face_indices[0];
+			const uint32_t index1 = face_indices[1];
+			const uint32_t index2 = face_indices[2];
+
+			const float edge1_x = positions.x[index1] - positions.x[index0];
+			const float edge1_y = positions.y[index1] - positions.y[index0];
+			const float edge1_z = positions.z[index1] - positions.z[index0];
+			const float edge2_x = positions.x[index2] - positions.x[index0];
+			const float edge2_y = positions.y[index2] - positions.y[index0];
+			const float edge2_z = positions.z[index2] - positions.z[index0];
+
+			float4f& output = output_face_normals[face_index];
+			output.x = edge1_y * edge2_z - edge1_z * edge2_y;
+			output.y = edge1_z * edge2_x - edge1_x * edge2_z;
+			output.z = edge1_x * edge2_y - edge1_y * edge2_x;
+			output.w = 0.0F;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the tangent and bitangent of 'num_faces' triangles with 3 vertex indices each:
+	// the directions of increasing [u] and [v] texture coordinates on each triangle.
+	// They are weighted by the texture area of the triangle and flipped when the texture is
+	// mirrored for the sum per vertex to be dominated by the larger triangles. Triangles without
+	// texture area have a zero tangent and bitangent. Like mesh_face_normals_soa(..), the output
+	// holds one float4f per face.
+	//////////////////////////////////////////////////////////////////////////
+	inline void mesh_face_tangents_soa(const const_float3f_soa& positions, const float* texcoords_u, const float* texcoords_v, const uint32_t* indices,
+		float4f* output_face_tangents, float4f* output_face_bitangents, uint32_t num_faces) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::mesh_face_tangents_soa", num_faces, num_faces * (sizeof(uint32_t) * 3 + sizeof(float) * 15 + sizeof(float4f) * 2));
+
+		for (uint32_t face_index = 0; face_index < num_faces; ++face_index)
+		{
+			const uint32_t* face_indices = indices + face_index * 3;
+			const uint32_t index0 = face_indices[0];
+			const uint32_t index1 = face_indices[1];
+			const uint32_t index2 = face_indices[2];
+
+			const float edge1_x = positions.x[index1] - positions.x[index0];
+			const float edge1_y = positions.y[index1] - positions.y[index0];
+			const float edge1_z = positions.z[index1] - positions.z[index0];
+			const float edge2_x = positions.x[index2] - positions.x[index0];
+			const float edge2_y = positions.y[index2] - positions.y[index0];
+			const float edge2_z = positions.z[index2] - positions.z[index0];
+
+			const float delta_u1 = texcoords_u[index1] - texcoords_u[index0];
+			const float delta_v1 = texcoords_v[index1] - texcoords_v[index0];
+			const float delta_u2 = texcoords_u[index2] - texcoords_u[index0];
+			const float delta_v2 = texcoords_v[index2] - texcoords_v[index0];
+
+			// The exact tangent divides by the signed texture area, only its sign is kept
+			const float sign = (delta_u1 * delta_v2 - delta_u2 * delta_v1) < 0.0F ? -1.0F : 1.0F;
+			const float tangent_u1 = delta_v2 * sign;
+			const float tangent_u2 = delta_v1 * sign;
+			const float bitangent_v1 = delta_u2 * sign;
+			const float bitangent_v2 = delta_u1 * sign;
+
+			float4f& tangent = output_face_tangents[face_index];
+			tangent.x = edge1_x * tangent_u1 - edge2_x * tangent_u2;
+			tangent.y = edge1_y * tangent_u1 - edge2_y * tangent_u2;
+			tangent.z = edge1_z * tangent_u1 - edge2_z * tangent_u2;
+			tangent.w = 0.0F;
+
+			float4f& bitangent = output_face_bitangents[face_index];
+			bitangent.x = edge2_x * bitangent_v2 - edge1_x * bitangent_v1;
+			bitangent.y = edge2_y * bitangent_v2 - edge1_y * bitangent_v1;
+			bitangent.z = edge2_z * bitangent_v2 - edge1_z * bitangent_v1;
+			bitangent.w = 0.0F;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the normal of 'num_vertices' vertices: the normalized sum of the normals of their faces,
+	// see mesh_face_normals_soa(..). Vertices without faces, or whose face normals cancel out,
+	// have a zero normal. 'vertex_faces' starts at the first vertex processed.
+	//////////////////////////////////////////////////////////////////////////
+	inline void mesh_vertex_normals_soa(const float4f* face_normals, const mesh_vertex_faces& vertex_faces, const float3f_soa& output_normals, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::mesh_vertex_normals_soa", num_vertices, num_vertices * (sizeof(uint32_t) * 7 + sizeof(float4f) * 6 + sizeof(float) * 3));
+
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; vertex_index += 4)
+		{
+			const uint32_t num_values = num_vertices - vertex_index;
+
+			vector4f normal_x, normal_y, normal_z;
+			rtm_impl::mesh_sum_vertex_faces4(face_normals, vertex_faces, vertex_index, num_values, normal_x, normal_y, normal_z);
+
+			const vector4f inv_length = rtm_impl::mesh_inverse_length(normal_x, normal_y, normal_z);
+			rtm_impl::mesh_store_partial(vector_mul(normal_x, inv_length), output_normals.x + vertex_index, num_values);
+			rtm_impl::mesh_store_partial(vector_mul(normal_y, inv_length), output_normals.y + vertex_index, num_values);
+			rtm_impl::mesh_store_partial(vector_mul(normal_z, inv_length), output_normals.z + vertex_index, num_values);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the tangent of 'num_vertices' vertices from the tangents and bitangents of their faces,
+	// see mesh_face_tangents_soa(..), and from their normalized vertex normals.
+	// The summed tangent is made orthogonal to the normal and normalized. Its [w] component holds
+	// the bitangent sign like the packing functions of rtm/packing/tangent_frame.h expect:
+	// -1.0 when the summed bitangent points opposite to cross(normal, tangent), 1.0 otherwise.
+	// A tangent that vanishes, e.g. without texture coordinates, is replaced by an arbitrary
+	// direction orthogonal to the normal. 'normals' and 'vertex_faces' start at the first vertex processed.
+	//////////////////////////////////////////////////////////////////////////
+	inline void mesh_vertex_tangents_soa(const const_float3f_soa& normals, const float4f* face_tangents, const float4f* face_bitangents, const mesh_vertex_faces& vertex_faces,
+		const float4f_soa& output_tangents, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::mesh_vertex_tangents_soa", num_vertices, num_vertices * (sizeof(uint32_t) * 7 + sizeof(float4f) * 12 + sizeof(float) * 7));
+
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; vertex_index += 4)
+		{
+			const uint32_t num_values = num_vertices - vertex_index;
+
+			vector4f tangent_x, tangent_y, tangent_z;
+			vector4f bitangent_x, bitangent_y, bitangent_z;
+			rtm_impl::mesh_sum_vertex_faces4(face_tangents, vertex_faces, vertex_index, num_values, tangent_x, tangent_y, tangent_z);
+			rtm_impl::mesh_sum_vertex_faces4(face_bitangents, vertex_faces, vertex_index, num_values, bitangent_x, bitangent_y, bitangent_z);
+
+			const vector4f normal_x = rtm_impl::mesh_load_partial(normals.x + vertex_index, num_values);
+			const vector4f normal_y = rtm_impl::mesh_load_partial(normals.y + vertex_index, num_values);
+			const vector4f normal_z = rtm_impl::mesh_load_partial(normals.z + vertex_index, num_values);
+
+			// Gram-Schmidt: remove the part of the tangent along the normal
+			const vector4f normal_dot_tangent = vector_mul_add(normal_z, tangent_z, vector_mul_add(normal_y, tangent_y, vector_mul(normal_x, tangent_x)));
+			tangent_x = vector_neg_mul_sub(normal_x, normal_dot_tangent, tangent_x);
+			tangent_y = vector_neg_mul_sub(normal_y, normal_dot_tangent, tangent_y);
+			tangent_z = vector_neg_mul_sub(normal_z, normal_dot_tangent, tangent_z);
+
+			// A vanishing tangent is replaced by the normal rotated a quarter turn around its largest axis
+			const vector4f zero = vector_zero();
+			const vector4f tangent_length_sq = vector_mul_add(tangent_z, tangent_z, vector_mul_add(tangent_y, tangent_y, vector_mul(tangent_x, tangent_x)));
+			const mask4f is_degenerate = vector_less_equal(tangent_length_sq, vector_mul(vector_set(1.0E-12F), vector_mul_add(bitangent_z, bitangent_z, vector_mul_add(bitangent_y, bitangent_y, vector_mul(bitangent_x, bitangent_x)))));
+			const mask4f is_x_larger = vector_greater_than(vector_abs(normal_x), vector_abs(normal_z));
+			tangent_x = vector_select(is_degenerate, vector_select(is_x_larger, vector_neg(normal_y), zero), tangent_x);
+			tangent_y = vector_select(is_degenerate, vector_select(is_x_larger, normal_x, vector_neg(normal_z)), tangent_y);
+			tangent_z = vector_select(is_degenerate, vector_select(is_x_larger, zero, normal_y), tangent_z);
+
+			const vector4f inv_length = rtm_impl::mesh_inverse_length(tangent_x, tangent_y, tangent_z);
+			tangent_x = vector_mul(tangent_x, inv_length);
+			tangent_y = vector_mul(tangent_y, inv_length);
+			tangent_z = vector_mul(tangent_z, inv_length);
+
+			// dot(cross(normal, tangent), bitangent)
+			const vector4f cross_x = vector_neg_mul_sub(normal_z, tangent_y, vector_mul(normal_y, tangent_z));
+			const vector4f cross_y = vector_neg_mul_sub(normal_x, tangent_z, vector_mul(normal_z, tangent_x));
+			const vector4f cross_z = vector_neg_mul_sub(normal_y, tangent_x, vector_mul(normal_x, tangent_y));
+			const vector4f handedness = vector_mul_add(cross_z, bitangent_z, vector_mul_add(cross_y, bitangent_y, vector_mul(cross_x, bitangent_x)));
+			const vector4f one = vector_set(1.0F);
+			const vector4f sign = vector_select(vector_less_than(handedness, zero), vector_neg(one), one);
+
+			rtm_impl::mesh_store_partial(tangent_x, output_tangents.x + vertex_index, num_values);
+			rtm_impl::mesh_store_partial(tangent_y, output_tangents.y + vertex_index, num_values);
+			rtm_impl::mesh_store_partial(tangent_z, output_tangents.z + vertex_index, num_values);
+			rtm_impl::mesh_store_partial(sign, output_tangents.w + vertex_index, num_values);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,224 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/noise.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+#if defined(RTM_AVX2_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// With AVX2, the lattice is hashed 8 positions at a time.
+		// AVX alone lacks the 256 bit integer operations.
+		//////////////////////////////////////////////////////////////////////////
+		template<>
+		struct noise_lanes<8>
+		{
+			using float_type = vector8f;
+			using int_type = __m256i;
+
+			static vector8f RTM_SIMD_CALL broadcast(float value) RTM_NO_EXCEPT { return vector8_set(value); }
+			static __m256i RTM_SIMD_CALL broadcast_int(int32_t value) RTM_NO_EXCEPT { return _mm256_set1_epi32(value); }
+			static vector8f RTM_SIMD_CALL load(const float* input) RTM_NO_EXCEPT { return vector8_load(input); }
+			static void RTM_SIMD_CALL store(vector8f_arg0 input, float* output) RTM_NO_EXCEPT { vector_store(input, output); }
+
+			// Returns floor(input) as integers, out_fraction receives input - floor(input)
+			static __m256i RTM_SIMD_CALL floor_to_int(vector8f_arg0 input, vector8f& out_fraction) RTM_NO_EXCEPT
+			{
+				const __m256 floored = _mm256_floor_ps(input);
+				out_fraction = _mm256_sub_ps(input, floored);
+				return _mm256_cvttps_epi32(floored);
+			}
+
+			static __m256i RTM_SIMD_CALL add(__m256i lhs, __m256i rhs) RTM_NO_EXCEPT { return _mm256_add_epi32(lhs, rhs); }
+			static __m256i RTM_SIMD_CALL mul(__m256i lhs, __m256i rhs) RTM_NO_EXCEPT { return _mm256_mullo_epi32(lhs, rhs); }
+			static __m256i RTM_SIMD_CALL bit_xor(__m256i lhs, __m256i rhs) RTM_NO_EXCEPT { return _mm256_xor_si256(lhs, rhs); }
+			static __m256i RTM_SIMD_CALL bit_and(__m256i lhs, __m256i rhs) RTM_NO_EXCEPT { return _mm256_and_si256(lhs, rhs); }
+			static __m256i RTM_SIMD_CALL shift_right_logical(__m256i input, uint32_t count) RTM_NO_EXCEPT { return _mm256_srl_epi32(input, _mm_cvtsi32_si128(static_cast<int>(count))); }
+			static vector8f RTM_SIMD_CALL to_float(__m256i input) RTM_NO_EXCEPT { return _mm256_cvtepi32_ps(input); }
+		};
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// The noise functions evaluated by noise_evaluate_soa(..), for any register width.
+		//////////////////////////////////////////////////////////////////////////
+		struct noise_perlin3_kernel
+		{
+			int32_t seed;
+
+			template<uint32_t num_lanes>
+			typename noise_lanes<num_lanes>::float_type evaluate(const typename noise_lanes<num_lanes>::float_type (&coordinates)[3]) const RTM_NO_EXCEPT
+			{
+				return noise_perlin3_impl<num_lanes>(coordinates[0], coordinates[1], coordinates[2], noise_lanes<num_lanes>::broadcast_int(seed));
+			}
+		};
+
+		struct noise_perlin4_kernel
+		{
+			int32_t seed;
+
+			template<uint32_t num_lanes>
+			typename noise_lanes<num_lanes>::float_type evaluate(const typename noise_lanes<num_lanes>::float_type (&coordinates)[4]) const RTM_NO_EXCEPT
+			{
+				return noise_perlin4_impl<num_lanes>(coordinates[0], coordinates[1], coordinates[2], coordinates[3], noise_lanes<num_lanes>::broadcast_int(seed));
+			}
+		};
+
+		struct noise_fbm3_kernel
+		{
+			const noise_fractal_settings* settings;
+			float normalization;
+
+			template<uint32_t num_lanes>
+			typename noise_lanes<num_lanes>::float_type evaluate(const typename noise_lanes<num_lanes>::float_type (&coordinates)[3]) const RTM_NO_EXCEPT
+			{
+				return noise_fbm3_impl<num_lanes>(coordinates[0], coordinates[1], coordinates[2], *settings, normalization);
+			}
+		};
+
+		struct noise_fbm4_kernel
+		{
+			const noise_fractal_settings* settings;
+			float normalization;
+
+			template<uint32_t num_lanes>
+			typename noise_lanes<num_lanes>::float_type evaluate(const typename noise_lanes<num_lanes>::float_type (&coordinates)[4]) const RTM_NO_EXCEPT
+			{
+				return noise_fbm4_impl<num_lanes>(coordinates[0], coordinates[1], coordinates[2], coordinates[3], *settings, normalization);
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates a noise kernel over 'count' positions stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_dimensions, typename kernel_type>
+		inline void noise_evaluate_soa(const float* const (&inputs)[num_dimensions], float* output, uint32_t count, const kernel_type& kernel) RTM_NO_EXCEPT
+		{
+			uint32_t index = 0;
+
+#if defined(RTM_AVX2_INTRINSICS)
+			for (; index + 8 <= count; index += 8)
+			{
+				vector8f coordinates[num_dimensions];
+				for (uint32_t dimension_index = 0; dimension_index < num_dimensions; ++dimension_index)
+					coordinates[dimension_index] = noise_lanes<8>::load(inputs[dimension_index] + index);
+
+				noise_lanes<8>::store(kernel.template evaluate<8>(coordinates), output + index);
+			}
+#endif
+
+			for (; index + 4 <= count; index += 4)
+			{
+				vector4f coordinates[num_dimensions];
+				for (uint32_t dimension_index = 0; dimension_index < num_dimensions; ++dimension_index)
+					coordinates[dimension_index] = noise_lanes<4>::load(inputs[dimension_index] + index);
+
+				noise_lanes<4>::store(kernel.template evaluate<4>(coordinates), output + index);
+			}
+
+			if (index < count)
+			{
+				// The last positions are copied into padded streams to run the same code
+				float buffer[num_dimensions][4] = {};
+				const uint32_t num_remaining = count - index;
+				for (uint32_t dimension_index = 0; dimension_index < num_dimensions; ++dimension_index)
+				{
+					for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+						buffer[dimension_index][lane_index] = inputs[dimension_index][index + lane_index];
+				}
+
+				vector4f coordinates[num_dimensions];
+				for (uint32_t dimension_index = 0; dimension_index < num_dimensions; ++dimension_index)
+					coordinates[dimension_index] = noise_lanes<4>::load(&buffer[dimension_index][0]);
+
+				float values[4];
+				noise_lanes<4>::store(kernel.template evaluate<4>(coordinates), &values[0]);
+				for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+					output[index + lane_index] = values[lane_index];
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 3D Perlin gradient noise at 'count' positions stored as structure of arrays,
+	// see noise_perlin3(..). With AVX2, 8 positions are evaluated at a time.
+	// The results are identical to noise_perlin3(..) on the same instruction set.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void noise_perlin3_soa(const const_float3f_soa& positions, float* output, uint32_t count, int32_t seed = 0) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::noise_perlin3_soa", count, count * sizeof(float) * 4);
+		const float* const inputs[3] = { positions.x, positions.y, positions.z };
+		rtm_impl::noise_evaluate_soa<3>(inputs, output, count, rtm_impl::noise_perlin3_kernel{ seed });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 4D Perlin gradient noise at 'count' positions stored as structure of arrays,
+	// see noise_perlin4(..). With AVX2, 8 positions are evaluated at a time.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void noise_perlin4_soa(const const_float4f_soa& positions, float* output, uint32_t count, int32_t seed = 0) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::noise_perlin4_soa", count, count * sizeof(float) * 5);
+		const float* const inputs[4] = { positions.x, positions.y, positions.z, positions.w };
+		rtm_impl::noise_evaluate_soa<4>(inputs, output, count, rtm_impl::noise_perlin4_kernel{ seed });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the fractal Brownian motion of 3D Perlin noise at 'count' positions stored
+	// as structure of arrays, see noise_fbm3(..). Every octave of a group of positions is
+	// summed in registers before it is written. With AVX2, 8 positions are evaluated at a time.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void noise_fbm3_soa(const const_float3f_soa& positions, float* output, uint32_t count, const noise_fractal_settings& settings) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::noise_fbm3_soa", count, count * sizeof(float) * 4);
+		const float* const inputs[3] = { positions.x, positions.y, positions.z };
+		rtm_impl::noise_evaluate_soa<3>(inputs, output, count, rtm_impl::noise_fbm3_kernel{ &settings, rtm_impl::noise_fractal_normalization(settings) });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the fractal Brownian motion of 4D Perlin noise at 'count' positions stored
+	// as structure of arrays, see noise_fbm4(..). With AVX2, 8 positions are evaluated at a time.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void noise_fbm4_soa(const const_float4f_soa& positions, float* output, uint32_t count, const noise_fractal_settings& settings) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::noise_fbm4_soa", count, count * sizeof(float) * 5);
+		const float* const inputs[4] = { positions.x, positions.y, positions.z, positions.w };
+		rtm_impl::noise_evaluate_soa<4>(inputs, output, count, rtm_impl::noise_fbm4_kernel{ &settings, rtm_impl::noise_fractal_normalization(settings) });
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
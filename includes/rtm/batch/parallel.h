@@ -0,0 +1,480 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/batch/matrix3x4f.h"
+#include "rtm/batch/mesh.h"
+#include "rtm/batch/quatf.h"
+#include "rtm/batch/qvvf.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// Opt-in multithreaded execution of the batch functions.
+//
+// Large arrays are split into chunks that are processed independently by an executor.
+// An executor is any type with the following member function, it must call 'job' once
+// for every index in [0, num_jobs) and return once every call has completed:
+//    template<typename JobFunction> void run(uint32_t num_jobs, const JobFunction& job);
+//
+// This allows an existing job system to be used. Alternatively, serial_executor runs
+// every job on the calling thread and thread_pool is a simple work stealing pool.
+//
+// The chunk boundaries only depend on the number of elements and on the chunk size,
+// never on the number of threads. Every element is thus processed by the same code
+// path and the results are bitwise identical regardless of the executor used.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Chunks are a multiple of this many elements. It is a multiple of every SIMD
+		// width used by the batch functions (16 with AVX-512) so that only the last
+		// chunk runs a remainder loop and so that chunks preserve the stream alignment.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t k_parallel_chunk_granularity = 64;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of bytes read and written by a chunk. It is small enough for a chunk
+		// to fit in the L2 cache while being large enough to amortize scheduling.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t k_parallel_chunk_size_bytes = 64 * 1024;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of elements per chunk for elements of the provided size,
+	// counting every stream read and written.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint32_t get_parallel_chunk_size(uint32_t bytes_per_element) RTM_NO_EXCEPT
+	{
+		return (rtm_impl::k_parallel_chunk_size_bytes / bytes_per_element) < rtm_impl::k_parallel_chunk_granularity
+			? rtm_impl::k_parallel_chunk_granularity
+			: ((rtm_impl::k_parallel_chunk_size_bytes / bytes_per_element) / rtm_impl::k_parallel_chunk_granularity) * rtm_impl::k_parallel_chunk_granularity;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Splits [0, num_elements) into chunks of 'chunk_size' elements (the last one can be
+	// smaller) and calls kernel(uint32_t offset, uint32_t count) for each of them with
+	// the provided executor.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType, typename KernelType>
+	inline void parallel_for_chunks(ExecutorType& executor, uint32_t num_elements, uint32_t chunk_size, const KernelType& kernel)
+	{
+		RTM_ASSERT(chunk_size != 0, "Chunk size cannot be zero");
+
+		if (num_elements == 0)
+			return;
+
+		const uint32_t num_chunks = ((num_elements - 1) / chunk_size) + 1;
+		if (num_chunks == 1)
+		{
+			// Not worth waking up the executor
+			kernel(0U, num_elements);
+			return;
+		}
+
+		executor.run(num_chunks, [&kernel, num_elements, chunk_size](uint32_t chunk_index)
+		{
+			const uint32_t offset = chunk_index * chunk_size;
+			const uint32_t count = (num_elements - offset) < chunk_size ? (num_elements - offset) : chunk_size;
+			kernel(offset, count);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Runs every job on the calling thread, in order.
+	//////////////////////////////////////////////////////////////////////////
+	struct serial_executor
+	{
+		template<typename JobFunction>
+		void run(uint32_t num_jobs, const JobFunction& job) const
+		{
+			for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+				job(job_index);
+		}
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A simple thread pool with work stealing.
+	//
+	// The calling thread participates in the work. Every thread starts with a contiguous
+	// range of jobs that it consumes from the front. Once its range is empty, it steals
+	// jobs from the back of the other ranges. Only one run can execute at a time.
+	//////////////////////////////////////////////////////////////////////////
+	class thread_pool
+	{
+	public:
+		//////////////////////////////////////////////////////////////////////////
+		// Creates 'num_worker_threads' threads in addition to the calling thread.
+		// With zero worker threads, every job runs on the calling thread.
+		//////////////////////////////////////////////////////////////////////////
+		explicit thread_pool(uint32_t num_worker_threads)
+			: m_ranges(new job_range[num_worker_threads + 1])
+			, m_num_threads(num_worker_threads + 1)
+		{
+			m_workers.reserve(num_worker_threads);
+			for (uint32_t worker_index = 0; worker_index < num_worker_threads; ++worker_index)
+				m_workers.emplace_back([this, worker_index]() { worker_main(worker_index + 1); });
+		}
+
+		~thread_pool()
+		{
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_is_exiting = true;
+			}
+
+			m_wake_condition.notify_all();
+
+			for (std::thread& worker : m_workers)
+				worker.join();
+		}
+
+		thread_pool(const thread_pool&) = delete;
+		thread_pool& operator=(const thread_pool&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of threads executing jobs, including the calling thread.
+		//////////////////////////////////////////////////////////////////////////
+		uint32_t get_num_threads() const { return m_num_threads; }
+
+		template<typename JobFunction>
+		void run(uint32_t num_jobs, const JobFunction& job)
+		{
+			if (num_jobs == 0)
+				return;
+
+			if (m_num_threads == 1)
+			{
+				for (uint32_t job_index = 0; job_index < num_jobs; ++job_index)
+					job(job_index);
+				return;
+			}
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				for (uint32_t thread_index = 0; thread_index < m_num_threads; ++thread_index)
+				{
+					const uint64_t first_job = (uint64_t(num_jobs) * thread_index) / m_num_threads;
+					const uint64_t end_job = (uint64_t(num_jobs) * (thread_index + 1)) / m_num_threads;
+					m_ranges[thread_index].range.store((end_job << 32) | first_job, std::memory_order_relaxed);
+				}
+
+				m_job = &job;
+				m_job_fn = &invoke_job<JobFunction>;
+				m_num_busy_workers = m_num_threads - 1;
+				m_generation++;
+			}
+
+			m_wake_condition.notify_all();
+
+			execute_jobs(0);
+
+			// Wait for the workers to be done with this run before the job goes out of scope
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_done_condition.wait(lock, [this]() { return m_num_busy_workers == 0; });
+		}
+
+	private:
+		// The first job is in the low 32 bits and the end job is in the high 32 bits.
+		// Padded to limit false sharing, over-aligned allocations require C++17.
+		struct job_range
+		{
+			std::atomic<uint64_t> range;
+			uint8_t padding[64 - sizeof(std::atomic<uint64_t>)];
+		};
+
+		using job_fn = void(*)(const void* job, uint32_t job_index);
+
+		template<typename JobFunction>
+		static void invoke_job(const void* job, uint32_t job_index)
+		{
+			(*static_cast<const JobFunction*>(job))(job_index);
+		}
+
+		bool pop_front(uint32_t thread_index, uint32_t& out_job_index)
+		{
+			std::atomic<uint64_t>& range = m_ranges[thread_index].range;
+			uint64_t value = range.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				const uint32_t first_job = uint32_t(value);
+				const uint32_t end_job = uint32_t(value >> 32);
+				if (first_job >= end_job)
+					return false;
+
+				if (range.compare_exchange_weak(value, (uint64_t(end_job) << 32) | (first_job + 1), std::memory_order_relaxed))
+				{
+					out_job_index = first_job;
+					return true;
+				}
+			}
+		}
+
+		bool steal_back(uint32_t thread_index, uint32_t& out_job_index)
+		{
+			std::atomic<uint64_t>& range = m_ranges[thread_index].range;
+			uint64_t value = range.load(std::memory_order_relaxed);
+			for (;;)
+			{
+				const uint32_t first_job = uint32_t(value);
+				const uint32_t end_job = uint32_t(value >> 32);
+				if (first_job >= end_job)
+					return false;
+
+				if (range.compare_exchange_weak(value, (uint64_t(end_job - 1) << 32) | first_job, std::memory_order_relaxed))
+				{
+					out_job_index = end_job - 1;
+					return true;
+				}
+			}
+		}
+
+		void execute_jobs(uint32_t thread_index)
+		{
+			uint32_t job_index;
+			for (;;)
+			{
+				if (pop_front(thread_index, job_index))
+				{
+					m_job_fn(m_job, job_index);
+					continue;
+				}
+
+				bool has_stolen = false;
+				for (uint32_t offset = 1; offset < m_num_threads; ++offset)
+				{
+					const uint32_t victim_index = (thread_index + offset) % m_num_threads;
+					if (steal_back(victim_index, job_index))
+					{
+						m_job_fn(m_job, job_index);
+						has_stolen = true;
+						break;
+					}
+				}
+
+				if (!has_stolen)
+					break;	// Every range is empty
+			}
+		}
+
+		void worker_main(uint32_t thread_index)
+		{
+			uint64_t last_generation = 0;
+			for (;;)
+			{
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_wake_condition.wait(lock, [this, last_generation]() { return m_is_exiting || m_generation != last_generation; });
+
+					if (m_is_exiting)
+						return;
+
+					last_generation = m_generation;
+				}
+
+				execute_jobs(thread_index);
+
+				bool is_last_worker;
+				{
+					std::lock_guard<std::mutex> lock(m_mutex);
+					is_last_worker = --m_num_busy_workers == 0;
+				}
+
+				if (is_last_worker)
+					m_done_condition.notify_one();
+			}
+		}
+
+		std::unique_ptr<job_range[]>	m_ranges;
+		std::vector<std::thread>		m_workers;
+
+		std::mutex						m_mutex;
+		std::condition_variable			m_wake_condition;
+		std::condition_variable			m_done_condition;
+
+		const void*						m_job = nullptr;
+		job_fn							m_job_fn = nullptr;
+		uint64_t						m_generation = 0;
+		uint32_t						m_num_busy_workers = 0;
+		uint32_t						m_num_threads;
+		bool							m_is_exiting = false;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// quat_mul_soa split into chunks processed by the provided executor.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void quat_mul_soa_parallel(ExecutorType& executor, const const_float4f_soa& lhs, const const_float4f_soa& rhs, const float4f_soa& output, uint32_t num_quats)
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_mul_soa_parallel", num_quats, num_quats * sizeof(float) * 12);
+
+		parallel_for_chunks(executor, num_quats, get_parallel_chunk_size(sizeof(float) * 12), [&](uint32_t offset, uint32_t count)
+		{
+			const const_float4f_soa lhs_chunk{ lhs.x + offset, lhs.y + offset, lhs.z + offset, lhs.w + offset };
+			const const_float4f_soa rhs_chunk{ rhs.x + offset, rhs.y + offset, rhs.z + offset, rhs.w + offset };
+			const float4f_soa output_chunk{ output.x + offset, output.y + offset, output.z + offset, output.w + offset };
+			quat_mul_soa(lhs_chunk, rhs_chunk, output_chunk, count);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// qvv_mul_aos split into chunks processed by the provided executor.
+	// Negative scale is detected per chunk, see qvv_mul_aos.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void qvv_mul_aos_parallel(ExecutorType& executor, const qvvf* lhs, const qvvf* rhs, qvvf* output, uint32_t num_transforms)
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_aos_parallel", num_transforms, num_transforms * sizeof(qvvf) * 3);
+
+		parallel_for_chunks(executor, num_transforms, get_parallel_chunk_size(sizeof(qvvf) * 3), [&](uint32_t offset, uint32_t count)
+		{
+			qvv_mul_aos(lhs + offset, rhs + offset, output + offset, count);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// qvv_mul_point3_aos split into chunks processed by the provided executor.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void qvv_mul_point3_aos_parallel(ExecutorType& executor, const qvvf& qvv, const float3f* points, float3f* output, uint32_t num_points, store_mode mode = store_mode::cached)
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_point3_aos_parallel", num_points, num_points * sizeof(float3f) * 2);
+
+		parallel_for_chunks(executor, num_points, get_parallel_chunk_size(sizeof(float3f) * 2), [&](uint32_t offset, uint32_t count)
+		{
+			qvv_mul_point3_aos(qvv, points + offset, output + offset, count, mode);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// matrix_mul_aos split into chunks processed by the provided executor.
+	// This multiplies a whole palette of matrices with a single matrix.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void matrix_mul_aos_parallel(ExecutorType& executor, const matrix3x4f* lhs, const matrix3x4f& rhs, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached)
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_mul_aos_parallel", num_matrices, num_matrices * sizeof(matrix3x4f) * 2);
+
+		parallel_for_chunks(executor, num_matrices, get_parallel_chunk_size(sizeof(matrix3x4f) * 2), [&](uint32_t offset, uint32_t count)
+		{
+			matrix_mul_aos(lhs + offset, rhs, output + offset, count, mode);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// matrix_mul_aos split into chunks processed by the provided executor.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void matrix_mul_aos_parallel(ExecutorType& executor, const matrix3x4f* lhs, const matrix3x4f* rhs, matrix3x4f* output, uint32_t num_matrices, store_mode mode = store_mode::cached)
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_mul_aos_parallel", num_matrices, num_matrices * sizeof(matrix3x4f) * 3);
+
+		parallel_for_chunks(executor, num_matrices, get_parallel_chunk_size(sizeof(matrix3x4f) * 3), [&](uint32_t offset, uint32_t count)
+		{
+			matrix_mul_aos(lhs + offset, rhs + offset, output + offset, count, mode);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// mesh_face_normals_soa split into chunks of faces processed by the provided executor.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void mesh_face_normals_soa_parallel(ExecutorType& executor, const const_float3f_soa& positions, const uint32_t* indices, float4f* output_face_normals, uint32_t num_faces)
+	{
+		RTM_PROFILE_SCOPE("rtm::mesh_face_normals_soa_parallel", num_faces, num_faces * (sizeof(uint32_t) * 3 + sizeof(float) * 9 + sizeof(float4f)));
+
+		parallel_for_chunks(executor, num_faces, get_parallel_chunk_size(sizeof(uint32_t) * 3 + sizeof(float) * 9 + sizeof(float4f)), [&](uint32_t offset, uint32_t count)
+		{
+			mesh_face_normals_soa(positions, indices + offset * 3, output_face_normals + offset, count);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// mesh_face_tangents_soa split into chunks of faces processed by the provided executor.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void mesh_face_tangents_soa_parallel(ExecutorType& executor, const const_float3f_soa& positions, const float* texcoords_u, const float* texcoords_v, const uint32_t* indices,
+		float4f* output_face_tangents, float4f* output_face_bitangents, uint32_t num_faces)
+	{
+		RTM_PROFILE_SCOPE("rtm::mesh_face_tangents_soa_parallel", num_faces, num_faces * (sizeof(uint32_t) * 3 + sizeof(float) * 15 + sizeof(float4f) * 2));
+
+		parallel_for_chunks(executor, num_faces, get_parallel_chunk_size(sizeof(uint32_t) * 3 + sizeof(float) * 15 + sizeof(float4f) * 2), [&](uint32_t offset, uint32_t count)
+		{
+			mesh_face_tangents_soa(positions, texcoords_u, texcoords_v, indices + offset * 3, output_face_tangents + offset, output_face_bitangents + offset, count);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// mesh_vertex_normals_soa split into chunks of vertices processed by the provided executor.
+	// Each vertex gathers its own faces, the chunks never write to the same vertex.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void mesh_vertex_normals_soa_parallel(ExecutorType& executor, const float4f* face_normals, const mesh_vertex_faces& vertex_faces, const float3f_soa& output_normals, uint32_t num_vertices)
+	{
+		RTM_PROFILE_SCOPE("rtm::mesh_vertex_normals_soa_parallel", num_vertices, num_vertices * (sizeof(uint32_t) * 7 + sizeof(float4f) * 6 + sizeof(float) * 3));
+
+		parallel_for_chunks(executor, num_vertices, get_parallel_chunk_size(sizeof(uint32_t) * 7 + sizeof(float4f) * 6 + sizeof(float) * 3), [&](uint32_t offset, uint32_t count)
+		{
+			const mesh_vertex_faces vertex_faces_chunk{ vertex_faces.offsets + offset, vertex_faces.face_indices };
+			const float3f_soa output_chunk{ output_normals.x + offset, output_normals.y + offset, output_normals.z + offset };
+			mesh_vertex_normals_soa(face_normals, vertex_faces_chunk, output_chunk, count);
+		});
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// mesh_vertex_tangents_soa split into chunks of vertices processed by the provided executor.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename ExecutorType>
+	inline void mesh_vertex_tangents_soa_parallel(ExecutorType& executor, const const_float3f_soa& normals, const float4f* face_tangents, const float4f* face_bitangents, const mesh_vertex_faces& vertex_faces,
+		const float4f_soa& output_tangents, uint32_t num_vertices)
+	{
+		RTM_PROFILE_SCOPE("rtm::mesh_vertex_tangents_soa_parallel", num_vertices, num_vertices * (sizeof(uint32_t) * 7 + sizeof(float4f) * 12 + sizeof(float) * 7));
+
+		parallel_for_chunks(executor, num_vertices, get_parallel_chunk_size(sizeof(uint32_t) * 7 + sizeof(float4f) * 12 + sizeof(float) * 7), [&](uint32_t offset, uint32_t count)
+		{
+			const const_float3f_soa normals_chunk{ normals.x + offset, normals.y + offset, normals.z + offset };
+			const mesh_vertex_faces vertex_faces_chunk{ vertex_faces.offsets + offset, vertex_faces.face_indices };
+			const float4f_soa output_chunk{ output_tangents.x + offset, output_tangents.y + offset, output_tangents.z + offset, output_tangents.w + offset };
+			mesh_vertex_tangents_soa(normals_chunk, face_tangents, face_bitangents, vertex_faces_chunk, output_chunk, count);
+		});
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
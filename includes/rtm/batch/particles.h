@@ -0,0 +1,338 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <limits>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The parameters shared by every particle integrated in a batch.
+	//////////////////////////////////////////////////////////////////////////
+	struct particle_integration_settings
+	{
+		// An acceleration applied to every particle (e.g. gravity), added to the per particle accelerations
+		float3f acceleration = { 0.0F, 0.0F, 0.0F };
+
+		// Velocities are clamped per component in [-max_velocity, max_velocity]
+		float3f max_velocity = { std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity(), std::numeric_limits<float>::infinity() };
+
+		// The duration of the step, in seconds
+		float delta_time = 0.0F;
+
+		// Velocities are scaled by max(1.0 - drag * delta_time, 0.0) every step
+		float drag = 0.0F;
+
+		// The fraction of the velocity along a collision plane normal that bounces back, in [0.0, 1.0]
+		float restitution = 0.0F;
+
+		// Particles are kept on the positive side of the planes: dot(plane.xyz, position) + plane.w >= 0.0
+		// The plane normals must be normalized.
+		const vector4f* collision_planes = nullptr;
+		uint32_t num_collision_planes = 0;
+	};
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Loads and broadcasts for the register width the particle kernels are instantiated with.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		struct particle_register;
+
+		template<>
+		struct particle_register<4>
+		{
+			using vector_type = vector4f;
+
+			static vector4f RTM_SIMD_CALL load(const float* input) RTM_NO_EXCEPT { return vector_load(input); }
+			static vector4f RTM_SIMD_CALL broadcast(float value) RTM_NO_EXCEPT { return vector_set(value); }
+		};
+
+		template<>
+		struct particle_register<8>
+		{
+			using vector_type = vector8f;
+
+			static vector8f RTM_SIMD_CALL load(const float* input) RTM_NO_EXCEPT { return vector8_load(input); }
+			static vector8f RTM_SIMD_CALL broadcast(float value) RTM_NO_EXCEPT { return vector8_set(value); }
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// The settings broadcast once per batch.
+		// Both integrators advance a motion per step: the velocity with Euler and the
+		// displacement since the previous position with Verlet. The acceleration and the
+		// velocity limits are scaled to match.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		struct particle_step_constants
+		{
+			using vector_type = typename particle_register<num_lanes>::vector_type;
+
+			vector_type acceleration_x;
+			vector_type acceleration_y;
+			vector_type acceleration_z;
+			vector_type max_motion_x;
+			vector_type max_motion_y;
+			vector_type max_motion_z;
+			vector_type acceleration_scale;
+			vector_type position_scale;
+			vector_type drag_factor;
+			vector_type bounce_factor;
+		};
+
+		template<uint32_t num_lanes>
+		inline particle_step_constants<num_lanes> particle_make_step_constants(const particle_integration_settings& settings, bool is_verlet) RTM_NO_EXCEPT
+		{
+			using reg = particle_register<num_lanes>;
+
+			const float delta_time = settings.delta_time;
+			const float acceleration_scale = is_verlet ? (delta_time * delta_time) : delta_time;
+			const float motion_scale = is_verlet ? delta_time : 1.0F;
+			const float drag_factor = scalar_max(1.0F - settings.drag * delta_time, 0.0F);
+
+			particle_step_constants<num_lanes> constants;
+			constants.acceleration_x = reg::broadcast(settings.acceleration.x * acceleration_scale);
+			constants.acceleration_y = reg::broadcast(settings.acceleration.y * acceleration_scale);
+			constants.acceleration_z = reg::broadcast(settings.acceleration.z * acceleration_scale);
+			constants.max_motion_x = reg::broadcast(settings.max_velocity.x * motion_scale);
+			constants.max_motion_y = reg::broadcast(settings.max_velocity.y * motion_scale);
+			constants.max_motion_z = reg::broadcast(settings.max_velocity.z * motion_scale);
+			constants.acceleration_scale = reg::broadcast(acceleration_scale);
+			constants.position_scale = reg::broadcast(is_verlet ? 1.0F : delta_time);
+			constants.drag_factor = reg::broadcast(drag_factor);
+			constants.bounce_factor = reg::broadcast(1.0F + settings.restitution);
+			return constants;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Pushes the particles out of the collision planes and reflects the motion
+		// towards each plane they penetrate, lane-wise.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline void particle_collide(const particle_integration_settings& settings, const particle_step_constants<num_lanes>& constants,
+			typename particle_register<num_lanes>::vector_type& position_x, typename particle_register<num_lanes>::vector_type& position_y, typename particle_register<num_lanes>::vector_type& position_z,
+			typename particle_register<num_lanes>::vector_type& motion_x, typename particle_register<num_lanes>::vector_type& motion_y, typename particle_register<num_lanes>::vector_type& motion_z) RTM_NO_EXCEPT
+		{
+			using reg = particle_register<num_lanes>;
+			using vector_type = typename reg::vector_type;
+
+			const vector_type zero = reg::broadcast(0.0F);
+			for (uint32_t plane_index = 0; plane_index < settings.num_collision_planes; ++plane_index)
+			{
+				const float* plane = reinterpret_cast<const float*>(settings.collision_planes + plane_index);
+				const vector_type normal_x = reg::broadcast(plane[0]);
+				const vector_type normal_y = reg::broadcast(plane[1]);
+				const vector_type normal_z = reg::broadcast(plane[2]);
+
+				const vector_type distance = vector_mul_add(position_z, normal_z, vector_mul_add(position_y, normal_y, vector_mul_add(position_x, normal_x, reg::broadcast(plane[3]))));
+				const vector_type normal_motion = vector_mul_add(motion_z, normal_z, vector_mul_add(motion_y, normal_y, vector_mul(motion_x, normal_x)));
+
+				// Only the motion of penetrating particles heading into the plane bounces
+				const vector_type correction = vector_min(distance, zero);
+				const vector_type impulse = vector_select(vector_less_than(distance, zero), vector_mul(vector_min(normal_motion, zero), constants.bounce_factor), zero);
+
+				position_x = vector_neg_mul_sub(normal_x, correction, position_x);
+				position_y = vector_neg_mul_sub(normal_y, correction, position_y);
+				position_z = vector_neg_mul_sub(normal_z, correction, position_z);
+				motion_x = vector_neg_mul_sub(normal_x, impulse, motion_x);
+				motion_y = vector_neg_mul_sub(normal_y, impulse, motion_y);
+				motion_z = vector_neg_mul_sub(normal_z, impulse, motion_z);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Integrates one register of particles starting at 'index'.
+		// With Euler, 'motions' holds the velocities. With Verlet, it holds the previous positions.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes, bool is_verlet, bool has_accelerations>
+		inline void particle_integrate(const float3f_soa& positions, const float3f_soa& motions, const const_float3f_soa& accelerations,
+			const particle_integration_settings& settings, const particle_step_constants<num_lanes>& constants, uint32_t index) RTM_NO_EXCEPT
+		{
+			using reg = particle_register<num_lanes>;
+			using vector_type = typename reg::vector_type;
+
+			vector_type acceleration_x = constants.acceleration_x;
+			vector_type acceleration_y = constants.acceleration_y;
+			vector_type acceleration_z = constants.acceleration_z;
+			if (static_condition<has_accelerations>::test())
+			{
+				acceleration_x = vector_mul_add(reg::load(accelerations.x + index), constants.acceleration_scale, acceleration_x);
+				acceleration_y = vector_mul_add(reg::load(accelerations.y + index), constants.acceleration_scale, acceleration_y);
+				acceleration_z = vector_mul_add(reg::load(accelerations.z + index), constants.acceleration_scale, acceleration_z);
+			}
+
+			vector_type position_x = reg::load(positions.x + index);
+			vector_type position_y = reg::load(positions.y + index);
+			vector_type position_z = reg::load(positions.z + index);
+
+			vector_type motion_x = reg::load(motions.x + index);
+			vector_type motion_y = reg::load(motions.y + index);
+			vector_type motion_z = reg::load(motions.z + index);
+			if (static_condition<is_verlet>::test())
+			{
+				motion_x = vector_sub(position_x, motion_x);
+				motion_y = vector_sub(position_y, motion_y);
+				motion_z = vector_sub(position_z, motion_z);
+			}
+
+			// motion = clamp(motion * drag + acceleration)
+			motion_x = vector_mul_add(motion_x, constants.drag_factor, acceleration_x);
+			motion_y = vector_mul_add(motion_y, constants.drag_factor, acceleration_y);
+			motion_z = vector_mul_add(motion_z, constants.drag_factor, acceleration_z);
+			motion_x = vector_min(vector_max(motion_x, vector_neg(constants.max_motion_x)), constants.max_motion_x);
+			motion_y = vector_min(vector_max(motion_y, vector_neg(constants.max_motion_y)), constants.max_motion_y);
+			motion_z = vector_min(vector_max(motion_z, vector_neg(constants.max_motion_z)), constants.max_motion_z);
+
+			position_x = vector_mul_add(motion_x, constants.position_scale, position_x);
+			position_y = vector_mul_add(motion_y, constants.position_scale, position_y);
+			position_z = vector_mul_add(motion_z, constants.position_scale, position_z);
+
+			particle_collide<num_lanes>(settings, constants, position_x, position_y, position_z, motion_x, motion_y, motion_z);
+
+			vector_store(position_x, positions.x + index);
+			vector_store(position_y, positions.y + index);
+			vector_store(position_z, positions.z + index);
+
+			if (static_condition<is_verlet>::test())
+			{
+				// The previous position is moved such that the next step resumes with the corrected motion
+				vector_store(vector_sub(position_x, motion_x), motions.x + index);
+				vector_store(vector_sub(position_y, motion_y), motions.y + index);
+				vector_store(vector_sub(position_z, motion_z), motions.z + index);
+			}
+			else
+			{
+				vector_store(motion_x, motions.x + index);
+				vector_store(motion_y, motions.y + index);
+				vector_store(motion_z, motions.z + index);
+			}
+		}
+
+		template<bool is_verlet, bool has_accelerations>
+		inline void particle_integrate_soa_impl(const float3f_soa& positions, const float3f_soa& motions, const const_float3f_soa& accelerations, const particle_integration_settings& settings, uint32_t num_particles) RTM_NO_EXCEPT
+		{
+			uint32_t index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+			const particle_step_constants<8> constants8 = particle_make_step_constants<8>(settings, is_verlet);
+			for (; index + 8 <= num_particles; index += 8)
+				particle_integrate<8, is_verlet, has_accelerations>(positions, motions, accelerations, settings, constants8, index);
+#endif
+
+			const particle_step_constants<4> constants4 = particle_make_step_constants<4>(settings, is_verlet);
+			for (; index + 4 <= num_particles; index += 4)
+				particle_integrate<4, is_verlet, has_accelerations>(positions, motions, accelerations, settings, constants4, index);
+
+			if (index < num_particles)
+			{
+				// The last particles are copied into padded streams to run the same code
+				float buffer[9][4] = {};
+				const uint32_t num_remaining = num_particles - index;
+				for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+				{
+					buffer[0][lane_index] = positions.x[index + lane_index];
+					buffer[1][lane_index] = positions.y[index + lane_index];
+					buffer[2][lane_index] = positions.z[index + lane_index];
+					buffer[3][lane_index] = motions.x[index + lane_index];
+					buffer[4][lane_index] = motions.y[index + lane_index];
+					buffer[5][lane_index] = motions.z[index + lane_index];
+					if (static_condition<has_accelerations>::test())
+					{
+						buffer[6][lane_index] = accelerations.x[index + lane_index];
+						buffer[7][lane_index] = accelerations.y[index + lane_index];
+						buffer[8][lane_index] = accelerations.z[index + lane_index];
+					}
+				}
+
+				const float3f_soa remaining_positions = { buffer[0], buffer[1], buffer[2] };
+				const float3f_soa remaining_motions = { buffer[3], buffer[4], buffer[5] };
+				const const_float3f_soa remaining_accelerations = { buffer[6], buffer[7], buffer[8] };
+				particle_integrate<4, is_verlet, has_accelerations>(remaining_positions, remaining_motions, remaining_accelerations, settings, constants4, 0);
+
+				for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+				{
+					positions.x[index + lane_index] = buffer[0][lane_index];
+					positions.y[index + lane_index] = buffer[1][lane_index];
+					positions.z[index + lane_index] = buffer[2][lane_index];
+					motions.x[index + lane_index] = buffer[3][lane_index];
+					motions.y[index + lane_index] = buffer[4][lane_index];
+					motions.z[index + lane_index] = buffer[5][lane_index];
+				}
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Advances 'num_particles' particles stored as structure of arrays by one step of
+	// semi-implicit Euler, in place:
+	//    velocity = clamp(velocity * max(1 - drag * dt, 0) + acceleration * dt, -max_velocity, max_velocity)
+	//    position = position + velocity * dt
+	// The particles are then pushed out of the collision planes, see particle_integration_settings.
+	// The accelerations are optional: their streams can be null to only apply the constant acceleration.
+	// Every stream is read and written once, sequentially. With AVX, 8 particles are integrated at a time.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void particle_integrate_euler_soa(const float3f_soa& positions, const float3f_soa& velocities, const const_float3f_soa& accelerations, const particle_integration_settings& settings, uint32_t num_particles) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::particle_integrate_euler_soa", num_particles, num_particles * sizeof(float) * (accelerations.x != nullptr ? 15 : 12));
+		if (accelerations.x != nullptr)
+			rtm_impl::particle_integrate_soa_impl<false, true>(positions, velocities, accelerations, settings, num_particles);
+		else
+			rtm_impl::particle_integrate_soa_impl<false, false>(positions, velocities, accelerations, settings, num_particles);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Advances 'num_particles' particles stored as structure of arrays by one step of
+	// position Verlet, in place. The velocity is implied by the previous position:
+	//    displacement = clamp((position - previous) * max(1 - drag * dt, 0) + acceleration * dt * dt, -max_velocity * dt, max_velocity * dt)
+	//    previous = position
+	//    position = position + displacement
+	// The particles are then pushed out of the collision planes, see particle_integration_settings,
+	// and their previous positions are updated to reflect the bounce.
+	// The step duration should remain constant from one step to the next.
+	// The accelerations are optional: their streams can be null to only apply the constant acceleration.
+	// Every stream is read and written once, sequentially. With AVX, 8 particles are integrated at a time.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void particle_integrate_verlet_soa(const float3f_soa& positions, const float3f_soa& previous_positions, const const_float3f_soa& accelerations, const particle_integration_settings& settings, uint32_t num_particles) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::particle_integrate_verlet_soa", num_particles, num_particles * sizeof(float) * (accelerations.x != nullptr ? 15 : 12));
+		if (accelerations.x != nullptr)
+			rtm_impl::particle_integrate_soa_impl<true, true>(positions, previous_positions, accelerations, settings, num_particles);
+		else
+			rtm_impl::particle_integrate_soa_impl<true, false>(positions, previous_positions, accelerations, settings, num_particles);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
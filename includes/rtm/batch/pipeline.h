@@ -0,0 +1,226 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/batch/scratch.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// Double buffered transform buffers to overlap the stages of consecutive frames.
+//
+// A frame goes through a chain of batch functions, typically:
+//    sample -> blend -> compose -> palette -> skin
+// The first half of the chain (e.g. sampling and blending the local pose) of frame N + 1
+// runs while the second half (e.g. the object space pose, the skinning palette, and the
+// skinned vertices) of frame N runs. Each half reads and writes its own frame buffers
+// in place, no transform is ever copied from one frame buffer to the other.
+//
+// Both frames are allocated once from a scratch_arena. Every stream starts on a cache line
+// and is padded to a whole number of cache lines such that two stages writing to different
+// streams or different frames never share a cache line. Chunks split by parallel_for_chunks
+// preserve this since they are a multiple of 64 elements.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The buffers of one frame of a transform_pipeline.
+	// The local pose is stored as structure of arrays such that the track sampling and the
+	// SoA blending functions read and write it directly. The object space pose and the
+	// skinning palette are stored as arrays of structures for qvv_local_to_object(..) and the
+	// skinning functions. Every transform has its own entry in each buffer.
+	// This does not own its memory.
+	//////////////////////////////////////////////////////////////////////////
+	struct transform_pipeline_frame
+	{
+		qvvf_soa local_pose;
+		qvvf* object_pose;
+		matrix3x4f* palette;
+
+		uint32_t num_transforms;
+
+		// Incremented every time a frame is produced, starting at zero
+		uint32_t frame_index;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Two transform_pipeline_frame that alternate between a produce stage and a consume stage.
+	//
+	// Every call to run(..) produces a new frame while the frame produced by the previous call
+	// is consumed, then the frames are swapped. The first call only produces and flush(..)
+	// consumes the last frame produced. The stages are functions called with the frame they
+	// work on: void stage(const transform_pipeline_frame& frame).
+	//
+	// Both stages are submitted as 2 jobs of the provided executor and run concurrently when it
+	// has more than one thread. thread_pool cannot run nested jobs: stages running on one must
+	// call the serial batch functions or use a different executor for the *_parallel ones.
+	//
+	// The buffers are allocated from the arena when the pipeline is created and are used for as
+	// long as it lives: the arena must not be reset or rewound before the pipeline is destroyed.
+	// See get_required_size(..) to size the arena. When the arena is full, nothing is allocated
+	// and is_valid() returns false.
+	// A pipeline must not be used by multiple threads at the same time.
+	//////////////////////////////////////////////////////////////////////////
+	class transform_pipeline
+	{
+	public:
+		transform_pipeline(scratch_arena& arena, uint32_t num_transforms) RTM_NO_EXCEPT
+			: m_frames()
+			, m_produce_slot(0)
+			, m_next_frame_index(0)
+			, m_has_pending_frame(false)
+			, m_is_valid(false)
+		{
+			const size_t marker = arena.get_marker();
+
+			bool is_allocated = true;
+			for (transform_pipeline_frame& frame : m_frames)
+			{
+				const float4f_soa rotation = arena.allocate_soa4(num_transforms, k_scratch_default_alignment);
+				const float3f_soa translation = arena.allocate_soa3(num_transforms, k_scratch_default_alignment);
+				const float3f_soa scale = arena.allocate_soa3(num_transforms, k_scratch_default_alignment);
+
+				frame.local_pose = qvvf_soa{ rotation, translation, scale };
+				frame.object_pose = arena.allocate_array<qvvf>(num_transforms, k_scratch_default_alignment);
+				frame.palette = arena.allocate_array<matrix3x4f>(num_transforms, k_scratch_default_alignment);
+				frame.num_transforms = num_transforms;
+				frame.frame_index = 0;
+
+				is_allocated &= rotation.x != nullptr && translation.x != nullptr && scale.x != nullptr && frame.object_pose != nullptr && frame.palette != nullptr;
+			}
+
+			if (!is_allocated)
+			{
+				// Release the frame that fit, if any
+				arena.rewind(marker);
+				m_frames[0] = transform_pipeline_frame();
+				m_frames[1] = transform_pipeline_frame();
+				return;
+			}
+
+			m_is_valid = true;
+		}
+
+		transform_pipeline(const transform_pipeline&) = delete;
+		transform_pipeline& operator=(const transform_pipeline&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of arena bytes used by a pipeline of 'num_transforms' transforms,
+		// including the padding of every stream and the alignment of the arena buffer.
+		//////////////////////////////////////////////////////////////////////////
+		static size_t get_required_size(uint32_t num_transforms) RTM_NO_EXCEPT
+		{
+			const size_t stream_size = rtm_impl::align_to(size_t(num_transforms) * sizeof(float), k_scratch_default_alignment);
+			const size_t object_pose_size = rtm_impl::align_to(size_t(num_transforms) * sizeof(qvvf), k_scratch_default_alignment);
+			const size_t palette_size = rtm_impl::align_to(size_t(num_transforms) * sizeof(matrix3x4f), k_scratch_default_alignment);
+			const size_t frame_size = stream_size * 10 + object_pose_size + palette_size;
+			return frame_size * 2 + (k_scratch_default_alignment - 1);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the frame buffers were allocated.
+		//////////////////////////////////////////////////////////////////////////
+		bool is_valid() const RTM_NO_EXCEPT { return m_is_valid; }
+
+		uint32_t get_num_transforms() const RTM_NO_EXCEPT { return m_frames[0].num_transforms; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if a frame was produced and not consumed yet.
+		//////////////////////////////////////////////////////////////////////////
+		bool has_pending_frame() const RTM_NO_EXCEPT { return m_has_pending_frame; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the frame that the next call to run(..) produces.
+		//////////////////////////////////////////////////////////////////////////
+		const transform_pipeline_frame& get_produce_frame() const RTM_NO_EXCEPT { return m_frames[m_produce_slot]; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the frame that the next call to run(..) or flush(..) consumes.
+		// Only meaningful when has_pending_frame() returns true.
+		//////////////////////////////////////////////////////////////////////////
+		const transform_pipeline_frame& get_consume_frame() const RTM_NO_EXCEPT { return m_frames[m_produce_slot ^ 1]; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Produces a new frame while the pending frame, if any, is consumed. Returns once
+		// both stages have completed. The new frame is then pending.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename ExecutorType, typename ProduceStageType, typename ConsumeStageType>
+		void run(ExecutorType& executor, const ProduceStageType& produce_stage, const ConsumeStageType& consume_stage)
+		{
+			RTM_ASSERT(m_is_valid, "The pipeline buffers are not allocated");
+
+			transform_pipeline_frame& produce_frame = m_frames[m_produce_slot];
+			const transform_pipeline_frame& consume_frame = m_frames[m_produce_slot ^ 1];
+			produce_frame.frame_index = m_next_frame_index++;
+
+			if (m_has_pending_frame)
+			{
+				executor.run(2, [&](uint32_t job_index)
+				{
+					if (job_index == 0)
+						produce_stage(static_cast<const transform_pipeline_frame&>(produce_frame));
+					else
+						consume_stage(consume_frame);
+				});
+			}
+			else
+				produce_stage(static_cast<const transform_pipeline_frame&>(produce_frame));
+
+			m_produce_slot ^= 1;
+			m_has_pending_frame = true;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Consumes the pending frame, if any, on the calling thread.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename ConsumeStageType>
+		void flush(const ConsumeStageType& consume_stage)
+		{
+			if (!m_has_pending_frame)
+				return;
+
+			consume_stage(get_consume_frame());
+			m_has_pending_frame = false;
+		}
+
+	private:
+		transform_pipeline_frame	m_frames[2];
+		uint32_t					m_produce_slot;
+		uint32_t					m_next_frame_index;
+		bool						m_has_pending_frame;
+		bool						m_is_valid;
+	};
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
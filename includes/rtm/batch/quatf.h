@@ -0,0 +1,1984 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x3f.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/quatf.h"
+#include "rtm/quat8f.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// 4 3x3 matrices stored as structure of arrays, each axis holds one vector4f per component.
+		//////////////////////////////////////////////////////////////////////////
+		struct matrix3x3f_soa4
+		{
+			vector4f x_axis[3];
+			vector4f y_axis[3];
+			vector4f z_axis[3];
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Builds the rotation matrices of 4 quaternions like matrix_from_quat.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix3x3f_soa4 RTM_SIMD_CALL matrix_from_quat_soa4(vector4f_arg0 quat_x, vector4f_arg1 quat_y, vector4f_arg2 quat_z, vector4f_arg3 quat_w) RTM_NO_EXCEPT
+		{
+			const vector4f x2 = vector_add(quat_x, quat_x);
+			const vector4f y2 = vector_add(quat_y, quat_y);
+			const vector4f z2 = vector_add(quat_z, quat_z);
+			const vector4f xx = vector_mul(quat_x, x2);
+			const vector4f xy = vector_mul(quat_x, y2);
+			const vector4f xz = vector_mul(quat_x, z2);
+			const vector4f yy = vector_mul(quat_y, y2);
+			const vector4f yz = vector_mul(quat_y, z2);
+			const vector4f zz = vector_mul(quat_z, z2);
+			const vector4f wx = vector_mul(quat_w, x2);
+			const vector4f wy = vector_mul(quat_w, y2);
+			const vector4f wz = vector_mul(quat_w, z2);
+			const vector4f one = vector_set(1.0F);
+
+			matrix3x3f_soa4 result;
+			result.x_axis[0] = vector_sub(one, vector_add(yy, zz));
+			result.x_axis[1] = vector_add(xy, wz);
+			result.x_axis[2] = vector_sub(xz, wy);
+			result.y_axis[0] = vector_sub(xy, wz);
+			result.y_axis[1] = vector_sub(one, vector_add(xx, zz));
+			result.y_axis[2] = vector_add(yz, wx);
+			result.z_axis[0] = vector_add(xz, wy);
+			result.z_axis[1] = vector_sub(yz, wx);
+			result.z_axis[2] = vector_sub(one, vector_add(xx, yy));
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts 4 3x3 matrices into rotation quaternions like quat_from_matrix.
+		// The same pivots are used but every candidate is computed and selected per lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline void quat_from_matrix_soa4(const matrix3x3f_soa4& input, vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			const vector4f one = vector_set(1.0F);
+			const vector4f trace = vector_add(vector_add(input.x_axis[0], input.y_axis[1]), input.z_axis[2]);
+
+			const vector4f diff_yz = vector_sub(input.y_axis[2], input.z_axis[1]);
+			const vector4f diff_zx = vector_sub(input.z_axis[0], input.x_axis[2]);
+			const vector4f diff_xy = vector_sub(input.x_axis[1], input.y_axis[0]);
+			const vector4f sum_xy = vector_add(input.x_axis[1], input.y_axis[0]);
+			const vector4f sum_zx = vector_add(input.z_axis[0], input.x_axis[2]);
+			const vector4f sum_yz = vector_add(input.y_axis[2], input.z_axis[1]);
+
+			const vector4f pivot_x = vector_sub(vector_add(one, input.x_axis[0]), vector_add(input.y_axis[1], input.z_axis[2]));
+			const vector4f pivot_y = vector_sub(vector_add(one, input.y_axis[1]), vector_add(input.x_axis[0], input.z_axis[2]));
+			const vector4f pivot_z = vector_sub(vector_add(one, input.z_axis[2]), vector_add(input.x_axis[0], input.y_axis[1]));
+			const vector4f pivot_w = vector_add(one, trace);
+
+			const mask4f is_y_best = vector_greater_than(input.y_axis[1], input.x_axis[0]);
+			const mask4f is_z_best = vector_greater_than(input.z_axis[2], vector_select(is_y_best, input.y_axis[1], input.x_axis[0]));
+			const mask4f is_w_best = vector_greater_than(trace, vector_zero());
+
+			vector4f quat_x = vector_select(is_y_best, sum_xy, pivot_x);
+			vector4f quat_y = vector_select(is_y_best, pivot_y, sum_xy);
+			vector4f quat_z = vector_select(is_y_best, sum_yz, sum_zx);
+			vector4f quat_w = vector_select(is_y_best, diff_zx, diff_yz);
+			vector4f pivot = vector_select(is_y_best, pivot_y, pivot_x);
+
+			quat_x = vector_select(is_z_best, sum_zx, quat_x);
+			quat_y = vector_select(is_z_best, sum_yz, quat_y);
+			quat_z = vector_select(is_z_best, pivot_z, quat_z);
+			quat_w = vector_select(is_z_best, diff_xy, quat_w);
+			pivot = vector_select(is_z_best, pivot_z, pivot);
+
+			quat_x = vector_select(is_w_best, diff_yz, quat_x);
+			quat_y = vector_select(is_w_best, diff_zx, quat_y);
+			quat_z = vector_select(is_w_best, diff_xy, quat_z);
+			quat_w = vector_select(is_w_best, pivot_w, quat_w);
+			pivot = vector_select(is_w_best, pivot_w, pivot);
+
+			// The pivot component is sqrt(pivot) / 2, the others are scaled to match
+			// The matrix might not be exactly orthonormal, normalize like quat_from_matrix does
+			const vector4f quat_scale = vector_div(vector_set(0.5F), vector_sqrt(pivot));
+			quat_x = vector_mul(quat_x, quat_scale);
+			quat_y = vector_mul(quat_y, quat_scale);
+			quat_z = vector_mul(quat_z, quat_scale);
+			quat_w = vector_mul(quat_w, quat_scale);
+
+			const vector4f quat_len_sq = vector_mul_add(quat_w, quat_w, vector_mul_add(quat_z, quat_z, vector_mul_add(quat_y, quat_y, vector_mul(quat_x, quat_x))));
+			const vector4f inv_quat_len = vector_div(one, vector_sqrt(quat_len_sq));
+
+			// Zero scale isn't supported, like quat_from_matrix those lanes return the identity
+			const vector4f x_axis_extent = vector_max(vector_max(vector_abs(input.x_axis[0]), vector_abs(input.x_axis[1])), vector_abs(input.x_axis[2]));
+			const vector4f y_axis_extent = vector_max(vector_max(vector_abs(input.y_axis[0]), vector_abs(input.y_axis[1])), vector_abs(input.y_axis[2]));
+			const vector4f z_axis_extent = vector_max(vector_max(vector_abs(input.z_axis[0]), vector_abs(input.z_axis[1])), vector_abs(input.z_axis[2]));
+			const vector4f min_axis_extent = vector_min(vector_min(x_axis_extent, y_axis_extent), z_axis_extent);
+			const mask4f is_zero_scale = vector_less_equal(min_axis_extent, vector_set(0.00001F));
+
+			const vector4f zero = vector_zero();
+			out_x = vector_select(is_zero_scale, zero, vector_mul(quat_x, inv_quat_len));
+			out_y = vector_select(is_zero_scale, zero, vector_mul(quat_y, inv_quat_len));
+			out_z = vector_select(is_zero_scale, zero, vector_mul(quat_z, inv_quat_len));
+			out_w = vector_select(is_zero_scale, one, vector_mul(quat_w, inv_quat_len));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Quaternion array accessors used by the batch conversions, AoS and SoA.
+		//////////////////////////////////////////////////////////////////////////
+		inline void quat_batch_load4(const quatf* input, uint32_t index, vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			out_x = quat_to_vector(input[index + 0]);
+			out_y = quat_to_vector(input[index + 1]);
+			out_z = quat_to_vector(input[index + 2]);
+			out_w = quat_to_vector(input[index + 3]);
+			vector_transpose4x4(out_x, out_y, out_z, out_w);
+		}
+
+		inline void quat_batch_load4(const const_float4f_soa& input, uint32_t index, vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			out_x = vector_load(input.x + index);
+			out_y = vector_load(input.y + index);
+			out_z = vector_load(input.z + index);
+			out_w = vector_load(input.w + index);
+		}
+
+		inline quatf quat_batch_load(const quatf* input, uint32_t index) RTM_NO_EXCEPT
+		{
+			return input[index];
+		}
+
+		inline quatf quat_batch_load(const const_float4f_soa& input, uint32_t index) RTM_NO_EXCEPT
+		{
+			return quat_set(input.x[index], input.y[index], input.z[index], input.w[index]);
+		}
+
+		inline void RTM_SIMD_CALL quat_batch_store4(vector4f_arg0 quat_x, vector4f_arg1 quat_y, vector4f_arg2 quat_z, vector4f_arg3 quat_w, quatf* output, uint32_t index) RTM_NO_EXCEPT
+		{
+			vector4f quat0 = quat_x;
+			vector4f quat1 = quat_y;
+			vector4f quat2 = quat_z;
+			vector4f quat3 = quat_w;
+			vector_transpose4x4(quat0, quat1, quat2, quat3);
+
+			output[index + 0] = vector_to_quat(quat0);
+			output[index + 1] = vector_to_quat(quat1);
+			output[index + 2] = vector_to_quat(quat2);
+			output[index + 3] = vector_to_quat(quat3);
+		}
+
+		inline void RTM_SIMD_CALL quat_batch_store4(vector4f_arg0 quat_x, vector4f_arg1 quat_y, vector4f_arg2 quat_z, vector4f_arg3 quat_w, const float4f_soa& output, uint32_t index) RTM_NO_EXCEPT
+		{
+			vector_store(quat_x, output.x + index);
+			vector_store(quat_y, output.y + index);
+			vector_store(quat_z, output.z + index);
+			vector_store(quat_w, output.w + index);
+		}
+
+		inline void RTM_SIMD_CALL quat_batch_store(quatf_arg0 input, quatf* output, uint32_t index) RTM_NO_EXCEPT
+		{
+			output[index] = input;
+		}
+
+		inline void RTM_SIMD_CALL quat_batch_store(quatf_arg0 input, const float4f_soa& output, uint32_t index) RTM_NO_EXCEPT
+		{
+			output.x[index] = quat_get_x(input);
+			output.y[index] = quat_get_y(input);
+			output.z[index] = quat_get_z(input);
+			output.w[index] = quat_get_w(input);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Matrix array accessors used by the batch conversions, only the rotation part is used.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename matrix_type>
+		inline matrix3x3f_soa4 matrix_batch_load_rotation4(const matrix_type* input, uint32_t index) RTM_NO_EXCEPT
+		{
+			matrix3x3f_soa4 result;
+			vector4f unused;
+
+			result.x_axis[0] = input[index + 0].x_axis;
+			result.x_axis[1] = input[index + 1].x_axis;
+			result.x_axis[2] = input[index + 2].x_axis;
+			unused = input[index + 3].x_axis;
+			vector_transpose4x4(result.x_axis[0], result.x_axis[1], result.x_axis[2], unused);
+
+			result.y_axis[0] = input[index + 0].y_axis;
+			result.y_axis[1] = input[index + 1].y_axis;
+			result.y_axis[2] = input[index + 2].y_axis;
+			unused = input[index + 3].y_axis;
+			vector_transpose4x4(result.y_axis[0], result.y_axis[1], result.y_axis[2], unused);
+
+			result.z_axis[0] = input[index + 0].z_axis;
+			result.z_axis[1] = input[index + 1].z_axis;
+			result.z_axis[2] = input[index + 2].z_axis;
+			unused = input[index + 3].z_axis;
+			vector_transpose4x4(result.z_axis[0], result.z_axis[1], result.z_axis[2], unused);
+
+			return result;
+		}
+
+		inline void RTM_SIMD_CALL matrix_batch_store_rotation(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, matrix3x3f& output) RTM_NO_EXCEPT
+		{
+			output.x_axis = x_axis;
+			output.y_axis = y_axis;
+			output.z_axis = z_axis;
+		}
+
+		inline void RTM_SIMD_CALL matrix_batch_store_rotation(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, matrix3x4f& output) RTM_NO_EXCEPT
+		{
+			output.x_axis = x_axis;
+			output.y_axis = y_axis;
+			output.z_axis = z_axis;
+			output.w_axis = vector_zero();
+		}
+
+		template<typename matrix_type>
+		inline void matrix_batch_store_rotation4(const matrix3x3f_soa4& input, matrix_type* output, uint32_t index) RTM_NO_EXCEPT
+		{
+			vector4f x_axis0 = input.x_axis[0];
+			vector4f x_axis1 = input.x_axis[1];
+			vector4f x_axis2 = input.x_axis[2];
+			vector4f x_axis3 = vector_zero();
+			vector_transpose4x4(x_axis0, x_axis1, x_axis2, x_axis3);
+
+			vector4f y_axis0 = input.y_axis[0];
+			vector4f y_axis1 = input.y_axis[1];
+			vector4f y_axis2 = input.y_axis[2];
+			vector4f y_axis3 = vector_zero();
+			vector_transpose4x4(y_axis0, y_axis1, y_axis2, y_axis3);
+
+			vector4f z_axis0 = input.z_axis[0];
+			vector4f z_axis1 = input.z_axis[1];
+			vector4f z_axis2 = input.z_axis[2];
+			vector4f z_axis3 = vector_zero();
+			vector_transpose4x4(z_axis0, z_axis1, z_axis2, z_axis3);
+
+			matrix_batch_store_rotation(x_axis0, y_axis0, z_axis0, output[index + 0]);
+			matrix_batch_store_rotation(x_axis1, y_axis1, z_axis1, output[index + 1]);
+			matrix_batch_store_rotation(x_axis2, y_axis2, z_axis2, output[index + 2]);
+			matrix_batch_store_rotation(x_axis3, y_axis3, z_axis3, output[index + 3]);
+		}
+
+		template<typename quat_input_type, typename matrix_type>
+		inline void matrix_from_quat_batch_impl(const quat_input_type& input, matrix_type* output, uint32_t num_quats) RTM_NO_EXCEPT
+		{
+			uint32_t quat_index = 0;
+			for (; quat_index + 4 <= num_quats; quat_index += 4)
+			{
+				vector4f quat_x;
+				vector4f quat_y;
+				vector4f quat_z;
+				vector4f quat_w;
+				quat_batch_load4(input, quat_index, quat_x, quat_y, quat_z, quat_w);
+
+				matrix_batch_store_rotation4(matrix_from_quat_soa4(quat_x, quat_y, quat_z, quat_w), output, quat_index);
+			}
+
+			for (; quat_index < num_quats; ++quat_index)
+				output[quat_index] = matrix_from_quat(quat_batch_load(input, quat_index));
+		}
+
+		template<typename matrix_type, typename quat_output_type>
+		inline void quat_from_matrix_batch_impl(const matrix_type* input, const quat_output_type& output, uint32_t num_matrices) RTM_NO_EXCEPT
+		{
+			uint32_t matrix_index = 0;
+			for (; matrix_index + 4 <= num_matrices; matrix_index += 4)
+			{
+				vector4f quat_x;
+				vector4f quat_y;
+				vector4f quat_z;
+				vector4f quat_w;
+				quat_from_matrix_soa4(matrix_batch_load_rotation4(input, matrix_index), quat_x, quat_y, quat_z, quat_w);
+
+				quat_batch_store4(quat_x, quat_y, quat_z, quat_w, output, matrix_index);
+			}
+
+			for (; matrix_index < num_matrices; ++matrix_index)
+				quat_batch_store(quat_from_matrix(input[matrix_index]), output, matrix_index);
+		}
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 4 quaternion pairs stored as structure of arrays like quat_mul.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_mul_soa4(
+			vector4f_arg0 lhs_x, vector4f_arg1 lhs_y, vector4f_arg2 lhs_z, vector4f_arg3 lhs_w,
+			vector4f_arg4 rhs_x, vector4f_arg5 rhs_y, vector4f_arg6 rhs_z, vector4f_arg7 rhs_w,
+			vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			out_x = vector_neg_mul_sub(rhs_z, lhs_y, vector_mul_add(rhs_y, lhs_z, vector_mul_add(rhs_x, lhs_w, vector_mul(rhs_w, lhs_x))));
+			out_y = vector_mul_add(rhs_z, lhs_x, vector_mul_add(rhs_y, lhs_w, vector_neg_mul_sub(rhs_x, lhs_z, vector_mul(rhs_w, lhs_y))));
+			out_z = vector_mul_add(rhs_z, lhs_w, vector_neg_mul_sub(rhs_y, lhs_x, vector_mul_add(rhs_x, lhs_y, vector_mul(rhs_w, lhs_z))));
+			out_w = vector_neg_mul_sub(rhs_z, lhs_z, vector_neg_mul_sub(rhs_y, lhs_y, vector_neg_mul_sub(rhs_x, lhs_x, vector_mul(rhs_w, lhs_w))));
+		}
+
+#if defined(RTM_AVX512_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 16 quaternion pairs stored as structure of arrays, see quat_mul_soa4.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_mul_soa16(
+			__m512 lhs_x, __m512 lhs_y, __m512 lhs_z, __m512 lhs_w,
+			__m512 rhs_x, __m512 rhs_y, __m512 rhs_z, __m512 rhs_w,
+			__m512& out_x, __m512& out_y, __m512& out_z, __m512& out_w) RTM_NO_EXCEPT
+		{
+			out_x = batch_avx512_neg_mul_sub(rhs_z, lhs_y, batch_avx512_mul_add(rhs_y, lhs_z, batch_avx512_mul_add(rhs_x, lhs_w, _mm512_mul_ps(rhs_w, lhs_x))));
+			out_y = batch_avx512_mul_add(rhs_z, lhs_x, batch_avx512_mul_add(rhs_y, lhs_w, batch_avx512_neg_mul_sub(rhs_x, lhs_z, _mm512_mul_ps(rhs_w, lhs_y))));
+			out_z = batch_avx512_mul_add(rhs_z, lhs_w, batch_avx512_neg_mul_sub(rhs_y, lhs_x, batch_avx512_mul_add(rhs_x, lhs_y, _mm512_mul_ps(rhs_w, lhs_z))));
+			out_w = batch_avx512_neg_mul_sub(rhs_z, lhs_z, batch_avx512_neg_mul_sub(rhs_y, lhs_y, batch_avx512_neg_mul_sub(rhs_x, lhs_x, _mm512_mul_ps(rhs_w, lhs_w))));
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_quats' quaternion pairs stored as structure of arrays.
+	// Each pair follows the same convention as quat_mul: lhs[i] is applied first,
+	// then rhs[i]. The output can safely alias either input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_mul_soa(const const_float4f_soa& lhs, const const_float4f_soa& rhs, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_mul_soa", num_quats, num_quats * sizeof(float) * 12);
+		uint32_t quat_index = 0;
+
+#if defined(RTM_SVE_INTRINSICS)
+		// The last iteration is predicated, no quaternion is left for the loops below
+		for (; quat_index < num_quats; quat_index += rtm_impl::batch_sve_num_lanes())
+		{
+			const svbool_t pg = svwhilelt_b32(quat_index, num_quats);
+
+			const svfloat32_t lhs_x = svld1_f32(pg, lhs.x + quat_index);
+			const svfloat32_t lhs_y = svld1_f32(pg, lhs.y + quat_index);
+			const svfloat32_t lhs_z = svld1_f32(pg, lhs.z + quat_index);
+			const svfloat32_t lhs_w = svld1_f32(pg, lhs.w + quat_index);
+
+			const svfloat32_t rhs_x = svld1_f32(pg, rhs.x + quat_index);
+			const svfloat32_t rhs_y = svld1_f32(pg, rhs.y + quat_index);
+			const svfloat32_t rhs_z = svld1_f32(pg, rhs.z + quat_index);
+			const svfloat32_t rhs_w = svld1_f32(pg, rhs.w + quat_index);
+
+			const svfloat32_t x = svmls_f32_x(pg, svmla_f32_x(pg, svmla_f32_x(pg, svmul_f32_x(pg, rhs_w, lhs_x), rhs_x, lhs_w), rhs_y, lhs_z), rhs_z, lhs_y);
+			const svfloat32_t y = svmla_f32_x(pg, svmla_f32_x(pg, svmls_f32_x(pg, svmul_f32_x(pg, rhs_w, lhs_y), rhs_x, lhs_z), rhs_y, lhs_w), rhs_z, lhs_x);
+			const svfloat32_t z = svmla_f32_x(pg, svmls_f32_x(pg, svmla_f32_x(pg, svmul_f32_x(pg, rhs_w, lhs_z), rhs_x, lhs_y), rhs_y, lhs_x), rhs_z, lhs_w);
+			const svfloat32_t w = svmls_f32_x(pg, svmls_f32_x(pg, svmls_f32_x(pg, svmul_f32_x(pg, rhs_w, lhs_w), rhs_x, lhs_x), rhs_y, lhs_y), rhs_z, lhs_z);
+
+			svst1_f32(pg, output.x + quat_index, x);
+			svst1_f32(pg, output.y + quat_index, y);
+			svst1_f32(pg, output.z + quat_index, z);
+			svst1_f32(pg, output.w + quat_index, w);
+		}
+#elif defined(RTM_AVX512_INTRINSICS)
+		// 16 quaternions per iteration, the last one is masked: no quaternion is left for the loops below
+		for (; quat_index < num_quats; quat_index += 16)
+		{
+			const __mmask16 mask = rtm_impl::batch_avx512_mask(num_quats - quat_index);
+
+			const __m512 lhs_x = _mm512_maskz_loadu_ps(mask, lhs.x + quat_index);
+			const __m512 lhs_y = _mm512_maskz_loadu_ps(mask, lhs.y + quat_index);
+			const __m512 lhs_z = _mm512_maskz_loadu_ps(mask, lhs.z + quat_index);
+			const __m512 lhs_w = _mm512_maskz_loadu_ps(mask, lhs.w + quat_index);
+
+			const __m512 rhs_x = _mm512_maskz_loadu_ps(mask, rhs.x + quat_index);
+			const __m512 rhs_y = _mm512_maskz_loadu_ps(mask, rhs.y + quat_index);
+			const __m512 rhs_z = _mm512_maskz_loadu_ps(mask, rhs.z + quat_index);
+			const __m512 rhs_w = _mm512_maskz_loadu_ps(mask, rhs.w + quat_index);
+
+			__m512 x, y, z, w;
+			rtm_impl::quat_mul_soa16(lhs_x, lhs_y, lhs_z, lhs_w, rhs_x, rhs_y, rhs_z, rhs_w, x, y, z, w);
+
+			_mm512_mask_storeu_ps(output.x + quat_index, mask, x);
+			_mm512_mask_storeu_ps(output.y + quat_index, mask, y);
+			_mm512_mask_storeu_ps(output.z + quat_index, mask, z);
+			_mm512_mask_storeu_ps(output.w + quat_index, mask, w);
+		}
+#elif defined(RTM_AVX_INTRINSICS)
+		// With AVX, a quat8f holds each component in a single register
+		for (; quat_index + 8 <= num_quats; quat_index += 8)
+		{
+			const quat8f lhs8 = quat8_load(lhs, quat_index);
+			const quat8f rhs8 = quat8_load(rhs, quat_index);
+			quat_store(quat_mul(lhs8, rhs8), output, quat_index);
+		}
+#endif
+
+		// Each vector4f holds the same component of 4 consecutive quaternions, no swizzling is required
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			const vector4f lhs_x = vector_load(lhs.x + quat_index);
+			const vector4f lhs_y = vector_load(lhs.y + quat_index);
+			const vector4f lhs_z = vector_load(lhs.z + quat_index);
+			const vector4f lhs_w = vector_load(lhs.w + quat_index);
+
+			const vector4f rhs_x = vector_load(rhs.x + quat_index);
+			const vector4f rhs_y = vector_load(rhs.y + quat_index);
+			const vector4f rhs_z = vector_load(rhs.z + quat_index);
+			const vector4f rhs_w = vector_load(rhs.w + quat_index);
+
+			vector4f x, y, z, w;
+			rtm_impl::quat_mul_soa4(lhs_x, lhs_y, lhs_z, lhs_w, rhs_x, rhs_y, rhs_z, rhs_w, x, y, z, w);
+
+			vector_store(x, output.x + quat_index);
+			vector_store(y, output.y + quat_index);
+			vector_store(z, output.z + quat_index);
+			vector_store(w, output.w + quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+		{
+			const float lhs_x = lhs.x[quat_index];
+			const float lhs_y = lhs.y[quat_index];
+			const float lhs_z = lhs.z[quat_index];
+			const float lhs_w = lhs.w[quat_index];
+
+			const float rhs_x = rhs.x[quat_index];
+			const float rhs_y = rhs.y[quat_index];
+			const float rhs_z = rhs.z[quat_index];
+			const float rhs_w = rhs.w[quat_index];
+
+			output.x[quat_index] = (rhs_w * lhs_x) + (rhs_x * lhs_w) + (rhs_y * lhs_z) - (rhs_z * lhs_y);
+			output.y[quat_index] = (rhs_w * lhs_y) - (rhs_x * lhs_z) + (rhs_y * lhs_w) + (rhs_z * lhs_x);
+			output.z[quat_index] = (rhs_w * lhs_z) + (rhs_x * lhs_y) - (rhs_y * lhs_x) + (rhs_z * lhs_w);
+			output.w[quat_index] = (rhs_w * lhs_w) - (rhs_x * lhs_x) - (rhs_y * lhs_y) - (rhs_z * lhs_z);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Linearly interpolates 'num_quats' quaternion pairs stored as structure of arrays,
+	// each pair with its own alpha value: output[i] = quat_lerp(start[i], end[i], alphas[i]).
+	// Like quat_lerp, the 'end' rotation is flipped when needed and the result is normalized.
+	// Dot products and lengths are computed lane-wise, no horizontal shuffling is required.
+	// The output can safely alias either input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_lerp_soa(const const_float4f_soa& start, const const_float4f_soa& end, const float* alphas, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_lerp_soa", num_quats, num_quats * sizeof(float) * 13);
+		uint32_t quat_index = 0;
+
+#if defined(RTM_SVE_INTRINSICS)
+		// The last iteration is predicated, no quaternion is left for the loops below
+		for (; quat_index < num_quats; quat_index += rtm_impl::batch_sve_num_lanes())
+		{
+			const svbool_t pg = svwhilelt_b32(quat_index, num_quats);
+
+			const svfloat32_t start_x = svld1_f32(pg, start.x + quat_index);
+			const svfloat32_t start_y = svld1_f32(pg, start.y + quat_index);
+			const svfloat32_t start_z = svld1_f32(pg, start.z + quat_index);
+			const svfloat32_t start_w = svld1_f32(pg, start.w + quat_index);
+
+			const svfloat32_t end_x = svld1_f32(pg, end.x + quat_index);
+			const svfloat32_t end_y = svld1_f32(pg, end.y + quat_index);
+			const svfloat32_t end_z = svld1_f32(pg, end.z + quat_index);
+			const svfloat32_t end_w = svld1_f32(pg, end.w + quat_index);
+
+			const svfloat32_t alpha = svld1_f32(pg, alphas + quat_index);
+
+			// If the dot product is negative, we flip the 'end' rotation by negating its alpha
+			const svfloat32_t dot = svmla_f32_x(pg, svmla_f32_x(pg, svmla_f32_x(pg, svmul_f32_x(pg, start_x, end_x), start_y, end_y), start_z, end_z), start_w, end_w);
+			const svfloat32_t end_alpha = svneg_f32_m(alpha, svcmplt_n_f32(pg, dot, 0.0F), alpha);
+
+			// (start - alpha * start) + (end_alpha * end)
+			const svfloat32_t x = svmla_f32_x(pg, svmls_f32_x(pg, start_x, start_x, alpha), end_x, end_alpha);
+			const svfloat32_t y = svmla_f32_x(pg, svmls_f32_x(pg, start_y, start_y, alpha), end_y, end_alpha);
+			const svfloat32_t z = svmla_f32_x(pg, svmls_f32_x(pg, start_z, start_z, alpha), end_z, end_alpha);
+			const svfloat32_t w = svmla_f32_x(pg, svmls_f32_x(pg, start_w, start_w, alpha), end_w, end_alpha);
+
+			const svfloat32_t length_squared = svmla_f32_x(pg, svmla_f32_x(pg, svmla_f32_x(pg, svmul_f32_x(pg, x, x), y, y), z, z), w, w);
+			const svfloat32_t length_reciprocal = rtm_impl::batch_sqrt_reciprocal<normalize_precision::exact>(pg, length_squared);
+
+			svst1_f32(pg, output.x + quat_index, svmul_f32_x(pg, x, length_reciprocal));
+			svst1_f32(pg, output.y + quat_index, svmul_f32_x(pg, y, length_reciprocal));
+			svst1_f32(pg, output.z + quat_index, svmul_f32_x(pg, z, length_reciprocal));
+			svst1_f32(pg, output.w + quat_index, svmul_f32_x(pg, w, length_reciprocal));
+		}
+#elif defined(RTM_AVX_INTRINSICS)
+		for (; quat_index + 8 <= num_quats; quat_index += 8)
+		{
+			const quat8f start8 = quat8_load(start, quat_index);
+			const quat8f end8 = quat8_load(end, quat_index);
+			const vector8f alpha8 = vector8_load(alphas + quat_index);
+			quat_store(quat_lerp(start8, end8, alpha8), output, quat_index);
+		}
+#endif
+
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			const vector4f start_x = vector_load(start.x + quat_index);
+			const vector4f start_y = vector_load(start.y + quat_index);
+			const vector4f start_z = vector_load(start.z + quat_index);
+			const vector4f start_w = vector_load(start.w + quat_index);
+
+			const vector4f end_x = vector_load(end.x + quat_index);
+			const vector4f end_y = vector_load(end.y + quat_index);
+			const vector4f end_z = vector_load(end.z + quat_index);
+			const vector4f end_w = vector_load(end.w + quat_index);
+
+			const vector4f alpha = vector_load(alphas + quat_index);
+
+			// If the dot product is negative, we flip the 'end' rotation by negating its alpha
+			const vector4f dot = vector_mul_add(start_w, end_w, vector_mul_add(start_z, end_z, vector_mul_add(start_y, end_y, vector_mul(start_x, end_x))));
+			const mask4f is_negative = vector_less_than(dot, vector_zero());
+			const vector4f end_alpha = vector_select(is_negative, vector_neg(alpha), alpha);
+
+			// ((1.0 - alpha) * start) + (end_alpha * end) == (start - alpha * start) + (end_alpha * end)
+			const vector4f x = vector_mul_add(end_x, end_alpha, vector_neg_mul_sub(start_x, alpha, start_x));
+			const vector4f y = vector_mul_add(end_y, end_alpha, vector_neg_mul_sub(start_y, alpha, start_y));
+			const vector4f z = vector_mul_add(end_z, end_alpha, vector_neg_mul_sub(start_z, alpha, start_z));
+			const vector4f w = vector_mul_add(end_w, end_alpha, vector_neg_mul_sub(start_w, alpha, start_w));
+
+			const vector4f length_squared = vector_mul_add(w, w, vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x))));
+			const vector4f length_reciprocal = vector_reciprocal(vector_sqrt(length_squared));
+
+			vector_store(vector_mul(x, length_reciprocal), output.x + quat_index);
+			vector_store(vector_mul(y, length_reciprocal), output.y + quat_index);
+			vector_store(vector_mul(z, length_reciprocal), output.z + quat_index);
+			vector_store(vector_mul(w, length_reciprocal), output.w + quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+		{
+			const quatf start_q = quat_set(start.x[quat_index], start.y[quat_index], start.z[quat_index], start.w[quat_index]);
+			const quatf end_q = quat_set(end.x[quat_index], end.y[quat_index], end.z[quat_index], end.w[quat_index]);
+			const quatf result = quat_lerp(start_q, end_q, alphas[quat_index]);
+
+			output.x[quat_index] = quat_get_x(result);
+			output.y[quat_index] = quat_get_y(result);
+			output.z[quat_index] = quat_get_z(result);
+			output.w[quat_index] = quat_get_w(result);
+		}
+	}
+
+	namespace rtm_impl
+	{
+		template<normalize_precision precision>
+		inline void quat_normalize_soa_impl(const const_float4f_soa& input, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+		{
+			uint32_t quat_index = 0;
+
+#if defined(RTM_SVE_INTRINSICS)
+			// The last iteration is predicated, no quaternion is left for the loops below
+			for (; quat_index < num_quats; quat_index += batch_sve_num_lanes())
+			{
+				const svbool_t pg = svwhilelt_b32(quat_index, num_quats);
+
+				const svfloat32_t x = svld1_f32(pg, input.x + quat_index);
+				const svfloat32_t y = svld1_f32(pg, input.y + quat_index);
+				const svfloat32_t z = svld1_f32(pg, input.z + quat_index);
+				const svfloat32_t w = svld1_f32(pg, input.w + quat_index);
+
+				const svfloat32_t length_squared = svmla_f32_x(pg, svmla_f32_x(pg, svmla_f32_x(pg, svmul_f32_x(pg, x, x), y, y), z, z), w, w);
+				const svfloat32_t length_reciprocal = batch_sqrt_reciprocal<precision>(pg, length_squared);
+
+				svst1_f32(pg, output.x + quat_index, svmul_f32_x(pg, x, length_reciprocal));
+				svst1_f32(pg, output.y + quat_index, svmul_f32_x(pg, y, length_reciprocal));
+				svst1_f32(pg, output.z + quat_index, svmul_f32_x(pg, z, length_reciprocal));
+				svst1_f32(pg, output.w + quat_index, svmul_f32_x(pg, w, length_reciprocal));
+			}
+#elif defined(RTM_AVX_INTRINSICS)
+			for (; quat_index + 8 <= num_quats; quat_index += 8)
+			{
+				const quat8f input8 = quat8_load(input, quat_index);
+
+				const vector8f length_squared = vector_mul_add(input8.w, input8.w, vector_mul_add(input8.z, input8.z, vector_mul_add(input8.y, input8.y, vector_mul(input8.x, input8.x))));
+				const vector8f length_reciprocal = batch_sqrt_reciprocal<precision>(length_squared);
+
+				vector_store(vector_mul(input8.x, length_reciprocal), output.x + quat_index);
+				vector_store(vector_mul(input8.y, length_reciprocal), output.y + quat_index);
+				vector_store(vector_mul(input8.z, length_reciprocal), output.z + quat_index);
+				vector_store(vector_mul(input8.w, length_reciprocal), output.w + quat_index);
+			}
+#endif
+
+			for (; quat_index + 4 <= num_quats; quat_index += 4)
+			{
+				const vector4f x = vector_load(input.x + quat_index);
+				const vector4f y = vector_load(input.y + quat_index);
+				const vector4f z = vector_load(input.z + quat_index);
+				const vector4f w = vector_load(input.w + quat_index);
+
+				const vector4f length_squared = vector_mul_add(w, w, vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x))));
+				const vector4f length_reciprocal = batch_sqrt_reciprocal<precision>(length_squared);
+
+				vector_store(vector_mul(x, length_reciprocal), output.x + quat_index);
+				vector_store(vector_mul(y, length_reciprocal), output.y + quat_index);
+				vector_store(vector_mul(z, length_reciprocal), output.z + quat_index);
+				vector_store(vector_mul(w, length_reciprocal), output.w + quat_index);
+			}
+
+			// The remaining quaternions use the same reciprocal square root as the wide loops
+			for (; quat_index < num_quats; ++quat_index)
+			{
+				const float x = input.x[quat_index];
+				const float y = input.y[quat_index];
+				const float z = input.z[quat_index];
+				const float w = input.w[quat_index];
+
+				const float length_squared = (x * x) + (y * y) + (z * z) + (w * w);
+				const float length_reciprocal = vector_get_x(batch_sqrt_reciprocal<precision>(vector_set(length_squared)));
+
+				output.x[quat_index] = x * length_reciprocal;
+				output.y[quat_index] = y * length_reciprocal;
+				output.z[quat_index] = z * length_reciprocal;
+				output.w[quat_index] = w * length_reciprocal;
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Normalizes 'num_quats' quaternions stored as structure of arrays.
+	// Lengths are computed lane-wise, no horizontal shuffling is required.
+	// The precision controls how the reciprocal length is calculated, see normalize_precision.
+	// The output can safely alias the input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_normalize_soa(const const_float4f_soa& input, const float4f_soa& output, uint32_t num_quats, normalize_precision precision = normalize_precision::exact) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_normalize_soa", num_quats, num_quats * sizeof(float) * 8);
+		switch (precision)
+		{
+		case normalize_precision::estimate:
+			rtm_impl::quat_normalize_soa_impl<normalize_precision::estimate>(input, output, num_quats);
+			break;
+		case normalize_precision::refined:
+			rtm_impl::quat_normalize_soa_impl<normalize_precision::refined>(input, output, num_quats);
+			break;
+		case normalize_precision::exact:
+		default:
+			rtm_impl::quat_normalize_soa_impl<normalize_precision::exact>(input, output, num_quats);
+			break;
+		}
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Spherically interpolates 4 quaternion pairs stored as structure of arrays like quat_slerp_fast.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_slerp_fast_soa4(
+			vector4f_arg0 start_x, vector4f_arg1 start_y, vector4f_arg2 start_z, vector4f_arg3 start_w,
+			vector4f_arg4 end_x, vector4f_arg5 end_y, vector4f_arg6 end_z, vector4f_arg7 end_w,
+			vector4f_argn alpha,
+			vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			const vector4f one = vector_set(1.0F);
+
+			// The dot product is lane-wise, if it is negative we flip the 'end' rotation by negating its weight
+			const vector4f cos_half_angle = vector_mul_add(start_w, end_w, vector_mul_add(start_z, end_z, vector_mul_add(start_y, end_y, vector_mul(start_x, end_x))));
+			const mask4f is_angle_negative = vector_less_than(cos_half_angle, vector_zero());
+			const vector4f cos_half_angle_minus_one = vector_sub(vector_abs(cos_half_angle), one);
+
+			const vector4f start_weight = quat_slerp_fast_weights(vector_sub(one, alpha), cos_half_angle_minus_one);
+			vector4f end_weight = quat_slerp_fast_weights(alpha, cos_half_angle_minus_one);
+			end_weight = vector_select(is_angle_negative, vector_neg(end_weight), end_weight);
+
+			out_x = vector_mul_add(end_x, end_weight, vector_mul(start_x, start_weight));
+			out_y = vector_mul_add(end_y, end_weight, vector_mul(start_y, start_weight));
+			out_z = vector_mul_add(end_z, end_weight, vector_mul(start_z, start_weight));
+			out_w = vector_mul_add(end_w, end_weight, vector_mul(start_w, start_weight));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Spherically interpolates 'num_quats' quaternion pairs stored as structure of arrays,
+	// each pair with its own alpha value: output[i] = quat_slerp_fast(start[i], end[i], alphas[i]).
+	// The weights are evaluated with a polynomial, see quat_slerp_fast for its error bound.
+	// The output can safely alias either input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_slerp_fast_soa(const const_float4f_soa& start, const const_float4f_soa& end, const float* alphas, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_slerp_fast_soa", num_quats, num_quats * sizeof(float) * 13);
+		uint32_t quat_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+		for (; quat_index + 8 <= num_quats; quat_index += 8)
+		{
+			const quat8f start8 = quat8_load(start, quat_index);
+			const quat8f end8 = quat8_load(end, quat_index);
+			const vector8f alpha8 = vector8_load(alphas + quat_index);
+			quat_store(quat_slerp_fast(start8, end8, alpha8), output, quat_index);
+		}
+#endif
+
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			const vector4f start_x = vector_load(start.x + quat_index);
+			const vector4f start_y = vector_load(start.y + quat_index);
+			const vector4f start_z = vector_load(start.z + quat_index);
+			const vector4f start_w = vector_load(start.w + quat_index);
+
+			const vector4f end_x = vector_load(end.x + quat_index);
+			const vector4f end_y = vector_load(end.y + quat_index);
+			const vector4f end_z = vector_load(end.z + quat_index);
+			const vector4f end_w = vector_load(end.w + quat_index);
+
+			const vector4f alpha = vector_load(alphas + quat_index);
+
+			vector4f x, y, z, w;
+			rtm_impl::quat_slerp_fast_soa4(start_x, start_y, start_z, start_w, end_x, end_y, end_z, end_w, alpha, x, y, z, w);
+
+			vector_store(x, output.x + quat_index);
+			vector_store(y, output.y + quat_index);
+			vector_store(z, output.z + quat_index);
+			vector_store(w, output.w + quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+		{
+			const quatf start_q = quat_set(start.x[quat_index], start.y[quat_index], start.z[quat_index], start.w[quat_index]);
+			const quatf end_q = quat_set(end.x[quat_index], end.y[quat_index], end.z[quat_index], end.w[quat_index]);
+			const quatf result = quat_slerp_fast(start_q, end_q, alphas[quat_index]);
+
+			output.x[quat_index] = quat_get_x(result);
+			output.y[quat_index] = quat_get_y(result);
+			output.z[quat_index] = quat_get_z(result);
+			output.w[quat_index] = quat_get_w(result);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Normalizes 'num_quats' quaternions stored as structure of arrays.
+	// The reciprocal length is calculated with the policy normalize_precision,
+	// selected at compile time, see precision::fast, precision::standard, and precision::exact.
+	// The output can safely alias the input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline void quat_normalize_soa(const const_float4f_soa& input, const float4f_soa& output, uint32_t num_quats, precision_policy) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_normalize_soa", num_quats, num_quats * sizeof(float) * 8);
+		rtm_impl::quat_normalize_soa_impl<precision_policy::normalize>(input, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interpolates 'num_quats' quaternion pairs stored as structure of arrays, each pair with
+	// its own alpha value: output[i] = quat_interpolate(start[i], end[i], alphas[i], policy).
+	// The policy rotation_interpolation selects quat_lerp_soa, quat_slerp_fast_soa, or quat_slerp
+	// at compile time. quat_slerp has no wide variant and is evaluated one pair at a time.
+	// The output can safely alias either input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline void quat_interpolate_soa(const const_float4f_soa& start, const const_float4f_soa& end, const float* alphas, const float4f_soa& output, uint32_t num_quats, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::interpolation == rotation_interpolation::lerp>::test())
+		{
+			quat_lerp_soa(start, end, alphas, output, num_quats);
+		}
+		else if (rtm_impl::static_condition<precision_policy::interpolation == rotation_interpolation::slerp_fast>::test())
+		{
+			quat_slerp_fast_soa(start, end, alphas, output, num_quats);
+		}
+		else
+		{
+			RTM_PROFILE_SCOPE("rtm::quat_slerp_soa", num_quats, num_quats * sizeof(float) * 13);
+			for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+			{
+				const quatf start_q = quat_set(start.x[quat_index], start.y[quat_index], start.z[quat_index], start.w[quat_index]);
+				const quatf end_q = quat_set(end.x[quat_index], end.y[quat_index], end.z[quat_index], end.w[quat_index]);
+				const quatf result = quat_slerp(start_q, end_q, alphas[quat_index]);
+
+				output.x[quat_index] = quat_get_x(result);
+				output.y[quat_index] = quat_get_y(result);
+				output.z[quat_index] = quat_get_z(result);
+				output.w[quat_index] = quat_get_w(result);
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_quats' rotation quaternions into rotation matrices like matrix_from_quat.
+	// Quaternions are processed 4 at a time, they must be normalized.
+	// Any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_from_quat_aos(const quatf* input, matrix3x3f* output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_from_quat_aos", num_quats, num_quats * (sizeof(quatf) + sizeof(matrix3x3f)));
+		rtm_impl::matrix_from_quat_batch_impl(input, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_quats' rotation quaternions into rotation matrices like matrix_from_quat.
+	// The translation of each output matrix is zero.
+	// Quaternions are processed 4 at a time, they must be normalized.
+	// Any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_from_quat_aos(const quatf* input, matrix3x4f* output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_from_quat_aos", num_quats, num_quats * (sizeof(quatf) + sizeof(matrix3x4f)));
+		rtm_impl::matrix_from_quat_batch_impl(input, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_quats' rotation quaternions stored as structure of arrays into
+	// rotation matrices like matrix_from_quat.
+	// Quaternions must be normalized. Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_from_quat_soa(const const_float4f_soa& input, matrix3x3f* output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_from_quat_soa", num_quats, num_quats * (sizeof(float) * 4 + sizeof(matrix3x3f)));
+		rtm_impl::matrix_from_quat_batch_impl(input, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_quats' rotation quaternions stored as structure of arrays into
+	// rotation matrices like matrix_from_quat. The translation of each output matrix is zero.
+	// Quaternions must be normalized. Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_from_quat_soa(const const_float4f_soa& input, matrix3x4f* output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_from_quat_soa", num_quats, num_quats * (sizeof(float) * 4 + sizeof(matrix3x4f)));
+		rtm_impl::matrix_from_quat_batch_impl(input, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_matrices' 3x3 matrices into rotation quaternions like quat_from_matrix.
+	// Matrices are processed 4 at a time without branching: the pivot of every lane is
+	// selected with masks. Matrices with a zero scale axis return the identity.
+	// Any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_matrix_aos(const matrix3x3f* input, quatf* output, uint32_t num_matrices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_from_matrix_aos", num_matrices, num_matrices * (sizeof(matrix3x3f) + sizeof(quatf)));
+		rtm_impl::quat_from_matrix_batch_impl(input, output, num_matrices);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts the rotation part of 'num_matrices' 3x4 matrices into rotation quaternions
+	// like quat_from_matrix. Matrices are processed 4 at a time without branching: the pivot
+	// of every lane is selected with masks. Matrices with a zero scale axis return the identity.
+	// Any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_matrix_aos(const matrix3x4f* input, quatf* output, uint32_t num_matrices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_from_matrix_aos", num_matrices, num_matrices * (sizeof(matrix3x4f) + sizeof(quatf)));
+		rtm_impl::quat_from_matrix_batch_impl(input, output, num_matrices);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_matrices' 3x3 matrices into rotation quaternions stored as structure of arrays
+	// like quat_from_matrix. Matrices are processed 4 at a time without branching.
+	// Matrices with a zero scale axis return the identity.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_matrix_soa(const matrix3x3f* input, const float4f_soa& output, uint32_t num_matrices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_from_matrix_soa", num_matrices, num_matrices * (sizeof(matrix3x3f) + sizeof(float) * 4));
+		rtm_impl::quat_from_matrix_batch_impl(input, output, num_matrices);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts the rotation part of 'num_matrices' 3x4 matrices into rotation quaternions stored
+	// as structure of arrays like quat_from_matrix. Matrices are processed 4 at a time without branching.
+	// Matrices with a zero scale axis return the identity.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_matrix_soa(const matrix3x4f* input, const float4f_soa& output, uint32_t num_matrices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_from_matrix_soa", num_matrices, num_matrices * (sizeof(matrix3x4f) + sizeof(float) * 4));
+		rtm_impl::quat_from_matrix_batch_impl(input, output, num_matrices);
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Creates 4 shortest arc rotations stored as structure of arrays like quat_from_to.
+		// Opposite directions are selected per lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_from_to_soa4(
+			vector4f_arg0 from_x, vector4f_arg1 from_y, vector4f_arg2 from_z,
+			vector4f_arg3 to_x, vector4f_arg4 to_y, vector4f_arg5 to_z,
+			vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			const vector4f from_length_squared = vector_mul_add(from_z, from_z, vector_mul_add(from_y, from_y, vector_mul(from_x, from_x)));
+			const vector4f to_length_squared = vector_mul_add(to_z, to_z, vector_mul_add(to_y, to_y, vector_mul(to_x, to_x)));
+			const vector4f length_product = vector_sqrt(vector_mul(from_length_squared, to_length_squared));
+			const vector4f w = vector_add(length_product, vector_mul_add(from_z, to_z, vector_mul_add(from_y, to_y, vector_mul(from_x, to_x))));
+
+			const vector4f axis_x = vector_neg_mul_sub(from_z, to_y, vector_mul(from_y, to_z));
+			const vector4f axis_y = vector_neg_mul_sub(from_x, to_z, vector_mul(from_z, to_x));
+			const vector4f axis_z = vector_neg_mul_sub(from_y, to_x, vector_mul(from_x, to_y));
+
+			// Opposite directions rotate by pi around the same orthogonal axis as quat_from_to
+			const mask4f is_opposite = vector_less_equal(w, vector_mul(length_product, 1.0E-6F));
+			const mask4f is_x_larger = vector_greater_than(vector_abs(from_x), vector_abs(from_z));
+			const vector4f zero = vector_zero();
+			const vector4f half_turn_x = vector_select(is_x_larger, vector_neg(from_y), zero);
+			const vector4f half_turn_y = vector_select(is_x_larger, from_x, vector_neg(from_z));
+			const vector4f half_turn_z = vector_select(is_x_larger, zero, from_y);
+
+			const vector4f quat_x = vector_select(is_opposite, half_turn_x, axis_x);
+			const vector4f quat_y = vector_select(is_opposite, half_turn_y, axis_y);
+			const vector4f quat_z = vector_select(is_opposite, half_turn_z, axis_z);
+			const vector4f quat_w = vector_select(is_opposite, zero, w);
+
+			const vector4f quat_length_squared = vector_mul_add(quat_w, quat_w, vector_mul_add(quat_z, quat_z, vector_mul_add(quat_y, quat_y, vector_mul(quat_x, quat_x))));
+			const vector4f inv_quat_length = vector_div(vector_set(1.0F), vector_sqrt(quat_length_squared));
+
+			out_x = vector_mul(quat_x, inv_quat_length);
+			out_y = vector_mul(quat_y, inv_quat_length);
+			out_z = vector_mul(quat_z, inv_quat_length);
+			out_w = vector_mul(quat_w, inv_quat_length);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Creates 4 look rotations stored as structure of arrays like quat_look_rotation.
+		// Mirrored and parallel directions are selected per lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_look_rotation_soa4(
+			vector4f_arg0 forward_x, vector4f_arg1 forward_y, vector4f_arg2 forward_z,
+			vector4f_arg3 up_x, vector4f_arg4 up_y, vector4f_arg5 up_z,
+			vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+			const vector4f forward_length_squared = vector_mul_add(forward_z, forward_z, vector_mul_add(forward_y, forward_y, vector_mul(forward_x, forward_x)));
+			const vector4f inv_forward_length = vector_div(one, vector_sqrt(forward_length_squared));
+			const mask4f is_mirrored = vector_less_than(forward_x, zero);
+
+			const vector4f arc_x = vector_mul(vector_abs(forward_x), inv_forward_length);
+			const vector4f arc_y = vector_mul(vector_select(is_mirrored, vector_neg(forward_y), forward_y), inv_forward_length);
+			const vector4f arc_z = vector_mul(forward_z, inv_forward_length);
+			const vector4f mirrored_up_x = vector_select(is_mirrored, vector_neg(up_x), up_x);
+			const vector4f mirrored_up_y = vector_select(is_mirrored, vector_neg(up_y), up_y);
+
+			const vector4f arc_w = vector_add(one, arc_x);
+			const vector4f arc_scale = vector_div(vector_mul_add(mirrored_up_x, arc_w, vector_mul_add(mirrored_up_y, arc_y, vector_mul(up_z, arc_z))), arc_w);
+			const vector4f roll_sin = vector_sub(vector_mul(arc_y, arc_scale), mirrored_up_y);
+			const vector4f roll_cos = vector_neg_mul_sub(arc_z, arc_scale, up_z);
+
+			// Lanes where 'up' is parallel to 'forward' have no roll
+			const vector4f up_length_squared = vector_mul_add(up_z, up_z, vector_mul_add(up_y, up_y, vector_mul(up_x, up_x)));
+			const vector4f roll_length_squared = vector_mul_add(roll_cos, roll_cos, vector_mul(roll_sin, roll_sin));
+			const mask4f is_parallel = vector_less_equal(roll_length_squared, vector_mul(up_length_squared, 1.0E-8F));
+			const vector4f safe_roll_sin = vector_select(is_parallel, zero, roll_sin);
+			const vector4f safe_roll_cos = vector_select(is_parallel, one, roll_cos);
+			const vector4f roll_length = vector_select(is_parallel, one, vector_sqrt(roll_length_squared));
+
+			const mask4f is_roll_forward = vector_greater_equal(safe_roll_cos, zero);
+			const vector4f roll_x = vector_select(is_roll_forward, safe_roll_sin, vector_sub(roll_length, safe_roll_cos));
+			const vector4f roll_w = vector_select(is_roll_forward, vector_add(roll_length, safe_roll_cos), safe_roll_sin);
+
+			const vector4f x = vector_mul(arc_w, roll_x);
+			const vector4f y = vector_neg_mul_sub(arc_z, roll_w, vector_mul(arc_y, roll_x));
+			const vector4f z = vector_mul_add(arc_y, roll_w, vector_mul(arc_z, roll_x));
+			const vector4f w = vector_mul(arc_w, roll_w);
+
+			const vector4f quat_x = vector_select(is_mirrored, vector_neg(y), x);
+			const vector4f quat_y = vector_select(is_mirrored, x, y);
+			const vector4f quat_z = vector_select(is_mirrored, w, z);
+			const vector4f quat_w = vector_select(is_mirrored, vector_neg(z), w);
+
+			const vector4f quat_length_squared = vector_mul_add(quat_w, quat_w, vector_mul_add(quat_z, quat_z, vector_mul_add(quat_y, quat_y, vector_mul(quat_x, quat_x))));
+			const vector4f inv_quat_length = vector_div(one, vector_sqrt(quat_length_squared));
+
+			out_x = vector_mul(quat_x, inv_quat_length);
+			out_y = vector_mul(quat_y, inv_quat_length);
+			out_z = vector_mul(quat_z, inv_quat_length);
+			out_w = vector_mul(quat_w, inv_quat_length);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates 'num_quats' shortest arc rotations stored as structure of arrays, each rotating
+	// its 'from' direction onto its 'to' direction: output[i] = quat_from_to(from[i], to[i]).
+	// The directions must have a non-zero length but they do not need to be normalized.
+	// No trigonometry is required and opposite directions are handled per lane without branching.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_to_soa(const const_float3f_soa& from, const const_float3f_soa& to, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_from_to_soa", num_quats, num_quats * sizeof(float) * 10);
+
+		uint32_t quat_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+		// With AVX, a vector3x8f holds each component in a single register
+		for (; quat_index + 8 <= num_quats; quat_index += 8)
+			quat_store(quat_from_to(vector3x8_load(from, quat_index), vector3x8_load(to, quat_index)), output, quat_index);
+#endif
+
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			vector4f quat_x;
+			vector4f quat_y;
+			vector4f quat_z;
+			vector4f quat_w;
+			rtm_impl::quat_from_to_soa4(
+				vector_load(from.x + quat_index), vector_load(from.y + quat_index), vector_load(from.z + quat_index),
+				vector_load(to.x + quat_index), vector_load(to.y + quat_index), vector_load(to.z + quat_index),
+				quat_x, quat_y, quat_z, quat_w);
+
+			rtm_impl::quat_batch_store4(quat_x, quat_y, quat_z, quat_w, output, quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+		{
+			const vector4f from_direction = vector_set(from.x[quat_index], from.y[quat_index], from.z[quat_index]);
+			const vector4f to_direction = vector_set(to.x[quat_index], to.y[quat_index], to.z[quat_index]);
+			rtm_impl::quat_batch_store(quat_from_to(from_direction, to_direction), output, quat_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates 'num_quats' look rotations stored as structure of arrays, each rotating the X axis onto
+	// its 'forward' direction with the Z axis as close to its 'up' direction as possible:
+	// output[i] = quat_look_rotation(forward[i], up[i]).
+	// Directions do not need to be normalized and 'up' does not need to be orthogonal to 'forward'.
+	// No trigonometry is required and every lane is handled without branching.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_look_rotation_soa(const const_float3f_soa& forward, const const_float3f_soa& up, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_look_rotation_soa", num_quats, num_quats * sizeof(float) * 10);
+
+		uint32_t quat_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+		for (; quat_index + 8 <= num_quats; quat_index += 8)
+			quat_store(quat_look_rotation(vector3x8_load(forward, quat_index), vector3x8_load(up, quat_index)), output, quat_index);
+#endif
+
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			vector4f quat_x;
+			vector4f quat_y;
+			vector4f quat_z;
+			vector4f quat_w;
+			rtm_impl::quat_look_rotation_soa4(
+				vector_load(forward.x + quat_index), vector_load(forward.y + quat_index), vector_load(forward.z + quat_index),
+				vector_load(up.x + quat_index), vector_load(up.y + quat_index), vector_load(up.z + quat_index),
+				quat_x, quat_y, quat_z, quat_w);
+
+			rtm_impl::quat_batch_store4(quat_x, quat_y, quat_z, quat_w, output, quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+		{
+			const vector4f forward_direction = vector_set(forward.x[quat_index], forward.y[quat_index], forward.z[quat_index]);
+			const vector4f up_direction = vector_set(up.x[quat_index], up.y[quat_index], up.z[quat_index]);
+			rtm_impl::quat_batch_store(quat_look_rotation(forward_direction, up_direction), output, quat_index);
+		}
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Below this many vectors, rotating each one with the quaternion is cheaper than
+		// building the rotation matrix first.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t k_quat_mul_vector3_matrix_threshold = 4;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the rotation matrix of a quaternion with each component broadcast in every lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix3x3f_soa4 RTM_SIMD_CALL matrix_from_quat_broadcast4(quatf_arg0 rotation) RTM_NO_EXCEPT
+		{
+			const vector4f rotation_v = quat_to_vector(rotation);
+			return matrix_from_quat_soa4(vector_dup_x(rotation_v), vector_dup_y(rotation_v), vector_dup_z(rotation_v), vector_dup_w(rotation_v));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Rotates 4 3D vectors stored as structure of arrays with a rotation matrix.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_mul_vector3_soa4(const matrix3x3f_soa4& mtx, vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, vector4f& out_x, vector4f& out_y, vector4f& out_z) RTM_NO_EXCEPT
+		{
+			out_x = vector_mul_add(z, mtx.z_axis[0], vector_mul_add(y, mtx.y_axis[0], vector_mul(x, mtx.x_axis[0])));
+			out_y = vector_mul_add(z, mtx.z_axis[1], vector_mul_add(y, mtx.y_axis[1], vector_mul(x, mtx.x_axis[1])));
+			out_z = vector_mul_add(z, mtx.z_axis[2], vector_mul_add(y, mtx.y_axis[2], vector_mul(x, mtx.x_axis[2])));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates 'num_vectors' packed 3D vectors with a single rotation: output[i] = quat_mul_vector3(input[i], rotation).
+	// With only a few vectors, each one is rotated with the quaternion. Otherwise the rotation matrix
+	// is built once and the vectors are deinterleaved and rotated 4 at a time with it.
+	// The rotation must be normalized. The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_mul_vector3_aos(const float3f* input, quatf_arg0 rotation, float3f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_mul_vector3_aos", num_vectors, num_vectors * sizeof(float3f) * 2);
+		uint32_t vector_index = 0;
+
+		if (num_vectors >= rtm_impl::k_quat_mul_vector3_matrix_threshold)
+		{
+			const rtm_impl::matrix3x3f_soa4 mtx = rtm_impl::matrix_from_quat_broadcast4(rotation);
+
+			for (; vector_index + 4 <= num_vectors; vector_index += 4)
+			{
+				vector4f x, y, z;
+				vector_deinterleave3(input + vector_index, x, y, z);
+
+				vector4f out_x, out_y, out_z;
+				rtm_impl::matrix_mul_vector3_soa4(mtx, x, y, z, out_x, out_y, out_z);
+
+				vector_interleave3(out_x, out_y, out_z, output + vector_index);
+			}
+
+			for (; vector_index < num_vectors; ++vector_index)
+			{
+				const float3f& value = input[vector_index];
+
+				vector4f out_x, out_y, out_z;
+				rtm_impl::matrix_mul_vector3_soa4(mtx, vector_set(value.x), vector_set(value.y), vector_set(value.z), out_x, out_y, out_z);
+
+				output[vector_index] = float3f{ vector_get_x(out_x), vector_get_x(out_y), vector_get_x(out_z) };
+			}
+		}
+		else
+		{
+			for (; vector_index < num_vectors; ++vector_index)
+				vector_store3(quat_mul_vector3(vector_load3(input + vector_index), rotation), output + vector_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Rotates 'num_vectors' 3D vectors stored as structure of arrays with a single rotation:
+	// output[i] = quat_mul_vector3(input[i], rotation).
+	// With only a few vectors, each one is rotated with the quaternion. Otherwise the rotation matrix
+	// is built once and the vectors are rotated 4 at a time with it (8 with AVX).
+	// The rotation must be normalized. The output can safely alias the input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_mul_vector3_soa(const const_float3f_soa& input, quatf_arg0 rotation, const float3f_soa& output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_mul_vector3_soa", num_vectors, num_vectors * sizeof(float) * 6);
+		uint32_t vector_index = 0;
+
+		if (num_vectors >= rtm_impl::k_quat_mul_vector3_matrix_threshold)
+		{
+			const rtm_impl::matrix3x3f_soa4 mtx = rtm_impl::matrix_from_quat_broadcast4(rotation);
+
+#if defined(RTM_AVX_INTRINSICS)
+			const vector8f x_axis_x = vector8_set(mtx.x_axis[0], mtx.x_axis[0]);
+			const vector8f x_axis_y = vector8_set(mtx.x_axis[1], mtx.x_axis[1]);
+			const vector8f x_axis_z = vector8_set(mtx.x_axis[2], mtx.x_axis[2]);
+			const vector8f y_axis_x = vector8_set(mtx.y_axis[0], mtx.y_axis[0]);
+			const vector8f y_axis_y = vector8_set(mtx.y_axis[1], mtx.y_axis[1]);
+			const vector8f y_axis_z = vector8_set(mtx.y_axis[2], mtx.y_axis[2]);
+			const vector8f z_axis_x = vector8_set(mtx.z_axis[0], mtx.z_axis[0]);
+			const vector8f z_axis_y = vector8_set(mtx.z_axis[1], mtx.z_axis[1]);
+			const vector8f z_axis_z = vector8_set(mtx.z_axis[2], mtx.z_axis[2]);
+
+			for (; vector_index + 8 <= num_vectors; vector_index += 8)
+			{
+				const vector8f x = vector8_load(input.x + vector_index);
+				const vector8f y = vector8_load(input.y + vector_index);
+				const vector8f z = vector8_load(input.z + vector_index);
+
+				vector_store(vector_mul_add(z, z_axis_x, vector_mul_add(y, y_axis_x, vector_mul(x, x_axis_x))), output.x + vector_index);
+				vector_store(vector_mul_add(z, z_axis_y, vector_mul_add(y, y_axis_y, vector_mul(x, x_axis_y))), output.y + vector_index);
+				vector_store(vector_mul_add(z, z_axis_z, vector_mul_add(y, y_axis_z, vector_mul(x, x_axis_z))), output.z + vector_index);
+			}
+#endif
+
+			for (; vector_index + 4 <= num_vectors; vector_index += 4)
+			{
+				vector4f out_x, out_y, out_z;
+				rtm_impl::matrix_mul_vector3_soa4(mtx, vector_load(input.x + vector_index), vector_load(input.y + vector_index), vector_load(input.z + vector_index), out_x, out_y, out_z);
+
+				vector_store(out_x, output.x + vector_index);
+				vector_store(out_y, output.y + vector_index);
+				vector_store(out_z, output.z + vector_index);
+			}
+
+			for (; vector_index < num_vectors; ++vector_index)
+			{
+				vector4f out_x, out_y, out_z;
+				rtm_impl::matrix_mul_vector3_soa4(mtx, vector_set(input.x[vector_index]), vector_set(input.y[vector_index]), vector_set(input.z[vector_index]), out_x, out_y, out_z);
+
+				output.x[vector_index] = vector_get_x(out_x);
+				output.y[vector_index] = vector_get_x(out_y);
+				output.z[vector_index] = vector_get_x(out_z);
+			}
+		}
+		else
+		{
+			for (; vector_index < num_vectors; ++vector_index)
+			{
+				const vector4f result = quat_mul_vector3(vector_set(input.x[vector_index], input.y[vector_index], input.z[vector_index]), rotation);
+
+				output.x[vector_index] = vector_get_x(result);
+				output.y[vector_index] = vector_get_y(result);
+				output.z[vector_index] = vector_get_z(result);
+			}
+		}
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the exponential of 4 pure quaternions stored as structure of arrays like quat_exp.
+		// When every half angle is small, only the polynomials are evaluated.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_exp_soa4(vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			const vector4f half_angle_sq = vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x)));
+			const vector4f max_half_angle_sq = vector_set(k_quat_exp_polynomial_max_half_angle_sq);
+
+			// sin(x) / x and cos(x) as polynomials in x^2, see quat_exp_small_angle
+			vector4f scale = vector_polynomial(half_angle_sq, 1.0F, -1.0F / 6.0F, 1.0F / 120.0F, -1.0F / 5040.0F, 1.0F / 362880.0F);
+			vector4f cos_half_angle = vector_polynomial(half_angle_sq, 1.0F, -1.0F / 2.0F, 1.0F / 24.0F, -1.0F / 720.0F, 1.0F / 40320.0F);
+
+			// Large angles are uncommon, skip the sin/cos when every lane is small
+			if (!vector_all_less_than(half_angle_sq, max_half_angle_sq))
+			{
+				const vector4f half_angle = vector_sqrt(half_angle_sq);
+
+				vector4f sin_;
+				vector4f cos_;
+				vector_sincos(half_angle, sin_, cos_);
+
+				const mask4f is_small = vector_less_than(half_angle_sq, max_half_angle_sq);
+				scale = vector_select(is_small, scale, vector_div(sin_, half_angle));
+				cos_half_angle = vector_select(is_small, cos_half_angle, cos_);
+			}
+
+			out_x = vector_mul(x, scale);
+			out_y = vector_mul(y, scale);
+			out_z = vector_mul(z, scale);
+			out_w = cos_half_angle;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Angular velocity array accessors used by the batch integration, AoS and SoA.
+		//////////////////////////////////////////////////////////////////////////
+		inline void vector3_batch_load4(const vector4f* input, uint32_t index, vector4f& out_x, vector4f& out_y, vector4f& out_z) RTM_NO_EXCEPT
+		{
+			out_x = input[index + 0];
+			out_y = input[index + 1];
+			out_z = input[index + 2];
+			vector4f unused = input[index + 3];
+			vector_transpose4x4(out_x, out_y, out_z, unused);
+		}
+
+		inline void vector3_batch_load4(const const_float3f_soa& input, uint32_t index, vector4f& out_x, vector4f& out_y, vector4f& out_z) RTM_NO_EXCEPT
+		{
+			out_x = vector_load(input.x + index);
+			out_y = vector_load(input.y + index);
+			out_z = vector_load(input.z + index);
+		}
+
+		inline vector4f vector3_batch_load(const vector4f* input, uint32_t index) RTM_NO_EXCEPT
+		{
+			return input[index];
+		}
+
+		inline vector4f vector3_batch_load(const const_float3f_soa& input, uint32_t index) RTM_NO_EXCEPT
+		{
+			return vector_set(input.x[index], input.y[index], input.z[index]);
+		}
+
+		template<typename quat_input_type, typename vector_input_type, typename quat_output_type>
+		inline void quat_integrate_batch_impl(const quat_input_type& rotations, const vector_input_type& angular_velocities, float delta_time, const quat_output_type& output, uint32_t num_quats) RTM_NO_EXCEPT
+		{
+			const vector4f half_delta_time = vector_set(delta_time * 0.5F);
+
+			uint32_t quat_index = 0;
+			for (; quat_index + 4 <= num_quats; quat_index += 4)
+			{
+				vector4f rotation_x, rotation_y, rotation_z, rotation_w;
+				quat_batch_load4(rotations, quat_index, rotation_x, rotation_y, rotation_z, rotation_w);
+
+				vector4f velocity_x, velocity_y, velocity_z;
+				vector3_batch_load4(angular_velocities, quat_index, velocity_x, velocity_y, velocity_z);
+
+				vector4f delta_x, delta_y, delta_z, delta_w;
+				quat_exp_soa4(vector_mul(velocity_x, half_delta_time), vector_mul(velocity_y, half_delta_time), vector_mul(velocity_z, half_delta_time), delta_x, delta_y, delta_z, delta_w);
+
+				vector4f x, y, z, w;
+				quat_mul_soa4(rotation_x, rotation_y, rotation_z, rotation_w, delta_x, delta_y, delta_z, delta_w, x, y, z, w);
+
+				const vector4f length_squared = vector_mul_add(w, w, vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x))));
+				const vector4f length_reciprocal = vector_reciprocal(vector_sqrt(length_squared));
+
+				quat_batch_store4(vector_mul(x, length_reciprocal), vector_mul(y, length_reciprocal), vector_mul(z, length_reciprocal), vector_mul(w, length_reciprocal), output, quat_index);
+			}
+
+			for (; quat_index < num_quats; ++quat_index)
+				quat_batch_store(quat_integrate(quat_batch_load(rotations, quat_index), vector3_batch_load(angular_velocities, quat_index), delta_time), output, quat_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the exponential of 'num_quats' pure quaternions stored as structure of arrays:
+	// output[i] = quat_exp(input[i]).
+	// Half angles below 1.0 radian use a polynomial, when 4 consecutive inputs are all
+	// below it, no square root and no sin/cos are evaluated.
+	// The results are within 2.0e-6 + 2.4e-7 * half_angle of quat_exp: the half angle is
+	// rounded to float and it can round differently here (e.g. with FMA), which shifts
+	// the sine and cosine by up to one float ulp of the half angle.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_exp_soa(const const_float3f_soa& input, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_exp_soa", num_quats, num_quats * sizeof(float) * 7);
+		uint32_t quat_index = 0;
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			vector4f x, y, z, w;
+			rtm_impl::quat_exp_soa4(vector_load(input.x + quat_index), vector_load(input.y + quat_index), vector_load(input.z + quat_index), x, y, z, w);
+			rtm_impl::quat_batch_store4(x, y, z, w, output, quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+			rtm_impl::quat_batch_store(quat_exp(vector_set(input.x[quat_index], input.y[quat_index], input.z[quat_index])), output, quat_index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the logarithm of 'num_quats' normalized quaternions stored as structure of arrays:
+	// output[i] = quat_log(input[i]), only [xyz] are written since [w] is always 0.0.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_log_soa(const const_float4f_soa& input, const float3f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_log_soa", num_quats, num_quats * sizeof(float) * 7);
+		uint32_t quat_index = 0;
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			vector4f x, y, z, w;
+			rtm_impl::quat_batch_load4(input, quat_index, x, y, z, w);
+
+			const vector4f sin_half_angle = vector_sqrt(vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x))));
+			const vector4f half_angle = vector_atan2(sin_half_angle, w);
+
+			// When the angle is small, half_angle / sin(half_angle) tends to 1.0
+			const mask4f is_small = vector_less_than(sin_half_angle, vector_set(1.0E-6F));
+			const vector4f scale = vector_select(is_small, vector_set(1.0F), vector_div(half_angle, sin_half_angle));
+
+			vector_store(vector_mul(x, scale), output.x + quat_index);
+			vector_store(vector_mul(y, scale), output.y + quat_index);
+			vector_store(vector_mul(z, scale), output.z + quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+		{
+			const vector4f result = quat_log(rtm_impl::quat_batch_load(input, quat_index));
+
+			output.x[quat_index] = vector_get_x(result);
+			output.y[quat_index] = vector_get_y(result);
+			output.z[quat_index] = vector_get_z(result);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Integrates 'num_quats' angular velocities over the same time step:
+	// output[i] = quat_integrate(rotations[i], angular_velocities[i], delta_time)
+	// Angular velocities are in radians per second and stored in [xyz].
+	// Rotations are processed 4 at a time, see quat_exp_soa for when the polynomial is used
+	// and for the accuracy, the half angle is 0.5 * delta_time * length(angular_velocity).
+	// The output can safely alias the rotations. Any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_integrate_aos(const quatf* rotations, const vector4f* angular_velocities, float delta_time, quatf* output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_integrate_aos", num_quats, num_quats * (sizeof(quatf) * 2 + sizeof(vector4f)));
+		rtm_impl::quat_integrate_batch_impl(rotations, angular_velocities, delta_time, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Integrates 'num_quats' angular velocities stored as structure of arrays over the same time step:
+	// output[i] = quat_integrate(rotations[i], angular_velocities[i], delta_time)
+	// Angular velocities are in radians per second.
+	// Rotations are processed 4 at a time, see quat_exp_soa for when the polynomial is used
+	// and for the accuracy, the half angle is 0.5 * delta_time * length(angular_velocity).
+	// The output can safely alias the rotations.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_integrate_soa(const const_float4f_soa& rotations, const const_float3f_soa& angular_velocities, float delta_time, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_integrate_soa", num_quats, num_quats * sizeof(float) * 11);
+		rtm_impl::quat_integrate_batch_impl(rotations, angular_velocities, delta_time, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates 'num_quats' quaternions from Euler Pitch/Yaw/Roll angles stored as structure of arrays:
+	// output[i] = quat_from_euler(angles.x[i], angles.y[i], angles.z[i])
+	// [x] holds the pitch, [y] the yaw and [z] the roll. Each angle stream is reduced
+	// 4 at a time with a single sin/cos evaluation.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_from_euler_soa(const const_float3f_soa& angles, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_from_euler_soa", num_quats, num_quats * sizeof(float) * 7);
+		uint32_t quat_index = 0;
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			vector4f sp, cp;
+			vector4f sy, cy;
+			vector4f sr, cr;
+			vector_sincos(vector_mul(vector_load(angles.x + quat_index), 0.5F), sp, cp);
+			vector_sincos(vector_mul(vector_load(angles.y + quat_index), 0.5F), sy, cy);
+			vector_sincos(vector_mul(vector_load(angles.z + quat_index), 0.5F), sr, cr);
+
+			const vector4f sp_sy = vector_mul(sp, sy);
+			const vector4f sp_cy = vector_mul(sp, cy);
+			const vector4f cp_sy = vector_mul(cp, sy);
+			const vector4f cp_cy = vector_mul(cp, cy);
+
+			vector_store(vector_neg_mul_sub(sr, cp_cy, vector_mul(cr, sp_sy)), output.x + quat_index);
+			vector_store(vector_neg(vector_mul_add(sr, cp_sy, vector_mul(cr, sp_cy))), output.y + quat_index);
+			vector_store(vector_neg_mul_sub(sr, sp_cy, vector_mul(cr, cp_sy)), output.z + quat_index);
+			vector_store(vector_mul_add(sr, sp_sy, vector_mul(cr, cp_cy)), output.w + quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+			rtm_impl::quat_batch_store(quat_from_euler(angles.x[quat_index], angles.y[quat_index], angles.z[quat_index]), output, quat_index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the Euler Pitch/Yaw/Roll angles of 'num_quats' normalized quaternions stored as
+	// structure of arrays like quat_to_euler: [x] holds the pitch, [y] the yaw and [z] the roll.
+	// Quaternions are processed 4 at a time, gimbal locked lanes are selected with masks.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_to_euler_soa(const const_float4f_soa& input, const float3f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_to_euler_soa", num_quats, num_quats * sizeof(float) * 7);
+		const vector4f half = vector_set(0.5F);
+		const vector4f gimbal_lock_threshold = vector_set(0.999999F);
+
+		uint32_t quat_index = 0;
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			vector4f x, y, z, w;
+			rtm_impl::quat_batch_load4(input, quat_index, x, y, z, w);
+
+			const vector4f sin_pitch = vector_mul(vector_neg_mul_sub(w, y, vector_mul(z, x)), 2.0F);
+			const mask4f is_gimbal_locked = vector_greater_equal(vector_abs(sin_pitch), gimbal_lock_threshold);
+
+			// Both atan2 inputs are halved, in gimbal lock the yaw holds the whole rotation
+			const vector4f wz = vector_mul(w, z);
+			const vector4f xx = vector_mul(x, x);
+			const vector4f yy = vector_mul(y, y);
+			const vector4f zz = vector_mul(z, z);
+			const vector4f yaw_y = vector_select(is_gimbal_locked, vector_neg_mul_sub(x, y, wz), vector_mul_add(x, y, wz));
+			const vector4f yaw_x = vector_sub(half, vector_select(is_gimbal_locked, vector_add(xx, zz), vector_add(yy, zz)));
+			const vector4f roll = vector_atan2(vector_neg(vector_mul_add(y, z, vector_mul(w, x))), vector_sub(half, vector_add(xx, yy)));
+
+			// Clamping keeps the asin input in range, locked lanes land exactly on +-pi/2
+			const vector4f clamped_sin_pitch = vector_select(is_gimbal_locked, vector_select(vector_less_than(sin_pitch, vector_zero()), vector_set(-1.0F), vector_set(1.0F)), sin_pitch);
+
+			vector_store(vector_asin(clamped_sin_pitch), output.x + quat_index);
+			vector_store(vector_atan2(yaw_y, yaw_x), output.y + quat_index);
+			vector_store(vector_select(is_gimbal_locked, vector_zero(), roll), output.z + quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+			quat_to_euler(rtm_impl::quat_batch_load(input, quat_index), output.x[quat_index], output.y[quat_index], output.z[quat_index]);
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the sine and cosine of the twist half angle of 4 rotations stored as
+		// structure of arrays like quat_swing_twist: twist = [axis * sin, cos]
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_twist_soa4(
+			vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, vector4f_arg3 w,
+			vector4f_arg4 axis_x, vector4f_arg5 axis_y, vector4f_arg6 axis_z,
+			vector4f& out_twist_sin, vector4f& out_twist_cos) RTM_NO_EXCEPT
+		{
+			constexpr float epsilon = 1.0E-8F;
+			constexpr float epsilon_squared = epsilon * epsilon;
+
+			const vector4f twist_sin = vector_mul_add(z, axis_z, vector_mul_add(y, axis_y, vector_mul(x, axis_x)));
+			const vector4f length_sq = vector_mul_add(w, w, vector_mul(twist_sin, twist_sin));
+			const mask4f is_degenerate = vector_less_than(length_sq, vector_set(epsilon_squared));
+
+			// The sign of [w] is transferred to the scale to keep the twist [w] positive
+			const vector4f length_reciprocal = vector_reciprocal(vector_sqrt(vector_max(length_sq, vector_set(epsilon_squared))));
+			const vector4f scale = vector_select(vector_less_than(w, vector_zero()), vector_neg(length_reciprocal), length_reciprocal);
+
+			out_twist_sin = vector_select(is_degenerate, vector_zero(), vector_mul(twist_sin, scale));
+			out_twist_cos = vector_select(is_degenerate, vector_set(1.0F), vector_mul(w, scale));
+		}
+
+		template<typename quat_input_type, typename quat_output_type>
+		inline void RTM_SIMD_CALL quat_swing_twist_batch_impl(const quat_input_type& input, vector4f_arg0 twist_axis, const quat_output_type& out_swing, const quat_output_type& out_twist, uint32_t num_quats) RTM_NO_EXCEPT
+		{
+			const vector4f axis_x = vector_dup_x(twist_axis);
+			const vector4f axis_y = vector_dup_y(twist_axis);
+			const vector4f axis_z = vector_dup_z(twist_axis);
+
+			uint32_t quat_index = 0;
+			for (; quat_index + 4 <= num_quats; quat_index += 4)
+			{
+				vector4f x, y, z, w;
+				quat_batch_load4(input, quat_index, x, y, z, w);
+
+				vector4f twist_sin, twist_cos;
+				quat_twist_soa4(x, y, z, w, axis_x, axis_y, axis_z, twist_sin, twist_cos);
+
+				const vector4f twist_x = vector_mul(axis_x, twist_sin);
+				const vector4f twist_y = vector_mul(axis_y, twist_sin);
+				const vector4f twist_z = vector_mul(axis_z, twist_sin);
+
+				// swing = quat_mul(quat_conjugate(twist), rotation)
+				vector4f swing_x, swing_y, swing_z, swing_w;
+				quat_mul_soa4(vector_neg(twist_x), vector_neg(twist_y), vector_neg(twist_z), twist_cos, x, y, z, w, swing_x, swing_y, swing_z, swing_w);
+
+				quat_batch_store4(swing_x, swing_y, swing_z, swing_w, out_swing, quat_index);
+				quat_batch_store4(twist_x, twist_y, twist_z, twist_cos, out_twist, quat_index);
+			}
+
+			for (; quat_index < num_quats; ++quat_index)
+			{
+				quatf swing;
+				quatf twist;
+				quat_swing_twist(quat_batch_load(input, quat_index), twist_axis, swing, twist);
+
+				quat_batch_store(swing, out_swing, quat_index);
+				quat_batch_store(twist, out_twist, quat_index);
+			}
+		}
+
+		template<typename quat_input_type, typename quat_output_type>
+		inline void RTM_SIMD_CALL quat_clamp_swing_twist_batch_impl(const quat_input_type& input, vector4f_arg0 twist_axis, float max_swing_angle, float min_twist_angle, float max_twist_angle, const quat_output_type& output, uint32_t num_quats) RTM_NO_EXCEPT
+		{
+			vector4f limits_sin;
+			vector4f limits_cos;
+			quat_swing_twist_limits(max_swing_angle, min_twist_angle, max_twist_angle, limits_sin, limits_cos);
+
+			const vector4f axis_x = vector_dup_x(twist_axis);
+			const vector4f axis_y = vector_dup_y(twist_axis);
+			const vector4f axis_z = vector_dup_z(twist_axis);
+			const vector4f max_swing_sin = vector_dup_x(limits_sin);
+			const vector4f max_swing_cos = vector_dup_x(limits_cos);
+			const vector4f min_twist_sin = vector_dup_y(limits_sin);
+			const vector4f min_twist_cos = vector_dup_y(limits_cos);
+			const vector4f max_twist_sin = vector_dup_z(limits_sin);
+			const vector4f max_twist_cos = vector_dup_z(limits_cos);
+
+			uint32_t quat_index = 0;
+			for (; quat_index + 4 <= num_quats; quat_index += 4)
+			{
+				vector4f x, y, z, w;
+				quat_batch_load4(input, quat_index, x, y, z, w);
+
+				// With a positive [w], the swing [w] is positive and the twist half angle lies in [-pi/2, pi/2]
+				const mask4f is_w_negative = vector_less_than(w, vector_zero());
+				x = vector_select(is_w_negative, vector_neg(x), x);
+				y = vector_select(is_w_negative, vector_neg(y), y);
+				z = vector_select(is_w_negative, vector_neg(z), z);
+				w = vector_abs(w);
+
+				vector4f twist_sin, twist_cos;
+				quat_twist_soa4(x, y, z, w, axis_x, axis_y, axis_z, twist_sin, twist_cos);
+
+				vector4f swing_x, swing_y, swing_z, swing_w;
+				quat_mul_soa4(vector_neg(vector_mul(axis_x, twist_sin)), vector_neg(vector_mul(axis_y, twist_sin)), vector_neg(vector_mul(axis_z, twist_sin)), twist_cos, x, y, z, w, swing_x, swing_y, swing_z, swing_w);
+
+				// The swing [w] is the cosine of its half angle, it decreases as the angle increases
+				const mask4f is_swing_clamped = vector_less_than(swing_w, max_swing_cos);
+				const vector4f swing_sin_sq = vector_mul_add(swing_z, swing_z, vector_mul_add(swing_y, swing_y, vector_mul(swing_x, swing_x)));
+				const mask4f is_swing_valid = vector_greater_than(swing_sin_sq, vector_zero());
+				const vector4f swing_clamp_scale = vector_select(is_swing_valid, vector_div(max_swing_sin, vector_sqrt(vector_select(is_swing_valid, swing_sin_sq, vector_set(1.0F)))), vector_zero());
+				const vector4f swing_scale = vector_select(is_swing_clamped, swing_clamp_scale, vector_set(1.0F));
+				swing_x = vector_mul(swing_x, swing_scale);
+				swing_y = vector_mul(swing_y, swing_scale);
+				swing_z = vector_mul(swing_z, swing_scale);
+				swing_w = vector_select(is_swing_clamped, max_swing_cos, swing_w);
+
+				// The sign of sin(angle - limit) tells on which side of a limit the twist lies
+				const mask4f is_above_max = vector_greater_than(vector_neg_mul_sub(twist_cos, max_twist_sin, vector_mul(twist_sin, max_twist_cos)), vector_zero());
+				const mask4f is_below_min = vector_less_than(vector_neg_mul_sub(twist_cos, min_twist_sin, vector_mul(twist_sin, min_twist_cos)), vector_zero());
+				twist_sin = vector_select(is_above_max, max_twist_sin, vector_select(is_below_min, min_twist_sin, twist_sin));
+				twist_cos = vector_select(is_above_max, max_twist_cos, vector_select(is_below_min, min_twist_cos, twist_cos));
+
+				vector4f result_x, result_y, result_z, result_w;
+				quat_mul_soa4(vector_mul(axis_x, twist_sin), vector_mul(axis_y, twist_sin), vector_mul(axis_z, twist_sin), twist_cos, swing_x, swing_y, swing_z, swing_w, result_x, result_y, result_z, result_w);
+
+				quat_batch_store4(result_x, result_y, result_z, result_w, output, quat_index);
+			}
+
+			for (; quat_index < num_quats; ++quat_index)
+				quat_batch_store(quat_clamp_swing_twist(quat_batch_load(input, quat_index), twist_axis, limits_sin, limits_cos), output, quat_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decomposes 'num_quats' normalized rotations into their swing and twist around the same
+	// normalized twist axis like quat_swing_twist: input[i] = quat_mul(out_twist[i], out_swing[i]).
+	// Rotations are processed 4 at a time without branching, no trigonometric function is evaluated.
+	// The outputs can safely alias the input. Any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_swing_twist_aos(const quatf* input, vector4f_arg0 twist_axis, quatf* out_swing, quatf* out_twist, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_swing_twist_aos", num_quats, num_quats * sizeof(quatf) * 3);
+		rtm_impl::quat_swing_twist_batch_impl(input, twist_axis, out_swing, out_twist, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decomposes 'num_quats' normalized rotations stored as structure of arrays into their swing
+	// and twist around the same normalized twist axis like quat_swing_twist:
+	// input[i] = quat_mul(out_twist[i], out_swing[i]).
+	// Rotations are processed 4 at a time without branching, no trigonometric function is evaluated.
+	// The outputs can safely alias the input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_swing_twist_soa(const const_float4f_soa& input, vector4f_arg0 twist_axis, const float4f_soa& out_swing, const float4f_soa& out_twist, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_swing_twist_soa", num_quats, num_quats * sizeof(float) * 12);
+		rtm_impl::quat_swing_twist_batch_impl(input, twist_axis, out_swing, out_twist, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Clamps 'num_quats' normalized rotations with the same swing cone and twist limits
+	// like quat_clamp_swing_twist, e.g. the same joint of many characters.
+	// The sine and cosine of the limits are computed once, rotations are then processed
+	// 4 at a time without branching and without any trigonometric function.
+	// The output can safely alias the input. Any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_clamp_swing_twist_aos(const quatf* input, vector4f_arg0 twist_axis, float max_swing_angle, float min_twist_angle, float max_twist_angle, quatf* output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_clamp_swing_twist_aos", num_quats, num_quats * sizeof(quatf) * 2);
+		rtm_impl::quat_clamp_swing_twist_batch_impl(input, twist_axis, max_swing_angle, min_twist_angle, max_twist_angle, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Clamps 'num_quats' normalized rotations stored as structure of arrays with the same swing
+	// cone and twist limits like quat_clamp_swing_twist, e.g. the same joint of many characters.
+	// The sine and cosine of the limits are computed once, rotations are then processed
+	// 4 at a time without branching and without any trigonometric function.
+	// The output can safely alias the input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_clamp_swing_twist_soa(const const_float4f_soa& input, vector4f_arg0 twist_axis, float max_swing_angle, float min_twist_angle, float max_twist_angle, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_clamp_swing_twist_soa", num_quats, num_quats * sizeof(float) * 8);
+		rtm_impl::quat_clamp_swing_twist_batch_impl(input, twist_axis, max_swing_angle, min_twist_angle, max_twist_angle, output, num_quats);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 'num_quats' quaternions stored as float4f, like quat_load on every entry.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon.
+	// The input does not need to be aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_load_array(const float4f* input, quatf* output, uint32_t num_quats, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_load_array", num_quats, num_quats * (sizeof(float4f) + sizeof(quatf)));
+		const size_t input_size = size_t(num_quats) * sizeof(float4f);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, quat_index * sizeof(float4f), input_size, prefetch_distance);
+			rtm_impl::batch_store(vector_load(input + quat_index), reinterpret_cast<float*>(output + quat_index), mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 'num_quats' quaternions as float4f, like quat_store on every entry.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon,
+	// the output must then be 16 bytes aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_store_array(const quatf* input, float4f* output, uint32_t num_quats, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_store_array", num_quats, num_quats * (sizeof(quatf) + sizeof(float4f)));
+		RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+		const size_t input_size = size_t(num_quats) * sizeof(quatf);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, quat_index * sizeof(quatf), input_size, prefetch_distance);
+			rtm_impl::batch_store(quat_to_vector(input[quat_index]), &output[quat_index].x, mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Sums 'num_quats' rotations starting at 'offset', weighted and flipped onto the
+		// hemisphere of the first one, and normalizes the sum.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename quat_input_type>
+		inline quatf quat_average_fast_impl(const quat_input_type& input, const float* weights, uint32_t offset, uint32_t num_quats) RTM_NO_EXCEPT
+		{
+			const quatf reference = quat_batch_load(input, offset);
+			const vector4f reference_x = vector_dup_x(quat_to_vector(reference));
+			const vector4f reference_y = vector_dup_y(quat_to_vector(reference));
+			const vector4f reference_z = vector_dup_z(quat_to_vector(reference));
+			const vector4f reference_w = vector_dup_w(quat_to_vector(reference));
+
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+			vector4f sum_x = zero;
+			vector4f sum_y = zero;
+			vector4f sum_z = zero;
+			vector4f sum_w = zero;
+
+			uint32_t quat_index = 0;
+			for (; quat_index + 4 <= num_quats; quat_index += 4)
+			{
+				vector4f quat_x;
+				vector4f quat_y;
+				vector4f quat_z;
+				vector4f quat_w;
+				quat_batch_load4(input, offset + quat_index, quat_x, quat_y, quat_z, quat_w);
+
+				const vector4f weight = weights != nullptr ? vector_load(weights + offset + quat_index) : one;
+				const vector4f dot = vector_mul_add(quat_w, reference_w, vector_mul_add(quat_z, reference_z, vector_mul_add(quat_y, reference_y, vector_mul(quat_x, reference_x))));
+				const vector4f signed_weight = vector_select(vector_less_than(dot, zero), vector_neg(weight), weight);
+
+				sum_x = vector_mul_add(quat_x, signed_weight, sum_x);
+				sum_y = vector_mul_add(quat_y, signed_weight, sum_y);
+				sum_z = vector_mul_add(quat_z, signed_weight, sum_z);
+				sum_w = vector_mul_add(quat_w, signed_weight, sum_w);
+			}
+
+			vector_transpose4x4(sum_x, sum_y, sum_z, sum_w);
+			vector4f sum = vector_add(vector_add(sum_x, sum_y), vector_add(sum_z, sum_w));
+
+			for (; quat_index < num_quats; ++quat_index)
+			{
+				const quatf rotation = quat_batch_load(input, offset + quat_index);
+				const float weight = weights != nullptr ? weights[offset + quat_index] : 1.0F;
+				const float signed_weight = quat_dot(rotation, reference) < 0.0F ? -weight : weight;
+				sum = vector_mul_add(quat_to_vector(rotation), signed_weight, sum);
+			}
+
+			return quat_normalize(vector_to_quat(sum));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies a symmetric 4x4 matrix stored as rows with a vector.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL quat_average_matrix_mul(const vector4f (&rows)[4], vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			vector4f result = vector_mul(rows[0], vector_dup_x(input));
+			result = vector_mul_add(rows[1], vector_dup_y(input), result);
+			result = vector_mul_add(rows[2], vector_dup_z(input), result);
+			return vector_mul_add(rows[3], vector_dup_w(input), result);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Accumulates the weighted outer products of 'num_quats' rotations starting at 'offset'
+		// and returns the eigenvector with the largest eigenvalue of their sum (Markley et al. 2007).
+		//////////////////////////////////////////////////////////////////////////
+		template<typename quat_input_type>
+		inline quatf quat_average_exact_impl(const quat_input_type& input, const float* weights, uint32_t offset, uint32_t num_quats) RTM_NO_EXCEPT
+		{
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+
+			// The matrix is symmetric, 10 of its 16 entries are accumulated
+			vector4f xx = zero;
+			vector4f xy = zero;
+			vector4f xz = zero;
+			vector4f xw = zero;
+			vector4f yy = zero;
+			vector4f yz = zero;
+			vector4f yw = zero;
+			vector4f zz = zero;
+			vector4f zw = zero;
+			vector4f ww = zero;
+
+			uint32_t quat_index = 0;
+			for (; quat_index + 4 <= num_quats; quat_index += 4)
+			{
+				vector4f quat_x;
+				vector4f quat_y;
+				vector4f quat_z;
+				vector4f quat_w;
+				quat_batch_load4(input, offset + quat_index, quat_x, quat_y, quat_z, quat_w);
+
+				const vector4f weight = weights != nullptr ? vector_load(weights + offset + quat_index) : one;
+				const vector4f weighted_x = vector_mul(quat_x, weight);
+				const vector4f weighted_y = vector_mul(quat_y, weight);
+				const vector4f weighted_z = vector_mul(quat_z, weight);
+				const vector4f weighted_w = vector_mul(quat_w, weight);
+
+				xx = vector_mul_add(weighted_x, quat_x, xx);
+				xy = vector_mul_add(weighted_x, quat_y, xy);
+				xz = vector_mul_add(weighted_x, quat_z, xz);
+				xw = vector_mul_add(weighted_x, quat_w, xw);
+				yy = vector_mul_add(weighted_y, quat_y, yy);
+				yz = vector_mul_add(weighted_y, quat_z, yz);
+				yw = vector_mul_add(weighted_y, quat_w, yw);
+				zz = vector_mul_add(weighted_z, quat_z, zz);
+				zw = vector_mul_add(weighted_z, quat_w, zw);
+				ww = vector_mul_add(weighted_w, quat_w, ww);
+			}
+
+			// Each row is the sum of the lanes of 4 accumulators
+			vector4f rows[4];
+			{
+				vector4f row0[4] = { xx, xy, xz, xw };
+				vector4f row1[4] = { xy, yy, yz, yw };
+				vector4f row2[4] = { xz, yz, zz, zw };
+				vector4f row3[4] = { xw, yw, zw, ww };
+				vector_transpose4x4(row0[0], row0[1], row0[2], row0[3]);
+				vector_transpose4x4(row1[0], row1[1], row1[2], row1[3]);
+				vector_transpose4x4(row2[0], row2[1], row2[2], row2[3]);
+				vector_transpose4x4(row3[0], row3[1], row3[2], row3[3]);
+				rows[0] = vector_add(vector_add(row0[0], row0[1]), vector_add(row0[2], row0[3]));
+				rows[1] = vector_add(vector_add(row1[0], row1[1]), vector_add(row1[2], row1[3]));
+				rows[2] = vector_add(vector_add(row2[0], row2[1]), vector_add(row2[2], row2[3]));
+				rows[3] = vector_add(vector_add(row3[0], row3[1]), vector_add(row3[2], row3[3]));
+			}
+
+			for (; quat_index < num_quats; ++quat_index)
+			{
+				const vector4f rotation = quat_to_vector(quat_batch_load(input, offset + quat_index));
+				const float weight = weights != nullptr ? weights[offset + quat_index] : 1.0F;
+				const vector4f weighted = vector_mul(rotation, weight);
+				rows[0] = vector_mul_add(rotation, vector_dup_x(weighted), rows[0]);
+				rows[1] = vector_mul_add(rotation, vector_dup_y(weighted), rows[1]);
+				rows[2] = vector_mul_add(rotation, vector_dup_z(weighted), rows[2]);
+				rows[3] = vector_mul_add(rotation, vector_dup_w(weighted), rows[3]);
+			}
+
+			// The row with the largest diagonal entry is never orthogonal to the eigenvector we
+			// look for unless two eigenvalues are equal, in which case any of them is an average
+			const float diagonal[4] = { vector_get_x(rows[0]), vector_get_y(rows[1]), vector_get_z(rows[2]), vector_get_w(rows[3]) };
+			uint32_t start_index = 0;
+			for (uint32_t row_index = 1; row_index < 4; ++row_index)
+			{
+				if (diagonal[row_index] > diagonal[start_index])
+					start_index = row_index;
+			}
+
+			// Squaring the matrix squares the ratio between its two largest eigenvalues, after
+			// 4 times every other eigenvector has vanished unless the rotations are far apart.
+			// The trace is the sum of the eigenvalues, dividing by it keeps the entries bounded.
+			vector4f power_rows[4] = { rows[0], rows[1], rows[2], rows[3] };
+			for (uint32_t iteration = 0; iteration < 4; ++iteration)
+			{
+				const float trace = float(vector_get_x(power_rows[0])) + float(vector_get_y(power_rows[1])) + float(vector_get_z(power_rows[2])) + float(vector_get_w(power_rows[3]));
+				const vector4f inv_trace = vector_set(1.0F / trace);
+
+				const vector4f squared_row0 = vector_mul(quat_average_matrix_mul(power_rows, power_rows[0]), inv_trace);
+				const vector4f squared_row1 = vector_mul(quat_average_matrix_mul(power_rows, power_rows[1]), inv_trace);
+				const vector4f squared_row2 = vector_mul(quat_average_matrix_mul(power_rows, power_rows[2]), inv_trace);
+				const vector4f squared_row3 = vector_mul(quat_average_matrix_mul(power_rows, power_rows[3]), inv_trace);
+				power_rows[0] = squared_row0;
+				power_rows[1] = squared_row1;
+				power_rows[2] = squared_row2;
+				power_rows[3] = squared_row3;
+			}
+
+			vector4f average = quat_to_vector(quat_normalize(vector_to_quat(quat_average_matrix_mul(power_rows, rows[start_index]))));
+			average = quat_to_vector(quat_normalize(vector_to_quat(quat_average_matrix_mul(power_rows, average))));
+
+			// The sign of an eigenvector is arbitrary, return the one closest to the first rotation
+			const vector4f first_rotation = quat_to_vector(quat_batch_load(input, offset));
+			if (vector_dot(average, first_rotation) < 0.0F)
+				average = vector_neg(average);
+
+			return vector_to_quat(average);
+		}
+
+		template<typename quat_input_type>
+		inline quatf quat_average_impl(const quat_input_type& input, const float* weights, uint32_t offset, uint32_t num_quats, quat_average_precision precision) RTM_NO_EXCEPT
+		{
+			if (precision == quat_average_precision::exact)
+				return quat_average_exact_impl(input, weights, offset, num_quats);
+			else
+				return quat_average_fast_impl(input, weights, offset, num_quats);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the weighted average of 'num_quats' rotations, e.g. to blend more than two
+	// poses or to smooth noisy rotations. When 'weights' is null, every rotation has the
+	// same weight. The precision controls how the average is found, see quat_average_precision.
+	// The result is on the hemisphere of the first rotation.
+	// The rotations must be normalized, the weights must not be negative, and at least one
+	// weight must be positive.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf quat_average_aos(const quatf* input, const float* weights, uint32_t num_quats, quat_average_precision precision = quat_average_precision::fast) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_average_aos", num_quats, num_quats * (sizeof(quatf) + (weights != nullptr ? sizeof(float) : 0)));
+		RTM_ASSERT(num_quats != 0, "At least one rotation is required");
+
+		return rtm_impl::quat_average_impl(input, weights, 0, num_quats, precision);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the weighted average of 'num_quats' rotations stored as structure of arrays.
+	// See quat_average_aos(..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf quat_average_soa(const const_float4f_soa& input, const float* weights, uint32_t num_quats, quat_average_precision precision = quat_average_precision::fast) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_average_soa", num_quats, num_quats * (sizeof(float) * 4 + (weights != nullptr ? sizeof(float) : 0)));
+		RTM_ASSERT(num_quats != 0, "At least one rotation is required");
+
+		return rtm_impl::quat_average_impl(input, weights, 0, num_quats, precision);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Averages 'num_groups' groups of rotations like quat_average_aos(..). Group i averages
+	// the 'group_sizes[i]' rotations starting at 'group_offsets[i]' and writes its result in
+	// 'output[i]'. Groups can overlap, e.g. sliding windows used to smooth a track.
+	// The weights, when present, are indexed like the rotations. Every group must hold
+	// at least one rotation.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_average_groups_aos(const quatf* input, const float* weights, const uint32_t* group_offsets, const uint32_t* group_sizes, uint32_t num_groups, quatf* output,
+		quat_average_precision precision = quat_average_precision::fast) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_average_groups_aos", num_groups, num_groups * (sizeof(uint32_t) * 2 + sizeof(quatf)));
+
+		for (uint32_t group_index = 0; group_index < num_groups; ++group_index)
+		{
+			RTM_ASSERT(group_sizes[group_index] != 0, "At least one rotation is required per group");
+			output[group_index] = rtm_impl::quat_average_impl(input, weights, group_offsets[group_index], group_sizes[group_index], precision);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Averages 'num_groups' groups of rotations stored as structure of arrays.
+	// See quat_average_groups_aos(..) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_average_groups_soa(const const_float4f_soa& input, const float* weights, const uint32_t* group_offsets, const uint32_t* group_sizes, uint32_t num_groups, const float4f_soa& output,
+		quat_average_precision precision = quat_average_precision::fast) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_average_groups_soa", num_groups, num_groups * (sizeof(uint32_t) * 2 + sizeof(float) * 4));
+
+		for (uint32_t group_index = 0; group_index < num_groups; ++group_index)
+		{
+			RTM_ASSERT(group_sizes[group_index] != 0, "At least one rotation is required per group");
+			rtm_impl::quat_batch_store(rtm_impl::quat_average_impl(input, weights, group_offsets[group_index], group_sizes[group_index], precision), output, group_index);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
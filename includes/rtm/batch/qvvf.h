@@ -0,0 +1,1953 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/batch/quatf.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Transforms a single point by the rows of the affine matrix built from a QVV transform.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL qvv_mul_point3_matrix(float x, float y, float z, const matrix3x4f& mtx) RTM_NO_EXCEPT
+		{
+			return vector_mul_add(mtx.z_axis, z, vector_mul_add(mtx.y_axis, y, vector_mul_add(mtx.x_axis, x, mtx.w_axis)));
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_points' 3D points stored as an array of structures by a QVV transform.
+	// Each point is transformed like qvv_mul_point3(point, qvv) but the rotation and scale
+	// are folded into a 3x3 matrix once for the whole array.
+	// The rotation must be normalized.
+	// The output can safely alias the input. With non-temporal stores, the output
+	// must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_mul_point3_aos(qvvf_arg0 qvv, const float3f* points, float3f* output, uint32_t num_points, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_point3_aos", num_points, num_points * sizeof(float3f) * 2);
+		RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+		const matrix3x4f mtx = matrix_from_qvv(qvv);
+
+		uint32_t point_index = 0;
+
+		// 4 points span exactly 3 vector4f, pack them to write full vectors
+		for (; point_index + 4 <= num_points; point_index += 4)
+		{
+			const float3f* group = points + point_index;
+			const vector4f result0 = rtm_impl::qvv_mul_point3_matrix(group[0].x, group[0].y, group[0].z, mtx);
+			const vector4f result1 = rtm_impl::qvv_mul_point3_matrix(group[1].x, group[1].y, group[1].z, mtx);
+			const vector4f result2 = rtm_impl::qvv_mul_point3_matrix(group[2].x, group[2].y, group[2].z, mtx);
+			const vector4f result3 = rtm_impl::qvv_mul_point3_matrix(group[3].x, group[3].y, group[3].z, mtx);
+
+			float* output_ptr = &output[point_index].x;
+			rtm_impl::batch_store(vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(result0, result1), output_ptr + 0, mode);
+			rtm_impl::batch_store(vector_mix<mix4::y, mix4::z, mix4::a, mix4::b>(result1, result2), output_ptr + 4, mode);
+			rtm_impl::batch_store(vector_mix<mix4::z, mix4::a, mix4::b, mix4::c>(result2, result3), output_ptr + 8, mode);
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const float3f& point = points[point_index];
+			vector_store3(rtm_impl::qvv_mul_point3_matrix(point.x, point.y, point.z, mtx), output + point_index);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_points' 3D points stored as structure of arrays by a QVV transform.
+	// Each point is transformed like qvv_mul_point3(point, qvv) but the rotation and scale
+	// are folded into a 3x3 matrix once for the whole array.
+	// The rotation must be normalized.
+	// The output can safely alias the input. With non-temporal stores, every output
+	// stream must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_mul_point3_soa(qvvf_arg0 qvv, const const_float3f_soa& points, const float3f_soa& output, uint32_t num_points, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_point3_soa", num_points, num_points * sizeof(float) * 6);
+		RTM_ASSERT(mode == store_mode::cached || (rtm_impl::is_aligned_to(output.x, 16) && rtm_impl::is_aligned_to(output.y, 16) && rtm_impl::is_aligned_to(output.z, 16)), "Non-temporal stores require 16 bytes alignment");
+
+		const matrix3x4f mtx = matrix_from_qvv(qvv);
+
+		// Every lane of a stream holds a different point, the matrix entries are broadcast once
+		const float m00 = vector_get_x(mtx.x_axis);
+		const float m01 = vector_get_y(mtx.x_axis);
+		const float m02 = vector_get_z(mtx.x_axis);
+		const float m10 = vector_get_x(mtx.y_axis);
+		const float m11 = vector_get_y(mtx.y_axis);
+		const float m12 = vector_get_z(mtx.y_axis);
+		const float m20 = vector_get_x(mtx.z_axis);
+		const float m21 = vector_get_y(mtx.z_axis);
+		const float m22 = vector_get_z(mtx.z_axis);
+		const float m30 = vector_get_x(mtx.w_axis);
+		const float m31 = vector_get_y(mtx.w_axis);
+		const float m32 = vector_get_z(mtx.w_axis);
+
+		uint32_t point_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+		{
+			const vector8f m00_8 = vector8_set(m00);
+			const vector8f m01_8 = vector8_set(m01);
+			const vector8f m02_8 = vector8_set(m02);
+			const vector8f m10_8 = vector8_set(m10);
+			const vector8f m11_8 = vector8_set(m11);
+			const vector8f m12_8 = vector8_set(m12);
+			const vector8f m20_8 = vector8_set(m20);
+			const vector8f m21_8 = vector8_set(m21);
+			const vector8f m22_8 = vector8_set(m22);
+			const vector8f m30_8 = vector8_set(m30);
+			const vector8f m31_8 = vector8_set(m31);
+			const vector8f m32_8 = vector8_set(m32);
+
+			for (; point_index + 8 <= num_points; point_index += 8)
+			{
+				const vector8f x = vector8_load(points.x + point_index);
+				const vector8f y = vector8_load(points.y + point_index);
+				const vector8f z = vector8_load(points.z + point_index);
+
+				rtm_impl::batch_store(vector_mul_add(z, m20_8, vector_mul_add(y, m10_8, vector_mul_add(x, m00_8, m30_8))), output.x + point_index, mode);
+				rtm_impl::batch_store(vector_mul_add(z, m21_8, vector_mul_add(y, m11_8, vector_mul_add(x, m01_8, m31_8))), output.y + point_index, mode);
+				rtm_impl::batch_store(vector_mul_add(z, m22_8, vector_mul_add(y, m12_8, vector_mul_add(x, m02_8, m32_8))), output.z + point_index, mode);
+			}
+		}
+#endif
+
+		{
+			const vector4f m00_4 = vector_set(m00);
+			const vector4f m01_4 = vector_set(m01);
+			const vector4f m02_4 = vector_set(m02);
+			const vector4f m10_4 = vector_set(m10);
+			const vector4f m11_4 = vector_set(m11);
+			const vector4f m12_4 = vector_set(m12);
+			const vector4f m20_4 = vector_set(m20);
+			const vector4f m21_4 = vector_set(m21);
+			const vector4f m22_4 = vector_set(m22);
+			const vector4f m30_4 = vector_set(m30);
+			const vector4f m31_4 = vector_set(m31);
+			const vector4f m32_4 = vector_set(m32);
+
+			for (; point_index + 4 <= num_points; point_index += 4)
+			{
+				const vector4f x = vector_load(points.x + point_index);
+				const vector4f y = vector_load(points.y + point_index);
+				const vector4f z = vector_load(points.z + point_index);
+
+				rtm_impl::batch_store(vector_mul_add(z, m20_4, vector_mul_add(y, m10_4, vector_mul_add(x, m00_4, m30_4))), output.x + point_index, mode);
+				rtm_impl::batch_store(vector_mul_add(z, m21_4, vector_mul_add(y, m11_4, vector_mul_add(x, m01_4, m31_4))), output.y + point_index, mode);
+				rtm_impl::batch_store(vector_mul_add(z, m22_4, vector_mul_add(y, m12_4, vector_mul_add(x, m02_4, m32_4))), output.z + point_index, mode);
+			}
+		}
+
+		for (; point_index < num_points; ++point_index)
+		{
+			const float x = points.x[point_index];
+			const float y = points.y[point_index];
+			const float z = points.z[point_index];
+
+			output.x[point_index] = (z * m20) + (y * m10) + (x * m00) + m30;
+			output.y[point_index] = (z * m21) + (y * m11) + (x * m01) + m31;
+			output.z[point_index] = (z * m22) + (y * m12) + (x * m02) + m32;
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Parent index used by the root transforms of a hierarchy.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint32_t k_hierarchy_root_index = 0xFFFFFFFFU;
+
+	//////////////////////////////////////////////////////////////////////////
+	// A transform hierarchy where transforms are grouped by depth, see hierarchy_sort_by_depth(..).
+	// Transforms that share the same depth do not depend on each other. The
+	// transforms at depth 'd' are sorted_indices[depth_offsets[d]] up to
+	// sorted_indices[depth_offsets[d + 1]] excluded.
+	// This does not own its memory.
+	//////////////////////////////////////////////////////////////////////////
+	struct transform_hierarchy
+	{
+		const uint32_t* parent_indices;
+		const uint32_t* sorted_indices;
+		const uint32_t* depth_offsets;
+		uint32_t num_transforms;
+		uint32_t num_depths;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Groups the transforms of a hierarchy by depth.
+	// Root transforms use k_hierarchy_root_index as parent index and every
+	// parent must come before its children.
+	// 'depths' and 'sorted_indices' must hold 'num_transforms' entries while
+	// 'depth_offsets' must hold 'num_transforms + 1' entries.
+	// The returned hierarchy references the provided buffers, it only needs to be
+	// built again when the topology changes.
+	//////////////////////////////////////////////////////////////////////////
+	inline transform_hierarchy hierarchy_sort_by_depth(const uint32_t* parent_indices, uint32_t num_transforms, uint32_t* depths, uint32_t* sorted_indices, uint32_t* depth_offsets) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::hierarchy_sort_by_depth", num_transforms, num_transforms * sizeof(uint32_t) * 3);
+		uint32_t num_depths = 0;
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const uint32_t parent_index = parent_indices[transform_index];
+			RTM_ASSERT(parent_index == k_hierarchy_root_index || parent_index < transform_index, "Parent transforms must come before their children");
+
+			const uint32_t depth = parent_index == k_hierarchy_root_index ? 0 : (depths[parent_index] + 1);
+			depths[transform_index] = depth;
+			num_depths = depth >= num_depths ? (depth + 1) : num_depths;
+		}
+
+		// Counting sort, stable to preserve the original order within a depth
+		for (uint32_t depth = 0; depth <= num_depths; ++depth)
+			depth_offsets[depth] = 0;
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			depth_offsets[depths[transform_index] + 1]++;
+
+		for (uint32_t depth = 1; depth < num_depths; ++depth)
+			depth_offsets[depth] += depth_offsets[depth - 1];
+
+		// Each offset is used as an insertion cursor and ends up where the next depth should start
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			sorted_indices[depth_offsets[depths[transform_index]]++] = transform_index;
+
+		for (uint32_t depth = num_depths; depth > 0; --depth)
+			depth_offsets[depth] = depth_offsets[depth - 1];
+		depth_offsets[0] = 0;
+
+		return transform_hierarchy{ parent_indices, sorted_indices, depth_offsets, num_transforms, num_depths };
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// 4 QVV transforms stored as structure of arrays, one vector4f per component.
+		//////////////////////////////////////////////////////////////////////////
+		struct qvvf_soa4
+		{
+			vector4f rotation_x;
+			vector4f rotation_y;
+			vector4f rotation_z;
+			vector4f rotation_w;
+			vector4f translation_x;
+			vector4f translation_y;
+			vector4f translation_z;
+			vector4f scale_x;
+			vector4f scale_y;
+			vector4f scale_z;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gathers 4 QVV transforms into their component streams.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_gather4(const qvvf& qvv0, const qvvf& qvv1, const qvvf& qvv2, const qvvf& qvv3, bool with_scale) RTM_NO_EXCEPT
+		{
+			qvvf_soa4 result;
+
+			result.rotation_x = quat_to_vector(qvv0.rotation);
+			result.rotation_y = quat_to_vector(qvv1.rotation);
+			result.rotation_z = quat_to_vector(qvv2.rotation);
+			result.rotation_w = quat_to_vector(qvv3.rotation);
+			vector_transpose4x4(result.rotation_x, result.rotation_y, result.rotation_z, result.rotation_w);
+
+			result.translation_x = qvv0.translation;
+			result.translation_y = qvv1.translation;
+			result.translation_z = qvv2.translation;
+			vector4f unused = qvv3.translation;
+			vector_transpose4x4(result.translation_x, result.translation_y, result.translation_z, unused);
+
+			if (with_scale)
+			{
+				result.scale_x = qvv0.scale;
+				result.scale_y = qvv1.scale;
+				result.scale_z = qvv2.scale;
+				unused = qvv3.scale;
+				vector_transpose4x4(result.scale_x, result.scale_y, result.scale_z, unused);
+			}
+			else
+			{
+				result.scale_x = result.scale_y = result.scale_z = vector_set(1.0F);
+			}
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 4 pairs of QVV transforms stored as structure of arrays.
+		// Follows the same convention as qvv_mul(lhs, rhs) and qvv_mul_no_scale(lhs, rhs).
+		// With scale, it must be positive.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_mul_soa4(const qvvf_soa4& lhs, const qvvf_soa4& rhs, bool with_scale) RTM_NO_EXCEPT
+		{
+			qvvf_soa4 result;
+
+			result.rotation_x = vector_neg_mul_sub(rhs.rotation_z, lhs.rotation_y, vector_mul_add(rhs.rotation_y, lhs.rotation_z, vector_mul_add(rhs.rotation_x, lhs.rotation_w, vector_mul(rhs.rotation_w, lhs.rotation_x))));
+			result.rotation_y = vector_mul_add(rhs.rotation_z, lhs.rotation_x, vector_mul_add(rhs.rotation_y, lhs.rotation_w, vector_neg_mul_sub(rhs.rotation_x, lhs.rotation_z, vector_mul(rhs.rotation_w, lhs.rotation_y))));
+			result.rotation_z = vector_mul_add(rhs.rotation_z, lhs.rotation_w, vector_neg_mul_sub(rhs.rotation_y, lhs.rotation_x, vector_mul_add(rhs.rotation_x, lhs.rotation_y, vector_mul(rhs.rotation_w, lhs.rotation_z))));
+			result.rotation_w = vector_neg_mul_sub(rhs.rotation_z, lhs.rotation_z, vector_neg_mul_sub(rhs.rotation_y, lhs.rotation_y, vector_neg_mul_sub(rhs.rotation_x, lhs.rotation_x, vector_mul(rhs.rotation_w, lhs.rotation_w))));
+
+			vector4f translation_x = lhs.translation_x;
+			vector4f translation_y = lhs.translation_y;
+			vector4f translation_z = lhs.translation_z;
+			if (with_scale)
+			{
+				translation_x = vector_mul(translation_x, rhs.scale_x);
+				translation_y = vector_mul(translation_y, rhs.scale_y);
+				translation_z = vector_mul(translation_z, rhs.scale_z);
+			}
+
+			// Rotate the translation with: v' = v + w * t + cross(q, t) where t = 2 * cross(q, v)
+			vector4f t_x = vector_neg_mul_sub(rhs.rotation_z, translation_y, vector_mul(rhs.rotation_y, translation_z));
+			vector4f t_y = vector_neg_mul_sub(rhs.rotation_x, translation_z, vector_mul(rhs.rotation_z, translation_x));
+			vector4f t_z = vector_neg_mul_sub(rhs.rotation_y, translation_x, vector_mul(rhs.rotation_x, translation_y));
+			t_x = vector_add(t_x, t_x);
+			t_y = vector_add(t_y, t_y);
+			t_z = vector_add(t_z, t_z);
+
+			const vector4f cross_x = vector_neg_mul_sub(rhs.rotation_z, t_y, vector_mul(rhs.rotation_y, t_z));
+			const vector4f cross_y = vector_neg_mul_sub(rhs.rotation_x, t_z, vector_mul(rhs.rotation_z, t_x));
+			const vector4f cross_z = vector_neg_mul_sub(rhs.rotation_y, t_x, vector_mul(rhs.rotation_x, t_y));
+
+			result.translation_x = vector_add(vector_add(vector_mul_add(rhs.rotation_w, t_x, translation_x), cross_x), rhs.translation_x);
+			result.translation_y = vector_add(vector_add(vector_mul_add(rhs.rotation_w, t_y, translation_y), cross_y), rhs.translation_y);
+			result.translation_z = vector_add(vector_add(vector_mul_add(rhs.rotation_w, t_z, translation_z), cross_z), rhs.translation_z);
+
+			if (with_scale)
+			{
+				result.scale_x = vector_mul(lhs.scale_x, rhs.scale_x);
+				result.scale_y = vector_mul(lhs.scale_y, rhs.scale_y);
+				result.scale_z = vector_mul(lhs.scale_z, rhs.scale_z);
+			}
+			else
+			{
+				result.scale_x = result.scale_y = result.scale_z = vector_set(1.0F);
+			}
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverts 4 QVV transforms stored as structure of arrays.
+		// Follows the same convention as qvv_inverse(input) and qvv_inverse_no_scale(input).
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_inverse_soa4(const qvvf_soa4& input, bool with_scale) RTM_NO_EXCEPT
+		{
+			qvvf_soa4 result;
+
+			result.rotation_x = vector_neg(input.rotation_x);
+			result.rotation_y = vector_neg(input.rotation_y);
+			result.rotation_z = vector_neg(input.rotation_z);
+			result.rotation_w = input.rotation_w;
+
+			vector4f translation_x = input.translation_x;
+			vector4f translation_y = input.translation_y;
+			vector4f translation_z = input.translation_z;
+			if (with_scale)
+			{
+				result.scale_x = vector_reciprocal(input.scale_x);
+				result.scale_y = vector_reciprocal(input.scale_y);
+				result.scale_z = vector_reciprocal(input.scale_z);
+
+				translation_x = vector_mul(translation_x, result.scale_x);
+				translation_y = vector_mul(translation_y, result.scale_y);
+				translation_z = vector_mul(translation_z, result.scale_z);
+			}
+			else
+			{
+				result.scale_x = result.scale_y = result.scale_z = vector_set(1.0F);
+			}
+
+			// Rotate the translation by the conjugate and negate it: -(v + w * t + cross(q, t)) where t = 2 * cross(q, v)
+			vector4f t_x = vector_neg_mul_sub(result.rotation_z, translation_y, vector_mul(result.rotation_y, translation_z));
+			vector4f t_y = vector_neg_mul_sub(result.rotation_x, translation_z, vector_mul(result.rotation_z, translation_x));
+			vector4f t_z = vector_neg_mul_sub(result.rotation_y, translation_x, vector_mul(result.rotation_x, translation_y));
+			t_x = vector_add(t_x, t_x);
+			t_y = vector_add(t_y, t_y);
+			t_z = vector_add(t_z, t_z);
+
+			const vector4f cross_x = vector_neg_mul_sub(result.rotation_z, t_y, vector_mul(result.rotation_y, t_z));
+			const vector4f cross_y = vector_neg_mul_sub(result.rotation_x, t_z, vector_mul(result.rotation_z, t_x));
+			const vector4f cross_z = vector_neg_mul_sub(result.rotation_y, t_x, vector_mul(result.rotation_x, t_y));
+
+			result.translation_x = vector_neg(vector_add(vector_mul_add(result.rotation_w, t_x, translation_x), cross_x));
+			result.translation_y = vector_neg(vector_add(vector_mul_add(result.rotation_w, t_y, translation_y), cross_y));
+			result.translation_z = vector_neg(vector_add(vector_mul_add(result.rotation_w, t_z, translation_z), cross_z));
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Builds the scaled rotation part of 4 QVV transforms like matrix_from_qvv.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix3x3f_soa4 matrix_from_qvv_soa4(const qvvf_soa4& input) RTM_NO_EXCEPT
+		{
+			matrix3x3f_soa4 result = matrix_from_quat_soa4(input.rotation_x, input.rotation_y, input.rotation_z, input.rotation_w);
+			result.x_axis[0] = vector_mul(result.x_axis[0], input.scale_x);
+			result.x_axis[1] = vector_mul(result.x_axis[1], input.scale_x);
+			result.x_axis[2] = vector_mul(result.x_axis[2], input.scale_x);
+			result.y_axis[0] = vector_mul(result.y_axis[0], input.scale_y);
+			result.y_axis[1] = vector_mul(result.y_axis[1], input.scale_y);
+			result.y_axis[2] = vector_mul(result.y_axis[2], input.scale_y);
+			result.z_axis[0] = vector_mul(result.z_axis[0], input.scale_z);
+			result.z_axis[1] = vector_mul(result.z_axis[1], input.scale_z);
+			result.z_axis[2] = vector_mul(result.z_axis[2], input.scale_z);
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Computes one axis of matrix_mul(lhs, rhs), normalizes it like matrix_remove_scale,
+		// and gives it the sign of the provided scale.
+		//////////////////////////////////////////////////////////////////////////
+		inline void matrix_mul_row_remove_scale_soa4(const vector4f (&lhs_axis)[3], const matrix3x3f_soa4& rhs, vector4f_arg0 scale_sign, vector4f (&output)[3]) RTM_NO_EXCEPT
+		{
+			const vector4f x = vector_mul_add(lhs_axis[2], rhs.z_axis[0], vector_mul_add(lhs_axis[1], rhs.y_axis[0], vector_mul(lhs_axis[0], rhs.x_axis[0])));
+			const vector4f y = vector_mul_add(lhs_axis[2], rhs.z_axis[1], vector_mul_add(lhs_axis[1], rhs.y_axis[1], vector_mul(lhs_axis[0], rhs.x_axis[1])));
+			const vector4f z = vector_mul_add(lhs_axis[2], rhs.z_axis[2], vector_mul_add(lhs_axis[1], rhs.y_axis[2], vector_mul(lhs_axis[0], rhs.x_axis[2])));
+
+			const vector4f len_sq = vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x)));
+			const vector4f inv_len = vector_copy_sign(vector_div(vector_set(1.0F), vector_sqrt(len_sq)), scale_sign);
+
+			output[0] = vector_mul(x, inv_len);
+			output[1] = vector_mul(y, inv_len);
+			output[2] = vector_mul(z, inv_len);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 4 pairs of QVV transforms stored as structure of arrays.
+		// Follows the same convention as qvv_mul(lhs, rhs) including negative scale.
+		// Instead of branching per transform, when any lane has negative scale every lane
+		// computes the rotation through a matrix like qvv_mul does and the right result
+		// is blended in. Zero scale is not supported.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_mul_signed_scale_soa4(const qvvf_soa4& lhs, const qvvf_soa4& rhs) RTM_NO_EXCEPT
+		{
+			qvvf_soa4 result = qvv_mul_soa4(lhs, rhs, true);
+
+			const vector4f lhs_min_scale = vector_min(vector_min(lhs.scale_x, lhs.scale_y), lhs.scale_z);
+			const vector4f rhs_min_scale = vector_min(vector_min(rhs.scale_x, rhs.scale_y), rhs.scale_z);
+			const mask4f is_negative_scale = vector_less_than(vector_min(lhs_min_scale, rhs_min_scale), vector_zero());
+			if (!mask_any_true(is_negative_scale))
+				return result;
+
+			// Multiply the scaled rotation matrices, remove the scale, and flip the axes with the sign of the resulting scale
+			const matrix3x3f_soa4 lhs_mtx = matrix_from_qvv_soa4(lhs);
+			const matrix3x3f_soa4 rhs_mtx = matrix_from_qvv_soa4(rhs);
+
+			matrix3x3f_soa4 result_mtx;
+			matrix_mul_row_remove_scale_soa4(lhs_mtx.x_axis, rhs_mtx, result.scale_x, result_mtx.x_axis);
+			matrix_mul_row_remove_scale_soa4(lhs_mtx.y_axis, rhs_mtx, result.scale_y, result_mtx.y_axis);
+			matrix_mul_row_remove_scale_soa4(lhs_mtx.z_axis, rhs_mtx, result.scale_z, result_mtx.z_axis);
+
+			vector4f quat_x;
+			vector4f quat_y;
+			vector4f quat_z;
+			vector4f quat_w;
+			quat_from_matrix_soa4(result_mtx, quat_x, quat_y, quat_z, quat_w);
+
+			result.rotation_x = vector_select(is_negative_scale, quat_x, result.rotation_x);
+			result.rotation_y = vector_select(is_negative_scale, quat_y, result.rotation_y);
+			result.rotation_z = vector_select(is_negative_scale, quat_z, result.rotation_z);
+			result.rotation_w = vector_select(is_negative_scale, quat_w, result.rotation_w);
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Scatters 4 QVV transforms from their component streams.
+		//////////////////////////////////////////////////////////////////////////
+		inline void qvv_scatter4(const qvvf_soa4& input, qvvf& qvv0, qvvf& qvv1, qvvf& qvv2, qvvf& qvv3) RTM_NO_EXCEPT
+		{
+			vector4f rotation0 = input.rotation_x;
+			vector4f rotation1 = input.rotation_y;
+			vector4f rotation2 = input.rotation_z;
+			vector4f rotation3 = input.rotation_w;
+			vector_transpose4x4(rotation0, rotation1, rotation2, rotation3);
+
+			vector4f translation0 = input.translation_x;
+			vector4f translation1 = input.translation_y;
+			vector4f translation2 = input.translation_z;
+			vector4f translation3 = vector_zero();
+			vector_transpose4x4(translation0, translation1, translation2, translation3);
+
+			vector4f scale0 = input.scale_x;
+			vector4f scale1 = input.scale_y;
+			vector4f scale2 = input.scale_z;
+			vector4f scale3 = vector_zero();
+			vector_transpose4x4(scale0, scale1, scale2, scale3);
+
+			qvv0 = qvv_set(vector_to_quat(rotation0), translation0, scale0);
+			qvv1 = qvv_set(vector_to_quat(rotation1), translation1, scale1);
+			qvv2 = qvv_set(vector_to_quat(rotation2), translation2, scale2);
+			qvv3 = qvv_set(vector_to_quat(rotation3), translation3, scale3);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Decomposes 4 3x4 affine matrices into QVV transforms like qvv_from_matrix.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_from_matrix_soa4(const matrix3x4f* input) RTM_NO_EXCEPT
+		{
+			matrix3x3f_soa4 mtx = matrix_batch_load_rotation4(input, 0);
+
+			qvvf_soa4 result;
+			result.translation_x = input[0].w_axis;
+			result.translation_y = input[1].w_axis;
+			result.translation_z = input[2].w_axis;
+			vector4f unused = input[3].w_axis;
+			vector_transpose4x4(result.translation_x, result.translation_y, result.translation_z, unused);
+
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+
+			const vector4f abs_scale_x = vector_sqrt(vector_mul_add(mtx.x_axis[2], mtx.x_axis[2], vector_mul_add(mtx.x_axis[1], mtx.x_axis[1], vector_mul(mtx.x_axis[0], mtx.x_axis[0]))));
+			const vector4f abs_scale_y = vector_sqrt(vector_mul_add(mtx.y_axis[2], mtx.y_axis[2], vector_mul_add(mtx.y_axis[1], mtx.y_axis[1], vector_mul(mtx.y_axis[0], mtx.y_axis[0]))));
+			const vector4f abs_scale_z = vector_sqrt(vector_mul_add(mtx.z_axis[2], mtx.z_axis[2], vector_mul_add(mtx.z_axis[1], mtx.z_axis[1], vector_mul(mtx.z_axis[0], mtx.z_axis[0]))));
+
+			// A reflection is retained by flipping the X axis
+			const vector4f cross_x = vector_neg_mul_sub(mtx.x_axis[2], mtx.y_axis[1], vector_mul(mtx.x_axis[1], mtx.y_axis[2]));
+			const vector4f cross_y = vector_neg_mul_sub(mtx.x_axis[0], mtx.y_axis[2], vector_mul(mtx.x_axis[2], mtx.y_axis[0]));
+			const vector4f cross_z = vector_neg_mul_sub(mtx.x_axis[1], mtx.y_axis[0], vector_mul(mtx.x_axis[0], mtx.y_axis[1]));
+			const vector4f determinant = vector_mul_add(cross_z, mtx.z_axis[2], vector_mul_add(cross_y, mtx.z_axis[1], vector_mul(cross_x, mtx.z_axis[0])));
+
+			result.scale_x = vector_select(vector_less_than(determinant, zero), vector_neg(abs_scale_x), abs_scale_x);
+			result.scale_y = abs_scale_y;
+			result.scale_z = abs_scale_z;
+
+			// Zero scale axes remain zero, quat_from_matrix_soa4 returns the identity for them
+			const vector4f inv_scale_x = vector_select(vector_greater_than(abs_scale_x, zero), vector_div(one, result.scale_x), zero);
+			const vector4f inv_scale_y = vector_select(vector_greater_than(abs_scale_y, zero), vector_div(one, abs_scale_y), zero);
+			const vector4f inv_scale_z = vector_select(vector_greater_than(abs_scale_z, zero), vector_div(one, abs_scale_z), zero);
+
+			for (uint32_t component_index = 0; component_index < 3; ++component_index)
+			{
+				mtx.x_axis[component_index] = vector_mul(mtx.x_axis[component_index], inv_scale_x);
+				mtx.y_axis[component_index] = vector_mul(mtx.y_axis[component_index], inv_scale_y);
+				mtx.z_axis[component_index] = vector_mul(mtx.z_axis[component_index], inv_scale_z);
+			}
+
+			quat_from_matrix_soa4(mtx, result.rotation_x, result.rotation_y, result.rotation_z, result.rotation_w);
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Normalizes the rotations of 4 QVV transforms stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		inline void qvv_normalize_rotation_soa4(qvvf_soa4& input) RTM_NO_EXCEPT
+		{
+			const vector4f length_squared = vector_mul_add(input.rotation_w, input.rotation_w, vector_mul_add(input.rotation_z, input.rotation_z, vector_mul_add(input.rotation_y, input.rotation_y, vector_mul(input.rotation_x, input.rotation_x))));
+			const vector4f length_reciprocal = vector_reciprocal(vector_sqrt(length_squared));
+
+			input.rotation_x = vector_mul(input.rotation_x, length_reciprocal);
+			input.rotation_y = vector_mul(input.rotation_y, length_reciprocal);
+			input.rotation_z = vector_mul(input.rotation_z, length_reciprocal);
+			input.rotation_w = vector_mul(input.rotation_w, length_reciprocal);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Interpolates 4 pairs of QVV transforms stored as structure of arrays like qvv_lerp.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_lerp_soa4(const qvvf_soa4& start, const qvvf_soa4& end, vector4f_arg0 alpha) RTM_NO_EXCEPT
+		{
+			// If the dot product is negative, we flip the 'end' rotation by negating its alpha
+			const vector4f dot = vector_mul_add(start.rotation_w, end.rotation_w, vector_mul_add(start.rotation_z, end.rotation_z, vector_mul_add(start.rotation_y, end.rotation_y, vector_mul(start.rotation_x, end.rotation_x))));
+			const vector4f end_alpha = vector_select(vector_less_than(dot, vector_zero()), vector_neg(alpha), alpha);
+
+			qvvf_soa4 result;
+
+			// ((1.0 - alpha) * start) + (end_alpha * end) == (start - alpha * start) + (end_alpha * end)
+			result.rotation_x = vector_mul_add(end.rotation_x, end_alpha, vector_neg_mul_sub(start.rotation_x, alpha, start.rotation_x));
+			result.rotation_y = vector_mul_add(end.rotation_y, end_alpha, vector_neg_mul_sub(start.rotation_y, alpha, start.rotation_y));
+			result.rotation_z = vector_mul_add(end.rotation_z, end_alpha, vector_neg_mul_sub(start.rotation_z, alpha, start.rotation_z));
+			result.rotation_w = vector_mul_add(end.rotation_w, end_alpha, vector_neg_mul_sub(start.rotation_w, alpha, start.rotation_w));
+			qvv_normalize_rotation_soa4(result);
+
+			result.translation_x = vector_mul_add(end.translation_x, alpha, vector_neg_mul_sub(start.translation_x, alpha, start.translation_x));
+			result.translation_y = vector_mul_add(end.translation_y, alpha, vector_neg_mul_sub(start.translation_y, alpha, start.translation_y));
+			result.translation_z = vector_mul_add(end.translation_z, alpha, vector_neg_mul_sub(start.translation_z, alpha, start.translation_z));
+
+			result.scale_x = vector_mul_add(end.scale_x, alpha, vector_neg_mul_sub(start.scale_x, alpha, start.scale_x));
+			result.scale_y = vector_mul_add(end.scale_y, alpha, vector_neg_mul_sub(start.scale_y, alpha, start.scale_y));
+			result.scale_z = vector_mul_add(end.scale_z, alpha, vector_neg_mul_sub(start.scale_z, alpha, start.scale_z));
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Applies 4 additive QVV transforms stored as structure of arrays like qvv_apply_additive.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_apply_additive_soa4(const qvvf_soa4& base, const qvvf_soa4& additive, vector4f_arg0 weight) RTM_NO_EXCEPT
+		{
+			const vector4f one_minus_weight = vector_sub(vector_set(1.0F), weight);
+
+			// Interpolate from the identity, its dot product with the additive rotation is the W component
+			const vector4f end_weight = vector_select(vector_less_than(additive.rotation_w, vector_zero()), vector_neg(weight), weight);
+
+			qvvf_soa4 additive_rotation;
+			additive_rotation.rotation_x = vector_mul(additive.rotation_x, end_weight);
+			additive_rotation.rotation_y = vector_mul(additive.rotation_y, end_weight);
+			additive_rotation.rotation_z = vector_mul(additive.rotation_z, end_weight);
+			additive_rotation.rotation_w = vector_mul_add(additive.rotation_w, end_weight, one_minus_weight);
+			qvv_normalize_rotation_soa4(additive_rotation);
+
+			qvvf_soa4 result;
+			quat_mul_soa4(
+				additive_rotation.rotation_x, additive_rotation.rotation_y, additive_rotation.rotation_z, additive_rotation.rotation_w,
+				base.rotation_x, base.rotation_y, base.rotation_z, base.rotation_w,
+				result.rotation_x, result.rotation_y, result.rotation_z, result.rotation_w);
+
+			result.translation_x = vector_mul_add(additive.translation_x, weight, base.translation_x);
+			result.translation_y = vector_mul_add(additive.translation_y, weight, base.translation_y);
+			result.translation_z = vector_mul_add(additive.translation_z, weight, base.translation_z);
+
+			result.scale_x = vector_mul(base.scale_x, vector_mul_add(additive.scale_x, weight, one_minus_weight));
+			result.scale_y = vector_mul(base.scale_y, vector_mul_add(additive.scale_y, weight, one_minus_weight));
+			result.scale_z = vector_mul(base.scale_z, vector_mul_add(additive.scale_z, weight, one_minus_weight));
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Extracts 4 additive QVV transforms stored as structure of arrays like qvv_extract_additive.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_extract_additive_soa4(const qvvf_soa4& pose, const qvvf_soa4& reference) RTM_NO_EXCEPT
+		{
+			qvvf_soa4 result;
+
+			// Multiply by the conjugate of the reference rotation
+			quat_mul_soa4(
+				pose.rotation_x, pose.rotation_y, pose.rotation_z, pose.rotation_w,
+				vector_neg(reference.rotation_x), vector_neg(reference.rotation_y), vector_neg(reference.rotation_z), reference.rotation_w,
+				result.rotation_x, result.rotation_y, result.rotation_z, result.rotation_w);
+
+			// Flip the rotations with a negative W to the same hemisphere as the identity
+			const vector4f hemisphere_sign = vector_select(vector_less_than(result.rotation_w, vector_zero()), vector_set(-1.0F), vector_set(1.0F));
+			result.rotation_x = vector_mul(result.rotation_x, hemisphere_sign);
+			result.rotation_y = vector_mul(result.rotation_y, hemisphere_sign);
+			result.rotation_z = vector_mul(result.rotation_z, hemisphere_sign);
+			result.rotation_w = vector_mul(result.rotation_w, hemisphere_sign);
+
+			result.translation_x = vector_sub(pose.translation_x, reference.translation_x);
+			result.translation_y = vector_sub(pose.translation_y, reference.translation_y);
+			result.translation_z = vector_sub(pose.translation_z, reference.translation_z);
+
+			result.scale_x = vector_div(pose.scale_x, reference.scale_x);
+			result.scale_y = vector_div(pose.scale_y, reference.scale_y);
+			result.scale_z = vector_div(pose.scale_z, reference.scale_z);
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads 4 consecutive QVV transforms from structure of arrays streams, no transposition is required.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf_soa4 qvv_load_soa4(const const_qvvf_soa& input, uint32_t index) RTM_NO_EXCEPT
+		{
+			qvvf_soa4 result;
+			result.rotation_x = vector_load(input.rotation.x + index);
+			result.rotation_y = vector_load(input.rotation.y + index);
+			result.rotation_z = vector_load(input.rotation.z + index);
+			result.rotation_w = vector_load(input.rotation.w + index);
+			result.translation_x = vector_load(input.translation.x + index);
+			result.translation_y = vector_load(input.translation.y + index);
+			result.translation_z = vector_load(input.translation.z + index);
+			result.scale_x = vector_load(input.scale.x + index);
+			result.scale_y = vector_load(input.scale.y + index);
+			result.scale_z = vector_load(input.scale.z + index);
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Stores 4 consecutive QVV transforms into structure of arrays streams.
+		//////////////////////////////////////////////////////////////////////////
+		inline void qvv_store_soa4(const qvvf_soa4& input, const qvvf_soa& output, uint32_t index) RTM_NO_EXCEPT
+		{
+			vector_store(input.rotation_x, output.rotation.x + index);
+			vector_store(input.rotation_y, output.rotation.y + index);
+			vector_store(input.rotation_z, output.rotation.z + index);
+			vector_store(input.rotation_w, output.rotation.w + index);
+			vector_store(input.translation_x, output.translation.x + index);
+			vector_store(input.translation_y, output.translation.y + index);
+			vector_store(input.translation_z, output.translation.z + index);
+			vector_store(input.scale_x, output.scale.x + index);
+			vector_store(input.scale_y, output.scale.y + index);
+			vector_store(input.scale_z, output.scale.z + index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reads and writes a single QVV transform in structure of arrays streams.
+		//////////////////////////////////////////////////////////////////////////
+		inline qvvf qvv_load_soa(const const_qvvf_soa& input, uint32_t index) RTM_NO_EXCEPT
+		{
+			const quatf rotation = quat_set(input.rotation.x[index], input.rotation.y[index], input.rotation.z[index], input.rotation.w[index]);
+			const vector4f translation = vector_set(input.translation.x[index], input.translation.y[index], input.translation.z[index], 0.0F);
+			const vector4f scale = vector_set(input.scale.x[index], input.scale.y[index], input.scale.z[index], 0.0F);
+			return qvv_set(rotation, translation, scale);
+		}
+
+		inline void qvv_store_soa(qvvf_arg0 input, const qvvf_soa& output, uint32_t index) RTM_NO_EXCEPT
+		{
+			output.rotation.x[index] = quat_get_x(input.rotation);
+			output.rotation.y[index] = quat_get_y(input.rotation);
+			output.rotation.z[index] = quat_get_z(input.rotation);
+			output.rotation.w[index] = quat_get_w(input.rotation);
+			output.translation.x[index] = vector_get_x(input.translation);
+			output.translation.y[index] = vector_get_y(input.translation);
+			output.translation.z[index] = vector_get_z(input.translation);
+			output.scale.x[index] = vector_get_x(input.scale);
+			output.scale.y[index] = vector_get_y(input.scale);
+			output.scale.z[index] = vector_get_z(input.scale);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// How batch QVV multiplications handle the 3D scale.
+		//////////////////////////////////////////////////////////////////////////
+		enum class qvv_scale_mode
+		{
+			none,			// Like qvv_mul_no_scale
+			positive,		// Like qvv_mul when the scale is known to be positive
+			any,			// Like qvv_mul, negative scale is blended in
+		};
+
+		template<qvv_scale_mode scale_mode>
+		inline qvvf_soa4 qvv_mul_soa4(const qvvf_soa4& lhs, const qvvf_soa4& rhs) RTM_NO_EXCEPT
+		{
+			if (static_condition<scale_mode == qvv_scale_mode::any>::test())
+				return qvv_mul_signed_scale_soa4(lhs, rhs);
+			else
+				return qvv_mul_soa4(lhs, rhs, scale_mode == qvv_scale_mode::positive);
+		}
+
+#if defined(RTM_AVX512_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// 16 QVV transforms stored as structure of arrays, one register per component.
+		// The functions using it are force inlined, otherwise the 10 registers spill
+		// to memory between them.
+		//////////////////////////////////////////////////////////////////////////
+		struct qvvf_soa16
+		{
+			__m512 rotation_x;
+			__m512 rotation_y;
+			__m512 rotation_z;
+			__m512 rotation_w;
+			__m512 translation_x;
+			__m512 translation_y;
+			__m512 translation_z;
+			__m512 scale_x;
+			__m512 scale_y;
+			__m512 scale_z;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads up to 4 records of 3 float4 values with 3 registers and splits them into
+		// 3 registers that each hold the same float4 of the 4 records.
+		// The registers hold: [a0 b0 c0 a1] [b1 c1 a2 b2] [c2 a3 b3 c3]
+		// and each output is extracted with two vpermt2ps. Missing records are zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline void qvv_avx512_load_records4(const float* input, uint32_t num_floats, __m512& out_first, __m512& out_second, __m512& out_third) RTM_NO_EXCEPT
+		{
+			const __m512 input0 = _mm512_maskz_loadu_ps(batch_avx512_mask(num_floats, 0), input + 0);
+			const __m512 input1 = _mm512_maskz_loadu_ps(batch_avx512_mask(num_floats, 1), input + 16);
+			const __m512 input2 = _mm512_maskz_loadu_ps(batch_avx512_mask(num_floats, 2), input + 32);
+
+			const __m512 first01 = _mm512_permutex2var_ps(input0, _mm512_setr_epi32(0, 1, 2, 3, 12, 13, 14, 15, 24, 25, 26, 27, 0, 0, 0, 0), input1);
+			const __m512 second01 = _mm512_permutex2var_ps(input0, _mm512_setr_epi32(4, 5, 6, 7, 16, 17, 18, 19, 28, 29, 30, 31, 0, 0, 0, 0), input1);
+			const __m512 third01 = _mm512_permutex2var_ps(input0, _mm512_setr_epi32(8, 9, 10, 11, 20, 21, 22, 23, 0, 0, 0, 0, 0, 0, 0, 0), input1);
+
+			out_first = _mm512_permutex2var_ps(first01, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 20, 21, 22, 23), input2);
+			out_second = _mm512_permutex2var_ps(second01, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 24, 25, 26, 27), input2);
+			out_third = _mm512_permutex2var_ps(third01, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 16, 17, 18, 19, 28, 29, 30, 31), input2);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Interleaves 3 registers back into up to 4 records of 3 float4 values and stores them.
+		// This is the inverse of qvv_avx512_load_records4.
+		//////////////////////////////////////////////////////////////////////////
+		inline void qvv_avx512_store_records4(__m512 first, __m512 second, __m512 third, float* output, uint32_t num_floats) RTM_NO_EXCEPT
+		{
+			// The third float4 of the first permutations is a placeholder replaced by the second ones
+			const __m512 output0 = _mm512_permutex2var_ps(first, _mm512_setr_epi32(0, 1, 2, 3, 16, 17, 18, 19, 0, 1, 2, 3, 4, 5, 6, 7), second);
+			const __m512 output1 = _mm512_permutex2var_ps(second, _mm512_setr_epi32(4, 5, 6, 7, 20, 21, 22, 23, 0, 1, 2, 3, 8, 9, 10, 11), third);
+			const __m512 output2 = _mm512_permutex2var_ps(third, _mm512_setr_epi32(8, 9, 10, 11, 28, 29, 30, 31, 0, 1, 2, 3, 12, 13, 14, 15), first);
+
+			// [a0 b0 c0 a1] [b1 c1 a2 b2] [c2 a3 b3 c3]
+			_mm512_mask_storeu_ps(output + 0, batch_avx512_mask(num_floats, 0), _mm512_permutex2var_ps(output0, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 16, 17, 18, 19, 12, 13, 14, 15), third));
+			_mm512_mask_storeu_ps(output + 16, batch_avx512_mask(num_floats, 1), _mm512_permutex2var_ps(output1, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 24, 25, 26, 27, 12, 13, 14, 15), first));
+			_mm512_mask_storeu_ps(output + 32, batch_avx512_mask(num_floats, 2), _mm512_permutex2var_ps(output2, _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 28, 29, 30, 31, 12, 13, 14, 15), second));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns how many of the 'num_floats' belong to the group of 4 records at 'group_index'.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t qvv_avx512_group_num_floats(uint32_t num_floats, uint32_t group_index) RTM_NO_EXCEPT
+		{
+			const uint32_t offset = group_index * 48;
+			return num_floats > offset ? num_floats - offset : 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Gathers up to 16 QVV transforms into their component streams.
+		// Missing transforms are zero.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE qvvf_soa16 qvv_gather16(const qvvf* input, uint32_t num_transforms, bool with_scale) RTM_NO_EXCEPT
+		{
+			// Each group of 3 registers holds 4 transforms
+			const float* input_ptr = reinterpret_cast<const float*>(input);
+			const uint32_t num_floats = num_transforms * 12;
+
+			__m512 rotations[4];
+			__m512 translations[4];
+			__m512 scales[4];
+			qvv_avx512_load_records4(input_ptr + 0, qvv_avx512_group_num_floats(num_floats, 0), rotations[0], translations[0], scales[0]);
+			qvv_avx512_load_records4(input_ptr + 48, qvv_avx512_group_num_floats(num_floats, 1), rotations[1], translations[1], scales[1]);
+			qvv_avx512_load_records4(input_ptr + 96, qvv_avx512_group_num_floats(num_floats, 2), rotations[2], translations[2], scales[2]);
+			qvv_avx512_load_records4(input_ptr + 144, qvv_avx512_group_num_floats(num_floats, 3), rotations[3], translations[3], scales[3]);
+
+			qvvf_soa16 result;
+			batch_avx512_transpose_aos_to_soa(rotations[0], rotations[1], rotations[2], rotations[3], result.rotation_x, result.rotation_y, result.rotation_z, result.rotation_w);
+
+			__m512 unused;
+			batch_avx512_transpose_aos_to_soa(translations[0], translations[1], translations[2], translations[3], result.translation_x, result.translation_y, result.translation_z, unused);
+
+			if (with_scale)
+				batch_avx512_transpose_aos_to_soa(scales[0], scales[1], scales[2], scales[3], result.scale_x, result.scale_y, result.scale_z, unused);
+			else
+				result.scale_x = result.scale_y = result.scale_z = _mm512_set1_ps(1.0F);
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 16 pairs of QVV transforms stored as structure of arrays, see qvv_mul_soa4.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE qvvf_soa16 qvv_mul_soa16(const qvvf_soa16& lhs, const qvvf_soa16& rhs, bool with_scale) RTM_NO_EXCEPT
+		{
+			qvvf_soa16 result;
+			quat_mul_soa16(lhs.rotation_x, lhs.rotation_y, lhs.rotation_z, lhs.rotation_w,
+				rhs.rotation_x, rhs.rotation_y, rhs.rotation_z, rhs.rotation_w,
+				result.rotation_x, result.rotation_y, result.rotation_z, result.rotation_w);
+
+			__m512 translation_x = lhs.translation_x;
+			__m512 translation_y = lhs.translation_y;
+			__m512 translation_z = lhs.translation_z;
+			if (with_scale)
+			{
+				translation_x = _mm512_mul_ps(translation_x, rhs.scale_x);
+				translation_y = _mm512_mul_ps(translation_y, rhs.scale_y);
+				translation_z = _mm512_mul_ps(translation_z, rhs.scale_z);
+			}
+
+			// Rotate the translation with: v' = v + w * t + cross(q, t) where t = 2 * cross(q, v)
+			__m512 t_x = batch_avx512_neg_mul_sub(rhs.rotation_z, translation_y, _mm512_mul_ps(rhs.rotation_y, translation_z));
+			__m512 t_y = batch_avx512_neg_mul_sub(rhs.rotation_x, translation_z, _mm512_mul_ps(rhs.rotation_z, translation_x));
+			__m512 t_z = batch_avx512_neg_mul_sub(rhs.rotation_y, translation_x, _mm512_mul_ps(rhs.rotation_x, translation_y));
+			t_x = _mm512_add_ps(t_x, t_x);
+			t_y = _mm512_add_ps(t_y, t_y);
+			t_z = _mm512_add_ps(t_z, t_z);
+
+			const __m512 cross_x = batch_avx512_neg_mul_sub(rhs.rotation_z, t_y, _mm512_mul_ps(rhs.rotation_y, t_z));
+			const __m512 cross_y = batch_avx512_neg_mul_sub(rhs.rotation_x, t_z, _mm512_mul_ps(rhs.rotation_z, t_x));
+			const __m512 cross_z = batch_avx512_neg_mul_sub(rhs.rotation_y, t_x, _mm512_mul_ps(rhs.rotation_x, t_y));
+
+			result.translation_x = _mm512_add_ps(_mm512_add_ps(batch_avx512_mul_add(rhs.rotation_w, t_x, translation_x), cross_x), rhs.translation_x);
+			result.translation_y = _mm512_add_ps(_mm512_add_ps(batch_avx512_mul_add(rhs.rotation_w, t_y, translation_y), cross_y), rhs.translation_y);
+			result.translation_z = _mm512_add_ps(_mm512_add_ps(batch_avx512_mul_add(rhs.rotation_w, t_z, translation_z), cross_z), rhs.translation_z);
+
+			if (with_scale)
+			{
+				result.scale_x = _mm512_mul_ps(lhs.scale_x, rhs.scale_x);
+				result.scale_y = _mm512_mul_ps(lhs.scale_y, rhs.scale_y);
+				result.scale_z = _mm512_mul_ps(lhs.scale_z, rhs.scale_z);
+			}
+			else
+			{
+				result.scale_x = result.scale_y = result.scale_z = _mm512_set1_ps(1.0F);
+			}
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Scatters up to 16 QVV transforms from their component streams.
+		// Like qvv_scatter4, the translation and scale W components are zero.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE void qvv_scatter16(const qvvf_soa16& input, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+		{
+			const __m512 zero = _mm512_setzero_ps();
+
+			__m512 rotations[4];
+			__m512 translations[4];
+			__m512 scales[4];
+			batch_avx512_transpose_soa_to_aos(input.rotation_x, input.rotation_y, input.rotation_z, input.rotation_w, rotations[0], rotations[1], rotations[2], rotations[3]);
+			batch_avx512_transpose_soa_to_aos(input.translation_x, input.translation_y, input.translation_z, zero, translations[0], translations[1], translations[2], translations[3]);
+			batch_avx512_transpose_soa_to_aos(input.scale_x, input.scale_y, input.scale_z, zero, scales[0], scales[1], scales[2], scales[3]);
+
+			float* output_ptr = reinterpret_cast<float*>(output);
+			const uint32_t num_floats = num_transforms * 12;
+			qvv_avx512_store_records4(rotations[0], translations[0], scales[0], output_ptr + 0, qvv_avx512_group_num_floats(num_floats, 0));
+			qvv_avx512_store_records4(rotations[1], translations[1], scales[1], output_ptr + 48, qvv_avx512_group_num_floats(num_floats, 1));
+			qvv_avx512_store_records4(rotations[2], translations[2], scales[2], output_ptr + 96, qvv_avx512_group_num_floats(num_floats, 2));
+			qvv_avx512_store_records4(rotations[3], translations[3], scales[3], output_ptr + 144, qvv_avx512_group_num_floats(num_floats, 3));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts up to 16 QVV transforms into the transposed float3x4f layout, see matrix_from_qvv_aos.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE void matrix_from_qvv_scatter16(const qvvf_soa16& input, float3x4f* output, uint32_t num_transforms) RTM_NO_EXCEPT
+		{
+			// Same as matrix_from_quat_soa4
+			const __m512 x2 = _mm512_add_ps(input.rotation_x, input.rotation_x);
+			const __m512 y2 = _mm512_add_ps(input.rotation_y, input.rotation_y);
+			const __m512 z2 = _mm512_add_ps(input.rotation_z, input.rotation_z);
+			const __m512 xx = _mm512_mul_ps(input.rotation_x, x2);
+			const __m512 xy = _mm512_mul_ps(input.rotation_x, y2);
+			const __m512 xz = _mm512_mul_ps(input.rotation_x, z2);
+			const __m512 yy = _mm512_mul_ps(input.rotation_y, y2);
+			const __m512 yz = _mm512_mul_ps(input.rotation_y, z2);
+			const __m512 zz = _mm512_mul_ps(input.rotation_z, z2);
+			const __m512 wx = _mm512_mul_ps(input.rotation_w, x2);
+			const __m512 wy = _mm512_mul_ps(input.rotation_w, y2);
+			const __m512 wz = _mm512_mul_ps(input.rotation_w, z2);
+			const __m512 one = _mm512_set1_ps(1.0F);
+
+			const __m512 x_axis_x = _mm512_mul_ps(_mm512_sub_ps(one, _mm512_add_ps(yy, zz)), input.scale_x);
+			const __m512 x_axis_y = _mm512_mul_ps(_mm512_add_ps(xy, wz), input.scale_x);
+			const __m512 x_axis_z = _mm512_mul_ps(_mm512_sub_ps(xz, wy), input.scale_x);
+			const __m512 y_axis_x = _mm512_mul_ps(_mm512_sub_ps(xy, wz), input.scale_y);
+			const __m512 y_axis_y = _mm512_mul_ps(_mm512_sub_ps(one, _mm512_add_ps(xx, zz)), input.scale_y);
+			const __m512 y_axis_z = _mm512_mul_ps(_mm512_add_ps(yz, wx), input.scale_y);
+			const __m512 z_axis_x = _mm512_mul_ps(_mm512_add_ps(xz, wy), input.scale_z);
+			const __m512 z_axis_y = _mm512_mul_ps(_mm512_sub_ps(yz, wx), input.scale_z);
+			const __m512 z_axis_z = _mm512_mul_ps(_mm512_sub_ps(one, _mm512_add_ps(xx, yy)), input.scale_z);
+
+			// Each transform has 3 rows of 4 floats, the same record layout as a QVV transform
+			__m512 x_rows[4];
+			__m512 y_rows[4];
+			__m512 z_rows[4];
+			batch_avx512_transpose_soa_to_aos(x_axis_x, y_axis_x, z_axis_x, input.translation_x, x_rows[0], x_rows[1], x_rows[2], x_rows[3]);
+			batch_avx512_transpose_soa_to_aos(x_axis_y, y_axis_y, z_axis_y, input.translation_y, y_rows[0], y_rows[1], y_rows[2], y_rows[3]);
+			batch_avx512_transpose_soa_to_aos(x_axis_z, y_axis_z, z_axis_z, input.translation_z, z_rows[0], z_rows[1], z_rows[2], z_rows[3]);
+
+			float* output_ptr = &output->x_row.x;
+			const uint32_t num_floats = num_transforms * 12;
+			qvv_avx512_store_records4(x_rows[0], y_rows[0], z_rows[0], output_ptr + 0, qvv_avx512_group_num_floats(num_floats, 0));
+			qvv_avx512_store_records4(x_rows[1], y_rows[1], z_rows[1], output_ptr + 48, qvv_avx512_group_num_floats(num_floats, 1));
+			qvv_avx512_store_records4(x_rows[2], y_rows[2], z_rows[2], output_ptr + 96, qvv_avx512_group_num_floats(num_floats, 2));
+			qvv_avx512_store_records4(x_rows[3], y_rows[3], z_rows[3], output_ptr + 144, qvv_avx512_group_num_floats(num_floats, 3));
+		}
+#endif
+
+		template<qvv_scale_mode scale_mode>
+		inline void qvv_mul_aos_impl(const qvvf* lhs, const qvvf* rhs, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+		{
+			constexpr bool with_scale = scale_mode != qvv_scale_mode::none;
+
+			uint32_t transform_index = 0;
+
+#if defined(RTM_AVX512_INTRINSICS)
+			// Negative scale keeps the 4 wide code path and its matrix fallback
+			if (!static_condition<scale_mode == qvv_scale_mode::any>::test())
+			{
+				// 16 transforms per iteration, the last one is masked: no transform is left for the loops below
+				for (; transform_index < num_transforms; transform_index += 16)
+				{
+					const uint32_t num_remaining = num_transforms - transform_index;
+					const uint32_t num_transforms16 = num_remaining < 16 ? num_remaining : 16;
+
+					const qvvf_soa16 lhs16 = qvv_gather16(lhs + transform_index, num_transforms16, with_scale);
+					const qvvf_soa16 rhs16 = qvv_gather16(rhs + transform_index, num_transforms16, with_scale);
+					qvv_scatter16(qvv_mul_soa16(lhs16, rhs16, with_scale), output + transform_index, num_transforms16);
+				}
+			}
+#endif
+
+			for (; transform_index + 4 <= num_transforms; transform_index += 4)
+			{
+				const qvvf_soa4 lhs4 = qvv_gather4(lhs[transform_index + 0], lhs[transform_index + 1], lhs[transform_index + 2], lhs[transform_index + 3], with_scale);
+				const qvvf_soa4 rhs4 = qvv_gather4(rhs[transform_index + 0], rhs[transform_index + 1], rhs[transform_index + 2], rhs[transform_index + 3], with_scale);
+				const qvvf_soa4 result = qvv_mul_soa4<scale_mode>(lhs4, rhs4);
+				qvv_scatter4(result, output[transform_index + 0], output[transform_index + 1], output[transform_index + 2], output[transform_index + 3]);
+			}
+
+			for (; transform_index < num_transforms; ++transform_index)
+				output[transform_index] = with_scale ? qvv_mul(lhs[transform_index], rhs[transform_index]) : qvv_mul_no_scale(lhs[transform_index], rhs[transform_index]);
+		}
+
+		template<bool with_scale>
+		inline void qvv_inverse_aos_impl(const qvvf* input, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+		{
+			uint32_t transform_index = 0;
+			for (; transform_index + 4 <= num_transforms; transform_index += 4)
+			{
+				const qvvf_soa4 input4 = qvv_gather4(input[transform_index + 0], input[transform_index + 1], input[transform_index + 2], input[transform_index + 3], with_scale);
+				const qvvf_soa4 result = qvv_inverse_soa4(input4, with_scale);
+				qvv_scatter4(result, output[transform_index + 0], output[transform_index + 1], output[transform_index + 2], output[transform_index + 3]);
+			}
+
+			for (; transform_index < num_transforms; ++transform_index)
+				output[transform_index] = with_scale ? qvv_inverse(input[transform_index]) : qvv_inverse_no_scale(input[transform_index]);
+		}
+
+		template<qvv_scale_mode scale_mode>
+		inline void qvv_local_to_object_impl(const transform_hierarchy& hierarchy, const qvvf* local_transforms, qvvf* object_transforms) RTM_NO_EXCEPT
+		{
+			constexpr bool with_scale = scale_mode != qvv_scale_mode::none;
+
+			const uint32_t* parent_indices = hierarchy.parent_indices;
+			const uint32_t* sorted_indices = hierarchy.sorted_indices;
+
+			for (uint32_t depth = 0; depth < hierarchy.num_depths; ++depth)
+			{
+				const uint32_t depth_end = hierarchy.depth_offsets[depth + 1];
+				uint32_t sorted_index = hierarchy.depth_offsets[depth];
+
+				if (depth == 0)
+				{
+					// Roots are already in object space
+					for (; sorted_index < depth_end; ++sorted_index)
+					{
+						const uint32_t transform_index = sorted_indices[sorted_index];
+						const qvvf& local_transform = local_transforms[transform_index];
+						object_transforms[transform_index] = with_scale ? local_transform : qvv_set(local_transform.rotation, local_transform.translation, vector_set(1.0F));
+					}
+
+					continue;
+				}
+
+				// Transforms at the same depth are independent, process them 4 at a time with one per SIMD lane
+				for (; sorted_index + 4 <= depth_end; sorted_index += 4)
+				{
+					const uint32_t transform_index0 = sorted_indices[sorted_index + 0];
+					const uint32_t transform_index1 = sorted_indices[sorted_index + 1];
+					const uint32_t transform_index2 = sorted_indices[sorted_index + 2];
+					const uint32_t transform_index3 = sorted_indices[sorted_index + 3];
+
+					const qvvf& parent0 = object_transforms[parent_indices[transform_index0]];
+					const qvvf& parent1 = object_transforms[parent_indices[transform_index1]];
+					const qvvf& parent2 = object_transforms[parent_indices[transform_index2]];
+					const qvvf& parent3 = object_transforms[parent_indices[transform_index3]];
+
+					const qvvf_soa4 lhs = qvv_gather4(local_transforms[transform_index0], local_transforms[transform_index1], local_transforms[transform_index2], local_transforms[transform_index3], with_scale);
+					const qvvf_soa4 rhs = qvv_gather4(parent0, parent1, parent2, parent3, with_scale);
+
+					const qvvf_soa4 result = qvv_mul_soa4<scale_mode>(lhs, rhs);
+					qvv_scatter4(result, object_transforms[transform_index0], object_transforms[transform_index1], object_transforms[transform_index2], object_transforms[transform_index3]);
+				}
+
+				for (; sorted_index < depth_end; ++sorted_index)
+				{
+					const uint32_t transform_index = sorted_indices[sorted_index];
+					const qvvf& parent = object_transforms[parent_indices[transform_index]];
+					object_transforms[transform_index] = with_scale ? qvv_mul(local_transforms[transform_index], parent) : qvv_mul_no_scale(local_transforms[transform_index], parent);
+				}
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Multiplies 4 QVV transforms with their parent, the negative scale code path
+		// is only used when one of them has a negative scale.
+		template<qvv_scale_mode scale_mode>
+		inline void qvv_local_to_object_dirty4(const transform_hierarchy& hierarchy, const qvvf* local_transforms, qvvf* object_transforms, const uint32_t (&transform_indices)[4]) RTM_NO_EXCEPT
+		{
+			constexpr bool with_scale = scale_mode != qvv_scale_mode::none;
+
+			const uint32_t* parent_indices = hierarchy.parent_indices;
+			const uint32_t transform_index0 = transform_indices[0];
+			const uint32_t transform_index1 = transform_indices[1];
+			const uint32_t transform_index2 = transform_indices[2];
+			const uint32_t transform_index3 = transform_indices[3];
+
+			const qvvf& parent0 = object_transforms[parent_indices[transform_index0]];
+			const qvvf& parent1 = object_transforms[parent_indices[transform_index1]];
+			const qvvf& parent2 = object_transforms[parent_indices[transform_index2]];
+			const qvvf& parent3 = object_transforms[parent_indices[transform_index3]];
+
+			const qvvf_soa4 lhs = qvv_gather4(local_transforms[transform_index0], local_transforms[transform_index1], local_transforms[transform_index2], local_transforms[transform_index3], with_scale);
+			const qvvf_soa4 rhs = qvv_gather4(parent0, parent1, parent2, parent3, with_scale);
+
+			qvvf_soa4 result;
+			if (static_condition<scale_mode == qvv_scale_mode::none>::test())
+				result = qvv_mul_soa4<qvv_scale_mode::none>(lhs, rhs);
+			else
+			{
+				const vector4f lhs_min_scale = vector_min(vector_min(lhs.scale_x, lhs.scale_y), lhs.scale_z);
+				const vector4f rhs_min_scale = vector_min(vector_min(rhs.scale_x, rhs.scale_y), rhs.scale_z);
+				if (vector_any_less_than(vector_min(lhs_min_scale, rhs_min_scale), vector_zero()))
+					result = qvv_mul_soa4<qvv_scale_mode::any>(lhs, rhs);
+				else
+					result = qvv_mul_soa4<qvv_scale_mode::positive>(lhs, rhs);
+			}
+
+			qvv_scatter4(result, object_transforms[transform_index0], object_transforms[transform_index1], object_transforms[transform_index2], object_transforms[transform_index3]);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		template<qvv_scale_mode scale_mode>
+		inline uint32_t qvv_local_to_object_dirty_impl(const transform_hierarchy& hierarchy, const qvvf* local_transforms, qvvf* object_transforms, uint32_t* dirty_bits) RTM_NO_EXCEPT
+		{
+			constexpr bool with_scale = scale_mode != qvv_scale_mode::none;
+
+			const uint32_t* parent_indices = hierarchy.parent_indices;
+			const uint32_t* sorted_indices = hierarchy.sorted_indices;
+
+			uint32_t num_updated = 0;
+			for (uint32_t depth = 0; depth < hierarchy.num_depths; ++depth)
+			{
+				const uint32_t depth_end = hierarchy.depth_offsets[depth + 1];
+				uint32_t sorted_index = hierarchy.depth_offsets[depth];
+
+				if (depth == 0)
+				{
+					// Roots are already in object space
+					for (; sorted_index < depth_end; ++sorted_index)
+					{
+						const uint32_t transform_index = sorted_indices[sorted_index];
+						if ((dirty_bits[transform_index / 32] & (1U << (transform_index % 32))) == 0)
+							continue;
+
+						const qvvf& local_transform = local_transforms[transform_index];
+						object_transforms[transform_index] = with_scale ? local_transform : qvv_set(local_transform.rotation, local_transform.translation, vector_set(1.0F));
+						num_updated++;
+					}
+
+					continue;
+				}
+
+				// Parents at the previous depth are final: a transform is dirty when it or its parent is.
+				// Dirty transforms are collected and processed 4 at a time with one per SIMD lane.
+				uint32_t pending_indices[4];
+				uint32_t num_pending = 0;
+
+				for (; sorted_index < depth_end; ++sorted_index)
+				{
+					const uint32_t transform_index = sorted_indices[sorted_index];
+					const uint32_t parent_index = parent_indices[transform_index];
+					const uint32_t transform_bit = 1U << (transform_index % 32);
+
+					const bool is_dirty = (dirty_bits[transform_index / 32] & transform_bit) != 0 || (dirty_bits[parent_index / 32] & (1U << (parent_index % 32))) != 0;
+					if (!is_dirty)
+						continue;
+
+					dirty_bits[transform_index / 32] |= transform_bit;
+					pending_indices[num_pending++] = transform_index;
+
+					if (num_pending == 4)
+					{
+						qvv_local_to_object_dirty4<scale_mode>(hierarchy, local_transforms, object_transforms, pending_indices);
+						num_pending = 0;
+						num_updated += 4;
+					}
+				}
+
+				for (uint32_t pending_index = 0; pending_index < num_pending; ++pending_index)
+				{
+					const uint32_t transform_index = pending_indices[pending_index];
+					const qvvf& parent = object_transforms[parent_indices[transform_index]];
+					object_transforms[transform_index] = with_scale ? qvv_mul(local_transforms[transform_index], parent) : qvv_mul_no_scale(local_transforms[transform_index], parent);
+				}
+
+				num_updated += num_pending;
+			}
+
+			return num_updated;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if any of the QVV transforms has a negative 3D scale component.
+	// Batch functions use this once up front to pick their positive scale fast path.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool qvv_any_negative_scale(const qvvf* transforms, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_any_negative_scale", num_transforms, num_transforms * sizeof(qvvf));
+		// Independent accumulators to hide the latency of vector_min
+		vector4f min_scale0 = vector_set(1.0F);
+		vector4f min_scale1 = min_scale0;
+		vector4f min_scale2 = min_scale0;
+		vector4f min_scale3 = min_scale0;
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			min_scale0 = vector_min(min_scale0, transforms[transform_index + 0].scale);
+			min_scale1 = vector_min(min_scale1, transforms[transform_index + 1].scale);
+			min_scale2 = vector_min(min_scale2, transforms[transform_index + 2].scale);
+			min_scale3 = vector_min(min_scale3, transforms[transform_index + 3].scale);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+			min_scale0 = vector_min(min_scale0, transforms[transform_index].scale);
+
+		const vector4f min_scale = vector_min(vector_min(min_scale0, min_scale1), vector_min(min_scale2, min_scale3));
+		return vector_any_less_than3(min_scale, vector_zero());
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Compares 'num_transforms' QVV transforms with their value on the previous frame and returns
+	// how many changed. A transform is clean when every component of its rotation, translation,
+	// and scale is within its threshold, like quat_near_equal and vector_all_near_equal3.
+	// A rotation flipped to the other hemisphere is reported as changed.
+	// The output holds one bit per transform, set when it changed:
+	// transform 'i' maps to bit 'i % 32' of dirty_bits[i / 32].
+	// The output must hold (num_transforms + 31) / 32 entries, unused bits of the last entry are cleared.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t qvv_detect_changes_aos(const qvvf* current, const qvvf* previous, uint32_t num_transforms, float rotation_threshold, float translation_threshold, float scale_threshold, uint32_t* dirty_bits) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_detect_changes_aos", num_transforms, num_transforms * sizeof(qvvf) * 2);
+		const vector4f rotation_threshold_v = vector_set(rotation_threshold);
+		const vector4f translation_threshold_v = vector_set(translation_threshold);
+		const vector4f scale_threshold_v = vector_set(scale_threshold);
+		const mask4f w_mask = vector_less_than(vector_set(0.0F, 0.0F, 0.0F, -1.0F), vector_zero());	// Only [w] is set
+
+		uint32_t num_changed = 0;
+		for (uint32_t word_index = 0, transform_index = 0; transform_index < num_transforms; ++word_index)
+		{
+			// Bits are accumulated in a register and each entry is written once
+			const uint32_t word_end = transform_index + 32 <= num_transforms ? transform_index + 32 : num_transforms;
+			uint32_t word = 0;
+
+			for (uint32_t bit_index = 0; transform_index < word_end; ++transform_index, ++bit_index)
+			{
+				const qvvf& current_transform = current[transform_index];
+				const qvvf& previous_transform = previous[transform_index];
+
+				const vector4f rotation_delta = vector_abs(vector_sub(quat_to_vector(current_transform.rotation), quat_to_vector(previous_transform.rotation)));
+				const vector4f translation_delta = vector_abs(vector_sub(current_transform.translation, previous_transform.translation));
+				const vector4f scale_delta = vector_abs(vector_sub(current_transform.scale, previous_transform.scale));
+
+				// The [w] lane of the translation and scale is ignored, the masks are combined before a single movemask
+				const mask4f rotation_clean = vector_less_equal(rotation_delta, rotation_threshold_v);
+				const mask4f translation_clean = vector_less_equal(translation_delta, translation_threshold_v);
+				const mask4f scale_clean = vector_less_equal(scale_delta, scale_threshold_v);
+				const mask4f is_clean = mask_and(rotation_clean, mask_or(mask_and(translation_clean, scale_clean), w_mask));
+
+				if (mask_get_bits(is_clean) != 0xF)
+				{
+					word |= 1U << bit_index;
+					num_changed++;
+				}
+			}
+
+			dirty_bits[word_index] = word;
+		}
+
+		return num_changed;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_transforms' pairs of QVV transforms: output[i] = qvv_mul(lhs[i], rhs[i]).
+	// Transforms are processed 4 at a time without branching. If either input has negative
+	// scale, the matrix code path of qvv_mul is evaluated for every lane and blended in.
+	// Zero scale is not supported.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_aos(const qvvf* lhs, const qvvf* rhs, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_aos", num_transforms, num_transforms * sizeof(qvvf) * 3);
+		if (qvv_any_negative_scale(lhs, num_transforms) || qvv_any_negative_scale(rhs, num_transforms))
+			rtm_impl::qvv_mul_aos_impl<rtm_impl::qvv_scale_mode::any>(lhs, rhs, output, num_transforms);
+		else
+			rtm_impl::qvv_mul_aos_impl<rtm_impl::qvv_scale_mode::positive>(lhs, rhs, output, num_transforms);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_transforms' pairs of QVV transforms ignoring 3D scale:
+	// output[i] = qvv_mul_no_scale(lhs[i], rhs[i]).
+	// The resulting QVV transforms have a [1,1,1] 3D scale.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_no_scale_aos(const qvvf* lhs, const qvvf* rhs, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_no_scale_aos", num_transforms, num_transforms * sizeof(qvvf) * 3);
+		rtm_impl::qvv_mul_aos_impl<rtm_impl::qvv_scale_mode::none>(lhs, rhs, output, num_transforms);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverts 'num_transforms' QVV transforms: output[i] = qvv_inverse(input[i]).
+	// e.g. to compute the inverse bind pose of a skeleton.
+	// Transforms are processed 4 at a time as structure of arrays. Zero scale is not supported.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_inverse_aos(const qvvf* input, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_inverse_aos", num_transforms, num_transforms * sizeof(qvvf) * 2);
+		rtm_impl::qvv_inverse_aos_impl<true>(input, output, num_transforms);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverts 'num_transforms' QVV transforms ignoring 3D scale:
+	// output[i] = qvv_inverse_no_scale(input[i]).
+	// The resulting QVV transforms have a [1,1,1] 3D scale.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_inverse_no_scale_aos(const qvvf* input, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_inverse_no_scale_aos", num_transforms, num_transforms * sizeof(qvvf) * 2);
+		rtm_impl::qvv_inverse_aos_impl<false>(input, output, num_transforms);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies 'num_transforms' QVV transforms gathered by index with their matching
+	// rhs transform: output[i] = qvv_mul(lhs[lhs_indices[i]], rhs[i]).
+	// e.g. to retarget a pose or to map a skeleton onto one of its LODs.
+	// The lhs transform 'prefetch_distance' indices ahead is prefetched, 0 disables it.
+	// Transforms are processed one at a time: transposing gathered transforms costs more than
+	// it saves. Zero scale is not supported.
+	// The output can safely alias the rhs input but not the lhs input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_indexed_aos(const qvvf* lhs, const uint32_t* lhs_indices, const qvvf* rhs, qvvf* output, uint32_t num_transforms, uint32_t prefetch_distance = rtm_impl::k_default_gather_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_indexed_aos", num_transforms, num_transforms * (sizeof(qvvf) * 3 + sizeof(uint32_t)));
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			rtm_impl::batch_prefetch_indexed(lhs, lhs_indices, transform_index, num_transforms, prefetch_distance);
+			output[transform_index] = qvv_mul(lhs[lhs_indices[transform_index]], rhs[transform_index]);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms 'num_points' 3D points, each by a QVV transform gathered by index:
+	// output[i] = qvv_mul_point3(points[i], transforms[transform_indices[i]]).
+	// e.g. to skin vertices influenced by a single bone.
+	// The transform 'prefetch_distance' indices ahead is prefetched, 0 disables it.
+	// With AVX2, the transforms are gathered 8 at a time with _mm256_i32gather_ps.
+	// The output can safely alias the input points.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_mul_point3_indexed_aos(const qvvf* transforms, const uint32_t* transform_indices, const float3f* points, float3f* output, uint32_t num_points, uint32_t prefetch_distance = rtm_impl::k_default_gather_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_mul_point3_indexed_aos", num_points, num_points * (sizeof(qvvf) + sizeof(float3f) * 2 + sizeof(uint32_t)));
+
+		uint32_t point_index = 0;
+
+#if defined(RTM_AVX2_INTRINSICS)
+		const float* transforms_ptr = reinterpret_cast<const float*>(transforms);
+		const __m256i transform_stride = _mm256_set1_epi32(sizeof(qvvf) / sizeof(float));
+
+		for (; point_index + 8 <= num_points; point_index += 8)
+		{
+			for (uint32_t prefetch_index = 0; prefetch_index < 8; ++prefetch_index)
+				rtm_impl::batch_prefetch_indexed(transforms, transform_indices, point_index + prefetch_index, num_points, prefetch_distance);
+
+			const __m256i offsets = _mm256_mullo_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(transform_indices + point_index)), transform_stride);
+
+			const quat8f rotation = {
+				_mm256_i32gather_ps(transforms_ptr + 0, offsets, 4),
+				_mm256_i32gather_ps(transforms_ptr + 1, offsets, 4),
+				_mm256_i32gather_ps(transforms_ptr + 2, offsets, 4),
+				_mm256_i32gather_ps(transforms_ptr + 3, offsets, 4)
+			};
+			const vector3x8f translation = {
+				_mm256_i32gather_ps(transforms_ptr + 4, offsets, 4),
+				_mm256_i32gather_ps(transforms_ptr + 5, offsets, 4),
+				_mm256_i32gather_ps(transforms_ptr + 6, offsets, 4)
+			};
+			const vector3x8f scale = {
+				_mm256_i32gather_ps(transforms_ptr + 8, offsets, 4),
+				_mm256_i32gather_ps(transforms_ptr + 9, offsets, 4),
+				_mm256_i32gather_ps(transforms_ptr + 10, offsets, 4)
+			};
+
+			const vector3x8f points8 = vector3x8_load(points + point_index);
+			vector_store(vector_add(quat_mul_vector3(vector_mul(scale, points8), rotation), translation), output + point_index);
+		}
+#endif
+
+		for (; point_index < num_points; ++point_index)
+		{
+			rtm_impl::batch_prefetch_indexed(transforms, transform_indices, point_index, num_points, prefetch_distance);
+			const vector4f point = vector_load3(points + point_index);
+			vector_store3(qvv_mul_point3(point, transforms[transform_indices[point_index]]), output + point_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts the local space transforms of a hierarchy into object space.
+	// Every transform is multiplied with its parent like qvv_mul(local, parent_object).
+	// Transforms at the same depth are independent and processed 4 at a time. Object space
+	// scale can only be negative if some local scale is, when none is the matrix
+	// code path for negative scale is skipped entirely.
+	// Zero scale is not supported.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_local_to_object(const transform_hierarchy& hierarchy, const qvvf* local_transforms, qvvf* object_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_local_to_object", hierarchy.num_transforms, hierarchy.num_transforms * sizeof(qvvf) * 2);
+		if (qvv_any_negative_scale(local_transforms, hierarchy.num_transforms))
+			rtm_impl::qvv_local_to_object_impl<rtm_impl::qvv_scale_mode::any>(hierarchy, local_transforms, object_transforms);
+		else
+			rtm_impl::qvv_local_to_object_impl<rtm_impl::qvv_scale_mode::positive>(hierarchy, local_transforms, object_transforms);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts the local space transforms of a hierarchy into object space ignoring 3D scale.
+	// Every transform is multiplied with its parent like qvv_mul_no_scale(local, parent_object)
+	// and the resulting QVV transforms have a [1,1,1] 3D scale.
+	// Use this when the hierarchy is known to have no scale.
+	// The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_local_to_object_no_scale(const transform_hierarchy& hierarchy, const qvvf* local_transforms, qvvf* object_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_local_to_object_no_scale", hierarchy.num_transforms, hierarchy.num_transforms * sizeof(qvvf) * 2);
+		rtm_impl::qvv_local_to_object_impl<rtm_impl::qvv_scale_mode::none>(hierarchy, local_transforms, object_transforms);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Updates the object space transforms of a hierarchy when only some of its local space
+	// transforms changed. On input, 'dirty_bits' holds one bit per transform set when its
+	// local transform changed: transform 'i' maps to bit 'i % 32' of dirty_bits[i / 32],
+	// see qvv_detect_changes_aos(..). Only the dirty transforms and their descendants are
+	// multiplied with their parent like qvv_mul(local, parent_object), in depth order and
+	// 4 at a time. Every other object space transform is left untouched and must be up to date.
+	// On output, the bits of the descendants are set as well: they flag every object space
+	// transform that changed. Returns the number of transforms updated.
+	// Zero scale is not supported. The output must not alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t qvv_local_to_object_dirty(const transform_hierarchy& hierarchy, const qvvf* local_transforms, qvvf* object_transforms, uint32_t* dirty_bits) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_local_to_object_dirty", hierarchy.num_transforms, hierarchy.num_transforms * sizeof(uint32_t) * 2);
+		RTM_ASSERT(local_transforms != object_transforms, "The output cannot alias the input");
+		return rtm_impl::qvv_local_to_object_dirty_impl<rtm_impl::qvv_scale_mode::positive>(hierarchy, local_transforms, object_transforms, dirty_bits);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Updates the object space transforms of a hierarchy ignoring 3D scale when only some of
+	// its local space transforms changed, see qvv_local_to_object_dirty(..).
+	// Transforms are multiplied like qvv_mul_no_scale(local, parent_object) and the
+	// resulting QVV transforms have a [1,1,1] 3D scale. Returns the number of transforms updated.
+	// The output must not alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t qvv_local_to_object_no_scale_dirty(const transform_hierarchy& hierarchy, const qvvf* local_transforms, qvvf* object_transforms, uint32_t* dirty_bits) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_local_to_object_no_scale_dirty", hierarchy.num_transforms, hierarchy.num_transforms * sizeof(uint32_t) * 2);
+		RTM_ASSERT(local_transforms != object_transforms, "The output cannot alias the input");
+		return rtm_impl::qvv_local_to_object_dirty_impl<rtm_impl::qvv_scale_mode::none>(hierarchy, local_transforms, object_transforms, dirty_bits);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_transforms' QVV transforms into the transposed float3x4f layout,
+	// the same as matrix_cast(matrix_from_qvv(transform)) but the rows are built directly.
+	// Transforms are processed 4 at a time with one per SIMD lane.
+	// The rotations must be normalized.
+	// With non-temporal stores, the output must be 16 bytes aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_from_qvv_aos(const qvvf* input, float3x4f* output, uint32_t num_transforms, store_mode mode = store_mode::cached) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::matrix_from_qvv_aos", num_transforms, num_transforms * (sizeof(qvvf) + sizeof(float3x4f)));
+		RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+		uint32_t transform_index = 0;
+
+#if defined(RTM_AVX512_INTRINSICS)
+		// Non-temporal stores keep the 4 wide code path, masked stores cannot stream
+		if (mode == store_mode::cached)
+		{
+			// 16 transforms per iteration, the last one is masked: no transform is left for the loops below
+			for (; transform_index < num_transforms; transform_index += 16)
+			{
+				const uint32_t num_remaining = num_transforms - transform_index;
+				const uint32_t num_transforms16 = num_remaining < 16 ? num_remaining : 16;
+
+				const rtm_impl::qvvf_soa16 qvv16 = rtm_impl::qvv_gather16(input + transform_index, num_transforms16, true);
+				rtm_impl::matrix_from_qvv_scatter16(qvv16, output + transform_index, num_transforms16);
+			}
+		}
+#endif
+
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 qvv4 = rtm_impl::qvv_gather4(input[transform_index + 0], input[transform_index + 1], input[transform_index + 2], input[transform_index + 3], true);
+			const rtm_impl::matrix3x3f_soa4 mtx = rtm_impl::matrix_from_qvv_soa4(qvv4);
+
+			// Each stream holds one matrix entry of 4 transforms, transposing gives the rows of each transform
+			vector4f x_row0 = mtx.x_axis[0];
+			vector4f x_row1 = mtx.y_axis[0];
+			vector4f x_row2 = mtx.z_axis[0];
+			vector4f x_row3 = qvv4.translation_x;
+			vector_transpose4x4(x_row0, x_row1, x_row2, x_row3);
+
+			vector4f y_row0 = mtx.x_axis[1];
+			vector4f y_row1 = mtx.y_axis[1];
+			vector4f y_row2 = mtx.z_axis[1];
+			vector4f y_row3 = qvv4.translation_y;
+			vector_transpose4x4(y_row0, y_row1, y_row2, y_row3);
+
+			vector4f z_row0 = mtx.x_axis[2];
+			vector4f z_row1 = mtx.y_axis[2];
+			vector4f z_row2 = mtx.z_axis[2];
+			vector4f z_row3 = qvv4.translation_z;
+			vector_transpose4x4(z_row0, z_row1, z_row2, z_row3);
+
+			float* output_ptr = &output[transform_index].x_row.x;
+			rtm_impl::batch_store(x_row0, output_ptr + 0, mode);
+			rtm_impl::batch_store(y_row0, output_ptr + 4, mode);
+			rtm_impl::batch_store(z_row0, output_ptr + 8, mode);
+			rtm_impl::batch_store(x_row1, output_ptr + 12, mode);
+			rtm_impl::batch_store(y_row1, output_ptr + 16, mode);
+			rtm_impl::batch_store(z_row1, output_ptr + 20, mode);
+			rtm_impl::batch_store(x_row2, output_ptr + 24, mode);
+			rtm_impl::batch_store(y_row2, output_ptr + 28, mode);
+			rtm_impl::batch_store(z_row2, output_ptr + 32, mode);
+			rtm_impl::batch_store(x_row3, output_ptr + 36, mode);
+			rtm_impl::batch_store(y_row3, output_ptr + 40, mode);
+			rtm_impl::batch_store(z_row3, output_ptr + 44, mode);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+			output[transform_index] = matrix_cast(matrix_from_qvv(input[transform_index]));
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decomposes 'num_transforms' 3x4 affine matrices into QVV transforms:
+	// output[i] = qvv_from_matrix(input[i]).
+	// Matrices are processed 4 at a time with one per SIMD lane, the axis lengths are
+	// computed once for both the scale and the rotation.
+	// The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_from_matrix_aos(const matrix3x4f* input, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_from_matrix_aos", num_transforms, num_transforms * (sizeof(matrix3x4f) + sizeof(qvvf)));
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 qvv4 = rtm_impl::qvv_from_matrix_soa4(input + transform_index);
+			rtm_impl::qvv_scatter4(qvv4, output[transform_index + 0], output[transform_index + 1], output[transform_index + 2], output[transform_index + 3]);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+			output[transform_index] = qvv_from_matrix(input[transform_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interpolates 'num_transforms' pairs of QVV transforms with the same alpha value:
+	// output[i] = qvv_lerp(start[i], end[i], alpha).
+	// Transforms are processed 4 at a time with one per SIMD lane, the rotation dot products
+	// used to pick the shortest path are computed lane-wise.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_lerp_aos(const qvvf* start, const qvvf* end, float alpha, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_lerp_aos", num_transforms, num_transforms * sizeof(qvvf) * 3);
+
+		const vector4f alpha4 = vector_set(alpha);
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 start4 = rtm_impl::qvv_gather4(start[transform_index + 0], start[transform_index + 1], start[transform_index + 2], start[transform_index + 3], true);
+			const rtm_impl::qvvf_soa4 end4 = rtm_impl::qvv_gather4(end[transform_index + 0], end[transform_index + 1], end[transform_index + 2], end[transform_index + 3], true);
+			const rtm_impl::qvvf_soa4 result = rtm_impl::qvv_lerp_soa4(start4, end4, alpha4);
+			rtm_impl::qvv_scatter4(result, output[transform_index + 0], output[transform_index + 1], output[transform_index + 2], output[transform_index + 3]);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+			output[transform_index] = qvv_lerp(start[transform_index], end[transform_index], alpha);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Blends 'num_poses' poses of 'num_transforms' QVV transforms each:
+	// output[i] = sum(weights[pose] * poses[pose][i]) with the rotation normalized afterwards.
+	// Every rotation is accumulated on the same side of the hypersphere as the rotation
+	// of the first pose, its weight is negated otherwise. The translation and the scale
+	// are plain weighted sums and as such the weights should add up to 1.0.
+	// This is equivalent to nested qvv_lerp calls when blending 2 poses and is more
+	// accurate and faster than chaining them for more: the rotations are only normalized once.
+	// Transforms are processed 4 at a time with one per SIMD lane and every pose is
+	// accumulated before moving on to the next 4 transforms.
+	// At least one pose is required. The output can safely alias any pose.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_blend_aos(const qvvf* const* poses, const float* weights, uint32_t num_poses, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_blend_aos", num_transforms, num_transforms * sizeof(qvvf) * (num_poses + 1));
+		RTM_ASSERT(num_poses != 0, "At least one pose is required");
+
+		const qvvf* first_pose = poses[0];
+		const float first_weight = weights[0];
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 first = rtm_impl::qvv_gather4(first_pose[transform_index + 0], first_pose[transform_index + 1], first_pose[transform_index + 2], first_pose[transform_index + 3], true);
+			const vector4f first_weight4 = vector_set(first_weight);
+
+			rtm_impl::qvvf_soa4 result;
+			result.rotation_x = vector_mul(first.rotation_x, first_weight4);
+			result.rotation_y = vector_mul(first.rotation_y, first_weight4);
+			result.rotation_z = vector_mul(first.rotation_z, first_weight4);
+			result.rotation_w = vector_mul(first.rotation_w, first_weight4);
+			result.translation_x = vector_mul(first.translation_x, first_weight4);
+			result.translation_y = vector_mul(first.translation_y, first_weight4);
+			result.translation_z = vector_mul(first.translation_z, first_weight4);
+			result.scale_x = vector_mul(first.scale_x, first_weight4);
+			result.scale_y = vector_mul(first.scale_y, first_weight4);
+			result.scale_z = vector_mul(first.scale_z, first_weight4);
+
+			for (uint32_t pose_index = 1; pose_index < num_poses; ++pose_index)
+			{
+				const qvvf* pose = poses[pose_index];
+				const rtm_impl::qvvf_soa4 pose4 = rtm_impl::qvv_gather4(pose[transform_index + 0], pose[transform_index + 1], pose[transform_index + 2], pose[transform_index + 3], true);
+				const vector4f weight = vector_set(weights[pose_index]);
+
+				// If the dot product with the first rotation is negative, we flip the rotation by negating its weight
+				const vector4f dot = vector_mul_add(first.rotation_w, pose4.rotation_w, vector_mul_add(first.rotation_z, pose4.rotation_z, vector_mul_add(first.rotation_y, pose4.rotation_y, vector_mul(first.rotation_x, pose4.rotation_x))));
+				const vector4f rotation_weight = vector_select(vector_less_than(dot, vector_zero()), vector_neg(weight), weight);
+
+				result.rotation_x = vector_mul_add(pose4.rotation_x, rotation_weight, result.rotation_x);
+				result.rotation_y = vector_mul_add(pose4.rotation_y, rotation_weight, result.rotation_y);
+				result.rotation_z = vector_mul_add(pose4.rotation_z, rotation_weight, result.rotation_z);
+				result.rotation_w = vector_mul_add(pose4.rotation_w, rotation_weight, result.rotation_w);
+				result.translation_x = vector_mul_add(pose4.translation_x, weight, result.translation_x);
+				result.translation_y = vector_mul_add(pose4.translation_y, weight, result.translation_y);
+				result.translation_z = vector_mul_add(pose4.translation_z, weight, result.translation_z);
+				result.scale_x = vector_mul_add(pose4.scale_x, weight, result.scale_x);
+				result.scale_y = vector_mul_add(pose4.scale_y, weight, result.scale_y);
+				result.scale_z = vector_mul_add(pose4.scale_z, weight, result.scale_z);
+			}
+
+			rtm_impl::qvv_normalize_rotation_soa4(result);
+			rtm_impl::qvv_scatter4(result, output[transform_index + 0], output[transform_index + 1], output[transform_index + 2], output[transform_index + 3]);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+		{
+			const qvvf& first = first_pose[transform_index];
+			vector4f rotation = vector_mul(quat_to_vector(first.rotation), first_weight);
+			vector4f translation = vector_mul(first.translation, first_weight);
+			vector4f scale = vector_mul(first.scale, first_weight);
+
+			for (uint32_t pose_index = 1; pose_index < num_poses; ++pose_index)
+			{
+				const qvvf& transform = poses[pose_index][transform_index];
+				const float weight = weights[pose_index];
+				const float dot = quat_dot(first.rotation, transform.rotation);
+
+				rotation = vector_mul_add(quat_to_vector(transform.rotation), dot < 0.0F ? -weight : weight, rotation);
+				translation = vector_mul_add(transform.translation, weight, translation);
+				scale = vector_mul_add(transform.scale, weight, scale);
+			}
+
+			output[transform_index] = qvv_set(quat_normalize(vector_to_quat(rotation)), translation, scale);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Applies 'num_transforms' additive QVV transforms on top of a base pose with the same weight:
+	// output[i] = qvv_apply_additive(base[i], additive[i], weight).
+	// Transforms are processed 4 at a time with one per SIMD lane.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_apply_additive_aos(const qvvf* base, const qvvf* additive, float weight, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_apply_additive_aos", num_transforms, num_transforms * sizeof(qvvf) * 3);
+
+		const vector4f weight4 = vector_set(weight);
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 base4 = rtm_impl::qvv_gather4(base[transform_index + 0], base[transform_index + 1], base[transform_index + 2], base[transform_index + 3], true);
+			const rtm_impl::qvvf_soa4 additive4 = rtm_impl::qvv_gather4(additive[transform_index + 0], additive[transform_index + 1], additive[transform_index + 2], additive[transform_index + 3], true);
+			const rtm_impl::qvvf_soa4 result = rtm_impl::qvv_apply_additive_soa4(base4, additive4, weight4);
+			rtm_impl::qvv_scatter4(result, output[transform_index + 0], output[transform_index + 1], output[transform_index + 2], output[transform_index + 3]);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+			output[transform_index] = qvv_apply_additive(base[transform_index], additive[transform_index], weight);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Applies 'num_transforms' additive QVV transforms stored as structure of arrays on top of
+	// a base pose with the same weight: output[i] = qvv_apply_additive(base[i], additive[i], weight).
+	// Each vector4f holds the same component of 4 consecutive transforms, no swizzling is required.
+	// The output can safely alias either input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_apply_additive_soa(const const_qvvf_soa& base, const const_qvvf_soa& additive, float weight, const qvvf_soa& output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_apply_additive_soa", num_transforms, num_transforms * sizeof(float) * 30);
+
+		const vector4f weight4 = vector_set(weight);
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 base4 = rtm_impl::qvv_load_soa4(base, transform_index);
+			const rtm_impl::qvvf_soa4 additive4 = rtm_impl::qvv_load_soa4(additive, transform_index);
+			rtm_impl::qvv_store_soa4(rtm_impl::qvv_apply_additive_soa4(base4, additive4, weight4), output, transform_index);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+		{
+			const qvvf result = qvv_apply_additive(rtm_impl::qvv_load_soa(base, transform_index), rtm_impl::qvv_load_soa(additive, transform_index), weight);
+			rtm_impl::qvv_store_soa(result, output, transform_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts 'num_transforms' additive QVV transforms from a pose and a reference pose:
+	// output[i] = qvv_extract_additive(poses[i], reference[i]).
+	// Rotations are flipped to have a positive [w] component, like the identity they are
+	// interpolated from when applied. The reference scale cannot be zero.
+	// Unlike qvv_apply_additive_aos, transforms are not transposed 4 at a time: extraction
+	// is too little math to pay for the transposes and runs twice as fast one transform
+	// at a time. Store additive poses with qvv_extract_additive_soa when possible.
+	// The output can safely alias either input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_extract_additive_aos(const qvvf* poses, const qvvf* reference, qvvf* output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_extract_additive_aos", num_transforms, num_transforms * sizeof(qvvf) * 3);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			output[transform_index] = qvv_extract_additive(poses[transform_index], reference[transform_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts 'num_transforms' additive QVV transforms stored as structure of arrays,
+	// see qvv_extract_additive_aos.
+	// The output can safely alias either input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_extract_additive_soa(const const_qvvf_soa& poses, const const_qvvf_soa& reference, const qvvf_soa& output, uint32_t num_transforms) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_extract_additive_soa", num_transforms, num_transforms * sizeof(float) * 30);
+
+		uint32_t transform_index = 0;
+		for (; transform_index + 4 <= num_transforms; transform_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 poses4 = rtm_impl::qvv_load_soa4(poses, transform_index);
+			const rtm_impl::qvvf_soa4 reference4 = rtm_impl::qvv_load_soa4(reference, transform_index);
+			rtm_impl::qvv_store_soa4(rtm_impl::qvv_extract_additive_soa4(poses4, reference4), output, transform_index);
+		}
+
+		for (; transform_index < num_transforms; ++transform_index)
+		{
+			const qvvf result = qvv_extract_additive(rtm_impl::qvv_load_soa(poses, transform_index), rtm_impl::qvv_load_soa(reference, transform_index));
+			rtm_impl::qvv_store_soa(result, output, transform_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Reads 'num_transforms' QVV transforms serialized as 3 float4f each: the rotation,
+	// the translation, and the scale. This is the inverse of qvv_store_array.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon.
+	// The input does not need to be aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_load_array(const float4f* input, qvvf* output, uint32_t num_transforms, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_load_array", num_transforms, num_transforms * (sizeof(float4f) * 3 + sizeof(qvvf)));
+		const size_t input_size = size_t(num_transforms) * 3 * sizeof(float4f);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const size_t input_offset = size_t(transform_index) * 3;
+			rtm_impl::batch_prefetch_ahead(input, input_offset * sizeof(float4f), input_size, prefetch_distance);
+
+			float* output_ptr = reinterpret_cast<float*>(output + transform_index);
+			rtm_impl::batch_store(vector_load(input + input_offset + 0), output_ptr + 0, mode);
+			rtm_impl::batch_store(vector_load(input + input_offset + 1), output_ptr + 4, mode);
+			rtm_impl::batch_store(vector_load(input + input_offset + 2), output_ptr + 8, mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Serializes 'num_transforms' QVV transforms as 3 float4f each: the rotation,
+	// the translation, and the scale. Everything is written as-is.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon,
+	// the output must then be 16 bytes aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_store_array(const qvvf* input, float4f* output, uint32_t num_transforms, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_store_array", num_transforms, num_transforms * (sizeof(qvvf) + sizeof(float4f) * 3));
+		RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+		const size_t input_size = size_t(num_transforms) * sizeof(qvvf);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, transform_index * sizeof(qvvf), input_size, prefetch_distance);
+
+			const qvvf& transform = input[transform_index];
+			float* output_ptr = &output[size_t(transform_index) * 3].x;
+			rtm_impl::batch_store(quat_to_vector(transform.rotation), output_ptr + 0, mode);
+			rtm_impl::batch_store(transform.translation, output_ptr + 4, mode);
+			rtm_impl::batch_store(transform.scale, output_ptr + 8, mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 'num_transforms' packed QVV transforms, like qvv_load_packed on every entry.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon.
+	// The input does not need to be aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_load_array(const qvvf_packed* input, qvvf* output, uint32_t num_transforms, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_load_array", num_transforms, num_transforms * (sizeof(qvvf_packed) + sizeof(qvvf)));
+		const size_t input_size = size_t(num_transforms) * sizeof(qvvf_packed);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, transform_index * sizeof(qvvf_packed), input_size, prefetch_distance);
+
+			const qvvf transform = qvv_load_packed(input + transform_index);
+			float* output_ptr = reinterpret_cast<float*>(output + transform_index);
+			rtm_impl::batch_store(quat_to_vector(transform.rotation), output_ptr + 0, mode);
+			rtm_impl::batch_store(transform.translation, output_ptr + 4, mode);
+			rtm_impl::batch_store(transform.scale, output_ptr + 8, mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 'num_transforms' packed QVV transforms with uniform scale, like qvv_load_packed on every entry.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon.
+	// The input does not need to be aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_load_array(const qvvf_packed_uniform_scale* input, qvvf* output, uint32_t num_transforms, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_load_array", num_transforms, num_transforms * (sizeof(qvvf_packed_uniform_scale) + sizeof(qvvf)));
+		const size_t input_size = size_t(num_transforms) * sizeof(qvvf_packed_uniform_scale);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, transform_index * sizeof(qvvf_packed_uniform_scale), input_size, prefetch_distance);
+
+			const qvvf transform = qvv_load_packed(input + transform_index);
+			float* output_ptr = reinterpret_cast<float*>(output + transform_index);
+			rtm_impl::batch_store(quat_to_vector(transform.rotation), output_ptr + 0, mode);
+			rtm_impl::batch_store(transform.translation, output_ptr + 4, mode);
+			rtm_impl::batch_store(transform.scale, output_ptr + 8, mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 'num_transforms' QVV transforms packed, like qvv_store_packed on every entry.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon,
+	// the output must then be 16 bytes aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_store_array(const qvvf* input, qvvf_packed* output, uint32_t num_transforms, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_store_array", num_transforms, num_transforms * (sizeof(qvvf) + sizeof(qvvf_packed)));
+		RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+		const size_t input_size = size_t(num_transforms) * sizeof(qvvf);
+		uint32_t transform_index = 0;
+
+#if defined(RTM_SSE2_INTRINSICS)
+		// 2 packed transforms span exactly 5 registers, with an aligned output every one of them is aligned
+		for (; transform_index + 2 <= num_transforms; transform_index += 2)
+		{
+			rtm_impl::batch_prefetch_ahead(input, transform_index * sizeof(qvvf), input_size, prefetch_distance);
+
+			const qvvf& transform0 = input[transform_index + 0];
+			const qvvf& transform1 = input[transform_index + 1];
+
+			const __m128 tz_tz_sx_sx0 = _mm_shuffle_ps(transform0.translation, transform0.scale, _MM_SHUFFLE(0, 0, 2, 2));
+			const __m128 tx_ty_tz_sx0 = _mm_shuffle_ps(transform0.translation, tz_tz_sx_sx0, _MM_SHUFFLE(2, 0, 1, 0));
+			const __m128 sy_sz_rx_ry = _mm_shuffle_ps(transform0.scale, transform1.rotation, _MM_SHUFFLE(1, 0, 2, 1));
+			const __m128 rz_rw_tx_ty = _mm_shuffle_ps(transform1.rotation, transform1.translation, _MM_SHUFFLE(1, 0, 3, 2));
+			const __m128 tz_tz_sx_sx1 = _mm_shuffle_ps(transform1.translation, transform1.scale, _MM_SHUFFLE(0, 0, 2, 2));
+			const __m128 tz_sx_sy_sz1 = _mm_shuffle_ps(tz_tz_sx_sx1, transform1.scale, _MM_SHUFFLE(2, 1, 2, 0));
+
+			float* output_ptr = &output[transform_index].rotation.x;
+			rtm_impl::batch_store(transform0.rotation, output_ptr + 0, mode);
+			rtm_impl::batch_store(tx_ty_tz_sx0, output_ptr + 4, mode);
+			rtm_impl::batch_store(sy_sz_rx_ry, output_ptr + 8, mode);
+			rtm_impl::batch_store(rz_rw_tx_ty, output_ptr + 12, mode);
+			rtm_impl::batch_store(tz_sx_sy_sz1, output_ptr + 16, mode);
+		}
+#endif
+
+		// With an odd count, the last transform uses regular stores
+		for (; transform_index < num_transforms; ++transform_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, transform_index * sizeof(qvvf), input_size, prefetch_distance);
+			qvv_store_packed(input[transform_index], output + transform_index);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 'num_transforms' QVV transforms packed with uniform scale, like qvv_store_packed on every entry.
+	// Only the [x] component of each scale is written.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon,
+	// the output must then be 16 bytes aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_store_array(const qvvf* input, qvvf_packed_uniform_scale* output, uint32_t num_transforms, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_store_array", num_transforms, num_transforms * (sizeof(qvvf) + sizeof(qvvf_packed_uniform_scale)));
+		RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+		const size_t input_size = size_t(num_transforms) * sizeof(qvvf);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, transform_index * sizeof(qvvf), input_size, prefetch_distance);
+
+			const qvvf& transform = input[transform_index];
+			const vector4f translation_scale = vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(transform.translation, transform.scale);
+
+			float* output_ptr = &output[transform_index].rotation.x;
+			rtm_impl::batch_store(quat_to_vector(transform.rotation), output_ptr + 0, mode);
+			rtm_impl::batch_store(translation_scale, output_ptr + 4, mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,239 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/random.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the first 'count' lanes of a vector, used for the last group of 4 values.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL random_store_partial(vector4f_arg0 input, float* output, uint32_t count) RTM_NO_EXCEPT
+		{
+			float values[4];
+			vector_store(input, &values[0]);
+			for (uint32_t lane_index = 0; lane_index < count; ++lane_index)
+				output[lane_index] = values[lane_index];
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Generates 4 directions on the unit sphere stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL random_unit_sphere_soa4(random_generator& generator, vector4f& out_x, vector4f& out_y, vector4f& out_z) RTM_NO_EXCEPT
+		{
+			const vector4f height_uniform = random_next_uniform(generator);
+			const vector4f angle_uniform = random_next_uniform(generator);
+
+			vector4f sin_angle;
+			vector4f cos_angle;
+			vector_sincos(random_uniform_to_angle(angle_uniform), sin_angle, cos_angle);
+
+			const vector4f radius = random_sphere_radius(height_uniform);
+			out_x = vector_mul(cos_angle, radius);
+			out_y = vector_mul(sin_angle, radius);
+			out_z = vector_neg_mul_sub(height_uniform, 2.0F, vector_set(1.0F));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Generates 4 points inside the unit disk stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL random_unit_disk_soa4(random_generator& generator, vector4f& out_x, vector4f& out_y) RTM_NO_EXCEPT
+		{
+			const vector4f radius = vector_sqrt(random_next_uniform(generator));
+			const vector4f angle_uniform = random_next_uniform(generator);
+
+			vector4f sin_angle;
+			vector4f cos_angle;
+			vector_sincos(random_uniform_to_angle(angle_uniform), sin_angle, cos_angle);
+
+			out_x = vector_mul(cos_angle, radius);
+			out_y = vector_mul(sin_angle, radius);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Generates 4 rotations with Shoemake's method stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL random_quat_soa4(random_generator& generator, vector4f& out_x, vector4f& out_y, vector4f& out_z, vector4f& out_w) RTM_NO_EXCEPT
+		{
+			const vector4f split_uniform = random_next_uniform(generator);
+			const vector4f angle0_uniform = random_next_uniform(generator);
+			const vector4f angle1_uniform = random_next_uniform(generator);
+
+			vector4f sin_angle0;
+			vector4f cos_angle0;
+			vector_sincos(random_uniform_to_angle(angle0_uniform), sin_angle0, cos_angle0);
+
+			vector4f sin_angle1;
+			vector4f cos_angle1;
+			vector_sincos(random_uniform_to_angle(angle1_uniform), sin_angle1, cos_angle1);
+
+			const vector4f radius0 = vector_sqrt(vector_sub(vector_set(1.0F), split_uniform));
+			const vector4f radius1 = vector_sqrt(split_uniform);
+			out_x = vector_mul(sin_angle0, radius0);
+			out_y = vector_mul(cos_angle0, radius0);
+			out_z = vector_mul(sin_angle1, radius1);
+			out_w = vector_mul(cos_angle1, radius1);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Fills 'count' values uniformly distributed in [0.0, 1.0).
+	// Values are generated 4 at a time: the output is identical to storing successive
+	// random_next_uniform(..) results and the last group is truncated.
+	// The output does not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void random_uniform_soa(random_generator& generator, float* output, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::random_uniform_soa", count, count * sizeof(float));
+
+		uint32_t index = 0;
+		for (; index + 4 <= count; index += 4)
+			vector_store(random_next_uniform(generator), output + index);
+
+		if (index < count)
+			rtm_impl::random_store_partial(random_next_uniform(generator), output + index, count - index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Fills 'count' directions uniformly distributed on the unit sphere, stored as structure of arrays.
+	// Directions are generated 4 at a time and every lane is used.
+	// The streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void random_unit_sphere_soa(random_generator& generator, const float3f_soa& output, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::random_unit_sphere_soa", count, count * sizeof(float) * 3);
+
+		uint32_t index = 0;
+		for (; index + 4 <= count; index += 4)
+		{
+			vector4f x;
+			vector4f y;
+			vector4f z;
+			rtm_impl::random_unit_sphere_soa4(generator, x, y, z);
+
+			vector_store(x, output.x + index);
+			vector_store(y, output.y + index);
+			vector_store(z, output.z + index);
+		}
+
+		if (index < count)
+		{
+			vector4f x;
+			vector4f y;
+			vector4f z;
+			rtm_impl::random_unit_sphere_soa4(generator, x, y, z);
+
+			const uint32_t num_remaining = count - index;
+			rtm_impl::random_store_partial(x, output.x + index, num_remaining);
+			rtm_impl::random_store_partial(y, output.y + index, num_remaining);
+			rtm_impl::random_store_partial(z, output.z + index, num_remaining);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Fills 'count' points uniformly distributed inside the unit disk, stored as structure of arrays.
+	// Points are generated 4 at a time and every lane is used.
+	// The streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void random_unit_disk_soa(random_generator& generator, float* output_x, float* output_y, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::random_unit_disk_soa", count, count * sizeof(float) * 2);
+
+		uint32_t index = 0;
+		for (; index + 4 <= count; index += 4)
+		{
+			vector4f x;
+			vector4f y;
+			rtm_impl::random_unit_disk_soa4(generator, x, y);
+
+			vector_store(x, output_x + index);
+			vector_store(y, output_y + index);
+		}
+
+		if (index < count)
+		{
+			vector4f x;
+			vector4f y;
+			rtm_impl::random_unit_disk_soa4(generator, x, y);
+
+			const uint32_t num_remaining = count - index;
+			rtm_impl::random_store_partial(x, output_x + index, num_remaining);
+			rtm_impl::random_store_partial(y, output_y + index, num_remaining);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Fills 'count' rotations uniformly distributed over SO(3) with Shoemake's method,
+	// stored as structure of arrays. The rotations are normalized.
+	// Rotations are generated 4 at a time and every lane is used.
+	// The streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void random_quat_soa(random_generator& generator, const float4f_soa& output, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::random_quat_soa", count, count * sizeof(float) * 4);
+
+		uint32_t index = 0;
+		for (; index + 4 <= count; index += 4)
+		{
+			vector4f x;
+			vector4f y;
+			vector4f z;
+			vector4f w;
+			rtm_impl::random_quat_soa4(generator, x, y, z, w);
+
+			vector_store(x, output.x + index);
+			vector_store(y, output.y + index);
+			vector_store(z, output.z + index);
+			vector_store(w, output.w + index);
+		}
+
+		if (index < count)
+		{
+			vector4f x;
+			vector4f y;
+			vector4f z;
+			vector4f w;
+			rtm_impl::random_quat_soa4(generator, x, y, z, w);
+
+			const uint32_t num_remaining = count - index;
+			rtm_impl::random_store_partial(x, output.x + index, num_remaining);
+			rtm_impl::random_store_partial(y, output.y + index, num_remaining);
+			rtm_impl::random_store_partial(z, output.z + index, num_remaining);
+			rtm_impl::random_store_partial(w, output.w + index, num_remaining);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,495 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Quantized samples stored as structure of arrays: one 16 bit stream per component.
+	// The [w] stream is unused by the 3D variants and can be null.
+	//////////////////////////////////////////////////////////////////////////
+	struct const_quantized4_soa
+	{
+		const uint16_t* x;
+		const uint16_t* y;
+		const uint16_t* z;
+		const uint16_t* w;
+	};
+
+	struct quantized4_soa
+	{
+		uint16_t* x;
+		uint16_t* y;
+		uint16_t* z;
+		uint16_t* w;
+
+		constexpr operator const_quantized4_soa() const RTM_NO_EXCEPT { return const_quantized4_soa{ x, y, z, w }; }
+	};
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Accumulates the smallest and largest values of 4 streams of 'num_samples' values.
+		// Each lane of the results holds the value of one stream. With 3 streams, the [z]
+		// stream is read twice.
+		//////////////////////////////////////////////////////////////////////////
+		inline void range_min_max_soa(const float* x, const float* y, const float* z, const float* w, uint32_t num_samples, vector4f& out_min, vector4f& out_max) RTM_NO_EXCEPT
+		{
+			vector4f min_value = vector_set(x[0], y[0], z[0], w[0]);
+			vector4f max_value = min_value;
+			uint32_t sample_index = 0;
+
+			if (num_samples >= 4)
+			{
+				// Every stream has its own accumulators, they are transposed once at the end
+				vector4f min_x = vector_load(x);
+				vector4f min_y = vector_load(y);
+				vector4f min_z = vector_load(z);
+				vector4f min_w = vector_load(w);
+				vector4f max_x = min_x;
+				vector4f max_y = min_y;
+				vector4f max_z = min_z;
+				vector4f max_w = min_w;
+
+				for (sample_index = 4; sample_index + 4 <= num_samples; sample_index += 4)
+				{
+					const vector4f sample_x = vector_load(x + sample_index);
+					const vector4f sample_y = vector_load(y + sample_index);
+					const vector4f sample_z = vector_load(z + sample_index);
+					const vector4f sample_w = vector_load(w + sample_index);
+
+					min_x = vector_min(min_x, sample_x);
+					min_y = vector_min(min_y, sample_y);
+					min_z = vector_min(min_z, sample_z);
+					min_w = vector_min(min_w, sample_w);
+					max_x = vector_max(max_x, sample_x);
+					max_y = vector_max(max_y, sample_y);
+					max_z = vector_max(max_z, sample_z);
+					max_w = vector_max(max_w, sample_w);
+				}
+
+				vector_transpose4x4(min_x, min_y, min_z, min_w);
+				vector_transpose4x4(max_x, max_y, max_z, max_w);
+				min_value = vector_min(vector_min(min_x, min_y), vector_min(min_z, min_w));
+				max_value = vector_max(vector_max(max_x, max_y), vector_max(max_z, max_w));
+			}
+
+			for (; sample_index < num_samples; ++sample_index)
+			{
+				const vector4f sample = vector_set(x[sample_index], y[sample_index], z[sample_index], w[sample_index]);
+				min_value = vector_min(min_value, sample);
+				max_value = vector_max(max_value, sample);
+			}
+
+			out_min = min_value;
+			out_max = max_value;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the reciprocal of the range extent or 0.0 when it is zero, see vector_range_reduce.
+		//////////////////////////////////////////////////////////////////////////
+		inline float range_inv_extent(float range_extent) RTM_NO_EXCEPT
+		{
+			return range_extent == 0.0F ? 0.0F : (1.0F / range_extent);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Remaps a stream of 'num_samples' values into [0.0, 1.0].
+		//////////////////////////////////////////////////////////////////////////
+		inline void range_reduce_stream(const float* input, float range_min, float range_extent, float* output, uint32_t num_samples) RTM_NO_EXCEPT
+		{
+			const float inv_range_extent = range_inv_extent(range_extent);
+			const vector4f range_min_v = vector_set(range_min);
+			const vector4f inv_range_extent_v = vector_set(inv_range_extent);
+
+			uint32_t sample_index = 0;
+			for (; sample_index + 4 <= num_samples; sample_index += 4)
+				vector_store(vector_mul(vector_sub(vector_load(input + sample_index), range_min_v), inv_range_extent_v), output + sample_index);
+
+			for (; sample_index < num_samples; ++sample_index)
+				output[sample_index] = (input[sample_index] - range_min) * inv_range_extent;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Remaps a stream of 'num_samples' values from [0.0, 1.0] back into their range.
+		//////////////////////////////////////////////////////////////////////////
+		inline void range_expand_stream(const float* input, float range_min, float range_extent, float* output, uint32_t num_samples) RTM_NO_EXCEPT
+		{
+			const vector4f range_min_v = vector_set(range_min);
+			const vector4f range_extent_v = vector_set(range_extent);
+
+			uint32_t sample_index = 0;
+			for (; sample_index + 4 <= num_samples; sample_index += 4)
+				vector_store(vector_mul_add(vector_load(input + sample_index), range_extent_v, range_min_v), output + sample_index);
+
+			for (; sample_index < num_samples; ++sample_index)
+				output[sample_index] = float(vector_get_x(vector_mul_add(vector_set(input[sample_index]), range_extent_v, range_min_v)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Stores 4 integral values in [0, 65535] as 16 bit integers.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL range_store_u16(vector4f_arg0 input, uint16_t* output) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE4_INTRINSICS)
+			const __m128i input_i32 = _mm_cvttps_epi32(input);
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packus_epi32(input_i32, input_i32));
+#elif defined(RTM_SSE2_INTRINSICS)
+			// SSE2 lacks an unsigned saturating pack, bias the values to fit in a signed 16 bit integer and flip the sign bit back
+			const __m128i input_i32 = _mm_sub_epi32(_mm_cvttps_epi32(input), _mm_set1_epi32(32768));
+			_mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_xor_si128(_mm_packs_epi32(input_i32, input_i32), _mm_set1_epi16(-32768)));
+#elif defined(RTM_NEON_INTRINSICS)
+			vst1_u16(output, vmovn_u32(vcvtq_u32_f32(input)));
+#else
+			output[0] = uint16_t(float(vector_get_x(input)));
+			output[1] = uint16_t(float(vector_get_y(input)));
+			output[2] = uint16_t(float(vector_get_z(input)));
+			output[3] = uint16_t(float(vector_get_w(input)));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads 4 16 bit integers as floats.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL range_load_u16(const uint16_t* input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			const __m128i input_u16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input));
+			return _mm_cvtepi32_ps(_mm_unpacklo_epi16(input_u16, _mm_setzero_si128()));
+#elif defined(RTM_NEON_INTRINSICS)
+			return vcvtq_f32_u32(vmovl_u16(vld1_u16(input)));
+#else
+			return vector_set(float(input[0]), float(input[1]), float(input[2]), float(input[3]));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Remaps a stream of 'num_samples' values into [0.0, 1.0] and quantizes them on 'num_bits' bits.
+		//////////////////////////////////////////////////////////////////////////
+		inline void range_reduce_quantize_stream(const float* input, float range_min, float range_extent, uint32_t num_bits, uint16_t* output, uint32_t num_samples) RTM_NO_EXCEPT
+		{
+			const vector4f range_min_v = vector_set(range_min);
+			const vector4f inv_range_extent_v = vector_set(range_inv_extent(range_extent));
+			const vector4f max_value = vector_set(float((1U << num_bits) - 1));
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+			const vector4f half = vector_set(0.5F);
+
+			// The values are positive once clamped, adding 0.5 before truncating rounds them to the nearest integer
+			uint32_t sample_index = 0;
+			for (; sample_index + 4 <= num_samples; sample_index += 4)
+			{
+				const vector4f normalized = vector_clamp(vector_mul(vector_sub(vector_load(input + sample_index), range_min_v), inv_range_extent_v), zero, one);
+				range_store_u16(vector_mul_add(normalized, max_value, half), output + sample_index);
+			}
+
+			if (sample_index < num_samples)
+			{
+				const uint32_t num_remaining = num_samples - sample_index;
+				float samples[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+				for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+					samples[lane_index] = input[sample_index + lane_index];
+
+				const vector4f normalized = vector_clamp(vector_mul(vector_sub(vector_load(&samples[0]), range_min_v), inv_range_extent_v), zero, one);
+
+				uint16_t quantized[4];
+				range_store_u16(vector_mul_add(normalized, max_value, half), &quantized[0]);
+
+				for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+					output[sample_index + lane_index] = quantized[lane_index];
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Dequantizes a stream of 'num_samples' values quantized on 'num_bits' bits and remaps
+		// them back into their range. The scale is folded into the range extent: a single
+		// multiply-add per value.
+		//////////////////////////////////////////////////////////////////////////
+		inline void range_dequantize_expand_stream(const uint16_t* input, uint32_t num_bits, float range_min, float range_extent, float* output, uint32_t num_samples) RTM_NO_EXCEPT
+		{
+			const vector4f range_min_v = vector_set(range_min);
+			const vector4f scale = vector_set(range_extent / float((1U << num_bits) - 1));
+
+			uint32_t sample_index = 0;
+			for (; sample_index + 4 <= num_samples; sample_index += 4)
+				vector_store(vector_mul_add(range_load_u16(input + sample_index), scale, range_min_v), output + sample_index);
+
+			for (; sample_index < num_samples; ++sample_index)
+				output[sample_index] = float(vector_get_x(vector_mul_add(vector_set(float(input[sample_index])), scale, range_min_v)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Dequantizes and range expands the [xyz] components of 4 rotations and reconstructs
+		// their [w] component like quat_from_positive_w.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL range_dequantize_expand_quat4(const const_quantized4_soa& input, vector4f_arg0 scale, vector4f_arg1 range_min, const float4f_soa& output, uint32_t sample_index) RTM_NO_EXCEPT
+		{
+			const vector4f x = vector_mul_add(range_load_u16(input.x + sample_index), vector_dup_x(scale), vector_dup_x(range_min));
+			const vector4f y = vector_mul_add(range_load_u16(input.y + sample_index), vector_dup_y(scale), vector_dup_y(range_min));
+			const vector4f z = vector_mul_add(range_load_u16(input.z + sample_index), vector_dup_z(scale), vector_dup_z(range_min));
+
+			const vector4f w_squared = vector_neg_mul_sub(z, z, vector_neg_mul_sub(y, y, vector_neg_mul_sub(x, x, vector_set(1.0F))));
+
+			vector_store(x, output.x + sample_index);
+			vector_store(y, output.y + sample_index);
+			vector_store(z, output.z + sample_index);
+			vector_store(vector_sqrt(vector_abs(w_squared)), output.w + sample_index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads 8 16 bit integers as floats.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector8f RTM_SIMD_CALL range_load8_u16(const uint16_t* input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX2_INTRINSICS)
+			const __m128i input_u16 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+			return _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(input_u16));
+#else
+			return vector8_set(range_load_u16(input), range_load_u16(input + 4));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Dequantizes and range expands the [xyz] components of 8 rotations and reconstructs
+		// their [w] component like quat_from_positive_w.
+		//////////////////////////////////////////////////////////////////////////
+		inline void range_dequantize_expand_quat8(const const_quantized4_soa& input, const vector3x8f& scale, const vector3x8f& range_min, const float4f_soa& output, uint32_t sample_index) RTM_NO_EXCEPT
+		{
+			const vector8f x = vector_mul_add(range_load8_u16(input.x + sample_index), scale.x, range_min.x);
+			const vector8f y = vector_mul_add(range_load8_u16(input.y + sample_index), scale.y, range_min.y);
+			const vector8f z = vector_mul_add(range_load8_u16(input.z + sample_index), scale.z, range_min.z);
+
+			// Like quat_from_positive_w, the squared value can be slightly negative due to quantization
+			const vector8f w_squared = vector_neg_mul_sub(z, z, vector_neg_mul_sub(y, y, vector_neg_mul_sub(x, x, vector8_set(1.0F))));
+
+			vector_store(x, output.x + sample_index);
+			vector_store(y, output.y + sample_index);
+			vector_store(z, output.z + sample_index);
+			vector_store(vector_sqrt(vector_abs(w_squared)), output.w + sample_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the range of 'num_samples' vector4 or quaternion samples of a track stored
+	// as structure of arrays: the smallest value and the extent up to the largest value of
+	// every component. The samples must hold at least one value.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_range_soa(const const_float4f_soa& samples, uint32_t num_samples, vector4f& out_range_min, vector4f& out_range_extent) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_range_soa", num_samples, num_samples * sizeof(float) * 4);
+		RTM_ASSERT(num_samples != 0, "At least one sample is required");
+
+		vector4f range_max;
+		rtm_impl::range_min_max_soa(samples.x, samples.y, samples.z, samples.w, num_samples, out_range_min, range_max);
+		out_range_extent = vector_sub(range_max, out_range_min);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the range of 'num_samples' vector3 samples of a track stored as structure
+	// of arrays. The [w] component of the range is 0.0. The samples must hold at least one value.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_range_soa(const const_float3f_soa& samples, uint32_t num_samples, vector4f& out_range_min, vector4f& out_range_extent) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_range_soa", num_samples, num_samples * sizeof(float) * 3);
+		RTM_ASSERT(num_samples != 0, "At least one sample is required");
+
+		vector4f range_min;
+		vector4f range_max;
+		rtm_impl::range_min_max_soa(samples.x, samples.y, samples.z, samples.z, num_samples, range_min, range_max);
+		out_range_min = vector_set_w(range_min, 0.0F);
+		out_range_extent = vector_set_w(vector_sub(range_max, range_min), 0.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Remaps 'num_samples' samples stored as structure of arrays from [range_min, range_min + range_extent]
+	// into [0.0, 1.0], see vector_range_reduce. Components with a zero extent are set to 0.0.
+	// The output can alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_range_reduce_soa(const const_float4f_soa& samples, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float4f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_range_reduce_soa", num_samples, num_samples * sizeof(float) * 4);
+
+		rtm_impl::range_reduce_stream(samples.x, vector_get_x(range_min), vector_get_x(range_extent), output.x, num_samples);
+		rtm_impl::range_reduce_stream(samples.y, vector_get_y(range_min), vector_get_y(range_extent), output.y, num_samples);
+		rtm_impl::range_reduce_stream(samples.z, vector_get_z(range_min), vector_get_z(range_extent), output.z, num_samples);
+		rtm_impl::range_reduce_stream(samples.w, vector_get_w(range_min), vector_get_w(range_extent), output.w, num_samples);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Remaps 'num_samples' vector3 samples stored as structure of arrays into [0.0, 1.0].
+	// The output can alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_range_reduce_soa(const const_float3f_soa& samples, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float3f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_range_reduce_soa", num_samples, num_samples * sizeof(float) * 3);
+
+		rtm_impl::range_reduce_stream(samples.x, vector_get_x(range_min), vector_get_x(range_extent), output.x, num_samples);
+		rtm_impl::range_reduce_stream(samples.y, vector_get_y(range_min), vector_get_y(range_extent), output.y, num_samples);
+		rtm_impl::range_reduce_stream(samples.z, vector_get_z(range_min), vector_get_z(range_extent), output.z, num_samples);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Remaps 'num_samples' samples stored as structure of arrays from [0.0, 1.0] back into
+	// [range_min, range_min + range_extent], see vector_range_expand. The output can alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_range_expand_soa(const const_float4f_soa& samples, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float4f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_range_expand_soa", num_samples, num_samples * sizeof(float) * 4);
+
+		rtm_impl::range_expand_stream(samples.x, vector_get_x(range_min), vector_get_x(range_extent), output.x, num_samples);
+		rtm_impl::range_expand_stream(samples.y, vector_get_y(range_min), vector_get_y(range_extent), output.y, num_samples);
+		rtm_impl::range_expand_stream(samples.z, vector_get_z(range_min), vector_get_z(range_extent), output.z, num_samples);
+		rtm_impl::range_expand_stream(samples.w, vector_get_w(range_min), vector_get_w(range_extent), output.w, num_samples);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Remaps 'num_samples' vector3 samples stored as structure of arrays from [0.0, 1.0] back
+	// into their range. The output can alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_range_expand_soa(const const_float3f_soa& samples, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float3f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_range_expand_soa", num_samples, num_samples * sizeof(float) * 3);
+
+		rtm_impl::range_expand_stream(samples.x, vector_get_x(range_min), vector_get_x(range_extent), output.x, num_samples);
+		rtm_impl::range_expand_stream(samples.y, vector_get_y(range_min), vector_get_y(range_extent), output.y, num_samples);
+		rtm_impl::range_expand_stream(samples.z, vector_get_z(range_min), vector_get_z(range_extent), output.z, num_samples);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Range reduces 'num_samples' samples stored as structure of arrays and quantizes them as
+	// unsigned normalized integers of 'num_bits' bits, between 1 and 16: [0.0, 1.0] maps onto
+	// [0, 2^num_bits - 1]. Values are clamped and rounded to the nearest integer.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL pack_range_reduce_unorm_soa(const const_float4f_soa& samples, vector4f_arg0 range_min, vector4f_arg1 range_extent, uint32_t num_bits, const quantized4_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::pack_range_reduce_unorm_soa", num_samples, num_samples * sizeof(float) * 4);
+		RTM_ASSERT(num_bits >= 1 && num_bits <= 16, "The number of bits must be between 1 and 16");
+
+		rtm_impl::range_reduce_quantize_stream(samples.x, vector_get_x(range_min), vector_get_x(range_extent), num_bits, output.x, num_samples);
+		rtm_impl::range_reduce_quantize_stream(samples.y, vector_get_y(range_min), vector_get_y(range_extent), num_bits, output.y, num_samples);
+		rtm_impl::range_reduce_quantize_stream(samples.z, vector_get_z(range_min), vector_get_z(range_extent), num_bits, output.z, num_samples);
+		rtm_impl::range_reduce_quantize_stream(samples.w, vector_get_w(range_min), vector_get_w(range_extent), num_bits, output.w, num_samples);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Range reduces and quantizes 'num_samples' vector3 samples stored as structure of arrays.
+	// The [w] output stream is not used.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL pack_range_reduce_unorm_soa(const const_float3f_soa& samples, vector4f_arg0 range_min, vector4f_arg1 range_extent, uint32_t num_bits, const quantized4_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::pack_range_reduce_unorm_soa", num_samples, num_samples * sizeof(float) * 3);
+		RTM_ASSERT(num_bits >= 1 && num_bits <= 16, "The number of bits must be between 1 and 16");
+
+		rtm_impl::range_reduce_quantize_stream(samples.x, vector_get_x(range_min), vector_get_x(range_extent), num_bits, output.x, num_samples);
+		rtm_impl::range_reduce_quantize_stream(samples.y, vector_get_y(range_min), vector_get_y(range_extent), num_bits, output.y, num_samples);
+		rtm_impl::range_reduce_quantize_stream(samples.z, vector_get_z(range_min), vector_get_z(range_extent), num_bits, output.z, num_samples);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Dequantizes 'num_samples' samples packed with pack_range_reduce_unorm_soa and range
+	// expands them. The quantization scale is folded into the range extent, the result can
+	// differ from unpacking and calling vector_range_expand in the last bit.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL unpack_range_expand_unorm_soa(const const_quantized4_soa& input, uint32_t num_bits, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float4f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_range_expand_unorm_soa", num_samples, num_samples * sizeof(uint16_t) * 4);
+		RTM_ASSERT(num_bits >= 1 && num_bits <= 16, "The number of bits must be between 1 and 16");
+
+		rtm_impl::range_dequantize_expand_stream(input.x, num_bits, vector_get_x(range_min), vector_get_x(range_extent), output.x, num_samples);
+		rtm_impl::range_dequantize_expand_stream(input.y, num_bits, vector_get_y(range_min), vector_get_y(range_extent), output.y, num_samples);
+		rtm_impl::range_dequantize_expand_stream(input.z, num_bits, vector_get_z(range_min), vector_get_z(range_extent), output.z, num_samples);
+		rtm_impl::range_dequantize_expand_stream(input.w, num_bits, vector_get_w(range_min), vector_get_w(range_extent), output.w, num_samples);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Dequantizes and range expands 'num_samples' vector3 samples stored as structure of arrays.
+	// The [w] input stream is not used.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL unpack_range_expand_unorm_soa(const const_quantized4_soa& input, uint32_t num_bits, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float3f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_range_expand_unorm_soa", num_samples, num_samples * sizeof(uint16_t) * 3);
+		RTM_ASSERT(num_bits >= 1 && num_bits <= 16, "The number of bits must be between 1 and 16");
+
+		rtm_impl::range_dequantize_expand_stream(input.x, num_bits, vector_get_x(range_min), vector_get_x(range_extent), output.x, num_samples);
+		rtm_impl::range_dequantize_expand_stream(input.y, num_bits, vector_get_y(range_min), vector_get_y(range_extent), output.y, num_samples);
+		rtm_impl::range_dequantize_expand_stream(input.z, num_bits, vector_get_z(range_min), vector_get_z(range_extent), output.z, num_samples);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Dequantizes and range expands the [xyz] components of 'num_samples' rotation samples
+	// packed with pack_range_reduce_unorm_soa and reconstructs their [w] component by assuming
+	// it is positive, like quat_from_positive_w. The [w] input stream is not used.
+	// This is a single pass over the samples: equivalent to unpack_range_expand_unorm_soa
+	// followed by quat_from_positive_w on every sample. Eight rotations are processed per step
+	// with the vector8f functions, a single register per component with AVX, then four.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL unpack_range_expand_quat_unorm_soa(const const_quantized4_soa& input, uint32_t num_bits, vector4f_arg0 range_min, vector4f_arg1 range_extent, const float4f_soa& output, uint32_t num_samples) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_range_expand_quat_unorm_soa", num_samples, num_samples * (sizeof(uint16_t) * 3 + sizeof(float) * 4));
+		RTM_ASSERT(num_bits >= 1 && num_bits <= 16, "The number of bits must be between 1 and 16");
+
+		const vector4f scale = vector_div(range_extent, vector_set(float((1U << num_bits) - 1)));
+		const vector3x8f scale8 = { vector8_set(vector_get_x(scale)), vector8_set(vector_get_y(scale)), vector8_set(vector_get_z(scale)) };
+		const vector3x8f range_min8 = { vector8_set(vector_get_x(range_min)), vector8_set(vector_get_y(range_min)), vector8_set(vector_get_z(range_min)) };
+
+		uint32_t sample_index = 0;
+		for (; sample_index + 8 <= num_samples; sample_index += 8)
+			rtm_impl::range_dequantize_expand_quat8(input, scale8, range_min8, output, sample_index);
+
+		if (sample_index + 4 <= num_samples)
+		{
+			rtm_impl::range_dequantize_expand_quat4(input, scale, range_min, output, sample_index);
+			sample_index += 4;
+		}
+
+		for (; sample_index < num_samples; ++sample_index)
+		{
+			const vector4f quantized = vector_set(float(input.x[sample_index]), float(input.y[sample_index]), float(input.z[sample_index]), 0.0F);
+			const vector4f value = vector_mul_add(quantized, scale, range_min);
+
+			const float x = vector_get_x(value);
+			const float y = vector_get_y(value);
+			const float z = vector_get_z(value);
+			const float w_squared = ((1.0F - x * x) - y * y) - z * z;
+
+			output.x[sample_index] = x;
+			output.y[sample_index] = y;
+			output.z[sample_index] = z;
+			output.w[sample_index] = scalar_sqrt(scalar_abs(w_squared));
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,357 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/mask4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <limits>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Ray intersection kernels.
+	// A ray starts at its origin and extends along its direction: point = origin + direction * t.
+	// The direction does not need to be normalized, every distance returned is the ray parameter 't'
+	// and equals the distance in world units only with a normalized direction.
+	// Hits behind the origin are ignored. Missed primitives have an infinite distance.
+	// Hit bits are packed into uint32_t entries like the frustum culling functions.
+	//////////////////////////////////////////////////////////////////////////
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// 4 rays stored as structure of arrays, one vector4f per component.
+		// When testing a single ray, each component is broadcast in every lane.
+		//////////////////////////////////////////////////////////////////////////
+		struct ray_soa4
+		{
+			vector4f origin_x;
+			vector4f origin_y;
+			vector4f origin_z;
+			vector4f direction_x;
+			vector4f direction_y;
+			vector4f direction_z;
+			vector4f inv_direction_x;
+			vector4f inv_direction_y;
+			vector4f inv_direction_z;
+		};
+
+		inline ray_soa4 RTM_SIMD_CALL ray_soa4_set(vector4f_arg0 origin_x, vector4f_arg1 origin_y, vector4f_arg2 origin_z, vector4f_arg3 direction_x, vector4f_arg4 direction_y, vector4f_arg5 direction_z) RTM_NO_EXCEPT
+		{
+			// A zero direction component yields an infinite reciprocal, the slabs of that axis then never clip the ray
+			const vector4f one = vector_set(1.0F);
+			return ray_soa4{ origin_x, origin_y, origin_z, direction_x, direction_y, direction_z, vector_div(one, direction_x), vector_div(one, direction_y), vector_div(one, direction_z) };
+		}
+
+		inline ray_soa4 RTM_SIMD_CALL ray_soa4_broadcast(vector4f_arg0 origin, vector4f_arg1 direction) RTM_NO_EXCEPT
+		{
+			return ray_soa4_set(vector_dup_x(origin), vector_dup_y(origin), vector_dup_z(origin), vector_dup_x(direction), vector_dup_y(direction), vector_dup_z(direction));
+		}
+
+		inline ray_soa4 RTM_SIMD_CALL ray_soa4_load(const const_float3f_soa& origins, const const_float3f_soa& directions) RTM_NO_EXCEPT
+		{
+			return ray_soa4_set(vector_load(origins.x), vector_load(origins.y), vector_load(origins.z), vector_load(directions.x), vector_load(directions.y), vector_load(directions.z));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads up to 4 values, the last one is repeated in the unused lanes.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL ray_load_partial(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			if (num_values >= 4)
+				return vector_load(input);
+
+			const uint32_t last_index = num_values - 1;
+			return vector_set(input[0], input[1 < last_index ? 1 : last_index], input[2 < last_index ? 2 : last_index], input[last_index]);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Intersects every ray lane with the matching sphere lane.
+		// When the origin is inside the sphere, the distance is zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline mask4f RTM_SIMD_CALL ray_intersect_sphere_soa4(const ray_soa4& ray, vector4f_arg0 center_x, vector4f_arg1 center_y, vector4f_arg2 center_z, vector4f_arg3 radius, vector4f& out_distance) RTM_NO_EXCEPT
+		{
+			// Solves: dot(d, d) * t^2 + 2 * dot(o - c, d) * t + dot(o - c, o - c) - r^2 = 0
+			const vector4f offset_x = vector_sub(ray.origin_x, center_x);
+			const vector4f offset_y = vector_sub(ray.origin_y, center_y);
+			const vector4f offset_z = vector_sub(ray.origin_z, center_z);
+
+			const vector4f a = vector_mul_add(ray.direction_z, ray.direction_z, vector_mul_add(ray.direction_y, ray.direction_y, vector_mul(ray.direction_x, ray.direction_x)));
+			const vector4f half_b = vector_mul_add(offset_z, ray.direction_z, vector_mul_add(offset_y, ray.direction_y, vector_mul(offset_x, ray.direction_x)));
+			const vector4f c = vector_neg_mul_sub(radius, radius, vector_mul_add(offset_z, offset_z, vector_mul_add(offset_y, offset_y, vector_mul(offset_x, offset_x))));
+			const vector4f discriminant = vector_neg_mul_sub(a, c, vector_mul(half_b, half_b));
+
+			const vector4f zero = vector_zero();
+			const vector4f sqrt_discriminant = vector_sqrt(vector_max(discriminant, zero));
+			const vector4f inv_a = vector_div(vector_set(1.0F), a);
+			const vector4f t_near = vector_mul(vector_neg(vector_add(half_b, sqrt_discriminant)), inv_a);
+			const vector4f t_far = vector_mul(vector_sub(sqrt_discriminant, half_b), inv_a);
+
+			const mask4f is_hit = mask_and(vector_greater_equal(discriminant, zero), vector_greater_equal(t_far, zero));
+			out_distance = vector_select(is_hit, vector_max(t_near, zero), vector_set(std::numeric_limits<float>::infinity()));
+			return is_hit;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Intersects every ray lane with the matching box lane using the slab method.
+		// When the origin is inside the box, the distance is zero.
+		// A ray parallel to an axis that lies exactly on a face of the box can go either way.
+		//////////////////////////////////////////////////////////////////////////
+		inline mask4f RTM_SIMD_CALL ray_intersect_aabb_soa4(const ray_soa4& ray, vector4f_arg0 center_x, vector4f_arg1 center_y, vector4f_arg2 center_z, vector4f_arg3 extent_x, vector4f_arg4 extent_y, vector4f_arg5 extent_z, vector4f& out_distance) RTM_NO_EXCEPT
+		{
+			// Distances where the ray enters and leaves each pair of parallel planes
+			const vector4f offset_x = vector_sub(center_x, ray.origin_x);
+			const vector4f offset_y = vector_sub(center_y, ray.origin_y);
+			const vector4f offset_z = vector_sub(center_z, ray.origin_z);
+			const vector4f t0_x = vector_mul(vector_sub(offset_x, extent_x), ray.inv_direction_x);
+			const vector4f t1_x = vector_mul(vector_add(offset_x, extent_x), ray.inv_direction_x);
+			const vector4f t0_y = vector_mul(vector_sub(offset_y, extent_y), ray.inv_direction_y);
+			const vector4f t1_y = vector_mul(vector_add(offset_y, extent_y), ray.inv_direction_y);
+			const vector4f t0_z = vector_mul(vector_sub(offset_z, extent_z), ray.inv_direction_z);
+			const vector4f t1_z = vector_mul(vector_add(offset_z, extent_z), ray.inv_direction_z);
+
+			// The ray is inside the box between the last entry and the first exit
+			const vector4f zero = vector_zero();
+			const vector4f t_enter = vector_max(vector_max(vector_min(t0_x, t1_x), vector_min(t0_y, t1_y)), vector_max(vector_min(t0_z, t1_z), zero));
+			const vector4f t_exit = vector_min(vector_min(vector_max(t0_x, t1_x), vector_max(t0_y, t1_y)), vector_max(t0_z, t1_z));
+
+			const mask4f is_hit = vector_less_equal(t_enter, t_exit);
+			out_distance = vector_select(is_hit, t_enter, vector_set(std::numeric_limits<float>::infinity()));
+			return is_hit;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Intersects every ray lane with the matching plane lane.
+		// Planes are two sided, rays parallel to their plane never hit.
+		//////////////////////////////////////////////////////////////////////////
+		inline mask4f RTM_SIMD_CALL ray_intersect_plane_soa4(const ray_soa4& ray, vector4f_arg0 normal_x, vector4f_arg1 normal_y, vector4f_arg2 normal_z, vector4f_arg3 plane_distance, vector4f& out_distance) RTM_NO_EXCEPT
+		{
+			const vector4f origin_distance = vector_mul_add(ray.origin_z, normal_z, vector_mul_add(ray.origin_y, normal_y, vector_mul_add(ray.origin_x, normal_x, plane_distance)));
+			const vector4f direction_dot = vector_mul_add(ray.direction_z, normal_z, vector_mul_add(ray.direction_y, normal_y, vector_mul(ray.direction_x, normal_x)));
+			const vector4f t = vector_neg(vector_div(origin_distance, direction_dot));
+
+			// A parallel ray yields an infinite distance or NaN, both fail the comparisons
+			const vector4f infinity = vector_set(std::numeric_limits<float>::infinity());
+			const mask4f is_hit = mask_and(vector_greater_equal(t, vector_zero()), vector_less_than(t, infinity));
+			out_distance = vector_select(is_hit, t, infinity);
+			return is_hit;
+		}
+
+		inline void ray_clear_bits(uint32_t* output_bits, uint32_t num_bits) RTM_NO_EXCEPT
+		{
+			const uint32_t num_words = (num_bits + 31) / 32;
+			for (uint32_t word_index = 0; word_index < num_words; ++word_index)
+				output_bits[word_index] = 0;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the hits and distances of 'num_values' primitives tested against one ray.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL ray_store_hits(mask4f_arg0 is_hit, vector4f_arg1 distance, uint32_t primitive_index, uint32_t num_values, float* output_distances, uint32_t* output_hit_bits) RTM_NO_EXCEPT
+		{
+			// Groups of 4 never straddle two output entries
+			if (num_values >= 4)
+			{
+				vector_store(distance, output_distances + primitive_index);
+				output_hit_bits[primitive_index / 32] |= mask_get_bits(is_hit) << (primitive_index % 32);
+			}
+			else
+			{
+				output_distances[primitive_index] = vector_get_x(distance);
+				if (num_values >= 2)
+					output_distances[primitive_index + 1] = vector_get_y(distance);
+				if (num_values >= 3)
+					output_distances[primitive_index + 2] = vector_get_z(distance);
+
+				const uint32_t used_bits = (1U << num_values) - 1;
+				output_hit_bits[primitive_index / 32] |= (mask_get_bits(is_hit) & used_bits) << (primitive_index % 32);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the hits and distances of one primitive tested against 4 rays.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL ray4_store_hits(mask4f_arg0 is_hit, vector4f_arg1 distance, uint32_t primitive_index, float* output_distances, uint32_t* output_hit_bits) RTM_NO_EXCEPT
+		{
+			const uint32_t bit_index = primitive_index * 4;
+			vector_store(distance, output_distances + bit_index);
+			output_hit_bits[bit_index / 32] |= mask_get_bits(is_hit) << (bit_index % 32);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Intersects one ray with 'num_spheres' spheres stored as structure of arrays.
+	// The distance to each sphere is written in 'output_distances', zero if the origin is inside.
+	// Sphere 'i' maps to bit 'i % 32' of output_hit_bits[i / 32], set on hit.
+	// The hit bits must hold (num_spheres + 31) / 32 entries, unused bits are cleared.
+	// Spheres are tested 4 at a time, the ray is broadcast once.
+	//////////////////////////////////////////////////////////////////////////
+	inline void ray_intersect_spheres_soa(vector4f_arg0 origin, vector4f_arg1 direction, const const_float3f_soa& centers, const float* radii, float* output_distances, uint32_t* output_hit_bits, uint32_t num_spheres) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::ray_intersect_spheres_soa", num_spheres, num_spheres * sizeof(float) * 5);
+		rtm_impl::ray_clear_bits(output_hit_bits, num_spheres);
+
+		const rtm_impl::ray_soa4 ray = rtm_impl::ray_soa4_broadcast(origin, direction);
+		for (uint32_t sphere_index = 0; sphere_index < num_spheres; sphere_index += 4)
+		{
+			const uint32_t num_values = num_spheres - sphere_index;
+			const vector4f center_x = rtm_impl::ray_load_partial(centers.x + sphere_index, num_values);
+			const vector4f center_y = rtm_impl::ray_load_partial(centers.y + sphere_index, num_values);
+			const vector4f center_z = rtm_impl::ray_load_partial(centers.z + sphere_index, num_values);
+			const vector4f radius = rtm_impl::ray_load_partial(radii + sphere_index, num_values);
+
+			vector4f distance;
+			const mask4f is_hit = rtm_impl::ray_intersect_sphere_soa4(ray, center_x, center_y, center_z, radius, distance);
+			rtm_impl::ray_store_hits(is_hit, distance, sphere_index, num_values, output_distances, output_hit_bits);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Intersects 4 rays with 'num_spheres' spheres stored as structure of arrays.
+	// The origins and directions hold the 4 rays as structure of arrays.
+	// The distance between sphere 'i' and ray 'r' is written in output_distances[i * 4 + r],
+	// zero if the origin is inside. Its hit bit is 'b % 32' of output_hit_bits[b / 32] with b = i * 4 + r.
+	// The hit bits must hold (num_spheres * 4 + 31) / 32 entries, unused bits are cleared.
+	//////////////////////////////////////////////////////////////////////////
+	inline void ray_intersect_spheres_soa(const const_float3f_soa& origins, const const_float3f_soa& directions, const const_float3f_soa& centers, const float* radii, float* output_distances, uint32_t* output_hit_bits, uint32_t num_spheres) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::ray_intersect_spheres_soa", num_spheres * 4, num_spheres * sizeof(float) * (4 + 4));
+		rtm_impl::ray_clear_bits(output_hit_bits, num_spheres * 4);
+
+		const rtm_impl::ray_soa4 rays = rtm_impl::ray_soa4_load(origins, directions);
+		for (uint32_t sphere_index = 0; sphere_index < num_spheres; ++sphere_index)
+		{
+			vector4f distance;
+			const mask4f is_hit = rtm_impl::ray_intersect_sphere_soa4(rays, vector_set(centers.x[sphere_index]), vector_set(centers.y[sphere_index]), vector_set(centers.z[sphere_index]), vector_set(radii[sphere_index]), distance);
+			rtm_impl::ray4_store_hits(is_hit, distance, sphere_index, output_distances, output_hit_bits);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Intersects one ray with 'num_boxes' axis aligned bounding boxes stored as structure of arrays.
+	// Each box is described by its center and its half extent along each axis.
+	// The distance to each box is written in 'output_distances', zero if the origin is inside.
+	// Box 'i' maps to bit 'i % 32' of output_hit_bits[i / 32], set on hit.
+	// The hit bits must hold (num_boxes + 31) / 32 entries, unused bits are cleared.
+	// Boxes are tested 4 at a time with the slab method, the ray and its reciprocal direction are broadcast once.
+	//////////////////////////////////////////////////////////////////////////
+	inline void ray_intersect_aabbs_soa(vector4f_arg0 origin, vector4f_arg1 direction, const const_float3f_soa& centers, const const_float3f_soa& extents, float* output_distances, uint32_t* output_hit_bits, uint32_t num_boxes) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::ray_intersect_aabbs_soa", num_boxes, num_boxes * sizeof(float) * 7);
+		rtm_impl::ray_clear_bits(output_hit_bits, num_boxes);
+
+		const rtm_impl::ray_soa4 ray = rtm_impl::ray_soa4_broadcast(origin, direction);
+		for (uint32_t box_index = 0; box_index < num_boxes; box_index += 4)
+		{
+			const uint32_t num_values = num_boxes - box_index;
+			const vector4f center_x = rtm_impl::ray_load_partial(centers.x + box_index, num_values);
+			const vector4f center_y = rtm_impl::ray_load_partial(centers.y + box_index, num_values);
+			const vector4f center_z = rtm_impl::ray_load_partial(centers.z + box_index, num_values);
+			const vector4f extent_x = rtm_impl::ray_load_partial(extents.x + box_index, num_values);
+			const vector4f extent_y = rtm_impl::ray_load_partial(extents.y + box_index, num_values);
+			const vector4f extent_z = rtm_impl::ray_load_partial(extents.z + box_index, num_values);
+
+			vector4f distance;
+			const mask4f is_hit = rtm_impl::ray_intersect_aabb_soa4(ray, center_x, center_y, center_z, extent_x, extent_y, extent_z, distance);
+			rtm_impl::ray_store_hits(is_hit, distance, box_index, num_values, output_distances, output_hit_bits);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Intersects 4 rays with 'num_boxes' axis aligned bounding boxes stored as structure of arrays.
+	// The origins and directions hold the 4 rays as structure of arrays.
+	// The output layout matches the 4 rays variant of ray_intersect_spheres_soa.
+	//////////////////////////////////////////////////////////////////////////
+	inline void ray_intersect_aabbs_soa(const const_float3f_soa& origins, const const_float3f_soa& directions, const const_float3f_soa& centers, const const_float3f_soa& extents, float* output_distances, uint32_t* output_hit_bits, uint32_t num_boxes) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::ray_intersect_aabbs_soa", num_boxes * 4, num_boxes * sizeof(float) * (6 + 4));
+		rtm_impl::ray_clear_bits(output_hit_bits, num_boxes * 4);
+
+		const rtm_impl::ray_soa4 rays = rtm_impl::ray_soa4_load(origins, directions);
+		for (uint32_t box_index = 0; box_index < num_boxes; ++box_index)
+		{
+			vector4f distance;
+			const mask4f is_hit = rtm_impl::ray_intersect_aabb_soa4(rays,
+				vector_set(centers.x[box_index]), vector_set(centers.y[box_index]), vector_set(centers.z[box_index]),
+				vector_set(extents.x[box_index]), vector_set(extents.y[box_index]), vector_set(extents.z[box_index]), distance);
+			rtm_impl::ray4_store_hits(is_hit, distance, box_index, output_distances, output_hit_bits);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Intersects one ray with 'num_planes' planes stored as structure of arrays.
+	// Each plane holds its normal in [xyz] and its distance from the origin in [w]:
+	// a point lies on the plane when dot3(point, plane) + plane.w == 0.0, like frustumf planes.
+	// Planes are two sided, rays parallel to their plane never hit.
+	// Plane 'i' maps to bit 'i % 32' of output_hit_bits[i / 32], set on hit.
+	// The hit bits must hold (num_planes + 31) / 32 entries, unused bits are cleared.
+	//////////////////////////////////////////////////////////////////////////
+	inline void ray_intersect_planes_soa(vector4f_arg0 origin, vector4f_arg1 direction, const const_float4f_soa& planes, float* output_distances, uint32_t* output_hit_bits, uint32_t num_planes) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::ray_intersect_planes_soa", num_planes, num_planes * sizeof(float) * 5);
+		rtm_impl::ray_clear_bits(output_hit_bits, num_planes);
+
+		const rtm_impl::ray_soa4 ray = rtm_impl::ray_soa4_broadcast(origin, direction);
+		for (uint32_t plane_index = 0; plane_index < num_planes; plane_index += 4)
+		{
+			const uint32_t num_values = num_planes - plane_index;
+			const vector4f normal_x = rtm_impl::ray_load_partial(planes.x + plane_index, num_values);
+			const vector4f normal_y = rtm_impl::ray_load_partial(planes.y + plane_index, num_values);
+			const vector4f normal_z = rtm_impl::ray_load_partial(planes.z + plane_index, num_values);
+			const vector4f plane_distance = rtm_impl::ray_load_partial(planes.w + plane_index, num_values);
+
+			vector4f distance;
+			const mask4f is_hit = rtm_impl::ray_intersect_plane_soa4(ray, normal_x, normal_y, normal_z, plane_distance, distance);
+			rtm_impl::ray_store_hits(is_hit, distance, plane_index, num_values, output_distances, output_hit_bits);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Intersects 4 rays with 'num_planes' planes stored as structure of arrays.
+	// The origins and directions hold the 4 rays as structure of arrays.
+	// The output layout matches the 4 rays variant of ray_intersect_spheres_soa.
+	//////////////////////////////////////////////////////////////////////////
+	inline void ray_intersect_planes_soa(const const_float3f_soa& origins, const const_float3f_soa& directions, const const_float4f_soa& planes, float* output_distances, uint32_t* output_hit_bits, uint32_t num_planes) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::ray_intersect_planes_soa", num_planes * 4, num_planes * sizeof(float) * (4 + 4));
+		rtm_impl::ray_clear_bits(output_hit_bits, num_planes * 4);
+
+		const rtm_impl::ray_soa4 rays = rtm_impl::ray_soa4_load(origins, directions);
+		for (uint32_t plane_index = 0; plane_index < num_planes; ++plane_index)
+		{
+			vector4f distance;
+			const mask4f is_hit = rtm_impl::ray_intersect_plane_soa4(rays, vector_set(planes.x[plane_index]), vector_set(planes.y[plane_index]), vector_set(planes.z[plane_index]), vector_set(planes.w[plane_index]), distance);
+			rtm_impl::ray4_store_hits(is_hit, distance, plane_index, output_distances, output_hit_bits);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
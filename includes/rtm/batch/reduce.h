@@ -0,0 +1,573 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/mask4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+#include <limits>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The reductions accumulate each value in the lane of its index modulo 4 and spread
+		// consecutive groups of 4 values over 8 independent accumulators to hide the
+		// latency of the additions. With AVX, pairs of accumulators share a register:
+		// every lane computes the same operations in the same order on every platform.
+		//////////////////////////////////////////////////////////////////////////
+		struct reduce_sum_op
+		{
+			static constexpr float identity() RTM_NO_EXCEPT { return 0.0F; }
+			static vector4f RTM_SIMD_CALL accumulate(vector4f_arg0 accumulator, vector4f_arg1 lhs, vector4f_arg2 rhs) RTM_NO_EXCEPT { (void)rhs; return vector_add(accumulator, lhs); }
+			static vector4f RTM_SIMD_CALL combine(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT { return vector_add(lhs, rhs); }
+#if defined(RTM_AVX_INTRINSICS)
+			static vector8f RTM_SIMD_CALL accumulate(vector8f_arg0 accumulator, vector8f_arg1 lhs, vector8f_arg2 rhs) RTM_NO_EXCEPT { (void)rhs; return vector_add(accumulator, lhs); }
+#endif
+		};
+
+		struct reduce_min_op
+		{
+			static constexpr float identity() RTM_NO_EXCEPT { return std::numeric_limits<float>::infinity(); }
+			static vector4f RTM_SIMD_CALL accumulate(vector4f_arg0 accumulator, vector4f_arg1 lhs, vector4f_arg2 rhs) RTM_NO_EXCEPT { (void)rhs; return vector_min(accumulator, lhs); }
+			static vector4f RTM_SIMD_CALL combine(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT { return vector_min(lhs, rhs); }
+#if defined(RTM_AVX_INTRINSICS)
+			static vector8f RTM_SIMD_CALL accumulate(vector8f_arg0 accumulator, vector8f_arg1 lhs, vector8f_arg2 rhs) RTM_NO_EXCEPT { (void)rhs; return vector_min(accumulator, lhs); }
+#endif
+		};
+
+		struct reduce_max_op
+		{
+			static constexpr float identity() RTM_NO_EXCEPT { return -std::numeric_limits<float>::infinity(); }
+			static vector4f RTM_SIMD_CALL accumulate(vector4f_arg0 accumulator, vector4f_arg1 lhs, vector4f_arg2 rhs) RTM_NO_EXCEPT { (void)rhs; return vector_max(accumulator, lhs); }
+			static vector4f RTM_SIMD_CALL combine(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT { return vector_max(lhs, rhs); }
+#if defined(RTM_AVX_INTRINSICS)
+			static vector8f RTM_SIMD_CALL accumulate(vector8f_arg0 accumulator, vector8f_arg1 lhs, vector8f_arg2 rhs) RTM_NO_EXCEPT { (void)rhs; return vector_max(accumulator, lhs); }
+#endif
+		};
+
+		struct reduce_dot_op
+		{
+			static constexpr float identity() RTM_NO_EXCEPT { return 0.0F; }
+			static vector4f RTM_SIMD_CALL accumulate(vector4f_arg0 accumulator, vector4f_arg1 lhs, vector4f_arg2 rhs) RTM_NO_EXCEPT { return vector_mul_add(lhs, rhs, accumulator); }
+			static vector4f RTM_SIMD_CALL combine(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT { return vector_add(lhs, rhs); }
+#if defined(RTM_AVX_INTRINSICS)
+			static vector8f RTM_SIMD_CALL accumulate(vector8f_arg0 accumulator, vector8f_arg1 lhs, vector8f_arg2 rhs) RTM_NO_EXCEPT { return vector_mul_add(lhs, rhs, accumulator); }
+#endif
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reduces 'num_values' values (or pairs of values) into 4 lanes: lane i holds the
+		// reduction of the values whose index modulo 4 is i. Unary reductions ignore 'rhs'.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename reduce_op>
+		inline vector4f reduce_lanes(const float* lhs, const float* rhs, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			vector4f accumulators[8];
+			uint32_t value_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+			{
+				const vector8f identity = vector8_set(reduce_op::identity());
+				vector8f accumulator01 = identity;
+				vector8f accumulator23 = identity;
+				vector8f accumulator45 = identity;
+				vector8f accumulator67 = identity;
+
+				for (; value_index + 32 <= num_values; value_index += 32)
+				{
+					accumulator01 = reduce_op::accumulate(accumulator01, vector8_load(lhs + value_index + 0), vector8_load(rhs + value_index + 0));
+					accumulator23 = reduce_op::accumulate(accumulator23, vector8_load(lhs + value_index + 8), vector8_load(rhs + value_index + 8));
+					accumulator45 = reduce_op::accumulate(accumulator45, vector8_load(lhs + value_index + 16), vector8_load(rhs + value_index + 16));
+					accumulator67 = reduce_op::accumulate(accumulator67, vector8_load(lhs + value_index + 24), vector8_load(rhs + value_index + 24));
+				}
+
+				accumulators[0] = _mm256_castps256_ps128(accumulator01);
+				accumulators[1] = _mm256_extractf128_ps(accumulator01, 1);
+				accumulators[2] = _mm256_castps256_ps128(accumulator23);
+				accumulators[3] = _mm256_extractf128_ps(accumulator23, 1);
+				accumulators[4] = _mm256_castps256_ps128(accumulator45);
+				accumulators[5] = _mm256_extractf128_ps(accumulator45, 1);
+				accumulators[6] = _mm256_castps256_ps128(accumulator67);
+				accumulators[7] = _mm256_extractf128_ps(accumulator67, 1);
+			}
+#else
+			{
+				const vector4f identity = vector_set(reduce_op::identity());
+				vector4f accumulator0 = identity;
+				vector4f accumulator1 = identity;
+				vector4f accumulator2 = identity;
+				vector4f accumulator3 = identity;
+				vector4f accumulator4 = identity;
+				vector4f accumulator5 = identity;
+				vector4f accumulator6 = identity;
+				vector4f accumulator7 = identity;
+
+				for (; value_index + 32 <= num_values; value_index += 32)
+				{
+					accumulator0 = reduce_op::accumulate(accumulator0, vector_load(lhs + value_index + 0), vector_load(rhs + value_index + 0));
+					accumulator1 = reduce_op::accumulate(accumulator1, vector_load(lhs + value_index + 4), vector_load(rhs + value_index + 4));
+					accumulator2 = reduce_op::accumulate(accumulator2, vector_load(lhs + value_index + 8), vector_load(rhs + value_index + 8));
+					accumulator3 = reduce_op::accumulate(accumulator3, vector_load(lhs + value_index + 12), vector_load(rhs + value_index + 12));
+					accumulator4 = reduce_op::accumulate(accumulator4, vector_load(lhs + value_index + 16), vector_load(rhs + value_index + 16));
+					accumulator5 = reduce_op::accumulate(accumulator5, vector_load(lhs + value_index + 20), vector_load(rhs + value_index + 20));
+					accumulator6 = reduce_op::accumulate(accumulator6, vector_load(lhs + value_index + 24), vector_load(rhs + value_index + 24));
+					accumulator7 = reduce_op::accumulate(accumulator7, vector_load(lhs + value_index + 28), vector_load(rhs + value_index + 28));
+				}
+
+				accumulators[0] = accumulator0;
+				accumulators[1] = accumulator1;
+				accumulators[2] = accumulator2;
+				accumulators[3] = accumulator3;
+				accumulators[4] = accumulator4;
+				accumulators[5] = accumulator5;
+				accumulators[6] = accumulator6;
+				accumulators[7] = accumulator7;
+			}
+#endif
+
+			// Less than 32 values remain, each group of 4 goes to the accumulator it would have used
+			uint32_t group_index = 0;
+			for (; value_index + 4 <= num_values; value_index += 4, ++group_index)
+				accumulators[group_index] = reduce_op::accumulate(accumulators[group_index], vector_load(lhs + value_index), vector_load(rhs + value_index));
+
+			if (value_index < num_values)
+			{
+				// Less than 4 values remain, the mask lets GCC see the copy stays within the lanes
+				const uint32_t num_remaining = (num_values - value_index) & 3;
+				float lhs_values[4] = { reduce_op::identity(), reduce_op::identity(), reduce_op::identity(), reduce_op::identity() };
+				float rhs_values[4] = { reduce_op::identity(), reduce_op::identity(), reduce_op::identity(), reduce_op::identity() };
+				for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+				{
+					lhs_values[lane_index] = lhs[value_index + lane_index];
+					rhs_values[lane_index] = rhs[value_index + lane_index];
+				}
+
+				accumulators[group_index] = reduce_op::accumulate(accumulators[group_index], vector_load(&lhs_values[0]), vector_load(&rhs_values[0]));
+			}
+
+			const vector4f result0123 = reduce_op::combine(reduce_op::combine(accumulators[0], accumulators[1]), reduce_op::combine(accumulators[2], accumulators[3]));
+			const vector4f result4567 = reduce_op::combine(reduce_op::combine(accumulators[4], accumulators[5]), reduce_op::combine(accumulators[6], accumulators[7]));
+			return reduce_op::combine(result0123, result4567);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// One step of compensated summation in every lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL reduce_compensated_add(vector4f& sum, vector4f& compensation, vector4f_arg0 value) RTM_NO_EXCEPT
+		{
+			const vector4f corrected_value = vector_sub(value, compensation);
+			const vector4f new_sum = vector_add(sum, corrected_value);
+			compensation = vector_sub(vector_sub(new_sum, sum), corrected_value);
+			sum = new_sum;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Sums 'num_values' values into 4 lanes like reduce_lanes with compensated summation.
+		// The 4 accumulators hide some of the latency of the compensation.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f reduce_compensated_sum_lanes(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			vector4f sums[4] = { vector_zero(), vector_zero(), vector_zero(), vector_zero() };
+			vector4f compensations[4] = { vector_zero(), vector_zero(), vector_zero(), vector_zero() };
+
+			uint32_t value_index = 0;
+			for (; value_index + 16 <= num_values; value_index += 16)
+			{
+				reduce_compensated_add(sums[0], compensations[0], vector_load(input + value_index + 0));
+				reduce_compensated_add(sums[1], compensations[1], vector_load(input + value_index + 4));
+				reduce_compensated_add(sums[2], compensations[2], vector_load(input + value_index + 8));
+				reduce_compensated_add(sums[3], compensations[3], vector_load(input + value_index + 12));
+			}
+
+			uint32_t group_index = 0;
+			for (; value_index + 4 <= num_values; value_index += 4, ++group_index)
+				reduce_compensated_add(sums[group_index], compensations[group_index], vector_load(input + value_index));
+
+			if (value_index < num_values)
+			{
+				// Less than 4 values remain, the mask lets GCC see the copy stays within the lanes
+				const uint32_t num_remaining = (num_values - value_index) & 3;
+				float values[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+				for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+					values[lane_index] = input[value_index + lane_index];
+
+				reduce_compensated_add(sums[group_index], compensations[group_index], vector_load(&values[0]));
+			}
+
+			// The accumulators are combined with their compensation carried along
+			vector4f sum = sums[0];
+			vector4f compensation = compensations[0];
+			for (uint32_t accumulator_index = 1; accumulator_index < 4; ++accumulator_index)
+			{
+				reduce_compensated_add(sum, compensation, sums[accumulator_index]);
+				reduce_compensated_add(sum, compensation, vector_neg(compensations[accumulator_index]));
+			}
+
+			return vector_sub(sum, compensation);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Sums 'num_values' values into 4 lanes like reduce_lanes, as a binary tree of blocks.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f reduce_pairwise_sum_lanes(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			constexpr uint32_t k_block_size = 1024;
+			if (num_values <= k_block_size)
+				return reduce_lanes<reduce_sum_op>(input, input, num_values);
+
+			// Splitting on a block boundary keeps every value in its lane
+			const uint32_t num_blocks = (num_values + k_block_size - 1) / k_block_size;
+			const uint32_t split_index = ((num_blocks + 1) / 2) * k_block_size;
+			return vector_add(reduce_pairwise_sum_lanes(input, split_index), reduce_pairwise_sum_lanes(input + split_index, num_values - split_index));
+		}
+
+		inline vector4f reduce_sum_lanes(const float* input, uint32_t num_values, summation_precision precision) RTM_NO_EXCEPT
+		{
+			switch (precision)
+			{
+			case summation_precision::pairwise:
+				return reduce_pairwise_sum_lanes(input, num_values);
+			case summation_precision::compensated:
+				return reduce_compensated_sum_lanes(input, num_values);
+			case summation_precision::fast:
+			default:
+				return reduce_lanes<reduce_sum_op>(input, input, num_values);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Adds the 4 lanes together, in the same order on every platform.
+		//////////////////////////////////////////////////////////////////////////
+		inline float RTM_SIMD_CALL reduce_lanes_sum(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			return (float(vector_get_x(input)) + float(vector_get_z(input))) + (float(vector_get_y(input)) + float(vector_get_w(input)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Sums 'num_values' values with the requested precision.
+		//////////////////////////////////////////////////////////////////////////
+		inline float reduce_sum(const float* input, uint32_t num_values, summation_precision precision) RTM_NO_EXCEPT
+		{
+			const vector4f lanes = reduce_sum_lanes(input, num_values, precision);
+			if (precision != summation_precision::compensated)
+				return reduce_lanes_sum(lanes);
+
+			// The 4 lanes can be of very different magnitudes, they are compensated as well
+			float sum = 0.0F;
+			float compensation = 0.0F;
+			const float lane_values[4] = { vector_get_x(lanes), vector_get_y(lanes), vector_get_z(lanes), vector_get_w(lanes) };
+			for (float lane_value : lane_values)
+			{
+				const float corrected_value = lane_value - compensation;
+				const float new_sum = sum + corrected_value;
+				compensation = (new_sum - sum) - corrected_value;
+				sum = new_sum;
+			}
+
+			return sum;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the smallest and largest of 'num_values' values.
+		//////////////////////////////////////////////////////////////////////////
+		inline float reduce_min(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			return vector_get_min_component(reduce_lanes<reduce_min_op>(input, input, num_values));
+		}
+
+		inline float reduce_max(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			return vector_get_max_component(reduce_lanes<reduce_max_op>(input, input, num_values));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the index of the first value equal to 'value' or 'num_values' if none is.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t reduce_find_first(const float* input, uint32_t num_values, float value) RTM_NO_EXCEPT
+		{
+			const vector4f value_v = vector_set(value);
+
+			uint32_t value_index = 0;
+			for (; value_index + 4 <= num_values; value_index += 4)
+			{
+				const uint32_t bits = mask_get_bits(vector_equal(vector_load(input + value_index), value_v));
+				if (bits != 0)
+					return value_index + ((bits & 1) != 0 ? 0 : (bits & 2) != 0 ? 1 : (bits & 4) != 0 ? 2 : 3);
+			}
+
+			for (; value_index < num_values; ++value_index)
+			{
+				if (input[value_index] == value)
+					return value_index;
+			}
+
+			return num_values;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the sum of 'num_values' floats.
+	// The precision controls the accumulation, see summation_precision.
+	// Returns 0.0 when the array is empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_sum_array(const float* input, uint32_t num_values, summation_precision precision = summation_precision::fast) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::scalar_sum_array", num_values, num_values * sizeof(float));
+
+		return rtm_impl::reduce_sum(input, num_values, precision);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest of 'num_values' floats.
+	// The array must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_min_array(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::scalar_min_array", num_values, num_values * sizeof(float));
+		RTM_ASSERT(num_values != 0, "At least one value is required");
+
+		return rtm_impl::reduce_min(input, num_values);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the largest of 'num_values' floats.
+	// The array must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_max_array(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::scalar_max_array", num_values, num_values * sizeof(float));
+		RTM_ASSERT(num_values != 0, "At least one value is required");
+
+		return rtm_impl::reduce_max(input, num_values);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the index of the smallest of 'num_values' floats, the first one on ties.
+	// The smallest value is reduced first and then searched for.
+	// The array must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t scalar_argmin_array(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::scalar_argmin_array", num_values, num_values * sizeof(float) * 2);
+		RTM_ASSERT(num_values != 0, "At least one value is required");
+
+		return rtm_impl::reduce_find_first(input, num_values, rtm_impl::reduce_min(input, num_values));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the index of the largest of 'num_values' floats, the first one on ties.
+	// The largest value is reduced first and then searched for.
+	// The array must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t scalar_argmax_array(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::scalar_argmax_array", num_values, num_values * sizeof(float) * 2);
+		RTM_ASSERT(num_values != 0, "At least one value is required");
+
+		return rtm_impl::reduce_find_first(input, num_values, rtm_impl::reduce_max(input, num_values));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the dot product of two arrays of 'num_values' floats: the sum of their
+	// products. Returns 0.0 when the arrays are empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_dot_array(const float* lhs, const float* rhs, uint32_t num_values) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::scalar_dot_array", num_values, num_values * sizeof(float) * 2);
+
+		return rtm_impl::reduce_lanes_sum(rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(lhs, rhs, num_values));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the sum of the squares of 'num_values' floats.
+	// Returns 0.0 when the array is empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_sum_squares_array(const float* input, uint32_t num_values) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::scalar_sum_squares_array", num_values, num_values * sizeof(float));
+
+		return rtm_impl::reduce_lanes_sum(rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(input, input, num_values));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise sum of 'num_vectors' vectors.
+	// The precision controls the accumulation, see summation_precision.
+	// Returns a zero vector when the array is empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_sum_array(const vector4f* input, uint32_t num_vectors, summation_precision precision = summation_precision::fast) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_sum_array", num_vectors, num_vectors * sizeof(vector4f));
+
+		// Every vector fills the 4 lanes, each lane sums a single component
+		return rtm_impl::reduce_sum_lanes(reinterpret_cast<const float*>(input), num_vectors * 4, precision);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise minimum of 'num_vectors' vectors.
+	// The array must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_min_array(const vector4f* input, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_min_array", num_vectors, num_vectors * sizeof(vector4f));
+		RTM_ASSERT(num_vectors != 0, "At least one vector is required");
+
+		const float* input_values = reinterpret_cast<const float*>(input);
+		return rtm_impl::reduce_lanes<rtm_impl::reduce_min_op>(input_values, input_values, num_vectors * 4);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise maximum of 'num_vectors' vectors.
+	// The array must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_max_array(const vector4f* input, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_max_array", num_vectors, num_vectors * sizeof(vector4f));
+		RTM_ASSERT(num_vectors != 0, "At least one vector is required");
+
+		const float* input_values = reinterpret_cast<const float*>(input);
+		return rtm_impl::reduce_lanes<rtm_impl::reduce_max_op>(input_values, input_values, num_vectors * 4);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise sum of the squares of 'num_vectors' vectors.
+	// Returns a zero vector when the array is empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_sum_squares_array(const vector4f* input, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_sum_squares_array", num_vectors, num_vectors * sizeof(vector4f));
+
+		const float* input_values = reinterpret_cast<const float*>(input);
+		return rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(input_values, input_values, num_vectors * 4);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise sum of 'num_vectors' 3D vectors stored as structure of arrays.
+	// The [w] component is 0.0. Returns a zero vector when the streams are empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_sum_soa(const const_float3f_soa& input, uint32_t num_vectors, summation_precision precision = summation_precision::fast) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_sum_soa", num_vectors, num_vectors * sizeof(float) * 3);
+
+		return vector_set(rtm_impl::reduce_sum(input.x, num_vectors, precision), rtm_impl::reduce_sum(input.y, num_vectors, precision), rtm_impl::reduce_sum(input.z, num_vectors, precision), 0.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise sum of 'num_vectors' 4D vectors stored as structure of arrays.
+	// Returns a zero vector when the streams are empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_sum_soa(const const_float4f_soa& input, uint32_t num_vectors, summation_precision precision = summation_precision::fast) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_sum_soa", num_vectors, num_vectors * sizeof(float) * 4);
+
+		return vector_set(rtm_impl::reduce_sum(input.x, num_vectors, precision), rtm_impl::reduce_sum(input.y, num_vectors, precision), rtm_impl::reduce_sum(input.z, num_vectors, precision), rtm_impl::reduce_sum(input.w, num_vectors, precision));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise minimum of 'num_vectors' 3D vectors stored as structure of arrays.
+	// The [w] component is 0.0. The streams must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_min_soa(const const_float3f_soa& input, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_min_soa", num_vectors, num_vectors * sizeof(float) * 3);
+		RTM_ASSERT(num_vectors != 0, "At least one vector is required");
+
+		return vector_set(rtm_impl::reduce_min(input.x, num_vectors), rtm_impl::reduce_min(input.y, num_vectors), rtm_impl::reduce_min(input.z, num_vectors), 0.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise minimum of 'num_vectors' 4D vectors stored as structure of arrays.
+	// The streams must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_min_soa(const const_float4f_soa& input, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_min_soa", num_vectors, num_vectors * sizeof(float) * 4);
+		RTM_ASSERT(num_vectors != 0, "At least one vector is required");
+
+		return vector_set(rtm_impl::reduce_min(input.x, num_vectors), rtm_impl::reduce_min(input.y, num_vectors), rtm_impl::reduce_min(input.z, num_vectors), rtm_impl::reduce_min(input.w, num_vectors));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise maximum of 'num_vectors' 3D vectors stored as structure of arrays.
+	// The [w] component is 0.0. The streams must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_max_soa(const const_float3f_soa& input, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_max_soa", num_vectors, num_vectors * sizeof(float) * 3);
+		RTM_ASSERT(num_vectors != 0, "At least one vector is required");
+
+		return vector_set(rtm_impl::reduce_max(input.x, num_vectors), rtm_impl::reduce_max(input.y, num_vectors), rtm_impl::reduce_max(input.z, num_vectors), 0.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the component-wise maximum of 'num_vectors' 4D vectors stored as structure of arrays.
+	// The streams must not be empty nor contain NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f vector_max_soa(const const_float4f_soa& input, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_max_soa", num_vectors, num_vectors * sizeof(float) * 4);
+		RTM_ASSERT(num_vectors != 0, "At least one vector is required");
+
+		return vector_set(rtm_impl::reduce_max(input.x, num_vectors), rtm_impl::reduce_max(input.y, num_vectors), rtm_impl::reduce_max(input.z, num_vectors), rtm_impl::reduce_max(input.w, num_vectors));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the sum of the 3D dot products of 'num_vectors' pairs of vectors stored as
+	// structure of arrays. Returns 0.0 when the streams are empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline float vector_dot3_soa(const const_float3f_soa& lhs, const const_float3f_soa& rhs, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_dot3_soa", num_vectors, num_vectors * sizeof(float) * 6);
+
+		const vector4f x_lanes = rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(lhs.x, rhs.x, num_vectors);
+		const vector4f y_lanes = rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(lhs.y, rhs.y, num_vectors);
+		const vector4f z_lanes = rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(lhs.z, rhs.z, num_vectors);
+		return rtm_impl::reduce_lanes_sum(vector_add(vector_add(x_lanes, y_lanes), z_lanes));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the sum of the squared 3D lengths of 'num_vectors' vectors stored as
+	// structure of arrays. Returns 0.0 when the streams are empty.
+	//////////////////////////////////////////////////////////////////////////
+	inline float vector_sum_squares3_soa(const const_float3f_soa& input, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_sum_squares3_soa", num_vectors, num_vectors * sizeof(float) * 3);
+
+		const vector4f x_lanes = rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(input.x, input.x, num_vectors);
+		const vector4f y_lanes = rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(input.y, input.y, num_vectors);
+		const vector4f z_lanes = rtm_impl::reduce_lanes<rtm_impl::reduce_dot_op>(input.z, input.z, num_vectors);
+		return rtm_impl::reduce_lanes_sum(vector_add(vector_add(x_lanes, y_lanes), z_lanes));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
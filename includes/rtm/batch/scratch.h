@@ -0,0 +1,279 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The default alignment of scratch memory: a cache line, enough for SSE, AVX, and AVX-512.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr size_t k_scratch_default_alignment = 64;
+
+	//////////////////////////////////////////////////////////////////////////
+	// A linear allocator over a caller provided buffer for the temporary buffers of the
+	// batch functions. Allocating bumps an offset and nothing is freed individually: call
+	// reset() once per frame, or rewind(..) to a marker returned by get_marker() to release
+	// everything allocated after it. Nothing is ever allocated from the heap, the buffer
+	// must outlive the arena and can be reused once it is destroyed.
+	// Allocations return nullptr when the buffer is full.
+	// An arena must not be used by multiple threads at the same time.
+	//////////////////////////////////////////////////////////////////////////
+	class scratch_arena
+	{
+	public:
+		scratch_arena(void* buffer, size_t buffer_size) RTM_NO_EXCEPT
+			: m_buffer(static_cast<uint8_t*>(buffer))
+			, m_buffer_size(buffer_size)
+			, m_offset(0)
+			, m_peak_size(0)
+		{
+			RTM_ASSERT(buffer != nullptr || buffer_size == 0, "A buffer is required");
+		}
+
+		scratch_arena(const scratch_arena&) = delete;
+		scratch_arena& operator=(const scratch_arena&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns 'size' bytes aligned to 'alignment' or nullptr if the buffer is full.
+		// The alignment must be a power of two.
+		//////////////////////////////////////////////////////////////////////////
+		void* allocate(size_t size, size_t alignment = k_scratch_default_alignment) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(rtm_impl::is_power_of_two(alignment), "Alignment value must be a power of two");
+
+			// The buffer itself might not be aligned, align the address instead of the offset
+			const uintptr_t buffer_address = reinterpret_cast<uintptr_t>(m_buffer);
+			const uintptr_t allocation_address = rtm_impl::align_to(buffer_address + m_offset, alignment);
+			const size_t allocation_offset = size_t(allocation_address - buffer_address);
+
+			if (allocation_offset > m_buffer_size || size > m_buffer_size - allocation_offset)
+				return nullptr;
+
+			m_offset = allocation_offset + size;
+			m_peak_size = m_offset > m_peak_size ? m_offset : m_peak_size;
+			return m_buffer + allocation_offset;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns an uninitialized array of 'num_elements' elements or nullptr if the buffer is full.
+		// The alignment must be a power of two and at least the alignment of the element type.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename element_type>
+		element_type* allocate_array(size_t num_elements, size_t alignment = k_scratch_default_alignment) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(rtm_impl::is_alignment_valid<element_type>(alignment), "Invalid alignment for the element type");
+			return static_cast<element_type*>(allocate(num_elements * sizeof(element_type), alignment));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns 3 float streams of 'num_elements' each. Every stream starts on the
+		// requested alignment, the streams are padded accordingly.
+		// Either every stream is allocated or they are all nullptr if the buffer is full.
+		//////////////////////////////////////////////////////////////////////////
+		float3f_soa allocate_soa3(size_t num_elements, size_t alignment = k_scratch_default_alignment) RTM_NO_EXCEPT
+		{
+			const size_t stream_size = rtm_impl::align_to(num_elements * sizeof(float), alignment);
+			float* streams = allocate_array<float>((stream_size / sizeof(float)) * 3, alignment);
+			if (streams == nullptr)
+				return float3f_soa{ nullptr, nullptr, nullptr };
+
+			const size_t stream_stride = stream_size / sizeof(float);
+			return float3f_soa{ streams, streams + stream_stride, streams + stream_stride * 2 };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns 4 float streams of 'num_elements' each. Every stream starts on the
+		// requested alignment, the streams are padded accordingly.
+		// Either every stream is allocated or they are all nullptr if the buffer is full.
+		//////////////////////////////////////////////////////////////////////////
+		float4f_soa allocate_soa4(size_t num_elements, size_t alignment = k_scratch_default_alignment) RTM_NO_EXCEPT
+		{
+			const size_t stream_size = rtm_impl::align_to(num_elements * sizeof(float), alignment);
+			float* streams = allocate_array<float>((stream_size / sizeof(float)) * 4, alignment);
+			if (streams == nullptr)
+				return float4f_soa{ nullptr, nullptr, nullptr, nullptr };
+
+			const size_t stream_stride = stream_size / sizeof(float);
+			return float4f_soa{ streams, streams + stream_stride, streams + stream_stride * 2, streams + stream_stride * 3 };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a marker that rewind(..) can return to.
+		//////////////////////////////////////////////////////////////////////////
+		size_t get_marker() const RTM_NO_EXCEPT { return m_offset; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases everything allocated since the marker was returned by get_marker().
+		//////////////////////////////////////////////////////////////////////////
+		void rewind(size_t marker) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(marker <= m_offset, "Cannot rewind past the current allocation offset");
+			m_offset = marker;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Releases every allocation, typically once per frame.
+		//////////////////////////////////////////////////////////////////////////
+		void reset() RTM_NO_EXCEPT { m_offset = 0; }
+
+		size_t get_capacity() const RTM_NO_EXCEPT { return m_buffer_size; }
+		size_t get_used_size() const RTM_NO_EXCEPT { return m_offset; }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the largest number of bytes used since the arena was created, including
+		// alignment padding. Useful to size the buffer.
+		//////////////////////////////////////////////////////////////////////////
+		size_t get_peak_size() const RTM_NO_EXCEPT { return m_peak_size; }
+
+	private:
+		uint8_t*	m_buffer;
+		size_t		m_buffer_size;
+		size_t		m_offset;
+		size_t		m_peak_size;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A pool of fixed size blocks carved out of a caller provided buffer. Blocks are
+	// allocated and freed individually in constant time and reset() frees all of them at
+	// once, typically once per frame. Every block is aligned to the requested alignment
+	// and the block size is rounded up to it. Nothing is ever allocated from the heap,
+	// the buffer must outlive the pool.
+	// Allocations return nullptr when every block is in use.
+	// A pool must not be used by multiple threads at the same time.
+	//////////////////////////////////////////////////////////////////////////
+	class scratch_block_pool
+	{
+	public:
+		scratch_block_pool(void* buffer, size_t buffer_size, size_t block_size, size_t alignment = k_scratch_default_alignment) RTM_NO_EXCEPT
+			: m_blocks(nullptr)
+			, m_free_list(nullptr)
+			, m_block_size(rtm_impl::align_to(block_size < sizeof(void*) ? sizeof(void*) : block_size, alignment))
+			, m_num_blocks(0)
+			, m_num_untouched_blocks(0)
+			, m_num_free_blocks(0)
+		{
+			RTM_ASSERT(rtm_impl::is_power_of_two(alignment), "Alignment value must be a power of two");
+			RTM_ASSERT(alignment >= alignof(void*), "The alignment must be able to hold a pointer");
+			RTM_ASSERT(buffer != nullptr || buffer_size == 0, "A buffer is required");
+
+			uint8_t* buffer_start = static_cast<uint8_t*>(buffer);
+			uint8_t* first_block = rtm_impl::align_to(buffer_start, alignment);
+			const size_t padding = size_t(first_block - buffer_start);
+			if (padding < buffer_size)
+			{
+				m_blocks = first_block;
+				m_num_blocks = (buffer_size - padding) / m_block_size;
+			}
+
+			reset();
+		}
+
+		scratch_block_pool(const scratch_block_pool&) = delete;
+		scratch_block_pool& operator=(const scratch_block_pool&) = delete;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a block of get_block_size() bytes or nullptr if every block is in use.
+		//////////////////////////////////////////////////////////////////////////
+		void* allocate() RTM_NO_EXCEPT
+		{
+			if (m_free_list != nullptr)
+			{
+				void* block = m_free_list;
+				std::memcpy(&m_free_list, block, sizeof(void*));
+				m_num_free_blocks--;
+				return block;
+			}
+
+			// Blocks that were never used since the last reset are not in the free list,
+			// resetting does not need to touch every block
+			if (m_num_untouched_blocks == 0)
+				return nullptr;
+
+			void* block = m_blocks + (m_num_blocks - m_num_untouched_blocks) * m_block_size;
+			m_num_untouched_blocks--;
+			m_num_free_blocks--;
+			return block;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a block to the pool. The block must come from this pool.
+		//////////////////////////////////////////////////////////////////////////
+		void free(void* block) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(owns(block), "The block does not belong to this pool");
+			std::memcpy(block, &m_free_list, sizeof(void*));
+			m_free_list = block;
+			m_num_free_blocks++;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Frees every block at once in constant time.
+		//////////////////////////////////////////////////////////////////////////
+		void reset() RTM_NO_EXCEPT
+		{
+			m_free_list = nullptr;
+			m_num_untouched_blocks = m_num_blocks;
+			m_num_free_blocks = m_num_blocks;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns true if the pointer is the start of a block of this pool.
+		//////////////////////////////////////////////////////////////////////////
+		bool owns(const void* block) const RTM_NO_EXCEPT
+		{
+			const uint8_t* block_ptr = static_cast<const uint8_t*>(block);
+			if (m_blocks == nullptr || block_ptr < m_blocks || block_ptr >= m_blocks + m_num_blocks * m_block_size)
+				return false;
+
+			return size_t(block_ptr - m_blocks) % m_block_size == 0;
+		}
+
+		size_t get_block_size() const RTM_NO_EXCEPT { return m_block_size; }
+		size_t get_num_blocks() const RTM_NO_EXCEPT { return m_num_blocks; }
+		size_t get_num_free_blocks() const RTM_NO_EXCEPT { return m_num_free_blocks; }
+
+	private:
+		uint8_t*	m_blocks;
+		void*		m_free_list;
+		size_t		m_block_size;
+		size_t		m_num_blocks;
+		size_t		m_num_untouched_blocks;
+		size_t		m_num_free_blocks;
+	};
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,327 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The vertex attributes read by the skinning functions.
+	// Each attribute advances by its stride in bytes per vertex: e.g. sizeof(float3f)
+	// for separate arrays of positions or the vertex size when attributes are interleaved.
+	// The normals and tangents are optional and skipped when null.
+	//////////////////////////////////////////////////////////////////////////
+	struct const_skin_vertex_streams
+	{
+		const float3f* positions;
+		const float3f* normals;
+		const float4f* tangents;
+
+		uint32_t position_stride;
+		uint32_t normal_stride;
+		uint32_t tangent_stride;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// The vertex attributes written by the skinning functions, see const_skin_vertex_streams.
+	// An attribute is written only when it is also read.
+	//////////////////////////////////////////////////////////////////////////
+	struct skin_vertex_streams
+	{
+		float3f* positions;
+		float3f* normals;
+		float4f* tangents;
+
+		uint32_t position_stride;
+		uint32_t normal_stride;
+		uint32_t tangent_stride;
+
+		constexpr operator const_skin_vertex_streams() const RTM_NO_EXCEPT { return const_skin_vertex_streams{ positions, normals, tangents, position_stride, normal_stride, tangent_stride }; }
+	};
+
+	namespace rtm_impl
+	{
+		template<typename attribute_type>
+		inline attribute_type* skin_stream_offset(attribute_type* stream, uint32_t stride, uint32_t vertex_index) RTM_NO_EXCEPT
+		{
+			using byte_type = typename std::conditional<std::is_const<attribute_type>::value, const uint8_t, uint8_t>::type;
+			return reinterpret_cast<attribute_type*>(reinterpret_cast<byte_type*>(stream) + size_t(stride) * vertex_index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the weighted sum of the 4 palette matrices that influence a vertex.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix3x4f skin_blend_matrix(const matrix3x4f* palette, const uint32_t* bone_indices, const float* bone_weights) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			// Two axes are accumulated per register, the [x, y] axes then the [z, w] axes
+			const float* bone0 = reinterpret_cast<const float*>(palette + bone_indices[0]);
+			const float* bone1 = reinterpret_cast<const float*>(palette + bone_indices[1]);
+			const float* bone2 = reinterpret_cast<const float*>(palette + bone_indices[2]);
+			const float* bone3 = reinterpret_cast<const float*>(palette + bone_indices[3]);
+
+			const vector8f weight0 = _mm256_broadcast_ss(bone_weights + 0);
+			const vector8f weight1 = _mm256_broadcast_ss(bone_weights + 1);
+			const vector8f weight2 = _mm256_broadcast_ss(bone_weights + 2);
+			const vector8f weight3 = _mm256_broadcast_ss(bone_weights + 3);
+
+			vector8f xy_axes = vector_mul(_mm256_loadu_ps(bone0 + 0), weight0);
+			vector8f zw_axes = vector_mul(_mm256_loadu_ps(bone0 + 8), weight0);
+
+			xy_axes = vector_mul_add(_mm256_loadu_ps(bone1 + 0), weight1, xy_axes);
+			zw_axes = vector_mul_add(_mm256_loadu_ps(bone1 + 8), weight1, zw_axes);
+
+			xy_axes = vector_mul_add(_mm256_loadu_ps(bone2 + 0), weight2, xy_axes);
+			zw_axes = vector_mul_add(_mm256_loadu_ps(bone2 + 8), weight2, zw_axes);
+
+			xy_axes = vector_mul_add(_mm256_loadu_ps(bone3 + 0), weight3, xy_axes);
+			zw_axes = vector_mul_add(_mm256_loadu_ps(bone3 + 8), weight3, zw_axes);
+
+			return matrix3x4f{ vector_get_low(xy_axes), vector_get_high(xy_axes), vector_get_low(zw_axes), vector_get_high(zw_axes) };
+#else
+			const matrix3x4f& bone0 = palette[bone_indices[0]];
+			const matrix3x4f& bone1 = palette[bone_indices[1]];
+			const matrix3x4f& bone2 = palette[bone_indices[2]];
+			const matrix3x4f& bone3 = palette[bone_indices[3]];
+
+			const vector4f weights = vector_load(bone_weights);
+			const vector4f weight0 = vector_dup_x(weights);
+			const vector4f weight1 = vector_dup_y(weights);
+			const vector4f weight2 = vector_dup_z(weights);
+			const vector4f weight3 = vector_dup_w(weights);
+
+			vector4f x_axis = vector_mul(bone0.x_axis, weight0);
+			vector4f y_axis = vector_mul(bone0.y_axis, weight0);
+			vector4f z_axis = vector_mul(bone0.z_axis, weight0);
+			vector4f w_axis = vector_mul(bone0.w_axis, weight0);
+
+			x_axis = vector_mul_add(bone1.x_axis, weight1, x_axis);
+			y_axis = vector_mul_add(bone1.y_axis, weight1, y_axis);
+			z_axis = vector_mul_add(bone1.z_axis, weight1, z_axis);
+			w_axis = vector_mul_add(bone1.w_axis, weight1, w_axis);
+
+			x_axis = vector_mul_add(bone2.x_axis, weight2, x_axis);
+			y_axis = vector_mul_add(bone2.y_axis, weight2, y_axis);
+			z_axis = vector_mul_add(bone2.z_axis, weight2, z_axis);
+			w_axis = vector_mul_add(bone2.w_axis, weight2, w_axis);
+
+			x_axis = vector_mul_add(bone3.x_axis, weight3, x_axis);
+			y_axis = vector_mul_add(bone3.y_axis, weight3, y_axis);
+			z_axis = vector_mul_add(bone3.z_axis, weight3, z_axis);
+			w_axis = vector_mul_add(bone3.w_axis, weight3, w_axis);
+
+			return matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Skins the attributes of a single vertex with its blended matrix.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL skin_vertex(matrix3x4f_arg0 blended, const const_skin_vertex_streams& input, const skin_vertex_streams& output, uint32_t vertex_index) RTM_NO_EXCEPT
+		{
+			const vector4f position = vector_load3(skin_stream_offset(input.positions, input.position_stride, vertex_index));
+			vector_store3(matrix_mul_point3(position, blended), skin_stream_offset(output.positions, output.position_stride, vertex_index));
+
+			// Blending scales the axes, the normal and tangent are normalized again
+			if (input.normals != nullptr)
+			{
+				const vector4f normal = vector_load3(skin_stream_offset(input.normals, input.normal_stride, vertex_index));
+				vector_store3(vector_normalize3(matrix_mul_vector3(normal, blended), normal), skin_stream_offset(output.normals, output.normal_stride, vertex_index));
+			}
+
+			if (input.tangents != nullptr)
+			{
+				// The [w] component holds the bitangent sign, it is preserved
+				const vector4f tangent = vector_load(skin_stream_offset(input.tangents, input.tangent_stride, vertex_index));
+				const vector4f skinned_tangent = vector_normalize3(matrix_mul_vector3(tangent, blended), tangent);
+				vector_store(vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(skinned_tangent, tangent), skin_stream_offset(output.tangents, output.tangent_stride, vertex_index));
+			}
+		}
+
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins 'num_vertices' vertices with linear blend skinning: each vertex is transformed
+	// by the weighted sum of the 4 palette matrices that influence it.
+	// 'bone_indices' and 'bone_weights' hold 4 entries per vertex. The weights should sum to 1.0,
+	// unused influences have a weight of 0.0 and must still index a valid palette matrix.
+	// The weighted matrix is accumulated once per vertex and transforms the position, the normal,
+	// and the tangent. The normal and tangent are normalized again, the tangent [w] component
+	// is copied as is. With AVX, two matrix axes are accumulated per 256 bit register.
+	// The output can safely alias the input as long as both use the same strides.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_skin_aos(const matrix3x4f* palette, const uint32_t* bone_indices, const float* bone_weights, const const_skin_vertex_streams& input, const skin_vertex_streams& output, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(input.positions != nullptr && output.positions != nullptr, "Positions are required");
+		RTM_ASSERT(input.normals == nullptr || output.normals != nullptr, "Normal output is required");
+		RTM_ASSERT(input.tangents == nullptr || output.tangents != nullptr, "Tangent output is required");
+
+		RTM_PROFILE_SCOPE("rtm::matrix_skin_aos", num_vertices, num_vertices * (sizeof(uint32_t) * 4 + sizeof(float) * 4 + sizeof(matrix3x4f) * 4
+			+ sizeof(float3f) * 2 + (input.normals != nullptr ? sizeof(float3f) * 2 : 0) + (input.tangents != nullptr ? sizeof(float4f) * 2 : 0)));
+
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		{
+			const matrix3x4f blended = rtm_impl::skin_blend_matrix(palette, bone_indices + vertex_index * 4, bone_weights + vertex_index * 4);
+			rtm_impl::skin_vertex(blended, input, output, vertex_index);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Skins 'num_vertices' vertices stored as structure of arrays with linear blend skinning,
+	// see matrix_skin_aos(..). The normals and tangents are skipped when their [x] stream is null.
+	// Like vector_normalize3_soa(..), a normal or tangent that skins to a zero length is not handled.
+	// The 4 weighted matrices of 4 vertices are transposed such that each vertex component
+	// is computed 4 at a time. The output can safely alias the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void matrix_skin_soa(const matrix3x4f* palette, const uint32_t* bone_indices, const float* bone_weights,
+		const const_float3f_soa& positions, const const_float3f_soa& normals, const const_float4f_soa& tangents,
+		const float3f_soa& out_positions, const float3f_soa& out_normals, const float4f_soa& out_tangents, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(positions.x != nullptr && out_positions.x != nullptr, "Positions are required");
+		RTM_ASSERT(normals.x == nullptr || out_normals.x != nullptr, "Normal output is required");
+		RTM_ASSERT(tangents.x == nullptr || out_tangents.x != nullptr, "Tangent output is required");
+
+		RTM_PROFILE_SCOPE("rtm::matrix_skin_soa", num_vertices, num_vertices * (sizeof(uint32_t) * 4 + sizeof(float) * 4 + sizeof(matrix3x4f) * 4
+			+ sizeof(float) * 6 + (normals.x != nullptr ? sizeof(float) * 6 : 0) + (tangents.x != nullptr ? sizeof(float) * 8 : 0)));
+
+		uint32_t vertex_index = 0;
+		for (; vertex_index + 4 <= num_vertices; vertex_index += 4)
+		{
+			const matrix3x4f blended0 = rtm_impl::skin_blend_matrix(palette, bone_indices + vertex_index * 4 + 0, bone_weights + vertex_index * 4 + 0);
+			const matrix3x4f blended1 = rtm_impl::skin_blend_matrix(palette, bone_indices + vertex_index * 4 + 4, bone_weights + vertex_index * 4 + 4);
+			const matrix3x4f blended2 = rtm_impl::skin_blend_matrix(palette, bone_indices + vertex_index * 4 + 8, bone_weights + vertex_index * 4 + 8);
+			const matrix3x4f blended3 = rtm_impl::skin_blend_matrix(palette, bone_indices + vertex_index * 4 + 12, bone_weights + vertex_index * 4 + 12);
+
+			// Each axis component of the 4 vertices, the [w] components are unused
+			vector4f x_axis_x = blended0.x_axis;
+			vector4f x_axis_y = blended1.x_axis;
+			vector4f x_axis_z = blended2.x_axis;
+			vector4f x_axis_w = blended3.x_axis;
+			vector_transpose4x4(x_axis_x, x_axis_y, x_axis_z, x_axis_w);
+
+			vector4f y_axis_x = blended0.y_axis;
+			vector4f y_axis_y = blended1.y_axis;
+			vector4f y_axis_z = blended2.y_axis;
+			vector4f y_axis_w = blended3.y_axis;
+			vector_transpose4x4(y_axis_x, y_axis_y, y_axis_z, y_axis_w);
+
+			vector4f z_axis_x = blended0.z_axis;
+			vector4f z_axis_y = blended1.z_axis;
+			vector4f z_axis_z = blended2.z_axis;
+			vector4f z_axis_w = blended3.z_axis;
+			vector_transpose4x4(z_axis_x, z_axis_y, z_axis_z, z_axis_w);
+
+			vector4f w_axis_x = blended0.w_axis;
+			vector4f w_axis_y = blended1.w_axis;
+			vector4f w_axis_z = blended2.w_axis;
+			vector4f w_axis_w = blended3.w_axis;
+			vector_transpose4x4(w_axis_x, w_axis_y, w_axis_z, w_axis_w);
+
+			{
+				const vector4f x = vector_load(positions.x + vertex_index);
+				const vector4f y = vector_load(positions.y + vertex_index);
+				const vector4f z = vector_load(positions.z + vertex_index);
+				vector_store(vector_mul_add(z, z_axis_x, vector_mul_add(y, y_axis_x, vector_mul_add(x, x_axis_x, w_axis_x))), out_positions.x + vertex_index);
+				vector_store(vector_mul_add(z, z_axis_y, vector_mul_add(y, y_axis_y, vector_mul_add(x, x_axis_y, w_axis_y))), out_positions.y + vertex_index);
+				vector_store(vector_mul_add(z, z_axis_z, vector_mul_add(y, y_axis_z, vector_mul_add(x, x_axis_z, w_axis_z))), out_positions.z + vertex_index);
+			}
+
+			if (normals.x != nullptr)
+			{
+				const vector4f x = vector_load(normals.x + vertex_index);
+				const vector4f y = vector_load(normals.y + vertex_index);
+				const vector4f z = vector_load(normals.z + vertex_index);
+				const vector4f skinned_x = vector_mul_add(z, z_axis_x, vector_mul_add(y, y_axis_x, vector_mul(x, x_axis_x)));
+				const vector4f skinned_y = vector_mul_add(z, z_axis_y, vector_mul_add(y, y_axis_y, vector_mul(x, x_axis_y)));
+				const vector4f skinned_z = vector_mul_add(z, z_axis_z, vector_mul_add(y, y_axis_z, vector_mul(x, x_axis_z)));
+				const vector4f inv_length = rtm_impl::batch_sqrt_reciprocal<normalize_precision::exact>(vector_mul_add(skinned_z, skinned_z, vector_mul_add(skinned_y, skinned_y, vector_mul(skinned_x, skinned_x))));
+				vector_store(vector_mul(skinned_x, inv_length), out_normals.x + vertex_index);
+				vector_store(vector_mul(skinned_y, inv_length), out_normals.y + vertex_index);
+				vector_store(vector_mul(skinned_z, inv_length), out_normals.z + vertex_index);
+			}
+
+			if (tangents.x != nullptr)
+			{
+				const vector4f x = vector_load(tangents.x + vertex_index);
+				const vector4f y = vector_load(tangents.y + vertex_index);
+				const vector4f z = vector_load(tangents.z + vertex_index);
+				const vector4f w = vector_load(tangents.w + vertex_index);
+				const vector4f skinned_x = vector_mul_add(z, z_axis_x, vector_mul_add(y, y_axis_x, vector_mul(x, x_axis_x)));
+				const vector4f skinned_y = vector_mul_add(z, z_axis_y, vector_mul_add(y, y_axis_y, vector_mul(x, x_axis_y)));
+				const vector4f skinned_z = vector_mul_add(z, z_axis_z, vector_mul_add(y, y_axis_z, vector_mul(x, x_axis_z)));
+				const vector4f inv_length = rtm_impl::batch_sqrt_reciprocal<normalize_precision::exact>(vector_mul_add(skinned_z, skinned_z, vector_mul_add(skinned_y, skinned_y, vector_mul(skinned_x, skinned_x))));
+				vector_store(vector_mul(skinned_x, inv_length), out_tangents.x + vertex_index);
+				vector_store(vector_mul(skinned_y, inv_length), out_tangents.y + vertex_index);
+				vector_store(vector_mul(skinned_z, inv_length), out_tangents.z + vertex_index);
+				vector_store(w, out_tangents.w + vertex_index);
+			}
+		}
+
+		for (; vertex_index < num_vertices; ++vertex_index)
+		{
+			const matrix3x4f blended = rtm_impl::skin_blend_matrix(palette, bone_indices + vertex_index * 4, bone_weights + vertex_index * 4);
+
+			const vector4f position = vector_set(positions.x[vertex_index], positions.y[vertex_index], positions.z[vertex_index]);
+			const vector4f skinned_position = matrix_mul_point3(position, blended);
+			out_positions.x[vertex_index] = vector_get_x(skinned_position);
+			out_positions.y[vertex_index] = vector_get_y(skinned_position);
+			out_positions.z[vertex_index] = vector_get_z(skinned_position);
+
+			if (normals.x != nullptr)
+			{
+				const vector4f normal = vector_set(normals.x[vertex_index], normals.y[vertex_index], normals.z[vertex_index]);
+				const vector4f skinned_normal = vector_normalize3(matrix_mul_vector3(normal, blended), normal);
+				out_normals.x[vertex_index] = vector_get_x(skinned_normal);
+				out_normals.y[vertex_index] = vector_get_y(skinned_normal);
+				out_normals.z[vertex_index] = vector_get_z(skinned_normal);
+			}
+
+			if (tangents.x != nullptr)
+			{
+				const vector4f tangent = vector_set(tangents.x[vertex_index], tangents.y[vertex_index], tangents.z[vertex_index]);
+				const vector4f skinned_tangent = vector_normalize3(matrix_mul_vector3(tangent, blended), tangent);
+				out_tangents.x[vertex_index] = vector_get_x(skinned_tangent);
+				out_tangents.y[vertex_index] = vector_get_y(skinned_tangent);
+				out_tangents.z[vertex_index] = vector_get_z(skinned_tangent);
+				out_tangents.w[vertex_index] = tangents.w[vertex_index];
+			}
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
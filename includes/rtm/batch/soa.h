@@ -0,0 +1,362 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4f.h"
+#include "rtm/batch/qvvf.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Padded structure of arrays streams hold a multiple of this many floats: a cache line.
+	// Kernels processing 4, 8, or 16 lanes at a time can then run over the padded size
+	// without a scalar remainder loop.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint32_t k_soa_lane_padding = 16;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of entries a padded stream holds for 'num_elements' elements.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr uint32_t soa_padded_size(uint32_t num_elements) RTM_NO_EXCEPT
+	{
+		return ((num_elements + k_soa_lane_padding - 1) / k_soa_lane_padding) * k_soa_lane_padding;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Containers with inline storage for up to 'capacity' elements. Every stream is 64 bytes
+	// aligned and padded with soa_padded_size(capacity). They convert to the structure of arrays
+	// views consumed by the batch functions as well as vector3x8_load(..) and quat8_load(..).
+	// Note that on the heap, they require a 64 bytes aligned allocation (e.g. scratch_arena).
+	//////////////////////////////////////////////////////////////////////////
+
+	template<uint32_t capacity>
+	struct soa_vector3f
+	{
+		static constexpr uint32_t k_padded_capacity = soa_padded_size(capacity);
+
+		alignas(64) float x[k_padded_capacity];
+		alignas(64) float y[k_padded_capacity];
+		alignas(64) float z[k_padded_capacity];
+		uint32_t size = 0;
+
+		uint32_t get_padded_size() const RTM_NO_EXCEPT { return soa_padded_size(size); }
+
+		operator float3f_soa() RTM_NO_EXCEPT { return float3f_soa{ x, y, z }; }
+		operator const_float3f_soa() const RTM_NO_EXCEPT { return const_float3f_soa{ x, y, z }; }
+	};
+
+	template<uint32_t capacity>
+	constexpr uint32_t soa_vector3f<capacity>::k_padded_capacity;
+
+	template<uint32_t capacity>
+	struct soa_quatf
+	{
+		static constexpr uint32_t k_padded_capacity = soa_padded_size(capacity);
+
+		alignas(64) float x[k_padded_capacity];
+		alignas(64) float y[k_padded_capacity];
+		alignas(64) float z[k_padded_capacity];
+		alignas(64) float w[k_padded_capacity];
+		uint32_t size = 0;
+
+		uint32_t get_padded_size() const RTM_NO_EXCEPT { return soa_padded_size(size); }
+
+		operator float4f_soa() RTM_NO_EXCEPT { return float4f_soa{ x, y, z, w }; }
+		operator const_float4f_soa() const RTM_NO_EXCEPT { return const_float4f_soa{ x, y, z, w }; }
+	};
+
+	template<uint32_t capacity>
+	constexpr uint32_t soa_quatf<capacity>::k_padded_capacity;
+
+	template<uint32_t capacity>
+	struct soa_qvvf
+	{
+		static constexpr uint32_t k_padded_capacity = soa_padded_size(capacity);
+
+		soa_quatf<capacity> rotation;
+		soa_vector3f<capacity> translation;
+		soa_vector3f<capacity> scale;
+		uint32_t size = 0;
+
+		uint32_t get_padded_size() const RTM_NO_EXCEPT { return soa_padded_size(size); }
+
+		operator qvvf_soa() RTM_NO_EXCEPT { return qvvf_soa{ rotation, translation, scale }; }
+		operator const_qvvf_soa() const RTM_NO_EXCEPT { return const_qvvf_soa{ rotation, translation, scale }; }
+	};
+
+	template<uint32_t capacity>
+	constexpr uint32_t soa_qvvf<capacity>::k_padded_capacity;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_elements' 3D vectors into structure of arrays streams.
+	// The streams must hold soa_padded_size(num_elements) entries: the padding is set to zero.
+	// Vectors are deinterleaved 4 at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void soa_pack(const float3f* input, uint32_t num_elements, const float3f_soa& output) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::soa_pack", num_elements, num_elements * sizeof(float) * 6);
+
+		uint32_t element_index = 0;
+		for (; element_index + 4 <= num_elements; element_index += 4)
+		{
+			vector4f x;
+			vector4f y;
+			vector4f z;
+			vector_deinterleave3(input + element_index, x, y, z);
+			vector_store(x, output.x + element_index);
+			vector_store(y, output.y + element_index);
+			vector_store(z, output.z + element_index);
+		}
+
+		for (; element_index < num_elements; ++element_index)
+		{
+			output.x[element_index] = input[element_index].x;
+			output.y[element_index] = input[element_index].y;
+			output.z[element_index] = input[element_index].z;
+		}
+
+		const uint32_t padded_size = soa_padded_size(num_elements);
+		for (; element_index < padded_size; ++element_index)
+			output.x[element_index] = output.y[element_index] = output.z[element_index] = 0.0F;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_elements' 3D vectors from structure of arrays streams.
+	// Vectors are interleaved 4 at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void soa_unpack(const const_float3f_soa& input, uint32_t num_elements, float3f* output) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::soa_unpack", num_elements, num_elements * sizeof(float) * 6);
+
+		uint32_t element_index = 0;
+		for (; element_index + 4 <= num_elements; element_index += 4)
+			vector_interleave3(vector_load(input.x + element_index), vector_load(input.y + element_index), vector_load(input.z + element_index), output + element_index);
+
+		for (; element_index < num_elements; ++element_index)
+			output[element_index] = float3f{ input.x[element_index], input.y[element_index], input.z[element_index] };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_elements' quaternions into structure of arrays streams.
+	// The streams must hold soa_padded_size(num_elements) entries: the padding is set to
+	// the identity rotation. Quaternions are transposed 4 at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void soa_pack(const quatf* input, uint32_t num_elements, const float4f_soa& output) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::soa_pack", num_elements, num_elements * sizeof(float) * 8);
+
+		uint32_t element_index = 0;
+		for (; element_index + 4 <= num_elements; element_index += 4)
+		{
+			vector4f x = quat_to_vector(input[element_index + 0]);
+			vector4f y = quat_to_vector(input[element_index + 1]);
+			vector4f z = quat_to_vector(input[element_index + 2]);
+			vector4f w = quat_to_vector(input[element_index + 3]);
+			vector_transpose4x4(x, y, z, w);
+			vector_store(x, output.x + element_index);
+			vector_store(y, output.y + element_index);
+			vector_store(z, output.z + element_index);
+			vector_store(w, output.w + element_index);
+		}
+
+		for (; element_index < num_elements; ++element_index)
+		{
+			output.x[element_index] = quat_get_x(input[element_index]);
+			output.y[element_index] = quat_get_y(input[element_index]);
+			output.z[element_index] = quat_get_z(input[element_index]);
+			output.w[element_index] = quat_get_w(input[element_index]);
+		}
+
+		const uint32_t padded_size = soa_padded_size(num_elements);
+		for (; element_index < padded_size; ++element_index)
+		{
+			output.x[element_index] = output.y[element_index] = output.z[element_index] = 0.0F;
+			output.w[element_index] = 1.0F;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_elements' quaternions from structure of arrays streams.
+	// Quaternions are transposed 4 at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void soa_unpack(const const_float4f_soa& input, uint32_t num_elements, quatf* output) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::soa_unpack", num_elements, num_elements * sizeof(float) * 8);
+
+		uint32_t element_index = 0;
+		for (; element_index + 4 <= num_elements; element_index += 4)
+		{
+			vector4f x = vector_load(input.x + element_index);
+			vector4f y = vector_load(input.y + element_index);
+			vector4f z = vector_load(input.z + element_index);
+			vector4f w = vector_load(input.w + element_index);
+			vector_transpose4x4(x, y, z, w);
+			output[element_index + 0] = vector_to_quat(x);
+			output[element_index + 1] = vector_to_quat(y);
+			output[element_index + 2] = vector_to_quat(z);
+			output[element_index + 3] = vector_to_quat(w);
+		}
+
+		for (; element_index < num_elements; ++element_index)
+			output[element_index] = quat_set(input.x[element_index], input.y[element_index], input.z[element_index], input.w[element_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_elements' QVV transforms into structure of arrays streams.
+	// The streams must hold soa_padded_size(num_elements) entries: the padding is set to
+	// the identity transform. Transforms are transposed 4 at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void soa_pack(const qvvf* input, uint32_t num_elements, const qvvf_soa& output) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::soa_pack", num_elements, num_elements * sizeof(float) * 20);
+
+		uint32_t element_index = 0;
+		for (; element_index + 4 <= num_elements; element_index += 4)
+		{
+			const rtm_impl::qvvf_soa4 qvv4 = rtm_impl::qvv_gather4(input[element_index + 0], input[element_index + 1], input[element_index + 2], input[element_index + 3], true);
+			vector_store(qvv4.rotation_x, output.rotation.x + element_index);
+			vector_store(qvv4.rotation_y, output.rotation.y + element_index);
+			vector_store(qvv4.rotation_z, output.rotation.z + element_index);
+			vector_store(qvv4.rotation_w, output.rotation.w + element_index);
+			vector_store(qvv4.translation_x, output.translation.x + element_index);
+			vector_store(qvv4.translation_y, output.translation.y + element_index);
+			vector_store(qvv4.translation_z, output.translation.z + element_index);
+			vector_store(qvv4.scale_x, output.scale.x + element_index);
+			vector_store(qvv4.scale_y, output.scale.y + element_index);
+			vector_store(qvv4.scale_z, output.scale.z + element_index);
+		}
+
+		const uint32_t padded_size = soa_padded_size(num_elements);
+		for (; element_index < padded_size; ++element_index)
+		{
+			const qvvf transform = element_index < num_elements ? input[element_index] : qvv_identity();
+			output.rotation.x[element_index] = quat_get_x(transform.rotation);
+			output.rotation.y[element_index] = quat_get_y(transform.rotation);
+			output.rotation.z[element_index] = quat_get_z(transform.rotation);
+			output.rotation.w[element_index] = quat_get_w(transform.rotation);
+			output.translation.x[element_index] = vector_get_x(transform.translation);
+			output.translation.y[element_index] = vector_get_y(transform.translation);
+			output.translation.z[element_index] = vector_get_z(transform.translation);
+			output.scale.x[element_index] = vector_get_x(transform.scale);
+			output.scale.y[element_index] = vector_get_y(transform.scale);
+			output.scale.z[element_index] = vector_get_z(transform.scale);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_elements' QVV transforms from structure of arrays streams.
+	// Transforms are transposed 4 at a time.
+	//////////////////////////////////////////////////////////////////////////
+	inline void soa_unpack(const const_qvvf_soa& input, uint32_t num_elements, qvvf* output) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::soa_unpack", num_elements, num_elements * sizeof(float) * 20);
+
+		uint32_t element_index = 0;
+		for (; element_index + 4 <= num_elements; element_index += 4)
+		{
+			rtm_impl::qvvf_soa4 qvv4;
+			qvv4.rotation_x = vector_load(input.rotation.x + element_index);
+			qvv4.rotation_y = vector_load(input.rotation.y + element_index);
+			qvv4.rotation_z = vector_load(input.rotation.z + element_index);
+			qvv4.rotation_w = vector_load(input.rotation.w + element_index);
+			qvv4.translation_x = vector_load(input.translation.x + element_index);
+			qvv4.translation_y = vector_load(input.translation.y + element_index);
+			qvv4.translation_z = vector_load(input.translation.z + element_index);
+			qvv4.scale_x = vector_load(input.scale.x + element_index);
+			qvv4.scale_y = vector_load(input.scale.y + element_index);
+			qvv4.scale_z = vector_load(input.scale.z + element_index);
+			rtm_impl::qvv_scatter4(qvv4, output[element_index + 0], output[element_index + 1], output[element_index + 2], output[element_index + 3]);
+		}
+
+		for (; element_index < num_elements; ++element_index)
+		{
+			const quatf rotation = quat_set(input.rotation.x[element_index], input.rotation.y[element_index], input.rotation.z[element_index], input.rotation.w[element_index]);
+			const vector4f translation = vector_set(input.translation.x[element_index], input.translation.y[element_index], input.translation.z[element_index], 0.0F);
+			const vector4f scale = vector_set(input.scale.x[element_index], input.scale.y[element_index], input.scale.z[element_index], 0.0F);
+			output[element_index] = qvv_set(rotation, translation, scale);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs into and unpacks from the containers, the container size is updated when packing.
+	//////////////////////////////////////////////////////////////////////////
+
+	template<uint32_t capacity>
+	inline void soa_pack(const float3f* input, uint32_t num_elements, soa_vector3f<capacity>& output) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_elements <= capacity, "Container capacity exceeded");
+		soa_pack(input, num_elements, static_cast<float3f_soa>(output));
+		output.size = num_elements;
+	}
+
+	template<uint32_t capacity>
+	inline void soa_unpack(const soa_vector3f<capacity>& input, float3f* output) RTM_NO_EXCEPT
+	{
+		soa_unpack(static_cast<const_float3f_soa>(input), input.size, output);
+	}
+
+	template<uint32_t capacity>
+	inline void soa_pack(const quatf* input, uint32_t num_elements, soa_quatf<capacity>& output) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_elements <= capacity, "Container capacity exceeded");
+		soa_pack(input, num_elements, static_cast<float4f_soa>(output));
+		output.size = num_elements;
+	}
+
+	template<uint32_t capacity>
+	inline void soa_unpack(const soa_quatf<capacity>& input, quatf* output) RTM_NO_EXCEPT
+	{
+		soa_unpack(static_cast<const_float4f_soa>(input), input.size, output);
+	}
+
+	template<uint32_t capacity>
+	inline void soa_pack(const qvvf* input, uint32_t num_elements, soa_qvvf<capacity>& output) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_elements <= capacity, "Container capacity exceeded");
+		soa_pack(input, num_elements, static_cast<qvvf_soa>(output));
+		output.size = num_elements;
+		output.rotation.size = num_elements;
+		output.translation.size = num_elements;
+		output.scale.size = num_elements;
+	}
+
+	template<uint32_t capacity>
+	inline void soa_unpack(const soa_qvvf<capacity>& input, qvvf* output) RTM_NO_EXCEPT
+	{
+		soa_unpack(static_cast<const_qvvf_soa>(input), input.size, output);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,484 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/types.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector4i.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <cstring>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// A uniform grid that partitions space into cubic cells.
+	// Cell [0, 0, 0] spans [origin, origin + cell_size) along every axis.
+	//////////////////////////////////////////////////////////////////////////
+	struct spatial_grid_settings
+	{
+		// The position of the lowest corner of cell [0, 0, 0]
+		float3f origin = { 0.0F, 0.0F, 0.0F };
+
+		// The width of a cell along every axis, it must be positive
+		float cell_size = 1.0F;
+	};
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The operations the spatial key kernels need, for each register width.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		struct spatial_lanes;
+
+		template<>
+		struct spatial_lanes<4>
+		{
+			using float_type = vector4f;
+			using int_type = vector4i;
+
+			static vector4f RTM_SIMD_CALL broadcast(float value) RTM_NO_EXCEPT { return vector_set(value); }
+			static vector4i RTM_SIMD_CALL broadcast_int(int32_t value) RTM_NO_EXCEPT { return vector_set(value); }
+			static vector4f RTM_SIMD_CALL load(const float* input) RTM_NO_EXCEPT { return vector_load(input); }
+			static void RTM_SIMD_CALL store(vector4i_arg0 input, int32_t* output) RTM_NO_EXCEPT { vector_store(input, output); }
+			static vector4i RTM_SIMD_CALL floor_to_int(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_truncate_to_int(vector_floor(input)); }
+
+			static vector4i RTM_SIMD_CALL mul(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT { return vector_mul(lhs, rhs); }
+			static vector4i RTM_SIMD_CALL bit_and(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT { return vector_and(lhs, rhs); }
+			static vector4i RTM_SIMD_CALL bit_or(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT { return vector_or(lhs, rhs); }
+			static vector4i RTM_SIMD_CALL bit_xor(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT { return vector_xor(lhs, rhs); }
+			static vector4i RTM_SIMD_CALL shift_left(vector4i_arg0 input, uint32_t count) RTM_NO_EXCEPT { return vector_shift_left(input, count); }
+			static vector4i RTM_SIMD_CALL shift_right(vector4i_arg0 input, uint32_t count) RTM_NO_EXCEPT { return vector_shift_right(input, count); }
+			static vector4i RTM_SIMD_CALL shift_right_logical(vector4i_arg0 input, uint32_t count) RTM_NO_EXCEPT { return vector_shift_right_logical(input, count); }
+
+			// Returns the bits of the floats as integers
+			static vector4i RTM_SIMD_CALL float_bits(vector4f_arg0 input) RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				return _mm_castps_si128(input);
+#elif defined(RTM_NEON_INTRINSICS)
+				return vreinterpretq_s32_f32(input);
+#else
+				float values[4];
+				vector_store(input, values);
+				int32_t bits[4];
+				std::memcpy(&bits[0], &values[0], sizeof(bits));
+				return vector_load(&bits[0]);
+#endif
+			}
+
+			// Writes 4 64 bit integers from their low and high 32 bits
+			static void RTM_SIMD_CALL store_uint64(vector4i_arg0 low, vector4i_arg1 high, uint64_t* output) RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 0), _mm_unpacklo_epi32(low, high));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(output + 2), _mm_unpackhi_epi32(low, high));
+#elif defined(RTM_NEON_INTRINSICS)
+				const int32x4x2_t interleaved = vzipq_s32(low, high);
+				vst1q_s32(reinterpret_cast<int32_t*>(output + 0), interleaved.val[0]);
+				vst1q_s32(reinterpret_cast<int32_t*>(output + 2), interleaved.val[1]);
+#else
+				uint32_t low_bits[4];
+				uint32_t high_bits[4];
+				vector_store(low, reinterpret_cast<int32_t*>(&low_bits[0]));
+				vector_store(high, reinterpret_cast<int32_t*>(&high_bits[0]));
+				for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+					output[lane_index] = (uint64_t(high_bits[lane_index]) << 32) | low_bits[lane_index];
+#endif
+			}
+		};
+
+#if defined(RTM_AVX2_INTRINSICS)
+		template<>
+		struct spatial_lanes<8>
+		{
+			using float_type = vector8f;
+			using int_type = __m256i;
+
+			static vector8f RTM_SIMD_CALL broadcast(float value) RTM_NO_EXCEPT { return vector8_set(value); }
+			static __m256i RTM_SIMD_CALL broadcast_int(int32_t value) RTM_NO_EXCEPT { return _mm256_set1_epi32(value); }
+			static vector8f RTM_SIMD_CALL load(const float* input) RTM_NO_EXCEPT { return vector8_load(input); }
+			static void RTM_SIMD_CALL store(__m256i input, int32_t* output) RTM_NO_EXCEPT { _mm256_storeu_si256(reinterpret_cast<__m256i*>(output), input); }
+			static __m256i RTM_SIMD_CALL floor_to_int(vector8f_arg0 input) RTM_NO_EXCEPT { return _mm256_cvttps_epi32(_mm256_floor_ps(input)); }
+
+			static __m256i RTM_SIMD_CALL mul(__m256i lhs, __m256i rhs) RTM_NO_EXCEPT { return _mm256_mullo_epi32(lhs, rhs); }
+			static __m256i RTM_SIMD_CALL bit_and(__m256i lhs, __m256i rhs) RTM_NO_EXCEPT { return _mm256_and_si256(lhs, rhs); }
+			static __m256i RTM_SIMD_CALL bit_or(__m256i lhs, __m256i rhs) RTM_NO_EXCEPT { return _mm256_or_si256(lhs, rhs); }
+			static __m256i RTM_SIMD_CALL bit_xor(__m256i lhs, __m256i rhs) RTM_NO_EXCEPT { return _mm256_xor_si256(lhs, rhs); }
+			static __m256i RTM_SIMD_CALL shift_left(__m256i input, uint32_t count) RTM_NO_EXCEPT { return _mm256_sll_epi32(input, _mm_cvtsi32_si128(static_cast<int>(count))); }
+			static __m256i RTM_SIMD_CALL shift_right(__m256i input, uint32_t count) RTM_NO_EXCEPT { return _mm256_sra_epi32(input, _mm_cvtsi32_si128(static_cast<int>(count))); }
+			static __m256i RTM_SIMD_CALL shift_right_logical(__m256i input, uint32_t count) RTM_NO_EXCEPT { return _mm256_srl_epi32(input, _mm_cvtsi32_si128(static_cast<int>(count))); }
+			static __m256i RTM_SIMD_CALL float_bits(vector8f_arg0 input) RTM_NO_EXCEPT { return _mm256_castps_si256(input); }
+
+			static void RTM_SIMD_CALL store_uint64(__m256i low, __m256i high, uint64_t* output) RTM_NO_EXCEPT
+			{
+				// Unpacking interleaves within each 128 bit half: [0, 1, 4, 5] and [2, 3, 6, 7]
+				const __m256i keys0145 = _mm256_unpacklo_epi32(low, high);
+				const __m256i keys2367 = _mm256_unpackhi_epi32(low, high);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 0), _mm256_permute2x128_si256(keys0145, keys2367, 0x20));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(output + 4), _mm256_permute2x128_si256(keys0145, keys2367, 0x31));
+			}
+		};
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Teschner et al. primes, followed by a multiply and xor-shift finalizer
+		// so that the low bits of the hash can index a power of two table.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr int32_t k_spatial_hash_prime_x = 73856093;
+		constexpr int32_t k_spatial_hash_prime_y = 19349663;
+		constexpr int32_t k_spatial_hash_prime_z = 83492791;
+		constexpr int32_t k_spatial_hash_multiplier = 0x7FEB352D;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The grid as a scale and a bias such that cell = floor(position * scale + bias).
+		//////////////////////////////////////////////////////////////////////////
+		struct spatial_grid_transform
+		{
+			float scale;
+			float bias[3];
+
+			explicit spatial_grid_transform(const spatial_grid_settings& grid) RTM_NO_EXCEPT
+				: scale(1.0F / grid.cell_size)
+				, bias{ -grid.origin.x / grid.cell_size, -grid.origin.y / grid.cell_size, -grid.origin.z / grid.cell_size }
+			{
+			}
+
+			// Returns the cell coordinates along an axis, clamped to [0, max_cell] when it is positive
+			template<uint32_t num_lanes>
+			typename spatial_lanes<num_lanes>::int_type cell(const typename spatial_lanes<num_lanes>::float_type& position, uint32_t axis_index, float max_cell) const RTM_NO_EXCEPT
+			{
+				using lanes = spatial_lanes<num_lanes>;
+
+				typename lanes::float_type cell_value = vector_mul_add(position, lanes::broadcast(scale), lanes::broadcast(bias[axis_index]));
+				if (max_cell > 0.0F)
+					cell_value = vector_min(vector_max(cell_value, lanes::broadcast(0.0F)), lanes::broadcast(max_cell));
+
+				return lanes::floor_to_int(cell_value);
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Spreads the 11 low bits of every lane such that bit 'i' moves to bit '3 * i'.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename spatial_lanes<num_lanes>::int_type spatial_spread_bits(const typename spatial_lanes<num_lanes>::int_type& input) RTM_NO_EXCEPT
+		{
+			using lanes = spatial_lanes<num_lanes>;
+			using int_type = typename lanes::int_type;
+
+			int_type result = lanes::bit_and(input, lanes::broadcast_int(0x000007FF));
+			result = lanes::bit_and(lanes::bit_or(result, lanes::shift_left(result, 16)), lanes::broadcast_int(0x070000FF));
+			result = lanes::bit_and(lanes::bit_or(result, lanes::shift_left(result, 8)), lanes::broadcast_int(0x0700F00F));
+			result = lanes::bit_and(lanes::bit_or(result, lanes::shift_left(result, 4)), lanes::broadcast_int(0x430C30C3));
+			result = lanes::bit_and(lanes::bit_or(result, lanes::shift_left(result, 2)), lanes::broadcast_int(0x49249249));
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Interleaves the bits of three coordinates: x in bit 0, y in bit 1, z in bit 2.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename spatial_lanes<num_lanes>::int_type spatial_interleave_bits(const typename spatial_lanes<num_lanes>::int_type& x, const typename spatial_lanes<num_lanes>::int_type& y, const typename spatial_lanes<num_lanes>::int_type& z) RTM_NO_EXCEPT
+		{
+			using lanes = spatial_lanes<num_lanes>;
+
+			const typename lanes::int_type xy = lanes::bit_or(spatial_spread_bits<num_lanes>(x), lanes::shift_left(spatial_spread_bits<num_lanes>(y), 1));
+			return lanes::bit_or(xy, lanes::shift_left(spatial_spread_bits<num_lanes>(z), 2));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// The kernels evaluated by spatial_evaluate_soa(..), for any register width.
+		// Each writes 'num_streams' outputs per position at the given offset.
+		//////////////////////////////////////////////////////////////////////////
+		struct spatial_cell_coords_kernel
+		{
+			using output_type = int32_t;
+			static constexpr uint32_t num_streams = 3;
+
+			spatial_grid_transform grid;
+
+			template<uint32_t num_lanes>
+			void apply(const typename spatial_lanes<num_lanes>::float_type (&positions)[3], output_type* const (&outputs)[num_streams], uint32_t offset) const RTM_NO_EXCEPT
+			{
+				using lanes = spatial_lanes<num_lanes>;
+
+				for (uint32_t axis_index = 0; axis_index < 3; ++axis_index)
+					lanes::store(grid.cell<num_lanes>(positions[axis_index], axis_index, 0.0F), outputs[axis_index] + offset);
+			}
+		};
+
+		struct spatial_morton32_kernel
+		{
+			using output_type = uint32_t;
+			static constexpr uint32_t num_streams = 1;
+
+			spatial_grid_transform grid;
+
+			template<uint32_t num_lanes>
+			void apply(const typename spatial_lanes<num_lanes>::float_type (&positions)[3], output_type* const (&outputs)[num_streams], uint32_t offset) const RTM_NO_EXCEPT
+			{
+				using lanes = spatial_lanes<num_lanes>;
+				using int_type = typename lanes::int_type;
+
+				// 10 bits per axis
+				const int_type cell_x = grid.cell<num_lanes>(positions[0], 0, 1023.0F);
+				const int_type cell_y = grid.cell<num_lanes>(positions[1], 1, 1023.0F);
+				const int_type cell_z = grid.cell<num_lanes>(positions[2], 2, 1023.0F);
+
+				lanes::store(spatial_interleave_bits<num_lanes>(cell_x, cell_y, cell_z), reinterpret_cast<int32_t*>(outputs[0] + offset));
+			}
+		};
+
+		struct spatial_morton64_kernel
+		{
+			using output_type = uint64_t;
+			static constexpr uint32_t num_streams = 1;
+
+			spatial_grid_transform grid;
+
+			template<uint32_t num_lanes>
+			void apply(const typename spatial_lanes<num_lanes>::float_type (&positions)[3], output_type* const (&outputs)[num_streams], uint32_t offset) const RTM_NO_EXCEPT
+			{
+				using lanes = spatial_lanes<num_lanes>;
+				using int_type = typename lanes::int_type;
+
+				// 21 bits per axis
+				const int_type cell_x = grid.cell<num_lanes>(positions[0], 0, 2097151.0F);
+				const int_type cell_y = grid.cell<num_lanes>(positions[1], 1, 2097151.0F);
+				const int_type cell_z = grid.cell<num_lanes>(positions[2], 2, 2097151.0F);
+
+				// Bit 32 of the key is bit 10 of z, the high 32 bits start with z
+				const int_type low = spatial_interleave_bits<num_lanes>(cell_x, cell_y, lanes::bit_and(cell_z, lanes::broadcast_int(0x000003FF)));
+				const int_type high = spatial_interleave_bits<num_lanes>(lanes::shift_right(cell_z, 10), lanes::shift_right(cell_x, 11), lanes::shift_right(cell_y, 11));
+
+				lanes::store_uint64(low, high, outputs[0] + offset);
+			}
+		};
+
+		struct spatial_hash_kernel
+		{
+			using output_type = uint32_t;
+			static constexpr uint32_t num_streams = 1;
+
+			spatial_grid_transform grid;
+
+			template<uint32_t num_lanes>
+			void apply(const typename spatial_lanes<num_lanes>::float_type (&positions)[3], output_type* const (&outputs)[num_streams], uint32_t offset) const RTM_NO_EXCEPT
+			{
+				using lanes = spatial_lanes<num_lanes>;
+				using int_type = typename lanes::int_type;
+
+				const int_type hash_x = lanes::mul(grid.cell<num_lanes>(positions[0], 0, 0.0F), lanes::broadcast_int(k_spatial_hash_prime_x));
+				const int_type hash_y = lanes::mul(grid.cell<num_lanes>(positions[1], 1, 0.0F), lanes::broadcast_int(k_spatial_hash_prime_y));
+				const int_type hash_z = lanes::mul(grid.cell<num_lanes>(positions[2], 2, 0.0F), lanes::broadcast_int(k_spatial_hash_prime_z));
+
+				int_type hash = lanes::bit_xor(lanes::bit_xor(hash_x, hash_y), hash_z);
+				hash = lanes::bit_xor(hash, lanes::shift_right_logical(hash, 16));
+				hash = lanes::mul(hash, lanes::broadcast_int(k_spatial_hash_multiplier));
+				hash = lanes::bit_xor(hash, lanes::shift_right_logical(hash, 15));
+
+				lanes::store(hash, reinterpret_cast<int32_t*>(outputs[0] + offset));
+			}
+		};
+
+		struct spatial_depth_kernel
+		{
+			using output_type = uint32_t;
+			static constexpr uint32_t num_streams = 1;
+
+			float camera_position[3];
+			float camera_forward[3];
+			int32_t order_flip;
+
+			template<uint32_t num_lanes>
+			void apply(const typename spatial_lanes<num_lanes>::float_type (&positions)[3], output_type* const (&outputs)[num_streams], uint32_t offset) const RTM_NO_EXCEPT
+			{
+				using lanes = spatial_lanes<num_lanes>;
+				using float_type = typename lanes::float_type;
+				using int_type = typename lanes::int_type;
+
+				float_type depth = vector_mul(vector_sub(positions[0], lanes::broadcast(camera_position[0])), lanes::broadcast(camera_forward[0]));
+				depth = vector_mul_add(vector_sub(positions[1], lanes::broadcast(camera_position[1])), lanes::broadcast(camera_forward[1]), depth);
+				depth = vector_mul_add(vector_sub(positions[2], lanes::broadcast(camera_position[2])), lanes::broadcast(camera_forward[2]), depth);
+
+				// Negative floats flip every bit, positive floats only their sign: the keys
+				// then sort in the same order as the depths when compared as unsigned integers
+				const int_type bits = lanes::float_bits(depth);
+				const int_type flip = lanes::bit_or(lanes::shift_right(bits, 31), lanes::broadcast_int(INT32_MIN));
+				const int_type key = lanes::bit_xor(lanes::bit_xor(bits, flip), lanes::broadcast_int(order_flip));
+
+				lanes::store(key, reinterpret_cast<int32_t*>(outputs[0] + offset));
+			}
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates a spatial key kernel over 'count' positions stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename kernel_type>
+		inline void spatial_evaluate_soa(const const_float3f_soa& positions, typename kernel_type::output_type* const (&outputs)[kernel_type::num_streams], uint32_t count, const kernel_type& kernel) RTM_NO_EXCEPT
+		{
+			using output_type = typename kernel_type::output_type;
+			constexpr uint32_t num_streams = kernel_type::num_streams;
+
+			uint32_t index = 0;
+
+#if defined(RTM_AVX2_INTRINSICS)
+			for (; index + 8 <= count; index += 8)
+			{
+				const vector8f coordinates[3] = { vector8_load(positions.x + index), vector8_load(positions.y + index), vector8_load(positions.z + index) };
+				kernel.template apply<8>(coordinates, outputs, index);
+			}
+#endif
+
+			for (; index + 4 <= count; index += 4)
+			{
+				const vector4f coordinates[3] = { vector_load(positions.x + index), vector_load(positions.y + index), vector_load(positions.z + index) };
+				kernel.template apply<4>(coordinates, outputs, index);
+			}
+
+			if (index < count)
+			{
+				// The last positions are copied into padded streams to run the same code
+				float buffer[3][4] = {};
+				const uint32_t num_remaining = count - index;
+				for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+				{
+					buffer[0][lane_index] = positions.x[index + lane_index];
+					buffer[1][lane_index] = positions.y[index + lane_index];
+					buffer[2][lane_index] = positions.z[index + lane_index];
+				}
+
+				output_type results[num_streams][4];
+				output_type* result_streams[num_streams];
+				for (uint32_t stream_index = 0; stream_index < num_streams; ++stream_index)
+					result_streams[stream_index] = &results[stream_index][0];
+
+				const vector4f coordinates[3] = { vector_load(&buffer[0][0]), vector_load(&buffer[1][0]), vector_load(&buffer[2][0]) };
+				kernel.template apply<4>(coordinates, result_streams, 0);
+
+				for (uint32_t stream_index = 0; stream_index < num_streams; ++stream_index)
+				{
+					for (uint32_t lane_index = 0; lane_index < num_remaining; ++lane_index)
+						outputs[stream_index][index + lane_index] = results[stream_index][lane_index];
+				}
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the integer cell coordinates of 'count' positions stored as structure of arrays:
+	// floor((position - grid.origin) / grid.cell_size) for each axis.
+	// The cell coordinates must fit in a signed 32 bit integer.
+	// Each iteration processes 8 positions with AVX2 and 4 otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline void spatial_cell_coords_soa(const const_float3f_soa& positions, const spatial_grid_settings& grid, int32_t* output_x, int32_t* output_y, int32_t* output_z, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::spatial_cell_coords_soa", count, count * sizeof(float) * 6);
+		RTM_ASSERT(grid.cell_size > 0.0F, "Cell size must be positive");
+
+		int32_t* const outputs[3] = { output_x, output_y, output_z };
+		rtm_impl::spatial_evaluate_soa(positions, outputs, count, rtm_impl::spatial_cell_coords_kernel{ rtm_impl::spatial_grid_transform(grid) });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the 30 bit Morton code (Z-order curve) of the cell containing each of
+	// 'count' positions stored as structure of arrays. The cell coordinates are clamped
+	// to [0, 1023] and their bits interleaved: x in bit 0, y in bit 1, z in bit 2, etc.
+	// Sorting positions by their code keeps neighboring cells close in memory.
+	// Each iteration processes 8 positions with AVX2 and 4 otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline void spatial_morton32_soa(const const_float3f_soa& positions, const spatial_grid_settings& grid, uint32_t* output_keys, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::spatial_morton32_soa", count, count * sizeof(float) * 4);
+		RTM_ASSERT(grid.cell_size > 0.0F, "Cell size must be positive");
+
+		uint32_t* const outputs[1] = { output_keys };
+		rtm_impl::spatial_evaluate_soa(positions, outputs, count, rtm_impl::spatial_morton32_kernel{ rtm_impl::spatial_grid_transform(grid) });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the 63 bit Morton code (Z-order curve) of the cell containing each of
+	// 'count' positions stored as structure of arrays. The cell coordinates are clamped
+	// to [0, 2097151] and their bits interleaved: x in bit 0, y in bit 1, z in bit 2, etc.
+	// Each iteration processes 8 positions with AVX2 and 4 otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline void spatial_morton64_soa(const const_float3f_soa& positions, const spatial_grid_settings& grid, uint64_t* output_keys, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::spatial_morton64_soa", count, count * (sizeof(float) * 3 + sizeof(uint64_t)));
+		RTM_ASSERT(grid.cell_size > 0.0F, "Cell size must be positive");
+
+		uint64_t* const outputs[1] = { output_keys };
+		rtm_impl::spatial_evaluate_soa(positions, outputs, count, rtm_impl::spatial_morton64_kernel{ rtm_impl::spatial_grid_transform(grid) });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a 32 bit hash of the cell containing each of 'count' positions stored as
+	// structure of arrays, for unbounded grids (e.g. a spatial hash table of particles).
+	// Positions in the same cell share their hash, the low bits can index a power of two table.
+	// The cell coordinates must fit in a signed 32 bit integer.
+	// Each iteration processes 8 positions with AVX2 and 4 otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline void spatial_hash_keys_soa(const const_float3f_soa& positions, const spatial_grid_settings& grid, uint32_t* output_keys, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::spatial_hash_keys_soa", count, count * sizeof(float) * 4);
+		RTM_ASSERT(grid.cell_size > 0.0F, "Cell size must be positive");
+
+		uint32_t* const outputs[1] = { output_keys };
+		rtm_impl::spatial_evaluate_soa(positions, outputs, count, rtm_impl::spatial_hash_kernel{ rtm_impl::spatial_grid_transform(grid) });
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a 32 bit sort key for the depth of each of 'count' positions stored as
+	// structure of arrays: the distance along the camera forward axis.
+	// Sorting the keys in increasing order as unsigned integers sorts the positions
+	// in the requested order, the keys are exact and handle negative depths.
+	// Each iteration processes 8 positions with AVX2 and 4 otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL spatial_depth_keys_soa(const const_float3f_soa& positions, vector4f_arg0 camera_position, vector4f_arg1 camera_forward, uint32_t* output_keys, uint32_t count, depth_sort_order order = depth_sort_order::front_to_back) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::spatial_depth_keys_soa", count, count * sizeof(float) * 4);
+
+		rtm_impl::spatial_depth_kernel kernel;
+		kernel.camera_position[0] = vector_get_x(camera_position);
+		kernel.camera_position[1] = vector_get_y(camera_position);
+		kernel.camera_position[2] = vector_get_z(camera_position);
+		kernel.camera_forward[0] = vector_get_x(camera_forward);
+		kernel.camera_forward[1] = vector_get_y(camera_forward);
+		kernel.camera_forward[2] = vector_get_z(camera_forward);
+		kernel.order_flip = order == depth_sort_order::back_to_front ? -1 : 0;
+
+		uint32_t* const outputs[1] = { output_keys };
+		rtm_impl::spatial_evaluate_soa(positions, outputs, count, kernel);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
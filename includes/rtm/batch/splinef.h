@@ -0,0 +1,292 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/quat8f.h"
+#include "rtm/quatf.h"
+#include "rtm/splinef.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/batch/quatf.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The component streams of the 4 control points of a set of curves and of their output.
+		//////////////////////////////////////////////////////////////////////////
+		struct spline_soa_streams
+		{
+			const float* control_points[4][4];
+			float* output[4];
+			uint32_t num_components;
+		};
+
+		inline spline_soa_streams spline_make_streams(const const_float3f_soa& p0, const const_float3f_soa& p1, const const_float3f_soa& p2, const const_float3f_soa& p3, const float3f_soa& output) RTM_NO_EXCEPT
+		{
+			return spline_soa_streams{
+				{ { p0.x, p0.y, p0.z, nullptr }, { p1.x, p1.y, p1.z, nullptr }, { p2.x, p2.y, p2.z, nullptr }, { p3.x, p3.y, p3.z, nullptr } },
+				{ output.x, output.y, output.z, nullptr },
+				3
+			};
+		}
+
+		inline spline_soa_streams spline_make_streams(const const_float4f_soa& p0, const const_float4f_soa& p1, const const_float4f_soa& p2, const const_float4f_soa& p3, const float4f_soa& output) RTM_NO_EXCEPT
+		{
+			return spline_soa_streams{
+				{ { p0.x, p0.y, p0.z, p0.w }, { p1.x, p1.y, p1.z, p1.w }, { p2.x, p2.y, p2.z, p2.w }, { p3.x, p3.y, p3.z, p3.w } },
+				{ output.x, output.y, output.z, output.w },
+				4
+			};
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates one cubic curve per value, each at its own time.
+		// The weights are computed once per value and shared by every component.
+		//////////////////////////////////////////////////////////////////////////
+		inline void spline_eval_soa_impl(const spline_basis4& basis, const spline_soa_streams& streams, const float* t, uint32_t num_values) RTM_NO_EXCEPT
+		{
+			const uint32_t num_components = streams.num_components;
+			uint32_t value_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+			for (; value_index + 8 <= num_values; value_index += 8)
+			{
+				const vector8f t8 = vector8_load(t + value_index);
+
+				vector8f weights[4];
+				for (uint32_t point_index = 0; point_index < 4; ++point_index)
+				{
+					const vector8f c0 = vector8_set(basis.coefficients[0][point_index]);
+					const vector8f c1 = vector8_set(basis.coefficients[1][point_index]);
+					const vector8f c2 = vector8_set(basis.coefficients[2][point_index]);
+					const vector8f c3 = vector8_set(basis.coefficients[3][point_index]);
+					weights[point_index] = vector_mul_add(vector_mul_add(vector_mul_add(c3, t8, c2), t8, c1), t8, c0);
+				}
+
+				for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+				{
+					const vector8f p0 = vector8_load(streams.control_points[0][component_index] + value_index);
+					const vector8f p1 = vector8_load(streams.control_points[1][component_index] + value_index);
+					const vector8f p2 = vector8_load(streams.control_points[2][component_index] + value_index);
+					const vector8f p3 = vector8_load(streams.control_points[3][component_index] + value_index);
+
+					const vector8f result = vector_mul_add(p3, weights[3], vector_mul_add(p2, weights[2], vector_mul_add(p1, weights[1], vector_mul(p0, weights[0]))));
+					vector_store(result, streams.output[component_index] + value_index);
+				}
+			}
+#endif
+
+			for (; value_index + 4 <= num_values; value_index += 4)
+			{
+				const vector4f t4 = vector_load(t + value_index);
+
+				vector4f weights[4];
+				for (uint32_t point_index = 0; point_index < 4; ++point_index)
+				{
+					const vector4f c0 = vector_set(basis.coefficients[0][point_index]);
+					const vector4f c1 = vector_set(basis.coefficients[1][point_index]);
+					const vector4f c2 = vector_set(basis.coefficients[2][point_index]);
+					const vector4f c3 = vector_set(basis.coefficients[3][point_index]);
+					weights[point_index] = vector_mul_add(vector_mul_add(vector_mul_add(c3, t4, c2), t4, c1), t4, c0);
+				}
+
+				for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+				{
+					const vector4f p0 = vector_load(streams.control_points[0][component_index] + value_index);
+					const vector4f p1 = vector_load(streams.control_points[1][component_index] + value_index);
+					const vector4f p2 = vector_load(streams.control_points[2][component_index] + value_index);
+					const vector4f p3 = vector_load(streams.control_points[3][component_index] + value_index);
+
+					const vector4f result = vector_mul_add(p3, weights[3], vector_mul_add(p2, weights[2], vector_mul_add(p1, weights[1], vector_mul(p0, weights[0]))));
+					vector_store(result, streams.output[component_index] + value_index);
+				}
+			}
+
+			for (; value_index < num_values; ++value_index)
+			{
+				const vector4f weights = spline_weights(basis, t[value_index]);
+
+				for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+				{
+					const vector4f points = vector_set(
+						streams.control_points[0][component_index][value_index],
+						streams.control_points[1][component_index][value_index],
+						streams.control_points[2][component_index][value_index],
+						streams.control_points[3][component_index][value_index]);
+
+					streams.output[component_index][value_index] = vector_dot(points, weights);
+				}
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Evaluates 'num_curves' cubic Bezier curves stored as structure of arrays,
+	// each at its own time: output[i] = vector_bezier(p0[i], p1[i], p2[i], p3[i], t[i]).
+	// The output can safely alias any input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_bezier_soa(const const_float3f_soa& p0, const const_float3f_soa& p1, const const_float3f_soa& p2, const const_float3f_soa& p3, const float* t, const float3f_soa& output, uint32_t num_curves) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_bezier_soa", num_curves, num_curves * sizeof(float) * 16);
+		rtm_impl::spline_eval_soa_impl(rtm_impl::spline_bezier_basis(), rtm_impl::spline_make_streams(p0, p1, p2, p3, output), t, num_curves);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Evaluates 'num_curves' cubic Bezier curves stored as structure of arrays,
+	// each at its own time: output[i] = vector_bezier(p0[i], p1[i], p2[i], p3[i], t[i]).
+	// The output can safely alias any input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_bezier_soa(const const_float4f_soa& p0, const const_float4f_soa& p1, const const_float4f_soa& p2, const const_float4f_soa& p3, const float* t, const float4f_soa& output, uint32_t num_curves) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_bezier_soa", num_curves, num_curves * sizeof(float) * 21);
+		rtm_impl::spline_eval_soa_impl(rtm_impl::spline_bezier_basis(), rtm_impl::spline_make_streams(p0, p1, p2, p3, output), t, num_curves);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Evaluates 'num_curves' cubic Hermite curves stored as structure of arrays,
+	// each at its own time: output[i] = vector_hermite(start[i], start_tangent[i], end[i], end_tangent[i], t[i]).
+	// The output can safely alias any input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_hermite_soa(const const_float3f_soa& start, const const_float3f_soa& start_tangent, const const_float3f_soa& end, const const_float3f_soa& end_tangent, const float* t, const float3f_soa& output, uint32_t num_curves) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_hermite_soa", num_curves, num_curves * sizeof(float) * 16);
+		rtm_impl::spline_eval_soa_impl(rtm_impl::spline_hermite_basis(), rtm_impl::spline_make_streams(start, start_tangent, end, end_tangent, output), t, num_curves);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Evaluates 'num_curves' cubic Hermite curves stored as structure of arrays,
+	// each at its own time: output[i] = vector_hermite(start[i], start_tangent[i], end[i], end_tangent[i], t[i]).
+	// The output can safely alias any input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_hermite_soa(const const_float4f_soa& start, const const_float4f_soa& start_tangent, const const_float4f_soa& end, const const_float4f_soa& end_tangent, const float* t, const float4f_soa& output, uint32_t num_curves) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_hermite_soa", num_curves, num_curves * sizeof(float) * 21);
+		rtm_impl::spline_eval_soa_impl(rtm_impl::spline_hermite_basis(), rtm_impl::spline_make_streams(start, start_tangent, end, end_tangent, output), t, num_curves);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Evaluates 'num_curves' uniform Catmull-Rom curves stored as structure of arrays,
+	// each at its own time: output[i] = vector_catmull_rom(p0[i], p1[i], p2[i], p3[i], t[i]).
+	// The output can safely alias any input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_catmull_rom_soa(const const_float3f_soa& p0, const const_float3f_soa& p1, const const_float3f_soa& p2, const const_float3f_soa& p3, const float* t, const float3f_soa& output, uint32_t num_curves) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_catmull_rom_soa", num_curves, num_curves * sizeof(float) * 16);
+		rtm_impl::spline_eval_soa_impl(rtm_impl::spline_catmull_rom_basis(), rtm_impl::spline_make_streams(p0, p1, p2, p3, output), t, num_curves);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Evaluates 'num_curves' uniform Catmull-Rom curves stored as structure of arrays,
+	// each at its own time: output[i] = vector_catmull_rom(p0[i], p1[i], p2[i], p3[i], t[i]).
+	// The output can safely alias any input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_catmull_rom_soa(const const_float4f_soa& p0, const const_float4f_soa& p1, const const_float4f_soa& p2, const const_float4f_soa& p3, const float* t, const float4f_soa& output, uint32_t num_curves) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_catmull_rom_soa", num_curves, num_curves * sizeof(float) * 21);
+		rtm_impl::spline_eval_soa_impl(rtm_impl::spline_catmull_rom_basis(), rtm_impl::spline_make_streams(p0, p1, p2, p3, output), t, num_curves);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Evaluates 'num_curves' squad rotation curves stored as structure of arrays,
+	// each at its own time: output[i] = quat_squad(start[i], start_control[i], end_control[i], end[i], t[i]).
+	// The 3 spherical interpolations use the quat_slerp_fast polynomial: the result is within 1.0e-4
+	// of quat_squad and it is not normalized.
+	// The output can safely alias any input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_squad_soa(const const_float4f_soa& start, const const_float4f_soa& start_control, const const_float4f_soa& end_control, const const_float4f_soa& end, const float* t, const float4f_soa& output, uint32_t num_curves) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_squad_soa", num_curves, num_curves * sizeof(float) * 21);
+		uint32_t curve_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+		const vector8f two8 = vector8_set(2.0F);
+		const vector8f one8 = vector8_set(1.0F);
+
+		for (; curve_index + 8 <= num_curves; curve_index += 8)
+		{
+			const vector8f t8 = vector8_load(t + curve_index);
+			const quat8f outer = quat_slerp_fast(quat8_load(start, curve_index), quat8_load(end, curve_index), t8);
+			const quat8f inner = quat_slerp_fast(quat8_load(start_control, curve_index), quat8_load(end_control, curve_index), t8);
+			const vector8f blend = vector_mul(vector_mul(two8, t8), vector_sub(one8, t8));
+			quat_store(quat_slerp_fast(outer, inner, blend), output, curve_index);
+		}
+#endif
+
+		const vector4f two = vector_set(2.0F);
+		const vector4f one = vector_set(1.0F);
+
+		for (; curve_index + 4 <= num_curves; curve_index += 4)
+		{
+			const vector4f t4 = vector_load(t + curve_index);
+
+			vector4f outer_x, outer_y, outer_z, outer_w;
+			rtm_impl::quat_slerp_fast_soa4(
+				vector_load(start.x + curve_index), vector_load(start.y + curve_index), vector_load(start.z + curve_index), vector_load(start.w + curve_index),
+				vector_load(end.x + curve_index), vector_load(end.y + curve_index), vector_load(end.z + curve_index), vector_load(end.w + curve_index),
+				t4, outer_x, outer_y, outer_z, outer_w);
+
+			vector4f inner_x, inner_y, inner_z, inner_w;
+			rtm_impl::quat_slerp_fast_soa4(
+				vector_load(start_control.x + curve_index), vector_load(start_control.y + curve_index), vector_load(start_control.z + curve_index), vector_load(start_control.w + curve_index),
+				vector_load(end_control.x + curve_index), vector_load(end_control.y + curve_index), vector_load(end_control.z + curve_index), vector_load(end_control.w + curve_index),
+				t4, inner_x, inner_y, inner_z, inner_w);
+
+			const vector4f blend = vector_mul(vector_mul(two, t4), vector_sub(one, t4));
+
+			vector4f x, y, z, w;
+			rtm_impl::quat_slerp_fast_soa4(outer_x, outer_y, outer_z, outer_w, inner_x, inner_y, inner_z, inner_w, blend, x, y, z, w);
+
+			vector_store(x, output.x + curve_index);
+			vector_store(y, output.y + curve_index);
+			vector_store(z, output.z + curve_index);
+			vector_store(w, output.w + curve_index);
+		}
+
+		for (; curve_index < num_curves; ++curve_index)
+		{
+			const float curve_t = t[curve_index];
+			const quatf outer = quat_slerp_fast(rtm_impl::quat_batch_load(start, curve_index), rtm_impl::quat_batch_load(end, curve_index), curve_t);
+			const quatf inner = quat_slerp_fast(rtm_impl::quat_batch_load(start_control, curve_index), rtm_impl::quat_batch_load(end_control, curve_index), curve_t);
+			rtm_impl::quat_batch_store(quat_slerp_fast(outer, inner, 2.0F * curve_t * (1.0F - curve_t)), output, curve_index);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,266 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quat8f.h"
+#include "rtm/quatf.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The two keys surrounding a sample time in a uniformly sampled track and the
+	// interpolation alpha between them.
+	//////////////////////////////////////////////////////////////////////////
+	struct track_sample_keys
+	{
+		uint32_t key0;
+		uint32_t key1;
+		float alpha;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Finds the two keys to interpolate for a sample time in seconds with 'num_keys'
+	// keys sampled at 'sample_rate' keys per second: the first key is at time 0.0.
+	// The sample time is clamped to the track duration, the last key is repeated at the end.
+	// At least one key is required.
+	//////////////////////////////////////////////////////////////////////////
+	inline track_sample_keys track_find_sample_keys(float sample_time, float sample_rate, uint32_t num_keys) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_keys != 0, "At least one key is required");
+
+		const uint32_t last_key = num_keys - 1;
+		const float key_time = scalar_clamp(sample_time * sample_rate, 0.0F, float(last_key));
+		const float key0_time = scalar_floor(key_time);
+
+		track_sample_keys result;
+		result.key0 = static_cast<uint32_t>(key0_time);
+		result.key1 = result.key0 < last_key ? result.key0 + 1 : last_key;
+		result.alpha = key_time - key0_time;
+		return result;
+	}
+
+	namespace rtm_impl
+	{
+		// Tracks are prefetched one cache line at a time
+		constexpr uint32_t k_track_sample_prefetch_stride = 16;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Prefetches the key after 'key1' for the next tracks, the next sample time is
+		// likely to interpolate it.
+		//////////////////////////////////////////////////////////////////////////
+		inline void track_prefetch_next_key(const float* const* key_streams, uint32_t num_components, const track_sample_keys& keys, uint32_t num_keys, uint32_t num_tracks, uint32_t track_index) RTM_NO_EXCEPT
+		{
+			if (keys.key1 + 1 >= num_keys || (track_index % k_track_sample_prefetch_stride) != 0)
+				return;
+
+			const size_t next_key_offset = size_t(keys.key1 + 1) * num_tracks + track_index;
+			for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+				batch_prefetch(key_streams[component_index] + next_key_offset);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Linearly interpolates every component of 'num_tracks' uniformly sampled tracks.
+		//////////////////////////////////////////////////////////////////////////
+		inline void vector_sample_uniform_soa_impl(const float* const* key_streams, float* const* output, uint32_t num_components, const track_sample_keys& keys, uint32_t num_keys, uint32_t num_tracks) RTM_NO_EXCEPT
+		{
+			const size_t key0_offset = size_t(keys.key0) * num_tracks;
+			const size_t key1_offset = size_t(keys.key1) * num_tracks;
+			const float alpha = keys.alpha;
+
+			uint32_t track_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+			for (; track_index + 8 <= num_tracks; track_index += 8)
+			{
+				track_prefetch_next_key(key_streams, num_components, keys, num_keys, num_tracks, track_index);
+
+				for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+				{
+					const float* stream = key_streams[component_index] + track_index;
+					const vector8f start = vector8_load(stream + key0_offset);
+					const vector8f end = vector8_load(stream + key1_offset);
+					vector_store(vector_lerp(start, end, alpha), output[component_index] + track_index);
+				}
+			}
+#endif
+
+			for (; track_index + 4 <= num_tracks; track_index += 4)
+			{
+				track_prefetch_next_key(key_streams, num_components, keys, num_keys, num_tracks, track_index);
+
+				for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+				{
+					const float* stream = key_streams[component_index] + track_index;
+					const vector4f start = vector_load(stream + key0_offset);
+					const vector4f end = vector_load(stream + key1_offset);
+					vector_store(vector_lerp(start, end, alpha), output[component_index] + track_index);
+				}
+			}
+
+			for (; track_index < num_tracks; ++track_index)
+			{
+				for (uint32_t component_index = 0; component_index < num_components; ++component_index)
+				{
+					const float* stream = key_streams[component_index] + track_index;
+					output[component_index][track_index] = scalar_lerp(stream[key0_offset], stream[key1_offset], alpha);
+				}
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Samples 'num_tracks' uniformly sampled 3D vector tracks at the provided time in seconds.
+	// The keys are stored as structure of arrays, key major: component 'c' of track 't' at key 'k'
+	// is keys.c[k * num_tracks + t]. Every track has 'num_keys' keys sampled at 'sample_rate'
+	// keys per second. The keys are found once with track_find_sample_keys and every track is
+	// interpolated with vector_lerp. The key following the interpolated ones is prefetched.
+	// The output must not overlap the keys.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_sample_uniform_soa(const const_float3f_soa& keys, uint32_t num_keys, float sample_rate, float sample_time, const float3f_soa& output, uint32_t num_tracks) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_sample_uniform_soa", num_tracks, num_tracks * sizeof(float) * 9);
+
+		const track_sample_keys sample_keys = track_find_sample_keys(sample_time, sample_rate, num_keys);
+		const float* key_streams[3] = { keys.x, keys.y, keys.z };
+		float* output_streams[3] = { output.x, output.y, output.z };
+		rtm_impl::vector_sample_uniform_soa_impl(key_streams, output_streams, 3, sample_keys, num_keys, num_tracks);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Samples 'num_tracks' uniformly sampled 4D vector tracks at the provided time in seconds.
+	// The keys are stored as structure of arrays, key major: component 'c' of track 't' at key 'k'
+	// is keys.c[k * num_tracks + t]. Every track has 'num_keys' keys sampled at 'sample_rate'
+	// keys per second. The keys are found once with track_find_sample_keys and every track is
+	// interpolated with vector_lerp. The key following the interpolated ones is prefetched.
+	// The output must not overlap the keys.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_sample_uniform_soa(const const_float4f_soa& keys, uint32_t num_keys, float sample_rate, float sample_time, const float4f_soa& output, uint32_t num_tracks) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_sample_uniform_soa", num_tracks, num_tracks * sizeof(float) * 12);
+
+		const track_sample_keys sample_keys = track_find_sample_keys(sample_time, sample_rate, num_keys);
+		const float* key_streams[4] = { keys.x, keys.y, keys.z, keys.w };
+		float* output_streams[4] = { output.x, output.y, output.z, output.w };
+		rtm_impl::vector_sample_uniform_soa_impl(key_streams, output_streams, 4, sample_keys, num_keys, num_tracks);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Samples 'num_tracks' uniformly sampled rotation tracks at the provided time in seconds.
+	// The keys are stored as structure of arrays, key major: component 'c' of track 't' at key 'k'
+	// is keys.c[k * num_tracks + t]. Every track has 'num_keys' keys sampled at 'sample_rate'
+	// keys per second. The keys are found once with track_find_sample_keys and every track is
+	// interpolated with quat_lerp: the second key is flipped when needed and the result is
+	// normalized. The key following the interpolated ones is prefetched.
+	// The output must not overlap the keys.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_sample_uniform_soa(const const_float4f_soa& keys, uint32_t num_keys, float sample_rate, float sample_time, const float4f_soa& output, uint32_t num_tracks) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::quat_sample_uniform_soa", num_tracks, num_tracks * sizeof(float) * 12);
+
+		const track_sample_keys sample_keys = track_find_sample_keys(sample_time, sample_rate, num_keys);
+		const float* key_streams[4] = { keys.x, keys.y, keys.z, keys.w };
+		const size_t key0_offset = size_t(sample_keys.key0) * num_tracks;
+		const size_t key1_offset = size_t(sample_keys.key1) * num_tracks;
+		const const_float4f_soa start = { keys.x + key0_offset, keys.y + key0_offset, keys.z + key0_offset, keys.w + key0_offset };
+		const const_float4f_soa end = { keys.x + key1_offset, keys.y + key1_offset, keys.z + key1_offset, keys.w + key1_offset };
+		const float alpha = sample_keys.alpha;
+
+		uint32_t track_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+		const vector8f alpha8 = vector8_set(alpha);
+		for (; track_index + 8 <= num_tracks; track_index += 8)
+		{
+			rtm_impl::track_prefetch_next_key(key_streams, 4, sample_keys, num_keys, num_tracks, track_index);
+
+			const quat8f start8 = quat8_load(start, track_index);
+			const quat8f end8 = quat8_load(end, track_index);
+			quat_store(quat_lerp(start8, end8, alpha8), output, track_index);
+		}
+#endif
+
+		const vector4f alpha4 = vector_set(alpha);
+		for (; track_index + 4 <= num_tracks; track_index += 4)
+		{
+			rtm_impl::track_prefetch_next_key(key_streams, 4, sample_keys, num_keys, num_tracks, track_index);
+
+			const vector4f start_x = vector_load(start.x + track_index);
+			const vector4f start_y = vector_load(start.y + track_index);
+			const vector4f start_z = vector_load(start.z + track_index);
+			const vector4f start_w = vector_load(start.w + track_index);
+
+			const vector4f end_x = vector_load(end.x + track_index);
+			const vector4f end_y = vector_load(end.y + track_index);
+			const vector4f end_z = vector_load(end.z + track_index);
+			const vector4f end_w = vector_load(end.w + track_index);
+
+			// If the dot product is negative, we flip the 'end' rotation by negating its alpha
+			const vector4f dot = vector_mul_add(start_w, end_w, vector_mul_add(start_z, end_z, vector_mul_add(start_y, end_y, vector_mul(start_x, end_x))));
+			const vector4f end_alpha = vector_select(vector_less_than(dot, vector_zero()), vector_neg(alpha4), alpha4);
+
+			// ((1.0 - alpha) * start) + (end_alpha * end) == (start - alpha * start) + (end_alpha * end)
+			const vector4f x = vector_mul_add(end_x, end_alpha, vector_neg_mul_sub(start_x, alpha4, start_x));
+			const vector4f y = vector_mul_add(end_y, end_alpha, vector_neg_mul_sub(start_y, alpha4, start_y));
+			const vector4f z = vector_mul_add(end_z, end_alpha, vector_neg_mul_sub(start_z, alpha4, start_z));
+			const vector4f w = vector_mul_add(end_w, end_alpha, vector_neg_mul_sub(start_w, alpha4, start_w));
+
+			const vector4f length_squared = vector_mul_add(w, w, vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x))));
+			const vector4f length_reciprocal = vector_reciprocal(vector_sqrt(length_squared));
+
+			vector_store(vector_mul(x, length_reciprocal), output.x + track_index);
+			vector_store(vector_mul(y, length_reciprocal), output.y + track_index);
+			vector_store(vector_mul(z, length_reciprocal), output.z + track_index);
+			vector_store(vector_mul(w, length_reciprocal), output.w + track_index);
+		}
+
+		for (; track_index < num_tracks; ++track_index)
+		{
+			const quatf start_q = quat_set(start.x[track_index], start.y[track_index], start.z[track_index], start.w[track_index]);
+			const quatf end_q = quat_set(end.x[track_index], end.y[track_index], end.z[track_index], end.w[track_index]);
+			const quatf result = quat_lerp(start_q, end_q, alpha);
+
+			output.x[track_index] = quat_get_x(result);
+			output.y[track_index] = quat_get_y(result);
+			output.z[track_index] = quat_get_z(result);
+			output.w[track_index] = quat_get_w(result);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,220 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/qvvf.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/error.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the affine matrix that maps a shell point to its displacement between
+		// the reference and the approximated transforms: both transforms are linear in the
+		// point, their difference is applied once instead of transforming the point twice.
+		// The shell distance scales the points and is folded into the rotation and scale.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix3x4f qvv_error_matrix(const qvvf& reference, const qvvf& approximation, float shell_distance) RTM_NO_EXCEPT
+		{
+			const matrix3x4f reference_mtx = matrix_from_qvv(reference);
+			const matrix3x4f approximation_mtx = matrix_from_qvv(approximation);
+
+			const vector4f distance = vector_set(shell_distance);
+			const vector4f x_axis = vector_mul(vector_sub(reference_mtx.x_axis, approximation_mtx.x_axis), distance);
+			const vector4f y_axis = vector_mul(vector_sub(reference_mtx.y_axis, approximation_mtx.y_axis), distance);
+			const vector4f z_axis = vector_mul(vector_sub(reference_mtx.z_axis, approximation_mtx.z_axis), distance);
+			const vector4f w_axis = vector_sub(reference_mtx.w_axis, approximation_mtx.w_axis);
+			return matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the largest squared displacement of the shell points by an error matrix.
+		//////////////////////////////////////////////////////////////////////////
+		inline float qvv_max_point_error_squared(const matrix3x4f& error_mtx, const const_float3f_soa& shell_points, uint32_t num_shell_points) RTM_NO_EXCEPT
+		{
+			// Every lane of a stream holds a different point, the matrix entries are broadcast once
+			const float m00 = vector_get_x(error_mtx.x_axis);
+			const float m01 = vector_get_y(error_mtx.x_axis);
+			const float m02 = vector_get_z(error_mtx.x_axis);
+			const float m10 = vector_get_x(error_mtx.y_axis);
+			const float m11 = vector_get_y(error_mtx.y_axis);
+			const float m12 = vector_get_z(error_mtx.y_axis);
+			const float m20 = vector_get_x(error_mtx.z_axis);
+			const float m21 = vector_get_y(error_mtx.z_axis);
+			const float m22 = vector_get_z(error_mtx.z_axis);
+			const float m30 = vector_get_x(error_mtx.w_axis);
+			const float m31 = vector_get_y(error_mtx.w_axis);
+			const float m32 = vector_get_z(error_mtx.w_axis);
+
+			// Squared distances are never negative, zero is a safe starting maximum
+			vector4f max_error_sq = vector_zero();
+			uint32_t point_index = 0;
+
+#if defined(RTM_AVX_INTRINSICS)
+			{
+				const vector8f m00_8 = vector8_set(m00);
+				const vector8f m01_8 = vector8_set(m01);
+				const vector8f m02_8 = vector8_set(m02);
+				const vector8f m10_8 = vector8_set(m10);
+				const vector8f m11_8 = vector8_set(m11);
+				const vector8f m12_8 = vector8_set(m12);
+				const vector8f m20_8 = vector8_set(m20);
+				const vector8f m21_8 = vector8_set(m21);
+				const vector8f m22_8 = vector8_set(m22);
+				const vector8f m30_8 = vector8_set(m30);
+				const vector8f m31_8 = vector8_set(m31);
+				const vector8f m32_8 = vector8_set(m32);
+
+				vector8f max_error_sq_8 = vector8_zero();
+				for (; point_index + 8 <= num_shell_points; point_index += 8)
+				{
+					const vector8f x = vector8_load(shell_points.x + point_index);
+					const vector8f y = vector8_load(shell_points.y + point_index);
+					const vector8f z = vector8_load(shell_points.z + point_index);
+
+					const vector8f error_x = vector_mul_add(z, m20_8, vector_mul_add(y, m10_8, vector_mul_add(x, m00_8, m30_8)));
+					const vector8f error_y = vector_mul_add(z, m21_8, vector_mul_add(y, m11_8, vector_mul_add(x, m01_8, m31_8)));
+					const vector8f error_z = vector_mul_add(z, m22_8, vector_mul_add(y, m12_8, vector_mul_add(x, m02_8, m32_8)));
+
+					const vector8f error_sq = vector_mul_add(error_z, error_z, vector_mul_add(error_y, error_y, vector_mul(error_x, error_x)));
+					max_error_sq_8 = vector_max(max_error_sq_8, error_sq);
+				}
+
+				max_error_sq = vector_max(_mm256_castps256_ps128(max_error_sq_8), _mm256_extractf128_ps(max_error_sq_8, 1));
+			}
+#endif
+
+			{
+				const vector4f m00_4 = vector_set(m00);
+				const vector4f m01_4 = vector_set(m01);
+				const vector4f m02_4 = vector_set(m02);
+				const vector4f m10_4 = vector_set(m10);
+				const vector4f m11_4 = vector_set(m11);
+				const vector4f m12_4 = vector_set(m12);
+				const vector4f m20_4 = vector_set(m20);
+				const vector4f m21_4 = vector_set(m21);
+				const vector4f m22_4 = vector_set(m22);
+				const vector4f m30_4 = vector_set(m30);
+				const vector4f m31_4 = vector_set(m31);
+				const vector4f m32_4 = vector_set(m32);
+
+				for (; point_index + 4 <= num_shell_points; point_index += 4)
+				{
+					const vector4f x = vector_load(shell_points.x + point_index);
+					const vector4f y = vector_load(shell_points.y + point_index);
+					const vector4f z = vector_load(shell_points.z + point_index);
+
+					const vector4f error_x = vector_mul_add(z, m20_4, vector_mul_add(y, m10_4, vector_mul_add(x, m00_4, m30_4)));
+					const vector4f error_y = vector_mul_add(z, m21_4, vector_mul_add(y, m11_4, vector_mul_add(x, m01_4, m31_4)));
+					const vector4f error_z = vector_mul_add(z, m22_4, vector_mul_add(y, m12_4, vector_mul_add(x, m02_4, m32_4)));
+
+					const vector4f error_sq = vector_mul_add(error_z, error_z, vector_mul_add(error_y, error_y, vector_mul(error_x, error_x)));
+					max_error_sq = vector_max(max_error_sq, error_sq);
+				}
+			}
+
+			float max_error_sq_scalar = vector_get_max_component(max_error_sq);
+			for (; point_index < num_shell_points; ++point_index)
+			{
+				const float x = shell_points.x[point_index];
+				const float y = shell_points.y[point_index];
+				const float z = shell_points.z[point_index];
+
+				const float error_x = (z * m20) + (y * m10) + (x * m00) + m30;
+				const float error_y = (z * m21) + (y * m11) + (x * m01) + m31;
+				const float error_z = (z * m22) + (y * m12) + (x * m02) + m32;
+				max_error_sq_scalar = scalar_max(max_error_sq_scalar, (error_x * error_x) + (error_y * error_y) + (error_z * error_z));
+			}
+
+			return max_error_sq_scalar;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Measures how far an approximated pose is from its reference, e.g. to validate
+	// compression or LOD. Each transform has a shell of virtual vertices around it: the
+	// shell points, in the local space of the transform, are scaled by the shell distance
+	// of the transform. The error of a transform is the largest displacement of its shell
+	// points between qvv_mul_point3(point, reference) and qvv_mul_point3(point, approximation).
+	//
+	// Writes the squared error of 'num_transforms' transforms in 'out_errors_squared', as
+	// vector_length_squared3(..) does the square root is skipped. When 'shell_distances'
+	// is null, the shell points are used as-is for every transform.
+	// Both transforms are converted to matrices that are subtracted, equal transforms
+	// can return a tiny nonzero error when the compiler contracts the two conversions
+	// differently (e.g. with FMA).
+	// The rotations must be normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline void qvv_point_error_squared_soa(const qvvf* reference_transforms, const qvvf* approximation_transforms, uint32_t num_transforms,
+		const const_float3f_soa& shell_points, uint32_t num_shell_points, const float* shell_distances, float* out_errors_squared) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_point_error_squared_soa", num_transforms, num_transforms * (sizeof(qvvf) * 2 + sizeof(float) * 2) + num_shell_points * sizeof(float) * 3);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const float shell_distance = shell_distances != nullptr ? shell_distances[transform_index] : 1.0F;
+			const matrix3x4f error_mtx = rtm_impl::qvv_error_matrix(reference_transforms[transform_index], approximation_transforms[transform_index], shell_distance);
+			out_errors_squared[transform_index] = rtm_impl::qvv_max_point_error_squared(error_mtx, shell_points, num_shell_points);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Measures the error of transforms like qvv_point_error_squared_soa(..) but stops at the
+	// first transform whose error is larger than 'threshold'. The threshold is a distance,
+	// it is compared with the squared errors like the lengths returned by vector_length3(..).
+	// Returns the index of that transform or 'num_transforms' when every error is within the
+	// threshold. The squared errors are written up to and including the returned index.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t qvv_find_point_error_above_soa(const qvvf* reference_transforms, const qvvf* approximation_transforms, uint32_t num_transforms,
+		const const_float3f_soa& shell_points, uint32_t num_shell_points, const float* shell_distances, float threshold, float* out_errors_squared) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::qvv_find_point_error_above_soa", num_transforms, num_transforms * (sizeof(qvvf) * 2 + sizeof(float) * 2) + num_shell_points * sizeof(float) * 3);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const float shell_distance = shell_distances != nullptr ? shell_distances[transform_index] : 1.0F;
+			const matrix3x4f error_mtx = rtm_impl::qvv_error_matrix(reference_transforms[transform_index], approximation_transforms[transform_index], shell_distance);
+			const float error_sq = rtm_impl::qvv_max_point_error_squared(error_mtx, shell_points, num_shell_points);
+			out_errors_squared[transform_index] = error_sq;
+
+			if (rtm_impl::length_squared_greater_than(error_sq, threshold))
+				return transform_index;
+		}
+
+		return num_transforms;
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,393 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		template<normalize_precision precision>
+		inline void vector_normalize3_soa_impl(const const_float3f_soa& input, const float3f_soa& output, uint32_t num_vectors) RTM_NO_EXCEPT
+		{
+			uint32_t vector_index = 0;
+
+#if defined(RTM_SVE_INTRINSICS)
+			// The last iteration is predicated, no vector is left for the loops below
+			for (; vector_index < num_vectors; vector_index += batch_sve_num_lanes())
+			{
+				const svbool_t pg = svwhilelt_b32(vector_index, num_vectors);
+
+				const svfloat32_t x = svld1_f32(pg, input.x + vector_index);
+				const svfloat32_t y = svld1_f32(pg, input.y + vector_index);
+				const svfloat32_t z = svld1_f32(pg, input.z + vector_index);
+
+				const svfloat32_t length_squared = svmla_f32_x(pg, svmla_f32_x(pg, svmul_f32_x(pg, x, x), y, y), z, z);
+				const svfloat32_t length_reciprocal = batch_sqrt_reciprocal<precision>(pg, length_squared);
+
+				svst1_f32(pg, output.x + vector_index, svmul_f32_x(pg, x, length_reciprocal));
+				svst1_f32(pg, output.y + vector_index, svmul_f32_x(pg, y, length_reciprocal));
+				svst1_f32(pg, output.z + vector_index, svmul_f32_x(pg, z, length_reciprocal));
+			}
+#elif defined(RTM_AVX_INTRINSICS)
+			for (; vector_index + 8 <= num_vectors; vector_index += 8)
+			{
+				const vector8f x = vector8_load(input.x + vector_index);
+				const vector8f y = vector8_load(input.y + vector_index);
+				const vector8f z = vector8_load(input.z + vector_index);
+
+				const vector8f length_squared = vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x)));
+				const vector8f length_reciprocal = batch_sqrt_reciprocal<precision>(length_squared);
+
+				vector_store(vector_mul(x, length_reciprocal), output.x + vector_index);
+				vector_store(vector_mul(y, length_reciprocal), output.y + vector_index);
+				vector_store(vector_mul(z, length_reciprocal), output.z + vector_index);
+			}
+#endif
+
+			// Each vector4f holds the same component of 4 consecutive vectors, lengths are computed lane-wise
+			for (; vector_index + 4 <= num_vectors; vector_index += 4)
+			{
+				const vector4f x = vector_load(input.x + vector_index);
+				const vector4f y = vector_load(input.y + vector_index);
+				const vector4f z = vector_load(input.z + vector_index);
+
+				const vector4f length_squared = vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x)));
+				const vector4f length_reciprocal = batch_sqrt_reciprocal<precision>(length_squared);
+
+				vector_store(vector_mul(x, length_reciprocal), output.x + vector_index);
+				vector_store(vector_mul(y, length_reciprocal), output.y + vector_index);
+				vector_store(vector_mul(z, length_reciprocal), output.z + vector_index);
+			}
+
+			// The remaining vectors use the same reciprocal square root as the wide loops
+			for (; vector_index < num_vectors; ++vector_index)
+			{
+				const float x = input.x[vector_index];
+				const float y = input.y[vector_index];
+				const float z = input.z[vector_index];
+
+				const float length_squared = (x * x) + (y * y) + (z * z);
+				const float length_reciprocal = vector_get_x(batch_sqrt_reciprocal<precision>(vector_set(length_squared)));
+
+				output.x[vector_index] = x * length_reciprocal;
+				output.y[vector_index] = y * length_reciprocal;
+				output.z[vector_index] = z * length_reciprocal;
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Normalizes 'num_vectors' 3D vectors stored as structure of arrays.
+	// Lengths are computed lane-wise, no horizontal shuffling is required.
+	// The precision controls how the reciprocal length is calculated, see normalize_precision.
+	// If the length of an input is not finite or zero, its result is undefined.
+	// The output can safely alias the input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_normalize3_soa(const const_float3f_soa& input, const float3f_soa& output, uint32_t num_vectors, normalize_precision precision = normalize_precision::exact) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_normalize3_soa", num_vectors, num_vectors * sizeof(float) * 6);
+		switch (precision)
+		{
+		case normalize_precision::estimate:
+			rtm_impl::vector_normalize3_soa_impl<normalize_precision::estimate>(input, output, num_vectors);
+			break;
+		case normalize_precision::refined:
+			rtm_impl::vector_normalize3_soa_impl<normalize_precision::refined>(input, output, num_vectors);
+			break;
+		case normalize_precision::exact:
+		default:
+			rtm_impl::vector_normalize3_soa_impl<normalize_precision::exact>(input, output, num_vectors);
+			break;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Normalizes 'num_vectors' 3D vectors stored as structure of arrays.
+	// The reciprocal length is calculated with the policy normalize_precision,
+	// selected at compile time, see precision::fast, precision::standard, and precision::exact.
+	// If the length of an input is not finite or zero, its result is undefined.
+	// The output can safely alias the input.
+	// Streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline void vector_normalize3_soa(const const_float3f_soa& input, const float3f_soa& output, uint32_t num_vectors, precision_policy) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_normalize3_soa", num_vectors, num_vectors * sizeof(float) * 6);
+		rtm_impl::vector_normalize3_soa_impl<precision_policy::normalize>(input, output, num_vectors);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 'num_vectors' packed 3D vectors (12 bytes stride) into vector4f with
+	// the [w] component set to zero, like vector_load3 on every entry.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon.
+	// The input does not need to be aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_load3_array(const float3f* input, vector4f* output, uint32_t num_vectors, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_load3_array", num_vectors, num_vectors * (sizeof(float3f) + sizeof(vector4f)));
+		const size_t input_size = size_t(num_vectors) * sizeof(float3f);
+		uint32_t vector_index = 0;
+
+#if defined(RTM_SSE2_INTRINSICS)
+		// 4 vectors span exactly 3 registers, the overlapping loads stay within them
+		const __m128 xyz_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+		for (; vector_index + 4 <= num_vectors; vector_index += 4)
+		{
+			rtm_impl::batch_prefetch_ahead(input, vector_index * sizeof(float3f), input_size, prefetch_distance);
+
+			const float* input_ptr = &input[vector_index].x;
+			const __m128 x0_y0_z0_x1 = _mm_loadu_ps(input_ptr + 0);
+			const __m128 x1_y1_z1_x2 = _mm_loadu_ps(input_ptr + 3);
+			const __m128 x2_y2_z2_x3 = _mm_loadu_ps(input_ptr + 6);
+			const __m128 z2_x3_y3_z3 = _mm_loadu_ps(input_ptr + 8);
+			const __m128 x3_y3_z3_z2 = _mm_shuffle_ps(z2_x3_y3_z3, z2_x3_y3_z3, _MM_SHUFFLE(0, 3, 2, 1));
+
+			float* output_ptr = reinterpret_cast<float*>(output + vector_index);
+			rtm_impl::batch_store(_mm_and_ps(x0_y0_z0_x1, xyz_mask), output_ptr + 0, mode);
+			rtm_impl::batch_store(_mm_and_ps(x1_y1_z1_x2, xyz_mask), output_ptr + 4, mode);
+			rtm_impl::batch_store(_mm_and_ps(x2_y2_z2_x3, xyz_mask), output_ptr + 8, mode);
+			rtm_impl::batch_store(_mm_and_ps(x3_y3_z3_z2, xyz_mask), output_ptr + 12, mode);
+		}
+#endif
+
+		for (; vector_index < num_vectors; ++vector_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, vector_index * sizeof(float3f), input_size, prefetch_distance);
+			rtm_impl::batch_store(vector_load3(input + vector_index), reinterpret_cast<float*>(output + vector_index), mode);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 'num_vectors' vector4f as packed 3D vectors (12 bytes stride),
+	// like vector_store3 on every entry.
+	// The input is prefetched 'prefetch_distance' bytes ahead, 0 disables prefetching.
+	// Use store_mode::non_temporal when the output is large and not read back soon,
+	// the output must then be 16 bytes aligned. The output must not overlap the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_store3_array(const vector4f* input, float3f* output, uint32_t num_vectors, store_mode mode = store_mode::cached, uint32_t prefetch_distance = rtm_impl::k_default_prefetch_distance) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_store3_array", num_vectors, num_vectors * (sizeof(vector4f) + sizeof(float3f)));
+		RTM_ASSERT(mode == store_mode::cached || rtm_impl::is_aligned_to(output, 16), "Non-temporal stores require 16 bytes alignment");
+
+		const size_t input_size = size_t(num_vectors) * sizeof(vector4f);
+		uint32_t vector_index = 0;
+
+#if defined(RTM_SSE2_INTRINSICS)
+		// 4 vectors are written as 3 full registers, with an aligned output every one of them is aligned
+		for (; vector_index + 4 <= num_vectors; vector_index += 4)
+		{
+			rtm_impl::batch_prefetch_ahead(input, vector_index * sizeof(vector4f), input_size, prefetch_distance);
+
+			const __m128 x0_y0_z0_w0 = input[vector_index + 0];
+			const __m128 x1_y1_z1_w1 = input[vector_index + 1];
+			const __m128 x2_y2_z2_w2 = input[vector_index + 2];
+			const __m128 x3_y3_z3_w3 = input[vector_index + 3];
+
+			const __m128 z0_z0_x1_x1 = _mm_shuffle_ps(x0_y0_z0_w0, x1_y1_z1_w1, _MM_SHUFFLE(0, 0, 2, 2));
+			const __m128 x0_y0_z0_x1 = _mm_shuffle_ps(x0_y0_z0_w0, z0_z0_x1_x1, _MM_SHUFFLE(2, 0, 1, 0));
+			const __m128 y1_z1_x2_y2 = _mm_shuffle_ps(x1_y1_z1_w1, x2_y2_z2_w2, _MM_SHUFFLE(1, 0, 2, 1));
+			const __m128 z2_z2_x3_x3 = _mm_shuffle_ps(x2_y2_z2_w2, x3_y3_z3_w3, _MM_SHUFFLE(0, 0, 2, 2));
+			const __m128 z2_x3_y3_z3 = _mm_shuffle_ps(z2_z2_x3_x3, x3_y3_z3_w3, _MM_SHUFFLE(2, 1, 2, 0));
+
+			float* output_ptr = &output[vector_index].x;
+			rtm_impl::batch_store(x0_y0_z0_x1, output_ptr + 0, mode);
+			rtm_impl::batch_store(y1_z1_x2_y2, output_ptr + 4, mode);
+			rtm_impl::batch_store(z2_x3_y3_z3, output_ptr + 8, mode);
+		}
+#endif
+
+		for (; vector_index < num_vectors; ++vector_index)
+		{
+			rtm_impl::batch_prefetch_ahead(input, vector_index * sizeof(vector4f), input_size, prefetch_distance);
+			vector_store3(input[vector_index], output + vector_index);
+		}
+
+		rtm_impl::batch_store_fence(mode);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the arc-tangent of [y/x] for 'count' values stored in contiguous arrays:
+	// output[i] = atan2(y[i], x[i]), see vector_atan2 for details.
+	// The main loop is software pipelined: two independent 8 wide evaluations are in flight
+	// while the inputs of the next iteration are loaded, hiding the polynomial latency.
+	// The output can be the same array as either input, partial overlap is not supported.
+	// Arrays do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_atan2_array(const float* y, const float* x, float* output, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_atan2_array", count, count * sizeof(float) * 3);
+#if defined(RTM_SVE_INTRINSICS)
+		// Length agnostic, the last iteration is predicated
+		for (uint32_t index = 0; index < count; index += rtm_impl::batch_sve_num_lanes())
+		{
+			const svbool_t pg = svwhilelt_b32(index, count);
+			svst1_f32(pg, output + index, rtm_impl::batch_sve_atan2(pg, svld1_f32(pg, y + index), svld1_f32(pg, x + index)));
+		}
+#elif defined(RTM_AVX512_INTRINSICS)
+		// 16 values per iteration, the last one is masked instead of using a scalar loop
+		for (uint32_t index = 0; index < count; index += 16)
+		{
+			const __mmask16 mask = rtm_impl::batch_avx512_mask(count - index);
+			const __m512 y16 = _mm512_maskz_loadu_ps(mask, y + index);
+			const __m512 x16 = _mm512_maskz_loadu_ps(mask, x + index);
+			_mm512_mask_storeu_ps(output + index, mask, rtm_impl::batch_avx512_atan2(y16, x16));
+		}
+#else
+		uint32_t index = 0;
+
+		if (count >= 16)
+		{
+			vector8f y0 = vector8_load(y + 0);
+			vector8f y1 = vector8_load(y + 8);
+			vector8f x0 = vector8_load(x + 0);
+			vector8f x1 = vector8_load(x + 8);
+
+			for (; index + 32 <= count; index += 16)
+			{
+				const vector8f result0 = vector_atan2(y0, x0);
+				const vector8f result1 = vector_atan2(y1, x1);
+
+				// Our next inputs do not overlap with the current output
+				y0 = vector8_load(y + index + 16);
+				y1 = vector8_load(y + index + 24);
+				x0 = vector8_load(x + index + 16);
+				x1 = vector8_load(x + index + 24);
+
+				vector_store(result0, output + index + 0);
+				vector_store(result1, output + index + 8);
+			}
+
+			vector_store(vector_atan2(y0, x0), output + index + 0);
+			vector_store(vector_atan2(y1, x1), output + index + 8);
+			index += 16;
+		}
+
+		if (index + 8 <= count)
+		{
+			vector_store(vector_atan2(vector8_load(y + index), vector8_load(x + index)), output + index);
+			index += 8;
+		}
+
+		if (index + 4 <= count)
+		{
+			vector_store(vector_atan2(vector_load(y + index), vector_load(x + index)), output + index);
+			index += 4;
+		}
+
+		// The remaining values use the same polynomial as the wide loops
+		for (; index < count; ++index)
+			output[index] = vector_get_x(vector_atan2(vector_set(y[index]), vector_set(x[index])));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the arc-cosine for 'count' values stored in a contiguous array:
+	// output[i] = acos(input[i]), see vector_acos for details.
+	// Input values must be in the range [-1.0, 1.0].
+	// The main loop is software pipelined: two independent 8 wide evaluations are in flight
+	// while the inputs of the next iteration are loaded, hiding the polynomial latency.
+	// The output can be the same array as the input, partial overlap is not supported.
+	// Arrays do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_acos_array(const float* input, float* output, uint32_t count) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::vector_acos_array", count, count * sizeof(float) * 2);
+#if defined(RTM_SVE_INTRINSICS)
+		// Length agnostic, the last iteration is predicated
+		for (uint32_t index = 0; index < count; index += rtm_impl::batch_sve_num_lanes())
+		{
+			const svbool_t pg = svwhilelt_b32(index, count);
+			svst1_f32(pg, output + index, rtm_impl::batch_sve_acos(pg, svld1_f32(pg, input + index)));
+		}
+#elif defined(RTM_AVX512_INTRINSICS)
+		// 16 values per iteration, the last one is masked instead of using a scalar loop
+		for (uint32_t index = 0; index < count; index += 16)
+		{
+			const __mmask16 mask = rtm_impl::batch_avx512_mask(count - index);
+			_mm512_mask_storeu_ps(output + index, mask, rtm_impl::batch_avx512_acos(_mm512_maskz_loadu_ps(mask, input + index)));
+		}
+#else
+		uint32_t index = 0;
+
+		if (count >= 16)
+		{
+			vector8f input0 = vector8_load(input + 0);
+			vector8f input1 = vector8_load(input + 8);
+
+			for (; index + 32 <= count; index += 16)
+			{
+				const vector8f result0 = vector_acos(input0);
+				const vector8f result1 = vector_acos(input1);
+
+				// Our next inputs do not overlap with the current output
+				input0 = vector8_load(input + index + 16);
+				input1 = vector8_load(input + index + 24);
+
+				vector_store(result0, output + index + 0);
+				vector_store(result1, output + index + 8);
+			}
+
+			vector_store(vector_acos(input0), output + index + 0);
+			vector_store(vector_acos(input1), output + index + 8);
+			index += 16;
+		}
+
+		if (index + 8 <= count)
+		{
+			vector_store(vector_acos(vector8_load(input + index)), output + index);
+			index += 8;
+		}
+
+		if (index + 4 <= count)
+		{
+			vector_store(vector_acos(vector_load(input + index)), output + index);
+			index += 4;
+		}
+
+		// The remaining values use the same polynomial as the wide loops
+		for (; index < count; ++index)
+			output[index] = vector_get_x(vector_acos(vector_set(input[index])));
+#endif
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
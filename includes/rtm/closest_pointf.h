@@ -0,0 +1,186 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Closest point queries between points, segments, and triangles.
+	// Only the [xyz] components of the inputs are used, the [w] component of the results is undefined.
+	// The squared distances are returned lazily like vector_length_squared3: they can be compared
+	// to a squared radius as a float or a scalarf without a square root.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the point on the segment [start, end] closest to the input point.
+	// A segment with a zero length returns its start.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL closest_point_on_segment(vector4f_arg0 point, vector4f_arg1 start, vector4f_arg2 end) RTM_NO_EXCEPT
+	{
+		const vector4f direction = vector_sub(end, start);
+		const float length_squared = vector_length_squared3(direction);
+		if (length_squared <= 0.0F)
+			return start;
+
+		const float t = scalar_clamp(float(vector_dot3(vector_sub(point, start), direction)) / length_squared, 0.0F, 1.0F);
+		return vector_mul_add(direction, t, start);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the squared distance between the input point and the segment [start, end].
+	//////////////////////////////////////////////////////////////////////////
+	inline rtm_impl::vector4f_vector_dot3 RTM_SIMD_CALL point_segment_distance_squared(vector4f_arg0 point, vector4f_arg1 start, vector4f_arg2 end) RTM_NO_EXCEPT
+	{
+		return vector_length_squared3(vector_sub(point, closest_point_on_segment(point, start, end)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the point on the triangle [vertex0, vertex1, vertex2] closest to the input point.
+	// The point is projected onto the Voronoi region of the triangle that contains it:
+	// a vertex, an edge, or the face. The triangle must not be degenerate.
+	// See: Real-Time Collision Detection, Christer Ericson, section 5.1.5
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL closest_point_on_triangle(vector4f_arg0 point, vector4f_arg1 vertex0, vector4f_arg2 vertex1, vector4f_arg3 vertex2) RTM_NO_EXCEPT
+	{
+		const vector4f edge01 = vector_sub(vertex1, vertex0);
+		const vector4f edge02 = vector_sub(vertex2, vertex0);
+
+		const vector4f offset0 = vector_sub(point, vertex0);
+		const float d1 = vector_dot3(edge01, offset0);
+		const float d2 = vector_dot3(edge02, offset0);
+		if (d1 <= 0.0F && d2 <= 0.0F)
+			return vertex0;
+
+		const vector4f offset1 = vector_sub(point, vertex1);
+		const float d3 = vector_dot3(edge01, offset1);
+		const float d4 = vector_dot3(edge02, offset1);
+		if (d3 >= 0.0F && d4 <= d3)
+			return vertex1;
+
+		const float vc = (d1 * d4) - (d3 * d2);
+		if (vc <= 0.0F && d1 >= 0.0F && d3 <= 0.0F)
+			return vector_mul_add(edge01, d1 / (d1 - d3), vertex0);
+
+		const vector4f offset2 = vector_sub(point, vertex2);
+		const float d5 = vector_dot3(edge01, offset2);
+		const float d6 = vector_dot3(edge02, offset2);
+		if (d6 >= 0.0F && d5 <= d6)
+			return vertex2;
+
+		const float vb = (d5 * d2) - (d1 * d6);
+		if (vb <= 0.0F && d2 >= 0.0F && d6 <= 0.0F)
+			return vector_mul_add(edge02, d2 / (d2 - d6), vertex0);
+
+		const float va = (d3 * d6) - (d5 * d4);
+		const float d43 = d4 - d3;
+		const float d56 = d5 - d6;
+		if (va <= 0.0F && d43 >= 0.0F && d56 >= 0.0F)
+			return vector_mul_add(vector_sub(vertex2, vertex1), d43 / (d43 + d56), vertex1);
+
+		// Inside the face, the barycentric coordinates follow from the areas
+		const float inv_area = 1.0F / (va + vb + vc);
+		return vector_mul_add(edge02, vc * inv_area, vector_mul_add(edge01, vb * inv_area, vertex0));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the squared distance between the input point and the triangle [vertex0, vertex1, vertex2].
+	//////////////////////////////////////////////////////////////////////////
+	inline rtm_impl::vector4f_vector_dot3 RTM_SIMD_CALL point_triangle_distance_squared(vector4f_arg0 point, vector4f_arg1 vertex0, vector4f_arg2 vertex1, vector4f_arg3 vertex2) RTM_NO_EXCEPT
+	{
+		return vector_length_squared3(vector_sub(point, closest_point_on_triangle(point, vertex0, vertex1, vertex2)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the closest pair of points between the segments [start0, end0] and [start1, end1].
+	// When the segments are parallel, one of the closest pairs is returned.
+	// Segments with a zero length are supported.
+	// See: Real-Time Collision Detection, Christer Ericson, section 5.1.9
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL closest_points_between_segments(vector4f_arg0 start0, vector4f_arg1 end0, vector4f_arg2 start1, vector4f_arg3 end1, vector4f& out_point0, vector4f& out_point1) RTM_NO_EXCEPT
+	{
+		const vector4f direction0 = vector_sub(end0, start0);
+		const vector4f direction1 = vector_sub(end1, start1);
+		const vector4f offset = vector_sub(start0, start1);
+
+		const float a = vector_length_squared3(direction0);
+		const float e = vector_length_squared3(direction1);
+		const float f = vector_dot3(direction1, offset);
+
+		float s;
+		float t;
+		if (a <= 0.0F)
+		{
+			// The first segment is a point
+			s = 0.0F;
+			t = e <= 0.0F ? 0.0F : scalar_clamp(f / e, 0.0F, 1.0F);
+		}
+		else
+		{
+			const float c = vector_dot3(direction0, offset);
+			if (e <= 0.0F)
+			{
+				// The second segment is a point
+				t = 0.0F;
+				s = scalar_clamp(-c / a, 0.0F, 1.0F);
+			}
+			else
+			{
+				// The closest point of the infinite lines, parallel lines start at the first start
+				const float b = vector_dot3(direction0, direction1);
+				const float denominator = (a * e) - (b * b);
+				s = denominator > 0.0F ? scalar_clamp(((b * f) - (c * e)) / denominator, 0.0F, 1.0F) : 0.0F;
+
+				// When the point on the second segment is clamped, the point on the first segment moves with it
+				const float unclamped_t = ((b * s) + f) / e;
+				t = scalar_clamp(unclamped_t, 0.0F, 1.0F);
+				if (t != unclamped_t)
+					s = scalar_clamp(((b * t) - c) / a, 0.0F, 1.0F);
+			}
+		}
+
+		out_point0 = vector_mul_add(direction0, s, start0);
+		out_point1 = vector_mul_add(direction1, t, start1);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the squared distance between the segments [start0, end0] and [start1, end1].
+	//////////////////////////////////////////////////////////////////////////
+	inline rtm_impl::vector4f_vector_dot3 RTM_SIMD_CALL segment_segment_distance_squared(vector4f_arg0 start0, vector4f_arg1 end0, vector4f_arg2 start1, vector4f_arg3 end1) RTM_NO_EXCEPT
+	{
+		vector4f point0;
+		vector4f point1;
+		closest_points_between_segments(start0, end0, start1, end1, point0, point1);
+		return vector_length_squared3(vector_sub(point0, point1));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
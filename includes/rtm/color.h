@@ -0,0 +1,262 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The per pixel operations for the register width the color kernels are instantiated with.
+		// Pixels are stored as [r, g, b, a]: one per vector4f, two per vector8f.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		struct color_register;
+
+		template<>
+		struct color_register<4>
+		{
+			using vector_type = vector4f;
+
+			static vector4f RTM_SIMD_CALL broadcast(float value) RTM_NO_EXCEPT { return vector_set(value); }
+			static vector4f RTM_SIMD_CALL broadcast_pixel(float r, float g, float b, float a) RTM_NO_EXCEPT { return vector_set(r, g, b, a); }
+
+			// Returns the [r, g, b] of the first input with the alpha of the second
+			static vector4f RTM_SIMD_CALL keep_alpha(vector4f_arg0 rgb, vector4f_arg1 alpha) RTM_NO_EXCEPT { return vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(rgb, alpha); }
+
+			static vector4f RTM_SIMD_CALL dup_r(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_dup_x(input); }
+			static vector4f RTM_SIMD_CALL dup_g(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_dup_y(input); }
+			static vector4f RTM_SIMD_CALL dup_b(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_dup_z(input); }
+			static vector4f RTM_SIMD_CALL dup_a(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_dup_w(input); }
+		};
+
+		template<>
+		struct color_register<8>
+		{
+			using vector_type = vector8f;
+
+			static vector8f RTM_SIMD_CALL broadcast(float value) RTM_NO_EXCEPT { return vector8_set(value); }
+
+			static vector8f RTM_SIMD_CALL broadcast_pixel(float r, float g, float b, float a) RTM_NO_EXCEPT
+			{
+				const vector4f pixel = vector_set(r, g, b, a);
+				return vector8_set(pixel, pixel);
+			}
+
+#if defined(RTM_AVX_INTRINSICS)
+			static vector8f RTM_SIMD_CALL keep_alpha(vector8f_arg0 rgb, vector8f_arg1 alpha) RTM_NO_EXCEPT { return _mm256_blend_ps(rgb, alpha, 0x88); }
+
+			static vector8f RTM_SIMD_CALL dup_r(vector8f_arg0 input) RTM_NO_EXCEPT { return _mm256_permute_ps(input, _MM_SHUFFLE(0, 0, 0, 0)); }
+			static vector8f RTM_SIMD_CALL dup_g(vector8f_arg0 input) RTM_NO_EXCEPT { return _mm256_permute_ps(input, _MM_SHUFFLE(1, 1, 1, 1)); }
+			static vector8f RTM_SIMD_CALL dup_b(vector8f_arg0 input) RTM_NO_EXCEPT { return _mm256_permute_ps(input, _MM_SHUFFLE(2, 2, 2, 2)); }
+			static vector8f RTM_SIMD_CALL dup_a(vector8f_arg0 input) RTM_NO_EXCEPT { return _mm256_permute_ps(input, _MM_SHUFFLE(3, 3, 3, 3)); }
+#else
+			static vector8f RTM_SIMD_CALL keep_alpha(vector8f_arg0 rgb, vector8f_arg1 alpha) RTM_NO_EXCEPT { return vector8f{ color_register<4>::keep_alpha(rgb.lo, alpha.lo), color_register<4>::keep_alpha(rgb.hi, alpha.hi) }; }
+
+			static vector8f RTM_SIMD_CALL dup_r(vector8f_arg0 input) RTM_NO_EXCEPT { return vector8f{ vector_dup_x(input.lo), vector_dup_x(input.hi) }; }
+			static vector8f RTM_SIMD_CALL dup_g(vector8f_arg0 input) RTM_NO_EXCEPT { return vector8f{ vector_dup_y(input.lo), vector_dup_y(input.hi) }; }
+			static vector8f RTM_SIMD_CALL dup_b(vector8f_arg0 input) RTM_NO_EXCEPT { return vector8f{ vector_dup_z(input.lo), vector_dup_z(input.hi) }; }
+			static vector8f RTM_SIMD_CALL dup_a(vector8f_arg0 input) RTM_NO_EXCEPT { return vector8f{ vector_dup_w(input.lo), vector_dup_w(input.hi) }; }
+#endif
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component sRGB decoding, after clamping to [0.0, 1.0]:
+		//    c <= 0.04045 ? c / 12.92 : ((c + 0.055) / 1.055)^2.4
+		// The power is a degree 6 minimax polynomial of s = sqrt(c + 0.055), over which
+		// s^4.8 is smooth. Its relative error is below 2.5e-6.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename color_register<num_lanes>::vector_type color_srgb_to_linear_lanes(const typename color_register<num_lanes>::vector_type& input) RTM_NO_EXCEPT
+		{
+			using reg = color_register<num_lanes>;
+			using vector_type = typename reg::vector_type;
+
+			const vector_type value = vector_min(vector_max(input, reg::broadcast(0.0F)), reg::broadcast(1.0F));
+			const vector_type linear_segment = vector_mul(value, 1.0F / 12.92F);
+
+			const vector_type s = vector_sqrt(vector_add(value, reg::broadcast(0.055F)));
+			const vector_type power_segment = vector_polynomial(s, 0.000209508847F, -0.00317427573F, 0.0209498725F, -0.0821294292F, 0.254266555F, 0.724010836F, -0.0347172699F);
+
+			return vector_select(vector_less_equal(value, reg::broadcast(0.04045F)), linear_segment, power_segment);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component sRGB encoding, after clamping to [0.0, 1.0]:
+		//    l <= 0.0031308 ? l * 12.92 : 1.055 * l^(1 / 2.4) - 0.055
+		// The power is a degree 6 minimax polynomial of t = l^(1 / 4), over which
+		// t^(5 / 3) is smooth. Its absolute error is below 2.0e-6.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename color_register<num_lanes>::vector_type color_linear_to_srgb_lanes(const typename color_register<num_lanes>::vector_type& input) RTM_NO_EXCEPT
+		{
+			using reg = color_register<num_lanes>;
+			using vector_type = typename reg::vector_type;
+
+			const vector_type value = vector_min(vector_max(input, reg::broadcast(0.0F)), reg::broadcast(1.0F));
+			const vector_type linear_segment = vector_mul(value, 12.92F);
+
+			const vector_type t = vector_sqrt(vector_sqrt(value));
+			const vector_type power_segment = vector_polynomial(t, -0.0595466087F, 0.139604136F, 1.36592105F, -0.852957453F, 0.65718829F, -0.318415992F, 0.0682079792F);
+
+			return vector_select(vector_less_equal(value, reg::broadcast(0.0031308F)), linear_segment, power_segment);
+		}
+
+		template<uint32_t num_lanes>
+		inline typename color_register<num_lanes>::vector_type color_premultiply_pixels(const typename color_register<num_lanes>::vector_type& rgba) RTM_NO_EXCEPT
+		{
+			using reg = color_register<num_lanes>;
+			return reg::keep_alpha(vector_mul(rgba, reg::dup_a(rgba)), rgba);
+		}
+
+		template<uint32_t num_lanes>
+		inline typename color_register<num_lanes>::vector_type color_unpremultiply_pixels(const typename color_register<num_lanes>::vector_type& rgba) RTM_NO_EXCEPT
+		{
+			using reg = color_register<num_lanes>;
+			using vector_type = typename reg::vector_type;
+
+			const vector_type alpha = reg::dup_a(rgba);
+			const vector_type zero = reg::broadcast(0.0F);
+			const vector_type inv_alpha = vector_select(vector_greater_than(alpha, zero), vector_div(reg::broadcast(1.0F), alpha), zero);
+			return reg::keep_alpha(vector_mul(rgba, inv_alpha), rgba);
+		}
+
+		template<uint32_t num_lanes>
+		inline typename color_register<num_lanes>::vector_type color_rgb_to_ycocg_pixels(const typename color_register<num_lanes>::vector_type& rgba) RTM_NO_EXCEPT
+		{
+			using reg = color_register<num_lanes>;
+			using vector_type = typename reg::vector_type;
+
+			// [Y, Co, Cg] = r * [0.25, 0.5, -0.25] + g * [0.5, 0.0, 0.5] + b * [0.25, -0.5, -0.25]
+			const vector_type r_weights = reg::broadcast_pixel(0.25F, 0.5F, -0.25F, 0.0F);
+			const vector_type g_weights = reg::broadcast_pixel(0.5F, 0.0F, 0.5F, 0.0F);
+			const vector_type b_weights = reg::broadcast_pixel(0.25F, -0.5F, -0.25F, 0.0F);
+			const vector_type ycocg = vector_mul_add(reg::dup_b(rgba), b_weights, vector_mul_add(reg::dup_g(rgba), g_weights, vector_mul(reg::dup_r(rgba), r_weights)));
+			return reg::keep_alpha(ycocg, rgba);
+		}
+
+		template<uint32_t num_lanes>
+		inline typename color_register<num_lanes>::vector_type color_ycocg_to_rgb_pixels(const typename color_register<num_lanes>::vector_type& ycocg) RTM_NO_EXCEPT
+		{
+			using reg = color_register<num_lanes>;
+			using vector_type = typename reg::vector_type;
+
+			// [r, g, b] = Y + Co * [1.0, 0.0, -1.0] + Cg * [-1.0, 1.0, -1.0]
+			const vector_type co_weights = reg::broadcast_pixel(1.0F, 0.0F, -1.0F, 0.0F);
+			const vector_type cg_weights = reg::broadcast_pixel(-1.0F, 1.0F, -1.0F, 0.0F);
+			const vector_type rgb = vector_mul_add(reg::dup_b(ycocg), cg_weights, vector_mul_add(reg::dup_g(ycocg), co_weights, reg::dup_r(ycocg)));
+			return reg::keep_alpha(rgb, ycocg);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component sRGB to linear conversion of all 4 components, they are clamped to [0.0, 1.0] first.
+	// The relative error is below 2.5e-6: decoding the 256 8 bit sRGB values and encoding
+	// them back yields the same values.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_srgb_to_linear(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::color_srgb_to_linear_lanes<4>(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component linear to sRGB conversion of all 4 components, they are clamped to [0.0, 1.0] first.
+	// The absolute error is below 2.0e-6.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_linear_to_srgb(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::color_linear_to_srgb_lanes<4>(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts the [r, g, b] of a color from sRGB to linear, its alpha is returned as-is.
+	// See vector_srgb_to_linear(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL color_srgb_to_linear(vector4f_arg0 rgba) RTM_NO_EXCEPT
+	{
+		return rtm_impl::color_register<4>::keep_alpha(rtm_impl::color_srgb_to_linear_lanes<4>(rgba), rgba);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts the [r, g, b] of a color from linear to sRGB, its alpha is returned as-is.
+	// See vector_linear_to_srgb(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL color_linear_to_srgb(vector4f_arg0 rgba) RTM_NO_EXCEPT
+	{
+		return rtm_impl::color_register<4>::keep_alpha(rtm_impl::color_linear_to_srgb_lanes<4>(rgba), rgba);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the color with its [r, g, b] multiplied by its alpha: [r * a, g * a, b * a, a]
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL color_premultiply(vector4f_arg0 rgba) RTM_NO_EXCEPT
+	{
+		return rtm_impl::color_premultiply_pixels<4>(rgba);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the premultiplied color with its [r, g, b] divided by its alpha: [r / a, g / a, b / a, a]
+	// The [r, g, b] of a fully transparent color are zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL color_unpremultiply(vector4f_arg0 rgba) RTM_NO_EXCEPT
+	{
+		return rtm_impl::color_unpremultiply_pixels<4>(rgba);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts the [r, g, b] of a color to [Y, Co, Cg], its alpha is returned as-is.
+	//    Y = r / 4 + g / 2 + b / 4
+	//    Co = r / 2 - b / 2
+	//    Cg = -r / 4 + g / 2 - b / 4
+	// For inputs in [0.0, 1.0], Y is in [0.0, 1.0] while Co and Cg are in [-0.5, 0.5].
+	// The weights are powers of two and the inverse only needs additions.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL color_rgb_to_ycocg(vector4f_arg0 rgba) RTM_NO_EXCEPT
+	{
+		return rtm_impl::color_rgb_to_ycocg_pixels<4>(rgba);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts [Y, Co, Cg] back to [r, g, b], the alpha is returned as-is.
+	//    r = Y + Co - Cg
+	//    g = Y + Cg
+	//    b = Y - Co - Cg
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL color_ycocg_to_rgb(vector4f_arg0 ycocg) RTM_NO_EXCEPT
+	{
+		return rtm_impl::color_ycocg_to_rgb_pixels<4>(ycocg);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
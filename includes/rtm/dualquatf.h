@@ -0,0 +1,150 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/dualquat_common.h"
+#include "rtm/impl/qvv_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Casts a dual quaternion float64 variant to a float32 variant.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatf RTM_SIMD_CALL dualquat_cast(const dualquatd& input) RTM_NO_EXCEPT
+	{
+		return dualquatf{ quat_cast(input.real), quat_cast(input.dual) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a dual quaternion from a rotation quaternion and a translation.
+	// The rotation is applied first, followed by the translation.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatf RTM_SIMD_CALL dualquat_from_rotation_translation(quatf_arg0 rotation, vector4f_arg1 translation) RTM_NO_EXCEPT
+	{
+		// dual = 0.5 * translation * rotation
+		const quatf half_translation = vector_to_quat(vector_set_w(vector_mul(translation, 0.5F), 0.0F));
+		return dualquatf{ rotation, quat_mul(rotation, half_translation) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a dual quaternion from a QVV transform.
+	// Dual quaternions cannot represent scale, it is ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatf RTM_SIMD_CALL dualquat_from_qvv(qvvf_arg0 transform) RTM_NO_EXCEPT
+	{
+		return dualquat_from_rotation_translation(transform.rotation, transform.translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the rotation part of a normalized dual quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr quatf RTM_SIMD_CALL dualquat_get_rotation(dualquatf_arg0 input) RTM_NO_EXCEPT
+	{
+		return input.real;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the translation part of a normalized dual quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL dualquat_get_translation(dualquatf_arg0 input) RTM_NO_EXCEPT
+	{
+		// translation = 2.0 * dual * conjugate(real)
+		const vector4f translation = quat_to_vector(quat_mul(quat_conjugate(input.real), input.dual));
+		return vector_add(translation, translation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a normalized dual quaternion into a QVV transform with a [1,1,1] 3D scale.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_from_dualquat(dualquatf_arg0 input) RTM_NO_EXCEPT
+	{
+		return qvv_set(input.real, dualquat_get_translation(input), vector_set(1.0F));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies two dual quaternions.
+	// Multiplication order is as follow: local_to_world = dualquat_mul(local_to_object, object_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatf RTM_SIMD_CALL dualquat_mul(dualquatf_arg0 lhs, dualquatf_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const quatf real = quat_mul(lhs.real, rhs.real);
+		const vector4f dual = vector_add(quat_to_vector(quat_mul(lhs.dual, rhs.real)), quat_to_vector(quat_mul(lhs.real, rhs.dual)));
+		return dualquatf{ real, vector_to_quat(dual) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a 3D point with a normalized dual quaternion.
+	// The rotation is applied first, followed by the translation.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL dualquat_mul_point3(vector4f_arg0 point, dualquatf_arg1 dq) RTM_NO_EXCEPT
+	{
+		return vector_add(quat_mul_vector3(point, dq.real), dualquat_get_translation(dq));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the inverse of a normalized dual quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatf RTM_SIMD_CALL dualquat_inverse(dualquatf_arg0 input) RTM_NO_EXCEPT
+	{
+		return dualquatf{ quat_conjugate(input.real), quat_conjugate(input.dual) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Normalizes a dual quaternion by the length of its real part.
+	// This is sufficient after blending normalized dual quaternions, see dualquat_blend4_aos(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline dualquatf RTM_SIMD_CALL dualquat_normalize(dualquatf_arg0 input) RTM_NO_EXCEPT
+	{
+		const scalarf inv_length = quat_length_reciprocal(input.real);
+		return dualquatf{ vector_to_quat(vector_mul(quat_to_vector(input.real), inv_length)), vector_to_quat(vector_mul(quat_to_vector(input.dual), inv_length)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the input dual quaternion is normalized, false otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL dualquat_is_normalized(dualquatf_arg0 input, float threshold = 0.00001F) RTM_NO_EXCEPT
+	{
+		// The real part must have unit length and be orthogonal to the dual part
+		const float real_dot = quat_dot(input.real, input.real);
+		const float real_dual_dot = quat_dot(input.real, input.dual);
+		return scalar_abs(real_dot - 1.0F) < threshold && scalar_abs(real_dual_dot) < threshold;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the two dual quaternions are nearly equal component wise, otherwise false.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL dualquat_near_equal(dualquatf_arg0 lhs, dualquatf_arg1 rhs, float threshold = 0.00001F) RTM_NO_EXCEPT
+	{
+		return quat_near_equal(lhs.real, rhs.real, threshold) && quat_near_equal(lhs.dual, rhs.dual, threshold);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
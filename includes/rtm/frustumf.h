@@ -0,0 +1,274 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix4x4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The frustum planes with each component broadcast in every lane of a vector4f.
+		// The absolute value of the normals is used to project boxes on the planes.
+		//////////////////////////////////////////////////////////////////////////
+		struct frustum_planes4
+		{
+			vector4f normal_x[6];
+			vector4f normal_y[6];
+			vector4f normal_z[6];
+			vector4f distance[6];
+
+			vector4f abs_normal_x[6];
+			vector4f abs_normal_y[6];
+			vector4f abs_normal_z[6];
+		};
+
+		inline frustum_planes4 RTM_SIMD_CALL frustum_to_planes4(const frustumf& frustum) RTM_NO_EXCEPT
+		{
+			frustum_planes4 result;
+			for (uint32_t plane_index = 0; plane_index < 6; ++plane_index)
+			{
+				const vector4f plane = frustum.planes[plane_index];
+				const vector4f abs_plane = vector_abs(plane);
+
+				result.normal_x[plane_index] = vector_set(float(vector_get_x(plane)));
+				result.normal_y[plane_index] = vector_set(float(vector_get_y(plane)));
+				result.normal_z[plane_index] = vector_set(float(vector_get_z(plane)));
+				result.distance[plane_index] = vector_set(float(vector_get_w(plane)));
+				result.abs_normal_x[plane_index] = vector_set(float(vector_get_x(abs_plane)));
+				result.abs_normal_y[plane_index] = vector_set(float(vector_get_y(abs_plane)));
+				result.abs_normal_z[plane_index] = vector_set(float(vector_get_z(abs_plane)));
+			}
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the smallest signed distance between a sphere and the frustum planes.
+		// The sphere is inside or intersects the frustum when it is positive or zero.
+		// Taking the minimum over all planes avoids combining 6 masks.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL frustum_sphere_distance(const frustum_planes4& planes, vector4f_arg0 center_x, vector4f_arg1 center_y, vector4f_arg2 center_z, vector4f_arg3 radius) RTM_NO_EXCEPT
+		{
+			vector4f min_distance = vector_mul_add(center_z, planes.normal_z[0], vector_mul_add(center_y, planes.normal_y[0], vector_mul_add(center_x, planes.normal_x[0], planes.distance[0])));
+			for (uint32_t plane_index = 1; plane_index < 6; ++plane_index)
+			{
+				const vector4f distance = vector_mul_add(center_z, planes.normal_z[plane_index], vector_mul_add(center_y, planes.normal_y[plane_index], vector_mul_add(center_x, planes.normal_x[plane_index], planes.distance[plane_index])));
+				min_distance = vector_min(min_distance, distance);
+			}
+
+			return vector_add(min_distance, radius);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the smallest signed distance between a box and the frustum planes.
+		// The box is inside or intersects the frustum when it is positive or zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL frustum_aabb_distance(const frustum_planes4& planes, vector4f_arg0 center_x, vector4f_arg1 center_y, vector4f_arg2 center_z, vector4f_arg3 extent_x, vector4f_arg4 extent_y, vector4f_arg5 extent_z) RTM_NO_EXCEPT
+		{
+			// The distance of the box center plus the box projected on the plane normal
+			const vector4f center_distance0 = vector_mul_add(center_z, planes.normal_z[0], vector_mul_add(center_y, planes.normal_y[0], vector_mul_add(center_x, planes.normal_x[0], planes.distance[0])));
+			vector4f min_distance = vector_mul_add(extent_z, planes.abs_normal_z[0], vector_mul_add(extent_y, planes.abs_normal_y[0], vector_mul_add(extent_x, planes.abs_normal_x[0], center_distance0)));
+			for (uint32_t plane_index = 1; plane_index < 6; ++plane_index)
+			{
+				const vector4f center_distance = vector_mul_add(center_z, planes.normal_z[plane_index], vector_mul_add(center_y, planes.normal_y[plane_index], vector_mul_add(center_x, planes.normal_x[plane_index], planes.distance[plane_index])));
+				const vector4f distance = vector_mul_add(extent_z, planes.abs_normal_z[plane_index], vector_mul_add(extent_y, planes.abs_normal_y[plane_index], vector_mul_add(extent_x, planes.abs_normal_x[plane_index], center_distance)));
+				min_distance = vector_min(min_distance, distance);
+			}
+
+			return min_distance;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// The frustum planes with each component broadcast in every lane of a vector8f.
+		// The absolute value of the normals is used to project boxes on the planes.
+		//////////////////////////////////////////////////////////////////////////
+		struct frustum_planes8
+		{
+			vector8f normal_x[6];
+			vector8f normal_y[6];
+			vector8f normal_z[6];
+			vector8f distance[6];
+
+			vector8f abs_normal_x[6];
+			vector8f abs_normal_y[6];
+			vector8f abs_normal_z[6];
+		};
+
+		inline frustum_planes8 RTM_SIMD_CALL frustum_to_planes8(const frustumf& frustum) RTM_NO_EXCEPT
+		{
+			frustum_planes8 result;
+			for (uint32_t plane_index = 0; plane_index < 6; ++plane_index)
+			{
+				const vector4f plane = frustum.planes[plane_index];
+				const vector4f abs_plane = vector_abs(plane);
+
+				result.normal_x[plane_index] = vector8_set(float(vector_get_x(plane)));
+				result.normal_y[plane_index] = vector8_set(float(vector_get_y(plane)));
+				result.normal_z[plane_index] = vector8_set(float(vector_get_z(plane)));
+				result.distance[plane_index] = vector8_set(float(vector_get_w(plane)));
+				result.abs_normal_x[plane_index] = vector8_set(float(vector_get_x(abs_plane)));
+				result.abs_normal_y[plane_index] = vector8_set(float(vector_get_y(abs_plane)));
+				result.abs_normal_z[plane_index] = vector8_set(float(vector_get_z(abs_plane)));
+			}
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the smallest signed distance between a sphere and the frustum planes.
+		// The sphere is inside or intersects the frustum when it is positive or zero.
+		// Taking the minimum over all planes avoids combining 6 masks.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector8f RTM_SIMD_CALL frustum_sphere_distance(const frustum_planes8& planes, vector8f_arg0 center_x, vector8f_arg1 center_y, vector8f_arg2 center_z, vector8f_arg3 radius) RTM_NO_EXCEPT
+		{
+			vector8f min_distance = vector_mul_add(center_z, planes.normal_z[0], vector_mul_add(center_y, planes.normal_y[0], vector_mul_add(center_x, planes.normal_x[0], planes.distance[0])));
+			for (uint32_t plane_index = 1; plane_index < 6; ++plane_index)
+			{
+				const vector8f distance = vector_mul_add(center_z, planes.normal_z[plane_index], vector_mul_add(center_y, planes.normal_y[plane_index], vector_mul_add(center_x, planes.normal_x[plane_index], planes.distance[plane_index])));
+				min_distance = vector_min(min_distance, distance);
+			}
+
+			return vector_add(min_distance, radius);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the smallest signed distance between a box and the frustum planes.
+		// The box is inside or intersects the frustum when it is positive or zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector8f RTM_SIMD_CALL frustum_aabb_distance(const frustum_planes8& planes, vector8f_arg0 center_x, vector8f_arg1 center_y, vector8f_arg2 center_z, vector8f_arg3 extent_x, vector8f_arg4 extent_y, vector8f_arg5 extent_z) RTM_NO_EXCEPT
+		{
+			// The distance of the box center plus the box projected on the plane normal
+			const vector8f center_distance0 = vector_mul_add(center_z, planes.normal_z[0], vector_mul_add(center_y, planes.normal_y[0], vector_mul_add(center_x, planes.normal_x[0], planes.distance[0])));
+			vector8f min_distance = vector_mul_add(extent_z, planes.abs_normal_z[0], vector_mul_add(extent_y, planes.abs_normal_y[0], vector_mul_add(extent_x, planes.abs_normal_x[0], center_distance0)));
+			for (uint32_t plane_index = 1; plane_index < 6; ++plane_index)
+			{
+				const vector8f center_distance = vector_mul_add(center_z, planes.normal_z[plane_index], vector_mul_add(center_y, planes.normal_y[plane_index], vector_mul_add(center_x, planes.normal_x[plane_index], planes.distance[plane_index])));
+				const vector8f distance = vector_mul_add(extent_z, planes.abs_normal_z[plane_index], vector_mul_add(extent_y, planes.abs_normal_y[plane_index], vector_mul_add(extent_x, planes.abs_normal_x[plane_index], center_distance)));
+				min_distance = vector_min(min_distance, distance);
+			}
+
+			return min_distance;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Extracts the frustum planes of a world to clip space matrix (e.g. view * projection).
+	// The matrix follows the multiplication order of matrix_mul_vector: clip = matrix_mul_vector(world, matrix).
+	// The planes are normalized so that plane distances are in world units.
+	// See: Fast Extraction of Viewing Frustum Planes from the World-View-Projection Matrix (Gribb, Hartmann)
+	//////////////////////////////////////////////////////////////////////////
+	inline frustumf RTM_SIMD_CALL frustum_from_matrix(matrix4x4f_arg0 world_to_clip, clip_depth_range depth_range = clip_depth_range::zero_to_one) RTM_NO_EXCEPT
+	{
+		// Every clip space component is the dot product of the point with a column of the matrix
+		const matrix4x4f columns = matrix_transpose(world_to_clip);
+
+		frustumf result;
+		result.planes[0] = vector_add(columns.w_axis, columns.x_axis);		// Left: x >= -w
+		result.planes[1] = vector_sub(columns.w_axis, columns.x_axis);		// Right: x <= w
+		result.planes[2] = vector_add(columns.w_axis, columns.y_axis);		// Bottom: y >= -w
+		result.planes[3] = vector_sub(columns.w_axis, columns.y_axis);		// Top: y <= w
+		result.planes[4] = depth_range == clip_depth_range::zero_to_one ? columns.z_axis : vector_add(columns.w_axis, columns.z_axis);	// Near: z >= 0 or z >= -w
+		result.planes[5] = vector_sub(columns.w_axis, columns.z_axis);		// Far: z <= w
+
+		for (vector4f& plane : result.planes)
+		{
+			const float length_reciprocal = vector_length_reciprocal3(plane);
+			plane = vector_mul(plane, length_reciprocal);
+		}
+
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if a sphere is inside or intersects the frustum, false otherwise.
+	// The test is conservative: spheres near the frustum corners can be reported as intersecting.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL frustum_intersects_sphere(const frustumf& frustum, vector4f_arg0 center, float radius) RTM_NO_EXCEPT
+	{
+		for (const vector4f& plane : frustum.planes)
+		{
+			const float distance = float(vector_dot3(center, plane)) + float(vector_get_w(plane));
+			if (distance < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if an axis aligned bounding box is inside or intersects the frustum, false otherwise.
+	// The box is described by its center and its half extent along each axis.
+	// The test is conservative: boxes near the frustum corners can be reported as intersecting.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL frustum_intersects_aabb(const frustumf& frustum, vector4f_arg0 center, vector4f_arg1 extent) RTM_NO_EXCEPT
+	{
+		for (const vector4f& plane : frustum.planes)
+		{
+			// The box projected on the plane normal
+			const float radius = vector_dot3(extent, vector_abs(plane));
+			const float distance = float(vector_dot3(center, plane)) + float(vector_get_w(plane));
+			if (distance < -radius)
+				return false;
+		}
+
+		return true;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Tests 8 spheres at once against the frustum.
+	// Returns per lane ~0 if the sphere is inside or intersects the frustum, 0 otherwise.
+	// Use mask_get_bits(..) to retrieve one bit per sphere.
+	//////////////////////////////////////////////////////////////////////////
+	inline mask8f RTM_SIMD_CALL frustum_intersects_sphere(const frustumf& frustum, vector3x8f_arg0 centers, vector8f_arg1 radii) RTM_NO_EXCEPT
+	{
+		const rtm_impl::frustum_planes8 planes = rtm_impl::frustum_to_planes8(frustum);
+		const vector8f distance = rtm_impl::frustum_sphere_distance(planes, centers.x, centers.y, centers.z, radii);
+		return vector_greater_equal(distance, vector8_zero());
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Tests 8 axis aligned bounding boxes at once against the frustum.
+	// Returns per lane ~0 if the box is inside or intersects the frustum, 0 otherwise.
+	// Use mask_get_bits(..) to retrieve one bit per box.
+	//////////////////////////////////////////////////////////////////////////
+	inline mask8f RTM_SIMD_CALL frustum_intersects_aabb(const frustumf& frustum, vector3x8f_arg0 centers, vector3x8f_arg1 extents) RTM_NO_EXCEPT
+	{
+		const rtm_impl::frustum_planes8 planes = rtm_impl::frustum_to_planes8(frustum);
+		const vector8f distance = rtm_impl::frustum_aabb_distance(planes, centers.x, centers.y, centers.z, extents.x, extents.y, extents.z);
+		return vector_greater_equal(distance, vector8_zero());
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,103 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// Forward declarations of the types that are structures on every platform.
+// This header includes nothing: headers that only pass them by reference or
+// pointer can use it instead of rtm/types.h.
+//
+// vector4f, quatf, mask4f, scalarf, and the other SIMD register types are
+// aliases of compiler intrinsic types on most platforms and cannot be forward
+// declared: include rtm/types.h for them.
+//////////////////////////////////////////////////////////////////////////
+
+namespace rtm
+{
+	struct qvvf;
+	struct qvvd;
+	struct qvsf;
+	struct qvsd;
+
+	struct dualquatf;
+	struct dualquatd;
+
+	struct matrix3x3f;
+	struct matrix3x3d;
+	struct matrix3x4f;
+	struct matrix3x4d;
+	struct matrix4x4f;
+	struct matrix4x4d;
+
+	struct vector3x8f;
+	struct vector4x8f;
+	struct quat8f;
+	struct matrix4x4x8f;
+
+	struct vector4fx;
+	struct quatfx;
+
+	struct aabbf;
+	struct spheref;
+	struct frustumf;
+
+	struct float2f;
+	struct float3f;
+	struct float4f;
+	struct float3x4f;
+	struct qvvf_packed;
+	struct qvvf_packed_uniform_scale;
+
+	struct float2d;
+	struct float3d;
+	struct float4d;
+
+	struct const_float3f_soa;
+	struct float3f_soa;
+	struct const_float4f_soa;
+	struct float4f_soa;
+	struct const_qvvf_soa;
+	struct qvvf_soa;
+
+	enum class mix4;
+	enum class axis3;
+	enum class axis4;
+	enum class store_mode;
+	enum class normalize_precision;
+	enum class summation_precision;
+	enum class quat_average_precision;
+	enum class clip_depth_range;
+	enum class trigonometry_precision;
+	enum class rotation_interpolation;
+	enum class depth_sort_order;
+
+	namespace precision
+	{
+		struct policy;
+		struct fast;
+		struct standard;
+		struct exact;
+	}
+}
@@ -0,0 +1,534 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Writes a vector4 to memory with the requested store mode.
+		// Non-temporal stores require the output to be 16 bytes aligned.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL batch_store(vector4f_arg0 input, float* output, store_mode mode) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			if (mode == store_mode::non_temporal)
+				_mm_stream_ps(output, input);
+			else
+				_mm_storeu_ps(output, input);
+#else
+			(void)mode;
+			vector_store(input, output);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes a vector8 to memory with the requested store mode.
+		// Non-temporal stores require the output to be 16 bytes aligned.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL batch_store(vector8f_arg0 input, float* output, store_mode mode) RTM_NO_EXCEPT
+		{
+			if (mode == store_mode::non_temporal)
+			{
+				// Two halves to only require the same alignment as vector4f
+				batch_store(vector_get_low(input), output, mode);
+				batch_store(vector_get_high(input), output + 4, mode);
+			}
+			else
+				vector_store(input, output);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Hints that the cache line holding the input will soon be read.
+		// Prefetching never faults, the input does not need to be valid.
+		//////////////////////////////////////////////////////////////////////////
+		inline void batch_prefetch(const void* input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			_mm_prefetch(static_cast<const char*>(input), _MM_HINT_T0);
+#elif defined(RTM_COMPILER_GCC) || defined(RTM_COMPILER_CLANG)
+			__builtin_prefetch(input);
+#else
+			(void)input;
+#endif
+		}
+
+		// How many bytes ahead of the read position the array functions prefetch by default
+		constexpr uint32_t k_default_prefetch_distance = 512;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Prefetches the input 'distance' bytes ahead of the provided byte offset.
+		// Nothing is prefetched past the end of the input or when the distance is 0.
+		//////////////////////////////////////////////////////////////////////////
+		inline void batch_prefetch_ahead(const void* input, size_t offset, size_t size, uint32_t distance) RTM_NO_EXCEPT
+		{
+			if (distance != 0 && offset + distance < size)
+				batch_prefetch(static_cast<const uint8_t*>(input) + offset + distance);
+		}
+
+		// How many indices ahead the indexed functions prefetch the element they gather by default
+		constexpr uint32_t k_default_gather_prefetch_distance = 16;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Prefetches the element gathered 'distance' indices ahead of the provided index.
+		// Both ends of the element are prefetched since it can straddle two cache lines.
+		// Nothing is prefetched past the last index or when the distance is 0.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename element_type>
+		inline void batch_prefetch_indexed(const element_type* input, const uint32_t* indices, uint32_t index, uint32_t num_indices, uint32_t distance) RTM_NO_EXCEPT
+		{
+			if (distance != 0 && index + distance < num_indices)
+			{
+				const uint8_t* element = reinterpret_cast<const uint8_t*>(input + indices[index + distance]);
+				batch_prefetch(element);
+				batch_prefetch(element + sizeof(element_type) - 1);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Non-temporal stores are weakly ordered, make them visible before returning.
+		//////////////////////////////////////////////////////////////////////////
+		inline void batch_store_fence(store_mode mode) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			if (mode == store_mode::non_temporal)
+				_mm_sfence();
+#else
+			(void)mode;
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Hardware reciprocal square root estimates differ between CPU vendors,
+		// RTM_DETERMINISTIC treats every precision as exact.
+		//////////////////////////////////////////////////////////////////////////
+		template<normalize_precision precision>
+		struct is_exact_precision
+		{
+#if defined(RTM_DETERMINISTIC)
+			static constexpr bool value = true;
+#else
+			static constexpr bool value = precision == normalize_precision::exact;
+#endif
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per component the reciprocal square root of the input: 1.0 / sqrt(input)
+		// The precision is a template argument to keep it out of the batch loops.
+		//////////////////////////////////////////////////////////////////////////
+		template<normalize_precision precision>
+		inline vector4f RTM_SIMD_CALL batch_sqrt_reciprocal(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			if (static_condition<is_exact_precision<precision>::value>::test())
+				return vector_reciprocal(vector_sqrt(input));
+
+			if (static_condition<precision == normalize_precision::estimate>::test())
+				return vector_sqrt_reciprocal_estimate<0>(input);
+
+			// One Newton-Raphson iteration, without a hardware estimate every precision is exact
+			return vector_sqrt_reciprocal_estimate<1>(input);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the reciprocal square root of the input: 1.0 / sqrt(input)
+		//////////////////////////////////////////////////////////////////////////
+		template<normalize_precision precision>
+		inline vector8f RTM_SIMD_CALL batch_sqrt_reciprocal(vector8f_arg0 input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX_INTRINSICS)
+			if (static_condition<is_exact_precision<precision>::value>::test())
+				return vector_reciprocal(vector_sqrt(input));
+
+			const __m256 estimate = _mm256_rsqrt_ps(input);
+			if (static_condition<precision == normalize_precision::estimate>::test())
+				return estimate;
+
+			// One Newton-Raphson iteration: x1 = x0 * (1.5 - (0.5 * input * x0 * x0))
+			const vector8f half_input = vector_mul(input, 0.5F);
+			return vector_mul(estimate, vector_neg_mul_sub(half_input, vector_mul(estimate, estimate), vector8_set(1.5F)));
+#else
+			return vector8f{ batch_sqrt_reciprocal<precision>(input.lo), batch_sqrt_reciprocal<precision>(input.hi) };
+#endif
+		}
+
+#if defined(RTM_SVE_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// SVE helpers, the vector length is only known at runtime.
+		// Batch loops advance by batch_sve_num_lanes() values and predicate every
+		// iteration with svwhilelt: the last one covers the remainder.
+		//////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns how many floats an SVE register holds.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t batch_sve_num_lanes() RTM_NO_EXCEPT
+		{
+			return static_cast<uint32_t>(svcntw());
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the reciprocal square root of the input: 1.0 / sqrt(input)
+		//////////////////////////////////////////////////////////////////////////
+		template<normalize_precision precision>
+		inline svfloat32_t batch_sqrt_reciprocal(svbool_t pg, svfloat32_t input) RTM_NO_EXCEPT
+		{
+			if (static_condition<is_exact_precision<precision>::value>::test())
+				return svdivr_n_f32_x(pg, svsqrt_f32_x(pg, input), 1.0F);
+
+			const svfloat32_t estimate = svrsqrte_f32(input);
+			if (static_condition<precision == normalize_precision::estimate>::test())
+				return estimate;
+
+			// One Newton-Raphson iteration, svrsqrts_f32 calculates: (3.0 - (a * b)) / 2.0
+			return svmul_f32_x(pg, estimate, svrsqrts_f32(svmul_f32_x(pg, input, estimate), estimate));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Evaluates per lane the polynomial with the provided coefficients, lowest degree first.
+		//////////////////////////////////////////////////////////////////////////
+		template<size_t num_coefficients>
+		inline svfloat32_t batch_sve_polynomial(svbool_t pg, svfloat32_t x, const float (&coefficients)[num_coefficients]) RTM_NO_EXCEPT
+		{
+			svfloat32_t result = svdup_n_f32(coefficients[num_coefficients - 1]);
+			for (size_t coefficient_index = num_coefficients - 1; coefficient_index-- > 0;)
+				result = svmad_n_f32_x(pg, result, x, coefficients[coefficient_index]);
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the input magnitude with the sign of 'sign'.
+		//////////////////////////////////////////////////////////////////////////
+		inline svfloat32_t batch_sve_or_sign(svbool_t pg, svfloat32_t input, svfloat32_t sign) RTM_NO_EXCEPT
+		{
+			const svuint32_t sign_bit = svand_n_u32_x(pg, svreinterpret_u32_f32(sign), 0x80000000U);
+			return svreinterpret_f32_u32(svorr_u32_x(pg, svreinterpret_u32_f32(input), sign_bit));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the arc-tangent of the input, see vector_atan.
+		//////////////////////////////////////////////////////////////////////////
+		inline svfloat32_t batch_sve_atan(svbool_t pg, svfloat32_t input) RTM_NO_EXCEPT
+		{
+			// Same degree 13 minimax approximation polynomial as vector_atan
+			const float coefficients[] = { 1.0F, -3.3324998579202170e-1F, 1.9856563505717162e-1F, -1.3374657325451267e-1F, 8.1675882859940430e-2F, -3.5059680836411644e-2F, 7.2128853633444123e-3F };
+
+			const svfloat32_t abs_value = svabs_f32_x(pg, input);
+			const svbool_t is_larger_than_one = svcmpgt_n_f32(pg, abs_value, 1.0F);
+			const svfloat32_t x = svsel_f32(is_larger_than_one, svdivr_n_f32_x(pg, abs_value, 1.0F), abs_value);
+
+			svfloat32_t result = svmul_f32_x(pg, batch_sve_polynomial(pg, svmul_f32_x(pg, x, x), coefficients), x);
+
+			// pi/2 - result
+			result = svsel_f32(is_larger_than_one, svsubr_n_f32_x(pg, result, rtm::constants::half_pi()), result);
+
+			// Keep the original sign
+			return batch_sve_or_sign(pg, result, input);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the arc-tangent of [y/x], see vector_atan2.
+		//////////////////////////////////////////////////////////////////////////
+		inline svfloat32_t batch_sve_atan2(svbool_t pg, svfloat32_t y, svfloat32_t x) RTM_NO_EXCEPT
+		{
+			const svfloat32_t zero = svdup_n_f32(0.0F);
+			const svbool_t is_x_zero = svcmpeq_n_f32(pg, x, 0.0F);
+			const svbool_t is_y_zero = svcmpeq_n_f32(pg, y, 0.0F);
+			const svbool_t inputs_are_zero = svand_b_z(pg, is_x_zero, is_y_zero);
+			const svbool_t is_x_positive = svcmpgt_n_f32(pg, x, 0.0F);
+
+			// If X == 0.0, our offset is PI/2 otherwise it is PI both with the sign of Y
+			// If X > 0.0 or if X == 0.0 and Y == 0.0, our offset is 0.0
+			svfloat32_t offset = svsel_f32(is_x_zero, svdup_n_f32(rtm::constants::half_pi()), svdup_n_f32(rtm::constants::pi()));
+			offset = batch_sve_or_sign(pg, offset, y);
+			offset = svsel_f32(svorr_b_z(pg, is_x_positive, inputs_are_zero), zero, offset);
+
+			// If X == 0.0, our value is 0.0 otherwise it is atan(y/x)
+			const svfloat32_t value = svsel_f32(is_x_zero, zero, batch_sve_atan(pg, svdiv_f32_x(pg, y, x)));
+
+			return svadd_f32_x(pg, value, offset);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the arc-cosine of the input, see vector_acos.
+		// Input values must be in the range [-1.0, 1.0].
+		//////////////////////////////////////////////////////////////////////////
+		inline svfloat32_t batch_sve_acos(svbool_t pg, svfloat32_t input) RTM_NO_EXCEPT
+		{
+			// Same polynomial as vector_acos: acos(value) = sqrt(1.0 - abs(value)) * polynomial(abs(value))
+			const float coefficients[] = { 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F };
+
+			const svfloat32_t abs_value = svabs_f32_x(pg, input);
+			const svfloat32_t scale = svsqrt_f32_x(pg, svsubr_n_f32_x(pg, abs_value, 1.0F));
+			const svfloat32_t result = svmul_f32_x(pg, batch_sve_polynomial(pg, abs_value, coefficients), scale);
+
+			// If input is negative: PI - result
+			const svbool_t is_input_negative = svcmplt_n_f32(pg, input, 0.0F);
+			return svsel_f32(is_input_negative, svsubr_n_f32_x(pg, result, rtm::constants::pi()), result);
+		}
+#endif
+
+#if defined(RTM_AVX512_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// AVX-512 helpers, batch loops process 16 floats per iteration.
+		// The remainder is handled by a last iteration with masked loads and stores.
+		//////////////////////////////////////////////////////////////////////////
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns a mask with the first 'count' lanes set, 16 or more sets every lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline __mmask16 batch_avx512_mask(uint32_t count) RTM_NO_EXCEPT
+		{
+			return count >= 16 ? __mmask16(0xFFFF) : __mmask16((1U << count) - 1U);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the mask of the register at 'register_index' when 'num_floats' are
+		// loaded or stored with consecutive registers.
+		//////////////////////////////////////////////////////////////////////////
+		inline __mmask16 batch_avx512_mask(uint32_t num_floats, uint32_t register_index) RTM_NO_EXCEPT
+		{
+			const uint32_t offset = register_index * 16;
+			return num_floats > offset ? batch_avx512_mask(num_floats - offset) : __mmask16(0);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane multiplication/addition: (v0 * v1) + v2
+		// Fused only when FMA is enabled, like vector_mul_add.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_mul_add(__m512 v0, __m512 v1, __m512 v2) RTM_NO_EXCEPT
+		{
+#if defined(RTM_IMPL_USE_FMA)
+			return _mm512_fmadd_ps(v0, v1, v2);
+#else
+			return _mm512_add_ps(_mm512_mul_ps(v0, v1), v2);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per lane negative multiplication/subtraction: v2 - (v0 * v1)
+		// Fused only when FMA is enabled, like vector_neg_mul_sub.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_neg_mul_sub(__m512 v0, __m512 v1, __m512 v2) RTM_NO_EXCEPT
+		{
+#if defined(RTM_IMPL_USE_FMA)
+			return _mm512_fnmadd_ps(v0, v1, v2);
+#else
+			return _mm512_sub_ps(v2, _mm512_mul_ps(v0, v1));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the square root of the input.
+		// GCC warns that the undefined pass-through of _mm512_sqrt_ps may be uninitialized,
+		// the zero masked form with every lane set is the same instruction without it.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_sqrt(__m512 input) RTM_NO_EXCEPT
+		{
+			return _mm512_maskz_sqrt_ps(__mmask16(0xFFFF), input);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the reciprocal square root of the input: 1.0 / sqrt(input)
+		//////////////////////////////////////////////////////////////////////////
+		template<normalize_precision precision>
+		inline __m512 RTM_SIMD_CALL batch_sqrt_reciprocal(__m512 input) RTM_NO_EXCEPT
+		{
+			if (static_condition<is_exact_precision<precision>::value>::test())
+				return _mm512_div_ps(_mm512_set1_ps(1.0F), batch_avx512_sqrt(input));
+
+			// 14 bits of precision, more than the 12 bits of _mm_rsqrt_ps
+			const __m512 estimate = _mm512_rsqrt14_ps(input);
+			if (static_condition<precision == normalize_precision::estimate>::test())
+				return estimate;
+
+			// One Newton-Raphson iteration: x1 = x0 * (1.5 - (0.5 * input * x0 * x0))
+			const __m512 half_input = _mm512_mul_ps(input, _mm512_set1_ps(0.5F));
+			return _mm512_mul_ps(estimate, batch_avx512_neg_mul_sub(half_input, _mm512_mul_ps(estimate, estimate), _mm512_set1_ps(1.5F)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the degree 6 polynomial: c0 + c1 * x + ... + c6 * x^6
+		// Evaluated with Estrin's scheme exactly like vector_polynomial.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_polynomial(__m512 x, float c0, float c1, float c2, float c3, float c4, float c5, float c6) RTM_NO_EXCEPT
+		{
+			const __m512 x2 = _mm512_mul_ps(x, x);
+			const __m512 x4 = _mm512_mul_ps(x2, x2);
+			const __m512 p01 = batch_avx512_mul_add(x, _mm512_set1_ps(c1), _mm512_set1_ps(c0));
+			const __m512 p23 = batch_avx512_mul_add(x, _mm512_set1_ps(c3), _mm512_set1_ps(c2));
+			const __m512 p0123 = batch_avx512_mul_add(p23, x2, p01);
+			const __m512 p45 = batch_avx512_mul_add(x, _mm512_set1_ps(c5), _mm512_set1_ps(c4));
+			const __m512 p456 = batch_avx512_mul_add(x2, _mm512_set1_ps(c6), p45);
+			return batch_avx512_mul_add(p456, x4, p0123);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the degree 7 polynomial: c0 + c1 * x + ... + c7 * x^7
+		// Evaluated with Estrin's scheme exactly like vector_polynomial.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_polynomial(__m512 x, float c0, float c1, float c2, float c3, float c4, float c5, float c6, float c7) RTM_NO_EXCEPT
+		{
+			const __m512 x2 = _mm512_mul_ps(x, x);
+			const __m512 x4 = _mm512_mul_ps(x2, x2);
+			const __m512 p01 = batch_avx512_mul_add(x, _mm512_set1_ps(c1), _mm512_set1_ps(c0));
+			const __m512 p23 = batch_avx512_mul_add(x, _mm512_set1_ps(c3), _mm512_set1_ps(c2));
+			const __m512 p0123 = batch_avx512_mul_add(p23, x2, p01);
+			const __m512 p45 = batch_avx512_mul_add(x, _mm512_set1_ps(c5), _mm512_set1_ps(c4));
+			const __m512 p67 = batch_avx512_mul_add(x, _mm512_set1_ps(c7), _mm512_set1_ps(c6));
+			const __m512 p4567 = batch_avx512_mul_add(p67, x2, p45);
+			return batch_avx512_mul_add(p4567, x4, p0123);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the input magnitude with the sign of 'sign'.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_or_sign(__m512 input, __m512 sign) RTM_NO_EXCEPT
+		{
+			const __m512i sign_bit = _mm512_and_si512(_mm512_castps_si512(sign), _mm512_set1_epi32(static_cast<int32_t>(0x80000000U)));
+			return _mm512_castsi512_ps(_mm512_or_si512(_mm512_castps_si512(input), sign_bit));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the arc-tangent of the input, see vector_atan.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_atan(__m512 input) RTM_NO_EXCEPT
+		{
+			const __m512 one = _mm512_set1_ps(1.0F);
+			const __m512 abs_value = _mm512_abs_ps(input);
+			const __mmask16 is_larger_than_one = _mm512_cmp_ps_mask(abs_value, one, _CMP_GT_OQ);
+			const __m512 x = _mm512_mask_div_ps(abs_value, is_larger_than_one, one, abs_value);
+
+			// Same degree 13 minimax approximation polynomial as vector_atan
+			__m512 result = batch_avx512_polynomial(_mm512_mul_ps(x, x), 1.0F, -3.3324998579202170e-1F, 1.9856563505717162e-1F, -1.3374657325451267e-1F, 8.1675882859940430e-2F, -3.5059680836411644e-2F, 7.2128853633444123e-3F);
+			result = _mm512_mul_ps(result, x);
+
+			// pi/2 - result
+			result = _mm512_mask_sub_ps(result, is_larger_than_one, _mm512_set1_ps(rtm::constants::half_pi()), result);
+
+			// Keep the original sign
+			return batch_avx512_or_sign(result, input);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the arc-tangent of [y/x], see vector_atan2.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_atan2(__m512 y, __m512 x) RTM_NO_EXCEPT
+		{
+			const __m512 zero = _mm512_setzero_ps();
+			const __mmask16 is_x_zero = _mm512_cmp_ps_mask(x, zero, _CMP_EQ_OQ);
+			const __mmask16 is_y_zero = _mm512_cmp_ps_mask(y, zero, _CMP_EQ_OQ);
+			const __mmask16 inputs_are_zero = __mmask16(is_x_zero & is_y_zero);
+			const __mmask16 is_x_positive = _mm512_cmp_ps_mask(x, zero, _CMP_GT_OQ);
+
+			// If X == 0.0, our offset is PI/2 otherwise it is PI both with the sign of Y
+			// If X > 0.0 or if X == 0.0 and Y == 0.0, our offset is 0.0
+			__m512 offset = _mm512_mask_blend_ps(is_x_zero, _mm512_set1_ps(rtm::constants::pi()), _mm512_set1_ps(rtm::constants::half_pi()));
+			offset = batch_avx512_or_sign(offset, y);
+			offset = _mm512_maskz_mov_ps(__mmask16(~(is_x_positive | inputs_are_zero)), offset);
+
+			// If X == 0.0, our value is 0.0 otherwise it is atan(y/x)
+			const __m512 value = _mm512_maskz_mov_ps(__mmask16(~is_x_zero), batch_avx512_atan(_mm512_div_ps(y, x)));
+
+			return _mm512_add_ps(value, offset);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane the arc-cosine of the input, see vector_acos.
+		// Input values must be in the range [-1.0, 1.0].
+		//////////////////////////////////////////////////////////////////////////
+		inline __m512 RTM_SIMD_CALL batch_avx512_acos(__m512 input) RTM_NO_EXCEPT
+		{
+			// Same polynomial as vector_acos: acos(value) = sqrt(1.0 - abs(value)) * polynomial(abs(value))
+			const __m512 abs_value = _mm512_abs_ps(input);
+			__m512 result = batch_avx512_polynomial(abs_value, 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F);
+			result = _mm512_mul_ps(result, batch_avx512_sqrt(_mm512_sub_ps(_mm512_set1_ps(1.0F), abs_value)));
+
+			// Like vector_acos, the result gets the sign of the input and PI is added when it is negative
+			const __mmask16 is_input_negative = _mm512_cmp_ps_mask(input, _mm512_setzero_ps(), _CMP_LT_OQ);
+			return _mm512_add_ps(batch_avx512_or_sign(result, input), _mm512_maskz_mov_ps(is_input_negative, _mm512_set1_ps(rtm::constants::pi())));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes 16 consecutive float4 values (array of structures) held in 4 registers
+		// into 4 registers with one component each (structure of arrays).
+		// Each permutation reads both of its inputs with vpermt2ps.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL batch_avx512_transpose_aos_to_soa(__m512 input0, __m512 input1, __m512 input2, __m512 input3, __m512& out_x, __m512& out_y, __m512& out_z, __m512& out_w) RTM_NO_EXCEPT
+		{
+			// [x0 x1 x2 x3 x4 x5 x6 x7 y0 y1 y2 y3 y4 y5 y6 y7] and [z0 .. z7 w0 .. w7]
+			const __m512i xy_indices = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28, 1, 5, 9, 13, 17, 21, 25, 29);
+			const __m512i zw_indices = _mm512_setr_epi32(2, 6, 10, 14, 18, 22, 26, 30, 3, 7, 11, 15, 19, 23, 27, 31);
+			const __m512 xy01 = _mm512_permutex2var_ps(input0, xy_indices, input1);
+			const __m512 zw01 = _mm512_permutex2var_ps(input0, zw_indices, input1);
+			const __m512 xy23 = _mm512_permutex2var_ps(input2, xy_indices, input3);
+			const __m512 zw23 = _mm512_permutex2var_ps(input2, zw_indices, input3);
+
+			const __m512i low_indices = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 16, 17, 18, 19, 20, 21, 22, 23);
+			const __m512i high_indices = _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15, 24, 25, 26, 27, 28, 29, 30, 31);
+			out_x = _mm512_permutex2var_ps(xy01, low_indices, xy23);
+			out_y = _mm512_permutex2var_ps(xy01, high_indices, xy23);
+			out_z = _mm512_permutex2var_ps(zw01, low_indices, zw23);
+			out_w = _mm512_permutex2var_ps(zw01, high_indices, zw23);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Transposes 4 registers with one component each (structure of arrays)
+		// into 16 consecutive float4 values (array of structures) held in 4 registers.
+		// This is the inverse of batch_avx512_transpose_aos_to_soa.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL batch_avx512_transpose_soa_to_aos(__m512 x, __m512 y, __m512 z, __m512 w, __m512& out0, __m512& out1, __m512& out2, __m512& out3) RTM_NO_EXCEPT
+		{
+			// [x0 y0 x1 y1 .. x7 y7] and [x8 y8 .. x15 y15], the same with z and w
+			const __m512i low_indices = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+			const __m512i high_indices = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+			const __m512 xy_low = _mm512_permutex2var_ps(x, low_indices, y);
+			const __m512 xy_high = _mm512_permutex2var_ps(x, high_indices, y);
+			const __m512 zw_low = _mm512_permutex2var_ps(z, low_indices, w);
+			const __m512 zw_high = _mm512_permutex2var_ps(z, high_indices, w);
+
+			const __m512i first_indices = _mm512_setr_epi32(0, 1, 16, 17, 2, 3, 18, 19, 4, 5, 20, 21, 6, 7, 22, 23);
+			const __m512i second_indices = _mm512_setr_epi32(8, 9, 24, 25, 10, 11, 26, 27, 12, 13, 28, 29, 14, 15, 30, 31);
+			out0 = _mm512_permutex2var_ps(xy_low, first_indices, zw_low);
+			out1 = _mm512_permutex2var_ps(xy_low, second_indices, zw_low);
+			out2 = _mm512_permutex2var_ps(xy_high, first_indices, zw_high);
+			out3 = _mm512_permutex2var_ps(xy_high, second_indices, zw_high);
+		}
+#endif
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,69 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+
+// Note: This header must remain free of RTM includes and inline functions since it is
+// shared between translation units compiled for different instruction sets.
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The batch kernels of one instruction set variant, see rtm/batch/dispatch.h.
+		// Every RTM argument is passed by address so that every variant shares the
+		// same signatures regardless of how its own RTM types are compiled. Store modes
+		// are passed as their store_mode value.
+		//////////////////////////////////////////////////////////////////////////
+		struct batch_kernel_table
+		{
+			const char* name;
+
+			void (*quat_mul_soa)(const void* lhs, const void* rhs, const void* output, uint32_t num_quats);
+			void (*quat_lerp_soa)(const void* start, const void* end, const float* alphas, const void* output, uint32_t num_quats);
+			void (*quat_slerp_fast_soa)(const void* start, const void* end, const float* alphas, const void* output, uint32_t num_quats);
+
+			void (*matrix_from_quat_aos)(const void* input, void* output, uint32_t num_quats);
+			void (*quat_from_matrix_aos)(const void* input, void* output, uint32_t num_matrices);
+			void (*matrix_mul_aos)(const void* lhs, const void* rhs, void* output, uint32_t num_matrices, uint32_t mode);
+
+			void (*qvv_mul_aos)(const void* lhs, const void* rhs, void* output, uint32_t num_transforms);
+			void (*matrix_from_qvv_aos)(const void* input, void* output, uint32_t num_transforms, uint32_t mode);
+			void (*qvv_mul_point3_aos)(const void* transform, const void* points, void* output, uint32_t num_points);
+			void (*qvv_mul_point3_indexed_aos)(const void* transforms, const uint32_t* transform_indices, const void* points, void* output, uint32_t num_points);
+			void (*qvv_load_packed_array)(const void* input, void* output, uint32_t num_transforms);
+			void (*qvv_store_packed_array)(const void* input, void* output, uint32_t num_transforms);
+
+			// The range functions take 4 stream SoA views, the [w] stream is unused with 3 components
+			void (*vector_range_soa)(const void* samples, uint32_t num_components, uint32_t num_samples, void* out_range_min, void* out_range_extent);
+			void (*pack_range_reduce_unorm_soa)(const void* samples, uint32_t num_components, const void* range_min, const void* range_extent, uint32_t num_bits, const void* output, uint32_t num_samples);
+			void (*unpack_range_expand_unorm_soa)(const void* input, uint32_t num_components, uint32_t num_bits, const void* range_min, const void* range_extent, const void* output, uint32_t num_samples);
+
+			void (*dualquat_blend4_aos)(const void* palette, const uint16_t* bone_indices, const float* bone_weights, void* output, uint32_t num_vertices);
+		};
+	}
+}
@@ -0,0 +1,198 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/batch/dualquatf.h"
+#include "rtm/batch/matrix3x4f.h"
+#include "rtm/batch/quatf.h"
+#include "rtm/batch/qvvf.h"
+#include "rtm/batch/range.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Type erased wrappers around the batch functions compiled for the current
+		// instruction set. They must match the signatures of batch_kernel_table.
+		//////////////////////////////////////////////////////////////////////////
+		inline void batch_kernel_quat_mul_soa(const void* lhs, const void* rhs, const void* output, uint32_t num_quats)
+		{
+			quat_mul_soa(*static_cast<const const_float4f_soa*>(lhs), *static_cast<const const_float4f_soa*>(rhs), *static_cast<const float4f_soa*>(output), num_quats);
+		}
+
+		inline void batch_kernel_quat_lerp_soa(const void* start, const void* end, const float* alphas, const void* output, uint32_t num_quats)
+		{
+			quat_lerp_soa(*static_cast<const const_float4f_soa*>(start), *static_cast<const const_float4f_soa*>(end), alphas, *static_cast<const float4f_soa*>(output), num_quats);
+		}
+
+		inline void batch_kernel_quat_slerp_fast_soa(const void* start, const void* end, const float* alphas, const void* output, uint32_t num_quats)
+		{
+			quat_slerp_fast_soa(*static_cast<const const_float4f_soa*>(start), *static_cast<const const_float4f_soa*>(end), alphas, *static_cast<const float4f_soa*>(output), num_quats);
+		}
+
+		inline void batch_kernel_matrix_from_quat_aos(const void* input, void* output, uint32_t num_quats)
+		{
+			matrix_from_quat_aos(static_cast<const quatf*>(input), static_cast<matrix3x4f*>(output), num_quats);
+		}
+
+		inline void batch_kernel_quat_from_matrix_aos(const void* input, void* output, uint32_t num_matrices)
+		{
+			quat_from_matrix_aos(static_cast<const matrix3x4f*>(input), static_cast<quatf*>(output), num_matrices);
+		}
+
+		inline void batch_kernel_matrix_mul_aos(const void* lhs, const void* rhs, void* output, uint32_t num_matrices, uint32_t mode)
+		{
+			matrix_mul_aos(static_cast<const matrix3x4f*>(lhs), static_cast<const matrix3x4f*>(rhs), static_cast<matrix3x4f*>(output), num_matrices, static_cast<store_mode>(mode));
+		}
+
+		inline void batch_kernel_qvv_mul_aos(const void* lhs, const void* rhs, void* output, uint32_t num_transforms)
+		{
+			qvv_mul_aos(static_cast<const qvvf*>(lhs), static_cast<const qvvf*>(rhs), static_cast<qvvf*>(output), num_transforms);
+		}
+
+		inline void batch_kernel_matrix_from_qvv_aos(const void* input, void* output, uint32_t num_transforms, uint32_t mode)
+		{
+			matrix_from_qvv_aos(static_cast<const qvvf*>(input), static_cast<float3x4f*>(output), num_transforms, static_cast<store_mode>(mode));
+		}
+
+		inline void batch_kernel_qvv_mul_point3_aos(const void* transform, const void* points, void* output, uint32_t num_points)
+		{
+			qvv_mul_point3_aos(*static_cast<const qvvf*>(transform), static_cast<const float3f*>(points), static_cast<float3f*>(output), num_points);
+		}
+
+		inline void batch_kernel_qvv_mul_point3_indexed_aos(const void* transforms, const uint32_t* transform_indices, const void* points, void* output, uint32_t num_points)
+		{
+			qvv_mul_point3_indexed_aos(static_cast<const qvvf*>(transforms), transform_indices, static_cast<const float3f*>(points), static_cast<float3f*>(output), num_points);
+		}
+
+		inline void batch_kernel_qvv_load_packed_array(const void* input, void* output, uint32_t num_transforms)
+		{
+			qvv_load_array(static_cast<const qvvf_packed*>(input), static_cast<qvvf*>(output), num_transforms);
+		}
+
+		inline void batch_kernel_qvv_store_packed_array(const void* input, void* output, uint32_t num_transforms)
+		{
+			qvv_store_array(static_cast<const qvvf*>(input), static_cast<qvvf_packed*>(output), num_transforms);
+		}
+
+		inline void batch_kernel_vector_range_soa(const void* samples, uint32_t num_components, uint32_t num_samples, void* out_range_min, void* out_range_extent)
+		{
+			const const_float4f_soa& samples4 = *static_cast<const const_float4f_soa*>(samples);
+			if (num_components == 3)
+				vector_range_soa(const_float3f_soa{ samples4.x, samples4.y, samples4.z }, num_samples, *static_cast<vector4f*>(out_range_min), *static_cast<vector4f*>(out_range_extent));
+			else
+				vector_range_soa(samples4, num_samples, *static_cast<vector4f*>(out_range_min), *static_cast<vector4f*>(out_range_extent));
+		}
+
+		inline void batch_kernel_pack_range_reduce_unorm_soa(const void* samples, uint32_t num_components, const void* range_min, const void* range_extent, uint32_t num_bits, const void* output, uint32_t num_samples)
+		{
+			const const_float4f_soa& samples4 = *static_cast<const const_float4f_soa*>(samples);
+			const vector4f range_min_ = *static_cast<const vector4f*>(range_min);
+			const vector4f range_extent_ = *static_cast<const vector4f*>(range_extent);
+			if (num_components == 3)
+				pack_range_reduce_unorm_soa(const_float3f_soa{ samples4.x, samples4.y, samples4.z }, range_min_, range_extent_, num_bits, *static_cast<const quantized4_soa*>(output), num_samples);
+			else
+				pack_range_reduce_unorm_soa(samples4, range_min_, range_extent_, num_bits, *static_cast<const quantized4_soa*>(output), num_samples);
+		}
+
+		inline void batch_kernel_unpack_range_expand_unorm_soa(const void* input, uint32_t num_components, uint32_t num_bits, const void* range_min, const void* range_extent, const void* output, uint32_t num_samples)
+		{
+			const float4f_soa& output4 = *static_cast<const float4f_soa*>(output);
+			const vector4f range_min_ = *static_cast<const vector4f*>(range_min);
+			const vector4f range_extent_ = *static_cast<const vector4f*>(range_extent);
+			if (num_components == 3)
+				unpack_range_expand_unorm_soa(*static_cast<const const_quantized4_soa*>(input), num_bits, range_min_, range_extent_, float3f_soa{ output4.x, output4.y, output4.z }, num_samples);
+			else
+				unpack_range_expand_unorm_soa(*static_cast<const const_quantized4_soa*>(input), num_bits, range_min_, range_extent_, output4, num_samples);
+		}
+
+		inline void batch_kernel_dualquat_blend4_aos(const void* palette, const uint16_t* bone_indices, const float* bone_weights, void* output, uint32_t num_vertices)
+		{
+			dualquat_blend4_aos(static_cast<const dualquatf*>(palette), bone_indices, bone_weights, static_cast<dualquatf*>(output), num_vertices);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the name of the instruction set the current translation unit is compiled for.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr const char* get_compiled_isa_name() RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX512_INTRINSICS)
+			return "avx512";
+#elif defined(RTM_AVX2_INTRINSICS)
+			return "avx2";
+#elif defined(RTM_AVX_INTRINSICS)
+			return "avx";
+#elif defined(RTM_SSE4_INTRINSICS)
+			return "sse4";
+#elif defined(RTM_SSE2_INTRINSICS)
+			return "sse2";
+#elif defined(RTM_SVE_INTRINSICS)
+			return "sve";
+#elif defined(RTM_NEON64_INTRINSICS)
+			return "neon64";
+#elif defined(RTM_NEON_INTRINSICS)
+			return "neon";
+#else
+			return "scalar";
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Fills a batch_kernel_table with the kernels compiled for the current translation unit.
+		// The table type is deduced: variants are compiled within a renamed namespace
+		// that cannot name it.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename table_type>
+		inline void fill_batch_kernel_table(table_type& out_table) RTM_NO_EXCEPT
+		{
+			out_table.name = get_compiled_isa_name();
+			out_table.quat_mul_soa = batch_kernel_quat_mul_soa;
+			out_table.quat_lerp_soa = batch_kernel_quat_lerp_soa;
+			out_table.quat_slerp_fast_soa = batch_kernel_quat_slerp_fast_soa;
+			out_table.matrix_from_quat_aos = batch_kernel_matrix_from_quat_aos;
+			out_table.quat_from_matrix_aos = batch_kernel_quat_from_matrix_aos;
+			out_table.matrix_mul_aos = batch_kernel_matrix_mul_aos;
+			out_table.qvv_mul_aos = batch_kernel_qvv_mul_aos;
+			out_table.matrix_from_qvv_aos = batch_kernel_matrix_from_qvv_aos;
+			out_table.qvv_mul_point3_aos = batch_kernel_qvv_mul_point3_aos;
+			out_table.qvv_mul_point3_indexed_aos = batch_kernel_qvv_mul_point3_indexed_aos;
+			out_table.qvv_load_packed_array = batch_kernel_qvv_load_packed_array;
+			out_table.qvv_store_packed_array = batch_kernel_qvv_store_packed_array;
+			out_table.vector_range_soa = batch_kernel_vector_range_soa;
+			out_table.pack_range_reduce_unorm_soa = batch_kernel_pack_range_reduce_unorm_soa;
+			out_table.unpack_range_expand_unorm_soa = batch_kernel_unpack_range_expand_unorm_soa;
+			out_table.dualquat_blend4_aos = batch_kernel_dualquat_blend4_aos;
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
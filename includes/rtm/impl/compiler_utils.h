@@ -85,11 +85,80 @@
 	#define RTM_FORCE_NOINLINE
 #endif
 
+//////////////////////////////////////////////////////////////////////////
+// Marks a pointer as the only way to access the memory it points to while in scope.
+// Loops over arrays of vectors and quaternions can then be vectorized by the compiler
+// without runtime overlap checks, which matters most with RTM_NO_INTRINSICS.
+//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_COMPILER_MSVC) || defined(RTM_COMPILER_GCC) || defined(RTM_COMPILER_CLANG)
+	#define RTM_RESTRICT __restrict
+#else
+	#define RTM_RESTRICT
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Tells the optimizer that a code path is never executed.
+//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_COMPILER_MSVC)
+	#define RTM_UNREACHABLE() __assume(0)
+#elif defined(RTM_COMPILER_GCC) || defined(RTM_COMPILER_CLANG)
+	#define RTM_UNREACHABLE() __builtin_unreachable()
+#else
+	#define RTM_UNREACHABLE() ((void)0)
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Tells the optimizer that an expression is always true. The expression must be free
+// of side effects as it may be evaluated. If it is false, the behavior is undefined.
+// Clang's __builtin_assume is not used as it ignores (and warns about) any expression
+// that calls a function, an unreachable branch works with everything.
+// Define RTM_NO_ASSUME to disable these hints.
+//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_NO_ASSUME)
+	#define RTM_ASSUME(expression) ((void)0)
+#elif defined(RTM_COMPILER_MSVC)
+	#define RTM_ASSUME(expression) __assume(expression)
+#elif defined(RTM_COMPILER_GCC) || defined(RTM_COMPILER_CLANG)
+	#define RTM_ASSUME(expression) do { if (!(expression)) __builtin_unreachable(); } while (false)
+#else
+	#define RTM_ASSUME(expression) ((void)0)
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Joins two pre-processor tokens: RTM_JOIN_TOKENS(foo, bar) yields 'foobar'
 //////////////////////////////////////////////////////////////////////////
 #define RTM_JOIN_TOKENS(a, b) a ## b
 
+//////////////////////////////////////////////////////////////////////////
+// Functions marked with RTM_CONSTEXPR_EVAL can be evaluated at compile time
+// with C++20. During constant evaluation (detected with std::is_constant_evaluated),
+// they use scalar code on the components obtained with std::bit_cast and
+// at runtime they use the usual SIMD code. Before C++20, they are simply inline.
+// Define RTM_NO_CONSTEXPR_EVAL to disable this.
+//////////////////////////////////////////////////////////////////////////
+#if defined(_MSVC_LANG)
+	#define RTM_IMPL_CPP_VERSION _MSVC_LANG
+#else
+	#define RTM_IMPL_CPP_VERSION __cplusplus
+#endif
+
+#if RTM_IMPL_CPP_VERSION >= 202002L && !defined(RTM_NO_CONSTEXPR_EVAL)
+	#include <version>
+
+	#if defined(__cpp_lib_is_constant_evaluated) && defined(__cpp_lib_bit_cast)
+		#include <bit>
+		#include <type_traits>
+
+		#define RTM_CONSTEXPR_EVAL_SUPPORTED
+	#endif
+#endif
+
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+	#define RTM_CONSTEXPR_EVAL constexpr
+#else
+	#define RTM_CONSTEXPR_EVAL inline
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Helper macro to determine if vrndns_f32 is supported (ARM64 only)
 //////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,82 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/quat_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a dual quaternion from its real and dual parts.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr dualquatf RTM_SIMD_CALL dualquat_set(quatf_arg0 real, quatf_arg1 dual) RTM_NO_EXCEPT
+	{
+		return dualquatf{ real, dual };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a dual quaternion from its real and dual parts.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr dualquatd RTM_SIMD_CALL dualquat_set(const quatd& real, const quatd& dual) RTM_NO_EXCEPT
+	{
+		return dualquatd{ real, dual };
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various dual quaternion types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct dualquat_identity_impl
+		{
+			inline RTM_SIMD_CALL operator dualquatd() const RTM_NO_EXCEPT
+			{
+				return dualquat_set(quat_identity(), quat_set(0.0, 0.0, 0.0, 0.0));
+			}
+
+			inline RTM_SIMD_CALL operator dualquatf() const RTM_NO_EXCEPT
+			{
+				return dualquat_set(quat_identity(), quat_set(0.0F, 0.0F, 0.0F, 0.0F));
+			}
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the identity dual quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr rtm_impl::dualquat_identity_impl RTM_SIMD_CALL dualquat_identity() RTM_NO_EXCEPT
+	{
+		return rtm_impl::dualquat_identity_impl();
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -159,6 +159,64 @@ RTM_IMPL_FILE_PRAGMA_PUSH
 
 #endif
 
+//////////////////////////////////////////////////////////////////////////
+// RTM_ASSERT_ASSUME behaves like RTM_ASSERT when assert checks are enabled. When they
+// are stripped, the expression becomes an optimizer hint with RTM_ASSUME instead of
+// vanishing: RTM_ASSERT_ASSUME(false, ...) marks an unreachable code path.
+// It is only used for cheap preconditions that the optimizer can exploit, like
+// alignment and enum ranges, where violating them is already undefined behavior.
+// Define RTM_NO_ASSUME to strip it like any other assert.
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(RTM_HAS_ASSERT_CHECKS)
+	#define RTM_ASSERT_ASSUME(expression, format, ...) RTM_ASSERT(expression, format, ## __VA_ARGS__)
+#else
+	#define RTM_ASSERT_ASSUME(expression, format, ...) RTM_ASSUME(expression)
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Profiling support
+//
+// The batch and array functions open a profiling scope that spans the whole call
+// and records the function name, the number of elements processed, and the number
+// of bytes read and written by the element streams (arguments broadcast to every
+// element, like a single transform, are not counted).
+//
+// A total of 3 behaviors are supported:
+//    - We can expand a custom macro
+//    - We can construct a custom scope type
+//    - Do nothing and strip the scopes at compile time (default behavior)
+//
+// Custom macro:
+//    Define RTM_PROFILE_SCOPE before including RTM. For example with Tracy:
+//    #define RTM_PROFILE_SCOPE(name, num_elements, num_bytes) ZoneScopedN(name); ZoneValue(num_elements)
+//
+// Custom scope type:
+//    Define RTM_ON_PROFILE_SCOPE_CUSTOM with the name of a type constructed when the
+//    scope begins and destroyed when it ends:
+//    #define RTM_ON_PROFILE_SCOPE_CUSTOM my_rtm_profile_scope
+//    Note that the constructor signature is as follow:
+//    my_rtm_profile_scope(const char* name, uint64_t num_elements, uint64_t num_bytes) {}
+//
+// The name is a string literal such as "rtm::quat_mul_soa". When the scopes are
+// enabled, RTM_HAS_PROFILE_SCOPES is defined.
+//////////////////////////////////////////////////////////////////////////
+
+#if defined(RTM_PROFILE_SCOPE)
+
+	#define RTM_HAS_PROFILE_SCOPES
+
+#elif defined(RTM_ON_PROFILE_SCOPE_CUSTOM)
+
+	#define RTM_PROFILE_SCOPE(name, num_elements, num_bytes) const RTM_ON_PROFILE_SCOPE_CUSTOM rtm_impl_profile_scope((name), uint64_t(num_elements), uint64_t(num_bytes)); (void)rtm_impl_profile_scope
+	#define RTM_HAS_PROFILE_SCOPES
+
+#else
+
+	#define RTM_PROFILE_SCOPE(name, num_elements, num_bytes) ((void)0)
+
+#endif
+
 //////////////////////////////////////////////////////////////////////////
 // Deprecation support
 //////////////////////////////////////////////////////////////////////////
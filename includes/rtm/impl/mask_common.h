@@ -49,7 +49,11 @@ namespace rtm
 				const uint64_t z_mask = z ? 0xFFFFFFFFFFFFFFFFULL : 0;
 				const uint64_t w_mask = w ? 0xFFFFFFFFFFFFFFFFULL : 0;
 
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm256_castsi256_pd(_mm256_set_epi64x(w_mask, z_mask, y_mask, x_mask));
+#else
 				return mask4d{ _mm_castsi128_pd(_mm_set_epi64x(y_mask, x_mask)), _mm_castsi128_pd(_mm_set_epi64x(w_mask, z_mask)) };
+#endif
 #else
 				const uint64_t x_mask = x ? 0xFFFFFFFFFFFFFFFFULL : 0;
 				const uint64_t y_mask = y ? 0xFFFFFFFFFFFFFFFFULL : 0;
@@ -207,7 +211,13 @@ namespace rtm
 				const uint32_t z_mask = z ? 0xFFFFFFFFU : 0;
 				const uint32_t w_mask = w ? 0xFFFFFFFFU : 0;
 
+		#if defined(RTM_AVX_INTRINSICS)
+				return _mm256_castsi256_pd(_mm256_set_epi32(w_mask, w_mask, z_mask, z_mask, y_mask, y_mask, x_mask, x_mask));
+		#else
 				return mask4d{ _mm_castsi128_pd(_mm_set_epi32(y_mask, y_mask, x_mask, x_mask)), _mm_castsi128_pd(_mm_set_epi32(w_mask, w_mask, z_mask, z_mask)) };
+		#endif
+	#elif defined(RTM_AVX_INTRINSICS)
+				return _mm256_castsi256_pd(_mm256_set_epi64x(w, z, y, x));
 	#else
 				return mask4d{ _mm_castsi128_pd(_mm_set_epi64x(y, x)), _mm_castsi128_pd(_mm_set_epi64x(w, z)) };
 	#endif
@@ -255,6 +265,108 @@ namespace rtm
 	{
 		return rtm_impl::mask4_uint64_set{ x, y, z, w };
 	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the number of bits set in a 4 bit mask, see mask_get_bits.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr uint32_t mask_bits_count(uint32_t mask_bits) RTM_NO_EXCEPT
+		{
+			// Every nibble holds the count of its index
+			return uint32_t(0x4332322132212110ULL >> ((mask_bits & 0xF) * 4)) & 0xF;
+		}
+
+#if defined(RTM_SSE2_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Expands the 4 low bits into 4x32 bit masks.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128i RTM_SIMD_CALL mask_expand_bits32(uint32_t mask_bits) RTM_NO_EXCEPT
+		{
+			const __m128i bit_values = _mm_setr_epi32(1, 2, 4, 8);
+			return _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(int32_t(mask_bits)), bit_values), bit_values);
+		}
+#elif defined(RTM_NEON_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Expands the 4 low bits into 4x32 bit masks.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32x4_t RTM_SIMD_CALL mask_expand_bits32(uint32_t mask_bits) RTM_NO_EXCEPT
+		{
+			const uint32_t bit_values_data[4] = { 1, 2, 4, 8 };
+			return vtstq_u32(vdupq_n_u32(mask_bits), vld1q_u32(&bit_values_data[0]));
+		}
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various vector types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct mask4_bits_set
+		{
+			inline RTM_SIMD_CALL operator mask4d() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				// Duplicate every 32 bit mask to widen it to 64 bits
+				const __m128i mask32 = mask_expand_bits32(bits);
+				const __m128d xy = _mm_castsi128_pd(_mm_unpacklo_epi32(mask32, mask32));
+				const __m128d zw = _mm_castsi128_pd(_mm_unpackhi_epi32(mask32, mask32));
+
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm256_insertf128_pd(_mm256_castpd128_pd256(xy), zw, 1);
+#else
+				return mask4d{ xy, zw };
+#endif
+#else
+				return mask4d{ (bits & 1) != 0 ? 0xFFFFFFFFFFFFFFFFULL : 0, (bits & 2) != 0 ? 0xFFFFFFFFFFFFFFFFULL : 0, (bits & 4) != 0 ? 0xFFFFFFFFFFFFFFFFULL : 0, (bits & 8) != 0 ? 0xFFFFFFFFFFFFFFFFULL : 0 };
+#endif
+			}
+
+			inline RTM_SIMD_CALL operator mask4q() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				const __m128i mask32 = mask_expand_bits32(bits);
+				return mask4q{ _mm_unpacklo_epi32(mask32, mask32), _mm_unpackhi_epi32(mask32, mask32) };
+#else
+				return mask4q{ (bits & 1) != 0 ? 0xFFFFFFFFFFFFFFFFULL : 0, (bits & 2) != 0 ? 0xFFFFFFFFFFFFFFFFULL : 0, (bits & 4) != 0 ? 0xFFFFFFFFFFFFFFFFULL : 0, (bits & 8) != 0 ? 0xFFFFFFFFFFFFFFFFULL : 0 };
+#endif
+			}
+
+			inline RTM_SIMD_CALL operator mask4f() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				return _mm_castsi128_ps(mask_expand_bits32(bits));
+#elif defined(RTM_NEON_INTRINSICS)
+				return vreinterpretq_f32_u32(mask_expand_bits32(bits));
+#else
+				return mask4f{ (bits & 1) != 0 ? 0xFFFFFFFFU : 0, (bits & 2) != 0 ? 0xFFFFFFFFU : 0, (bits & 4) != 0 ? 0xFFFFFFFFU : 0, (bits & 8) != 0 ? 0xFFFFFFFFU : 0 };
+#endif
+			}
+
+			inline RTM_SIMD_CALL operator mask4i() const RTM_NO_EXCEPT
+			{
+#if defined(RTM_SSE2_INTRINSICS)
+				return mask_expand_bits32(bits);
+#elif defined(RTM_NEON_INTRINSICS)
+				return RTM_IMPL_MASK4i_SET(mask_expand_bits32(bits));
+#else
+				return mask4i{ (bits & 1) != 0 ? 0xFFFFFFFFU : 0, (bits & 2) != 0 ? 0xFFFFFFFFU : 0, (bits & 4) != 0 ? 0xFFFFFFFFU : 0, (bits & 8) != 0 ? 0xFFFFFFFFU : 0 };
+#endif
+			}
+
+			uint32_t bits;
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a mask4 from bits, one per component: bit 0 is [x] and bit 3 is [w].
+	// This is the inverse of mask_get_bits.
+	//////////////////////////////////////////////////////////////////////////
+	constexpr rtm_impl::mask4_bits_set RTM_SIMD_CALL mask_from_bits(uint32_t mask_bits) RTM_NO_EXCEPT
+	{
+		return rtm_impl::mask4_bits_set{ mask_bits };
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -144,6 +144,56 @@ namespace rtm
 			return axis == axis3::x ? x_axis : (axis == axis3::y ? y_axis : z_axis);
 		}
 
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses an affine matrix whose 3x3 rotation/scale part is orthogonal: the 3x3
+		// part is transposed and multiplied with 'inv_scale_sq' while the translation
+		// is rotated back and negated.
+		// The [w] component of every output axis is undefined.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_inverse_orthogonal(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, vector4f_arg3 w_axis, vector4f_arg4 inv_scale_sq,
+			vector4f& out_x_axis, vector4f& out_y_axis, vector4f& out_z_axis, vector4f& out_w_axis) RTM_NO_EXCEPT
+		{
+			const vector4f v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(x_axis, y_axis);
+			const vector4f v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(x_axis, y_axis);
+
+			const vector4f inv_x_axis = vector_mul(vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(v00_v01_v10_v11, z_axis), inv_scale_sq);
+			const vector4f inv_y_axis = vector_mul(vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(v00_v01_v10_v11, z_axis), inv_scale_sq);
+			const vector4f inv_z_axis = vector_mul(vector_mix<mix4::x, mix4::z, mix4::c, mix4::c>(v02_v03_v12_v13, z_axis), inv_scale_sq);
+
+			const vector4f tmp0 = vector_mul(vector_dup_z(w_axis), inv_z_axis);
+			const vector4f tmp1 = vector_mul_add(vector_dup_y(w_axis), inv_y_axis, tmp0);
+
+			out_x_axis = inv_x_axis;
+			out_y_axis = inv_y_axis;
+			out_z_axis = inv_z_axis;
+			out_w_axis = vector_neg(vector_mul_add(vector_dup_x(w_axis), inv_x_axis, tmp1));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses an affine matrix whose 3x3 rotation/scale part is orthogonal: the 3x3
+		// part is transposed and multiplied with 'inv_scale_sq' while the translation
+		// is rotated back and negated.
+		// The [w] component of every output axis is undefined.
+		//////////////////////////////////////////////////////////////////////////
+		inline void matrix_inverse_orthogonal(const vector4d& x_axis, const vector4d& y_axis, const vector4d& z_axis, const vector4d& w_axis, const vector4d& inv_scale_sq,
+			vector4d& out_x_axis, vector4d& out_y_axis, vector4d& out_z_axis, vector4d& out_w_axis) RTM_NO_EXCEPT
+		{
+			const vector4d v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(x_axis, y_axis);
+			const vector4d v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(x_axis, y_axis);
+
+			const vector4d inv_x_axis = vector_mul(vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(v00_v01_v10_v11, z_axis), inv_scale_sq);
+			const vector4d inv_y_axis = vector_mul(vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(v00_v01_v10_v11, z_axis), inv_scale_sq);
+			const vector4d inv_z_axis = vector_mul(vector_mix<mix4::x, mix4::z, mix4::c, mix4::c>(v02_v03_v12_v13, z_axis), inv_scale_sq);
+
+			const vector4d tmp0 = vector_mul(vector_dup_z(w_axis), inv_z_axis);
+			const vector4d tmp1 = vector_mul_add(vector_dup_y(w_axis), inv_y_axis, tmp0);
+
+			out_x_axis = inv_x_axis;
+			out_y_axis = inv_y_axis;
+			out_z_axis = inv_z_axis;
+			out_w_axis = vector_neg(vector_mul_add(vector_dup_x(w_axis), inv_x_axis, tmp1));
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Converts a 3x3 matrix into a rotation quaternion.
 		//////////////////////////////////////////////////////////////////////////
@@ -285,6 +335,78 @@ namespace rtm
 				return quat_normalize(quat_load(&quat_values[0]));
 			}
 		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Orthonormalizes the axes of a 3x3 matrix with Gram-Schmidt, see matrix_orthonormalize.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_orthonormalize(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, vector4f& out_x_axis, vector4f& out_y_axis, vector4f& out_z_axis) RTM_NO_EXCEPT
+		{
+			const vector4f x_axis_n = vector_normalize3(x_axis);
+			const float y_dot_x = vector_dot3(y_axis, x_axis_n);
+			const vector4f y_axis_n = vector_normalize3(vector_neg_mul_sub(x_axis_n, y_dot_x, y_axis));
+
+			// The cross product is already normalized, its sign retains reflections
+			const vector4f z_axis_n = vector_cross3(x_axis_n, y_axis_n);
+			const float z_sign = vector_dot3(z_axis, z_axis_n);
+
+			out_x_axis = x_axis_n;
+			out_y_axis = y_axis_n;
+			out_z_axis = z_sign >= 0.0F ? z_axis_n : vector_neg(z_axis_n);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the orthogonal polar factor of a 3x3 matrix, see matrix_orthonormalize_polar.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_orthonormalize_polar(vector4f_arg0 x_axis, vector4f_arg1 y_axis, vector4f_arg2 z_axis, uint32_t max_iterations, vector4f& out_x_axis, vector4f& out_y_axis, vector4f& out_z_axis) RTM_NO_EXCEPT
+		{
+			// Below this Frobenius norm squared, an update is lost in rounding
+			constexpr float convergence_threshold_sq = 1.0E-12F;
+
+			vector4f x = x_axis;
+			vector4f y = y_axis;
+			vector4f z = z_axis;
+
+			for (uint32_t iteration = 0; iteration < max_iterations; ++iteration)
+			{
+				// The inverse transpose is the cofactor matrix divided by the determinant
+				const vector4f cofactor_x = vector_cross3(y, z);
+				const vector4f cofactor_y = vector_cross3(z, x);
+				const vector4f cofactor_z = vector_cross3(x, y);
+				const float det = vector_dot3(x, cofactor_x);
+
+				if (scalar_abs(det) < 1.0E-8F)
+				{
+					// Singular, fall back to Gram-Schmidt which recovers what it can
+					matrix_orthonormalize(x_axis, y_axis, z_axis, out_x_axis, out_y_axis, out_z_axis);
+					return;
+				}
+
+				// Newton iteration X = (gamma * X + X^-T / gamma) / 2 with the Frobenius norm scaling
+				// of Higham, it converges in a few iterations even with a large scale
+				const float norm_sq = float(vector_length_squared3(x)) + float(vector_length_squared3(y)) + float(vector_length_squared3(z));
+				const float cofactor_norm_sq = float(vector_length_squared3(cofactor_x)) + float(vector_length_squared3(cofactor_y)) + float(vector_length_squared3(cofactor_z));
+				const float gamma = scalar_sqrt(scalar_sqrt(cofactor_norm_sq / norm_sq) / scalar_abs(det));
+				const vector4f scale = vector_set(gamma * 0.5F);
+				const vector4f cofactor_scale = vector_set(0.5F / (gamma * det));
+
+				const vector4f new_x = vector_mul_add(cofactor_x, cofactor_scale, vector_mul(x, scale));
+				const vector4f new_y = vector_mul_add(cofactor_y, cofactor_scale, vector_mul(y, scale));
+				const vector4f new_z = vector_mul_add(cofactor_z, cofactor_scale, vector_mul(z, scale));
+
+				const float delta_sq = float(vector_length_squared3(vector_sub(new_x, x))) + float(vector_length_squared3(vector_sub(new_y, y))) + float(vector_length_squared3(vector_sub(new_z, z)));
+
+				x = new_x;
+				y = new_y;
+				z = new_z;
+
+				if (delta_sq < convergence_threshold_sq)
+					break;
+			}
+
+			out_x_axis = x;
+			out_y_axis = y;
+			out_z_axis = z;
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
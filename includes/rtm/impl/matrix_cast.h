@@ -27,6 +27,7 @@
 #include "rtm/math.h"
 #include "rtm/vector4f.h"
 #include "rtm/vector4d.h"
+#include "rtm/impl/batch_common.h"
 #include "rtm/impl/compiler_utils.h"
 
 RTM_IMPL_FILE_PRAGMA_PUSH
@@ -156,9 +157,48 @@ namespace rtm
 				return matrix4x4d{ vector_cast(mtx.x_axis), vector_cast(mtx.y_axis), vector_cast(mtx.z_axis), vector_cast(mtx.w_axis) };
 			}
 
+			inline RTM_SIMD_CALL operator float3x4f() const RTM_NO_EXCEPT
+			{
+				// The last row only holds the [w] components of the axes, it is discarded
+				vector4f x_row = mtx.x_axis;
+				vector4f y_row = mtx.y_axis;
+				vector4f z_row = mtx.z_axis;
+				vector4f w_row = mtx.w_axis;
+				vector_transpose4x4(x_row, y_row, z_row, w_row);
+
+				float3x4f result;
+				vector_store(x_row, &result.x_row);
+				vector_store(y_row, &result.y_row);
+				vector_store(z_row, &result.z_row);
+				return result;
+			}
+
 			const matrix3x4f& mtx;
 		};
 
+		template<>
+		struct matrix_caster<float3x4f>
+		{
+			constexpr explicit matrix_caster(const float3x4f& mtx_) RTM_NO_EXCEPT : mtx(mtx_) {}
+
+			inline RTM_SIMD_CALL operator matrix3x4f() const RTM_NO_EXCEPT
+			{
+				vector4f x_axis = vector_load(&mtx.x_row);
+				vector4f y_axis = vector_load(&mtx.y_row);
+				vector4f z_axis = vector_load(&mtx.z_row);
+				vector4f w_axis = vector_zero();
+				vector_transpose4x4(x_axis, y_axis, z_axis, w_axis);
+				return matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
+			}
+
+			constexpr RTM_SIMD_CALL operator float3x4f() const RTM_NO_EXCEPT
+			{
+				return mtx;
+			}
+
+			const float3x4f& mtx;
+		};
+
 		template<>
 		struct matrix_caster<matrix3x4d>
 		{
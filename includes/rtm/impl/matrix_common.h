@@ -50,7 +50,7 @@ namespace rtm
 				return matrix3x3d{ vector_set(1.0, 0.0, 0.0, 0.0), vector_set(0.0, 1.0, 0.0, 0.0), vector_set(0.0, 0.0, 1.0, 0.0) };
 			}
 
-			inline RTM_SIMD_CALL operator matrix3x3f() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator matrix3x3f() const RTM_NO_EXCEPT
 			{
 				return matrix3x3f{ vector_set(1.0F, 0.0F, 0.0F, 0.0F), vector_set(0.0F, 1.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F, 0.0F) };
 			}
@@ -60,7 +60,7 @@ namespace rtm
 				return matrix3x4d{ vector_set(1.0, 0.0, 0.0, 0.0), vector_set(0.0, 1.0, 0.0, 0.0), vector_set(0.0, 0.0, 1.0, 0.0), vector_set(0.0, 0.0, 0.0, 1.0) };
 			}
 
-			inline RTM_SIMD_CALL operator matrix3x4f() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator matrix3x4f() const RTM_NO_EXCEPT
 			{
 				return matrix3x4f{ vector_set(1.0F, 0.0F, 0.0F, 0.0F), vector_set(0.0F, 1.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F, 0.0F), vector_set(0.0F, 0.0F, 0.0F, 1.0F) };
 			}
@@ -70,7 +70,7 @@ namespace rtm
 				return matrix4x4d{ vector_set(1.0, 0.0, 0.0, 0.0), vector_set(0.0, 1.0, 0.0, 0.0), vector_set(0.0, 0.0, 1.0, 0.0), vector_set(0.0, 0.0, 0.0, 1.0) };
 			}
 
-			inline RTM_SIMD_CALL operator matrix4x4f() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator matrix4x4f() const RTM_NO_EXCEPT
 			{
 				return matrix4x4f{ vector_set(1.0F, 0.0F, 0.0F, 0.0F), vector_set(0.0F, 1.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F, 0.0F), vector_set(0.0F, 0.0F, 0.0F, 1.0F) };
 			}
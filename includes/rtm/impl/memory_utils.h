@@ -32,8 +32,6 @@
 #include <cstring>
 #include <type_traits>
 #include <limits>
-#include <memory>
-#include <algorithm>
 
 //////////////////////////////////////////////////////////////////////////
 // This file contains various memory related utility functions and other misc helpers.
@@ -123,6 +121,22 @@ namespace rtm
 			return static_cast<IntegralType>((static_cast<size_t>(value) + (alignment - 1)) & ~(alignment - 1));
 		}
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the input pointer and lets the compiler assume that it satisfies the desired alignment.
+		// Auto-vectorized loops can then use aligned loads and stores without a peeling prologue.
+		//////////////////////////////////////////////////////////////////////////
+		template<size_t alignment, typename PtrType>
+		RTM_FORCE_INLINE PtrType* assume_aligned(PtrType* value) RTM_NO_EXCEPT
+		{
+			static_assert(is_power_of_two(alignment), "Alignment value must be a power of two");
+			RTM_ASSERT(is_aligned_to(value, alignment), "Pointer does not satisfy the alignment");
+#if defined(RTM_COMPILER_GCC) || defined(RTM_COMPILER_CLANG)
+			return static_cast<PtrType*>(__builtin_assume_aligned(value, alignment));
+#else
+			return value;
+#endif
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Returns the array size for the provided array.
 		//////////////////////////////////////////////////////////////////////////
@@ -137,7 +151,7 @@ namespace rtm
 		{
 			inline static DestPtrType* cast(SrcType* input) RTM_NO_EXCEPT
 			{
-				RTM_ASSERT(is_aligned_to(input, alignof(DestPtrType)), "reinterpret_cast would result in an unaligned pointer");
+				RTM_ASSERT_ASSUME(is_aligned_to(input, alignof(DestPtrType)), "reinterpret_cast would result in an unaligned pointer");
 				return reinterpret_cast<DestPtrType*>(input);
 			}
 		};
@@ -153,7 +167,7 @@ namespace rtm
 		{
 			inline static DestPtrType* cast(SrcType input) RTM_NO_EXCEPT
 			{
-				RTM_ASSERT(is_aligned_to(input, alignof(DestPtrType)), "reinterpret_cast would result in an unaligned pointer");
+				RTM_ASSERT_ASSUME(is_aligned_to(input, alignof(DestPtrType)), "reinterpret_cast would result in an unaligned pointer");
 				return reinterpret_cast<DestPtrType*>(input);
 			}
 		};
@@ -34,8 +34,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a quaternion from all 4 components.
 	//////////////////////////////////////////////////////////////////////////
-	inline quatf RTM_SIMD_CALL quat_set(float x, float y, float z, float w) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL quatf RTM_SIMD_CALL quat_set(float x, float y, float z, float w) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return std::bit_cast<quatf>(float4f{ x, y, z, w });
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_set_ps(w, z, y, x);
 #elif defined(RTM_NEON_INTRINSICS)
@@ -57,7 +61,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd RTM_SIMD_CALL quat_set(double x, double y, double z, double w) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set_pd(w, z, y, x);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ _mm_set_pd(y, x), _mm_set_pd(w, z) };
 #else
 		return quatd{ x, y, z, w };
@@ -79,7 +85,7 @@ namespace rtm
 				return quat_set(0.0, 0.0, 0.0, 1.0);
 			}
 
-			inline RTM_SIMD_CALL operator quatf() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator quatf() const RTM_NO_EXCEPT
 			{
 				return quat_set(0.0F, 0.0F, 0.0F, 1.0F);
 			}
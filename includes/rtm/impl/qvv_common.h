@@ -62,7 +62,7 @@ namespace rtm
 				return qvv_set(quat_identity(), vector_zero(), vector_set(1.0));
 			}
 
-			inline RTM_SIMD_CALL operator qvvf() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator qvvf() const RTM_NO_EXCEPT
 			{
 				return qvv_set(quat_identity(), vector_zero(), vector_set(1.0F));
 			}
@@ -27,6 +27,8 @@
 #include "rtm/math.h"
 #include "rtm/impl/compiler_utils.h"
 
+#include <cstdint>
+
 RTM_IMPL_FILE_PRAGMA_PUSH
 
 namespace rtm
@@ -95,6 +97,65 @@ namespace rtm
 	{
 		return rtm_impl::scalar_loaderd{ input };
 	}
+
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Reduces an angle in radians to [-PI, PI] during constant evaluation.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double constexpr_reduce_angle(double angle) RTM_NO_EXCEPT
+		{
+			constexpr double two_pi = 6.283185307179586476925286766559;
+
+			// std::round isn't constexpr, round to the nearest number of turns by hand
+			const double num_turns = angle / two_pi;
+			const double rounded_num_turns = double(int64_t(num_turns + (num_turns >= 0.0 ? 0.5 : -0.5)));
+			return angle - (rounded_num_turns * two_pi);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the sine of the angle in radians during constant evaluation where
+		// std::sin isn't available. The Taylor series is evaluated in double precision
+		// on the reduced angle which is accurate enough to round to float.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double constexpr_sin(double angle) RTM_NO_EXCEPT
+		{
+			const double x = constexpr_reduce_angle(angle);
+			const double x2 = x * x;
+
+			double term = x;
+			double result = x;
+			for (int32_t term_index = 1; term_index < 16; ++term_index)
+			{
+				term *= -x2 / double((2 * term_index) * (2 * term_index + 1));
+				result += term;
+			}
+
+			return result;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the cosine of the angle in radians during constant evaluation where
+		// std::cos isn't available.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr double constexpr_cos(double angle) RTM_NO_EXCEPT
+		{
+			const double x = constexpr_reduce_angle(angle);
+			const double x2 = x * x;
+
+			double term = 1.0;
+			double result = 1.0;
+			for (int32_t term_index = 1; term_index < 16; ++term_index)
+			{
+				term *= -x2 / double((2 * term_index - 1) * (2 * term_index));
+				result += term;
+			}
+
+			return result;
+		}
+	}
+#endif
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -88,12 +88,38 @@ namespace rtm
 	using mask4i_arg7 = const mask4i&;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i;
+	using vector4i_arg5 = const vector4i;
+	using vector4i_arg6 = const vector4i&;
+	using vector4i_arg7 = const vector4i&;
+	using vector4i_argn = const vector4i&;
+
 	// With __vectorcall, vector aggregates are also passed by register and they can use up to 4 registers.
 
 	using qvvf_arg0 = const qvvf;
 	using qvvf_arg1 = const qvvf;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf;
+	using dualquatf_arg1 = const dualquatf;
+	using dualquatf_argn = const dualquatf&;
+
+	using qvsf_arg0 = const qvsf;
+	using qvsf_arg1 = const qvsf;
+	using qvsf_argn = const qvsf&;
+
+	using aabbf_arg0 = const aabbf;
+	using aabbf_arg1 = const aabbf;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref;
+	using spheref_arg1 = const spheref;
+	using spheref_argn = const spheref&;
+
 	using matrix3x3f_arg0 = const matrix3x3f;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -159,6 +185,16 @@ namespace rtm
 	using mask4i_arg7 = const mask4i;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i;
+	using vector4i_arg5 = const vector4i;
+	using vector4i_arg6 = const vector4i;
+	using vector4i_arg7 = const vector4i;
+	using vector4i_argn = const vector4i&;
+
 	// With ARM64 NEON, vector aggregates are also passed by register but the whole aggregate
 	// must fit in the number of registers available (e.g. we can pass 2x qvvf but not 3x).
 	// A qvvf can also be returned by register.
@@ -167,6 +203,22 @@ namespace rtm
 	using qvvf_arg1 = const qvvf;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf;
+	using dualquatf_arg1 = const dualquatf;
+	using dualquatf_argn = const dualquatf&;
+
+	using qvsf_arg0 = const qvsf;
+	using qvsf_arg1 = const qvsf;
+	using qvsf_argn = const qvsf&;
+
+	using aabbf_arg0 = const aabbf;
+	using aabbf_arg1 = const aabbf;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref;
+	using spheref_arg1 = const spheref;
+	using spheref_argn = const spheref&;
+
 	using matrix3x3f_arg0 = const matrix3x3f;
 	using matrix3x3f_arg1 = const matrix3x3f;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -232,12 +284,38 @@ namespace rtm
 	using mask4i_arg7 = const mask4i&;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i&;
+	using vector4i_arg5 = const vector4i&;
+	using vector4i_arg6 = const vector4i&;
+	using vector4i_arg7 = const vector4i&;
+	using vector4i_argn = const vector4i&;
+
 	// ARM NEON does not support passing aggregates by register.
 
 	using qvvf_arg0 = const qvvf&;
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf&;
+	using dualquatf_arg1 = const dualquatf&;
+	using dualquatf_argn = const dualquatf&;
+
+	using qvsf_arg0 = const qvsf&;
+	using qvsf_arg1 = const qvsf&;
+	using qvsf_argn = const qvsf&;
+
+	using aabbf_arg0 = const aabbf&;
+	using aabbf_arg1 = const aabbf&;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref;
+	using spheref_arg1 = const spheref;
+	using spheref_argn = const spheref&;
+
 	using matrix3x3f_arg0 = const matrix3x3f&;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -303,12 +381,38 @@ namespace rtm
 	using mask4i_arg7 = const mask4i;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i;
+	using vector4i_arg5 = const vector4i;
+	using vector4i_arg6 = const vector4i;
+	using vector4i_arg7 = const vector4i;
+	using vector4i_argn = const vector4i&;
+
 	// gcc does not appear to support passing and returning aggregates by register
 
 	using qvvf_arg0 = const qvvf&;
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf&;
+	using dualquatf_arg1 = const dualquatf&;
+	using dualquatf_argn = const dualquatf&;
+
+	using qvsf_arg0 = const qvsf&;
+	using qvsf_arg1 = const qvsf&;
+	using qvsf_argn = const qvsf&;
+
+	using aabbf_arg0 = const aabbf&;
+	using aabbf_arg1 = const aabbf&;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref;
+	using spheref_arg1 = const spheref;
+	using spheref_argn = const spheref&;
+
 	using matrix3x3f_arg0 = const matrix3x3f&;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -374,6 +478,16 @@ namespace rtm
 	using mask4i_arg7 = const mask4i;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i;
+	using vector4i_arg1 = const vector4i;
+	using vector4i_arg2 = const vector4i;
+	using vector4i_arg3 = const vector4i;
+	using vector4i_arg4 = const vector4i;
+	using vector4i_arg5 = const vector4i;
+	using vector4i_arg6 = const vector4i;
+	using vector4i_arg7 = const vector4i;
+	using vector4i_argn = const vector4i&;
+
 	// We could pass up to 2 full qvvf types by register and the rotation/translation of
 	// the third but aggregates are not returned by register.
 	// TODO: Measure the impact of this because it could potentially degrade performance
@@ -385,6 +499,22 @@ namespace rtm
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf&;
+	using dualquatf_arg1 = const dualquatf&;
+	using dualquatf_argn = const dualquatf&;
+
+	using qvsf_arg0 = const qvsf&;
+	using qvsf_arg1 = const qvsf&;
+	using qvsf_argn = const qvsf&;
+
+	using aabbf_arg0 = const aabbf&;
+	using aabbf_arg1 = const aabbf&;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref;
+	using spheref_arg1 = const spheref;
+	using spheref_argn = const spheref&;
+
 	using matrix3x3f_arg0 = const matrix3x3f&;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -448,10 +578,36 @@ namespace rtm
 	using mask4i_arg7 = const mask4i&;
 	using mask4i_argn = const mask4i&;
 
+	using vector4i_arg0 = const vector4i&;
+	using vector4i_arg1 = const vector4i&;
+	using vector4i_arg2 = const vector4i&;
+	using vector4i_arg3 = const vector4i&;
+	using vector4i_arg4 = const vector4i&;
+	using vector4i_arg5 = const vector4i&;
+	using vector4i_arg6 = const vector4i&;
+	using vector4i_arg7 = const vector4i&;
+	using vector4i_argn = const vector4i&;
+
 	using qvvf_arg0 = const qvvf&;
 	using qvvf_arg1 = const qvvf&;
 	using qvvf_argn = const qvvf&;
 
+	using dualquatf_arg0 = const dualquatf&;
+	using dualquatf_arg1 = const dualquatf&;
+	using dualquatf_argn = const dualquatf&;
+
+	using qvsf_arg0 = const qvsf&;
+	using qvsf_arg1 = const qvsf&;
+	using qvsf_argn = const qvsf&;
+
+	using aabbf_arg0 = const aabbf&;
+	using aabbf_arg1 = const aabbf&;
+	using aabbf_argn = const aabbf&;
+
+	using spheref_arg0 = const spheref&;
+	using spheref_arg1 = const spheref&;
+	using spheref_argn = const spheref&;
+
 	using matrix3x3f_arg0 = const matrix3x3f&;
 	using matrix3x3f_arg1 = const matrix3x3f&;
 	using matrix3x3f_argn = const matrix3x3f&;
@@ -464,4 +620,83 @@ namespace rtm
 	using matrix4x4f_arg1 = const matrix4x4f&;
 	using matrix4x4f_argn = const matrix4x4f&;
 #endif
+
+#if defined(RTM_AVX_INTRINSICS) && (defined(RTM_USE_VECTORCALL) || defined(__x86_64__))
+	// With AVX, vector8f/mask8f are a single register and follow the same rules as vector4f.
+	// __vectorcall has 6 registers available, x64 System V has 8 but we keep them consistent.
+	using vector8f_arg0 = const vector8f;
+	using vector8f_arg1 = const vector8f;
+	using vector8f_arg2 = const vector8f;
+	using vector8f_arg3 = const vector8f;
+	using vector8f_arg4 = const vector8f;
+	using vector8f_arg5 = const vector8f;
+	using vector8f_argn = const vector8f&;
+
+	using mask8f_arg0 = const mask8f;
+	using mask8f_arg1 = const mask8f;
+	using mask8f_arg2 = const mask8f;
+	using mask8f_arg3 = const mask8f;
+	using mask8f_arg4 = const mask8f;
+	using mask8f_arg5 = const mask8f;
+	using mask8f_argn = const mask8f&;
+#else
+	// Without AVX, vector8f/mask8f are aggregates of two halves and are passed by const&
+	using vector8f_arg0 = const vector8f&;
+	using vector8f_arg1 = const vector8f&;
+	using vector8f_arg2 = const vector8f&;
+	using vector8f_arg3 = const vector8f&;
+	using vector8f_arg4 = const vector8f&;
+	using vector8f_arg5 = const vector8f&;
+	using vector8f_argn = const vector8f&;
+
+	using mask8f_arg0 = const mask8f&;
+	using mask8f_arg1 = const mask8f&;
+	using mask8f_arg2 = const mask8f&;
+	using mask8f_arg3 = const mask8f&;
+	using mask8f_arg4 = const mask8f&;
+	using mask8f_arg5 = const mask8f&;
+	using mask8f_argn = const mask8f&;
+#endif
+
+	// The 8 wide aggregates are too large to be passed by register
+	using vector3x8f_arg0 = const vector3x8f&;
+	using vector3x8f_arg1 = const vector3x8f&;
+	using vector3x8f_arg2 = const vector3x8f&;
+	using vector3x8f_argn = const vector3x8f&;
+
+	using vector4x8f_arg0 = const vector4x8f&;
+	using vector4x8f_arg1 = const vector4x8f&;
+	using vector4x8f_arg2 = const vector4x8f&;
+	using vector4x8f_argn = const vector4x8f&;
+
+	using quat8f_arg0 = const quat8f&;
+	using quat8f_arg1 = const quat8f&;
+	using quat8f_arg2 = const quat8f&;
+	using quat8f_argn = const quat8f&;
+
+	using matrix4x4x8f_arg0 = const matrix4x4x8f&;
+	using matrix4x4x8f_arg1 = const matrix4x4x8f&;
+	using matrix4x4x8f_arg2 = const matrix4x4x8f&;
+	using matrix4x4x8f_argn = const matrix4x4x8f&;
+
+#if defined(RTM_USE_VECTORCALL) || defined(RTM_NEON64_INTRINSICS)
+	// The fixed point types wrap a single vector4i and follow the same rules as the other aggregates
+	using vector4fx_arg0 = const vector4fx;
+	using vector4fx_arg1 = const vector4fx;
+	using vector4fx_arg2 = const vector4fx;
+	using vector4fx_argn = const vector4fx&;
+
+	using quatfx_arg0 = const quatfx;
+	using quatfx_arg1 = const quatfx;
+	using quatfx_argn = const quatfx&;
+#else
+	using vector4fx_arg0 = const vector4fx&;
+	using vector4fx_arg1 = const vector4fx&;
+	using vector4fx_arg2 = const vector4fx&;
+	using vector4fx_argn = const vector4fx&;
+
+	using quatfx_arg0 = const quatfx&;
+	using quatfx_arg1 = const quatfx&;
+	using quatfx_argn = const quatfx&;
+#endif
 }
@@ -31,6 +31,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <type_traits>
 
 RTM_IMPL_FILE_PRAGMA_PUSH
 
@@ -39,8 +40,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a vector4 from all 4 components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_set(float x, float y, float z, float w) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_set(float x, float y, float z, float w) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return std::bit_cast<vector4f>(float4f{ x, y, z, w });
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_set_ps(w, z, y, x);
 #elif defined(RTM_NEON_INTRINSICS)
@@ -60,8 +65,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a vector4 from the [xyz] components and sets [w] to 0.0.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_set(float x, float y, float z) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_set(float x, float y, float z) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return std::bit_cast<vector4f>(float4f{ x, y, z, 0.0F });
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_set_ps(0.0F, z, y, x);
 #elif defined(RTM_NEON_INTRINSICS)
@@ -81,8 +90,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a vector4 from a single value for all 4 components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_set(float xyzw) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_set(float xyzw) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return std::bit_cast<vector4f>(float4f{ xyzw, xyzw, xyzw, xyzw });
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_set_ps1(xyzw);
 #elif defined(RTM_NEON_INTRINSICS)
@@ -127,7 +140,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set(double x, double y, double z, double w) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set_pd(w, z, y, x);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_set_pd(y, x), _mm_set_pd(w, z) };
 #else
 		return vector4d{ x, y, z, w };
@@ -139,7 +154,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set(double x, double y, double z) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set_pd(0.0, z, y, x);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_set_pd(y, x), _mm_set_pd(0.0, z) };
 #else
 		return vector4d{ x, y, z, 0.0 };
@@ -151,7 +168,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set(double xyzw) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set1_pd(xyzw);
+#elif defined(RTM_SSE2_INTRINSICS)
 		const __m128d xyzw_pd = _mm_set1_pd(xyzw);
 		return vector4d{ xyzw_pd, xyzw_pd };
 #else
@@ -167,7 +186,11 @@ namespace rtm
 	{
 		const __m128d xy = _mm_unpacklo_pd(x.value, y.value);
 		const __m128d zw = _mm_unpacklo_pd(z.value, w.value);
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(xy), zw, 1);
+#else
 		return vector4d{ xy, zw };
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -177,7 +200,11 @@ namespace rtm
 	{
 		const __m128d xy = _mm_unpacklo_pd(x.value, y.value);
 		const __m128d zw = _mm_unpacklo_pd(z.value, _mm_setzero_pd());
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(xy), zw, 1);
+#else
 		return vector4d{ xy, zw };
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -186,12 +213,67 @@ namespace rtm
 	inline vector4d RTM_SIMD_CALL vector_set(scalard xyzw) RTM_NO_EXCEPT
 	{
 		const __m128d xyzw_pd = _mm_shuffle_pd(xyzw.value, xyzw.value, 0);
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(xyzw_pd), xyzw_pd, 1);
+#else
 		return vector4d{ xyzw_pd, xyzw_pd };
+#endif
 	}
 #endif
 
 	namespace rtm_impl
 	{
+#if defined(RTM_SSE4_INTRINSICS) || defined(RTM_NEON64_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the byte shuffle control that moves the 32 bit lanes selected by a
+		// 4 bit mask to the front, see vector_compress_store. The remaining lanes repeat [x].
+		//////////////////////////////////////////////////////////////////////////
+		inline const uint8_t* get_compress_shuffle_control(uint32_t mask_bits) RTM_NO_EXCEPT
+		{
+			alignas(16) static const uint8_t k_controls[16][16] =
+			{
+				{ 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 },				// ----
+				{ 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 },				// x---
+				{ 4, 5, 6, 7, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 },				// -y--
+				{ 0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 0, 1, 2, 3 },				// xy--
+				{ 8, 9, 10, 11, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 },			// --z-
+				{ 0, 1, 2, 3, 8, 9, 10, 11, 0, 1, 2, 3, 0, 1, 2, 3 },			// x-z-
+				{ 4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 3, 0, 1, 2, 3 },			// -yz-
+				{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0, 1, 2, 3 },			// xyz-
+				{ 12, 13, 14, 15, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3 },			// ---w
+				{ 0, 1, 2, 3, 12, 13, 14, 15, 0, 1, 2, 3, 0, 1, 2, 3 },			// x--w
+				{ 4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3, 0, 1, 2, 3 },			// -y-w
+				{ 0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15, 0, 1, 2, 3 },			// xy-w
+				{ 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 0, 1, 2, 3 },		// --zw
+				{ 0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3 },		// x-zw
+				{ 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3 },		// -yzw
+				{ 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 },		// xyzw
+			};
+
+			return &k_controls[mask_bits & 0xF][0];
+		}
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes the values selected by a 4 bit mask contiguously without branching and
+		// returns how many were selected. Every value is written at the current offset
+		// which only advances when the value is selected.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename value_type>
+		inline uint32_t compress_store4(value_type x, value_type y, value_type z, value_type w, uint32_t mask_bits, value_type* output) RTM_NO_EXCEPT
+		{
+			uint32_t offset = 0;
+			output[offset] = x;
+			offset += mask_bits & 1;
+			output[offset] = y;
+			offset += (mask_bits >> 1) & 1;
+			output[offset] = z;
+			offset += (mask_bits >> 2) & 1;
+			output[offset] = w;
+			offset += (mask_bits >> 3) & 1;
+			return offset;
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// Returns true if mix4 component is one of [xyzw]
 		//////////////////////////////////////////////////////////////////////////
@@ -202,18 +284,38 @@ namespace rtm
 		//////////////////////////////////////////////////////////////////////////
 		constexpr bool is_mix_abcd(mix4 arg) RTM_NO_EXCEPT { return uint32_t(arg) >= uint32_t(mix4::a); }
 
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the matching [xyzw] component of a mix4 component
+		//////////////////////////////////////////////////////////////////////////
+		constexpr mix4 mix_to_xyzw(mix4 arg) RTM_NO_EXCEPT { return mix4(uint32_t(arg) % 4); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the matching [abcd] component of a mix4 component
+		//////////////////////////////////////////////////////////////////////////
+		constexpr mix4 mix_to_abcd(mix4 arg) RTM_NO_EXCEPT { return mix4((uint32_t(arg) % 4) + uint32_t(mix4::a)); }
+
+		//////////////////////////////////////////////////////////////////////////
+		// The return type of length comparison operators, only arithmetic
+		// thresholds are supported. Being a template, the operators are preferred
+		// over the built-in comparison of the coerced length regardless of the
+		// threshold type.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename threshold_type>
+		using length_comparison_result = typename std::enable_if<std::is_arithmetic<threshold_type>::value, bool>::type;
+
 		//////////////////////////////////////////////////////////////////////////
 		// This is a helper struct to help manipulate SIMD masks.
+		// Plain integer conversions are used instead of a union so that compilers
+		// can auto-vectorize the scalar code path comparisons.
 		//////////////////////////////////////////////////////////////////////////
-		union mask_converter
+		struct mask_converter
 		{
-			uint64_t u64;
-			uint32_t u32[2];
+			uint64_t value;
 
-			explicit constexpr mask_converter(uint64_t value) RTM_NO_EXCEPT : u64(value) {}
+			explicit constexpr mask_converter(uint64_t value_) RTM_NO_EXCEPT : value(value_) {}
 
-			constexpr operator uint32_t() const RTM_NO_EXCEPT { return u32[0]; }
-			constexpr operator uint64_t() const RTM_NO_EXCEPT { return u64; }
+			constexpr operator uint32_t() const RTM_NO_EXCEPT { return uint32_t(value); }
+			constexpr operator uint64_t() const RTM_NO_EXCEPT { return value; }
 		};
 
 		//////////////////////////////////////////////////////////////////////////
@@ -250,7 +352,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator vector4d() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm256_setzero_pd();
+#elif defined(RTM_SSE2_INTRINSICS)
 				const __m128d zero_pd = _mm_setzero_pd();
 				return vector4d{ zero_pd, zero_pd };
 #else
@@ -258,8 +362,12 @@ namespace rtm
 #endif
 			}
 
-			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return vector_set(0.0F);
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 				return _mm_setzero_ps();
 #else
@@ -400,7 +508,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm256_castpd256_pd128(value));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(value.xy);
 #else
 				return value.x;
@@ -410,7 +520,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm256_castpd256_pd128(value) };
+#else
 				return scalard{ value.xy };
+#endif
 			}
 #endif
 
@@ -500,7 +614,11 @@ namespace rtm
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
 #if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				__m128d xz_yw = _mm_min_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+#else
 				__m128d xz_yw = _mm_min_pd(value.xy, value.zw);
+#endif
 				__m128d yw_yw = _mm_shuffle_pd(xz_yw, xz_yw, 1);
 				return _mm_cvtsd_f64(_mm_min_pd(xz_yw, yw_yw));
 #else
@@ -511,7 +629,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				__m128d xz_yw = _mm_min_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+#else
 				__m128d xz_yw = _mm_min_pd(value.xy, value.zw);
+#endif
 				__m128d yw_yw = _mm_shuffle_pd(xz_yw, xz_yw, 1);
 				return scalard{ _mm_min_pd(xz_yw, yw_yw) };
 			}
@@ -531,7 +653,11 @@ namespace rtm
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
 #if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				__m128d xz_yw = _mm_max_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+#else
 				__m128d xz_yw = _mm_max_pd(value.xy, value.zw);
+#endif
 				__m128d yw_yw = _mm_shuffle_pd(xz_yw, xz_yw, 1);
 				return _mm_cvtsd_f64(_mm_max_pd(xz_yw, yw_yw));
 #else
@@ -542,7 +668,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				__m128d xz_yw = _mm_max_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+#else
 				__m128d xz_yw = _mm_max_pd(value.xy, value.zw);
+#endif
 				__m128d yw_yw = _mm_shuffle_pd(xz_yw, xz_yw, 1);
 				return scalard{ _mm_max_pd(xz_yw, yw_yw) };
 			}
@@ -38,11 +38,16 @@ namespace rtm
 	inline uint64_t RTM_SIMD_CALL mask_get_x(const mask4d& input) RTM_NO_EXCEPT
 	{
 #if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		const __m128d xy = _mm256_castpd256_pd128(input);
+#else
+		const __m128d xy = input.xy;
+#endif
 #if defined(_M_X64)
-		return _mm_cvtsi128_si64(_mm_castpd_si128(input.xy));
+		return _mm_cvtsi128_si64(_mm_castpd_si128(xy));
 #else
 		// Just sign extend on 32bit systems
-		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(input.xy));
+		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(xy));
 #endif
 #else
 		return input.x;
@@ -55,11 +60,16 @@ namespace rtm
 	inline uint64_t RTM_SIMD_CALL mask_get_y(const mask4d& input) RTM_NO_EXCEPT
 	{
 #if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		const __m128d xy = _mm256_castpd256_pd128(input);
+#else
+		const __m128d xy = input.xy;
+#endif
 #if defined(_M_X64)
-		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm_shuffle_pd(input.xy, input.xy, 1)));
+		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm_shuffle_pd(xy, xy, 1)));
 #else
 		// Just sign extend on 32bit systems
-		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm_shuffle_pd(input.xy, input.xy, 1)));
+		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm_shuffle_pd(xy, xy, 1)));
 #endif
 #else
 		return input.y;
@@ -72,11 +82,16 @@ namespace rtm
 	inline uint64_t RTM_SIMD_CALL mask_get_z(const mask4d& input) RTM_NO_EXCEPT
 	{
 #if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		const __m128d zw = _mm256_extractf128_pd(input, 1);
+#else
+		const __m128d zw = input.zw;
+#endif
 #if defined(_M_X64)
-		return _mm_cvtsi128_si64(_mm_castpd_si128(input.zw));
+		return _mm_cvtsi128_si64(_mm_castpd_si128(zw));
 #else
 		// Just sign extend on 32bit systems
-		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(input.zw));
+		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(zw));
 #endif
 #else
 		return input.z;
@@ -89,11 +104,16 @@ namespace rtm
 	inline uint64_t RTM_SIMD_CALL mask_get_w(const mask4d& input) RTM_NO_EXCEPT
 	{
 #if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		const __m128d zw = _mm256_extractf128_pd(input, 1);
+#else
+		const __m128d zw = input.zw;
+#endif
 #if defined(_M_X64)
-		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm_shuffle_pd(input.zw, input.zw, 1)));
+		return _mm_cvtsi128_si64(_mm_castpd_si128(_mm_shuffle_pd(zw, zw, 1)));
 #else
 		// Just sign extend on 32bit systems
-		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm_shuffle_pd(input.zw, input.zw, 1)));
+		return (uint64_t)_mm_cvtsi128_si32(_mm_castpd_si128(_mm_shuffle_pd(zw, zw, 1)));
 #endif
 #else
 		return input.w;
@@ -105,7 +125,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool RTM_SIMD_CALL mask_all_true(const mask4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(input) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		return (_mm_movemask_pd(input.xy) & _mm_movemask_pd(input.zw)) == 3;
 #else
 		return input.x != 0 && input.y != 0 && input.z != 0 && input.w != 0;
@@ -117,7 +139,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool RTM_SIMD_CALL mask_all_true2(const mask4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(input) & 0x3) == 0x3;
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_movemask_pd(input.xy) == 3;
 #else
 		return input.x != 0 && input.y != 0;
@@ -129,7 +153,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool RTM_SIMD_CALL mask_all_true3(const mask4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(input) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_movemask_pd(input.xy) == 3 && (_mm_movemask_pd(input.zw) & 1) != 0;
 #else
 		return input.x != 0 && input.y != 0 && input.z != 0;
@@ -141,7 +167,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool RTM_SIMD_CALL mask_any_true(const mask4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(input) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		return (_mm_movemask_pd(input.xy) | _mm_movemask_pd(input.zw)) != 0;
 #else
 		return input.x != 0 || input.y != 0 || input.z != 0 || input.w != 0;
@@ -153,7 +181,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool RTM_SIMD_CALL mask_any_true2(const mask4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(input) & 0x3) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_movemask_pd(input.xy) != 0;
 #else
 		return input.x != 0 || input.y != 0;
@@ -165,12 +195,38 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool RTM_SIMD_CALL mask_any_true3(const mask4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(input) & 0x7) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_movemask_pd(input.xy) != 0 || (_mm_movemask_pd(input.zw) & 1) != 0;
 #else
 		return input.x != 0 || input.y != 0 || input.z != 0;
 #endif
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the mask packed as bits, one per component: bit 0 is [x] and bit 3 is [w].
+	// Mask components must be ~0 or 0, like the result of a comparison.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_get_bits(const mask4d& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return uint32_t(_mm256_movemask_pd(input));
+#elif defined(RTM_SSE2_INTRINSICS)
+		return uint32_t(_mm_movemask_pd(input.xy) | (_mm_movemask_pd(input.zw) << 2));
+#else
+		return (input.x != 0 ? 1U : 0U) | (input.y != 0 ? 2U : 0U) | (input.z != 0 ? 4U : 0U) | (input.w != 0 ? 8U : 0U);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of true components.
+	// Mask components must be ~0 or 0, like the result of a comparison.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_count_true(const mask4d& input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::mask_bits_count(mask_get_bits(input));
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
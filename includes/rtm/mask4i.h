@@ -181,6 +181,42 @@ namespace rtm
 		return (vget_lane_u32(mask_0_8_4_12_1_9_5_13_2_10_6_14_3_11_7_15.val[0], 0) & 0x00FFFFFFU) != 0;
 #else
 		return input.x != 0 || input.y != 0 || input.z != 0;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the mask packed as bits, one per component: bit 0 is [x] and bit 3 is [w].
+	// Mask components must be ~0 or 0, like the result of a comparison.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_get_bits(mask4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return uint32_t(_mm_movemask_ps(_mm_castsi128_ps(input)));
+#elif defined(RTM_NEON_INTRINSICS)
+		const uint32_t bit_values_data[4] = { 1, 2, 4, 8 };
+		const uint32x4_t bits = vandq_u32(RTM_IMPL_MASK4i_GET(input), vld1q_u32(&bit_values_data[0]));
+#if defined(RTM_NEON64_INTRINSICS)
+		return vaddvq_u32(bits);
+#else
+		const uint32x2_t bits_xy_zw = vorr_u32(vget_low_u32(bits), vget_high_u32(bits));
+		return vget_lane_u32(bits_xy_zw, 0) | vget_lane_u32(bits_xy_zw, 1);
+#endif
+#else
+		return (input.x != 0 ? 1U : 0U) | (input.y != 0 ? 2U : 0U) | (input.z != 0 ? 4U : 0U) | (input.w != 0 ? 8U : 0U);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of true components.
+	// Mask components must be ~0 or 0, like the result of a comparison.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_count_true(mask4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_NEON64_INTRINSICS)
+		// Every true component is -1 as an integer
+		return 0U - vaddvq_u32(RTM_IMPL_MASK4i_GET(input));
+#else
+		return rtm_impl::mask_bits_count(mask_get_bits(input));
 #endif
 	}
 }
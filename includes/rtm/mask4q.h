@@ -171,6 +171,28 @@ namespace rtm
 		return input.x != 0 || input.y != 0 || input.z != 0;
 #endif
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the mask packed as bits, one per component: bit 0 is [x] and bit 3 is [w].
+	// Mask components must be ~0 or 0, like the result of a comparison.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_get_bits(const mask4q& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return uint32_t(_mm_movemask_pd(_mm_castsi128_pd(input.xy)) | (_mm_movemask_pd(_mm_castsi128_pd(input.zw)) << 2));
+#else
+		return (input.x != 0 ? 1U : 0U) | (input.y != 0 ? 2U : 0U) | (input.z != 0 ? 4U : 0U) | (input.w != 0 ? 8U : 0U);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the number of true components.
+	// Mask components must be ~0 or 0, like the result of a comparison.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_count_true(const mask4q& input) RTM_NO_EXCEPT
+	{
+		return rtm_impl::mask_bits_count(mask_get_bits(input));
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -30,11 +30,21 @@
 //////////////////////////////////////////////////////////////////////////
 
 #if !defined(RTM_NO_INTRINSICS)
+	// AVX-512 is only used by the batch functions, the types keep using AVX
+	#if defined(__AVX512F__)
+		#define RTM_AVX512_INTRINSICS
+	#endif
+
 	#if defined(__AVX2__)
 		#define RTM_AVX2_INTRINSICS
 		#define RTM_FMA_INTRINSICS
 	#endif
 
+	// MSVC does not define __F16C__, every AVX2 capable processor supports it
+	#if defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__))
+		#define RTM_F16C_INTRINSICS
+	#endif
+
 	#if defined(__AVX__)
 		#define RTM_AVX_INTRINSICS
 		#define RTM_SSE4_INTRINSICS
@@ -63,6 +73,20 @@
 		#if defined(__aarch64__) || defined(_M_ARM64)
 			#define RTM_NEON64_INTRINSICS
 		#endif
+
+		// SVE registers are sizeless, they cannot back vector4f. The types keep using NEON
+		// while the batch functions process svcntw() values at a time with predicated tails.
+		#if defined(__ARM_FEATURE_SVE)
+			#define RTM_SVE_INTRINSICS
+		#endif
+	#endif
+
+	// WebAssembly SIMD128 requires Emscripten's SSE2 support (e.g. emcc -msimd128 -msse2): the SSE2
+	// intrinsics are implemented on top of SIMD128 and the SSE2 code paths are shared. Native SIMD128
+	// code paths replace the few SSE2 intrinsics that do not map to a single SIMD128 instruction.
+	// With -msimd128 alone, the scalar implementation is used.
+	#if defined(__wasm_simd128__) && defined(__SSE2__)
+		#define RTM_WASM_SIMD128_INTRINSICS
 	#endif
 
 	// If SSE2 and NEON aren't used, we default to the scalar implementation
@@ -84,6 +108,10 @@
 	#endif
 #endif
 
+#if defined(RTM_WASM_SIMD128_INTRINSICS)
+	#include <wasm_simd128.h>
+#endif
+
 #if defined(RTM_SSE3_INTRINSICS)
 	#include <pmmintrin.h>
 #endif
@@ -92,7 +120,7 @@
 	#include <smmintrin.h>
 #endif
 
-#if defined(RTM_AVX_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS) || defined(RTM_F16C_INTRINSICS)
 	#include <immintrin.h>
 #endif
 
@@ -103,6 +131,10 @@
 	#include <arm_neon.h>
 #endif
 
+#if defined(RTM_SVE_INTRINSICS)
+	#include <arm_sve.h>
+#endif
+
 // Specify the SIMD calling convention is we can
 #if !defined(RTM_SIMD_CALL)
 	#if defined(RTM_USE_VECTORCALL)
@@ -112,6 +144,15 @@
 	#endif
 #endif
 
+// FMA intrinsics are supported with AVX2 but by default they are not used because they appear
+// slower on at least Haswell and Ryzen. Define RTM_USE_FMA to opt-in and fuse vector_mul_add,
+// vector_neg_mul_sub, and everything built on top of them (polynomials, matrix multiplication, etc).
+// GCC and Clang require FMA to be enabled explicitly (e.g. -mfma) along with AVX2.
+// Fused results differ from the non-fused ones and as such RTM_DETERMINISTIC disables them.
+#if defined(RTM_USE_FMA) && defined(RTM_FMA_INTRINSICS) && (defined(__FMA__) || defined(_MSC_VER)) && !defined(RTM_DETERMINISTIC)
+	#define RTM_IMPL_USE_FMA
+#endif
+
 // By default, we include the type definitions and error handling
 #include "rtm/impl/error.h"
 #include "rtm/types.h"
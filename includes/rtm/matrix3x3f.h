@@ -54,7 +54,7 @@ namespace rtm
 		case axis4::y: return input.y_axis;
 		case axis4::z: return input.z_axis;
 		default:
-			RTM_ASSERT(false, "Invalid matrix axis");
+			RTM_ASSERT_ASSUME(false, "Invalid matrix axis");
 			return input.x_axis;
 		}
 	}
@@ -179,65 +179,89 @@ namespace rtm
 		return matrix3x3f{ x_axis, y_axis, z_axis };
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	// Inverses a 3x3 matrix.
-	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
-	// fall back value is returned instead.
-	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x3f RTM_SIMD_CALL matrix_inverse(matrix3x3f_arg0 input, matrix3x3f_arg1 fallback, float threshold = 1.0E-8F) RTM_NO_EXCEPT
+	namespace rtm_impl
 	{
-		const vector4f v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
-		const vector4f v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses the matrix and returns the fall back value when the absolute value of
+		// its determinant is below the threshold. The comparison is done in registers.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix3x3f RTM_SIMD_CALL matrix_inverse_with_fallback(matrix3x3f_arg0 input, matrix3x3f_arg1 fallback, scalarf_arg2 threshold) RTM_NO_EXCEPT
+		{
+			const vector4f v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
+			const vector4f v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
 
-		const vector4f v00_v10_v20_v22 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(v00_v01_v10_v11, input.z_axis);
-		const vector4f v01_v11_v21_v23 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(v00_v01_v10_v11, input.z_axis);
-		const vector4f v02_v12_v22_v22 = vector_mix<mix4::x, mix4::z, mix4::c, mix4::c>(v02_v03_v12_v13, input.z_axis);
+			const vector4f v00_v10_v20_v22 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(v00_v01_v10_v11, input.z_axis);
+			const vector4f v01_v11_v21_v23 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(v00_v01_v10_v11, input.z_axis);
+			const vector4f v02_v12_v22_v22 = vector_mix<mix4::x, mix4::z, mix4::c, mix4::c>(v02_v03_v12_v13, input.z_axis);
 
-		const vector4f v11_v21_v01 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(v01_v11_v21_v23, input.x_axis);
-		const vector4f v22_v02_v12_v10 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::a>(v02_v12_v22_v22, input.y_axis);
-		const vector4f v11v22_v21v02_v01v12 = vector_mul(v11_v21_v01, v22_v02_v12_v10);
+			const vector4f v11_v21_v01 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(v01_v11_v21_v23, input.x_axis);
+			const vector4f v22_v02_v12_v10 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::a>(v02_v12_v22_v22, input.y_axis);
+			const vector4f v11v22_v21v02_v01v12 = vector_mul(v11_v21_v01, v22_v02_v12_v10);
 
-		const vector4f v01_v02_v11_v12 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.x_axis, input.y_axis);
+			const vector4f v01_v02_v11_v12 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.x_axis, input.y_axis);
 
-		const vector4f v12_v01_v11 = vector_mix<mix4::w, mix4::x, mix4::b, mix4::c>(v01_v02_v11_v12, v01_v11_v21_v23);
-		const vector4f v21_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.z_axis, v22_v02_v12_v10);
+			const vector4f v12_v01_v11 = vector_mix<mix4::w, mix4::x, mix4::b, mix4::c>(v01_v02_v11_v12, v01_v11_v21_v23);
+			const vector4f v21_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.z_axis, v22_v02_v12_v10);
 
-		vector4f x_axis = vector_neg_mul_sub(v12_v01_v11, v21_v22_v02, v11v22_v21v02_v01v12);
+			vector4f x_axis = vector_neg_mul_sub(v12_v01_v11, v21_v22_v02, v11v22_v21v02_v01v12);
 
-		const vector4f v20_v00_v10_v22 = vector_mix<mix4::z, mix4::x, mix4::d, mix4::a>(v00_v10_v20_v22, v22_v02_v12_v10);
-		const vector4f v12_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v02_v12_v22_v22, v21_v22_v02);
-		const vector4f v20v12_v00v22_v10v02 = vector_mul(v20_v00_v10_v22, v12_v22_v02);
+			const vector4f v20_v00_v10_v22 = vector_mix<mix4::z, mix4::x, mix4::d, mix4::a>(v00_v10_v20_v22, v22_v02_v12_v10);
+			const vector4f v12_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v02_v12_v22_v22, v21_v22_v02);
+			const vector4f v20v12_v00v22_v10v02 = vector_mul(v20_v00_v10_v22, v12_v22_v02);
 
-		const vector4f v10_v02_v00 = vector_mix<mix4::w, mix4::y, mix4::b, mix4::c>(v22_v02_v12_v10, v20_v00_v10_v22);
-		const vector4f v22_v20_v12 = vector_mix<mix4::w, mix4::x, mix4::a, mix4::c>(v20_v00_v10_v22, v12_v22_v02);
+			const vector4f v10_v02_v00 = vector_mix<mix4::w, mix4::y, mix4::b, mix4::c>(v22_v02_v12_v10, v20_v00_v10_v22);
+			const vector4f v22_v20_v12 = vector_mix<mix4::w, mix4::x, mix4::a, mix4::c>(v20_v00_v10_v22, v12_v22_v02);
 
-		vector4f y_axis = vector_neg_mul_sub(v10_v02_v00, v22_v20_v12, v20v12_v00v22_v10v02);
+			vector4f y_axis = vector_neg_mul_sub(v10_v02_v00, v22_v20_v12, v20v12_v00v22_v10v02);
 
-		const vector4f v10_v20_v00 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::c>(v20_v00_v10_v22, v10_v02_v00);
-		const vector4f v21_v01_v11 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v11_v21_v01, v12_v01_v11);
-		const vector4f v10v21_v20v01_v00v11 = vector_mul(v10_v20_v00, v21_v01_v11);
+			const vector4f v10_v20_v00 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::c>(v20_v00_v10_v22, v10_v02_v00);
+			const vector4f v21_v01_v11 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v11_v21_v01, v12_v01_v11);
+			const vector4f v10v21_v20v01_v00v11 = vector_mul(v10_v20_v00, v21_v01_v11);
 
-		const vector4f v20_v00_v01 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v10_v20_v00, v11_v21_v01);
-		const vector4f v11_v21_v10 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::c>(v11_v21_v01, v10_v20_v00);
+			const vector4f v20_v00_v01 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v10_v20_v00, v11_v21_v01);
+			const vector4f v11_v21_v10 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::c>(v11_v21_v01, v10_v20_v00);
 
-		vector4f z_axis = vector_neg_mul_sub(v20_v00_v01, v11_v21_v10, v10v21_v20v01_v00v11);
+			vector4f z_axis = vector_neg_mul_sub(v20_v00_v01, v11_v21_v10, v10v21_v20v01_v00v11);
 
-		const vector4f o00_o00_o10_o10 = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(x_axis, y_axis);
-		const vector4f o00_o10_o20 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::a>(o00_o00_o10_o10, z_axis);
+			const vector4f o00_o00_o10_o10 = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(x_axis, y_axis);
+			const vector4f o00_o10_o20 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::a>(o00_o00_o10_o10, z_axis);
 
-		const scalarf det = vector_dot3(o00_o10_o20, input.x_axis);
-		if (scalar_cast(scalar_abs(det)) < threshold)
-			return fallback;
+			const scalarf det = vector_dot3(o00_o10_o20, input.x_axis);
+			if (scalar_lower_than(scalar_abs(det), threshold))
+				return fallback;
 
-		const vector4f inv_det = vector_set(scalar_reciprocal(det));
+			const vector4f inv_det = vector_set(scalar_reciprocal(det));
 
-		x_axis = vector_mul(x_axis, inv_det);
-		y_axis = vector_mul(y_axis, inv_det);
-		z_axis = vector_mul(z_axis, inv_det);
+			x_axis = vector_mul(x_axis, inv_det);
+			y_axis = vector_mul(y_axis, inv_det);
+			z_axis = vector_mul(z_axis, inv_det);
 
-		return matrix3x3f{ x_axis, y_axis, z_axis };
+			return matrix3x3f{ x_axis, y_axis, z_axis };
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x3 matrix.
+	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
+	// fall back value is returned instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x3f RTM_SIMD_CALL matrix_inverse(matrix3x3f_arg0 input, matrix3x3f_arg1 fallback, float threshold = 1.0E-8F) RTM_NO_EXCEPT
+	{
+		return rtm_impl::matrix_inverse_with_fallback(input, fallback, scalar_set(threshold));
 	}
 
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x3 matrix.
+	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
+	// fall back value is returned instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x3f RTM_SIMD_CALL matrix_inverse(matrix3x3f_arg0 input, matrix3x3f_arg1 fallback, scalarf_arg2 threshold) RTM_NO_EXCEPT
+	{
+		return rtm_impl::matrix_inverse_with_fallback(input, fallback, threshold);
+	}
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the determinant of the input 3x3 matrix.
 	//////////////////////////////////////////////////////////////////////////
@@ -380,6 +404,36 @@ namespace rtm
 		result.z_axis = vector_normalize3(input.z_axis, input.z_axis);
 		return result;
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orthonormalizes the rotation part of a 3x3 matrix with Gram-Schmidt.
+	// This is the cheapest way to remove the drift and skew that accumulate when matrices
+	// are composed repeatedly. The X axis is kept as is (normalized), the Y axis is made
+	// orthogonal to it, and the Z axis is rebuilt from both while retaining its sign
+	// such that reflections are preserved.
+	// Use it before quat_from_matrix when the input might be skewed.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x3f RTM_SIMD_CALL matrix_orthonormalize(matrix3x3f_arg0 input) RTM_NO_EXCEPT
+	{
+		matrix3x3f result;
+		rtm_impl::matrix_orthonormalize(input.x_axis, input.y_axis, input.z_axis, result.x_axis, result.y_axis, result.z_axis);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orthonormalizes the rotation part of a 3x3 matrix with its polar decomposition.
+	// The result is the closest orthogonal matrix to the input: unlike Gram-Schmidt, the error
+	// is distributed evenly over every axis and any scale or shear is removed.
+	// It is computed with a scaled Newton iteration which typically converges in 3 to 6 iterations.
+	// If the determinant is negative, the result retains the reflection.
+	// If the matrix is singular, this falls back to Gram-Schmidt.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x3f RTM_SIMD_CALL matrix_orthonormalize_polar(matrix3x3f_arg0 input, uint32_t max_iterations = 8) RTM_NO_EXCEPT
+	{
+		matrix3x3f result;
+		rtm_impl::matrix_orthonormalize_polar(input.x_axis, input.y_axis, input.z_axis, max_iterations, result.x_axis, result.y_axis, result.z_axis);
+		return result;
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
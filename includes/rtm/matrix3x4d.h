@@ -251,70 +251,123 @@ namespace rtm
 		return matrix3x4d{ x_axis, y_axis, z_axis, w_axis };
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	// Inverses a 3x4 affine matrix.
-	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
-	// fall back value is returned instead.
-	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4d matrix_inverse(const matrix3x4d& input, const matrix3x4d& fallback, double threshold = 1.0E-8) RTM_NO_EXCEPT
+	namespace rtm_impl
 	{
-		// Invert the 3x3 portion of the matrix that contains the rotation and 3D scale
-		const vector4d v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
-		const vector4d v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses the matrix and returns the fall back value when the absolute value of
+		// its determinant is below the threshold. The comparison is done in registers.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix3x4d matrix_inverse_with_fallback(const matrix3x4d& input, const matrix3x4d& fallback, const scalard& threshold) RTM_NO_EXCEPT
+		{
+			// Invert the 3x3 portion of the matrix that contains the rotation and 3D scale
+			const vector4d v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
+			const vector4d v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
 
-		const vector4d v00_v10_v20_v22 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(v00_v01_v10_v11, input.z_axis);
-		const vector4d v01_v11_v21_v23 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(v00_v01_v10_v11, input.z_axis);
-		const vector4d v02_v12_v22_v22 = vector_mix<mix4::x, mix4::z, mix4::c, mix4::c>(v02_v03_v12_v13, input.z_axis);
+			const vector4d v00_v10_v20_v22 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(v00_v01_v10_v11, input.z_axis);
+			const vector4d v01_v11_v21_v23 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(v00_v01_v10_v11, input.z_axis);
+			const vector4d v02_v12_v22_v22 = vector_mix<mix4::x, mix4::z, mix4::c, mix4::c>(v02_v03_v12_v13, input.z_axis);
 
-		const vector4d v11_v21_v01 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(v01_v11_v21_v23, input.x_axis);
-		const vector4d v22_v02_v12_v10 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::a>(v02_v12_v22_v22, input.y_axis);
-		const vector4d v11v22_v21v02_v01v12 = vector_mul(v11_v21_v01, v22_v02_v12_v10);
+			const vector4d v11_v21_v01 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(v01_v11_v21_v23, input.x_axis);
+			const vector4d v22_v02_v12_v10 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::a>(v02_v12_v22_v22, input.y_axis);
+			const vector4d v11v22_v21v02_v01v12 = vector_mul(v11_v21_v01, v22_v02_v12_v10);
 
-		const vector4d v01_v02_v11_v12 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.x_axis, input.y_axis);
+			const vector4d v01_v02_v11_v12 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.x_axis, input.y_axis);
 
-		const vector4d v12_v01_v11 = vector_mix<mix4::w, mix4::x, mix4::b, mix4::c>(v01_v02_v11_v12, v01_v11_v21_v23);
-		const vector4d v21_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.z_axis, v22_v02_v12_v10);
+			const vector4d v12_v01_v11 = vector_mix<mix4::w, mix4::x, mix4::b, mix4::c>(v01_v02_v11_v12, v01_v11_v21_v23);
+			const vector4d v21_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.z_axis, v22_v02_v12_v10);
 
-		vector4d x_axis = vector_neg_mul_sub(v12_v01_v11, v21_v22_v02, v11v22_v21v02_v01v12);
+			vector4d x_axis = vector_neg_mul_sub(v12_v01_v11, v21_v22_v02, v11v22_v21v02_v01v12);
 
-		const vector4d v20_v00_v10_v22 = vector_mix<mix4::z, mix4::x, mix4::d, mix4::a>(v00_v10_v20_v22, v22_v02_v12_v10);
-		const vector4d v12_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v02_v12_v22_v22, v21_v22_v02);
-		const vector4d v20v12_v00v22_v10v02 = vector_mul(v20_v00_v10_v22, v12_v22_v02);
+			const vector4d v20_v00_v10_v22 = vector_mix<mix4::z, mix4::x, mix4::d, mix4::a>(v00_v10_v20_v22, v22_v02_v12_v10);
+			const vector4d v12_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v02_v12_v22_v22, v21_v22_v02);
+			const vector4d v20v12_v00v22_v10v02 = vector_mul(v20_v00_v10_v22, v12_v22_v02);
 
-		const vector4d v10_v02_v00 = vector_mix<mix4::w, mix4::y, mix4::b, mix4::c>(v22_v02_v12_v10, v20_v00_v10_v22);
-		const vector4d v22_v20_v12 = vector_mix<mix4::w, mix4::x, mix4::a, mix4::c>(v20_v00_v10_v22, v12_v22_v02);
+			const vector4d v10_v02_v00 = vector_mix<mix4::w, mix4::y, mix4::b, mix4::c>(v22_v02_v12_v10, v20_v00_v10_v22);
+			const vector4d v22_v20_v12 = vector_mix<mix4::w, mix4::x, mix4::a, mix4::c>(v20_v00_v10_v22, v12_v22_v02);
 
-		vector4d y_axis = vector_neg_mul_sub(v10_v02_v00, v22_v20_v12, v20v12_v00v22_v10v02);
+			vector4d y_axis = vector_neg_mul_sub(v10_v02_v00, v22_v20_v12, v20v12_v00v22_v10v02);
 
-		const vector4d v10_v20_v00 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::c>(v20_v00_v10_v22, v10_v02_v00);
-		const vector4d v21_v01_v11 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v11_v21_v01, v12_v01_v11);
-		const vector4d v10v21_v20v01_v00v11 = vector_mul(v10_v20_v00, v21_v01_v11);
+			const vector4d v10_v20_v00 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::c>(v20_v00_v10_v22, v10_v02_v00);
+			const vector4d v21_v01_v11 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v11_v21_v01, v12_v01_v11);
+			const vector4d v10v21_v20v01_v00v11 = vector_mul(v10_v20_v00, v21_v01_v11);
 
-		const vector4d v20_v00_v01 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v10_v20_v00, v11_v21_v01);
-		const vector4d v11_v21_v10 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::c>(v11_v21_v01, v10_v20_v00);
+			const vector4d v20_v00_v01 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v10_v20_v00, v11_v21_v01);
+			const vector4d v11_v21_v10 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::c>(v11_v21_v01, v10_v20_v00);
 
-		vector4d z_axis = vector_neg_mul_sub(v20_v00_v01, v11_v21_v10, v10v21_v20v01_v00v11);
+			vector4d z_axis = vector_neg_mul_sub(v20_v00_v01, v11_v21_v10, v10v21_v20v01_v00v11);
 
-		const vector4d o00_o00_o10_o10 = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(x_axis, y_axis);
-		const vector4d o00_o10_o20 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::a>(o00_o00_o10_o10, z_axis);
+			const vector4d o00_o00_o10_o10 = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(x_axis, y_axis);
+			const vector4d o00_o10_o20 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::a>(o00_o00_o10_o10, z_axis);
 
-		const scalard det = vector_dot3(o00_o10_o20, input.x_axis);
-		if (scalar_cast(scalar_abs(det)) < threshold)
-			return fallback;
+			const scalard det = vector_dot3(o00_o10_o20, input.x_axis);
+			if (scalar_lower_than(scalar_abs(det), threshold))
+				return fallback;
 
-		const scalard inv_det_s = scalar_reciprocal(det);
-		const vector4d inv_det = vector_set(inv_det_s);
+			const scalard inv_det_s = scalar_reciprocal(det);
+			const vector4d inv_det = vector_set(inv_det_s);
 
-		x_axis = vector_mul(x_axis, inv_det);
-		y_axis = vector_mul(y_axis, inv_det);
-		z_axis = vector_mul(z_axis, inv_det);
+			x_axis = vector_mul(x_axis, inv_det);
+			y_axis = vector_mul(y_axis, inv_det);
+			z_axis = vector_mul(z_axis, inv_det);
 
-		// Invert the translation
-		const vector4d tmp0 = vector_mul(vector_dup_z(input.w_axis), z_axis);
-		const vector4d tmp1 = vector_mul_add(vector_dup_y(input.w_axis), y_axis, tmp0);
-		vector4d w_axis = vector_neg(vector_mul_add(vector_dup_x(input.w_axis), x_axis, tmp1));
+			// Invert the translation
+			const vector4d tmp0 = vector_mul(vector_dup_z(input.w_axis), z_axis);
+			const vector4d tmp1 = vector_mul_add(vector_dup_y(input.w_axis), y_axis, tmp0);
+			vector4d w_axis = vector_neg(vector_mul_add(vector_dup_x(input.w_axis), x_axis, tmp1));
 
-		return matrix3x4d{ x_axis, y_axis, z_axis, w_axis };
+			return matrix3x4d{ x_axis, y_axis, z_axis, w_axis };
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x4 affine matrix.
+	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
+	// fall back value is returned instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4d matrix_inverse(const matrix3x4d& input, const matrix3x4d& fallback, double threshold = 1.0E-8) RTM_NO_EXCEPT
+	{
+		return rtm_impl::matrix_inverse_with_fallback(input, fallback, scalar_set(threshold));
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x4 affine matrix.
+	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
+	// fall back value is returned instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4d matrix_inverse(const matrix3x4d& input, const matrix3x4d& fallback, const scalard& threshold) RTM_NO_EXCEPT
+	{
+		return rtm_impl::matrix_inverse_with_fallback(input, fallback, threshold);
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x4 affine matrix that only contains a rotation and a translation.
+	// This is much cheaper than matrix_inverse(..): the rotation is transposed
+	// and the translation is rotated back and negated.
+	// If the input matrix has scale, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4d matrix_inverse_rigid(const matrix3x4d& input) RTM_NO_EXCEPT
+	{
+		matrix3x4d result;
+		rtm_impl::matrix_inverse_orthogonal(input.x_axis, input.y_axis, input.z_axis, input.w_axis, vector_set(1.0), result.x_axis, result.y_axis, result.z_axis, result.w_axis);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x4 affine matrix that contains a rotation, a uniform scale, and a translation.
+	// This is much cheaper than matrix_inverse(..): the scaled rotation is transposed
+	// and divided by the squared scale.
+	// If the input matrix has non-uniform or zero scale, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4d matrix_inverse_uniform_scale(const matrix3x4d& input) RTM_NO_EXCEPT
+	{
+		const scalard scale_sq = vector_length_squared3(input.x_axis);
+		const vector4d inv_scale_sq = vector_set(scalar_reciprocal(scale_sq));
+
+		matrix3x4d result;
+		rtm_impl::matrix_inverse_orthogonal(input.x_axis, input.y_axis, input.z_axis, input.w_axis, inv_scale_sq, result.x_axis, result.y_axis, result.z_axis, result.w_axis);
+		return result;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
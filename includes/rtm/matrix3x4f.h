@@ -40,7 +40,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Converts a rotation 3x3 matrix into a 3x4 affine matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4f RTM_SIMD_CALL matrix_from_rotation(matrix3x3f_arg0 rotation) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL matrix3x4f RTM_SIMD_CALL matrix_from_rotation(matrix3x3f_arg0 rotation) RTM_NO_EXCEPT
 	{
 		return matrix3x4f{ rotation.x_axis, rotation.y_axis, rotation.z_axis, vector_zero() };
 	}
@@ -48,7 +48,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Converts a translation vector into a 3x4 affine matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4f RTM_SIMD_CALL matrix_from_translation(vector4f_arg0 translation) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL matrix3x4f RTM_SIMD_CALL matrix_from_translation(vector4f_arg0 translation) RTM_NO_EXCEPT
 	{
 		return matrix3x4f{ vector_set(1.0F, 0.0F, 0.0F, 0.0F), vector_set(0.0F, 1.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F, 0.0F), translation };
 	}
@@ -56,7 +56,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Sets a 3x4 affine matrix from a rotation quaternion, translation, and 3D scale.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4f RTM_SIMD_CALL matrix_from_qvv(quatf_arg0 quat, vector4f_arg1 translation, vector4f_arg2 scale) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL matrix3x4f RTM_SIMD_CALL matrix_from_qvv(quatf_arg0 quat, vector4f_arg1 translation, vector4f_arg2 scale) RTM_NO_EXCEPT
 	{
 		RTM_ASSERT(quat_is_normalized(quat), "Quaternion is not normalized");
 
@@ -86,7 +86,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Converts a QVV transform into a 3x4 affine matrix.
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4f RTM_SIMD_CALL matrix_from_qvv(qvvf_arg0 transform) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL matrix3x4f RTM_SIMD_CALL matrix_from_qvv(qvvf_arg0 transform) RTM_NO_EXCEPT
 	{
 		return matrix_from_qvv(transform.rotation, transform.translation, transform.scale);
 	}
@@ -111,7 +111,7 @@ namespace rtm
 	// Multiplies two 3x4 affine matrices.
 	// Multiplication order is as follow: local_to_world = matrix_mul(local_to_object, object_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4f RTM_SIMD_CALL matrix_mul(matrix3x4f_arg0 lhs, matrix3x4f_arg1 rhs) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL matrix3x4f RTM_SIMD_CALL matrix_mul(matrix3x4f_arg0 lhs, matrix3x4f_arg1 rhs) RTM_NO_EXCEPT
 	{
 		vector4f tmp = vector_mul(vector_dup_x(lhs.x_axis), rhs.x_axis);
 		tmp = vector_mul_add(vector_dup_y(lhs.x_axis), rhs.y_axis, tmp);
@@ -139,7 +139,7 @@ namespace rtm
 	// Multiplies a 3x4 affine matrix and a 3D point.
 	// Multiplication order is as follow: world_position = matrix_mul(local_position, local_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL matrix_mul_point3(vector4f_arg0 point, matrix3x4f_arg0 mtx) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL matrix_mul_point3(vector4f_arg0 point, matrix3x4f_arg0 mtx) RTM_NO_EXCEPT
 	{
 		vector4f tmp0;
 		vector4f tmp1;
@@ -158,7 +158,7 @@ namespace rtm
 	// is to multiply the normal with the cofactor matrix of the 3x3 rotation/scale part.
 	// See: https://github.com/graphitemaster/normals_revisited
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL matrix_mul_vector3(vector4f_arg0 vec3, matrix3x4f_arg0 mtx) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL matrix_mul_vector3(vector4f_arg0 vec3, matrix3x4f_arg0 mtx) RTM_NO_EXCEPT
 	{
 		vector4f tmp;
 
@@ -251,70 +251,123 @@ namespace rtm
 		return matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
 	}
 
-	//////////////////////////////////////////////////////////////////////////
-	// Inverses a 3x4 affine matrix.
-	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
-	// fall back value is returned instead.
-	//////////////////////////////////////////////////////////////////////////
-	inline matrix3x4f RTM_SIMD_CALL matrix_inverse(matrix3x4f_arg0 input, matrix3x4f_arg1 fallback, float threshold = 1.0E-8F) RTM_NO_EXCEPT
+	namespace rtm_impl
 	{
-		// Invert the 3x3 portion of the matrix that contains the rotation and 3D scale
-		const vector4f v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
-		const vector4f v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses the matrix and returns the fall back value when the absolute value of
+		// its determinant is below the threshold. The comparison is done in registers.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix3x4f RTM_SIMD_CALL matrix_inverse_with_fallback(matrix3x4f_arg0 input, matrix3x4f_arg1 fallback, scalarf_arg2 threshold) RTM_NO_EXCEPT
+		{
+			// Invert the 3x3 portion of the matrix that contains the rotation and 3D scale
+			const vector4f v00_v01_v10_v11 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(input.x_axis, input.y_axis);
+			const vector4f v02_v03_v12_v13 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(input.x_axis, input.y_axis);
 
-		const vector4f v00_v10_v20_v22 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(v00_v01_v10_v11, input.z_axis);
-		const vector4f v01_v11_v21_v23 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(v00_v01_v10_v11, input.z_axis);
-		const vector4f v02_v12_v22_v22 = vector_mix<mix4::x, mix4::z, mix4::c, mix4::c>(v02_v03_v12_v13, input.z_axis);
+			const vector4f v00_v10_v20_v22 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(v00_v01_v10_v11, input.z_axis);
+			const vector4f v01_v11_v21_v23 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(v00_v01_v10_v11, input.z_axis);
+			const vector4f v02_v12_v22_v22 = vector_mix<mix4::x, mix4::z, mix4::c, mix4::c>(v02_v03_v12_v13, input.z_axis);
 
-		const vector4f v11_v21_v01 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(v01_v11_v21_v23, input.x_axis);
-		const vector4f v22_v02_v12_v10 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::a>(v02_v12_v22_v22, input.y_axis);
-		const vector4f v11v22_v21v02_v01v12 = vector_mul(v11_v21_v01, v22_v02_v12_v10);
+			const vector4f v11_v21_v01 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(v01_v11_v21_v23, input.x_axis);
+			const vector4f v22_v02_v12_v10 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::a>(v02_v12_v22_v22, input.y_axis);
+			const vector4f v11v22_v21v02_v01v12 = vector_mul(v11_v21_v01, v22_v02_v12_v10);
 
-		const vector4f v01_v02_v11_v12 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.x_axis, input.y_axis);
+			const vector4f v01_v02_v11_v12 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.x_axis, input.y_axis);
 
-		const vector4f v12_v01_v11 = vector_mix<mix4::w, mix4::x, mix4::b, mix4::c>(v01_v02_v11_v12, v01_v11_v21_v23);
-		const vector4f v21_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.z_axis, v22_v02_v12_v10);
+			const vector4f v12_v01_v11 = vector_mix<mix4::w, mix4::x, mix4::b, mix4::c>(v01_v02_v11_v12, v01_v11_v21_v23);
+			const vector4f v21_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::b, mix4::c>(input.z_axis, v22_v02_v12_v10);
 
-		vector4f x_axis = vector_neg_mul_sub(v12_v01_v11, v21_v22_v02, v11v22_v21v02_v01v12);
+			vector4f x_axis = vector_neg_mul_sub(v12_v01_v11, v21_v22_v02, v11v22_v21v02_v01v12);
 
-		const vector4f v20_v00_v10_v22 = vector_mix<mix4::z, mix4::x, mix4::d, mix4::a>(v00_v10_v20_v22, v22_v02_v12_v10);
-		const vector4f v12_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v02_v12_v22_v22, v21_v22_v02);
-		const vector4f v20v12_v00v22_v10v02 = vector_mul(v20_v00_v10_v22, v12_v22_v02);
+			const vector4f v20_v00_v10_v22 = vector_mix<mix4::z, mix4::x, mix4::d, mix4::a>(v00_v10_v20_v22, v22_v02_v12_v10);
+			const vector4f v12_v22_v02 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v02_v12_v22_v22, v21_v22_v02);
+			const vector4f v20v12_v00v22_v10v02 = vector_mul(v20_v00_v10_v22, v12_v22_v02);
 
-		const vector4f v10_v02_v00 = vector_mix<mix4::w, mix4::y, mix4::b, mix4::c>(v22_v02_v12_v10, v20_v00_v10_v22);
-		const vector4f v22_v20_v12 = vector_mix<mix4::w, mix4::x, mix4::a, mix4::c>(v20_v00_v10_v22, v12_v22_v02);
+			const vector4f v10_v02_v00 = vector_mix<mix4::w, mix4::y, mix4::b, mix4::c>(v22_v02_v12_v10, v20_v00_v10_v22);
+			const vector4f v22_v20_v12 = vector_mix<mix4::w, mix4::x, mix4::a, mix4::c>(v20_v00_v10_v22, v12_v22_v02);
 
-		vector4f y_axis = vector_neg_mul_sub(v10_v02_v00, v22_v20_v12, v20v12_v00v22_v10v02);
+			vector4f y_axis = vector_neg_mul_sub(v10_v02_v00, v22_v20_v12, v20v12_v00v22_v10v02);
 
-		const vector4f v10_v20_v00 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::c>(v20_v00_v10_v22, v10_v02_v00);
-		const vector4f v21_v01_v11 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v11_v21_v01, v12_v01_v11);
-		const vector4f v10v21_v20v01_v00v11 = vector_mul(v10_v20_v00, v21_v01_v11);
+			const vector4f v10_v20_v00 = vector_mix<mix4::z, mix4::x, mix4::c, mix4::c>(v20_v00_v10_v22, v10_v02_v00);
+			const vector4f v21_v01_v11 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v11_v21_v01, v12_v01_v11);
+			const vector4f v10v21_v20v01_v00v11 = vector_mul(v10_v20_v00, v21_v01_v11);
 
-		const vector4f v20_v00_v01 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v10_v20_v00, v11_v21_v01);
-		const vector4f v11_v21_v10 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::c>(v11_v21_v01, v10_v20_v00);
+			const vector4f v20_v00_v01 = vector_mix<mix4::y, mix4::z, mix4::c, mix4::c>(v10_v20_v00, v11_v21_v01);
+			const vector4f v11_v21_v10 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::c>(v11_v21_v01, v10_v20_v00);
 
-		vector4f z_axis = vector_neg_mul_sub(v20_v00_v01, v11_v21_v10, v10v21_v20v01_v00v11);
+			vector4f z_axis = vector_neg_mul_sub(v20_v00_v01, v11_v21_v10, v10v21_v20v01_v00v11);
 
-		const vector4f o00_o00_o10_o10 = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(x_axis, y_axis);
-		const vector4f o00_o10_o20 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::a>(o00_o00_o10_o10, z_axis);
+			const vector4f o00_o00_o10_o10 = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(x_axis, y_axis);
+			const vector4f o00_o10_o20 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::a>(o00_o00_o10_o10, z_axis);
 
-		const scalarf det = vector_dot3(o00_o10_o20, input.x_axis);
-		if (scalar_cast(scalar_abs(det)) < threshold)
-			return fallback;
+			const scalarf det = vector_dot3(o00_o10_o20, input.x_axis);
+			if (scalar_lower_than(scalar_abs(det), threshold))
+				return fallback;
 
-		const scalarf inv_det_s = scalar_reciprocal(det);
-		const vector4f inv_det = vector_set(inv_det_s);
+			const scalarf inv_det_s = scalar_reciprocal(det);
+			const vector4f inv_det = vector_set(inv_det_s);
 
-		x_axis = vector_mul(x_axis, inv_det);
-		y_axis = vector_mul(y_axis, inv_det);
-		z_axis = vector_mul(z_axis, inv_det);
+			x_axis = vector_mul(x_axis, inv_det);
+			y_axis = vector_mul(y_axis, inv_det);
+			z_axis = vector_mul(z_axis, inv_det);
 
-		// Invert the translation
-		const vector4f tmp0 = vector_mul(vector_dup_z(input.w_axis), z_axis);
-		const vector4f tmp1 = vector_mul_add(vector_dup_y(input.w_axis), y_axis, tmp0);
-		vector4f w_axis = vector_neg(vector_mul_add(vector_dup_x(input.w_axis), x_axis, tmp1));
+			// Invert the translation
+			const vector4f tmp0 = vector_mul(vector_dup_z(input.w_axis), z_axis);
+			const vector4f tmp1 = vector_mul_add(vector_dup_y(input.w_axis), y_axis, tmp0);
+			vector4f w_axis = vector_neg(vector_mul_add(vector_dup_x(input.w_axis), x_axis, tmp1));
 
-		return matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
+			return matrix3x4f{ x_axis, y_axis, z_axis, w_axis };
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x4 affine matrix.
+	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
+	// fall back value is returned instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f RTM_SIMD_CALL matrix_inverse(matrix3x4f_arg0 input, matrix3x4f_arg1 fallback, float threshold = 1.0E-8F) RTM_NO_EXCEPT
+	{
+		return rtm_impl::matrix_inverse_with_fallback(input, fallback, scalar_set(threshold));
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x4 affine matrix.
+	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
+	// fall back value is returned instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f RTM_SIMD_CALL matrix_inverse(matrix3x4f_arg0 input, matrix3x4f_arg1 fallback, scalarf_arg2 threshold) RTM_NO_EXCEPT
+	{
+		return rtm_impl::matrix_inverse_with_fallback(input, fallback, threshold);
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x4 affine matrix that only contains a rotation and a translation.
+	// This is much cheaper than matrix_inverse(..): the rotation is transposed
+	// and the translation is rotated back and negated.
+	// If the input matrix has scale, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f RTM_SIMD_CALL matrix_inverse_rigid(matrix3x4f_arg0 input) RTM_NO_EXCEPT
+	{
+		matrix3x4f result;
+		rtm_impl::matrix_inverse_orthogonal(input.x_axis, input.y_axis, input.z_axis, input.w_axis, vector_set(1.0F), result.x_axis, result.y_axis, result.z_axis, result.w_axis);
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 3x4 affine matrix that contains a rotation, a uniform scale, and a translation.
+	// This is much cheaper than matrix_inverse(..): the scaled rotation is transposed
+	// and divided by the squared scale.
+	// If the input matrix has non-uniform or zero scale, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f RTM_SIMD_CALL matrix_inverse_uniform_scale(matrix3x4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const scalarf scale_sq = vector_length_squared3(input.x_axis);
+		const vector4f inv_scale_sq = vector_set(scalar_reciprocal(scale_sq));
+
+		matrix3x4f result;
+		rtm_impl::matrix_inverse_orthogonal(input.x_axis, input.y_axis, input.z_axis, input.w_axis, inv_scale_sq, result.x_axis, result.y_axis, result.z_axis, result.w_axis);
+		return result;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -460,6 +513,38 @@ namespace rtm
 		result.w_axis = input.w_axis;
 		return result;
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orthonormalizes the rotation part of a 3x4 affine matrix with Gram-Schmidt. The translation is retained.
+	// This is the cheapest way to remove the drift and skew that accumulate when matrices
+	// are composed repeatedly. The X axis is kept as is (normalized), the Y axis is made
+	// orthogonal to it, and the Z axis is rebuilt from both while retaining its sign
+	// such that reflections are preserved.
+	// Use it before quat_from_matrix when the input might be skewed.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f RTM_SIMD_CALL matrix_orthonormalize(matrix3x4f_arg0 input) RTM_NO_EXCEPT
+	{
+		matrix3x4f result;
+		rtm_impl::matrix_orthonormalize(input.x_axis, input.y_axis, input.z_axis, result.x_axis, result.y_axis, result.z_axis);
+		result.w_axis = input.w_axis;
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Orthonormalizes the rotation part of a 3x4 affine matrix with its polar decomposition. The translation is retained.
+	// The result is the closest orthogonal matrix to the input: unlike Gram-Schmidt, the error
+	// is distributed evenly over every axis and any scale or shear is removed.
+	// It is computed with a scaled Newton iteration which typically converges in 3 to 6 iterations.
+	// If the determinant is negative, the result retains the reflection.
+	// If the matrix is singular, this falls back to Gram-Schmidt.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4f RTM_SIMD_CALL matrix_orthonormalize_polar(matrix3x4f_arg0 input, uint32_t max_iterations = 8) RTM_NO_EXCEPT
+	{
+		matrix3x4f result;
+		rtm_impl::matrix_orthonormalize_polar(input.x_axis, input.y_axis, input.z_axis, max_iterations, result.x_axis, result.y_axis, result.z_axis);
+		result.w_axis = input.w_axis;
+		return result;
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
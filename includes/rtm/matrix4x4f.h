@@ -29,6 +29,7 @@
 #include "rtm/vector4f.h"
 #include "rtm/impl/compiler_utils.h"
 #include "rtm/impl/matrix_common.h"
+#include "rtm/impl/matrix_affine_common.h"
 
 RTM_IMPL_FILE_PRAGMA_PUSH
 
@@ -197,6 +198,105 @@ namespace rtm
 		return matrix4x4f{ x_axis, y_axis, z_axis, w_axis };
 	}
 
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses the matrix and returns the fall back value when the absolute value of
+		// its determinant is below the threshold. The comparison is done in registers.
+		//////////////////////////////////////////////////////////////////////////
+		inline matrix4x4f RTM_SIMD_CALL matrix_inverse_with_fallback(matrix4x4f_arg0 input, matrix4x4f_arg1 fallback, scalarf_arg2 threshold) RTM_NO_EXCEPT
+		{
+			matrix4x4f input_transposed = matrix_transpose(input);
+
+			vector4f v00 = vector_mix<mix4::x, mix4::x, mix4::y, mix4::y>(input_transposed.z_axis, input_transposed.z_axis);
+			vector4f v01 = vector_mix<mix4::x, mix4::x, mix4::y, mix4::y>(input_transposed.x_axis, input_transposed.x_axis);
+			vector4f v02 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(input_transposed.z_axis, input_transposed.x_axis);
+			vector4f v10 = vector_mix<mix4::z, mix4::w, mix4::z, mix4::w>(input_transposed.w_axis, input_transposed.w_axis);
+			vector4f v11 = vector_mix<mix4::z, mix4::w, mix4::z, mix4::w>(input_transposed.y_axis, input_transposed.y_axis);
+			vector4f v12 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(input_transposed.w_axis, input_transposed.y_axis);
+
+			vector4f d0 = vector_mul(v00, v10);
+			vector4f d1 = vector_mul(v01, v11);
+			vector4f d2 = vector_mul(v02, v12);
+
+			v00 = vector_mix<mix4::z, mix4::w, mix4::z, mix4::w>(input_transposed.z_axis, input_transposed.z_axis);
+			v01 = vector_mix<mix4::z, mix4::w, mix4::z, mix4::w>(input_transposed.x_axis, input_transposed.x_axis);
+			v02 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(input_transposed.z_axis, input_transposed.x_axis);
+			v10 = vector_mix<mix4::x, mix4::x, mix4::y, mix4::y>(input_transposed.w_axis, input_transposed.w_axis);
+			v11 = vector_mix<mix4::x, mix4::x, mix4::y, mix4::y>(input_transposed.y_axis, input_transposed.y_axis);
+			v12 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(input_transposed.w_axis, input_transposed.y_axis);
+
+			d0 = vector_neg_mul_sub(v00, v10, d0);
+			d1 = vector_neg_mul_sub(v01, v11, d1);
+			d2 = vector_neg_mul_sub(v02, v12, d2);
+
+			v00 = vector_mix<mix4::y, mix4::z, mix4::x, mix4::y>(input_transposed.y_axis, input_transposed.y_axis);
+			v01 = vector_mix<mix4::z, mix4::x, mix4::y, mix4::x>(input_transposed.x_axis, input_transposed.x_axis);
+			v02 = vector_mix<mix4::y, mix4::z, mix4::x, mix4::y>(input_transposed.w_axis, input_transposed.w_axis);
+			vector4f v03 = vector_mix<mix4::z, mix4::x, mix4::y, mix4::x>(input_transposed.z_axis, input_transposed.z_axis);
+			v10 = vector_mix<mix4::b, mix4::y, mix4::w, mix4::x>(d0, d2);
+			v11 = vector_mix<mix4::w, mix4::b, mix4::y, mix4::z>(d0, d2);
+			v12 = vector_mix<mix4::d, mix4::y, mix4::w, mix4::x>(d1, d2);
+			vector4f v13 = vector_mix<mix4::w, mix4::d, mix4::y, mix4::z>(d1, d2);
+
+			vector4f c0 = vector_mul(v00, v10);
+			vector4f c2 = vector_mul(v01, v11);
+			vector4f c4 = vector_mul(v02, v12);
+			vector4f c6 = vector_mul(v03, v13);
+
+			v00 = vector_mix<mix4::z, mix4::w, mix4::y, mix4::z>(input_transposed.y_axis, input_transposed.y_axis);
+			v01 = vector_mix<mix4::w, mix4::z, mix4::w, mix4::y>(input_transposed.x_axis, input_transposed.x_axis);
+			v02 = vector_mix<mix4::z, mix4::w, mix4::y, mix4::z>(input_transposed.w_axis, input_transposed.w_axis);
+			v03 = vector_mix<mix4::w, mix4::z, mix4::w, mix4::y>(input_transposed.z_axis, input_transposed.z_axis);
+			v10 = vector_mix<mix4::w, mix4::x, mix4::y, mix4::a>(d0, d2);
+			v11 = vector_mix<mix4::z, mix4::y, mix4::a, mix4::x>(d0, d2);
+			v12 = vector_mix<mix4::w, mix4::x, mix4::y, mix4::c>(d1, d2);
+			v13 = vector_mix<mix4::z, mix4::y, mix4::c, mix4::x>(d1, d2);
+
+			c0 = vector_neg_mul_sub(v00, v10, c0);
+			c2 = vector_neg_mul_sub(v01, v11, c2);
+			c4 = vector_neg_mul_sub(v02, v12, c4);
+			c6 = vector_neg_mul_sub(v03, v13, c6);
+
+			v00 = vector_mix<mix4::w, mix4::x, mix4::w, mix4::x>(input_transposed.y_axis, input_transposed.y_axis);
+			v01 = vector_mix<mix4::y, mix4::w, mix4::x, mix4::z>(input_transposed.x_axis, input_transposed.x_axis);
+			v02 = vector_mix<mix4::w, mix4::x, mix4::w, mix4::x>(input_transposed.w_axis, input_transposed.w_axis);
+			v03 = vector_mix<mix4::y, mix4::w, mix4::x, mix4::z>(input_transposed.z_axis, input_transposed.z_axis);
+			v10 = vector_mix<mix4::z, mix4::b, mix4::a, mix4::z>(d0, d2);
+			v11 = vector_mix<mix4::b, mix4::x, mix4::w, mix4::a>(d0, d2);
+			v12 = vector_mix<mix4::z, mix4::d, mix4::c, mix4::z>(d1, d2);
+			v13 = vector_mix<mix4::d, mix4::x, mix4::w, mix4::c>(d1, d2);
+
+			vector4f c1 = vector_neg_mul_sub(v00, v10, c0);
+			c0 = vector_mul_add(v00, v10, c0);
+			vector4f c3 = vector_mul_add(v01, v11, c2);
+			c2 = vector_neg_mul_sub(v01, v11, c2);
+			vector4f c5 = vector_neg_mul_sub(v02, v12, c4);
+			c4 = vector_mul_add(v02, v12, c4);
+			vector4f c7 = vector_mul_add(v03, v13, c6);
+			c6 = vector_neg_mul_sub(v03, v13, c6);
+
+			vector4f x_axis = vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(c0, c1);
+			vector4f y_axis = vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(c2, c3);
+			vector4f z_axis = vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(c4, c5);
+			vector4f w_axis = vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(c6, c7);
+
+			const scalarf det = vector_dot(x_axis, input_transposed.x_axis);
+			if (scalar_lower_than(scalar_abs(det), threshold))
+				return fallback;
+
+			const scalarf inv_det_s = scalar_reciprocal(det);
+			const vector4f inv_det = vector_set(inv_det_s);
+
+			x_axis = vector_mul(x_axis, inv_det);
+			y_axis = vector_mul(y_axis, inv_det);
+			z_axis = vector_mul(z_axis, inv_det);
+			w_axis = vector_mul(w_axis, inv_det);
+
+			return matrix4x4f{ x_axis, y_axis, z_axis, w_axis };
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Inverses a 4x4 matrix.
 	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
@@ -204,94 +304,54 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline matrix4x4f RTM_SIMD_CALL matrix_inverse(matrix4x4f_arg0 input, matrix4x4f_arg1 fallback, float threshold = 1.0E-8F) RTM_NO_EXCEPT
 	{
-		matrix4x4f input_transposed = matrix_transpose(input);
-
-		vector4f v00 = vector_mix<mix4::x, mix4::x, mix4::y, mix4::y>(input_transposed.z_axis, input_transposed.z_axis);
-		vector4f v01 = vector_mix<mix4::x, mix4::x, mix4::y, mix4::y>(input_transposed.x_axis, input_transposed.x_axis);
-		vector4f v02 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(input_transposed.z_axis, input_transposed.x_axis);
-		vector4f v10 = vector_mix<mix4::z, mix4::w, mix4::z, mix4::w>(input_transposed.w_axis, input_transposed.w_axis);
-		vector4f v11 = vector_mix<mix4::z, mix4::w, mix4::z, mix4::w>(input_transposed.y_axis, input_transposed.y_axis);
-		vector4f v12 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(input_transposed.w_axis, input_transposed.y_axis);
-
-		vector4f d0 = vector_mul(v00, v10);
-		vector4f d1 = vector_mul(v01, v11);
-		vector4f d2 = vector_mul(v02, v12);
-
-		v00 = vector_mix<mix4::z, mix4::w, mix4::z, mix4::w>(input_transposed.z_axis, input_transposed.z_axis);
-		v01 = vector_mix<mix4::z, mix4::w, mix4::z, mix4::w>(input_transposed.x_axis, input_transposed.x_axis);
-		v02 = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(input_transposed.z_axis, input_transposed.x_axis);
-		v10 = vector_mix<mix4::x, mix4::x, mix4::y, mix4::y>(input_transposed.w_axis, input_transposed.w_axis);
-		v11 = vector_mix<mix4::x, mix4::x, mix4::y, mix4::y>(input_transposed.y_axis, input_transposed.y_axis);
-		v12 = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(input_transposed.w_axis, input_transposed.y_axis);
-
-		d0 = vector_neg_mul_sub(v00, v10, d0);
-		d1 = vector_neg_mul_sub(v01, v11, d1);
-		d2 = vector_neg_mul_sub(v02, v12, d2);
-
-		v00 = vector_mix<mix4::y, mix4::z, mix4::x, mix4::y>(input_transposed.y_axis, input_transposed.y_axis);
-		v01 = vector_mix<mix4::z, mix4::x, mix4::y, mix4::x>(input_transposed.x_axis, input_transposed.x_axis);
-		v02 = vector_mix<mix4::y, mix4::z, mix4::x, mix4::y>(input_transposed.w_axis, input_transposed.w_axis);
-		vector4f v03 = vector_mix<mix4::z, mix4::x, mix4::y, mix4::x>(input_transposed.z_axis, input_transposed.z_axis);
-		v10 = vector_mix<mix4::b, mix4::y, mix4::w, mix4::x>(d0, d2);
-		v11 = vector_mix<mix4::w, mix4::b, mix4::y, mix4::z>(d0, d2);
-		v12 = vector_mix<mix4::d, mix4::y, mix4::w, mix4::x>(d1, d2);
-		vector4f v13 = vector_mix<mix4::w, mix4::d, mix4::y, mix4::z>(d1, d2);
-
-		vector4f c0 = vector_mul(v00, v10);
-		vector4f c2 = vector_mul(v01, v11);
-		vector4f c4 = vector_mul(v02, v12);
-		vector4f c6 = vector_mul(v03, v13);
-
-		v00 = vector_mix<mix4::z, mix4::w, mix4::y, mix4::z>(input_transposed.y_axis, input_transposed.y_axis);
-		v01 = vector_mix<mix4::w, mix4::z, mix4::w, mix4::y>(input_transposed.x_axis, input_transposed.x_axis);
-		v02 = vector_mix<mix4::z, mix4::w, mix4::y, mix4::z>(input_transposed.w_axis, input_transposed.w_axis);
-		v03 = vector_mix<mix4::w, mix4::z, mix4::w, mix4::y>(input_transposed.z_axis, input_transposed.z_axis);
-		v10 = vector_mix<mix4::w, mix4::x, mix4::y, mix4::a>(d0, d2);
-		v11 = vector_mix<mix4::z, mix4::y, mix4::a, mix4::x>(d0, d2);
-		v12 = vector_mix<mix4::w, mix4::x, mix4::y, mix4::c>(d1, d2);
-		v13 = vector_mix<mix4::z, mix4::y, mix4::c, mix4::x>(d1, d2);
-
-		c0 = vector_neg_mul_sub(v00, v10, c0);
-		c2 = vector_neg_mul_sub(v01, v11, c2);
-		c4 = vector_neg_mul_sub(v02, v12, c4);
-		c6 = vector_neg_mul_sub(v03, v13, c6);
-
-		v00 = vector_mix<mix4::w, mix4::x, mix4::w, mix4::x>(input_transposed.y_axis, input_transposed.y_axis);
-		v01 = vector_mix<mix4::y, mix4::w, mix4::x, mix4::z>(input_transposed.x_axis, input_transposed.x_axis);
-		v02 = vector_mix<mix4::w, mix4::x, mix4::w, mix4::x>(input_transposed.w_axis, input_transposed.w_axis);
-		v03 = vector_mix<mix4::y, mix4::w, mix4::x, mix4::z>(input_transposed.z_axis, input_transposed.z_axis);
-		v10 = vector_mix<mix4::z, mix4::b, mix4::a, mix4::z>(d0, d2);
-		v11 = vector_mix<mix4::b, mix4::x, mix4::w, mix4::a>(d0, d2);
-		v12 = vector_mix<mix4::z, mix4::d, mix4::c, mix4::z>(d1, d2);
-		v13 = vector_mix<mix4::d, mix4::x, mix4::w, mix4::c>(d1, d2);
-
-		vector4f c1 = vector_neg_mul_sub(v00, v10, c0);
-		c0 = vector_mul_add(v00, v10, c0);
-		vector4f c3 = vector_mul_add(v01, v11, c2);
-		c2 = vector_neg_mul_sub(v01, v11, c2);
-		vector4f c5 = vector_neg_mul_sub(v02, v12, c4);
-		c4 = vector_mul_add(v02, v12, c4);
-		vector4f c7 = vector_mul_add(v03, v13, c6);
-		c6 = vector_neg_mul_sub(v03, v13, c6);
-
-		vector4f x_axis = vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(c0, c1);
-		vector4f y_axis = vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(c2, c3);
-		vector4f z_axis = vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(c4, c5);
-		vector4f w_axis = vector_mix<mix4::x, mix4::b, mix4::z, mix4::d>(c6, c7);
-
-		const scalarf det = vector_dot(x_axis, input_transposed.x_axis);
-		if (scalar_cast(scalar_abs(det)) < threshold)
-			return fallback;
+		return rtm_impl::matrix_inverse_with_fallback(input, fallback, scalar_set(threshold));
+	}
 
-		const scalarf inv_det_s = scalar_reciprocal(det);
-		const vector4f inv_det = vector_set(inv_det_s);
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 4x4 matrix.
+	// If the input matrix has a determinant whose absolute value is below the supplied threshold, the
+	// fall back value is returned instead.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4f RTM_SIMD_CALL matrix_inverse(matrix4x4f_arg0 input, matrix4x4f_arg1 fallback, scalarf_arg2 threshold) RTM_NO_EXCEPT
+	{
+		return rtm_impl::matrix_inverse_with_fallback(input, fallback, threshold);
+	}
+#endif
 
-		x_axis = vector_mul(x_axis, inv_det);
-		y_axis = vector_mul(y_axis, inv_det);
-		z_axis = vector_mul(z_axis, inv_det);
-		w_axis = vector_mul(w_axis, inv_det);
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 4x4 affine matrix that only contains a rotation and a translation.
+	// This is much cheaper than matrix_inverse(..): the rotation is transposed
+	// and the translation is rotated back and negated.
+	// If the input matrix has scale or is not affine, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4f RTM_SIMD_CALL matrix_inverse_rigid(matrix4x4f_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4f x_axis;
+		vector4f y_axis;
+		vector4f z_axis;
+		vector4f w_axis;
+		rtm_impl::matrix_inverse_orthogonal(input.x_axis, input.y_axis, input.z_axis, input.w_axis, vector_set(1.0F), x_axis, y_axis, z_axis, w_axis);
+		return matrix4x4f{ vector_set_w(x_axis, 0.0F), vector_set_w(y_axis, 0.0F), vector_set_w(z_axis, 0.0F), vector_set_w(w_axis, 1.0F) };
+	}
 
-		return matrix4x4f{ x_axis, y_axis, z_axis, w_axis };
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses a 4x4 affine matrix that contains a rotation, a uniform scale, and a translation.
+	// This is much cheaper than matrix_inverse(..): the scaled rotation is transposed
+	// and divided by the squared scale.
+	// If the input matrix has non-uniform or zero scale or is not affine, the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4f RTM_SIMD_CALL matrix_inverse_uniform_scale(matrix4x4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const scalarf scale_sq = vector_length_squared3(input.x_axis);
+		const vector4f inv_scale_sq = vector_set(scalar_reciprocal(scale_sq));
+
+		vector4f x_axis;
+		vector4f y_axis;
+		vector4f z_axis;
+		vector4f w_axis;
+		rtm_impl::matrix_inverse_orthogonal(input.x_axis, input.y_axis, input.z_axis, input.w_axis, inv_scale_sq, x_axis, y_axis, z_axis, w_axis);
+		return matrix4x4f{ vector_set_w(x_axis, 0.0F), vector_set_w(y_axis, 0.0F), vector_set_w(z_axis, 0.0F), vector_set_w(w_axis, 1.0F) };
 	}
 
 	//////////////////////////////////////////////////////////////////////////
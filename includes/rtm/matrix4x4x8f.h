@@ -0,0 +1,362 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/matrix4x4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// matrix4x4x8f holds 8 4x4 matrices as structure of arrays, one vector8f per component.
+	// Every operation is performed lane-wise, no swizzling is ever required.
+	// Conventions match their matrix4x4f counterparts.
+	//////////////////////////////////////////////////////////////////////////
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Inverses 4x4 matrices stored lane-wise:
+		// m[R][C] holds the component C of the axis R of every matrix.
+		// Returns the determinants, the inverses are undefined when they are zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector8f RTM_SIMD_CALL matrix_inverse_lanes(const vector8f (&m)[4][4], vector8f (&out_inverse)[4][4]) RTM_NO_EXCEPT
+		{
+			// 2x2 sub-determinants of the first two and the last two axes
+			const vector8f s0 = vector_neg_mul_sub(m[1][0], m[0][1], vector_mul(m[0][0], m[1][1]));
+			const vector8f s1 = vector_neg_mul_sub(m[1][0], m[0][2], vector_mul(m[0][0], m[1][2]));
+			const vector8f s2 = vector_neg_mul_sub(m[1][0], m[0][3], vector_mul(m[0][0], m[1][3]));
+			const vector8f s3 = vector_neg_mul_sub(m[1][1], m[0][2], vector_mul(m[0][1], m[1][2]));
+			const vector8f s4 = vector_neg_mul_sub(m[1][1], m[0][3], vector_mul(m[0][1], m[1][3]));
+			const vector8f s5 = vector_neg_mul_sub(m[1][2], m[0][3], vector_mul(m[0][2], m[1][3]));
+
+			const vector8f c0 = vector_neg_mul_sub(m[3][0], m[2][1], vector_mul(m[2][0], m[3][1]));
+			const vector8f c1 = vector_neg_mul_sub(m[3][0], m[2][2], vector_mul(m[2][0], m[3][2]));
+			const vector8f c2 = vector_neg_mul_sub(m[3][0], m[2][3], vector_mul(m[2][0], m[3][3]));
+			const vector8f c3 = vector_neg_mul_sub(m[3][1], m[2][2], vector_mul(m[2][1], m[3][2]));
+			const vector8f c4 = vector_neg_mul_sub(m[3][1], m[2][3], vector_mul(m[2][1], m[3][3]));
+			const vector8f c5 = vector_neg_mul_sub(m[3][2], m[2][3], vector_mul(m[2][2], m[3][3]));
+
+			const vector8f det = vector_mul_add(s5, c0, vector_neg_mul_sub(s4, c1, vector_mul_add(s3, c2, vector_mul_add(s2, c3, vector_neg_mul_sub(s1, c4, vector_mul(s0, c5))))));
+			const vector8f inv_det = vector_reciprocal(det);
+
+			out_inverse[0][0] = vector_mul(vector_mul_add(m[1][3], c3, vector_neg_mul_sub(m[1][2], c4, vector_mul(m[1][1], c5))), inv_det);
+			out_inverse[0][1] = vector_mul(vector_neg_mul_sub(m[0][3], c3, vector_mul_add(m[0][2], c4, vector_neg(vector_mul(m[0][1], c5)))), inv_det);
+			out_inverse[0][2] = vector_mul(vector_mul_add(m[3][3], s3, vector_neg_mul_sub(m[3][2], s4, vector_mul(m[3][1], s5))), inv_det);
+			out_inverse[0][3] = vector_mul(vector_neg_mul_sub(m[2][3], s3, vector_mul_add(m[2][2], s4, vector_neg(vector_mul(m[2][1], s5)))), inv_det);
+
+			out_inverse[1][0] = vector_mul(vector_neg_mul_sub(m[1][3], c1, vector_mul_add(m[1][2], c2, vector_neg(vector_mul(m[1][0], c5)))), inv_det);
+			out_inverse[1][1] = vector_mul(vector_mul_add(m[0][3], c1, vector_neg_mul_sub(m[0][2], c2, vector_mul(m[0][0], c5))), inv_det);
+			out_inverse[1][2] = vector_mul(vector_neg_mul_sub(m[3][3], s1, vector_mul_add(m[3][2], s2, vector_neg(vector_mul(m[3][0], s5)))), inv_det);
+			out_inverse[1][3] = vector_mul(vector_mul_add(m[2][3], s1, vector_neg_mul_sub(m[2][2], s2, vector_mul(m[2][0], s5))), inv_det);
+
+			out_inverse[2][0] = vector_mul(vector_mul_add(m[1][3], c0, vector_neg_mul_sub(m[1][1], c2, vector_mul(m[1][0], c4))), inv_det);
+			out_inverse[2][1] = vector_mul(vector_neg_mul_sub(m[0][3], c0, vector_mul_add(m[0][1], c2, vector_neg(vector_mul(m[0][0], c4)))), inv_det);
+			out_inverse[2][2] = vector_mul(vector_mul_add(m[3][3], s0, vector_neg_mul_sub(m[3][1], s2, vector_mul(m[3][0], s4))), inv_det);
+			out_inverse[2][3] = vector_mul(vector_neg_mul_sub(m[2][3], s0, vector_mul_add(m[2][1], s2, vector_neg(vector_mul(m[2][0], s4)))), inv_det);
+
+			out_inverse[3][0] = vector_mul(vector_neg_mul_sub(m[1][2], c0, vector_mul_add(m[1][1], c1, vector_neg(vector_mul(m[1][0], c3)))), inv_det);
+			out_inverse[3][1] = vector_mul(vector_mul_add(m[0][2], c0, vector_neg_mul_sub(m[0][1], c1, vector_mul(m[0][0], c3))), inv_det);
+			out_inverse[3][2] = vector_mul(vector_neg_mul_sub(m[3][2], s0, vector_mul_add(m[3][1], s1, vector_neg(vector_mul(m[3][0], s3)))), inv_det);
+			out_inverse[3][3] = vector_mul(vector_mul_add(m[2][2], s0, vector_neg_mul_sub(m[2][1], s1, vector_mul(m[2][0], s3))), inv_det);
+
+			return det;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts between matrix4x4x8f and the lane-wise layout of matrix_inverse_lanes(..).
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL matrix_to_lanes(matrix4x4x8f_arg0 input, vector8f (&output)[4][4]) RTM_NO_EXCEPT
+		{
+			const vector4x8f* axes[4] = { &input.x_axis, &input.y_axis, &input.z_axis, &input.w_axis };
+			for (uint32_t axis_index = 0; axis_index < 4; ++axis_index)
+			{
+				output[axis_index][0] = axes[axis_index]->x;
+				output[axis_index][1] = axes[axis_index]->y;
+				output[axis_index][2] = axes[axis_index]->z;
+				output[axis_index][3] = axes[axis_index]->w;
+			}
+		}
+
+		inline matrix4x4x8f RTM_SIMD_CALL matrix_from_lanes(const vector8f (&input)[4][4]) RTM_NO_EXCEPT
+		{
+			return matrix4x4x8f{
+				vector4x8f{ input[0][0], input[0][1], input[0][2], input[0][3] },
+				vector4x8f{ input[1][0], input[1][1], input[1][2], input[1][3] },
+				vector4x8f{ input[2][0], input[2][1], input[2][2], input[2][3] },
+				vector4x8f{ input[3][0], input[3][1], input[3][2], input[3][3] }
+			};
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the 4D vector multiplied by each matrix, the vector components are per lane.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4x8f RTM_SIMD_CALL matrix_mul_lanes(vector8f_arg0 x, vector8f_arg1 y, vector8f_arg2 z, vector8f_arg3 w, matrix4x4x8f_arg0 mtx) RTM_NO_EXCEPT
+		{
+			return vector4x8f{
+				vector_mul_add(w, mtx.w_axis.x, vector_mul_add(z, mtx.z_axis.x, vector_mul_add(y, mtx.y_axis.x, vector_mul(x, mtx.x_axis.x)))),
+				vector_mul_add(w, mtx.w_axis.y, vector_mul_add(z, mtx.z_axis.y, vector_mul_add(y, mtx.y_axis.y, vector_mul(x, mtx.x_axis.y)))),
+				vector_mul_add(w, mtx.w_axis.z, vector_mul_add(z, mtx.z_axis.z, vector_mul_add(y, mtx.y_axis.z, vector_mul(x, mtx.x_axis.z)))),
+				vector_mul_add(w, mtx.w_axis.w, vector_mul_add(z, mtx.z_axis.w, vector_mul_add(y, mtx.y_axis.w, vector_mul(x, mtx.x_axis.w))))
+			};
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns 8 identity matrices.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4x8f RTM_SIMD_CALL matrix4x4x8_identity() RTM_NO_EXCEPT
+	{
+		const vector8f zero = vector8_zero();
+		const vector8f one = vector8_set(1.0F);
+		return matrix4x4x8f{ vector4x8f{ one, zero, zero, zero }, vector4x8f{ zero, one, zero, zero }, vector4x8f{ zero, zero, one, zero }, vector4x8f{ zero, zero, zero, one } };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns 8 copies of a matrix.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4x8f RTM_SIMD_CALL matrix4x4x8_set(matrix4x4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f* axes[4] = { &input.x_axis, &input.y_axis, &input.z_axis, &input.w_axis };
+
+		vector8f lanes[4][4];
+		for (uint32_t axis_index = 0; axis_index < 4; ++axis_index)
+		{
+			lanes[axis_index][0] = vector8_set(vector_get_x(*axes[axis_index]));
+			lanes[axis_index][1] = vector8_set(vector_get_y(*axes[axis_index]));
+			lanes[axis_index][2] = vector8_set(vector_get_z(*axes[axis_index]));
+			lanes[axis_index][3] = vector8_set(vector_get_w(*axes[axis_index]));
+		}
+
+		return rtm_impl::matrix_from_lanes(lanes);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads and transposes 8 consecutive matrices.
+	// The input does not need to be aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4x8f RTM_SIMD_CALL matrix4x4x8_load(const matrix4x4f* input) RTM_NO_EXCEPT
+	{
+		// Two axes of a matrix per row, after the transpose each row holds a component of every matrix
+		vector8f xy[8];
+		vector8f zw[8];
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+		{
+			xy[matrix_index] = vector8_set(input[matrix_index].x_axis, input[matrix_index].y_axis);
+			zw[matrix_index] = vector8_set(input[matrix_index].z_axis, input[matrix_index].w_axis);
+		}
+
+		vector_transpose8x8(xy[0], xy[1], xy[2], xy[3], xy[4], xy[5], xy[6], xy[7]);
+		vector_transpose8x8(zw[0], zw[1], zw[2], zw[3], zw[4], zw[5], zw[6], zw[7]);
+
+		return matrix4x4x8f{
+			vector4x8f{ xy[0], xy[1], xy[2], xy[3] },
+			vector4x8f{ xy[4], xy[5], xy[6], xy[7] },
+			vector4x8f{ zw[0], zw[1], zw[2], zw[3] },
+			vector4x8f{ zw[4], zw[5], zw[6], zw[7] }
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads and transposes 'num_matrices' consecutive matrices, at most 8.
+	// The lanes past the last matrix hold the identity.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4x8f RTM_SIMD_CALL matrix4x4x8_load(const matrix4x4f* input, uint32_t num_matrices) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_matrices <= 8, "At most 8 matrices can be loaded");
+
+		matrix4x4f padded[8];
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			padded[matrix_index] = input[matrix_index];
+
+		for (uint32_t matrix_index = num_matrices; matrix_index < 8; ++matrix_index)
+			padded[matrix_index] = matrix_identity();
+
+		return matrix4x4x8_load(&padded[0]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes and writes the 8 matrices consecutively.
+	// The output does not need to be aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_store(matrix4x4x8f_arg0 input, matrix4x4f* output) RTM_NO_EXCEPT
+	{
+		vector8f xy[8] = { input.x_axis.x, input.x_axis.y, input.x_axis.z, input.x_axis.w, input.y_axis.x, input.y_axis.y, input.y_axis.z, input.y_axis.w };
+		vector8f zw[8] = { input.z_axis.x, input.z_axis.y, input.z_axis.z, input.z_axis.w, input.w_axis.x, input.w_axis.y, input.w_axis.z, input.w_axis.w };
+
+		vector_transpose8x8(xy[0], xy[1], xy[2], xy[3], xy[4], xy[5], xy[6], xy[7]);
+		vector_transpose8x8(zw[0], zw[1], zw[2], zw[3], zw[4], zw[5], zw[6], zw[7]);
+
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+			output[matrix_index] = matrix_set(vector_get_low(xy[matrix_index]), vector_get_high(xy[matrix_index]), vector_get_low(zw[matrix_index]), vector_get_high(zw[matrix_index]));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes and writes the first 'num_matrices' matrices consecutively, at most 8.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL matrix_store(matrix4x4x8f_arg0 input, matrix4x4f* output, uint32_t num_matrices) RTM_NO_EXCEPT
+	{
+		RTM_ASSERT(num_matrices <= 8, "At most 8 matrices can be written");
+
+		matrix4x4f matrices[8];
+		matrix_store(input, &matrices[0]);
+
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			output[matrix_index] = matrices[matrix_index];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies each pair of 4x4 matrices.
+	// Multiplication order is as follow: local_to_world = matrix_mul(local_to_object, object_to_world)
+	// Every component of both matrices is used: projections can be on either side.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4x8f RTM_SIMD_CALL matrix_mul(matrix4x4x8f_arg0 lhs, matrix4x4x8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return matrix4x4x8f{
+			rtm_impl::matrix_mul_lanes(lhs.x_axis.x, lhs.x_axis.y, lhs.x_axis.z, lhs.x_axis.w, rhs),
+			rtm_impl::matrix_mul_lanes(lhs.y_axis.x, lhs.y_axis.y, lhs.y_axis.z, lhs.y_axis.w, rhs),
+			rtm_impl::matrix_mul_lanes(lhs.z_axis.x, lhs.z_axis.y, lhs.z_axis.z, lhs.z_axis.w, rhs),
+			rtm_impl::matrix_mul_lanes(lhs.w_axis.x, lhs.w_axis.y, lhs.w_axis.z, lhs.w_axis.w, rhs)
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies each 4D vector by its matching 4x4 matrix.
+	// Multiplication order is as follow: world_position = matrix_mul_vector(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4x8f RTM_SIMD_CALL matrix_mul_vector(vector4x8f_arg0 vec4, matrix4x4x8f_arg1 mtx) RTM_NO_EXCEPT
+	{
+		return rtm_impl::matrix_mul_lanes(vec4.x, vec4.y, vec4.z, vec4.w, mtx);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies each 3D point (with w = 1.0) by its matching 4x4 matrix.
+	// The homogeneous result is returned, divide by its [w] component to project it.
+	// Multiplication order is as follow: clip_position = matrix_mul_point3(world_position, world_to_clip)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4x8f RTM_SIMD_CALL matrix_mul_point3(vector3x8f_arg0 point, matrix4x4x8f_arg1 mtx) RTM_NO_EXCEPT
+	{
+		return vector4x8f{
+			vector_mul_add(point.z, mtx.z_axis.x, vector_mul_add(point.y, mtx.y_axis.x, vector_mul_add(point.x, mtx.x_axis.x, mtx.w_axis.x))),
+			vector_mul_add(point.z, mtx.z_axis.y, vector_mul_add(point.y, mtx.y_axis.y, vector_mul_add(point.x, mtx.x_axis.y, mtx.w_axis.y))),
+			vector_mul_add(point.z, mtx.z_axis.z, vector_mul_add(point.y, mtx.y_axis.z, vector_mul_add(point.x, mtx.x_axis.z, mtx.w_axis.z))),
+			vector_mul_add(point.z, mtx.z_axis.w, vector_mul_add(point.y, mtx.y_axis.w, vector_mul_add(point.x, mtx.x_axis.w, mtx.w_axis.w)))
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes each 4x4 matrix, the components only change places.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4x8f RTM_SIMD_CALL matrix_transpose(matrix4x4x8f_arg0 input) RTM_NO_EXCEPT
+	{
+		return matrix4x4x8f{
+			vector4x8f{ input.x_axis.x, input.y_axis.x, input.z_axis.x, input.w_axis.x },
+			vector4x8f{ input.x_axis.y, input.y_axis.y, input.z_axis.y, input.w_axis.y },
+			vector4x8f{ input.x_axis.z, input.y_axis.z, input.z_axis.z, input.w_axis.z },
+			vector4x8f{ input.x_axis.w, input.y_axis.w, input.z_axis.w, input.w_axis.w }
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses each 4x4 matrix.
+	// If a matrix is not invertible, its result is undefined.
+	// For a safe alternative, supply a fallback value and a threshold.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4x8f RTM_SIMD_CALL matrix_inverse(matrix4x4x8f_arg0 input) RTM_NO_EXCEPT
+	{
+		vector8f lanes[4][4];
+		rtm_impl::matrix_to_lanes(input, lanes);
+
+		vector8f inverse[4][4];
+		rtm_impl::matrix_inverse_lanes(lanes, inverse);
+
+		return rtm_impl::matrix_from_lanes(inverse);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Inverses each 4x4 matrix.
+	// The matrices whose absolute determinant is below the threshold are replaced by the fallback.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix4x4x8f RTM_SIMD_CALL matrix_inverse(matrix4x4x8f_arg0 input, matrix4x4x8f_arg1 fallback, float threshold = 1.0E-8F) RTM_NO_EXCEPT
+	{
+		vector8f lanes[4][4];
+		rtm_impl::matrix_to_lanes(input, lanes);
+
+		vector8f inverse[4][4];
+		const vector8f det = rtm_impl::matrix_inverse_lanes(lanes, inverse);
+		const mask8f is_singular = vector_less_than(vector_abs(det), vector8_set(threshold));
+
+		vector8f fallback_lanes[4][4];
+		rtm_impl::matrix_to_lanes(fallback, fallback_lanes);
+
+		for (uint32_t axis_index = 0; axis_index < 4; ++axis_index)
+		{
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+				inverse[axis_index][component_index] = vector_select(is_singular, fallback_lanes[axis_index][component_index], inverse[axis_index][component_index]);
+		}
+
+		return rtm_impl::matrix_from_lanes(inverse);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the determinant of each 4x4 matrix.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL matrix_determinant(matrix4x4x8f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector8f s0 = vector_neg_mul_sub(input.y_axis.x, input.x_axis.y, vector_mul(input.x_axis.x, input.y_axis.y));
+		const vector8f s1 = vector_neg_mul_sub(input.y_axis.x, input.x_axis.z, vector_mul(input.x_axis.x, input.y_axis.z));
+		const vector8f s2 = vector_neg_mul_sub(input.y_axis.x, input.x_axis.w, vector_mul(input.x_axis.x, input.y_axis.w));
+		const vector8f s3 = vector_neg_mul_sub(input.y_axis.y, input.x_axis.z, vector_mul(input.x_axis.y, input.y_axis.z));
+		const vector8f s4 = vector_neg_mul_sub(input.y_axis.y, input.x_axis.w, vector_mul(input.x_axis.y, input.y_axis.w));
+		const vector8f s5 = vector_neg_mul_sub(input.y_axis.z, input.x_axis.w, vector_mul(input.x_axis.z, input.y_axis.w));
+
+		const vector8f c0 = vector_neg_mul_sub(input.w_axis.x, input.z_axis.y, vector_mul(input.z_axis.x, input.w_axis.y));
+		const vector8f c1 = vector_neg_mul_sub(input.w_axis.x, input.z_axis.z, vector_mul(input.z_axis.x, input.w_axis.z));
+		const vector8f c2 = vector_neg_mul_sub(input.w_axis.x, input.z_axis.w, vector_mul(input.z_axis.x, input.w_axis.w));
+		const vector8f c3 = vector_neg_mul_sub(input.w_axis.y, input.z_axis.z, vector_mul(input.z_axis.y, input.w_axis.z));
+		const vector8f c4 = vector_neg_mul_sub(input.w_axis.y, input.z_axis.w, vector_mul(input.z_axis.y, input.w_axis.w));
+		const vector8f c5 = vector_neg_mul_sub(input.w_axis.z, input.z_axis.w, vector_mul(input.z_axis.z, input.w_axis.w));
+
+		return vector_mul_add(s5, c0, vector_neg_mul_sub(s4, c1, vector_mul_add(s3, c2, vector_mul_add(s2, c3, vector_neg_mul_sub(s1, c4, vector_mul(s0, c5))))));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,412 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector4i.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The octaves summed by fractal Brownian motion (fBm).
+	// Each octave samples the noise at 'lacunarity' times the frequency of the previous one
+	// with 'gain' times its amplitude and its own seed: seed, seed + 1, etc.
+	//////////////////////////////////////////////////////////////////////////
+	struct noise_fractal_settings
+	{
+		// The number of octaves summed, at least 1
+		uint32_t num_octaves = 4;
+
+		// The frequency of the first octave, the positions are scaled by it
+		float frequency = 1.0F;
+
+		// The frequency multiplier from one octave to the next
+		float lacunarity = 2.0F;
+
+		// The amplitude multiplier from one octave to the next
+		float gain = 0.5F;
+
+		// The seed of the first octave
+		int32_t seed = 0;
+	};
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The integer operations and conversions for the register width the noise kernels
+		// are instantiated with. Float arithmetic uses the regular overloads, those of vector8f
+		// are included for the 8 wide kernels of rtm/batch/noise.h.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		struct noise_lanes;
+
+		template<>
+		struct noise_lanes<4>
+		{
+			using float_type = vector4f;
+			using int_type = vector4i;
+
+			static vector4f RTM_SIMD_CALL broadcast(float value) RTM_NO_EXCEPT { return vector_set(value); }
+			static vector4i RTM_SIMD_CALL broadcast_int(int32_t value) RTM_NO_EXCEPT { return vector_set(value); }
+			static vector4f RTM_SIMD_CALL load(const float* input) RTM_NO_EXCEPT { return vector_load(input); }
+			static void RTM_SIMD_CALL store(vector4f_arg0 input, float* output) RTM_NO_EXCEPT { vector_store(input, output); }
+
+			// Returns floor(input) as integers, out_fraction receives input - floor(input)
+			static vector4i RTM_SIMD_CALL floor_to_int(vector4f_arg0 input, vector4f& out_fraction) RTM_NO_EXCEPT
+			{
+				const vector4f floored = vector_floor(input);
+				out_fraction = vector_sub(input, floored);
+				return vector_truncate_to_int(floored);
+			}
+
+			static vector4i RTM_SIMD_CALL add(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT { return vector_add(lhs, rhs); }
+			static vector4i RTM_SIMD_CALL mul(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT { return vector_mul(lhs, rhs); }
+			static vector4i RTM_SIMD_CALL bit_xor(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT { return vector_xor(lhs, rhs); }
+			static vector4i RTM_SIMD_CALL bit_and(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT { return vector_and(lhs, rhs); }
+			static vector4i RTM_SIMD_CALL shift_right_logical(vector4i_arg0 input, uint32_t count) RTM_NO_EXCEPT { return vector_shift_right_logical(input, count); }
+			static vector4f RTM_SIMD_CALL to_float(vector4i_arg0 input) RTM_NO_EXCEPT { return vector_int_to_float(input); }
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Large primes that decorrelate the lattice coordinates before they are hashed.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr int32_t k_noise_prime_x = 501125321;
+		constexpr int32_t k_noise_prime_y = 1136930381;
+		constexpr int32_t k_noise_prime_z = 1720413743;
+		constexpr int32_t k_noise_prime_w = 1066037191;
+		constexpr int32_t k_noise_hash_multiplier = 0x27D4EB2D;
+
+		// Scale the noise to [-1.0, 1.0], the reciprocals of the largest magnitudes found by searching the fields
+		constexpr float k_noise_perlin3_scale = 0.965F;
+		constexpr float k_noise_perlin4_scale = 0.76F;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The lattice cell containing a coordinate: the hash terms of its two corners
+		// (the integer coordinate times the axis prime) and the offsets from them.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		struct noise_axis
+		{
+			using float_type = typename noise_lanes<num_lanes>::float_type;
+			using int_type = typename noise_lanes<num_lanes>::int_type;
+
+			int_type hash_terms[2];
+			float_type offsets[2];
+			float_type fade;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per component the quintic fade curve: 6t^5 - 15t^4 + 10t^3
+		// Its first and second derivatives are zero at 0 and 1: the noise is C2 continuous.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename noise_lanes<num_lanes>::float_type noise_fade(const typename noise_lanes<num_lanes>::float_type& input) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+			using float_type = typename lanes::float_type;
+
+			const float_type input_cubed = vector_mul(vector_mul(input, input), input);
+			const float_type polynomial = vector_mul_add(input, vector_mul_add(input, 6.0F, lanes::broadcast(-15.0F)), lanes::broadcast(10.0F));
+			return vector_mul(input_cubed, polynomial);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Splits a coordinate into its lattice cell.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline noise_axis<num_lanes> noise_make_axis(const typename noise_lanes<num_lanes>::float_type& input, int32_t prime) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+
+			noise_axis<num_lanes> axis;
+			const typename lanes::int_type floored = lanes::floor_to_int(input, axis.offsets[0]);
+			const typename lanes::int_type prime_v = lanes::broadcast_int(prime);
+			axis.hash_terms[0] = lanes::mul(floored, prime_v);
+			axis.hash_terms[1] = lanes::add(axis.hash_terms[0], prime_v);
+			axis.offsets[1] = vector_sub(axis.offsets[0], lanes::broadcast(1.0F));
+			axis.fade = noise_fade<num_lanes>(axis.offsets[0]);
+			return axis;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the hash of a corner whose seed and axis terms are combined: the high bits
+		// are the best mixed after the multiplication, they select the gradient.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename noise_lanes<num_lanes>::int_type noise_hash(const typename noise_lanes<num_lanes>::int_type& terms) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+			return lanes::mul(terms, lanes::broadcast_int(k_noise_hash_multiplier));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the dot product of the corner offset with one of the 12 gradients along the
+		// edges of a cube, picked by the top 4 bits of the hash as in improved Perlin noise.
+		// The index is compared as a float since integer masks cannot select floats.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename noise_lanes<num_lanes>::float_type noise_gradient3(const typename noise_lanes<num_lanes>::int_type& hash,
+			const typename noise_lanes<num_lanes>::float_type& x, const typename noise_lanes<num_lanes>::float_type& y, const typename noise_lanes<num_lanes>::float_type& z) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+			using float_type = typename lanes::float_type;
+			using int_type = typename lanes::int_type;
+
+			const int_type index = lanes::shift_right_logical(hash, 28);
+			const float_type index_f = lanes::to_float(index);
+
+			// [0, 8) -> x, [8, 16) -> y
+			const float_type u = vector_select(vector_less_than(index_f, lanes::broadcast(8.0F)), x, y);
+
+			// [0, 4) -> y, [4, 12) -> z, [12, 16) -> x
+			const float_type v = vector_select(vector_less_than(index_f, lanes::broadcast(4.0F)), y, vector_select(vector_less_than(index_f, lanes::broadcast(12.0F)), z, x));
+
+			// Bit 0 negates u and bit 1 negates v: sign = 1 - 2 * bit
+			const float_type one = lanes::broadcast(1.0F);
+			const float_type u_sign = vector_neg_mul_sub(lanes::to_float(lanes::bit_and(index, lanes::broadcast_int(1))), 2.0F, one);
+			const float_type v_sign = vector_sub(one, lanes::to_float(lanes::bit_and(index, lanes::broadcast_int(2))));
+			return vector_mul_add(u, u_sign, vector_mul(v, v_sign));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the dot product of the corner offset with one of the 32 gradients that have
+		// one zero and three unit components, picked by the top 5 bits of the hash.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename noise_lanes<num_lanes>::float_type noise_gradient4(const typename noise_lanes<num_lanes>::int_type& hash,
+			const typename noise_lanes<num_lanes>::float_type& x, const typename noise_lanes<num_lanes>::float_type& y,
+			const typename noise_lanes<num_lanes>::float_type& z, const typename noise_lanes<num_lanes>::float_type& w) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+			using float_type = typename lanes::float_type;
+			using int_type = typename lanes::int_type;
+
+			const int_type index = lanes::shift_right_logical(hash, 27);
+			const float_type index_f = lanes::to_float(index);
+
+			// [0, 8) -> xyz, [8, 16) -> xyw, [16, 24) -> xzw, [24, 32) -> yzw
+			const float_type u = vector_select(vector_less_than(index_f, lanes::broadcast(24.0F)), x, y);
+			const float_type v = vector_select(vector_less_than(index_f, lanes::broadcast(16.0F)), y, z);
+			const float_type t = vector_select(vector_less_than(index_f, lanes::broadcast(8.0F)), z, w);
+
+			// Bits 0, 1, and 2 negate u, v, and t
+			const float_type one = lanes::broadcast(1.0F);
+			const float_type u_sign = vector_neg_mul_sub(lanes::to_float(lanes::bit_and(index, lanes::broadcast_int(1))), 2.0F, one);
+			const float_type v_sign = vector_sub(one, lanes::to_float(lanes::bit_and(index, lanes::broadcast_int(2))));
+			const float_type t_sign = vector_neg_mul_sub(lanes::to_float(lanes::bit_and(index, lanes::broadcast_int(4))), 0.5F, one);
+			return vector_mul_add(u, u_sign, vector_mul_add(v, v_sign, vector_mul(t, t_sign)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Blends the corner values of a cell pairwise along each axis in turn.
+		// The values are ordered with the x corner in bit 0, y in bit 1, etc.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes, uint32_t num_corners>
+		inline typename noise_lanes<num_lanes>::float_type noise_blend_corners(typename noise_lanes<num_lanes>::float_type (&values)[num_corners], const noise_axis<num_lanes>* axes) RTM_NO_EXCEPT
+		{
+			uint32_t axis_index = 0;
+			for (uint32_t num_values = num_corners; num_values > 1; num_values /= 2, ++axis_index)
+			{
+				for (uint32_t value_index = 0; value_index < num_values / 2; ++value_index)
+					values[value_index] = vector_lerp(values[value_index * 2 + 0], values[value_index * 2 + 1], axes[axis_index].fade);
+			}
+
+			return values[0];
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// 3D Perlin gradient noise, scaled to about [-1.0, 1.0].
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename noise_lanes<num_lanes>::float_type noise_perlin3_impl(const typename noise_lanes<num_lanes>::float_type& x, const typename noise_lanes<num_lanes>::float_type& y,
+			const typename noise_lanes<num_lanes>::float_type& z, const typename noise_lanes<num_lanes>::int_type& seed) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+			using float_type = typename lanes::float_type;
+
+			const noise_axis<num_lanes> axes[3] = { noise_make_axis<num_lanes>(x, k_noise_prime_x), noise_make_axis<num_lanes>(y, k_noise_prime_y), noise_make_axis<num_lanes>(z, k_noise_prime_z) };
+
+			float_type values[8];
+			for (uint32_t corner_index = 0; corner_index < 8; ++corner_index)
+			{
+				const uint32_t x_corner = corner_index & 1;
+				const uint32_t y_corner = (corner_index >> 1) & 1;
+				const uint32_t z_corner = corner_index >> 2;
+
+				const typename lanes::int_type terms = lanes::bit_xor(lanes::bit_xor(seed, axes[0].hash_terms[x_corner]), lanes::bit_xor(axes[1].hash_terms[y_corner], axes[2].hash_terms[z_corner]));
+				values[corner_index] = noise_gradient3<num_lanes>(noise_hash<num_lanes>(terms), axes[0].offsets[x_corner], axes[1].offsets[y_corner], axes[2].offsets[z_corner]);
+			}
+
+			return vector_mul(noise_blend_corners<num_lanes>(values, axes), k_noise_perlin3_scale);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// 4D Perlin gradient noise, scaled to about [-1.0, 1.0].
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_lanes>
+		inline typename noise_lanes<num_lanes>::float_type noise_perlin4_impl(const typename noise_lanes<num_lanes>::float_type& x, const typename noise_lanes<num_lanes>::float_type& y,
+			const typename noise_lanes<num_lanes>::float_type& z, const typename noise_lanes<num_lanes>::float_type& w, const typename noise_lanes<num_lanes>::int_type& seed) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+			using float_type = typename lanes::float_type;
+
+			const noise_axis<num_lanes> axes[4] = { noise_make_axis<num_lanes>(x, k_noise_prime_x), noise_make_axis<num_lanes>(y, k_noise_prime_y), noise_make_axis<num_lanes>(z, k_noise_prime_z), noise_make_axis<num_lanes>(w, k_noise_prime_w) };
+
+			float_type values[16];
+			for (uint32_t corner_index = 0; corner_index < 16; ++corner_index)
+			{
+				const uint32_t x_corner = corner_index & 1;
+				const uint32_t y_corner = (corner_index >> 1) & 1;
+				const uint32_t z_corner = (corner_index >> 2) & 1;
+				const uint32_t w_corner = corner_index >> 3;
+
+				const typename lanes::int_type xy_terms = lanes::bit_xor(axes[0].hash_terms[x_corner], axes[1].hash_terms[y_corner]);
+				const typename lanes::int_type zw_terms = lanes::bit_xor(axes[2].hash_terms[z_corner], axes[3].hash_terms[w_corner]);
+				const typename lanes::int_type terms = lanes::bit_xor(seed, lanes::bit_xor(xy_terms, zw_terms));
+				values[corner_index] = noise_gradient4<num_lanes>(noise_hash<num_lanes>(terms), axes[0].offsets[x_corner], axes[1].offsets[y_corner], axes[2].offsets[z_corner], axes[3].offsets[w_corner]);
+			}
+
+			return vector_mul(noise_blend_corners<num_lanes>(values, axes), k_noise_perlin4_scale);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the seed of an octave, wrapping around on overflow.
+		//////////////////////////////////////////////////////////////////////////
+		inline int32_t noise_octave_seed(int32_t seed, uint32_t octave_index) RTM_NO_EXCEPT
+		{
+			return static_cast<int32_t>(static_cast<uint32_t>(seed) + octave_index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the reciprocal of the sum of the octave amplitudes, it normalizes the fBm.
+		//////////////////////////////////////////////////////////////////////////
+		inline float noise_fractal_normalization(const noise_fractal_settings& settings) RTM_NO_EXCEPT
+		{
+			RTM_ASSERT(settings.num_octaves != 0, "At least one octave is required");
+
+			float amplitude = 1.0F;
+			float amplitude_sum = 0.0F;
+			for (uint32_t octave_index = 0; octave_index < settings.num_octaves; ++octave_index)
+			{
+				amplitude_sum += amplitude;
+				amplitude *= settings.gain;
+			}
+
+			return 1.0F / amplitude_sum;
+		}
+
+		template<uint32_t num_lanes>
+		inline typename noise_lanes<num_lanes>::float_type noise_fbm3_impl(const typename noise_lanes<num_lanes>::float_type& x, const typename noise_lanes<num_lanes>::float_type& y,
+			const typename noise_lanes<num_lanes>::float_type& z, const noise_fractal_settings& settings, float normalization) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+			using float_type = typename lanes::float_type;
+
+			float_type sum = lanes::broadcast(0.0F);
+			float frequency = settings.frequency;
+			float amplitude = normalization;
+			for (uint32_t octave_index = 0; octave_index < settings.num_octaves; ++octave_index)
+			{
+				const float_type octave = noise_perlin3_impl<num_lanes>(vector_mul(x, frequency), vector_mul(y, frequency), vector_mul(z, frequency), lanes::broadcast_int(noise_octave_seed(settings.seed, octave_index)));
+				sum = vector_mul_add(octave, amplitude, sum);
+				frequency *= settings.lacunarity;
+				amplitude *= settings.gain;
+			}
+
+			return sum;
+		}
+
+		template<uint32_t num_lanes>
+		inline typename noise_lanes<num_lanes>::float_type noise_fbm4_impl(const typename noise_lanes<num_lanes>::float_type& x, const typename noise_lanes<num_lanes>::float_type& y,
+			const typename noise_lanes<num_lanes>::float_type& z, const typename noise_lanes<num_lanes>::float_type& w, const noise_fractal_settings& settings, float normalization) RTM_NO_EXCEPT
+		{
+			using lanes = noise_lanes<num_lanes>;
+			using float_type = typename lanes::float_type;
+
+			float_type sum = lanes::broadcast(0.0F);
+			float frequency = settings.frequency;
+			float amplitude = normalization;
+			for (uint32_t octave_index = 0; octave_index < settings.num_octaves; ++octave_index)
+			{
+				const float_type octave = noise_perlin4_impl<num_lanes>(vector_mul(x, frequency), vector_mul(y, frequency), vector_mul(z, frequency), vector_mul(w, frequency), lanes::broadcast_int(noise_octave_seed(settings.seed, octave_index)));
+				sum = vector_mul_add(octave, amplitude, sum);
+				frequency *= settings.lacunarity;
+				amplitude *= settings.gain;
+			}
+
+			return sum;
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns 3D Perlin gradient noise at 4 positions stored as structure of arrays.
+	// The noise is zero on the integer lattice, C2 continuous, and within about [-1.0, 1.0].
+	// Every seed produces a different field. Only integer multiplications, XORs, and shifts
+	// hash the lattice: a seed produces the same field on every platform, within rounding.
+	// Positions must be within [-2^31, 2^31) once floored.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL noise_perlin3(vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, int32_t seed = 0) RTM_NO_EXCEPT
+	{
+		return rtm_impl::noise_perlin3_impl<4>(x, y, z, vector_set(seed));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns 4D Perlin gradient noise at 4 positions stored as structure of arrays.
+	// The fourth dimension is commonly time, to animate a 3D field, or a second
+	// seed. See noise_perlin3(..) for the properties of the noise.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL noise_perlin4(vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, vector4f_arg3 w, int32_t seed = 0) RTM_NO_EXCEPT
+	{
+		return rtm_impl::noise_perlin4_impl<4>(x, y, z, w, vector_set(seed));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the fractal Brownian motion (fBm) of 3D Perlin noise at 4 positions stored
+	// as structure of arrays: the sum of its octaves divided by the sum of their amplitudes,
+	// within about [-1.0, 1.0]. Each octave costs one noise_perlin3(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL noise_fbm3(vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, const noise_fractal_settings& settings) RTM_NO_EXCEPT
+	{
+		return rtm_impl::noise_fbm3_impl<4>(x, y, z, settings, rtm_impl::noise_fractal_normalization(settings));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the fractal Brownian motion (fBm) of 4D Perlin noise at 4 positions stored
+	// as structure of arrays, see noise_fbm3(..).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL noise_fbm4(vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, vector4f_arg3 w, const noise_fractal_settings& settings) RTM_NO_EXCEPT
+	{
+		return rtm_impl::noise_fbm4_impl<4>(x, y, z, w, settings, rtm_impl::noise_fractal_normalization(settings));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
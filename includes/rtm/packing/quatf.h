@@ -29,6 +29,8 @@
 #include "rtm/vector4f.h"
 #include "rtm/impl/compiler_utils.h"
 
+#include <cstdint>
+
 RTM_IMPL_FILE_PRAGMA_PUSH
 
 namespace rtm
@@ -94,6 +96,286 @@ namespace rtm
 		return quat_set_w(vector_to_quat(input), w);
 #endif
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Smallest three encoding
+	// The largest component (in absolute value) of a normalized quaternion is dropped and
+	// its index is stored in the 2 least significant bits. The quaternion is negated when needed
+	// for the dropped component to be positive which lets us reconstruct it like quat_from_positive_w.
+	// The three remaining components are in [-1/sqrt(2), 1/sqrt(2)] and are quantized in order
+	// as unsigned normalized integers of 10 (32 bit), 15 (48 bit), or 20 (64 bit) bits each.
+	//////////////////////////////////////////////////////////////////////////
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the index of the largest component and the three remaining components
+		// in the [xyz] components of 'out_smallest', scaled by 'max_value'
+		// and rounded to the nearest integer.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint32_t RTM_SIMD_CALL quat_smallest_three_split(quatf_arg0 input, float max_value, vector4f& out_smallest) RTM_NO_EXCEPT
+		{
+			alignas(16) float components[4];
+			vector_store(quat_to_vector(input), &components[0]);
+
+			uint32_t largest_index = 0;
+			for (uint32_t component_index = 1; component_index < 4; ++component_index)
+			{
+				if (scalar_abs(components[component_index]) > scalar_abs(components[largest_index]))
+					largest_index = component_index;
+			}
+
+			const float bias = components[largest_index] >= 0.0F ? 1.0F : -1.0F;
+
+			float smallest[3];
+			for (uint32_t component_index = 0, smallest_index = 0; component_index < 4; ++component_index)
+			{
+				if (component_index != largest_index)
+					smallest[smallest_index++] = components[component_index] * bias;
+			}
+
+			// [-1/sqrt(2), 1/sqrt(2)] -> [0.0, 1.0] -> [0, max_value]
+			const vector4f normalized = vector_mul_add(vector_set(smallest[0], smallest[1], smallest[2], 0.0F), 0.707106781186547524F, vector_set(0.5F));
+			out_smallest = vector_round_symmetric(vector_mul(vector_clamp(normalized, vector_zero(), vector_set(1.0F)), max_value));
+			return largest_index;
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the quaternion reconstructed from the index of its largest component and the
+		// three remaining quantized components in [0, max_value] held in the [xyz] components of 'smallest'.
+		//////////////////////////////////////////////////////////////////////////
+		inline quatf RTM_SIMD_CALL quat_from_smallest_three(uint32_t largest_index, vector4f_arg0 smallest, float max_value) RTM_NO_EXCEPT
+		{
+			// [0, max_value] -> [-1/sqrt(2), 1/sqrt(2)]
+			const vector4f components = vector_mul_add(smallest, 1.414213562373095049F / max_value, vector_set(-0.707106781186547524F));
+
+			const float a = vector_get_x(components);
+			const float b = vector_get_y(components);
+			const float c = vector_get_z(components);
+
+			// Like quat_from_positive_w, the squared value can be slightly negative due to quantization
+			const float largest_squared = ((1.0F - a * a) - b * b) - c * c;
+			const float largest = scalar_sqrt(scalar_abs(largest_squared));
+
+			switch (largest_index)
+			{
+			case 0:		return quat_set(largest, a, b, c);
+			case 1:		return quat_set(a, largest, b, c);
+			case 2:		return quat_set(a, b, largest, c);
+			default:	return quat_set(a, b, c, largest);
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Reconstructs 4 quaternions with SoA math from the index of their largest component
+		// and their three remaining components quantized in [0, max_value].
+		// No branching or swizzling is required, the largest component is inserted with selects.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_from_smallest_three_soa4(vector4f_arg0 largest_index, vector4f_arg1 smallest_a, vector4f_arg2 smallest_b, vector4f_arg3 smallest_c, float max_value, const float4f_soa& output, uint32_t quat_index) RTM_NO_EXCEPT
+		{
+			const vector4f scale = vector_set(1.414213562373095049F / max_value);
+			const vector4f offset = vector_set(-0.707106781186547524F);
+
+			const vector4f a = vector_mul_add(smallest_a, scale, offset);
+			const vector4f b = vector_mul_add(smallest_b, scale, offset);
+			const vector4f c = vector_mul_add(smallest_c, scale, offset);
+
+			const vector4f largest_squared = vector_neg_mul_sub(c, c, vector_neg_mul_sub(b, b, vector_neg_mul_sub(a, a, vector_set(1.0F))));
+			const vector4f largest = vector_sqrt(vector_abs(largest_squared));
+
+			const mask4f is_x = vector_equal(largest_index, vector_zero());
+			const mask4f is_y = vector_equal(largest_index, vector_set(1.0F));
+			const mask4f is_z = vector_equal(largest_index, vector_set(2.0F));
+			const mask4f is_w = vector_equal(largest_index, vector_set(3.0F));
+
+			vector_store(vector_select(is_x, largest, a), output.x + quat_index);
+			vector_store(vector_select(is_x, a, vector_select(is_y, largest, b)), output.y + quat_index);
+			vector_store(vector_select(is_w, c, vector_select(is_z, largest, b)), output.z + quat_index);
+			vector_store(vector_select(is_w, largest, c), output.w + quat_index);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Writes a single quaternion to SoA streams.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL quat_store_soa(quatf_arg0 input, const float4f_soa& output, uint32_t quat_index) RTM_NO_EXCEPT
+		{
+			output.x[quat_index] = quat_get_x(input);
+			output.y[quat_index] = quat_get_y(input);
+			output.z[quat_index] = quat_get_z(input);
+			output.w[quat_index] = quat_get_w(input);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a normalized quaternion in 32 bits with the smallest three encoding: 2 bits
+	// for the index of the largest component and 10 bits for each remaining component.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL pack_quat_smallest_three_32(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4f smallest;
+		const uint32_t largest_index = rtm_impl::quat_smallest_three_split(input, 1023.0F, smallest);
+
+		const uint32_t a = uint32_t(vector_get_x(smallest));
+		const uint32_t b = uint32_t(vector_get_y(smallest));
+		const uint32_t c = uint32_t(vector_get_z(smallest));
+		return largest_index | (a << 2) | (b << 12) | (c << 22);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks a quaternion packed with pack_quat_smallest_three_32.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL unpack_quat_smallest_three_32(uint32_t input) RTM_NO_EXCEPT
+	{
+		const vector4f smallest = vector_set(float((input >> 2) & 0x3FF), float((input >> 12) & 0x3FF), float(input >> 22), 0.0F);
+		return rtm_impl::quat_from_smallest_three(input & 0x3, smallest, 1023.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a normalized quaternion in the 48 least significant bits with the smallest three encoding:
+	// 2 bits for the index of the largest component and 15 bits for each remaining component.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint64_t RTM_SIMD_CALL pack_quat_smallest_three_48(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4f smallest;
+		const uint32_t largest_index = rtm_impl::quat_smallest_three_split(input, 32767.0F, smallest);
+
+		const uint64_t a = uint64_t(vector_get_x(smallest));
+		const uint64_t b = uint64_t(vector_get_y(smallest));
+		const uint64_t c = uint64_t(vector_get_z(smallest));
+		return uint64_t(largest_index) | (a << 2) | (b << 17) | (c << 32);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks a quaternion packed with pack_quat_smallest_three_48.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL unpack_quat_smallest_three_48(uint64_t input) RTM_NO_EXCEPT
+	{
+		const vector4f smallest = vector_set(float((input >> 2) & 0x7FFF), float((input >> 17) & 0x7FFF), float((input >> 32) & 0x7FFF), 0.0F);
+		return rtm_impl::quat_from_smallest_three(uint32_t(input & 0x3), smallest, 32767.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a normalized quaternion in 64 bits with the smallest three encoding: 2 bits
+	// for the index of the largest component and 20 bits for each remaining component.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint64_t RTM_SIMD_CALL pack_quat_smallest_three_64(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		vector4f smallest;
+		const uint32_t largest_index = rtm_impl::quat_smallest_three_split(input, 1048575.0F, smallest);
+
+		const uint64_t a = uint64_t(vector_get_x(smallest));
+		const uint64_t b = uint64_t(vector_get_y(smallest));
+		const uint64_t c = uint64_t(vector_get_z(smallest));
+		return uint64_t(largest_index) | (a << 2) | (b << 22) | (c << 42);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks a quaternion packed with pack_quat_smallest_three_64.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL unpack_quat_smallest_three_64(uint64_t input) RTM_NO_EXCEPT
+	{
+		const vector4f smallest = vector_set(float((input >> 2) & 0xFFFFF), float((input >> 22) & 0xFFFFF), float((input >> 42) & 0xFFFFF), 0.0F);
+		return rtm_impl::quat_from_smallest_three(uint32_t(input & 0x3), smallest, 1048575.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_quats' quaternions packed with pack_quat_smallest_three_32 into structure of arrays.
+	// Four quaternions are reconstructed per step with SoA math.
+	// The output streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_quat_smallest_three_32_soa(const uint32_t* input, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_quat_smallest_three_32_soa", num_quats, num_quats * (sizeof(uint32_t) + sizeof(float) * 4));
+		uint32_t quat_index = 0;
+
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			// Every field has the same bit offset in each lane, a plain shift and mask extracts it
+			const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + quat_index));
+			const __m128i mask = _mm_set1_epi32(0x3FF);
+
+			const vector4f largest_index = _mm_cvtepi32_ps(_mm_and_si128(packed, _mm_set1_epi32(0x3)));
+			const vector4f smallest_a = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 2), mask));
+			const vector4f smallest_b = _mm_cvtepi32_ps(_mm_and_si128(_mm_srli_epi32(packed, 12), mask));
+			const vector4f smallest_c = _mm_cvtepi32_ps(_mm_srli_epi32(packed, 22));
+#elif defined(RTM_NEON_INTRINSICS)
+			const uint32x4_t packed = vld1q_u32(input + quat_index);
+			const uint32x4_t mask = vdupq_n_u32(0x3FF);
+
+			const vector4f largest_index = vcvtq_f32_u32(vandq_u32(packed, vdupq_n_u32(0x3)));
+			const vector4f smallest_a = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 2), mask));
+			const vector4f smallest_b = vcvtq_f32_u32(vandq_u32(vshrq_n_u32(packed, 12), mask));
+			const vector4f smallest_c = vcvtq_f32_u32(vshrq_n_u32(packed, 22));
+#else
+			const uint32_t* packed = input + quat_index;
+
+			const vector4f largest_index = vector_set(float(packed[0] & 0x3), float(packed[1] & 0x3), float(packed[2] & 0x3), float(packed[3] & 0x3));
+			const vector4f smallest_a = vector_set(float((packed[0] >> 2) & 0x3FF), float((packed[1] >> 2) & 0x3FF), float((packed[2] >> 2) & 0x3FF), float((packed[3] >> 2) & 0x3FF));
+			const vector4f smallest_b = vector_set(float((packed[0] >> 12) & 0x3FF), float((packed[1] >> 12) & 0x3FF), float((packed[2] >> 12) & 0x3FF), float((packed[3] >> 12) & 0x3FF));
+			const vector4f smallest_c = vector_set(float(packed[0] >> 22), float(packed[1] >> 22), float(packed[2] >> 22), float(packed[3] >> 22));
+#endif
+
+			rtm_impl::quat_from_smallest_three_soa4(largest_index, smallest_a, smallest_b, smallest_c, 1023.0F, output, quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+			rtm_impl::quat_store_soa(unpack_quat_smallest_three_32(input[quat_index]), output, quat_index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_quats' quaternions packed with pack_quat_smallest_three_48 into structure of arrays.
+	// Four quaternions are reconstructed per step with SoA math.
+	// The output streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_quat_smallest_three_48_soa(const uint64_t* input, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_quat_smallest_three_48_soa", num_quats, num_quats * (sizeof(uint64_t) + sizeof(float) * 4));
+		uint32_t quat_index = 0;
+
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			// The fields straddle 32 bit lanes, extract them with scalar code
+			const uint64_t* packed = input + quat_index;
+
+			const vector4f largest_index = vector_set(float(packed[0] & 0x3), float(packed[1] & 0x3), float(packed[2] & 0x3), float(packed[3] & 0x3));
+			const vector4f smallest_a = vector_set(float((packed[0] >> 2) & 0x7FFF), float((packed[1] >> 2) & 0x7FFF), float((packed[2] >> 2) & 0x7FFF), float((packed[3] >> 2) & 0x7FFF));
+			const vector4f smallest_b = vector_set(float((packed[0] >> 17) & 0x7FFF), float((packed[1] >> 17) & 0x7FFF), float((packed[2] >> 17) & 0x7FFF), float((packed[3] >> 17) & 0x7FFF));
+			const vector4f smallest_c = vector_set(float((packed[0] >> 32) & 0x7FFF), float((packed[1] >> 32) & 0x7FFF), float((packed[2] >> 32) & 0x7FFF), float((packed[3] >> 32) & 0x7FFF));
+
+			rtm_impl::quat_from_smallest_three_soa4(largest_index, smallest_a, smallest_b, smallest_c, 32767.0F, output, quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+			rtm_impl::quat_store_soa(unpack_quat_smallest_three_48(input[quat_index]), output, quat_index);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_quats' quaternions packed with pack_quat_smallest_three_64 into structure of arrays.
+	// Four quaternions are reconstructed per step with SoA math.
+	// The output streams do not need to be aligned and any count is supported.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_quat_smallest_three_64_soa(const uint64_t* input, const float4f_soa& output, uint32_t num_quats) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_quat_smallest_three_64_soa", num_quats, num_quats * (sizeof(uint64_t) + sizeof(float) * 4));
+		uint32_t quat_index = 0;
+
+		for (; quat_index + 4 <= num_quats; quat_index += 4)
+		{
+			// The fields straddle 32 bit lanes, extract them with scalar code
+			const uint64_t* packed = input + quat_index;
+
+			const vector4f largest_index = vector_set(float(packed[0] & 0x3), float(packed[1] & 0x3), float(packed[2] & 0x3), float(packed[3] & 0x3));
+			const vector4f smallest_a = vector_set(float((packed[0] >> 2) & 0xFFFFF), float((packed[1] >> 2) & 0xFFFFF), float((packed[2] >> 2) & 0xFFFFF), float((packed[3] >> 2) & 0xFFFFF));
+			const vector4f smallest_b = vector_set(float((packed[0] >> 22) & 0xFFFFF), float((packed[1] >> 22) & 0xFFFFF), float((packed[2] >> 22) & 0xFFFFF), float((packed[3] >> 22) & 0xFFFFF));
+			const vector4f smallest_c = vector_set(float((packed[0] >> 42) & 0xFFFFF), float((packed[1] >> 42) & 0xFFFFF), float((packed[2] >> 42) & 0xFFFFF), float((packed[3] >> 42) & 0xFFFFF));
+
+			rtm_impl::quat_from_smallest_three_soa4(largest_index, smallest_a, smallest_b, smallest_c, 1048575.0F, output, quat_index);
+		}
+
+		for (; quat_index < num_quats; ++quat_index)
+			rtm_impl::quat_store_soa(unpack_quat_smallest_three_64(input[quat_index]), output, quat_index);
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,584 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/matrix3x3f.h"
+#include "rtm/quatf.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/packing/quatf.h"
+#include "rtm/packing/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Octahedral normal encoding
+	// A unit vector is projected onto the octahedron |x| + |y| + |z| = 1 and the lower half
+	// is folded over the upper half, which maps the sphere onto the [-1.0, 1.0] square.
+	// The two coordinates are quantized as signed normalized integers of 8 (16 bit),
+	// 12 (24 bit), or 16 (32 bit) bits each, [x] in the least significant bits.
+	// The 24 bit format leaves the 8 most significant bits of its uint32_t cleared.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the octahedral coordinates in [-1.0, 1.0] of a unit vector in the [xy] components.
+	// The [zw] components are set to 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_to_octahedral(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const float x = vector_get_x(input);
+		const float y = vector_get_y(input);
+		const float z = vector_get_z(input);
+
+		const float inv_l1_norm = 1.0F / (scalar_abs(x) + scalar_abs(y) + scalar_abs(z));
+		const float u = x * inv_l1_norm;
+		const float v = y * inv_l1_norm;
+		if (z >= 0.0F)
+			return vector_set(u, v, 0.0F, 0.0F);
+
+		// The lower hemisphere is folded over the diagonals, the sign of zero is positive
+		const float folded_u = u >= 0.0F ? (1.0F - scalar_abs(v)) : (scalar_abs(v) - 1.0F);
+		const float folded_v = v >= 0.0F ? (1.0F - scalar_abs(u)) : (scalar_abs(u) - 1.0F);
+		return vector_set(folded_u, folded_v, 0.0F, 0.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the unit vector of the octahedral coordinates in the [xy] components of the input.
+	// The [w] component is set to 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_from_octahedral(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const float u = vector_get_x(input);
+		const float v = vector_get_y(input);
+		const float z = 1.0F - scalar_abs(u) - scalar_abs(v);
+
+		// Unfold the lower hemisphere
+		const float fold = scalar_max(-z, 0.0F);
+		const float x = u >= 0.0F ? (u - fold) : (u + fold);
+		const float y = v >= 0.0F ? (v - fold) : (v + fold);
+		return vector_normalize3(vector_set(x, y, z, 0.0F));
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Computes the octahedral coordinates of 4 unit vectors stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL octahedral_encode4(vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, vector4f& out_u, vector4f& out_v) RTM_NO_EXCEPT
+		{
+			const vector4f zero = vector_zero();
+			const vector4f one = vector_set(1.0F);
+
+			const vector4f inv_l1_norm = vector_div(one, vector_add(vector_add(vector_abs(x), vector_abs(y)), vector_abs(z)));
+			const vector4f u = vector_mul(x, inv_l1_norm);
+			const vector4f v = vector_mul(y, inv_l1_norm);
+
+			const vector4f folded_u = vector_select(vector_greater_equal(u, zero), vector_sub(one, vector_abs(v)), vector_sub(vector_abs(v), one));
+			const vector4f folded_v = vector_select(vector_greater_equal(v, zero), vector_sub(one, vector_abs(u)), vector_sub(vector_abs(u), one));
+
+			const mask4f is_lower = vector_less_than(z, zero);
+			out_u = vector_select(is_lower, folded_u, u);
+			out_v = vector_select(is_lower, folded_v, v);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Computes the unit vectors of 4 octahedral coordinates stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL octahedral_decode4(vector4f_arg0 u, vector4f_arg1 v, vector4f& out_x, vector4f& out_y, vector4f& out_z) RTM_NO_EXCEPT
+		{
+			const vector4f zero = vector_zero();
+
+			const vector4f z = vector_sub(vector_sub(vector_set(1.0F), vector_abs(u)), vector_abs(v));
+
+			const vector4f fold = vector_max(vector_neg(z), zero);
+			const vector4f x = vector_sub(u, vector_select(vector_greater_equal(u, zero), fold, vector_neg(fold)));
+			const vector4f y = vector_sub(v, vector_select(vector_greater_equal(v, zero), fold, vector_neg(fold)));
+
+			const vector4f inv_length = vector_div(vector_set(1.0F), vector_sqrt(vector_mul_add(z, z, vector_mul_add(y, y, vector_mul(x, x)))));
+			out_x = vector_mul(x, inv_length);
+			out_y = vector_mul(y, inv_length);
+			out_z = vector_mul(z, inv_length);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Packs octahedral coordinates as two signed normalized integers of 'num_bits_per_axis' bits.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_bits_per_axis>
+		inline uint32_t pack_octahedral(float u, float v) RTM_NO_EXCEPT
+		{
+			constexpr float max_value = float((1U << (num_bits_per_axis - 1)) - 1);
+			constexpr uint32_t mask = (1U << num_bits_per_axis) - 1;
+
+			const uint32_t packed_u = uint32_t(int32_t(scalar_round_symmetric(scalar_clamp(u, -1.0F, 1.0F) * max_value))) & mask;
+			const uint32_t packed_v = uint32_t(int32_t(scalar_round_symmetric(scalar_clamp(v, -1.0F, 1.0F) * max_value))) & mask;
+			return packed_u | (packed_v << num_bits_per_axis);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the octahedral coordinates packed as two signed normalized integers of 'num_bits_per_axis' bits.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_bits_per_axis>
+		inline vector4f unpack_octahedral(uint32_t input) RTM_NO_EXCEPT
+		{
+			constexpr float inv_max_value = 1.0F / float((1U << (num_bits_per_axis - 1)) - 1);
+
+			// Shift each field to the top and back down to sign extend it, the most negative integer unpacks to -1.0 as well
+			const float u = scalar_max(float(int32_t(input << (32 - num_bits_per_axis)) >> (32 - num_bits_per_axis)) * inv_max_value, -1.0F);
+			const float v = scalar_max(float(int32_t(input << (32 - num_bits_per_axis * 2)) >> (32 - num_bits_per_axis)) * inv_max_value, -1.0F);
+			return vector_set(u, v, 0.0F, 0.0F);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Packs 4 octahedral coordinates stored as structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_bits_per_axis, typename packed_type>
+		inline void RTM_SIMD_CALL pack_octahedral4(vector4f_arg0 u, vector4f_arg1 v, packed_type* output) RTM_NO_EXCEPT
+		{
+			constexpr float max_value = float((1U << (num_bits_per_axis - 1)) - 1);
+			constexpr uint32_t mask = (1U << num_bits_per_axis) - 1;
+
+			const vector4f min_value = vector_set(-1.0F);
+			const vector4f one = vector_set(1.0F);
+			const vector4f scaled_u = vector_round_symmetric(vector_mul(vector_clamp(u, min_value, one), max_value));
+			const vector4f scaled_v = vector_round_symmetric(vector_mul(vector_clamp(v, min_value, one), max_value));
+
+#if defined(RTM_SSE2_INTRINSICS)
+			// The values are integral, the conversion is exact
+			const __m128i mask_i32 = _mm_set1_epi32(int32_t(mask));
+			const __m128i packed = _mm_or_si128(_mm_and_si128(_mm_cvttps_epi32(scaled_u), mask_i32), _mm_slli_epi32(_mm_and_si128(_mm_cvttps_epi32(scaled_v), mask_i32), num_bits_per_axis));
+
+			alignas(16) uint32_t packed_u32[4];
+			_mm_store_si128(reinterpret_cast<__m128i*>(&packed_u32[0]), packed);
+#else
+			alignas(16) float u_f32[4];
+			alignas(16) float v_f32[4];
+			vector_store(scaled_u, &u_f32[0]);
+			vector_store(scaled_v, &v_f32[0]);
+
+			uint32_t packed_u32[4];
+			for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+				packed_u32[lane_index] = (uint32_t(int32_t(u_f32[lane_index])) & mask) | ((uint32_t(int32_t(v_f32[lane_index])) & mask) << num_bits_per_axis);
+#endif
+
+			for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+				output[lane_index] = packed_type(packed_u32[lane_index]);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unpacks 4 octahedral coordinates into structure of arrays.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_bits_per_axis, typename packed_type>
+		inline void unpack_octahedral4(const packed_type* input, vector4f& out_u, vector4f& out_v) RTM_NO_EXCEPT
+		{
+			constexpr float inv_max_value = 1.0F / float((1U << (num_bits_per_axis - 1)) - 1);
+			const vector4f min_value = vector_set(-1.0F);
+
+#if defined(RTM_SSE2_INTRINSICS)
+			__m128i packed;
+			if (sizeof(packed_type) == sizeof(uint16_t))
+				packed = _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)), _mm_setzero_si128());
+			else
+				packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+
+			// Shift each field to the top of its lane and back down to sign extend it
+			const vector4f u = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(packed, 32 - num_bits_per_axis), 32 - num_bits_per_axis));
+			const vector4f v = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_slli_epi32(packed, 32 - num_bits_per_axis * 2), 32 - num_bits_per_axis));
+#else
+			float u_f32[4];
+			float v_f32[4];
+			for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			{
+				const uint32_t packed = uint32_t(input[lane_index]);
+				u_f32[lane_index] = float(int32_t(packed << (32 - num_bits_per_axis)) >> (32 - num_bits_per_axis));
+				v_f32[lane_index] = float(int32_t(packed << (32 - num_bits_per_axis * 2)) >> (32 - num_bits_per_axis));
+			}
+
+			const vector4f u = vector_load(&u_f32[0]);
+			const vector4f v = vector_load(&v_f32[0]);
+#endif
+
+			out_u = vector_max(vector_mul(u, inv_max_value), min_value);
+			out_v = vector_max(vector_mul(v, inv_max_value), min_value);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Packs 'num_normals' unit vectors stored as structure of arrays, 4 at a time.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_bits_per_axis, typename packed_type>
+		inline void pack_normal_octahedral_soa(const const_float3f_soa& input, packed_type* output, uint32_t num_normals) RTM_NO_EXCEPT
+		{
+			uint32_t normal_index = 0;
+			for (; normal_index + 4 <= num_normals; normal_index += 4)
+			{
+				vector4f u;
+				vector4f v;
+				octahedral_encode4(vector_load(input.x + normal_index), vector_load(input.y + normal_index), vector_load(input.z + normal_index), u, v);
+				pack_octahedral4<num_bits_per_axis>(u, v, output + normal_index);
+			}
+
+			for (; normal_index < num_normals; ++normal_index)
+			{
+				const vector4f uv = vector_to_octahedral(vector_set(input.x[normal_index], input.y[normal_index], input.z[normal_index]));
+				output[normal_index] = packed_type(pack_octahedral<num_bits_per_axis>(vector_get_x(uv), vector_get_y(uv)));
+			}
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Unpacks 'num_normals' unit vectors into structure of arrays, 4 at a time.
+		//////////////////////////////////////////////////////////////////////////
+		template<uint32_t num_bits_per_axis, typename packed_type>
+		inline void unpack_normal_octahedral_soa(const packed_type* input, const float3f_soa& output, uint32_t num_normals) RTM_NO_EXCEPT
+		{
+			uint32_t normal_index = 0;
+			for (; normal_index + 4 <= num_normals; normal_index += 4)
+			{
+				vector4f u;
+				vector4f v;
+				unpack_octahedral4<num_bits_per_axis>(input + normal_index, u, v);
+
+				vector4f x;
+				vector4f y;
+				vector4f z;
+				octahedral_decode4(u, v, x, y, z);
+
+				vector_store(x, output.x + normal_index);
+				vector_store(y, output.y + normal_index);
+				vector_store(z, output.z + normal_index);
+			}
+
+			for (; normal_index < num_normals; ++normal_index)
+			{
+				const vector4f normal = vector_from_octahedral(unpack_octahedral<num_bits_per_axis>(uint32_t(input[normal_index])));
+				output.x[normal_index] = vector_get_x(normal);
+				output.y[normal_index] = vector_get_y(normal);
+				output.z[normal_index] = vector_get_z(normal);
+			}
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a unit vector in 16 bits with the octahedral encoding, 8 bits per axis.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint16_t RTM_SIMD_CALL pack_normal_octahedral_16(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f uv = vector_to_octahedral(input);
+		return uint16_t(rtm_impl::pack_octahedral<8>(vector_get_x(uv), vector_get_y(uv)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks a unit vector packed with pack_normal_octahedral_16.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_normal_octahedral_16(uint16_t input) RTM_NO_EXCEPT
+	{
+		return vector_from_octahedral(rtm_impl::unpack_octahedral<8>(input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a unit vector in the 24 least significant bits with the octahedral encoding, 12 bits per axis.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL pack_normal_octahedral_24(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f uv = vector_to_octahedral(input);
+		return rtm_impl::pack_octahedral<12>(vector_get_x(uv), vector_get_y(uv));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks a unit vector packed with pack_normal_octahedral_24.
+	// The 8 most significant bits are ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_normal_octahedral_24(uint32_t input) RTM_NO_EXCEPT
+	{
+		return vector_from_octahedral(rtm_impl::unpack_octahedral<12>(input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a unit vector in 32 bits with the octahedral encoding, 16 bits per axis.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL pack_normal_octahedral_32(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f uv = vector_to_octahedral(input);
+		return rtm_impl::pack_octahedral<16>(vector_get_x(uv), vector_get_y(uv));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks a unit vector packed with pack_normal_octahedral_32.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_normal_octahedral_32(uint32_t input) RTM_NO_EXCEPT
+	{
+		return vector_from_octahedral(rtm_impl::unpack_octahedral<16>(input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// QTangent encoding
+	// A tangent frame (tangent, bitangent, normal) is stored as the quaternion of the rotation
+	// whose [x] axis is the tangent and whose [z] axis is the normal. When the bitangent is
+	// reflected, i.e. it points opposite to cross(normal, tangent), the quaternion is negated
+	// for its [w] component to be negative. To preserve that sign, [w] is biased away from zero.
+	// The tangent frame is stored as a normal and a tangent whose [w] component holds the
+	// bitangent sign (1.0 or -1.0): bitangent = cross(normal, tangent) * tangent.w.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the QTangent of a tangent frame. The tangent is made orthogonal to the normal first.
+	// 'w_bias' is the smallest [w] magnitude, it must survive the quantization used to store it.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL qtangent_from_tangent_frame(vector4f_arg0 normal, vector4f_arg1 tangent, float w_bias = 1.0F / 32767.0F) RTM_NO_EXCEPT
+	{
+		const float normal_dot_tangent = vector_dot3(normal, tangent);
+		const vector4f orthogonal_tangent = vector_normalize3(vector_neg_mul_sub(normal, normal_dot_tangent, tangent));
+		const vector4f bitangent = vector_cross3(normal, orthogonal_tangent);
+
+		quatf rotation = quat_ensure_positive_w(quat_from_matrix(matrix_set(orthogonal_tangent, bitangent, normal)));
+
+		if (quat_get_w(rotation) < w_bias)
+		{
+			// Scale the [xyz] components to keep the quaternion normalized
+			const float xyz_length_squared = vector_length_squared3(quat_to_vector(rotation));
+			const float xyz_scale = scalar_sqrt(1.0F - w_bias * w_bias) * scalar_sqrt_reciprocal(xyz_length_squared);
+			rotation = quat_set_w(vector_to_quat(vector_mul(quat_to_vector(rotation), xyz_scale)), w_bias);
+		}
+
+		return vector_get_w(tangent) < 0.0F ? quat_neg(rotation) : rotation;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Computes the tangent frame of a QTangent. The quaternion must be normalized.
+	// The [w] component of the tangent is set to the bitangent sign.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qtangent_to_tangent_frame(quatf_arg0 input, vector4f& out_normal, vector4f& out_tangent) RTM_NO_EXCEPT
+	{
+		const float x = quat_get_x(input);
+		const float y = quat_get_y(input);
+		const float z = quat_get_z(input);
+		const float w = quat_get_w(input);
+
+		// The [z] and [x] axes of matrix_from_quat, the sign of the quaternion cancels out
+		const float x2 = x + x;
+		const float y2 = y + y;
+		const float z2 = z + z;
+		const float xx = x * x2;
+		const float xy = x * y2;
+		const float xz = x * z2;
+		const float yy = y * y2;
+		const float yz = y * z2;
+		const float zz = z * z2;
+		const float wx = w * x2;
+		const float wy = w * y2;
+		const float wz = w * z2;
+
+		out_normal = vector_set(xz + wy, yz - wx, 1.0F - (xx + yy), 0.0F);
+		out_tangent = vector_set(1.0F - (yy + zz), xy + wz, xz - wy, w >= 0.0F ? 1.0F : -1.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a tangent frame in 64 bits as a QTangent with 16 bit signed normalized components.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint64_t RTM_SIMD_CALL pack_qtangent_snorm16(vector4f_arg0 normal, vector4f_arg1 tangent) RTM_NO_EXCEPT
+	{
+		return pack_vector4_snorm16(quat_to_vector(qtangent_from_tangent_frame(normal, tangent, 1.0F / 32767.0F)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks a tangent frame packed with pack_qtangent_snorm16.
+	// The [w] component of the tangent is set to the bitangent sign.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL unpack_qtangent_snorm16(uint64_t input, vector4f& out_normal, vector4f& out_tangent) RTM_NO_EXCEPT
+	{
+		qtangent_to_tangent_frame(quat_normalize(vector_to_quat(unpack_vector4_snorm16(input))), out_normal, out_tangent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Batch variants
+	// The packing variants process one value at a time. The unpacking variants decode
+	// 4 values per step with SoA math, the output streams do not need to be aligned.
+	// The input and output must not overlap.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_normals' unit vectors, see pack_normal_octahedral_16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_normal_octahedral_16_soa(const const_float3f_soa& input, uint16_t* output, uint32_t num_normals) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::pack_normal_octahedral_16_soa", num_normals, num_normals * (sizeof(float) * 3 + sizeof(uint16_t)));
+		rtm_impl::pack_normal_octahedral_soa<8>(input, output, num_normals);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_normals' unit vectors, see unpack_normal_octahedral_16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_normal_octahedral_16_soa(const uint16_t* input, const float3f_soa& output, uint32_t num_normals) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_normal_octahedral_16_soa", num_normals, num_normals * (sizeof(uint16_t) + sizeof(float) * 3));
+		rtm_impl::unpack_normal_octahedral_soa<8>(input, output, num_normals);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_normals' unit vectors, see pack_normal_octahedral_24.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_normal_octahedral_24_soa(const const_float3f_soa& input, uint32_t* output, uint32_t num_normals) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::pack_normal_octahedral_24_soa", num_normals, num_normals * (sizeof(float) * 3 + sizeof(uint32_t)));
+		rtm_impl::pack_normal_octahedral_soa<12>(input, output, num_normals);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_normals' unit vectors, see unpack_normal_octahedral_24.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_normal_octahedral_24_soa(const uint32_t* input, const float3f_soa& output, uint32_t num_normals) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_normal_octahedral_24_soa", num_normals, num_normals * (sizeof(uint32_t) + sizeof(float) * 3));
+		rtm_impl::unpack_normal_octahedral_soa<12>(input, output, num_normals);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_normals' unit vectors, see pack_normal_octahedral_32.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_normal_octahedral_32_soa(const const_float3f_soa& input, uint32_t* output, uint32_t num_normals) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::pack_normal_octahedral_32_soa", num_normals, num_normals * (sizeof(float) * 3 + sizeof(uint32_t)));
+		rtm_impl::pack_normal_octahedral_soa<16>(input, output, num_normals);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_normals' unit vectors, see unpack_normal_octahedral_32.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_normal_octahedral_32_soa(const uint32_t* input, const float3f_soa& output, uint32_t num_normals) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_normal_octahedral_32_soa", num_normals, num_normals * (sizeof(uint32_t) + sizeof(float) * 3));
+		rtm_impl::unpack_normal_octahedral_soa<16>(input, output, num_normals);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_vertices' tangent frames, see pack_qtangent_snorm16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_qtangent_snorm16_aos(const float3f* normals, const float4f* tangents, uint64_t* output, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::pack_qtangent_snorm16_aos", num_vertices, num_vertices * (sizeof(float3f) + sizeof(float4f) + sizeof(uint64_t)));
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+			output[vertex_index] = pack_qtangent_snorm16(vector_load3(normals + vertex_index), vector_load(tangents + vertex_index));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs 'num_vertices' tangent frames stored as structure of arrays, see pack_qtangent_snorm16.
+	// This matches the output of mesh_vertex_normals_soa(..) and mesh_vertex_tangents_soa(..)
+	// from rtm/batch/mesh.h.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_qtangent_snorm16_soa(const const_float3f_soa& normals, const const_float4f_soa& tangents, uint64_t* output, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::pack_qtangent_snorm16_soa", num_vertices, num_vertices * (sizeof(float) * 7 + sizeof(uint64_t)));
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		{
+			const vector4f normal = vector_set(normals.x[vertex_index], normals.y[vertex_index], normals.z[vertex_index]);
+			const vector4f tangent = vector_set(tangents.x[vertex_index], tangents.y[vertex_index], tangents.z[vertex_index], tangents.w[vertex_index]);
+			output[vertex_index] = pack_qtangent_snorm16(normal, tangent);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 'num_vertices' tangent frames into structure of arrays, see unpack_qtangent_snorm16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_qtangent_snorm16_soa(const uint64_t* input, const float3f_soa& out_normals, const float4f_soa& out_tangents, uint32_t num_vertices) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_qtangent_snorm16_soa", num_vertices, num_vertices * (sizeof(uint64_t) + sizeof(float) * 7));
+
+		uint32_t vertex_index = 0;
+		for (; vertex_index + 4 <= num_vertices; vertex_index += 4)
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			// Transpose the 16 bit components of 4 quaternions and sign extend them
+			const __m128i packed01 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + vertex_index + 0));
+			const __m128i packed23 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + vertex_index + 2));
+			const __m128i x02y02z02w02 = _mm_unpacklo_epi16(packed01, packed23);
+			const __m128i x13y13z13w13 = _mm_unpackhi_epi16(packed01, packed23);
+			const __m128i xy = _mm_unpacklo_epi16(x02y02z02w02, x13y13z13w13);
+			const __m128i zw = _mm_unpackhi_epi16(x02y02z02w02, x13y13z13w13);
+
+			const vector4f packed_x = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(xy, xy), 16));
+			const vector4f packed_y = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(xy, xy), 16));
+			const vector4f packed_z = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(zw, zw), 16));
+			const vector4f packed_w = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(zw, zw), 16));
+#else
+			const uint64_t* packed = input + vertex_index;
+			const vector4f packed_x = vector_set(float(int16_t(packed[0] & 0xFFFF)), float(int16_t(packed[1] & 0xFFFF)), float(int16_t(packed[2] & 0xFFFF)), float(int16_t(packed[3] & 0xFFFF)));
+			const vector4f packed_y = vector_set(float(int16_t((packed[0] >> 16) & 0xFFFF)), float(int16_t((packed[1] >> 16) & 0xFFFF)), float(int16_t((packed[2] >> 16) & 0xFFFF)), float(int16_t((packed[3] >> 16) & 0xFFFF)));
+			const vector4f packed_z = vector_set(float(int16_t((packed[0] >> 32) & 0xFFFF)), float(int16_t((packed[1] >> 32) & 0xFFFF)), float(int16_t((packed[2] >> 32) & 0xFFFF)), float(int16_t((packed[3] >> 32) & 0xFFFF)));
+			const vector4f packed_w = vector_set(float(int16_t(packed[0] >> 48)), float(int16_t(packed[1] >> 48)), float(int16_t(packed[2] >> 48)), float(int16_t(packed[3] >> 48)));
+#endif
+
+			// The quantization scale cancels out when normalizing
+			const vector4f inv_length = vector_div(vector_set(1.0F), vector_sqrt(vector_mul_add(packed_w, packed_w, vector_mul_add(packed_z, packed_z, vector_mul_add(packed_y, packed_y, vector_mul(packed_x, packed_x))))));
+			const vector4f x = vector_mul(packed_x, inv_length);
+			const vector4f y = vector_mul(packed_y, inv_length);
+			const vector4f z = vector_mul(packed_z, inv_length);
+			const vector4f w = vector_mul(packed_w, inv_length);
+
+			const vector4f one = vector_set(1.0F);
+			const vector4f x2 = vector_add(x, x);
+			const vector4f y2 = vector_add(y, y);
+			const vector4f z2 = vector_add(z, z);
+			const vector4f xx = vector_mul(x, x2);
+			const vector4f xy2 = vector_mul(x, y2);
+			const vector4f xz = vector_mul(x, z2);
+			const vector4f yy = vector_mul(y, y2);
+			const vector4f yz = vector_mul(y, z2);
+			const vector4f zz = vector_mul(z, z2);
+			const vector4f wx = vector_mul(w, x2);
+			const vector4f wy = vector_mul(w, y2);
+			const vector4f wz = vector_mul(w, z2);
+
+			vector_store(vector_add(xz, wy), out_normals.x + vertex_index);
+			vector_store(vector_sub(yz, wx), out_normals.y + vertex_index);
+			vector_store(vector_sub(one, vector_add(xx, yy)), out_normals.z + vertex_index);
+
+			vector_store(vector_sub(one, vector_add(yy, zz)), out_tangents.x + vertex_index);
+			vector_store(vector_add(xy2, wz), out_tangents.y + vertex_index);
+			vector_store(vector_sub(xz, wy), out_tangents.z + vertex_index);
+			vector_store(vector_select(vector_greater_equal(w, vector_zero()), one, vector_neg(one)), out_tangents.w + vertex_index);
+		}
+
+		for (; vertex_index < num_vertices; ++vertex_index)
+		{
+			vector4f normal;
+			vector4f tangent;
+			unpack_qtangent_snorm16(input[vertex_index], normal, tangent);
+
+			out_normals.x[vertex_index] = vector_get_x(normal);
+			out_normals.y[vertex_index] = vector_get_y(normal);
+			out_normals.z[vertex_index] = vector_get_z(normal);
+			out_tangents.x[vertex_index] = vector_get_x(tangent);
+			out_tangents.y[vertex_index] = vector_get_y(tangent);
+			out_tangents.z[vertex_index] = vector_get_z(tangent);
+			out_tangents.w[vertex_index] = vector_get_w(tangent);
+		}
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,559 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Normalized integer formats
+	// Unsigned normalized (unorm) components map [0.0, 1.0] onto [0, 2^N - 1].
+	// Signed normalized (snorm) components map [-1.0, 1.0] onto [-(2^(N-1) - 1), 2^(N-1) - 1]
+	// and the most negative integer value unpacks to -1.0 as well.
+	// Inputs are clamped to the representable range and rounded to the nearest integer.
+	// Component [x] is stored in the least significant bits, followed by [y], [z], and [w].
+	// On little endian platforms, the 8 and 16 bit formats thus match the memory layout of
+	// uint8_t[4] and uint16_t[4] respectively.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the input remapped from [range_min, range_min + range_extent] to [0.0, 1.0]
+	// for it to be packed with an unsigned normalized format.
+	// Components with a zero extent are set to 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_range_reduce(vector4f_arg0 input, vector4f_arg1 range_min, vector4f_arg2 range_extent) RTM_NO_EXCEPT
+	{
+		const vector4f zero = vector_zero();
+		const vector4f inv_range_extent = vector_select(vector_equal(range_extent, zero), zero, vector_reciprocal(range_extent));
+		return vector_mul(vector_sub(input, range_min), inv_range_extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the input remapped from [0.0, 1.0] to [range_min, range_min + range_extent].
+	// This is the inverse of vector_range_reduce.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_range_expand(vector4f_arg0 input, vector4f_arg1 range_min, vector4f_arg2 range_extent) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(input, range_extent, range_min);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a vector4 in [0.0, 1.0] as 4x 8 bit unsigned normalized components.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL pack_vector4_unorm8(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f scaled = vector_round_symmetric(vector_mul(vector_clamp(input, vector_zero(), vector_set(1.0F)), 255.0F));
+
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i scaled_i32 = _mm_cvttps_epi32(scaled);
+		const __m128i scaled_i16 = _mm_packs_epi32(scaled_i32, scaled_i32);
+		return uint32_t(_mm_cvtsi128_si32(_mm_packus_epi16(scaled_i16, scaled_i16)));
+#else
+		const uint32_t x = uint32_t(vector_get_x(scaled));
+		const uint32_t y = uint32_t(vector_get_y(scaled));
+		const uint32_t z = uint32_t(vector_get_z(scaled));
+		const uint32_t w = uint32_t(vector_get_w(scaled));
+		return x | (y << 8) | (z << 16) | (w << 24);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 4x 8 bit unsigned normalized components into a vector4 in [0.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_vector4_unorm8(uint32_t input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i zero = _mm_setzero_si128();
+		const __m128i input_u8 = _mm_cvtsi32_si128(int32_t(input));
+		const __m128i input_u32 = _mm_unpacklo_epi16(_mm_unpacklo_epi8(input_u8, zero), zero);
+		return _mm_mul_ps(_mm_cvtepi32_ps(input_u32), _mm_set_ps1(1.0F / 255.0F));
+#elif defined(RTM_NEON_INTRINSICS)
+		const uint16x8_t input_u16 = vmovl_u8(vcreate_u8(uint64_t(input)));
+		const uint32x4_t input_u32 = vmovl_u16(vget_low_u16(input_u16));
+		return vmulq_n_f32(vcvtq_f32_u32(input_u32), 1.0F / 255.0F);
+#else
+		const float x = float(input & 0xFF);
+		const float y = float((input >> 8) & 0xFF);
+		const float z = float((input >> 16) & 0xFF);
+		const float w = float(input >> 24);
+		return vector_mul(vector_set(x, y, z, w), 1.0F / 255.0F);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a vector4 in [-1.0, 1.0] as 4x 8 bit signed normalized components.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL pack_vector4_snorm8(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f scaled = vector_round_symmetric(vector_mul(vector_clamp(input, vector_set(-1.0F), vector_set(1.0F)), 127.0F));
+
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i scaled_i32 = _mm_cvttps_epi32(scaled);
+		const __m128i scaled_i16 = _mm_packs_epi32(scaled_i32, scaled_i32);
+		return uint32_t(_mm_cvtsi128_si32(_mm_packs_epi16(scaled_i16, scaled_i16)));
+#else
+		const uint32_t x = uint32_t(int32_t(vector_get_x(scaled))) & 0xFF;
+		const uint32_t y = uint32_t(int32_t(vector_get_y(scaled))) & 0xFF;
+		const uint32_t z = uint32_t(int32_t(vector_get_z(scaled))) & 0xFF;
+		const uint32_t w = uint32_t(int32_t(vector_get_w(scaled))) & 0xFF;
+		return x | (y << 8) | (z << 16) | (w << 24);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 4x 8 bit signed normalized components into a vector4 in [-1.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_vector4_snorm8(uint32_t input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Replicate each byte within its 32 bit lane and shift it back down to sign extend it
+		__m128i input_i32 = _mm_cvtsi32_si128(int32_t(input));
+		input_i32 = _mm_unpacklo_epi8(input_i32, input_i32);
+		input_i32 = _mm_srai_epi32(_mm_unpacklo_epi16(input_i32, input_i32), 24);
+		return _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(input_i32), _mm_set_ps1(1.0F / 127.0F)), _mm_set_ps1(-1.0F));
+#elif defined(RTM_NEON_INTRINSICS)
+		const int16x8_t input_i16 = vmovl_s8(vcreate_s8(uint64_t(input)));
+		const int32x4_t input_i32 = vmovl_s16(vget_low_s16(input_i16));
+		return vmaxq_f32(vmulq_n_f32(vcvtq_f32_s32(input_i32), 1.0F / 127.0F), vdupq_n_f32(-1.0F));
+#else
+		const float x = float(int8_t(input & 0xFF));
+		const float y = float(int8_t((input >> 8) & 0xFF));
+		const float z = float(int8_t((input >> 16) & 0xFF));
+		const float w = float(int8_t(input >> 24));
+		return vector_max(vector_mul(vector_set(x, y, z, w), 1.0F / 127.0F), vector_set(-1.0F));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a vector4 in [0.0, 1.0] as 4x 16 bit unsigned normalized components.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint64_t RTM_SIMD_CALL pack_vector4_unorm16(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f scaled = vector_round_symmetric(vector_mul(vector_clamp(input, vector_zero(), vector_set(1.0F)), 65535.0F));
+
+#if defined(RTM_SSE2_INTRINSICS)
+		// SSE2 lacks an unsigned saturating pack, bias the values to fit in a signed 16 bit integer and flip the sign bit back
+		const __m128i scaled_i32 = _mm_sub_epi32(_mm_cvttps_epi32(scaled), _mm_set1_epi32(32768));
+		const __m128i scaled_u16 = _mm_xor_si128(_mm_packs_epi32(scaled_i32, scaled_i32), _mm_set1_epi16(-32768));
+
+		uint64_t result;
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(&result), scaled_u16);
+		return result;
+#else
+		const uint64_t x = uint64_t(vector_get_x(scaled));
+		const uint64_t y = uint64_t(vector_get_y(scaled));
+		const uint64_t z = uint64_t(vector_get_z(scaled));
+		const uint64_t w = uint64_t(vector_get_w(scaled));
+		return x | (y << 16) | (z << 32) | (w << 48);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 4x 16 bit unsigned normalized components into a vector4 in [0.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_vector4_unorm16(uint64_t input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i input_u16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&input));
+		const __m128i input_u32 = _mm_unpacklo_epi16(input_u16, _mm_setzero_si128());
+		return _mm_mul_ps(_mm_cvtepi32_ps(input_u32), _mm_set_ps1(1.0F / 65535.0F));
+#elif defined(RTM_NEON_INTRINSICS)
+		const uint32x4_t input_u32 = vmovl_u16(vcreate_u16(input));
+		return vmulq_n_f32(vcvtq_f32_u32(input_u32), 1.0F / 65535.0F);
+#else
+		const float x = float(input & 0xFFFF);
+		const float y = float((input >> 16) & 0xFFFF);
+		const float z = float((input >> 32) & 0xFFFF);
+		const float w = float(input >> 48);
+		return vector_mul(vector_set(x, y, z, w), 1.0F / 65535.0F);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a vector4 in [-1.0, 1.0] as 4x 16 bit signed normalized components.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint64_t RTM_SIMD_CALL pack_vector4_snorm16(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f scaled = vector_round_symmetric(vector_mul(vector_clamp(input, vector_set(-1.0F), vector_set(1.0F)), 32767.0F));
+
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128i scaled_i32 = _mm_cvttps_epi32(scaled);
+
+		uint64_t result;
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(&result), _mm_packs_epi32(scaled_i32, scaled_i32));
+		return result;
+#else
+		const uint64_t x = uint64_t(int64_t(vector_get_x(scaled))) & 0xFFFF;
+		const uint64_t y = uint64_t(int64_t(vector_get_y(scaled))) & 0xFFFF;
+		const uint64_t z = uint64_t(int64_t(vector_get_z(scaled))) & 0xFFFF;
+		const uint64_t w = uint64_t(int64_t(vector_get_w(scaled))) & 0xFFFF;
+		return x | (y << 16) | (z << 32) | (w << 48);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 4x 16 bit signed normalized components into a vector4 in [-1.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_vector4_snorm16(uint64_t input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Replicate each 16 bit value within its 32 bit lane and shift it back down to sign extend it
+		__m128i input_i32 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(&input));
+		input_i32 = _mm_srai_epi32(_mm_unpacklo_epi16(input_i32, input_i32), 16);
+		return _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(input_i32), _mm_set_ps1(1.0F / 32767.0F)), _mm_set_ps1(-1.0F));
+#elif defined(RTM_NEON_INTRINSICS)
+		const int32x4_t input_i32 = vmovl_s16(vcreate_s16(input));
+		return vmaxq_f32(vmulq_n_f32(vcvtq_f32_s32(input_i32), 1.0F / 32767.0F), vdupq_n_f32(-1.0F));
+#else
+		const float x = float(int16_t(input & 0xFFFF));
+		const float y = float(int16_t((input >> 16) & 0xFFFF));
+		const float z = float(int16_t((input >> 32) & 0xFFFF));
+		const float w = float(int16_t(input >> 48));
+		return vector_max(vector_mul(vector_set(x, y, z, w), 1.0F / 32767.0F), vector_set(-1.0F));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs a vector4 in [0.0, 1.0] as 10 bit unsigned normalized [xyz] components
+	// and a 2 bit unsigned normalized [w] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL pack_vector4_unorm10_10_10_2(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f scaled = vector_round_symmetric(vector_mul(vector_clamp(input, vector_zero(), vector_set(1.0F)), vector_set(1023.0F, 1023.0F, 1023.0F, 3.0F)));
+
+		const uint32_t x = uint32_t(vector_get_x(scaled));
+		const uint32_t y = uint32_t(vector_get_y(scaled));
+		const uint32_t z = uint32_t(vector_get_z(scaled));
+		const uint32_t w = uint32_t(vector_get_w(scaled));
+		return x | (y << 10) | (z << 20) | (w << 30);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 10 bit unsigned normalized [xyz] components and a 2 bit unsigned normalized [w]
+	// component into a vector4 in [0.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_vector4_unorm10_10_10_2(uint32_t input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Mask each component in place, the [w] component is shifted down to keep the lane positive
+		const __m128i input_u32 = _mm_set1_epi32(int32_t(input));
+		const __m128i xyz_u32 = _mm_and_si128(input_u32, _mm_set_epi32(0, 0x3FF << 20, 0x3FF << 10, 0x3FF));
+		const __m128i w_u32 = _mm_and_si128(_mm_srli_epi32(input_u32, 30), _mm_set_epi32(0x3, 0, 0, 0));
+		const __m128 scale = _mm_set_ps(1.0F / 3.0F, 1.0F / (1023.0F * 1048576.0F), 1.0F / (1023.0F * 1024.0F), 1.0F / 1023.0F);
+		return _mm_mul_ps(_mm_cvtepi32_ps(_mm_or_si128(xyz_u32, w_u32)), scale);
+#elif defined(RTM_NEON_INTRINSICS)
+		alignas(16) constexpr int32_t shift_i[4] = { 0, -10, -20, -30 };
+		alignas(16) constexpr uint32_t mask_i[4] = { 0x3FF, 0x3FF, 0x3FF, 0x3 };
+		alignas(16) constexpr float scale_f[4] = { 1.0F / 1023.0F, 1.0F / 1023.0F, 1.0F / 1023.0F, 1.0F / 3.0F };
+		const uint32x4_t input_u32 = vandq_u32(vshlq_u32(vdupq_n_u32(input), vld1q_s32(&shift_i[0])), vld1q_u32(&mask_i[0]));
+		return vmulq_f32(vcvtq_f32_u32(input_u32), vld1q_f32(&scale_f[0]));
+#else
+		const float x = float(input & 0x3FF);
+		const float y = float((input >> 10) & 0x3FF);
+		const float z = float((input >> 20) & 0x3FF);
+		const float w = float(input >> 30);
+		return vector_mul(vector_set(x, y, z, w), vector_set(1.0F / 1023.0F, 1.0F / 1023.0F, 1.0F / 1023.0F, 1.0F / 3.0F));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs the [xyz] components of a vector4 in [0.0, 1.0] as 11 bit unsigned normalized [xy]
+	// components and a 10 bit unsigned normalized [z] component. The [w] component is ignored.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL pack_vector3_unorm11_11_10(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4f scaled = vector_round_symmetric(vector_mul(vector_clamp(input, vector_zero(), vector_set(1.0F)), vector_set(2047.0F, 2047.0F, 1023.0F, 0.0F)));
+
+		const uint32_t x = uint32_t(vector_get_x(scaled));
+		const uint32_t y = uint32_t(vector_get_y(scaled));
+		const uint32_t z = uint32_t(vector_get_z(scaled));
+		return x | (y << 11) | (z << 22);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks 11 bit unsigned normalized [xy] components and a 10 bit unsigned normalized [z]
+	// component into a vector4 in [0.0, 1.0]. The [w] component is set to 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL unpack_vector3_unorm11_11_10(uint32_t input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Mask each component in place, the [z] component is shifted down to keep the lane positive
+		const __m128i input_u32 = _mm_set1_epi32(int32_t(input));
+		const __m128i xy_u32 = _mm_and_si128(input_u32, _mm_set_epi32(0, 0, 0x7FF << 11, 0x7FF));
+		const __m128i z_u32 = _mm_and_si128(_mm_srli_epi32(input_u32, 22), _mm_set_epi32(0, 0x3FF, 0, 0));
+		const __m128 scale = _mm_set_ps(0.0F, 1.0F / 1023.0F, 1.0F / (2047.0F * 2048.0F), 1.0F / 2047.0F);
+		return _mm_mul_ps(_mm_cvtepi32_ps(_mm_or_si128(xy_u32, z_u32)), scale);
+#elif defined(RTM_NEON_INTRINSICS)
+		alignas(16) constexpr int32_t shift_i[4] = { 0, -11, -22, 0 };
+		alignas(16) constexpr uint32_t mask_i[4] = { 0x7FF, 0x7FF, 0x3FF, 0 };
+		alignas(16) constexpr float scale_f[4] = { 1.0F / 2047.0F, 1.0F / 2047.0F, 1.0F / 1023.0F, 0.0F };
+		const uint32x4_t input_u32 = vandq_u32(vshlq_u32(vdupq_n_u32(input), vld1q_s32(&shift_i[0])), vld1q_u32(&mask_i[0]));
+		return vmulq_f32(vcvtq_f32_u32(input_u32), vld1q_f32(&scale_f[0]));
+#else
+		const float x = float(input & 0x7FF);
+		const float y = float((input >> 11) & 0x7FF);
+		const float z = float(input >> 22);
+		return vector_mul(vector_set(x, y, z, 0.0F), vector_set(1.0F / 2047.0F, 1.0F / 2047.0F, 1.0F / 1023.0F, 0.0F));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Batch variants
+	// Each packs or unpacks 'num_vectors' consecutive values, the range reduced
+	// variants remap every value with the same [range_min, range_min + range_extent].
+	// The input and output must not overlap.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs an array of vectors, see pack_vector4_unorm8.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_vector4_unorm8_aos(const vector4f* input, uint32_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector4_unorm8(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks an array of vectors, see unpack_vector4_unorm8.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_vector4_unorm8_aos(const uint32_t* input, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = unpack_vector4_unorm8(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Range reduces and packs an array of vectors, see vector_range_reduce and pack_vector4_unorm8.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL pack_vector4_unorm8_aos(const vector4f* input, vector4f_arg0 range_min, vector4f_arg1 range_extent, uint32_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector4_unorm8(vector_range_reduce(input[vector_index], range_min, range_extent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks and range expands an array of vectors, see unpack_vector4_unorm8 and vector_range_expand.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL unpack_vector4_unorm8_aos(const uint32_t* input, vector4f_arg0 range_min, vector4f_arg1 range_extent, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = vector_range_expand(unpack_vector4_unorm8(input[vector_index]), range_min, range_extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs an array of vectors, see pack_vector4_snorm8.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_vector4_snorm8_aos(const vector4f* input, uint32_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector4_snorm8(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks an array of vectors, see unpack_vector4_snorm8.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_vector4_snorm8_aos(const uint32_t* input, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = unpack_vector4_snorm8(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs an array of vectors, see pack_vector4_unorm16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_vector4_unorm16_aos(const vector4f* input, uint64_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector4_unorm16(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks an array of vectors, see unpack_vector4_unorm16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_vector4_unorm16_aos(const uint64_t* input, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = unpack_vector4_unorm16(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Range reduces and packs an array of vectors, see vector_range_reduce and pack_vector4_unorm16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL pack_vector4_unorm16_aos(const vector4f* input, vector4f_arg0 range_min, vector4f_arg1 range_extent, uint64_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector4_unorm16(vector_range_reduce(input[vector_index], range_min, range_extent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks and range expands an array of vectors, see unpack_vector4_unorm16 and vector_range_expand.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL unpack_vector4_unorm16_aos(const uint64_t* input, vector4f_arg0 range_min, vector4f_arg1 range_extent, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = vector_range_expand(unpack_vector4_unorm16(input[vector_index]), range_min, range_extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs an array of vectors, see pack_vector4_snorm16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_vector4_snorm16_aos(const vector4f* input, uint64_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector4_snorm16(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks an array of vectors, see unpack_vector4_snorm16.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_vector4_snorm16_aos(const uint64_t* input, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = unpack_vector4_snorm16(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs an array of vectors, see pack_vector4_unorm10_10_10_2.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_vector4_unorm10_10_10_2_aos(const vector4f* input, uint32_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector4_unorm10_10_10_2(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks an array of vectors, see unpack_vector4_unorm10_10_10_2.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_vector4_unorm10_10_10_2_aos(const uint32_t* input, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = unpack_vector4_unorm10_10_10_2(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Range reduces and packs an array of vectors, see vector_range_reduce and pack_vector4_unorm10_10_10_2.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL pack_vector4_unorm10_10_10_2_aos(const vector4f* input, vector4f_arg0 range_min, vector4f_arg1 range_extent, uint32_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector4_unorm10_10_10_2(vector_range_reduce(input[vector_index], range_min, range_extent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks and range expands an array of vectors, see unpack_vector4_unorm10_10_10_2 and vector_range_expand.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL unpack_vector4_unorm10_10_10_2_aos(const uint32_t* input, vector4f_arg0 range_min, vector4f_arg1 range_extent, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = vector_range_expand(unpack_vector4_unorm10_10_10_2(input[vector_index]), range_min, range_extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Packs an array of vectors, see pack_vector3_unorm11_11_10.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_vector3_unorm11_11_10_aos(const vector4f* input, uint32_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector3_unorm11_11_10(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks an array of vectors, see unpack_vector3_unorm11_11_10.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_vector3_unorm11_11_10_aos(const uint32_t* input, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = unpack_vector3_unorm11_11_10(input[vector_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Range reduces and packs an array of vectors, see vector_range_reduce and pack_vector3_unorm11_11_10.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL pack_vector3_unorm11_11_10_aos(const vector4f* input, vector4f_arg0 range_min, vector4f_arg1 range_extent, uint32_t* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = pack_vector3_unorm11_11_10(vector_range_reduce(input[vector_index], range_min, range_extent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Unpacks and range expands an array of vectors, see unpack_vector3_unorm11_11_10 and vector_range_expand.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL unpack_vector3_unorm11_11_10_aos(const uint32_t* input, vector4f_arg0 range_min, vector4f_arg1 range_extent, vector4f* output, uint32_t num_vectors) RTM_NO_EXCEPT
+	{
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			output[vector_index] = vector_range_expand(unpack_vector3_unorm11_11_10(input[vector_index]), range_min, range_extent);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_values' consecutive floats into half precision, see vector_store_half.
+	// The input and output must not overlap.
+	//////////////////////////////////////////////////////////////////////////
+	inline void pack_half_array(const float* input, uint16_t* output, uint32_t num_values) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::pack_half_array", num_values, num_values * (sizeof(float) + sizeof(uint16_t)));
+		uint32_t value_index = 0;
+
+#if defined(RTM_F16C_INTRINSICS) && defined(RTM_AVX_INTRINSICS)
+		for (; value_index + 8 <= num_values; value_index += 8)
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(output + value_index), _mm256_cvtps_ph(_mm256_loadu_ps(input + value_index), _MM_FROUND_TO_NEAREST_INT));
+#endif
+
+		for (; value_index + 4 <= num_values; value_index += 4)
+			vector_store_half(vector_load(input + value_index), output + value_index);
+
+		for (; value_index < num_values; ++value_index)
+			output[value_index] = scalar_float_to_half(input[value_index]);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts 'num_values' consecutive half precision values into floats, see vector_load_half.
+	// The input and output must not overlap.
+	//////////////////////////////////////////////////////////////////////////
+	inline void unpack_half_array(const uint16_t* input, float* output, uint32_t num_values) RTM_NO_EXCEPT
+	{
+		RTM_PROFILE_SCOPE("rtm::unpack_half_array", num_values, num_values * (sizeof(uint16_t) + sizeof(float)));
+		uint32_t value_index = 0;
+
+#if defined(RTM_F16C_INTRINSICS) && defined(RTM_AVX_INTRINSICS)
+		for (; value_index + 8 <= num_values; value_index += 8)
+			_mm256_storeu_ps(output + value_index, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(input + value_index))));
+#endif
+
+		for (; value_index + 4 <= num_values; value_index += 4)
+			vector_store(vector_load_half(input + value_index), output + value_index);
+
+		for (; value_index < num_values; ++value_index)
+			output[value_index] = scalar_half_to_float(input[value_index]);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
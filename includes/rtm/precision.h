@@ -0,0 +1,282 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/scalard.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4d.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/batch_common.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/memory_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+//////////////////////////////////////////////////////////////////////////
+// Overloads of the functions with a speed/accuracy trade-off that take a precision
+// policy as their last argument, see precision::fast, precision::standard, and precision::exact.
+// The policy is a type: every choice is resolved at compile time.
+//////////////////////////////////////////////////////////////////////////
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the sine of the input angle.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline float scalar_sin(float angle, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return scalar_sin_fast(angle);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return static_cast<float>(scalar_sin(static_cast<double>(angle)));
+		else
+			return scalar_sin(angle);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the cosine of the input angle.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline float scalar_cos(float angle, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return scalar_cos_fast(angle);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return static_cast<float>(scalar_cos(static_cast<double>(angle)));
+		else
+			return scalar_cos(angle);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the tangent of the input angle.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline float scalar_tan(float angle, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return scalar_tan_fast(angle);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return static_cast<float>(scalar_tan(static_cast<double>(angle)));
+		else
+			return scalar_tan(angle);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-sine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline float scalar_asin(float value, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return scalar_asin_fast(value);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return static_cast<float>(scalar_asin(static_cast<double>(value)));
+		else
+			return scalar_asin(value);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-cosine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline float scalar_acos(float value, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return scalar_acos_fast(value);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return static_cast<float>(scalar_acos(static_cast<double>(value)));
+		else
+			return scalar_acos(value);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-tangent of the input.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline float scalar_atan(float value, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return scalar_atan_fast(value);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return static_cast<float>(scalar_atan(static_cast<double>(value)));
+		else
+			return scalar_atan(value);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline float scalar_atan2(float y, float x, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return scalar_atan2_fast(y, x);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return static_cast<float>(scalar_atan2(static_cast<double>(y), static_cast<double>(x)));
+		else
+			return scalar_atan2(y, x);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the sine of the input angle.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline vector4f RTM_SIMD_CALL vector_sin(vector4f_arg0 input, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return vector_sin_fast(input);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return vector_cast(vector_sin(vector_cast(input)));
+		else
+			return vector_sin(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the cosine of the input angle.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline vector4f RTM_SIMD_CALL vector_cos(vector4f_arg0 input, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return vector_cos_fast(input);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return vector_cast(vector_cos(vector_cast(input)));
+		else
+			return vector_cos(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the tangent of the input angle.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline vector4f RTM_SIMD_CALL vector_tan(vector4f_arg0 input, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return vector_tan_fast(input);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return vector_cast(vector_tan(vector_cast(input)));
+		else
+			return vector_tan(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-sine of the input.
+	// Input values must be in the range [-1.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline vector4f RTM_SIMD_CALL vector_asin(vector4f_arg0 input, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return vector_asin_fast(input);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return vector_cast(vector_asin(vector_cast(input)));
+		else
+			return vector_asin(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-cosine of the input.
+	// Input values must be in the range [-1.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline vector4f RTM_SIMD_CALL vector_acos(vector4f_arg0 input, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return vector_acos_fast(input);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return vector_cast(vector_acos(vector_cast(input)));
+		else
+			return vector_acos(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-tangent of the input.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline vector4f RTM_SIMD_CALL vector_atan(vector4f_arg0 input, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return vector_atan_fast(input);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return vector_cast(vector_atan(vector_cast(input)));
+		else
+			return vector_atan(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline vector4f RTM_SIMD_CALL vector_atan2(vector4f_arg0 y, vector4f_arg1 x, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::fast>::test())
+			return vector_atan2_fast(y, x);
+		else if (rtm_impl::static_condition<precision_policy::trigonometry == trigonometry_precision::exact>::test())
+			return vector_cast(vector_atan2(vector_cast(y), vector_cast(x)));
+		else
+			return vector_atan2(y, x);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized quaternion, the reciprocal length is calculated with
+	// the policy normalize_precision.
+	// Note that if the input quaternion is invalid (pure zero or with NaN/Inf),
+	// the result is undefined.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline quatf RTM_SIMD_CALL quat_normalize(quatf_arg0 input, precision_policy) RTM_NO_EXCEPT
+	{
+		const vector4f input_v = quat_to_vector(input);
+		const vector4f length_squared = vector_dot(input_v, input_v);
+		const vector4f length_reciprocal = rtm_impl::batch_sqrt_reciprocal<precision_policy::normalize>(length_squared);
+		return vector_to_quat(vector_mul(input_v, length_reciprocal));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the interpolation between start and end for a given alpha value
+	// with the policy rotation_interpolation: quat_lerp, quat_slerp_fast, or quat_slerp.
+	// Like those, the 'end' rotation is flipped when needed to interpolate along the shortest path.
+	// Note that quat_slerp_fast does not normalize its result.
+	//////////////////////////////////////////////////////////////////////////
+	template<typename precision_policy, rtm_impl::enable_if_precision_policy<precision_policy> = 0>
+	inline quatf RTM_SIMD_CALL quat_interpolate(quatf_arg0 start, quatf_arg1 end, float alpha, precision_policy) RTM_NO_EXCEPT
+	{
+		if (rtm_impl::static_condition<precision_policy::interpolation == rotation_interpolation::lerp>::test())
+			return quat_lerp(start, end, alpha);
+		else if (rtm_impl::static_condition<precision_policy::interpolation == rotation_interpolation::slerp_fast>::test())
+			return quat_slerp_fast(start, end, alpha);
+		else
+			return quat_slerp(start, end, alpha);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
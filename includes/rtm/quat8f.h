@@ -0,0 +1,340 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/vector8f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// quat8f holds 8 quaternions as structure of arrays, one vector8f per component.
+	// Every operation is performed lane-wise, no swizzling is ever required.
+	// Conventions match their quatf counterparts.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns 8 identity quaternions.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat8_identity() RTM_NO_EXCEPT
+	{
+		const vector8f zero = vector8_zero();
+		return quat8f{ zero, zero, zero, vector8_set(1.0F) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 quaternions from structure of arrays streams, starting at the provided offset.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat8_load(const const_float4f_soa& input, uint32_t offset) RTM_NO_EXCEPT
+	{
+		return quat8f{ vector8_load(input.x + offset), vector8_load(input.y + offset), vector8_load(input.z + offset), vector8_load(input.w + offset) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 8 quaternions to structure of arrays streams, starting at the provided offset.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL quat_store(quat8f_arg0 input, const float4f_soa& output, uint32_t offset) RTM_NO_EXCEPT
+	{
+		vector_store(input.x, output.x + offset);
+		vector_store(input.y, output.y + offset);
+		vector_store(input.z, output.z + offset);
+		vector_store(input.w, output.w + offset);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the quaternion conjugate of each input.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_conjugate(quat8f_arg0 input) RTM_NO_EXCEPT
+	{
+		return quat8f{ vector_neg(input.x), vector_neg(input.y), vector_neg(input.z), input.w };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies each pair of quaternions.
+	// Note that due to floating point rounding, the result might not be perfectly normalized.
+	// Multiplication order is as follow: local_to_world = quat_mul(local_to_object, object_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_mul(quat8f_arg0 lhs, quat8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const vector8f x = vector_neg_mul_sub(rhs.z, lhs.y, vector_mul_add(rhs.y, lhs.z, vector_mul_add(rhs.x, lhs.w, vector_mul(rhs.w, lhs.x))));
+		const vector8f y = vector_mul_add(rhs.z, lhs.x, vector_mul_add(rhs.y, lhs.w, vector_neg_mul_sub(rhs.x, lhs.z, vector_mul(rhs.w, lhs.y))));
+		const vector8f z = vector_mul_add(rhs.z, lhs.w, vector_neg_mul_sub(rhs.y, lhs.x, vector_mul_add(rhs.x, lhs.y, vector_mul(rhs.w, lhs.z))));
+		const vector8f w = vector_neg_mul_sub(rhs.z, lhs.z, vector_neg_mul_sub(rhs.y, lhs.y, vector_neg_mul_sub(rhs.x, lhs.x, vector_mul(rhs.w, lhs.w))));
+		return quat8f{ x, y, z, w };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies each 3D vector by its matching quaternion rotation.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL quat_mul_vector3(vector3x8f_arg0 vector, quat8f_arg1 rotation) RTM_NO_EXCEPT
+	{
+		// v' = v + (w * t) + cross(q.xyz, t) where t = 2 * cross(q.xyz, v)
+		// This is equivalent to conjugating the vector as a pure quaternion with the rotation.
+		const vector3x8f rotation_xyz = { rotation.x, rotation.y, rotation.z };
+		const vector3x8f cross = vector_cross3(rotation_xyz, vector);
+		const vector3x8f t = vector_add(cross, cross);
+		const vector3x8f rotation_cross_t = vector_cross3(rotation_xyz, t);
+		return vector3x8f{
+			vector_add(vector_mul_add(t.x, rotation.w, vector.x), rotation_cross_t.x),
+			vector_add(vector_mul_add(t.y, rotation.w, vector.y), rotation_cross_t.y),
+			vector_add(vector_mul_add(t.z, rotation.w, vector.z), rotation_cross_t.z)
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the dot product of each pair of quaternions.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL quat_dot(quat8f_arg0 lhs, quat8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(lhs.w, rhs.w, vector_mul_add(lhs.z, rhs.z, vector_mul_add(lhs.y, rhs.y, vector_mul(lhs.x, rhs.x))));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the squared length/norm of each quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL quat_length_squared(quat8f_arg0 input) RTM_NO_EXCEPT
+	{
+		return quat_dot(input, input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the length/norm of each quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL quat_length(quat8f_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_sqrt(quat_dot(input, input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized version of each quaternion.
+	// If the length of a quaternion is zero, its result will contain NaN or infinity.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_normalize(quat8f_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector8f length_reciprocal = vector_reciprocal(quat_length(input));
+		return quat8f{ vector_mul(input.x, length_reciprocal), vector_mul(input.y, length_reciprocal), vector_mul(input.z, length_reciprocal), vector_mul(input.w, length_reciprocal) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the linear interpolation of each pair of quaternions at its matching alpha, normalized.
+	// Like quat_lerp, the 'end' rotation is flipped when needed to interpolate along the shortest path.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_lerp(quat8f_arg0 start, quat8f_arg1 end, vector8f_arg2 alpha) RTM_NO_EXCEPT
+	{
+		// If the dot product is negative, we flip the 'end' rotation by negating its alpha
+		const mask8f is_negative = vector_less_than(quat_dot(start, end), vector8_zero());
+		const vector8f end_alpha = vector_select(is_negative, vector_neg(alpha), alpha);
+
+		// ((1.0 - alpha) * start) + (end_alpha * end) == (start - alpha * start) + (end_alpha * end)
+		const quat8f interpolated_rotation = {
+			vector_mul_add(end.x, end_alpha, vector_neg_mul_sub(start.x, alpha, start.x)),
+			vector_mul_add(end.y, end_alpha, vector_neg_mul_sub(start.y, alpha, start.y)),
+			vector_mul_add(end.z, end_alpha, vector_neg_mul_sub(start.z, alpha, start.z)),
+			vector_mul_add(end.w, end_alpha, vector_neg_mul_sub(start.w, alpha, start.w))
+		};
+
+		return quat_normalize(interpolated_rotation);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the linear interpolation of each pair of quaternions at the specified alpha, normalized.
+	// Like quat_lerp, the 'end' rotation is flipped when needed to interpolate along the shortest path.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_lerp(quat8f_arg0 start, quat8f_arg1 end, float alpha) RTM_NO_EXCEPT
+	{
+		return quat_lerp(start, end, vector8_set(alpha));
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per lane sin(alpha * angle) / sin(angle) from the alpha and cos(angle) - 1.0.
+		// See: rtm_impl::quat_slerp_fast_weights in quatf.h
+		//////////////////////////////////////////////////////////////////////////
+		inline vector8f RTM_SIMD_CALL quat_slerp_fast_weights(vector8f_arg0 alpha, vector8f_arg1 cos_angle_minus_one) RTM_NO_EXCEPT
+		{
+			const vector8f alpha_sq = vector_mul(alpha, alpha);
+			const vector8f one = vector8_set(1.0F);
+
+			vector8f result = vector_mul_add(vector_mul(vector_mul_add(alpha_sq, 1.36248610e-2F, vector8_set(-8.71991102e-1F)), cos_angle_minus_one), one, one);
+			result = vector_mul_add(vector_mul(vector_mul_add(alpha_sq, 9.52380952e-3F, vector8_set(-4.66666667e-1F)), cos_angle_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_mul_add(alpha_sq, 1.28205128e-2F, vector8_set(-4.61538462e-1F)), cos_angle_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_mul_add(alpha_sq, 1.81818182e-2F, vector8_set(-4.54545455e-1F)), cos_angle_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_mul_add(alpha_sq, 2.77777778e-2F, vector8_set(-4.44444444e-1F)), cos_angle_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_mul_add(alpha_sq, 4.76190476e-2F, vector8_set(-4.28571429e-1F)), cos_angle_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_mul_add(alpha_sq, 1.00000000e-1F, vector8_set(-4.00000000e-1F)), cos_angle_minus_one), result, one);
+			result = vector_mul_add(vector_mul(vector_mul_add(alpha_sq, 3.33333333e-1F, vector8_set(-3.33333333e-1F)), cos_angle_minus_one), result, one);
+			return vector_mul(result, alpha);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the spherical interpolation of each pair of quaternions at its matching alpha.
+	// Like quat_slerp_fast, the weights are evaluated with a polynomial and the result is not normalized.
+	// The 'end' rotation is flipped when needed to interpolate along the shortest path.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_slerp_fast(quat8f_arg0 start, quat8f_arg1 end, vector8f_arg2 alpha) RTM_NO_EXCEPT
+	{
+		// If the dot product is negative, we flip the 'end' rotation by negating its weight
+		const vector8f cos_half_angle = quat_dot(start, end);
+		const mask8f is_angle_negative = vector_less_than(cos_half_angle, vector8_zero());
+		const vector8f cos_half_angle_minus_one = vector_sub(vector_abs(cos_half_angle), vector8_set(1.0F));
+
+		const vector8f start_weight = rtm_impl::quat_slerp_fast_weights(vector_sub(vector8_set(1.0F), alpha), cos_half_angle_minus_one);
+		vector8f end_weight = rtm_impl::quat_slerp_fast_weights(alpha, cos_half_angle_minus_one);
+		end_weight = vector_select(is_angle_negative, vector_neg(end_weight), end_weight);
+
+		return quat8f{
+			vector_mul_add(end.x, end_weight, vector_mul(start.x, start_weight)),
+			vector_mul_add(end.y, end_weight, vector_mul(start.y, start_weight)),
+			vector_mul_add(end.z, end_weight, vector_mul(start.z, start_weight)),
+			vector_mul_add(end.w, end_weight, vector_mul(start.w, start_weight))
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the spherical interpolation of each pair of quaternions at the specified alpha.
+	// Like quat_slerp_fast, the weights are evaluated with a polynomial and the result is not normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_slerp_fast(quat8f_arg0 start, quat8f_arg1 end, float alpha) RTM_NO_EXCEPT
+	{
+		return quat_slerp_fast(start, end, vector8_set(alpha));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the negation of each quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_neg(quat8f_arg0 input) RTM_NO_EXCEPT
+	{
+		return quat8f{ vector_neg(input.x), vector_neg(input.y), vector_neg(input.z), vector_neg(input.w) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Comparisons and masking
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane selection of each quaternion depending on the mask: mask != 0 ? if_true : if_false
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_select(mask8f_arg0 mask, quat8f_arg1 if_true, quat8f_arg2 if_false) RTM_NO_EXCEPT
+	{
+		return quat8f{ vector_select(mask, if_true.x, if_false.x), vector_select(mask, if_true.y, if_false.y), vector_select(mask, if_true.z, if_false.z), vector_select(mask, if_true.w, if_false.w) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Conversion from directions
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates the shortest arc rotation quaternions that rotate each 'from' direction onto its 'to' direction.
+	// The directions must have a non-zero length but they do not need to be normalized.
+	// Opposite directions are handled per lane without branching, see quat_from_to.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_from_to(vector3x8f_arg0 from, vector3x8f_arg1 to) RTM_NO_EXCEPT
+	{
+		const vector8f length_product = vector_sqrt(vector_mul(vector_length_squared3(from), vector_length_squared3(to)));
+		const vector8f w = vector_add(length_product, vector_dot3(from, to));
+		const vector3x8f axis = vector_cross3(from, to);
+
+		// Opposite directions rotate by pi around the same orthogonal axis as quat_from_to
+		const mask8f is_opposite = vector_less_equal(w, vector_mul(length_product, 1.0E-6F));
+		const mask8f is_x_larger = vector_greater_than(vector_abs(from.x), vector_abs(from.z));
+		const vector8f zero = vector8_zero();
+		const vector8f half_turn_x = vector_select(is_x_larger, vector_neg(from.y), zero);
+		const vector8f half_turn_y = vector_select(is_x_larger, from.x, vector_neg(from.z));
+		const vector8f half_turn_z = vector_select(is_x_larger, zero, from.y);
+
+		const quat8f result = quat8f{
+			vector_select(is_opposite, half_turn_x, axis.x),
+			vector_select(is_opposite, half_turn_y, axis.y),
+			vector_select(is_opposite, half_turn_z, axis.z),
+			vector_select(is_opposite, zero, w)
+		};
+		return quat_normalize(result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates the rotation quaternions that look along each 'forward' direction with the Z axis (up)
+	// as close to its 'up' direction as possible, see quat_look_rotation.
+	// Mirrored and parallel directions are handled per lane without branching.
+	//////////////////////////////////////////////////////////////////////////
+	inline quat8f RTM_SIMD_CALL quat_look_rotation(vector3x8f_arg0 forward, vector3x8f_arg1 up) RTM_NO_EXCEPT
+	{
+		const vector3x8f forward_axis = vector_normalize3(forward);
+		const mask8f is_mirrored = vector_less_than(forward_axis.x, vector8_zero());
+
+		const vector8f arc_x = vector_abs(forward_axis.x);
+		const vector8f arc_y = vector_select(is_mirrored, vector_neg(forward_axis.y), forward_axis.y);
+		const vector8f arc_z = forward_axis.z;
+		const vector8f up_x = vector_select(is_mirrored, vector_neg(up.x), up.x);
+		const vector8f up_y = vector_select(is_mirrored, vector_neg(up.y), up.y);
+
+		const vector8f one = vector8_set(1.0F);
+		const vector8f arc_w = vector_add(one, arc_x);
+		const vector8f arc_scale = vector_div(vector_mul_add(up_x, arc_w, vector_mul_add(up_y, arc_y, vector_mul(up.z, arc_z))), arc_w);
+		const vector8f roll_sin = vector_sub(vector_mul(arc_y, arc_scale), up_y);
+		const vector8f roll_cos = vector_neg_mul_sub(arc_z, arc_scale, up.z);
+
+		// Lanes where 'up' is parallel to 'forward' have no roll
+		const vector8f roll_length_squared = vector_mul_add(roll_cos, roll_cos, vector_mul(roll_sin, roll_sin));
+		const mask8f is_parallel = vector_less_equal(roll_length_squared, vector_mul(vector_length_squared3(up), 1.0E-8F));
+		const vector8f safe_roll_sin = vector_select(is_parallel, vector8_zero(), roll_sin);
+		const vector8f safe_roll_cos = vector_select(is_parallel, one, roll_cos);
+		const vector8f roll_length = vector_select(is_parallel, one, vector_sqrt(roll_length_squared));
+
+		const mask8f is_roll_forward = vector_greater_equal(safe_roll_cos, vector8_zero());
+		const vector8f roll_x = vector_select(is_roll_forward, safe_roll_sin, vector_sub(roll_length, safe_roll_cos));
+		const vector8f roll_w = vector_select(is_roll_forward, vector_add(roll_length, safe_roll_cos), safe_roll_sin);
+
+		const vector8f x = vector_mul(arc_w, roll_x);
+		const vector8f y = vector_neg_mul_sub(arc_z, roll_w, vector_mul(arc_y, roll_x));
+		const vector8f z = vector_mul_add(arc_y, roll_w, vector_mul(arc_z, roll_x));
+		const vector8f w = vector_mul(arc_w, roll_w);
+
+		const quat8f result = quat8f{
+			vector_select(is_mirrored, vector_neg(y), x),
+			vector_select(is_mirrored, x, y),
+			vector_select(is_mirrored, w, z),
+			vector_select(is_mirrored, vector_neg(z), w)
+		};
+		return quat_normalize(result);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
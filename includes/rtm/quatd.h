@@ -47,7 +47,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_load(const double* input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_loadu_pd(input);
+#else
 		return quat_set(input[0], input[1], input[2], input[3]);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -64,7 +68,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd vector_to_quat(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return input;
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ input.xy, input.zw };
 #else
 		return quatd{ input.x, input.y, input.z, input.w };
@@ -76,7 +82,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_cast(const quatf& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cvtps_pd(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ _mm_cvtps_pd(input), _mm_cvtps_pd(_mm_shuffle_ps(input, input, _MM_SHUFFLE(3, 2, 3, 2))) };
 #elif defined(RTM_NEON_INTRINSICS)
 		return quatd{ double(vgetq_lane_f32(input, 0)), double(vgetq_lane_f32(input, 1)), double(vgetq_lane_f32(input, 2)), double(vgetq_lane_f32(input, 3)) };
@@ -97,7 +105,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm256_castpd256_pd128(input));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(input.xy);
 #else
 				return input.x;
@@ -107,7 +117,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm256_castpd256_pd128(input) };
+#else
 				return scalard{ input.xy };
+#endif
 			}
 #endif
 
@@ -135,7 +149,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm_permute_pd(_mm256_castpd256_pd128(input), 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(_mm_shuffle_pd(input.xy, input.xy, 1));
 #else
 				return input.y;
@@ -145,7 +161,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm_permute_pd(_mm256_castpd256_pd128(input), 1) };
+#else
 				return scalard{ _mm_shuffle_pd(input.xy, input.xy, 1) };
+#endif
 			}
 #endif
 
@@ -173,7 +193,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm256_extractf128_pd(input, 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(input.zw);
 #else
 				return input.z;
@@ -183,7 +205,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm256_extractf128_pd(input, 1) };
+#else
 				return scalard{ input.zw };
+#endif
 			}
 #endif
 
@@ -211,7 +237,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm_permute_pd(_mm256_extractf128_pd(input, 1), 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(_mm_shuffle_pd(input.zw, input.zw, 1));
 #else
 				return input.w;
@@ -221,7 +249,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm_permute_pd(_mm256_extractf128_pd(input, 1), 1) };
+#else
 				return scalard{ _mm_shuffle_pd(input.zw, input.zw, 1) };
+#endif
 			}
 #endif
 
@@ -242,7 +274,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_set_x(const quatd& input, double lane_value) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_set1_pd(lane_value), 1);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ _mm_move_sd(input.xy, _mm_set_sd(lane_value)), input.zw };
 #else
 		return quatd{ lane_value, input.y, input.z, input.w };
@@ -255,7 +289,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_set_x(const quatd& input, const scalard& lane_value) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_castpd128_pd256(lane_value.value), 1);
+#else
 		return quatd{ _mm_move_sd(input.xy, lane_value.value), input.zw };
+#endif
 	}
 #endif
 
@@ -264,7 +302,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_set_y(const quatd& input, double lane_value) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_set1_pd(lane_value), 2);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ _mm_shuffle_pd(input.xy, _mm_set_sd(lane_value), 0), input.zw };
 #else
 		return quatd{ input.x, lane_value, input.z, input.w };
@@ -277,7 +317,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_set_y(const quatd& input, const scalard& lane_value) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_castpd128_pd256(_mm_shuffle_pd(lane_value.value, lane_value.value, 0)), 2);
+#else
 		return quatd{ _mm_shuffle_pd(input.xy, lane_value.value, 0), input.zw };
+#endif
 	}
 #endif
 
@@ -286,7 +330,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_set_z(const quatd& input, double lane_value) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_set1_pd(lane_value), 4);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ input.xy, _mm_move_sd(input.zw, _mm_set_sd(lane_value)) };
 #else
 		return quatd{ input.x, input.y, lane_value, input.w };
@@ -299,7 +345,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_set_z(const quatd& input, const scalard& lane_value) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(input, _mm_move_sd(_mm256_extractf128_pd(input, 1), lane_value.value), 1);
+#else
 		return quatd{ input.xy, _mm_move_sd(input.zw, lane_value.value) };
+#endif
 	}
 #endif
 
@@ -308,7 +358,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_set_w(const quatd& input, double lane_value) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_set1_pd(lane_value), 8);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return quatd{ input.xy, _mm_shuffle_pd(input.zw, _mm_set_sd(lane_value), 0) };
 #else
 		return quatd{ input.x, input.y, input.z, lane_value };
@@ -321,7 +373,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_set_w(const quatd& input, const scalard& lane_value) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(input, _mm_shuffle_pd(_mm256_extractf128_pd(input, 1), lane_value.value, 0), 1);
+#else
 		return quatd{ input.xy, _mm_shuffle_pd(input.zw, lane_value.value, 0) };
+#endif
 	}
 #endif
 
@@ -330,10 +386,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline void quat_store(const quatd& input, double* output) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		_mm256_storeu_pd(output, input);
+#else
 		output[0] = quat_get_x(input);
 		output[1] = quat_get_y(input);
 		output[2] = quat_get_z(input);
 		output[3] = quat_get_w(input);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -372,7 +432,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_conjugate(const quatd& input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		constexpr __m256d signs = { -0.0, -0.0, -0.0, 0.0 };
+		return _mm256_xor_pd(input, signs);
+#else
 		return quat_set(-quat_get_x(input), -quat_get_y(input), -quat_get_z(input), quat_get_w(input));
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -382,6 +447,36 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd quat_mul(const quatd& lhs, const quatd& rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		constexpr __m256d control_wzyx = {  0.0, -0.0,  0.0, -0.0 };
+		constexpr __m256d control_zwxy = {  0.0,  0.0, -0.0, -0.0 };
+		constexpr __m256d control_yxwz = { -0.0,  0.0,  0.0, -0.0 };
+
+		// Broadcasting from memory is free on the load ports, only lhs needs to be shuffled
+		const double* rhs_ptr = reinterpret_cast<const double*>(&rhs);
+		const __m256d r_xxxx = _mm256_broadcast_sd(rhs_ptr + 0);
+		const __m256d r_yyyy = _mm256_broadcast_sd(rhs_ptr + 1);
+		const __m256d r_zzzz = _mm256_broadcast_sd(rhs_ptr + 2);
+		const __m256d r_wwww = _mm256_broadcast_sd(rhs_ptr + 3);
+
+		const __m256d lxrw_lyrw_lzrw_lwrw = _mm256_mul_pd(r_wwww, lhs);
+		const __m256d l_zwxy = _mm256_permute2f128_pd(lhs, lhs, 0x01);
+		const __m256d l_wzyx = _mm256_permute_pd(l_zwxy, 0x5);
+		const __m256d l_yxwz = _mm256_permute_pd(lhs, 0x5);
+
+		const __m256d lwrx_lzrx_lyrx_lxrx = _mm256_mul_pd(r_xxxx, l_wzyx);
+		const __m256d lwrx_nlzrx_lyrx_nlxrx = _mm256_xor_pd(lwrx_lzrx_lyrx_lxrx, control_wzyx);
+
+		const __m256d lzry_lwry_lxry_lyry = _mm256_mul_pd(r_yyyy, l_zwxy);
+		const __m256d lzry_lwry_nlxry_nlyry = _mm256_xor_pd(lzry_lwry_lxry_lyry, control_zwxy);
+
+		const __m256d lyrz_lxrz_lwrz_lzrz = _mm256_mul_pd(r_zzzz, l_yxwz);
+		const __m256d nlyrz_lxrz_lwrz_nlzrz = _mm256_xor_pd(lyrz_lxrz_lwrz_lzrz, control_yxwz);
+
+		const __m256d result0 = _mm256_add_pd(lxrw_lyrw_lzrw_lwrw, lwrx_nlzrx_lyrx_nlxrx);
+		const __m256d result1 = _mm256_add_pd(lzry_lwry_nlxry_nlyry, nlyrz_lxrz_lwrz_nlzrz);
+		return _mm256_add_pd(result0, result1);
+#else
 		double lhs_x = quat_get_x(lhs);
 		double lhs_y = quat_get_y(lhs);
 		double lhs_z = quat_get_z(lhs);
@@ -398,6 +493,7 @@ namespace rtm
 		double w = (rhs_w * lhs_w) - (rhs_x * lhs_x) - (rhs_y * lhs_y) - (rhs_z * lhs_z);
 
 		return quat_set(x, y, z, w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -406,9 +502,29 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d quat_mul_vector3(const vector4d& vector, const quatd& rotation) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX2_INTRINSICS)
+		// Expanding both quaternion multiplications and dropping the terms that cancel out yields:
+		// t = 2 * cross(rotation.xyz, vector), result = vector + (rotation.w * t) + cross(rotation.xyz, t)
+		// A cross product needs two [yzx] permutations: cross(a, b) = ((a * b.yzx) - (a.yzx * b)).yzx
+		// We don't care about the result W lane.
+		const __m256d rotation_w = _mm256_broadcast_sd(reinterpret_cast<const double*>(&rotation) + 3);
+		const __m256d rotation_yzx = _mm256_permute4x64_pd(rotation, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m256d vector_yzx = _mm256_permute4x64_pd(vector, _MM_SHUFFLE(3, 0, 2, 1));
+
+		const __m256d cross_rv_zxy = _mm256_sub_pd(_mm256_mul_pd(rotation, vector_yzx), _mm256_mul_pd(rotation_yzx, vector));
+		const __m256d t_zxy = _mm256_add_pd(cross_rv_zxy, cross_rv_zxy);
+		const __m256d t = _mm256_permute4x64_pd(t_zxy, _MM_SHUFFLE(3, 0, 2, 1));
+		const __m256d t_yzx = _mm256_permute4x64_pd(t_zxy, _MM_SHUFFLE(3, 1, 0, 2));
+
+		const __m256d cross_rt_zxy = _mm256_sub_pd(_mm256_mul_pd(rotation, t_yzx), _mm256_mul_pd(rotation_yzx, t));
+		const __m256d cross_rt = _mm256_permute4x64_pd(cross_rt_zxy, _MM_SHUFFLE(3, 0, 2, 1));
+
+		return _mm256_add_pd(_mm256_add_pd(vector, _mm256_mul_pd(rotation_w, t)), cross_rt);
+#else
 		quatd vector_quat = quat_set_w(vector_to_quat(vector), 0.0);
 		quatd inv_rotation = quat_conjugate(rotation);
 		return quat_to_vector(quat_mul(quat_mul(inv_rotation, vector_quat), rotation));
+#endif
 	}
 
 	namespace rtm_impl
@@ -423,6 +539,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return vector_dot(quat_to_vector(lhs), quat_to_vector(rhs));
+#else
 				const scalard lhs_x = quat_get_x(lhs);
 				const scalard lhs_y = quat_get_y(lhs);
 				const scalard lhs_z = quat_get_z(lhs);
@@ -436,11 +555,15 @@ namespace rtm
 				const scalard zz = scalar_mul(lhs_z, rhs_z);
 				const scalard ww = scalar_mul(lhs_w, rhs_w);
 				return scalar_cast(scalar_add(scalar_add(xx, yy), scalar_add(zz, ww)));
+#endif
 			}
 
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return vector_dot(quat_to_vector(lhs), quat_to_vector(rhs));
+#else
 				const scalard lhs_x = quat_get_x(lhs);
 				const scalard lhs_y = quat_get_y(lhs);
 				const scalard lhs_z = quat_get_z(lhs);
@@ -454,6 +577,7 @@ namespace rtm
 				const scalard zz = scalar_mul(lhs_z, rhs_z);
 				const scalard ww = scalar_mul(lhs_w, rhs_w);
 				return scalar_add(scalar_add(xx, yy), scalar_add(zz, ww));
+#endif
 			}
 #endif
 
@@ -632,6 +756,23 @@ namespace rtm
 		end_v = vector_select(is_angle_negative, vector_neg(end_v), end_v);
 		cos_half_angle_v = vector_select(is_angle_negative, vector_neg(cos_half_angle_v), cos_half_angle_v);
 
+#if defined(RTM_SSE4_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		// Every lane holds the cosine, acos is evaluated with SIMD instead of the C math library
+		vector4d half_angle = vector_acos(cos_half_angle_v);
+#else
+		// With two __m128d halves, a single C math library call is faster than acos in every lane
+		vector4d half_angle = vector_set(scalar_acos(double(vector_get_x(cos_half_angle_v))));
+#endif
+		vector4d sin_half_angle = vector_sqrt(vector_sub(vector_set(1.0), vector_mul(cos_half_angle_v, cos_half_angle_v)));
+
+		// The sine of both contribution angles is evaluated with SIMD
+		const double alpha_ = scalar_cast(alpha);
+		vector4d contribution_angles = vector_mul(vector_set(1.0 - alpha_, alpha_, 1.0 - alpha_, alpha_), half_angle);
+		vector4d contributions = vector_div(vector_sin(contribution_angles), sin_half_angle);
+		vector4d start_contribution = vector_dup_x(contributions);
+		vector4d end_contribution = vector_dup_y(contributions);
+#else
 		scalard cos_half_angle = vector_get_x(cos_half_angle_v);
 		scalard half_angle = scalar_acos(cos_half_angle);
 		scalard sin_half_angle = scalar_sqrt(scalar_sub(scalar_set(1.0), scalar_mul(cos_half_angle, cos_half_angle)));
@@ -643,6 +784,7 @@ namespace rtm
 		vector4d contributions = vector_mul(vector_sin(contribution_angles), inv_sin_half_angle);
 		vector4d start_contribution = vector_dup_x(contributions);
 		vector4d end_contribution = vector_dup_y(contributions);
+#endif
 
 		vector4d result = vector_add(vector_mul(start_v, start_contribution), vector_mul(end_v, end_contribution));
 		return vector_to_quat(result);
@@ -656,6 +798,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline quatd RTM_SIMD_CALL quat_slerp(const quatd& start, const quatd& end, double alpha) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return quat_slerp(start, end, scalar_set(alpha));
+#else
 		vector4d start_v = quat_to_vector(start);
 		vector4d end_v = quat_to_vector(end);
 		scalard alpha_s = scalar_set(alpha);
@@ -681,6 +826,7 @@ namespace rtm
 
 		vector4d result = vector_add(vector_mul(start_v, start_contribution), vector_mul(end_v, end_contribution));
 		return vector_to_quat(result);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -726,15 +872,54 @@ namespace rtm
 		return scale_sq >= epsilon_squared ? vector_mul(quat_to_vector(input), vector_set(scalar_sqrt_reciprocal(scale_sq))) : vector_set(1.0, 0.0, 0.0);
 	}
 
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// This is a helper struct to allow a single consistent API between
+		// various vector types when the semantics are identical but the return
+		// type differs. Implicit coercion is used to return the desired value
+		// at the call site.
+		//////////////////////////////////////////////////////////////////////////
+		struct quatd_quat_get_angle
+		{
+			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
+			{
+				const scalard input_w = quat_get_w(input);
+				return scalar_cast(scalar_acos(input_w)) * 2.0;
+			}
+
+#if defined(RTM_SSE2_INTRINSICS)
+			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
+			{
+				const scalard input_w = quat_get_w(input);
+				const scalard half_angle = scalar_acos(input_w);
+				return scalar_add(half_angle, half_angle);
+			}
+#endif
+
+			quatd input;
+		};
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the rotation angle part of the input quaternion.
 	//////////////////////////////////////////////////////////////////////////
-	inline double quat_get_angle(const quatd& input) RTM_NO_EXCEPT
+	constexpr rtm_impl::quatd_quat_get_angle quat_get_angle(const quatd& input) RTM_NO_EXCEPT
 	{
-		const scalard input_w = quat_get_w(input);
-		return scalar_cast(scalar_acos(input_w)) * 2.0;
+		return rtm_impl::quatd_quat_get_angle{ input };
 	}
 
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the rotation axis and rotation angle that make up the input quaternion.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_to_axis_angle(const quatd& input, vector4d& out_axis, scalard& out_angle) RTM_NO_EXCEPT
+	{
+		out_angle = quat_get_angle(input);
+		out_axis = quat_get_axis(input);
+	}
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a quaternion from a rotation axis and a rotation angle.
 	//////////////////////////////////////////////////////////////////////////
@@ -747,6 +932,20 @@ namespace rtm
 		return vector_to_quat(vector_set_w(vector_mul(sin_, axis), cos_));
 	}
 
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a quaternion from a rotation axis and a rotation angle.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatd quat_from_axis_angle(const vector4d& axis, const scalard& angle) RTM_NO_EXCEPT
+	{
+		vector4d sincos_ = scalar_sincos(scalar_mul(angle, scalar_set(0.5)));
+		vector4d sin_ = vector_dup_x(sincos_);
+		scalard cos_ = vector_get_y(sincos_);
+
+		return vector_to_quat(vector_set_w(vector_mul(sin_, axis), cos_));
+	}
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// Creates a quaternion from Euler Pitch/Yaw/Roll angles.
 	// Pitch is around the Y axis (right)
@@ -772,6 +971,35 @@ namespace rtm
 			cr * cp * cy + sr * sp * sy);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the Euler Pitch/Yaw/Roll angles of a normalized quaternion, see quat_from_euler.
+	// Pitch lies in [-pi/2, pi/2] while yaw and roll lie in [-pi, pi].
+	// When the pitch is near +-pi/2 (gimbal lock), yaw and roll rotate around the same axis:
+	// the roll is then 0.0 and the yaw holds the whole rotation.
+	//////////////////////////////////////////////////////////////////////////
+	inline void quat_to_euler(const quatd& input, double& out_pitch, double& out_yaw, double& out_roll) RTM_NO_EXCEPT
+	{
+		const double x = quat_get_x(input);
+		const double y = quat_get_y(input);
+		const double z = quat_get_z(input);
+		const double w = quat_get_w(input);
+
+		const double sin_pitch = 2.0 * (z * x - w * y);
+		if (scalar_abs(sin_pitch) >= 0.999999999)
+		{
+			const double half_pi = rtm::constants::half_pi();
+			out_pitch = sin_pitch >= 0.0 ? half_pi : -half_pi;
+			out_yaw = scalar_atan2(2.0 * ((w * z) - (x * y)), 1.0 - 2.0 * ((x * x) + (z * z)));
+			out_roll = 0.0;
+		}
+		else
+		{
+			out_pitch = scalar_asin(sin_pitch);
+			out_yaw = scalar_atan2(2.0 * ((w * z) + (x * y)), 1.0 - 2.0 * ((y * y) + (z * z)));
+			out_roll = scalar_atan2(-2.0 * ((w * x) + (y * z)), 1.0 - 2.0 * ((x * x) + (y * y)));
+		}
+	}
+
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -785,7 +1013,13 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool quat_is_finite(const quatd& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		// A finite value is ordered and smaller than infinity in absolute value
+		const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFULL));
+		const __m256d abs_input = _mm256_and_pd(input, abs_mask);
+		const __m256d is_finite = _mm256_cmp_pd(abs_input, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_LT_OQ);
+		return _mm256_movemask_pd(is_finite) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		const __m128i abs_mask = _mm_set_epi64x(0x7FFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL);
 		__m128d abs_input_xy = _mm_and_pd(input.xy, _mm_castsi128_pd(abs_mask));
 		__m128d abs_input_zw = _mm_and_pd(input.zw, _mm_castsi128_pd(abs_mask));
@@ -815,6 +1049,17 @@ namespace rtm
 		return scalar_abs(length_squared - 1.0) < threshold;
 	}
 
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the input quaternion is normalized, otherwise false.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool quat_is_normalized(const quatd& input, const scalard& threshold) RTM_NO_EXCEPT
+	{
+		const scalard length_squared = quat_length_squared(input);
+		return scalar_lower_than(scalar_abs(scalar_sub(length_squared, scalar_set(1.0))), threshold);
+	}
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if the two quaternions are nearly equal component wise, otherwise false.
 	//////////////////////////////////////////////////////////////////////////
@@ -823,6 +1068,16 @@ namespace rtm
 		return vector_all_near_equal(quat_to_vector(lhs), quat_to_vector(rhs), threshold);
 	}
 
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the two quaternions are nearly equal component wise, otherwise false.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool quat_near_equal(const quatd& lhs, const quatd& rhs, const scalard& threshold) RTM_NO_EXCEPT
+	{
+		return vector_all_less_equal(vector_abs(vector_sub(quat_to_vector(lhs), quat_to_vector(rhs))), vector_set(threshold));
+	}
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns true if the input quaternion is nearly equal to the identity quaternion
 	// by comparing its rotation angle.
@@ -834,6 +1089,20 @@ namespace rtm
 		const double positive_w_angle = scalar_acos(scalar_cast(scalar_abs(input_w))) * 2.0;
 		return positive_w_angle < threshold_angle;
 	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the input quaternion is nearly equal to the identity quaternion
+	// by comparing its rotation angle.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool quat_near_identity(const quatd& input, const scalard& threshold_angle) RTM_NO_EXCEPT
+	{
+		// See the quatf version of quat_near_identity for details.
+		const scalard input_w = quat_get_w(input);
+		const scalard positive_w_half_angle = scalar_acos(scalar_abs(input_w));
+		return scalar_lower_than(scalar_add(positive_w_half_angle, positive_w_half_angle), threshold_angle);
+	}
+#endif
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,166 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/vector4fx.h"
+#include "rtm/vector4i.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// Fixed point quaternions with Q16.16 components, see rtm/vector4fx.h.
+// Like vector4fx, every function returns the same bits on every platform.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a quatfx from the raw Q16.16 integer values of its [xyzw] components.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatfx RTM_SIMD_CALL quat_fx_from_raw(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+		return quatfx{ input };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the raw Q16.16 integer values of the [xyzw] components.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL quat_fx_to_raw(quatfx_arg0 input) RTM_NO_EXCEPT
+	{
+		return input.value;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the identity rotation.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatfx RTM_SIMD_CALL quat_fx_identity() RTM_NO_EXCEPT
+	{
+		return quatfx{ vector_set(0, 0, 0, rtm_impl::k_fx_one) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a quatf into fixed point, rounding to the nearest Q16.16 value with banker's rounding.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatfx RTM_SIMD_CALL quat_to_fx(quatf_arg0 input) RTM_NO_EXCEPT
+	{
+		return quatfx{ vector_to_fx(quat_to_vector(input)).value };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a quatfx into floating point.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_from_fx(quatfx_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_to_quat(vector_from_fx(vector4fx{ input.value }));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the quaternion conjugate: [-x, -y, -z, w]
+	//////////////////////////////////////////////////////////////////////////
+	inline quatfx RTM_SIMD_CALL quat_conjugate(quatfx_arg0 input) RTM_NO_EXCEPT
+	{
+		return quatfx{ rtm_impl::vector_fx_negate_masked(input.value, vector_set(-1, -1, -1, 0)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies two quaternions, each product is rounded to the nearest Q16.16 value.
+	// Multiplication order is as follow: local_to_world = quat_mul(local_to_object, object_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline quatfx RTM_SIMD_CALL quat_mul(quatfx_arg0 lhs, quatfx_arg1 rhs) RTM_NO_EXCEPT
+	{
+		// result = rhs.w * lhs + rhs.x * [lhs.w, -lhs.z, lhs.y, -lhs.x] + rhs.y * [lhs.z, lhs.w, -lhs.x, -lhs.y] + rhs.z * [-lhs.y, lhs.x, lhs.w, -lhs.z]
+		const vector4i lhs_wzyx = rtm_impl::vector_fx_negate_masked(rtm_impl::vector_fx_swizzle<3, 2, 1, 0>(lhs.value), vector_set(0, -1, 0, -1));
+		const vector4i lhs_zwxy = rtm_impl::vector_fx_negate_masked(rtm_impl::vector_fx_swizzle<2, 3, 0, 1>(lhs.value), vector_set(0, 0, -1, -1));
+		const vector4i lhs_yxwz = rtm_impl::vector_fx_negate_masked(rtm_impl::vector_fx_swizzle<1, 0, 3, 2>(lhs.value), vector_set(-1, 0, 0, -1));
+
+		const vector4i rhs_xxxx = rtm_impl::vector_fx_swizzle<0, 0, 0, 0>(rhs.value);
+		const vector4i rhs_yyyy = rtm_impl::vector_fx_swizzle<1, 1, 1, 1>(rhs.value);
+		const vector4i rhs_zzzz = rtm_impl::vector_fx_swizzle<2, 2, 2, 2>(rhs.value);
+		const vector4i rhs_wwww = rtm_impl::vector_fx_swizzle<3, 3, 3, 3>(rhs.value);
+
+		const vector4i result_w = rtm_impl::vector_fx_mul_shift(rhs_wwww, lhs.value, 16);
+		const vector4i result_x = rtm_impl::vector_fx_mul_shift(rhs_xxxx, lhs_wzyx, 16);
+		const vector4i result_y = rtm_impl::vector_fx_mul_shift(rhs_yyyy, lhs_zwxy, 16);
+		const vector4i result_z = rtm_impl::vector_fx_mul_shift(rhs_zzzz, lhs_yxwz, 16);
+		return quatfx{ vector_add(vector_add(result_w, result_x), vector_add(result_y, result_z)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a quaternion and a 3D vector, rotating it.
+	// Multiplication order is as follow: world_position = quat_mul_vector3(local_vector, local_to_world)
+	// The rotation must be normalized. The [w] component of the input vector is retained.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL quat_mul_vector3(vector4fx_arg0 vector, quatfx_arg1 rotation) RTM_NO_EXCEPT
+	{
+		// Like quat_mul_vector3, we use the cross product form: v + 2w(r x v) + 2r x (r x v)
+		const vector4fx rotation_xyz = vector4fx{ vector_and(rotation.value, vector_set(-1, -1, -1, 0)) };
+		const vector4fx cross = vector_cross3(rotation_xyz, vector);
+		const vector4fx t = vector_add(cross, cross);
+
+		const vector4i rotation_wwww = rtm_impl::vector_fx_swizzle<3, 3, 3, 3>(rotation.value);
+		const vector4i w_t = rtm_impl::vector_fx_mul_shift(rotation_wwww, t.value, 16);
+		return vector_add(vector_add(vector, vector4fx{ w_t }), vector_cross3(rotation_xyz, t));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized quaternion, see vector_normalize3 for its precision.
+	// A zero length input returns zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatfx RTM_SIMD_CALL quat_normalize(quatfx_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4i length_squared = rtm_impl::vector_fx_sum(rtm_impl::vector_fx_mul_shift(input.value, input.value, 16));
+		return quatfx{ rtm_impl::vector_fx_mul_sqrt_reciprocal(input.value, length_squared) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a quaternion from a normalized axis and an angle in radians, held as
+	// a raw Q16.16 value.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatfx RTM_SIMD_CALL quat_from_axis_angle(vector4fx_arg0 axis, int32_t angle) RTM_NO_EXCEPT
+	{
+		vector4fx sine;
+		vector4fx cosine;
+		vector_sincos(vector_fx_from_raw(vector_set(angle / 2)), sine, cosine);
+
+		// [axis.xyz * sin(angle / 2), cos(angle / 2)]
+		const vector4i xyz_mask = vector_set(-1, -1, -1, 0);
+		const vector4i w_mask = vector_set(0, 0, 0, -1);
+		const vector4i axis_one = vector_or(vector_and(axis.value, xyz_mask), vector_set(0, 0, 0, rtm_impl::k_fx_one));
+		const vector4i sin_cos = vector_or(vector_and(sine.value, xyz_mask), vector_and(cosine.value, w_mask));
+		return quatfx{ rtm_impl::vector_fx_mul_shift(axis_one, sin_cos, 16) };
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,165 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/quatd.h"
+#include "rtm/vector4d.h"
+#include "rtm/matrix3x4d.h"
+#include "rtm/impl/compiler_utils.h"
+#include "rtm/impl/qvs_common.h"
+#include "rtm/impl/qvv_common.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a QVS transform from a rotation quaternion, a translation, and a uniform scale.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvsd qvs_set(const quatd& rotation, const vector4d& translation, double scale) RTM_NO_EXCEPT
+	{
+		return qvs_set(rotation, vector_set_w(translation, scale));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Casts a QVS transform float32 variant to a float64 variant.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvsd qvs_cast(const qvsf& input) RTM_NO_EXCEPT
+	{
+		return qvsd{ quat_cast(input.rotation), vector_cast(input.translation_scale) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the translation of a QVS transform with the [w] component set to zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d qvs_get_translation(const qvsd& input) RTM_NO_EXCEPT
+	{
+		return vector_set_w(input.translation_scale, 0.0);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the uniform scale of a QVS transform.
+	//////////////////////////////////////////////////////////////////////////
+	inline double qvs_get_scale(const qvsd& input) RTM_NO_EXCEPT
+	{
+		return vector_get_w(input.translation_scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies two QVS transforms.
+	// Multiplication order is as follow: local_to_world = qvs_mul(local_to_object, object_to_world)
+	// A uniform scale commutes with the rotation, negative scale is supported without a fallback.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvsd qvs_mul(const qvsd& lhs, const qvsd& rhs) RTM_NO_EXCEPT
+	{
+		// Scaling the whole lhs translation by the rhs scale also yields the combined scale in [w]
+		const vector4d scaled_translation_scale = vector_mul(lhs.translation_scale, vector_dup_w(rhs.translation_scale));
+
+		const quatd rotation = quat_mul(lhs.rotation, rhs.rotation);
+		const vector4d translation = vector_add(quat_mul_vector3(scaled_translation_scale, rhs.rotation), rhs.translation_scale);
+		return qvs_set(rotation, vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(translation, scaled_translation_scale));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a QVS transform and a 3D point.
+	// Multiplication order is as follow: world_position = qvs_mul_point3(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d qvs_mul_point3(const vector4d& point, const qvsd& qvs) RTM_NO_EXCEPT
+	{
+		return vector_add(quat_mul_vector3(vector_mul(point, vector_dup_w(qvs.translation_scale)), qvs.rotation), qvs.translation_scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies a QVS transform and a 3D point ignoring the scale.
+	// Multiplication order is as follow: world_position = qvs_mul_point3_no_scale(local_position, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d qvs_mul_point3_no_scale(const vector4d& point, const qvsd& qvs) RTM_NO_EXCEPT
+	{
+		return vector_add(quat_mul_vector3(point, qvs.rotation), qvs.translation_scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the inverse of the input QVS transform.
+	// The scale must not be zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvsd qvs_inverse(const qvsd& input) RTM_NO_EXCEPT
+	{
+		const quatd inv_rotation = quat_conjugate(input.rotation);
+		const vector4d inv_scale = vector_reciprocal(vector_dup_w(input.translation_scale));
+		const vector4d inv_translation = vector_neg(quat_mul_vector3(vector_mul(input.translation_scale, inv_scale), inv_rotation));
+		return qvs_set(inv_rotation, vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(inv_translation, inv_scale));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a QVS transform with the rotation part normalized.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvsd qvs_normalize(const qvsd& input) RTM_NO_EXCEPT
+	{
+		const quatd rotation = quat_normalize(input.rotation);
+		return qvs_set(rotation, input.translation_scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a QVS transform into a QVV transform.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd qvv_from_qvs(const qvsd& input) RTM_NO_EXCEPT
+	{
+		return qvv_set(input.rotation, qvs_get_translation(input), vector_dup_w(input.translation_scale));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a QVV transform into a QVS transform.
+	// The 3D scale must be uniform, only its [x] component is used.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvsd qvs_from_qvv(const qvvd& input) RTM_NO_EXCEPT
+	{
+		return qvs_set(input.rotation, vector_mix<mix4::x, mix4::y, mix4::z, mix4::a>(input.translation, input.scale));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a QVS transform into a 3x4 affine matrix.
+	//////////////////////////////////////////////////////////////////////////
+	inline matrix3x4d matrix_from_qvs(const qvsd& input) RTM_NO_EXCEPT
+	{
+		return matrix_from_qvv(input.rotation, qvs_get_translation(input), vector_dup_w(input.translation_scale));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a 3x4 affine matrix with uniform scale into a QVS transform.
+	// A negative determinant yields a negative scale. The scale must not be zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvsd qvs_from_matrix(const matrix3x4d& input) RTM_NO_EXCEPT
+	{
+		const double scale_abs = vector_length3(input.x_axis);
+		const double scale = scalar_cast(matrix_determinant(input)) < 0.0 ? -scale_abs : scale_abs;
+		const double inv_scale = 1.0 / scale;
+
+		const quatd rotation = rtm_impl::quat_from_matrix(vector_mul(input.x_axis, inv_scale), vector_mul(input.y_axis, inv_scale), vector_mul(input.z_axis, inv_scale));
+		return qvs_set(rotation, input.w_axis, scale);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
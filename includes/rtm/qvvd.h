@@ -140,6 +140,117 @@ namespace rtm
 		const quatd rotation = quat_normalize(input.rotation);
 		return qvv_set(rotation, input.translation, input.scale);
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the linear interpolation between two QVV transforms for a given alpha value.
+	// The rotation is interpolated with quat_lerp: 'end' is flipped when the rotations are
+	// on opposite ends of the hypersphere and the result is normalized.
+	// The translation and the scale are interpolated with vector_lerp.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd qvv_lerp(const qvvd& start, const qvvd& end, double alpha) RTM_NO_EXCEPT
+	{
+		const quatd rotation = quat_lerp(start.rotation, end.rotation, alpha);
+		const vector4d translation = vector_lerp(start.translation, end.translation, alpha);
+		const vector4d scale = vector_lerp(start.scale, end.scale, alpha);
+		return qvv_set(rotation, translation, scale);
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the linear interpolation between two QVV transforms for a given alpha value.
+	// The rotation is interpolated with quat_lerp: 'end' is flipped when the rotations are
+	// on opposite ends of the hypersphere and the result is normalized.
+	// The translation and the scale are interpolated with vector_lerp.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd qvv_lerp(const qvvd& start, const qvvd& end, const scalard& alpha) RTM_NO_EXCEPT
+	{
+		const quatd rotation = quat_lerp(start.rotation, end.rotation, alpha);
+		const vector4d translation = vector_lerp(start.translation, end.translation, alpha);
+		const vector4d scale = vector_lerp(start.scale, end.scale, alpha);
+		return qvv_set(rotation, translation, scale);
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the additive QVV transform that qvv_apply_additive applies on top of a
+	// reference transform to reproduce a pose with a weight of 1.0:
+	// the rotation is quat_mul(pose.rotation, quat_conjugate(reference.rotation)), flipped
+	// to have a positive [w] component, the translation is pose.translation - reference.translation,
+	// and the 3D scale is pose.scale / reference.scale. The reference scale cannot be zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd qvv_extract_additive(const qvvd& pose, const qvvd& reference) RTM_NO_EXCEPT
+	{
+		const quatd rotation = quat_mul(pose.rotation, quat_conjugate(reference.rotation));
+		const vector4d translation = vector_sub(pose.translation, reference.translation);
+		// The [w] component of the reference scale is ignored, it is usually zero
+		const vector4d scale = vector_div(pose.scale, vector_set_w(reference.scale, 1.0));
+		return qvv_set(quat_get_w(rotation) >= 0.0 ? rotation : quat_neg(rotation), translation, scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Applies an additive QVV transform on top of a base QVV transform with a given weight.
+	// The additive rotation is applied first, in the local space of the base rotation:
+	// quat_mul(additive_rotation, base.rotation) where the additive rotation is interpolated
+	// from the identity with quat_lerp. The additive translation is added and the additive
+	// scale is multiplicative: an additive transform with a [1,1,1] 3D scale leaves the base
+	// scale unchanged. A weight of 0.0 returns the base transform.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd qvv_apply_additive(const qvvd& base, const qvvd& additive, double weight) RTM_NO_EXCEPT
+	{
+		const quatd additive_rotation = quat_lerp(quat_identity(), additive.rotation, weight);
+		const quatd rotation = quat_mul(additive_rotation, base.rotation);
+		const vector4d translation = vector_mul_add(additive.translation, weight, base.translation);
+		const vector4d scale = vector_mul(base.scale, vector_lerp(vector_set(1.0), additive.scale, weight));
+		return qvv_set(rotation, translation, scale);
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Applies an additive QVV transform on top of a base QVV transform with a given weight.
+	// The additive rotation is applied first, in the local space of the base rotation:
+	// quat_mul(additive_rotation, base.rotation) where the additive rotation is interpolated
+	// from the identity with quat_lerp. The additive translation is added and the additive
+	// scale is multiplicative: an additive transform with a [1,1,1] 3D scale leaves the base
+	// scale unchanged. A weight of 0.0 returns the base transform.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd qvv_apply_additive(const qvvd& base, const qvvd& additive, const scalard& weight) RTM_NO_EXCEPT
+	{
+		const quatd additive_rotation = quat_lerp(quat_identity(), additive.rotation, weight);
+		const quatd rotation = quat_mul(additive_rotation, base.rotation);
+		const vector4d translation = vector_mul_add(additive.translation, weight, base.translation);
+		const vector4d scale = vector_mul(base.scale, vector_lerp(vector_set(1.0), additive.scale, weight));
+		return qvv_set(rotation, translation, scale);
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decomposes a 3x4 affine matrix into a QVV transform in a single pass.
+	// The axis lengths are computed once and used both as the 3D scale and to remove it
+	// before the rotation is extracted, unlike matrix_remove_scale followed by quat_from_matrix.
+	// When the matrix contains a reflection (negative determinant), the X scale is negative.
+	// A zero scale axis has an identity rotation like quat_from_matrix. Skew/shear is lost.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvd qvv_from_matrix(const matrix3x4d& input) RTM_NO_EXCEPT
+	{
+		const double x_length_sq = vector_length_squared3(input.x_axis);
+		const double y_length_sq = vector_length_squared3(input.y_axis);
+		const double z_length_sq = vector_length_squared3(input.z_axis);
+		const vector4d abs_scale = vector_sqrt(vector_set(x_length_sq, y_length_sq, z_length_sq, 0.0));
+
+		// A reflection is retained by flipping the X axis
+		const double determinant = vector_dot3(vector_cross3(input.x_axis, input.y_axis), input.z_axis);
+		const vector4d scale = determinant < 0.0 ? vector_mul(abs_scale, vector_set(-1.0, 1.0, 1.0, 1.0)) : abs_scale;
+
+		const mask4d is_non_zero = vector_greater_than(abs_scale, vector_zero());
+		const vector4d inv_scale = vector_select(is_non_zero, vector_div(vector_set(1.0), scale), vector_zero());
+
+		const vector4d x_axis = vector_mul(input.x_axis, vector_dup_x(inv_scale));
+		const vector4d y_axis = vector_mul(input.y_axis, vector_dup_y(inv_scale));
+		const vector4d z_axis = vector_mul(input.z_axis, vector_dup_z(inv_scale));
+
+		const quatd rotation = rtm_impl::quat_from_matrix(x_axis, y_axis, z_axis);
+		return qvv_set(rotation, input.w_axis, scale);
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -44,6 +44,93 @@ namespace rtm
 		return qvvf{ quat_cast(input.rotation), vector_cast(input.translation), vector_cast(input.scale) };
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an unaligned packed QVV transform from memory.
+	// The [w] components of the translation and scale are set to zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_load_packed(const qvvf_packed* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const float* input_ptr = &input->rotation.x;
+		const __m128 xyz_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+		// The last load starts one float early to stay within the packed transform
+		const __m128 rotation = _mm_loadu_ps(input_ptr + 0);
+		const __m128 tx_ty_tz_sx = _mm_loadu_ps(input_ptr + 4);
+		const __m128 tz_sx_sy_sz = _mm_loadu_ps(input_ptr + 6);
+
+		const __m128 translation = _mm_and_ps(tx_ty_tz_sx, xyz_mask);
+		const __m128 scale = _mm_and_ps(_mm_shuffle_ps(tz_sx_sy_sz, tz_sx_sy_sz, _MM_SHUFFLE(0, 3, 2, 1)), xyz_mask);
+		return qvv_set(rotation, translation, scale);
+#else
+		return qvv_set(quat_load(&input->rotation.x), vector_load3(&input->translation), vector_load3(&input->scale));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an unaligned packed QVV transform with uniform scale from memory.
+	// The [w] components of the translation and scale are set to zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_load_packed(const qvvf_packed_uniform_scale* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const float* input_ptr = &input->rotation.x;
+		const __m128 xyz_mask = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+		const __m128 rotation = _mm_loadu_ps(input_ptr + 0);
+		const __m128 tx_ty_tz_s = _mm_loadu_ps(input_ptr + 4);
+
+		const __m128 translation = _mm_and_ps(tx_ty_tz_s, xyz_mask);
+		const __m128 scale = _mm_and_ps(_mm_shuffle_ps(tx_ty_tz_s, tx_ty_tz_s, _MM_SHUFFLE(3, 3, 3, 3)), xyz_mask);
+		return qvv_set(rotation, translation, scale);
+#else
+		return qvv_set(quat_load(&input->rotation.x), vector_load3(&input->translation), vector_set(input->scale, input->scale, input->scale, 0.0F));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a QVV transform to unaligned memory without the SIMD padding.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_store_packed(qvvf_arg0 input, qvvf_packed* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		float* output_ptr = &output->rotation.x;
+
+		const __m128 tz_tz_sx_sx = _mm_shuffle_ps(input.translation, input.scale, _MM_SHUFFLE(0, 0, 2, 2));
+		const __m128 tx_ty_tz_sx = _mm_shuffle_ps(input.translation, tz_tz_sx_sx, _MM_SHUFFLE(2, 0, 1, 0));
+		const __m128 sy_sz_sy_sz = _mm_shuffle_ps(input.scale, input.scale, _MM_SHUFFLE(2, 1, 2, 1));
+
+		_mm_storeu_ps(output_ptr + 0, input.rotation);
+		_mm_storeu_ps(output_ptr + 4, tx_ty_tz_sx);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(output_ptr + 8), _mm_castps_si128(sy_sz_sy_sz));
+#else
+		quat_store(input.rotation, &output->rotation);
+		vector_store3(input.translation, &output->translation);
+		vector_store3(input.scale, &output->scale);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a QVV transform with uniform scale to unaligned memory without the SIMD padding.
+	// Only the [x] component of the scale is written.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL qvv_store_packed(qvvf_arg0 input, qvvf_packed_uniform_scale* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		float* output_ptr = &output->rotation.x;
+
+		const __m128 tz_tz_sx_sx = _mm_shuffle_ps(input.translation, input.scale, _MM_SHUFFLE(0, 0, 2, 2));
+		const __m128 tx_ty_tz_sx = _mm_shuffle_ps(input.translation, tz_tz_sx_sx, _MM_SHUFFLE(2, 0, 1, 0));
+
+		_mm_storeu_ps(output_ptr + 0, input.rotation);
+		_mm_storeu_ps(output_ptr + 4, tx_ty_tz_sx);
+#else
+		quat_store(input.rotation, &output->rotation);
+		vector_store3(input.translation, &output->translation);
+		output->scale = vector_get_x(input.scale);
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Multiplies two QVV transforms.
 	// Multiplication order is as follow: local_to_world = qvv_mul(local_to_object, object_to_world)
@@ -94,7 +181,7 @@ namespace rtm
 	// The resulting QVV transform with have a [1,1,1] 3D scale.
 	// Multiplication order is as follow: local_to_world = qvv_mul(local_to_object, object_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline qvvf RTM_SIMD_CALL qvv_mul_no_scale(qvvf_arg0 lhs, qvvf_arg1 rhs) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL qvvf RTM_SIMD_CALL qvv_mul_no_scale(qvvf_arg0 lhs, qvvf_arg1 rhs) RTM_NO_EXCEPT
 	{
 		const quatf rotation = quat_mul(lhs.rotation, rhs.rotation);
 		const vector4f translation = vector_add(quat_mul_vector3(lhs.translation, rhs.rotation), rhs.translation);
@@ -105,7 +192,7 @@ namespace rtm
 	// Multiplies a QVV transform and a 3D point.
 	// Multiplication order is as follow: world_position = qvv_mul_point3(local_position, local_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL qvv_mul_point3(vector4f_arg0 point, qvvf_arg1 qvv) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL qvv_mul_point3(vector4f_arg0 point, qvvf_arg1 qvv) RTM_NO_EXCEPT
 	{
 		return vector_add(quat_mul_vector3(vector_mul(qvv.scale, point), qvv.rotation), qvv.translation);
 	}
@@ -114,7 +201,7 @@ namespace rtm
 	// Multiplies a QVV transform and a 3D point ignoring 3D scale.
 	// Multiplication order is as follow: world_position = qvv_mul_point3_no_scale(local_position, local_to_world)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL qvv_mul_point3_no_scale(vector4f_arg0 point, qvvf_arg1 qvv) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL qvv_mul_point3_no_scale(vector4f_arg0 point, qvvf_arg1 qvv) RTM_NO_EXCEPT
 	{
 		return vector_add(quat_mul_vector3(point, qvv.rotation), qvv.translation);
 	}
@@ -149,6 +236,118 @@ namespace rtm
 		const quatf rotation = quat_normalize(input.rotation);
 		return qvv_set(rotation, input.translation, input.scale);
 	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the linear interpolation between two QVV transforms for a given alpha value.
+	// The rotation is interpolated with quat_lerp: 'end' is flipped when the rotations are
+	// on opposite ends of the hypersphere and the result is normalized.
+	// The translation and the scale are interpolated with vector_lerp.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_lerp(qvvf_arg0 start, qvvf_arg1 end, float alpha) RTM_NO_EXCEPT
+	{
+		const quatf rotation = quat_lerp(start.rotation, end.rotation, alpha);
+		const vector4f translation = vector_lerp(start.translation, end.translation, alpha);
+		const vector4f scale = vector_lerp(start.scale, end.scale, alpha);
+		return qvv_set(rotation, translation, scale);
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the linear interpolation between two QVV transforms for a given alpha value.
+	// The rotation is interpolated with quat_lerp: 'end' is flipped when the rotations are
+	// on opposite ends of the hypersphere and the result is normalized.
+	// The translation and the scale are interpolated with vector_lerp.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_lerp(qvvf_arg0 start, qvvf_arg1 end, scalarf_arg2 alpha) RTM_NO_EXCEPT
+	{
+		const quatf rotation = quat_lerp(start.rotation, end.rotation, alpha);
+		const vector4f translation = vector_lerp(start.translation, end.translation, alpha);
+		const vector4f scale = vector_lerp(start.scale, end.scale, alpha);
+		return qvv_set(rotation, translation, scale);
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the additive QVV transform that qvv_apply_additive applies on top of a
+	// reference transform to reproduce a pose with a weight of 1.0:
+	// the rotation is quat_mul(pose.rotation, quat_conjugate(reference.rotation)), flipped
+	// to have a positive [w] component, the translation is pose.translation - reference.translation,
+	// and the 3D scale is pose.scale / reference.scale. The reference scale cannot be zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_extract_additive(qvvf_arg0 pose, qvvf_arg1 reference) RTM_NO_EXCEPT
+	{
+		const quatf rotation = quat_mul(pose.rotation, quat_conjugate(reference.rotation));
+		const vector4f translation = vector_sub(pose.translation, reference.translation);
+		// The [w] component of the reference scale is ignored, it is usually zero
+		const vector4f scale = vector_div(pose.scale, vector_set_w(reference.scale, 1.0F));
+		return qvv_set(quat_get_w(rotation) >= 0.0F ? rotation : quat_neg(rotation), translation, scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Applies an additive QVV transform on top of a base QVV transform with a given weight.
+	// The additive rotation is applied first, in the local space of the base rotation:
+	// quat_mul(additive_rotation, base.rotation) where the additive rotation is interpolated
+	// from the identity with quat_lerp. The additive translation is added and the additive
+	// scale is multiplicative: an additive transform with a [1,1,1] 3D scale leaves the base
+	// scale unchanged. A weight of 0.0 returns the base transform.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_apply_additive(qvvf_arg0 base, qvvf_arg1 additive, float weight) RTM_NO_EXCEPT
+	{
+		const quatf additive_rotation = quat_lerp(quat_identity(), additive.rotation, weight);
+		const quatf rotation = quat_mul(additive_rotation, base.rotation);
+		const vector4f translation = vector_mul_add(additive.translation, weight, base.translation);
+		const vector4f scale = vector_mul(base.scale, vector_lerp(vector_set(1.0F), additive.scale, weight));
+		return qvv_set(rotation, translation, scale);
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Applies an additive QVV transform on top of a base QVV transform with a given weight.
+	// The additive rotation is applied first, in the local space of the base rotation:
+	// quat_mul(additive_rotation, base.rotation) where the additive rotation is interpolated
+	// from the identity with quat_lerp. The additive translation is added and the additive
+	// scale is multiplicative: an additive transform with a [1,1,1] 3D scale leaves the base
+	// scale unchanged. A weight of 0.0 returns the base transform.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_apply_additive(qvvf_arg0 base, qvvf_arg1 additive, scalarf_arg2 weight) RTM_NO_EXCEPT
+	{
+		const quatf additive_rotation = quat_lerp(quat_identity(), additive.rotation, weight);
+		const quatf rotation = quat_mul(additive_rotation, base.rotation);
+		const vector4f translation = vector_mul_add(additive.translation, weight, base.translation);
+		const vector4f scale = vector_mul(base.scale, vector_lerp(vector_set(1.0F), additive.scale, weight));
+		return qvv_set(rotation, translation, scale);
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Decomposes a 3x4 affine matrix into a QVV transform in a single pass.
+	// The axis lengths are computed once and used both as the 3D scale and to remove it
+	// before the rotation is extracted, unlike matrix_remove_scale followed by quat_from_matrix.
+	// When the matrix contains a reflection (negative determinant), the X scale is negative.
+	// A zero scale axis has an identity rotation like quat_from_matrix. Skew/shear is lost,
+	// see matrix_orthonormalize.
+	//////////////////////////////////////////////////////////////////////////
+	inline qvvf RTM_SIMD_CALL qvv_from_matrix(matrix3x4f_arg0 input) RTM_NO_EXCEPT
+	{
+		const float x_length_sq = vector_length_squared3(input.x_axis);
+		const float y_length_sq = vector_length_squared3(input.y_axis);
+		const float z_length_sq = vector_length_squared3(input.z_axis);
+		const vector4f abs_scale = vector_sqrt(vector_set(x_length_sq, y_length_sq, z_length_sq, 0.0F));
+
+		// A reflection is retained by flipping the X axis
+		const float determinant = vector_dot3(vector_cross3(input.x_axis, input.y_axis), input.z_axis);
+		const vector4f scale = determinant < 0.0F ? vector_mul(abs_scale, vector_set(-1.0F, 1.0F, 1.0F, 1.0F)) : abs_scale;
+
+		const mask4f is_non_zero = vector_greater_than(abs_scale, vector_zero());
+		const vector4f inv_scale = vector_select(is_non_zero, vector_div(vector_set(1.0F), scale), vector_zero());
+
+		const vector4f x_axis = vector_mul(input.x_axis, vector_dup_x(inv_scale));
+		const vector4f y_axis = vector_mul(input.y_axis, vector_dup_y(inv_scale));
+		const vector4f z_axis = vector_mul(input.z_axis, vector_dup_z(inv_scale));
+
+		const quatf rotation = rtm_impl::quat_from_matrix(x_axis, y_axis, z_axis);
+		return qvv_set(rotation, input.w_axis, scale);
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
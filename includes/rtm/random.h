@@ -0,0 +1,228 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector4i.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// A pseudo random number generator with 4 independent xoshiro128+ streams, one per SIMD lane.
+	// Only integer additions, shifts, and XORs are used: the bits and uniform values generated
+	// from a seed are identical on every platform and with every instruction set.
+	// It is not suitable for cryptography.
+	//////////////////////////////////////////////////////////////////////////
+	struct random_generator
+	{
+		vector4i state[4];
+	};
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// SplitMix64, used to expand a seed into the generator state.
+		//////////////////////////////////////////////////////////////////////////
+		inline uint64_t random_splitmix64(uint64_t& state) RTM_NO_EXCEPT
+		{
+			state += 0x9E3779B97F4A7C15ULL;
+			uint64_t value = state;
+			value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+			value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+			return value ^ (value >> 31);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the input times 2 PI per component: the angles of uniform values.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL random_uniform_to_angle(vector4f_arg0 uniform) RTM_NO_EXCEPT
+		{
+			return vector_mul(uniform, float(constants::two_pi()));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns 2 * sqrt(u * (1 - u)) per component: the radius of the circle at height
+		// 1 - 2u on the unit sphere, without the cancellation of sqrt(1 - z * z) near the poles.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL random_sphere_radius(vector4f_arg0 uniform) RTM_NO_EXCEPT
+		{
+			const vector4f one_minus_uniform = vector_sub(vector_set(1.0F), uniform);
+			return vector_mul(vector_sqrt(vector_mul(uniform, one_minus_uniform)), 2.0F);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a generator seeded from a 64 bit value.
+	// Each lane receives its own state, expanded with SplitMix64.
+	//////////////////////////////////////////////////////////////////////////
+	inline random_generator random_init(uint64_t seed) RTM_NO_EXCEPT
+	{
+		uint64_t splitmix_state = seed;
+
+		// state[word][lane], each 64 bit value seeds two lanes of a word
+		int32_t words[4][4];
+		for (uint32_t word_index = 0; word_index < 4; ++word_index)
+		{
+			for (uint32_t lane_index = 0; lane_index < 4; lane_index += 2)
+			{
+				const uint64_t value = rtm_impl::random_splitmix64(splitmix_state);
+				words[word_index][lane_index + 0] = static_cast<int32_t>(static_cast<uint32_t>(value));
+				words[word_index][lane_index + 1] = static_cast<int32_t>(static_cast<uint32_t>(value >> 32));
+			}
+		}
+
+		// An all zero state only ever generates zeros
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+		{
+			if ((words[0][lane_index] | words[1][lane_index] | words[2][lane_index] | words[3][lane_index]) == 0)
+				words[0][lane_index] = 1;
+		}
+
+		random_generator generator;
+		for (uint32_t word_index = 0; word_index < 4; ++word_index)
+			generator.state[word_index] = vector_load(&words[word_index][0]);
+
+		return generator;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Advances the generator and returns 32 random bits per component.
+	// The low bits are of lower quality than the high bits with xoshiro128+: use the
+	// high bits when fewer than 32 bits are needed.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL random_next_bits(random_generator& generator) RTM_NO_EXCEPT
+	{
+		vector4i s0 = generator.state[0];
+		vector4i s1 = generator.state[1];
+		vector4i s2 = generator.state[2];
+		vector4i s3 = generator.state[3];
+
+		const vector4i result = vector_add(s0, s3);
+		const vector4i t = vector_shift_left(s1, 9);
+
+		s2 = vector_xor(s2, s0);
+		s3 = vector_xor(s3, s1);
+		s1 = vector_xor(s1, s2);
+		s0 = vector_xor(s0, s3);
+		s2 = vector_xor(s2, t);
+		s3 = vector_or(vector_shift_left(s3, 11), vector_shift_right_logical(s3, 21));
+
+		generator.state[0] = s0;
+		generator.state[1] = s1;
+		generator.state[2] = s2;
+		generator.state[3] = s3;
+		return result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Advances the generator and returns 4 uniformly distributed values in [0.0, 1.0).
+	// The high 24 bits are converted: every value is a multiple of 2^-24.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL random_next_uniform(random_generator& generator) RTM_NO_EXCEPT
+	{
+		const vector4i bits = vector_shift_right_logical(random_next_bits(generator), 8);
+		return vector_mul(vector_int_to_float(bits), 1.0F / 16777216.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Advances the generator and returns 4 uniformly distributed values in [min_value, max_value).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL random_next_uniform(random_generator& generator, vector4f_arg0 min_value, vector4f_arg1 max_value) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(random_next_uniform(generator), vector_sub(max_value, min_value), min_value);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Advances the generator and returns a direction uniformly distributed on the unit sphere.
+	// The [w] component is 0.0.
+	// To generate many directions, random_unit_sphere_soa(..) is faster: it uses every lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL random_next_unit_sphere(random_generator& generator) RTM_NO_EXCEPT
+	{
+		// The height is uniform in [-1, 1] (Archimedes), the angle around it in [0, 2 PI)
+		// [x] holds the angle and [z] the height
+		const vector4f uniform = random_next_uniform(generator);
+
+		vector4f sin_angle;
+		vector4f cos_angle;
+		vector_sincos(rtm_impl::random_uniform_to_angle(uniform), sin_angle, cos_angle);
+
+		const vector4f height = vector_neg_mul_sub(uniform, 2.0F, vector_set(1.0F));
+		const vector4f radius = vector_dup_z(rtm_impl::random_sphere_radius(uniform));
+
+		const vector4f xy = vector_mul(vector_mix<mix4::x, mix4::a, mix4::x, mix4::a>(cos_angle, sin_angle), radius);
+		const vector4f z0 = vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(height, vector_zero());
+		return vector_mix<mix4::x, mix4::y, mix4::c, mix4::d>(xy, z0);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Advances the generator and returns a point uniformly distributed inside the unit disk
+	// in the XY plane. The [z] and [w] components are 0.0.
+	// To generate many points, random_unit_disk_soa(..) is faster: it uses every lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL random_next_unit_disk(random_generator& generator) RTM_NO_EXCEPT
+	{
+		// The square root of the radius makes the area density uniform
+		// [x] holds the radius and [y] the angle
+		const vector4f uniform = random_next_uniform(generator);
+
+		vector4f sin_angle;
+		vector4f cos_angle;
+		vector_sincos(rtm_impl::random_uniform_to_angle(uniform), sin_angle, cos_angle);
+
+		const vector4f radius = vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(vector_sqrt(uniform), vector_zero());
+		return vector_mul(vector_mix<mix4::y, mix4::b, mix4::y, mix4::b>(cos_angle, sin_angle), radius);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Advances the generator and returns a rotation uniformly distributed over SO(3)
+	// with Shoemake's method. The rotation is normalized.
+	// To generate many rotations, random_quat_soa(..) is faster: it uses every lane.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL random_next_quat(random_generator& generator) RTM_NO_EXCEPT
+	{
+		// With u0, u1, u2 in [x], [y], [z]:
+		// q = [sqrt(1 - u0) * sin(2 PI u1), sqrt(1 - u0) * cos(2 PI u1), sqrt(u0) * sin(2 PI u2), sqrt(u0) * cos(2 PI u2)]
+		const vector4f uniform = random_next_uniform(generator);
+
+		vector4f sin_angle;
+		vector4f cos_angle;
+		vector_sincos(rtm_impl::random_uniform_to_angle(uniform), sin_angle, cos_angle);
+
+		const vector4f one_minus_uniform = vector_sub(vector_set(1.0F), uniform);
+		const vector4f radius = vector_sqrt(vector_mix<mix4::x, mix4::x, mix4::a, mix4::a>(one_minus_uniform, uniform));
+		const vector4f sin_cos = vector_mix<mix4::y, mix4::b, mix4::z, mix4::c>(sin_angle, cos_angle);
+		return vector_to_quat(vector_mul(sin_cos, radius));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
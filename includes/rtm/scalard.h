@@ -30,8 +30,8 @@
 #include "rtm/impl/compiler_utils.h"
 #include "rtm/impl/scalar_common.h"
 
-#include <algorithm>
 #include <cmath>
+#include <limits>
 
 RTM_IMPL_FILE_PRAGMA_PUSH
 
@@ -223,7 +223,8 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(_mm_min_sd(_mm_max_sd(_mm_set1_pd(input), _mm_set1_pd(min)), _mm_set1_pd(max)));
 #else
-		return std::min(std::max(input, min), max);
+		const double clamped_min = input < min ? min : input;
+		return max < clamped_min ? max : clamped_min;
 #endif
 	}
 
@@ -380,7 +381,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline scalard RTM_SIMD_CALL scalar_mul_add(scalard s0, scalard s1, scalard s2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return scalard{ _mm_fmadd_sd(s0.value, s1.value, s2.value) };
+#else
 		return scalard{ _mm_add_sd(_mm_mul_sd(s0.value, s1.value), s2.value) };
+#endif
 	}
 #endif
 
@@ -399,7 +404,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline scalard RTM_SIMD_CALL scalar_neg_mul_sub(scalard s0, scalard s1, scalard s2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return scalard{ _mm_fnmadd_sd(s0.value, s1.value, s2.value) };
+#else
 		return scalard{ _mm_sub_sd(s2.value, _mm_mul_sd(s0.value, s1.value)) };
+#endif
 	}
 #endif
 
@@ -473,7 +482,7 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(_mm_min_sd(_mm_set1_pd(left), _mm_set1_pd(right)));
 #else
-		return std::min(left, right);
+		return right < left ? right : left;
 #endif
 	}
 
@@ -495,7 +504,7 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtsd_f64(_mm_max_sd(_mm_set1_pd(left), _mm_set1_pd(right)));
 #else
-		return std::max(left, right);
+		return left < right ? right : left;
 #endif
 	}
 
@@ -931,6 +940,50 @@ namespace rtm
 		return input_f;
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Exponential and logarithmic functions
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns e raised to the power of the input: e^input
+	//////////////////////////////////////////////////////////////////////////
+	inline double scalar_exp(double input) RTM_NO_EXCEPT
+	{
+		return std::exp(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns 2 raised to the power of the input: 2^input
+	//////////////////////////////////////////////////////////////////////////
+	inline double scalar_exp2(double input) RTM_NO_EXCEPT
+	{
+		return std::exp2(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the natural logarithm of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline double scalar_log(double input) RTM_NO_EXCEPT
+	{
+		return std::log(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the base 2 logarithm of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline double scalar_log2(double input) RTM_NO_EXCEPT
+	{
+		return std::log2(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the base raised to the power of the exponent: base^exponent
+	//////////////////////////////////////////////////////////////////////////
+	inline double scalar_pow(double base, double exponent) RTM_NO_EXCEPT
+	{
+		return std::pow(base, exponent);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Trigonometric functions
 	//////////////////////////////////////////////////////////////////////////
@@ -981,7 +1034,11 @@ namespace rtm
 		scalard cos_ = scalar_cos(angle);
 
 		__m128d xy = _mm_unpacklo_pd(sin_.value, cos_.value);
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(xy), xy, 1);
+#else
 		return vector4d{ xy, xy };
+#endif
 	}
 #endif
 
@@ -999,7 +1056,11 @@ namespace rtm
 
 #if defined(RTM_SSE2_INTRINSICS)
 		__m128d xy = _mm_unpacklo_pd(sin_.value, cos_.value);
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(_mm256_castpd128_pd256(xy), xy, 1);
+#else
 		return vector4d{ xy, xy };
+#endif
 #else
 		return vector4d{ sin_, cos_, sin_, cos_ };
 #endif
@@ -30,8 +30,10 @@
 #include "rtm/impl/compiler_utils.h"
 #include "rtm/impl/scalar_common.h"
 
-#include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 
 RTM_IMPL_FILE_PRAGMA_PUSH
 
@@ -79,6 +81,93 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the single precision value of an IEEE 754 half precision value stored as its raw bits.
+	// Subnormals, infinities, and NaN are preserved.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_half_to_float(uint16_t input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_F16C_INTRINSICS)
+		return _cvtsh_ss(input);
+#else
+		// Shift the exponent and mantissa in place and let the multiplication re-bias the exponent,
+		// this also normalizes subnormal values
+		const uint32_t exponent_mantissa = uint32_t(input) & 0x7FFF;
+		const uint32_t shifted = exponent_mantissa << 13;
+		const uint32_t magic_bits = (254 - 15) << 23;	// 2^112
+
+		float shifted_f;
+		float magic;
+		std::memcpy(&shifted_f, &shifted, sizeof(float));
+		std::memcpy(&magic, &magic_bits, sizeof(float));
+
+		const float scaled = shifted_f * magic;
+
+		uint32_t result;
+		std::memcpy(&result, &scaled, sizeof(float));
+
+		// Infinity and NaN keep their maximum exponent
+		if (exponent_mantissa >= 0x7C00)
+			result |= 255 << 23;
+
+		result |= (uint32_t(input) & 0x8000) << 16;
+
+		float result_f;
+		std::memcpy(&result_f, &result, sizeof(float));
+		return result_f;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the raw bits of the IEEE 754 half precision value closest to the input.
+	// Rounding is to nearest even, values too large saturate to infinity and NaN remains NaN.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint16_t scalar_float_to_half(float input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_F16C_INTRINSICS)
+		return uint16_t(_cvtss_sh(input, _MM_FROUND_TO_NEAREST_INT));
+#else
+		uint32_t input_bits;
+		std::memcpy(&input_bits, &input, sizeof(float));
+
+		const uint32_t sign = input_bits & 0x80000000U;
+		uint32_t abs_bits = input_bits ^ sign;
+
+		uint32_t result;
+		if (abs_bits >= ((127 + 16) << 23))
+		{
+			// Too large for a half, NaN becomes a quiet NaN and everything else infinity
+			result = abs_bits > 0x7F800000U ? 0x7E00 : 0x7C00;
+		}
+		else if (abs_bits < ((127 - 14) << 23))
+		{
+			// The result is subnormal or zero, let the addition perform the rounding
+			const uint32_t subnormal_magic_bits = ((127 - 15) + (23 - 10) + 1) << 23;
+
+			float abs_f;
+			float subnormal_magic;
+			std::memcpy(&abs_f, &abs_bits, sizeof(float));
+			std::memcpy(&subnormal_magic, &subnormal_magic_bits, sizeof(float));
+
+			const float rounded = abs_f + subnormal_magic;
+
+			uint32_t rounded_bits;
+			std::memcpy(&rounded_bits, &rounded, sizeof(float));
+			result = rounded_bits - subnormal_magic_bits;
+		}
+		else
+		{
+			// Re-bias the exponent and round the mantissa to nearest even
+			const uint32_t is_mantissa_odd = (abs_bits >> 13) & 1;
+			abs_bits += ((15U - 127U) << 23) + 0xFFF;
+			abs_bits += is_mantissa_odd;
+			result = abs_bits >> 13;
+		}
+
+		return uint16_t(result | (sign >> 16));
+#endif
+	}
+
 #if defined(RTM_SSE2_INTRINSICS)
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the largest integer value not greater than the input (round towards minus infinity).
@@ -121,6 +210,9 @@ namespace rtm
 		// Add our bias to properly handle negative values
 		integer_part = _mm_add_ss(integer_part, bias);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = _mm_or_ps(integer_part, _mm_and_ps(input.value, _mm_set_ps1(-0.0F)));
+
 		__m128 result = _mm_or_ps(_mm_and_ps(use_original_input, input.value), _mm_andnot_ps(use_original_input, integer_part));
 		return scalarf{ result };
 #endif
@@ -183,6 +275,9 @@ namespace rtm
 		// Subtract our bias to properly handle positive values
 		integer_part = _mm_sub_ss(integer_part, bias);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = _mm_or_ps(integer_part, _mm_and_ps(input.value, _mm_set_ps1(-0.0F)));
+
 		__m128 result = _mm_or_ps(_mm_and_ps(use_original_input, input.value), _mm_andnot_ps(use_original_input, integer_part));
 		return scalarf{ result };
 #endif
@@ -223,7 +318,8 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtss_f32(_mm_min_ss(_mm_max_ss(_mm_set_ps1(input), _mm_set_ps1(min)), _mm_set_ps1(max)));
 #else
-		return std::min(std::max(input, min), max);
+		const float clamped_min = input < min ? min : input;
+		return max < clamped_min ? max : clamped_min;
 #endif
 	}
 
@@ -241,8 +337,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the absolute value of the input.
 	//////////////////////////////////////////////////////////////////////////
-	inline float scalar_abs(float input) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL float scalar_abs(float input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return input < 0.0F ? -input : input;
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		const __m128i abs_mask = _mm_set_epi32(0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL);
 		return _mm_cvtss_f32(_mm_and_ps(_mm_set_ps1(input), _mm_castsi128_ps(abs_mask)));
@@ -286,6 +386,10 @@ namespace rtm
 	#endif
 	inline scalarf RTM_SIMD_CALL scalar_sqrt_reciprocal(scalarf_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_DETERMINISTIC)
+		// The hardware estimate differs between CPU vendors, use a square root and a division instead
+		return scalarf{ _mm_div_ss(_mm_set_ss(1.0F), _mm_sqrt_ss(input.value)) };
+#else
 		// Perform two passes of Newton-Raphson iteration on the hardware estimate
 		const __m128 half = _mm_set_ss(0.5F);
 		const __m128 input_half = _mm_mul_ss(input.value, half);
@@ -302,6 +406,7 @@ namespace rtm
 		x2 = _mm_add_ss(_mm_mul_ss(x1, x2), x1);
 
 		return scalarf{ x2 };
+#endif
 	}
 	#if defined(RTM_COMPILER_MSVC) && _MSC_VER >= 1920 && _MSC_VER < 1925 && defined(_M_X64) && !defined(RTM_AVX_INTRINSICS)
 		// HACK!!! See comment above
@@ -421,7 +526,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline scalarf RTM_SIMD_CALL scalar_mul_add(scalarf_arg0 s0, scalarf_arg1 s1, scalarf_arg2 s2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return scalarf{ _mm_fmadd_ss(s0.value, s1.value, s2.value) };
+#else
 		return scalarf{ _mm_add_ss(_mm_mul_ss(s0.value, s1.value), s2.value) };
+#endif
 	}
 #endif
 
@@ -440,7 +549,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline scalarf RTM_SIMD_CALL scalar_neg_mul_sub(scalarf_arg0 s0, scalarf_arg1 s1, scalarf_arg2 s2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return scalarf{ _mm_fnmadd_ss(s0.value, s1.value, s2.value) };
+#else
 		return scalarf{ _mm_sub_ss(s2.value, _mm_mul_ss(s0.value, s1.value)) };
+#endif
 	}
 #endif
 
@@ -453,6 +566,81 @@ namespace rtm
 		return s2 - (s0 * s1);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the degree 3 polynomial: c0 + c1 * x + ... + c3 * x^3
+	// Estrin's scheme is used: pairs of terms are evaluated independently and combined
+	// with powers of x^2 which shortens the dependency chain of Horner's method.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_polynomial(float x, float c0, float c1, float c2, float c3) RTM_NO_EXCEPT
+	{
+		const float x2 = x * x;
+		const float p01 = (x * c1) + c0;
+		const float p23 = (x * c3) + c2;
+		return (p23 * x2) + p01;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the degree 4 polynomial: c0 + c1 * x + ... + c4 * x^4
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_polynomial(float x, float c0, float c1, float c2, float c3, float c4) RTM_NO_EXCEPT
+	{
+		const float x2 = x * x;
+		const float x4 = x2 * x2;
+		const float p01 = (x * c1) + c0;
+		const float p23 = (x * c3) + c2;
+		const float p0123 = (p23 * x2) + p01;
+		return (x4 * c4) + p0123;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the degree 5 polynomial: c0 + c1 * x + ... + c5 * x^5
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_polynomial(float x, float c0, float c1, float c2, float c3, float c4, float c5) RTM_NO_EXCEPT
+	{
+		const float x2 = x * x;
+		const float x4 = x2 * x2;
+		const float p01 = (x * c1) + c0;
+		const float p23 = (x * c3) + c2;
+		const float p0123 = (p23 * x2) + p01;
+		const float p45 = (x * c5) + c4;
+		return (p45 * x4) + p0123;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the degree 6 polynomial: c0 + c1 * x + ... + c6 * x^6
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_polynomial(float x, float c0, float c1, float c2, float c3, float c4, float c5, float c6) RTM_NO_EXCEPT
+	{
+		const float x2 = x * x;
+		const float x4 = x2 * x2;
+		const float p01 = (x * c1) + c0;
+		const float p23 = (x * c3) + c2;
+		const float p0123 = (p23 * x2) + p01;
+		const float p45 = (x * c5) + c4;
+		const float p456 = (x2 * c6) + p45;
+		return (p456 * x4) + p0123;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the degree 7 polynomial: c0 + c1 * x + ... + c7 * x^7
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_polynomial(float x, float c0, float c1, float c2, float c3, float c4, float c5, float c6, float c7) RTM_NO_EXCEPT
+	{
+		const float x2 = x * x;
+		const float x4 = x2 * x2;
+		const float p01 = (x * c1) + c0;
+		const float p23 = (x * c3) + c2;
+		const float p0123 = (p23 * x2) + p01;
+		const float p45 = (x * c5) + c4;
+		const float p67 = (x * c7) + c6;
+		const float p4567 = (p67 * x2) + p45;
+		return (p4567 * x4) + p0123;
+	}
+
 #if defined(RTM_SSE2_INTRINSICS)
 	//////////////////////////////////////////////////////////////////////////
 	// Returns the linear interpolation of the two inputs at the specified alpha.
@@ -514,7 +702,7 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtss_f32(_mm_min_ss(_mm_set_ps1(left), _mm_set_ps1(right)));
 #else
-		return std::min(left, right);
+		return right < left ? right : left;
 #endif
 	}
 
@@ -536,7 +724,7 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_cvtss_f32(_mm_max_ss(_mm_set_ps1(left), _mm_set_ps1(right)));
 #else
-		return std::max(left, right);
+		return left < right ? right : left;
 #endif
 	}
 
@@ -842,6 +1030,9 @@ namespace rtm
 		// Convert to an integer with truncation and back, this rounds towards zero.
 		__m128 integer_part = _mm_cvtepi32_ps(_mm_cvttps_epi32(biased_input));
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = _mm_or_ps(integer_part, sign);
+
 		__m128 result = _mm_or_ps(_mm_and_ps(use_original_input, input.value), _mm_andnot_ps(use_original_input, integer_part));
 
 		return scalarf{ result };
@@ -937,6 +1128,9 @@ namespace rtm
 		__m128 truncating_offset = _mm_or_ps(sign, fractional_limit);
 		__m128 integer_part = _mm_sub_ss(_mm_add_ss(input.value, truncating_offset), truncating_offset);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = _mm_or_ps(integer_part, sign);
+
 		// If our input was so large that it had no fractional part, return it unchanged
 		// Otherwise return our integer part
 		const __m128i abs_mask = _mm_set_epi32(0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL);
@@ -971,13 +1165,14 @@ namespace rtm
 		int32_t whole = static_cast<int32_t>(input);
 		float whole_f = static_cast<float>(whole);
 		float remainder = scalar_abs(input - whole_f);
+		// Keep the sign of the input to return -0.0 like the C math library does
 		if (remainder < 0.5F)
-			return whole_f;
+			return std::copysign(whole_f, input);
 		if (remainder > 0.5F)
 			return input >= 0.0F ? (whole_f + 1.0F) : (whole_f - 1.0F);
 
 		if ((whole % 2) == 0)
-			return whole_f;
+			return std::copysign(whole_f, input);
 		else
 			return input >= 0.0F ? (whole_f + 1.0F) : (whole_f - 1.0F);
 #endif
@@ -1002,6 +1197,50 @@ namespace rtm
 		return input_f;
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Exponential and logarithmic functions
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns e raised to the power of the input: e^input
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_exp(float input) RTM_NO_EXCEPT
+	{
+		return std::exp(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns 2 raised to the power of the input: 2^input
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_exp2(float input) RTM_NO_EXCEPT
+	{
+		return std::exp2(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the natural logarithm of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_log(float input) RTM_NO_EXCEPT
+	{
+		return std::log(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the base 2 logarithm of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_log2(float input) RTM_NO_EXCEPT
+	{
+		return std::log2(input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the base raised to the power of the exponent: base^exponent
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_pow(float base, float exponent) RTM_NO_EXCEPT
+	{
+		return std::pow(base, exponent);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Trigonometric functions
 	//////////////////////////////////////////////////////////////////////////
@@ -1040,11 +1279,7 @@ namespace rtm
 
 		// Calculate our value
 		const float x2 = _mm_cvtss_f32(_mm_mul_ss(x, x));
-		float result = (x2 * -2.3828544692960918e-8F) + 2.7521557770526783e-6F;
-		result = (result * x2) - 1.9840782426250314e-4F;
-		result = (result * x2) + 8.3333303183525942e-3F;
-		result = (result * x2) - 1.6666666601721269e-1F;
-		result = (result * x2) + 1.0F;
+		float result = scalar_polynomial(x2, 1.0F, -1.6666666601721269e-1F, 8.3333303183525942e-3F, -1.9840782426250314e-4F, 2.7521557770526783e-6F, -2.3828544692960918e-8F);
 		result = result * _mm_cvtss_f32(x);
 		return scalar_set(result);
 	}
@@ -1057,7 +1292,7 @@ namespace rtm
 	{
 #if defined(RTM_SSE2_INTRINSICS)
 		return scalar_cast(scalar_sin(scalar_set(angle)));
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return std::sin(angle);
 #else
 		// Use a degree 11 minimax approximation polynomial
@@ -1077,11 +1312,7 @@ namespace rtm
 
 		// Calculate our value
 		const float x2 = x * x;
-		float result = (x2 * -2.3828544692960918e-8F) + 2.7521557770526783e-6F;
-		result = (result * x2) - 1.9840782426250314e-4F;
-		result = (result * x2) + 8.3333303183525942e-3F;
-		result = (result * x2) - 1.6666666601721269e-1F;
-		result = (result * x2) + 1.0F;
+		float result = scalar_polynomial(x2, 1.0F, -1.6666666601721269e-1F, 8.3333303183525942e-3F, -1.9840782426250314e-4F, 2.7521557770526783e-6F, -2.3828544692960918e-8F);
 		result = result * x;
 		return result;
 #endif
@@ -1120,11 +1351,7 @@ namespace rtm
 
 		// Calculate our value
 		const float x2 = _mm_cvtss_f32(_mm_mul_ss(x, x));
-		float result = (x2 * -2.6051615464872668e-7F) + 2.4760495088926859e-5F;
-		result = (result * x2) - 1.3888377661039897e-3F;
-		result = (result * x2) + 4.1666638865338612e-2F;
-		result = (result * x2) - 4.9999999508695869e-1F;
-		result = (result * x2) + 1.0F;
+		float result = scalar_polynomial(x2, 1.0F, -4.9999999508695869e-1F, 4.1666638865338612e-2F, -1.3888377661039897e-3F, 2.4760495088926859e-5F, -2.6051615464872668e-7F);
 
 		// Remap into [-pi, pi]
 		__m128 result_v = _mm_set_ps1(result);
@@ -1140,7 +1367,7 @@ namespace rtm
 	{
 #if defined(RTM_SSE2_INTRINSICS)
 		return scalar_cast(scalar_cos(scalar_set(angle)));
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return std::cos(angle);
 #else
 		// Use a degree 10 minimax approximation polynomial
@@ -1160,11 +1387,7 @@ namespace rtm
 
 		// Calculate our value
 		const float x2 = x * x;
-		float result = (x2 * -2.6051615464872668e-7F) + 2.4760495088926859e-5F;
-		result = (result * x2) - 1.3888377661039897e-3F;
-		result = (result * x2) + 4.1666638865338612e-2F;
-		result = (result * x2) - 4.9999999508695869e-1F;
-		result = (result * x2) + 1.0F;
+		float result = scalar_polynomial(x2, 1.0F, -4.9999999508695869e-1F, 4.1666638865338612e-2F, -1.3888377661039897e-3F, 2.4760495088926859e-5F, -2.6051615464872668e-7F);
 
 		// Remap into [-pi, pi]
 		if (x_abs <= rtm::constants::half_pi())
@@ -1237,25 +1460,18 @@ namespace rtm
 
 		// Calculate our value
 		const float x = _mm_cvtss_f32(abs_value);
-		float result = (x * -1.2690614339589956e-3F) + 6.7072304676685235e-3F;
-		result = (result * x) - 1.7162031184398074e-2F;
-		result = (result * x) + 3.0961594977611639e-2F;
-		result = (result * x) - 5.0207843052845647e-2F;
-		result = (result * x) + 8.8986946573346160e-2F;
-		result = (result * x) - 2.1459960076929829e-1F;
-		result = (result * x) + 1.5707963267948966F;
+		float result = scalar_polynomial(x, 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F);
 
 		// Scale our result
 		const __m128 scale = _mm_sqrt_ss(_mm_sub_ss(_mm_set_ps1(1.0F), abs_value));
 		result = result * _mm_cvtss_f32(scale);
 
-		// Handle negative values through reflection
-		if (_mm_cvtss_f32(value.value) < 0.0F)
-			result = rtm::constants::pi() - result;
-
-		// Shift our final result
+		// Normally the math is as follow:
+		// If input is positive: PI/2 - result
+		// If input is negative: PI/2 - (PI - result) = -PI/2 + result
+		// The second form has a single rounding and matches vector_asin
 		const float offset = rtm::constants::half_pi();
-		result = offset - result;
+		result = _mm_cvtss_f32(value.value) < 0.0F ? (result - offset) : (offset - result);
 		return scalarf{ _mm_set_ps1(result) };
 	}
 #endif
@@ -1268,7 +1484,7 @@ namespace rtm
 	{
 #if defined(RTM_SSE2_INTRINSICS)
 		return scalar_cast(scalar_asin(scalar_set(value)));
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return std::asin(value);
 #else
 		// Use a degree 7 minimax approximation polynomial
@@ -1278,26 +1494,18 @@ namespace rtm
 		const float abs_value = scalar_abs(value);
 
 		// Calculate our value
-		float result = (abs_value * -1.2690614339589956e-3F) + 6.7072304676685235e-3F;
-		result = (result * abs_value) - 1.7162031184398074e-2F;
-		result = (result * abs_value) + 3.0961594977611639e-2F;
-		result = (result * abs_value) - 5.0207843052845647e-2F;
-		result = (result * abs_value) + 8.8986946573346160e-2F;
-		result = (result * abs_value) - 2.1459960076929829e-1F;
-		result = (result * abs_value) + 1.5707963267948966F;
+		float result = scalar_polynomial(abs_value, 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F);
 
 		// Scale our result
 		const float scale = scalar_sqrt(1.0F - abs_value);
 		result = result * scale;
 
-		// Handle negative values through reflection
-		if (value < 0.0F)
-			result = rtm::constants::pi() - result;
-
-		// Shift our final result
+		// Normally the math is as follow:
+		// If input is positive: PI/2 - result
+		// If input is negative: PI/2 - (PI - result) = -PI/2 + result
+		// The second form has a single rounding and matches vector_asin
 		const float offset = rtm::constants::half_pi();
-		result = offset - result;
-		return result;
+		return value < 0.0F ? (result - offset) : (offset - result);
 #endif
 	}
 
@@ -1321,13 +1529,7 @@ namespace rtm
 
 		// Calculate our value
 		const float x = _mm_cvtss_f32(abs_value);
-		float result = (x * -1.2690614339589956e-3F) + 6.7072304676685235e-3F;
-		result = (result * x) - 1.7162031184398074e-2F;
-		result = (result * x) + 3.0961594977611639e-2F;
-		result = (result * x) - 5.0207843052845647e-2F;
-		result = (result * x) + 8.8986946573346160e-2F;
-		result = (result * x) - 2.1459960076929829e-1F;
-		result = (result * x) + 1.5707963267948966F;
+		float result = scalar_polynomial(x, 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F);
 
 		// Scale our result
 		const __m128 scale = _mm_sqrt_ss(_mm_sub_ss(_mm_set_ps1(1.0F), abs_value));
@@ -1349,7 +1551,7 @@ namespace rtm
 	{
 #if defined(RTM_SSE2_INTRINSICS)
 		return scalar_cast(scalar_acos(scalar_set(value)));
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return std::acos(value);
 #else
 		// Use the identity: acos(value) + asin(value) = PI/2
@@ -1363,13 +1565,7 @@ namespace rtm
 		const float abs_value = scalar_abs(value);
 
 		// Calculate our value
-		float result = (abs_value * -1.2690614339589956e-3F) + 6.7072304676685235e-3F;
-		result = (result * abs_value) - 1.7162031184398074e-2F;
-		result = (result * abs_value) + 3.0961594977611639e-2F;
-		result = (result * abs_value) - 5.0207843052845647e-2F;
-		result = (result * abs_value) + 8.8986946573346160e-2F;
-		result = (result * abs_value) - 2.1459960076929829e-1F;
-		result = (result * abs_value) + 1.5707963267948966F;
+		float result = scalar_polynomial(abs_value, 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F);
 
 		// Scale our result
 		const float scale = scalar_sqrt(1.0F - abs_value);
@@ -1404,7 +1600,7 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline float scalar_tan(float angle) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON_INTRINSICS)
+#if defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return std::tan(angle);
 #else
 		// Use the identity: tan(angle) = sin(angle) / cos(angle)
@@ -1446,12 +1642,7 @@ namespace rtm
 		float x_s = _mm_cvtss_f32(x);
 		float x2 = x_s * x_s;
 
-		float result = (x2 * 7.2128853633444123e-3F) - 3.5059680836411644e-2F;
-		result = (result * x2) + 8.1675882859940430e-2F;
-		result = (result * x2) - 1.3374657325451267e-1F;
-		result = (result * x2) + 1.9856563505717162e-1F;
-		result = (result * x2) - 3.3324998579202170e-1F;
-		result = (result * x2) + 1.0F;
+		float result = scalar_polynomial(x2, 1.0F, -3.3324998579202170e-1F, 1.9856563505717162e-1F, -1.3374657325451267e-1F, 8.1675882859940430e-2F, -3.5059680836411644e-2F, 7.2128853633444123e-3F);
 		result = result * x_s;
 
 		__m128 result_s = _mm_set_ps1(result);
@@ -1480,7 +1671,7 @@ namespace rtm
 	{
 #if defined(RTM_SSE2_INTRINSICS)
 		return scalar_cast(scalar_atan(scalar_set(value)));
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return std::atan(value);
 #else
 		// Use a degree 13 minimax approximation polynomial
@@ -1493,12 +1684,7 @@ namespace rtm
 		float x = abs_value > 1.0F ? scalar_reciprocal(abs_value) : abs_value;
 		float x2 = x * x;
 
-		float result = (x2 * 7.2128853633444123e-3F) - 3.5059680836411644e-2F;
-		result = (result * x2) + 8.1675882859940430e-2F;
-		result = (result * x2) - 1.3374657325451267e-1F;
-		result = (result * x2) + 1.9856563505717162e-1F;
-		result = (result * x2) - 3.3324998579202170e-1F;
-		result = (result * x2) + 1.0F;
+		float result = scalar_polynomial(x2, 1.0F, -3.3324998579202170e-1F, 1.9856563505717162e-1F, -1.3374657325451267e-1F, 8.1675882859940430e-2F, -3.5059680836411644e-2F, 7.2128853633444123e-3F);
 		result = result * x;
 
 		if (abs_value > 1.0f)
@@ -1572,7 +1758,7 @@ namespace rtm
 	{
 #if defined(RTM_SSE2_INTRINSICS)
 		return scalar_cast(scalar_atan2(scalar_set(y), scalar_set(x)));
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return std::atan2(y, x);
 #else
 		// If X == 0.0 and Y != 0.0, we return PI/2 with the sign of Y
@@ -1598,6 +1784,255 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the sine of the input angle.
+	// Uses a degree 7 minimax approximation polynomial.
+	// Max absolute error: 1.4e-6 within [-pi, pi] and 5.5e-6 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_sin_fast(float angle) RTM_NO_EXCEPT
+	{
+		// Remap our input in the [-pi, pi] range
+		const float quotient = scalar_round_bankers(angle * rtm::constants::one_div_two_pi()) * rtm::constants::two_pi();
+		float x = angle - quotient;
+
+		// Remap our input in the [-pi/2, pi/2] range
+		if (x > rtm::constants::half_pi())
+			x = rtm::constants::pi() - x;
+		else if (x < -rtm::constants::half_pi())
+			x = -rtm::constants::pi() - x;
+
+		// Calculate our value
+		const float x2 = x * x;
+		float result = scalar_polynomial(x2, 1.0F, -1.6665681092213705e-1F, 8.3123664364479644e-3F, -1.8492186805893105e-4F);
+		return result * x;
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the sine of the input angle.
+	// Uses a degree 7 minimax approximation polynomial.
+	// Max absolute error: 1.4e-6 within [-pi, pi] and 5.5e-6 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_sin_fast(scalarf_arg0 angle) RTM_NO_EXCEPT
+	{
+		return scalar_set(scalar_sin_fast(scalar_cast(angle)));
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the cosine of the input angle.
+	// Uses a degree 6 minimax approximation polynomial.
+	// Max absolute error: 8.4e-6 within [-pi, pi] and 1.4e-5 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_cos_fast(float angle) RTM_NO_EXCEPT
+	{
+		// Remap our input in the [-pi, pi] range
+		const float quotient = scalar_round_bankers(angle * rtm::constants::one_div_two_pi()) * rtm::constants::two_pi();
+		float x = angle - quotient;
+
+		// Remap our input in the [-pi/2, pi/2] range, cos(pi - x) = -cos(x)
+		float sign = 1.0F;
+		if (x > rtm::constants::half_pi())
+		{
+			x = rtm::constants::pi() - x;
+			sign = -1.0F;
+		}
+		else if (x < -rtm::constants::half_pi())
+		{
+			x = -rtm::constants::pi() - x;
+			sign = -1.0F;
+		}
+
+		// Calculate our value
+		const float x2 = x * x;
+		float result = scalar_polynomial(x2, 1.0F, -4.9993562862475299e-1F, 4.1507063576977227e-2F, -1.2757509400283312e-3F);
+		return result * sign;
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the cosine of the input angle.
+	// Uses a degree 6 minimax approximation polynomial.
+	// Max absolute error: 8.4e-6 within [-pi, pi] and 1.4e-5 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_cos_fast(scalarf_arg0 angle) RTM_NO_EXCEPT
+	{
+		return scalar_set(scalar_cos_fast(scalar_cast(angle)));
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the tangent of the input angle.
+	// Uses the ratio of scalar_sin_fast and scalar_cos_fast.
+	// Max error: 7.5e-5 (absolute below 1.0, relative above) when abs(tan(angle)) <= 10.0
+	// The error grows as cos(angle) approaches zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_tan_fast(float angle) RTM_NO_EXCEPT
+	{
+		// Use the identity: tan(angle) = sin(angle) / cos(angle)
+		const float sin_ = scalar_sin_fast(angle);
+		const float cos_ = scalar_cos_fast(angle);
+		if (cos_ == 0.0F)
+			return std::copysign(std::numeric_limits<float>::infinity(), angle);
+
+		return sin_ / cos_;
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the tangent of the input angle.
+	// Uses the ratio of scalar_sin_fast and scalar_cos_fast.
+	// Max error: 7.5e-5 (absolute below 1.0, relative above) when abs(tan(angle)) <= 10.0
+	// The error grows as cos(angle) approaches zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_tan_fast(scalarf_arg0 angle) RTM_NO_EXCEPT
+	{
+		return scalar_set(scalar_tan_fast(scalar_cast(angle)));
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-sine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	// Uses a degree 3 minimax approximation polynomial.
+	// Max absolute error: 4.6e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_asin_fast(float value) RTM_NO_EXCEPT
+	{
+		// asin(x) = pi/2 - sqrt(1.0 - x) * polynomial(x) for x in [0.0, 1.0]
+		const float abs_value = scalar_abs(value);
+
+		float result = scalar_polynomial(abs_value, 1.5707963267948966F, -2.1330134257572395e-1F, 7.7981463463848086e-2F, -2.1641476616848260e-2F);
+		result = rtm::constants::half_pi() - (result * scalar_sqrt(1.0F - abs_value));
+
+		// Keep the original sign
+		return value >= 0.0F ? result : -result;
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-sine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	// Uses a degree 3 minimax approximation polynomial.
+	// Max absolute error: 4.6e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_asin_fast(scalarf_arg0 value) RTM_NO_EXCEPT
+	{
+		return scalar_set(scalar_asin_fast(scalar_cast(value)));
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-cosine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	// Uses a degree 3 minimax approximation polynomial.
+	// Max absolute error: 4.6e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_acos_fast(float value) RTM_NO_EXCEPT
+	{
+		// acos(x) = sqrt(1.0 - x) * polynomial(x) for x in [0.0, 1.0]
+		// acos(-x) = pi - acos(x)
+		const float abs_value = scalar_abs(value);
+
+		float result = scalar_polynomial(abs_value, 1.5707963267948966F, -2.1330134257572395e-1F, 7.7981463463848086e-2F, -2.1641476616848260e-2F);
+		result *= scalar_sqrt(1.0F - abs_value);
+
+		return value >= 0.0F ? result : (rtm::constants::pi() - result);
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-cosine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	// Uses a degree 3 minimax approximation polynomial.
+	// Max absolute error: 4.6e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_acos_fast(scalarf_arg0 value) RTM_NO_EXCEPT
+	{
+		return scalar_set(scalar_acos_fast(scalar_cast(value)));
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-tangent of the input.
+	// Note that due to the sign ambiguity, atan cannot determine which quadrant
+	// the value resides in. See scalar_atan2_fast.
+	// Uses a degree 9 minimax approximation polynomial.
+	// Max absolute error: 1.8e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_atan_fast(float value) RTM_NO_EXCEPT
+	{
+		// Discard our sign, we'll restore it later
+		const float abs_value = scalar_abs(value);
+
+		// atan(x) = pi/2 - atan(1/x) for x > 1.0
+		const float x = abs_value > 1.0F ? scalar_reciprocal(abs_value) : abs_value;
+		const float x2 = x * x;
+
+		float result = scalar_polynomial(x2, 1.0F, -3.3168525440753333e-1F, 1.8449079620329184e-1F, -9.0450293895443359e-2F, 2.3060121252307116e-2F);
+		result = result * x;
+
+		if (abs_value > 1.0F)
+			result = rtm::constants::half_pi() - result;
+
+		// Keep the original sign
+		return value >= 0.0F ? result : -result;
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-tangent of the input.
+	// Note that due to the sign ambiguity, atan cannot determine which quadrant
+	// the value resides in. See scalar_atan2_fast.
+	// Uses a degree 9 minimax approximation polynomial.
+	// Max absolute error: 1.8e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_atan_fast(scalarf_arg0 value) RTM_NO_EXCEPT
+	{
+		return scalar_set(scalar_atan_fast(scalar_cast(value)));
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant.
+	// Y represents the proportion of the y-coordinate.
+	// X represents the proportion of the x-coordinate.
+	// Uses scalar_atan_fast, max absolute error: 1.8e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_atan2_fast(float y, float x) RTM_NO_EXCEPT
+	{
+		// See scalar_atan2 for details
+		if (x == 0.0F)
+		{
+			if (y == 0.0F)
+				return 0.0F;
+
+			return std::copysign(rtm::constants::half_pi(), y);
+		}
+
+		const float value = scalar_atan_fast(y / x);
+		if (x > 0.0F)
+			return value;
+
+		const float offset = std::copysign(rtm::constants::pi(), y);
+		return value + offset;
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant.
+	// Y represents the proportion of the y-coordinate.
+	// X represents the proportion of the x-coordinate.
+	// Uses scalar_atan_fast, max absolute error: 1.8e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline scalarf RTM_SIMD_CALL scalar_atan2_fast(scalarf_arg0 y, scalarf_arg1 x) RTM_NO_EXCEPT
+	{
+		return scalar_set(scalar_atan2_fast(scalar_cast(y), scalar_cast(x)));
+	}
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// Converts degrees into radians.
 	//////////////////////////////////////////////////////////////////////////
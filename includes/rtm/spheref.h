@@ -0,0 +1,176 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/aabbf.h"
+#include "rtm/matrix3x4f.h"
+#include "rtm/qvsf.h"
+#include "rtm/qvvf.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a bounding sphere from its center and its radius.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_set(vector4f_arg0 center, float radius) RTM_NO_EXCEPT
+	{
+		return spheref{ vector_set_w(center, radius) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the center of a bounding sphere with the [w] component set to zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL sphere_get_center(spheref_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_set_w(input.center_radius, 0.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the radius of a bounding sphere.
+	//////////////////////////////////////////////////////////////////////////
+	inline float RTM_SIMD_CALL sphere_get_radius(spheref_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_get_w(input.center_radius);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest bounding sphere that contains both inputs.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_merge(spheref_arg0 lhs, spheref_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const float lhs_radius = sphere_get_radius(lhs);
+		const float rhs_radius = sphere_get_radius(rhs);
+		const vector4f offset = vector_sub(rhs.center_radius, lhs.center_radius);
+		const float distance = vector_length3(offset);
+
+		// One sphere already contains the other
+		if (distance + rhs_radius <= lhs_radius)
+			return lhs;
+		if (distance + lhs_radius <= rhs_radius)
+			return rhs;
+
+		// The new center lies on the segment between both centers, the distance is never zero here
+		const float radius = (distance + lhs_radius + rhs_radius) * 0.5F;
+		const vector4f center = vector_mul_add(offset, (radius - lhs_radius) / distance, lhs.center_radius);
+		return sphere_set(center, radius);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the smallest bounding sphere that contains the input sphere and the point.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_merge_point(spheref_arg0 input, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		return sphere_merge(input, sphere_set(point, 0.0F));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Grows a bounding sphere by the provided amount.
+	// A negative amount shrinks the sphere, the radius must remain positive or zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_expand(spheref_arg0 input, float amount) RTM_NO_EXCEPT
+	{
+		return sphere_set(input.center_radius, sphere_get_radius(input) + amount);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if the 3D point is inside or on the surface of the sphere, false otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL sphere_contains_point(spheref_arg0 input, vector4f_arg1 point) RTM_NO_EXCEPT
+	{
+		const float radius = sphere_get_radius(input);
+		return float(vector_length_squared3(vector_sub(point, input.center_radius))) <= radius * radius;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if both spheres overlap or touch, false otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL sphere_intersects(spheref_arg0 lhs, spheref_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const float radius_sum = sphere_get_radius(lhs) + sphere_get_radius(rhs);
+		return float(vector_length_squared3(vector_sub(rhs.center_radius, lhs.center_radius))) <= radius_sum * radius_sum;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a bounding sphere and returns the sphere that contains the result.
+	// Multiplication order is as follow: world_bounds = sphere_mul(local_bounds, local_to_world)
+	// With non-uniform scale, the radius is scaled by the longest matrix axis.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_mul(spheref_arg0 input, matrix3x4f_arg1 transform) RTM_NO_EXCEPT
+	{
+		const float x_length_sq = vector_length_squared3(transform.x_axis);
+		const float y_length_sq = vector_length_squared3(transform.y_axis);
+		const float z_length_sq = vector_length_squared3(transform.z_axis);
+		const float max_scale = scalar_sqrt(scalar_max(x_length_sq, scalar_max(y_length_sq, z_length_sq)));
+
+		return sphere_set(matrix_mul_point3(input.center_radius, transform), sphere_get_radius(input) * max_scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a bounding sphere and returns the sphere that contains the result.
+	// Multiplication order is as follow: world_bounds = sphere_mul(local_bounds, local_to_world)
+	// With non-uniform scale, the radius is scaled by the largest absolute scale component.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_mul(spheref_arg0 input, qvvf_arg1 transform) RTM_NO_EXCEPT
+	{
+		const vector4f abs_scale = vector_abs(transform.scale);
+		const float max_scale = scalar_max(float(vector_get_x(abs_scale)), scalar_max(float(vector_get_y(abs_scale)), float(vector_get_z(abs_scale))));
+
+		return sphere_set(qvv_mul_point3(input.center_radius, transform), sphere_get_radius(input) * max_scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transforms a bounding sphere.
+	// Multiplication order is as follow: world_bounds = sphere_mul(local_bounds, local_to_world)
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_mul(spheref_arg0 input, qvsf_arg1 transform) RTM_NO_EXCEPT
+	{
+		const float scale = scalar_abs(qvs_get_scale(transform));
+		return sphere_set(qvs_mul_point3(input.center_radius, transform), sphere_get_radius(input) * scale);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the bounding sphere that contains an axis aligned bounding box.
+	//////////////////////////////////////////////////////////////////////////
+	inline spheref RTM_SIMD_CALL sphere_from_aabb(aabbf_arg0 input) RTM_NO_EXCEPT
+	{
+		return sphere_set(input.center, vector_length3(input.extent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the axis aligned bounding box that contains a bounding sphere.
+	//////////////////////////////////////////////////////////////////////////
+	inline aabbf RTM_SIMD_CALL aabb_from_sphere(spheref_arg0 input) RTM_NO_EXCEPT
+	{
+		return aabb_set(sphere_get_center(input), vector_dup_w(input.center_radius));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,164 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/quatf.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The polynomial form of a cubic spline basis.
+		// The weight of control point 'i' is: sum(coefficients[power][i] * t^power).
+		//////////////////////////////////////////////////////////////////////////
+		struct spline_basis4
+		{
+			float coefficients[4][4];
+		};
+
+		constexpr spline_basis4 spline_bezier_basis() RTM_NO_EXCEPT
+		{
+			return spline_basis4{ { { 1.0F, 0.0F, 0.0F, 0.0F }, { -3.0F, 3.0F, 0.0F, 0.0F }, { 3.0F, -6.0F, 3.0F, 0.0F }, { -1.0F, 3.0F, -3.0F, 1.0F } } };
+		}
+
+		// Control points are ordered: start, start tangent, end, end tangent
+		constexpr spline_basis4 spline_hermite_basis() RTM_NO_EXCEPT
+		{
+			return spline_basis4{ { { 1.0F, 0.0F, 0.0F, 0.0F }, { 0.0F, 1.0F, 0.0F, 0.0F }, { -3.0F, -2.0F, 3.0F, -1.0F }, { 2.0F, 1.0F, -2.0F, 1.0F } } };
+		}
+
+		constexpr spline_basis4 spline_catmull_rom_basis() RTM_NO_EXCEPT
+		{
+			return spline_basis4{ { { 0.0F, 1.0F, 0.0F, 0.0F }, { -0.5F, 0.0F, 0.5F, 0.0F }, { 1.0F, -2.5F, 2.0F, -0.5F }, { -0.5F, 1.5F, -1.5F, 0.5F } } };
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the weights of the 4 control points, one per lane, at the given time.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL spline_weights(const spline_basis4& basis, float t) RTM_NO_EXCEPT
+		{
+			const vector4f t_v = vector_set(t);
+			const vector4f c0 = vector_set(basis.coefficients[0][0], basis.coefficients[0][1], basis.coefficients[0][2], basis.coefficients[0][3]);
+			const vector4f c1 = vector_set(basis.coefficients[1][0], basis.coefficients[1][1], basis.coefficients[1][2], basis.coefficients[1][3]);
+			const vector4f c2 = vector_set(basis.coefficients[2][0], basis.coefficients[2][1], basis.coefficients[2][2], basis.coefficients[2][3]);
+			const vector4f c3 = vector_set(basis.coefficients[3][0], basis.coefficients[3][1], basis.coefficients[3][2], basis.coefficients[3][3]);
+
+			// Horner form: ((c3 * t + c2) * t + c1) * t + c0
+			return vector_mul_add(vector_mul_add(vector_mul_add(c3, t_v, c2), t_v, c1), t_v, c0);
+		}
+
+		inline vector4f RTM_SIMD_CALL spline_eval(const spline_basis4& basis, vector4f_arg0 p0, vector4f_arg1 p1, vector4f_arg2 p2, vector4f_arg3 p3, float t) RTM_NO_EXCEPT
+		{
+			const vector4f weights = spline_weights(basis, t);
+			return vector_mul_add(p3, vector_dup_w(weights), vector_mul_add(p2, vector_dup_z(weights), vector_mul_add(p1, vector_dup_y(weights), vector_mul(p0, vector_dup_x(weights)))));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns quat_slerp(start, end, alpha) but falls back to quat_lerp when both rotations are nearly equal.
+		// The slerp weights divide by sin(angle) which is not defined when the angle is zero.
+		//////////////////////////////////////////////////////////////////////////
+		inline quatf RTM_SIMD_CALL quat_squad_slerp(quatf_arg0 start, quatf_arg1 end, float alpha) RTM_NO_EXCEPT
+		{
+			const float cos_half_angle = quat_dot(start, end);
+			return scalar_abs(cos_half_angle) >= 0.9999F ? quat_lerp(start, end, alpha) : quat_slerp(start, end, alpha);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the point on a cubic Bezier curve at time t in [0.0, 1.0].
+	// The curve starts at p0, ends at p3, and p1 and p2 shape it.
+	// All 4 components are interpolated.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_bezier(vector4f_arg0 p0, vector4f_arg1 p1, vector4f_arg2 p2, vector4f_arg3 p3, float t) RTM_NO_EXCEPT
+	{
+		return rtm_impl::spline_eval(rtm_impl::spline_bezier_basis(), p0, p1, p2, p3, t);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the point on a cubic Hermite curve at time t in [0.0, 1.0].
+	// The curve starts at 'start' with the tangent 'start_tangent' and ends at 'end' with the tangent 'end_tangent'.
+	// All 4 components are interpolated.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_hermite(vector4f_arg0 start, vector4f_arg1 start_tangent, vector4f_arg2 end, vector4f_arg3 end_tangent, float t) RTM_NO_EXCEPT
+	{
+		return rtm_impl::spline_eval(rtm_impl::spline_hermite_basis(), start, start_tangent, end, end_tangent, t);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the point on a uniform Catmull-Rom curve at time t in [0.0, 1.0].
+	// The curve passes through every control point, t interpolates between p1 and p2.
+	// All 4 components are interpolated.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_catmull_rom(vector4f_arg0 p0, vector4f_arg1 p1, vector4f_arg2 p2, vector4f_arg3 p3, float t) RTM_NO_EXCEPT
+	{
+		return rtm_impl::spline_eval(rtm_impl::spline_catmull_rom_basis(), p0, p1, p2, p3, t);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the squad control point of 'current' for the sequence of rotations: previous, current, next.
+	// The result is used as 'start_control' when 'current' starts a segment or as 'end_control' when it ends one.
+	// See: Quaternions, Interpolation and Animation (Erik B. Dam, Martin Koch, Martin Lillholm)
+	// Rotations must be normalized, the neighbors are flipped when needed to use the shortest path.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_squad_control(quatf_arg0 previous, quatf_arg1 current, quatf_arg2 next) RTM_NO_EXCEPT
+	{
+		const float previous_dot = quat_dot(previous, current);
+		const float next_dot = quat_dot(next, current);
+		const quatf previous_ = previous_dot >= 0.0F ? previous : quat_neg(previous);
+		const quatf next_ = next_dot >= 0.0F ? next : quat_neg(next);
+
+		// control = current * exp(-(log(current^-1 * next) + log(current^-1 * previous)) / 4)
+		// quat_mul(lhs, rhs) applies 'lhs' first which reverses the product order
+		const quatf inv_current = quat_conjugate(current);
+		const vector4f log_next = quat_log(quat_mul(next_, inv_current));
+		const vector4f log_previous = quat_log(quat_mul(previous_, inv_current));
+		const vector4f tangent = vector_mul(vector_add(log_next, log_previous), -0.25F);
+
+		return quat_normalize(quat_mul(quat_exp(tangent), current));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the spherical cubic interpolation (squad) between 'start' and 'end' at time t in [0.0, 1.0].
+	// squad = slerp(slerp(start, end, t), slerp(start_control, end_control, t), 2t(1 - t))
+	// The control points are usually computed with quat_squad_control.
+	// Like quat_slerp, every interpolation uses the shortest path. Nearly equal rotations are linearly
+	// interpolated instead which keeps constant curves and coincident control points well defined.
+	//////////////////////////////////////////////////////////////////////////
+	inline quatf RTM_SIMD_CALL quat_squad(quatf_arg0 start, quatf_arg1 start_control, quatf_arg2 end_control, quatf_arg3 end, float t) RTM_NO_EXCEPT
+	{
+		const quatf outer = rtm_impl::quat_squad_slerp(start, end, t);
+		const quatf inner = rtm_impl::quat_squad_slerp(start_control, end_control, t);
+		return rtm_impl::quat_squad_slerp(outer, inner, 2.0F * t * (1.0F - t));
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
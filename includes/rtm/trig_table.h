@@ -0,0 +1,458 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector4i.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+//////////////////////////////////////////////////////////////////////////
+// Trigonometric functions that linearly interpolate a small lookup table instead of
+// evaluating a polynomial. They are meant for consumers that only need about 1e-3
+// of precision such as audio LFOs, procedural noise, and particle effects.
+// The sine table holds 256 entries over [0, 2pi) and the arc-tangent table 64 entries
+// over [0, 1]. Every entry stores its value and the delta to the next one, 2.5 KB in total:
+// a lookup is a single 64 bit load per component followed by a multiply-add.
+// With AVX2, the 4 entries are loaded with a single gather.
+// Inputs must be finite.
+//////////////////////////////////////////////////////////////////////////
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The number of sine table entries over [0, 2pi), it must be a power of two.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr int32_t k_sin_table_size = 256;
+
+		//////////////////////////////////////////////////////////////////////////
+		// The number of arc-tangent table entries over [0, 1].
+		//////////////////////////////////////////////////////////////////////////
+		constexpr int32_t k_atan_table_size = 64;
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the sine table: the entry [i] holds sin(i * 2pi / 256) and the delta
+		// to the entry [i + 1], wrapping around.
+		//////////////////////////////////////////////////////////////////////////
+		inline const float* get_sin_table() RTM_NO_EXCEPT
+		{
+			alignas(64) static const float k_table[k_sin_table_size * 2] =
+			{
+				0.0F, 2.45412290e-2F, 2.45412290e-2F, 2.45264471e-2F,
+				4.90676761e-2F, 2.44968906e-2F, 7.35645667e-2F, 2.44525746e-2F,
+				9.80171412e-2F, 2.43935362e-2F, 1.22410677e-1F, 2.43197903e-2F,
+				1.46730468e-1F, 2.42314190e-2F, 1.70961887e-1F, 2.41284370e-2F,
+				1.95090324e-1F, 2.40109116e-2F, 2.19101235e-1F, 2.38789469e-2F,
+				2.42980182e-1F, 2.37325728e-2F, 2.66712755e-1F, 2.35719085e-2F,
+				2.90284663e-1F, 2.33970881e-2F, 3.13681751e-1F, 2.32081115e-2F,
+				3.36889863e-1F, 2.30051875e-2F, 3.59895051e-1F, 2.27883756e-2F,
+				3.82683426e-1F, 2.25578845e-2F, 4.05241311e-1F, 2.23137736e-2F,
+				4.27555084e-1F, 2.20562518e-2F, 4.49611336e-1F, 2.17854083e-2F,
+				4.71396744e-1F, 2.15014517e-2F, 4.92898196e-1F, 2.12045610e-2F,
+				5.14102757e-1F, 2.08948851e-2F, 5.34997642e-1F, 2.05726027e-2F,
+				5.55570245e-1F, 2.02379227e-2F, 5.75808167e-1F, 1.98911428e-2F,
+				5.95699310e-1F, 1.95322633e-2F, 6.15231574e-1F, 1.91617012e-2F,
+				6.34393275e-1F, 1.87795758e-2F, 6.53172851e-1F, 1.83861256e-2F,
+				6.71558976e-1F, 1.79815888e-2F, 6.89540565e-1F, 1.75662041e-2F,
+				7.07106769e-1F, 1.71403289e-2F, 7.24247098e-1F, 1.67040229e-2F,
+				7.40951121e-1F, 1.62577033e-2F, 7.57208824e-1F, 1.58016086e-2F,
+				7.73010433e-1F, 1.53359771e-2F, 7.88346410e-1F, 1.48611069e-2F,
+				8.03207517e-1F, 1.43772960e-2F, 8.17584813e-1F, 1.38847828e-2F,
+				8.31469595e-1F, 1.33839846e-2F, 8.44853580e-1F, 1.28750205e-2F,
+				8.57728601e-1F, 1.23583674e-2F, 8.70086968e-1F, 1.18343234e-2F,
+				8.81921291e-1F, 1.13030076e-2F, 8.93224299e-1F, 1.07650161e-2F,
+				9.03989315e-1F, 1.02204680e-2F, 9.14209783e-1F, 9.66972113e-3F,
+				9.23879504e-1F, 9.11331177e-3F, 9.32992816e-1F, 8.55123997e-3F,
+				9.41544056e-1F, 7.98410177e-3F, 9.49528158e-1F, 7.41219521e-3F,
+				9.56940353e-1F, 6.83569908e-3F, 9.63776052e-1F, 6.25520945e-3F,
+				9.70031261e-1F, 5.67084551e-3F, 9.75702107e-1F, 5.08314371e-3F,
+				9.80785251e-1F, 4.49240208e-3F, 9.85277653e-1F, 3.89885902e-3F,
+				9.89176512e-1F, 3.30305099e-3F, 9.92479563e-1F, 2.70515680e-3F,
+				9.95184720e-1F, 2.10571289e-3F, 9.97290432e-1F, 1.50501728e-3F,
+				9.98795450e-1F, 9.03367996e-4F, 9.99698818e-1F, 3.01182270e-4F,
+				1.00000000e0F, -3.01182270e-4F, 9.99698818e-1F, -9.03367996e-4F,
+				9.98795450e-1F, -1.50501728e-3F, 9.97290432e-1F, -2.10571289e-3F,
+				9.95184720e-1F, -2.70515680e-3F, 9.92479563e-1F, -3.30305099e-3F,
+				9.89176512e-1F, -3.89885902e-3F, 9.85277653e-1F, -4.49240208e-3F,
+				9.80785251e-1F, -5.08314371e-3F, 9.75702107e-1F, -5.67084551e-3F,
+				9.70031261e-1F, -6.25520945e-3F, 9.63776052e-1F, -6.83569908e-3F,
+				9.56940353e-1F, -7.41219521e-3F, 9.49528158e-1F, -7.98410177e-3F,
+				9.41544056e-1F, -8.55123997e-3F, 9.32992816e-1F, -9.11331177e-3F,
+				9.23879504e-1F, -9.66972113e-3F, 9.14209783e-1F, -1.02204680e-2F,
+				9.03989315e-1F, -1.07650161e-2F, 8.93224299e-1F, -1.13030076e-2F,
+				8.81921291e-1F, -1.18343234e-2F, 8.70086968e-1F, -1.23583674e-2F,
+				8.57728601e-1F, -1.28750205e-2F, 8.44853580e-1F, -1.33839846e-2F,
+				8.31469595e-1F, -1.38847828e-2F, 8.17584813e-1F, -1.43772960e-2F,
+				8.03207517e-1F, -1.48611069e-2F, 7.88346410e-1F, -1.53359771e-2F,
+				7.73010433e-1F, -1.58016086e-2F, 7.57208824e-1F, -1.62577033e-2F,
+				7.40951121e-1F, -1.67040229e-2F, 7.24247098e-1F, -1.71403289e-2F,
+				7.07106769e-1F, -1.75662041e-2F, 6.89540565e-1F, -1.79815888e-2F,
+				6.71558976e-1F, -1.83861256e-2F, 6.53172851e-1F, -1.87795758e-2F,
+				6.34393275e-1F, -1.91617012e-2F, 6.15231574e-1F, -1.95322633e-2F,
+				5.95699310e-1F, -1.98911428e-2F, 5.75808167e-1F, -2.02379227e-2F,
+				5.55570245e-1F, -2.05726027e-2F, 5.34997642e-1F, -2.08948851e-2F,
+				5.14102757e-1F, -2.12045610e-2F, 4.92898196e-1F, -2.15014517e-2F,
+				4.71396744e-1F, -2.17854083e-2F, 4.49611336e-1F, -2.20562518e-2F,
+				4.27555084e-1F, -2.23137736e-2F, 4.05241311e-1F, -2.25578845e-2F,
+				3.82683426e-1F, -2.27883756e-2F, 3.59895051e-1F, -2.30051875e-2F,
+				3.36889863e-1F, -2.32081115e-2F, 3.13681751e-1F, -2.33970881e-2F,
+				2.90284663e-1F, -2.35719085e-2F, 2.66712755e-1F, -2.37325728e-2F,
+				2.42980182e-1F, -2.38789469e-2F, 2.19101235e-1F, -2.40109116e-2F,
+				1.95090324e-1F, -2.41284370e-2F, 1.70961887e-1F, -2.42314190e-2F,
+				1.46730468e-1F, -2.43197903e-2F, 1.22410677e-1F, -2.43935362e-2F,
+				9.80171412e-2F, -2.44525746e-2F, 7.35645667e-2F, -2.44968906e-2F,
+				4.90676761e-2F, -2.45264471e-2F, 2.45412290e-2F, -2.45412290e-2F,
+				1.22464685e-16F, -2.45412290e-2F, -2.45412290e-2F, -2.45264471e-2F,
+				-4.90676761e-2F, -2.44968906e-2F, -7.35645667e-2F, -2.44525746e-2F,
+				-9.80171412e-2F, -2.43935362e-2F, -1.22410677e-1F, -2.43197903e-2F,
+				-1.46730468e-1F, -2.42314190e-2F, -1.70961887e-1F, -2.41284370e-2F,
+				-1.95090324e-1F, -2.40109116e-2F, -2.19101235e-1F, -2.38789469e-2F,
+				-2.42980182e-1F, -2.37325728e-2F, -2.66712755e-1F, -2.35719085e-2F,
+				-2.90284663e-1F, -2.33970881e-2F, -3.13681751e-1F, -2.32081115e-2F,
+				-3.36889863e-1F, -2.30051875e-2F, -3.59895051e-1F, -2.27883756e-2F,
+				-3.82683426e-1F, -2.25578845e-2F, -4.05241311e-1F, -2.23137736e-2F,
+				-4.27555084e-1F, -2.20562518e-2F, -4.49611336e-1F, -2.17854083e-2F,
+				-4.71396744e-1F, -2.15014517e-2F, -4.92898196e-1F, -2.12045610e-2F,
+				-5.14102757e-1F, -2.08948851e-2F, -5.34997642e-1F, -2.05726027e-2F,
+				-5.55570245e-1F, -2.02379227e-2F, -5.75808167e-1F, -1.98911428e-2F,
+				-5.95699310e-1F, -1.95322633e-2F, -6.15231574e-1F, -1.91617012e-2F,
+				-6.34393275e-1F, -1.87795758e-2F, -6.53172851e-1F, -1.83861256e-2F,
+				-6.71558976e-1F, -1.79815888e-2F, -6.89540565e-1F, -1.75662041e-2F,
+				-7.07106769e-1F, -1.71403289e-2F, -7.24247098e-1F, -1.67040229e-2F,
+				-7.40951121e-1F, -1.62577033e-2F, -7.57208824e-1F, -1.58016086e-2F,
+				-7.73010433e-1F, -1.53359771e-2F, -7.88346410e-1F, -1.48611069e-2F,
+				-8.03207517e-1F, -1.43772960e-2F, -8.17584813e-1F, -1.38847828e-2F,
+				-8.31469595e-1F, -1.33839846e-2F, -8.44853580e-1F, -1.28750205e-2F,
+				-8.57728601e-1F, -1.23583674e-2F, -8.70086968e-1F, -1.18343234e-2F,
+				-8.81921291e-1F, -1.13030076e-2F, -8.93224299e-1F, -1.07650161e-2F,
+				-9.03989315e-1F, -1.02204680e-2F, -9.14209783e-1F, -9.66972113e-3F,
+				-9.23879504e-1F, -9.11331177e-3F, -9.32992816e-1F, -8.55123997e-3F,
+				-9.41544056e-1F, -7.98410177e-3F, -9.49528158e-1F, -7.41219521e-3F,
+				-9.56940353e-1F, -6.83569908e-3F, -9.63776052e-1F, -6.25520945e-3F,
+				-9.70031261e-1F, -5.67084551e-3F, -9.75702107e-1F, -5.08314371e-3F,
+				-9.80785251e-1F, -4.49240208e-3F, -9.85277653e-1F, -3.89885902e-3F,
+				-9.89176512e-1F, -3.30305099e-3F, -9.92479563e-1F, -2.70515680e-3F,
+				-9.95184720e-1F, -2.10571289e-3F, -9.97290432e-1F, -1.50501728e-3F,
+				-9.98795450e-1F, -9.03367996e-4F, -9.99698818e-1F, -3.01182270e-4F,
+				-1.00000000e0F, 3.01182270e-4F, -9.99698818e-1F, 9.03367996e-4F,
+				-9.98795450e-1F, 1.50501728e-3F, -9.97290432e-1F, 2.10571289e-3F,
+				-9.95184720e-1F, 2.70515680e-3F, -9.92479563e-1F, 3.30305099e-3F,
+				-9.89176512e-1F, 3.89885902e-3F, -9.85277653e-1F, 4.49240208e-3F,
+				-9.80785251e-1F, 5.08314371e-3F, -9.75702107e-1F, 5.67084551e-3F,
+				-9.70031261e-1F, 6.25520945e-3F, -9.63776052e-1F, 6.83569908e-3F,
+				-9.56940353e-1F, 7.41219521e-3F, -9.49528158e-1F, 7.98410177e-3F,
+				-9.41544056e-1F, 8.55123997e-3F, -9.32992816e-1F, 9.11331177e-3F,
+				-9.23879504e-1F, 9.66972113e-3F, -9.14209783e-1F, 1.02204680e-2F,
+				-9.03989315e-1F, 1.07650161e-2F, -8.93224299e-1F, 1.13030076e-2F,
+				-8.81921291e-1F, 1.18343234e-2F, -8.70086968e-1F, 1.23583674e-2F,
+				-8.57728601e-1F, 1.28750205e-2F, -8.44853580e-1F, 1.33839846e-2F,
+				-8.31469595e-1F, 1.38847828e-2F, -8.17584813e-1F, 1.43772960e-2F,
+				-8.03207517e-1F, 1.48611069e-2F, -7.88346410e-1F, 1.53359771e-2F,
+				-7.73010433e-1F, 1.58016086e-2F, -7.57208824e-1F, 1.62577033e-2F,
+				-7.40951121e-1F, 1.67040229e-2F, -7.24247098e-1F, 1.71403289e-2F,
+				-7.07106769e-1F, 1.75662041e-2F, -6.89540565e-1F, 1.79815888e-2F,
+				-6.71558976e-1F, 1.83861256e-2F, -6.53172851e-1F, 1.87795758e-2F,
+				-6.34393275e-1F, 1.91617012e-2F, -6.15231574e-1F, 1.95322633e-2F,
+				-5.95699310e-1F, 1.98911428e-2F, -5.75808167e-1F, 2.02379227e-2F,
+				-5.55570245e-1F, 2.05726027e-2F, -5.34997642e-1F, 2.08948851e-2F,
+				-5.14102757e-1F, 2.12045610e-2F, -4.92898196e-1F, 2.15014517e-2F,
+				-4.71396744e-1F, 2.17854083e-2F, -4.49611336e-1F, 2.20562518e-2F,
+				-4.27555084e-1F, 2.23137736e-2F, -4.05241311e-1F, 2.25578845e-2F,
+				-3.82683426e-1F, 2.27883756e-2F, -3.59895051e-1F, 2.30051875e-2F,
+				-3.36889863e-1F, 2.32081115e-2F, -3.13681751e-1F, 2.33970881e-2F,
+				-2.90284663e-1F, 2.35719085e-2F, -2.66712755e-1F, 2.37325728e-2F,
+				-2.42980182e-1F, 2.38789469e-2F, -2.19101235e-1F, 2.40109116e-2F,
+				-1.95090324e-1F, 2.41284370e-2F, -1.70961887e-1F, 2.42314190e-2F,
+				-1.46730468e-1F, 2.43197903e-2F, -1.22410677e-1F, 2.43935362e-2F,
+				-9.80171412e-2F, 2.44525746e-2F, -7.35645667e-2F, 2.44968906e-2F,
+				-4.90676761e-2F, 2.45264471e-2F, -2.45412290e-2F, 2.45412290e-2F,
+			};
+
+			return &k_table[0];
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the arc-tangent table: the entry [i] holds atan(i / 64) and the delta
+		// to the entry [i + 1].
+		//////////////////////////////////////////////////////////////////////////
+		inline const float* get_atan_table() RTM_NO_EXCEPT
+		{
+			alignas(64) static const float k_table[k_atan_table_size * 2] =
+			{
+				0.0F, 1.56237287e-2F, 1.56237287e-2F, 1.56161049e-2F,
+				3.12398337e-2F, 1.56008787e-2F, 4.68407124e-2F, 1.55780986e-2F,
+				6.24188110e-2F, 1.55478194e-2F, 7.79666305e-2F, 1.55101493e-2F,
+				9.34767798e-2F, 1.54651776e-2F, 1.08941957e-1F, 1.54130384e-2F,
+				1.24354996e-1F, 1.53538808e-2F, 1.39708877e-1F, 1.52878612e-2F,
+				1.54996738e-1F, 1.52151883e-2F, 1.70211926e-1F, 1.51360184e-2F,
+				1.85347944e-1F, 1.50506049e-2F, 2.00398549e-1F, 1.49591565e-2F,
+				2.15357706e-1F, 1.48618817e-2F, 2.30219588e-1F, 1.47590786e-2F,
+				2.44978666e-1F, 1.46509707e-2F, 2.59629637e-1F, 1.45378113e-2F,
+				2.74167448e-1F, 1.44199133e-2F, 2.88587362e-1F, 1.42975152e-2F,
+				3.02884877e-1F, 1.41708851e-2F, 3.17055762e-1F, 1.40403211e-2F,
+				3.31096083e-1F, 1.39060915e-2F, 3.45002174e-1F, 1.37684941e-2F,
+				3.58770669e-1F, 1.36277676e-2F, 3.72398436e-1F, 1.34842396e-2F,
+				3.85882676e-1F, 1.33380890e-2F, 3.99220765e-1F, 1.31896734e-2F,
+				4.12410438e-1F, 1.30392015e-2F, 4.25449640e-1F, 1.28869116e-2F,
+				4.38336551e-1F, 1.27331018e-2F, 4.51069653e-1F, 1.25779510e-2F,
+				4.63647604e-1F, 1.24217272e-2F, 4.76069331e-1F, 1.22646093e-2F,
+				4.88333941e-1F, 1.21068954e-2F, 5.00440836e-1F, 1.19486451e-2F,
+				5.12389481e-1F, 1.17901564e-2F, 5.24179637e-1F, 1.16316080e-2F,
+				5.35811245e-1F, 1.14731193e-2F, 5.47284365e-1F, 1.13149285e-2F,
+				5.58599293e-1F, 1.11571550e-2F, 5.69756448e-1F, 1.09999180e-2F,
+				5.80756366e-1F, 1.08433366e-2F, 5.91599703e-1F, 1.06876493e-2F,
+				6.02287352e-1F, 1.05328560e-2F, 6.12820208e-1F, 1.03791356e-2F,
+				6.23199344e-1F, 1.02265477e-2F, 6.33425891e-1F, 1.00752115e-2F,
+				6.43501103e-1F, 9.92524624e-3F, 6.53426349e-1F, 9.77665186e-3F,
+				6.63203001e-1F, 9.62954760e-3F, 6.72832549e-1F, 9.48399305e-3F,
+				6.82316542e-1F, 9.34010744e-3F, 6.91656649e-1F, 9.19777155e-3F,
+				7.00854421e-1F, 9.05722380e-3F, 7.09911644e-1F, 8.91834497e-3F,
+				7.18829989e-1F, 8.78131390e-3F, 7.27611303e-1F, 8.64613056e-3F,
+				7.36257434e-1F, 8.51267576e-3F, 7.44770110e-1F, 8.38118792e-3F,
+				7.53151298e-1F, 8.25148821e-3F, 7.61402786e-1F, 8.12369585e-3F,
+				7.69526482e-1F, 7.99781084e-3F, 7.77524292e-1F, 7.87389278e-3F,
+			};
+
+			return &k_table[0];
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Loads the table entries at the provided per component indices and returns
+		// their values and deltas.
+		//////////////////////////////////////////////////////////////////////////
+		inline void RTM_SIMD_CALL trig_table_gather(const float* table, vector4i_arg0 indices, vector4f& out_values, vector4f& out_deltas) RTM_NO_EXCEPT
+		{
+#if defined(RTM_AVX2_INTRINSICS)
+			// Every entry is loaded as a 64 bit value: [value0, delta0, value1, delta1 | value2, delta2, value3, delta3]
+			// The masked gather avoids an uninitialized value warning with GCC
+			const __m256d all_lanes = _mm256_castsi256_pd(_mm256_set1_epi64x(-1));
+			const __m256 entries = _mm256_castpd_ps(_mm256_mask_i32gather_pd(_mm256_setzero_pd(), reinterpret_cast<const double*>(table), indices, all_lanes, 8));
+			const __m128 entries01 = _mm256_castps256_ps128(entries);
+			const __m128 entries23 = _mm256_extractf128_ps(entries, 1);
+			out_values = _mm_shuffle_ps(entries01, entries23, _MM_SHUFFLE(2, 0, 2, 0));
+			out_deltas = _mm_shuffle_ps(entries01, entries23, _MM_SHUFFLE(3, 1, 3, 1));
+#elif defined(RTM_SSE2_INTRINSICS)
+			const __m128 entry0 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(table + vector_get_x(indices) * 2)));
+			const __m128 entry1 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(table + vector_get_y(indices) * 2)));
+			const __m128 entry2 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(table + vector_get_z(indices) * 2)));
+			const __m128 entry3 = _mm_castpd_ps(_mm_load_sd(reinterpret_cast<const double*>(table + vector_get_w(indices) * 2)));
+			const __m128 entries01 = _mm_movelh_ps(entry0, entry1);
+			const __m128 entries23 = _mm_movelh_ps(entry2, entry3);
+			out_values = _mm_shuffle_ps(entries01, entries23, _MM_SHUFFLE(2, 0, 2, 0));
+			out_deltas = _mm_shuffle_ps(entries01, entries23, _MM_SHUFFLE(3, 1, 3, 1));
+#elif defined(RTM_NEON_INTRINSICS)
+			const float32x4_t entries01 = vcombine_f32(vld1_f32(table + vector_get_x(indices) * 2), vld1_f32(table + vector_get_y(indices) * 2));
+			const float32x4_t entries23 = vcombine_f32(vld1_f32(table + vector_get_z(indices) * 2), vld1_f32(table + vector_get_w(indices) * 2));
+			const float32x4x2_t values_deltas = vuzpq_f32(entries01, entries23);
+			out_values = values_deltas.val[0];
+			out_deltas = values_deltas.val[1];
+#else
+			const float* entry0 = table + vector_get_x(indices) * 2;
+			const float* entry1 = table + vector_get_y(indices) * 2;
+			const float* entry2 = table + vector_get_z(indices) * 2;
+			const float* entry3 = table + vector_get_w(indices) * 2;
+			out_values = vector_set(entry0[0], entry1[0], entry2[0], entry3[0]);
+			out_deltas = vector_set(entry0[1], entry1[1], entry2[1], entry3[1]);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per component the integral part of a table position rounded towards
+		// negative infinity along with its fractional part.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL trig_table_floor(vector4f_arg0 position, vector4f& out_alpha) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS) && !defined(RTM_SSE4_INTRINSICS)
+			// Without SSE4, vector_floor is expensive: truncate and subtract 1 when we rounded up
+			const __m128i truncated = _mm_cvttps_epi32(position);
+			const __m128 is_rounded_up = _mm_cmpgt_ps(_mm_cvtepi32_ps(truncated), position);
+			const __m128i indices = _mm_add_epi32(truncated, _mm_castps_si128(is_rounded_up));
+			out_alpha = _mm_sub_ps(position, _mm_cvtepi32_ps(indices));
+			return indices;
+#else
+			const vector4f index = vector_floor(position);
+			out_alpha = vector_sub(position, index);
+			return vector_truncate_to_int(index);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Interpolates the sine table at the provided per component indices.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_sin_table_lerp(vector4i_arg0 indices, vector4f_arg1 alpha) RTM_NO_EXCEPT
+		{
+			vector4f values;
+			vector4f deltas;
+			trig_table_gather(get_sin_table(), vector_and(indices, vector_set(k_sin_table_size - 1)), values, deltas);
+			return vector_mul_add(deltas, alpha, values);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the arc-tangent of the input in [0, 1].
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_atan_unit_table(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+			// The index is clamped, 1.0 interpolates the last entry up to its end
+			const vector4f position = vector_mul(input, float(k_atan_table_size));
+			const vector4i indices = vector_clamp(vector_truncate_to_int(position), vector_set(int32_t(0)), vector_set(k_atan_table_size - 1));
+			const vector4f alpha = vector_sub(position, vector_int_to_float(indices));
+
+			vector4f values;
+			vector4f deltas;
+			trig_table_gather(get_atan_table(), indices, values, deltas);
+			return vector_mul_add(deltas, alpha, values);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the arc-tangent of the input in [0, 1].
+		//////////////////////////////////////////////////////////////////////////
+		inline float scalar_atan_unit_table(float input) RTM_NO_EXCEPT
+		{
+			const float position = input * float(k_atan_table_size);
+			int32_t index = static_cast<int32_t>(position);
+			index = index < 0 ? 0 : (index > k_atan_table_size - 1 ? k_atan_table_size - 1 : index);
+			const float* entry = get_atan_table() + index * 2;
+			return entry[0] + (position - float(index)) * entry[1];
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the sine of the input angle by interpolating a 256 entry table.
+	// Max absolute error: 7.6e-5 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_sin_table(float angle) RTM_NO_EXCEPT
+	{
+		const float position = angle * float(rtm_impl::k_sin_table_size) * float(rtm::constants::one_div_two_pi());
+		const float index = scalar_floor(position);
+		const float* entry = rtm_impl::get_sin_table() + (static_cast<int32_t>(index) & (rtm_impl::k_sin_table_size - 1)) * 2;
+		return entry[0] + (position - index) * entry[1];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the cosine of the input angle by interpolating a 256 entry table.
+	// Max absolute error: 7.6e-5 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_cos_table(float angle) RTM_NO_EXCEPT
+	{
+		// cos(angle) = sin(angle + pi/2), a quarter of the table further
+		const float position = angle * float(rtm_impl::k_sin_table_size) * float(rtm::constants::one_div_two_pi());
+		const float index = scalar_floor(position);
+		const float* entry = rtm_impl::get_sin_table() + ((static_cast<int32_t>(index) + rtm_impl::k_sin_table_size / 4) & (rtm_impl::k_sin_table_size - 1)) * 2;
+		return entry[0] + (position - index) * entry[1];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant, by interpolating a 64 entry table.
+	// Returns 0.0 when both are 0.0.
+	// Max absolute error: 2.5e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline float scalar_atan2_table(float y, float x) RTM_NO_EXCEPT
+	{
+		// See vector_atan2_table for details
+		const float abs_x = scalar_abs(x);
+		const float abs_y = scalar_abs(y);
+		const float max_value = scalar_max(abs_x, abs_y);
+		const float ratio = max_value > 0.0F ? (scalar_min(abs_x, abs_y) / max_value) : 0.0F;
+
+		float result = rtm_impl::scalar_atan_unit_table(ratio);
+		result = abs_y > abs_x ? (float(rtm::constants::half_pi()) - result) : result;
+		result = x < 0.0F ? (float(rtm::constants::pi()) - result) : result;
+		return std::signbit(y) ? -result : result;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the sine of the input angle by interpolating a 256 entry table.
+	// Max absolute error: 7.6e-5 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_sin_table(vector4f_arg0 angle) RTM_NO_EXCEPT
+	{
+		// The table wraps around: the range reduction is a mask of the integral part
+		const vector4f position = vector_mul(angle, float(rtm_impl::k_sin_table_size) * float(rtm::constants::one_div_two_pi()));
+		vector4f alpha;
+		const vector4i indices = rtm_impl::trig_table_floor(position, alpha);
+		return rtm_impl::vector_sin_table_lerp(indices, alpha);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the cosine of the input angle by interpolating a 256 entry table.
+	// Max absolute error: 7.6e-5 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_cos_table(vector4f_arg0 angle) RTM_NO_EXCEPT
+	{
+		// cos(angle) = sin(angle + pi/2), a quarter of the table further
+		const vector4f position = vector_mul(angle, float(rtm_impl::k_sin_table_size) * float(rtm::constants::one_div_two_pi()));
+		vector4f alpha;
+		const vector4i indices = rtm_impl::trig_table_floor(position, alpha);
+		return rtm_impl::vector_sin_table_lerp(vector_add(indices, vector_set(rtm_impl::k_sin_table_size / 4)), alpha);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component both the sine and cosine of the input angle by interpolating
+	// a 256 entry table. The results match vector_sin_table and vector_cos_table exactly.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_sincos_table(vector4f_arg0 angle, vector4f& out_sin, vector4f& out_cos) RTM_NO_EXCEPT
+	{
+		const vector4f position = vector_mul(angle, float(rtm_impl::k_sin_table_size) * float(rtm::constants::one_div_two_pi()));
+		vector4f alpha;
+		const vector4i indices = rtm_impl::trig_table_floor(position, alpha);
+
+		out_sin = rtm_impl::vector_sin_table_lerp(indices, alpha);
+		out_cos = rtm_impl::vector_sin_table_lerp(vector_add(indices, vector_set(rtm_impl::k_sin_table_size / 4)), alpha);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant, by interpolating a 64 entry table.
+	// Returns 0.0 when both are 0.0.
+	// Max absolute error: 2.5e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_atan2_table(vector4f_arg0 y, vector4f_arg1 x) RTM_NO_EXCEPT
+	{
+		// Reduce to atan(min / max) in [0, pi/4] and restore the octant:
+		// atan(y/x) = pi/2 - atan(x/y) when abs(y) > abs(x)
+		// atan2(y, x) = pi - atan(y/-x) when x < 0.0
+		// atan2(-y, x) = -atan2(y, x)
+		const vector4f zero = vector_zero();
+		const vector4f abs_x = vector_abs(x);
+		const vector4f abs_y = vector_abs(y);
+		const vector4f max_value = vector_max(abs_x, abs_y);
+		const vector4f ratio = vector_select(vector_equal(max_value, zero), zero, vector_div(vector_min(abs_x, abs_y), max_value));
+
+		vector4f result = rtm_impl::vector_atan_unit_table(ratio);
+		result = vector_select(vector_greater_than(abs_y, abs_x), vector_sub(vector_set(float(rtm::constants::half_pi())), result), result);
+		result = vector_select(vector_less_than(x, zero), vector_sub(vector_set(float(rtm::constants::pi())), result), result);
+		return vector_copy_sign(result, y);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -43,6 +43,8 @@ namespace rtm
 		using vector4 = vector4f;
 		using quat = quatf;
 		using qvv = qvvf;
+		using qvs = qvsf;
+		using dualquat = dualquatf;
 
 		using matrix3x3 = matrix3x3f;
 		using matrix3x4 = matrix3x4f;
@@ -62,6 +64,8 @@ namespace rtm
 		using vector4 = vector4d;
 		using quat = quatd;
 		using qvv = qvvd;
+		using qvs = qvsd;
+		using dualquat = dualquatd;
 
 		using matrix3x3 = matrix3x3d;
 		using matrix3x4 = matrix3x4d;
@@ -26,8 +26,10 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "rtm/math.h"
+#include "rtm/fwd.h"
 
 #include <cstdint>
+#include <type_traits>
 
 namespace rtm
 {
@@ -42,11 +44,15 @@ namespace rtm
 	// A quaternion (4D complex number) where the imaginary part is the [w] component.
 	// It accurately represents a 3D rotation with no gimbal lock as long as it is kept normalized.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_AVX_INTRINSICS)
+	using quatd = __m256d;
+#else
 	struct quatd
 	{
 		__m128d xy;
 		__m128d zw;
 	};
+#endif
 
 	//////////////////////////////////////////////////////////////////////////
 	// A 4D vector.
@@ -56,11 +62,15 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// A 4D vector.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_AVX_INTRINSICS)
+	using vector4d = __m256d;
+#else
 	struct vector4d
 	{
 		__m128d xy;
 		__m128d zw;
 	};
+#endif
 
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x32 bit vector comparison mask for 32 bit floats: ~0 if true, 0 otherwise.
@@ -70,11 +80,15 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x64 bit vector comparison mask for 64 bit floats: ~0 if true, 0 otherwise.
 	//////////////////////////////////////////////////////////////////////////
+#if defined(RTM_AVX_INTRINSICS)
+	using mask4d = __m256d;
+#else
 	struct mask4d
 	{
 		__m128d xy;
 		__m128d zw;
 	};
+#endif
 
 	//////////////////////////////////////////////////////////////////////////
 	// A 4x32 bit vector comparison mask: ~0 if true, 0 otherwise.
@@ -89,6 +103,12 @@ namespace rtm
 		__m128i xy;
 		__m128i zw;
 	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of signed 32 bit integers.
+	// Note that with SSE2, it shares its underlying type with mask4i.
+	//////////////////////////////////////////////////////////////////////////
+	using vector4i = __m128i;
 #elif defined(RTM_NEON_INTRINSICS)
 	//////////////////////////////////////////////////////////////////////////
 	// A quaternion (4D complex number) where the imaginary part is the [w] component.
@@ -176,6 +196,32 @@ namespace rtm
 		uint64_t z;
 		uint64_t w;
 	};
+
+#if defined(_MSC_VER)
+	// MSVC uses a simple typedef to an identical underlying type for int32x4_t and float32x4_t
+	// To avoid issues of duplicate symbols, we introduce a concrete type
+
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of signed 32 bit integers.
+	//////////////////////////////////////////////////////////////////////////
+	struct alignas(16) vector4i
+	{
+		int32x4_t value;
+	};
+
+	// Helper macros to simplify usage
+	#define RTM_IMPL_VECTOR4i_GET(input) input.value
+	#define RTM_IMPL_VECTOR4i_SET(input) vector4i{ input }
+#else
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of signed 32 bit integers.
+	//////////////////////////////////////////////////////////////////////////
+	using vector4i = int32x4_t;
+
+	// Helper macros to simplify usage
+	#define RTM_IMPL_VECTOR4i_GET(input) input
+	#define RTM_IMPL_VECTOR4i_SET(input) input
+#endif
 #else
 	//////////////////////////////////////////////////////////////////////////
 	// A quaternion (4D complex number) where the imaginary part is the [w] component.
@@ -266,6 +312,17 @@ namespace rtm
 		uint64_t z;
 		uint64_t w;
 	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of signed 32 bit integers.
+	//////////////////////////////////////////////////////////////////////////
+	struct alignas(16) vector4i
+	{
+		int32_t x;
+		int32_t y;
+		int32_t z;
+		int32_t w;
+	};
 #endif
 
 #if defined(RTM_SSE2_INTRINSICS)
@@ -373,6 +430,50 @@ namespace rtm
 		vector4d	scale;
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// A QVS transform represents a 3D rotation (quaternion), 3D translation (vector), and uniform scale (scalar).
+	// The scale is stored in the [w] component of the translation, the whole transform spans
+	// 2 registers. Unlike QVV transforms, negative scale needs no special handling since
+	// a uniform scale commutes with the rotation.
+	//////////////////////////////////////////////////////////////////////////
+	struct qvsf
+	{
+		quatf		rotation;
+		vector4f	translation_scale;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A QVS transform represents a 3D rotation (quaternion), 3D translation (vector), and uniform scale (scalar).
+	// The scale is stored in the [w] component of the translation.
+	//////////////////////////////////////////////////////////////////////////
+	struct qvsd
+	{
+		quatd		rotation;
+		vector4d	translation_scale;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A dual quaternion represents a 3D rigid transform: a rotation and a translation.
+	// The real part holds the rotation while the dual part holds half the translation
+	// multiplied with the rotation. Unlike matrices, blending them preserves volume.
+	//////////////////////////////////////////////////////////////////////////
+	struct dualquatf
+	{
+		quatf		real;
+		quatf		dual;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A dual quaternion represents a 3D rigid transform: a rotation and a translation.
+	// The real part holds the rotation while the dual part holds half the translation
+	// multiplied with the rotation. Unlike matrices, blending them preserves volume.
+	//////////////////////////////////////////////////////////////////////////
+	struct dualquatd
+	{
+		quatd		real;
+		quatd		dual;
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// A generic 3x3 matrix.
 	// Note: The [w] component of every column vector is undefined.
@@ -459,6 +560,129 @@ namespace rtm
 		vector4d	w_axis;
 	};
 
+#if defined(RTM_AVX_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// 8 lanes of a single component, used to process data stored as structure of arrays.
+	//////////////////////////////////////////////////////////////////////////
+	using vector8f = __m256;
+
+	//////////////////////////////////////////////////////////////////////////
+	// A 8x32 bit vector comparison mask for 32 bit floats: ~0 if true, 0 otherwise.
+	//////////////////////////////////////////////////////////////////////////
+	using mask8f = __m256;
+#else
+	//////////////////////////////////////////////////////////////////////////
+	// 8 lanes of a single component, used to process data stored as structure of arrays.
+	// Without AVX, both 4 lane halves are processed one after the other.
+	//////////////////////////////////////////////////////////////////////////
+	struct vector8f
+	{
+		vector4f	lo;
+		vector4f	hi;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A 8x32 bit vector comparison mask for 32 bit floats: ~0 if true, 0 otherwise.
+	// Without AVX, both 4 lane halves are processed one after the other.
+	//////////////////////////////////////////////////////////////////////////
+	struct mask8f
+	{
+		mask4f		lo;
+		mask4f		hi;
+	};
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// 8 3D vectors stored as structure of arrays: one vector8f per component.
+	//////////////////////////////////////////////////////////////////////////
+	struct vector3x8f
+	{
+		vector8f	x;
+		vector8f	y;
+		vector8f	z;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// 8 quaternions stored as structure of arrays: one vector8f per component.
+	//////////////////////////////////////////////////////////////////////////
+	//////////////////////////////////////////////////////////////////////////
+	// 8 4D vectors stored as structure of arrays: one vector8f per component.
+	//////////////////////////////////////////////////////////////////////////
+	struct vector4x8f
+	{
+		vector8f	x;
+		vector8f	y;
+		vector8f	z;
+		vector8f	w;
+	};
+
+	struct quat8f
+	{
+		vector8f	x;
+		vector8f	y;
+		vector8f	z;
+		vector8f	w;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// 8 4x4 matrices stored as structure of arrays: each axis holds the matching
+	// axis of every matrix, one vector8f per component.
+	//////////////////////////////////////////////////////////////////////////
+	struct matrix4x4x8f
+	{
+		vector4x8f	x_axis;
+		vector4x8f	y_axis;
+		vector4x8f	z_axis;
+		vector4x8f	w_axis;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A 4D vector of signed Q16.16 fixed point values: 16 integral bits and 16 fractional
+	// bits held in each 32 bit integer component. Every operation is done with integer
+	// arithmetic and returns the same bits on every platform, see rtm/vector4fx.h.
+	//////////////////////////////////////////////////////////////////////////
+	struct vector4fx
+	{
+		vector4i	value;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A quaternion of signed Q16.16 fixed point values, see rtm/quatfx.h.
+	//////////////////////////////////////////////////////////////////////////
+	struct quatfx
+	{
+		vector4i	value;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// An axis aligned bounding box stored as its center and its half extent along each axis.
+	// The [w] component of both vectors is unused.
+	//////////////////////////////////////////////////////////////////////////
+	struct aabbf
+	{
+		vector4f	center;
+		vector4f	extent;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A bounding sphere: the center is stored in [xyz] and the radius in [w].
+	//////////////////////////////////////////////////////////////////////////
+	struct spheref
+	{
+		vector4f	center_radius;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A view frustum made of 6 normalized planes: left, right, bottom, top, near, far.
+	// Each plane holds its normal in [xyz], pointing inside the frustum, and its
+	// distance from the origin in [w]. A point is inside a plane when
+	// dot3(point, plane) + plane.w >= 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	struct frustumf
+	{
+		vector4f	planes[6];
+	};
+
 	//////////////////////////////////////////////////////////////////////////
 	// Represents a component when mixing/shuffling/permuting vectors.
 	// [xyzw] are used to refer to the first input while [abcd] refer to the second input.
@@ -497,6 +721,178 @@ namespace rtm
 		w = 3,
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// Controls how batch functions write their output.
+	//////////////////////////////////////////////////////////////////////////
+	enum class store_mode
+	{
+		// Regular stores, the output remains in the cache hierarchy
+		cached,
+
+		// Non-temporal stores that bypass the cache. Use them when the output is
+		// large and will not be read back soon (e.g. it is uploaded to the GPU).
+		non_temporal,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Controls how batch normalization functions calculate the reciprocal length.
+	//////////////////////////////////////////////////////////////////////////
+	enum class normalize_precision
+	{
+		// Raw hardware reciprocal square root estimate: about 12 bits of precision
+		// with SSE and 8 bits with NEON. Falls back to 'exact' without SIMD.
+		estimate,
+
+		// Hardware estimate refined with a single Newton-Raphson iteration:
+		// about 22 bits of precision with SSE and 16 bits with NEON.
+		refined,
+
+		// Full precision square root followed by a division.
+		exact,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Controls how batch reductions sum their values.
+	//////////////////////////////////////////////////////////////////////////
+	enum class summation_precision
+	{
+		// Independent accumulators per SIMD lane: the error grows with the number of
+		// values divided by the number of accumulators.
+		fast,
+
+		// Blocks summed with the fast method and combined as a binary tree: the error
+		// grows with the logarithm of the number of values. Almost as fast.
+		pairwise,
+
+		// Compensated (Kahan) summation in every lane: the error does not depend on the
+		// number of values. About 3.5 times slower.
+		compensated,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Controls how batch functions average rotations.
+	//////////////////////////////////////////////////////////////////////////
+	enum class quat_average_precision
+	{
+		// Weighted sum of the rotations flipped onto the hemisphere of the first one,
+		// normalized. Close to the exact average when the rotations are within a few
+		// tens of degrees of each other.
+		fast,
+
+		// Eigenvector with the largest eigenvalue of the weighted sum of the outer
+		// products of the rotations, found with power iterations. It does not depend
+		// on the sign or the order of the rotations.
+		exact,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// The clip space depth range of a projection matrix.
+	//////////////////////////////////////////////////////////////////////////
+	enum class clip_depth_range
+	{
+		// Depth is in [0.0, w] (e.g. D3D, Vulkan, Metal)
+		zero_to_one,
+
+		// Depth is in [-w, w] (e.g. OpenGL)
+		minus_one_to_one,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Controls how trigonometric functions are evaluated by a precision policy.
+	//////////////////////////////////////////////////////////////////////////
+	enum class trigonometry_precision
+	{
+		// The lower degree polynomials of the *_fast variants (e.g. scalar_sin_fast).
+		fast,
+
+		// The regular float functions (e.g. scalar_sin).
+		standard,
+
+		// Evaluated in double precision and rounded back to float.
+		exact,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Controls how rotations are interpolated by a precision policy.
+	//////////////////////////////////////////////////////////////////////////
+	enum class rotation_interpolation
+	{
+		// Normalized linear interpolation, see quat_lerp.
+		lerp,
+
+		// Polynomial spherical interpolation, see quat_slerp_fast.
+		slerp_fast,
+
+		// Spherical interpolation, see quat_slerp.
+		slerp,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// The order in which depth sort keys sort their positions when sorted in increasing order.
+	//////////////////////////////////////////////////////////////////////////
+	enum class depth_sort_order
+	{
+		// The nearest positions first (e.g. opaque geometry).
+		front_to_back,
+
+		// The farthest positions first (e.g. transparent geometry).
+		back_to_front,
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Precision policies select at compile time the speed/accuracy trade-off of
+	// the functions that accept them as their last argument, e.g.:
+	//     quat_normalize(rotation, precision::fast())
+	// A pipeline templated on its policy is specialized as a whole without runtime branches.
+	// Custom policies can derive from precision::policy and define the same members.
+	//////////////////////////////////////////////////////////////////////////
+	namespace precision
+	{
+		struct policy {};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Favors throughput: a single Newton-Raphson iteration on the reciprocal square root
+		// estimate, the *_fast trigonometric polynomials, and normalized linear interpolation.
+		//////////////////////////////////////////////////////////////////////////
+		struct fast : policy
+		{
+			static constexpr normalize_precision normalize = normalize_precision::refined;
+			static constexpr trigonometry_precision trigonometry = trigonometry_precision::fast;
+			static constexpr rotation_interpolation interpolation = rotation_interpolation::lerp;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// The default trade-off: full precision normalization, the regular trigonometric
+		// functions, and polynomial spherical interpolation.
+		//////////////////////////////////////////////////////////////////////////
+		struct standard : policy
+		{
+			static constexpr normalize_precision normalize = normalize_precision::exact;
+			static constexpr trigonometry_precision trigonometry = trigonometry_precision::standard;
+			static constexpr rotation_interpolation interpolation = rotation_interpolation::slerp_fast;
+		};
+
+		//////////////////////////////////////////////////////////////////////////
+		// Favors accuracy: full precision normalization, trigonometric functions
+		// evaluated in double precision, and spherical interpolation.
+		//////////////////////////////////////////////////////////////////////////
+		struct exact : policy
+		{
+			static constexpr normalize_precision normalize = normalize_precision::exact;
+			static constexpr trigonometry_precision trigonometry = trigonometry_precision::exact;
+			static constexpr rotation_interpolation interpolation = rotation_interpolation::slerp;
+		};
+	}
+
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Restricts the policy overloads to precision policies, used as a defaulted template argument.
+		//////////////////////////////////////////////////////////////////////////
+		template<typename precision_policy>
+		using enable_if_precision_policy = typename std::enable_if<std::is_base_of<precision::policy, precision_policy>::value, int>::type;
+	}
+
 
 	//////////////////////////////////////////////////////////////////////////
 	// Various unaligned types suitable for interop. with GPUs, etc.
@@ -524,6 +920,40 @@ namespace rtm
 		float w;
 	};
 
+	//////////////////////////////////////////////////////////////////////////
+	// A 3x4 affine matrix transposed into 3 rows of 4 floats (48 bytes), the layout
+	// GPU skinning palettes commonly expect. Each row holds one component of the
+	// matrix3x4f axes: x_row = [x_axis.x, y_axis.x, z_axis.x, w_axis.x] and so on.
+	//////////////////////////////////////////////////////////////////////////
+	struct float3x4f
+	{
+		float4f x_row;
+		float4f y_row;
+		float4f z_row;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A QVV transform stored without the SIMD padding (40 bytes instead of 48).
+	// Use it to shrink large pose buffers, qvv_load_packed converts it back.
+	//////////////////////////////////////////////////////////////////////////
+	struct qvvf_packed
+	{
+		float4f rotation;
+		float3f translation;
+		float3f scale;
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// A QVV transform with uniform scale stored without the SIMD padding (32 bytes).
+	// The scale follows the translation, the whole transform spans 2 SIMD registers.
+	//////////////////////////////////////////////////////////////////////////
+	struct qvvf_packed_uniform_scale
+	{
+		float4f rotation;
+		float3f translation;
+		float scale;
+	};
+
 	struct float2d
 	{
 		double x;
@@ -544,6 +974,65 @@ namespace rtm
 		double z;
 		double w;
 	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// Structure of arrays views: one pointer per component stream.
+	// These do not own their memory, each stream must hold as many entries
+	// as the operation consuming them requires.
+	//////////////////////////////////////////////////////////////////////////
+
+	struct const_float3f_soa
+	{
+		const float* x;
+		const float* y;
+		const float* z;
+	};
+
+	struct float3f_soa
+	{
+		float* x;
+		float* y;
+		float* z;
+
+		constexpr operator const_float3f_soa() const RTM_NO_EXCEPT { return const_float3f_soa{ x, y, z }; }
+	};
+
+	struct const_float4f_soa
+	{
+		const float* x;
+		const float* y;
+		const float* z;
+		const float* w;
+	};
+
+	struct float4f_soa
+	{
+		float* x;
+		float* y;
+		float* z;
+		float* w;
+
+		constexpr operator const_float4f_soa() const RTM_NO_EXCEPT { return const_float4f_soa{ x, y, z, w }; }
+	};
+
+	//////////////////////////////////////////////////////////////////////////
+	// QVV transforms stored as structure of arrays: one stream per component.
+	//////////////////////////////////////////////////////////////////////////
+	struct const_qvvf_soa
+	{
+		const_float4f_soa rotation;
+		const_float3f_soa translation;
+		const_float3f_soa scale;
+	};
+
+	struct qvvf_soa
+	{
+		float4f_soa rotation;
+		float3f_soa translation;
+		float3f_soa scale;
+
+		constexpr operator const_qvvf_soa() const RTM_NO_EXCEPT { return const_qvvf_soa{ rotation, translation, scale }; }
+	};
 }
 
 // Always include the register passing typedefs
@@ -45,7 +45,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_load(const double* input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_loadu_pd(input);
+#else
 		return vector_set(input[0], input[1], input[2], input[3]);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -101,7 +105,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_broadcast(const double* input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_broadcast_sd(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		const __m128d value = _mm_load1_pd(input);
 		return vector4d{ value, value };
 #else
@@ -114,7 +120,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d quat_to_vector(const quatd& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return input;
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ input.xy, input.zw };
 #else
 		return vector4d{ input.x, input.y, input.z, input.w };
@@ -126,7 +134,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_cast(const vector4f& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cvtps_pd(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_cvtps_pd(input), _mm_cvtps_pd(_mm_shuffle_ps(input, input, _MM_SHUFFLE(3, 2, 3, 2))) };
 #elif defined(RTM_NEON_INTRINSICS)
 		return vector4d{ double(vgetq_lane_f32(input, 0)), double(vgetq_lane_f32(input, 1)), double(vgetq_lane_f32(input, 2)), double(vgetq_lane_f32(input, 3)) };
@@ -147,7 +157,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm256_castpd256_pd128(input));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(input.xy);
 #else
 				return input.x;
@@ -157,7 +169,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm256_castpd256_pd128(input) };
+#else
 				return scalard{ input.xy };
+#endif
 			}
 #endif
 
@@ -185,7 +201,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm_permute_pd(_mm256_castpd256_pd128(input), 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(_mm_shuffle_pd(input.xy, input.xy, 1));
 #else
 				return input.y;
@@ -195,7 +213,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm_permute_pd(_mm256_castpd256_pd128(input), 1) };
+#else
 				return scalard{ _mm_shuffle_pd(input.xy, input.xy, 1) };
+#endif
 			}
 #endif
 
@@ -223,7 +245,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm256_extractf128_pd(input, 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(input.zw);
 #else
 				return input.z;
@@ -233,7 +257,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm256_extractf128_pd(input, 1) };
+#else
 				return scalard{ input.zw };
+#endif
 			}
 #endif
 
@@ -261,7 +289,9 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				return _mm_cvtsd_f64(_mm_permute_pd(_mm256_extractf128_pd(input, 1), 1));
+#elif defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtsd_f64(_mm_shuffle_pd(input.zw, input.zw, 1));
 #else
 				return input.w;
@@ -271,7 +301,11 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				return scalard{ _mm_permute_pd(_mm256_extractf128_pd(input, 1), 1) };
+#else
 				return scalard{ _mm_shuffle_pd(input.zw, input.zw, 1) };
+#endif
 			}
 #endif
 
@@ -412,7 +446,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set_x(const vector4d& input, double lane_value) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_set1_pd(lane_value), 1);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_move_sd(input.xy, _mm_set_sd(lane_value)), input.zw };
 #else
 		return vector4d{ lane_value, input.y, input.z, input.w };
@@ -425,7 +461,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set_x(const vector4d& input, const scalard& lane_value) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_castpd128_pd256(lane_value.value), 1);
+#else
 		return vector4d{ _mm_move_sd(input.xy, lane_value.value), input.zw };
+#endif
 	}
 #endif
 
@@ -434,7 +474,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set_y(const vector4d& input, double lane_value) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_set1_pd(lane_value), 2);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_shuffle_pd(input.xy, _mm_set_sd(lane_value), 0), input.zw };
 #else
 		return vector4d{ input.x, lane_value, input.z, input.w };
@@ -447,7 +489,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set_y(const vector4d& input, const scalard& lane_value) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_castpd128_pd256(_mm_shuffle_pd(lane_value.value, lane_value.value, 0)), 2);
+#else
 		return vector4d{ _mm_shuffle_pd(input.xy, lane_value.value, 0), input.zw };
+#endif
 	}
 #endif
 
@@ -456,7 +502,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set_z(const vector4d& input, double lane_value) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_set1_pd(lane_value), 4);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ input.xy, _mm_move_sd(input.zw, _mm_set_sd(lane_value)) };
 #else
 		return vector4d{ input.x, input.y, lane_value, input.w };
@@ -469,7 +517,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set_z(const vector4d& input, const scalard& lane_value) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(input, _mm_move_sd(_mm256_extractf128_pd(input, 1), lane_value.value), 1);
+#else
 		return vector4d{ input.xy, _mm_move_sd(input.zw, lane_value.value) };
+#endif
 	}
 #endif
 
@@ -478,7 +530,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set_w(const vector4d& input, double lane_value) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blend_pd(input, _mm256_set1_pd(lane_value), 8);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ input.xy, _mm_shuffle_pd(input.zw, _mm_set_sd(lane_value), 0) };
 #else
 		return vector4d{ input.x, input.y, input.z, lane_value };
@@ -491,7 +545,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_set_w(const vector4d& input, const scalard& lane_value) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_pd(input, _mm_shuffle_pd(_mm256_extractf128_pd(input, 1), lane_value.value, 0), 1);
+#else
 		return vector4d{ input.xy, _mm_shuffle_pd(input.zw, lane_value.value, 0) };
+#endif
 	}
 #endif
 
@@ -508,10 +566,14 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline void vector_store(const vector4d& input, double* output) RTM_NO_EXCEPT
 	{
+#if defined(RTM_AVX_INTRINSICS)
+		_mm256_storeu_pd(output, input);
+#else
 		output[0] = vector_get_x(input);
 		output[1] = vector_get_y(input);
 		output[2] = vector_get_z(input);
 		output[3] = vector_get_w(input);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -615,7 +677,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_add(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_add_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_add_pd(lhs.xy, rhs.xy), _mm_add_pd(lhs.zw, rhs.zw) };
 #else
 		return vector_set(lhs.x + rhs.x, lhs.y + rhs.y, lhs.z + rhs.z, lhs.w + rhs.w);
@@ -627,7 +691,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_sub(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sub_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_sub_pd(lhs.xy, rhs.xy), _mm_sub_pd(lhs.zw, rhs.zw) };
 #else
 		return vector_set(lhs.x - rhs.x, lhs.y - rhs.y, lhs.z - rhs.z, lhs.w - rhs.w);
@@ -639,7 +705,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_mul(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_mul_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_mul_pd(lhs.xy, rhs.xy), _mm_mul_pd(lhs.zw, rhs.zw) };
 #else
 		return vector_set(lhs.x * rhs.x, lhs.y * rhs.y, lhs.z * rhs.z, lhs.w * rhs.w);
@@ -661,7 +729,11 @@ namespace rtm
 	inline vector4d vector_mul(const vector4d& lhs, const scalard& rhs) RTM_NO_EXCEPT
 	{
 		const __m128d rhs_xx = _mm_shuffle_pd(rhs.value, rhs.value, 0);
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_mul_pd(lhs, _mm256_insertf128_pd(_mm256_castpd128_pd256(rhs_xx), rhs_xx, 1));
+#else
 		return vector4d{ _mm_mul_pd(lhs.xy, rhs_xx), _mm_mul_pd(lhs.zw, rhs_xx) };
+#endif
 	}
 #endif
 
@@ -670,7 +742,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_div(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_div_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_div_pd(lhs.xy, rhs.xy), _mm_div_pd(lhs.zw, rhs.zw) };
 #else
 		return vector_set(lhs.x / rhs.x, lhs.y / rhs.y, lhs.z / rhs.z, lhs.w / rhs.w);
@@ -682,7 +756,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_max(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_max_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_max_pd(lhs.xy, rhs.xy), _mm_max_pd(lhs.zw, rhs.zw) };
 #else
 		return vector_set(scalar_max(lhs.x, rhs.x), scalar_max(lhs.y, rhs.y), scalar_max(lhs.z, rhs.z), scalar_max(lhs.w, rhs.w));
@@ -694,7 +770,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_min(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_min_pd(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_min_pd(lhs.xy, rhs.xy), _mm_min_pd(lhs.zw, rhs.zw) };
 #else
 		return vector_set(scalar_min(lhs.x, rhs.x), scalar_min(lhs.y, rhs.y), scalar_min(lhs.z, rhs.z), scalar_min(lhs.w, rhs.w));
@@ -714,7 +792,10 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_abs(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFULL));
+		return _mm256_and_pd(input, abs_mask);
+#elif defined(RTM_SSE2_INTRINSICS)
 		vector4d zero{ _mm_setzero_pd(), _mm_setzero_pd() };
 		return vector_max(vector_sub(zero, input), input);
 #else
@@ -743,7 +824,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_sqrt(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sqrt_pd(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return vector4d{ _mm_sqrt_pd(input.xy), _mm_sqrt_pd(input.zw) };
 #else
 		scalard x = vector_get_x(input);
@@ -754,13 +837,23 @@ namespace rtm
 #endif
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Per component reciprocal square root of the input: 1.0 / sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_sqrt_reciprocal(const vector4d& input) RTM_NO_EXCEPT
+	{
+		return vector_reciprocal(vector_sqrt(input));
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Per component returns the smallest integer value not less than the input (round towards positive infinity).
 	// vector_ceil([1.8, 1.0, -1.8, -1.0]) = [2.0, 1.0, -1.0, -1.0]
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_ceil(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_ceil_pd(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		// NaN, +- Infinity, and numbers larger or equal to 2^23 remain unchanged
 		// since they have no fractional part.
 
@@ -818,7 +911,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_floor(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE4_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_floor_pd(input);
+#elif defined(RTM_SSE4_INTRINSICS)
 		return vector4d{ _mm_floor_pd(input.xy), _mm_floor_pd(input.zw) };
 #elif defined(RTM_SSE2_INTRINSICS)
 		// NaN, +- Infinity, and numbers larger or equal to 2^23 remain unchanged
@@ -899,6 +994,12 @@ namespace rtm
 		{
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				const __m256d x2_y2_z2_w2 = _mm256_mul_pd(lhs, rhs);
+				const __m128d x2z2_y2w2 = _mm_add_pd(_mm256_castpd256_pd128(x2_y2_z2_w2), _mm256_extractf128_pd(x2_y2_z2_w2, 1));
+				const __m128d y2w2 = _mm_unpackhi_pd(x2z2_y2w2, x2z2_y2w2);
+				return _mm_cvtsd_f64(_mm_add_sd(x2z2_y2w2, y2w2));
+#else
 				const scalard lhs_x = vector_get_x(lhs);
 				const scalard lhs_y = vector_get_y(lhs);
 				const scalard lhs_z = vector_get_z(lhs);
@@ -912,11 +1013,18 @@ namespace rtm
 				const scalard zz = scalar_mul(lhs_z, rhs_z);
 				const scalard ww = scalar_mul(lhs_w, rhs_w);
 				return scalar_cast(scalar_add(scalar_add(xx, yy), scalar_add(zz, ww)));
+#endif
 			}
 
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				const __m256d x2_y2_z2_w2 = _mm256_mul_pd(lhs, rhs);
+				const __m128d x2z2_y2w2 = _mm_add_pd(_mm256_castpd256_pd128(x2_y2_z2_w2), _mm256_extractf128_pd(x2_y2_z2_w2, 1));
+				const __m128d y2w2 = _mm_unpackhi_pd(x2z2_y2w2, x2z2_y2w2);
+				return scalard{ _mm_add_sd(x2z2_y2w2, y2w2) };
+#else
 				const scalard lhs_x = vector_get_x(lhs);
 				const scalard lhs_y = vector_get_y(lhs);
 				const scalard lhs_z = vector_get_z(lhs);
@@ -930,13 +1038,22 @@ namespace rtm
 				const scalard zz = scalar_mul(lhs_z, rhs_z);
 				const scalard ww = scalar_mul(lhs_w, rhs_w);
 				return scalar_add(scalar_add(xx, yy), scalar_add(zz, ww));
+#endif
 			}
 #endif
 
 			inline RTM_SIMD_CALL operator vector4d() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				const __m256d x2_y2_z2_w2 = _mm256_mul_pd(lhs, rhs);
+				const __m256d z2_w2_x2_y2 = _mm256_permute2f128_pd(x2_y2_z2_w2, x2_y2_z2_w2, 0x01);
+				const __m256d x2z2_y2w2_x2z2_y2w2 = _mm256_add_pd(x2_y2_z2_w2, z2_w2_x2_y2);
+				const __m256d y2w2_x2z2_y2w2_x2z2 = _mm256_permute_pd(x2z2_y2w2_x2z2_y2w2, 0x5);
+				return _mm256_add_pd(x2z2_y2w2_x2z2_y2w2, y2w2_x2z2_y2w2_x2z2);
+#else
 				const scalard dot = *this;
 				return vector_set(dot);
+#endif
 			}
 
 			vector4d lhs;
@@ -984,8 +1101,14 @@ namespace rtm
 			inline RTM_SIMD_CALL operator double() const RTM_NO_EXCEPT
 			{
 #if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+				const __m256d x2_y2_z2_w2 = _mm256_mul_pd(lhs, rhs);
+				__m128d x2_y2 = _mm256_castpd256_pd128(x2_y2_z2_w2);
+				__m128d z2_w2 = _mm256_extractf128_pd(x2_y2_z2_w2, 1);
+#else
 				__m128d x2_y2 = _mm_mul_pd(lhs.xy, rhs.xy);
 				__m128d z2_w2 = _mm_mul_pd(lhs.zw, rhs.zw);
+#endif
 				__m128d y2 = _mm_shuffle_pd(x2_y2, x2_y2, 1);
 				__m128d x2y2 = _mm_add_sd(x2_y2, y2);
 				return _mm_cvtsd_f64(_mm_add_sd(x2y2, z2_w2));
@@ -997,8 +1120,14 @@ namespace rtm
 #if defined(RTM_SSE2_INTRINSICS)
 			inline RTM_SIMD_CALL operator scalard() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_AVX_INTRINSICS)
+				const __m256d x2_y2_z2_w2 = _mm256_mul_pd(lhs, rhs);
+				__m128d x2_y2 = _mm256_castpd256_pd128(x2_y2_z2_w2);
+				__m128d z2_w2 = _mm256_extractf128_pd(x2_y2_z2_w2, 1);
+#else
 				__m128d x2_y2 = _mm_mul_pd(lhs.xy, rhs.xy);
 				__m128d z2_w2 = _mm_mul_pd(lhs.zw, rhs.zw);
+#endif
 				__m128d y2 = _mm_shuffle_pd(x2_y2, x2_y2, 1);
 				__m128d x2y2 = _mm_add_sd(x2_y2, y2);
 				return scalard{ _mm_add_sd(x2y2, z2_w2) };
@@ -1036,6 +1165,40 @@ namespace rtm
 
 	namespace rtm_impl
 	{
+		//////////////////////////////////////////////////////////////////////////
+		// Compares a length with a threshold through its squared value: length < threshold.
+		// A length is never negative which allows us to skip the square root while returning
+		// the same result for negative, infinite, and NaN thresholds or lengths.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool length_squared_less_than(double len_sq, double threshold) RTM_NO_EXCEPT
+		{
+			return threshold > 0.0 && len_sq < (threshold * threshold);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compares a length with a threshold through its squared value: length <= threshold.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool length_squared_less_equal(double len_sq, double threshold) RTM_NO_EXCEPT
+		{
+			return threshold >= 0.0 && len_sq <= (threshold * threshold);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compares a length with a threshold through its squared value: length > threshold.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool length_squared_greater_than(double len_sq, double threshold) RTM_NO_EXCEPT
+		{
+			return threshold < 0.0 ? (len_sq >= 0.0) : (len_sq > (threshold * threshold));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compares a length with a threshold through its squared value: length >= threshold.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool length_squared_greater_equal(double len_sq, double threshold) RTM_NO_EXCEPT
+		{
+			return threshold <= 0.0 ? (len_sq >= 0.0) : (len_sq >= (threshold * threshold));
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// This is a helper struct to allow a single consistent API between
 		// various vector types when the semantics are identical but the return
@@ -1058,8 +1221,59 @@ namespace rtm
 			}
 #endif
 
+			//////////////////////////////////////////////////////////////////////////
+			// Comparisons against a threshold use the squared length and skip the square root.
+			//////////////////////////////////////////////////////////////////////////
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_less_than(vector_length_squared(input), double(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<=(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_less_equal(vector_length_squared(input), double(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_greater_than(vector_length_squared(input), double(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>=(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_greater_equal(vector_length_squared(input), double(threshold));
+			}
+
 			vector4d input;
 		};
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<(threshold_type threshold, const vector4d_vector_length& length) RTM_NO_EXCEPT
+		{
+			return length > threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<=(threshold_type threshold, const vector4d_vector_length& length) RTM_NO_EXCEPT
+		{
+			return length >= threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>(threshold_type threshold, const vector4d_vector_length& length) RTM_NO_EXCEPT
+		{
+			return length < threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>=(threshold_type threshold, const vector4d_vector_length& length) RTM_NO_EXCEPT
+		{
+			return length <= threshold;
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1094,8 +1308,59 @@ namespace rtm
 			}
 #endif
 
+			//////////////////////////////////////////////////////////////////////////
+			// Comparisons against a threshold use the squared length and skip the square root.
+			//////////////////////////////////////////////////////////////////////////
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_less_than(vector_length_squared3(input), double(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<=(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_less_equal(vector_length_squared3(input), double(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_greater_than(vector_length_squared3(input), double(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>=(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_greater_equal(vector_length_squared3(input), double(threshold));
+			}
+
 			vector4d input;
 		};
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<(threshold_type threshold, const vector4d_vector_length3& length) RTM_NO_EXCEPT
+		{
+			return length > threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<=(threshold_type threshold, const vector4d_vector_length3& length) RTM_NO_EXCEPT
+		{
+			return length >= threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>(threshold_type threshold, const vector4d_vector_length3& length) RTM_NO_EXCEPT
+		{
+			return length < threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>=(threshold_type threshold, const vector4d_vector_length3& length) RTM_NO_EXCEPT
+		{
+			return length <= threshold;
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1187,6 +1452,16 @@ namespace rtm
 		return rtm_impl::vector4d_vector_length3{ difference };
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the squared distance between two 3D points.
+	// Prefer comparing squared distances over distances to skip the square root.
+	//////////////////////////////////////////////////////////////////////////
+	inline rtm_impl::vector4d_vector_dot3 vector_distance_squared3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
+	{
+		const vector4d difference = vector_sub(lhs, rhs);
+		return rtm_impl::vector4d_vector_dot3{ difference, difference };
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns a normalized vector3.
 	// If the length of the input is not finite or zero, the result is undefined.
@@ -1214,6 +1489,26 @@ namespace rtm
 			return fallback;
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized vector3 only if it isn't already normalized.
+	// If the squared length of the input is within 'normalized_threshold' of 1.0,
+	// the input is returned unchanged which skips the reciprocal square root.
+	// If the length of the input is below the supplied threshold, the
+	// fall back value is returned instead.
+	// The squared length is calculated only once.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_normalize3_if_needed(const vector4d& input, const vector4d& fallback, double threshold = 1.0E-8, double normalized_threshold = 0.00001) RTM_NO_EXCEPT
+	{
+		const scalard len_sq = vector_length_squared3(input);
+		const double len_sq_value = scalar_cast(len_sq);
+		if (scalar_abs(len_sq_value - 1.0) < normalized_threshold)
+			return input;
+		else if (len_sq_value >= threshold)
+			return vector_mul(input, scalar_sqrt_reciprocal(len_sq));
+		else
+			return fallback;
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component the fractional part of the input.
 	//////////////////////////////////////////////////////////////////////////
@@ -1227,7 +1522,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_mul_add(const vector4d& v0, const vector4d& v1, const vector4d& v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm256_fmadd_pd(v0, v1, v2);
+#else
 		return vector_add(vector_mul(v0, v1), v2);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1235,7 +1534,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_mul_add(const vector4d& v0, double s1, const vector4d& v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm256_fmadd_pd(v0, _mm256_set1_pd(s1), v2);
+#else
 		return vector_add(vector_mul(v0, s1), v2);
+#endif
 	}
 
 #if defined(RTM_SSE2_INTRINSICS)
@@ -1244,7 +1547,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_mul_add(const vector4d& v0, const scalard& s1, const vector4d& v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm256_fmadd_pd(v0, _mm256_broadcastsd_pd(s1.value), v2);
+#else
 		return vector_add(vector_mul(v0, s1), v2);
+#endif
 	}
 #endif
 
@@ -1254,7 +1561,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_neg_mul_sub(const vector4d& v0, const vector4d& v1, const vector4d& v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm256_fnmadd_pd(v0, v1, v2);
+#else
 		return vector_sub(v2, vector_mul(v0, v1));
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1263,7 +1574,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_neg_mul_sub(const vector4d& v0, double s1, const vector4d& v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm256_fnmadd_pd(v0, _mm256_set1_pd(s1), v2);
+#else
 		return vector_sub(v2, vector_mul(v0, s1));
+#endif
 	}
 
 #if defined(RTM_SSE2_INTRINSICS)
@@ -1273,7 +1588,11 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_neg_mul_sub(const vector4d& v0, const scalard& s1, const vector4d& v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm256_fnmadd_pd(v0, _mm256_broadcastsd_pd(s1.value), v2);
+#else
 		return vector_sub(v2, vector_mul(v0, s1));
+#endif
 	}
 #endif
 
@@ -1306,6 +1625,17 @@ namespace rtm
 	}
 #endif
 
+	//////////////////////////////////////////////////////////////////////////
+	// Per component linear interpolation of the two inputs at the specified per component alpha.
+	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
+	// Interpolation is stable and will return 'start' when alpha is 0.0 and 'end' when it is 1.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_lerp(const vector4d& start, const vector4d& end, const vector4d& alpha) RTM_NO_EXCEPT
+	{
+		// ((1.0 - alpha) * start) + (alpha * end) == (start - alpha * start) + (alpha * end)
+		return vector_mul_add(end, alpha, vector_neg_mul_sub(start, alpha, start));
+	}
+
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1318,7 +1648,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline mask4d vector_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_pd(lhs, rhs, _CMP_EQ_OQ);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmpeq_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmpeq_pd(lhs.zw, rhs.zw);
 		return mask4d{ xy_lt_pd, zw_lt_pd };
@@ -1332,7 +1664,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline mask4d vector_less_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return mask4d{xy_lt_pd, zw_lt_pd};
@@ -1346,7 +1680,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline mask4d vector_less_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return mask4d{ xy_lt_pd, zw_lt_pd };
@@ -1360,7 +1696,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline mask4d vector_greater_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return mask4d{ xy_ge_pd, zw_ge_pd };
@@ -1374,7 +1712,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline mask4d vector_greater_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return mask4d{ xy_ge_pd, zw_ge_pd };
@@ -1388,7 +1728,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_less_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_lt_pd) & _mm_movemask_pd(zw_lt_pd)) == 3;
@@ -1402,7 +1744,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_less_than2(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) & 0x3) == 0x3;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_lt_pd) == 3;
 #else
@@ -1415,7 +1759,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_less_than3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_lt_pd) == 3 && (_mm_movemask_pd(zw_lt_pd) & 1) == 1;
@@ -1429,7 +1775,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_less_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_lt_pd) | _mm_movemask_pd(zw_lt_pd)) != 0;
@@ -1443,7 +1791,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_less_than2(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) & 0x3) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_lt_pd) != 0;
 #else
@@ -1456,7 +1806,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_less_than3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LT_OQ)) & 0x7) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_lt_pd = _mm_cmplt_pd(lhs.xy, rhs.xy);
 		__m128d zw_lt_pd = _mm_cmplt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_lt_pd) != 0 || (_mm_movemask_pd(zw_lt_pd) & 0x1) != 0;
@@ -1470,7 +1822,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_less_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_le_pd) & _mm_movemask_pd(zw_le_pd)) == 3;
@@ -1484,7 +1838,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_less_equal2(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) & 0x3) == 0x3;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_le_pd) == 3;
 #else
@@ -1497,7 +1853,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_less_equal3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_le_pd) == 3 && (_mm_movemask_pd(zw_le_pd) & 1) != 0;
@@ -1511,7 +1869,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_less_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_le_pd) | _mm_movemask_pd(zw_le_pd)) != 0;
@@ -1525,7 +1885,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_less_equal2(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) & 0x3) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_le_pd) != 0;
 #else
@@ -1538,7 +1900,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_less_equal3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_LE_OQ)) & 0x7) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_le_pd = _mm_cmple_pd(lhs.xy, rhs.xy);
 		__m128d zw_le_pd = _mm_cmple_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_le_pd) != 0 || (_mm_movemask_pd(zw_le_pd) & 1) != 0;
@@ -1552,7 +1916,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_greater_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ)) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) & _mm_movemask_pd(zw_ge_pd)) == 3;
@@ -1566,7 +1932,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_greater_than2(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ)) & 0x3) == 0x3;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_ge_pd) == 3;
 #else
@@ -1579,7 +1947,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_greater_than3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ)) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) == 3 && (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
@@ -1593,7 +1963,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_greater_than(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ)) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) | _mm_movemask_pd(zw_ge_pd)) != 0;
@@ -1607,7 +1979,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_greater_than2(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ)) & 0x3) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_ge_pd) != 0;
 #else
@@ -1620,7 +1994,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_greater_than3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GT_OQ)) & 0x7) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpgt_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpgt_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) != 0 || (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
@@ -1634,7 +2010,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_greater_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) & _mm_movemask_pd(zw_ge_pd)) == 3;
@@ -1648,7 +2026,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_greater_equal2(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) & 0x3) == 0x3;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_ge_pd) == 3;
 #else
@@ -1661,7 +2041,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_all_greater_equal3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) == 3 && (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
@@ -1675,7 +2057,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_greater_equal(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return (_mm_movemask_pd(xy_ge_pd) | _mm_movemask_pd(zw_ge_pd)) != 0;
@@ -1689,7 +2073,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_greater_equal2(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) & 0x3) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		return _mm_movemask_pd(xy_ge_pd) != 0;
 #else
@@ -1702,7 +2088,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_any_greater_equal3(const vector4d& lhs, const vector4d& rhs) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return (_mm256_movemask_pd(_mm256_cmp_pd(lhs, rhs, _CMP_GE_OQ)) & 0x7) != 0;
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy_ge_pd = _mm_cmpge_pd(lhs.xy, rhs.xy);
 		__m128d zw_ge_pd = _mm_cmpge_pd(lhs.zw, rhs.zw);
 		return _mm_movemask_pd(xy_ge_pd) != 0 || (_mm_movemask_pd(zw_ge_pd) & 1) != 0;
@@ -1764,7 +2152,13 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_is_finite(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		// A finite value is ordered and smaller than infinity in absolute value
+		const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFULL));
+		const __m256d abs_input = _mm256_and_pd(input, abs_mask);
+		const __m256d is_finite = _mm256_cmp_pd(abs_input, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_LT_OQ);
+		return _mm256_movemask_pd(is_finite) == 0xF;
+#elif defined(RTM_SSE2_INTRINSICS)
 		const __m128i abs_mask = _mm_set_epi64x(0x7FFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL);
 		__m128d abs_input_xy = _mm_and_pd(input.xy, _mm_castsi128_pd(abs_mask));
 		__m128d abs_input_zw = _mm_and_pd(input.zw, _mm_castsi128_pd(abs_mask));
@@ -1790,7 +2184,13 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_is_finite2(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		// A finite value is ordered and smaller than infinity in absolute value
+		const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFULL));
+		const __m256d abs_input = _mm256_and_pd(input, abs_mask);
+		const __m256d is_finite = _mm256_cmp_pd(abs_input, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_LT_OQ);
+		return (_mm256_movemask_pd(is_finite) & 0x3) == 0x3;
+#elif defined(RTM_SSE2_INTRINSICS)
 		const __m128i abs_mask = _mm_set_epi64x(0x7FFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL);
 		__m128d abs_input_xy = _mm_and_pd(input.xy, _mm_castsi128_pd(abs_mask));
 
@@ -1811,7 +2211,13 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline bool vector_is_finite3(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		// A finite value is ordered and smaller than infinity in absolute value
+		const __m256d abs_mask = _mm256_castsi256_pd(_mm256_set1_epi64x(0x7FFFFFFFFFFFFFFFULL));
+		const __m256d abs_input = _mm256_and_pd(input, abs_mask);
+		const __m256d is_finite = _mm256_cmp_pd(abs_input, _mm256_set1_pd(std::numeric_limits<double>::infinity()), _CMP_LT_OQ);
+		return (_mm256_movemask_pd(is_finite) & 0x7) == 0x7;
+#elif defined(RTM_SSE2_INTRINSICS)
 		const __m128i abs_mask = _mm_set_epi64x(0x7FFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL);
 		__m128d abs_input_xy = _mm_and_pd(input.xy, _mm_castsi128_pd(abs_mask));
 		__m128d abs_input_zw = _mm_and_pd(input.zw, _mm_castsi128_pd(abs_mask));
@@ -1843,7 +2249,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_select(const mask4d& mask, const vector4d& if_true, const vector4d& if_false) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blendv_pd(if_false, if_true, mask);
+#elif defined(RTM_SSE2_INTRINSICS)
 		__m128d xy = _mm_or_pd(_mm_andnot_pd(mask.xy, if_false.xy), _mm_and_pd(if_true.xy, mask.xy));
 		__m128d zw = _mm_or_pd(_mm_andnot_pd(mask.zw, if_false.zw), _mm_and_pd(if_true.zw, mask.zw));
 		return vector4d{ xy, zw };
@@ -1870,22 +2278,59 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [x] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dup_x(const vector4d& input) RTM_NO_EXCEPT { return vector_mix<mix4::x, mix4::x, mix4::x, mix4::x>(input, input); }
+	inline vector4d vector_dup_x(const vector4d& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX2_INTRINSICS)
+		return _mm256_permute4x64_pd(input, 0x00);
+#elif defined(RTM_AVX_INTRINSICS)
+		// Without a cross lane permute, broadcasting from memory is cheaper than two shuffles
+		return _mm256_broadcast_sd(reinterpret_cast<const double*>(&input) + 0);
+#else
+		return vector_mix<mix4::x, mix4::x, mix4::x, mix4::x>(input, input);
+#endif
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [y] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dup_y(const vector4d& input) RTM_NO_EXCEPT { return vector_mix<mix4::y, mix4::y, mix4::y, mix4::y>(input, input); }
+	inline vector4d vector_dup_y(const vector4d& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX2_INTRINSICS)
+		return _mm256_permute4x64_pd(input, 0x55);
+#elif defined(RTM_AVX_INTRINSICS)
+		return _mm256_broadcast_sd(reinterpret_cast<const double*>(&input) + 1);
+#else
+		return vector_mix<mix4::y, mix4::y, mix4::y, mix4::y>(input, input);
+#endif
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [z] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dup_z(const vector4d& input) RTM_NO_EXCEPT { return vector_mix<mix4::z, mix4::z, mix4::z, mix4::z>(input, input); }
+	inline vector4d vector_dup_z(const vector4d& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX2_INTRINSICS)
+		return _mm256_permute4x64_pd(input, 0xAA);
+#elif defined(RTM_AVX_INTRINSICS)
+		return _mm256_broadcast_sd(reinterpret_cast<const double*>(&input) + 2);
+#else
+		return vector_mix<mix4::z, mix4::z, mix4::z, mix4::z>(input, input);
+#endif
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [w] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4d vector_dup_w(const vector4d& input) RTM_NO_EXCEPT { return vector_mix<mix4::w, mix4::w, mix4::w, mix4::w>(input, input); }
+	inline vector4d vector_dup_w(const vector4d& input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX2_INTRINSICS)
+		return _mm256_permute4x64_pd(input, 0xFF);
+#elif defined(RTM_AVX_INTRINSICS)
+		return _mm256_broadcast_sd(reinterpret_cast<const double*>(&input) + 3);
+#else
+		return vector_mix<mix4::w, mix4::w, mix4::w, mix4::w>(input, input);
+#endif
+	}
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1907,7 +2352,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_copy_sign(const vector4d& input, const vector4d& control_sign) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		const __m256d sign_bit = _mm256_set1_pd(-0.0);
+		const __m256d signs = _mm256_and_pd(sign_bit, control_sign);
+		const __m256d abs_input = _mm256_andnot_pd(sign_bit, input);
+		return _mm256_or_pd(abs_input, signs);
+#elif defined(RTM_SSE2_INTRINSICS)
 		const __m128d sign_bit = _mm_set1_pd(-0.0);
 		__m128d signs_xy = _mm_and_pd(sign_bit, control_sign.xy);
 		__m128d signs_zw = _mm_and_pd(sign_bit, control_sign.zw);
@@ -1943,7 +2393,22 @@ namespace rtm
 		// NaN, +- Infinity, and numbers larger or equal to 2^23 remain unchanged
 		// since they have no fractional part.
 
-#if defined(RTM_SSE4_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		const __m256d sign_mask = _mm256_set1_pd(-0.0);
+		const __m256d sign = _mm256_and_pd(input, sign_mask);
+
+		// For positive values, we add a bias of 0.5.
+		// For negative values, we add a bias of -0.5.
+		const __m256d half = _mm256_set1_pd(0.5);
+		const __m256d bias = _mm256_or_pd(sign, half);
+		const __m256d biased_input = _mm256_add_pd(input, bias);
+
+		const __m256d floored = _mm256_floor_pd(biased_input);
+		const __m256d ceiled = _mm256_ceil_pd(biased_input);
+		const __m256d is_positive = _mm256_cmp_pd(input, _mm256_setzero_pd(), _CMP_GE_OQ);
+
+		return _mm256_blendv_pd(ceiled, floored, is_positive);
+#elif defined(RTM_SSE4_INTRINSICS)
 		const __m128d sign_mask = _mm_set_pd(-0.0, -0.0);
 		__m128d sign_xy = _mm_and_pd(input.xy, sign_mask);
 		__m128d sign_zw = _mm_and_pd(input.zw, sign_mask);
@@ -2044,7 +2509,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_round_bankers(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE4_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_round_pd(input, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#elif defined(RTM_SSE4_INTRINSICS)
 		return vector4d{ _mm_round_pd(input.xy, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC), _mm_round_pd(input.zw, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC) };
 #elif defined(RTM_SSE2_INTRINSICS)
 		const __m128i abs_mask = _mm_set_epi64x(0x7FFFFFFFFFFFFFFFULL, 0x7FFFFFFFFFFFFFFFULL);
@@ -2080,16 +2547,79 @@ namespace rtm
 #endif
 	}
 
+#if defined(RTM_SSE4_INTRINSICS)
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Reduces the input angle in the [-pi/4, pi/4] range and returns the quadrant
+		// it belongs to in [0, 3] along with the sine and cosine of the reduced angle.
+		// Every lane is evaluated at once instead of calling the C math library per lane,
+		// it requires SSE4 to round without emulation to be faster.
+		// Results are accurate to a few ULPs for angles smaller than 2^20 * pi/2 (1.6 million radians).
+		//////////////////////////////////////////////////////////////////////////
+		inline void vector_sincos_reduced(const vector4d& input, vector4d& out_sin, vector4d& out_cos, vector4d& out_quadrant) RTM_NO_EXCEPT
+		{
+			const vector4d quotient = vector_round_bankers(vector_mul(input, 6.36619772367581382433e-01));	// 2/pi
+
+			// Cody-Waite reduction: pi/2 is split in three parts, the first two have 33 significant bits
+			// and their product with the quotient is exact
+			vector4d x = vector_neg_mul_sub(quotient, 1.57079632673412561417e+00, input);
+			x = vector_neg_mul_sub(quotient, 6.07710050630396597660e-11, x);
+			x = vector_neg_mul_sub(quotient, 2.02226624871116645580e-21, x);
+
+			// Quotient modulo 4, (quotient - 1.5) / 4 is never halfway between two integers and rounds like floor(quotient / 4)
+			out_quadrant = vector_neg_mul_sub(vector_round_bankers(vector_mul(vector_sub(quotient, vector_set(1.5)), 0.25)), 4.0, quotient);
+
+			// Minimax polynomials, see: fdlibm k_sin.c and k_cos.c
+			const vector4d x2 = vector_mul(x, x);
+
+			vector4d sin_poly = vector_mul_add(x2, 1.58969099521155010221e-10, vector_set(-2.50507602534068634195e-08));
+			sin_poly = vector_mul_add(sin_poly, x2, vector_set(2.75573137070700676789e-06));
+			sin_poly = vector_mul_add(sin_poly, x2, vector_set(-1.98412698298579493134e-04));
+			sin_poly = vector_mul_add(sin_poly, x2, vector_set(8.33333333332248946124e-03));
+			sin_poly = vector_mul_add(sin_poly, x2, vector_set(-1.66666666666666324348e-01));
+			out_sin = vector_mul_add(vector_mul(sin_poly, x2), x, x);
+
+			vector4d cos_poly = vector_mul_add(x2, -1.13596475577881948265e-11, vector_set(2.08757232129817482790e-09));
+			cos_poly = vector_mul_add(cos_poly, x2, vector_set(-2.75573143513906633035e-07));
+			cos_poly = vector_mul_add(cos_poly, x2, vector_set(2.48015872894767294178e-05));
+			cos_poly = vector_mul_add(cos_poly, x2, vector_set(-1.38888888888741095749e-03));
+			cos_poly = vector_mul_add(cos_poly, x2, vector_set(4.16666666666666019037e-02));
+			out_cos = vector_mul_add(vector_mul(cos_poly, x2), x2, vector_neg_mul_sub(x2, 0.5, vector_set(1.0)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the sine of the angle from its reduced sine, cosine, and quadrant.
+		// The cosine is the sine of the quadrant that follows.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4d vector_sin_from_quadrant(const vector4d& sin_, const vector4d& cos_, const vector4d& quadrant) RTM_NO_EXCEPT
+		{
+			// Quadrants 1 and 3 use the cosine, quadrants 2 and 3 are negated
+			const vector4d parity = vector_neg_mul_sub(vector_round_bankers(vector_mul(vector_sub(quadrant, vector_set(0.5)), 0.5)), 2.0, quadrant);
+			const vector4d result = vector_select(vector_equal(parity, vector_zero()), sin_, cos_);
+			return vector_select(vector_greater_equal(quadrant, vector_set(2.0)), vector_neg(result), result);
+		}
+	}
+#endif
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component the sine of the input angle.
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_sin(const vector4d& input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE4_INTRINSICS)
+		vector4d sin_;
+		vector4d cos_;
+		vector4d quadrant;
+		rtm_impl::vector_sincos_reduced(input, sin_, cos_, quadrant);
+		return rtm_impl::vector_sin_from_quadrant(sin_, cos_, quadrant);
+#else
 		scalard x = scalar_sin(scalard(vector_get_x(input)));
 		scalard y = scalar_sin(scalard(vector_get_y(input)));
 		scalard z = scalar_sin(scalard(vector_get_z(input)));
 		scalard w = scalar_sin(scalard(vector_get_w(input)));
 		return vector_set(x, y, z, w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -2110,11 +2640,56 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_cos(const vector4d& input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE4_INTRINSICS)
+		vector4d sin_;
+		vector4d cos_;
+		vector4d quadrant;
+		rtm_impl::vector_sincos_reduced(input, sin_, cos_, quadrant);
+
+		// cos(x) = sin(x + pi/2), use the next quadrant
+		const vector4d next_quadrant = vector_select(vector_equal(quadrant, vector_set(3.0)), vector_zero(), vector_add(quadrant, vector_set(1.0)));
+		return rtm_impl::vector_sin_from_quadrant(sin_, cos_, next_quadrant);
+#else
 		scalard x = scalar_cos(scalard(vector_get_x(input)));
 		scalard y = scalar_cos(scalard(vector_get_y(input)));
 		scalard z = scalar_cos(scalard(vector_get_z(input)));
 		scalard w = scalar_cos(scalard(vector_get_w(input)));
 		return vector_set(x, y, z, w);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component both the sine and cosine of the input angle.
+	//////////////////////////////////////////////////////////////////////////
+	inline void vector_sincos(const vector4d& input, vector4d& out_sin, vector4d& out_cos) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		vector4d sin_;
+		vector4d cos_;
+		vector4d quadrant;
+		rtm_impl::vector_sincos_reduced(input, sin_, cos_, quadrant);
+
+		const vector4d next_quadrant = vector_select(vector_equal(quadrant, vector_set(3.0)), vector_zero(), vector_add(quadrant, vector_set(1.0)));
+		out_sin = rtm_impl::vector_sin_from_quadrant(sin_, cos_, quadrant);
+		out_cos = rtm_impl::vector_sin_from_quadrant(sin_, cos_, next_quadrant);
+#else
+		double sin_x;
+		double sin_y;
+		double sin_z;
+		double sin_w;
+		double cos_x;
+		double cos_y;
+		double cos_z;
+		double cos_w;
+
+		scalar_sincos(double(vector_get_x(input)), sin_x, cos_x);
+		scalar_sincos(double(vector_get_y(input)), sin_y, cos_y);
+		scalar_sincos(double(vector_get_z(input)), sin_z, cos_z);
+		scalar_sincos(double(vector_get_w(input)), sin_w, cos_w);
+
+		out_sin = vector_set(sin_x, sin_y, sin_z, sin_w);
+		out_cos = vector_set(cos_x, cos_y, cos_z, cos_w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -2123,11 +2698,49 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_acos(const vector4d& input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Rational approximation of asin, see: fdlibm e_acos.c
+		// |x| < 0.5: acos(x) = pi/2 - (x + x * R(x^2))
+		// |x| >= 0.5: acos(|x|) = 2 * (s + s * R(z)) with z = (1 - |x|) / 2 and s = sqrt(z)
+		// x <= -0.5: acos(x) = pi - acos(|x|)
+		const double pi_div_two_hi = 1.57079632679489655800e+00;
+		const double pi_div_two_lo = 6.12323399573676603587e-17;
+
+		const vector4d abs_input = vector_abs(input);
+		const mask4d is_small = vector_less_than(abs_input, vector_set(0.5));
+
+		const vector4d z = vector_select(is_small, vector_mul(input, input), vector_mul(vector_sub(vector_set(1.0), abs_input), 0.5));
+		const vector4d s = vector_select(is_small, input, vector_sqrt(z));
+
+		vector4d p = vector_mul_add(z, 3.47933107596021167570e-05, vector_set(7.91534994289814532176e-04));
+		p = vector_mul_add(p, z, vector_set(-4.00555345006794114027e-02));
+		p = vector_mul_add(p, z, vector_set(2.01212532134862925881e-01));
+		p = vector_mul_add(p, z, vector_set(-3.25565818622400915405e-01));
+		p = vector_mul_add(p, z, vector_set(1.66666666666666657415e-01));
+		p = vector_mul(p, z);
+
+		vector4d q = vector_mul_add(z, 7.70381505559019352791e-02, vector_set(-6.88283971605453293030e-01));
+		q = vector_mul_add(q, z, vector_set(2.02094576023350569471e+00));
+		q = vector_mul_add(q, z, vector_set(-2.40339491173441421878e+00));
+		q = vector_mul_add(q, z, vector_set(1.0));
+
+		const vector4d r = vector_div(p, q);
+
+		// pi/2 - (x + x * r) and pi - 2 * (s + s * r) with the low part of pi/2 added back first
+		const vector4d correction = vector_neg_mul_sub(s, r, vector_set(pi_div_two_lo));
+		const vector4d small_result = vector_sub(vector_set(pi_div_two_hi), vector_sub(s, correction));
+		const vector4d positive_result = vector_mul(vector_mul_add(s, r, s), 2.0);
+		const vector4d negative_result = vector_neg_mul_sub(vector_sub(s, correction), 2.0, vector_set(pi_div_two_hi * 2.0));
+
+		const vector4d large_result = vector_select(vector_less_than(input, vector_zero()), negative_result, positive_result);
+		return vector_select(is_small, small_result, large_result);
+#else
 		scalard x = scalar_acos(scalard(vector_get_x(input)));
 		scalard y = scalar_acos(scalard(vector_get_y(input)));
 		scalard z = scalar_acos(scalard(vector_get_z(input)));
 		scalard w = scalar_acos(scalard(vector_get_w(input)));
 		return vector_set(x, y, z, w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -2136,8 +2749,9 @@ namespace rtm
 	inline vector4d vector_tan(const vector4d& angle) RTM_NO_EXCEPT
 	{
 		// Use the identity: tan(angle) = sin(angle) / cos(angle)
-		vector4d sin_ = vector_sin(angle);
-		vector4d cos_ = vector_cos(angle);
+		vector4d sin_;
+		vector4d cos_;
+		vector_sincos(angle, sin_, cos_);
 
 		mask4d is_cos_zero = vector_equal(cos_, vector_zero());
 		vector4d signed_infinity = vector_copy_sign(vector_set(std::numeric_limits<double>::infinity()), angle);
@@ -2152,11 +2766,47 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_atan(const vector4d& input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Rational approximation, see: Cephes atan.c
+		// |x| > tan(3pi/8): atan(|x|) = pi/2 + atan(-1 / |x|)
+		// |x| > 0.66: atan(|x|) = pi/4 + atan((|x| - 1) / (|x| + 1))
+		const double more_bits = 6.123233995736765886130e-17;
+
+		const vector4d abs_input = vector_abs(input);
+		const mask4d is_large = vector_greater_than(abs_input, vector_set(2.41421356237309504880));
+		const mask4d is_medium = vector_greater_than(abs_input, vector_set(0.66));
+
+		// A single division handles the three ranges
+		const vector4d numerator = vector_select(is_large, vector_set(-1.0), vector_select(is_medium, vector_sub(abs_input, vector_set(1.0)), abs_input));
+		const vector4d denominator = vector_select(is_large, abs_input, vector_select(is_medium, vector_add(abs_input, vector_set(1.0)), vector_set(1.0)));
+		const vector4d x = vector_div(numerator, denominator);
+
+		const vector4d offset = vector_select(is_large, vector_set(1.57079632679489661923), vector_select(is_medium, vector_set(0.78539816339744830962), vector_zero()));
+		const vector4d offset_lo = vector_select(is_large, vector_set(more_bits), vector_select(is_medium, vector_set(0.5 * more_bits), vector_zero()));
+
+		const vector4d x2 = vector_mul(x, x);
+
+		vector4d p = vector_mul_add(x2, -8.750608600031904122785e-01, vector_set(-1.615753718733365076637e+01));
+		p = vector_mul_add(p, x2, vector_set(-7.500855792314704667340e+01));
+		p = vector_mul_add(p, x2, vector_set(-1.228866684490136173410e+02));
+		p = vector_mul_add(p, x2, vector_set(-6.485021904942025371773e+01));
+
+		vector4d q = vector_add(x2, vector_set(2.485846490142306297962e+01));
+		q = vector_mul_add(q, x2, vector_set(1.650270098316988542046e+02));
+		q = vector_mul_add(q, x2, vector_set(4.328810604912902668951e+02));
+		q = vector_mul_add(q, x2, vector_set(4.853903996359136964868e+02));
+		q = vector_mul_add(q, x2, vector_set(1.945506571482613964425e+02));
+
+		const vector4d r = vector_div(vector_mul(p, x2), q);
+		const vector4d result = vector_add(offset, vector_add(vector_mul_add(x, r, x), offset_lo));
+		return vector_copy_sign(result, input);
+#else
 		scalard x = scalar_atan(scalard(vector_get_x(input)));
 		scalard y = scalar_atan(scalard(vector_get_y(input)));
 		scalard z = scalar_atan(scalard(vector_get_z(input)));
 		scalard w = scalar_atan(scalard(vector_get_w(input)));
 		return vector_set(x, y, z, w);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -2167,11 +2817,104 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4d vector_atan2(const vector4d& y, const vector4d& x) RTM_NO_EXCEPT
 	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// If X == 0.0 and Y != 0.0, we return PI/2 with the sign of Y
+		// If X == 0.0 and Y == 0.0, we return 0.0
+		// If X > 0.0, we return atan(y/x)
+		// If X < 0.0, we return atan(y/x) + sign(Y) * PI
+		// See: https://en.wikipedia.org/wiki/Atan2#Definition_and_computation
+
+		const vector4d zero = vector_zero();
+		const mask4d is_x_zero = vector_equal(x, zero);
+		const mask4d is_y_zero = vector_equal(y, zero);
+
+		// If X == 0.0, our offset is PI/2 otherwise it is PI both with the sign of Y
+		vector4d offset = vector_select(is_x_zero, vector_set(1.57079632679489661923), vector_set(3.14159265358979323846));
+		offset = vector_copy_sign(offset, y);
+
+		// If X > 0.0, or X == 0.0 and Y == 0.0, our offset is 0.0
+		offset = vector_select(vector_greater_than(x, zero), zero, offset);
+		offset = vector_select(is_x_zero, vector_select(is_y_zero, zero, offset), offset);
+
+		// If X == 0.0, our value is 0.0 otherwise it is atan(y/x)
+		const vector4d value = vector_select(is_x_zero, zero, vector_atan(vector_div(y, x)));
+
+		return vector_add(value, offset);
+#else
 		scalard x_ = scalar_atan2(scalard(vector_get_x(y)), scalard(vector_get_x(x)));
 		scalard y_ = scalar_atan2(scalard(vector_get_y(y)), scalard(vector_get_y(x)));
 		scalard z_ = scalar_atan2(scalard(vector_get_z(y)), scalard(vector_get_z(x)));
 		scalard w_ = scalar_atan2(scalard(vector_get_w(y)), scalard(vector_get_w(x)));
 		return vector_set(x_, y_, z_, w_);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component 2 raised to the power of the input: 2^input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_exp2(const vector4d& input) RTM_NO_EXCEPT
+	{
+		double x = scalar_exp2(double(vector_get_x(input)));
+		double y = scalar_exp2(double(vector_get_y(input)));
+		double z = scalar_exp2(double(vector_get_z(input)));
+		double w = scalar_exp2(double(vector_get_w(input)));
+		return vector_set(x, y, z, w);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component e raised to the power of the input: e^input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_exp(const vector4d& input) RTM_NO_EXCEPT
+	{
+		double x = scalar_exp(double(vector_get_x(input)));
+		double y = scalar_exp(double(vector_get_y(input)));
+		double z = scalar_exp(double(vector_get_z(input)));
+		double w = scalar_exp(double(vector_get_w(input)));
+		return vector_set(x, y, z, w);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the base 2 logarithm of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_log2(const vector4d& input) RTM_NO_EXCEPT
+	{
+		double x = scalar_log2(double(vector_get_x(input)));
+		double y = scalar_log2(double(vector_get_y(input)));
+		double z = scalar_log2(double(vector_get_z(input)));
+		double w = scalar_log2(double(vector_get_w(input)));
+		return vector_set(x, y, z, w);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the natural logarithm of the input.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_log(const vector4d& input) RTM_NO_EXCEPT
+	{
+		double x = scalar_log(double(vector_get_x(input)));
+		double y = scalar_log(double(vector_get_y(input)));
+		double z = scalar_log(double(vector_get_z(input)));
+		double w = scalar_log(double(vector_get_w(input)));
+		return vector_set(x, y, z, w);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the base raised to the power of the exponent: base^exponent
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_pow(const vector4d& base, const vector4d& exponent) RTM_NO_EXCEPT
+	{
+		double x = scalar_pow(double(vector_get_x(base)), double(vector_get_x(exponent)));
+		double y = scalar_pow(double(vector_get_y(base)), double(vector_get_y(exponent)));
+		double z = scalar_pow(double(vector_get_z(base)), double(vector_get_z(exponent)));
+		double w = scalar_pow(double(vector_get_w(base)), double(vector_get_w(exponent)));
+		return vector_set(x, y, z, w);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the base raised to the power of the scalar exponent: base^exponent
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4d vector_pow(const vector4d& base, double exponent) RTM_NO_EXCEPT
+	{
+		return vector_pow(base, vector_set(exponent));
 	}
 }
 
@@ -26,6 +26,7 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 #include "rtm/math.h"
+#include "rtm/mask4f.h"
 #include "rtm/scalarf.h"
 #include "rtm/impl/compiler_utils.h"
 #include "rtm/impl/memory_utils.h"
@@ -114,6 +115,86 @@ namespace rtm
 		return vector_set(input->x, input->y, input->z, 0.0F);
 	}
 
+#if defined(RTM_SSE2_INTRINSICS) && !defined(RTM_F16C_INTRINSICS)
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Converts the raw half precision bits held in the low 16 bits of each lane into single precision.
+		// See scalar_half_to_float for details.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128 RTM_SIMD_CALL vector_half_to_float_sse2(__m128i input) RTM_NO_EXCEPT
+		{
+			const __m128i exponent_mantissa = _mm_and_si128(input, _mm_set1_epi32(0x7FFF));
+			const __m128i sign = _mm_slli_epi32(_mm_xor_si128(input, exponent_mantissa), 16);
+
+			const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(exponent_mantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+			const __m128i is_inf_nan = _mm_cmpgt_epi32(exponent_mantissa, _mm_set1_epi32(0x7BFF));
+			const __m128i inf_nan_exponent = _mm_and_si128(is_inf_nan, _mm_set1_epi32(255 << 23));
+
+			return _mm_or_ps(scaled, _mm_castsi128_ps(_mm_or_si128(sign, inf_nan_exponent)));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Converts each lane into half precision with round to nearest even.
+		// The raw bits are returned sign extended to 32 bits, ready to be packed with signed saturation.
+		// See scalar_float_to_half for details.
+		//////////////////////////////////////////////////////////////////////////
+		inline __m128i RTM_SIMD_CALL vector_float_to_half_sse2(__m128 input) RTM_NO_EXCEPT
+		{
+			const __m128i subnormal_magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+
+			const __m128 sign = _mm_and_ps(input, _mm_set_ps1(-0.0F));
+			const __m128 abs_input = _mm_xor_ps(input, sign);
+			const __m128i abs_input_i = _mm_castps_si128(abs_input);
+
+			// Infinity and NaN, as well as anything too large for a half
+			const __m128i is_regular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), abs_input_i);
+			const __m128i nan_bit = _mm_and_si128(_mm_castps_si128(_mm_cmpunord_ps(abs_input, abs_input)), _mm_set1_epi32(0x200));
+			const __m128i inf_nan = _mm_or_si128(nan_bit, _mm_set1_epi32(0x7C00));
+
+			// The result is subnormal or zero, let the addition perform the rounding
+			const __m128i is_subnormal = _mm_cmpgt_epi32(_mm_set1_epi32((127 - 14) << 23), abs_input_i);
+			const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(abs_input, _mm_castsi128_ps(subnormal_magic))), subnormal_magic);
+
+			// Re-bias the exponent and round the mantissa to nearest even
+			const __m128i is_mantissa_odd = _mm_srai_epi32(_mm_slli_epi32(abs_input_i, 31 - 13), 31);
+			const __m128i rounded = _mm_sub_epi32(_mm_add_epi32(abs_input_i, _mm_set1_epi32(0xFFF - ((127 - 15) << 23))), is_mantissa_odd);
+			const __m128i normal = _mm_srli_epi32(rounded, 13);
+
+			const __m128i non_special = _mm_or_si128(_mm_and_si128(is_subnormal, subnormal), _mm_andnot_si128(is_subnormal, normal));
+			const __m128i result = _mm_or_si128(_mm_and_si128(is_regular, non_special), _mm_andnot_si128(is_regular, inf_nan));
+
+			return _mm_or_si128(result, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+		}
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an unaligned vector4 from memory stored as 4 half precision values.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_load_half(const uint16_t* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_F16C_INTRINSICS)
+		return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(input)));
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128i input_u16 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(input));
+		return rtm_impl::vector_half_to_float_sse2(_mm_unpacklo_epi16(input_u16, _mm_setzero_si128()));
+#elif defined(RTM_NEON64_INTRINSICS)
+		return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(input)));
+#else
+		return vector_set(scalar_half_to_float(input[0]), scalar_half_to_float(input[1]), scalar_half_to_float(input[2]), scalar_half_to_float(input[3]));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an unaligned vector3 from memory stored as 3 half precision values and sets the [w] component to zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_load3_half(const uint16_t* input) RTM_NO_EXCEPT
+	{
+		const uint16_t padded_input[4] = { input[0], input[1], input[2], 0 };
+		return vector_load_half(&padded_input[0]);
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Loads an input scalar from memory into the [xyzw] components.
 	//////////////////////////////////////////////////////////////////////////
@@ -133,8 +214,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Casts a quaternion to a vector4.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL quat_to_vector(quatf_arg0 input) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL quat_to_vector(quatf_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return std::bit_cast<vector4f>(input);
+#endif
 #if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS)
 		return input;
 #else
@@ -147,7 +232,9 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	inline vector4f RTM_SIMD_CALL vector_cast(const vector4d& input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cvtpd_ps(input);
+#elif defined(RTM_SSE2_INTRINSICS)
 		return _mm_shuffle_ps(_mm_cvtpd_ps(input.xy), _mm_cvtpd_ps(input.zw), _MM_SHUFFLE(1, 0, 1, 0));
 #else
 		return vector_set(float(input.x), float(input.y), float(input.z), float(input.w));
@@ -164,8 +251,12 @@ namespace rtm
 		//////////////////////////////////////////////////////////////////////////
 		struct vector4f_vector_get_x
 		{
-			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return std::bit_cast<float4f>(input).x;
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtss_f32(input);
 #elif defined(RTM_NEON_INTRINSICS)
@@ -176,7 +267,7 @@ namespace rtm
 			}
 
 #if defined(RTM_SSE2_INTRINSICS)
-			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
 			{
 				return scalarf{ input };
 			}
@@ -204,8 +295,12 @@ namespace rtm
 		//////////////////////////////////////////////////////////////////////////
 		struct vector4f_vector_get_y
 		{
-			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return std::bit_cast<float4f>(input).y;
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtss_f32(_mm_shuffle_ps(input, input, _MM_SHUFFLE(1, 1, 1, 1)));
 #elif defined(RTM_NEON_INTRINSICS)
@@ -216,8 +311,12 @@ namespace rtm
 			}
 
 #if defined(RTM_SSE2_INTRINSICS)
-			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return scalarf{ vector_set(std::bit_cast<float4f>(input).y) };
+#endif
 				return scalarf{ _mm_shuffle_ps(input, input, _MM_SHUFFLE(1, 1, 1, 1)) };
 			}
 #endif
@@ -244,8 +343,12 @@ namespace rtm
 		//////////////////////////////////////////////////////////////////////////
 		struct vector4f_vector_get_z
 		{
-			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return std::bit_cast<float4f>(input).z;
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtss_f32(_mm_shuffle_ps(input, input, _MM_SHUFFLE(2, 2, 2, 2)));
 #elif defined(RTM_NEON_INTRINSICS)
@@ -256,8 +359,12 @@ namespace rtm
 			}
 
 #if defined(RTM_SSE2_INTRINSICS)
-			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return scalarf{ vector_set(std::bit_cast<float4f>(input).z) };
+#endif
 				return scalarf{ _mm_shuffle_ps(input, input, _MM_SHUFFLE(2, 2, 2, 2)) };
 			}
 #endif
@@ -284,8 +391,12 @@ namespace rtm
 		//////////////////////////////////////////////////////////////////////////
 		struct vector4f_vector_get_w
 		{
-			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return std::bit_cast<float4f>(input).w;
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 				return _mm_cvtss_f32(_mm_shuffle_ps(input, input, _MM_SHUFFLE(3, 3, 3, 3)));
 #elif defined(RTM_NEON_INTRINSICS)
@@ -296,8 +407,12 @@ namespace rtm
 			}
 
 #if defined(RTM_SSE2_INTRINSICS)
-			inline RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator scalarf() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return scalarf{ vector_set(std::bit_cast<float4f>(input).w) };
+#endif
 				return scalarf{ _mm_shuffle_ps(input, input, _MM_SHUFFLE(3, 3, 3, 3)) };
 			}
 #endif
@@ -676,6 +791,91 @@ namespace rtm
 		output->z = vector_get_z(input);
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a vector4 to unaligned memory as 4 half precision values.
+	// Rounding is to nearest even.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store_half(vector4f_arg0 input, uint16_t* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_F16C_INTRINSICS)
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_cvtps_ph(input, _MM_FROUND_TO_NEAREST_INT));
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128i result = rtm_impl::vector_float_to_half_sse2(input);
+		_mm_storel_epi64(reinterpret_cast<__m128i*>(output), _mm_packs_epi32(result, result));
+#elif defined(RTM_NEON64_INTRINSICS)
+		vst1_u16(output, vreinterpret_u16_f16(vcvt_f16_f32(input)));
+#else
+		output[0] = scalar_float_to_half(vector_get_x(input));
+		output[1] = scalar_float_to_half(vector_get_y(input));
+		output[2] = scalar_float_to_half(vector_get_z(input));
+		output[3] = scalar_float_to_half(vector_get_w(input));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a vector3 to unaligned memory as 3 half precision values.
+	// Rounding is to nearest even.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store3_half(vector4f_arg0 input, uint16_t* output) RTM_NO_EXCEPT
+	{
+		uint16_t padded_output[4];
+		vector_store_half(input, &padded_output[0]);
+		output[0] = padded_output[0];
+		output[1] = padded_output[1];
+		output[2] = padded_output[2];
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the vector4 components where the mask is true to unaligned memory.
+	// The other values in memory are left unchanged.
+	// With AVX, the masked out values are not accessed. Otherwise, they are read and
+	// written back: all 4 values must be valid memory and not written concurrently.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store_masked(vector4f_arg0 input, mask4f_arg1 mask, float* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		_mm_maskstore_ps(output, _mm_castps_si128(mask), input);
+#elif defined(RTM_SSE4_INTRINSICS)
+		_mm_storeu_ps(output, _mm_blendv_ps(_mm_loadu_ps(output), input, mask));
+#elif defined(RTM_SSE2_INTRINSICS)
+		_mm_storeu_ps(output, _mm_or_ps(_mm_and_ps(mask, input), _mm_andnot_ps(mask, _mm_loadu_ps(output))));
+#elif defined(RTM_NEON_INTRINSICS)
+		vst1q_f32(output, vbslq_f32(vreinterpretq_u32_f32(mask), input, vld1q_f32(output)));
+#else
+		output[0] = mask.x != 0 ? input.x : output[0];
+		output[1] = mask.y != 0 ? input.y : output[1];
+		output[2] = mask.z != 0 ? input.z : output[2];
+		output[3] = mask.w != 0 ? input.w : output[3];
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the vector4 components where the mask is true contiguously to unaligned
+	// memory (left packing) and returns how many were written, without branching.
+	// The output must have room for 4 values, the values past the returned count
+	// can be overwritten with undefined values.
+	// e.g. Store the indices of the values that pass a test to build a list.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL vector_compress_store(vector4f_arg0 input, mask4f_arg1 mask, float* output) RTM_NO_EXCEPT
+	{
+		const uint32_t mask_bits = mask_get_bits(mask);
+
+#if defined(RTM_AVX512_INTRINSICS)
+		// Only the selected values are written
+		_mm512_mask_compressstoreu_ps(output, __mmask16(mask_bits), _mm512_castps128_ps512(input));
+#elif defined(RTM_SSE4_INTRINSICS)
+		const __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(rtm_impl::get_compress_shuffle_control(mask_bits)));
+		_mm_storeu_ps(output, _mm_castsi128_ps(_mm_shuffle_epi8(_mm_castps_si128(input), control)));
+#elif defined(RTM_NEON64_INTRINSICS)
+		const uint8x16_t control = vld1q_u8(rtm_impl::get_compress_shuffle_control(mask_bits));
+		vst1q_f32(output, vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(input), control)));
+#else
+		rtm_impl::compress_store4<float>(vector_get_x(input), vector_get_y(input), vector_get_z(input), vector_get_w(input), mask_bits, output);
+#endif
+
+		return rtm_impl::mask_bits_count(mask_bits);
+	}
+
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -686,8 +886,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component addition of the two inputs: lhs + rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_add(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_add(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+		{
+			const float4f lhs_ = std::bit_cast<float4f>(lhs);
+			const float4f rhs_ = std::bit_cast<float4f>(rhs);
+			return vector_set(lhs_.x + rhs_.x, lhs_.y + rhs_.y, lhs_.z + rhs_.z, lhs_.w + rhs_.w);
+		}
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_add_ps(lhs, rhs);
 #elif defined(RTM_NEON_INTRINSICS)
@@ -700,8 +908,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component subtraction of the two inputs: lhs - rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_sub(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_sub(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+		{
+			const float4f lhs_ = std::bit_cast<float4f>(lhs);
+			const float4f rhs_ = std::bit_cast<float4f>(rhs);
+			return vector_set(lhs_.x - rhs_.x, lhs_.y - rhs_.y, lhs_.z - rhs_.z, lhs_.w - rhs_.w);
+		}
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_sub_ps(lhs, rhs);
 #elif defined(RTM_NEON_INTRINSICS)
@@ -714,8 +930,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication of the two inputs: lhs * rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_mul(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_mul(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+		{
+			const float4f lhs_ = std::bit_cast<float4f>(lhs);
+			const float4f rhs_ = std::bit_cast<float4f>(rhs);
+			return vector_set(lhs_.x * rhs_.x, lhs_.y * rhs_.y, lhs_.z * rhs_.z, lhs_.w * rhs_.w);
+		}
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		return _mm_mul_ps(lhs, rhs);
 #elif defined(RTM_NEON_INTRINSICS)
@@ -728,8 +952,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication of the vector by a scalar: lhs * rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_mul(vector4f_arg0 lhs, float rhs) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_mul(vector4f_arg0 lhs, float rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_mul(lhs, vector_set(rhs));
+#endif
 #if defined(RTM_NEON_INTRINSICS)
 		return vmulq_n_f32(lhs, rhs);
 #else
@@ -741,8 +969,12 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication of the vector by a scalar: lhs * rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_mul(vector4f_arg0 lhs, scalarf_arg1 rhs) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_mul(vector4f_arg0 lhs, scalarf_arg1 rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_mul(lhs, vector_set(std::bit_cast<float4f>(rhs.value).x));
+#endif
 		return _mm_mul_ps(lhs, _mm_shuffle_ps(rhs.value, rhs.value, _MM_SHUFFLE(0, 0, 0, 0)));
 	}
 #endif
@@ -828,8 +1060,15 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component negation of the input: -input
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_neg(vector4f_arg0 input) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_neg(vector4f_arg0 input) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+		{
+			const float4f input_ = std::bit_cast<float4f>(input);
+			return vector_set(-input_.x, -input_.y, -input_.z, -input_.w);
+		}
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		constexpr __m128 signs = { -0.0F, -0.0F, -0.0F, -0.0F };
 		return _mm_xor_ps(input, signs);
@@ -849,7 +1088,7 @@ namespace rtm
 		return _mm_div_ps(_mm_set_ps1(1.0F), input);
 #elif defined(RTM_NEON64_INTRINSICS)
 		return vdivq_f32(vdupq_n_f32(1.0F), input);
-#elif defined(RTM_NEON_INTRINSICS)
+#elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		// Perform two passes of Newton-Raphson iteration on the hardware estimate
 		float32x4_t x0 = vrecpeq_f32(input);
 
@@ -890,6 +1129,8 @@ namespace rtm
 	{
 #if defined(RTM_SSE4_INTRINSICS)
 		return _mm_ceil_ps(input);
+#elif defined(RTM_WASM_SIMD128_INTRINSICS)
+		return (__m128)wasm_f32x4_ceil((v128_t)input);
 #elif defined(RTM_SSE2_INTRINSICS)
 		// NaN, +- Infinity, and numbers larger or equal to 2^23 remain unchanged
 		// since they have no fractional part.
@@ -922,6 +1163,9 @@ namespace rtm
 		// Subtract our bias to properly handle positive values
 		integer_part = _mm_sub_ps(integer_part, bias);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = _mm_or_ps(integer_part, _mm_and_ps(input, _mm_set_ps1(-0.0F)));
+
 		return _mm_or_ps(_mm_and_ps(use_original_input, input), _mm_andnot_ps(use_original_input, integer_part));
 #elif defined(RTM_NEON64_INTRINSICS)
 		return vrndpq_f32(input);
@@ -953,6 +1197,9 @@ namespace rtm
 		// Subtract our bias to properly handle positive values
 		integer_part = vsubq_f32(integer_part, bias);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(integer_part), vandq_u32(vreinterpretq_u32_f32(input), vreinterpretq_u32_f32(vdupq_n_f32(-0.0F)))));
+
 		return vbslq_f32(use_original_input, input, integer_part);
 #else
 		return vector_set(scalar_ceil(vector_get_x(input)), scalar_ceil(vector_get_y(input)), scalar_ceil(vector_get_z(input)), scalar_ceil(vector_get_w(input)));
@@ -967,6 +1214,8 @@ namespace rtm
 	{
 #if defined(RTM_SSE4_INTRINSICS)
 		return _mm_floor_ps(input);
+#elif defined(RTM_WASM_SIMD128_INTRINSICS)
+		return (__m128)wasm_f32x4_floor((v128_t)input);
 #elif defined(RTM_SSE2_INTRINSICS)
 		// NaN, +- Infinity, and numbers larger or equal to 2^23 remain unchanged
 		// since they have no fractional part.
@@ -999,6 +1248,9 @@ namespace rtm
 		// Add our bias to properly handle negative values
 		integer_part = _mm_add_ps(integer_part, bias);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = _mm_or_ps(integer_part, _mm_and_ps(input, _mm_set_ps1(-0.0F)));
+
 		return _mm_or_ps(_mm_and_ps(use_original_input, input), _mm_andnot_ps(use_original_input, integer_part));
 #elif defined(RTM_NEON64_INTRINSICS)
 		return vrndmq_f32(input);
@@ -1030,6 +1282,9 @@ namespace rtm
 		// Add our bias to properly handle negative values
 		integer_part = vaddq_f32(integer_part, bias);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(integer_part), vandq_u32(vreinterpretq_u32_f32(input), vreinterpretq_u32_f32(vdupq_n_f32(-0.0F)))));
+
 		return vbslq_f32(use_original_input, input, integer_part);
 #else
 		return vector_set(scalar_floor(vector_get_x(input)), scalar_floor(vector_get_y(input)), scalar_floor(vector_get_z(input)), scalar_floor(vector_get_w(input)));
@@ -1039,8 +1294,16 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// 3D cross product: lhs x rhs
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_cross3(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_cross3(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+		{
+			const float4f lhs_ = std::bit_cast<float4f>(lhs);
+			const float4f rhs_ = std::bit_cast<float4f>(rhs);
+			return vector_set((lhs_.y * rhs_.z) - (lhs_.z * rhs_.y), (lhs_.z * rhs_.x) - (lhs_.x * rhs_.z), (lhs_.x * rhs_.y) - (lhs_.y * rhs_.x));
+		}
+#endif
 #if defined(RTM_SSE2_INTRINSICS)
 		// cross(a, b).zxy = (a * b.yzx) - (a.yzx * b)
 		__m128 lhs_yzx = _mm_shuffle_ps(lhs, lhs, _MM_SHUFFLE(3, 0, 2, 1));
@@ -1071,8 +1334,16 @@ namespace rtm
 		//////////////////////////////////////////////////////////////////////////
 		struct vector4f_vector_dot
 		{
-			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+				{
+					const float4f lhs_ = std::bit_cast<float4f>(lhs);
+					const float4f rhs_ = std::bit_cast<float4f>(rhs);
+					return ((lhs_.x * rhs_.x) + (lhs_.z * rhs_.z)) + ((lhs_.y * rhs_.y) + (lhs_.w * rhs_.w));
+				}
+#endif
 #if defined(RTM_SSE4_INTRINSICS) && 0
 				// SSE4 dot product instruction isn't precise enough
 				return _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0xFF));
@@ -1083,8 +1354,18 @@ namespace rtm
 				__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
 				__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
 				return _mm_cvtss_f32(x2y2z2w2_0_0_0);
+#elif defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+				// A single horizontal add across all 4 lanes
+				return vaddvq_f32(vmulq_f32(lhs, rhs));
+#elif defined(RTM_NEON_INTRINSICS)
+				float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
+				float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
+				float32x2_t z2_w2 = vget_high_f32(x2_y2_z2_w2);
+				float32x2_t x2z2_y2w2 = vadd_f32(x2_y2, z2_w2);
+				float32x2_t x2y2z2w2 = vpadd_f32(x2z2_y2w2, x2z2_y2w2);
+				return vget_lane_f32(x2y2z2w2, 0);
 #else
-				return (vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs)) + (vector_get_w(lhs) * vector_get_w(rhs));
+				return ((vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs))) + ((vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_w(lhs) * vector_get_w(rhs)));
 #endif
 			}
 
@@ -1105,8 +1386,12 @@ namespace rtm
 			}
 #endif
 
-			inline RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator vector4f() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+					return vector_set(float(*this));
+#endif
 #if defined(RTM_SSE4_INTRINSICS) && 0
 				// SSE4 dot product instruction isn't precise enough
 				return _mm_dp_ps(lhs, rhs, 0xFF);
@@ -1117,6 +1402,11 @@ namespace rtm
 				__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
 				__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
 				return _mm_shuffle_ps(x2y2z2w2_0_0_0, x2y2z2w2_0_0_0, _MM_SHUFFLE(0, 0, 0, 0));
+#elif defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+				// Two pairwise adds leave the sum in every lane without leaving the register
+				float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
+				float32x4_t x2y2_z2w2_x2y2_z2w2 = vpaddq_f32(x2_y2_z2_w2, x2_y2_z2_w2);
+				return vpaddq_f32(x2y2_z2w2_x2y2_z2w2, x2y2_z2w2_x2y2_z2w2);
 #elif defined(RTM_NEON_INTRINSICS)
 				float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
 				float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
@@ -1159,6 +1449,8 @@ namespace rtm
 		__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
 		__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
 		return scalarf{ x2y2z2w2_0_0_0 };
+#elif defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+		return vaddvq_f32(vmulq_f32(lhs, rhs));
 #elif defined(RTM_NEON_INTRINSICS)
 		float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
 		float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
@@ -1167,7 +1459,7 @@ namespace rtm
 		float32x2_t x2y2z2w2 = vpadd_f32(x2z2_y2w2, x2z2_y2w2);
 		return vget_lane_f32(x2y2z2w2, 0);
 #else
-		return (vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs)) + (vector_get_w(lhs) * vector_get_w(rhs));
+		return ((vector_get_x(lhs) * vector_get_x(rhs)) + (vector_get_z(lhs) * vector_get_z(rhs))) + ((vector_get_y(lhs) * vector_get_y(rhs)) + (vector_get_w(lhs) * vector_get_w(rhs)));
 #endif
 	}
 
@@ -1187,6 +1479,10 @@ namespace rtm
 		__m128 y2w2_0_0_0 = _mm_shuffle_ps(x2z2_y2w2_0_0, x2z2_y2w2_0_0, _MM_SHUFFLE(0, 0, 0, 1));
 		__m128 x2y2z2w2_0_0_0 = _mm_add_ps(x2z2_y2w2_0_0, y2w2_0_0_0);
 		return _mm_shuffle_ps(x2y2z2w2_0_0_0, x2y2z2w2_0_0_0, _MM_SHUFFLE(0, 0, 0, 0));
+#elif defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
+		float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
+		float32x4_t x2y2_z2w2_x2y2_z2w2 = vpaddq_f32(x2_y2_z2_w2, x2_y2_z2_w2);
+		return vpaddq_f32(x2y2_z2w2_x2y2_z2w2, x2y2_z2w2_x2y2_z2w2);
 #elif defined(RTM_NEON_INTRINSICS)
 		float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
 		float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
@@ -1209,8 +1505,16 @@ namespace rtm
 		//////////////////////////////////////////////////////////////////////////
 		struct vector4f_vector_dot3
 		{
-			inline RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
+			RTM_CONSTEXPR_EVAL RTM_SIMD_CALL operator float() const RTM_NO_EXCEPT
 			{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+				if (std::is_constant_evaluated())
+				{
+					const float4f lhs_ = std::bit_cast<float4f>(lhs);
+					const float4f rhs_ = std::bit_cast<float4f>(rhs);
+					return ((lhs_.x * rhs_.x) + (lhs_.y * rhs_.y)) + (lhs_.z * rhs_.z);
+				}
+#endif
 #if defined(RTM_SSE4_INTRINSICS) && 0
 				// SSE4 dot product instruction isn't precise enough
 				return _mm_cvtss_f32(_mm_dp_ps(lhs, rhs, 0x7F));
@@ -1221,6 +1525,10 @@ namespace rtm
 				__m128 z2_0_0_0 = _mm_shuffle_ps(x2_y2_z2_w2, x2_y2_z2_w2, _MM_SHUFFLE(0, 0, 0, 2));
 				__m128 x2y2z2_0_0_0 = _mm_add_ss(x2y2_0_0_0, z2_0_0_0);
 				return _mm_cvtss_f32(x2y2z2_0_0_0);
+#elif defined(RTM_NEON64_INTRINSICS)
+				// Pairwise add the first two lanes and add the third, the w lane is ignored
+				float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
+				return vpadds_f32(vget_low_f32(x2_y2_z2_w2)) + vgetq_lane_f32(x2_y2_z2_w2, 2);
 #elif defined(RTM_NEON_INTRINSICS)
 				float32x4_t x2_y2_z2_w2 = vmulq_f32(lhs, rhs);
 				float32x2_t x2_y2 = vget_low_f32(x2_y2_z2_w2);
@@ -1276,6 +1584,40 @@ namespace rtm
 
 	namespace rtm_impl
 	{
+		//////////////////////////////////////////////////////////////////////////
+		// Compares a length with a threshold through its squared value: length < threshold.
+		// A length is never negative which allows us to skip the square root while returning
+		// the same result for negative, infinite, and NaN thresholds or lengths.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool length_squared_less_than(float len_sq, float threshold) RTM_NO_EXCEPT
+		{
+			return threshold > 0.0F && len_sq < (threshold * threshold);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compares a length with a threshold through its squared value: length <= threshold.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool length_squared_less_equal(float len_sq, float threshold) RTM_NO_EXCEPT
+		{
+			return threshold >= 0.0F && len_sq <= (threshold * threshold);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compares a length with a threshold through its squared value: length > threshold.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool length_squared_greater_than(float len_sq, float threshold) RTM_NO_EXCEPT
+		{
+			return threshold < 0.0F ? (len_sq >= 0.0F) : (len_sq > (threshold * threshold));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Compares a length with a threshold through its squared value: length >= threshold.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr bool length_squared_greater_equal(float len_sq, float threshold) RTM_NO_EXCEPT
+		{
+			return threshold <= 0.0F ? (len_sq >= 0.0F) : (len_sq >= (threshold * threshold));
+		}
+
 		//////////////////////////////////////////////////////////////////////////
 		// This is a helper struct to allow a single consistent API between
 		// various vector types when the semantics are identical but the return
@@ -1298,8 +1640,59 @@ namespace rtm
 			}
 #endif
 
+			//////////////////////////////////////////////////////////////////////////
+			// Comparisons against a threshold use the squared length and skip the square root.
+			//////////////////////////////////////////////////////////////////////////
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_less_than(vector_length_squared(input), float(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<=(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_less_equal(vector_length_squared(input), float(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_greater_than(vector_length_squared(input), float(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>=(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_greater_equal(vector_length_squared(input), float(threshold));
+			}
+
 			vector4f input;
 		};
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<(threshold_type threshold, const vector4f_vector_length& length) RTM_NO_EXCEPT
+		{
+			return length > threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<=(threshold_type threshold, const vector4f_vector_length& length) RTM_NO_EXCEPT
+		{
+			return length >= threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>(threshold_type threshold, const vector4f_vector_length& length) RTM_NO_EXCEPT
+		{
+			return length < threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>=(threshold_type threshold, const vector4f_vector_length& length) RTM_NO_EXCEPT
+		{
+			return length <= threshold;
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1334,8 +1727,59 @@ namespace rtm
 			}
 #endif
 
+			//////////////////////////////////////////////////////////////////////////
+			// Comparisons against a threshold use the squared length and skip the square root.
+			//////////////////////////////////////////////////////////////////////////
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_less_than(vector_length_squared3(input), float(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<=(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_less_equal(vector_length_squared3(input), float(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_greater_than(vector_length_squared3(input), float(threshold));
+			}
+
+			template<typename threshold_type>
+			inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>=(threshold_type threshold) const RTM_NO_EXCEPT
+			{
+				return length_squared_greater_equal(vector_length_squared3(input), float(threshold));
+			}
+
 			vector4f input;
 		};
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<(threshold_type threshold, const vector4f_vector_length3& length) RTM_NO_EXCEPT
+		{
+			return length > threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator<=(threshold_type threshold, const vector4f_vector_length3& length) RTM_NO_EXCEPT
+		{
+			return length >= threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>(threshold_type threshold, const vector4f_vector_length3& length) RTM_NO_EXCEPT
+		{
+			return length < threshold;
+		}
+
+		template<typename threshold_type>
+		inline length_comparison_result<threshold_type> RTM_SIMD_CALL operator>=(threshold_type threshold, const vector4f_vector_length3& length) RTM_NO_EXCEPT
+		{
+			return length <= threshold;
+		}
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -1427,6 +1871,16 @@ namespace rtm
 		return rtm_impl::vector4f_vector_length3{ difference };
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the squared distance between two 3D points.
+	// Prefer comparing squared distances over distances to skip the square root.
+	//////////////////////////////////////////////////////////////////////////
+	inline rtm_impl::vector4f_vector_dot3 RTM_SIMD_CALL vector_distance_squared3(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const vector4f difference = vector_sub(lhs, rhs);
+		return rtm_impl::vector4f_vector_dot3{ difference, difference };
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns a normalized vector3.
 	// If the length of the input is not finite or zero, the result is undefined.
@@ -1454,6 +1908,26 @@ namespace rtm
 			return fallback;
 	}
 
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a normalized vector3 only if it isn't already normalized.
+	// If the squared length of the input is within 'normalized_threshold' of 1.0,
+	// the input is returned unchanged which skips the reciprocal square root.
+	// If the length of the input is below the supplied threshold, the
+	// fall back value is returned instead.
+	// The squared length is calculated only once.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_normalize3_if_needed(vector4f_arg0 input, vector4f_arg1 fallback, float threshold = 1.0E-8F, float normalized_threshold = 0.00001F) RTM_NO_EXCEPT
+	{
+		const scalarf len_sq = vector_length_squared3(input);
+		const float len_sq_value = scalar_cast(len_sq);
+		if (scalar_abs(len_sq_value - 1.0F) < normalized_threshold)
+			return input;
+		else if (len_sq_value >= threshold)
+			return vector_mul(input, scalar_sqrt_reciprocal(len_sq));
+		else
+			return fallback;
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Returns per component the fractional part of the input.
 	//////////////////////////////////////////////////////////////////////////
@@ -1465,12 +1939,18 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication/addition of the three inputs: v2 + (v0 * v1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, vector4f_arg1 v1, vector4f_arg2 v2) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, vector4f_arg1 v1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON64_INTRINSICS)
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_add(vector_mul(v0, v1), v2);
+#endif
+#if defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vfmaq_f32(v2, v0, v1);
 #elif defined(RTM_NEON_INTRINSICS)
 		return vmlaq_f32(v2, v0, v1);
+#elif defined(RTM_IMPL_USE_FMA)
+		return _mm_fmadd_ps(v0, v1, v2);
 #else
 		return vector_add(vector_mul(v0, v1), v2);
 #endif
@@ -1479,12 +1959,18 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication/addition of the three inputs: v2 + (v0 * s1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, float s1, vector4f_arg2 v2) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, float s1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON64_INTRINSICS)
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_add(vector_mul(v0, s1), v2);
+#endif
+#if defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vfmaq_n_f32(v2, v0, s1);
 #elif defined(RTM_NEON_INTRINSICS)
 		return vmlaq_n_f32(v2, v0, s1);
+#elif defined(RTM_IMPL_USE_FMA)
+		return _mm_fmadd_ps(v0, _mm_set_ps1(s1), v2);
 #else
 		return vector_add(vector_mul(v0, s1), v2);
 #endif
@@ -1494,9 +1980,17 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Per component multiplication/addition of the three inputs: v2 + (v0 * s1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, scalarf_arg1 s1, vector4f_arg2 v2) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_mul_add(vector4f_arg0 v0, scalarf_arg1 s1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_add(vector_mul(v0, s1), v2);
+#endif
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm_fmadd_ps(v0, _mm_shuffle_ps(s1.value, s1.value, _MM_SHUFFLE(0, 0, 0, 0)), v2);
+#else
 		return vector_add(vector_mul(v0, s1), v2);
+#endif
 	}
 #endif
 
@@ -1504,12 +1998,18 @@ namespace rtm
 	// Per component negative multiplication/subtraction of the three inputs: -((v0 * v1) - v2)
 	// This is mathematically equivalent to: v2 - (v0 * v1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, vector4f_arg1 v1, vector4f_arg2 v2) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, vector4f_arg1 v1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON64_INTRINSICS)
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_sub(v2, vector_mul(v0, v1));
+#endif
+#if defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vfmsq_f32(v2, v0, v1);
 #elif defined(RTM_NEON_INTRINSICS)
 		return vmlsq_f32(v2, v0, v1);
+#elif defined(RTM_IMPL_USE_FMA)
+		return _mm_fnmadd_ps(v0, v1, v2);
 #else
 		return vector_sub(v2, vector_mul(v0, v1));
 #endif
@@ -1519,12 +2019,18 @@ namespace rtm
 	// Per component negative multiplication/subtraction of the three inputs: -((v0 * s1) - v2)
 	// This is mathematically equivalent to: v2 - (v0 * s1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, float s1, vector4f_arg2 v2) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, float s1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
-#if defined(RTM_NEON64_INTRINSICS)
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_sub(v2, vector_mul(v0, s1));
+#endif
+#if defined(RTM_NEON64_INTRINSICS) && !defined(RTM_DETERMINISTIC)
 		return vfmsq_n_f32(v2, v0, s1);
 #elif defined(RTM_NEON_INTRINSICS)
 		return vmlsq_n_f32(v2, v0, s1);
+#elif defined(RTM_IMPL_USE_FMA)
+		return _mm_fnmadd_ps(v0, _mm_set_ps1(s1), v2);
 #else
 		return vector_sub(v2, vector_mul(v0, s1));
 #endif
@@ -1535,64 +2041,238 @@ namespace rtm
 	// Per component negative multiplication/subtraction of the three inputs: -((v0 * s1) - v2)
 	// This is mathematically equivalent to: v2 - (v0 * s1)
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, scalarf_arg1 s1, vector4f_arg2 v2) RTM_NO_EXCEPT
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_neg_mul_sub(vector4f_arg0 v0, scalarf_arg1 s1, vector4f_arg2 v2) RTM_NO_EXCEPT
 	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_sub(v2, vector_mul(v0, s1));
+#endif
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm_fnmadd_ps(v0, _mm_shuffle_ps(s1.value, s1.value, _MM_SHUFFLE(0, 0, 0, 0)), v2);
+#else
 		return vector_sub(v2, vector_mul(v0, s1));
+#endif
 	}
 #endif
 
 	//////////////////////////////////////////////////////////////////////////
-	// Per component linear interpolation of the two inputs at the specified alpha.
-	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
-	// Interpolation is stable and will return 'start' when alpha is 0.0 and 'end' when it is 1.0.
-	// This is the same instruction count when FMA is present but it might be slightly slower
-	// due to the extra multiplication compared to: start + (alpha * (end - start)).
+	// Per component estimate of the reciprocal of the input: 1.0 / input
+	// The hardware estimate has 12 bits of precision with SSE and 8 bits with NEON.
+	// Each Newton-Raphson refinement step roughly doubles it: 1 step is enough for
+	// most lighting and normalization code and 2 steps are close to full precision.
+	// Refined estimates return NaN for a zero or infinite input.
+	// Without a hardware estimate, or with RTM_DETERMINISTIC, the exact reciprocal is returned.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_lerp(vector4f_arg0 start, vector4f_arg1 end, float alpha) RTM_NO_EXCEPT
+	template<uint32_t num_refinement_steps = 0>
+	inline vector4f RTM_SIMD_CALL vector_reciprocal_estimate(vector4f_arg0 input) RTM_NO_EXCEPT
 	{
-		// ((1.0 - alpha) * start) + (alpha * end) == (start - alpha * start) + (alpha * end)
-		return vector_mul_add(end, alpha, vector_neg_mul_sub(start, alpha, start));
+#if defined(RTM_DETERMINISTIC)
+		return vector_reciprocal(input);
+#elif defined(RTM_SSE2_INTRINSICS)
+		__m128 result = _mm_rcp_ps(input);
+
+		// Newton-Raphson iteration: x1 = x0 * (2.0 - (input * x0))
+		for (uint32_t step_index = num_refinement_steps; step_index != 0; --step_index)
+			result = _mm_mul_ps(result, vector_neg_mul_sub(input, result, vector_set(2.0F)));
+
+		return result;
+#elif defined(RTM_NEON_INTRINSICS)
+		float32x4_t result = vrecpeq_f32(input);
+
+		// Newton-Raphson iteration, vrecpsq_f32 calculates: 2.0 - (a * b)
+		for (uint32_t step_index = num_refinement_steps; step_index != 0; --step_index)
+			result = vmulq_f32(result, vrecpsq_f32(result, input));
+
+		return result;
+#else
+		return vector_reciprocal(input);
+#endif
 	}
 
-#if defined(RTM_SSE2_INTRINSICS)
 	//////////////////////////////////////////////////////////////////////////
-	// Per component linear interpolation of the two inputs at the specified alpha.
-	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
-	// Interpolation is stable and will return 'start' when alpha is 0.0 and 'end' when it is 1.0.
-	// This is the same instruction count when FMA is present but it might be slightly slower
-	// due to the extra multiplication compared to: start + (alpha * (end - start)).
+	// Per component estimate of the reciprocal square root of the input: 1.0 / sqrt(input)
+	// The hardware estimate has 12 bits of precision with SSE and 8 bits with NEON.
+	// Each Newton-Raphson refinement step roughly doubles it: 1 step is enough for
+	// most lighting and normalization code and 2 steps are close to full precision.
+	// Refined estimates return NaN for a zero or infinite input.
+	// Without a hardware estimate, or with RTM_DETERMINISTIC, the exact value is returned.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_lerp(vector4f_arg0 start, vector4f_arg1 end, scalarf_arg2 alpha) RTM_NO_EXCEPT
+	template<uint32_t num_refinement_steps = 0>
+	inline vector4f RTM_SIMD_CALL vector_sqrt_reciprocal_estimate(vector4f_arg0 input) RTM_NO_EXCEPT
 	{
-		// ((1.0 - alpha) * start) + (alpha * end) == (start - alpha * start) + (alpha * end)
-		const vector4f alpha_v = vector_set(alpha);
-		return vector_mul_add(end, alpha_v, vector_neg_mul_sub(start, alpha_v, start));
-	}
-#endif
+#if defined(RTM_DETERMINISTIC)
+		return vector_reciprocal(vector_sqrt(input));
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128 half_input = _mm_mul_ps(input, _mm_set_ps1(0.5F));
+		__m128 result = _mm_rsqrt_ps(input);
 
+		// Newton-Raphson iteration: x1 = x0 * (1.5 - (0.5 * input * x0 * x0))
+		for (uint32_t step_index = num_refinement_steps; step_index != 0; --step_index)
+			result = _mm_mul_ps(result, vector_neg_mul_sub(half_input, _mm_mul_ps(result, result), vector_set(1.5F)));
 
+		return result;
+#elif defined(RTM_NEON_INTRINSICS)
+		float32x4_t result = vrsqrteq_f32(input);
 
-	//////////////////////////////////////////////////////////////////////////
-	// Comparisons and masking
-	//////////////////////////////////////////////////////////////////////////
+		// Newton-Raphson iteration, vrsqrtsq_f32 calculates: (3.0 - (a * b)) / 2.0
+		for (uint32_t step_index = num_refinement_steps; step_index != 0; --step_index)
+			result = vmulq_f32(result, vrsqrtsq_f32(vmulq_f32(input, result), result));
 
+		return result;
+#else
+		return vector_reciprocal(vector_sqrt(input));
+#endif
+	}
 
 	//////////////////////////////////////////////////////////////////////////
-	// Returns per component ~0 if equal, otherwise 0: lhs == rhs ? ~0 : 0
+	// Per component reciprocal square root of the input: 1.0 / sqrt(input)
+	// Like scalar_sqrt_reciprocal(..), two Newton-Raphson steps refine the hardware
+	// estimate and a zero input returns NaN. With RTM_DETERMINISTIC, a square root
+	// and a division are used instead and a zero input returns infinity.
 	//////////////////////////////////////////////////////////////////////////
-	inline mask4f RTM_SIMD_CALL vector_equal(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+	inline vector4f RTM_SIMD_CALL vector_sqrt_reciprocal(vector4f_arg0 input) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
-		return _mm_cmpeq_ps(lhs, rhs);
-#elif defined(RTM_NEON_INTRINSICS)
-		return vreinterpretq_f32_u32(vceqq_f32(lhs, rhs));
-#else
-		return mask4f{ rtm_impl::get_mask_value(lhs.x == rhs.x), rtm_impl::get_mask_value(lhs.y == rhs.y), rtm_impl::get_mask_value(lhs.z == rhs.z), rtm_impl::get_mask_value(lhs.w == rhs.w) };
-#endif
+		return vector_sqrt_reciprocal_estimate<2>(input);
 	}
 
 	//////////////////////////////////////////////////////////////////////////
-	// Returns per component ~0 if less than, otherwise 0: lhs < rhs ? ~0 : 0
+	// Returns per component the degree 3 polynomial: c0 + c1 * x + ... + c3 * x^3
+	// Estrin's scheme is used: pairs of terms are evaluated independently and combined
+	// with powers of x^2 which shortens the dependency chain of Horner's method.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_polynomial(vector4f_arg0 x, float c0, float c1, float c2, float c3) RTM_NO_EXCEPT
+	{
+		const vector4f x2 = vector_mul(x, x);
+		const vector4f p01 = vector_mul_add(x, c1, vector_set(c0));
+		const vector4f p23 = vector_mul_add(x, c3, vector_set(c2));
+		return vector_mul_add(p23, x2, p01);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the degree 4 polynomial: c0 + c1 * x + ... + c4 * x^4
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_polynomial(vector4f_arg0 x, float c0, float c1, float c2, float c3, float c4) RTM_NO_EXCEPT
+	{
+		const vector4f x2 = vector_mul(x, x);
+		const vector4f x4 = vector_mul(x2, x2);
+		const vector4f p01 = vector_mul_add(x, c1, vector_set(c0));
+		const vector4f p23 = vector_mul_add(x, c3, vector_set(c2));
+		const vector4f p0123 = vector_mul_add(p23, x2, p01);
+		return vector_mul_add(x4, c4, p0123);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the degree 5 polynomial: c0 + c1 * x + ... + c5 * x^5
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_polynomial(vector4f_arg0 x, float c0, float c1, float c2, float c3, float c4, float c5) RTM_NO_EXCEPT
+	{
+		const vector4f x2 = vector_mul(x, x);
+		const vector4f x4 = vector_mul(x2, x2);
+		const vector4f p01 = vector_mul_add(x, c1, vector_set(c0));
+		const vector4f p23 = vector_mul_add(x, c3, vector_set(c2));
+		const vector4f p0123 = vector_mul_add(p23, x2, p01);
+		const vector4f p45 = vector_mul_add(x, c5, vector_set(c4));
+		return vector_mul_add(p45, x4, p0123);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the degree 6 polynomial: c0 + c1 * x + ... + c6 * x^6
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_polynomial(vector4f_arg0 x, float c0, float c1, float c2, float c3, float c4, float c5, float c6) RTM_NO_EXCEPT
+	{
+		const vector4f x2 = vector_mul(x, x);
+		const vector4f x4 = vector_mul(x2, x2);
+		const vector4f p01 = vector_mul_add(x, c1, vector_set(c0));
+		const vector4f p23 = vector_mul_add(x, c3, vector_set(c2));
+		const vector4f p0123 = vector_mul_add(p23, x2, p01);
+		const vector4f p45 = vector_mul_add(x, c5, vector_set(c4));
+		const vector4f p456 = vector_mul_add(x2, c6, p45);
+		return vector_mul_add(p456, x4, p0123);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the degree 7 polynomial: c0 + c1 * x + ... + c7 * x^7
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_polynomial(vector4f_arg0 x, float c0, float c1, float c2, float c3, float c4, float c5, float c6, float c7) RTM_NO_EXCEPT
+	{
+		const vector4f x2 = vector_mul(x, x);
+		const vector4f x4 = vector_mul(x2, x2);
+		const vector4f p01 = vector_mul_add(x, c1, vector_set(c0));
+		const vector4f p23 = vector_mul_add(x, c3, vector_set(c2));
+		const vector4f p0123 = vector_mul_add(p23, x2, p01);
+		const vector4f p45 = vector_mul_add(x, c5, vector_set(c4));
+		const vector4f p67 = vector_mul_add(x, c7, vector_set(c6));
+		const vector4f p4567 = vector_mul_add(p67, x2, p45);
+		return vector_mul_add(p4567, x4, p0123);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component linear interpolation of the two inputs at the specified alpha.
+	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
+	// Interpolation is stable and will return 'start' when alpha is 0.0 and 'end' when it is 1.0.
+	// This is the same instruction count when FMA is present but it might be slightly slower
+	// due to the extra multiplication compared to: start + (alpha * (end - start)).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_lerp(vector4f_arg0 start, vector4f_arg1 end, float alpha) RTM_NO_EXCEPT
+	{
+		// ((1.0 - alpha) * start) + (alpha * end) == (start - alpha * start) + (alpha * end)
+		return vector_mul_add(end, alpha, vector_neg_mul_sub(start, alpha, start));
+	}
+
+#if defined(RTM_SSE2_INTRINSICS)
+	//////////////////////////////////////////////////////////////////////////
+	// Per component linear interpolation of the two inputs at the specified alpha.
+	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
+	// Interpolation is stable and will return 'start' when alpha is 0.0 and 'end' when it is 1.0.
+	// This is the same instruction count when FMA is present but it might be slightly slower
+	// due to the extra multiplication compared to: start + (alpha * (end - start)).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_lerp(vector4f_arg0 start, vector4f_arg1 end, scalarf_arg2 alpha) RTM_NO_EXCEPT
+	{
+		// ((1.0 - alpha) * start) + (alpha * end) == (start - alpha * start) + (alpha * end)
+		const vector4f alpha_v = vector_set(alpha);
+		return vector_mul_add(end, alpha_v, vector_neg_mul_sub(start, alpha_v, start));
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component linear interpolation of the two inputs at the specified per component alpha.
+	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
+	// Interpolation is stable and will return 'start' when alpha is 0.0 and 'end' when it is 1.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_lerp(vector4f_arg0 start, vector4f_arg1 end, vector4f_arg2 alpha) RTM_NO_EXCEPT
+	{
+		// ((1.0 - alpha) * start) + (alpha * end) == (start - alpha * start) + (alpha * end)
+		return vector_mul_add(end, alpha, vector_neg_mul_sub(start, alpha, start));
+	}
+
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Comparisons and masking
+	//////////////////////////////////////////////////////////////////////////
+
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if equal, otherwise 0: lhs == rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4f RTM_SIMD_CALL vector_equal(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cmpeq_ps(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return vreinterpretq_f32_u32(vceqq_f32(lhs, rhs));
+#else
+		return mask4f{ rtm_impl::get_mask_value(lhs.x == rhs.x), rtm_impl::get_mask_value(lhs.y == rhs.y), rtm_impl::get_mask_value(lhs.z == rhs.z), rtm_impl::get_mask_value(lhs.w == rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if less than, otherwise 0: lhs < rhs ? ~0 : 0
 	//////////////////////////////////////////////////////////////////////////
 	inline mask4f RTM_SIMD_CALL vector_less_than(vector4f_arg0 lhs, vector4f_arg1 rhs) RTM_NO_EXCEPT
 	{
@@ -2173,6 +2853,227 @@ namespace rtm
 #endif
 	}
 
+	namespace rtm_impl
+	{
+#if defined(RTM_NEON_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns two components of the input selected at compile time.
+		// Every combination maps to at most two instructions.
+		//////////////////////////////////////////////////////////////////////////
+		template<mix4 comp0, mix4 comp1>
+		inline float32x2_t RTM_SIMD_CALL vector_swizzle2(float32x4_t input) RTM_NO_EXCEPT
+		{
+			const float32x2_t xy = vget_low_f32(input);
+			const float32x2_t zw = vget_high_f32(input);
+
+			const int lane0 = int(comp0) % 4;
+			const int lane1 = int(comp1) % 4;
+
+			if (static_condition<(int(comp0) % 4) == 0 && (int(comp1) % 4) == 1>::test())
+				return xy;
+
+			if (static_condition<(int(comp0) % 4) == 2 && (int(comp1) % 4) == 3>::test())
+				return zw;
+
+			if (static_condition<(int(comp0) % 4) == (int(comp1) % 4)>::test())
+				return vdup_lane_f32(lane0 < 2 ? xy : zw, lane0 % 2);
+
+			if (static_condition<(int(comp0) % 4) == 1 && (int(comp1) % 4) == 0>::test())
+				return vrev64_f32(xy);
+
+			if (static_condition<(int(comp0) % 4) == 3 && (int(comp1) % 4) == 2>::test())
+				return vrev64_f32(zw);
+
+			if (static_condition<(int(comp0) % 4) == 1 && (int(comp1) % 4) == 2>::test())
+				return vext_f32(xy, zw, 1);
+
+			if (static_condition<(int(comp0) % 4) == 3 && (int(comp1) % 4) == 0>::test())
+				return vext_f32(zw, xy, 1);
+
+			if (static_condition<(int(comp0) % 4) == 2 && (int(comp1) % 4) == 1>::test())
+				return vrev64_f32(vext_f32(xy, zw, 1));
+
+			if (static_condition<(int(comp0) % 4) == 0 && (int(comp1) % 4) == 3>::test())
+				return vrev64_f32(vext_f32(zw, xy, 1));
+
+			// Only [xz], [yw], [zx], and [wy] remain, the even or odd lanes of both halves
+			if (lane0 < 2)
+				return lane1 == 2 ? vuzp_f32(xy, zw).val[0] : vuzp_f32(xy, zw).val[1];
+			else
+				return lane1 == 0 ? vuzp_f32(zw, xy).val[0] : vuzp_f32(zw, xy).val[1];
+		}
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Permutes the components of a single input, selected at compile time.
+	// Only [xyzw] can be used. Every permutation maps to a single instruction with SSE
+	// and to the shortest NEON sequence (rev64, ext, zip, uzp, trn, dup, or a combine of two halves).
+	//////////////////////////////////////////////////////////////////////////
+	template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_swizzle(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		static_assert(rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_xyzw(comp2) && rtm_impl::is_mix_xyzw(comp3), "vector_swizzle only supports [xyzw]");
+
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+		{
+			const float4f input_ = std::bit_cast<float4f>(input);
+			const float values[4] = { input_.x, input_.y, input_.z, input_.w };
+			return vector_set(values[int(comp0)], values[int(comp1)], values[int(comp2)], values[int(comp3)]);
+		}
+#endif
+
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::y && comp2 == mix4::z && comp3 == mix4::w>::test())
+			return input;
+
+#if defined(RTM_SSE2_INTRINSICS)
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::y && comp2 == mix4::x && comp3 == mix4::y>::test())
+			return _mm_movelh_ps(input, input);
+
+		if (rtm_impl::static_condition<comp0 == mix4::z && comp1 == mix4::w && comp2 == mix4::z && comp3 == mix4::w>::test())
+			return _mm_movehl_ps(input, input);
+
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::x && comp2 == mix4::y && comp3 == mix4::y>::test())
+			return _mm_unpacklo_ps(input, input);
+
+		if (rtm_impl::static_condition<comp0 == mix4::z && comp1 == mix4::z && comp2 == mix4::w && comp3 == mix4::w>::test())
+			return _mm_unpackhi_ps(input, input);
+
+#if defined(RTM_SSE3_INTRINSICS)
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::x && comp2 == mix4::z && comp3 == mix4::z>::test())
+			return _mm_moveldup_ps(input);
+
+		if (rtm_impl::static_condition<comp0 == mix4::y && comp1 == mix4::y && comp2 == mix4::w && comp3 == mix4::w>::test())
+			return _mm_movehdup_ps(input);
+#endif
+
+		return _mm_shuffle_ps(input, input, _MM_SHUFFLE(int(comp3), int(comp2), int(comp1), int(comp0)));
+#elif defined(RTM_NEON_INTRINSICS)
+		// Broadcast
+		if (rtm_impl::static_condition<comp0 == comp1 && comp0 == comp2 && comp0 == comp3>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vdupq_laneq_f32(input, int(comp0));
+#else
+			return vdupq_lane_f32(int(comp0) < 2 ? vget_low_f32(input) : vget_high_f32(input), int(comp0) % 2);
+#endif
+		}
+
+		// Swap within each half
+		if (rtm_impl::static_condition<comp0 == mix4::y && comp1 == mix4::x && comp2 == mix4::w && comp3 == mix4::z>::test())
+			return vrev64q_f32(input);
+
+		// Rotations
+		if (rtm_impl::static_condition<comp0 == mix4::y && comp1 == mix4::z && comp2 == mix4::w && comp3 == mix4::x>::test())
+			return vextq_f32(input, input, 1);
+
+		if (rtm_impl::static_condition<comp0 == mix4::z && comp1 == mix4::w && comp2 == mix4::x && comp3 == mix4::y>::test())
+			return vextq_f32(input, input, 2);
+
+		if (rtm_impl::static_condition<comp0 == mix4::w && comp1 == mix4::x && comp2 == mix4::y && comp3 == mix4::z>::test())
+			return vextq_f32(input, input, 3);
+
+		// Interleaves
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::x && comp2 == mix4::y && comp3 == mix4::y>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vzip1q_f32(input, input);
+#else
+			return vzipq_f32(input, input).val[0];
+#endif
+		}
+
+		if (rtm_impl::static_condition<comp0 == mix4::z && comp1 == mix4::z && comp2 == mix4::w && comp3 == mix4::w>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vzip2q_f32(input, input);
+#else
+			return vzipq_f32(input, input).val[1];
+#endif
+		}
+
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::x && comp2 == mix4::z && comp3 == mix4::z>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vtrn1q_f32(input, input);
+#else
+			return vtrnq_f32(input, input).val[0];
+#endif
+		}
+
+		if (rtm_impl::static_condition<comp0 == mix4::y && comp1 == mix4::y && comp2 == mix4::w && comp3 == mix4::w>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vtrn2q_f32(input, input);
+#else
+			return vtrnq_f32(input, input).val[1];
+#endif
+		}
+
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::z && comp2 == mix4::x && comp3 == mix4::z>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vuzp1q_f32(input, input);
+#else
+			return vuzpq_f32(input, input).val[0];
+#endif
+		}
+
+		if (rtm_impl::static_condition<comp0 == mix4::y && comp1 == mix4::w && comp2 == mix4::y && comp3 == mix4::w>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vuzp2q_f32(input, input);
+#else
+			return vuzpq_f32(input, input).val[1];
+#endif
+		}
+
+		// Everything else is built from two halves
+		return vcombine_f32(rtm_impl::vector_swizzle2<comp0, comp1>(input), rtm_impl::vector_swizzle2<comp2, comp3>(input));
+#else
+		return vector_set(vector_get_component<comp0>(input), vector_get_component<comp1>(input), vector_get_component<comp2>(input), vector_get_component<comp3>(input));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns two components of the first input followed by two components of the second input,
+	// selected at compile time like '_mm_shuffle_ps'.
+	// [comp0, comp1] must be in [xyzw] and [comp2, comp3] must be in [abcd].
+	// Every combination maps to a single instruction with SSE and to a combine of two halves with NEON.
+	//////////////////////////////////////////////////////////////////////////
+	template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_shuffle(vector4f_arg0 input0, vector4f_arg1 input1) RTM_NO_EXCEPT
+	{
+		static_assert(rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1), "vector_shuffle expects [xyzw] for the first two components");
+		static_assert(rtm_impl::is_mix_abcd(comp2) && rtm_impl::is_mix_abcd(comp3), "vector_shuffle expects [abcd] for the last two components");
+
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+		{
+			const float4f input0_ = std::bit_cast<float4f>(input0);
+			const float4f input1_ = std::bit_cast<float4f>(input1);
+			const float values0[4] = { input0_.x, input0_.y, input0_.z, input0_.w };
+			const float values1[4] = { input1_.x, input1_.y, input1_.z, input1_.w };
+			return vector_set(values0[int(comp0)], values0[int(comp1)], values1[int(comp2) % 4], values1[int(comp3) % 4]);
+		}
+#endif
+
+#if defined(RTM_SSE2_INTRINSICS)
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::y && comp2 == mix4::a && comp3 == mix4::b>::test())
+			return _mm_movelh_ps(input0, input1);
+
+		if (rtm_impl::static_condition<comp0 == mix4::z && comp1 == mix4::w && comp2 == mix4::c && comp3 == mix4::d>::test())
+			return _mm_movehl_ps(input1, input0);
+
+		return _mm_shuffle_ps(input0, input1, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1), int(comp0)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vcombine_f32(rtm_impl::vector_swizzle2<comp0, comp1>(input0), rtm_impl::vector_swizzle2<comp2, comp3>(input1));
+#else
+		return vector_set(vector_get_component<comp0>(input0), vector_get_component<comp1>(input0), vector_get_component<comp2>(input1), vector_get_component<comp3>(input1));
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Mixes two inputs and returns the desired components.
 	// [xyzw] indexes into the first input while [abcd] indexes in the second.
@@ -2180,23 +3081,45 @@ namespace rtm
 	template<mix4 comp0, mix4 comp1, mix4 comp2, mix4 comp3>
 	inline vector4f RTM_SIMD_CALL vector_mix(vector4f_arg0 input0, vector4f_arg1 input1) RTM_NO_EXCEPT
 	{
-#if defined(RTM_SSE2_INTRINSICS)
 		// All four components come from input 0
-		if (rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_xyzw(comp2) && rtm_impl::is_mix_xyzw(comp3))
-			return _mm_shuffle_ps(input0, input0, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1) % 4, int(comp0) % 4));
+		if (rtm_impl::static_condition<rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_xyzw(comp2) && rtm_impl::is_mix_xyzw(comp3)>::test())
+			return vector_swizzle<rtm_impl::mix_to_xyzw(comp0), rtm_impl::mix_to_xyzw(comp1), rtm_impl::mix_to_xyzw(comp2), rtm_impl::mix_to_xyzw(comp3)>(input0);
 
 		// All four components come from input 1
-		if (rtm_impl::is_mix_abcd(comp0) && rtm_impl::is_mix_abcd(comp1) && rtm_impl::is_mix_abcd(comp2) && rtm_impl::is_mix_abcd(comp3))
-			return _mm_shuffle_ps(input1, input1, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1) % 4, int(comp0) % 4));
+		if (rtm_impl::static_condition<rtm_impl::is_mix_abcd(comp0) && rtm_impl::is_mix_abcd(comp1) && rtm_impl::is_mix_abcd(comp2) && rtm_impl::is_mix_abcd(comp3)>::test())
+			return vector_swizzle<rtm_impl::mix_to_xyzw(comp0), rtm_impl::mix_to_xyzw(comp1), rtm_impl::mix_to_xyzw(comp2), rtm_impl::mix_to_xyzw(comp3)>(input1);
 
 		// First two components come from input 0, second two come from input 1
-		if (rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_abcd(comp2) && rtm_impl::is_mix_abcd(comp3))
-			return _mm_shuffle_ps(input0, input1, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1) % 4, int(comp0) % 4));
+		if (rtm_impl::static_condition<rtm_impl::is_mix_xyzw(comp0) && rtm_impl::is_mix_xyzw(comp1) && rtm_impl::is_mix_abcd(comp2) && rtm_impl::is_mix_abcd(comp3)>::test())
+			return vector_shuffle<rtm_impl::mix_to_xyzw(comp0), rtm_impl::mix_to_xyzw(comp1), rtm_impl::mix_to_abcd(comp2), rtm_impl::mix_to_abcd(comp3)>(input0, input1);
 
 		// First two components come from input 1, second two come from input 0
-		if (rtm_impl::is_mix_abcd(comp0) && rtm_impl::is_mix_abcd(comp1) && rtm_impl::is_mix_xyzw(comp2) && rtm_impl::is_mix_xyzw(comp3))
-			return _mm_shuffle_ps(input1, input0, _MM_SHUFFLE(int(comp3) % 4, int(comp2) % 4, int(comp1) % 4, int(comp0) % 4));
+		if (rtm_impl::static_condition<rtm_impl::is_mix_abcd(comp0) && rtm_impl::is_mix_abcd(comp1) && rtm_impl::is_mix_xyzw(comp2) && rtm_impl::is_mix_xyzw(comp3)>::test())
+			return vector_shuffle<rtm_impl::mix_to_xyzw(comp0), rtm_impl::mix_to_xyzw(comp1), rtm_impl::mix_to_abcd(comp2), rtm_impl::mix_to_abcd(comp3)>(input1, input0);
+
+#if defined(RTM_NEON_INTRINSICS)
+		// Low words from both inputs are interleaved
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::a && comp2 == mix4::y && comp3 == mix4::b>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vzip1q_f32(input0, input1);
+#else
+			return vzipq_f32(input0, input1).val[0];
+#endif
+		}
+
+		// High words from both inputs are interleaved
+		if (rtm_impl::static_condition<comp0 == mix4::z && comp1 == mix4::c && comp2 == mix4::w && comp3 == mix4::d>::test())
+		{
+#if defined(RTM_NEON64_INTRINSICS)
+			return vzip2q_f32(input0, input1);
+#else
+			return vzipq_f32(input0, input1).val[1];
+#endif
+		}
+#endif
 
+#if defined(RTM_SSE2_INTRINSICS)
 		// Low words from both inputs are interleaved
 		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::a && comp2 == mix4::y && comp3 == mix4::b>::test())
 			return _mm_unpacklo_ps(input0, input1);
@@ -2212,6 +3135,18 @@ namespace rtm
 		// High words from both inputs are interleaved
 		if (rtm_impl::static_condition<comp0 == mix4::c && comp1 == mix4::z && comp2 == mix4::d && comp3 == mix4::w>::test())
 			return _mm_unpackhi_ps(input1, input0);
+
+		// First three components come from input 0, the last one comes from input 1 (e.g. a vector3 with a new [w])
+		if (rtm_impl::static_condition<comp0 == mix4::x && comp1 == mix4::y && comp2 == mix4::z && rtm_impl::is_mix_abcd(comp3)>::test())
+		{
+#if defined(RTM_SSE4_INTRINSICS)
+			if (rtm_impl::static_condition<comp3 == mix4::d>::test())
+				return _mm_blend_ps(input0, input1, 8);
+#endif
+
+			const __m128 z0_z0_w1_w1 = _mm_shuffle_ps(input0, input1, _MM_SHUFFLE(int(comp3) % 4, int(comp3) % 4, 2, 2));
+			return _mm_shuffle_ps(input0, z0_z0_w1_w1, _MM_SHUFFLE(2, 0, 1, 0));
+		}
 #endif	// defined(RTM_SSE2_INTRINSICS)
 
 		// Slow code path, not yet optimized or not using intrinsics
@@ -2225,22 +3160,50 @@ namespace rtm
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [x] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_dup_x(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_mix<mix4::x, mix4::x, mix4::x, mix4::x>(input, input); }
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_dup_x(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_set(std::bit_cast<float4f>(input).x);
+#endif
+		return vector_mix<mix4::x, mix4::x, mix4::x, mix4::x>(input, input);
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [y] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_dup_y(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_mix<mix4::y, mix4::y, mix4::y, mix4::y>(input, input); }
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_dup_y(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_set(std::bit_cast<float4f>(input).y);
+#endif
+		return vector_mix<mix4::y, mix4::y, mix4::y, mix4::y>(input, input);
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [z] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_dup_z(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_mix<mix4::z, mix4::z, mix4::z, mix4::z>(input, input); }
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_dup_z(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_set(std::bit_cast<float4f>(input).z);
+#endif
+		return vector_mix<mix4::z, mix4::z, mix4::z, mix4::z>(input, input);
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Replicates the [w] component in all components.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_dup_w(vector4f_arg0 input) RTM_NO_EXCEPT { return vector_mix<mix4::w, mix4::w, mix4::w, mix4::w>(input, input); }
+	RTM_CONSTEXPR_EVAL vector4f RTM_SIMD_CALL vector_dup_w(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+		if (std::is_constant_evaluated())
+			return vector_set(std::bit_cast<float4f>(input).w);
+#endif
+		return vector_mix<mix4::w, mix4::w, mix4::w, mix4::w>(input, input);
+	}
 
 	//////////////////////////////////////////////////////////////////////////
 	// Miscellaneous
@@ -2314,6 +3277,15 @@ namespace rtm
 		__m128 is_positive = _mm_cmpge_ps(input, _mm_setzero_ps());
 
 		return vector_select(is_positive, floored, ceiled);
+#elif defined(RTM_WASM_SIMD128_INTRINSICS)
+		const v128_t input_v128 = (v128_t)input;
+		const v128_t is_input_large = wasm_f32x4_ge(wasm_f32x4_abs(input_v128), wasm_f32x4_splat(8388608.0F)); // 2^23
+
+		// Add a bias of 0.5 with the sign of the input and truncate towards zero
+		const v128_t bias = wasm_v128_or(wasm_v128_and(input_v128, wasm_f32x4_splat(-0.0F)), wasm_f32x4_splat(0.5F));
+		const v128_t integer_part = wasm_f32x4_trunc(wasm_f32x4_add(input_v128, bias));
+
+		return (__m128)wasm_v128_bitselect(input_v128, integer_part, is_input_large);
 #elif defined(RTM_SSE2_INTRINSICS)
 		const __m128i abs_mask = _mm_set_epi32(0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL);
 		const __m128 fractional_limit = _mm_set_ps1(8388608.0F); // 2^23
@@ -2340,6 +3312,9 @@ namespace rtm
 		// Convert to an integer with truncation and back, this rounds towards zero.
 		__m128 integer_part = _mm_cvtepi32_ps(_mm_cvttps_epi32(biased_input));
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = _mm_or_ps(integer_part, sign);
+
 		return _mm_or_ps(_mm_and_ps(use_original_input, input), _mm_andnot_ps(use_original_input, integer_part));
 #elif defined(RTM_NEON_INTRINSICS) && !defined(RTM_NEON64_INTRINSICS) // arm64 is faster with scalar code
 		// NaN, +- Infinity, and numbers larger or equal to 2^23 remain unchanged
@@ -2367,6 +3342,9 @@ namespace rtm
 		// Convert to an integer and back. This does banker's rounding by default
 		float32x4_t integer_part = vcvtq_f32_s32(vcvtq_s32_f32(biased_input));
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(integer_part), sign));
+
 		return vbslq_f32(use_original_input, input, integer_part);
 #else
 		const vector4f half = vector_set(0.5F);
@@ -2403,6 +3381,8 @@ namespace rtm
 	{
 #if defined(RTM_SSE4_INTRINSICS)
 		return _mm_round_ps(input, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+#elif defined(RTM_WASM_SIMD128_INTRINSICS)
+		return (__m128)wasm_f32x4_nearest((v128_t)input);
 #elif defined(RTM_SSE2_INTRINSICS)
 		const __m128 sign_mask = _mm_set_ps(-0.0F, -0.0F, -0.0F, -0.0F);
 		__m128 sign = _mm_and_ps(input, sign_mask);
@@ -2416,6 +3396,9 @@ namespace rtm
 		__m128 truncating_offset = _mm_or_ps(sign, fractional_limit);
 		__m128 integer_part = _mm_sub_ps(_mm_add_ps(input, truncating_offset), truncating_offset);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = _mm_or_ps(integer_part, sign);
+
 		// If our input was so large that it had no fractional part, return it unchanged
 		// Otherwise return our integer part
 		const __m128i abs_mask = _mm_set_epi32(0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL);
@@ -2436,6 +3419,9 @@ namespace rtm
 		float32x4_t truncating_offset = vreinterpretq_f32_u32(vorrq_u32(sign, vreinterpretq_u32_f32(fractional_limit)));
 		float32x4_t integer_part = vsubq_f32(vaddq_f32(input, truncating_offset), truncating_offset);
 
+		// Keep the sign of the input to return -0.0 like the C math library does
+		integer_part = vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(integer_part), sign));
+
 		// If our input was so large that it had no fractional part, return it unchanged
 		// Otherwise return our integer part
 		uint32x4_t is_input_large = vcageq_f32(input, fractional_limit);
@@ -2483,11 +3469,7 @@ namespace rtm
 
 		// Calculate our value
 		const __m128 x2 = _mm_mul_ps(x, x);
-		__m128 result = _mm_add_ps(_mm_mul_ps(x2, _mm_set_ps1(-2.3828544692960918e-8F)), _mm_set_ps1(2.7521557770526783e-6F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(-1.9840782426250314e-4F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(8.3333303183525942e-3F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(-1.6666666601721269e-1F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(1.0F));
+		__m128 result = vector_polynomial(x2, 1.0F, -1.6666666601721269e-1F, 8.3333303183525942e-3F, -1.9840782426250314e-4F, 2.7521557770526783e-6F, -2.3828544692960918e-8F);
 		result = _mm_mul_ps(result, x);
 		return result;
 #elif defined(RTM_NEON_INTRINSICS)
@@ -2516,19 +3498,7 @@ namespace rtm
 		// Calculate our value
 		float32x4_t x2 = vmulq_f32(x, x);
 
-#if defined(RTM_NEON64_INTRINSICS)
-		float32x4_t result = vfmaq_n_f32(vdupq_n_f32(2.7521557770526783e-6F), x2, -2.3828544692960918e-8F);
-		result = vfmaq_f32(vdupq_n_f32(-1.9840782426250314e-4F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(8.3333303183525942e-3F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(-1.6666666601721269e-1F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(1.0F), result, x2);
-#else
-		float32x4_t result = vmlaq_n_f32(vdupq_n_f32(2.7521557770526783e-6F), x2, -2.3828544692960918e-8F);
-		result = vmlaq_f32(vdupq_n_f32(-1.9840782426250314e-4F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(8.3333303183525942e-3F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(-1.6666666601721269e-1F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(1.0F), result, x2);
-#endif
+		float32x4_t result = vector_polynomial(x2, 1.0F, -1.6666666601721269e-1F, 8.3333303183525942e-3F, -1.9840782426250314e-4F, 2.7521557770526783e-6F, -2.3828544692960918e-8F);
 
 		result = vmulq_f32(result, x);
 		return result;
@@ -2557,13 +3527,7 @@ namespace rtm
 		__m128 abs_value = _mm_andnot_ps(sign_bit, input);
 
 		// Calculate our value
-		__m128 result = _mm_add_ps(_mm_mul_ps(abs_value, _mm_set_ps1(-1.2690614339589956e-3F)), _mm_set_ps1(6.7072304676685235e-3F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(-1.7162031184398074e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(3.0961594977611639e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(-5.0207843052845647e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(8.8986946573346160e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(-2.1459960076929829e-1F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(1.5707963267948966F));
+		__m128 result = vector_polynomial(abs_value, 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F);
 
 		// Scale our result
 		__m128 scale = _mm_sqrt_ps(_mm_sub_ps(_mm_set_ps1(1.0F), abs_value));
@@ -2623,11 +3587,7 @@ namespace rtm
 
 		// Calculate our value
 		const __m128 x2 = _mm_mul_ps(x, x);
-		__m128 result = _mm_add_ps(_mm_mul_ps(x2, _mm_set_ps1(-2.6051615464872668e-7F)), _mm_set_ps1(2.4760495088926859e-5F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(-1.3888377661039897e-3F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(4.1666638865338612e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(-4.9999999508695869e-1F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(1.0F));
+		__m128 result = vector_polynomial(x2, 1.0F, -4.9999999508695869e-1F, 4.1666638865338612e-2F, -1.3888377661039897e-3F, 2.4760495088926859e-5F, -2.6051615464872668e-7F);
 
 		// Remap into [-pi, pi]
 		return _mm_or_ps(result, _mm_andnot_ps(is_less_equal_than_half_pi, sign_mask));
@@ -2657,19 +3617,7 @@ namespace rtm
 		// Calculate our value
 		float32x4_t x2 = vmulq_f32(x, x);
 
-#if defined(RTM_NEON64_INTRINSICS)
-		float32x4_t result = vfmaq_n_f32(vdupq_n_f32(2.4760495088926859e-5F), x2, -2.6051615464872668e-7F);
-		result = vfmaq_f32(vdupq_n_f32(-1.3888377661039897e-3F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(4.1666638865338612e-2F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(-4.9999999508695869e-1F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(1.0F), result, x2);
-#else
-		float32x4_t result = vmlaq_n_f32(vdupq_n_f32(2.4760495088926859e-5F), x2, -2.6051615464872668e-7F);
-		result = vmlaq_f32(vdupq_n_f32(-1.3888377661039897e-3F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(4.1666638865338612e-2F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(-4.9999999508695869e-1F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(1.0F), result, x2);
-#endif
+		float32x4_t result = vector_polynomial(x2, 1.0F, -4.9999999508695869e-1F, 4.1666638865338612e-2F, -1.3888377661039897e-3F, 2.4760495088926859e-5F, -2.6051615464872668e-7F);
 
 		// Remap into [-pi, pi]
 		return vbslq_f32(is_less_equal_than_half_pi, result, vnegq_f32(result));
@@ -2683,38 +3631,114 @@ namespace rtm
 	}
 
 	//////////////////////////////////////////////////////////////////////////
-	// Returns per component the arc-cosine of the input.
-	// Input value must be in the range [-1.0, 1.0].
+	// Returns per component both the sine and cosine of the input angle.
+	// The range reduction is only performed once and the results match
+	// vector_sin and vector_cos exactly.
 	//////////////////////////////////////////////////////////////////////////
-	inline vector4f RTM_SIMD_CALL vector_acos(vector4f_arg0 input) RTM_NO_EXCEPT
+	inline void RTM_SIMD_CALL vector_sincos(vector4f_arg0 input, vector4f& out_sin, vector4f& out_cos) RTM_NO_EXCEPT
 	{
 #if defined(RTM_SSE2_INTRINSICS)
-		// Use the identity: acos(value) + asin(value) = PI/2
-		// This ends up being: acos(value) = PI/2 - asin(value)
-		// Since asin(value) = PI/2 - sqrt(1.0 - polynomial(value))
-		// Our end result is acos(value) = sqrt(1.0 - polynomial(value))
-		// This means we can re-use the same polynomial as asin()
+		// Use a degree 11 minimax approximation polynomial for sine and degree 10 for cosine
 		// See: GPGPU Programming for Games and Science (David H. Eberly)
 
-		// We first calculate our scale: sqrt(1.0 - abs(value))
-		// Use the sign bit to generate our absolute value since we'll re-use that constant
-		const __m128 sign_bit = _mm_set_ps1(-0.0F);
-		__m128 abs_value = _mm_andnot_ps(sign_bit, input);
-
-		// Calculate our value
-		__m128 result = _mm_add_ps(_mm_mul_ps(abs_value, _mm_set_ps1(-1.2690614339589956e-3F)), _mm_set_ps1(6.7072304676685235e-3F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(-1.7162031184398074e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(3.0961594977611639e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(-5.0207843052845647e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(8.8986946573346160e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(-2.1459960076929829e-1F));
-		result = _mm_add_ps(_mm_mul_ps(result, abs_value), _mm_set_ps1(1.5707963267948966F));
+		// Remap our input in the [-pi, pi] range
+		__m128 quotient = _mm_mul_ps(input, _mm_set_ps1(rtm::constants::one_div_two_pi()));
+		quotient = vector_round_bankers(quotient);
+		quotient = _mm_mul_ps(quotient, _mm_set_ps1(rtm::constants::two_pi()));
+		__m128 x = _mm_sub_ps(input, quotient);
 
-		// Scale our result
-		__m128 scale = _mm_sqrt_ps(_mm_sub_ps(_mm_set_ps1(1.0F), abs_value));
-		result = _mm_mul_ps(result, scale);
+		// Remap our input in the [-pi/2, pi/2] range
+		const __m128 sign_mask = _mm_set_ps(-0.0F, -0.0F, -0.0F, -0.0F);
+		__m128 sign = _mm_and_ps(x, sign_mask);
+		__m128 reference = _mm_or_ps(sign, _mm_set_ps1(rtm::constants::pi()));
 
-		// Normally the math is as follow:
+		const __m128 reflection = _mm_sub_ps(reference, x);
+		const __m128i abs_mask = _mm_set_epi32(0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL, 0x7FFFFFFFULL);
+		const __m128 x_abs = _mm_and_ps(x, _mm_castsi128_ps(abs_mask));
+
+		__m128 is_less_equal_than_half_pi = _mm_cmple_ps(x_abs, _mm_set_ps1(rtm::constants::half_pi()));
+
+#if defined(RTM_AVX_INTRINSICS)
+		x = _mm_blendv_ps(reflection, x, is_less_equal_than_half_pi);
+#else
+		x = _mm_or_ps(_mm_andnot_ps(is_less_equal_than_half_pi, reflection), _mm_and_ps(x, is_less_equal_than_half_pi));
+#endif
+
+		// Calculate our values, both polynomials are independent so their evaluation can overlap
+		const __m128 x2 = _mm_mul_ps(x, x);
+		__m128 sin_result = vector_polynomial(x2, 1.0F, -1.6666666601721269e-1F, 8.3333303183525942e-3F, -1.9840782426250314e-4F, 2.7521557770526783e-6F, -2.3828544692960918e-8F);
+		__m128 cos_result = vector_polynomial(x2, 1.0F, -4.9999999508695869e-1F, 4.1666638865338612e-2F, -1.3888377661039897e-3F, 2.4760495088926859e-5F, -2.6051615464872668e-7F);
+
+		out_sin = _mm_mul_ps(sin_result, x);
+
+		// Remap into [-pi, pi]
+		out_cos = _mm_or_ps(cos_result, _mm_andnot_ps(is_less_equal_than_half_pi, sign_mask));
+#elif defined(RTM_NEON_INTRINSICS)
+		// Use a degree 11 minimax approximation polynomial for sine and degree 10 for cosine
+		// See: GPGPU Programming for Games and Science (David H. Eberly)
+
+		// Remap our input in the [-pi, pi] range
+		float32x4_t quotient = vmulq_n_f32(input, rtm::constants::one_div_two_pi());
+		quotient = vector_round_bankers(quotient);
+		quotient = vmulq_n_f32(quotient, rtm::constants::two_pi());
+		float32x4_t x = vsubq_f32(input, quotient);
+
+		// Remap our input in the [-pi/2, pi/2] range
+		uint32x4_t sign_mask = vreinterpretq_u32_f32(vdupq_n_f32(-0.0F));
+		uint32x4_t sign = vandq_u32(vreinterpretq_u32_f32(x), sign_mask);
+		float32x4_t reference = vreinterpretq_f32_u32(vorrq_u32(sign, vreinterpretq_u32_f32(vdupq_n_f32(rtm::constants::pi()))));
+
+		float32x4_t reflection = vsubq_f32(reference, x);
+#if defined(RTM_COMPILER_MSVC) && _MSC_VER < 1920
+		float32x4_t is_less_equal_than_half_pi = vcleq_f32(vabsq_f32(x), vdupq_n_f32(rtm::constants::half_pi()));
+#else
+		float32x4_t is_less_equal_than_half_pi = vcaleq_f32(x, vdupq_n_f32(rtm::constants::half_pi()));
+#endif
+		x = vbslq_f32(is_less_equal_than_half_pi, x, reflection);
+
+		// Calculate our values, both polynomials are independent so their evaluation can overlap
+		float32x4_t x2 = vmulq_f32(x, x);
+
+		float32x4_t sin_result = vector_polynomial(x2, 1.0F, -1.6666666601721269e-1F, 8.3333303183525942e-3F, -1.9840782426250314e-4F, 2.7521557770526783e-6F, -2.3828544692960918e-8F);
+		float32x4_t cos_result = vector_polynomial(x2, 1.0F, -4.9999999508695869e-1F, 4.1666638865338612e-2F, -1.3888377661039897e-3F, 2.4760495088926859e-5F, -2.6051615464872668e-7F);
+
+		out_sin = vmulq_f32(sin_result, x);
+
+		// Remap into [-pi, pi]
+		out_cos = vbslq_f32(is_less_equal_than_half_pi, cos_result, vnegq_f32(cos_result));
+#else
+		out_sin = vector_sin(input);
+		out_cos = vector_cos(input);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-cosine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_acos(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// Use the identity: acos(value) + asin(value) = PI/2
+		// This ends up being: acos(value) = PI/2 - asin(value)
+		// Since asin(value) = PI/2 - sqrt(1.0 - polynomial(value))
+		// Our end result is acos(value) = sqrt(1.0 - polynomial(value))
+		// This means we can re-use the same polynomial as asin()
+		// See: GPGPU Programming for Games and Science (David H. Eberly)
+
+		// We first calculate our scale: sqrt(1.0 - abs(value))
+		// Use the sign bit to generate our absolute value since we'll re-use that constant
+		const __m128 sign_bit = _mm_set_ps1(-0.0F);
+		__m128 abs_value = _mm_andnot_ps(sign_bit, input);
+
+		// Calculate our value
+		__m128 result = vector_polynomial(abs_value, 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F);
+
+		// Scale our result
+		__m128 scale = _mm_sqrt_ps(_mm_sub_ps(_mm_set_ps1(1.0F), abs_value));
+		result = _mm_mul_ps(result, scale);
+
+		// Normally the math is as follow:
 		// If input is positive: result
 		// If input is negative: PI - result = -result + PI
 
@@ -2741,8 +3765,9 @@ namespace rtm
 	inline vector4f RTM_SIMD_CALL vector_tan(vector4f_arg0 angle) RTM_NO_EXCEPT
 	{
 		// Use the identity: tan(angle) = sin(angle) / cos(angle)
-		vector4f sin_ = vector_sin(angle);
-		vector4f cos_ = vector_cos(angle);
+		vector4f sin_;
+		vector4f cos_;
+		vector_sincos(angle, sin_, cos_);
 
 		mask4f is_cos_zero = vector_equal(cos_, vector_zero());
 		vector4f signed_infinity = vector_copy_sign(vector_set(std::numeric_limits<float>::infinity()), angle);
@@ -2773,12 +3798,7 @@ namespace rtm
 
 		__m128 x2 = _mm_mul_ps(x, x);
 
-		__m128 result = _mm_add_ps(_mm_mul_ps(x2, _mm_set_ps1(7.2128853633444123e-3F)), _mm_set_ps1(-3.5059680836411644e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(8.1675882859940430e-2F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(-1.3374657325451267e-1F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(1.9856563505717162e-1F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(-3.3324998579202170e-1F));
-		result = _mm_add_ps(_mm_mul_ps(result, x2), _mm_set_ps1(1.0F));
+		__m128 result = vector_polynomial(x2, 1.0F, -3.3324998579202170e-1F, 1.9856563505717162e-1F, -1.3374657325451267e-1F, 8.1675882859940430e-2F, -3.5059680836411644e-2F, 7.2128853633444123e-3F);
 		result = _mm_mul_ps(result, x);
 
 		__m128 remapped = _mm_sub_ps(_mm_set_ps1(rtm::constants::half_pi()), result);
@@ -2807,21 +3827,7 @@ namespace rtm
 
 		float32x4_t x2 = vmulq_f32(x, x);
 
-#if defined(RTM_NEON64_INTRINSICS)
-		float32x4_t result = vfmaq_n_f32(vdupq_n_f32(-3.5059680836411644e-2F), x2, 7.2128853633444123e-3F);
-		result = vfmaq_f32(vdupq_n_f32(8.1675882859940430e-2F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(-1.3374657325451267e-1F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(1.9856563505717162e-1F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(-3.3324998579202170e-1F), result, x2);
-		result = vfmaq_f32(vdupq_n_f32(1.0F), result, x2);
-#else
-		float32x4_t result = vmlaq_n_f32(vdupq_n_f32(-3.5059680836411644e-2F), x2, 7.2128853633444123e-3F);
-		result = vmlaq_f32(vdupq_n_f32(8.1675882859940430e-2F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(-1.3374657325451267e-1F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(1.9856563505717162e-1F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(-3.3324998579202170e-1F), result, x2);
-		result = vmlaq_f32(vdupq_n_f32(1.0F), result, x2);
-#endif
+		float32x4_t result = vector_polynomial(x2, 1.0F, -3.3324998579202170e-1F, 1.9856563505717162e-1F, -1.3374657325451267e-1F, 8.1675882859940430e-2F, -3.5059680836411644e-2F, 7.2128853633444123e-3F);
 
 		result = vmulq_f32(result, x);
 
@@ -2942,6 +3948,643 @@ namespace rtm
 		return vector_set(x_, y_, z_, w_);
 #endif
 	}
+
+#if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS) || defined(RTM_DETERMINISTIC)
+	namespace rtm_impl
+	{
+#if !defined(RTM_SSE2_INTRINSICS) && !defined(RTM_NEON_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Scalar equivalents of the SIMD integer manipulations below, used by RTM_DETERMINISTIC.
+		//////////////////////////////////////////////////////////////////////////
+		inline float scalar_scale_exp2(float p, float n) RTM_NO_EXCEPT
+		{
+			const int32_t n_i32 = static_cast<int32_t>(n);
+			const int32_t n_lo = n_i32 >> 1;
+			const int32_t n_hi = n_i32 - n_lo;
+			const uint32_t scale_lo_bits = uint32_t(n_lo + 127) << 23;
+			const uint32_t scale_hi_bits = uint32_t(n_hi + 127) << 23;
+
+			float scale_lo;
+			float scale_hi;
+			std::memcpy(&scale_lo, &scale_lo_bits, sizeof(float));
+			std::memcpy(&scale_hi, &scale_hi_bits, sizeof(float));
+			return (p * scale_lo) * scale_hi;
+		}
+
+		inline float scalar_log_split(float input, float& out_exponent) RTM_NO_EXCEPT
+		{
+			const bool is_denormal = input < std::numeric_limits<float>::min();
+			const float normal_input = is_denormal ? (input * 8388608.0F) : input;
+			const float exponent_bias = is_denormal ? 23.0F : 0.0F;
+
+			uint32_t bits;
+			std::memcpy(&bits, &normal_input, sizeof(float));
+
+			const int32_t exponent = static_cast<int32_t>(bits - 0x3F3504F3U) >> 23;
+			out_exponent = float(exponent) - exponent_bias;
+
+			const uint32_t mantissa_bits = bits - (uint32_t(exponent) << 23);
+			float mantissa;
+			std::memcpy(&mantissa, &mantissa_bits, sizeof(float));
+			return mantissa;
+		}
+
+		inline float scalar_log_special_values(float input, float result) RTM_NO_EXCEPT
+		{
+			if (input >= 0.0F)
+				return result;
+
+			// Same NaN bits as the SIMD comparison mask
+			const uint32_t nan_bits = 0xFFFFFFFFU;
+			float nan;
+			std::memcpy(&nan, &nan_bits, sizeof(float));
+			return nan;
+		}
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per component the input rounded to the nearest integer, ties to even.
+		// The input magnitude must be lower than 2^31, this avoids the general
+		// rounding code path of vector_round_bankers on SSE2.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_round_small(vector4f_arg0 input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_WASM_SIMD128_INTRINSICS)
+			return (__m128)wasm_f32x4_nearest((v128_t)input);
+#elif defined(RTM_SSE2_INTRINSICS)
+			return _mm_cvtepi32_ps(_mm_cvtps_epi32(input));
+#else
+			return vector_round_bankers(input);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per component p * 2^n where n is an integral value in [-150, 128].
+		// The scale is split in two halves to reach the denormal and maximum ranges
+		// without overflowing the exponent bits.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_scale_exp2(vector4f_arg0 p, vector4f_arg1 n) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+#if defined(RTM_WASM_SIMD128_INTRINSICS)
+			// n is integral, truncating is exact
+			const __m128i n_i32 = (__m128i)wasm_i32x4_trunc_sat_f32x4((v128_t)n);
+#else
+			const __m128i n_i32 = _mm_cvtps_epi32(n);
+#endif
+			const __m128i n_lo = _mm_srai_epi32(n_i32, 1);
+			const __m128i n_hi = _mm_sub_epi32(n_i32, n_lo);
+			const __m128i bias = _mm_set1_epi32(127);
+			const __m128 scale_lo = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n_lo, bias), 23));
+			const __m128 scale_hi = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(n_hi, bias), 23));
+			return _mm_mul_ps(_mm_mul_ps(p, scale_lo), scale_hi);
+#elif defined(RTM_NEON_INTRINSICS)
+			const int32x4_t n_i32 = vcvtq_s32_f32(n);
+			const int32x4_t n_lo = vshrq_n_s32(n_i32, 1);
+			const int32x4_t n_hi = vsubq_s32(n_i32, n_lo);
+			const int32x4_t bias = vdupq_n_s32(127);
+			const float32x4_t scale_lo = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n_lo, bias), 23));
+			const float32x4_t scale_hi = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(n_hi, bias), 23));
+			return vmulq_f32(vmulq_f32(p, scale_lo), scale_hi);
+#else
+			return vector_set(scalar_scale_exp2(vector_get_x(p), vector_get_x(n)), scalar_scale_exp2(vector_get_y(p), vector_get_y(n)), scalar_scale_exp2(vector_get_z(p), vector_get_z(n)), scalar_scale_exp2(vector_get_w(p), vector_get_w(n)));
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Splits per component a positive finite input into a mantissa in [sqrt(0.5), sqrt(2.0))
+		// and its exponent such that: input = mantissa * 2^exponent
+		// Centering the mantissa around 1.0 keeps the logarithm polynomial input small.
+		// Denormals are scaled by 2^23 first to become normal.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_log_split(vector4f_arg0 input, vector4f& out_exponent) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			const __m128 is_denormal = _mm_cmplt_ps(input, _mm_set_ps1(std::numeric_limits<float>::min()));
+			const __m128 normal_input = vector_select(is_denormal, _mm_mul_ps(input, _mm_set_ps1(8388608.0F)), input);
+			const __m128 exponent_bias = _mm_and_ps(is_denormal, _mm_set_ps1(23.0F));
+
+			// Offsetting the bits by those of sqrt(0.5) moves the exponent boundary there
+			const __m128i bits = _mm_castps_si128(normal_input);
+			const __m128i exponent = _mm_srai_epi32(_mm_sub_epi32(bits, _mm_set1_epi32(0x3F3504F3)), 23);
+			out_exponent = _mm_sub_ps(_mm_cvtepi32_ps(exponent), exponent_bias);
+			return _mm_castsi128_ps(_mm_sub_epi32(bits, _mm_slli_epi32(exponent, 23)));
+#elif defined(RTM_NEON_INTRINSICS)
+			const uint32x4_t is_denormal = vcltq_f32(input, vdupq_n_f32(std::numeric_limits<float>::min()));
+			const float32x4_t normal_input = vbslq_f32(is_denormal, vmulq_n_f32(input, 8388608.0F), input);
+			const float32x4_t exponent_bias = vreinterpretq_f32_u32(vandq_u32(is_denormal, vreinterpretq_u32_f32(vdupq_n_f32(23.0F))));
+
+			// Offsetting the bits by those of sqrt(0.5) moves the exponent boundary there
+			const int32x4_t bits = vreinterpretq_s32_f32(normal_input);
+			const int32x4_t exponent = vshrq_n_s32(vsubq_s32(bits, vdupq_n_s32(0x3F3504F3)), 23);
+			out_exponent = vsubq_f32(vcvtq_f32_s32(exponent), exponent_bias);
+			return vreinterpretq_f32_s32(vsubq_s32(bits, vshlq_n_s32(exponent, 23)));
+#else
+			float exponent_x;
+			float exponent_y;
+			float exponent_z;
+			float exponent_w;
+			const float mantissa_x = scalar_log_split(vector_get_x(input), exponent_x);
+			const float mantissa_y = scalar_log_split(vector_get_y(input), exponent_y);
+			const float mantissa_z = scalar_log_split(vector_get_z(input), exponent_z);
+			const float mantissa_w = scalar_log_split(vector_get_w(input), exponent_w);
+			out_exponent = vector_set(exponent_x, exponent_y, exponent_z, exponent_w);
+			return vector_set(mantissa_x, mantissa_y, mantissa_z, mantissa_w);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per component log(mantissa) where input = mantissa * 2^exponent.
+		// The input must be positive and finite.
+		// See: Cephes Math Library (Stephen L. Moshier)
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_log_mantissa(vector4f_arg0 input, vector4f& out_exponent) RTM_NO_EXCEPT
+		{
+			const vector4f mantissa = vector_log_split(input, out_exponent);
+
+			// log(1 + x) = x - x^2 / 2 + x^3 * P(x) with a degree 8 polynomial P
+			const vector4f x = vector_sub(mantissa, vector_set(1.0F));
+			const vector4f x2 = vector_mul(x, x);
+			vector4f poly = vector_polynomial(x, -2.4999993993e-1F, 2.0000714765e-1F, -1.6668057665e-1F, 1.4249322787e-1F, -1.2420140846e-1F, 1.1676998740e-1F, -1.1514610310e-1F, 7.0376836292e-2F);
+			poly = vector_mul_add(poly, x, vector_set(3.3333331174e-1F));
+
+			const vector4f result = vector_neg_mul_sub(x2, 0.5F, vector_mul(vector_mul(x, x2), poly));
+			return vector_add(x, result);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns per component the logarithm with its special values patched:
+		// log(0) = -infinity, log(infinity) = infinity, log(negative) = NaN, log(NaN) = NaN
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4f RTM_SIMD_CALL vector_log_special_values(vector4f_arg0 input, vector4f_arg1 result) RTM_NO_EXCEPT
+		{
+			const vector4f infinity = vector_set(std::numeric_limits<float>::infinity());
+
+			vector4f patched_result = vector_select(vector_equal(input, vector_zero()), vector_neg(infinity), result);
+			patched_result = vector_select(vector_equal(input, infinity), infinity, patched_result);
+
+			// Negative and NaN inputs fail the comparison, their mask has every bit set which is a NaN
+#if defined(RTM_SSE2_INTRINSICS)
+			return _mm_or_ps(patched_result, _mm_cmpnge_ps(input, _mm_setzero_ps()));
+#elif defined(RTM_NEON_INTRINSICS)
+			return vreinterpretq_f32_u32(vorrq_u32(vreinterpretq_u32_f32(patched_result), vmvnq_u32(vcgeq_f32(input, vdupq_n_f32(0.0F)))));
+#else
+			return vector_set(scalar_log_special_values(vector_get_x(input), vector_get_x(patched_result)), scalar_log_special_values(vector_get_y(input), vector_get_y(patched_result)), scalar_log_special_values(vector_get_z(input), vector_get_z(patched_result)), scalar_log_special_values(vector_get_w(input), vector_get_w(patched_result)));
+#endif
+		}
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component 2 raised to the power of the input: 2^input
+	// Uses a degree 6 minimax approximation polynomial after range reduction.
+	// See: Cephes Math Library (Stephen L. Moshier)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_exp2(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS) || defined(RTM_DETERMINISTIC)
+		// Past these bounds, the result is either 0.0 or infinity
+		const vector4f x = vector_clamp(input, vector_set(-150.0F), vector_set(128.0F));
+
+		// 2^x = 2^n * 2^f with n integral and f in [-0.5, 0.5]
+		const vector4f n = rtm_impl::vector_round_small(x);
+		const vector4f f = vector_sub(x, n);
+		const vector4f poly = vector_polynomial(f, 1.0F, 6.931472028550421e-1F, 2.402264791363012e-1F, 5.550332471162809e-2F, 9.618437357674640e-3F, 1.339887440266574e-3F, 1.535336188319500e-4F);
+		const vector4f result = rtm_impl::vector_scale_exp2(poly, n);
+
+		// Clamping does not preserve NaN
+		return vector_select(vector_equal(input, input), result, input);
+#else
+		float x = scalar_exp2(float(vector_get_x(input)));
+		float y = scalar_exp2(float(vector_get_y(input)));
+		float z = scalar_exp2(float(vector_get_z(input)));
+		float w = scalar_exp2(float(vector_get_w(input)));
+		return vector_set(x, y, z, w);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component e raised to the power of the input: e^input
+	// Uses a degree 7 minimax approximation polynomial after range reduction.
+	// See: Cephes Math Library (Stephen L. Moshier)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_exp(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS) || defined(RTM_DETERMINISTIC)
+		// Past these bounds, the result is either 0.0 or infinity
+		const vector4f x = vector_clamp(input, vector_set(-104.0F), vector_set(89.0F));
+
+		// e^x = 2^n * e^r with n integral and r in [-ln(2)/2, ln(2)/2]
+		// ln(2) is split in two constants to reduce the input without losing precision
+		const vector4f n = rtm_impl::vector_round_small(vector_mul(x, 1.44269504088896341F));
+		vector4f r = vector_neg_mul_sub(n, 0.693359375F, x);
+		r = vector_neg_mul_sub(n, -2.12194440e-4F, r);
+
+		const vector4f poly = vector_polynomial(r, 1.0F, 1.0F, 5.0000001201e-1F, 1.6666665459e-1F, 4.1665795894e-2F, 8.3334519073e-3F, 1.3981999507e-3F, 1.9875691500e-4F);
+		const vector4f result = rtm_impl::vector_scale_exp2(poly, n);
+
+		// Clamping does not preserve NaN
+		return vector_select(vector_equal(input, input), result, input);
+#else
+		float x = scalar_exp(float(vector_get_x(input)));
+		float y = scalar_exp(float(vector_get_y(input)));
+		float z = scalar_exp(float(vector_get_z(input)));
+		float w = scalar_exp(float(vector_get_w(input)));
+		return vector_set(x, y, z, w);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the base 2 logarithm of the input.
+	// Zero returns -infinity, negative values return NaN.
+	// See: Cephes Math Library (Stephen L. Moshier)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_log2(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS) || defined(RTM_DETERMINISTIC)
+		// log2(x) = log(m) / ln(2) + exponent, exact for powers of two
+		vector4f exponent;
+		const vector4f log_mantissa = rtm_impl::vector_log_mantissa(input, exponent);
+		const vector4f result = vector_mul_add(log_mantissa, 1.44269504088896341F, exponent);
+		return rtm_impl::vector_log_special_values(input, result);
+#else
+		float x = scalar_log2(float(vector_get_x(input)));
+		float y = scalar_log2(float(vector_get_y(input)));
+		float z = scalar_log2(float(vector_get_z(input)));
+		float w = scalar_log2(float(vector_get_w(input)));
+		return vector_set(x, y, z, w);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the natural logarithm of the input.
+	// Zero returns -infinity, negative values return NaN.
+	// See: Cephes Math Library (Stephen L. Moshier)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_log(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS) || defined(RTM_DETERMINISTIC)
+		// log(x) = log(m) + exponent * ln(2)
+		// ln(2) is split in two constants to avoid losing precision
+		vector4f exponent;
+		const vector4f log_mantissa = rtm_impl::vector_log_mantissa(input, exponent);
+		vector4f result = vector_mul_add(exponent, -2.12194440e-4F, log_mantissa);
+		result = vector_mul_add(exponent, 0.693359375F, result);
+		return rtm_impl::vector_log_special_values(input, result);
+#else
+		float x = scalar_log(float(vector_get_x(input)));
+		float y = scalar_log(float(vector_get_y(input)));
+		float z = scalar_log(float(vector_get_z(input)));
+		float w = scalar_log(float(vector_get_w(input)));
+		return vector_set(x, y, z, w);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the base raised to the power of the exponent: base^exponent
+	// Computed as 2^(exponent * log2(base)), the relative error grows with the
+	// magnitude of the result exponent.
+	// Negative bases are supported for integral exponents and return NaN otherwise.
+	// A zero exponent or a base of 1.0 always returns 1.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_pow(vector4f_arg0 base, vector4f_arg1 exponent) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS) || defined(RTM_NEON_INTRINSICS) || defined(RTM_DETERMINISTIC)
+		vector4f result = vector_exp2(vector_mul(exponent, vector_log2(vector_abs(base))));
+
+		// A negative base keeps its sign with odd exponents and is undefined with fractional exponents
+		// Negative bases are uncommon, skip the extra work when there are none
+		if (vector_any_less_than(base, vector_zero()))
+		{
+			const vector4f half_exponent = vector_mul(exponent, 0.5F);
+			const mask4f is_exponent_integral = vector_equal(vector_round_bankers(exponent), exponent);
+			const mask4f is_exponent_even = vector_equal(vector_round_bankers(half_exponent), half_exponent);
+			const vector4f negative_base_result = vector_select(is_exponent_integral, vector_select(is_exponent_even, result, vector_neg(result)), vector_set(std::numeric_limits<float>::quiet_NaN()));
+			result = vector_select(vector_less_than(base, vector_zero()), negative_base_result, result);
+		}
+
+		const vector4f one = vector_set(1.0F);
+		result = vector_select(vector_equal(exponent, vector_zero()), one, result);
+		return vector_select(vector_equal(base, one), one, result);
+#else
+		float x = scalar_pow(float(vector_get_x(base)), float(vector_get_x(exponent)));
+		float y = scalar_pow(float(vector_get_y(base)), float(vector_get_y(exponent)));
+		float z = scalar_pow(float(vector_get_z(base)), float(vector_get_z(exponent)));
+		float w = scalar_pow(float(vector_get_w(base)), float(vector_get_w(exponent)));
+		return vector_set(x, y, z, w);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the base raised to the power of the scalar exponent: base^exponent
+	// See vector_pow(vector4f, vector4f) for details.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_pow(vector4f_arg0 base, float exponent) RTM_NO_EXCEPT
+	{
+		return vector_pow(base, vector_set(exponent));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the sine of the input angle.
+	// Uses a degree 7 minimax approximation polynomial.
+	// Max absolute error: 1.4e-6 within [-pi, pi] and 5.5e-6 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_sin_fast(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		// Remap our input in the [-pi, pi] range
+		const vector4f quotient = vector_mul(vector_round_bankers(vector_mul(input, rtm::constants::one_div_two_pi())), rtm::constants::two_pi());
+		vector4f x = vector_sub(input, quotient);
+
+		// Remap our input in the [-pi/2, pi/2] range
+		const vector4f pi = vector_set(float(rtm::constants::pi()));
+		const vector4f reflection = vector_select(vector_less_than(x, vector_zero()), vector_sub(vector_neg(pi), x), vector_sub(pi, x));
+		const mask4f is_less_equal_than_half_pi = vector_less_equal(vector_abs(x), vector_set(float(rtm::constants::half_pi())));
+		x = vector_select(is_less_equal_than_half_pi, x, reflection);
+
+		// Calculate our value
+		const vector4f x2 = vector_mul(x, x);
+		vector4f result = vector_polynomial(x2, 1.0F, -1.6665681092213705e-1F, 8.3123664364479644e-3F, -1.8492186805893105e-4F);
+		return vector_mul(result, x);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the cosine of the input angle.
+	// Uses a degree 6 minimax approximation polynomial.
+	// Max absolute error: 8.4e-6 within [-pi, pi] and 1.4e-5 when abs(angle) <= 100.0
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_cos_fast(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		// Remap our input in the [-pi, pi] range
+		const vector4f quotient = vector_mul(vector_round_bankers(vector_mul(input, rtm::constants::one_div_two_pi())), rtm::constants::two_pi());
+		vector4f x = vector_sub(input, quotient);
+
+		// Remap our input in the [-pi/2, pi/2] range, cos(pi - x) = -cos(x)
+		const vector4f pi = vector_set(float(rtm::constants::pi()));
+		const vector4f reflection = vector_select(vector_less_than(x, vector_zero()), vector_sub(vector_neg(pi), x), vector_sub(pi, x));
+		const mask4f is_less_equal_than_half_pi = vector_less_equal(vector_abs(x), vector_set(float(rtm::constants::half_pi())));
+		x = vector_select(is_less_equal_than_half_pi, x, reflection);
+
+		// Calculate our value
+		const vector4f x2 = vector_mul(x, x);
+		vector4f result = vector_polynomial(x2, 1.0F, -4.9993562862475299e-1F, 4.1507063576977227e-2F, -1.2757509400283312e-3F);
+		return vector_select(is_less_equal_than_half_pi, result, vector_neg(result));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component both the sine and cosine of the input angle.
+	// The range reduction is only performed once and the results match
+	// vector_sin_fast and vector_cos_fast exactly.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_sincos_fast(vector4f_arg0 input, vector4f& out_sin, vector4f& out_cos) RTM_NO_EXCEPT
+	{
+		// Remap our input in the [-pi, pi] range
+		const vector4f quotient = vector_mul(vector_round_bankers(vector_mul(input, rtm::constants::one_div_two_pi())), rtm::constants::two_pi());
+		vector4f x = vector_sub(input, quotient);
+
+		// Remap our input in the [-pi/2, pi/2] range
+		const vector4f pi = vector_set(float(rtm::constants::pi()));
+		const vector4f reflection = vector_select(vector_less_than(x, vector_zero()), vector_sub(vector_neg(pi), x), vector_sub(pi, x));
+		const mask4f is_less_equal_than_half_pi = vector_less_equal(vector_abs(x), vector_set(float(rtm::constants::half_pi())));
+		x = vector_select(is_less_equal_than_half_pi, x, reflection);
+
+		// Calculate our values, both polynomials are independent so their evaluation can overlap
+		const vector4f x2 = vector_mul(x, x);
+		vector4f sin_result = vector_polynomial(x2, 1.0F, -1.6665681092213705e-1F, 8.3123664364479644e-3F, -1.8492186805893105e-4F);
+		vector4f cos_result = vector_polynomial(x2, 1.0F, -4.9993562862475299e-1F, 4.1507063576977227e-2F, -1.2757509400283312e-3F);
+
+		out_sin = vector_mul(sin_result, x);
+		out_cos = vector_select(is_less_equal_than_half_pi, cos_result, vector_neg(cos_result));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the tangent of the input angle.
+	// Uses the ratio of vector_sin_fast and vector_cos_fast.
+	// Max error: 7.5e-5 (absolute below 1.0, relative above) when abs(tan(angle)) <= 10.0
+	// The error grows as cos(angle) approaches zero.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_tan_fast(vector4f_arg0 angle) RTM_NO_EXCEPT
+	{
+		// Use the identity: tan(angle) = sin(angle) / cos(angle)
+		vector4f sin_;
+		vector4f cos_;
+		vector_sincos_fast(angle, sin_, cos_);
+
+		mask4f is_cos_zero = vector_equal(cos_, vector_zero());
+		vector4f signed_infinity = vector_copy_sign(vector_set(std::numeric_limits<float>::infinity()), angle);
+		vector4f result = vector_div(sin_, cos_);
+		return vector_select(is_cos_zero, signed_infinity, result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-sine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	// Uses a degree 3 minimax approximation polynomial.
+	// Max absolute error: 4.6e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_asin_fast(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		// asin(x) = pi/2 - sqrt(1.0 - x) * polynomial(x) for x in [0.0, 1.0]
+		const vector4f abs_value = vector_abs(input);
+
+		vector4f result = vector_polynomial(abs_value, 1.5707963267948966F, -2.1330134257572395e-1F, 7.7981463463848086e-2F, -2.1641476616848260e-2F);
+		result = vector_neg_mul_sub(result, vector_sqrt(vector_sub(vector_set(1.0F), abs_value)), vector_set(float(rtm::constants::half_pi())));
+
+		// Keep the original sign
+		return vector_select(vector_less_than(input, vector_zero()), vector_neg(result), result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-cosine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	// Uses a degree 3 minimax approximation polynomial.
+	// Max absolute error: 4.6e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_acos_fast(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		// acos(x) = sqrt(1.0 - x) * polynomial(x) for x in [0.0, 1.0]
+		// acos(-x) = pi - acos(x)
+		const vector4f abs_value = vector_abs(input);
+
+		vector4f result = vector_polynomial(abs_value, 1.5707963267948966F, -2.1330134257572395e-1F, 7.7981463463848086e-2F, -2.1641476616848260e-2F);
+		result = vector_mul(result, vector_sqrt(vector_sub(vector_set(1.0F), abs_value)));
+
+		return vector_select(vector_less_than(input, vector_zero()), vector_sub(vector_set(float(rtm::constants::pi())), result), result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-tangent of the input.
+	// Note that due to the sign ambiguity, atan cannot determine which quadrant
+	// the value resides in.
+	// Uses a degree 9 minimax approximation polynomial.
+	// Max absolute error: 1.8e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_atan_fast(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		// Discard our sign, we'll restore it later
+		const vector4f abs_value = vector_abs(input);
+
+		// atan(x) = pi/2 - atan(1/x) for x > 1.0
+		const mask4f is_larger_than_one = vector_greater_than(abs_value, vector_set(1.0F));
+		const vector4f x = vector_select(is_larger_than_one, vector_reciprocal(abs_value), abs_value);
+		const vector4f x2 = vector_mul(x, x);
+
+		vector4f result = vector_polynomial(x2, 1.0F, -3.3168525440753333e-1F, 1.8449079620329184e-1F, -9.0450293895443359e-2F, 2.3060121252307116e-2F);
+		result = vector_mul(result, x);
+
+		result = vector_select(is_larger_than_one, vector_sub(vector_set(float(rtm::constants::half_pi())), result), result);
+
+		// Keep the original sign
+		return vector_select(vector_less_than(input, vector_zero()), vector_neg(result), result);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant.
+	// Y represents the proportion of the y-coordinate.
+	// X represents the proportion of the x-coordinate.
+	// Uses vector_atan_fast, max absolute error: 1.8e-5
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_atan2_fast(vector4f_arg0 y, vector4f_arg1 x) RTM_NO_EXCEPT
+	{
+		// See vector_atan2 for details
+		const vector4f zero = vector_zero();
+		const mask4f is_x_zero = vector_equal(x, zero);
+		const mask4f is_y_zero = vector_equal(y, zero);
+		const mask4f is_x_positive = vector_greater_than(x, zero);
+
+		// If X == 0.0, our offset is PI/2 with the sign of Y or 0.0 if Y == 0.0
+		// If X > 0.0, our offset is 0.0
+		// If X < 0.0, our offset is PI with the sign of Y
+		const vector4f x_zero_offset = vector_select(is_y_zero, zero, vector_copy_sign(vector_set(float(rtm::constants::half_pi())), y));
+		const vector4f x_non_zero_offset = vector_select(is_x_positive, zero, vector_copy_sign(vector_set(float(rtm::constants::pi())), y));
+		const vector4f offset = vector_select(is_x_zero, x_zero_offset, x_non_zero_offset);
+
+		// If X == 0.0, our value is 0.0 otherwise it is atan(y/x)
+		const vector4f value = vector_select(is_x_zero, zero, vector_atan_fast(vector_div(y, x)));
+
+		return vector_add(value, offset);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes 4 vectors in place as if they were the rows of a 4x4 matrix.
+	// This converts 4 AoS values (e.g. 4 quaternions) into their x, y, z, w SoA
+	// lanes and back since the transpose is its own inverse.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_transpose4x4(vector4f& v0, vector4f& v1, vector4f& v2, vector4f& v3) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128 x0_x1_y0_y1 = _mm_unpacklo_ps(v0, v1);
+		const __m128 x2_x3_y2_y3 = _mm_unpacklo_ps(v2, v3);
+		const __m128 z0_z1_w0_w1 = _mm_unpackhi_ps(v0, v1);
+		const __m128 z2_z3_w2_w3 = _mm_unpackhi_ps(v2, v3);
+
+		v0 = _mm_movelh_ps(x0_x1_y0_y1, x2_x3_y2_y3);
+		v1 = _mm_movehl_ps(x2_x3_y2_y3, x0_x1_y0_y1);
+		v2 = _mm_movelh_ps(z0_z1_w0_w1, z2_z3_w2_w3);
+		v3 = _mm_movehl_ps(z2_z3_w2_w3, z0_z1_w0_w1);
+#elif defined(RTM_NEON_INTRINSICS)
+		const float32x4x2_t x0_x1_z0_z1__y0_y1_w0_w1 = vtrnq_f32(v0, v1);
+		const float32x4x2_t x2_x3_z2_z3__y2_y3_w2_w3 = vtrnq_f32(v2, v3);
+
+		v0 = vcombine_f32(vget_low_f32(x0_x1_z0_z1__y0_y1_w0_w1.val[0]), vget_low_f32(x2_x3_z2_z3__y2_y3_w2_w3.val[0]));
+		v1 = vcombine_f32(vget_low_f32(x0_x1_z0_z1__y0_y1_w0_w1.val[1]), vget_low_f32(x2_x3_z2_z3__y2_y3_w2_w3.val[1]));
+		v2 = vcombine_f32(vget_high_f32(x0_x1_z0_z1__y0_y1_w0_w1.val[0]), vget_high_f32(x2_x3_z2_z3__y2_y3_w2_w3.val[0]));
+		v3 = vcombine_f32(vget_high_f32(x0_x1_z0_z1__y0_y1_w0_w1.val[1]), vget_high_f32(x2_x3_z2_z3__y2_y3_w2_w3.val[1]));
+#else
+		const vector4f xxyy01 = vector_mix<mix4::x, mix4::a, mix4::y, mix4::b>(v0, v1);
+		const vector4f xxyy23 = vector_mix<mix4::x, mix4::a, mix4::y, mix4::b>(v2, v3);
+		const vector4f zzww01 = vector_mix<mix4::z, mix4::c, mix4::w, mix4::d>(v0, v1);
+		const vector4f zzww23 = vector_mix<mix4::z, mix4::c, mix4::w, mix4::d>(v2, v3);
+
+		v0 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(xxyy01, xxyy23);
+		v1 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(xxyy01, xxyy23);
+		v2 = vector_mix<mix4::x, mix4::y, mix4::a, mix4::b>(zzww01, zzww23);
+		v3 = vector_mix<mix4::z, mix4::w, mix4::c, mix4::d>(zzww01, zzww23);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 packed 3D vectors (12 bytes stride) and deinterleaves them into
+	// their x, y, z SoA lanes directly from registers.
+	// The input does not need to be aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_deinterleave3(const float3f* input, vector4f& out_x, vector4f& out_y, vector4f& out_z) RTM_NO_EXCEPT
+	{
+		const float* input_ptr = &input->x;
+
+#if defined(RTM_SSE2_INTRINSICS)
+		// The 4 vectors span exactly 3 registers
+		const __m128 x0_y0_z0_x1 = _mm_loadu_ps(input_ptr + 0);
+		const __m128 y1_z1_x2_y2 = _mm_loadu_ps(input_ptr + 4);
+		const __m128 z2_x3_y3_z3 = _mm_loadu_ps(input_ptr + 8);
+
+		const __m128 x2_x2_x3_x3 = _mm_shuffle_ps(y1_z1_x2_y2, z2_x3_y3_z3, _MM_SHUFFLE(1, 1, 2, 2));
+		out_x = _mm_shuffle_ps(x0_y0_z0_x1, x2_x2_x3_x3, _MM_SHUFFLE(2, 0, 3, 0));
+
+		const __m128 y0_y0_y1_y1 = _mm_shuffle_ps(x0_y0_z0_x1, y1_z1_x2_y2, _MM_SHUFFLE(0, 0, 1, 1));
+		const __m128 y2_y2_y3_y3 = _mm_shuffle_ps(y1_z1_x2_y2, z2_x3_y3_z3, _MM_SHUFFLE(2, 2, 3, 3));
+		out_y = _mm_shuffle_ps(y0_y0_y1_y1, y2_y2_y3_y3, _MM_SHUFFLE(2, 0, 2, 0));
+
+		const __m128 z0_z0_z1_z1 = _mm_shuffle_ps(x0_y0_z0_x1, y1_z1_x2_y2, _MM_SHUFFLE(1, 1, 2, 2));
+		out_z = _mm_shuffle_ps(z0_z0_z1_z1, z2_x3_y3_z3, _MM_SHUFFLE(3, 0, 2, 0));
+#elif defined(RTM_NEON_INTRINSICS)
+		const float32x4x3_t xyz = vld3q_f32(input_ptr);
+		out_x = xyz.val[0];
+		out_y = xyz.val[1];
+		out_z = xyz.val[2];
+#else
+		out_x = vector_set(input_ptr[0], input_ptr[3], input_ptr[6], input_ptr[9]);
+		out_y = vector_set(input_ptr[1], input_ptr[4], input_ptr[7], input_ptr[10]);
+		out_z = vector_set(input_ptr[2], input_ptr[5], input_ptr[8], input_ptr[11]);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interleaves the x, y, z SoA lanes of 4 3D vectors and writes them
+	// packed (12 bytes stride). This is the inverse of vector_deinterleave3.
+	// The output does not need to be aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_interleave3(vector4f_arg0 x, vector4f_arg1 y, vector4f_arg2 z, float3f* output) RTM_NO_EXCEPT
+	{
+		float* output_ptr = &output->x;
+
+#if defined(RTM_SSE2_INTRINSICS)
+		const __m128 x0_y0_x1_y1 = _mm_unpacklo_ps(x, y);
+		const __m128 z0_z0_x1_x1 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0));
+		const __m128 x0_y0_z0_x1 = _mm_shuffle_ps(x0_y0_x1_y1, z0_z0_x1_x1, _MM_SHUFFLE(2, 0, 1, 0));
+
+		const __m128 y0_z0_y1_z1 = _mm_unpacklo_ps(y, z);
+		const __m128 x2_y2_x3_y3 = _mm_unpackhi_ps(x, y);
+		const __m128 y1_z1_x2_y2 = _mm_shuffle_ps(y0_z0_y1_z1, x2_y2_x3_y3, _MM_SHUFFLE(1, 0, 3, 2));
+
+		const __m128 z2_z2_x3_x3 = _mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2));
+		const __m128 y3_y3_z3_z3 = _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3));
+		const __m128 z2_x3_y3_z3 = _mm_shuffle_ps(z2_z2_x3_x3, y3_y3_z3_z3, _MM_SHUFFLE(2, 0, 2, 0));
+
+		_mm_storeu_ps(output_ptr + 0, x0_y0_z0_x1);
+		_mm_storeu_ps(output_ptr + 4, y1_z1_x2_y2);
+		_mm_storeu_ps(output_ptr + 8, z2_x3_y3_z3);
+#elif defined(RTM_NEON_INTRINSICS)
+		float32x4x3_t xyz;
+		xyz.val[0] = x;
+		xyz.val[1] = y;
+		xyz.val[2] = z;
+		vst3q_f32(output_ptr, xyz);
+#else
+		output_ptr[0] = vector_get_x(x);
+		output_ptr[1] = vector_get_x(y);
+		output_ptr[2] = vector_get_x(z);
+		output_ptr[3] = vector_get_y(x);
+		output_ptr[4] = vector_get_y(y);
+		output_ptr[5] = vector_get_y(z);
+		output_ptr[6] = vector_get_z(x);
+		output_ptr[7] = vector_get_z(y);
+		output_ptr[8] = vector_get_z(z);
+		output_ptr[9] = vector_get_w(x);
+		output_ptr[10] = vector_get_w(y);
+		output_ptr[11] = vector_get_w(z);
+#endif
+	}
 }
 
 RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,447 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/mask4i.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector4i.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+//////////////////////////////////////////////////////////////////////////
+// Fixed point vectors for simulations that must produce the same bits on every platform.
+//
+// Even in deterministic mode (see docs/determinism.md), floating point results can differ
+// between targets that flush denormals or do not round like IEEE 754. A vector4fx holds
+// 4 signed Q16.16 values: the raw 32 bit integer is the value multiplied by 65536.
+// Values are in [-32768.0, 32768.0) with a precision of 1/65536. Every function only uses
+// integer arithmetic with the vector4i SIMD types and returns the same bits on every platform
+// and instruction set.
+//
+// Additions and subtractions wrap around on overflow. Multiplications compute the full
+// 64 bit product and round it to the nearest Q16.16 value. Nothing is checked: keep the
+// values well within the range, e.g. the squared length of a vector must fit.
+//////////////////////////////////////////////////////////////////////////
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// The raw value of 1.0 in Q16.16.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr int32_t k_fx_one = 65536;
+
+#if !defined(RTM_SSE2_INTRINSICS) && !defined(RTM_NEON_INTRINSICS)
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the signed 64 bit product of the inputs shifted right by 'shift' bits
+		// and rounded to the nearest integer, keeping the low 32 bits of the result.
+		//////////////////////////////////////////////////////////////////////////
+		inline int32_t int_mul_shift(int32_t lhs, int32_t rhs, uint32_t shift) RTM_NO_EXCEPT
+		{
+			const uint64_t product = static_cast<uint64_t>(static_cast<int64_t>(lhs) * static_cast<int64_t>(rhs));
+			return static_cast<int32_t>(static_cast<uint32_t>((product + (uint64_t(1) << (shift - 1))) >> shift));
+		}
+#endif
+
+		//////////////////////////////////////////////////////////////////////////
+		// Per component signed 32x32 -> 64 bit multiplication, shifted right by 'shift' bits
+		// and rounded to the nearest integer: (lhs * rhs + 2^(shift - 1)) >> shift
+		// Only the low 32 bits of the result are kept. The shift must be in [1, 32].
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE vector4i RTM_SIMD_CALL vector_fx_mul_shift(vector4i_arg0 lhs, vector4i_arg1 rhs, uint32_t shift) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			const __m128i lhs_odd = _mm_srli_epi64(lhs, 32);
+			const __m128i rhs_odd = _mm_srli_epi64(rhs, 32);
+
+#if defined(RTM_SSE4_INTRINSICS)
+			__m128i product_even = _mm_mul_epi32(lhs, rhs);
+			__m128i product_odd = _mm_mul_epi32(lhs_odd, rhs_odd);
+#else
+			// SSE2 only has an unsigned multiplication, the signed product is lhs * rhs - 2^32 * ((lhs < 0 ? rhs : 0) + (rhs < 0 ? lhs : 0))
+			const __m128i correction = _mm_add_epi32(_mm_and_si128(_mm_srai_epi32(lhs, 31), rhs), _mm_and_si128(_mm_srai_epi32(rhs, 31), lhs));
+			__m128i product_even = _mm_sub_epi64(_mm_mul_epu32(lhs, rhs), _mm_slli_epi64(correction, 32));
+			__m128i product_odd = _mm_sub_epi64(_mm_mul_epu32(lhs_odd, rhs_odd), _mm_and_si128(correction, _mm_set_epi32(-1, 0, -1, 0)));
+#endif
+
+			const __m128i bias = _mm_sll_epi64(_mm_set_epi32(0, 1, 0, 1), _mm_cvtsi32_si128(static_cast<int>(shift - 1)));
+			product_even = _mm_add_epi64(product_even, bias);
+			product_odd = _mm_add_epi64(product_odd, bias);
+
+			// The result of the even components ends up in the low half of each 64 bit lane
+			// and the result of the odd components in the high half
+			const __m128i result_even = _mm_srl_epi64(product_even, _mm_cvtsi32_si128(static_cast<int>(shift)));
+			const __m128i result_odd = _mm_sll_epi64(product_odd, _mm_cvtsi32_si128(static_cast<int>(32 - shift)));
+
+#if defined(RTM_SSE4_INTRINSICS)
+			return _mm_blend_epi16(result_even, result_odd, 0xCC);
+#else
+			const __m128i low_mask = _mm_set_epi32(0, -1, 0, -1);
+			return _mm_or_si128(_mm_and_si128(result_even, low_mask), _mm_andnot_si128(low_mask, result_odd));
+#endif
+#elif defined(RTM_NEON_INTRINSICS)
+			const int32x4_t lhs_ = RTM_IMPL_VECTOR4i_GET(lhs);
+			const int32x4_t rhs_ = RTM_IMPL_VECTOR4i_GET(rhs);
+			const int64x2_t count = vdupq_n_s64(-static_cast<int64_t>(shift));
+
+			// A negative count is a rounding right shift
+			const int64x2_t product_xy = vrshlq_s64(vmull_s32(vget_low_s32(lhs_), vget_low_s32(rhs_)), count);
+			const int64x2_t product_zw = vrshlq_s64(vmull_s32(vget_high_s32(lhs_), vget_high_s32(rhs_)), count);
+			return RTM_IMPL_VECTOR4i_SET(vcombine_s32(vmovn_s64(product_xy), vmovn_s64(product_zw)));
+#else
+			return vector4i{ int_mul_shift(lhs.x, rhs.x, shift), int_mul_shift(lhs.y, rhs.y, shift), int_mul_shift(lhs.z, rhs.z, shift), int_mul_shift(lhs.w, rhs.w, shift) };
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the components of the input in the order specified.
+		//////////////////////////////////////////////////////////////////////////
+		template<int component0, int component1, int component2, int component3>
+		inline vector4i RTM_SIMD_CALL vector_fx_swizzle(vector4i_arg0 input) RTM_NO_EXCEPT
+		{
+#if defined(RTM_SSE2_INTRINSICS)
+			return _mm_shuffle_epi32(input, _MM_SHUFFLE(component3, component2, component1, component0));
+#else
+			alignas(16) int32_t components[4];
+			vector_store(input, &components[0]);
+			return vector_set(components[component0], components[component1], components[component2], components[component3]);
+#endif
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns the sum of the 4 components of the input in every component.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL vector_fx_sum(vector4i_arg0 input) RTM_NO_EXCEPT
+		{
+			// Integer additions are exact, the order does not change the result
+			const vector4i sum_xy_zw = vector_add(input, vector_fx_swizzle<2, 3, 0, 1>(input));
+			return vector_add(sum_xy_zw, vector_fx_swizzle<1, 0, 3, 2>(sum_xy_zw));
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Negates the components of the input where the mask is all ones: (input ^ mask) - mask
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL vector_fx_negate_masked(vector4i_arg0 input, vector4i_arg1 mask) RTM_NO_EXCEPT
+		{
+			return vector_sub(vector_xor(input, mask), mask);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Scales the values below 2^(30 - 2 * shift) by 2^(2 * shift) and their scale by 2^shift.
+		// Forced inline for the shifts to be immediate values.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE void RTM_SIMD_CALL vector_fx_sqrt_reciprocal_scale_step(uint32_t shift, vector4i& scaled, vector4i& scale) RTM_NO_EXCEPT
+		{
+			const mask4i is_small = vector_less_than(scaled, vector_set(int32_t(1) << (30 - shift * 2)));
+			scaled = vector_select(is_small, vector_shift_left(scaled, shift * 2), scaled);
+			scale = vector_select(is_small, vector_shift_left(scale, shift), scale);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Refines a Q3.29 estimate of 1/sqrt(m) for a Q2.30 value m: r = (3 * r - m * r^3) / 2
+		// m * r and r * r are independent which keeps the dependency chain at two multiplications.
+		// The true value of 3 * r - m * r^3 is in (2.0, 4.0] and fits as an unsigned Q3.29 value,
+		// the subtraction wraps to it.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE vector4i RTM_SIMD_CALL vector_fx_sqrt_reciprocal_newton_step(vector4i_arg0 scaled, vector4i_arg1 estimate) RTM_NO_EXCEPT
+		{
+			const vector4i scaled_estimate = vector_fx_mul_shift(scaled, estimate, 30);
+			const vector4i estimate_squared = vector_fx_mul_shift(estimate, estimate, 29);
+			const vector4i estimate_cubed = vector_fx_mul_shift(scaled_estimate, estimate_squared, 29);
+			const vector4i estimate_tripled = vector_add(estimate, vector_add(estimate, estimate));
+			return vector_shift_right_logical(vector_sub(estimate_tripled, estimate_cubed), 1);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns value / sqrt(input) for positive Q16.16 inputs as Q16.16 values.
+		// The value must be smaller than 2^30 / 2.0, zero inputs return zero.
+		// Multiplying before undoing the scaling keeps the full precision of the
+		// reciprocal square root instead of rounding it to Q16.16 first.
+		//////////////////////////////////////////////////////////////////////////
+		RTM_FORCE_INLINE vector4i RTM_SIMD_CALL vector_fx_mul_sqrt_reciprocal(vector4i_arg0 value, vector4i_arg1 input) RTM_NO_EXCEPT
+		{
+			// The input is scaled by an even power of two 2^(2 * k) into [2^28, 2^30) with a few compares and selects
+			// since the scale of each component differs and the integer SIMD shifts are uniform.
+			// Seen as Q2.30, the scaled value 'm' is in [0.25, 1.0) and 1/sqrt(m) in (1.0, 2.0].
+			// We keep track of 2^(k + 1) to undo the scaling at the end.
+			const vector4i one = vector_set(int32_t(1));
+
+			vector4i scaled = input;
+			vector4i scale = vector_set(int32_t(2));
+
+			const mask4i is_large = vector_greater_equal(scaled, vector_set(int32_t(1) << 30));
+			scaled = vector_select(is_large, vector_shift_right(scaled, 2), scaled);
+			scale = vector_select(is_large, one, scale);
+
+			vector_fx_sqrt_reciprocal_scale_step(8, scaled, scale);
+			vector_fx_sqrt_reciprocal_scale_step(4, scaled, scale);
+			vector_fx_sqrt_reciprocal_scale_step(2, scaled, scale);
+			vector_fx_sqrt_reciprocal_scale_step(1, scaled, scale);
+
+			// Quadratic estimate of 1/sqrt(m) in Q3.29 with a relative error of 2.5%
+			const vector4i scaled_squared = vector_fx_mul_shift(scaled, scaled, 30);
+			vector4i estimate = vector_add(vector_set(int32_t(1434064951)), vector_fx_mul_shift(vector_set(int32_t(-1764375512)), scaled, 30));
+			estimate = vector_add(estimate, vector_fx_mul_shift(vector_set(int32_t(880124996)), scaled_squared, 30));
+
+			// Two Newton-Raphson iterations
+			estimate = vector_fx_sqrt_reciprocal_newton_step(scaled, estimate);
+			estimate = vector_fx_sqrt_reciprocal_newton_step(scaled, estimate);
+
+			// 1/sqrt(input / 2^16) = 2^24 / sqrt(input) = estimate * 2^(k + 1) / 2^21
+			// and the Q16.16 product with the value is value * estimate * 2^(k + 1) / 2^37
+			const vector4i result = vector_fx_mul_shift(vector_fx_mul_shift(value, estimate, 29), scale, 8);
+			return vector_select(vector_equal(input, vector_set(int32_t(0))), vector_set(int32_t(0)), result);
+		}
+
+		//////////////////////////////////////////////////////////////////////////
+		// Returns sin(x * PI / 2) for x in [0.0, 1.0] as Q2.30 values, x is also Q2.30.
+		//////////////////////////////////////////////////////////////////////////
+		inline vector4i RTM_SIMD_CALL vector_fx_sin_quadrant(vector4i_arg0 x) RTM_NO_EXCEPT
+		{
+			// Odd polynomial with an absolute error of 6.0e-7, a tenth of the Q16.16 precision
+			const vector4i x2 = vector_fx_mul_shift(x, x, 30);
+			vector4i result = vector_add(vector_set(int32_t(85291825)), vector_fx_mul_shift(vector_set(int32_t(-4652518)), x2, 30));
+			result = vector_add(vector_set(int32_t(-693522107)), vector_fx_mul_shift(result, x2, 30));
+			result = vector_add(vector_set(int32_t(1686624000)), vector_fx_mul_shift(result, x2, 30));
+			return vector_fx_mul_shift(result, x, 30);
+		}
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a vector4fx from the raw Q16.16 integer values of its 4 components.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_fx_from_raw(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector4fx{ input };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the raw Q16.16 integer values of the 4 components.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_fx_to_raw(vector4fx_arg0 input) RTM_NO_EXCEPT
+	{
+		return input.value;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a vector4fx with all components set to 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_fx_zero() RTM_NO_EXCEPT
+	{
+		return vector4fx{ vector_set(int32_t(0)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads the raw Q16.16 integer values of 4 components from unaligned memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_fx_load(const int32_t* input) RTM_NO_EXCEPT
+	{
+		return vector4fx{ vector_load(input) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the raw Q16.16 integer values of the 4 components to unaligned memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store(vector4fx_arg0 input, int32_t* output) RTM_NO_EXCEPT
+	{
+		vector_store(input.value, output);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a vector4f into fixed point, rounding to the nearest Q16.16 value with
+	// banker's rounding. The input must be in [-32768.0, 32768.0).
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_to_fx(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+		// Scaling by a power of two is exact
+		return vector4fx{ vector_round_to_int(vector_mul(input, 65536.0F)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Converts a vector4fx into floating point. Values with more than 24 significant bits are rounded.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_from_fx(vector4fx_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_mul(vector_int_to_float(input.value), 1.0F / 65536.0F);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component addition of the two inputs, wrapping around on overflow: lhs + rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_add(vector4fx_arg0 lhs, vector4fx_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector4fx{ vector_add(lhs.value, rhs.value) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component subtraction of the two inputs, wrapping around on overflow: lhs - rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_sub(vector4fx_arg0 lhs, vector4fx_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector4fx{ vector_sub(lhs.value, rhs.value) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component multiplication of the two inputs, rounded to the nearest Q16.16 value: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_mul(vector4fx_arg0 lhs, vector4fx_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector4fx{ rtm_impl::vector_fx_mul_shift(lhs.value, rhs.value, 16) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component negation of the input: -input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_neg(vector4fx_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector4fx{ vector_neg(input.value) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// 4D dot product: lhs . rhs
+	// Returns the raw Q16.16 value of the result.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_dot(vector4fx_arg0 lhs, vector4fx_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector_get_x(rtm_impl::vector_fx_sum(rtm_impl::vector_fx_mul_shift(lhs.value, rhs.value, 16)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// 3D dot product: lhs . rhs
+	// Returns the raw Q16.16 value of the result.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_dot3(vector4fx_arg0 lhs, vector4fx_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const vector4i products = rtm_impl::vector_fx_mul_shift(lhs.value, rhs.value, 16);
+		return static_cast<int32_t>(static_cast<uint32_t>(vector_get_x(products)) + static_cast<uint32_t>(vector_get_y(products)) + static_cast<uint32_t>(vector_get_z(products)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// 3D cross product: lhs x rhs
+	// The [w] component of the result is 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_cross3(vector4fx_arg0 lhs, vector4fx_arg1 rhs) RTM_NO_EXCEPT
+	{
+		const vector4i lhs_yzx = rtm_impl::vector_fx_swizzle<1, 2, 0, 3>(lhs.value);
+		const vector4i lhs_zxy = rtm_impl::vector_fx_swizzle<2, 0, 1, 3>(lhs.value);
+		const vector4i rhs_yzx = rtm_impl::vector_fx_swizzle<1, 2, 0, 3>(rhs.value);
+		const vector4i rhs_zxy = rtm_impl::vector_fx_swizzle<2, 0, 1, 3>(rhs.value);
+		return vector4fx{ vector_sub(rtm_impl::vector_fx_mul_shift(lhs_yzx, rhs_zxy, 16), rtm_impl::vector_fx_mul_shift(lhs_zxy, rhs_yzx, 16)) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the normalized input vector3, the [w] component of the result is 0.0.
+	// A zero length input returns zero. The squared length must be below 32768.0 and the
+	// precision degrades for vectors much shorter than 1.0 since their squared length
+	// only has a few significant bits.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_normalize3(vector4fx_arg0 input) RTM_NO_EXCEPT
+	{
+		const vector4i input_xyz = vector_and(input.value, vector_set(-1, -1, -1, 0));
+		const vector4i length_squared = rtm_impl::vector_fx_sum(rtm_impl::vector_fx_mul_shift(input_xyz, input_xyz, 16));
+		return vector4fx{ rtm_impl::vector_fx_mul_sqrt_reciprocal(input_xyz, length_squared) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Trigonometry
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the sine and cosine of angles in radians.
+	// The angle is reduced exactly into a fraction of a full turn and each quadrant is
+	// evaluated with the same polynomial: for every representable angle, the results are
+	// within 1/65536 of the exact values, odd and even like the true functions, and exact
+	// at multiples of PI/2.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_sincos(vector4fx_arg0 angle, vector4fx& out_sine, vector4fx& out_cosine) RTM_NO_EXCEPT
+	{
+		// angle / (2 * PI) in Q32.32 turns, the low 32 bits are the fraction of a turn
+		// which wraps around like the trigonometric functions. The raw angle is multiplied by
+		// 2^32 / (2 * PI) = 683565275.5764316... split into its integer part and 31 bits of
+		// its fraction: a single 32 bit constant is off by up to 0.5 and that error, multiplied
+		// by the angle, reaches 2 LSB for angles near 32768.0.
+		const vector4i phase_high = rtm_impl::vector_fx_mul_shift(angle.value, vector_set(int32_t(683565275)), 16);
+		const vector4i phase_low = rtm_impl::vector_fx_mul_shift(angle.value, vector_set(int32_t(1237877413)), 32);
+		const vector4i phase = vector_add(phase_high, vector_shift_right(vector_add(phase_low, vector_set(int32_t(1) << 14)), 15));
+
+		// The top 2 bits are the quadrant, the rest is the position within it in Q2.30
+		const vector4i quadrant = vector_shift_right_logical(phase, 30);
+		const vector4i x = vector_and(phase, vector_set(int32_t(0x3FFFFFFF)));
+		const vector4i y = vector_sub(vector_set(int32_t(1) << 30), x);
+
+		// Round from Q2.30 to Q16.16 before applying the signs for the functions to be exactly odd and even
+		const vector4i rounding = vector_set(int32_t(1) << 13);
+		const vector4i sin_x = vector_shift_right(vector_add(rtm_impl::vector_fx_sin_quadrant(x), rounding), 14);
+		const vector4i sin_y = vector_shift_right(vector_add(rtm_impl::vector_fx_sin_quadrant(y), rounding), 14);
+
+		// Quadrants 1 and 3 swap the functions, 2 and 3 negate the sine, 1 and 2 negate the cosine
+		const vector4i is_odd = vector_sub(vector_set(int32_t(0)), vector_and(quadrant, vector_set(int32_t(1))));
+		const vector4i is_sine_negative = vector_shift_right(vector_shift_left(quadrant, 30), 31);
+		const vector4i is_cosine_negative = vector_xor(is_odd, is_sine_negative);
+
+		const vector4i sine = vector_select(vector_equal(is_odd, vector_set(int32_t(0))), sin_x, sin_y);
+		const vector4i cosine = vector_select(vector_equal(is_odd, vector_set(int32_t(0))), sin_y, sin_x);
+		out_sine = vector4fx{ rtm_impl::vector_fx_negate_masked(sine, is_sine_negative) };
+		out_cosine = vector4fx{ rtm_impl::vector_fx_negate_masked(cosine, is_cosine_negative) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the sine of angles in radians, see vector_sincos.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_sin(vector4fx_arg0 angle) RTM_NO_EXCEPT
+	{
+		vector4fx sine;
+		vector4fx cosine;
+		vector_sincos(angle, sine, cosine);
+		return sine;
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component the cosine of angles in radians, see vector_sincos.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4fx RTM_SIMD_CALL vector_cos(vector4fx_arg0 angle) RTM_NO_EXCEPT
+	{
+		vector4fx sine;
+		vector4fx cosine;
+		vector_sincos(angle, sine, cosine);
+		return cosine;
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,630 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "rtm/math.h"
+#include "rtm/mask4i.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+#if !defined(RTM_SSE2_INTRINSICS) && !defined(RTM_NEON_INTRINSICS)
+	namespace rtm_impl
+	{
+		//////////////////////////////////////////////////////////////////////////
+		// Scalar integer helpers with SIMD semantics: arithmetic wraps around on overflow.
+		//////////////////////////////////////////////////////////////////////////
+		constexpr int32_t int_add(int32_t lhs, int32_t rhs) RTM_NO_EXCEPT { return static_cast<int32_t>(static_cast<uint32_t>(lhs) + static_cast<uint32_t>(rhs)); }
+		constexpr int32_t int_sub(int32_t lhs, int32_t rhs) RTM_NO_EXCEPT { return static_cast<int32_t>(static_cast<uint32_t>(lhs) - static_cast<uint32_t>(rhs)); }
+		constexpr int32_t int_mul(int32_t lhs, int32_t rhs) RTM_NO_EXCEPT { return static_cast<int32_t>(static_cast<uint32_t>(lhs) * static_cast<uint32_t>(rhs)); }
+		constexpr int32_t int_shift_left(int32_t input, uint32_t count) RTM_NO_EXCEPT { return static_cast<int32_t>(static_cast<uint32_t>(input) << count); }
+		constexpr int32_t int_shift_right_logical(int32_t input, uint32_t count) RTM_NO_EXCEPT { return static_cast<int32_t>(static_cast<uint32_t>(input) >> count); }
+		constexpr int32_t int_select(uint32_t mask, int32_t if_true, int32_t if_false) RTM_NO_EXCEPT { return mask == 0 ? if_false : if_true; }
+	}
+#endif
+
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a vector4i from all 4 components.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_set(int32_t x, int32_t y, int32_t z, int32_t w) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_set_epi32(w, z, y, x);
+#elif defined(RTM_NEON_INTRINSICS)
+		const int32x2_t xy = vcreate_s32(uint64_t(uint32_t(x)) | (uint64_t(uint32_t(y)) << 32));
+		const int32x2_t zw = vcreate_s32(uint64_t(uint32_t(z)) | (uint64_t(uint32_t(w)) << 32));
+		return RTM_IMPL_VECTOR4i_SET(vcombine_s32(xy, zw));
+#else
+		return vector4i{ x, y, z, w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a vector4i from a single value for all 4 components.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_set(int32_t xyzw) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_set1_epi32(xyzw);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vdupq_n_s32(xyzw));
+#else
+		return vector4i{ xyzw, xyzw, xyzw, xyzw };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an unaligned vector4i from memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_load(const int32_t* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vld1q_s32(input));
+#else
+		return vector4i{ input[0], input[1], input[2], input[3] };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a vector4i to unaligned memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store(vector4i_arg0 input, int32_t* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), input);
+#elif defined(RTM_NEON_INTRINSICS)
+		vst1q_s32(output, RTM_IMPL_VECTOR4i_GET(input));
+#else
+		output[0] = input.x;
+		output[1] = input.y;
+		output[2] = input.z;
+		output[3] = input.w;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the vector4i [x] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_get_x(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtsi128_si32(input);
+#elif defined(RTM_NEON_INTRINSICS)
+		return vgetq_lane_s32(RTM_IMPL_VECTOR4i_GET(input), 0);
+#else
+		return input.x;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the vector4i [y] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_get_y(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_extract_epi32(input, 1);
+#elif defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtsi128_si32(_mm_shuffle_epi32(input, _MM_SHUFFLE(1, 1, 1, 1)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vgetq_lane_s32(RTM_IMPL_VECTOR4i_GET(input), 1);
+#else
+		return input.y;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the vector4i [z] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_get_z(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_extract_epi32(input, 2);
+#elif defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtsi128_si32(_mm_shuffle_epi32(input, _MM_SHUFFLE(2, 2, 2, 2)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vgetq_lane_s32(RTM_IMPL_VECTOR4i_GET(input), 2);
+#else
+		return input.z;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the vector4i [w] component.
+	//////////////////////////////////////////////////////////////////////////
+	inline int32_t RTM_SIMD_CALL vector_get_w(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_extract_epi32(input, 3);
+#elif defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtsi128_si32(_mm_shuffle_epi32(input, _MM_SHUFFLE(3, 3, 3, 3)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return vgetq_lane_s32(RTM_IMPL_VECTOR4i_GET(input), 3);
+#else
+		return input.w;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the vector4i components where the mask is true to unaligned memory.
+	// The other values in memory are left unchanged.
+	// With AVX, the masked out values are not accessed. Otherwise, they are read and
+	// written back: all 4 values must be valid memory and not written concurrently.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store_masked(vector4i_arg0 input, mask4i_arg1 mask, int32_t* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		_mm_maskstore_ps(reinterpret_cast<float*>(output), mask, _mm_castsi128_ps(input));
+#elif defined(RTM_SSE4_INTRINSICS)
+		__m128i* output_ptr = reinterpret_cast<__m128i*>(output);
+		_mm_storeu_si128(output_ptr, _mm_blendv_epi8(_mm_loadu_si128(output_ptr), input, mask));
+#elif defined(RTM_SSE2_INTRINSICS)
+		__m128i* output_ptr = reinterpret_cast<__m128i*>(output);
+		_mm_storeu_si128(output_ptr, _mm_or_si128(_mm_and_si128(mask, input), _mm_andnot_si128(mask, _mm_loadu_si128(output_ptr))));
+#elif defined(RTM_NEON_INTRINSICS)
+		vst1q_s32(output, vbslq_s32(RTM_IMPL_MASK4i_GET(mask), RTM_IMPL_VECTOR4i_GET(input), vld1q_s32(output)));
+#else
+		output[0] = mask.x != 0 ? input.x : output[0];
+		output[1] = mask.y != 0 ? input.y : output[1];
+		output[2] = mask.z != 0 ? input.z : output[2];
+		output[3] = mask.w != 0 ? input.w : output[3];
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes the vector4i components where the mask is true contiguously to unaligned
+	// memory (left packing) and returns how many were written, without branching.
+	// The output must have room for 4 values, the values past the returned count
+	// can be overwritten with undefined values.
+	// e.g. Store the indices of the values that pass a test to build a list.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL vector_compress_store(vector4i_arg0 input, mask4i_arg1 mask, int32_t* output) RTM_NO_EXCEPT
+	{
+		const uint32_t mask_bits = mask_get_bits(mask);
+
+#if defined(RTM_AVX512_INTRINSICS)
+		// Only the selected values are written
+		_mm512_mask_compressstoreu_epi32(output, __mmask16(mask_bits), _mm512_castsi128_si512(input));
+#elif defined(RTM_SSE4_INTRINSICS)
+		const __m128i control = _mm_load_si128(reinterpret_cast<const __m128i*>(rtm_impl::get_compress_shuffle_control(mask_bits)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(output), _mm_shuffle_epi8(input, control));
+#elif defined(RTM_NEON64_INTRINSICS)
+		const uint8x16_t control = vld1q_u8(rtm_impl::get_compress_shuffle_control(mask_bits));
+		vst1q_s32(output, vreinterpretq_s32_u8(vqtbl1q_u8(vreinterpretq_u8_s32(RTM_IMPL_VECTOR4i_GET(input)), control)));
+#else
+		rtm_impl::compress_store4<int32_t>(vector_get_x(input), vector_get_y(input), vector_get_z(input), vector_get_w(input), mask_bits, output);
+#endif
+
+		return rtm_impl::mask_bits_count(mask_bits);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component conversion from float to integer, truncating towards zero.
+	// Inputs outside the range of a signed 32 bit integer produce a platform specific value.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_truncate_to_int(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_WASM_SIMD128_INTRINSICS)
+		return (__m128i)wasm_i32x4_trunc_sat_f32x4((v128_t)input);
+#elif defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvttps_epi32(input);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vcvtq_s32_f32(input));
+#else
+		return vector4i{ static_cast<int32_t>(input.x), static_cast<int32_t>(input.y), static_cast<int32_t>(input.z), static_cast<int32_t>(input.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component conversion from float to integer, rounding to the nearest integer
+	// using banker's rounding (half to even).
+	// With SSE2, this honors the current rounding mode which is banker's rounding by default.
+	// Inputs outside the range of a signed 32 bit integer produce a platform specific value.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_round_to_int(vector4f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_WASM_SIMD128_INTRINSICS)
+		return (__m128i)wasm_i32x4_trunc_sat_f32x4(wasm_f32x4_nearest((v128_t)input));
+#elif defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtps_epi32(input);
+#elif defined(RTM_NEON64_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vcvtnq_s32_f32(input));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vcvtq_s32_f32(vector_round_bankers(input)));
+#else
+		const int32_t x = static_cast<int32_t>(scalar_round_bankers(input.x));
+		const int32_t y = static_cast<int32_t>(scalar_round_bankers(input.y));
+		const int32_t z = static_cast<int32_t>(scalar_round_bankers(input.z));
+		const int32_t w = static_cast<int32_t>(scalar_round_bankers(input.w));
+		return vector4i{ x, y, z, w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component conversion from integer to float.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_int_to_float(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cvtepi32_ps(input);
+#elif defined(RTM_NEON_INTRINSICS)
+		return vcvtq_f32_s32(RTM_IMPL_VECTOR4i_GET(input));
+#else
+		return vector_set(static_cast<float>(input.x), static_cast<float>(input.y), static_cast<float>(input.z), static_cast<float>(input.w));
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 floats from memory at the provided per component indices: base[indices]
+	// Indices must be valid for the base pointer, no bounds checking is performed.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_gather(const float* base, vector4i_arg0 indices) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX2_INTRINSICS)
+		return _mm_i32gather_ps(base, indices, 4);
+#else
+		return vector_set(base[vector_get_x(indices)], base[vector_get_y(indices)], base[vector_get_z(indices)], base[vector_get_w(indices)]);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 4 integers from memory at the provided per component indices: base[indices]
+	// Indices must be valid for the base pointer, no bounds checking is performed.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_gather(const int32_t* base, vector4i_arg0 indices) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX2_INTRINSICS)
+		return _mm_i32gather_epi32(base, indices, 4);
+#else
+		return vector_set(base[vector_get_x(indices)], base[vector_get_y(indices)], base[vector_get_z(indices)], base[vector_get_w(indices)]);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component addition of the two inputs, wrapping around on overflow: lhs + rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_add(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_add_epi32(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vaddq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ rtm_impl::int_add(lhs.x, rhs.x), rtm_impl::int_add(lhs.y, rhs.y), rtm_impl::int_add(lhs.z, rhs.z), rtm_impl::int_add(lhs.w, rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component subtraction of the two inputs, wrapping around on overflow: lhs - rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_sub(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_sub_epi32(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vsubq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ rtm_impl::int_sub(lhs.x, rhs.x), rtm_impl::int_sub(lhs.y, rhs.y), rtm_impl::int_sub(lhs.z, rhs.z), rtm_impl::int_sub(lhs.w, rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component multiplication of the two inputs, keeping the low 32 bits of the result: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_mul(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_mullo_epi32(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
+		// SSE2 only has an unsigned 32x32 -> 64 bit multiplication of the even components
+		// The low 32 bits are identical for signed and unsigned inputs
+		const __m128i x_z = _mm_mul_epu32(lhs, rhs);
+		const __m128i y_w = _mm_mul_epu32(_mm_srli_epi64(lhs, 32), _mm_srli_epi64(rhs, 32));
+		return _mm_unpacklo_epi32(_mm_shuffle_epi32(x_z, _MM_SHUFFLE(0, 0, 2, 0)), _mm_shuffle_epi32(y_w, _MM_SHUFFLE(0, 0, 2, 0)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vmulq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ rtm_impl::int_mul(lhs.x, rhs.x), rtm_impl::int_mul(lhs.y, rhs.y), rtm_impl::int_mul(lhs.z, rhs.z), rtm_impl::int_mul(lhs.w, rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component negation of the input, wrapping around on overflow: -input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_neg(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_sub_epi32(_mm_setzero_si128(), input);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vnegq_s32(RTM_IMPL_VECTOR4i_GET(input)));
+#else
+		return vector4i{ rtm_impl::int_sub(0, input.x), rtm_impl::int_sub(0, input.y), rtm_impl::int_sub(0, input.z), rtm_impl::int_sub(0, input.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component absolute of the input, INT32_MIN is returned unchanged: abs(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_abs(vector4i_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_abs_epi32(input);
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128i sign = _mm_srai_epi32(input, 31);
+		return _mm_sub_epi32(_mm_xor_si128(input, sign), sign);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vabsq_s32(RTM_IMPL_VECTOR4i_GET(input)));
+#else
+		const int32_t x = input.x < 0 ? rtm_impl::int_sub(0, input.x) : input.x;
+		const int32_t y = input.y < 0 ? rtm_impl::int_sub(0, input.y) : input.y;
+		const int32_t z = input.z < 0 ? rtm_impl::int_sub(0, input.z) : input.z;
+		const int32_t w = input.w < 0 ? rtm_impl::int_sub(0, input.w) : input.w;
+		return vector4i{ x, y, z, w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component minimum of the two inputs: min(lhs, rhs)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_min(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_min_epi32(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128i is_lhs_greater = _mm_cmpgt_epi32(lhs, rhs);
+		return _mm_or_si128(_mm_and_si128(is_lhs_greater, rhs), _mm_andnot_si128(is_lhs_greater, lhs));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vminq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x < rhs.x ? lhs.x : rhs.x, lhs.y < rhs.y ? lhs.y : rhs.y, lhs.z < rhs.z ? lhs.z : rhs.z, lhs.w < rhs.w ? lhs.w : rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component maximum of the two inputs: max(lhs, rhs)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_max(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_max_epi32(lhs, rhs);
+#elif defined(RTM_SSE2_INTRINSICS)
+		const __m128i is_lhs_greater = _mm_cmpgt_epi32(lhs, rhs);
+		return _mm_or_si128(_mm_and_si128(is_lhs_greater, lhs), _mm_andnot_si128(is_lhs_greater, rhs));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vmaxq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x > rhs.x ? lhs.x : rhs.x, lhs.y > rhs.y ? lhs.y : rhs.y, lhs.z > rhs.z ? lhs.z : rhs.z, lhs.w > rhs.w ? lhs.w : rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component clamping of an input between a minimum and a maximum value: min(max_value, max(min_value, input))
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_clamp(vector4i_arg0 input, vector4i_arg1 min_value, vector4i_arg2 max_value) RTM_NO_EXCEPT
+	{
+		return vector_min(max_value, vector_max(min_value, input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Bitwise operations
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component bitwise AND of the two inputs: lhs & rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_and(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_and_si128(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vandq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x & rhs.x, lhs.y & rhs.y, lhs.z & rhs.z, lhs.w & rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component bitwise OR of the two inputs: lhs | rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_or(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_or_si128(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vorrq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x | rhs.x, lhs.y | rhs.y, lhs.z | rhs.z, lhs.w | rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component bitwise XOR of the two inputs: lhs ^ rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_xor(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_xor_si128(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(veorq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return vector4i{ lhs.x ^ rhs.x, lhs.y ^ rhs.y, lhs.z ^ rhs.z, lhs.w ^ rhs.w };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component left shift of the input, shifting in zeros: input << count
+	// The shift count must be in the range [0, 31].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_shift_left(vector4i_arg0 input, uint32_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_sll_epi32(input, _mm_cvtsi32_si128(static_cast<int>(count)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vshlq_s32(RTM_IMPL_VECTOR4i_GET(input), vdupq_n_s32(static_cast<int32_t>(count))));
+#else
+		return vector4i{ rtm_impl::int_shift_left(input.x, count), rtm_impl::int_shift_left(input.y, count), rtm_impl::int_shift_left(input.z, count), rtm_impl::int_shift_left(input.w, count) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component arithmetic right shift of the input, shifting in the sign bit: input >> count
+	// The shift count must be in the range [0, 31].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_shift_right(vector4i_arg0 input, uint32_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_sra_epi32(input, _mm_cvtsi32_si128(static_cast<int>(count)));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vshlq_s32(RTM_IMPL_VECTOR4i_GET(input), vdupq_n_s32(-static_cast<int32_t>(count))));
+#else
+		return vector4i{ input.x >> count, input.y >> count, input.z >> count, input.w >> count };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component logical right shift of the input, shifting in zeros: uint32_t(input) >> count
+	// The shift count must be in the range [0, 31].
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_shift_right_logical(vector4i_arg0 input, uint32_t count) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_srl_epi32(input, _mm_cvtsi32_si128(static_cast<int>(count)));
+#elif defined(RTM_NEON_INTRINSICS)
+		const uint32x4_t input_u32 = vreinterpretq_u32_s32(RTM_IMPL_VECTOR4i_GET(input));
+		return RTM_IMPL_VECTOR4i_SET(vreinterpretq_s32_u32(vshlq_u32(input_u32, vdupq_n_s32(-static_cast<int32_t>(count)))));
+#else
+		return vector4i{ rtm_impl::int_shift_right_logical(input.x, count), rtm_impl::int_shift_right_logical(input.y, count), rtm_impl::int_shift_right_logical(input.z, count), rtm_impl::int_shift_right_logical(input.w, count) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Comparisons and masking
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if equal, otherwise 0: lhs == rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_equal(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cmpeq_epi32(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vceqq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ rtm_impl::get_mask_value(lhs.x == rhs.x), rtm_impl::get_mask_value(lhs.y == rhs.y), rtm_impl::get_mask_value(lhs.z == rhs.z), rtm_impl::get_mask_value(lhs.w == rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if less than, otherwise 0: lhs < rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_less_than(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cmplt_epi32(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vcltq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ rtm_impl::get_mask_value(lhs.x < rhs.x), rtm_impl::get_mask_value(lhs.y < rhs.y), rtm_impl::get_mask_value(lhs.z < rhs.z), rtm_impl::get_mask_value(lhs.w < rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if less equal, otherwise 0: lhs <= rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_less_equal(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// SSE2 has no integer less equal comparison, negate greater than instead
+		return _mm_xor_si128(_mm_cmpgt_epi32(lhs, rhs), _mm_set1_epi32(-1));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vcleq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ rtm_impl::get_mask_value(lhs.x <= rhs.x), rtm_impl::get_mask_value(lhs.y <= rhs.y), rtm_impl::get_mask_value(lhs.z <= rhs.z), rtm_impl::get_mask_value(lhs.w <= rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if greater than, otherwise 0: lhs > rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_greater_than(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		return _mm_cmpgt_epi32(lhs, rhs);
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vcgtq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ rtm_impl::get_mask_value(lhs.x > rhs.x), rtm_impl::get_mask_value(lhs.y > rhs.y), rtm_impl::get_mask_value(lhs.z > rhs.z), rtm_impl::get_mask_value(lhs.w > rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per component ~0 if greater equal, otherwise 0: lhs >= rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask4i RTM_SIMD_CALL vector_greater_equal(vector4i_arg0 lhs, vector4i_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE2_INTRINSICS)
+		// SSE2 has no integer greater equal comparison, negate less than instead
+		return _mm_xor_si128(_mm_cmplt_epi32(lhs, rhs), _mm_set1_epi32(-1));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_MASK4i_SET(vcgeq_s32(RTM_IMPL_VECTOR4i_GET(lhs), RTM_IMPL_VECTOR4i_GET(rhs)));
+#else
+		return mask4i{ rtm_impl::get_mask_value(lhs.x >= rhs.x), rtm_impl::get_mask_value(lhs.y >= rhs.y), rtm_impl::get_mask_value(lhs.z >= rhs.z), rtm_impl::get_mask_value(lhs.w >= rhs.w) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component selection depending on the mask: mask != 0 ? if_true : if_false
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4i RTM_SIMD_CALL vector_select(mask4i_arg0 mask, vector4i_arg1 if_true, vector4i_arg2 if_false) RTM_NO_EXCEPT
+	{
+#if defined(RTM_SSE4_INTRINSICS)
+		return _mm_blendv_epi8(if_false, if_true, mask);
+#elif defined(RTM_SSE2_INTRINSICS)
+		return _mm_or_si128(_mm_andnot_si128(mask, if_false), _mm_and_si128(if_true, mask));
+#elif defined(RTM_NEON_INTRINSICS)
+		return RTM_IMPL_VECTOR4i_SET(vbslq_s32(RTM_IMPL_MASK4i_GET(mask), RTM_IMPL_VECTOR4i_GET(if_true), RTM_IMPL_VECTOR4i_GET(if_false)));
+#else
+		return vector4i{ rtm_impl::int_select(mask.x, if_true.x, if_false.x), rtm_impl::int_select(mask.y, if_true.y, if_false.y), rtm_impl::int_select(mask.z, if_true.z, if_false.z), rtm_impl::int_select(mask.w, if_true.w, if_false.w) };
+#endif
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
@@ -0,0 +1,822 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm/math.h"
+#include "rtm/mask4f.h"
+#include "rtm/vector4f.h"
+#include "rtm/impl/compiler_utils.h"
+
+#include <cstdint>
+#include <utility>
+
+RTM_IMPL_FILE_PRAGMA_PUSH
+
+namespace rtm
+{
+	//////////////////////////////////////////////////////////////////////////
+	// The vector8f family processes 8 values per operation for data stored as
+	// structure of arrays. With AVX, a single 256 bit register is used, otherwise
+	// the two 4 lane halves are processed with the regular vector4f functions.
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Setters, getters, and casts
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns a vector8 with all lanes set to 0.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector8_zero() RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_setzero_ps();
+#else
+		return vector8f{ vector_zero(), vector_zero() };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a vector8 from a single value for all 8 lanes.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector8_set(float value) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_set1_ps(value);
+#else
+		const vector4f value4 = vector_set(value);
+		return vector8f{ value4, value4 };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Creates a vector8 from its low [0, 3] and high [4, 7] lanes.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector8_set(vector4f_arg0 lo, vector4f_arg1 hi) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(lo), hi, 1);
+#else
+		return vector8f{ lo, hi };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads an unaligned vector8 from memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector8_load(const float* input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_loadu_ps(input);
+#else
+		return vector8f{ vector_load(input), vector_load(input + 4) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes a vector8 to unaligned memory.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store(vector8f_arg0 input, float* output) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		_mm256_storeu_ps(output, input);
+#else
+		vector_store(input.lo, output);
+		vector_store(input.hi, output + 4);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the low lanes [0, 3] of a vector8.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_get_low(vector8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_castps256_ps128(input);
+#else
+		return input.lo;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the high lanes [4, 7] of a vector8.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4f RTM_SIMD_CALL vector_get_high(vector8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_extractf128_ps(input, 1);
+#else
+		return input.hi;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Arithmetic
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane addition of the two inputs: lhs + rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_add(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_add_ps(lhs, rhs);
+#else
+		return vector8f{ vector_add(lhs.lo, rhs.lo), vector_add(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane subtraction of the two inputs: lhs - rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_sub(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sub_ps(lhs, rhs);
+#else
+		return vector8f{ vector_sub(lhs.lo, rhs.lo), vector_sub(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of the two inputs: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_mul(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_mul_ps(lhs, rhs);
+#else
+		return vector8f{ vector_mul(lhs.lo, rhs.lo), vector_mul(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication of the vector by a scalar: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_mul(vector8f_arg0 lhs, float rhs) RTM_NO_EXCEPT
+	{
+		return vector_mul(lhs, vector8_set(rhs));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane division of the two inputs: lhs / rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_div(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_div_ps(lhs, rhs);
+#else
+		return vector8f{ vector_div(lhs.lo, rhs.lo), vector_div(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane maximum of the two inputs: max(lhs, rhs)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_max(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_max_ps(lhs, rhs);
+#else
+		return vector8f{ vector_max(lhs.lo, rhs.lo), vector_max(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane minimum of the two inputs: min(lhs, rhs)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_min(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_min_ps(lhs, rhs);
+#else
+		return vector8f{ vector_min(lhs.lo, rhs.lo), vector_min(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane absolute value of the input: abs(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_abs(vector8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		constexpr __m256 signs = { -0.0F, -0.0F, -0.0F, -0.0F, -0.0F, -0.0F, -0.0F, -0.0F };
+		return _mm256_andnot_ps(signs, input);
+#else
+		return vector8f{ vector_abs(input.lo), vector_abs(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane negation of the input: -input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_neg(vector8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		constexpr __m256 signs = { -0.0F, -0.0F, -0.0F, -0.0F, -0.0F, -0.0F, -0.0F, -0.0F };
+		return _mm256_xor_ps(input, signs);
+#else
+		return vector8f{ vector_neg(input.lo), vector_neg(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane reciprocal of the input: 1.0 / input
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_reciprocal(vector8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_div_ps(_mm256_set1_ps(1.0F), input);
+#else
+		return vector8f{ vector_reciprocal(input.lo), vector_reciprocal(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane square root of the input: sqrt(input)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_sqrt(vector8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_sqrt_ps(input);
+#else
+		return vector8f{ vector_sqrt(input.lo), vector_sqrt(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication/addition of the three inputs: v2 + (v0 * v1)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_mul_add(vector8f_arg0 v0, vector8f_arg1 v1, vector8f_arg2 v2) RTM_NO_EXCEPT
+	{
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm256_fmadd_ps(v0, v1, v2);
+#elif defined(RTM_AVX_INTRINSICS)
+		return _mm256_add_ps(_mm256_mul_ps(v0, v1), v2);
+#else
+		return vector8f{ vector_mul_add(v0.lo, v1.lo, v2.lo), vector_mul_add(v0.hi, v1.hi, v2.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane multiplication/addition of the three inputs: v2 + (v0 * s1)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_mul_add(vector8f_arg0 v0, float s1, vector8f_arg2 v2) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(v0, vector8_set(s1), v2);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane negative multiplication/subtraction of the three inputs: -((v0 * v1) - v2)
+	// This is mathematically equivalent to: v2 - (v0 * v1)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_neg_mul_sub(vector8f_arg0 v0, vector8f_arg1 v1, vector8f_arg2 v2) RTM_NO_EXCEPT
+	{
+#if defined(RTM_IMPL_USE_FMA)
+		return _mm256_fnmadd_ps(v0, v1, v2);
+#elif defined(RTM_AVX_INTRINSICS)
+		return _mm256_sub_ps(v2, _mm256_mul_ps(v0, v1));
+#else
+		return vector8f{ vector_neg_mul_sub(v0.lo, v1.lo, v2.lo), vector_neg_mul_sub(v0.hi, v1.hi, v2.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane negative multiplication/subtraction of the three inputs: -((v0 * s1) - v2)
+	// This is mathematically equivalent to: v2 - (v0 * s1)
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_neg_mul_sub(vector8f_arg0 v0, float s1, vector8f_arg2 v2) RTM_NO_EXCEPT
+	{
+		return vector_neg_mul_sub(v0, vector8_set(s1), v2);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane the degree 3 polynomial: c0 + c1 * x + ... + c3 * x^3
+	// Estrin's scheme is used: pairs of terms are evaluated independently and combined
+	// with powers of x^2 which shortens the dependency chain of Horner's method.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_polynomial(vector8f_arg0 x, float c0, float c1, float c2, float c3) RTM_NO_EXCEPT
+	{
+		const vector8f x2 = vector_mul(x, x);
+		const vector8f p01 = vector_mul_add(x, c1, vector8_set(c0));
+		const vector8f p23 = vector_mul_add(x, c3, vector8_set(c2));
+		return vector_mul_add(p23, x2, p01);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane the degree 4 polynomial: c0 + c1 * x + ... + c4 * x^4
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_polynomial(vector8f_arg0 x, float c0, float c1, float c2, float c3, float c4) RTM_NO_EXCEPT
+	{
+		const vector8f x2 = vector_mul(x, x);
+		const vector8f x4 = vector_mul(x2, x2);
+		const vector8f p01 = vector_mul_add(x, c1, vector8_set(c0));
+		const vector8f p23 = vector_mul_add(x, c3, vector8_set(c2));
+		const vector8f p0123 = vector_mul_add(p23, x2, p01);
+		return vector_mul_add(x4, c4, p0123);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane the degree 5 polynomial: c0 + c1 * x + ... + c5 * x^5
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_polynomial(vector8f_arg0 x, float c0, float c1, float c2, float c3, float c4, float c5) RTM_NO_EXCEPT
+	{
+		const vector8f x2 = vector_mul(x, x);
+		const vector8f x4 = vector_mul(x2, x2);
+		const vector8f p01 = vector_mul_add(x, c1, vector8_set(c0));
+		const vector8f p23 = vector_mul_add(x, c3, vector8_set(c2));
+		const vector8f p0123 = vector_mul_add(p23, x2, p01);
+		const vector8f p45 = vector_mul_add(x, c5, vector8_set(c4));
+		return vector_mul_add(p45, x4, p0123);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane the degree 6 polynomial: c0 + c1 * x + ... + c6 * x^6
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_polynomial(vector8f_arg0 x, float c0, float c1, float c2, float c3, float c4, float c5, float c6) RTM_NO_EXCEPT
+	{
+		const vector8f x2 = vector_mul(x, x);
+		const vector8f x4 = vector_mul(x2, x2);
+		const vector8f p01 = vector_mul_add(x, c1, vector8_set(c0));
+		const vector8f p23 = vector_mul_add(x, c3, vector8_set(c2));
+		const vector8f p0123 = vector_mul_add(p23, x2, p01);
+		const vector8f p45 = vector_mul_add(x, c5, vector8_set(c4));
+		const vector8f p456 = vector_mul_add(x2, c6, p45);
+		return vector_mul_add(p456, x4, p0123);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane the degree 7 polynomial: c0 + c1 * x + ... + c7 * x^7
+	// Evaluated with Estrin's scheme like the degree 3 overload.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_polynomial(vector8f_arg0 x, float c0, float c1, float c2, float c3, float c4, float c5, float c6, float c7) RTM_NO_EXCEPT
+	{
+		const vector8f x2 = vector_mul(x, x);
+		const vector8f x4 = vector_mul(x2, x2);
+		const vector8f p01 = vector_mul_add(x, c1, vector8_set(c0));
+		const vector8f p23 = vector_mul_add(x, c3, vector8_set(c2));
+		const vector8f p0123 = vector_mul_add(p23, x2, p01);
+		const vector8f p45 = vector_mul_add(x, c5, vector8_set(c4));
+		const vector8f p67 = vector_mul_add(x, c7, vector8_set(c6));
+		const vector8f p4567 = vector_mul_add(p67, x2, p45);
+		return vector_mul_add(p4567, x4, p0123);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane linear interpolation of the two inputs at the specified alpha.
+	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
+	// Interpolation is stable and will return 'start' when alpha is 0.0 and 'end' when it is 1.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_lerp(vector8f_arg0 start, vector8f_arg1 end, vector8f_arg2 alpha) RTM_NO_EXCEPT
+	{
+		// ((1.0 - alpha) * start) + (alpha * end) == (start - alpha * start) + (alpha * end)
+		return vector_mul_add(end, alpha, vector_neg_mul_sub(start, alpha, start));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane linear interpolation of the two inputs at the specified alpha.
+	// The formula used is: ((1.0 - alpha) * start) + (alpha * end).
+	// Interpolation is stable and will return 'start' when alpha is 0.0 and 'end' when it is 1.0.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_lerp(vector8f_arg0 start, vector8f_arg1 end, float alpha) RTM_NO_EXCEPT
+	{
+		return vector_lerp(start, end, vector8_set(alpha));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Comparisons and masking
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane ~0 if less than, otherwise 0: lhs < rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask8f RTM_SIMD_CALL vector_less_than(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_ps(lhs, rhs, _CMP_LT_OQ);
+#else
+		return mask8f{ vector_less_than(lhs.lo, rhs.lo), vector_less_than(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane ~0 if less equal, otherwise 0: lhs <= rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask8f RTM_SIMD_CALL vector_less_equal(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_ps(lhs, rhs, _CMP_LE_OQ);
+#else
+		return mask8f{ vector_less_equal(lhs.lo, rhs.lo), vector_less_equal(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane ~0 if greater than, otherwise 0: lhs > rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask8f RTM_SIMD_CALL vector_greater_than(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_ps(lhs, rhs, _CMP_GT_OQ);
+#else
+		return mask8f{ vector_greater_than(lhs.lo, rhs.lo), vector_greater_than(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane ~0 if greater equal, otherwise 0: lhs >= rhs ? ~0 : 0
+	//////////////////////////////////////////////////////////////////////////
+	inline mask8f RTM_SIMD_CALL vector_greater_equal(vector8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_cmp_ps(lhs, rhs, _CMP_GE_OQ);
+#else
+		return mask8f{ vector_greater_equal(lhs.lo, rhs.lo), vector_greater_equal(lhs.hi, rhs.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if all 8 lanes of the mask are true, otherwise false.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL mask_all_true(mask8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_ps(input) == 0xFF;
+#else
+		return mask_all_true(input.lo) && mask_all_true(input.hi);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns true if any of the 8 lanes of the mask are true, otherwise false.
+	//////////////////////////////////////////////////////////////////////////
+	inline bool RTM_SIMD_CALL mask_any_true(mask8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_movemask_ps(input) != 0;
+#else
+		return mask_any_true(input.lo) || mask_any_true(input.hi);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the mask packed as bits, one per lane: bit 0 is the first lane and bit 7 the last.
+	//////////////////////////////////////////////////////////////////////////
+	inline uint32_t RTM_SIMD_CALL mask_get_bits(mask8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return uint32_t(_mm256_movemask_ps(input));
+#else
+		return mask_get_bits(input.lo) | (mask_get_bits(input.hi) << 4);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane selection depending on the mask: mask != 0 ? if_true : if_false
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_select(mask8f_arg0 mask, vector8f_arg1 if_true, vector8f_arg2 if_false) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		return _mm256_blendv_ps(if_false, if_true, mask);
+#else
+		return vector8f{ vector_select(mask.lo, if_true.lo, if_false.lo), vector_select(mask.hi, if_true.hi, if_false.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Trigonometry
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane the arc-cosine of the input.
+	// Input value must be in the range [-1.0, 1.0].
+	// See the vector4f version for details, both use the same polynomial.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_acos(vector8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		// We first calculate our scale: sqrt(1.0 - abs(value))
+		// Use the sign bit to generate our absolute value since we'll re-use that constant
+		const __m256 sign_bit = _mm256_set1_ps(-0.0F);
+		const __m256 abs_value = _mm256_andnot_ps(sign_bit, input);
+
+		// Calculate our value
+		__m256 result = vector_polynomial(abs_value, 1.5707963267948966F, -2.1459960076929829e-1F, 8.8986946573346160e-2F, -5.0207843052845647e-2F, 3.0961594977611639e-2F, -1.7162031184398074e-2F, 6.7072304676685235e-3F, -1.2690614339589956e-3F);
+
+		// Scale our result
+		const __m256 scale = _mm256_sqrt_ps(_mm256_sub_ps(_mm256_set1_ps(1.0F), abs_value));
+		result = _mm256_mul_ps(result, scale);
+
+		// The offset is 0.0 when the input is positive and PI when negative
+		const __m256 is_input_negative = _mm256_cmp_ps(input, _mm256_setzero_ps(), _CMP_LT_OQ);
+		const __m256 offset = _mm256_and_ps(is_input_negative, _mm256_set1_ps(rtm::constants::pi()));
+
+		// And our result has the same sign of the input
+		const __m256 input_sign = _mm256_and_ps(input, sign_bit);
+		result = _mm256_or_ps(result, input_sign);
+		return _mm256_add_ps(result, offset);
+#else
+		return vector8f{ vector_acos(input.lo), vector_acos(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane the arc-tangent of the input.
+	// See the vector4f version for details, both use the same polynomial.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_atan(vector8f_arg0 input) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		// Discard our sign, we'll restore it later
+		const __m256 sign_bit = _mm256_set1_ps(-0.0F);
+		const __m256 abs_value = _mm256_andnot_ps(sign_bit, input);
+
+		// Compute our value
+		const __m256 is_larger_than_one = _mm256_cmp_ps(abs_value, _mm256_set1_ps(1.0F), _CMP_GT_OQ);
+		const __m256 reciprocal = vector_reciprocal(abs_value);
+
+		const __m256 x = _mm256_blendv_ps(abs_value, reciprocal, is_larger_than_one);
+
+		const __m256 x2 = _mm256_mul_ps(x, x);
+
+		__m256 result = vector_polynomial(x2, 1.0F, -3.3324998579202170e-1F, 1.9856563505717162e-1F, -1.3374657325451267e-1F, 8.1675882859940430e-2F, -3.5059680836411644e-2F, 7.2128853633444123e-3F);
+		result = _mm256_mul_ps(result, x);
+
+		// pi/2 - result
+		const __m256 remapped = _mm256_sub_ps(_mm256_set1_ps(rtm::constants::half_pi()), result);
+		result = _mm256_blendv_ps(result, remapped, is_larger_than_one);
+
+		// Keep the original sign
+		return _mm256_or_ps(result, _mm256_and_ps(input, sign_bit));
+#else
+		return vector8f{ vector_atan(input.lo), vector_atan(input.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns per lane the arc-tangent of [y/x] using the sign of the arguments to
+	// determine the correct quadrant.
+	// See the vector4f version for details, both handle the zero inputs the same way.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_atan2(vector8f_arg0 y, vector8f_arg1 x) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		const __m256 zero = _mm256_setzero_ps();
+		const __m256 is_x_zero = _mm256_cmp_ps(x, zero, _CMP_EQ_OQ);
+		const __m256 is_y_zero = _mm256_cmp_ps(y, zero, _CMP_EQ_OQ);
+		const __m256 inputs_are_zero = _mm256_and_ps(is_x_zero, is_y_zero);
+
+		const __m256 is_x_positive = _mm256_cmp_ps(x, zero, _CMP_GT_OQ);
+
+		const __m256 y_sign = _mm256_and_ps(y, _mm256_set1_ps(-0.0F));
+
+		// If X == 0.0, our offset is PI/2 otherwise it is PI both with the sign of Y
+		__m256 offset = _mm256_blendv_ps(_mm256_set1_ps(rtm::constants::pi()), _mm256_set1_ps(rtm::constants::half_pi()), is_x_zero);
+		offset = _mm256_or_ps(offset, y_sign);
+
+		// If X > 0.0, our offset is 0.0
+		offset = _mm256_andnot_ps(is_x_positive, offset);
+
+		// If X == 0.0 and Y == 0.0, our offset is 0.0
+		offset = _mm256_andnot_ps(inputs_are_zero, offset);
+
+		const __m256 angle = _mm256_div_ps(y, x);
+		__m256 value = vector_atan(angle);
+
+		// If X == 0.0, our value is 0.0 otherwise it is atan(y/x)
+		// This also covers X == 0.0 and Y == 0.0
+		value = _mm256_andnot_ps(is_x_zero, value);
+
+		return _mm256_add_ps(value, offset);
+#else
+		return vector8f{ vector_atan2(y.lo, x.lo), vector_atan2(y.hi, x.hi) };
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Transposes 8 vectors in place as if they were the rows of a 8x8 matrix.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_transpose8x8(vector8f& v0, vector8f& v1, vector8f& v2, vector8f& v3, vector8f& v4, vector8f& v5, vector8f& v6, vector8f& v7) RTM_NO_EXCEPT
+	{
+#if defined(RTM_AVX_INTRINSICS)
+		const __m256 t0 = _mm256_unpacklo_ps(v0, v1);
+		const __m256 t1 = _mm256_unpackhi_ps(v0, v1);
+		const __m256 t2 = _mm256_unpacklo_ps(v2, v3);
+		const __m256 t3 = _mm256_unpackhi_ps(v2, v3);
+		const __m256 t4 = _mm256_unpacklo_ps(v4, v5);
+		const __m256 t5 = _mm256_unpackhi_ps(v4, v5);
+		const __m256 t6 = _mm256_unpacklo_ps(v6, v7);
+		const __m256 t7 = _mm256_unpackhi_ps(v6, v7);
+
+		const __m256 tt0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+		const __m256 tt1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+		const __m256 tt2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+		const __m256 tt3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+		const __m256 tt4 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(1, 0, 1, 0));
+		const __m256 tt5 = _mm256_shuffle_ps(t4, t6, _MM_SHUFFLE(3, 2, 3, 2));
+		const __m256 tt6 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(1, 0, 1, 0));
+		const __m256 tt7 = _mm256_shuffle_ps(t5, t7, _MM_SHUFFLE(3, 2, 3, 2));
+
+		v0 = _mm256_permute2f128_ps(tt0, tt4, 0x20);
+		v1 = _mm256_permute2f128_ps(tt1, tt5, 0x20);
+		v2 = _mm256_permute2f128_ps(tt2, tt6, 0x20);
+		v3 = _mm256_permute2f128_ps(tt3, tt7, 0x20);
+		v4 = _mm256_permute2f128_ps(tt0, tt4, 0x31);
+		v5 = _mm256_permute2f128_ps(tt1, tt5, 0x31);
+		v6 = _mm256_permute2f128_ps(tt2, tt6, 0x31);
+		v7 = _mm256_permute2f128_ps(tt3, tt7, 0x31);
+#else
+		// Each 4x4 quadrant is transposed on its own and the off diagonal quadrants swap places
+		vector_transpose4x4(v0.lo, v1.lo, v2.lo, v3.lo);
+		vector_transpose4x4(v0.hi, v1.hi, v2.hi, v3.hi);
+		vector_transpose4x4(v4.lo, v5.lo, v6.lo, v7.lo);
+		vector_transpose4x4(v4.hi, v5.hi, v6.hi, v7.hi);
+
+		std::swap(v0.hi, v4.lo);
+		std::swap(v1.hi, v5.lo);
+		std::swap(v2.hi, v6.lo);
+		std::swap(v3.hi, v7.lo);
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// vector3x8f: 8 3D vectors, one vector8f per component
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 3D vectors from structure of arrays streams, starting at the provided offset.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector3x8_load(const const_float3f_soa& input, uint32_t offset) RTM_NO_EXCEPT
+	{
+		return vector3x8f{ vector8_load(input.x + offset), vector8_load(input.y + offset), vector8_load(input.z + offset) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 packed 3D vectors (12 bytes stride) and deinterleaves them.
+	// The input does not need to be aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector3x8_load(const float3f* input) RTM_NO_EXCEPT
+	{
+		vector4f x_lo, y_lo, z_lo;
+		vector4f x_hi, y_hi, z_hi;
+		vector_deinterleave3(input + 0, x_lo, y_lo, z_lo);
+		vector_deinterleave3(input + 4, x_hi, y_hi, z_hi);
+		return vector3x8f{ vector8_set(x_lo, x_hi), vector8_set(y_lo, y_hi), vector8_set(z_lo, z_hi) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 8 3D vectors to structure of arrays streams, starting at the provided offset.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store(vector3x8f_arg0 input, const float3f_soa& output, uint32_t offset) RTM_NO_EXCEPT
+	{
+		vector_store(input.x, output.x + offset);
+		vector_store(input.y, output.y + offset);
+		vector_store(input.z, output.z + offset);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Interleaves 8 3D vectors and writes them packed (12 bytes stride).
+	// The output does not need to be aligned.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store(vector3x8f_arg0 input, float3f* output) RTM_NO_EXCEPT
+	{
+		vector_interleave3(vector_get_low(input.x), vector_get_low(input.y), vector_get_low(input.z), output + 0);
+		vector_interleave3(vector_get_high(input.x), vector_get_high(input.y), vector_get_high(input.z), output + 4);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component addition of the two inputs: lhs + rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector_add(vector3x8f_arg0 lhs, vector3x8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector3x8f{ vector_add(lhs.x, rhs.x), vector_add(lhs.y, rhs.y), vector_add(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component subtraction of the two inputs: lhs - rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector_sub(vector3x8f_arg0 lhs, vector3x8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector3x8f{ vector_sub(lhs.x, rhs.x), vector_sub(lhs.y, rhs.y), vector_sub(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per component multiplication of the two inputs: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector_mul(vector3x8f_arg0 lhs, vector3x8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector3x8f{ vector_mul(lhs.x, rhs.x), vector_mul(lhs.y, rhs.y), vector_mul(lhs.z, rhs.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Multiplies each 3D vector by its matching lane scale: lhs * rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector_mul(vector3x8f_arg0 lhs, vector8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector3x8f{ vector_mul(lhs.x, rhs), vector_mul(lhs.y, rhs), vector_mul(lhs.z, rhs) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// 3D dot product of each pair of vectors: lhs . rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_dot3(vector3x8f_arg0 lhs, vector3x8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector_mul_add(lhs.z, rhs.z, vector_mul_add(lhs.y, rhs.y, vector_mul(lhs.x, rhs.x)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// 3D cross product of each pair of vectors: lhs x rhs
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector_cross3(vector3x8f_arg0 lhs, vector3x8f_arg1 rhs) RTM_NO_EXCEPT
+	{
+		return vector3x8f{
+			vector_neg_mul_sub(lhs.z, rhs.y, vector_mul(lhs.y, rhs.z)),
+			vector_neg_mul_sub(lhs.x, rhs.z, vector_mul(lhs.z, rhs.x)),
+			vector_neg_mul_sub(lhs.y, rhs.x, vector_mul(lhs.x, rhs.y))
+		};
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the squared length/norm of each 3D vector.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_length_squared3(vector3x8f_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_dot3(input, input);
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the length/norm of each 3D vector.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector8f RTM_SIMD_CALL vector_length3(vector3x8f_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_sqrt(vector_dot3(input, input));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns the normalized version of each 3D vector.
+	// If the length of a vector is zero, its result will contain NaN or infinity.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector_normalize3(vector3x8f_arg0 input) RTM_NO_EXCEPT
+	{
+		return vector_mul(input, vector_reciprocal(vector_length3(input)));
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Per lane selection of each 3D vector depending on the mask: mask != 0 ? if_true : if_false
+	//////////////////////////////////////////////////////////////////////////
+	inline vector3x8f RTM_SIMD_CALL vector_select(mask8f_arg0 mask, vector3x8f_arg1 if_true, vector3x8f_arg2 if_false) RTM_NO_EXCEPT
+	{
+		return vector3x8f{ vector_select(mask, if_true.x, if_false.x), vector_select(mask, if_true.y, if_false.y), vector_select(mask, if_true.z, if_false.z) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// vector4x8f: 8 4D vectors, one vector8f per component
+	//////////////////////////////////////////////////////////////////////////
+
+	//////////////////////////////////////////////////////////////////////////
+	// Loads 8 4D vectors from structure of arrays streams, starting at the provided offset.
+	//////////////////////////////////////////////////////////////////////////
+	inline vector4x8f RTM_SIMD_CALL vector4x8_load(const const_float4f_soa& input, uint32_t offset) RTM_NO_EXCEPT
+	{
+		return vector4x8f{ vector8_load(input.x + offset), vector8_load(input.y + offset), vector8_load(input.z + offset), vector8_load(input.w + offset) };
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Writes 8 4D vectors to structure of arrays streams, starting at the provided offset.
+	//////////////////////////////////////////////////////////////////////////
+	inline void RTM_SIMD_CALL vector_store(vector4x8f_arg0 input, const float4f_soa& output, uint32_t offset) RTM_NO_EXCEPT
+	{
+		vector_store(input.x, output.x + offset);
+		vector_store(input.y, output.y + offset);
+		vector_store(input.z, output.z + offset);
+		vector_store(input.w, output.w + offset);
+	}
+}
+
+RTM_IMPL_FILE_PRAGMA_POP
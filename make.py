@@ -1,10 +1,14 @@
 import argparse
+import datetime
+import json
 import multiprocessing
 import os
 import platform
+import re
 import shutil
 import subprocess
 import sys
+import time
 
 def parse_argv():
 	parser = argparse.ArgumentParser(add_help=False)
@@ -14,18 +18,28 @@ def parse_argv():
 	actions.add_argument('-clean', action='store_true')
 	actions.add_argument('-unit_test', action='store_true')
 	actions.add_argument('-bench', action='store_true')
+	actions.add_argument('-accuracy', action='store_true', help='Build and run the accuracy and throughput harness, fails when a function exceeds its error budget')
 
 	target = parser.add_argument_group(title='Target')
 	target.add_argument('-compiler', choices=['vs2015', 'vs2017', 'vs2019', 'vs2019-clang', 'android', 'clang4', 'clang5', 'clang6', 'clang7', 'clang8', 'clang9', 'clang10', 'gcc5', 'gcc6', 'gcc7', 'gcc8', 'gcc9', 'gcc10', 'osx', 'ios', 'emscripten'], help='Defaults to the host system\'s default compiler')
 	target.add_argument('-config', choices=['Debug', 'Release'], type=str.capitalize)
 	target.add_argument('-cpu', choices=['x86', 'x64', 'armv7', 'arm64', 'wasm'], help='Defaults to the host system\'s architecture')
+	target.add_argument('-cpp_version', choices=['11', '14', '17', '20'], help='C++ version used to compile the unit tests and benchmarks, defaults to 11')
 
 	misc = parser.add_argument_group(title='Miscellaneous')
 	misc.add_argument('-avx', dest='use_avx', action='store_true', help='Compile using AVX instructions on Windows, OS X, and Linux')
 	misc.add_argument('-avx2', dest='use_avx2', action='store_true', help='Compile using AVX2 instructions on Windows, OS X, and Linux')
+	misc.add_argument('-avx512', dest='use_avx512', action='store_true', help='Compile using AVX-512 instructions on Windows and Linux, the batch functions process 16 floats at a time')
+	misc.add_argument('-fma', dest='use_fma', action='store_true', help='Use FMA instructions when AVX2 is enabled')
 	misc.add_argument('-nosimd', dest='use_simd', action='store_false', help='Compile without SIMD instructions')
+	misc.add_argument('-capi', dest='use_capi', action='store_true', help='Build the rtm_capi shared library, its C test runs with -unit_test')
+	misc.add_argument('-bench_competitors', dest='bench_competitors', action='store_true', help='Benchmark DirectXMath, GLM, and Eigen along with RTM when they are found')
+	misc.add_argument('-bench_perf_counters', dest='bench_perf_counters', action='store_true', help='Report hardware performance counters with the benchmarks that support them (Linux only)')
+	misc.add_argument('-pch', dest='use_pch', action='store_true', help='Precompile the core headers of the unit tests and benchmarks, requires CMake 3.16')
 	misc.add_argument('-num_threads', help='No. to use while compiling and regressing')
 	misc.add_argument('-tests_matching', help='Only run tests whose names match this regex')
+	misc.add_argument('-bench_output', help='Path of the JSON benchmark results, defaults to build/bench_results/<device>_<cpu>_<simd>_<date>.json')
+	misc.add_argument('-accuracy_baseline', help='Path of the JSON accuracy results to compare against, regressions cause a failure')
 	misc.add_argument('-help', action='help', help='Display this usage information')
 
 	num_threads = multiprocessing.cpu_count()
@@ -34,15 +48,16 @@ def parse_argv():
 	if not num_threads or num_threads == 0:
 		num_threads = 4
 
-	parser.set_defaults(build=False, clean=False, unit_test=False, compiler=None, config='Release', cpu=None, use_avx=False, use_avx2=False, use_simd=True, num_threads=num_threads, tests_matching='')
+	parser.set_defaults(build=False, clean=False, unit_test=False, compiler=None, config='Release', cpu=None, cpp_version='11', use_avx=False, use_avx2=False, use_avx512=False, use_fma=False, use_simd=True, use_pch=False, use_capi=False, bench_competitors=False, bench_perf_counters=False, num_threads=num_threads, tests_matching='', bench_output=None, accuracy=False, accuracy_baseline=None)
 
 	args = parser.parse_args()
 
 	# Sanitize and validate our options
-	if (args.use_avx or args.use_avx2) and not args.use_simd:
-		print('SIMD is explicitly disabled, AVX and AVX2 will not be used')
+	if (args.use_avx or args.use_avx2 or args.use_avx512) and not args.use_simd:
+		print('SIMD is explicitly disabled, AVX, AVX2, and AVX-512 will not be used')
 		args.use_avx = False
 		args.use_avx2 = False
+		args.use_avx512 = False
 
 	if args.compiler == 'android':
 		if not args.cpu:
@@ -52,8 +67,8 @@ def parse_argv():
 			print('Android is only supported on Windows')
 			sys.exit(1)
 
-		if args.use_avx or args.use_avx2:
-			print('AVX and AVX2 are not supported on Android')
+		if args.use_avx or args.use_avx2 or args.use_avx512:
+			print('AVX, AVX2, and AVX-512 are not supported on Android')
 			sys.exit(1)
 
 		if not args.cpu in ['armv7', 'arm64']:
@@ -67,8 +82,8 @@ def parse_argv():
 			print('iOS is only supported on OS X')
 			sys.exit(1)
 
-		if args.use_avx or args.use_avx2:
-			print('AVX and AVX2 are not supported on iOS')
+		if args.use_avx or args.use_avx2 or args.use_avx512:
+			print('AVX, AVX2, and AVX-512 are not supported on iOS')
 			sys.exit(1)
 
 		if args.unit_test:
@@ -86,8 +101,8 @@ def parse_argv():
 			print('Emscripten is only supported on OS X and Linux')
 			sys.exit(1)
 
-		if args.use_avx or args.use_avx2:
-			print('AVX and AVX2 are not supported on Emscripten')
+		if args.use_avx or args.use_avx2 or args.use_avx512:
+			print('AVX, AVX2, and AVX-512 are not supported on Emscripten')
 			sys.exit(1)
 
 		if not args.cpu in ['wasm']:
@@ -245,6 +260,7 @@ def do_generate_solution(build_dir, cmake_script_dir, args):
 
 	extra_switches = ['--no-warn-unused-cli']
 	extra_switches.append('-DCPU_INSTRUCTION_SET:STRING={}'.format(cpu))
+	extra_switches.append('-DCPP_VERSION:STRING={}'.format(args.cpp_version))
 
 	if args.use_avx:
 		print('Enabling AVX usage')
@@ -254,13 +270,36 @@ def do_generate_solution(build_dir, cmake_script_dir, args):
 		print('Enabling AVX2 usage')
 		extra_switches.append('-DUSE_AVX2_INSTRUCTIONS:BOOL=true')
 
+	if args.use_avx512:
+		print('Enabling AVX-512 usage')
+		extra_switches.append('-DUSE_AVX512_INSTRUCTIONS:BOOL=true')
+
+	if args.use_fma:
+		print('Enabling FMA usage')
+		extra_switches.append('-DUSE_FMA:BOOL=true')
+
 	if not args.use_simd:
 		print('Disabling SIMD instruction usage')
 		extra_switches.append('-DUSE_SIMD_INSTRUCTIONS:BOOL=false')
 
+	if args.use_pch:
+		print('Enabling precompiled headers')
+		extra_switches.append('-DUSE_PRECOMPILED_HEADERS:BOOL=true')
+
+	if args.use_capi:
+		print('Enabling the C interface library')
+		extra_switches.append('-DBUILD_CAPI_LIBRARY:BOOL=true')
+
 	if args.bench:
 		extra_switches.append('-DBUILD_BENCHMARK_EXE:BOOL=true')
 
+	if args.bench_competitors:
+		print('Enabling the competitor benchmarks')
+		extra_switches.append('-DBENCH_COMPETITORS:BOOL=true')
+
+	if args.accuracy:
+		extra_switches.append('-DBUILD_ACCURACY_EXE:BOOL=true')
+
 	if not platform.system() == 'Windows':
 		extra_switches.append('-DCMAKE_BUILD_TYPE={}'.format(config.upper()))
 
@@ -365,6 +404,38 @@ def do_tests(build_dir, args):
 	else:
 		do_tests_cmake(args)
 
+def get_simd_name():
+	if not args.use_simd:
+		return 'nosimd'
+	return 'avx512' if args.use_avx512 else 'avx2' if args.use_avx2 else 'avx' if args.use_avx else 'default'
+
+def get_bench_output_path(device_name):
+	if args.bench_output:
+		return os.path.abspath(args.bench_output)
+
+	# The SIMD flavor is part of the name so that '-nosimd' runs do not replace the SIMD ones
+	date = datetime.datetime.now().strftime('%Y%m%d_%H%M%S')
+	filename = '{}_{}_{}_{}.json'.format(re.sub(r'[^A-Za-z0-9_.-]+', '_', device_name), args.cpu, get_simd_name(), date)
+	return os.path.join(build_dir, 'bench_results', filename)
+
+def annotate_bench_results(output_path, device_name):
+	# Record what we ran on and how RTM was built so that runs can be compared across devices and releases
+	with open(output_path, 'r') as f:
+		results = json.load(f)
+
+	context = results.setdefault('context', {})
+	context['rtm_device'] = device_name
+	context['rtm_compiler'] = args.compiler if args.compiler else 'default'
+	context['rtm_cpu'] = args.cpu
+	context['rtm_config'] = args.config
+	context['rtm_simd'] = get_simd_name()
+	context['rtm_fma'] = args.use_fma
+
+	with open(output_path, 'w') as f:
+		json.dump(results, f, indent=2)
+
+	print('Benchmark results written to: {}'.format(output_path))
+
 def do_bench_android():
 	# Switch our working directory to where we built everything
 	working_dir = os.path.join(build_dir, 'tools', 'bench', 'main_android')
@@ -384,12 +455,33 @@ def do_bench_android():
 	if result != 0:
 		sys.exit(result)
 
+	# The app writes its results in its external files directory, see MainActivity.java
+	device_json_path = '/sdcard/Android/data/com.rtm.benchmark/files/rtm_bench.json'
+	subprocess.call('adb shell rm -f {}'.format(device_json_path), shell=True)
+
 	# Execute through ADB
 	run_cmd = 'adb shell am start -n "com.rtm.benchmark/com.rtm.benchmark.MainActivity" -a android.intent.action.MAIN -c android.intent.category.LAUNCHER'
 	result = subprocess.call(run_cmd, shell=True)
 	if result != 0:
 		sys.exit(result)
 
+	# The activity returns right away, wait for the results to show up
+	print('Waiting for the benchmark to complete on the device ...')
+	with open(os.devnull, 'w') as devnull:
+		while subprocess.call('adb shell ls {}'.format(device_json_path), shell=True, stdout=devnull, stderr=devnull) != 0:
+			time.sleep(5)
+
+	device_name = subprocess.check_output('adb shell getprop ro.product.model', shell=True).decode('utf-8').strip()
+	output_path = get_bench_output_path(device_name)
+	if not os.path.exists(os.path.dirname(output_path)):
+		os.makedirs(os.path.dirname(output_path))
+
+	result = subprocess.call('adb pull {} "{}"'.format(device_json_path, output_path), shell=True)
+	if result != 0:
+		sys.exit(result)
+
+	annotate_bench_results(output_path, device_name)
+
 	# Restore working directory
 	os.chdir(build_dir)
 
@@ -399,15 +491,32 @@ def do_bench_native():
 	else:
 		bench_exe = os.path.join(os.getcwd(), 'bin/rtm_bench')
 
-	bench_cmd = '{}'.format(bench_exe)
+	output_path = None
+	if args.compiler == 'emscripten':
+		# The Emscripten file system lives in memory, only the console output is available
+		bench_cmd = 'node {}.js'.format(bench_exe)
+	else:
+		output_path = get_bench_output_path(platform.node())
+		if not os.path.exists(os.path.dirname(output_path)):
+			os.makedirs(os.path.dirname(output_path))
+
+		bench_cmd = '{} --benchmark_out="{}" --benchmark_out_format=json'.format(bench_exe, output_path)
+		if args.bench_perf_counters:
+			bench_cmd += ' --rtm_perf_counters'
 
 	result = subprocess.call(bench_cmd, shell=True)
 	if result != 0:
 		sys.exit(result)
 
+	if output_path:
+		annotate_bench_results(output_path, platform.node())
+
 def do_bench():
 	if args.compiler == 'ios':
-		return	# Not supported on iOS
+		# Not supported on iOS, the app must be launched from Xcode
+		print('Run rtm_bench from Xcode, the JSON results are written to Documents/rtm_bench.json in its application container. Copy them with:')
+		print('xcrun devicectl device copy from --device <device> --domain-type appDataContainer --domain-identifier com.rtm.rtm-bench --source Documents/rtm_bench.json --destination rtm_bench.json')
+		return
 
 	print('Running benchmark ...')
 
@@ -416,9 +525,42 @@ def do_bench():
 	else:
 		do_bench_native()
 
+def do_accuracy():
+	if args.compiler in ['android', 'ios', 'emscripten']:
+		print('The accuracy harness only runs natively on Windows, Linux, and OS X')
+		return
+
+	print('Running accuracy harness ...')
+
+	if platform.system() == 'Windows':
+		accuracy_exe = os.path.join(os.getcwd(), 'bin/rtm_accuracy.exe')
+	else:
+		accuracy_exe = os.path.join(os.getcwd(), 'bin/rtm_accuracy')
+
+	date = datetime.datetime.now().strftime('%Y%m%d_%H%M%S')
+	filename = '{}_{}_{}_{}.json'.format(re.sub(r'[^A-Za-z0-9_.-]+', '_', platform.node()), args.cpu, get_simd_name(), date)
+	output_path = os.path.join(build_dir, 'accuracy_results', filename)
+	if not os.path.exists(os.path.dirname(output_path)):
+		os.makedirs(os.path.dirname(output_path))
+
+	result = subprocess.call('{} -output="{}"'.format(accuracy_exe, output_path), shell=True)
+	print('Accuracy results written to: {}'.format(output_path))
+	if result != 0:
+		sys.exit(result)
+
+	if args.accuracy_baseline:
+		compare_script = os.path.join(build_dir, '..', 'tools', 'accuracy', 'compare_accuracy.py')
+		result = subprocess.call('"{}" "{}" "{}" "{}"'.format(sys.executable, compare_script, args.accuracy_baseline, output_path), shell=True)
+		if result != 0:
+			sys.exit(result)
+
 if __name__ == "__main__":
 	args = parse_argv()
 
+	if args.accuracy_baseline:
+		# Relative to where we were invoked, we switch to the build directory below
+		args.accuracy_baseline = os.path.abspath(args.accuracy_baseline)
+
 	build_dir = os.path.join(os.getcwd(), 'build')
 	cmake_script_dir = os.path.join(os.getcwd(), 'cmake')
 
@@ -448,4 +590,7 @@ if __name__ == "__main__":
 	if args.bench:
 		do_bench()
 
+	if args.accuracy:
+		do_accuracy()
+
 	sys.exit(0)
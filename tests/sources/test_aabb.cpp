@@ -0,0 +1,106 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/aabbf.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvsf.h>
+#include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+TEST_CASE("aabbf math", "[math][aabb]")
+{
+	const float threshold = 1.0E-5F;
+
+	{
+		const aabbf box = aabb_from_min_max(vector_set(-1.0F, 2.0F, 3.0F), vector_set(3.0F, 4.0F, 9.0F));
+		CHECK(vector_all_near_equal3(box.center, vector_set(1.0F, 3.0F, 6.0F), threshold));
+		CHECK(vector_all_near_equal3(box.extent, vector_set(2.0F, 1.0F, 3.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_min(box), vector_set(-1.0F, 2.0F, 3.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(box), vector_set(3.0F, 4.0F, 9.0F), threshold));
+
+		const aabbf expanded = aabb_expand(box, 0.5F);
+		CHECK(vector_all_near_equal3(expanded.center, box.center, threshold));
+		CHECK(vector_all_near_equal3(expanded.extent, vector_set(2.5F, 1.5F, 3.5F), threshold));
+
+		CHECK(aabb_contains_point(box, vector_set(0.0F, 3.0F, 4.0F)));
+		CHECK(aabb_contains_point(box, vector_set(3.0F, 4.0F, 9.0F)));
+		CHECK_FALSE(aabb_contains_point(box, vector_set(0.0F, 3.0F, 9.5F)));
+	}
+
+	{
+		const aabbf box0 = aabb_set(vector_set(0.0F, 0.0F, 0.0F), vector_set(1.0F, 1.0F, 1.0F));
+		const aabbf box1 = aabb_set(vector_set(3.0F, 0.5F, -1.0F), vector_set(1.0F, 2.0F, 1.0F));
+		const aabbf merged = aabb_merge(box0, box1);
+		CHECK(vector_all_near_equal3(aabb_get_min(merged), vector_set(-1.0F, -1.5F, -2.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(merged), vector_set(4.0F, 2.5F, 1.0F), threshold));
+
+		const aabbf merged_point = aabb_merge_point(box0, vector_set(-3.0F, 0.5F, 2.0F));
+		CHECK(vector_all_near_equal3(aabb_get_min(merged_point), vector_set(-3.0F, -1.0F, -1.0F), threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(merged_point), vector_set(1.0F, 1.0F, 2.0F), threshold));
+
+		CHECK_FALSE(aabb_intersects(box0, box1));
+		CHECK(aabb_intersects(box0, aabb_set(vector_set(1.5F, 0.5F, -1.0F), vector_set(1.0F, 2.0F, 1.0F))));
+		CHECK(aabb_intersects(box0, aabb_set(vector_set(2.0F, 0.0F, 0.0F), vector_set(1.0F))));
+		CHECK_FALSE(aabb_intersects(box0, aabb_set(vector_set(2.5F, 0.0F, 0.0F), vector_set(1.0F))));
+	}
+
+	{
+		const aabbf box = aabb_set(vector_set(1.0F, 2.0F, 3.0F), vector_set(0.5F, 1.0F, 2.0F));
+		const quatf rotation = quat_from_euler(scalar_deg_to_rad(20.0F), scalar_deg_to_rad(-35.0F), scalar_deg_to_rad(70.0F));
+		const vector4f translation = vector_set(-2.0F, 5.0F, 1.0F);
+		const qvvf transform = qvv_set(rotation, translation, vector_set(1.5F, -2.0F, 0.5F));
+		const matrix3x4f transform_mtx = matrix_from_qvv(transform);
+
+		// The transformed box must match the bounds of its transformed corners
+		vector4f expected_min = vector_set(1.0E10F);
+		vector4f expected_max = vector_set(-1.0E10F);
+		for (uint32_t corner_index = 0; corner_index < 8; ++corner_index)
+		{
+			const vector4f sign = vector_set((corner_index & 1) != 0 ? 1.0F : -1.0F, (corner_index & 2) != 0 ? 1.0F : -1.0F, (corner_index & 4) != 0 ? 1.0F : -1.0F);
+			const vector4f corner = matrix_mul_point3(vector_mul_add(box.extent, sign, box.center), transform_mtx);
+			expected_min = vector_min(expected_min, corner);
+			expected_max = vector_max(expected_max, corner);
+		}
+
+		const aabbf result_mtx = aabb_mul(box, transform_mtx);
+		CHECK(vector_all_near_equal3(aabb_get_min(result_mtx), expected_min, threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(result_mtx), expected_max, threshold));
+
+		const aabbf result_qvv = aabb_mul(box, transform);
+		CHECK(vector_all_near_equal3(aabb_get_min(result_qvv), expected_min, threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(result_qvv), expected_max, threshold));
+
+		const qvsf transform_qvs = qvs_set(rotation, translation, -2.0F);
+		const aabbf result_qvs = aabb_mul(box, transform_qvs);
+		const aabbf result_qvs_mtx = aabb_mul(box, matrix_from_qvs(transform_qvs));
+		CHECK(vector_all_near_equal3(result_qvs.center, result_qvs_mtx.center, threshold));
+		CHECK(vector_all_near_equal3(result_qvs.extent, result_qvs_mtx.extent, threshold));
+	}
+}
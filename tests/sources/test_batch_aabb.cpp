@@ -0,0 +1,88 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/aabbf.h>
+#include <rtm/scalarf.h>
+#include <rtm/spheref.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/aabbf.h>
+
+using namespace rtm;
+
+TEST_CASE("aabbf batch bounds", "[math][aabb][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// Not a multiple of 8 to exercise the wide loop along with the remainder
+	constexpr uint32_t num_points = 29;
+
+	float3f points[num_points];
+	float points_x[num_points];
+	float points_y[num_points];
+	float points_z[num_points];
+
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+	{
+		const float value = float(point_index);
+		points[point_index] = float3f{ scalar_sin(value * 0.7F) * 10.0F, scalar_cos(value * 1.3F) * 4.0F - 2.0F, value * 0.5F - 3.0F };
+		points_x[point_index] = points[point_index].x;
+		points_y[point_index] = points[point_index].y;
+		points_z[point_index] = points[point_index].z;
+	}
+
+	for (uint32_t count : { 1U, 5U, 8U, 16U, num_points })
+	{
+		vector4f expected_min = vector_load3(&points[0]);
+		vector4f expected_max = expected_min;
+		for (uint32_t point_index = 1; point_index < count; ++point_index)
+		{
+			expected_min = vector_min(expected_min, vector_load3(&points[point_index]));
+			expected_max = vector_max(expected_max, vector_load3(&points[point_index]));
+		}
+
+		const aabbf bounds = aabb_from_points(&points[0], count);
+		CHECK(vector_all_near_equal3(aabb_get_min(bounds), expected_min, threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(bounds), expected_max, threshold));
+
+		const aabbf bounds_soa = aabb_from_points_soa(const_float3f_soa{ points_x, points_y, points_z }, count);
+		CHECK(vector_all_near_equal3(aabb_get_min(bounds_soa), expected_min, threshold));
+		CHECK(vector_all_near_equal3(aabb_get_max(bounds_soa), expected_max, threshold));
+
+		// The farthest point lies on the sphere
+		const spheref sphere = sphere_from_points(&points[0], count);
+		CHECK(vector_all_near_equal3(sphere.center_radius, bounds.center, threshold));
+
+		float max_distance = 0.0F;
+		for (uint32_t point_index = 0; point_index < count; ++point_index)
+		{
+			CHECK(sphere_contains_point(sphere_expand(sphere, threshold), vector_load3(&points[point_index])));
+			max_distance = scalar_max(max_distance, float(vector_distance3(vector_load3(&points[point_index]), bounds.center)));
+		}
+
+		CHECK(scalar_near_equal(sphere_get_radius(sphere), max_distance, threshold));
+	}
+}
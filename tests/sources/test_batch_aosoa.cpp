@@ -0,0 +1,175 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/aosoa.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Covers full blocks, a partial block, and the 4 wide and scalar remainders
+static constexpr uint32_t k_num_transforms = 19;
+static constexpr uint32_t k_num_blocks = qvv_aosoa_num_blocks(k_num_transforms);
+
+static qvvf make_transform(uint32_t index, bool with_negative_scale)
+{
+	const float value = float(index);
+	const quatf rotation = quat_from_euler(value * 0.1F, 1.0F - value * 0.2F, value * 0.3F);
+	const vector4f translation = vector_set(value, -2.0F, value * 0.5F, 0.0F);
+	const float scale_x = with_negative_scale && (index % 3) == 0 ? -1.5F : 1.5F;
+	const vector4f scale = vector_set(scale_x, 0.5F + value * 0.1F, 2.0F, 0.0F);
+	return qvv_set(rotation, translation, scale);
+}
+
+// The matrix code path used with negative scale can return either of the two quaternions that represent a rotation
+static bool is_same_rotation(quatf_arg0 lhs, quatf_arg1 rhs, float threshold)
+{
+	return quat_near_equal(lhs, rhs, threshold) || quat_near_equal(lhs, quat_neg(rhs), threshold);
+}
+
+static void check_near_equal(const qvvf& actual, const qvvf& expected, float threshold)
+{
+	CHECK(is_same_rotation(actual.rotation, expected.rotation, threshold));
+	CHECK(vector_all_near_equal3(actual.translation, expected.translation, threshold));
+	CHECK(vector_all_near_equal3(actual.scale, expected.scale, threshold));
+}
+
+TEST_CASE("qvvf aosoa pack", "[math][qvv][batch]")
+{
+	CHECK(sizeof(qvvf_aosoa8) == 320);
+	CHECK(alignof(qvvf_aosoa8) == 64);
+	CHECK(k_num_blocks == 3);
+
+	qvvf input[k_num_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		input[transform_index] = make_transform(transform_index, false);
+
+	qvvf_aosoa8 blocks[k_num_blocks];
+	qvv_pack_aosoa(input, k_num_transforms, blocks);
+
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		check_near_equal(qvv_aosoa_get(blocks, transform_index), input[transform_index], 0.0F);
+
+	for (uint32_t transform_index = k_num_transforms; transform_index < k_num_blocks * k_qvv_aosoa_width; ++transform_index)
+		check_near_equal(qvv_aosoa_get(blocks, transform_index), qvv_identity(), 0.0F);
+
+	CHECK(blocks[1].translation_x[3] == vector_get_x(input[11].translation));
+
+	qvv_aosoa_set(blocks, 5, input[0]);
+	check_near_equal(qvv_aosoa_get(blocks, 5), input[0], 0.0F);
+	check_near_equal(qvv_aosoa_get(blocks, 6), input[6], 0.0F);
+	qvv_aosoa_set(blocks, 5, input[5]);
+
+	qvvf output[k_num_transforms];
+	qvv_unpack_aosoa(blocks, k_num_transforms, output);
+
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		check_near_equal(output[transform_index], input[transform_index], 0.0F);
+}
+
+TEST_CASE("qvvf aosoa mul", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	for (uint32_t with_negative_scale = 0; with_negative_scale < 2; ++with_negative_scale)
+	{
+		qvvf lhs[k_num_transforms];
+		qvvf rhs[k_num_transforms];
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		{
+			lhs[transform_index] = make_transform(transform_index, with_negative_scale != 0);
+			rhs[transform_index] = make_transform(k_num_transforms - transform_index, false);
+		}
+
+		qvvf_aosoa8 lhs_blocks[k_num_blocks];
+		qvvf_aosoa8 rhs_blocks[k_num_blocks];
+		qvvf_aosoa8 output_blocks[k_num_blocks];
+		qvv_pack_aosoa(lhs, k_num_transforms, lhs_blocks);
+		qvv_pack_aosoa(rhs, k_num_transforms, rhs_blocks);
+
+		qvv_mul_aosoa(lhs_blocks, rhs_blocks, output_blocks, k_num_transforms);
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+			check_near_equal(qvv_aosoa_get(output_blocks, transform_index), qvv_mul(lhs[transform_index], rhs[transform_index]), threshold);
+
+		// The padding remains the identity
+		check_near_equal(qvv_aosoa_get(output_blocks, k_num_blocks * k_qvv_aosoa_width - 1), qvv_identity(), threshold);
+
+		qvv_mul_no_scale_aosoa(lhs_blocks, rhs_blocks, output_blocks, k_num_transforms);
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+			check_near_equal(qvv_aosoa_get(output_blocks, transform_index), qvv_mul_no_scale(lhs[transform_index], rhs[transform_index]), threshold);
+
+		// In place
+		qvv_mul_aosoa(lhs_blocks, rhs_blocks, lhs_blocks, k_num_transforms);
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+			check_near_equal(qvv_aosoa_get(lhs_blocks, transform_index), qvv_mul(lhs[transform_index], rhs[transform_index]), threshold);
+	}
+}
+
+TEST_CASE("qvvf aosoa inverse", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	qvvf input[k_num_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		input[transform_index] = make_transform(transform_index, true);
+
+	qvvf_aosoa8 blocks[k_num_blocks];
+	qvv_pack_aosoa(input, k_num_transforms, blocks);
+	qvv_inverse_aosoa(blocks, blocks, k_num_transforms);
+
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		check_near_equal(qvv_aosoa_get(blocks, transform_index), qvv_inverse(input[transform_index]), threshold);
+
+	check_near_equal(qvv_aosoa_get(blocks, k_num_blocks * k_qvv_aosoa_width - 1), qvv_identity(), threshold);
+}
+
+TEST_CASE("qvvf aosoa mul point3", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	qvvf transforms[k_num_transforms];
+	float3f points[k_num_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		transforms[transform_index] = make_transform(transform_index, true);
+		points[transform_index] = float3f{ value * 0.5F, 1.0F - value, 3.0F };
+	}
+
+	qvvf_aosoa8 blocks[k_num_blocks];
+	qvv_pack_aosoa(transforms, k_num_transforms, blocks);
+
+	float3f output[k_num_transforms];
+	qvv_mul_point3_aosoa(blocks, points, output, k_num_transforms);
+
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+	{
+		const vector4f expected = qvv_mul_point3(vector_load3(points + transform_index), transforms[transform_index]);
+		CHECK(vector_all_near_equal3(vector_load3(output + transform_index), expected, threshold));
+	}
+}
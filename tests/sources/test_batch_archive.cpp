@@ -0,0 +1,292 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/archive.h>
+#include <rtm/batch/archive_file.h>
+#include <rtm/batch/qvvf.h>
+#include <rtm/batch/quatf.h>
+#include <rtm/batch/range.h>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+using namespace rtm;
+
+// Enough elements to cover the 4 wide loops and a partial stream
+static constexpr uint32_t k_num_archive_elements = 19;
+
+static void fill_archive_transforms(qvvf* transforms)
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_archive_elements; ++transform_index)
+	{
+		const float value = float(transform_index);
+		const quatf rotation = quat_from_axis_angle(vector_normalize3(vector_set(1.0F, value, 2.0F)), value * 0.3F);
+		transforms[transform_index] = qvv_set(rotation, vector_set(value, -value, 2.0F * value), vector_set(1.0F + value * 0.1F));
+	}
+}
+
+static size_t write_test_archive(uint8_t* buffer, size_t buffer_size, const qvvf* transforms, const const_float4f_soa& rotations, const const_float3f_soa& positions)
+{
+	archive_writer writer(buffer, buffer_size, 8);
+	CHECK(writer.add_qvvf_array(1, transforms, k_num_archive_elements));
+	CHECK(writer.add_qvvf_packed_array(2, transforms, k_num_archive_elements));
+	CHECK(writer.add_qvvf_soa(3, transforms, k_num_archive_elements));
+	CHECK(writer.add_float4f_soa(4, rotations, k_num_archive_elements));
+	CHECK(writer.add_float3f_soa(5, positions, k_num_archive_elements));
+	CHECK(writer.add_quantized_soa(6, positions, k_num_archive_elements, 16));
+	CHECK(writer.add_quantized_soa(7, rotations, k_num_archive_elements, 12));
+	CHECK(writer.get_num_blocks() == 7);
+	return writer.finalize();
+}
+
+TEST_CASE("batch archive", "[math][batch][archive]")
+{
+	static qvvf transforms[k_num_archive_elements];
+	fill_archive_transforms(transforms);
+
+	alignas(64) static float rotations_x[k_num_archive_elements];
+	alignas(64) static float rotations_y[k_num_archive_elements];
+	alignas(64) static float rotations_z[k_num_archive_elements];
+	alignas(64) static float rotations_w[k_num_archive_elements];
+	alignas(64) static float positions_x[k_num_archive_elements];
+	alignas(64) static float positions_y[k_num_archive_elements];
+	alignas(64) static float positions_z[k_num_archive_elements];
+	for (uint32_t element_index = 0; element_index < k_num_archive_elements; ++element_index)
+	{
+		rotations_x[element_index] = quat_get_x(transforms[element_index].rotation);
+		rotations_y[element_index] = quat_get_y(transforms[element_index].rotation);
+		rotations_z[element_index] = quat_get_z(transforms[element_index].rotation);
+		rotations_w[element_index] = quat_get_w(transforms[element_index].rotation);
+		positions_x[element_index] = vector_get_x(transforms[element_index].translation);
+		positions_y[element_index] = vector_get_y(transforms[element_index].translation);
+		positions_z[element_index] = vector_get_z(transforms[element_index].translation);
+	}
+
+	const const_float4f_soa rotations{ rotations_x, rotations_y, rotations_z, rotations_w };
+	const const_float3f_soa positions{ positions_x, positions_y, positions_z };
+
+	alignas(64) static uint8_t buffer[16 * 1024];
+	const size_t archive_size = write_test_archive(buffer, sizeof(buffer), transforms, rotations, positions);
+
+	{
+		// The size of the archive is known up front
+		const uint64_t expected_size = archive_get_header_size(8)
+			+ archive_get_block_size(archive_block_layout::qvvf_aos, k_num_archive_elements)
+			+ archive_get_block_size(archive_block_layout::qvvf_packed_aos, k_num_archive_elements)
+			+ archive_get_block_size(archive_block_layout::qvvf_soa, k_num_archive_elements)
+			+ archive_get_block_size(archive_block_layout::float4f_soa, k_num_archive_elements)
+			+ archive_get_block_size(archive_block_layout::float3f_soa, k_num_archive_elements)
+			+ archive_get_block_size(archive_block_layout::quantized3_soa, k_num_archive_elements)
+			+ archive_get_block_size(archive_block_layout::quantized4_soa, k_num_archive_elements);
+		CHECK(archive_size == expected_size);
+		CHECK(archive_get_header_size(8) == 640);
+		CHECK(archive_get_stream_stride(archive_block_layout::float3f_soa, k_num_archive_elements) == 32);
+		CHECK(archive_get_stream_stride(archive_block_layout::quantized4_soa, k_num_archive_elements) == 32);
+		CHECK(archive_get_stream_stride(archive_block_layout::qvvf_aos, k_num_archive_elements) == 0);
+		CHECK(archive_get_block_size(archive_block_layout::qvvf_packed_aos, k_num_archive_elements) == 768);
+	}
+
+	{
+		archive_reader reader;
+		REQUIRE(reader.open(buffer, archive_size) == archive_error::none);
+		CHECK(reader.is_open());
+		CHECK(reader.get_num_blocks() == 7);
+		CHECK(reader.find_block(8) == nullptr);
+
+		for (uint32_t block_index = 0; block_index < reader.get_num_blocks(); ++block_index)
+		{
+			const archive_block& block = reader.get_block(block_index);
+			CHECK(block.id == block_index + 1);
+			CHECK(block.num_elements == k_num_archive_elements);
+			CHECK((block.offset % k_archive_alignment) == 0);
+		}
+
+		// The views point into the archive and are used as is by the batch functions
+		const archive_block* transform_block = reader.find_block(1);
+		REQUIRE(transform_block != nullptr);
+		const qvvf* archived_transforms = reader.get_qvvf_array(*transform_block);
+		CHECK(reinterpret_cast<const uint8_t*>(archived_transforms) == buffer + transform_block->offset);
+
+		qvvf composed[k_num_archive_elements];
+		qvv_mul_aos(archived_transforms, transforms, composed, k_num_archive_elements);
+
+		qvvf unpacked[k_num_archive_elements];
+		qvv_load_array(reader.get_qvvf_packed_array(*reader.find_block(2)), unpacked, k_num_archive_elements);
+
+		qvvf from_soa[k_num_archive_elements];
+		soa_unpack(reader.get_qvvf_soa(*reader.find_block(3)), k_num_archive_elements, from_soa);
+
+		for (uint32_t transform_index = 0; transform_index < k_num_archive_elements; ++transform_index)
+		{
+			const qvvf& transform = transforms[transform_index];
+			const qvvf expected = qvv_mul(transform, transform);
+			CHECK(quat_near_equal(composed[transform_index].rotation, expected.rotation, 1.0E-5F));
+			CHECK(vector_all_near_equal3(composed[transform_index].translation, expected.translation, 1.0E-4F));
+			CHECK(quat_near_equal(unpacked[transform_index].rotation, transform.rotation, 0.0F));
+			CHECK(vector_all_near_equal3(unpacked[transform_index].scale, transform.scale, 0.0F));
+			CHECK(quat_near_equal(from_soa[transform_index].rotation, transform.rotation, 0.0F));
+			CHECK(vector_all_near_equal3(from_soa[transform_index].translation, transform.translation, 0.0F));
+			CHECK(vector_all_near_equal3(from_soa[transform_index].scale, transform.scale, 0.0F));
+		}
+
+		// The padding of the transform streams is the identity
+		const const_qvvf_soa soa_transforms = reader.get_qvvf_soa(*reader.find_block(3));
+		CHECK(soa_transforms.rotation.w[k_num_archive_elements] == 1.0F);
+		CHECK(soa_transforms.scale.x[31] == 1.0F);
+		CHECK(soa_transforms.translation.z[k_num_archive_elements] == 0.0F);
+
+		alignas(64) float products_x[32];
+		alignas(64) float products_y[32];
+		alignas(64) float products_z[32];
+		alignas(64) float products_w[32];
+		const archive_block& rotation_block = *reader.find_block(4);
+		const const_float4f_soa archived_rotations = reader.get_float4f_soa(rotation_block);
+		CHECK(archived_rotations.y == archived_rotations.x + 32);
+		quat_mul_soa(archived_rotations, rotations, float4f_soa{ products_x, products_y, products_z, products_w }, k_num_archive_elements);
+
+		const const_float3f_soa archived_positions = reader.get_float3f_soa(*reader.find_block(5));
+		for (uint32_t element_index = 0; element_index < k_num_archive_elements; ++element_index)
+		{
+			const quatf rotation = transforms[element_index].rotation;
+			CHECK(quat_near_equal(quat_set(products_x[element_index], products_y[element_index], products_z[element_index], products_w[element_index]), quat_mul(rotation, rotation), 1.0E-6F));
+			CHECK(archived_positions.z[element_index] == positions_z[element_index]);
+		}
+
+		CHECK(archived_positions.x[k_num_archive_elements] == 0.0F);
+
+		// Quantized blocks carry their range
+		const archive_block& quantized_block = *reader.find_block(6);
+		CHECK(quantized_block.layout == archive_block_layout::quantized3_soa);
+		CHECK(quantized_block.num_bits == 16);
+		CHECK(quantized_block.range_min[1] == -18.0F);
+		CHECK(quantized_block.range_extent[2] == 36.0F);
+
+		const const_quantized4_soa quantized_positions = reader.get_quantized_soa(quantized_block);
+		CHECK(quantized_positions.w == nullptr);
+
+		alignas(64) float dequantized_x[32];
+		alignas(64) float dequantized_y[32];
+		alignas(64) float dequantized_z[32];
+		unpack_range_expand_unorm_soa(quantized_positions, quantized_block.num_bits, archive_get_range_min(quantized_block), archive_get_range_extent(quantized_block), float3f_soa{ dequantized_x, dequantized_y, dequantized_z }, k_num_archive_elements);
+
+		const archive_block& quantized_rotation_block = *reader.find_block(7);
+		const const_quantized4_soa quantized_rotations = reader.get_quantized_soa(quantized_rotation_block);
+		CHECK(quantized_rotations.w == quantized_rotations.x + 96);
+
+		alignas(64) float dequantized_w[32];
+		unpack_range_expand_unorm_soa(quantized_rotations, quantized_rotation_block.num_bits, archive_get_range_min(quantized_rotation_block), archive_get_range_extent(quantized_rotation_block), float4f_soa{ products_x, products_y, products_z, dequantized_w }, k_num_archive_elements);
+
+		for (uint32_t element_index = 0; element_index < k_num_archive_elements; ++element_index)
+		{
+			CHECK(scalar_near_equal(dequantized_x[element_index], positions_x[element_index], 1.0E-3F));
+			CHECK(scalar_near_equal(dequantized_z[element_index], positions_z[element_index], 1.0E-3F));
+			CHECK(scalar_near_equal(dequantized_w[element_index], rotations_w[element_index], 1.0E-3F));
+		}
+	}
+
+	{
+		// Corrupted or truncated archives are rejected
+		archive_reader reader;
+		CHECK(reader.open(buffer + 16, archive_size - 16) == archive_error::misaligned);
+		CHECK(reader.open(buffer, 32) == archive_error::truncated);
+		CHECK(reader.open(buffer, archive_size - 1) == archive_error::truncated);
+		CHECK(!reader.is_open());
+
+		alignas(64) static uint8_t corrupted[16 * 1024];
+		std::memcpy(corrupted, buffer, archive_size);
+		corrupted[0] ^= 0xFF;
+		CHECK(reader.open(corrupted, archive_size) == archive_error::invalid_magic);
+
+		std::memcpy(corrupted, buffer, archive_size);
+		reinterpret_cast<archive_header*>(corrupted)->version = k_archive_version + 1;
+		CHECK(reader.open(corrupted, archive_size) == archive_error::unsupported_version);
+
+		std::memcpy(corrupted, buffer, archive_size);
+		archive_block* blocks = reinterpret_cast<archive_block*>(corrupted + sizeof(archive_header));
+		blocks[2].offset += 16;
+		CHECK(reader.open(corrupted, archive_size) == archive_error::invalid_block);
+
+		std::memcpy(corrupted, buffer, archive_size);
+		blocks[6].num_elements = 1000;
+		CHECK(reader.open(corrupted, archive_size) == archive_error::invalid_block);
+
+		std::memcpy(corrupted, buffer, archive_size);
+		blocks[0].layout = archive_block_layout(42);
+		CHECK(reader.open(corrupted, archive_size) == archive_error::invalid_block);
+		CHECK(!reader.is_open());
+	}
+
+	{
+		// Blocks that do not fit are rejected, the archive stays valid
+		alignas(64) static uint8_t small_buffer[1024];
+		archive_writer writer(small_buffer, sizeof(small_buffer), 2);
+		CHECK(writer.add_float3f_soa(1, positions, k_num_archive_elements));
+		CHECK(!writer.add_qvvf_soa(2, transforms, k_num_archive_elements));
+		CHECK(writer.add_float3f_soa(3, positions, 2));
+		CHECK(!writer.add_float3f_soa(4, positions, 2));
+
+		const size_t small_archive_size = writer.finalize();
+		CHECK(small_archive_size == 256 + 384 + 192);
+
+		archive_reader reader;
+		CHECK(reader.open(small_buffer, small_archive_size) == archive_error::none);
+		CHECK(reader.get_num_blocks() == 2);
+		CHECK(reader.find_block(3) != nullptr);
+	}
+
+	{
+		// Archives are mapped as is from disk
+		const char* filename = "rtm_test_archive.bin";
+		std::FILE* file = std::fopen(filename, "wb");
+		if (file != nullptr)
+		{
+			const bool is_written = std::fwrite(buffer, 1, archive_size, file) == archive_size;
+			std::fclose(file);
+			CHECK(is_written);
+
+			archive_file mapped_file;
+			REQUIRE(mapped_file.open(filename));
+			CHECK(mapped_file.get_size() == archive_size);
+
+			archive_reader reader;
+			CHECK(reader.open(mapped_file.get_data(), mapped_file.get_size()) == archive_error::none);
+			CHECK(reader.get_num_blocks() == 7);
+
+			const qvvf* mapped_transforms = reader.get_qvvf_array(*reader.find_block(1));
+			CHECK(vector_all_near_equal3(mapped_transforms[5].translation, transforms[5].translation, 0.0F));
+
+			mapped_file.close();
+			CHECK(!mapped_file.is_open());
+			std::remove(filename);
+		}
+
+		archive_file missing_file;
+		CHECK(!missing_file.open("rtm_missing_archive.bin"));
+	}
+}
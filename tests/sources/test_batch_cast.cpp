@@ -0,0 +1,107 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2024 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <catch.hpp>
+
+#include <rtm/batch/cast.h>
+
+using namespace rtm;
+
+TEST_CASE("batch cast relative", "[math][batch][cast]")
+{
+	constexpr uint32_t num_values = 7;
+
+	// Far away from the world origin, float32 cannot represent these positions to the centimeter
+	const vector4d origin = vector_set(1.0E7, -3.0E6, 2.5E5, 123.0);
+
+	vector4d vectors[num_values];
+	qvvd transforms[num_values];
+	matrix3x4d matrices[num_values];
+
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+	{
+		const double offset = double(value_index) * 0.0125;
+		const vector4d position = vector_add(origin, vector_set(offset, -offset * 2.0, offset + 0.5, 0.0));
+		const quatd rotation = quat_from_euler(0.1 * double(value_index), -0.7, 1.3);
+		const vector4d scale = vector_set(1.0 + offset, 2.0, -0.5, 0.0);
+
+		vectors[value_index] = vector_set_w(position, double(value_index));
+		transforms[value_index] = qvv_set(rotation, position, scale);
+		matrices[value_index] = matrix_from_qvv(transforms[value_index]);
+	}
+
+	SECTION("vector4")
+	{
+		vector4f output[num_values];
+		vector_cast_relative_array(vectors, origin, output, num_values);
+
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		{
+			// The [w] component of the origin is ignored
+			const vector4f expected = vector_cast(vector_sub(vectors[value_index], vector_set_w(origin, 0.0)));
+			CHECK(vector_all_near_equal(output[value_index], expected, 0.0F));
+			CHECK(vector_get_w(output[value_index]) == float(value_index));
+		}
+
+		// The offsets are preserved while narrowing before subtracting loses them
+		CHECK(scalar_near_equal(vector_get_x(output[1]), 0.0125F, 1.0E-6F));
+		CHECK(!scalar_near_equal(vector_get_x(vector_sub(vector_cast(vectors[1]), vector_cast(origin))), 0.0125F, 1.0E-3F));
+
+		vector4f non_temporal_output[num_values];
+		vector_cast_relative_array(vectors, origin, non_temporal_output, num_values, store_mode::non_temporal);
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+			CHECK(vector_all_near_equal(non_temporal_output[value_index], output[value_index], 0.0F));
+	}
+
+	SECTION("qvv")
+	{
+		qvvf output[num_values];
+		qvv_cast_relative_array(transforms, origin, output, num_values);
+
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		{
+			const qvvd& transform = transforms[value_index];
+			CHECK(quat_near_equal(output[value_index].rotation, quat_cast(transform.rotation), 0.0F));
+			CHECK(vector_all_near_equal(output[value_index].translation, vector_cast(vector_sub(transform.translation, vector_set_w(origin, 0.0))), 0.0F));
+			CHECK(vector_all_near_equal(output[value_index].scale, vector_cast(transform.scale), 0.0F));
+		}
+	}
+
+	SECTION("matrix3x4")
+	{
+		matrix3x4f output[num_values];
+		matrix_cast_relative_array(matrices, origin, output, num_values, store_mode::non_temporal);
+
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		{
+			const matrix3x4d& mtx = matrices[value_index];
+			CHECK(vector_all_near_equal(output[value_index].x_axis, vector_cast(mtx.x_axis), 0.0F));
+			CHECK(vector_all_near_equal(output[value_index].y_axis, vector_cast(mtx.y_axis), 0.0F));
+			CHECK(vector_all_near_equal(output[value_index].z_axis, vector_cast(mtx.z_axis), 0.0F));
+			CHECK(vector_all_near_equal(output[value_index].w_axis, vector_cast(vector_sub(mtx.w_axis, vector_set_w(origin, 0.0))), 0.0F));
+		}
+	}
+}
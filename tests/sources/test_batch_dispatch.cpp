@@ -0,0 +1,247 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/dispatch.h>
+#include <rtm/batch/matrix3x4f.h>
+#include <rtm/batch/quatf.h>
+#include <rtm/batch/qvvf.h>
+#include <rtm/batch/range.h>
+
+#include <cstring>
+
+using namespace rtm;
+
+TEST_CASE("batch dispatch cpu detection", "[math][batch][dispatch]")
+{
+	// We are running, the CPU supports what we are compiled for
+	CHECK(cpu_supports(cpu_isa::scalar));
+	CHECK(cpu_supports(rtm_impl::get_compiled_isa()));
+	CHECK(is_dispatch_isa_available(rtm_impl::get_compiled_isa()));
+
+	// The most capable variant is selected
+	const cpu_isa selected_isa = get_dispatch_isa();
+	CHECK(is_dispatch_isa_available(selected_isa));
+	CHECK(uint32_t(selected_isa) >= uint32_t(rtm_impl::get_compiled_isa()));
+	for (uint32_t isa_index = uint32_t(selected_isa) + 1; isa_index < rtm_impl::k_num_cpu_isa; ++isa_index)
+		CHECK_FALSE(is_dispatch_isa_available(cpu_isa(isa_index)));
+
+#if defined(RTM_DISPATCH_AVX2)
+	CHECK(is_dispatch_isa_available(cpu_isa::avx2) == cpu_supports(cpu_isa::avx2));
+#endif
+
+	CHECK(get_dispatch_name() != nullptr);
+	CHECK_FALSE(set_dispatch_isa(cpu_isa(rtm_impl::k_num_cpu_isa)));
+	CHECK(get_dispatch_isa() == selected_isa);
+}
+
+TEST_CASE("batch dispatch kernels", "[math][batch][dispatch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_elements = 19;
+
+	quatf quats[num_elements];
+	qvvf transforms[num_elements];
+	float quat_x[num_elements];
+	float quat_y[num_elements];
+	float quat_z[num_elements];
+	float quat_w[num_elements];
+
+	for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+	{
+		const float angle = float(element_index) * 0.31F;
+		quats[element_index] = quat_from_euler(angle, angle * 0.5F - 1.0F, 0.7F - angle);
+		transforms[element_index] = qvv_set(quats[element_index], vector_set(angle, 1.0F - angle, angle * 0.5F), vector_set(1.0F, 1.5F, 0.5F));
+
+		quat_x[element_index] = quat_get_x(quats[element_index]);
+		quat_y[element_index] = quat_get_y(quats[element_index]);
+		quat_z[element_index] = quat_get_z(quats[element_index]);
+		quat_w[element_index] = quat_get_w(quats[element_index]);
+	}
+
+	const cpu_isa selected_isa = get_dispatch_isa();
+
+	// Every available variant must match the kernels compiled here
+	for (uint32_t isa_index = 0; isa_index < rtm_impl::k_num_cpu_isa; ++isa_index)
+	{
+		if (!set_dispatch_isa(cpu_isa(isa_index)))
+			continue;
+
+		INFO("Variant: " << get_dispatch_name());
+
+		{
+			const const_float4f_soa quats_soa = { quat_x, quat_y, quat_z, quat_w };
+
+			float out_x[num_elements];
+			float out_y[num_elements];
+			float out_z[num_elements];
+			float out_w[num_elements];
+			quat_mul_soa_dispatch(quats_soa, quats_soa, float4f_soa{ out_x, out_y, out_z, out_w }, num_elements);
+
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+			{
+				const quatf result = quat_set(out_x[element_index], out_y[element_index], out_z[element_index], out_w[element_index]);
+				CHECK(quat_near_equal(result, quat_mul(quats[element_index], quats[element_index]), threshold));
+			}
+		}
+
+		{
+			matrix3x4f matrices[num_elements];
+			quatf results[num_elements];
+			matrix_from_quat_aos_dispatch(quats, matrices, num_elements);
+			quat_from_matrix_aos_dispatch(matrices, results, num_elements);
+
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+				CHECK(quat_near_equal(results[element_index], quat_from_matrix(matrix3x4f(matrix_from_quat(quats[element_index]))), threshold));
+		}
+
+		{
+			matrix3x4f lhs[num_elements];
+			matrix3x4f results[num_elements];
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+				lhs[element_index] = matrix_from_qvv(transforms[element_index]);
+
+			matrix_mul_aos_dispatch(lhs, lhs, results, num_elements);
+
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+			{
+				const matrix3x4f expected = matrix_mul(lhs[element_index], lhs[element_index]);
+				CHECK(vector_all_near_equal3(results[element_index].x_axis, expected.x_axis, threshold));
+				CHECK(vector_all_near_equal3(results[element_index].y_axis, expected.y_axis, threshold));
+				CHECK(vector_all_near_equal3(results[element_index].z_axis, expected.z_axis, threshold));
+				CHECK(vector_all_near_equal3(results[element_index].w_axis, expected.w_axis, threshold));
+			}
+		}
+
+		{
+			qvvf results[num_elements];
+			qvv_mul_aos_dispatch(transforms, transforms, results, num_elements);
+
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+			{
+				const qvvf expected = qvv_mul(transforms[element_index], transforms[element_index]);
+				CHECK(quat_near_equal(results[element_index].rotation, expected.rotation, threshold));
+				CHECK(vector_all_near_equal3(results[element_index].translation, expected.translation, threshold));
+				CHECK(vector_all_near_equal3(results[element_index].scale, expected.scale, threshold));
+			}
+		}
+
+		{
+			float3f points[num_elements];
+			uint32_t transform_indices[num_elements];
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+			{
+				points[element_index] = float3f{ float(element_index), 2.0F, -float(element_index) * 0.5F };
+				transform_indices[element_index] = (element_index * 7) % num_elements;
+			}
+
+			float3f results[num_elements];
+			float3f indexed_results[num_elements];
+			qvv_mul_point3_aos_dispatch(transforms[3], points, results, num_elements);
+			qvv_mul_point3_indexed_aos_dispatch(transforms, transform_indices, points, indexed_results, num_elements);
+
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+			{
+				const vector4f point = vector_load3(&points[element_index]);
+				CHECK(vector_all_near_equal3(vector_load3(&results[element_index]), qvv_mul_point3(point, transforms[3]), threshold));
+				CHECK(vector_all_near_equal3(vector_load3(&indexed_results[element_index]), qvv_mul_point3(point, transforms[transform_indices[element_index]]), threshold));
+			}
+		}
+
+		{
+			qvvf_packed packed[num_elements];
+			qvvf results[num_elements];
+			qvv_store_array_dispatch(transforms, packed, num_elements);
+			qvv_load_array_dispatch(packed, results, num_elements);
+
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+			{
+				CHECK(quat_near_equal(results[element_index].rotation, transforms[element_index].rotation, 0.0F));
+				CHECK(vector_all_near_equal3(results[element_index].translation, transforms[element_index].translation, 0.0F));
+				CHECK(vector_all_near_equal3(results[element_index].scale, transforms[element_index].scale, 0.0F));
+			}
+		}
+
+		{
+			const const_float4f_soa quats_soa = { quat_x, quat_y, quat_z, quat_w };
+			const const_float3f_soa vectors_soa = { quat_x, quat_y, quat_z };
+
+			vector4f range_min;
+			vector4f range_extent;
+			vector4f expected_min;
+			vector4f expected_extent;
+			vector_range_soa_dispatch(quats_soa, num_elements, range_min, range_extent);
+			vector_range_soa(quats_soa, num_elements, expected_min, expected_extent);
+			CHECK(vector_all_near_equal(range_min, expected_min, 0.0F));
+			CHECK(vector_all_near_equal(range_extent, expected_extent, 0.0F));
+
+			vector4f range_min3;
+			vector4f range_extent3;
+			vector_range_soa_dispatch(vectors_soa, num_elements, range_min3, range_extent3);
+			CHECK(vector_all_near_equal3(range_min3, expected_min, 0.0F));
+			CHECK(vector_all_near_equal3(range_extent3, expected_extent, 0.0F));
+
+			uint16_t packed_x[num_elements];
+			uint16_t packed_y[num_elements];
+			uint16_t packed_z[num_elements];
+			uint16_t packed_w[num_elements];
+			const quantized4_soa packed = { packed_x, packed_y, packed_z, packed_w };
+			pack_range_reduce_unorm_soa_dispatch(quats_soa, range_min, range_extent, 16, packed, num_elements);
+
+			float out_x[num_elements];
+			float out_y[num_elements];
+			float out_z[num_elements];
+			float out_w[num_elements];
+			unpack_range_expand_unorm_soa_dispatch(packed, 16, range_min, range_extent, float4f_soa{ out_x, out_y, out_z, out_w }, num_elements);
+
+			uint16_t packed3_x[num_elements];
+			uint16_t packed3_y[num_elements];
+			uint16_t packed3_z[num_elements];
+			const quantized4_soa packed3 = { packed3_x, packed3_y, packed3_z, nullptr };
+			pack_range_reduce_unorm_soa_dispatch(vectors_soa, range_min, range_extent, 12, packed3, num_elements);
+
+			float out3_x[num_elements];
+			float out3_y[num_elements];
+			float out3_z[num_elements];
+			unpack_range_expand_unorm_soa_dispatch(packed3, 12, range_min, range_extent, float3f_soa{ out3_x, out3_y, out3_z }, num_elements);
+
+			for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+			{
+				const quatf result = quat_set(out_x[element_index], out_y[element_index], out_z[element_index], out_w[element_index]);
+				CHECK(quat_near_equal(result, quats[element_index], 1.0E-4F));
+
+				const vector4f result3 = vector_set(out3_x[element_index], out3_y[element_index], out3_z[element_index]);
+				CHECK(vector_all_near_equal3(result3, quat_to_vector(quats[element_index]), 1.0E-3F));
+			}
+		}
+	}
+
+	CHECK(set_dispatch_isa(selected_isa));
+}
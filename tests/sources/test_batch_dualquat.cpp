@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/dualquatf.h>
+#include <rtm/batch/dualquatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static dualquatf dualquat_neg(const dualquatf& input)
+{
+	return dualquat_set(quat_neg(input.real), quat_neg(input.dual));
+}
+
+TEST_CASE("dualquatf batch blend", "[math][dualquat][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	constexpr uint32_t num_bones = 6;
+	dualquatf palette[num_bones];
+	for (uint32_t bone_index = 0; bone_index < num_bones; ++bone_index)
+	{
+		const float value = float(bone_index);
+		palette[bone_index] = dualquat_from_rotation_translation(quat_from_euler(value * 0.3F, 1.0F - value * 0.2F, value * 0.1F), vector_set(value, -2.0F, value * 0.5F));
+	}
+
+	// The last bone is stored in the opposite hemisphere, it must blend like its positive counterpart
+	palette[num_bones - 1] = dualquat_neg(palette[num_bones - 2]);
+
+	constexpr uint32_t num_vertices = 11;
+	uint16_t bone_indices[num_vertices * 4];
+	float bone_weights[num_vertices * 4];
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+		{
+			bone_indices[vertex_index * 4 + influence_index] = uint16_t((vertex_index + influence_index * 2) % num_bones);
+			bone_weights[vertex_index * 4 + influence_index] = float(influence_index + 1) * 0.1F;
+		}
+	}
+
+	// Single influences
+	bone_weights[0] = 1.0F;
+	bone_weights[1] = bone_weights[2] = bone_weights[3] = 0.0F;
+	bone_indices[40] = 2;
+	bone_weights[40] = 1.0F;
+	bone_weights[41] = bone_weights[42] = bone_weights[43] = 0.0F;
+
+	dualquatf output[num_vertices];
+	dualquat_blend4_aos(palette, bone_indices, bone_weights, output, num_vertices);
+
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const uint16_t* vertex_bone_indices = bone_indices + vertex_index * 4;
+		const float* vertex_bone_weights = bone_weights + vertex_index * 4;
+
+		const quatf pivot = palette[vertex_bone_indices[0]].real;
+		vector4f real = vector_zero();
+		vector4f dual = vector_zero();
+		for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+		{
+			dualquatf influence = palette[vertex_bone_indices[influence_index]];
+			if (quat_dot(influence.real, pivot) < 0.0F)
+				influence = dualquat_neg(influence);
+
+			real = vector_add(real, vector_mul(quat_to_vector(influence.real), vertex_bone_weights[influence_index]));
+			dual = vector_add(dual, vector_mul(quat_to_vector(influence.dual), vertex_bone_weights[influence_index]));
+		}
+
+		const dualquatf expected = dualquat_normalize(dualquat_set(vector_to_quat(real), vector_to_quat(dual)));
+		CHECK(dualquat_near_equal(output[vertex_index], expected, threshold));
+		CHECK(quat_is_normalized(output[vertex_index].real, threshold));
+	}
+
+	CHECK(dualquat_near_equal(output[0], palette[bone_indices[0]], threshold));
+	CHECK(dualquat_near_equal(output[10], palette[2], threshold));
+
+	{
+		// Two bones with the same rotation blend their translations linearly, even when one is flipped
+		const quatf rotation = quat_from_euler(0.4F, -0.7F, 1.3F);
+		const dualquatf pair[2] = { dualquat_from_rotation_translation(rotation, vector_set(1.0F, 2.0F, 3.0F)), dualquat_neg(dualquat_from_rotation_translation(rotation, vector_set(3.0F, -2.0F, 5.0F))) };
+		const uint16_t pair_indices[4] = { 0, 1, 0, 0 };
+		const float pair_weights[4] = { 0.5F, 0.5F, 0.0F, 0.0F };
+
+		dualquatf blended;
+		dualquat_blend4_aos(pair, pair_indices, pair_weights, &blended, 1);
+		CHECK(quat_near_equal(blended.real, rotation, threshold));
+		CHECK(vector_all_near_equal3(dualquat_get_translation(blended), vector_set(2.0F, 0.0F, 4.0F), threshold));
+	}
+}
@@ -0,0 +1,319 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/batch/matrix3x4f.h>
+
+using namespace rtm;
+
+static bool matrix_near_equal(matrix3x4f_arg0 lhs, matrix3x4f_arg1 rhs, float threshold)
+{
+	return vector_all_near_equal3(lhs.x_axis, rhs.x_axis, threshold)
+		&& vector_all_near_equal3(lhs.y_axis, rhs.y_axis, threshold)
+		&& vector_all_near_equal3(lhs.z_axis, rhs.z_axis, threshold)
+		&& vector_all_near_equal3(lhs.w_axis, rhs.w_axis, threshold);
+}
+
+static void check_transposed(const float3x4f& transposed, matrix3x4f_arg0 mtx, float threshold)
+{
+	float4f axes[4];
+	vector_store(mtx.x_axis, &axes[0]);
+	vector_store(mtx.y_axis, &axes[1]);
+	vector_store(mtx.z_axis, &axes[2]);
+	vector_store(mtx.w_axis, &axes[3]);
+
+	CHECK(vector_all_near_equal(vector_load(&transposed.x_row), vector_set(axes[0].x, axes[1].x, axes[2].x, axes[3].x), threshold));
+	CHECK(vector_all_near_equal(vector_load(&transposed.y_row), vector_set(axes[0].y, axes[1].y, axes[2].y, axes[3].y), threshold));
+	CHECK(vector_all_near_equal(vector_load(&transposed.z_row), vector_set(axes[0].z, axes[1].z, axes[2].z, axes[3].z), threshold));
+}
+
+TEST_CASE("matrix3x4f batch math", "[math][matrix3x4][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// More matrices than the prefetch distance
+	constexpr uint32_t num_matrices = 11;
+
+	matrix3x4f lhs[num_matrices];
+	matrix3x4f rhs[num_matrices];
+	matrix3x4f output[num_matrices];
+	alignas(16) float3x4f transposed_output[num_matrices];
+
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const float angle = float(matrix_index) * 0.37F;
+		lhs[matrix_index] = matrix_from_qvv(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, -1.0F, 2.0F * angle), vector_set(1.0F, 1.5F, 0.5F + angle));
+		rhs[matrix_index] = matrix_from_qvv(quat_from_euler(1.2F - angle, angle * 0.3F, -angle), vector_set(-2.0F, angle, 0.5F), vector_set(0.75F, 1.0F, -1.0F));
+	}
+
+	const matrix3x4f shared_rhs = rhs[3];
+
+	matrix_mul_aos(lhs, rhs, output, num_matrices);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		CHECK(matrix_near_equal(output[matrix_index], matrix_mul(lhs[matrix_index], rhs[matrix_index]), threshold));
+
+	matrix_mul_aos(lhs, rhs, transposed_output, num_matrices, store_mode::non_temporal);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		check_transposed(transposed_output[matrix_index], matrix_mul(lhs[matrix_index], rhs[matrix_index]), threshold);
+
+	matrix_mul_aos(lhs, shared_rhs, output, num_matrices, store_mode::non_temporal);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		CHECK(matrix_near_equal(output[matrix_index], matrix_mul(lhs[matrix_index], shared_rhs), threshold));
+
+	matrix_mul_aos(lhs, shared_rhs, transposed_output, num_matrices);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		check_transposed(transposed_output[matrix_index], matrix_mul(lhs[matrix_index], shared_rhs), threshold);
+
+	{
+		// In place, the output aliases the lhs
+		matrix3x4f in_place[num_matrices];
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			in_place[matrix_index] = lhs[matrix_index];
+
+		matrix_mul_aos(in_place, rhs, in_place, num_matrices);
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			CHECK(matrix_near_equal(in_place[matrix_index], matrix_mul(lhs[matrix_index], rhs[matrix_index]), threshold));
+	}
+}
+
+TEST_CASE("matrix3x4f batch indexed", "[math][matrix3x4][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// More outputs than the prefetch distances, gathered from fewer matrices
+	constexpr uint32_t num_matrices = 7;
+	constexpr uint32_t num_outputs = 37;
+
+	matrix3x4f palette[num_matrices];
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const float angle = float(matrix_index) * 0.37F;
+		palette[matrix_index] = matrix_from_qvv(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, -1.0F, 2.0F * angle), vector_set(1.0F, 1.5F, 0.5F + angle));
+	}
+
+	uint32_t indices[num_outputs];
+	matrix3x4f rhs[num_outputs];
+	float3f points[num_outputs];
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+	{
+		const float angle = float(output_index) * 0.21F;
+		indices[output_index] = (output_index * 5 + 3) % num_matrices;
+		rhs[output_index] = matrix_from_qvv(quat_from_euler(1.2F - angle, angle * 0.3F, -angle), vector_set(-2.0F, angle, 0.5F), vector_set(0.75F, 1.0F, -1.0F));
+		points[output_index] = float3f{ angle, 1.0F - angle, 2.0F };
+	}
+
+	matrix3x4f output[num_outputs];
+	matrix_mul_indexed_aos(palette, indices, rhs, output, num_outputs);
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+		CHECK(matrix_near_equal(output[output_index], matrix_mul(palette[indices[output_index]], rhs[output_index]), threshold));
+
+	// In place, the output aliases the rhs
+	matrix_mul_indexed_aos(palette, indices, rhs, rhs, num_outputs, store_mode::non_temporal);
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+		CHECK(matrix_near_equal(rhs[output_index], output[output_index], 0.0F));
+
+	float3f point_output[num_outputs];
+	matrix_mul_point3_indexed_aos(palette, indices, points, point_output, num_outputs);
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+	{
+		const vector4f expected = matrix_mul_point3(vector_load3(points + output_index), palette[indices[output_index]]);
+		CHECK(vector_all_near_equal3(vector_load3(point_output + output_index), expected, threshold));
+	}
+
+	// Without prefetching, in place
+	matrix_mul_point3_indexed_aos(palette, indices, points, points, num_outputs, 0);
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+		CHECK(vector_all_near_equal3(vector_load3(points + output_index), vector_load3(point_output + output_index), 0.0F));
+}
+
+TEST_CASE("matrix3x4f batch inverse", "[math][matrix3x4][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// More matrices than the prefetch distance
+	constexpr uint32_t num_matrices = 11;
+
+	matrix3x4f rigid[num_matrices];
+	matrix3x4f scaled[num_matrices];
+	matrix3x4f output[num_matrices];
+
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const float angle = float(matrix_index) * 0.37F;
+		const quatf rotation = quat_from_euler(angle, 0.5F - angle, angle * 1.5F);
+		const vector4f translation = vector_set(angle, -1.0F, 2.0F * angle);
+		rigid[matrix_index] = matrix_from_qvv(rotation, translation, vector_set(1.0F));
+		scaled[matrix_index] = matrix_from_qvv(rotation, translation, vector_set(0.5F + angle));
+	}
+
+	matrix_inverse_rigid_aos(rigid, output, num_matrices);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		CHECK(matrix_near_equal(output[matrix_index], matrix_inverse(rigid[matrix_index]), threshold));
+
+	matrix_inverse_uniform_scale_aos(scaled, output, num_matrices, store_mode::non_temporal);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		CHECK(matrix_near_equal(output[matrix_index], matrix_inverse(scaled[matrix_index]), threshold));
+
+	{
+		// In place
+		matrix3x4f in_place[num_matrices];
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			in_place[matrix_index] = scaled[matrix_index];
+
+		matrix_inverse_uniform_scale_aos(in_place, in_place, num_matrices);
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			CHECK(matrix_near_equal(in_place[matrix_index], matrix_inverse_uniform_scale(scaled[matrix_index]), 0.0F));
+	}
+
+	{
+		// General inverse with non-uniform scale and shear
+		matrix3x4f general[num_matrices];
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		{
+			const float value = float(matrix_index);
+			const matrix3x4f scaled_mtx = matrix_from_qvv(quat_from_euler(value * 0.3F, 1.0F - value, 0.2F), vector_set(value, 2.0F, -value), vector_set(0.5F + value * 0.1F, 1.5F, 0.75F));
+			const matrix3x4f shear = matrix_set(vector_set(1.0F, 0.25F * value, 0.0F), vector_set(0.0F, 1.0F, 0.1F), vector_set(0.3F, 0.0F, 1.0F), vector_zero());
+			general[matrix_index] = matrix_mul(shear, scaled_mtx);
+		}
+
+		matrix_inverse_aos(general, output, num_matrices, store_mode::non_temporal);
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			CHECK(matrix_near_equal(output[matrix_index], matrix_inverse(general[matrix_index]), threshold));
+
+		// Singular matrices are replaced by the fallback, in the wide loop and in the remainder
+		const matrix3x4f fallback = matrix_set(vector_set(2.0F, 0.0F, 0.0F), vector_set(0.0F, 2.0F, 0.0F), vector_set(0.0F, 0.0F, 2.0F), vector_set(1.0F, 2.0F, 3.0F));
+		general[1].z_axis = vector_zero();
+		general[9].y_axis = vector_zero();
+
+		matrix_inverse_aos(general, general, num_matrices, fallback);
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		{
+			if (matrix_index == 1 || matrix_index == 9)
+				CHECK(matrix_near_equal(general[matrix_index], fallback, 0.0F));
+			else
+				CHECK(matrix_near_equal(general[matrix_index], output[matrix_index], threshold));
+		}
+	}
+}
+
+TEST_CASE("matrix3x4f batch orthonormalize", "[math][matrix3x4][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// More matrices than the prefetch distance and not a multiple of 4
+	constexpr uint32_t num_matrices = 11;
+
+	matrix3x4f input[num_matrices];
+	matrix3x4f output[num_matrices];
+	matrix3x3f input3x3[num_matrices];
+	matrix3x3f output3x3[num_matrices];
+
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const float angle = float(matrix_index) * 0.37F;
+		const float sign = (matrix_index % 3) == 0 ? -1.0F : 1.0F;
+		matrix3x4f mtx = matrix_from_qvv(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, -1.0F, 2.0F * angle), vector_set(1.0F + angle, 1.5F, sign * 0.5F));
+
+		// Skew the axes a bit
+		mtx.y_axis = vector_mul_add(mtx.x_axis, 0.01F * angle, mtx.y_axis);
+		mtx.z_axis = vector_mul_add(mtx.y_axis, -0.02F, mtx.z_axis);
+
+		input[matrix_index] = mtx;
+		input3x3[matrix_index] = matrix_set(mtx.x_axis, mtx.y_axis, mtx.z_axis);
+	}
+
+	matrix_orthonormalize_aos(input, output, num_matrices);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		CHECK(matrix_near_equal(output[matrix_index], matrix_orthonormalize(input[matrix_index]), threshold));
+
+	matrix_orthonormalize_aos(input3x3, output3x3, num_matrices, store_mode::non_temporal);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const matrix3x3f reference = matrix_orthonormalize(input3x3[matrix_index]);
+		CHECK(vector_all_near_equal3(output3x3[matrix_index].x_axis, reference.x_axis, threshold));
+		CHECK(vector_all_near_equal3(output3x3[matrix_index].y_axis, reference.y_axis, threshold));
+		CHECK(vector_all_near_equal3(output3x3[matrix_index].z_axis, reference.z_axis, threshold));
+	}
+
+	matrix_orthonormalize_polar_aos(input, output, num_matrices);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+		CHECK(matrix_near_equal(output[matrix_index], matrix_orthonormalize_polar(input[matrix_index]), 0.0F));
+
+	matrix_orthonormalize_polar_aos(input3x3, output3x3, num_matrices);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const matrix3x3f reference = matrix_orthonormalize_polar(input3x3[matrix_index]);
+		CHECK(vector_all_near_equal3(output3x3[matrix_index].x_axis, reference.x_axis, 0.0F));
+		CHECK(vector_all_near_equal3(output3x3[matrix_index].y_axis, reference.y_axis, 0.0F));
+		CHECK(vector_all_near_equal3(output3x3[matrix_index].z_axis, reference.z_axis, 0.0F));
+	}
+
+	{
+		// In place
+		matrix3x4f in_place[num_matrices];
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			in_place[matrix_index] = input[matrix_index];
+
+		matrix_orthonormalize_aos(in_place, in_place, num_matrices);
+		for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+			CHECK(matrix_near_equal(in_place[matrix_index], matrix_orthonormalize(input[matrix_index]), threshold));
+	}
+}
+
+TEST_CASE("matrix3x4f batch change detection", "[math][matrix3x4][batch]")
+{
+	// Spans 2 output entries, the last one partially
+	constexpr uint32_t num_matrices = 37;
+
+	matrix3x4f previous[num_matrices];
+	matrix3x4f current[num_matrices];
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const float value = float(matrix_index);
+		previous[matrix_index] = matrix_from_qvv(quat_from_euler(value * 0.1F, -0.5F, value * 0.3F), vector_set(value, 1.0F, -value), vector_set(1.0F, 2.0F, 1.0F));
+		current[matrix_index] = previous[matrix_index];
+	}
+
+	uint32_t dirty_bits[2] = { 0xFFFFFFFFU, 0xFFFFFFFFU };
+	CHECK(matrix_detect_changes_aos(current, previous, num_matrices, 1.0E-4F, 1.0E-3F, dirty_bits) == 0);
+	CHECK(dirty_bits[0] == 0);
+	CHECK(dirty_bits[1] == 0);
+
+	// Below the thresholds
+	current[1].w_axis = vector_add(current[1].w_axis, vector_set(0.0F, 0.0005F, 0.0F));
+	current[2].y_axis = vector_add(current[2].y_axis, vector_set(0.00005F, 0.0F, 0.0F));
+	CHECK(matrix_detect_changes_aos(current, previous, num_matrices, 1.0E-4F, 1.0E-3F, dirty_bits) == 0);
+
+	// Above the thresholds, one of each axis
+	current[0].x_axis = vector_add(current[0].x_axis, vector_set(0.001F, 0.0F, 0.0F));
+	current[7].y_axis = vector_add(current[7].y_axis, vector_set(0.0F, 0.001F, 0.0F));
+	current[31].z_axis = vector_add(current[31].z_axis, vector_set(0.0F, 0.0F, 0.001F));
+	current[36].w_axis = vector_add(current[36].w_axis, vector_set(0.01F, 0.0F, 0.0F));
+
+	CHECK(matrix_detect_changes_aos(current, previous, num_matrices, 1.0E-4F, 1.0E-3F, dirty_bits) == 4);
+	CHECK(dirty_bits[0] == ((1U << 0) | (1U << 7) | (1U << 31)));
+	CHECK(dirty_bits[1] == (1U << (36 - 32)));
+}
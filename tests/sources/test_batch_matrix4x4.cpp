@@ -0,0 +1,211 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/matrix4x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/matrix4x4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// A perspective projection looking down +Z with a 90 degree field of view, near at 1.0 and far at 100.0.
+static matrix4x4f make_projection(clip_depth_range depth_range)
+{
+	const float near_distance = 1.0F;
+	const float far_distance = 100.0F;
+
+	if (depth_range == clip_depth_range::zero_to_one)
+	{
+		const float depth_scale = far_distance / (far_distance - near_distance);
+		return matrix_set(
+			vector_set(1.0F, 0.0F, 0.0F, 0.0F),
+			vector_set(0.0F, 1.0F, 0.0F, 0.0F),
+			vector_set(0.0F, 0.0F, depth_scale, 1.0F),
+			vector_set(0.0F, 0.0F, -near_distance * depth_scale, 0.0F));
+	}
+	else
+	{
+		const float depth_scale = (far_distance + near_distance) / (far_distance - near_distance);
+		const float depth_offset = -2.0F * far_distance * near_distance / (far_distance - near_distance);
+		return matrix_set(
+			vector_set(1.0F, 0.0F, 0.0F, 0.0F),
+			vector_set(0.0F, 1.0F, 0.0F, 0.0F),
+			vector_set(0.0F, 0.0F, depth_scale, 1.0F),
+			vector_set(0.0F, 0.0F, depth_offset, 0.0F));
+	}
+}
+
+static bool is_bit_set(const uint32_t* bits, uint32_t index)
+{
+	return (bits[index / 32] & (1U << (index % 32))) != 0;
+}
+
+static void test_projection(clip_depth_range depth_range)
+{
+	const float threshold = 1.0E-5F;
+
+	// Not a multiple of 4 to cover the remainder and straddles two output words
+	constexpr uint32_t num_points = 39;
+
+	const matrix4x4f projection = make_projection(depth_range);
+
+	float3f points[num_points];
+	float points_x[num_points];
+	float points_y[num_points];
+	float points_z[num_points];
+	bool expected_visible[num_points];
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+	{
+		const float value = float(point_index);
+		const float depth = value * 3.5F - 10.0F;	// From behind the camera to past the far plane
+
+		points[point_index] = float3f{ scalar_sin(value) * 5.0F, scalar_cos(value * 0.5F) * 3.0F, depth };
+		points_x[point_index] = points[point_index].x;
+		points_y[point_index] = points[point_index].y;
+		points_z[point_index] = points[point_index].z;
+		expected_visible[point_index] = depth >= 1.0F && depth <= 100.0F;
+	}
+
+	float4f clip_output[num_points];
+	matrix_project_points_aos(points, projection, clip_output, num_points);
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+	{
+		const vector4f expected = matrix_mul_vector(vector_set(points[point_index].x, points[point_index].y, points[point_index].z, 1.0F), projection);
+		CHECK(vector_all_near_equal(vector_load(&clip_output[point_index]), expected, threshold));
+	}
+
+	float3f ndc_output[num_points];
+	uint32_t visible_bits[2];
+	matrix_project_points_aos(points, projection, ndc_output, visible_bits, num_points, depth_range);
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+	{
+		const vector4f clip = matrix_mul_vector(vector_set(points[point_index].x, points[point_index].y, points[point_index].z, 1.0F), projection);
+		const vector4f expected = vector_div(clip, vector_dup_w(clip));
+		CHECK(vector_all_near_equal3(vector_load3(&ndc_output[point_index]), expected, threshold));
+		CHECK(is_bit_set(visible_bits, point_index) == expected_visible[point_index]);
+	}
+
+	// Bits past the last point are never set
+	CHECK((visible_bits[1] >> (num_points % 32)) == 0);
+
+	// The visible bits are optional
+	float3f ndc_output_no_bits[num_points];
+	matrix_project_points_aos(points, projection, ndc_output_no_bits, nullptr, num_points, depth_range);
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		CHECK(vector_all_near_equal3(vector_load3(&ndc_output_no_bits[point_index]), vector_load3(&ndc_output[point_index]), threshold));
+
+	const const_float3f_soa points_soa{ points_x, points_y, points_z };
+
+	float clip_x[num_points];
+	float clip_y[num_points];
+	float clip_z[num_points];
+	float clip_w[num_points];
+	matrix_project_points_soa(points_soa, projection, float4f_soa{ clip_x, clip_y, clip_z, clip_w }, num_points);
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		CHECK(vector_all_near_equal(vector_set(clip_x[point_index], clip_y[point_index], clip_z[point_index], clip_w[point_index]), vector_load(&clip_output[point_index]), threshold));
+
+	float ndc_x[num_points];
+	float ndc_y[num_points];
+	float ndc_z[num_points];
+	uint32_t visible_bits_soa[2];
+	matrix_project_points_soa(points_soa, projection, float3f_soa{ ndc_x, ndc_y, ndc_z }, visible_bits_soa, num_points, depth_range);
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		CHECK(vector_all_near_equal3(vector_set(ndc_x[point_index], ndc_y[point_index], ndc_z[point_index]), vector_load3(&ndc_output[point_index]), threshold));
+
+	CHECK(visible_bits_soa[0] == visible_bits[0]);
+	CHECK(visible_bits_soa[1] == visible_bits[1]);
+
+	// Projecting in place
+	matrix_project_points_soa(points_soa, projection, float3f_soa{ points_x, points_y, points_z }, nullptr, num_points, depth_range);
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		CHECK(vector_all_near_equal3(vector_set(points_x[point_index], points_y[point_index], points_z[point_index]), vector_load3(&ndc_output[point_index]), threshold));
+}
+
+TEST_CASE("matrix4x4f batch projection", "[math][matrix4x4][batch]")
+{
+	test_projection(clip_depth_range::zero_to_one);
+	test_projection(clip_depth_range::minus_one_to_one);
+
+	{
+		// Fewer points than a group
+		const matrix4x4f projection = make_projection(clip_depth_range::zero_to_one);
+		const float3f points[2] = { { 0.5F, 0.25F, 10.0F }, { 1.0F, 2.0F, -5.0F } };
+		float3f output[3] = { { 0.0F, 0.0F, 0.0F }, { 0.0F, 0.0F, 0.0F }, { 7.0F, 7.0F, 7.0F } };
+		uint32_t visible_bits = ~0U;
+		matrix_project_points_aos(points, projection, output, &visible_bits, 2);
+
+		CHECK(visible_bits == 0x1U);
+		CHECK(scalar_near_equal(output[0].x, 0.05F, 1.0E-6F));
+		CHECK(scalar_near_equal(output[0].y, 0.025F, 1.0E-6F));
+		CHECK(output[2].x == 7.0F);
+	}
+}
+
+TEST_CASE("matrix4x4f batch inverse", "[math][matrix4x4][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_matrices = 11;
+
+	matrix4x4f input[num_matrices];
+	matrix4x4f output[num_matrices];
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const float value = float(matrix_index);
+		const matrix4x4f view = matrix_cast(matrix_from_qvv(quat_from_euler(value * 0.3F, 1.0F - value, 0.2F), vector_set(value, 2.0F, -value), vector_set(0.5F + value * 0.1F, 1.5F, 0.75F)));
+		input[matrix_index] = matrix_mul(view, make_projection(matrix_index % 2 == 0 ? clip_depth_range::zero_to_one : clip_depth_range::minus_one_to_one));
+	}
+
+	matrix_inverse_aos(input, output, num_matrices);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const matrix4x4f expected = matrix_inverse(input[matrix_index]);
+		CHECK(vector_all_near_equal(output[matrix_index].x_axis, expected.x_axis, threshold));
+		CHECK(vector_all_near_equal(output[matrix_index].y_axis, expected.y_axis, threshold));
+		CHECK(vector_all_near_equal(output[matrix_index].z_axis, expected.z_axis, threshold));
+		CHECK(vector_all_near_equal(output[matrix_index].w_axis, expected.w_axis, threshold));
+	}
+
+	// Singular matrices are replaced by the fallback, in the wide loop and in the remainder
+	const matrix4x4f fallback = matrix_set(vector_set(2.0F, 0.0F, 0.0F, 0.0F), vector_set(0.0F, 2.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 2.0F, 0.0F), vector_set(1.0F, 2.0F, 3.0F, 1.0F));
+	input[2].z_axis = vector_zero();
+	input[10].y_axis = vector_zero();
+
+	matrix_inverse_aos(input, input, num_matrices, fallback);
+	for (uint32_t matrix_index = 0; matrix_index < num_matrices; ++matrix_index)
+	{
+		const matrix4x4f& expected = (matrix_index == 2 || matrix_index == 10) ? fallback : output[matrix_index];
+		CHECK(vector_all_near_equal(input[matrix_index].x_axis, expected.x_axis, threshold));
+		CHECK(vector_all_near_equal(input[matrix_index].y_axis, expected.y_axis, threshold));
+		CHECK(vector_all_near_equal(input[matrix_index].z_axis, expected.z_axis, threshold));
+		CHECK(vector_all_near_equal(input[matrix_index].w_axis, expected.w_axis, threshold));
+	}
+}
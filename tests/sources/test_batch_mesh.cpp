@@ -0,0 +1,274 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <catch.hpp>
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/mesh.h>
+#include <rtm/packing/tangent_frame.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+namespace
+{
+	// A grid of 'size' x 'size' vertices in the XY plane, two counter clockwise triangles per cell
+	struct grid_mesh
+	{
+		explicit grid_mesh(uint32_t size)
+			: num_vertices(size * size)
+			, num_faces((size - 1) * (size - 1) * 2)
+			, positions_x(num_vertices)
+			, positions_y(num_vertices)
+			, positions_z(num_vertices)
+			, texcoords_u(num_vertices)
+			, texcoords_v(num_vertices)
+			, indices(num_faces * 3)
+		{
+			for (uint32_t row = 0; row < size; ++row)
+			{
+				for (uint32_t column = 0; column < size; ++column)
+				{
+					const uint32_t vertex_index = row * size + column;
+					positions_x[vertex_index] = float(column);
+					positions_y[vertex_index] = float(row);
+					positions_z[vertex_index] = 0.0F;
+					texcoords_u[vertex_index] = float(column) * 0.1F;
+					texcoords_v[vertex_index] = float(row) * 0.1F;
+				}
+			}
+
+			uint32_t* face = indices.data();
+			for (uint32_t row = 0; row + 1 < size; ++row)
+			{
+				for (uint32_t column = 0; column + 1 < size; ++column)
+				{
+					const uint32_t vertex_index = row * size + column;
+					*face++ = vertex_index;
+					*face++ = vertex_index + 1;
+					*face++ = vertex_index + size + 1;
+					*face++ = vertex_index;
+					*face++ = vertex_index + size + 1;
+					*face++ = vertex_index + size;
+				}
+			}
+		}
+
+		const_float3f_soa positions() const { return const_float3f_soa{ positions_x.data(), positions_y.data(), positions_z.data() }; }
+
+		uint32_t num_vertices;
+		uint32_t num_faces;
+		std::vector<float> positions_x;
+		std::vector<float> positions_y;
+		std::vector<float> positions_z;
+		std::vector<float> texcoords_u;
+		std::vector<float> texcoords_v;
+		std::vector<uint32_t> indices;
+	};
+
+	struct soa3_buffer
+	{
+		explicit soa3_buffer(uint32_t size) : x(size), y(size), z(size) {}
+
+		float3f_soa soa() { return float3f_soa{ x.data(), y.data(), z.data() }; }
+		vector4f get(uint32_t index) const { return vector_set(x[index], y[index], z[index]); }
+
+		std::vector<float> x;
+		std::vector<float> y;
+		std::vector<float> z;
+	};
+}
+
+TEST_CASE("mesh batch vertex faces", "[math][mesh][batch]")
+{
+	// Two triangles sharing an edge and an unused vertex
+	const uint32_t indices[] = { 0, 1, 2, 2, 1, 3 };
+	uint32_t offsets[6];
+	uint32_t face_indices[6];
+	mesh_build_vertex_faces(indices, 2, 5, offsets, face_indices);
+
+	CHECK(offsets[0] == 0);
+	CHECK(offsets[1] == 1);
+	CHECK(offsets[2] == 3);
+	CHECK(offsets[3] == 5);
+	CHECK(offsets[4] == 6);
+	CHECK(offsets[5] == 6);
+	CHECK(face_indices[0] == 0);
+	CHECK(face_indices[1] == 0);
+	CHECK(face_indices[2] == 1);
+	CHECK(face_indices[3] == 0);
+	CHECK(face_indices[4] == 1);
+	CHECK(face_indices[5] == 1);
+}
+
+TEST_CASE("mesh batch normals and tangents", "[math][mesh][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// 50 faces, not a multiple of 4 to exercise the remainder
+	grid_mesh mesh(6);
+
+	// Bend the grid such that every vertex normal differs
+	for (uint32_t vertex_index = 0; vertex_index < mesh.num_vertices; ++vertex_index)
+		mesh.positions_z[vertex_index] = scalar_sin(mesh.positions_x[vertex_index] * 0.7F) * scalar_cos(mesh.positions_y[vertex_index] * 0.4F);
+
+	std::vector<uint32_t> offsets(mesh.num_vertices + 1);
+	std::vector<uint32_t> face_indices(mesh.num_faces * 3);
+	mesh_build_vertex_faces(mesh.indices.data(), mesh.num_faces, mesh.num_vertices, offsets.data(), face_indices.data());
+	const mesh_vertex_faces vertex_faces{ offsets.data(), face_indices.data() };
+
+	std::vector<float4f> face_normals(mesh.num_faces);
+	soa3_buffer normals(mesh.num_vertices);
+	mesh_face_normals_soa(mesh.positions(), mesh.indices.data(), face_normals.data(), mesh.num_faces);
+	mesh_vertex_normals_soa(face_normals.data(), vertex_faces, normals.soa(), mesh.num_vertices);
+
+	{
+		// Matches scattering the face cross products into their vertices
+		soa3_buffer expected(mesh.num_vertices);
+		for (uint32_t face_index = 0; face_index < mesh.num_faces; ++face_index)
+		{
+			const uint32_t* face = &mesh.indices[face_index * 3];
+			const vector4f position0 = vector_set(mesh.positions_x[face[0]], mesh.positions_y[face[0]], mesh.positions_z[face[0]]);
+			const vector4f position1 = vector_set(mesh.positions_x[face[1]], mesh.positions_y[face[1]], mesh.positions_z[face[1]]);
+			const vector4f position2 = vector_set(mesh.positions_x[face[2]], mesh.positions_y[face[2]], mesh.positions_z[face[2]]);
+			const vector4f face_normal = vector_cross3(vector_sub(position1, position0), vector_sub(position2, position0));
+
+			CHECK(vector_all_near_equal(vector_load(&face_normals[face_index]), face_normal, threshold));
+			for (uint32_t corner = 0; corner < 3; ++corner)
+			{
+				expected.x[face[corner]] += vector_get_x(face_normal);
+				expected.y[face[corner]] += vector_get_y(face_normal);
+				expected.z[face[corner]] += vector_get_z(face_normal);
+			}
+		}
+
+		for (uint32_t vertex_index = 0; vertex_index < mesh.num_vertices; ++vertex_index)
+			CHECK(vector_all_near_equal3(normals.get(vertex_index), vector_normalize3(expected.get(vertex_index)), threshold));
+	}
+
+	std::vector<float4f> face_tangents(mesh.num_faces);
+	std::vector<float4f> face_bitangents(mesh.num_faces);
+	std::vector<float> tangents_w(mesh.num_vertices);
+	soa3_buffer tangents(mesh.num_vertices);
+	const float4f_soa tangents_soa{ tangents.x.data(), tangents.y.data(), tangents.z.data(), tangents_w.data() };
+
+	{
+		// [u] increases along +X and [v] along +Y, the tangents are orthonormal to the normals
+		mesh_face_tangents_soa(mesh.positions(), mesh.texcoords_u.data(), mesh.texcoords_v.data(), mesh.indices.data(), face_tangents.data(), face_bitangents.data(), mesh.num_faces);
+		mesh_vertex_tangents_soa(normals.soa(), face_tangents.data(), face_bitangents.data(), vertex_faces, tangents_soa, mesh.num_vertices);
+
+		for (uint32_t vertex_index = 0; vertex_index < mesh.num_vertices; ++vertex_index)
+		{
+			const vector4f normal = normals.get(vertex_index);
+			const vector4f tangent = tangents.get(vertex_index);
+			CHECK(scalar_near_equal(float(vector_length3(tangent)), 1.0F, threshold));
+			CHECK(scalar_near_equal(float(vector_dot3(normal, tangent)), 0.0F, threshold));
+			CHECK(vector_get_x(tangent) > 0.5F);
+			CHECK(tangents_w[vertex_index] == 1.0F);
+		}
+
+		// Every face of a flat grid has the same tangent frame
+		const float flat_z[] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+		grid_mesh flat(3);
+		flat.positions_z.assign(flat_z, flat_z + 9);
+		std::vector<float4f> flat_face_tangents(flat.num_faces);
+		std::vector<float4f> flat_face_bitangents(flat.num_faces);
+		mesh_face_tangents_soa(flat.positions(), flat.texcoords_u.data(), flat.texcoords_v.data(), flat.indices.data(), flat_face_tangents.data(), flat_face_bitangents.data(), flat.num_faces);
+		for (uint32_t face_index = 0; face_index < flat.num_faces; ++face_index)
+		{
+			CHECK(vector_all_near_equal3(vector_normalize3(vector_load(&flat_face_tangents[face_index])), vector_set(1.0F, 0.0F, 0.0F), threshold));
+			CHECK(vector_all_near_equal3(vector_normalize3(vector_load(&flat_face_bitangents[face_index])), vector_set(0.0F, 1.0F, 0.0F), threshold));
+		}
+	}
+
+	{
+		// Mirrored texture coordinates flip the tangent and the bitangent sign
+		for (float& texcoord : mesh.texcoords_u)
+			texcoord = -texcoord;
+
+		mesh_face_tangents_soa(mesh.positions(), mesh.texcoords_u.data(), mesh.texcoords_v.data(), mesh.indices.data(), face_tangents.data(), face_bitangents.data(), mesh.num_faces);
+		mesh_vertex_tangents_soa(normals.soa(), face_tangents.data(), face_bitangents.data(), vertex_faces, tangents_soa, mesh.num_vertices);
+
+		for (uint32_t vertex_index = 0; vertex_index < mesh.num_vertices; ++vertex_index)
+		{
+			CHECK(vector_get_x(tangents.get(vertex_index)) < -0.5F);
+			CHECK(tangents_w[vertex_index] == -1.0F);
+		}
+
+		// The QTangents preserve the frame
+		std::vector<uint64_t> qtangents(mesh.num_vertices);
+		pack_qtangent_snorm16_soa(normals.soa(), tangents_soa, qtangents.data(), mesh.num_vertices);
+		for (uint32_t vertex_index = 0; vertex_index < mesh.num_vertices; ++vertex_index)
+		{
+			vector4f normal;
+			vector4f tangent;
+			unpack_qtangent_snorm16(qtangents[vertex_index], normal, tangent);
+			CHECK(vector_all_near_equal3(normal, normals.get(vertex_index), 1.0E-3F));
+			CHECK(vector_all_near_equal3(tangent, tangents.get(vertex_index), 1.0E-3F));
+			CHECK(vector_get_w(tangent) == -1.0F);
+		}
+	}
+
+	{
+		// Without texture area, any tangent orthogonal to the normal is returned
+		std::fill(mesh.texcoords_u.begin(), mesh.texcoords_u.end(), 0.5F);
+		std::fill(mesh.texcoords_v.begin(), mesh.texcoords_v.end(), 0.5F);
+
+		mesh_face_tangents_soa(mesh.positions(), mesh.texcoords_u.data(), mesh.texcoords_v.data(), mesh.indices.data(), face_tangents.data(), face_bitangents.data(), mesh.num_faces);
+		mesh_vertex_tangents_soa(normals.soa(), face_tangents.data(), face_bitangents.data(), vertex_faces, tangents_soa, mesh.num_vertices);
+
+		for (uint32_t vertex_index = 0; vertex_index < mesh.num_vertices; ++vertex_index)
+		{
+			const vector4f tangent = tangents.get(vertex_index);
+			CHECK(scalar_near_equal(float(vector_length3(tangent)), 1.0F, threshold));
+			CHECK(scalar_near_equal(float(vector_dot3(normals.get(vertex_index), tangent)), 0.0F, threshold));
+		}
+	}
+
+	{
+		// Unused vertices have a zero normal
+		const uint32_t indices[] = { 0, 1, 2 };
+		const float positions_x[] = { 0.0F, 1.0F, 0.0F, 5.0F };
+		const float positions_y[] = { 0.0F, 0.0F, 1.0F, 5.0F };
+		const float positions_z[] = { 0.0F, 0.0F, 0.0F, 5.0F };
+		uint32_t triangle_offsets[5];
+		uint32_t triangle_faces[3];
+		mesh_build_vertex_faces(indices, 1, 4, triangle_offsets, triangle_faces);
+
+		float4f triangle_face_normal;
+		soa3_buffer triangle_normals(4);
+		mesh_face_normals_soa(const_float3f_soa{ positions_x, positions_y, positions_z }, indices, &triangle_face_normal, 1);
+		mesh_vertex_normals_soa(&triangle_face_normal, mesh_vertex_faces{ triangle_offsets, triangle_faces }, triangle_normals.soa(), 4);
+
+		CHECK(vector_all_near_equal3(triangle_normals.get(0), vector_set(0.0F, 0.0F, 1.0F), threshold));
+		CHECK(vector_all_near_equal3(triangle_normals.get(2), vector_set(0.0F, 0.0F, 1.0F), threshold));
+		CHECK(vector_all_near_equal3(triangle_normals.get(3), vector_zero(), 0.0F));
+	}
+}
@@ -0,0 +1,249 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/batch/parallel.h>
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+using namespace rtm;
+
+// Without thread support, the pool runs everything on the calling thread
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+static constexpr uint32_t k_num_worker_threads = 0;
+#else
+static constexpr uint32_t k_num_worker_threads = 3;
+#endif
+
+TEST_CASE("batch parallel_for_chunks", "[math][batch][parallel]")
+{
+	CHECK(get_parallel_chunk_size(1) == 64 * 1024);
+	CHECK(get_parallel_chunk_size(48) == 1344);
+	CHECK(get_parallel_chunk_size(64 * 1024) == 64);
+	CHECK((get_parallel_chunk_size(sizeof(qvvf) * 3) % 64) == 0);
+
+	thread_pool pool(k_num_worker_threads);
+	CHECK(pool.get_num_threads() == k_num_worker_threads + 1);
+
+	for (uint32_t num_elements : { 0U, 1U, 63U, 64U, 65U, 1000U, 4096U, 10001U })
+	{
+		std::vector<std::atomic<uint32_t>> visit_counts(num_elements);
+		for (std::atomic<uint32_t>& count : visit_counts)
+			count = 0;
+
+		// Catch is not thread safe, the jobs only record what is checked afterwards
+		std::atomic<uint32_t> num_chunks(0);
+		std::atomic<uint32_t> num_misaligned_chunks(0);
+		parallel_for_chunks(pool, num_elements, 64, [&](uint32_t offset, uint32_t count)
+		{
+			if ((offset % 64) != 0)
+				num_misaligned_chunks++;
+			num_chunks++;
+			for (uint32_t element_index = offset; element_index < offset + count; ++element_index)
+				visit_counts[element_index]++;
+		});
+
+		CHECK(num_chunks == (num_elements + 63) / 64);
+		CHECK(num_misaligned_chunks == 0);
+
+		bool is_each_visited_once = true;
+		for (std::atomic<uint32_t>& count : visit_counts)
+			is_each_visited_once &= count == 1;
+		CHECK(is_each_visited_once);
+	}
+
+	// The pool can be reused many times
+	std::atomic<uint32_t> num_jobs_executed(0);
+	for (uint32_t run_index = 0; run_index < 100; ++run_index)
+		pool.run(run_index, [&](uint32_t) { num_jobs_executed++; });
+	CHECK(num_jobs_executed == (99 * 100) / 2);
+}
+
+TEST_CASE("batch parallel functions", "[math][batch][parallel]")
+{
+	const uint32_t num_elements = 5000;
+
+	std::vector<float> lhs_soa(num_elements * 4);
+	std::vector<float> rhs_soa(num_elements * 4);
+	std::vector<qvvf> lhs_qvv(num_elements);
+	std::vector<qvvf> rhs_qvv(num_elements);
+	std::vector<matrix3x4f> lhs_mtx(num_elements);
+	std::vector<float3f> points(num_elements);
+
+	for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+	{
+		const float angle = float(element_index) * 0.01F;
+		const quatf lhs_rotation = quat_from_euler(angle, angle * 0.5F, angle * 0.25F);
+		const quatf rhs_rotation = quat_from_euler(angle * 0.3F, -angle, angle * 0.7F);
+		const vector4f translation = vector_set(angle, -angle, angle * 2.0F);
+		const vector4f scale = vector_set(1.0F + angle * 0.01F, (element_index % 97) == 0 ? -1.0F : 1.0F, 1.0F);
+
+		lhs_soa[element_index] = quat_get_x(lhs_rotation);
+		lhs_soa[element_index + num_elements] = quat_get_y(lhs_rotation);
+		lhs_soa[element_index + num_elements * 2] = quat_get_z(lhs_rotation);
+		lhs_soa[element_index + num_elements * 3] = quat_get_w(lhs_rotation);
+		rhs_soa[element_index] = quat_get_x(rhs_rotation);
+		rhs_soa[element_index + num_elements] = quat_get_y(rhs_rotation);
+		rhs_soa[element_index + num_elements * 2] = quat_get_z(rhs_rotation);
+		rhs_soa[element_index + num_elements * 3] = quat_get_w(rhs_rotation);
+
+		lhs_qvv[element_index] = qvv_set(lhs_rotation, translation, scale);
+		rhs_qvv[element_index] = qvv_set(rhs_rotation, vector_neg(translation), vector_set(1.0F));
+		lhs_mtx[element_index] = matrix_from_qvv(lhs_qvv[element_index]);
+		points[element_index] = float3f{ angle, angle * 3.0F, -angle };
+	}
+
+	const const_float4f_soa lhs{ &lhs_soa[0], &lhs_soa[num_elements], &lhs_soa[num_elements * 2], &lhs_soa[num_elements * 3] };
+	const const_float4f_soa rhs{ &rhs_soa[0], &rhs_soa[num_elements], &rhs_soa[num_elements * 2], &rhs_soa[num_elements * 3] };
+	const qvvf transform = rhs_qvv[17];
+	const matrix3x4f palette_transform = lhs_mtx[42];
+
+	thread_pool pool(k_num_worker_threads);
+	serial_executor serial;
+
+	// The results must be bitwise identical regardless of the number of threads
+	{
+		std::vector<float> serial_soa(num_elements * 4);
+		std::vector<float> pool_soa(num_elements * 4);
+		const float4f_soa serial_output{ &serial_soa[0], &serial_soa[num_elements], &serial_soa[num_elements * 2], &serial_soa[num_elements * 3] };
+		const float4f_soa pool_output{ &pool_soa[0], &pool_soa[num_elements], &pool_soa[num_elements * 2], &pool_soa[num_elements * 3] };
+
+		quat_mul_soa_parallel(serial, lhs, rhs, serial_output, num_elements);
+		quat_mul_soa_parallel(pool, lhs, rhs, pool_output, num_elements);
+		CHECK(std::memcmp(serial_soa.data(), pool_soa.data(), serial_soa.size() * sizeof(float)) == 0);
+
+		// Also matches the single threaded function
+		quat_mul_soa(lhs, rhs, serial_output, num_elements);
+		CHECK(std::memcmp(serial_soa.data(), pool_soa.data(), serial_soa.size() * sizeof(float)) == 0);
+	}
+
+	{
+		std::vector<qvvf> serial_qvv(num_elements);
+		std::vector<qvvf> pool_qvv(num_elements);
+
+		qvv_mul_aos_parallel(serial, lhs_qvv.data(), rhs_qvv.data(), serial_qvv.data(), num_elements);
+		qvv_mul_aos_parallel(pool, lhs_qvv.data(), rhs_qvv.data(), pool_qvv.data(), num_elements);
+		CHECK(std::memcmp(serial_qvv.data(), pool_qvv.data(), serial_qvv.size() * sizeof(qvvf)) == 0);
+	}
+
+	{
+		std::vector<float3f> serial_points(num_elements);
+		std::vector<float3f> pool_points(num_elements);
+
+		qvv_mul_point3_aos_parallel(serial, transform, points.data(), serial_points.data(), num_elements);
+		qvv_mul_point3_aos_parallel(pool, transform, points.data(), pool_points.data(), num_elements);
+		CHECK(std::memcmp(serial_points.data(), pool_points.data(), serial_points.size() * sizeof(float3f)) == 0);
+	}
+
+	{
+		std::vector<matrix3x4f> serial_mtx(num_elements);
+		std::vector<matrix3x4f> pool_mtx(num_elements);
+
+		matrix_mul_aos_parallel(serial, lhs_mtx.data(), palette_transform, serial_mtx.data(), num_elements);
+		matrix_mul_aos_parallel(pool, lhs_mtx.data(), palette_transform, pool_mtx.data(), num_elements);
+		CHECK(std::memcmp(serial_mtx.data(), pool_mtx.data(), serial_mtx.size() * sizeof(matrix3x4f)) == 0);
+
+		matrix_mul_aos_parallel(serial, lhs_mtx.data(), serial_mtx.data(), serial_mtx.data(), num_elements);
+		matrix_mul_aos_parallel(pool, lhs_mtx.data(), pool_mtx.data(), pool_mtx.data(), num_elements);
+		CHECK(std::memcmp(serial_mtx.data(), pool_mtx.data(), serial_mtx.size() * sizeof(matrix3x4f)) == 0);
+
+		const matrix3x4f expected = matrix_mul(lhs_mtx[1234], matrix_mul(lhs_mtx[1234], palette_transform));
+		CHECK(vector_all_near_equal3(pool_mtx[1234].w_axis, expected.w_axis, 1.0E-3F));
+	}
+
+	{
+		// A bent grid of 60 x 60 vertices, large enough to span several chunks
+		const uint32_t grid_size = 60;
+		const uint32_t num_vertices = grid_size * grid_size;
+		const uint32_t num_faces = (grid_size - 1) * (grid_size - 1) * 2;
+
+		std::vector<float> positions_soa(num_vertices * 3);
+		std::vector<float> texcoords_soa(num_vertices * 2);
+		std::vector<uint32_t> indices;
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		{
+			const float column = float(vertex_index % grid_size);
+			const float row = float(vertex_index / grid_size);
+			positions_soa[vertex_index] = column;
+			positions_soa[vertex_index + num_vertices] = row;
+			positions_soa[vertex_index + num_vertices * 2] = scalar_sin(column * 0.3F) * scalar_cos(row * 0.2F);
+			texcoords_soa[vertex_index] = column * 0.01F;
+			texcoords_soa[vertex_index + num_vertices] = row * 0.01F;
+
+			if (column + 1.0F < float(grid_size) && row + 1.0F < float(grid_size))
+			{
+				const uint32_t cell_indices[] = { vertex_index, vertex_index + 1, vertex_index + grid_size + 1, vertex_index, vertex_index + grid_size + 1, vertex_index + grid_size };
+				indices.insert(indices.end(), cell_indices, cell_indices + 6);
+			}
+		}
+
+		std::vector<uint32_t> offsets(num_vertices + 1);
+		std::vector<uint32_t> face_indices(num_faces * 3);
+		mesh_build_vertex_faces(indices.data(), num_faces, num_vertices, offsets.data(), face_indices.data());
+		const mesh_vertex_faces vertex_faces{ offsets.data(), face_indices.data() };
+		const const_float3f_soa positions{ &positions_soa[0], &positions_soa[num_vertices], &positions_soa[num_vertices * 2] };
+
+		std::vector<float4f> serial_faces(num_faces * 3);
+		std::vector<float4f> pool_faces(num_faces * 3);
+		std::vector<float> serial_vertices(num_vertices * 7);
+		std::vector<float> pool_vertices(num_vertices * 7);
+
+		for (uint32_t run_index = 0; run_index < 2; ++run_index)
+		{
+			std::vector<float4f>& faces = run_index == 0 ? serial_faces : pool_faces;
+			std::vector<float>& vertices = run_index == 0 ? serial_vertices : pool_vertices;
+			float4f* face_normals = &faces[0];
+			float4f* face_tangents = &faces[num_faces];
+			float4f* face_bitangents = &faces[num_faces * 2];
+			const float3f_soa normals{ &vertices[0], &vertices[num_vertices], &vertices[num_vertices * 2] };
+			const float4f_soa tangents{ &vertices[num_vertices * 3], &vertices[num_vertices * 4], &vertices[num_vertices * 5], &vertices[num_vertices * 6] };
+
+			if (run_index == 0)
+			{
+				mesh_face_normals_soa_parallel(serial, positions, indices.data(), face_normals, num_faces);
+				mesh_face_tangents_soa_parallel(serial, positions, &texcoords_soa[0], &texcoords_soa[num_vertices], indices.data(), face_tangents, face_bitangents, num_faces);
+				mesh_vertex_normals_soa_parallel(serial, face_normals, vertex_faces, normals, num_vertices);
+				mesh_vertex_tangents_soa_parallel(serial, normals, face_tangents, face_bitangents, vertex_faces, tangents, num_vertices);
+			}
+			else
+			{
+				mesh_face_normals_soa_parallel(pool, positions, indices.data(), face_normals, num_faces);
+				mesh_face_tangents_soa_parallel(pool, positions, &texcoords_soa[0], &texcoords_soa[num_vertices], indices.data(), face_tangents, face_bitangents, num_faces);
+				mesh_vertex_normals_soa_parallel(pool, face_normals, vertex_faces, normals, num_vertices);
+				mesh_vertex_tangents_soa_parallel(pool, normals, face_tangents, face_bitangents, vertex_faces, tangents, num_vertices);
+			}
+		}
+
+		CHECK(std::memcmp(serial_faces.data(), pool_faces.data(), serial_faces.size() * sizeof(float4f)) == 0);
+		CHECK(std::memcmp(serial_vertices.data(), pool_vertices.data(), serial_vertices.size() * sizeof(float)) == 0);
+
+		// Also matches the single threaded functions
+		std::vector<float> normals_soa(num_vertices * 3);
+		mesh_vertex_normals_soa(pool_faces.data(), vertex_faces, float3f_soa{ &normals_soa[0], &normals_soa[num_vertices], &normals_soa[num_vertices * 2] }, num_vertices);
+		CHECK(std::memcmp(normals_soa.data(), pool_vertices.data(), normals_soa.size() * sizeof(float)) == 0);
+	}
+}
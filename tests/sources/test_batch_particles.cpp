@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/batch/particles.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_particles = 37;
+
+struct reference_particle
+{
+	float position[3];
+	float motion[3];
+	float acceleration[3];
+};
+
+// Scalar reference of both integrators, 'motion' holds the velocity with Euler and the previous position with Verlet
+static void integrate_reference(reference_particle& particle, const particle_integration_settings& settings, bool is_verlet)
+{
+	const float dt = settings.delta_time;
+	const float acceleration_scale = is_verlet ? dt * dt : dt;
+	const float drag_factor = scalar_max(1.0F - settings.drag * dt, 0.0F);
+	const float constant_acceleration[3] = { settings.acceleration.x, settings.acceleration.y, settings.acceleration.z };
+	const float max_velocity[3] = { settings.max_velocity.x, settings.max_velocity.y, settings.max_velocity.z };
+
+	float motion[3];
+	for (uint32_t axis = 0; axis < 3; ++axis)
+	{
+		const float previous_motion = is_verlet ? (particle.position[axis] - particle.motion[axis]) : particle.motion[axis];
+		const float acceleration = (constant_acceleration[axis] + particle.acceleration[axis]) * acceleration_scale;
+		const float max_motion = max_velocity[axis] * (is_verlet ? dt : 1.0F);
+		motion[axis] = scalar_clamp(previous_motion * drag_factor + acceleration, -max_motion, max_motion);
+		particle.position[axis] += motion[axis] * (is_verlet ? 1.0F : dt);
+	}
+
+	for (uint32_t plane_index = 0; plane_index < settings.num_collision_planes; ++plane_index)
+	{
+		float plane[4];
+		vector_store(settings.collision_planes[plane_index], &plane[0]);
+
+		const float distance = plane[0] * particle.position[0] + plane[1] * particle.position[1] + plane[2] * particle.position[2] + plane[3];
+		const float normal_motion = plane[0] * motion[0] + plane[1] * motion[1] + plane[2] * motion[2];
+		if (distance < 0.0F)
+		{
+			const float impulse = scalar_min(normal_motion, 0.0F) * (1.0F + settings.restitution);
+			for (uint32_t axis = 0; axis < 3; ++axis)
+			{
+				particle.position[axis] -= plane[axis] * distance;
+				motion[axis] -= plane[axis] * impulse;
+			}
+		}
+	}
+
+	for (uint32_t axis = 0; axis < 3; ++axis)
+		particle.motion[axis] = is_verlet ? (particle.position[axis] - motion[axis]) : motion[axis];
+}
+
+static void test_particle_integration(bool is_verlet, bool has_accelerations)
+{
+	const vector4f planes[2] =
+	{
+		vector_set(0.0F, 0.0F, 1.0F, 0.0F),				// Ground at z = 0
+		vector_set(-0.6F, 0.0F, 0.8F, 2.0F),			// Slanted wall
+	};
+
+	particle_integration_settings settings;
+	settings.acceleration = { 0.0F, 0.0F, -9.81F };
+	settings.max_velocity = { 4.0F, 4.0F, 20.0F };
+	settings.delta_time = 1.0F / 30.0F;
+	settings.drag = 0.5F;
+	settings.restitution = 0.4F;
+	settings.collision_planes = planes;
+	settings.num_collision_planes = 2;
+
+	float positions[3][k_num_particles];
+	float motions[3][k_num_particles];
+	float accelerations[3][k_num_particles];
+	reference_particle reference[k_num_particles];
+
+	for (uint32_t particle_index = 0; particle_index < k_num_particles; ++particle_index)
+	{
+		const float value = float(particle_index);
+		reference_particle& particle = reference[particle_index];
+
+		particle.position[0] = scalar_sin(value) * 3.0F;
+		particle.position[1] = scalar_cos(value) * 3.0F;
+		particle.position[2] = 0.02F * value;
+
+		// Some particles move fast enough to be clamped or to cross the planes in a single step
+		const float velocity[3] = { scalar_cos(value * 1.7F) * 6.0F, scalar_sin(value * 0.3F) * 2.0F, -0.5F * value };
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			particle.motion[axis] = is_verlet ? (particle.position[axis] - velocity[axis] * settings.delta_time) : velocity[axis];
+			particle.acceleration[axis] = has_accelerations ? scalar_sin(value + float(axis)) * 5.0F : 0.0F;
+
+			positions[axis][particle_index] = particle.position[axis];
+			motions[axis][particle_index] = particle.motion[axis];
+			accelerations[axis][particle_index] = particle.acceleration[axis];
+		}
+	}
+
+	const float3f_soa position_streams = { positions[0], positions[1], positions[2] };
+	const float3f_soa motion_streams = { motions[0], motions[1], motions[2] };
+	const const_float3f_soa acceleration_streams = has_accelerations ? const_float3f_soa{ accelerations[0], accelerations[1], accelerations[2] } : const_float3f_soa{ nullptr, nullptr, nullptr };
+
+	for (uint32_t step_index = 0; step_index < 10; ++step_index)
+	{
+		if (is_verlet)
+			particle_integrate_verlet_soa(position_streams, motion_streams, acceleration_streams, settings, k_num_particles);
+		else
+			particle_integrate_euler_soa(position_streams, motion_streams, acceleration_streams, settings, k_num_particles);
+
+		for (uint32_t particle_index = 0; particle_index < k_num_particles; ++particle_index)
+			integrate_reference(reference[particle_index], settings, is_verlet);
+	}
+
+	for (uint32_t particle_index = 0; particle_index < k_num_particles; ++particle_index)
+	{
+		const reference_particle& particle = reference[particle_index];
+		for (uint32_t axis = 0; axis < 3; ++axis)
+		{
+			CHECK(scalar_near_equal(positions[axis][particle_index], particle.position[axis], 1.0E-4F));
+			CHECK(scalar_near_equal(motions[axis][particle_index], particle.motion[axis], 1.0E-4F));
+		}
+
+		// Every particle ends up on the positive side of the planes
+		for (const vector4f& plane : planes)
+		{
+			const float distance = vector_dot3(plane, vector_set(positions[0][particle_index], positions[1][particle_index], positions[2][particle_index])) + float(vector_get_w(plane));
+			CHECK(distance >= -1.0E-5F);
+		}
+	}
+}
+
+TEST_CASE("particle integration euler", "[math][vector4][batch]")
+{
+	test_particle_integration(false, true);
+	test_particle_integration(false, false);
+
+	// A particle falling straight down bounces off the ground with the restitution
+	const vector4f ground = vector_set(0.0F, 0.0F, 1.0F, 0.0F);
+
+	particle_integration_settings settings;
+	settings.delta_time = 0.1F;
+	settings.restitution = 0.5F;
+	settings.collision_planes = &ground;
+	settings.num_collision_planes = 1;
+
+	float position_x = 0.0F;
+	float position_y = 0.0F;
+	float position_z = 0.5F;
+	float velocity_x = 1.0F;
+	float velocity_y = 0.0F;
+	float velocity_z = -10.0F;
+	particle_integrate_euler_soa(float3f_soa{ &position_x, &position_y, &position_z }, float3f_soa{ &velocity_x, &velocity_y, &velocity_z }, const_float3f_soa{ nullptr, nullptr, nullptr }, settings, 1);
+
+	CHECK(scalar_near_equal(position_x, 0.1F, 1.0E-6F));
+	CHECK(position_z == 0.0F);
+	CHECK(scalar_near_equal(velocity_x, 1.0F, 1.0E-6F));
+	CHECK(scalar_near_equal(velocity_z, 5.0F, 1.0E-5F));
+}
+
+TEST_CASE("particle integration verlet", "[math][vector4][batch]")
+{
+	test_particle_integration(true, true);
+	test_particle_integration(true, false);
+
+	// Without forces, a particle keeps moving at the same velocity
+	particle_integration_settings settings;
+	settings.delta_time = 0.1F;
+
+	float position_x = 1.0F;
+	float position_y = 2.0F;
+	float position_z = 3.0F;
+	float previous_x = 0.5F;
+	float previous_y = 2.0F;
+	float previous_z = 3.25F;
+	particle_integrate_verlet_soa(float3f_soa{ &position_x, &position_y, &position_z }, float3f_soa{ &previous_x, &previous_y, &previous_z }, const_float3f_soa{ nullptr, nullptr, nullptr }, settings, 1);
+
+	CHECK(position_x == 1.5F);
+	CHECK(position_y == 2.0F);
+	CHECK(position_z == 2.75F);
+	CHECK(previous_x == 1.0F);
+	CHECK(previous_y == 2.0F);
+	CHECK(previous_z == 3.0F);
+}
@@ -0,0 +1,308 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/batch/parallel.h>
+#include <rtm/batch/pipeline.h>
+#include <rtm/batch/qvvf.h>
+#include <rtm/batch/skinning.h>
+#include <rtm/batch/soa.h>
+#include <rtm/batch/trackf.h>
+
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+using namespace rtm;
+
+// Without thread support, the pool runs everything on the calling thread
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+static constexpr uint32_t k_num_worker_threads = 0;
+#else
+static constexpr uint32_t k_num_worker_threads = 1;
+#endif
+
+namespace
+{
+	// Odd counts to exercise the wide loops along with the remainder
+	constexpr uint32_t k_num_bones = 37;
+	constexpr uint32_t k_num_keys = 5;
+	constexpr uint32_t k_num_vertices = 101;
+	constexpr uint32_t k_num_frames = 6;
+
+	struct pipeline_test_data
+	{
+		std::vector<float> key_streams[10];
+		std::vector<float> additive_streams[10];
+
+		uint32_t parent_indices[k_num_bones];
+		uint32_t depths[k_num_bones];
+		uint32_t sorted_indices[k_num_bones];
+		uint32_t depth_offsets[k_num_bones + 1];
+		transform_hierarchy hierarchy;
+
+		matrix3x4f inverse_bind_pose[k_num_bones];
+
+		float3f positions[k_num_vertices];
+		uint32_t bone_indices[k_num_vertices * 4];
+		float bone_weights[k_num_vertices * 4];
+
+		pipeline_test_data()
+		{
+			for (uint32_t component_index = 0; component_index < 10; ++component_index)
+			{
+				key_streams[component_index].resize(k_num_keys * k_num_bones);
+				additive_streams[component_index].resize(k_num_bones);
+			}
+
+			for (uint32_t key_index = 0; key_index < k_num_keys; ++key_index)
+			{
+				for (uint32_t bone_index = 0; bone_index < k_num_bones; ++bone_index)
+				{
+					const float value = float(key_index) * 0.25F + float(bone_index) * 0.1F;
+					const qvvf key = qvv_set(quat_from_euler(value, 0.5F - value, value * 0.3F), vector_set(value, 1.0F, -value), vector_set(1.0F + value * 0.1F, 1.0F, 0.8F));
+					set(key_streams, key_index * k_num_bones + bone_index, key);
+				}
+			}
+
+			for (uint32_t bone_index = 0; bone_index < k_num_bones; ++bone_index)
+			{
+				const float value = float(bone_index) * 0.05F;
+				set(additive_streams, bone_index, qvv_set(quat_from_euler(value, -value, 0.1F), vector_set(0.1F, value, 0.0F), vector_set(1.0F, 1.1F, 1.0F)));
+
+				parent_indices[bone_index] = bone_index == 0 ? k_hierarchy_root_index : ((bone_index - 1) / 2);
+				inverse_bind_pose[bone_index] = matrix_from_qvv(qvv_inverse(qvv_set(quat_from_euler(value, 0.2F, -value), vector_set(0.0F, value, 1.0F), vector_set(1.0F))));
+			}
+
+			hierarchy = hierarchy_sort_by_depth(parent_indices, k_num_bones, depths, sorted_indices, depth_offsets);
+
+			for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+			{
+				const float value = float(vertex_index);
+				positions[vertex_index] = float3f{ value * 0.1F, 1.0F - value * 0.05F, 0.5F };
+
+				for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+				{
+					bone_indices[vertex_index * 4 + influence_index] = (vertex_index * 7 + influence_index * 11) % k_num_bones;
+					bone_weights[vertex_index * 4 + influence_index] = influence_index == 0 ? 0.4F : 0.2F;
+				}
+			}
+		}
+
+		static void set(std::vector<float> (&streams)[10], uint32_t index, const qvvf& transform)
+		{
+			streams[0][index] = quat_get_x(transform.rotation);
+			streams[1][index] = quat_get_y(transform.rotation);
+			streams[2][index] = quat_get_z(transform.rotation);
+			streams[3][index] = quat_get_w(transform.rotation);
+			streams[4][index] = vector_get_x(transform.translation);
+			streams[5][index] = vector_get_y(transform.translation);
+			streams[6][index] = vector_get_z(transform.translation);
+			streams[7][index] = vector_get_x(transform.scale);
+			streams[8][index] = vector_get_y(transform.scale);
+			streams[9][index] = vector_get_z(transform.scale);
+		}
+
+		static const_qvvf_soa get(const std::vector<float> (&streams)[10])
+		{
+			return const_qvvf_soa{
+				const_float4f_soa{ streams[0].data(), streams[1].data(), streams[2].data(), streams[3].data() },
+				const_float3f_soa{ streams[4].data(), streams[5].data(), streams[6].data() },
+				const_float3f_soa{ streams[7].data(), streams[8].data(), streams[9].data() } };
+		}
+
+		// Samples and blends the local pose
+		void produce(const transform_pipeline_frame& frame) const
+		{
+			const const_qvvf_soa keys = get(key_streams);
+			const float sample_time = float(frame.frame_index) * 0.05F;
+			quat_sample_uniform_soa(keys.rotation, k_num_keys, 30.0F, sample_time, frame.local_pose.rotation, k_num_bones);
+			vector_sample_uniform_soa(keys.translation, k_num_keys, 30.0F, sample_time, frame.local_pose.translation, k_num_bones);
+			vector_sample_uniform_soa(keys.scale, k_num_keys, 30.0F, sample_time, frame.local_pose.scale, k_num_bones);
+
+			qvv_apply_additive_soa(frame.local_pose, get(additive_streams), 0.5F, frame.local_pose, k_num_bones);
+		}
+
+		// Composes the object space pose, builds the palette, and skins the vertices
+		void consume(const transform_pipeline_frame& frame, float3f* skinned_positions) const
+		{
+			soa_unpack(frame.local_pose, k_num_bones, frame.object_pose);
+			qvv_local_to_object(hierarchy, frame.object_pose, frame.object_pose);
+
+			for (uint32_t bone_index = 0; bone_index < k_num_bones; ++bone_index)
+				frame.palette[bone_index] = matrix_from_qvv(frame.object_pose[bone_index]);
+			matrix_mul_aos(inverse_bind_pose, frame.palette, frame.palette, k_num_bones);
+
+			const const_skin_vertex_streams input = { positions, nullptr, nullptr, sizeof(float3f), 0, 0 };
+			const skin_vertex_streams output = { skinned_positions, nullptr, nullptr, sizeof(float3f), 0, 0 };
+			matrix_skin_aos(frame.palette, bone_indices, bone_weights, input, output, k_num_vertices);
+		}
+	};
+}
+
+TEST_CASE("batch transform_pipeline", "[math][batch][pipeline]")
+{
+	const size_t required_size = transform_pipeline::get_required_size(k_num_bones);
+
+	// Offset by a few bytes such that the arena has to align the buffer
+	std::vector<uint8_t> buffer(required_size + 3);
+	scratch_arena arena(buffer.data() + 3, required_size);
+
+	transform_pipeline pipeline(arena, k_num_bones);
+	REQUIRE(pipeline.is_valid());
+	CHECK(pipeline.get_num_transforms() == k_num_bones);
+	CHECK(arena.get_used_size() <= required_size);
+	CHECK_FALSE(pipeline.has_pending_frame());
+
+	{
+		// Every stream starts on its own cache line and the frames do not overlap
+		const transform_pipeline_frame& frame0 = pipeline.get_produce_frame();
+		const transform_pipeline_frame& frame1 = pipeline.get_consume_frame();
+		for (uint32_t frame_index = 0; frame_index < 2; ++frame_index)
+		{
+			const transform_pipeline_frame& frame = frame_index == 0 ? frame0 : frame1;
+			const void* frame_streams[12] =
+			{
+				frame.local_pose.rotation.x, frame.local_pose.rotation.y, frame.local_pose.rotation.z, frame.local_pose.rotation.w,
+				frame.local_pose.translation.x, frame.local_pose.translation.y, frame.local_pose.translation.z,
+				frame.local_pose.scale.x, frame.local_pose.scale.y, frame.local_pose.scale.z,
+				frame.object_pose, frame.palette,
+			};
+
+			for (const void* stream : frame_streams)
+				CHECK(rtm_impl::is_aligned_to(stream, k_scratch_default_alignment));
+		}
+
+		const uintptr_t frame0_end = reinterpret_cast<uintptr_t>(frame0.palette + k_num_bones);
+		const uintptr_t frame1_start = reinterpret_cast<uintptr_t>(frame1.local_pose.rotation.x);
+		CHECK(frame0_end <= frame1_start);
+		CHECK(frame1_start % k_scratch_default_alignment == 0);
+	}
+
+	const pipeline_test_data data;
+
+	// Reference, one whole frame at a time
+	std::vector<float3f> expected_positions(k_num_frames * k_num_vertices);
+	{
+		std::vector<uint8_t> reference_buffer(transform_pipeline::get_required_size(k_num_bones));
+		scratch_arena reference_arena(reference_buffer.data(), reference_buffer.size());
+		transform_pipeline reference(reference_arena, k_num_bones);
+		REQUIRE(reference.is_valid());
+
+		transform_pipeline_frame frame = reference.get_produce_frame();
+		for (uint32_t frame_index = 0; frame_index < k_num_frames; ++frame_index)
+		{
+			frame.frame_index = frame_index;
+			data.produce(frame);
+			data.consume(frame, expected_positions.data() + frame_index * k_num_vertices);
+		}
+	}
+
+	// Catch is not thread safe, the stages only record what is checked afterwards
+	std::vector<float3f> skinned_positions(k_num_frames * k_num_vertices);
+	std::atomic<uint32_t> num_produced(0);
+	std::atomic<uint32_t> num_consumed(0);
+	std::atomic<uint32_t> num_out_of_order(0);
+
+	const auto produce_stage = [&](const transform_pipeline_frame& frame)
+	{
+		if (frame.frame_index != num_produced)
+			num_out_of_order++;
+		num_produced++;
+		data.produce(frame);
+	};
+
+	const auto consume_stage = [&](const transform_pipeline_frame& frame)
+	{
+		if (frame.frame_index != num_consumed)
+			num_out_of_order++;
+		num_consumed++;
+		data.consume(frame, skinned_positions.data() + frame.frame_index * k_num_vertices);
+	};
+
+	thread_pool pool(k_num_worker_threads);
+
+	// Nothing to consume yet on the first frame
+	pipeline.run(pool, produce_stage, consume_stage);
+	CHECK(num_produced == 1);
+	CHECK(num_consumed == 0);
+	CHECK(pipeline.has_pending_frame());
+
+	for (uint32_t frame_index = 1; frame_index < k_num_frames; ++frame_index)
+	{
+		pipeline.run(pool, produce_stage, consume_stage);
+		CHECK(num_consumed == frame_index);
+	}
+
+	pipeline.flush(consume_stage);
+	CHECK_FALSE(pipeline.has_pending_frame());
+	CHECK(num_produced == k_num_frames);
+	CHECK(num_consumed == k_num_frames);
+	CHECK(num_out_of_order == 0);
+
+	// Nothing left to consume
+	pipeline.flush(consume_stage);
+	CHECK(num_consumed == k_num_frames);
+
+	// The frames are processed by the same functions, the results are identical
+	CHECK(std::memcmp(skinned_positions.data(), expected_positions.data(), skinned_positions.size() * sizeof(float3f)) == 0);
+
+	// With a serial executor, the stages run one after the other
+	serial_executor executor;
+	pipeline.run(executor, produce_stage, consume_stage);
+	CHECK(num_produced == k_num_frames + 1);
+	CHECK(num_consumed == k_num_frames);
+}
+
+TEST_CASE("batch transform_pipeline allocation", "[math][batch][pipeline]")
+{
+	std::vector<uint8_t> buffer(transform_pipeline::get_required_size(100));
+
+	{
+		// Only one frame fits, nothing is kept
+		scratch_arena arena(buffer.data(), buffer.size() / 2 + 64);
+		transform_pipeline pipeline(arena, 100);
+		CHECK_FALSE(pipeline.is_valid());
+		CHECK(arena.get_used_size() == 0);
+	}
+
+	{
+		scratch_arena arena(buffer.data(), buffer.size());
+		const transform_pipeline pipeline0(arena, 100);
+		CHECK(pipeline0.is_valid());
+
+		// The arena is full
+		const transform_pipeline pipeline1(arena, 100);
+		CHECK_FALSE(pipeline1.is_valid());
+		CHECK(pipeline0.is_valid());
+	}
+
+	{
+		scratch_arena arena(buffer.data(), buffer.size());
+		const transform_pipeline pipeline(arena, 0);
+		CHECK(pipeline.is_valid());
+		CHECK(pipeline.get_num_transforms() == 0);
+	}
+}
@@ -0,0 +1,906 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x3f.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
+
+using namespace rtm;
+
+TEST_CASE("quatf batch math", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-6F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	float lhs_x[num_quats];
+	float lhs_y[num_quats];
+	float lhs_z[num_quats];
+	float lhs_w[num_quats];
+	float rhs_x[num_quats];
+	float rhs_y[num_quats];
+	float rhs_z[num_quats];
+	float rhs_w[num_quats];
+	float out_x[num_quats];
+	float out_y[num_quats];
+	float out_z[num_quats];
+	float out_w[num_quats];
+
+	quatf lhs[num_quats];
+	quatf rhs[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.31F;
+		lhs[quat_index] = quat_from_euler(angle, angle * 0.5F - 1.0F, 0.7F - angle);
+		rhs[quat_index] = quat_from_euler(1.2F - angle, angle * 1.5F, angle + 0.2F);
+
+		lhs_x[quat_index] = quat_get_x(lhs[quat_index]);
+		lhs_y[quat_index] = quat_get_y(lhs[quat_index]);
+		lhs_z[quat_index] = quat_get_z(lhs[quat_index]);
+		lhs_w[quat_index] = quat_get_w(lhs[quat_index]);
+		rhs_x[quat_index] = quat_get_x(rhs[quat_index]);
+		rhs_y[quat_index] = quat_get_y(rhs[quat_index]);
+		rhs_z[quat_index] = quat_get_z(rhs[quat_index]);
+		rhs_w[quat_index] = quat_get_w(rhs[quat_index]);
+	}
+
+	{
+		quat_mul_soa(const_float4f_soa{ lhs_x, lhs_y, lhs_z, lhs_w }, const_float4f_soa{ rhs_x, rhs_y, rhs_z, rhs_w }, float4f_soa{ out_x, out_y, out_z, out_w }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_mul(lhs[quat_index], rhs[quat_index]), threshold));
+		}
+	}
+
+	{
+		// In place, the output aliases the lhs streams
+		const float4f_soa lhs_soa = { lhs_x, lhs_y, lhs_z, lhs_w };
+		quat_mul_soa(lhs_soa, const_float4f_soa{ rhs_x, rhs_y, rhs_z, rhs_w }, lhs_soa, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf result = quat_set(lhs_x[quat_index], lhs_y[quat_index], lhs_z[quat_index], lhs_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_mul(lhs[quat_index], rhs[quat_index]), threshold));
+		}
+	}
+
+	{
+		// Empty input does nothing
+		out_x[0] = 123.0F;
+		quat_mul_soa(const_float4f_soa{ rhs_x, rhs_y, rhs_z, rhs_w }, const_float4f_soa{ rhs_x, rhs_y, rhs_z, rhs_w }, float4f_soa{ out_x, out_y, out_z, out_w }, 0);
+		CHECK(out_x[0] == 123.0F);
+	}
+}
+
+TEST_CASE("quatf batch lerp", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-6F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	float start_x[num_quats];
+	float start_y[num_quats];
+	float start_z[num_quats];
+	float start_w[num_quats];
+	float end_x[num_quats];
+	float end_y[num_quats];
+	float end_z[num_quats];
+	float end_w[num_quats];
+	float out_x[num_quats];
+	float out_y[num_quats];
+	float out_z[num_quats];
+	float out_w[num_quats];
+	float alphas[num_quats];
+
+	quatf start[num_quats];
+	quatf end[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.31F;
+		start[quat_index] = quat_from_euler(angle, angle * 0.5F - 1.0F, 0.7F - angle);
+		end[quat_index] = quat_from_euler(1.2F - angle, angle * 1.5F, angle + 0.2F);
+
+		// Some of the end rotations are on the opposite side of the hypersphere
+		if ((quat_index % 3) == 0)
+			end[quat_index] = quat_neg(end[quat_index]);
+
+		alphas[quat_index] = float(quat_index) / float(num_quats - 1);
+
+		start_x[quat_index] = quat_get_x(start[quat_index]);
+		start_y[quat_index] = quat_get_y(start[quat_index]);
+		start_z[quat_index] = quat_get_z(start[quat_index]);
+		start_w[quat_index] = quat_get_w(start[quat_index]);
+		end_x[quat_index] = quat_get_x(end[quat_index]);
+		end_y[quat_index] = quat_get_y(end[quat_index]);
+		end_z[quat_index] = quat_get_z(end[quat_index]);
+		end_w[quat_index] = quat_get_w(end[quat_index]);
+	}
+
+	{
+		quat_lerp_soa(const_float4f_soa{ start_x, start_y, start_z, start_w }, const_float4f_soa{ end_x, end_y, end_z, end_w }, alphas, float4f_soa{ out_x, out_y, out_z, out_w }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_lerp(start[quat_index], end[quat_index], alphas[quat_index]), threshold));
+			CHECK(quat_is_normalized(result));
+		}
+	}
+
+	{
+		// In place, the output aliases the start streams
+		const float4f_soa start_soa = { start_x, start_y, start_z, start_w };
+		quat_lerp_soa(start_soa, const_float4f_soa{ end_x, end_y, end_z, end_w }, alphas, start_soa, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf result = quat_set(start_x[quat_index], start_y[quat_index], start_z[quat_index], start_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_lerp(start[quat_index], end[quat_index], alphas[quat_index]), threshold));
+		}
+	}
+}
+
+TEST_CASE("quatf batch normalize", "[math][quat][batch]")
+{
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	float input_x[num_quats];
+	float input_y[num_quats];
+	float input_z[num_quats];
+	float input_w[num_quats];
+	float out_x[num_quats];
+	float out_y[num_quats];
+	float out_z[num_quats];
+	float out_w[num_quats];
+
+	quatf input[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		// Scale the rotations to denormalize them, like after blending
+		const float angle = float(quat_index) * 0.31F;
+		const float scale = 0.25F + float(quat_index) * 0.4F;
+		input[quat_index] = vector_to_quat(vector_mul(quat_to_vector(quat_from_euler(angle, angle * 0.5F - 1.0F, 0.7F - angle)), scale));
+
+		input_x[quat_index] = quat_get_x(input[quat_index]);
+		input_y[quat_index] = quat_get_y(input[quat_index]);
+		input_z[quat_index] = quat_get_z(input[quat_index]);
+		input_w[quat_index] = quat_get_w(input[quat_index]);
+	}
+
+	// The hardware estimate only has 8 bits of precision with NEON and 12 with SSE
+	const normalize_precision precisions[] = { normalize_precision::estimate, normalize_precision::refined, normalize_precision::exact };
+	const float thresholds[] = { 1.0E-2F, 1.0E-4F, 1.0E-6F };
+
+	for (uint32_t precision_index = 0; precision_index < 3; ++precision_index)
+	{
+		const float threshold = thresholds[precision_index];
+		quat_normalize_soa(const_float4f_soa{ input_x, input_y, input_z, input_w }, float4f_soa{ out_x, out_y, out_z, out_w }, num_quats, precisions[precision_index]);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_normalize(input[quat_index]), threshold));
+			CHECK(quat_is_normalized(result, threshold * 2.0F));
+		}
+	}
+
+	{
+		// In place, the output aliases the input streams
+		const float4f_soa input_soa = { input_x, input_y, input_z, input_w };
+		quat_normalize_soa(input_soa, input_soa, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf result = quat_set(input_x[quat_index], input_y[quat_index], input_z[quat_index], input_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_normalize(input[quat_index]), 1.0E-6F));
+		}
+	}
+}
+
+TEST_CASE("quatf batch array load/store", "[math][quat][batch]")
+{
+	constexpr uint32_t num_quats = 19;
+
+	alignas(16) float4f input[num_quats];
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float value = float(quat_index);
+		input[quat_index] = float4f{ value, -value, value * 0.5F, 1.0F - value };
+	}
+
+	const store_mode modes[] = { store_mode::cached, store_mode::non_temporal };
+	const uint32_t prefetch_distances[] = { 0, rtm_impl::k_default_prefetch_distance };
+
+	for (store_mode mode : modes)
+	{
+		for (uint32_t prefetch_distance : prefetch_distances)
+		{
+			quatf quats[num_quats];
+			quat_load_array(input, quats, num_quats, mode, prefetch_distance);
+
+			for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+				CHECK(quat_near_equal(quats[quat_index], quat_load(&input[quat_index].x), 0.0F));
+
+			alignas(16) float4f output[num_quats];
+			quat_store_array(quats, output, num_quats, mode, prefetch_distance);
+
+			for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+			{
+				CHECK(output[quat_index].x == input[quat_index].x);
+				CHECK(output[quat_index].y == input[quat_index].y);
+				CHECK(output[quat_index].z == input[quat_index].z);
+				CHECK(output[quat_index].w == input[quat_index].w);
+			}
+		}
+	}
+}
+
+TEST_CASE("quatf batch slerp", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-6F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	float start_x[num_quats];
+	float start_y[num_quats];
+	float start_z[num_quats];
+	float start_w[num_quats];
+	float end_x[num_quats];
+	float end_y[num_quats];
+	float end_z[num_quats];
+	float end_w[num_quats];
+	float out_x[num_quats];
+	float out_y[num_quats];
+	float out_z[num_quats];
+	float out_w[num_quats];
+	float alphas[num_quats];
+
+	quatf start[num_quats];
+	quatf end[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.31F;
+		start[quat_index] = quat_from_euler(angle, angle * 0.5F - 1.0F, 0.7F - angle);
+		end[quat_index] = quat_from_euler(1.2F - angle, angle * 1.5F, angle + 0.2F);
+
+		// Some of the end rotations are on the opposite side of the hypersphere
+		if ((quat_index % 3) == 0)
+			end[quat_index] = quat_neg(end[quat_index]);
+
+		alphas[quat_index] = float(quat_index) / float(num_quats - 1);
+
+		start_x[quat_index] = quat_get_x(start[quat_index]);
+		start_y[quat_index] = quat_get_y(start[quat_index]);
+		start_z[quat_index] = quat_get_z(start[quat_index]);
+		start_w[quat_index] = quat_get_w(start[quat_index]);
+		end_x[quat_index] = quat_get_x(end[quat_index]);
+		end_y[quat_index] = quat_get_y(end[quat_index]);
+		end_z[quat_index] = quat_get_z(end[quat_index]);
+		end_w[quat_index] = quat_get_w(end[quat_index]);
+	}
+
+	{
+		quat_slerp_fast_soa(const_float4f_soa{ start_x, start_y, start_z, start_w }, const_float4f_soa{ end_x, end_y, end_z, end_w }, alphas, float4f_soa{ out_x, out_y, out_z, out_w }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_slerp_fast(start[quat_index], end[quat_index], alphas[quat_index]), threshold));
+			CHECK(quat_near_equal(result, quat_slerp(start[quat_index], end[quat_index], alphas[quat_index]), 5.0E-5F));
+		}
+	}
+
+	{
+		// In place, the output aliases the start streams
+		const float4f_soa start_soa = { start_x, start_y, start_z, start_w };
+		quat_slerp_fast_soa(start_soa, const_float4f_soa{ end_x, end_y, end_z, end_w }, alphas, start_soa, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf result = quat_set(start_x[quat_index], start_y[quat_index], start_z[quat_index], start_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_slerp_fast(start[quat_index], end[quat_index], alphas[quat_index]), threshold));
+		}
+	}
+}
+
+TEST_CASE("quatf batch matrix conversion", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-6F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	quatf quats[num_quats];
+	float quat_x[num_quats];
+	float quat_y[num_quats];
+	float quat_z[num_quats];
+	float quat_w[num_quats];
+	matrix3x3f matrices3x3[num_quats];
+	matrix3x4f matrices3x4[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.31F;
+		quats[quat_index] = quat_from_euler(angle, angle * 0.5F - 1.0F, 0.7F - angle);
+
+		quat_x[quat_index] = quat_get_x(quats[quat_index]);
+		quat_y[quat_index] = quat_get_y(quats[quat_index]);
+		quat_z[quat_index] = quat_get_z(quats[quat_index]);
+		quat_w[quat_index] = quat_get_w(quats[quat_index]);
+	}
+
+	{
+		matrix_from_quat_aos(quats, matrices3x3, num_quats);
+		matrix_from_quat_aos(quats, matrices3x4, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const matrix3x3f expected = matrix_from_quat(quats[quat_index]);
+			CHECK(vector_all_near_equal(matrices3x3[quat_index].x_axis, expected.x_axis, threshold));
+			CHECK(vector_all_near_equal(matrices3x3[quat_index].y_axis, expected.y_axis, threshold));
+			CHECK(vector_all_near_equal(matrices3x3[quat_index].z_axis, expected.z_axis, threshold));
+
+			CHECK(vector_all_near_equal(matrices3x4[quat_index].x_axis, expected.x_axis, threshold));
+			CHECK(vector_all_near_equal(matrices3x4[quat_index].y_axis, expected.y_axis, threshold));
+			CHECK(vector_all_near_equal(matrices3x4[quat_index].z_axis, expected.z_axis, threshold));
+			CHECK(vector_all_near_equal(matrices3x4[quat_index].w_axis, vector_zero(), threshold));
+		}
+	}
+
+	{
+		matrix3x3f soa_matrices[num_quats];
+		matrix_from_quat_soa(const_float4f_soa{ quat_x, quat_y, quat_z, quat_w }, soa_matrices, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			CHECK(vector_all_near_equal(soa_matrices[quat_index].x_axis, matrices3x3[quat_index].x_axis, threshold));
+			CHECK(vector_all_near_equal(soa_matrices[quat_index].y_axis, matrices3x3[quat_index].y_axis, threshold));
+			CHECK(vector_all_near_equal(soa_matrices[quat_index].z_axis, matrices3x3[quat_index].z_axis, threshold));
+		}
+	}
+
+	{
+		// Cover every pivot: near 180 degree rotations around each axis have a negative trace
+		matrices3x3[0] = matrix_from_quat(quat_from_axis_angle(vector_set(1.0F, 0.0F, 0.0F), 3.1F));
+		matrices3x3[1] = matrix_from_quat(quat_from_axis_angle(vector_set(0.0F, 1.0F, 0.0F), 3.1F));
+		matrices3x3[2] = matrix_from_quat(quat_from_axis_angle(vector_set(0.0F, 0.0F, 1.0F), 3.1F));
+		matrices3x3[3] = matrix_identity();
+
+		// Scale is normalized away like quat_from_matrix does
+		matrices3x3[5] = matrix_mul(matrix_from_scale(vector_set(2.0F, 0.5F, 3.0F)), matrices3x3[5]);
+
+		// Zero scale returns the identity
+		matrices3x3[6].y_axis = vector_zero();
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			matrices3x4[quat_index] = matrix_cast(matrices3x3[quat_index]);
+			matrices3x4[quat_index].w_axis = vector_set(1.0F, 2.0F, 3.0F, 1.0F);
+		}
+
+		quatf results3x3[num_quats];
+		quatf results3x4[num_quats];
+		quat_from_matrix_aos(matrices3x3, results3x3, num_quats);
+		quat_from_matrix_aos(matrices3x4, results3x4, num_quats);
+		quat_from_matrix_soa(matrices3x3, float4f_soa{ quat_x, quat_y, quat_z, quat_w }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf expected = quat_from_matrix(matrices3x3[quat_index]);
+			CHECK(quat_near_equal(results3x3[quat_index], expected, 1.0E-5F));
+			CHECK(quat_near_equal(results3x4[quat_index], expected, 1.0E-5F));
+
+			const quatf result_soa = quat_set(quat_x[quat_index], quat_y[quat_index], quat_z[quat_index], quat_w[quat_index]);
+			CHECK(quat_near_equal(result_soa, expected, 1.0E-5F));
+		}
+
+		CHECK(quat_near_equal(results3x3[6], quat_identity(), threshold));
+		CHECK(quat_near_equal(results3x3[8], quats[8], 1.0E-5F));
+	}
+}
+
+TEST_CASE("quatf batch mul vector3", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// 8 wide, 4 wide, and scalar code paths
+	constexpr uint32_t num_vectors = 15;
+
+	const quatf rotation = quat_from_euler(0.7F, -1.3F, 2.1F);
+
+	float3f vectors[num_vectors];
+	float vectors_x[num_vectors];
+	float vectors_y[num_vectors];
+	float vectors_z[num_vectors];
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		const float value = float(vector_index);
+		vectors[vector_index] = float3f{ value * 0.5F - 3.0F, 2.0F - value * 0.25F, value * value * 0.1F };
+		vectors_x[vector_index] = vectors[vector_index].x;
+		vectors_y[vector_index] = vectors[vector_index].y;
+		vectors_z[vector_index] = vectors[vector_index].z;
+	}
+
+	// Every count exercises both the quaternion and the matrix code paths
+	for (uint32_t count = 0; count <= num_vectors; ++count)
+	{
+		float3f results[num_vectors];
+		quat_mul_vector3_aos(vectors, rotation, results, count);
+
+		float results_x[num_vectors];
+		float results_y[num_vectors];
+		float results_z[num_vectors];
+		quat_mul_vector3_soa(const_float3f_soa{ vectors_x, vectors_y, vectors_z }, rotation, float3f_soa{ results_x, results_y, results_z }, count);
+
+		for (uint32_t vector_index = 0; vector_index < count; ++vector_index)
+		{
+			const vector4f expected = quat_mul_vector3(vector_load3(vectors + vector_index), rotation);
+			CHECK(vector_all_near_equal3(vector_load3(results + vector_index), expected, threshold));
+			CHECK(vector_all_near_equal3(vector_set(results_x[vector_index], results_y[vector_index], results_z[vector_index]), expected, threshold));
+		}
+	}
+
+	// In place
+	quat_mul_vector3_aos(vectors, rotation, vectors, num_vectors);
+	quat_mul_vector3_soa(const_float3f_soa{ vectors_x, vectors_y, vectors_z }, rotation, float3f_soa{ vectors_x, vectors_y, vectors_z }, num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		CHECK(vector_all_near_equal3(vector_load3(vectors + vector_index), vector_set(vectors_x[vector_index], vectors_y[vector_index], vectors_z[vector_index]), threshold));
+}
+
+TEST_CASE("quatf batch exp log integrate", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	float rotation_x[num_quats];
+	float rotation_y[num_quats];
+	float rotation_z[num_quats];
+	float rotation_w[num_quats];
+	float velocity_x[num_quats];
+	float velocity_y[num_quats];
+	float velocity_z[num_quats];
+	float out_x[num_quats];
+	float out_y[num_quats];
+	float out_z[num_quats];
+	float out_w[num_quats];
+
+	quatf rotations[num_quats];
+	vector4f velocities[num_quats];
+	quatf results[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.31F;
+		rotations[quat_index] = quat_from_euler(angle, angle * 0.5F - 1.0F, 0.7F - angle);
+
+		// The first group only has small angles, the later ones mix in large angles up to 4 * PI
+		const float speed = quat_index < 4 ? float(quat_index) * 0.3F : float(quat_index) * 0.7F;
+		velocities[quat_index] = vector_mul(vector_normalize3(vector_set(angle - 1.0F, 0.5F, 1.0F - angle * 0.2F)), speed);
+
+		rotation_x[quat_index] = quat_get_x(rotations[quat_index]);
+		rotation_y[quat_index] = quat_get_y(rotations[quat_index]);
+		rotation_z[quat_index] = quat_get_z(rotations[quat_index]);
+		rotation_w[quat_index] = quat_get_w(rotations[quat_index]);
+		velocity_x[quat_index] = vector_get_x(velocities[quat_index]);
+		velocity_y[quat_index] = vector_get_y(velocities[quat_index]);
+		velocity_z[quat_index] = vector_get_z(velocities[quat_index]);
+	}
+
+	// A coarse time step for the later integrated half angles to exceed 1.0 radian
+	const float delta_time = 0.25F;
+
+	{
+		quat_exp_soa(const_float3f_soa{ velocity_x, velocity_y, velocity_z }, float4f_soa{ out_x, out_y, out_z, out_w }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			// The documented accuracy of quat_exp_soa
+			const float half_angle = vector_length3(velocities[quat_index]);
+			const float exp_threshold = 2.0E-6F + 2.4E-7F * half_angle;
+
+			const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+			CHECK(quat_near_equal(result, quat_exp(velocities[quat_index]), exp_threshold));
+		}
+	}
+
+	{
+		quat_log_soa(const_float4f_soa{ rotation_x, rotation_y, rotation_z, rotation_w }, float3f_soa{ out_x, out_y, out_z }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const vector4f result = vector_set(out_x[quat_index], out_y[quat_index], out_z[quat_index]);
+			CHECK(vector_all_near_equal3(result, quat_log(rotations[quat_index]), threshold));
+		}
+	}
+
+	{
+		quat_integrate_aos(rotations, velocities, delta_time, results, num_quats);
+		quat_integrate_soa(const_float4f_soa{ rotation_x, rotation_y, rotation_z, rotation_w }, const_float3f_soa{ velocity_x, velocity_y, velocity_z }, delta_time, float4f_soa{ out_x, out_y, out_z, out_w }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf expected = quat_integrate(rotations[quat_index], velocities[quat_index], delta_time);
+			CHECK(quat_near_equal(results[quat_index], expected, threshold));
+			CHECK(quat_near_equal(quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]), expected, threshold));
+		}
+	}
+
+	{
+		// In place, the output aliases the rotations
+		const quatf expected = quat_integrate(rotations[num_quats - 1], velocities[num_quats - 1], delta_time);
+		quat_integrate_aos(rotations, velocities, delta_time, rotations, num_quats);
+		CHECK(quat_near_equal(rotations[num_quats - 1], expected, threshold));
+	}
+}
+
+TEST_CASE("quatf batch swing twist", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	float rotation_x[num_quats];
+	float rotation_y[num_quats];
+	float rotation_z[num_quats];
+	float rotation_w[num_quats];
+	float swing_x[num_quats];
+	float swing_y[num_quats];
+	float swing_z[num_quats];
+	float swing_w[num_quats];
+	float twist_x[num_quats];
+	float twist_y[num_quats];
+	float twist_z[num_quats];
+	float twist_w[num_quats];
+
+	quatf rotations[num_quats];
+	quatf swings[num_quats];
+	quatf twists[num_quats];
+	quatf results[num_quats];
+
+	const vector4f twist_axis = vector_normalize3(vector_set(0.2F, 0.9F, -0.3F));
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.37F;
+		rotations[quat_index] = quat_from_euler(angle - 3.0F, 0.5F * angle - 1.0F, 1.2F - angle);
+
+		// Negative [w] lanes in the wide loop
+		if ((quat_index % 3) == 1)
+			rotations[quat_index] = quat_neg(rotations[quat_index]);
+
+		rotation_x[quat_index] = quat_get_x(rotations[quat_index]);
+		rotation_y[quat_index] = quat_get_y(rotations[quat_index]);
+		rotation_z[quat_index] = quat_get_z(rotations[quat_index]);
+		rotation_w[quat_index] = quat_get_w(rotations[quat_index]);
+	}
+
+	{
+		quat_swing_twist_aos(rotations, twist_axis, swings, twists, num_quats);
+		quat_swing_twist_soa(const_float4f_soa{ rotation_x, rotation_y, rotation_z, rotation_w }, twist_axis, float4f_soa{ swing_x, swing_y, swing_z, swing_w }, float4f_soa{ twist_x, twist_y, twist_z, twist_w }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			INFO("index: " << quat_index);
+
+			quatf expected_swing;
+			quatf expected_twist;
+			quat_swing_twist(rotations[quat_index], twist_axis, expected_swing, expected_twist);
+			CHECK(quat_near_equal(swings[quat_index], expected_swing, threshold));
+			CHECK(quat_near_equal(twists[quat_index], expected_twist, threshold));
+			CHECK(quat_near_equal(quat_set(swing_x[quat_index], swing_y[quat_index], swing_z[quat_index], swing_w[quat_index]), expected_swing, threshold));
+			CHECK(quat_near_equal(quat_set(twist_x[quat_index], twist_y[quat_index], twist_z[quat_index], twist_w[quat_index]), expected_twist, threshold));
+		}
+	}
+
+	{
+		quat_clamp_swing_twist_aos(rotations, twist_axis, 0.9F, -1.0F, 1.2F, results, num_quats);
+		quat_clamp_swing_twist_soa(const_float4f_soa{ rotation_x, rotation_y, rotation_z, rotation_w }, twist_axis, 0.9F, -1.0F, 1.2F, float4f_soa{ swing_x, swing_y, swing_z, swing_w }, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			INFO("index: " << quat_index);
+
+			const quatf expected = quat_clamp_swing_twist(rotations[quat_index], twist_axis, 0.9F, -1.0F, 1.2F);
+			CHECK(quat_near_equal(results[quat_index], expected, threshold));
+			CHECK(quat_near_equal(quat_set(swing_x[quat_index], swing_y[quat_index], swing_z[quat_index], swing_w[quat_index]), expected, threshold));
+		}
+	}
+}
+
+TEST_CASE("quatf batch from directions", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	float from_x[num_quats];
+	float from_y[num_quats];
+	float from_z[num_quats];
+	float to_x[num_quats];
+	float to_y[num_quats];
+	float to_z[num_quats];
+	float out_x[num_quats];
+	float out_y[num_quats];
+	float out_z[num_quats];
+	float out_w[num_quats];
+
+	vector4f from[num_quats];
+	vector4f to[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.53F;
+		from[quat_index] = vector_set(scalar_cos(angle) * 2.0F, scalar_sin(angle), 0.3F - 0.1F * float(quat_index));
+		to[quat_index] = vector_set(0.5F - scalar_sin(angle), 1.5F, scalar_cos(angle) * 0.7F);
+
+		// Opposite and parallel directions in the wide loops and in the remainder
+		if ((quat_index % 5) == 1)
+			to[quat_index] = vector_mul(from[quat_index], -3.0F);
+		else if ((quat_index % 5) == 3)
+			to[quat_index] = vector_mul(from[quat_index], 0.5F);
+
+		from_x[quat_index] = vector_get_x(from[quat_index]);
+		from_y[quat_index] = vector_get_y(from[quat_index]);
+		from_z[quat_index] = vector_get_z(from[quat_index]);
+		to_x[quat_index] = vector_get_x(to[quat_index]);
+		to_y[quat_index] = vector_get_y(to[quat_index]);
+		to_z[quat_index] = vector_get_z(to[quat_index]);
+	}
+
+	const const_float3f_soa from_soa = { from_x, from_y, from_z };
+	const const_float3f_soa to_soa = { to_x, to_y, to_z };
+	const float4f_soa output = { out_x, out_y, out_z, out_w };
+
+	{
+		quat_from_to_soa(from_soa, to_soa, output, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			INFO("index: " << quat_index);
+
+			const quatf expected = quat_from_to(from[quat_index], to[quat_index]);
+			CHECK(quat_near_equal(quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]), expected, threshold));
+		}
+	}
+
+	{
+		// The 'to' directions are the up directions, some are parallel to forward
+		quat_look_rotation_soa(from_soa, to_soa, output, num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			INFO("index: " << quat_index);
+
+			const quatf expected = quat_look_rotation(from[quat_index], to[quat_index]);
+			const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+			CHECK(quat_near_equal(result, expected, threshold));
+			CHECK(vector_all_near_equal3(quat_mul_vector3(vector_set(1.0F, 0.0F, 0.0F), result), vector_normalize3(from[quat_index]), threshold));
+		}
+	}
+}
+
+TEST_CASE("quatf batch euler conversion", "[math][quat][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 19;
+
+	float pitch[num_quats];
+	float yaw[num_quats];
+	float roll[num_quats];
+	float out_x[num_quats];
+	float out_y[num_quats];
+	float out_z[num_quats];
+	float out_w[num_quats];
+	float out_pitch[num_quats];
+	float out_yaw[num_quats];
+	float out_roll[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.31F;
+		pitch[quat_index] = 1.4F - angle * 0.5F;
+		yaw[quat_index] = angle * 0.5F - 1.0F;
+		roll[quat_index] = 0.7F - angle * 0.5F;
+	}
+
+	// Gimbal locked lanes in the wide loop
+	pitch[1] = rtm::constants::half_pi();
+	roll[1] = 0.0F;
+	pitch[6] = -float(rtm::constants::half_pi());
+	roll[6] = 0.0F;
+
+	quat_from_euler_soa(const_float3f_soa{ pitch, yaw, roll }, float4f_soa{ out_x, out_y, out_z, out_w }, num_quats);
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+		CHECK(quat_near_equal(result, quat_from_euler(pitch[quat_index], yaw[quat_index], roll[quat_index]), threshold));
+	}
+
+	quat_to_euler_soa(const_float4f_soa{ out_x, out_y, out_z, out_w }, float3f_soa{ out_pitch, out_yaw, out_roll }, num_quats);
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		INFO("index: " << quat_index);
+
+		float expected_pitch;
+		float expected_yaw;
+		float expected_roll;
+		quat_to_euler(quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]), expected_pitch, expected_yaw, expected_roll);
+		CHECK(scalar_near_equal(out_pitch[quat_index], expected_pitch, threshold));
+		CHECK(scalar_near_equal(out_yaw[quat_index], expected_yaw, threshold));
+		CHECK(scalar_near_equal(out_roll[quat_index], expected_roll, threshold));
+
+		CHECK(scalar_near_equal(out_pitch[quat_index], pitch[quat_index], 1.0E-3F));
+		CHECK(scalar_near_equal(out_yaw[quat_index], yaw[quat_index], 1.0E-3F));
+		CHECK(scalar_near_equal(out_roll[quat_index], roll[quat_index], 1.0E-3F));
+	}
+}
+
+TEST_CASE("quatf batch average", "[math][quat][batch]")
+{
+	const vector4f axis = vector_normalize3(vector_set(1.0F, -2.0F, 0.5F));
+	const quat_average_precision precisions[] = { quat_average_precision::fast, quat_average_precision::exact };
+
+	for (quat_average_precision precision : precisions)
+	{
+		// A rotation and its negation are the same rotation
+		const quatf rotation = quat_from_axis_angle(axis, 0.7F);
+		const quatf opposite_rotations[2] = { rotation, quat_neg(rotation) };
+		CHECK(quat_near_equal(quat_average_aos(&opposite_rotations[0], nullptr, 2, precision), rotation, 1.0E-5F));
+
+		// Rotations around the same axis average to the middle angle
+		const quatf axis_rotations[2] = { quat_from_axis_angle(axis, 0.2F), quat_from_axis_angle(axis, 1.0F) };
+		CHECK(quat_near_equal(quat_average_aos(&axis_rotations[0], nullptr, 2, precision), quat_from_axis_angle(axis, 0.6F), 1.0E-5F));
+
+		// A zero weight ignores its rotation
+		const float weights[2] = { 0.0F, 2.0F };
+		CHECK(quat_near_equal(quat_average_aos(&axis_rotations[0], &weights[0], 2, precision), axis_rotations[1], 1.0E-5F));
+
+		const quatf single_rotation = quat_average_aos(&rotation, nullptr, 1, precision);
+		CHECK(quat_near_equal(single_rotation, rotation, 1.0E-6F));
+	}
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 23;
+	quatf rotations[num_quats];
+	float weights[num_quats];
+	float rotations_x[num_quats];
+	float rotations_y[num_quats];
+	float rotations_z[num_quats];
+	float rotations_w[num_quats];
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		// Noisy samples of the same rotation, some of them on the other hemisphere
+		const float noise = float(int32_t(quat_index % 5) - 2) * 0.05F;
+		rotations[quat_index] = quat_from_euler(0.4F + noise, -0.3F - noise * 0.5F, 1.2F + noise * 0.3F);
+		if (quat_index % 3 == 1)
+			rotations[quat_index] = quat_neg(rotations[quat_index]);
+
+		weights[quat_index] = 1.0F + float(quat_index % 4);
+		rotations_x[quat_index] = quat_get_x(rotations[quat_index]);
+		rotations_y[quat_index] = quat_get_y(rotations[quat_index]);
+		rotations_z[quat_index] = quat_get_z(rotations[quat_index]);
+		rotations_w[quat_index] = quat_get_w(rotations[quat_index]);
+	}
+
+	const const_float4f_soa rotations_soa = { &rotations_x[0], &rotations_y[0], &rotations_z[0], &rotations_w[0] };
+
+	{
+		const quatf fast_average = quat_average_aos(&rotations[0], &weights[0], num_quats, quat_average_precision::fast);
+		const quatf exact_average = quat_average_aos(&rotations[0], &weights[0], num_quats, quat_average_precision::exact);
+		CHECK(quat_is_normalized(fast_average));
+		CHECK(quat_is_normalized(exact_average));
+		CHECK(quat_dot(fast_average, rotations[0]) >= 0.0F);
+		CHECK(quat_dot(exact_average, rotations[0]) >= 0.0F);
+
+		// Clustered rotations have nearly the same fast and exact averages
+		CHECK(quat_near_equal(fast_average, exact_average, 1.0E-3F));
+
+		// The exact average maximizes the weighted sum of the squared dot products
+		float fast_score = 0.0F;
+		float exact_score = 0.0F;
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const float fast_dot = quat_dot(fast_average, rotations[quat_index]);
+			const float exact_dot = quat_dot(exact_average, rotations[quat_index]);
+			fast_score += weights[quat_index] * fast_dot * fast_dot;
+			exact_score += weights[quat_index] * exact_dot * exact_dot;
+		}
+		CHECK(exact_score >= fast_score * 0.999999F);
+
+		CHECK(quat_near_equal(quat_average_soa(rotations_soa, &weights[0], num_quats, quat_average_precision::fast), fast_average, 1.0E-6F));
+		CHECK(quat_near_equal(quat_average_soa(rotations_soa, &weights[0], num_quats, quat_average_precision::exact), exact_average, 1.0E-6F));
+	}
+
+	{
+		// Rotations far apart, the exact average is still an eigenvector
+		const quatf spread_rotations[5] = { quat_identity(), quat_from_axis_angle(vector_set(1.0F, 0.0F, 0.0F), 2.0F), quat_from_axis_angle(vector_set(0.0F, 1.0F, 0.0F), -1.5F), quat_from_axis_angle(vector_set(0.0F, 0.0F, 1.0F), 2.5F), quat_from_axis_angle(axis, 1.0F) };
+		const quatf average = quat_average_aos(&spread_rotations[0], nullptr, 5, quat_average_precision::exact);
+
+		vector4f product = vector_zero();
+		for (const quatf& spread_rotation : spread_rotations)
+			product = vector_mul_add(quat_to_vector(spread_rotation), float(quat_dot(spread_rotation, average)), product);
+
+		const float eigenvalue = vector_dot(product, quat_to_vector(average));
+		CHECK(vector_all_near_equal(product, vector_mul(quat_to_vector(average), eigenvalue), 1.0E-4F));
+
+		// It does not depend on the order nor on the sign of the rotations
+		const quatf shuffled_rotations[5] = { quat_neg(spread_rotations[3]), spread_rotations[0], quat_neg(spread_rotations[4]), spread_rotations[1], spread_rotations[2] };
+		const quatf shuffled_average = quat_average_aos(&shuffled_rotations[0], nullptr, 5, quat_average_precision::exact);
+		CHECK(scalar_abs(float(quat_dot(shuffled_average, average))) >= 0.99999F);
+	}
+
+	{
+		// Overlapping sliding windows
+		constexpr uint32_t num_groups = 8;
+		uint32_t group_offsets[num_groups];
+		uint32_t group_sizes[num_groups];
+		for (uint32_t group_index = 0; group_index < num_groups; ++group_index)
+		{
+			group_offsets[group_index] = group_index * 2;
+			group_sizes[group_index] = 1 + group_index;
+		}
+
+		for (quat_average_precision precision : precisions)
+		{
+			quatf averages[num_groups];
+			float averages_x[num_groups];
+			float averages_y[num_groups];
+			float averages_z[num_groups];
+			float averages_w[num_groups];
+			const float4f_soa averages_soa = { &averages_x[0], &averages_y[0], &averages_z[0], &averages_w[0] };
+
+			quat_average_groups_aos(&rotations[0], &weights[0], &group_offsets[0], &group_sizes[0], num_groups, &averages[0], precision);
+			quat_average_groups_soa(rotations_soa, &weights[0], &group_offsets[0], &group_sizes[0], num_groups, averages_soa, precision);
+
+			for (uint32_t group_index = 0; group_index < num_groups; ++group_index)
+			{
+				const quatf expected = quat_average_aos(&rotations[group_offsets[group_index]], &weights[group_offsets[group_index]], group_sizes[group_index], precision);
+				CHECK(quat_near_equal(averages[group_index], expected, 1.0E-6F));
+				CHECK(quat_near_equal(quat_set(averages_x[group_index], averages_y[group_index], averages_z[group_index], averages_w[group_index]), expected, 1.0E-6F));
+			}
+		}
+	}
+}
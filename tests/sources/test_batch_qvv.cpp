@@ -0,0 +1,916 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/qvvf.h>
+
+#include <limits>
+
+using namespace rtm;
+
+// Batch functions can return either of the two quaternions that represent a rotation
+static bool is_same_rotation(quatf_arg0 lhs, quatf_arg1 rhs, float threshold)
+{
+	return quat_near_equal(lhs, rhs, threshold) || quat_near_equal(lhs, quat_neg(rhs), threshold);
+}
+
+TEST_CASE("qvvf batch math", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_points = 19;
+
+	const qvvf transform = qvv_set(quat_from_euler(0.3F, -1.2F, 2.1F), vector_set(-1.5F, 12.0F, 0.25F), vector_set(1.5F, -0.5F, 2.0F));
+
+	float3f points[num_points];
+	alignas(16) float3f aos_output[num_points];
+	alignas(16) float points_x[num_points];
+	alignas(16) float points_y[num_points];
+	alignas(16) float points_z[num_points];
+	alignas(16) float out_x[num_points];
+	alignas(16) float out_y[num_points];
+	alignas(16) float out_z[num_points];
+
+	vector4f expected[num_points];
+
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+	{
+		const float value = float(point_index);
+		points[point_index] = float3f{ value * 0.5F - 3.0F, 2.0F - value, value * value * 0.1F };
+
+		points_x[point_index] = points[point_index].x;
+		points_y[point_index] = points[point_index].y;
+		points_z[point_index] = points[point_index].z;
+
+		expected[point_index] = qvv_mul_point3(vector_load3(&points[point_index]), transform);
+	}
+
+	{
+		qvv_mul_point3_aos(transform, points, aos_output, num_points);
+
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+			CHECK(vector_all_near_equal3(vector_load3(&aos_output[point_index]), expected[point_index], threshold));
+	}
+
+	{
+		qvv_mul_point3_aos(transform, points, aos_output, num_points, store_mode::non_temporal);
+
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+			CHECK(vector_all_near_equal3(vector_load3(&aos_output[point_index]), expected[point_index], threshold));
+	}
+
+	{
+		qvv_mul_point3_soa(transform, const_float3f_soa{ points_x, points_y, points_z }, float3f_soa{ out_x, out_y, out_z }, num_points);
+
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+			CHECK(vector_all_near_equal3(vector_set(out_x[point_index], out_y[point_index], out_z[point_index]), expected[point_index], threshold));
+	}
+
+	{
+		qvv_mul_point3_soa(transform, const_float3f_soa{ points_x, points_y, points_z }, float3f_soa{ out_x, out_y, out_z }, num_points, store_mode::non_temporal);
+
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+			CHECK(vector_all_near_equal3(vector_set(out_x[point_index], out_y[point_index], out_z[point_index]), expected[point_index], threshold));
+	}
+
+	{
+		// In place, the output aliases the input
+		qvv_mul_point3_aos(transform, points, points, num_points);
+		const float3f_soa points_soa = { points_x, points_y, points_z };
+		qvv_mul_point3_soa(transform, points_soa, points_soa, num_points);
+
+		for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+		{
+			CHECK(vector_all_near_equal3(vector_load3(&points[point_index]), expected[point_index], threshold));
+			CHECK(vector_all_near_equal3(vector_set(points_x[point_index], points_y[point_index], points_z[point_index]), expected[point_index], threshold));
+		}
+	}
+
+	{
+		// Empty input does nothing
+		out_x[0] = 123.0F;
+		aos_output[0].x = 123.0F;
+		qvv_mul_point3_soa(transform, const_float3f_soa{ points_x, points_y, points_z }, float3f_soa{ out_x, out_y, out_z }, 0);
+		qvv_mul_point3_aos(transform, points, aos_output, 0);
+		CHECK(out_x[0] == 123.0F);
+		CHECK(aos_output[0].x == 123.0F);
+	}
+}
+
+TEST_CASE("qvvf batch array load/store", "[math][qvv][batch]")
+{
+	constexpr uint32_t num_transforms = 7;
+
+	qvvf transforms[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		const quatf rotation = quat_from_euler(value * 0.3F, 0.5F - value, value * 0.1F);
+		transforms[transform_index] = qvv_set(rotation, vector_set(value, -value, value * 2.0F, 0.0F), vector_set(1.0F + value, 2.0F, -0.5F, 0.0F));
+	}
+
+	const store_mode modes[] = { store_mode::cached, store_mode::non_temporal };
+
+	for (store_mode mode : modes)
+	{
+		alignas(16) float4f serialized[num_transforms * 3];
+		qvv_store_array(transforms, serialized, num_transforms, mode);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const qvvf& transform = transforms[transform_index];
+			CHECK(quat_near_equal(quat_load(&serialized[transform_index * 3 + 0].x), transform.rotation, 0.0F));
+			CHECK(vector_all_near_equal(vector_load(serialized + transform_index * 3 + 1), transform.translation, 0.0F));
+			CHECK(vector_all_near_equal(vector_load(serialized + transform_index * 3 + 2), transform.scale, 0.0F));
+		}
+
+		qvvf result[num_transforms];
+		qvv_load_array(serialized, result, num_transforms, mode, 0);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			CHECK(quat_near_equal(result[transform_index].rotation, transforms[transform_index].rotation, 0.0F));
+			CHECK(vector_all_near_equal(result[transform_index].translation, transforms[transform_index].translation, 0.0F));
+			CHECK(vector_all_near_equal(result[transform_index].scale, transforms[transform_index].scale, 0.0F));
+		}
+	}
+}
+
+TEST_CASE("qvvf batch packed array load/store", "[math][qvv][batch]")
+{
+	// Odd count to exercise the pair loop along with the remainder
+	constexpr uint32_t num_transforms = 7;
+
+	qvvf transforms[num_transforms];
+	qvvf uniform_transforms[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		const quatf rotation = quat_from_euler(value * 0.3F, 0.5F - value, value * 0.1F);
+		const vector4f translation = vector_set(value, -value, value * 2.0F, 0.0F);
+		transforms[transform_index] = qvv_set(rotation, translation, vector_set(1.0F + value, 2.0F, -0.5F, 0.0F));
+		uniform_transforms[transform_index] = qvv_set(rotation, translation, vector_set(0.5F + value, 0.5F + value, 0.5F + value, 0.0F));
+	}
+
+	const store_mode modes[] = { store_mode::cached, store_mode::non_temporal };
+
+	for (store_mode mode : modes)
+	{
+		alignas(16) qvvf_packed packed[num_transforms];
+		qvv_store_array(transforms, packed, num_transforms, mode);
+
+		alignas(16) qvvf_packed_uniform_scale packed_uniform[num_transforms];
+		qvv_store_array(uniform_transforms, packed_uniform, num_transforms, mode);
+
+		qvvf result[num_transforms];
+		qvvf result_uniform[num_transforms];
+		qvv_load_array(packed, result, num_transforms, mode);
+		qvv_load_array(packed_uniform, result_uniform, num_transforms, mode, 0);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const qvvf expected = qvv_load_packed(packed + transform_index);
+			CHECK(quat_near_equal(expected.rotation, transforms[transform_index].rotation, 0.0F));
+			CHECK(vector_all_near_equal(expected.translation, transforms[transform_index].translation, 0.0F));
+			CHECK(vector_all_near_equal(expected.scale, transforms[transform_index].scale, 0.0F));
+
+			CHECK(quat_near_equal(result[transform_index].rotation, transforms[transform_index].rotation, 0.0F));
+			CHECK(vector_all_near_equal(result[transform_index].translation, transforms[transform_index].translation, 0.0F));
+			CHECK(vector_all_near_equal(result[transform_index].scale, transforms[transform_index].scale, 0.0F));
+
+			CHECK(quat_near_equal(result_uniform[transform_index].rotation, uniform_transforms[transform_index].rotation, 0.0F));
+			CHECK(vector_all_near_equal(result_uniform[transform_index].translation, uniform_transforms[transform_index].translation, 0.0F));
+			CHECK(vector_all_near_equal(result_uniform[transform_index].scale, uniform_transforms[transform_index].scale, 0.0F));
+		}
+	}
+}
+
+TEST_CASE("qvvf batch hierarchy", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	// Two chains and a few branches so that some depths are wider than 4 transforms
+	constexpr uint32_t num_transforms = 23;
+	const uint32_t root = k_hierarchy_root_index;
+	const uint32_t parent_indices[num_transforms] = { root, 0, 1, 2, 3, 0, 5, 6, 7, 1, 1, 1, 1, 1, 5, 5, 5, 5, 9, 10, 11, 12, 13 };
+
+	uint32_t depths[num_transforms];
+	uint32_t sorted_indices[num_transforms];
+	uint32_t depth_offsets[num_transforms + 1];
+	const transform_hierarchy hierarchy = hierarchy_sort_by_depth(parent_indices, num_transforms, depths, sorted_indices, depth_offsets);
+
+	CHECK(hierarchy.num_transforms == num_transforms);
+	CHECK(hierarchy.num_depths == 5);
+	CHECK(depth_offsets[0] == 0);
+	CHECK(depth_offsets[hierarchy.num_depths] == num_transforms);
+
+	for (uint32_t depth = 0; depth < hierarchy.num_depths; ++depth)
+	{
+		for (uint32_t sorted_index = depth_offsets[depth]; sorted_index < depth_offsets[depth + 1]; ++sorted_index)
+			CHECK(depths[sorted_indices[sorted_index]] == depth);
+	}
+
+	qvvf local_transforms[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		const quatf rotation = quat_from_euler(value * 0.2F, 0.3F - value * 0.1F, value * 0.05F);
+		local_transforms[transform_index] = qvv_set(rotation, vector_set(value * 0.5F, 1.0F - value, 0.25F), vector_set(1.0F + value * 0.01F, 0.9F, 1.1F));
+	}
+
+	qvvf expected[num_transforms];
+	qvvf expected_no_scale[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const uint32_t parent_index = parent_indices[transform_index];
+		if (parent_index == root)
+		{
+			expected[transform_index] = local_transforms[transform_index];
+			expected_no_scale[transform_index] = qvv_set(local_transforms[transform_index].rotation, local_transforms[transform_index].translation, vector_set(1.0F));
+		}
+		else
+		{
+			expected[transform_index] = qvv_mul(local_transforms[transform_index], expected[parent_index]);
+			expected_no_scale[transform_index] = qvv_mul_no_scale(local_transforms[transform_index], expected_no_scale[parent_index]);
+		}
+	}
+
+	qvvf object_transforms[num_transforms];
+
+	{
+		qvv_local_to_object(hierarchy, local_transforms, object_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			CHECK(is_same_rotation(object_transforms[transform_index].rotation, expected[transform_index].rotation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].translation, expected[transform_index].translation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].scale, expected[transform_index].scale, threshold));
+		}
+	}
+
+	{
+		qvv_local_to_object_no_scale(hierarchy, local_transforms, object_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			CHECK(is_same_rotation(object_transforms[transform_index].rotation, expected_no_scale[transform_index].rotation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].translation, expected_no_scale[transform_index].translation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].scale, vector_set(1.0F), threshold));
+		}
+	}
+
+	{
+		// Negative scale goes through qvv_mul
+		local_transforms[10].scale = vector_set(1.0F, -1.0F, 1.0F);
+		expected[10] = qvv_mul(local_transforms[10], expected[1]);
+		expected[19] = qvv_mul(local_transforms[19], expected[10]);
+
+		qvv_local_to_object(hierarchy, local_transforms, object_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			CHECK(is_same_rotation(object_transforms[transform_index].rotation, expected[transform_index].rotation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].translation, expected[transform_index].translation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].scale, expected[transform_index].scale, threshold));
+		}
+	}
+
+	{
+		// In place, the output aliases the input
+		qvv_local_to_object(hierarchy, local_transforms, local_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			CHECK(is_same_rotation(local_transforms[transform_index].rotation, expected[transform_index].rotation, threshold));
+			CHECK(vector_all_near_equal3(local_transforms[transform_index].translation, expected[transform_index].translation, threshold));
+		}
+	}
+
+	{
+		// Empty hierarchy
+		const transform_hierarchy empty = hierarchy_sort_by_depth(parent_indices, 0, depths, sorted_indices, depth_offsets);
+		CHECK(empty.num_depths == 0);
+		CHECK(depth_offsets[0] == 0);
+		qvv_local_to_object(empty, local_transforms, object_transforms);
+	}
+}
+
+TEST_CASE("qvvf batch hierarchy dirty", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	constexpr uint32_t num_transforms = 23;
+	const uint32_t root = k_hierarchy_root_index;
+	const uint32_t parent_indices[num_transforms] = { root, 0, 1, 2, 3, 0, 5, 6, 7, 1, 1, 1, 1, 1, 5, 5, 5, 5, 9, 10, 11, 12, 13 };
+
+	uint32_t depths[num_transforms];
+	uint32_t sorted_indices[num_transforms];
+	uint32_t depth_offsets[num_transforms + 1];
+	const transform_hierarchy hierarchy = hierarchy_sort_by_depth(parent_indices, num_transforms, depths, sorted_indices, depth_offsets);
+
+	qvvf local_transforms[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		const quatf rotation = quat_from_euler(value * 0.2F, 0.3F - value * 0.1F, value * 0.05F);
+		local_transforms[transform_index] = qvv_set(rotation, vector_set(value * 0.5F, 1.0F - value, 0.25F), vector_set(1.0F + value * 0.01F, 0.9F, 1.1F));
+	}
+
+	const auto is_descendant_of = [&](uint32_t transform_index, uint32_t ancestor_index)
+	{
+		for (; transform_index != root; transform_index = parent_indices[transform_index])
+		{
+			if (transform_index == ancestor_index)
+				return true;
+		}
+		return false;
+	};
+
+	{
+		qvvf object_transforms[num_transforms];
+		qvvf expected[num_transforms];
+		qvv_local_to_object(hierarchy, local_transforms, object_transforms);
+
+		// Nothing changed, nothing is updated
+		uint32_t dirty_bits[1] = { 0 };
+		CHECK(qvv_local_to_object_dirty(hierarchy, local_transforms, object_transforms, dirty_bits) == 0);
+		CHECK(dirty_bits[0] == 0);
+
+		// Transform 1 has 5 children at depth 2, enough for a group of 4, and transform 17 is a leaf
+		local_transforms[1].translation = vector_set(2.0F, -1.0F, 0.5F);
+		local_transforms[1].rotation = quat_from_euler(0.1F, 0.7F, -0.3F);
+		local_transforms[17].scale = vector_set(1.5F, 1.5F, 0.5F);
+		dirty_bits[0] = (1U << 1) | (1U << 17);
+
+		qvv_local_to_object(hierarchy, local_transforms, expected);
+
+		uint32_t num_expected = 0;
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			if (is_descendant_of(transform_index, 1) || transform_index == 17)
+				num_expected++;
+		}
+
+		CHECK(qvv_local_to_object_dirty(hierarchy, local_transforms, object_transforms, dirty_bits) == num_expected);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const bool is_dirty = is_descendant_of(transform_index, 1) || transform_index == 17;
+			CHECK(((dirty_bits[0] >> transform_index) & 1) == (is_dirty ? 1U : 0U));
+
+			CHECK(is_same_rotation(object_transforms[transform_index].rotation, expected[transform_index].rotation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].translation, expected[transform_index].translation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].scale, expected[transform_index].scale, threshold));
+		}
+
+		// Negative scale on a root goes through qvv_mul for every transform
+		local_transforms[0].scale = vector_set(1.0F, -1.0F, 1.0F);
+		dirty_bits[0] = 1U << 0;
+
+		qvv_local_to_object(hierarchy, local_transforms, expected);
+		CHECK(qvv_local_to_object_dirty(hierarchy, local_transforms, object_transforms, dirty_bits) == num_transforms);
+		CHECK(dirty_bits[0] == (1U << num_transforms) - 1);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			CHECK(is_same_rotation(object_transforms[transform_index].rotation, expected[transform_index].rotation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].translation, expected[transform_index].translation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].scale, expected[transform_index].scale, threshold));
+		}
+	}
+
+	{
+		qvvf object_transforms[num_transforms];
+		qvvf expected[num_transforms];
+		qvv_local_to_object_no_scale(hierarchy, local_transforms, object_transforms);
+
+		local_transforms[5].translation = vector_set(-3.0F, 0.5F, 1.0F);
+		uint32_t dirty_bits[1] = { 1U << 5 };
+
+		qvv_local_to_object_no_scale(hierarchy, local_transforms, expected);
+
+		uint32_t num_expected = 0;
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			if (is_descendant_of(transform_index, 5))
+				num_expected++;
+		}
+
+		CHECK(qvv_local_to_object_no_scale_dirty(hierarchy, local_transforms, object_transforms, dirty_bits) == num_expected);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			CHECK(((dirty_bits[0] >> transform_index) & 1) == (is_descendant_of(transform_index, 5) ? 1U : 0U));
+
+			CHECK(is_same_rotation(object_transforms[transform_index].rotation, expected[transform_index].rotation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].translation, expected[transform_index].translation, threshold));
+			CHECK(vector_all_near_equal3(object_transforms[transform_index].scale, vector_set(1.0F), threshold));
+		}
+	}
+}
+
+TEST_CASE("qvvf batch mul", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_transforms = 19;
+
+	qvvf lhs[num_transforms];
+	qvvf rhs[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		lhs[transform_index] = qvv_set(quat_from_euler(value * 0.3F, 1.0F - value * 0.2F, value), vector_set(value, -2.0F, value * 0.5F), vector_set(1.0F + value * 0.1F, 0.5F, 2.0F));
+		rhs[transform_index] = qvv_set(quat_from_euler(-value, value * 0.7F, 0.1F), vector_set(0.5F, value * 2.0F, 1.0F), vector_set(0.8F, 1.0F + value * 0.05F, 1.2F));
+	}
+
+	qvvf output[num_transforms];
+
+	CHECK(!qvv_any_negative_scale(lhs, num_transforms));
+	CHECK(!qvv_any_negative_scale(rhs, num_transforms));
+
+	{
+		qvv_mul_aos(lhs, rhs, output, num_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const qvvf expected = qvv_mul(lhs[transform_index], rhs[transform_index]);
+			CHECK(is_same_rotation(output[transform_index].rotation, expected.rotation, threshold));
+			CHECK(vector_all_near_equal3(output[transform_index].translation, expected.translation, threshold));
+			CHECK(vector_all_near_equal3(output[transform_index].scale, expected.scale, threshold));
+		}
+	}
+
+	{
+		qvv_mul_no_scale_aos(lhs, rhs, output, num_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const qvvf expected = qvv_mul_no_scale(lhs[transform_index], rhs[transform_index]);
+			CHECK(is_same_rotation(output[transform_index].rotation, expected.rotation, threshold));
+			CHECK(vector_all_near_equal3(output[transform_index].translation, expected.translation, threshold));
+			CHECK(vector_all_near_equal3(output[transform_index].scale, vector_set(1.0F), threshold));
+		}
+	}
+
+	{
+		// Mix of positive and negative scale within the same 4 lanes, on either side
+		lhs[1].scale = vector_set(-1.0F, 1.0F, 1.0F);
+		lhs[2].scale = vector_set(1.0F, -2.0F, -0.5F);
+		rhs[2].scale = vector_set(-1.5F, 1.0F, 1.0F);
+		rhs[5].scale = vector_set(1.0F, 1.0F, -1.0F);
+		rhs[6].scale = vector_set(-1.0F, -1.0F, -1.0F);
+		lhs[9].scale = vector_set(-1.0F, 1.0F, 1.0F);
+
+		CHECK(qvv_any_negative_scale(lhs, num_transforms));
+		CHECK(qvv_any_negative_scale(rhs, num_transforms));
+		CHECK(!qvv_any_negative_scale(rhs, 2));
+
+		qvv_mul_aos(lhs, rhs, output, num_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const qvvf expected = qvv_mul(lhs[transform_index], rhs[transform_index]);
+			CHECK(is_same_rotation(output[transform_index].rotation, expected.rotation, threshold));
+			CHECK(vector_all_near_equal3(output[transform_index].translation, expected.translation, threshold));
+			CHECK(vector_all_near_equal3(output[transform_index].scale, expected.scale, threshold));
+		}
+	}
+
+	{
+		// In place, the output aliases the lhs
+		qvvf expected[num_transforms];
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			expected[transform_index] = qvv_mul(lhs[transform_index], rhs[transform_index]);
+
+		qvv_mul_aos(lhs, rhs, lhs, num_transforms);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			CHECK(is_same_rotation(lhs[transform_index].rotation, expected[transform_index].rotation, threshold));
+			CHECK(vector_all_near_equal3(lhs[transform_index].translation, expected[transform_index].translation, threshold));
+		}
+	}
+}
+
+TEST_CASE("qvvf batch inverse", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_transforms = 11;
+
+	qvvf input[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		input[transform_index] = qvv_set(quat_from_euler(value * 0.3F, 1.0F - value * 0.2F, value), vector_set(value, -2.0F, value * 0.5F), vector_set(1.0F + value * 0.1F, 0.5F, 2.0F));
+	}
+
+	qvvf output[num_transforms];
+	qvv_inverse_aos(input, output, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf expected = qvv_inverse(input[transform_index]);
+		CHECK(quat_near_equal(output[transform_index].rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].translation, expected.translation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].scale, expected.scale, threshold));
+	}
+
+	qvv_inverse_no_scale_aos(input, output, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf expected = qvv_inverse_no_scale(input[transform_index]);
+		CHECK(quat_near_equal(output[transform_index].rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].translation, expected.translation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].scale, vector_set(1.0F), 0.0F));
+	}
+
+	// In place
+	qvv_inverse_aos(input, output, num_transforms);
+	qvv_inverse_aos(input, input, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		CHECK(quat_near_equal(input[transform_index].rotation, output[transform_index].rotation, 0.0F));
+		CHECK(vector_all_near_equal3(input[transform_index].translation, output[transform_index].translation, 0.0F));
+		CHECK(vector_all_near_equal3(input[transform_index].scale, output[transform_index].scale, 0.0F));
+	}
+}
+
+TEST_CASE("qvvf batch indexed", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	// More outputs than the prefetch distance and the 8 wide gathers, from fewer transforms
+	constexpr uint32_t num_transforms = 7;
+	constexpr uint32_t num_outputs = 37;
+
+	qvvf rig[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		const float scale_x = (transform_index % 3) == 0 ? -1.5F : 1.5F;
+		rig[transform_index] = qvv_set(quat_from_euler(value * 0.3F, 0.5F - value, value * 0.1F), vector_set(value, -value, value * 2.0F, 0.0F), vector_set(scale_x, 2.0F, 0.5F + value, 0.0F));
+	}
+
+	uint32_t indices[num_outputs];
+	qvvf rhs[num_outputs];
+	float3f points[num_outputs];
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+	{
+		const float value = float(output_index) * 0.21F;
+		indices[output_index] = (output_index * 5 + 3) % num_transforms;
+		rhs[output_index] = qvv_set(quat_from_euler(1.2F - value, value * 0.3F, -value), vector_set(-2.0F, value, 0.5F, 0.0F), vector_set(0.75F, 1.0F, 1.0F + value, 0.0F));
+		points[output_index] = float3f{ value, 1.0F - value, 2.0F };
+	}
+
+	qvvf output[num_outputs];
+	qvv_mul_indexed_aos(rig, indices, rhs, output, num_outputs);
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+	{
+		const qvvf expected = qvv_mul(rig[indices[output_index]], rhs[output_index]);
+		CHECK(is_same_rotation(output[output_index].rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(output[output_index].translation, expected.translation, threshold));
+		CHECK(vector_all_near_equal3(output[output_index].scale, expected.scale, threshold));
+	}
+
+	// In place without prefetching, the output aliases the rhs
+	qvv_mul_indexed_aos(rig, indices, rhs, rhs, num_outputs, 0);
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+	{
+		CHECK(quat_near_equal(rhs[output_index].rotation, output[output_index].rotation, 0.0F));
+		CHECK(vector_all_near_equal3(rhs[output_index].translation, output[output_index].translation, 0.0F));
+	}
+
+	float3f point_output[num_outputs];
+	qvv_mul_point3_indexed_aos(rig, indices, points, point_output, num_outputs);
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+	{
+		const vector4f expected = qvv_mul_point3(vector_load3(points + output_index), rig[indices[output_index]]);
+		CHECK(vector_all_near_equal3(vector_load3(point_output + output_index), expected, threshold));
+	}
+
+	// In place without prefetching
+	qvv_mul_point3_indexed_aos(rig, indices, points, points, num_outputs, 0);
+	for (uint32_t output_index = 0; output_index < num_outputs; ++output_index)
+		CHECK(vector_all_near_equal3(vector_load3(points + output_index), vector_load3(point_output + output_index), threshold));
+}
+
+TEST_CASE("qvvf batch matrix conversion", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_transforms = 19;
+
+	qvvf transforms[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		transforms[transform_index] = qvv_set(quat_from_euler(value * 0.3F, 1.0F - value * 0.2F, value), vector_set(value, -2.0F, value * 0.5F), vector_set(1.0F + value * 0.1F, -0.5F, 2.0F));
+	}
+
+	alignas(16) float3x4f output[num_transforms];
+
+	const store_mode modes[] = { store_mode::cached, store_mode::non_temporal };
+	for (store_mode mode : modes)
+	{
+		matrix_from_qvv_aos(transforms, output, num_transforms, mode);
+
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const float3x4f expected = matrix_cast(matrix_from_qvv(transforms[transform_index]));
+			CHECK(vector_all_near_equal(vector_load(&output[transform_index].x_row), vector_load(&expected.x_row), threshold));
+			CHECK(vector_all_near_equal(vector_load(&output[transform_index].y_row), vector_load(&expected.y_row), threshold));
+			CHECK(vector_all_near_equal(vector_load(&output[transform_index].z_row), vector_load(&expected.z_row), threshold));
+		}
+	}
+
+	// Back to QVV transforms, the negative Y scale ends up in the X scale
+	matrix3x4f matrices[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		matrices[transform_index] = matrix_from_qvv(transforms[transform_index]);
+
+	// A zero scale lane
+	matrices[5].y_axis = vector_zero();
+
+	qvvf decomposed[num_transforms];
+	qvv_from_matrix_aos(matrices, decomposed, num_transforms);
+
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf expected = qvv_from_matrix(matrices[transform_index]);
+		CHECK(is_same_rotation(decomposed[transform_index].rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(decomposed[transform_index].translation, expected.translation, threshold));
+		CHECK(vector_all_near_equal3(decomposed[transform_index].scale, expected.scale, threshold));
+	}
+}
+
+TEST_CASE("qvvf batch blend", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_transforms = 19;
+	constexpr uint32_t num_poses = 3;
+
+	qvvf poses[num_poses][num_transforms];
+	for (uint32_t pose_index = 0; pose_index < num_poses; ++pose_index)
+	{
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		{
+			const float value = float(transform_index) + float(pose_index) * 0.25F;
+			quatf rotation = quat_from_euler(value * 0.1F, 1.0F - value * 0.05F, value * 0.2F);
+
+			// Some rotations on the other side of the hypersphere
+			if ((transform_index + pose_index) % 3 == 0)
+				rotation = quat_neg(rotation);
+
+			poses[pose_index][transform_index] = qvv_set(rotation, vector_set(value, -2.0F, value * 0.5F), vector_set(1.0F + value * 0.1F, 0.5F, 2.0F - float(pose_index)));
+		}
+	}
+
+	const qvvf* pose_ptrs[num_poses] = { poses[0], poses[1], poses[2] };
+	const float weights[num_poses] = { 0.5F, 0.3F, 0.2F };
+
+	qvvf output[num_transforms];
+
+	qvv_lerp_aos(poses[0], poses[1], 0.3F, output, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf expected = qvv_lerp(poses[0][transform_index], poses[1][transform_index], 0.3F);
+		CHECK(quat_near_equal(output[transform_index].rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].translation, expected.translation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].scale, expected.scale, threshold));
+	}
+
+	// Blending 2 poses is a lerp
+	const float lerp_weights[2] = { 0.7F, 0.3F };
+	qvv_blend_aos(pose_ptrs, lerp_weights, 2, output, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf expected = qvv_lerp(poses[0][transform_index], poses[1][transform_index], 0.3F);
+		CHECK(quat_near_equal(output[transform_index].rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].translation, expected.translation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].scale, expected.scale, threshold));
+	}
+
+	qvv_blend_aos(pose_ptrs, weights, num_poses, output, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf& first = poses[0][transform_index];
+		vector4f rotation = vector_zero();
+		vector4f translation = vector_zero();
+		vector4f scale = vector_zero();
+		for (uint32_t pose_index = 0; pose_index < num_poses; ++pose_index)
+		{
+			const qvvf& transform = poses[pose_index][transform_index];
+			const float rotation_alignment = quat_dot(first.rotation, transform.rotation);
+			const float rotation_weight = rotation_alignment < 0.0F ? -weights[pose_index] : weights[pose_index];
+
+			rotation = vector_add(rotation, vector_mul(quat_to_vector(transform.rotation), rotation_weight));
+			translation = vector_add(translation, vector_mul(transform.translation, weights[pose_index]));
+			scale = vector_add(scale, vector_mul(transform.scale, weights[pose_index]));
+		}
+
+		CHECK(quat_near_equal(output[transform_index].rotation, quat_normalize(vector_to_quat(rotation)), threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].translation, translation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].scale, scale, threshold));
+	}
+
+	// A single pose is copied with its rotation normalized
+	const float single_weight = 1.0F;
+	qvv_blend_aos(pose_ptrs, &single_weight, 1, output, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		CHECK(quat_near_equal(output[transform_index].rotation, poses[0][transform_index].rotation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].translation, poses[0][transform_index].translation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].scale, poses[0][transform_index].scale, threshold));
+	}
+
+	qvv_apply_additive_aos(poses[0], poses[2], 0.6F, output, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf expected = qvv_apply_additive(poses[0][transform_index], poses[2][transform_index], 0.6F);
+		CHECK(quat_near_equal(output[transform_index].rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].translation, expected.translation, threshold));
+		CHECK(vector_all_near_equal3(output[transform_index].scale, expected.scale, threshold));
+	}
+
+	// In place
+	qvv_lerp_aos(poses[0], poses[1], 0.3F, poses[0], num_transforms);
+	qvv_blend_aos(pose_ptrs, weights, num_poses, poses[1], num_transforms);
+	qvv_apply_additive_aos(poses[1], poses[2], 0.6F, poses[2], num_transforms);
+	CHECK(quat_is_normalized(poses[2][num_transforms - 1].rotation));
+}
+
+TEST_CASE("qvvf batch additive", "[math][qvv][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_transforms = 19;
+
+	qvvf poses[num_transforms];
+	qvvf reference[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		quatf rotation = quat_from_euler(value * 0.3F, 1.0F - value * 0.15F, value * 0.2F);
+
+		// Some rotations on the other side of the hypersphere
+		if (transform_index % 3 == 0)
+			rotation = quat_neg(rotation);
+
+		poses[transform_index] = qvv_set(rotation, vector_set(value, -2.0F, value * 0.5F), vector_set(1.0F + value * 0.1F, 0.5F, 2.0F));
+		reference[transform_index] = qvv_set(quat_from_euler(-value * 0.1F, 0.4F, value * 0.05F), vector_set(1.0F, value, -value), vector_set(2.0F, 1.0F + value * 0.2F, 0.25F));
+	}
+
+	qvvf additive[num_transforms];
+	qvv_extract_additive_aos(poses, reference, additive, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf expected = qvv_extract_additive(poses[transform_index], reference[transform_index]);
+		CHECK(quat_near_equal(additive[transform_index].rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(additive[transform_index].translation, expected.translation, threshold));
+		CHECK(vector_all_near_equal3(additive[transform_index].scale, expected.scale, threshold));
+		CHECK(quat_get_w(additive[transform_index].rotation) >= 0.0F);
+
+		// Applied with a weight of 1.0, the additive transform reproduces the pose
+		const qvvf pose = qvv_apply_additive(reference[transform_index], additive[transform_index], 1.0F);
+		CHECK(is_same_rotation(pose.rotation, poses[transform_index].rotation, threshold));
+		CHECK(vector_all_near_equal3(pose.translation, poses[transform_index].translation, threshold));
+		CHECK(vector_all_near_equal3(pose.scale, poses[transform_index].scale, threshold));
+	}
+
+	// Structure of arrays
+	float streams[3][10][num_transforms];
+	auto make_soa = [&](uint32_t index)
+	{
+		float (&components)[10][num_transforms] = streams[index];
+		return qvvf_soa{ float4f_soa{ components[0], components[1], components[2], components[3] }, float3f_soa{ components[4], components[5], components[6] }, float3f_soa{ components[7], components[8], components[9] } };
+	};
+
+	const qvvf_soa poses_soa = make_soa(0);
+	const qvvf_soa reference_soa = make_soa(1);
+	const qvvf_soa output_soa = make_soa(2);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const qvvf* transforms[2] = { &poses[transform_index], &reference[transform_index] };
+		for (uint32_t index = 0; index < 2; ++index)
+		{
+			const qvvf& transform = *transforms[index];
+			const qvvf_soa& soa = index == 0 ? poses_soa : reference_soa;
+			soa.rotation.x[transform_index] = quat_get_x(transform.rotation);
+			soa.rotation.y[transform_index] = quat_get_y(transform.rotation);
+			soa.rotation.z[transform_index] = quat_get_z(transform.rotation);
+			soa.rotation.w[transform_index] = quat_get_w(transform.rotation);
+			soa.translation.x[transform_index] = vector_get_x(transform.translation);
+			soa.translation.y[transform_index] = vector_get_y(transform.translation);
+			soa.translation.z[transform_index] = vector_get_z(transform.translation);
+			soa.scale.x[transform_index] = vector_get_x(transform.scale);
+			soa.scale.y[transform_index] = vector_get_y(transform.scale);
+			soa.scale.z[transform_index] = vector_get_z(transform.scale);
+		}
+	}
+
+	auto check_soa = [&](const qvvf_soa& soa, uint32_t transform_index, const qvvf& expected)
+	{
+		const quatf rotation = quat_set(soa.rotation.x[transform_index], soa.rotation.y[transform_index], soa.rotation.z[transform_index], soa.rotation.w[transform_index]);
+		CHECK(quat_near_equal(rotation, expected.rotation, threshold));
+		CHECK(vector_all_near_equal3(vector_set(soa.translation.x[transform_index], soa.translation.y[transform_index], soa.translation.z[transform_index]), expected.translation, threshold));
+		CHECK(vector_all_near_equal3(vector_set(soa.scale.x[transform_index], soa.scale.y[transform_index], soa.scale.z[transform_index]), expected.scale, threshold));
+	};
+
+	qvv_extract_additive_soa(poses_soa, reference_soa, output_soa, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		check_soa(output_soa, transform_index, additive[transform_index]);
+
+	qvv_apply_additive_soa(reference_soa, output_soa, 0.6F, output_soa, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		check_soa(output_soa, transform_index, qvv_apply_additive(reference[transform_index], additive[transform_index], 0.6F));
+
+	// In place
+	qvv_extract_additive_aos(poses, reference, poses, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		CHECK(quat_near_equal(poses[transform_index].rotation, additive[transform_index].rotation, threshold));
+
+	qvv_extract_additive_soa(poses_soa, reference_soa, poses_soa, num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		check_soa(poses_soa, transform_index, additive[transform_index]);
+}
+
+TEST_CASE("qvvf batch change detection", "[math][qvv][batch]")
+{
+	// Spans 3 output entries, the last one partially
+	constexpr uint32_t num_transforms = 70;
+
+	qvvf previous[num_transforms];
+	qvvf current[num_transforms];
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		previous[transform_index] = qvv_set(quat_from_euler(value * 0.1F, 0.5F, -value * 0.2F), vector_set(value, -value, 2.0F), vector_set(1.0F));
+		current[transform_index] = previous[transform_index];
+	}
+
+	uint32_t dirty_bits[3] = { 0xFFFFFFFFU, 0xFFFFFFFFU, 0xFFFFFFFFU };
+	CHECK(qvv_detect_changes_aos(current, previous, num_transforms, 1.0E-4F, 1.0E-3F, 1.0E-3F, dirty_bits) == 0);
+	CHECK(dirty_bits[0] == 0);
+	CHECK(dirty_bits[1] == 0);
+	CHECK(dirty_bits[2] == 0);
+
+	// Below the thresholds
+	current[3].translation = vector_add(current[3].translation, vector_set(0.0005F, 0.0F, 0.0F));
+	current[4].scale = vector_set(1.0F, 1.0F, 1.0005F);
+	CHECK(qvv_detect_changes_aos(current, previous, num_transforms, 1.0E-4F, 1.0E-3F, 1.0E-3F, dirty_bits) == 0);
+
+	// The [w] component of the translation and scale is ignored
+	current[5].translation = vector_set_w(current[5].translation, 100.0F);
+	current[6].scale = vector_set_w(current[6].scale, -100.0F);
+	CHECK(qvv_detect_changes_aos(current, previous, num_transforms, 1.0E-4F, 1.0E-3F, 1.0E-3F, dirty_bits) == 0);
+
+	// Above the thresholds, one of each component
+	current[0].rotation = quat_normalize(quat_mul(current[0].rotation, quat_from_euler(0.01F, 0.0F, 0.0F)));
+	current[33].translation = vector_add(current[33].translation, vector_set(0.0F, 0.0F, 0.01F));
+	current[69].scale = vector_set(1.0F, 1.01F, 1.0F);
+
+	// The same rotation in the other hemisphere
+	current[40].rotation = quat_neg(current[40].rotation);
+
+	CHECK(qvv_detect_changes_aos(current, previous, num_transforms, 1.0E-4F, 1.0E-3F, 1.0E-3F, dirty_bits) == 4);
+	CHECK(dirty_bits[0] == 0x00000001U);
+	CHECK(dirty_bits[1] == ((1U << (33 - 32)) | (1U << (40 - 32))));
+	CHECK(dirty_bits[2] == (1U << (69 - 64)));
+
+	// A NaN is never near equal
+	current[10].translation = vector_set(std::numeric_limits<float>::quiet_NaN(), 0.0F, 0.0F);
+	CHECK(qvv_detect_changes_aos(current, previous, num_transforms, 1.0E-4F, 1.0E-3F, 1.0E-3F, dirty_bits) == 5);
+	CHECK(dirty_bits[0] == (0x00000001U | (1U << 10)));
+}
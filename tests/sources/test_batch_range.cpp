@@ -0,0 +1,293 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/batch/range.h>
+#include <rtm/packing/quatf.h>
+#include <rtm/packing/vector4f.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+using namespace rtm;
+
+// Enough samples to cover the 4 wide loops and a partial group
+static constexpr uint32_t k_num_samples = 23;
+
+static void fill_track(float* x, float* y, float* z, float* w)
+{
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const float t = float(sample_index);
+		x[sample_index] = std::sin(t * 0.37F) * 12.5F + 3.0F;
+		y[sample_index] = std::cos(t * 0.71F) * 0.25F - 7.0F;
+		z[sample_index] = t * t * 0.01F - 1.0F;
+		w[sample_index] = 4.5F;	// A constant component has a zero extent
+	}
+
+	// The extremes are in the partial group
+	x[k_num_samples - 1] = 100.0F;
+	y[k_num_samples - 2] = -100.0F;
+}
+
+TEST_CASE("batch range compute", "[math][batch][range]")
+{
+	float x[k_num_samples];
+	float y[k_num_samples];
+	float z[k_num_samples];
+	float w[k_num_samples];
+	fill_track(x, y, z, w);
+
+	vector4f expected_min = vector_set(x[0], y[0], z[0], w[0]);
+	vector4f expected_max = expected_min;
+	for (uint32_t sample_index = 1; sample_index < k_num_samples; ++sample_index)
+	{
+		const vector4f sample = vector_set(x[sample_index], y[sample_index], z[sample_index], w[sample_index]);
+		expected_min = vector_min(expected_min, sample);
+		expected_max = vector_max(expected_max, sample);
+	}
+
+	for (uint32_t num_samples = 1; num_samples <= k_num_samples; num_samples += k_num_samples - 1)
+	{
+		vector4f range_min;
+		vector4f range_extent;
+		vector_range_soa(const_float4f_soa{ x, y, z, w }, num_samples, range_min, range_extent);
+
+		if (num_samples == 1)
+		{
+			CHECK(vector_all_near_equal(range_min, vector_set(x[0], y[0], z[0], w[0]), 0.0F));
+			CHECK(vector_all_near_equal(range_extent, vector_zero(), 0.0F));
+		}
+		else
+		{
+			CHECK(vector_all_near_equal(range_min, expected_min, 0.0F));
+			CHECK(vector_all_near_equal(range_extent, vector_sub(expected_max, expected_min), 0.0F));
+		}
+	}
+
+	{
+		vector4f range_min;
+		vector4f range_extent;
+		vector_range_soa(const_float3f_soa{ x, y, z }, k_num_samples, range_min, range_extent);
+		CHECK(vector_all_near_equal(range_min, vector_set_w(expected_min, 0.0F), 0.0F));
+		CHECK(vector_all_near_equal(range_extent, vector_set_w(vector_sub(expected_max, expected_min), 0.0F), 0.0F));
+	}
+}
+
+TEST_CASE("batch range normalize", "[math][batch][range]")
+{
+	float x[k_num_samples];
+	float y[k_num_samples];
+	float z[k_num_samples];
+	float w[k_num_samples];
+	fill_track(x, y, z, w);
+
+	vector4f range_min;
+	vector4f range_extent;
+	vector_range_soa(const_float4f_soa{ x, y, z, w }, k_num_samples, range_min, range_extent);
+
+	float normalized_x[k_num_samples];
+	float normalized_y[k_num_samples];
+	float normalized_z[k_num_samples];
+	float normalized_w[k_num_samples];
+	const float4f_soa normalized = { normalized_x, normalized_y, normalized_z, normalized_w };
+	vector_range_reduce_soa(const_float4f_soa{ x, y, z, w }, range_min, range_extent, normalized, k_num_samples);
+
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const vector4f sample = vector_set(x[sample_index], y[sample_index], z[sample_index], w[sample_index]);
+		// Compare the stored bits, an arithmetic comparison can be contracted into an FMA
+		float expected[4];
+		vector_store(vector_range_reduce(sample, range_min, range_extent), &expected[0]);
+
+		const float actual[4] = { normalized_x[sample_index], normalized_y[sample_index], normalized_z[sample_index], normalized_w[sample_index] };
+		CHECK(std::memcmp(&actual[0], &expected[0], sizeof(expected)) == 0);
+	}
+
+	// In place
+	float expanded_x[k_num_samples];
+	float expanded_y[k_num_samples];
+	float expanded_z[k_num_samples];
+	float expanded_w[k_num_samples];
+	const float4f_soa expanded = { expanded_x, expanded_y, expanded_z, expanded_w };
+	vector_range_expand_soa(normalized, range_min, range_extent, expanded, k_num_samples);
+	vector_range_expand_soa(normalized, range_min, range_extent, normalized, k_num_samples);
+
+	const float threshold = 1.0E-4F;
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		CHECK(expanded_x[sample_index] == normalized_x[sample_index]);
+		CHECK(expanded_w[sample_index] == normalized_w[sample_index]);
+		CHECK(scalar_near_equal(expanded_x[sample_index], x[sample_index], threshold));
+		CHECK(scalar_near_equal(expanded_y[sample_index], y[sample_index], threshold));
+		CHECK(scalar_near_equal(expanded_z[sample_index], z[sample_index], threshold));
+		CHECK(expanded_w[sample_index] == w[sample_index]);
+	}
+
+	// Vector3 tracks leave the [w] stream alone
+	vector_range_reduce_soa(const_float3f_soa{ x, y, z }, range_min, range_extent, float3f_soa{ normalized_x, normalized_y, normalized_z }, k_num_samples);
+	vector_range_expand_soa(const_float3f_soa{ normalized_x, normalized_y, normalized_z }, range_min, range_extent, float3f_soa{ expanded_x, expanded_y, expanded_z }, k_num_samples);
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		CHECK(normalized_x[sample_index] >= 0.0F);
+		CHECK(normalized_x[sample_index] <= 1.0F);
+		CHECK(scalar_near_equal(expanded_y[sample_index], y[sample_index], threshold));
+		CHECK(scalar_near_equal(expanded_z[sample_index], z[sample_index], threshold));
+	}
+}
+
+TEST_CASE("batch range quantization", "[math][batch][range]")
+{
+	float x[k_num_samples];
+	float y[k_num_samples];
+	float z[k_num_samples];
+	float w[k_num_samples];
+	fill_track(x, y, z, w);
+
+	vector4f range_min;
+	vector4f range_extent;
+	vector_range_soa(const_float4f_soa{ x, y, z, w }, k_num_samples, range_min, range_extent);
+
+	uint16_t quantized_x[k_num_samples];
+	uint16_t quantized_y[k_num_samples];
+	uint16_t quantized_z[k_num_samples];
+	uint16_t quantized_w[k_num_samples];
+	const quantized4_soa quantized = { quantized_x, quantized_y, quantized_z, quantized_w };
+
+	float dequantized_x[k_num_samples];
+	float dequantized_y[k_num_samples];
+	float dequantized_z[k_num_samples];
+	float dequantized_w[k_num_samples];
+	const float4f_soa dequantized = { dequantized_x, dequantized_y, dequantized_z, dequantized_w };
+
+	const uint32_t bit_rates[] = { 1, 5, 8, 12, 16 };
+	for (uint32_t num_bits : bit_rates)
+	{
+		const uint32_t max_value = (1U << num_bits) - 1;
+
+		pack_range_reduce_unorm_soa(const_float4f_soa{ x, y, z, w }, range_min, range_extent, num_bits, quantized, k_num_samples);
+		unpack_range_expand_unorm_soa(quantized, num_bits, range_min, range_extent, dequantized, k_num_samples);
+
+		// Half a quantization step plus some slack for the float arithmetic
+		const vector4f threshold = vector_add(vector_mul(range_extent, 0.5F / float(max_value)), vector_set(1.0E-4F));
+
+		for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+		{
+			CHECK(quantized_x[sample_index] <= max_value);
+			CHECK(quantized_y[sample_index] <= max_value);
+			CHECK(quantized_z[sample_index] <= max_value);
+			CHECK(quantized_w[sample_index] == 0);
+
+			const vector4f sample = vector_set(x[sample_index], y[sample_index], z[sample_index], w[sample_index]);
+			const vector4f result = vector_set(dequantized_x[sample_index], dequantized_y[sample_index], dequantized_z[sample_index], dequantized_w[sample_index]);
+			CHECK(vector_all_less_equal(vector_abs(vector_sub(result, sample)), threshold));
+
+			if (num_bits == 16)
+			{
+				// Matches the range reduced 16 bit packing
+				const uint64_t packed = pack_vector4_unorm16(vector_range_reduce(sample, range_min, range_extent));
+				CHECK(uint16_t(packed) == quantized_x[sample_index]);
+				CHECK(uint16_t(packed >> 16) == quantized_y[sample_index]);
+				CHECK(uint16_t(packed >> 32) == quantized_z[sample_index]);
+				CHECK(uint16_t(packed >> 48) == quantized_w[sample_index]);
+			}
+		}
+
+		// The extremes are exact
+		CHECK(quantized_x[k_num_samples - 1] == max_value);
+		CHECK(quantized_y[k_num_samples - 2] == 0);
+	}
+
+	// Vector3 tracks do not touch the [w] stream
+	const quantized4_soa quantized3 = { quantized_x, quantized_y, quantized_z, nullptr };
+	pack_range_reduce_unorm_soa(const_float3f_soa{ x, y, z }, range_min, range_extent, 16, quantized3, k_num_samples);
+	unpack_range_expand_unorm_soa(quantized3, 16, range_min, range_extent, float3f_soa{ dequantized_x, dequantized_y, dequantized_z }, k_num_samples);
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		CHECK(scalar_near_equal(dequantized_x[sample_index], x[sample_index], 2.0E-3F));
+		CHECK(scalar_near_equal(dequantized_y[sample_index], y[sample_index], 2.0E-3F));
+		CHECK(scalar_near_equal(dequantized_z[sample_index], z[sample_index], 2.0E-3F));
+	}
+}
+
+TEST_CASE("batch range rotation dequantization", "[math][batch][range]")
+{
+	// A rotation track with a positive [w] component, only [xyz] are stored
+	float x[k_num_samples];
+	float y[k_num_samples];
+	float z[k_num_samples];
+	float w[k_num_samples];
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const float t = float(sample_index);
+		const quatf rotation = quat_normalize(quat_set(std::sin(t * 0.37F) * 0.6F, std::cos(t * 0.71F) * 0.3F, t * 0.02F - 0.2F, 1.0F));
+		x[sample_index] = quat_get_x(rotation);
+		y[sample_index] = quat_get_y(rotation);
+		z[sample_index] = quat_get_z(rotation);
+		w[sample_index] = quat_get_w(rotation);
+	}
+
+	vector4f range_min;
+	vector4f range_extent;
+	vector_range_soa(const_float3f_soa{ x, y, z }, k_num_samples, range_min, range_extent);
+
+	uint16_t quantized_x[k_num_samples];
+	uint16_t quantized_y[k_num_samples];
+	uint16_t quantized_z[k_num_samples];
+	const quantized4_soa quantized = { quantized_x, quantized_y, quantized_z, nullptr };
+
+	float rotations_x[k_num_samples];
+	float rotations_y[k_num_samples];
+	float rotations_z[k_num_samples];
+	float rotations_w[k_num_samples];
+
+	float dequantized_x[k_num_samples];
+	float dequantized_y[k_num_samples];
+	float dequantized_z[k_num_samples];
+
+	const uint32_t bit_rates[] = { 8, 12, 16 };
+	for (uint32_t num_bits : bit_rates)
+	{
+		pack_range_reduce_unorm_soa(const_float3f_soa{ x, y, z }, range_min, range_extent, num_bits, quantized, k_num_samples);
+		unpack_range_expand_quat_unorm_soa(quantized, num_bits, range_min, range_extent, float4f_soa{ rotations_x, rotations_y, rotations_z, rotations_w }, k_num_samples);
+
+		// Same result as the separate passes
+		unpack_range_expand_unorm_soa(quantized, num_bits, range_min, range_extent, float3f_soa{ dequantized_x, dequantized_y, dequantized_z }, k_num_samples);
+
+		const float threshold = num_bits == 8 ? 1.0E-2F : 1.0E-3F;
+		for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+		{
+			const quatf expected = quat_from_positive_w(vector_set(dequantized_x[sample_index], dequantized_y[sample_index], dequantized_z[sample_index], 0.0F));
+			const quatf result = quat_set(rotations_x[sample_index], rotations_y[sample_index], rotations_z[sample_index], rotations_w[sample_index]);
+			CHECK(quat_near_equal(result, expected, 1.0E-6F));
+			CHECK(rotations_w[sample_index] >= 0.0F);
+
+			const quatf original = quat_set(x[sample_index], y[sample_index], z[sample_index], w[sample_index]);
+			CHECK(quat_near_equal(result, original, threshold));
+		}
+	}
+}
@@ -0,0 +1,166 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/rayf.h>
+
+#include <limits>
+
+using namespace rtm;
+
+static bool is_bit_set(const uint32_t* bits, uint32_t bit_index)
+{
+	return (bits[bit_index / 32] & (1U << (bit_index % 32))) != 0;
+}
+
+TEST_CASE("rayf batch intersection", "[math][ray][batch]")
+{
+	const float threshold = 1.0E-5F;
+	const float infinity = std::numeric_limits<float>::infinity();
+
+	// Not a multiple of 4 to exercise the partial group
+	constexpr uint32_t num_primitives = 7;
+
+	// Primitives along +X, the ray starts at the origin and looks down +X
+	const float center_x[num_primitives] = { 5.0F, 10.0F, -5.0F, 20.0F, 0.0F, 8.0F, 30.0F };
+	const float center_y[num_primitives] = { 0.0F, 3.0F, 0.0F, 0.5F, 0.0F, -1.0F, 0.0F };
+	const float center_z[num_primitives] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+	const float radii[num_primitives] = { 1.0F, 1.0F, 1.0F, 1.0F, 2.0F, 1.0F, 0.5F };
+	const const_float3f_soa centers{ center_x, center_y, center_z };
+
+	const vector4f origin = vector_set(0.0F, 0.0F, 0.0F);
+	const vector4f direction = vector_set(1.0F, 0.0F, 0.0F);
+
+	{
+		float distances[num_primitives];
+		uint32_t hit_bits[1] = { ~0U };
+		ray_intersect_spheres_soa(origin, direction, centers, radii, distances, hit_bits, num_primitives);
+
+		// Hit, miss to the side, behind, off center hit, origin inside, tangent, far hit
+		CHECK(hit_bits[0] == 0x79U);
+		CHECK(scalar_near_equal(distances[0], 4.0F, threshold));
+		CHECK(distances[1] == infinity);
+		CHECK(distances[2] == infinity);
+		CHECK(scalar_near_equal(distances[3], 20.0F - scalar_sqrt(0.75F), threshold));
+		CHECK(distances[4] == 0.0F);
+		CHECK(scalar_near_equal(distances[5], 8.0F, 1.0E-3F));
+		CHECK(scalar_near_equal(distances[6], 29.5F, threshold));
+	}
+
+	{
+		// A direction that is not normalized returns the ray parameter
+		float distances[num_primitives];
+		uint32_t hit_bits[1];
+		ray_intersect_spheres_soa(origin, vector_set(2.0F, 0.0F, 0.0F), centers, radii, distances, hit_bits, num_primitives);
+		CHECK(scalar_near_equal(distances[0], 2.0F, threshold));
+	}
+
+	{
+		float distances[num_primitives];
+		uint32_t hit_bits[1] = { ~0U };
+		const float extents[num_primitives] = { 1.0F, 1.0F, 1.0F, 1.0F, 2.0F, 1.5F, 0.5F };
+		ray_intersect_aabbs_soa(origin, direction, centers, const_float3f_soa{ extents, extents, extents }, distances, hit_bits, num_primitives);
+
+		CHECK(hit_bits[0] == 0x79U);
+		CHECK(scalar_near_equal(distances[0], 4.0F, threshold));
+		CHECK(distances[1] == infinity);
+		CHECK(distances[2] == infinity);
+		CHECK(scalar_near_equal(distances[3], 19.0F, threshold));
+		CHECK(distances[4] == 0.0F);
+		CHECK(scalar_near_equal(distances[5], 6.5F, threshold));
+		CHECK(scalar_near_equal(distances[6], 29.5F, threshold));
+	}
+
+	{
+		// Planes facing either way, behind, and parallel
+		const float normal_x[5] = { 1.0F, -1.0F, 1.0F, 0.0F, 0.6F };
+		const float normal_y[5] = { 0.0F, 0.0F, 0.0F, 1.0F, 0.8F };
+		const float normal_z[5] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+		const float plane_w[5] = { -3.0F, 6.0F, 2.0F, -1.0F, -3.0F };
+
+		float distances[5];
+		uint32_t hit_bits[1] = { ~0U };
+		ray_intersect_planes_soa(origin, direction, const_float4f_soa{ normal_x, normal_y, normal_z, plane_w }, distances, hit_bits, 5);
+
+		CHECK(hit_bits[0] == 0x13U);
+		CHECK(scalar_near_equal(distances[0], 3.0F, threshold));
+		CHECK(scalar_near_equal(distances[1], 6.0F, threshold));
+		CHECK(distances[2] == infinity);
+		CHECK(distances[3] == infinity);
+		CHECK(scalar_near_equal(distances[4], 5.0F, threshold));
+	}
+
+	{
+		// 4 rays must match 4 single ray queries
+		const float origin_x[4] = { 0.0F, 1.0F, -2.0F, 10.0F };
+		const float origin_y[4] = { 0.0F, 0.5F, 3.0F, -2.0F };
+		const float origin_z[4] = { 0.0F, -1.0F, 0.0F, 0.5F };
+		const float direction_x[4] = { 1.0F, 0.8F, 0.0F, -1.0F };
+		const float direction_y[4] = { 0.0F, 0.6F, -1.0F, 0.5F };
+		const float direction_z[4] = { 0.0F, 0.0F, 0.0F, 0.25F };
+		const const_float3f_soa origins{ origin_x, origin_y, origin_z };
+		const const_float3f_soa directions{ direction_x, direction_y, direction_z };
+		const const_float3f_soa radii_extents{ radii, radii, radii };
+		const const_float4f_soa planes{ center_y, center_x, center_z, radii };
+
+		float distances4[num_primitives * 4];
+		uint32_t hit_bits4[1];
+		float distances[num_primitives];
+		uint32_t hit_bits[1];
+
+		for (uint32_t primitive_type = 0; primitive_type < 3; ++primitive_type)
+		{
+			if (primitive_type == 0)
+				ray_intersect_spheres_soa(origins, directions, centers, radii, distances4, hit_bits4, num_primitives);
+			else if (primitive_type == 1)
+				ray_intersect_aabbs_soa(origins, directions, centers, radii_extents, distances4, hit_bits4, num_primitives);
+			else
+				ray_intersect_planes_soa(origins, directions, planes, distances4, hit_bits4, num_primitives);
+
+			for (uint32_t ray_index = 0; ray_index < 4; ++ray_index)
+			{
+				const vector4f ray_origin = vector_set(origin_x[ray_index], origin_y[ray_index], origin_z[ray_index]);
+				const vector4f ray_direction = vector_set(direction_x[ray_index], direction_y[ray_index], direction_z[ray_index]);
+
+				if (primitive_type == 0)
+					ray_intersect_spheres_soa(ray_origin, ray_direction, centers, radii, distances, hit_bits, num_primitives);
+				else if (primitive_type == 1)
+					ray_intersect_aabbs_soa(ray_origin, ray_direction, centers, radii_extents, distances, hit_bits, num_primitives);
+				else
+					ray_intersect_planes_soa(ray_origin, ray_direction, planes, distances, hit_bits, num_primitives);
+
+				for (uint32_t primitive_index = 0; primitive_index < num_primitives; ++primitive_index)
+				{
+					const uint32_t bit_index = primitive_index * 4 + ray_index;
+					CHECK(is_bit_set(hit_bits4, bit_index) == is_bit_set(hit_bits, primitive_index));
+					CHECK(distances4[bit_index] == distances[primitive_index]);
+				}
+			}
+		}
+	}
+}
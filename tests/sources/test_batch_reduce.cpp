@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <catch.hpp>
+
+#include <rtm/batch/reduce.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+// Covers the empty, partial group, 4 wide, 32 wide, and pairwise block cases
+static const uint32_t k_reduce_counts[] = { 1, 3, 4, 7, 31, 32, 33, 100, 1024, 2500 };
+
+static std::vector<float> make_reduce_values(uint32_t num_values, float offset)
+{
+	std::vector<float> values(num_values);
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		values[value_index] = scalar_sin(float(value_index) * 0.37F + offset) * (1.0F + float(value_index % 7));
+
+	return values;
+}
+
+TEST_CASE("batch reduce float arrays", "[math][batch][reduce]")
+{
+	CHECK(scalar_sum_array(nullptr, 0) == 0.0F);
+	CHECK(scalar_dot_array(nullptr, nullptr, 0) == 0.0F);
+
+	for (uint32_t num_values : k_reduce_counts)
+	{
+		const std::vector<float> values = make_reduce_values(num_values, 0.0F);
+		const std::vector<float> other_values = make_reduce_values(num_values, 1.5F);
+
+		double ref_sum = 0.0;
+		double ref_dot = 0.0;
+		double ref_sum_squares = 0.0;
+		double ref_abs_sum = 0.0;
+		uint32_t ref_argmin = 0;
+		uint32_t ref_argmax = 0;
+		for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		{
+			const double value = double(values[value_index]);
+			ref_sum += value;
+			ref_dot += value * double(other_values[value_index]);
+			ref_sum_squares += value * value;
+			ref_abs_sum += scalar_abs(value);
+
+			if (values[value_index] < values[ref_argmin])
+				ref_argmin = value_index;
+			if (values[value_index] > values[ref_argmax])
+				ref_argmax = value_index;
+		}
+
+		const float threshold = float(ref_abs_sum) * 1.0E-5F + 1.0E-6F;
+		CHECK(scalar_near_equal(scalar_sum_array(values.data(), num_values), float(ref_sum), threshold));
+		CHECK(scalar_near_equal(scalar_sum_array(values.data(), num_values, summation_precision::pairwise), float(ref_sum), threshold));
+		CHECK(scalar_near_equal(scalar_sum_array(values.data(), num_values, summation_precision::compensated), float(ref_sum), threshold));
+		CHECK(scalar_near_equal(scalar_dot_array(values.data(), other_values.data(), num_values), float(ref_dot), float(ref_sum_squares) * 1.0E-5F + 1.0E-6F));
+		CHECK(scalar_near_equal(scalar_sum_squares_array(values.data(), num_values), float(ref_sum_squares), float(ref_sum_squares) * 1.0E-5F + 1.0E-6F));
+
+		CHECK(scalar_min_array(values.data(), num_values) == values[ref_argmin]);
+		CHECK(scalar_max_array(values.data(), num_values) == values[ref_argmax]);
+		CHECK(scalar_argmin_array(values.data(), num_values) == ref_argmin);
+		CHECK(scalar_argmax_array(values.data(), num_values) == ref_argmax);
+	}
+
+	{
+		// Ties return the first index
+		const float values[9] = { 3.0F, -1.0F, 5.0F, -1.0F, 5.0F, 0.0F, 0.0F, -1.0F, 5.0F };
+		CHECK(scalar_argmin_array(&values[0], 9) == 1);
+		CHECK(scalar_argmax_array(&values[0], 9) == 2);
+		CHECK(scalar_argmin_array(&values[2], 7) == 1);
+		CHECK(scalar_argmax_array(&values[5], 4) == 3);
+	}
+
+	{
+		// Many small values after a large one are lost without compensation
+		std::vector<float> values(4001, 1.0E-4F);
+		values[0] = 1.0E4F;
+
+		const float expected = 1.0E4F + 4000.0F * 1.0E-4F;
+		CHECK(scalar_near_equal(scalar_sum_array(values.data(), 4001, summation_precision::compensated), expected, 1.0E-3F));
+	}
+}
+
+TEST_CASE("batch reduce vector4 arrays", "[math][batch][reduce]")
+{
+	CHECK(vector_all_near_equal(vector_sum_array(nullptr, 0), vector_zero(), 0.0F));
+
+	for (uint32_t num_vectors : k_reduce_counts)
+	{
+		const std::vector<float> values = make_reduce_values(num_vectors * 4, 0.0F);
+		static vector4f vectors[2500];	// Large enough for the largest count
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			vectors[vector_index] = vector_load(&values[vector_index * 4]);
+
+		double ref_sum[4] = { 0.0, 0.0, 0.0, 0.0 };
+		double ref_sum_squares[4] = { 0.0, 0.0, 0.0, 0.0 };
+		float ref_min[4] = { values[0], values[1], values[2], values[3] };
+		float ref_max[4] = { values[0], values[1], values[2], values[3] };
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		{
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			{
+				const float value = values[vector_index * 4 + component_index];
+				ref_sum[component_index] += double(value);
+				ref_sum_squares[component_index] += double(value) * double(value);
+				ref_min[component_index] = scalar_min(ref_min[component_index], value);
+				ref_max[component_index] = scalar_max(ref_max[component_index], value);
+			}
+		}
+
+		const vector4f expected_sum = vector_set(float(ref_sum[0]), float(ref_sum[1]), float(ref_sum[2]), float(ref_sum[3]));
+		const vector4f expected_sum_squares = vector_set(float(ref_sum_squares[0]), float(ref_sum_squares[1]), float(ref_sum_squares[2]), float(ref_sum_squares[3]));
+		const float threshold = float(num_vectors) * 1.0E-4F;
+
+		CHECK(vector_all_near_equal(vector_sum_array(&vectors[0], num_vectors), expected_sum, threshold));
+		CHECK(vector_all_near_equal(vector_sum_array(&vectors[0], num_vectors, summation_precision::pairwise), expected_sum, threshold));
+		CHECK(vector_all_near_equal(vector_sum_array(&vectors[0], num_vectors, summation_precision::compensated), expected_sum, threshold));
+		CHECK(vector_all_near_equal(vector_sum_squares_array(&vectors[0], num_vectors), expected_sum_squares, threshold * 10.0F));
+		CHECK(vector_all_near_equal(vector_min_array(&vectors[0], num_vectors), vector_load(&ref_min[0]), 0.0F));
+		CHECK(vector_all_near_equal(vector_max_array(&vectors[0], num_vectors), vector_load(&ref_max[0]), 0.0F));
+	}
+}
+
+TEST_CASE("batch reduce soa", "[math][batch][reduce]")
+{
+	for (uint32_t num_vectors : k_reduce_counts)
+	{
+		const std::vector<float> x = make_reduce_values(num_vectors, 0.0F);
+		const std::vector<float> y = make_reduce_values(num_vectors, 1.0F);
+		const std::vector<float> z = make_reduce_values(num_vectors, 2.0F);
+		const std::vector<float> w = make_reduce_values(num_vectors, 3.0F);
+		const const_float3f_soa input3 = { x.data(), y.data(), z.data() };
+		const const_float4f_soa input4 = { x.data(), y.data(), z.data(), w.data() };
+		const const_float3f_soa other3 = { w.data(), z.data(), x.data() };
+
+		const vector4f sum4 = vector_set(scalar_sum_array(x.data(), num_vectors), scalar_sum_array(y.data(), num_vectors), scalar_sum_array(z.data(), num_vectors), scalar_sum_array(w.data(), num_vectors));
+		const vector4f min4 = vector_set(scalar_min_array(x.data(), num_vectors), scalar_min_array(y.data(), num_vectors), scalar_min_array(z.data(), num_vectors), scalar_min_array(w.data(), num_vectors));
+		const vector4f max4 = vector_set(scalar_max_array(x.data(), num_vectors), scalar_max_array(y.data(), num_vectors), scalar_max_array(z.data(), num_vectors), scalar_max_array(w.data(), num_vectors));
+
+		// The SoA variants reduce each stream like the float array functions
+		CHECK(vector_all_near_equal(vector_sum_soa(input4, num_vectors), sum4, 0.0F));
+		CHECK(vector_all_near_equal(vector_sum_soa(input3, num_vectors), vector_set_w(sum4, 0.0F), 0.0F));
+		CHECK(vector_all_near_equal(vector_sum_soa(input4, num_vectors, summation_precision::compensated), sum4, float(num_vectors) * 1.0E-4F));
+		CHECK(vector_all_near_equal(vector_min_soa(input4, num_vectors), min4, 0.0F));
+		CHECK(vector_all_near_equal(vector_min_soa(input3, num_vectors), vector_set_w(min4, 0.0F), 0.0F));
+		CHECK(vector_all_near_equal(vector_max_soa(input4, num_vectors), max4, 0.0F));
+		CHECK(vector_all_near_equal(vector_max_soa(input3, num_vectors), vector_set_w(max4, 0.0F), 0.0F));
+
+		double ref_dot = 0.0;
+		double ref_sum_squares = 0.0;
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		{
+			ref_dot += double(x[vector_index]) * double(w[vector_index]) + double(y[vector_index]) * double(z[vector_index]) + double(z[vector_index]) * double(x[vector_index]);
+			ref_sum_squares += double(x[vector_index]) * double(x[vector_index]) + double(y[vector_index]) * double(y[vector_index]) + double(z[vector_index]) * double(z[vector_index]);
+		}
+
+		CHECK(scalar_near_equal(vector_dot3_soa(input3, other3, num_vectors), float(ref_dot), float(ref_sum_squares) * 1.0E-5F + 1.0E-6F));
+		CHECK(scalar_near_equal(vector_sum_squares3_soa(input3, num_vectors), float(ref_sum_squares), float(ref_sum_squares) * 1.0E-5F + 1.0E-6F));
+	}
+}
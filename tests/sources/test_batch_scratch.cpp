@@ -0,0 +1,152 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/scratch.h>
+#include <rtm/impl/memory_utils.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+TEST_CASE("scratch arena", "[core][memory][batch]")
+{
+	alignas(64) uint8_t buffer[1024];
+
+	{
+		// Start at an odd address to make sure the allocations are aligned regardless
+		scratch_arena arena(buffer + 1, sizeof(buffer) - 1);
+		CHECK(arena.get_capacity() == sizeof(buffer) - 1);
+		CHECK(arena.get_used_size() == 0);
+
+		void* allocation = arena.allocate(10);
+		CHECK(allocation == buffer + 64);
+		CHECK(arena.get_used_size() == 63 + 10);
+
+		float* floats16 = arena.allocate_array<float>(3, 16);
+		CHECK(floats16 == reinterpret_cast<float*>(buffer + 80));
+
+		qvvf* transforms = arena.allocate_array<qvvf>(4, 32);
+		CHECK(rtm_impl::is_aligned_to(transforms, 32));
+		CHECK(transforms == reinterpret_cast<qvvf*>(buffer + 96));
+
+		const size_t marker = arena.get_marker();
+		const float4f_soa streams = arena.allocate_soa4(5);
+		CHECK(streams.x == reinterpret_cast<float*>(buffer + 320));
+		CHECK(streams.y == streams.x + 16);
+		CHECK(streams.z == streams.x + 32);
+		CHECK(streams.w == streams.x + 48);
+
+		// Everything after the marker is released
+		arena.rewind(marker);
+		const float3f_soa streams3 = arena.allocate_soa3(17, 16);
+		CHECK(streams3.x == reinterpret_cast<float*>(buffer + 288));
+		CHECK(streams3.y == streams3.x + 20);
+		CHECK(streams3.z == streams3.x + 40);
+
+		// Full, nothing is allocated
+		const size_t used_size = arena.get_used_size();
+		CHECK(arena.allocate(1024) == nullptr);
+		CHECK(arena.allocate_soa4(64).x == nullptr);
+		CHECK(arena.allocate_soa4(64).w == nullptr);
+		CHECK(arena.get_used_size() == used_size);
+
+		// The rest of the buffer is still available
+		CHECK(arena.allocate(sizeof(buffer) - 1 - used_size, 1) != nullptr);
+		CHECK(arena.allocate(1, 1) == nullptr);
+		CHECK(arena.get_peak_size() == sizeof(buffer) - 1);
+
+		arena.reset();
+		CHECK(arena.get_used_size() == 0);
+		CHECK(arena.allocate(10) == buffer + 64);
+		CHECK(arena.get_peak_size() == sizeof(buffer) - 1);
+	}
+
+	{
+		scratch_arena arena(nullptr, 0);
+		CHECK(arena.allocate(1, 1) == nullptr);
+	}
+}
+
+TEST_CASE("scratch block pool", "[core][memory][batch]")
+{
+	alignas(64) uint8_t buffer[1024];
+
+	{
+		// The first block starts on the alignment and blocks are rounded up to it
+		scratch_block_pool pool(buffer + 1, sizeof(buffer) - 1, 100);
+		CHECK(pool.get_block_size() == 128);
+		CHECK(pool.get_num_blocks() == 7);
+		CHECK(pool.get_num_free_blocks() == 7);
+
+		void* blocks[7];
+		for (uint32_t block_index = 0; block_index < 7; ++block_index)
+		{
+			blocks[block_index] = pool.allocate();
+			CHECK(blocks[block_index] == buffer + 64 + block_index * 128);
+			CHECK(pool.owns(blocks[block_index]));
+		}
+
+		CHECK(pool.get_num_free_blocks() == 0);
+		CHECK(pool.allocate() == nullptr);
+		CHECK(!pool.owns(buffer + 65));
+		CHECK(!pool.owns(buffer));
+
+		// Freed blocks are reused
+		pool.free(blocks[2]);
+		pool.free(blocks[5]);
+		CHECK(pool.get_num_free_blocks() == 2);
+		CHECK(pool.allocate() == blocks[5]);
+		CHECK(pool.allocate() == blocks[2]);
+		CHECK(pool.allocate() == nullptr);
+
+		pool.reset();
+		CHECK(pool.get_num_free_blocks() == 7);
+		for (uint32_t block_index = 0; block_index < 7; ++block_index)
+			CHECK(pool.allocate() == blocks[block_index]);
+	}
+
+	{
+		// Small blocks must hold a pointer
+		scratch_block_pool pool(buffer, sizeof(buffer), 1, 8);
+		CHECK(pool.get_block_size() == 8);
+		CHECK(pool.get_num_blocks() == 128);
+
+		void* block0 = pool.allocate();
+		void* block1 = pool.allocate();
+		pool.free(block0);
+		pool.free(block1);
+		CHECK(pool.allocate() == block1);
+		CHECK(pool.allocate() == block0);
+	}
+
+	{
+		scratch_block_pool pool(buffer, 32, 64);
+		CHECK(pool.get_num_blocks() == 0);
+		CHECK(pool.allocate() == nullptr);
+	}
+}
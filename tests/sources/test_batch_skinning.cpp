@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/batch/skinning.h>
+
+#include <cstring>
+
+using namespace rtm;
+
+namespace
+{
+	// An interleaved vertex as found in a vertex buffer
+	struct skinned_vertex
+	{
+		float3f position;
+		float3f normal;
+		float4f tangent;
+	};
+
+	constexpr uint32_t k_num_bones = 7;
+	constexpr uint32_t k_num_vertices = 37;
+
+	struct skinning_test_data
+	{
+		matrix3x4f palette[k_num_bones];
+		uint32_t bone_indices[k_num_vertices * 4];
+		float bone_weights[k_num_vertices * 4];
+		skinned_vertex vertices[k_num_vertices];
+
+		skinning_test_data()
+		{
+			for (uint32_t bone_index = 0; bone_index < k_num_bones; ++bone_index)
+			{
+				const float angle = float(bone_index) * 0.37F;
+				palette[bone_index] = matrix_from_qvv(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, -1.0F, 2.0F * angle), vector_set(1.0F, 1.5F, 0.5F + angle));
+			}
+
+			for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+			{
+				const float angle = float(vertex_index) * 0.21F;
+
+				// Every third vertex has a single influence, the others use 2 to 4
+				const uint32_t num_influences = vertex_index % 3 == 0 ? 1 : (2 + vertex_index % 3);
+				float weight_sum = 0.0F;
+				for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+				{
+					const float weight = influence_index < num_influences ? float(influence_index + vertex_index % 5 + 1) : 0.0F;
+					bone_indices[vertex_index * 4 + influence_index] = (vertex_index * 5 + influence_index * 3) % k_num_bones;
+					bone_weights[vertex_index * 4 + influence_index] = weight;
+					weight_sum += weight;
+				}
+
+				for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+					bone_weights[vertex_index * 4 + influence_index] /= weight_sum;
+
+				vertices[vertex_index].position = float3f{ angle, 1.0F - angle, 2.0F };
+				vector_store3(vector_normalize3(vector_set(1.0F, angle, -0.5F)), &vertices[vertex_index].normal);
+				const vector4f tangent = vector_normalize3(vector_set(-angle, 0.25F, 1.0F));
+				vector_store(vector_set(vector_get_x(tangent), vector_get_y(tangent), vector_get_z(tangent), vertex_index % 2 == 0 ? 1.0F : -1.0F), &vertices[vertex_index].tangent);
+			}
+		}
+
+		// The skinned position and normal, blended one influence at a time
+		vector4f skin_position(uint32_t vertex_index) const
+		{
+			const vector4f position = vector_load3(&vertices[vertex_index].position);
+			vector4f result = vector_zero();
+			for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+				result = vector_mul_add(matrix_mul_point3(position, palette[bone_indices[vertex_index * 4 + influence_index]]), bone_weights[vertex_index * 4 + influence_index], result);
+			return result;
+		}
+
+		vector4f skin_direction(vector4f_arg0 direction, uint32_t vertex_index) const
+		{
+			vector4f result = vector_zero();
+			for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+				result = vector_mul_add(matrix_mul_vector3(direction, palette[bone_indices[vertex_index * 4 + influence_index]]), bone_weights[vertex_index * 4 + influence_index], result);
+			return vector_normalize3(result);
+		}
+	};
+}
+
+TEST_CASE("skinning batch aos", "[math][matrix3x4][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	const skinning_test_data data;
+
+	// Interleaved input, separate output streams
+	const const_skin_vertex_streams input = { &data.vertices[0].position, &data.vertices[0].normal, &data.vertices[0].tangent, sizeof(skinned_vertex), sizeof(skinned_vertex), sizeof(skinned_vertex) };
+
+	float3f positions[k_num_vertices];
+	float3f normals[k_num_vertices];
+	float4f tangents[k_num_vertices];
+	const skin_vertex_streams output = { positions, normals, tangents, sizeof(float3f), sizeof(float3f), sizeof(float4f) };
+
+	matrix_skin_aos(data.palette, data.bone_indices, data.bone_weights, input, output, k_num_vertices);
+	for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+	{
+		const vector4f tangent = vector_load(&data.vertices[vertex_index].tangent);
+
+		CHECK(vector_all_near_equal3(vector_load3(positions + vertex_index), data.skin_position(vertex_index), threshold));
+		CHECK(vector_all_near_equal3(vector_load3(normals + vertex_index), data.skin_direction(vector_load3(&data.vertices[vertex_index].normal), vertex_index), threshold));
+		CHECK(vector_all_near_equal3(vector_load(tangents + vertex_index), data.skin_direction(tangent, vertex_index), threshold));
+		CHECK(tangents[vertex_index].w == vector_get_w(tangent));
+	}
+
+	// In place over the interleaved vertices, positions only
+	skinned_vertex vertices[k_num_vertices];
+	std::memcpy(vertices, data.vertices, sizeof(vertices));
+
+	const skin_vertex_streams in_place = { &vertices[0].position, nullptr, nullptr, sizeof(skinned_vertex), 0, 0 };
+	matrix_skin_aos(data.palette, data.bone_indices, data.bone_weights, in_place, in_place, k_num_vertices);
+	for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+	{
+		CHECK(vector_all_near_equal3(vector_load3(&vertices[vertex_index].position), vector_load3(positions + vertex_index), 0.0F));
+		CHECK(vector_all_near_equal3(vector_load3(&vertices[vertex_index].normal), vector_load3(&data.vertices[vertex_index].normal), 0.0F));
+	}
+}
+
+TEST_CASE("skinning batch soa", "[math][matrix3x4][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	const skinning_test_data data;
+
+	float input[10][k_num_vertices];
+	for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+	{
+		const skinned_vertex& vertex = data.vertices[vertex_index];
+		input[0][vertex_index] = vertex.position.x;
+		input[1][vertex_index] = vertex.position.y;
+		input[2][vertex_index] = vertex.position.z;
+		input[3][vertex_index] = vertex.normal.x;
+		input[4][vertex_index] = vertex.normal.y;
+		input[5][vertex_index] = vertex.normal.z;
+		input[6][vertex_index] = vertex.tangent.x;
+		input[7][vertex_index] = vertex.tangent.y;
+		input[8][vertex_index] = vertex.tangent.z;
+		input[9][vertex_index] = vertex.tangent.w;
+	}
+
+	float output[10][k_num_vertices];
+	matrix_skin_soa(data.palette, data.bone_indices, data.bone_weights,
+		const_float3f_soa{ input[0], input[1], input[2] }, const_float3f_soa{ input[3], input[4], input[5] }, const_float4f_soa{ input[6], input[7], input[8], input[9] },
+		float3f_soa{ output[0], output[1], output[2] }, float3f_soa{ output[3], output[4], output[5] }, float4f_soa{ output[6], output[7], output[8], output[9] },
+		k_num_vertices);
+
+	for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+	{
+		const skinned_vertex& vertex = data.vertices[vertex_index];
+		const vector4f position = vector_set(output[0][vertex_index], output[1][vertex_index], output[2][vertex_index]);
+		const vector4f normal = vector_set(output[3][vertex_index], output[4][vertex_index], output[5][vertex_index]);
+		const vector4f tangent = vector_set(output[6][vertex_index], output[7][vertex_index], output[8][vertex_index]);
+
+		CHECK(vector_all_near_equal3(position, data.skin_position(vertex_index), threshold));
+		CHECK(vector_all_near_equal3(normal, data.skin_direction(vector_load3(&vertex.normal), vertex_index), threshold));
+		CHECK(vector_all_near_equal3(tangent, data.skin_direction(vector_load(&vertex.tangent), vertex_index), threshold));
+		CHECK(output[9][vertex_index] == vertex.tangent.w);
+	}
+
+	// In place, positions only
+	matrix_skin_soa(data.palette, data.bone_indices, data.bone_weights,
+		const_float3f_soa{ input[0], input[1], input[2] }, const_float3f_soa{ nullptr, nullptr, nullptr }, const_float4f_soa{ nullptr, nullptr, nullptr, nullptr },
+		float3f_soa{ input[0], input[1], input[2] }, float3f_soa{ nullptr, nullptr, nullptr }, float4f_soa{ nullptr, nullptr, nullptr, nullptr },
+		k_num_vertices);
+
+	for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+	{
+		CHECK(input[0][vertex_index] == output[0][vertex_index]);
+		CHECK(input[1][vertex_index] == output[1][vertex_index]);
+		CHECK(input[2][vertex_index] == output[2][vertex_index]);
+	}
+}
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/quat8f.h>
+#include <rtm/qvvf.h>
+#include <rtm/vector8f.h>
+#include <rtm/batch/quatf.h>
+#include <rtm/batch/soa.h>
+#include <rtm/impl/memory_utils.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Covers the 4 wide and scalar code paths along with the padding
+static constexpr uint32_t k_num_elements = 19;
+
+TEST_CASE("soa padded size", "[math][soa][batch]")
+{
+	CHECK(soa_padded_size(0) == 0);
+	CHECK(soa_padded_size(1) == 16);
+	CHECK(soa_padded_size(16) == 16);
+	CHECK(soa_padded_size(17) == 32);
+	CHECK(soa_vector3f<k_num_elements>::k_padded_capacity == 32);
+	CHECK(soa_quatf<64>::k_padded_capacity == 64);
+}
+
+TEST_CASE("soa vector3f pack", "[math][soa][batch]")
+{
+	float3f input[k_num_elements];
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+	{
+		const float value = float(element_index);
+		input[element_index] = float3f{ value, -value * 2.0F, value + 0.5F };
+	}
+
+	soa_vector3f<k_num_elements> vectors;
+	CHECK(vectors.size == 0);
+	CHECK(rtm_impl::is_aligned_to(vectors.x, 64));
+	CHECK(rtm_impl::is_aligned_to(vectors.y, 64));
+	CHECK(rtm_impl::is_aligned_to(vectors.z, 64));
+
+	soa_pack(input, k_num_elements, vectors);
+	CHECK(vectors.size == k_num_elements);
+	CHECK(vectors.get_padded_size() == 32);
+
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+	{
+		CHECK(vectors.x[element_index] == input[element_index].x);
+		CHECK(vectors.y[element_index] == input[element_index].y);
+		CHECK(vectors.z[element_index] == input[element_index].z);
+	}
+
+	for (uint32_t element_index = k_num_elements; element_index < vectors.get_padded_size(); ++element_index)
+	{
+		CHECK(vectors.x[element_index] == 0.0F);
+		CHECK(vectors.y[element_index] == 0.0F);
+		CHECK(vectors.z[element_index] == 0.0F);
+	}
+
+	// Kernels can run 8 wide over the padded size without a remainder
+	for (uint32_t element_index = 0; element_index < vectors.get_padded_size(); element_index += 8)
+		vector_store(vector_add(vector3x8_load(vectors, element_index), vector3x8f{ vector8_set(1.0F), vector8_set(1.0F), vector8_set(1.0F) }), vectors, element_index);
+
+	float3f output[k_num_elements];
+	soa_unpack(vectors, output);
+
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+	{
+		CHECK(output[element_index].x == input[element_index].x + 1.0F);
+		CHECK(output[element_index].y == input[element_index].y + 1.0F);
+		CHECK(output[element_index].z == input[element_index].z + 1.0F);
+	}
+}
+
+TEST_CASE("soa quatf pack", "[math][soa][batch]")
+{
+	const float threshold = 1.0E-6F;
+
+	quatf input[k_num_elements];
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+	{
+		const float value = float(element_index);
+		input[element_index] = quat_from_euler(value * 0.1F, 1.0F - value * 0.2F, value * 0.3F);
+	}
+
+	soa_quatf<k_num_elements> rotations;
+	soa_pack(input, k_num_elements, rotations);
+	CHECK(rotations.size == k_num_elements);
+
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+	{
+		CHECK(rotations.x[element_index] == quat_get_x(input[element_index]));
+		CHECK(rotations.w[element_index] == quat_get_w(input[element_index]));
+	}
+
+	// The padding holds identity rotations, safe to normalize or multiply
+	for (uint32_t element_index = k_num_elements; element_index < rotations.get_padded_size(); ++element_index)
+	{
+		CHECK(rotations.x[element_index] == 0.0F);
+		CHECK(rotations.y[element_index] == 0.0F);
+		CHECK(rotations.z[element_index] == 0.0F);
+		CHECK(rotations.w[element_index] == 1.0F);
+	}
+
+	// Batch functions consume the containers directly, over the padded size
+	quat_mul_soa(rotations, rotations, rotations, rotations.get_padded_size());
+	for (uint32_t element_index = 0; element_index < rotations.get_padded_size(); element_index += 8)
+		quat_store(quat_normalize(quat8_load(rotations, element_index)), rotations, element_index);
+
+	quatf output[k_num_elements];
+	soa_unpack(rotations, output);
+
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+		CHECK(quat_near_equal(output[element_index], quat_mul(input[element_index], input[element_index]), threshold));
+
+	CHECK(rotations.w[rotations.get_padded_size() - 1] == 1.0F);
+}
+
+TEST_CASE("soa qvvf pack", "[math][soa][batch]")
+{
+	qvvf input[k_num_elements];
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+	{
+		const float value = float(element_index);
+		input[element_index] = qvv_set(quat_from_euler(value * 0.1F, 1.0F - value * 0.2F, value * 0.3F), vector_set(value, -2.0F, value * 0.5F, 0.0F), vector_set(1.0F + value * 0.1F, 0.5F, 2.0F, 0.0F));
+	}
+
+	soa_qvvf<k_num_elements> transforms;
+	CHECK(rtm_impl::is_aligned_to(transforms.rotation.x, 64));
+	CHECK(rtm_impl::is_aligned_to(transforms.scale.z, 64));
+
+	soa_pack(input, k_num_elements, transforms);
+	CHECK(transforms.size == k_num_elements);
+	CHECK(transforms.rotation.size == k_num_elements);
+	CHECK(transforms.get_padded_size() == 32);
+
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+	{
+		CHECK(transforms.rotation.z[element_index] == quat_get_z(input[element_index].rotation));
+		CHECK(transforms.translation.x[element_index] == vector_get_x(input[element_index].translation));
+		CHECK(transforms.scale.y[element_index] == vector_get_y(input[element_index].scale));
+	}
+
+	for (uint32_t element_index = k_num_elements; element_index < transforms.get_padded_size(); ++element_index)
+	{
+		CHECK(transforms.rotation.w[element_index] == 1.0F);
+		CHECK(transforms.translation.x[element_index] == 0.0F);
+		CHECK(transforms.scale.x[element_index] == 1.0F);
+		CHECK(transforms.scale.z[element_index] == 1.0F);
+	}
+
+	qvvf output[k_num_elements];
+	soa_unpack(transforms, output);
+
+	for (uint32_t element_index = 0; element_index < k_num_elements; ++element_index)
+	{
+		CHECK(quat_near_equal(output[element_index].rotation, input[element_index].rotation, 0.0F));
+		CHECK(vector_all_near_equal(output[element_index].translation, input[element_index].translation, 0.0F));
+		CHECK(vector_all_near_equal(output[element_index].scale, input[element_index].scale, 0.0F));
+	}
+}
@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <catch.hpp>
+
+#include <rtm/vector4f.h>
+#include <rtm/batch/spatial_keys.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+using namespace rtm;
+
+static uint32_t spread_bits_reference(uint32_t value)
+{
+	uint64_t result = 0;
+	for (uint32_t bit_index = 0; bit_index < 21; ++bit_index)
+		result |= uint64_t((value >> bit_index) & 1) << (bit_index * 3);
+	return static_cast<uint32_t>(result);
+}
+
+static uint64_t morton_reference(int32_t x, int32_t y, int32_t z, int32_t max_cell)
+{
+	uint64_t result = 0;
+	const uint32_t values[3] = { uint32_t(std::min(std::max(x, 0), max_cell)), uint32_t(std::min(std::max(y, 0), max_cell)), uint32_t(std::min(std::max(z, 0), max_cell)) };
+	for (uint32_t bit_index = 0; bit_index < 21; ++bit_index)
+	{
+		for (uint32_t axis_index = 0; axis_index < 3; ++axis_index)
+			result |= uint64_t((values[axis_index] >> bit_index) & 1) << (bit_index * 3 + axis_index);
+	}
+	return result;
+}
+
+TEST_CASE("spatial keys", "[math][batch][spatial]")
+{
+	// Not a multiple of 4 or 8 to exercise the partial group
+	constexpr uint32_t num_positions = 23;
+
+	float position_x[num_positions];
+	float position_y[num_positions];
+	float position_z[num_positions];
+	for (uint32_t index = 0; index < num_positions; ++index)
+	{
+		position_x[index] = std::sin(float(index) * 1.3F) * 40.0F;
+		position_y[index] = std::cos(float(index) * 0.7F) * 25.0F + 10.0F;
+		position_z[index] = float(index) * 3.7F - 20.0F;
+	}
+
+	// Exact cell boundaries and far positions that clamp
+	position_x[3] = 2.0F;
+	position_y[3] = -0.5F;
+	position_z[3] = -2.5F;
+	position_x[4] = 1.0E7F;
+	position_y[4] = -1.0E6F;
+	position_z[4] = 1.0E7F;
+
+	const const_float3f_soa positions{ position_x, position_y, position_z };
+
+	spatial_grid_settings grid;
+	grid.origin = float3f{ -50.0F, -20.0F, -30.0F };
+	grid.cell_size = 0.5F;
+
+	int32_t cell_x[num_positions];
+	int32_t cell_y[num_positions];
+	int32_t cell_z[num_positions];
+	spatial_cell_coords_soa(positions, grid, cell_x, cell_y, cell_z, num_positions);
+
+	for (uint32_t index = 0; index < num_positions; ++index)
+	{
+		if (index == 4)
+			continue;	// Out of range on purpose
+
+		CHECK(cell_x[index] == int32_t(std::floor((position_x[index] - grid.origin.x) / grid.cell_size)));
+		CHECK(cell_y[index] == int32_t(std::floor((position_y[index] - grid.origin.y) / grid.cell_size)));
+		CHECK(cell_z[index] == int32_t(std::floor((position_z[index] - grid.origin.z) / grid.cell_size)));
+	}
+
+	CHECK(cell_x[3] == 104);
+	CHECK(cell_y[3] == 39);
+	CHECK(cell_z[3] == 55);
+
+	{
+		uint32_t keys[num_positions];
+		spatial_morton32_soa(positions, grid, keys, num_positions);
+
+		for (uint32_t index = 0; index < num_positions; ++index)
+		{
+			if (index != 4)
+				CHECK(keys[index] == uint32_t(morton_reference(cell_x[index], cell_y[index], cell_z[index], 1023)));
+		}
+
+		CHECK(keys[4] == uint32_t(morton_reference(1023, 0, 1023, 1023)));
+		CHECK(spread_bits_reference(1023) == 0x09249249U);
+	}
+
+	{
+		uint64_t keys[num_positions];
+		spatial_morton64_soa(positions, grid, keys, num_positions);
+
+		for (uint32_t index = 0; index < num_positions; ++index)
+		{
+			if (index != 4)
+				CHECK(keys[index] == morton_reference(cell_x[index], cell_y[index], cell_z[index], 2097151));
+		}
+
+		CHECK(keys[4] == morton_reference(2097151, 0, 2097151, 2097151));
+	}
+
+	{
+		// Every bit of every axis reaches its place in the 64 bit code
+		const float axis_x[4] = { 2097151.0F, 0.0F, 0.0F, 1398101.0F };
+		const float axis_y[4] = { 0.0F, 2097151.0F, 0.0F, 699050.0F };
+		const float axis_z[4] = { 0.0F, 0.0F, 2097151.0F, 1048576.0F };
+		const const_float3f_soa axis_positions{ axis_x, axis_y, axis_z };
+
+		spatial_grid_settings unit_grid;
+
+		uint64_t keys[4];
+		spatial_morton64_soa(axis_positions, unit_grid, keys, 4);
+		CHECK(keys[0] == 0x1249249249249249ULL);
+		CHECK(keys[1] == 0x2492492492492492ULL);
+		CHECK(keys[2] == 0x4924924924924924ULL);
+		CHECK(keys[3] == morton_reference(1398101, 699050, 1048576, 2097151));
+	}
+
+	{
+		uint32_t keys[num_positions];
+		spatial_hash_keys_soa(positions, grid, keys, num_positions);
+
+		for (uint32_t index = 0; index < num_positions; ++index)
+		{
+			if (index == 4)
+				continue;
+
+			uint32_t hash = (uint32_t(cell_x[index]) * 73856093U) ^ (uint32_t(cell_y[index]) * 19349663U) ^ (uint32_t(cell_z[index]) * 83492791U);
+			hash ^= hash >> 16;
+			hash *= 0x7FEB352DU;
+			hash ^= hash >> 15;
+			CHECK(keys[index] == hash);
+		}
+
+		// Positions in the same cell share their key
+		const float same_x[2] = { 0.1F, 0.4F };
+		const float same_y[2] = { -0.3F, -0.2F };
+		const float same_z[2] = { 7.05F, 7.45F };
+		uint32_t same_keys[2];
+		spatial_hash_keys_soa(const_float3f_soa{ same_x, same_y, same_z }, grid, same_keys, 2);
+		CHECK(same_keys[0] == same_keys[1]);
+	}
+
+	{
+		const vector4f camera_position = vector_set(5.0F, 2.0F, -1.0F);
+		const vector4f camera_forward = vector_normalize3(vector_set(1.0F, 0.5F, -0.25F));
+
+		float depths[num_positions];
+		for (uint32_t index = 0; index < num_positions; ++index)
+			depths[index] = (position_x[index] - 5.0F) * vector_get_x(camera_forward) + (position_y[index] - 2.0F) * vector_get_y(camera_forward) + (position_z[index] + 1.0F) * vector_get_z(camera_forward);
+
+		uint32_t front_to_back_keys[num_positions];
+		uint32_t back_to_front_keys[num_positions];
+		spatial_depth_keys_soa(positions, camera_position, camera_forward, front_to_back_keys, num_positions);
+		spatial_depth_keys_soa(positions, camera_position, camera_forward, back_to_front_keys, num_positions, depth_sort_order::back_to_front);
+
+		for (uint32_t index = 0; index < num_positions; ++index)
+		{
+			CHECK(back_to_front_keys[index] == ~front_to_back_keys[index]);
+
+			for (uint32_t other_index = 0; other_index < num_positions; ++other_index)
+			{
+				if (std::fabs(depths[index] - depths[other_index]) > 1.0E-3F)
+				{
+					CHECK((depths[index] < depths[other_index]) == (front_to_back_keys[index] < front_to_back_keys[other_index]));
+					CHECK((depths[index] < depths[other_index]) == (back_to_front_keys[index] > back_to_front_keys[other_index]));
+				}
+			}
+		}
+
+		// The keys are exact and negative depths sort first
+		const float depth_x[4] = { -1.0F, -2.0F, 0.0F, 1.0F };
+		const float depth_zero[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+		uint32_t keys[4];
+		spatial_depth_keys_soa(const_float3f_soa{ depth_x, depth_zero, depth_zero }, vector_zero(), vector_set(1.0F, 0.0F, 0.0F), keys, 4);
+		CHECK(keys[0] == 0x407FFFFFU);
+		CHECK(keys[1] == 0x3FFFFFFFU);
+		CHECK(keys[2] == 0x80000000U);
+		CHECK(keys[3] == 0xBF800000U);
+	}
+}
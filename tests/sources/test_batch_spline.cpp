@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/splinef.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/splinef.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Covers the 8 wide, 4 wide, and scalar code paths
+static constexpr uint32_t k_num_curves = 15;
+
+struct spline_test_streams
+{
+	float x[k_num_curves];
+	float y[k_num_curves];
+	float z[k_num_curves];
+	float w[k_num_curves];
+
+	const_float3f_soa get_const3() const { return const_float3f_soa{ x, y, z }; }
+	const_float4f_soa get_const4() const { return const_float4f_soa{ x, y, z, w }; }
+	float3f_soa get3() { return float3f_soa{ x, y, z }; }
+	float4f_soa get4() { return float4f_soa{ x, y, z, w }; }
+	vector4f get(uint32_t index) const { return vector_set(x[index], y[index], z[index], w[index]); }
+};
+
+static void fill_streams(spline_test_streams& streams, float seed)
+{
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+	{
+		const float value = float(curve_index) + seed;
+		streams.x[curve_index] = scalar_sin(value * 1.3F) * 4.0F;
+		streams.y[curve_index] = scalar_cos(value * 0.7F) * 2.0F;
+		streams.z[curve_index] = value * 0.25F - 1.0F;
+		streams.w[curve_index] = scalar_sin(value * 0.3F + 1.0F);
+	}
+}
+
+TEST_CASE("vector4f batch spline math", "[math][vector4][spline][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	spline_test_streams p0, p1, p2, p3;
+	fill_streams(p0, 0.0F);
+	fill_streams(p1, 10.0F);
+	fill_streams(p2, 20.0F);
+	fill_streams(p3, 30.0F);
+
+	float t[k_num_curves];
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+		t[curve_index] = float(curve_index) / float(k_num_curves - 1);
+
+	spline_test_streams output;
+
+	vector_bezier_soa(p0.get_const4(), p1.get_const4(), p2.get_const4(), p3.get_const4(), t, output.get4(), k_num_curves);
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+		CHECK(vector_all_near_equal(output.get(curve_index), vector_bezier(p0.get(curve_index), p1.get(curve_index), p2.get(curve_index), p3.get(curve_index), t[curve_index]), threshold));
+
+	vector_hermite_soa(p0.get_const4(), p1.get_const4(), p2.get_const4(), p3.get_const4(), t, output.get4(), k_num_curves);
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+		CHECK(vector_all_near_equal(output.get(curve_index), vector_hermite(p0.get(curve_index), p1.get(curve_index), p2.get(curve_index), p3.get(curve_index), t[curve_index]), threshold));
+
+	vector_catmull_rom_soa(p0.get_const4(), p1.get_const4(), p2.get_const4(), p3.get_const4(), t, output.get4(), k_num_curves);
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+		CHECK(vector_all_near_equal(output.get(curve_index), vector_catmull_rom(p0.get(curve_index), p1.get(curve_index), p2.get(curve_index), p3.get(curve_index), t[curve_index]), threshold));
+
+	// 3 component streams leave [w] untouched
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+		output.w[curve_index] = 123.0F;
+
+	vector_catmull_rom_soa(p0.get_const3(), p1.get_const3(), p2.get_const3(), p3.get_const3(), t, output.get3(), k_num_curves);
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+	{
+		CHECK(vector_all_near_equal3(output.get(curve_index), vector_catmull_rom(p0.get(curve_index), p1.get(curve_index), p2.get(curve_index), p3.get(curve_index), t[curve_index]), threshold));
+		CHECK(output.w[curve_index] == 123.0F);
+	}
+
+	vector_bezier_soa(p0.get_const3(), p1.get_const3(), p2.get_const3(), p3.get_const3(), t, output.get3(), k_num_curves);
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+		CHECK(vector_all_near_equal3(output.get(curve_index), vector_bezier(p0.get(curve_index), p1.get(curve_index), p2.get(curve_index), p3.get(curve_index), t[curve_index]), threshold));
+
+	vector_hermite_soa(p0.get_const3(), p1.get_const3(), p2.get_const3(), p3.get_const3(), t, output.get3(), k_num_curves);
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+		CHECK(vector_all_near_equal3(output.get(curve_index), vector_hermite(p0.get(curve_index), p1.get(curve_index), p2.get(curve_index), p3.get(curve_index), t[curve_index]), threshold));
+
+	// In place
+	spline_test_streams expected;
+	vector_bezier_soa(p0.get_const4(), p1.get_const4(), p2.get_const4(), p3.get_const4(), t, expected.get4(), k_num_curves);
+	vector_bezier_soa(p0.get_const4(), p1.get_const4(), p2.get_const4(), p3.get_const4(), t, p0.get4(), k_num_curves);
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+		CHECK(vector_all_near_equal(p0.get(curve_index), expected.get(curve_index), threshold));
+}
+
+TEST_CASE("quatf batch squad math", "[math][quat][spline][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	spline_test_streams start, start_control, end_control, end;
+	float t[k_num_curves];
+
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+	{
+		const float value = float(curve_index) * 0.21F;
+		const quatf q0 = quat_from_euler(value, -0.4F, 0.3F + value);
+		const quatf q1 = quat_from_euler(0.8F - value, 0.2F, -0.5F);
+		const quatf q2 = quat_from_euler(1.3F, 0.9F + value, 0.1F);
+		const quatf q3 = quat_from_euler(1.1F, 1.7F, 0.6F - value);
+
+		const quatf control1 = quat_squad_control(q0, q1, q2);
+		const quatf control2 = quat_squad_control(q1, q2, q3);
+
+		// Negated on some curves to exercise the shortest path selection
+		const quatf end_q = (curve_index % 3) == 0 ? quat_neg(q2) : q2;
+
+		vector4f values[4] = { quat_to_vector(q1), quat_to_vector(control1), quat_to_vector(control2), quat_to_vector(end_q) };
+		spline_test_streams* streams[4] = { &start, &start_control, &end_control, &end };
+		for (uint32_t stream_index = 0; stream_index < 4; ++stream_index)
+		{
+			streams[stream_index]->x[curve_index] = vector_get_x(values[stream_index]);
+			streams[stream_index]->y[curve_index] = vector_get_y(values[stream_index]);
+			streams[stream_index]->z[curve_index] = vector_get_z(values[stream_index]);
+			streams[stream_index]->w[curve_index] = vector_get_w(values[stream_index]);
+		}
+
+		t[curve_index] = float(curve_index) / float(k_num_curves - 1);
+	}
+
+	spline_test_streams output;
+	quat_squad_soa(start.get_const4(), start_control.get_const4(), end_control.get_const4(), end.get_const4(), t, output.get4(), k_num_curves);
+
+	for (uint32_t curve_index = 0; curve_index < k_num_curves; ++curve_index)
+	{
+		const quatf expected = quat_squad(vector_to_quat(start.get(curve_index)), vector_to_quat(start_control.get(curve_index)), vector_to_quat(end_control.get(curve_index)), vector_to_quat(end.get(curve_index)), t[curve_index]);
+		const quatf result = vector_to_quat(output.get(curve_index));
+
+		// Both represent the same rotation but may lie on opposite hemispheres
+		const float dot = quat_dot(result, expected);
+		CHECK(scalar_abs(dot) >= 1.0F - threshold);
+	}
+}
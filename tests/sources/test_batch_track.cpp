@@ -0,0 +1,167 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/trackf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Covers the 8 wide, 4 wide, and scalar code paths
+static constexpr uint32_t k_num_tracks = 15;
+static constexpr uint32_t k_num_keys = 5;
+static constexpr uint32_t k_num_values = k_num_tracks * k_num_keys;
+
+TEST_CASE("track sample keys", "[math][track][batch]")
+{
+	const float sample_rate = 30.0F;
+
+	track_sample_keys keys = track_find_sample_keys(0.0F, sample_rate, k_num_keys);
+	CHECK(keys.key0 == 0);
+	CHECK(keys.key1 == 1);
+	CHECK(keys.alpha == 0.0F);
+
+	keys = track_find_sample_keys(2.5F / sample_rate, sample_rate, k_num_keys);
+	CHECK(keys.key0 == 2);
+	CHECK(keys.key1 == 3);
+	CHECK(scalar_near_equal(keys.alpha, 0.5F, 1.0E-5F));
+
+	// Clamped to the track duration
+	keys = track_find_sample_keys(-1.0F, sample_rate, k_num_keys);
+	CHECK(keys.key0 == 0);
+	CHECK(keys.key1 == 1);
+	CHECK(keys.alpha == 0.0F);
+
+	keys = track_find_sample_keys(4.0F / sample_rate, sample_rate, k_num_keys);
+	CHECK(keys.key0 == 4);
+	CHECK(keys.key1 == 4);
+	CHECK(keys.alpha == 0.0F);
+
+	keys = track_find_sample_keys(10.0F, sample_rate, k_num_keys);
+	CHECK(keys.key0 == 4);
+	CHECK(keys.key1 == 4);
+	CHECK(keys.alpha == 0.0F);
+
+	// A single key
+	keys = track_find_sample_keys(0.5F, sample_rate, 1);
+	CHECK(keys.key0 == 0);
+	CHECK(keys.key1 == 0);
+	CHECK(keys.alpha == 0.0F);
+}
+
+TEST_CASE("track batch sample uniform", "[math][track][batch]")
+{
+	const float threshold = 1.0E-5F;
+	const float sample_rate = 30.0F;
+
+	float key_x[k_num_values];
+	float key_y[k_num_values];
+	float key_z[k_num_values];
+	float key_w[k_num_values];
+	float rotation_x[k_num_values];
+	float rotation_y[k_num_values];
+	float rotation_z[k_num_values];
+	float rotation_w[k_num_values];
+
+	for (uint32_t key_index = 0; key_index < k_num_keys; ++key_index)
+	{
+		for (uint32_t track_index = 0; track_index < k_num_tracks; ++track_index)
+		{
+			const uint32_t value_index = key_index * k_num_tracks + track_index;
+			const float value = float(track_index) * 0.3F + float(key_index) * 0.2F;
+
+			key_x[value_index] = value;
+			key_y[value_index] = -2.0F * value;
+			key_z[value_index] = value * value;
+			key_w[value_index] = 1.0F - value;
+
+			quatf rotation = quat_from_euler(value, 0.5F - value, value * 0.25F);
+
+			// Some keys on the other side of the hypersphere
+			if ((key_index + track_index) % 3 == 0)
+				rotation = quat_neg(rotation);
+
+			rotation_x[value_index] = quat_get_x(rotation);
+			rotation_y[value_index] = quat_get_y(rotation);
+			rotation_z[value_index] = quat_get_z(rotation);
+			rotation_w[value_index] = quat_get_w(rotation);
+		}
+	}
+
+	const const_float3f_soa keys3 = { key_x, key_y, key_z };
+	const const_float4f_soa keys4 = { key_x, key_y, key_z, key_w };
+	const const_float4f_soa rotation_keys = { rotation_x, rotation_y, rotation_z, rotation_w };
+
+	float output_x[k_num_tracks];
+	float output_y[k_num_tracks];
+	float output_z[k_num_tracks];
+	float output_w[k_num_tracks];
+	const float3f_soa output3 = { output_x, output_y, output_z };
+	const float4f_soa output4 = { output_x, output_y, output_z, output_w };
+
+	const float sample_times[] = { 0.0F, 1.3F / sample_rate, 3.75F / sample_rate, 4.0F / sample_rate, 1.0F };
+	for (float sample_time : sample_times)
+	{
+		const track_sample_keys keys = track_find_sample_keys(sample_time, sample_rate, k_num_keys);
+
+		vector_sample_uniform_soa(keys3, k_num_keys, sample_rate, sample_time, output3, k_num_tracks);
+		for (uint32_t track_index = 0; track_index < k_num_tracks; ++track_index)
+		{
+			const uint32_t key0_index = keys.key0 * k_num_tracks + track_index;
+			const uint32_t key1_index = keys.key1 * k_num_tracks + track_index;
+			const vector4f start = vector_set(key_x[key0_index], key_y[key0_index], key_z[key0_index]);
+			const vector4f end = vector_set(key_x[key1_index], key_y[key1_index], key_z[key1_index]);
+			const vector4f expected = vector_lerp(start, end, keys.alpha);
+			CHECK(vector_all_near_equal3(vector_set(output_x[track_index], output_y[track_index], output_z[track_index]), expected, threshold));
+		}
+
+		vector_sample_uniform_soa(keys4, k_num_keys, sample_rate, sample_time, output4, k_num_tracks);
+		for (uint32_t track_index = 0; track_index < k_num_tracks; ++track_index)
+		{
+			const uint32_t key0_index = keys.key0 * k_num_tracks + track_index;
+			const uint32_t key1_index = keys.key1 * k_num_tracks + track_index;
+			const vector4f start = vector_set(key_x[key0_index], key_y[key0_index], key_z[key0_index], key_w[key0_index]);
+			const vector4f end = vector_set(key_x[key1_index], key_y[key1_index], key_z[key1_index], key_w[key1_index]);
+			const vector4f expected = vector_lerp(start, end, keys.alpha);
+			CHECK(vector_all_near_equal(vector_set(output_x[track_index], output_y[track_index], output_z[track_index], output_w[track_index]), expected, threshold));
+		}
+
+		quat_sample_uniform_soa(rotation_keys, k_num_keys, sample_rate, sample_time, output4, k_num_tracks);
+		for (uint32_t track_index = 0; track_index < k_num_tracks; ++track_index)
+		{
+			const uint32_t key0_index = keys.key0 * k_num_tracks + track_index;
+			const uint32_t key1_index = keys.key1 * k_num_tracks + track_index;
+			const quatf start = quat_set(rotation_x[key0_index], rotation_y[key0_index], rotation_z[key0_index], rotation_w[key0_index]);
+			const quatf end = quat_set(rotation_x[key1_index], rotation_y[key1_index], rotation_z[key1_index], rotation_w[key1_index]);
+			const quatf expected = quat_lerp(start, end, keys.alpha);
+			CHECK(quat_near_equal(quat_set(output_x[track_index], output_y[track_index], output_z[track_index], output_w[track_index]), expected, threshold));
+		}
+	}
+}
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <catch.hpp>
+
+#include <rtm/batch/transform_error.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_transforms = 5;
+static constexpr uint32_t k_max_num_shell_points = 13;
+
+static qvvf make_transform(uint32_t index, float offset)
+{
+	const float t = float(index) + offset;
+	const quatf rotation = quat_from_euler(scalar_deg_to_rad(t * 17.0F), scalar_deg_to_rad(t * -29.0F), scalar_deg_to_rad(t * 41.0F));
+	return qvv_set(rotation, vector_set(t, t * -2.0F, 0.5F), vector_set(1.0F + t * 0.1F, 1.0F, 1.0F - t * 0.05F));
+}
+
+// Transforms every shell point by both transforms with qvv_mul_point3(..)
+static float point_error_squared_reference(const qvvf& reference, const qvvf& approximation, const const_float3f_soa& shell_points, uint32_t num_shell_points, float shell_distance)
+{
+	float max_error_sq = 0.0F;
+	for (uint32_t point_index = 0; point_index < num_shell_points; ++point_index)
+	{
+		const vector4f point = vector_mul(vector_set(shell_points.x[point_index], shell_points.y[point_index], shell_points.z[point_index]), shell_distance);
+		const float error_sq = vector_length_squared3(vector_sub(qvv_mul_point3(point, reference), qvv_mul_point3(point, approximation)));
+		max_error_sq = scalar_max(max_error_sq, error_sq);
+	}
+
+	return max_error_sq;
+}
+
+TEST_CASE("batch qvvf point error", "[math][batch][qvv]")
+{
+	float x[k_max_num_shell_points];
+	float y[k_max_num_shell_points];
+	float z[k_max_num_shell_points];
+	for (uint32_t point_index = 0; point_index < k_max_num_shell_points; ++point_index)
+	{
+		// Points on the shell of a unit sphere along the axes and diagonals
+		const vector4f point = vector_normalize3(vector_set(float(int32_t(point_index % 3) - 1), float(int32_t(point_index % 5) - 2), float(int32_t(point_index % 2) * 2 - 1)));
+		x[point_index] = vector_get_x(point);
+		y[point_index] = vector_get_y(point);
+		z[point_index] = vector_get_z(point);
+	}
+
+	const const_float3f_soa shell_points = { &x[0], &y[0], &z[0] };
+	const float shell_distances[k_num_transforms] = { 1.0F, 3.0F, 0.25F, 10.0F, 2.0F };
+
+	qvvf reference_transforms[k_num_transforms];
+	qvvf approximation_transforms[k_num_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+	{
+		reference_transforms[transform_index] = make_transform(transform_index, 0.0F);
+		approximation_transforms[transform_index] = make_transform(transform_index, 0.01F * float(transform_index));
+	}
+
+	// Covers the 8 wide, 4 wide, and scalar loops
+	const uint32_t num_shell_points_list[] = { 1, 3, 4, 8, 13 };
+	for (uint32_t num_shell_points : num_shell_points_list)
+	{
+		float errors_sq[k_num_transforms];
+		qvv_point_error_squared_soa(reference_transforms, approximation_transforms, k_num_transforms, shell_points, num_shell_points, shell_distances, &errors_sq[0]);
+
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		{
+			const float expected = point_error_squared_reference(reference_transforms[transform_index], approximation_transforms[transform_index], shell_points, num_shell_points, shell_distances[transform_index]);
+			CHECK(scalar_near_equal(errors_sq[transform_index], expected, 1.0E-4F + expected * 1.0E-4F));
+		}
+
+		qvv_point_error_squared_soa(reference_transforms, approximation_transforms, k_num_transforms, shell_points, num_shell_points, nullptr, &errors_sq[0]);
+
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		{
+			const float expected = point_error_squared_reference(reference_transforms[transform_index], approximation_transforms[transform_index], shell_points, num_shell_points, 1.0F);
+			CHECK(scalar_near_equal(errors_sq[transform_index], expected, 1.0E-4F + expected * 1.0E-4F));
+		}
+	}
+
+	{
+		// Identical transforms have no error, up to the rounding of the two matrices
+		float errors_sq[k_num_transforms];
+		qvv_point_error_squared_soa(reference_transforms, reference_transforms, k_num_transforms, shell_points, k_max_num_shell_points, shell_distances, &errors_sq[0]);
+
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+			CHECK(scalar_near_equal(errors_sq[transform_index], 0.0F, 1.0E-10F));
+	}
+
+	{
+		// A pure translation moves every point by the same distance
+		qvvf translated_transforms[k_num_transforms];
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+			translated_transforms[transform_index] = qvv_set(reference_transforms[transform_index].rotation, vector_add(reference_transforms[transform_index].translation, vector_set(0.0F, 3.0F, 4.0F)), reference_transforms[transform_index].scale);
+
+		float errors_sq[k_num_transforms];
+		qvv_point_error_squared_soa(reference_transforms, translated_transforms, k_num_transforms, shell_points, k_max_num_shell_points, shell_distances, &errors_sq[0]);
+
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+			CHECK(scalar_near_equal(errors_sq[transform_index], 25.0F, 1.0E-3F));
+	}
+}
+
+TEST_CASE("batch qvvf point error threshold", "[math][batch][qvv]")
+{
+	const float x[4] = { 1.0F, 0.0F, 0.0F, -1.0F };
+	const float y[4] = { 0.0F, 1.0F, 0.0F, 0.0F };
+	const float z[4] = { 0.0F, 0.0F, 1.0F, 0.0F };
+	const const_float3f_soa shell_points = { &x[0], &y[0], &z[0] };
+
+	// The translation error grows with the transform index: 0.0, 0.5, 1.0, 1.5, 2.0
+	qvvf reference_transforms[k_num_transforms];
+	qvvf approximation_transforms[k_num_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+	{
+		reference_transforms[transform_index] = qvv_identity();
+		approximation_transforms[transform_index] = qvv_set(quat_identity(), vector_set(0.5F * float(transform_index), 0.0F, 0.0F), vector_set(1.0F));
+	}
+
+	float errors_sq[k_num_transforms] = { -1.0F, -1.0F, -1.0F, -1.0F, -1.0F };
+	CHECK(qvv_find_point_error_above_soa(reference_transforms, approximation_transforms, k_num_transforms, shell_points, 4, nullptr, 1.2F, &errors_sq[0]) == 3);
+	CHECK(scalar_near_equal(errors_sq[0], 0.0F, 1.0E-6F));
+	CHECK(scalar_near_equal(errors_sq[1], 0.25F, 1.0E-6F));
+	CHECK(scalar_near_equal(errors_sq[2], 1.0F, 1.0E-6F));
+	CHECK(scalar_near_equal(errors_sq[3], 2.25F, 1.0E-6F));
+	CHECK(errors_sq[4] == -1.0F);	// Not evaluated
+
+	// The threshold is inclusive
+	CHECK(qvv_find_point_error_above_soa(reference_transforms, approximation_transforms, k_num_transforms, shell_points, 4, nullptr, 2.0F, &errors_sq[0]) == k_num_transforms);
+	CHECK(scalar_near_equal(errors_sq[4], 4.0F, 1.0E-6F));
+
+	// Every error is above a negative threshold
+	CHECK(qvv_find_point_error_above_soa(reference_transforms, approximation_transforms, k_num_transforms, shell_points, 4, nullptr, -1.0F, &errors_sq[0]) == 0);
+}
@@ -0,0 +1,193 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/vector4f.h>
+#include <rtm/batch/vector4f.h>
+
+using namespace rtm;
+
+TEST_CASE("vector4f batch normalize3", "[math][vector4][batch]")
+{
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_vectors = 19;
+
+	float input_x[num_vectors];
+	float input_y[num_vectors];
+	float input_z[num_vectors];
+	float out_x[num_vectors];
+	float out_y[num_vectors];
+	float out_z[num_vectors];
+
+	vector4f input[num_vectors];
+
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		const float value = float(vector_index) * 0.37F;
+		input[vector_index] = vector_set(value + 0.1F, 2.0F - value, value * value - 3.0F, 0.0F);
+
+		input_x[vector_index] = vector_get_x(input[vector_index]);
+		input_y[vector_index] = vector_get_y(input[vector_index]);
+		input_z[vector_index] = vector_get_z(input[vector_index]);
+	}
+
+	// The hardware estimate only has 8 bits of precision with NEON and 12 with SSE
+	const normalize_precision precisions[] = { normalize_precision::estimate, normalize_precision::refined, normalize_precision::exact };
+	const float thresholds[] = { 1.0E-2F, 1.0E-4F, 1.0E-6F };
+
+	for (uint32_t precision_index = 0; precision_index < 3; ++precision_index)
+	{
+		const float threshold = thresholds[precision_index];
+		vector_normalize3_soa(const_float3f_soa{ input_x, input_y, input_z }, float3f_soa{ out_x, out_y, out_z }, num_vectors, precisions[precision_index]);
+
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		{
+			const vector4f result = vector_set(out_x[vector_index], out_y[vector_index], out_z[vector_index], 0.0F);
+			CHECK(vector_all_near_equal3(result, vector_normalize3(input[vector_index]), threshold));
+			CHECK(scalar_near_equal(float(vector_length_squared3(result)), 1.0F, threshold * 2.0F));
+		}
+	}
+
+	{
+		// In place, the output aliases the input streams
+		const float3f_soa input_soa = { input_x, input_y, input_z };
+		vector_normalize3_soa(input_soa, input_soa, num_vectors);
+
+		for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		{
+			const vector4f result = vector_set(input_x[vector_index], input_y[vector_index], input_z[vector_index], 0.0F);
+			CHECK(vector_all_near_equal3(result, vector_normalize3(input[vector_index]), 1.0E-6F));
+		}
+	}
+
+	{
+		// Empty input does nothing
+		out_x[0] = 123.0F;
+		vector_normalize3_soa(const_float3f_soa{ input_x, input_y, input_z }, float3f_soa{ out_x, out_y, out_z }, 0, normalize_precision::refined);
+		CHECK(out_x[0] == 123.0F);
+	}
+}
+
+TEST_CASE("vector4f batch array load/store", "[math][vector4][batch]")
+{
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_vectors = 19;
+
+	// One extra entry to catch out of bounds writes
+	alignas(16) float3f input[num_vectors + 1];
+	for (uint32_t vector_index = 0; vector_index < num_vectors + 1; ++vector_index)
+	{
+		const float value = float(vector_index);
+		input[vector_index] = float3f{ value, value * 2.0F - 7.0F, value * 0.25F + 1.0F };
+	}
+
+	const store_mode modes[] = { store_mode::cached, store_mode::non_temporal };
+	const uint32_t prefetch_distances[] = { 0, 64, rtm_impl::k_default_prefetch_distance };
+
+	for (store_mode mode : modes)
+	{
+		for (uint32_t prefetch_distance : prefetch_distances)
+		{
+			vector4f vectors[num_vectors + 1];
+			vectors[num_vectors] = vector_set(-1.0F);
+			vector_load3_array(input, vectors, num_vectors, mode, prefetch_distance);
+
+			for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+				CHECK(vector_all_near_equal(vectors[vector_index], vector_load3(input + vector_index), 0.0F));
+			CHECK(vector_all_near_equal(vectors[num_vectors], vector_set(-1.0F), 0.0F));
+
+			alignas(16) float3f output[num_vectors + 1];
+			output[num_vectors] = float3f{ -1.0F, -1.0F, -1.0F };
+			vector_store3_array(vectors, output, num_vectors, mode, prefetch_distance);
+
+			for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+			{
+				CHECK(output[vector_index].x == input[vector_index].x);
+				CHECK(output[vector_index].y == input[vector_index].y);
+				CHECK(output[vector_index].z == input[vector_index].z);
+			}
+			CHECK(output[num_vectors].x == -1.0F);
+			CHECK(output[num_vectors].y == -1.0F);
+			CHECK(output[num_vectors].z == -1.0F);
+		}
+	}
+
+	{
+		// Unaligned input with cached stores
+		vector4f vectors[num_vectors - 1];
+		vector_load3_array(input + 1, vectors, num_vectors - 1);
+
+		for (uint32_t vector_index = 0; vector_index < num_vectors - 1; ++vector_index)
+			CHECK(vector_all_near_equal(vectors[vector_index], vector_load3(input + vector_index + 1), 0.0F));
+	}
+}
+
+TEST_CASE("vector4f batch trigonometry arrays", "[math][vector4][batch]")
+{
+	// Exercise the pipelined loop, every remainder path, and their combinations
+	constexpr uint32_t max_count = 47;
+	const uint32_t counts[] = { 0, 3, 4, 8, 15, 16, 31, 32, 47 };
+
+	float input_y[max_count];
+	float input_x[max_count];
+	float input_acos[max_count];
+	for (uint32_t index = 0; index < max_count; ++index)
+	{
+		input_y[index] = float(index % 7) - 3.0F;
+		input_x[index] = float(index % 5) - 2.0F;
+		input_acos[index] = (float(index) / float(max_count - 1)) * 2.0F - 1.0F;
+	}
+
+	for (uint32_t count : counts)
+	{
+		float output[max_count + 1];
+		output[count] = -10.0F;
+		vector_atan2_array(input_y, input_x, output, count);
+
+		for (uint32_t index = 0; index < count; ++index)
+			CHECK(output[index] == vector_get_x(vector_atan2(vector_set(input_y[index]), vector_set(input_x[index]))));
+		CHECK(output[count] == -10.0F);
+
+		output[count] = -10.0F;
+		vector_acos_array(input_acos, output, count);
+
+		for (uint32_t index = 0; index < count; ++index)
+			CHECK(scalar_near_equal(output[index], scalar_acos(input_acos[index]), 1.0E-5F));
+		CHECK(output[count] == -10.0F);
+	}
+
+	{
+		// In place
+		float values[max_count];
+		for (uint32_t index = 0; index < max_count; ++index)
+			values[index] = input_acos[index];
+
+		vector_acos_array(values, values, max_count);
+
+		for (uint32_t index = 0; index < max_count; ++index)
+			CHECK(values[index] == vector_get_x(vector_acos(vector_set(input_acos[index]))));
+	}
+}
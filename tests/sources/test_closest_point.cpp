@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <catch.hpp>
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/closest_pointf.h>
+#include <rtm/batch/closest_pointf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Deterministic values in [-range, range]
+static float next_value(uint32_t& state, float range)
+{
+	state = state * 1664525U + 1013904223U;
+	return (float(state >> 8) * (1.0F / 16777216.0F) * 2.0F - 1.0F) * range;
+}
+
+static vector4f next_point(uint32_t& state, float range)
+{
+	const float x = next_value(state, range);
+	const float y = next_value(state, range);
+	const float z = next_value(state, range);
+	return vector_set(x, y, z);
+}
+
+TEST_CASE("closest_pointf math", "[math][closest_point]")
+{
+	const float threshold = 1.0E-5F;
+
+	{
+		const vector4f start = vector_set(0.0F, 0.0F, 0.0F);
+		const vector4f end = vector_set(4.0F, 0.0F, 0.0F);
+
+		// Before the start, inside, and past the end
+		CHECK(vector_all_near_equal3(closest_point_on_segment(vector_set(-2.0F, 1.0F, 0.0F), start, end), start, threshold));
+		CHECK(vector_all_near_equal3(closest_point_on_segment(vector_set(1.0F, 3.0F, 0.0F), start, end), vector_set(1.0F, 0.0F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(closest_point_on_segment(vector_set(7.0F, 0.0F, -4.0F), start, end), end, threshold));
+		CHECK(scalar_near_equal(float(point_segment_distance_squared(vector_set(1.0F, 3.0F, 0.0F), start, end)), 9.0F, threshold));
+		CHECK(scalar_near_equal(float(point_segment_distance_squared(vector_set(7.0F, 0.0F, -4.0F), start, end)), 25.0F, threshold));
+
+		// A zero length segment is a point
+		CHECK(vector_all_near_equal3(closest_point_on_segment(vector_set(1.0F, 3.0F, 0.0F), end, end), end, threshold));
+	}
+
+	{
+		const vector4f vertex0 = vector_set(0.0F, 0.0F, 0.0F);
+		const vector4f vertex1 = vector_set(2.0F, 0.0F, 0.0F);
+		const vector4f vertex2 = vector_set(0.0F, 2.0F, 0.0F);
+
+		// Face, every vertex, and every edge region
+		CHECK(vector_all_near_equal3(closest_point_on_triangle(vector_set(0.5F, 0.5F, 3.0F), vertex0, vertex1, vertex2), vector_set(0.5F, 0.5F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(closest_point_on_triangle(vector_set(-1.0F, -1.0F, 1.0F), vertex0, vertex1, vertex2), vertex0, threshold));
+		CHECK(vector_all_near_equal3(closest_point_on_triangle(vector_set(3.0F, -1.0F, 0.0F), vertex0, vertex1, vertex2), vertex1, threshold));
+		CHECK(vector_all_near_equal3(closest_point_on_triangle(vector_set(-1.0F, 3.0F, 0.0F), vertex0, vertex1, vertex2), vertex2, threshold));
+		CHECK(vector_all_near_equal3(closest_point_on_triangle(vector_set(1.0F, -2.0F, 0.0F), vertex0, vertex1, vertex2), vector_set(1.0F, 0.0F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(closest_point_on_triangle(vector_set(-2.0F, 1.0F, 0.0F), vertex0, vertex1, vertex2), vector_set(0.0F, 1.0F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(closest_point_on_triangle(vector_set(2.0F, 2.0F, 0.0F), vertex0, vertex1, vertex2), vector_set(1.0F, 1.0F, 0.0F), threshold));
+		CHECK(scalar_near_equal(float(point_triangle_distance_squared(vector_set(0.5F, 0.5F, 3.0F), vertex0, vertex1, vertex2)), 9.0F, threshold));
+		CHECK(scalar_near_equal(float(point_triangle_distance_squared(vector_set(2.0F, 2.0F, 0.0F), vertex0, vertex1, vertex2)), 2.0F, threshold));
+	}
+
+	{
+		vector4f point0;
+		vector4f point1;
+
+		// Crossing segments
+		closest_points_between_segments(vector_set(-1.0F, 0.0F, 0.0F), vector_set(1.0F, 0.0F, 0.0F), vector_set(0.5F, -1.0F, 2.0F), vector_set(0.5F, 1.0F, 2.0F), point0, point1);
+		CHECK(vector_all_near_equal3(point0, vector_set(0.5F, 0.0F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(point1, vector_set(0.5F, 0.0F, 2.0F), threshold));
+
+		// Parallel segments
+		closest_points_between_segments(vector_set(0.0F, 0.0F, 0.0F), vector_set(2.0F, 0.0F, 0.0F), vector_set(1.0F, 1.0F, 0.0F), vector_set(3.0F, 1.0F, 0.0F), point0, point1);
+		CHECK(scalar_near_equal(float(vector_distance3(point0, point1)), 1.0F, threshold));
+
+		// Clamped at both ends
+		closest_points_between_segments(vector_set(0.0F, 0.0F, 0.0F), vector_set(1.0F, 0.0F, 0.0F), vector_set(3.0F, 1.0F, 0.0F), vector_set(3.0F, 5.0F, 0.0F), point0, point1);
+		CHECK(vector_all_near_equal3(point0, vector_set(1.0F, 0.0F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(point1, vector_set(3.0F, 1.0F, 0.0F), threshold));
+		CHECK(scalar_near_equal(float(segment_segment_distance_squared(vector_set(0.0F, 0.0F, 0.0F), vector_set(1.0F, 0.0F, 0.0F), vector_set(3.0F, 1.0F, 0.0F), vector_set(3.0F, 5.0F, 0.0F))), 5.0F, threshold));
+
+		// Zero length segments
+		closest_points_between_segments(vector_set(1.0F, 1.0F, 0.0F), vector_set(1.0F, 1.0F, 0.0F), vector_set(0.0F, 0.0F, 0.0F), vector_set(4.0F, 0.0F, 0.0F), point0, point1);
+		CHECK(vector_all_near_equal3(point0, vector_set(1.0F, 1.0F, 0.0F), threshold));
+		CHECK(vector_all_near_equal3(point1, vector_set(1.0F, 0.0F, 0.0F), threshold));
+		CHECK(scalar_near_equal(float(segment_segment_distance_squared(vector_set(1.0F, 1.0F, 0.0F), vector_set(1.0F, 1.0F, 0.0F), vector_set(2.0F, 2.0F, 0.0F), vector_set(2.0F, 2.0F, 0.0F))), 2.0F, threshold));
+	}
+
+	{
+		// Sampling never finds a closer point than the queries
+		uint32_t state = 12345;
+		for (uint32_t iteration = 0; iteration < 64; ++iteration)
+		{
+			const vector4f point = next_point(state, 4.0F);
+			const vector4f vertex0 = next_point(state, 2.0F);
+			const vector4f vertex1 = next_point(state, 2.0F);
+			const vector4f vertex2 = next_point(state, 2.0F);
+			const vector4f start = next_point(state, 2.0F);
+			const vector4f end = next_point(state, 2.0F);
+
+			const float triangle_distance_sq = point_triangle_distance_squared(point, vertex0, vertex1, vertex2);
+			const float segment_distance_sq = segment_segment_distance_squared(vertex0, vertex1, start, end);
+			const float segments_tolerance = 1.0E-4F;
+
+			for (uint32_t sample_s = 0; sample_s <= 16; ++sample_s)
+			{
+				const float s = float(sample_s) / 16.0F;
+				const vector4f on_edge = vector_lerp(vertex0, vertex1, s);
+				for (uint32_t sample_t = 0; sample_t <= 16; ++sample_t)
+				{
+					const float t = float(sample_t) / 16.0F;
+					const vector4f on_segment = vector_lerp(start, end, t);
+					CHECK(segment_distance_sq <= float(vector_distance_squared3(on_edge, on_segment)) + segments_tolerance);
+
+					if (sample_s + sample_t <= 16)
+					{
+						const vector4f on_triangle = vector_add(vertex0, vector_add(vector_mul(vector_sub(vertex1, vertex0), s), vector_mul(vector_sub(vertex2, vertex0), t)));
+						CHECK(triangle_distance_sq <= float(vector_distance_squared3(point, on_triangle)) + segments_tolerance);
+					}
+				}
+			}
+		}
+	}
+}
+
+TEST_CASE("closest_pointf batch", "[math][closest_point][batch]")
+{
+	const float threshold = 1.0E-4F;
+
+	// Not a multiple of 4 to exercise the partial group, the last entries are degenerate
+	constexpr uint32_t num_primitives = 19;
+
+	float vertex0_x[num_primitives];
+	float vertex0_y[num_primitives];
+	float vertex0_z[num_primitives];
+	float vertex1_x[num_primitives];
+	float vertex1_y[num_primitives];
+	float vertex1_z[num_primitives];
+	float vertex2_x[num_primitives];
+	float vertex2_y[num_primitives];
+	float vertex2_z[num_primitives];
+
+	uint32_t state = 42;
+	for (uint32_t index = 0; index < num_primitives; ++index)
+	{
+		vertex0_x[index] = next_value(state, 3.0F);
+		vertex0_y[index] = next_value(state, 3.0F);
+		vertex0_z[index] = next_value(state, 3.0F);
+		vertex1_x[index] = next_value(state, 3.0F);
+		vertex1_y[index] = next_value(state, 3.0F);
+		vertex1_z[index] = next_value(state, 3.0F);
+		vertex2_x[index] = next_value(state, 3.0F);
+		vertex2_y[index] = next_value(state, 3.0F);
+		vertex2_z[index] = next_value(state, 3.0F);
+	}
+
+	// Zero length segments
+	vertex1_x[num_primitives - 1] = vertex0_x[num_primitives - 1];
+	vertex1_y[num_primitives - 1] = vertex0_y[num_primitives - 1];
+	vertex1_z[num_primitives - 1] = vertex0_z[num_primitives - 1];
+
+	const const_float3f_soa vertices0{ vertex0_x, vertex0_y, vertex0_z };
+	const const_float3f_soa vertices1{ vertex1_x, vertex1_y, vertex1_z };
+	const const_float3f_soa vertices2{ vertex2_x, vertex2_y, vertex2_z };
+
+	float closest_x[num_primitives];
+	float closest_y[num_primitives];
+	float closest_z[num_primitives];
+	const float3f_soa closest_points{ closest_x, closest_y, closest_z };
+
+	for (uint32_t query_index = 0; query_index < 8; ++query_index)
+	{
+		const vector4f point = next_point(state, 4.0F);
+		const vector4f end = next_point(state, 4.0F);
+
+		// Every count up to the full set writes only its own entries
+		for (uint32_t num_values = 1; num_values <= num_primitives; num_values += 6)
+		{
+			float distances_sq[num_primitives + 1];
+			distances_sq[num_values] = -1.0F;
+
+			point_segment_distance_squared_soa(point, vertices0, vertices1, distances_sq, num_values);
+			CHECK(distances_sq[num_values] == -1.0F);
+			for (uint32_t index = 0; index < num_values; ++index)
+			{
+				const vector4f vertex0 = vector_set(vertex0_x[index], vertex0_y[index], vertex0_z[index]);
+				const vector4f vertex1 = vector_set(vertex1_x[index], vertex1_y[index], vertex1_z[index]);
+				CHECK(scalar_near_equal(distances_sq[index], float(point_segment_distance_squared(point, vertex0, vertex1)), threshold));
+			}
+
+			segment_segment_distance_squared_soa(point, end, vertices0, vertices1, distances_sq, num_values);
+			CHECK(distances_sq[num_values] == -1.0F);
+			for (uint32_t index = 0; index < num_values; ++index)
+			{
+				const vector4f vertex0 = vector_set(vertex0_x[index], vertex0_y[index], vertex0_z[index]);
+				const vector4f vertex1 = vector_set(vertex1_x[index], vertex1_y[index], vertex1_z[index]);
+				CHECK(scalar_near_equal(distances_sq[index], float(segment_segment_distance_squared(point, end, vertex0, vertex1)), threshold));
+			}
+		}
+
+		float distances_sq[num_primitives];
+		closest_point_on_segments_soa(point, vertices0, vertices1, closest_points, num_primitives);
+		for (uint32_t index = 0; index < num_primitives; ++index)
+		{
+			const vector4f vertex0 = vector_set(vertex0_x[index], vertex0_y[index], vertex0_z[index]);
+			const vector4f vertex1 = vector_set(vertex1_x[index], vertex1_y[index], vertex1_z[index]);
+			const vector4f closest = vector_set(closest_x[index], closest_y[index], closest_z[index]);
+			CHECK(vector_all_near_equal3(closest, closest_point_on_segment(point, vertex0, vertex1), threshold));
+		}
+
+		// The last entry is a degenerate triangle
+		const uint32_t num_triangles = num_primitives - 1;
+
+		point_triangle_distance_squared_soa(point, vertices0, vertices1, vertices2, distances_sq, num_triangles);
+		closest_point_on_triangles_soa(point, vertices0, vertices1, vertices2, closest_points, num_triangles);
+		for (uint32_t index = 0; index < num_triangles; ++index)
+		{
+			const vector4f vertex0 = vector_set(vertex0_x[index], vertex0_y[index], vertex0_z[index]);
+			const vector4f vertex1 = vector_set(vertex1_x[index], vertex1_y[index], vertex1_z[index]);
+			const vector4f vertex2 = vector_set(vertex2_x[index], vertex2_y[index], vertex2_z[index]);
+			const vector4f closest = vector_set(closest_x[index], closest_y[index], closest_z[index]);
+			CHECK(scalar_near_equal(distances_sq[index], float(point_triangle_distance_squared(point, vertex0, vertex1, vertex2)), threshold));
+			CHECK(vector_all_near_equal3(closest, closest_point_on_triangle(point, vertex0, vertex1, vertex2), threshold));
+		}
+	}
+}
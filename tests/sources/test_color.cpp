@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/color.h>
+#include <rtm/batch/color.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+using namespace rtm;
+
+static double reference_srgb_to_linear(double value)
+{
+	return value <= 0.04045 ? (value / 12.92) : std::pow((value + 0.055) / 1.055, 2.4);
+}
+
+static double reference_linear_to_srgb(double value)
+{
+	return value <= 0.0031308 ? (value * 12.92) : (1.055 * std::pow(value, 1.0 / 2.4) - 0.055);
+}
+
+TEST_CASE("color srgb", "[math][color]")
+{
+	{
+		double max_relative_error = 0.0;
+		double max_absolute_error = 0.0;
+		for (uint32_t value_index = 0; value_index <= 65536; ++value_index)
+		{
+			const float value = float(value_index) / 65536.0F;
+			const double reference_linear = reference_srgb_to_linear(value);
+			const double reference_srgb = reference_linear_to_srgb(value);
+
+			const float linear = vector_get_x(vector_srgb_to_linear(vector_set(value)));
+			const float srgb = vector_get_x(vector_linear_to_srgb(vector_set(value)));
+
+			if (reference_linear > 0.0)
+				max_relative_error = std::fmax(max_relative_error, std::fabs(linear - reference_linear) / reference_linear);
+			max_absolute_error = std::fmax(max_absolute_error, std::fabs(srgb - reference_srgb));
+		}
+
+		CHECK(max_relative_error < 2.5E-6);
+		CHECK(max_absolute_error < 2.0E-6);
+	}
+
+	// Inputs are clamped, every component is converted
+	CHECK(vector_all_near_equal(vector_srgb_to_linear(vector_set(-1.0F, 0.0F, 1.0F, 2.0F)), vector_set(0.0F, 0.0F, 1.0F, 1.0F), 2.5E-6F));
+	CHECK(vector_all_near_equal(vector_linear_to_srgb(vector_set(-1.0F, 0.0F, 1.0F, 2.0F)), vector_set(0.0F, 0.0F, 1.0F, 1.0F), 2.5E-6F));
+
+	// The alpha is kept
+	const vector4f color = vector_set(0.2F, 0.5F, 0.8F, 0.3F);
+	const vector4f linear = color_srgb_to_linear(color);
+	CHECK(scalar_near_equal(vector_get_x(linear), float(reference_srgb_to_linear(0.2)), 1.0E-6F));
+	CHECK(scalar_near_equal(vector_get_z(linear), float(reference_srgb_to_linear(0.8)), 1.0E-6F));
+	CHECK(vector_get_w(linear) == 0.3F);
+	CHECK(vector_all_near_equal(color_linear_to_srgb(linear), color, 1.0E-5F));
+	CHECK(vector_get_w(color_linear_to_srgb(linear)) == 0.3F);
+
+	{
+		// Every 8 bit value survives a round trip, and encoding rounds to the nearest value
+		uint8_t srgb8[256 * 4];
+		for (uint32_t value = 0; value < 256; ++value)
+		{
+			srgb8[value * 4 + 0] = uint8_t(value);
+			srgb8[value * 4 + 1] = uint8_t(255 - value);
+			srgb8[value * 4 + 2] = uint8_t((value * 7) & 255);
+			srgb8[value * 4 + 3] = uint8_t(value);
+		}
+
+		// An odd count exercises the last partial group
+		const uint32_t num_pixels = 255;
+		float4f linear_pixels[256];
+		uint8_t round_trip[256 * 4];
+		color_srgb8_to_linear(srgb8, linear_pixels, num_pixels);
+		color_linear_to_srgb8(linear_pixels, round_trip, num_pixels);
+
+		for (uint32_t pixel_index = 0; pixel_index < num_pixels; ++pixel_index)
+		{
+			CHECK(scalar_near_equal(linear_pixels[pixel_index].x, float(reference_srgb_to_linear(pixel_index / 255.0)), 2.5E-6F));
+			CHECK(scalar_near_equal(linear_pixels[pixel_index].w, pixel_index / 255.0F, 1.0E-6F));
+
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+				CHECK(round_trip[pixel_index * 4 + component_index] == srgb8[pixel_index * 4 + component_index]);
+		}
+
+		// Premultiplied pixels are unpremultiplied before they are encoded
+		color_srgb8_to_linear_premultiplied(srgb8, linear_pixels, num_pixels);
+		CHECK(linear_pixels[0].x == 0.0F);
+		CHECK(scalar_near_equal(linear_pixels[128].y, float(reference_srgb_to_linear(127 / 255.0)) * (128.0F / 255.0F), 1.0E-6F));
+
+		color_linear_premultiplied_to_srgb8(linear_pixels, round_trip, num_pixels);
+		for (uint32_t pixel_index = 1; pixel_index < num_pixels; ++pixel_index)
+		{
+			// The smallest alphas lose precision once multiplied
+			if (pixel_index >= 16)
+			{
+				for (uint32_t component_index = 0; component_index < 4; ++component_index)
+					CHECK(round_trip[pixel_index * 4 + component_index] == srgb8[pixel_index * 4 + component_index]);
+			}
+		}
+
+		// Fully transparent pixels are black
+		CHECK(round_trip[0] == 0);
+		CHECK(round_trip[1] == 0);
+		CHECK(round_trip[2] == 0);
+		CHECK(round_trip[3] == 0);
+	}
+}
+
+TEST_CASE("color premultiply", "[math][color]")
+{
+	const vector4f color = vector_set(0.2F, 0.5F, 0.8F, 0.25F);
+	const vector4f premultiplied = color_premultiply(color);
+	CHECK(vector_all_near_equal(premultiplied, vector_set(0.05F, 0.125F, 0.2F, 0.25F), 1.0E-6F));
+	CHECK(vector_all_near_equal(color_unpremultiply(premultiplied), color, 1.0E-6F));
+	CHECK(vector_all_near_equal(color_unpremultiply(vector_set(0.5F, 0.5F, 0.5F, 0.0F)), vector_zero(), 0.0F));
+}
+
+TEST_CASE("color ycocg", "[math][color]")
+{
+	const vector4f color = vector_set(0.2F, 0.5F, 0.8F, 0.3F);
+	const vector4f ycocg = color_rgb_to_ycocg(color);
+	CHECK(vector_all_near_equal(ycocg, vector_set(0.5F, -0.3F, 0.0F, 0.3F), 1.0E-6F));
+	CHECK(vector_all_near_equal(color_ycocg_to_rgb(ycocg), color, 1.0E-6F));
+
+	// Gray has no chroma
+	CHECK(vector_all_near_equal(color_rgb_to_ycocg(vector_set(0.4F, 0.4F, 0.4F, 1.0F)), vector_set(0.4F, 0.0F, 0.0F, 1.0F), 1.0E-6F));
+
+	const uint32_t num_pixels = 1023;
+	uint8_t pixels[1024 * 4];
+	for (uint32_t value_index = 0; value_index < 1024 * 4; ++value_index)
+		pixels[value_index] = uint8_t((value_index * 2654435761U) >> 24);
+
+	// Gray pixels have a chroma of 128
+	pixels[0] = pixels[1] = pixels[2] = 77;
+
+	uint8_t ycocg8[1024 * 4];
+	uint8_t round_trip[1024 * 4];
+	color_rgba8_to_ycocg8(pixels, ycocg8, num_pixels);
+	color_ycocg8_to_rgba8(ycocg8, round_trip, num_pixels);
+
+	CHECK(ycocg8[0] == 77);
+	CHECK(ycocg8[1] == 128);
+	CHECK(ycocg8[2] == 128);
+
+	for (uint32_t pixel_index = 0; pixel_index < num_pixels; ++pixel_index)
+	{
+		for (uint32_t component_index = 0; component_index < 3; ++component_index)
+			CHECK(std::abs(int32_t(round_trip[pixel_index * 4 + component_index]) - int32_t(pixels[pixel_index * 4 + component_index])) <= 1);
+
+		CHECK(ycocg8[pixel_index * 4 + 3] == pixels[pixel_index * 4 + 3]);
+		CHECK(round_trip[pixel_index * 4 + 3] == pixels[pixel_index * 4 + 3]);
+	}
+
+	// In place
+	color_rgba8_to_ycocg8(pixels, pixels, num_pixels);
+	for (uint32_t value_index = 0; value_index < num_pixels * 4; ++value_index)
+		CHECK(pixels[value_index] == ycocg8[value_index]);
+}
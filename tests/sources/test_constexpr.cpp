@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+namespace
+{
+	// Everything below is evaluated at compile time
+	constexpr vector4f k_vector_a = vector_set(1.0F, -2.0F, 3.5F, 0.25F);
+	constexpr vector4f k_vector_b = vector_set(-0.5F, 4.0F, 2.0F, 8.0F);
+	constexpr vector4f k_vector_add = vector_add(k_vector_a, k_vector_b);
+	constexpr vector4f k_vector_mul_add = vector_mul_add(k_vector_a, k_vector_b, vector_set(1.0F));
+	constexpr vector4f k_vector_cross3 = vector_cross3(k_vector_a, k_vector_b);
+	constexpr float k_vector_dot = vector_dot(k_vector_a, k_vector_b);
+	constexpr float k_vector_dot3 = vector_dot3(k_vector_a, k_vector_b);
+	constexpr vector4f k_vector_swizzle = vector_swizzle<mix4::w, mix4::z, mix4::y, mix4::x>(k_vector_a);
+	constexpr vector4f k_vector_shuffle = vector_shuffle<mix4::y, mix4::x, mix4::d, mix4::c>(k_vector_a, k_vector_b);
+
+	constexpr vector4f k_axis_z = vector_set(0.0F, 0.0F, 1.0F);
+	constexpr float k_angle = 1.2F;
+	constexpr quatf k_rotation_z = quat_from_axis_angle(k_axis_z, k_angle);
+	constexpr quatf k_rotation_x = quat_from_axis_angle(vector_set(1.0F, 0.0F, 0.0F), -2.7F);
+	constexpr quatf k_rotation = quat_mul(k_rotation_z, k_rotation_x);
+	constexpr vector4f k_rotated = quat_mul_vector3(k_vector_a, k_rotation);
+
+	constexpr qvvf k_transform = qvv_set(k_rotation, k_vector_b, vector_set(1.5F, 2.0F, 0.5F));
+	constexpr vector4f k_transformed = qvv_mul_point3(k_vector_a, k_transform);
+	constexpr matrix3x4f k_matrix = matrix_from_qvv(k_transform);
+	constexpr matrix3x4f k_matrix_mul = matrix_mul(k_matrix, matrix_from_translation(k_vector_a));
+	constexpr vector4f k_matrix_transformed = matrix_mul_point3(k_vector_a, k_matrix);
+
+	// Lookup tables can be baked into the binary
+	constexpr vector4f k_directions[] =
+	{
+		quat_mul_vector3(vector_set(1.0F, 0.0F, 0.0F), quat_from_axis_angle(k_axis_z, 0.0F)),
+		quat_mul_vector3(vector_set(1.0F, 0.0F, 0.0F), quat_from_axis_angle(k_axis_z, 1.5707963F)),
+		quat_mul_vector3(vector_set(1.0F, 0.0F, 0.0F), quat_from_axis_angle(k_axis_z, 3.1415926F)),
+	};
+
+	static_assert(vector_get_x(k_vector_add) == 0.5F, "Unexpected constexpr vector_add result");
+	static_assert(vector_get_w(k_vector_mul_add) == 3.0F, "Unexpected constexpr vector_mul_add result");
+	static_assert(k_vector_dot == -0.5F - 8.0F + 7.0F + 2.0F, "Unexpected constexpr vector_dot result");
+	static_assert(k_vector_dot3 == -0.5F - 8.0F + 7.0F, "Unexpected constexpr vector_dot3 result");
+	static_assert(vector_get_x(k_vector_swizzle) == vector_get_w(k_vector_a), "Unexpected constexpr vector_swizzle result");
+	static_assert(vector_get_w(k_vector_shuffle) == vector_get_z(k_vector_b), "Unexpected constexpr vector_shuffle result");
+	static_assert(quat_get_w(quatf(quat_identity())) == 1.0F, "Unexpected constexpr quat_identity result");
+	static_assert(vector_get_w(matrix3x4f(matrix_identity()).w_axis) == 1.0F, "Unexpected constexpr matrix_identity result");
+	static_assert(quat_is_normalized(k_rotation), "Constexpr quat_mul result is not normalized");
+}
+#endif
+
+TEST_CASE("constexpr evaluation", "[math][constexpr]")
+{
+#if defined(RTM_CONSTEXPR_EVAL_SUPPORTED)
+	// The compile time results must match the runtime ones
+	const float threshold = 1.0E-6F;
+
+	const vector4f vector_a = vector_set(1.0F, -2.0F, 3.5F, 0.25F);
+	const vector4f vector_b = vector_set(-0.5F, 4.0F, 2.0F, 8.0F);
+	CHECK(vector_all_near_equal(k_vector_add, vector_add(vector_a, vector_b), threshold));
+	CHECK(vector_all_near_equal(k_vector_mul_add, vector_mul_add(vector_a, vector_b, vector_set(1.0F)), threshold));
+	CHECK(vector_all_near_equal3(k_vector_cross3, vector_cross3(vector_a, vector_b), threshold));
+	CHECK(scalar_near_equal(k_vector_dot, float(vector_dot(vector_a, vector_b)), threshold));
+	CHECK(scalar_near_equal(k_vector_dot3, float(vector_dot3(vector_a, vector_b)), threshold));
+	CHECK(vector_all_near_equal(k_vector_swizzle, vector_swizzle<mix4::w, mix4::z, mix4::y, mix4::x>(vector_a), threshold));
+	CHECK(vector_all_near_equal(k_vector_shuffle, vector_shuffle<mix4::y, mix4::x, mix4::d, mix4::c>(vector_a, vector_b), threshold));
+
+	const vector4f axis_z = vector_set(0.0F, 0.0F, 1.0F);
+	const quatf rotation = quat_mul(quat_from_axis_angle(axis_z, 1.2F), quat_from_axis_angle(vector_set(1.0F, 0.0F, 0.0F), -2.7F));
+	CHECK(quat_near_equal(k_rotation_z, quat_from_axis_angle(axis_z, 1.2F), threshold));
+	CHECK(quat_near_equal(k_rotation, rotation, threshold));
+
+	// With SSE2, quat_mul_vector3 uses the cross product form which differs by a few ulp at runtime
+	const float rotation_threshold = 2.0E-6F;
+	CHECK(vector_all_near_equal3(k_rotated, quat_mul_vector3(vector_a, rotation), rotation_threshold));
+
+	const qvvf transform = qvv_set(rotation, vector_b, vector_set(1.5F, 2.0F, 0.5F));
+	CHECK(vector_all_near_equal3(k_transformed, qvv_mul_point3(vector_a, transform), threshold));
+
+	const matrix3x4f matrix = matrix_from_qvv(transform);
+	CHECK(vector_all_near_equal(k_matrix.x_axis, matrix.x_axis, threshold));
+	CHECK(vector_all_near_equal(k_matrix.y_axis, matrix.y_axis, threshold));
+	CHECK(vector_all_near_equal(k_matrix.z_axis, matrix.z_axis, threshold));
+	CHECK(vector_all_near_equal(k_matrix.w_axis, matrix.w_axis, threshold));
+
+	const matrix3x4f matrix_mul_result = matrix_mul(matrix, matrix_from_translation(vector_a));
+	CHECK(vector_all_near_equal(k_matrix_mul.x_axis, matrix_mul_result.x_axis, threshold));
+	CHECK(vector_all_near_equal(k_matrix_mul.y_axis, matrix_mul_result.y_axis, threshold));
+	CHECK(vector_all_near_equal(k_matrix_mul.z_axis, matrix_mul_result.z_axis, threshold));
+	CHECK(vector_all_near_equal(k_matrix_mul.w_axis, matrix_mul_result.w_axis, threshold));
+	CHECK(vector_all_near_equal3(k_matrix_transformed, matrix_mul_point3(vector_a, matrix), threshold));
+
+	CHECK(vector_all_near_equal3(k_directions[0], vector_set(1.0F, 0.0F, 0.0F), threshold));
+	CHECK(vector_all_near_equal3(k_directions[1], vector_set(0.0F, 1.0F, 0.0F), threshold));
+	CHECK(vector_all_near_equal3(k_directions[2], vector_set(-1.0F, 0.0F, 0.0F), threshold));
+#endif
+}
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "test_determinism.h"
+
+#include <catch.hpp>
+
+#include <rtm/batch/dispatch.h>
+
+#include <cstring>
+
+using namespace rtm;
+
+namespace
+{
+	void check_identical_results(const determinism_results& reference, const determinism_results& results)
+	{
+		REQUIRE(reference.size() == results.size());
+
+		for (size_t result_index = 0; result_index < reference.size(); ++result_index)
+		{
+			const determinism_result& expected = reference[result_index];
+			const determinism_result& actual = results[result_index];
+
+			INFO("Function: " << expected.function_name << ", input: " << expected.input_index);
+			REQUIRE(std::strcmp(expected.function_name, actual.function_name) == 0);
+			CHECK(expected.bits[0] == actual.bits[0]);
+			CHECK(expected.bits[1] == actual.bits[1]);
+			CHECK(expected.bits[2] == actual.bits[2]);
+			CHECK(expected.bits[3] == actual.bits[3]);
+		}
+	}
+}
+
+TEST_CASE("deterministic mode", "[math][determinism]")
+{
+	// Every variant is compiled with RTM_DETERMINISTIC for a different instruction set
+	// and must produce the same bits as the scalar code path
+	determinism_results reference;
+	compute_determinism_results_scalar(reference);
+	REQUIRE_FALSE(reference.empty());
+
+	determinism_results results;
+
+	SECTION("default")
+	{
+		compute_determinism_results_default(results);
+		check_identical_results(reference, results);
+	}
+
+	SECTION("sse4")
+	{
+		if (cpu_supports(cpu_isa::sse4))
+		{
+			compute_determinism_results_sse4(results);
+			check_identical_results(reference, results);
+		}
+	}
+
+	SECTION("avx2")
+	{
+		if (cpu_supports(cpu_isa::avx2))
+		{
+			compute_determinism_results_avx2(results);
+			check_identical_results(reference, results);
+		}
+	}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <vector>
+
+// The deterministic math mode (RTM_DETERMINISTIC) must produce bit identical results
+// regardless of the instruction set. The same functions are evaluated by translation
+// units compiled for different instruction sets, see test_determinism_impl.h, and
+// their raw bits are compared.
+
+struct determinism_result
+{
+	const char* function_name;
+	uint32_t input_index;
+	uint32_t bits[4];
+};
+
+using determinism_results = std::vector<determinism_result>;
+
+void compute_determinism_results_scalar(determinism_results& out_results);
+void compute_determinism_results_default(determinism_results& out_results);
+void compute_determinism_results_sse4(determinism_results& out_results);
+void compute_determinism_results_avx2(determinism_results& out_results);
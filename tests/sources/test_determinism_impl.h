@@ -0,0 +1,384 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Included by the test_determinism_*.cpp translation units, each compiled for a different
+// instruction set. Like rtm/batch/dispatch_variant.h, the rtm namespace is renamed so that
+// the inline functions compiled here do not collide with the rest of the unit tests.
+
+#if !defined(RTM_IMPL_DETERMINISM_VARIANT)
+	#error "RTM_IMPL_DETERMINISM_VARIANT must be defined"
+#endif
+
+#define RTM_DETERMINISTIC
+
+// Standard headers included by RTM are included first so they are not affected by the renaming
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+#include "test_determinism.h"
+
+#define RTM_IMPL_DETERMINISM_CONCAT_IMPL(prefix, suffix) prefix ## suffix
+#define RTM_IMPL_DETERMINISM_CONCAT(prefix, suffix) RTM_IMPL_DETERMINISM_CONCAT_IMPL(prefix, suffix)
+
+#define rtm RTM_IMPL_DETERMINISM_CONCAT(rtm_determinism_, RTM_IMPL_DETERMINISM_VARIANT)
+
+#include "rtm/matrix3x4f.h"
+#include "rtm/matrix4x4f.h"
+#include "rtm/quatf.h"
+#include "rtm/quatfx.h"
+#include "rtm/qvvf.h"
+#include "rtm/scalarf.h"
+#include "rtm/vector4f.h"
+#include "rtm/vector4fx.h"
+#include "rtm/batch/quatf.h"
+#include "rtm/batch/vector4f.h"
+
+namespace
+{
+	using namespace rtm;
+
+	constexpr uint32_t k_num_determinism_inputs = 64;
+
+	// A simple integer hash keeps the inputs identical in every translation unit
+	float get_input(uint32_t input_index, uint32_t component_index, float range)
+	{
+		uint32_t hash = (input_index + 1) * 747796405U + component_index * 2891336453U;
+		hash = ((hash >> ((hash >> 28) + 4)) ^ hash) * 277803737U;
+		hash = (hash >> 22) ^ hash;
+
+		return ((float(hash >> 8) * (1.0F / 16777216.0F)) * 2.0F - 1.0F) * range;
+	}
+
+	vector4f get_input_vector(uint32_t input_index, uint32_t seed, float range)
+	{
+		return vector_set(get_input(input_index, seed, range), get_input(input_index, seed + 1, range), get_input(input_index, seed + 2, range), get_input(input_index, seed + 3, range));
+	}
+
+	quatf get_input_quat(uint32_t input_index, uint32_t seed)
+	{
+		return quat_from_euler(get_input(input_index, seed, 3.1F), get_input(input_index, seed + 1, 3.1F), get_input(input_index, seed + 2, 3.1F));
+	}
+
+	qvvf get_input_qvv(uint32_t input_index, uint32_t seed)
+	{
+		const vector4f scale = vector_add(vector_abs(get_input_vector(input_index, seed + 3, 2.0F)), vector_set(0.1F));
+		return qvv_set(get_input_quat(input_index, seed), get_input_vector(input_index, seed + 7, 100.0F), scale);
+	}
+
+	void record(determinism_results& results, const char* function_name, uint32_t input_index, vector4f_arg0 value)
+	{
+		float values[4];
+		vector_store(value, &values[0]);
+
+		determinism_result result;
+		result.function_name = function_name;
+		result.input_index = input_index;
+		std::memcpy(&result.bits[0], &values[0], sizeof(values));
+		results.push_back(result);
+	}
+
+	void record(determinism_results& results, const char* function_name, uint32_t input_index, vector4i_arg0 value)
+	{
+		int32_t values[4];
+		vector_store(value, &values[0]);
+
+		determinism_result result;
+		result.function_name = function_name;
+		result.input_index = input_index;
+		std::memcpy(&result.bits[0], &values[0], sizeof(values));
+		results.push_back(result);
+	}
+
+	void record(determinism_results& results, const char* function_name, uint32_t input_index, vector4fx_arg0 value)
+	{
+		record(results, function_name, input_index, vector_fx_to_raw(value));
+	}
+
+	void record(determinism_results& results, const char* function_name, uint32_t input_index, quatfx_arg0 value)
+	{
+		record(results, function_name, input_index, quat_fx_to_raw(value));
+	}
+
+	void record(determinism_results& results, const char* function_name, uint32_t input_index, float value)
+	{
+		record(results, function_name, input_index, vector_set(value, 0.0F, 0.0F, 0.0F));
+	}
+
+	void record(determinism_results& results, const char* function_name, uint32_t input_index, const matrix3x4f& value)
+	{
+		record(results, function_name, input_index, value.x_axis);
+		record(results, function_name, input_index, value.y_axis);
+		record(results, function_name, input_index, value.z_axis);
+		record(results, function_name, input_index, value.w_axis);
+	}
+
+	void record(determinism_results& results, const char* function_name, uint32_t input_index, const matrix4x4f& value)
+	{
+		record(results, function_name, input_index, value.x_axis);
+		record(results, function_name, input_index, value.y_axis);
+		record(results, function_name, input_index, value.z_axis);
+		record(results, function_name, input_index, value.w_axis);
+	}
+
+	void record(determinism_results& results, const char* function_name, uint32_t input_index, const qvvf& value)
+	{
+		record(results, function_name, input_index, quat_to_vector(value.rotation));
+		record(results, function_name, input_index, value.translation);
+		record(results, function_name, input_index, value.scale);
+	}
+
+	void compute_scalar_results(determinism_results& results, uint32_t input_index)
+	{
+		const float value = get_input(input_index, 0, 10.0F);
+		const float positive_value = std::abs(value) + 0.001F;
+		const float angle = get_input(input_index, 1, 6.0F);
+		const float unit_value = get_input(input_index, 2, 1.0F);
+
+		record(results, "scalar_sqrt", input_index, scalar_sqrt(positive_value));
+		record(results, "scalar_sqrt_reciprocal", input_index, scalar_sqrt_reciprocal(positive_value));
+		record(results, "scalar_reciprocal", input_index, scalar_reciprocal(value));
+		record(results, "scalar_mul_add", input_index, scalar_mul_add(value, angle, unit_value));
+		record(results, "scalar_neg_mul_sub", input_index, scalar_neg_mul_sub(value, angle, unit_value));
+		record(results, "scalar_lerp", input_index, scalar_lerp(value, angle, unit_value));
+		record(results, "scalar_floor", input_index, scalar_floor(value));
+		record(results, "scalar_ceil", input_index, scalar_ceil(value));
+		record(results, "scalar_round_bankers", input_index, scalar_round_bankers(value * 4.0F));
+		record(results, "scalar_round_symmetric", input_index, scalar_round_symmetric(value * 4.0F));
+		record(results, "scalar_sin", input_index, scalar_sin(angle));
+		record(results, "scalar_cos", input_index, scalar_cos(angle));
+		record(results, "scalar_tan", input_index, scalar_tan(angle));
+		record(results, "scalar_asin", input_index, scalar_asin(unit_value));
+		record(results, "scalar_acos", input_index, scalar_acos(unit_value));
+		record(results, "scalar_atan", input_index, scalar_atan(value));
+		record(results, "scalar_atan2", input_index, scalar_atan2(value, angle));
+
+		// [zw] are undefined
+		const vector4f sincos = scalar_sincos(angle);
+		record(results, "scalar_sincos", input_index, vector_set(vector_get_x(sincos), vector_get_y(sincos), 0.0F, 0.0F));
+	}
+
+	void compute_vector_results(determinism_results& results, uint32_t input_index)
+	{
+		const vector4f value0 = get_input_vector(input_index, 0, 10.0F);
+		const vector4f value1 = get_input_vector(input_index, 4, 10.0F);
+		const vector4f angles = get_input_vector(input_index, 8, 6.0F);
+		const vector4f unit_values = get_input_vector(input_index, 12, 1.0F);
+		const vector4f positive_values = vector_add(vector_abs(value0), vector_set(0.001F));
+
+		record(results, "vector_mul_add", input_index, vector_mul_add(value0, value1, unit_values));
+		record(results, "vector_neg_mul_sub", input_index, vector_neg_mul_sub(value0, value1, unit_values));
+		record(results, "vector_lerp", input_index, vector_lerp(value0, value1, 0.3F));
+		record(results, "vector_div", input_index, vector_div(value0, value1));
+		record(results, "vector_reciprocal", input_index, vector_reciprocal(value1));
+		record(results, "vector_sqrt", input_index, vector_sqrt(positive_values));
+		record(results, "vector_sqrt_reciprocal", input_index, vector_sqrt_reciprocal(positive_values));
+		record(results, "vector_sqrt_reciprocal_estimate", input_index, vector_sqrt_reciprocal_estimate<1>(positive_values));
+		record(results, "vector_reciprocal_estimate", input_index, vector_reciprocal_estimate<1>(value1));
+		record(results, "vector_dot", input_index, float(vector_dot(value0, value1)));
+		record(results, "vector_dot_vector", input_index, vector4f(vector_dot(value0, value1)));
+		record(results, "vector_dot3", input_index, float(vector_dot3(value0, value1)));
+		record(results, "vector_length", input_index, float(vector_length(value0)));
+		record(results, "vector_length3", input_index, float(vector_length3(value0)));
+		record(results, "vector_length_reciprocal", input_index, float(vector_length_reciprocal(value0)));
+		record(results, "vector_length_reciprocal3", input_index, float(vector_length_reciprocal3(value0)));
+		record(results, "vector_normalize3", input_index, vector_normalize3(value0));
+		record(results, "vector_cross3", input_index, vector_cross3(value0, value1));
+		record(results, "vector_floor", input_index, vector_floor(value0));
+		record(results, "vector_ceil", input_index, vector_ceil(value0));
+		record(results, "vector_fraction", input_index, vector_fraction(value0));
+		record(results, "vector_round_bankers", input_index, vector_round_bankers(vector_mul(value0, 4.0F)));
+		record(results, "vector_round_symmetric", input_index, vector_round_symmetric(vector_mul(value0, 4.0F)));
+		record(results, "vector_sin", input_index, vector_sin(angles));
+		record(results, "vector_cos", input_index, vector_cos(angles));
+		record(results, "vector_tan", input_index, vector_tan(angles));
+		record(results, "vector_asin", input_index, vector_asin(unit_values));
+		record(results, "vector_acos", input_index, vector_acos(unit_values));
+		record(results, "vector_atan", input_index, vector_atan(value0));
+		record(results, "vector_atan2", input_index, vector_atan2(value0, value1));
+		record(results, "vector_exp", input_index, vector_exp(unit_values));
+		record(results, "vector_log", input_index, vector_log(positive_values));
+		record(results, "vector_pow", input_index, vector_pow(positive_values, unit_values));
+
+		vector4f sin;
+		vector4f cos;
+		vector_sincos(angles, sin, cos);
+		record(results, "vector_sincos", input_index, sin);
+		record(results, "vector_sincos", input_index, cos);
+	}
+
+	void compute_transform_results(determinism_results& results, uint32_t input_index)
+	{
+		const quatf rotation0 = get_input_quat(input_index, 0);
+		const quatf rotation1 = get_input_quat(input_index, 3);
+		const vector4f point = get_input_vector(input_index, 6, 100.0F);
+		const qvvf transform0 = get_input_qvv(input_index, 10);
+		const qvvf transform1 = get_input_qvv(input_index, 20);
+		const matrix3x4f matrix0 = matrix_from_qvv(transform0);
+		const matrix3x4f matrix1 = matrix_from_qvv(transform1);
+		const matrix4x4f matrix4x4 = matrix_cast(matrix0);
+
+		record(results, "quat_from_euler", input_index, quat_to_vector(rotation0));
+		record(results, "quat_mul", input_index, quat_to_vector(quat_mul(rotation0, rotation1)));
+		record(results, "quat_mul_vector3", input_index, quat_mul_vector3(point, rotation0));
+		record(results, "quat_normalize", input_index, quat_to_vector(quat_normalize(vector_to_quat(vector_mul(quat_to_vector(rotation0), 1.01F)))));
+		record(results, "quat_length", input_index, quat_length(rotation0));
+		record(results, "quat_length_reciprocal", input_index, quat_length_reciprocal(rotation0));
+		record(results, "quat_lerp", input_index, quat_to_vector(quat_lerp(rotation0, rotation1, 0.3F)));
+		record(results, "quat_slerp", input_index, quat_to_vector(quat_slerp(rotation0, rotation1, 0.3F)));
+		record(results, "quat_slerp_fast", input_index, quat_to_vector(quat_slerp_fast(rotation0, rotation1, 0.3F)));
+		record(results, "quat_get_angle", input_index, quat_get_angle(rotation0));
+		record(results, "quat_exp", input_index, quat_to_vector(quat_exp(quat_log(rotation0))));
+
+		float pitch;
+		float yaw;
+		float roll;
+		quat_to_euler(rotation0, pitch, yaw, roll);
+		record(results, "quat_to_euler", input_index, vector_set(pitch, yaw, roll, 0.0F));
+
+		record(results, "quat_from_matrix", input_index, quat_to_vector(quat_from_matrix(matrix0)));
+		record(results, "matrix_from_quat", input_index, matrix_from_quat(rotation0));
+		record(results, "matrix_mul", input_index, matrix_mul(matrix0, matrix1));
+		record(results, "matrix_mul_point3", input_index, matrix_mul_point3(point, matrix0));
+		record(results, "matrix_inverse", input_index, matrix_inverse(matrix0));
+		record(results, "matrix_mul_4x4", input_index, matrix_mul(matrix4x4, matrix4x4));
+		record(results, "matrix_inverse_4x4", input_index, matrix_inverse(matrix4x4));
+		record(results, "qvv_mul", input_index, qvv_mul(transform0, transform1));
+		record(results, "qvv_mul_point3", input_index, qvv_mul_point3(point, transform0));
+		record(results, "qvv_inverse", input_index, qvv_inverse(transform0));
+	}
+
+	void compute_fixed_point_results(determinism_results& results, uint32_t input_index)
+	{
+		// Fixed point math is exact integer arithmetic and matches even without RTM_DETERMINISTIC
+		const vector4fx vector0 = vector_to_fx(get_input_vector(input_index, 0, 50.0F));
+		const vector4fx vector1 = vector_to_fx(get_input_vector(input_index, 4, 50.0F));
+		const vector4fx angles = vector_to_fx(get_input_vector(input_index, 8, 1000.0F));
+		const quatfx rotation0 = quat_to_fx(get_input_quat(input_index, 12));
+		const quatfx rotation1 = quat_to_fx(get_input_quat(input_index, 15));
+		const quatfx unnormalized_rotation = quat_fx_from_raw(vector_fx_to_raw(vector_to_fx(get_input_vector(input_index, 18, 2.0F))));
+
+		vector4fx sine;
+		vector4fx cosine;
+		vector_sincos(angles, sine, cosine);
+
+		record(results, "vector_mul fx", input_index, vector_mul(vector0, vector1));
+		record(results, "vector_dot fx", input_index, vector_set(vector_dot(vector0, vector1), vector_dot3(vector0, vector1), 0, 0));
+		record(results, "vector_cross3 fx", input_index, vector_cross3(vector0, vector1));
+		record(results, "vector_normalize3 fx", input_index, vector_normalize3(vector0));
+		record(results, "vector_sincos sin fx", input_index, sine);
+		record(results, "vector_sincos cos fx", input_index, cosine);
+		record(results, "quat_mul fx", input_index, quat_mul(rotation0, rotation1));
+		record(results, "quat_mul_vector3 fx", input_index, quat_mul_vector3(vector0, rotation0));
+		record(results, "quat_normalize fx", input_index, quat_normalize(unnormalized_rotation));
+		record(results, "quat_from_axis_angle fx", input_index, quat_from_axis_angle(vector_normalize3(vector1), vector_get_x(vector_fx_to_raw(angles))));
+	}
+
+	void compute_batch_results(determinism_results& results)
+	{
+		// Not a multiple of any SIMD width to exercise the remainder loops
+		constexpr uint32_t num_values = k_num_determinism_inputs - 3;
+
+		float lhs[4][k_num_determinism_inputs];
+		float rhs[4][k_num_determinism_inputs];
+		float output[4][k_num_determinism_inputs];
+		float alphas[k_num_determinism_inputs];
+
+		for (uint32_t input_index = 0; input_index < num_values; ++input_index)
+		{
+			float lhs_value[4];
+			float rhs_value[4];
+			quat_store(get_input_quat(input_index, 0), &lhs_value[0]);
+			vector_store(vector_mul(quat_to_vector(get_input_quat(input_index, 3)), 1.01F), &rhs_value[0]);
+
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			{
+				lhs[component_index][input_index] = lhs_value[component_index];
+				rhs[component_index][input_index] = rhs_value[component_index];
+			}
+
+			alphas[input_index] = get_input(input_index, 7, 1.0F);
+		}
+
+		const const_float4f_soa lhs_soa{ lhs[0], lhs[1], lhs[2], lhs[3] };
+		const const_float4f_soa rhs_soa{ rhs[0], rhs[1], rhs[2], rhs[3] };
+		const float4f_soa output_soa{ output[0], output[1], output[2], output[3] };
+		const float3f_soa output3_soa{ output[0], output[1], output[2] };
+
+		auto record_soa = [&](const char* function_name)
+		{
+			for (uint32_t input_index = 0; input_index < num_values; ++input_index)
+				record(results, function_name, input_index, vector_set(output[0][input_index], output[1][input_index], output[2][input_index], output[3][input_index]));
+		};
+
+		quat_mul_soa(lhs_soa, rhs_soa, output_soa, num_values);
+		record_soa("quat_mul_soa");
+
+		quat_lerp_soa(lhs_soa, rhs_soa, alphas, output_soa, num_values);
+		record_soa("quat_lerp_soa");
+
+		quat_slerp_fast_soa(lhs_soa, rhs_soa, alphas, output_soa, num_values);
+		record_soa("quat_slerp_fast_soa");
+
+		quat_normalize_soa(rhs_soa, output_soa, num_values, normalize_precision::estimate);
+		record_soa("quat_normalize_soa estimate");
+
+		quat_normalize_soa(rhs_soa, output_soa, num_values, normalize_precision::exact);
+		record_soa("quat_normalize_soa exact");
+
+		std::memset(output, 0, sizeof(output));
+		vector_normalize3_soa(const_float3f_soa{ rhs[0], rhs[1], rhs[2] }, output3_soa, num_values, normalize_precision::refined);
+		record_soa("vector_normalize3_soa refined");
+
+		vector_atan2_array(lhs[0], rhs[1], output[0], num_values);
+		vector_acos_array(lhs[2], output[1], num_values);
+		record_soa("vector_atan2_array vector_acos_array");
+	}
+}
+
+#undef rtm
+
+void RTM_IMPL_DETERMINISM_CONCAT(compute_determinism_results_, RTM_IMPL_DETERMINISM_VARIANT)(determinism_results& out_results)
+{
+	out_results.clear();
+
+	for (uint32_t input_index = 0; input_index < k_num_determinism_inputs; ++input_index)
+	{
+		compute_scalar_results(out_results, input_index);
+		compute_vector_results(out_results, input_index);
+		compute_transform_results(out_results, input_index);
+		compute_fixed_point_results(out_results, input_index);
+	}
+
+	compute_batch_results(out_results);
+}
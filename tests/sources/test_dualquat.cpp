@@ -0,0 +1,134 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/dualquatf.h>
+#include <rtm/dualquatd.h>
+#include <rtm/qvvf.h>
+#include <rtm/qvvd.h>
+
+using namespace rtm;
+
+template<typename DualQuatType, typename TransformType, typename FloatType>
+static void test_dualquat_impl(const DualQuatType& identity, const FloatType threshold)
+{
+	using QuatType = decltype(DualQuatType::real);
+	using Vector4Type = decltype(TransformType::translation);
+
+	{
+		QuatType q_identity = quat_set(FloatType(0.0), FloatType(0.0), FloatType(0.0), FloatType(1.0));
+		QuatType q_zero = quat_set(FloatType(0.0), FloatType(0.0), FloatType(0.0), FloatType(0.0));
+		DualQuatType tmp = dualquat_set(q_identity, q_zero);
+		CHECK(dualquat_near_equal(identity, tmp, threshold));
+		CHECK(dualquat_is_normalized(identity, threshold));
+		CHECK(quat_near_equal(dualquat_get_rotation(identity), q_identity, threshold));
+		CHECK(vector_all_near_equal3(dualquat_get_translation(identity), vector_set(FloatType(0.0)), threshold));
+	}
+
+	const QuatType rotation_a = quat_from_euler(scalar_deg_to_rad(FloatType(12.0)), scalar_deg_to_rad(FloatType(-56.0)), scalar_deg_to_rad(FloatType(132.0)));
+	const Vector4Type translation_a = vector_set(FloatType(1.5), FloatType(-12.0), FloatType(0.25));
+	const QuatType rotation_b = quat_from_euler(scalar_deg_to_rad(FloatType(-80.0)), scalar_deg_to_rad(FloatType(5.0)), scalar_deg_to_rad(FloatType(33.0)));
+	const Vector4Type translation_b = vector_set(FloatType(-4.0), FloatType(2.0), FloatType(10.5));
+	const Vector4Type one = vector_set(FloatType(1.0));
+
+	const TransformType transform_a = qvv_set(rotation_a, translation_a, one);
+	const TransformType transform_b = qvv_set(rotation_b, translation_b, one);
+	const DualQuatType dq_a = dualquat_from_qvv(transform_a);
+	const DualQuatType dq_b = dualquat_from_qvv(transform_b);
+
+	const Vector4Type point = vector_set(FloatType(0.5), FloatType(-3.0), FloatType(7.25));
+
+	{
+		CHECK(dualquat_is_normalized(dq_a, threshold));
+		CHECK(quat_near_equal(dualquat_get_rotation(dq_a), rotation_a, threshold));
+		CHECK(vector_all_near_equal3(dualquat_get_translation(dq_a), translation_a, threshold));
+		CHECK(dualquat_near_equal(dualquat_from_rotation_translation(rotation_a, translation_a), dq_a, threshold));
+
+		const TransformType roundtrip = qvv_from_dualquat(dq_a);
+		CHECK(quat_near_equal(roundtrip.rotation, rotation_a, threshold));
+		CHECK(vector_all_near_equal3(roundtrip.translation, translation_a, threshold));
+		CHECK(vector_all_near_equal3(roundtrip.scale, one, threshold));
+
+		// Scale is ignored
+		const DualQuatType dq_scaled = dualquat_from_qvv(qvv_set(rotation_a, translation_a, vector_set(FloatType(2.0))));
+		CHECK(dualquat_near_equal(dq_scaled, dq_a, threshold));
+	}
+
+	{
+		CHECK(vector_all_near_equal3(dualquat_mul_point3(point, dq_a), qvv_mul_point3(point, transform_a), threshold));
+		CHECK(vector_all_near_equal3(dualquat_mul_point3(point, identity), point, threshold));
+	}
+
+	{
+		const DualQuatType dq_ab = dualquat_mul(dq_a, dq_b);
+		const TransformType transform_ab = qvv_mul(transform_a, transform_b);
+		CHECK(dualquat_is_normalized(dq_ab, threshold));
+		CHECK(quat_near_equal(dualquat_get_rotation(dq_ab), transform_ab.rotation, threshold));
+		CHECK(vector_all_near_equal3(dualquat_get_translation(dq_ab), transform_ab.translation, threshold));
+		CHECK(vector_all_near_equal3(dualquat_mul_point3(point, dq_ab), dualquat_mul_point3(dualquat_mul_point3(point, dq_a), dq_b), threshold));
+
+		CHECK(dualquat_near_equal(dualquat_mul(dq_a, identity), dq_a, threshold));
+		CHECK(dualquat_near_equal(dualquat_mul(identity, dq_a), dq_a, threshold));
+	}
+
+	{
+		const DualQuatType dq_inv = dualquat_inverse(dq_a);
+		CHECK(vector_all_near_equal3(dualquat_mul_point3(dualquat_mul_point3(point, dq_a), dq_inv), point, threshold));
+
+		const DualQuatType dq_id = dualquat_mul(dq_a, dq_inv);
+		CHECK(quat_near_identity(dq_id.real, threshold));
+		CHECK(vector_all_near_equal3(dualquat_get_translation(dq_id), vector_set(FloatType(0.0)), threshold));
+	}
+
+	{
+		const FloatType scale = FloatType(2.5);
+		const DualQuatType dq_scaled = dualquat_set(vector_to_quat(vector_mul(quat_to_vector(dq_a.real), scale)), vector_to_quat(vector_mul(quat_to_vector(dq_a.dual), scale)));
+		CHECK(!dualquat_is_normalized(dq_scaled, threshold));
+
+		const DualQuatType dq_normalized = dualquat_normalize(dq_scaled);
+		CHECK(dualquat_is_normalized(dq_normalized, threshold));
+		CHECK(dualquat_near_equal(dq_normalized, dq_a, threshold));
+	}
+}
+
+TEST_CASE("dualquatf math", "[math][dualquat]")
+{
+	test_dualquat_impl<dualquatf, qvvf, float>(dualquat_identity(), 1.0E-4F);
+
+	const dualquatf src = dualquat_from_rotation_translation(quat_from_euler(0.3F, -1.2F, 2.1F), vector_set(-2.65F, 2.996113F, 0.68123521F));
+	const dualquatd dst = dualquat_cast(src);
+	CHECK(quat_near_equal(src.real, quat_cast(dst.real), 1.0E-6F));
+	CHECK(quat_near_equal(src.dual, quat_cast(dst.dual), 1.0E-6F));
+}
+
+TEST_CASE("dualquatd math", "[math][dualquat]")
+{
+	test_dualquat_impl<dualquatd, qvvd, double>(dualquat_identity(), 1.0E-6);
+
+	const dualquatd src = dualquat_from_rotation_translation(quat_from_euler(0.3, -1.2, 2.1), vector_set(-2.65, 2.996113, 0.68123521));
+	const dualquatf dst = dualquat_cast(src);
+	CHECK(quat_near_equal(src.real, quat_cast(dst.real), 1.0E-6));
+	CHECK(quat_near_equal(src.dual, quat_cast(dst.dual), 1.0E-6));
+}
@@ -0,0 +1,219 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/frustumf.h>
+#include <rtm/matrix4x4f.h>
+#include <rtm/matrix4x4x8f.h>
+#include <rtm/qvvf.h>
+#include <rtm/vector4f.h>
+#include <rtm/vector8f.h>
+#include <rtm/batch/frustumf.h>
+
+using namespace rtm;
+
+// A symmetric perspective projection looking down +Z with a 90 degree field of view.
+// Clip depth is in [0, w] with the near plane at 1.0 and the far plane at 100.0.
+static matrix4x4f make_projection()
+{
+	const float near_distance = 1.0F;
+	const float far_distance = 100.0F;
+	const float depth_scale = far_distance / (far_distance - near_distance);
+
+	return matrix_set(
+		vector_set(1.0F, 0.0F, 0.0F, 0.0F),
+		vector_set(0.0F, 1.0F, 0.0F, 0.0F),
+		vector_set(0.0F, 0.0F, depth_scale, 1.0F),
+		vector_set(0.0F, 0.0F, -near_distance * depth_scale, 0.0F));
+}
+
+TEST_CASE("frustumf math", "[math][frustum]")
+{
+	const float threshold = 1.0E-5F;
+
+	{
+		const frustumf frustum = frustum_from_matrix(make_projection());
+
+		// Normals point inside and are normalized, planes go through the apex
+		const float inv_sqrt2 = 0.70710678F;
+		CHECK(vector_all_near_equal(frustum.planes[0], vector_set(inv_sqrt2, 0.0F, inv_sqrt2, 0.0F), threshold));
+		CHECK(vector_all_near_equal(frustum.planes[1], vector_set(-inv_sqrt2, 0.0F, inv_sqrt2, 0.0F), threshold));
+		CHECK(vector_all_near_equal(frustum.planes[2], vector_set(0.0F, inv_sqrt2, inv_sqrt2, 0.0F), threshold));
+		CHECK(vector_all_near_equal(frustum.planes[3], vector_set(0.0F, -inv_sqrt2, inv_sqrt2, 0.0F), threshold));
+		CHECK(vector_all_near_equal(frustum.planes[4], vector_set(0.0F, 0.0F, 1.0F, -1.0F), threshold));
+		CHECK(vector_all_near_equal(frustum.planes[5], vector_set(0.0F, 0.0F, -1.0F, 100.0F), 1.0E-3F));
+
+		CHECK(frustum_intersects_sphere(frustum, vector_set(0.0F, 0.0F, 10.0F), 1.0F));
+		CHECK(frustum_intersects_sphere(frustum, vector_set(0.0F, 0.0F, 0.5F), 1.0F));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(0.0F, 0.0F, -5.0F), 1.0F));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(20.0F, 0.0F, 10.0F), 1.0F));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(0.0F, 0.0F, 102.0F), 1.0F));
+
+		CHECK(frustum_intersects_aabb(frustum, vector_set(0.0F, 0.0F, 10.0F), vector_set(1.0F)));
+		CHECK(frustum_intersects_aabb(frustum, vector_set(12.0F, 0.0F, 10.0F), vector_set(3.0F)));
+		CHECK_FALSE(frustum_intersects_aabb(frustum, vector_set(18.0F, 0.0F, 10.0F), vector_set(3.0F)));
+		CHECK_FALSE(frustum_intersects_aabb(frustum, vector_set(0.0F, -5.0F, 0.0F), vector_set(1.0F)));
+	}
+
+	{
+		// With a [-w, w] depth range, the near plane stays at 1.0
+		const float depth_scale = 101.0F / 99.0F;
+		const matrix4x4f projection = matrix_set(
+			vector_set(1.0F, 0.0F, 0.0F, 0.0F),
+			vector_set(0.0F, 1.0F, 0.0F, 0.0F),
+			vector_set(0.0F, 0.0F, depth_scale, 1.0F),
+			vector_set(0.0F, 0.0F, -200.0F / 99.0F, 0.0F));
+		const frustumf frustum = frustum_from_matrix(projection, clip_depth_range::minus_one_to_one);
+		CHECK(vector_all_near_equal(frustum.planes[4], vector_set(0.0F, 0.0F, 1.0F, -1.0F), threshold));
+		CHECK(vector_all_near_equal(frustum.planes[5], vector_set(0.0F, 0.0F, -1.0F, 100.0F), 1.0E-3F));
+	}
+
+	{
+		// The planes follow the view matrix: move the camera 10 units along -Z
+		const matrix4x4f view = matrix_set(vector_set(1.0F, 0.0F, 0.0F, 0.0F), vector_set(0.0F, 1.0F, 0.0F, 0.0F), vector_set(0.0F, 0.0F, 1.0F, 0.0F), vector_set(0.0F, 0.0F, 10.0F, 1.0F));
+		const frustumf frustum = frustum_from_matrix(matrix_mul(view, make_projection()));
+
+		CHECK(frustum_intersects_sphere(frustum, vector_set(0.0F, 0.0F, 0.0F), 1.0F));
+		CHECK_FALSE(frustum_intersects_sphere(frustum, vector_set(0.0F, 0.0F, -15.0F), 1.0F));
+	}
+}
+
+TEST_CASE("frustumf batch culling", "[math][frustum][batch]")
+{
+	const frustumf frustum = frustum_from_matrix(make_projection());
+
+	// Not a multiple of 8 or 32 to exercise the wide loops, the remainder, and the last output entry
+	constexpr uint32_t num_objects = 45;
+
+	float center_x[num_objects];
+	float center_y[num_objects];
+	float center_z[num_objects];
+	float extent_x[num_objects];
+	float extent_y[num_objects];
+	float extent_z[num_objects];
+	float radii[num_objects];
+
+	for (uint32_t object_index = 0; object_index < num_objects; ++object_index)
+	{
+		const float value = float(object_index);
+		center_x[object_index] = scalar_sin(value * 0.7F) * 30.0F;
+		center_y[object_index] = scalar_cos(value * 1.3F) * 20.0F;
+		center_z[object_index] = value * 2.6F - 10.0F;
+		extent_x[object_index] = 0.5F + float(object_index % 3);
+		extent_y[object_index] = 1.0F + float(object_index % 5) * 0.5F;
+		extent_z[object_index] = 0.25F + float(object_index % 2);
+		radii[object_index] = 0.5F + float(object_index % 7);
+	}
+
+	const const_float3f_soa centers{ center_x, center_y, center_z };
+	const const_float3f_soa extents{ extent_x, extent_y, extent_z };
+
+	{
+		uint32_t sphere_bits[2] = { ~0U, ~0U };
+		frustum_cull_spheres_soa(frustum, centers, radii, sphere_bits, num_objects);
+
+		uint32_t num_visible = 0;
+		for (uint32_t object_index = 0; object_index < num_objects; ++object_index)
+		{
+			const bool is_visible = (sphere_bits[object_index / 32] & (1U << (object_index % 32))) != 0;
+			CHECK(is_visible == frustum_intersects_sphere(frustum, vector_set(center_x[object_index], center_y[object_index], center_z[object_index]), radii[object_index]));
+			num_visible += is_visible ? 1 : 0;
+		}
+
+		// Some are culled, some are not
+		CHECK(num_visible != 0);
+		CHECK(num_visible != num_objects);
+		CHECK((sphere_bits[1] >> (num_objects % 32)) == 0);
+	}
+
+	{
+		uint32_t box_bits[2] = { ~0U, ~0U };
+		frustum_cull_aabbs_soa(frustum, centers, extents, box_bits, num_objects);
+
+		uint32_t num_visible = 0;
+		for (uint32_t object_index = 0; object_index < num_objects; ++object_index)
+		{
+			const vector4f center = vector_set(center_x[object_index], center_y[object_index], center_z[object_index]);
+			const vector4f extent = vector_set(extent_x[object_index], extent_y[object_index], extent_z[object_index]);
+			const bool is_visible = (box_bits[object_index / 32] & (1U << (object_index % 32))) != 0;
+			CHECK(is_visible == frustum_intersects_aabb(frustum, center, extent));
+			num_visible += is_visible ? 1 : 0;
+		}
+
+		CHECK(num_visible != 0);
+		CHECK(num_visible != num_objects);
+		CHECK((box_bits[1] >> (num_objects % 32)) == 0);
+	}
+
+	{
+		const vector3x8f centers8 = vector3x8_load(centers, 8);
+		const vector3x8f extents8 = vector3x8_load(extents, 8);
+		const uint32_t sphere_bits = mask_get_bits(frustum_intersects_sphere(frustum, centers8, vector8_load(radii + 8)));
+		const uint32_t box_bits = mask_get_bits(frustum_intersects_aabb(frustum, centers8, extents8));
+
+		for (uint32_t lane_index = 0; lane_index < 8; ++lane_index)
+		{
+			const uint32_t object_index = lane_index + 8;
+			const vector4f center = vector_set(center_x[object_index], center_y[object_index], center_z[object_index]);
+			const vector4f extent = vector_set(extent_x[object_index], extent_y[object_index], extent_z[object_index]);
+			CHECK(((sphere_bits >> lane_index) & 1) == (frustum_intersects_sphere(frustum, center, radii[object_index]) ? 1U : 0U));
+			CHECK(((box_bits >> lane_index) & 1) == (frustum_intersects_aabb(frustum, center, extent) ? 1U : 0U));
+		}
+	}
+}
+
+TEST_CASE("frustumf batch extraction", "[math][frustum][batch]")
+{
+	const float threshold = 1.0E-5F;
+
+	// The 6 faces of a cube map and two translated cameras
+	matrix4x4f world_to_clip[8];
+	for (uint32_t camera_index = 0; camera_index < 8; ++camera_index)
+	{
+		const float angle = float(camera_index) * 0.9F;
+		const vector4f translation = vector_set(float(camera_index) - 3.0F, 1.5F, -2.0F * float(camera_index));
+		const matrix4x4f transform = matrix_cast(matrix_from_qvv(quat_from_euler(angle, 0.3F * angle, 0.0F), translation, vector_set(1.0F)));
+		const matrix4x4f view = matrix_set(transform.x_axis, transform.y_axis, transform.z_axis, vector_set_w(transform.w_axis, 1.0F));
+		world_to_clip[camera_index] = matrix_mul(view, make_projection());
+	}
+
+	const matrix4x4x8f world_to_clip8 = matrix4x4x8_load(world_to_clip);
+
+	for (uint32_t range_index = 0; range_index < 2; ++range_index)
+	{
+		const clip_depth_range depth_range = range_index == 0 ? clip_depth_range::zero_to_one : clip_depth_range::minus_one_to_one;
+
+		frustumf frustums[8];
+		frustum_from_matrix(world_to_clip8, frustums, 7, depth_range);
+
+		for (uint32_t camera_index = 0; camera_index < 7; ++camera_index)
+		{
+			const frustumf reference = frustum_from_matrix(world_to_clip[camera_index], depth_range);
+			for (uint32_t plane_index = 0; plane_index < 6; ++plane_index)
+				CHECK(vector_all_near_equal(frustums[camera_index].planes[plane_index], reference.planes[plane_index], plane_index == 5 ? 1.0E-3F : threshold));
+		}
+	}
+}
@@ -0,0 +1,66 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+// Only the forward declarations are visible to the declarations below
+#include <rtm/fwd.h>
+
+namespace
+{
+	rtm::qvvf make_transform(const rtm::float3f& translation);
+	float get_translation_x(const rtm::qvvf& transform);
+	int get_mix_index(rtm::mix4 component);
+}
+
+#include <rtm/qvvf.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+namespace
+{
+	qvvf make_transform(const float3f& translation)
+	{
+		return qvv_set(quat_identity(), vector_load3(&translation), vector_set(1.0F));
+	}
+
+	float get_translation_x(const qvvf& transform)
+	{
+		return vector_get_x(transform.translation);
+	}
+
+	int get_mix_index(mix4 component)
+	{
+		return static_cast<int>(component);
+	}
+}
+
+TEST_CASE("forward declarations", "[math][fwd]")
+{
+	const float3f translation = { 1.0F, 2.0F, 3.0F };
+	CHECK(get_translation_x(make_transform(translation)) == 1.0F);
+	CHECK(get_mix_index(mix4::b) == 5);
+}
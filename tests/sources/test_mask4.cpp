@@ -51,6 +51,18 @@ static void test_mask_impl()
 		CHECK(mask_get_w(mask) == ~IntType(0));
 	}
 
+	for (uint32_t mask_bits = 0; mask_bits < 16; ++mask_bits)
+	{
+		const MaskType mask = mask_from_bits(mask_bits);
+		CHECK(mask_get_x(mask) == ((mask_bits & 1) != 0 ? ~IntType(0) : IntType(0)));
+		CHECK(mask_get_y(mask) == ((mask_bits & 2) != 0 ? ~IntType(0) : IntType(0)));
+		CHECK(mask_get_z(mask) == ((mask_bits & 4) != 0 ? ~IntType(0) : IntType(0)));
+		CHECK(mask_get_w(mask) == ((mask_bits & 8) != 0 ? ~IntType(0) : IntType(0)));
+
+		CHECK(mask_get_bits(mask) == mask_bits);
+		CHECK(mask_count_true(mask) == uint32_t((mask_bits & 1) + ((mask_bits >> 1) & 1) + ((mask_bits >> 2) & 1) + ((mask_bits >> 3) & 1)));
+	}
+
 	{
 		const MaskType mask0 = mask_set(IntType(0), ~IntType(0), IntType(0), ~IntType(0));
 		const MaskType mask1 = mask_set(IntType(0), IntType(0), IntType(0), IntType(0));
@@ -127,6 +139,16 @@ static void test_mask_impl()
 TEST_CASE("mask4f math", "[math][mask]")
 {
 	test_mask_impl<mask4f, uint32_t>();
+
+	CHECK(mask_get_bits(mask4f(mask_set(0U, 0U, 0U, 0U))) == 0x0U);
+	CHECK(mask_get_bits(mask4f(mask_set(~0U, 0U, 0U, 0U))) == 0x1U);
+	CHECK(mask_get_bits(mask4f(mask_set(0U, ~0U, 0U, ~0U))) == 0xAU);
+	CHECK(mask_get_bits(mask4f(mask_set(~0U, ~0U, ~0U, ~0U))) == 0xFU);
+
+	const mask4f mask0 = mask_set(~0U, ~0U, 0U, 0U);
+	const mask4f mask1 = mask_set(~0U, 0U, ~0U, 0U);
+	CHECK(mask_get_bits(mask_and(mask0, mask1)) == 0x1U);
+	CHECK(mask_get_bits(mask_or(mask0, mask1)) == 0x7U);
 }
 
 TEST_CASE("mask4d math", "[math][mask]")
@@ -137,6 +159,11 @@ TEST_CASE("mask4d math", "[math][mask]")
 TEST_CASE("mask4i math", "[math][mask]")
 {
 	test_mask_impl<mask4i, uint32_t>();
+
+	CHECK(mask_get_bits(mask4i(mask_set(0U, 0U, 0U, 0U))) == 0x0U);
+	CHECK(mask_get_bits(mask4i(mask_set(~0U, 0U, 0U, 0U))) == 0x1U);
+	CHECK(mask_get_bits(mask4i(mask_set(0U, ~0U, 0U, ~0U))) == 0xAU);
+	CHECK(mask_get_bits(mask4i(mask_set(~0U, ~0U, ~0U, ~0U))) == 0xFU);
 }
 
 TEST_CASE("mask4q math", "[math][mask]")
@@ -53,4 +53,26 @@ TEST_CASE("matrix3x3f math misc", "[math][matrix3x3]")
 		CHECK(vector_all_near_equal3(vector_cast(src.y_axis), dst.y_axis, 1.0E-4));
 		CHECK(vector_all_near_equal3(vector_cast(src.z_axis), dst.z_axis, 1.0E-4));
 	}
+
+	{
+		const quatf rotation = quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-75.0F), scalar_deg_to_rad(110.0F));
+		const matrix3x3f rigid = matrix_from_quat(rotation);
+
+		matrix3x3f scaled = rigid;
+		scaled.x_axis = vector_mul(scaled.x_axis, 4.0F);
+		scaled.y_axis = vector_mul(scaled.y_axis, 0.5F);
+		scaled.z_axis = vector_mul(scaled.z_axis, -6.0F);
+
+		matrix3x3f reflected = rigid;
+		reflected.z_axis = vector_neg(reflected.z_axis);
+
+		const matrix3x3f gram_schmidt = matrix_orthonormalize(scaled);
+		const matrix3x3f polar = matrix_orthonormalize_polar(scaled);
+		CHECK(vector_all_near_equal3(gram_schmidt.x_axis, reflected.x_axis, 1.0E-5F));
+		CHECK(vector_all_near_equal3(gram_schmidt.y_axis, reflected.y_axis, 1.0E-5F));
+		CHECK(vector_all_near_equal3(gram_schmidt.z_axis, reflected.z_axis, 1.0E-5F));
+		CHECK(vector_all_near_equal3(polar.x_axis, reflected.x_axis, 1.0E-5F));
+		CHECK(vector_all_near_equal3(polar.y_axis, reflected.y_axis, 1.0E-5F));
+		CHECK(vector_all_near_equal3(polar.z_axis, reflected.z_axis, 1.0E-5F));
+	}
 }
@@ -33,6 +33,14 @@
 
 using namespace rtm;
 
+static bool matrix_near_equal(matrix3x4f_arg0 lhs, matrix3x4f_arg1 rhs, float threshold)
+{
+	return vector_all_near_equal3(lhs.x_axis, rhs.x_axis, threshold)
+		&& vector_all_near_equal3(lhs.y_axis, rhs.y_axis, threshold)
+		&& vector_all_near_equal3(lhs.z_axis, rhs.z_axis, threshold)
+		&& vector_all_near_equal3(lhs.w_axis, rhs.w_axis, threshold);
+}
+
 template<typename FloatType>
 static void test_affine_matrix_setters(const FloatType threshold)
 {
@@ -300,6 +308,33 @@ static void test_affine_matrix_transformations(const FloatType threshold)
 		CHECK(vector_all_near_equal3(vector_set(FloatType(0.0), FloatType(0.0), FloatType(1.0), FloatType(0.0)), result.z_axis, threshold));
 		CHECK(vector_all_near_equal3(vector_set(FloatType(0.0), FloatType(0.0), FloatType(0.0), FloatType(1.0)), result.w_axis, threshold));
 	}
+
+	{
+		QuatType rotation = quat_from_euler(scalar_deg_to_rad(FloatType(12.3)), scalar_deg_to_rad(FloatType(42.8)), scalar_deg_to_rad(FloatType(33.41)));
+		Vector4Type translation = vector_set(FloatType(1.0), FloatType(2.0), FloatType(3.0));
+
+		Matrix3x4Type mtx = matrix_from_qvv(rotation, translation, vector_set(FloatType(1.0)));
+		Matrix3x4Type inv_mtx = matrix_inverse_rigid(mtx);
+		Matrix3x4Type expected = matrix_inverse(mtx);
+		CHECK(vector_all_near_equal3(expected.x_axis, inv_mtx.x_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.y_axis, inv_mtx.y_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.z_axis, inv_mtx.z_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.w_axis, inv_mtx.w_axis, threshold));
+
+		mtx = matrix_from_qvv(rotation, translation, vector_set(FloatType(2.5)));
+		inv_mtx = matrix_inverse_uniform_scale(mtx);
+		expected = matrix_inverse(mtx);
+		CHECK(vector_all_near_equal3(expected.x_axis, inv_mtx.x_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.y_axis, inv_mtx.y_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.z_axis, inv_mtx.z_axis, threshold));
+		CHECK(vector_all_near_equal3(expected.w_axis, inv_mtx.w_axis, threshold));
+
+		Matrix3x4Type result = matrix_mul(mtx, inv_mtx);
+		CHECK(vector_all_near_equal3(identity.x_axis, result.x_axis, threshold));
+		CHECK(vector_all_near_equal3(identity.y_axis, result.y_axis, threshold));
+		CHECK(vector_all_near_equal3(identity.z_axis, result.z_axis, threshold));
+		CHECK(vector_all_near_equal3(identity.w_axis, result.w_axis, threshold));
+	}
 }
 
 template<typename FloatType>
@@ -443,6 +478,89 @@ TEST_CASE("matrix3x4f math", "[math][matrix3x4]")
 		CHECK(vector_all_near_equal3(vector_cast(src.z_axis), dst.z_axis, 1.0E-4));
 		CHECK(vector_all_near_equal3(vector_cast(src.w_axis), dst.w_axis, 1.0E-4));
 	}
+
+	{
+		quatf rotation_around_z = quat_from_euler(scalar_deg_to_rad(0.0F), scalar_deg_to_rad(90.0F), scalar_deg_to_rad(0.0F));
+		vector4f translation = vector_set(1.0F, 2.0F, 3.0F);
+		vector4f scale = vector_set(4.0F, 5.0F, 6.0F);
+		matrix3x4f src = matrix_from_qvv(rotation_around_z, translation, scale);
+		float3x4f transposed = matrix_cast(src);
+		CHECK(scalar_near_equal(transposed.x_row.x, vector_get_x(src.x_axis), 0.0F));
+		CHECK(scalar_near_equal(transposed.x_row.y, vector_get_x(src.y_axis), 0.0F));
+		CHECK(scalar_near_equal(transposed.x_row.z, vector_get_x(src.z_axis), 0.0F));
+		CHECK(scalar_near_equal(transposed.x_row.w, vector_get_x(src.w_axis), 0.0F));
+		CHECK(scalar_near_equal(transposed.y_row.x, vector_get_y(src.x_axis), 0.0F));
+		CHECK(scalar_near_equal(transposed.y_row.w, vector_get_y(src.w_axis), 0.0F));
+		CHECK(scalar_near_equal(transposed.z_row.z, vector_get_z(src.z_axis), 0.0F));
+		CHECK(scalar_near_equal(transposed.z_row.w, vector_get_z(src.w_axis), 0.0F));
+
+		matrix3x4f dst = matrix_cast(transposed);
+		CHECK(vector_all_near_equal3(src.x_axis, dst.x_axis, 0.0F));
+		CHECK(vector_all_near_equal3(src.y_axis, dst.y_axis, 0.0F));
+		CHECK(vector_all_near_equal3(src.z_axis, dst.z_axis, 0.0F));
+		CHECK(vector_all_near_equal3(src.w_axis, dst.w_axis, 0.0F));
+	}
+
+	{
+		const quatf rotation = quat_from_euler(scalar_deg_to_rad(30.0F), scalar_deg_to_rad(-75.0F), scalar_deg_to_rad(110.0F));
+		const vector4f translation = vector_set(1.0F, 2.0F, 3.0F);
+		const matrix3x4f rigid = matrix_from_qvv(rotation, translation, vector_set(1.0F));
+		const matrix3x4f scaled = matrix_from_qvv(rotation, translation, vector_set(4.0F, 5.0F, 6.0F));
+		const matrix3x4f reflected = matrix_from_qvv(rotation, translation, vector_set(-1.0F, 1.0F, 1.0F));
+		const matrix3x4f scaled_reflected = matrix_from_qvv(rotation, translation, vector_set(-4.0F, 5.0F, 6.0F));
+
+		// The drift that accumulates when matrices are composed repeatedly
+		matrix3x4f drifted = rigid;
+		drifted.x_axis = vector_mul(drifted.x_axis, 1.02F);
+		drifted.y_axis = vector_mul_add(rigid.x_axis, 0.01F, drifted.y_axis);
+		drifted.z_axis = vector_mul_add(rigid.y_axis, -0.015F, drifted.z_axis);
+
+		const matrix3x4f results[] =
+		{
+			matrix_orthonormalize(drifted),
+			matrix_orthonormalize_polar(drifted),
+			matrix_orthonormalize_polar(matrix_from_qvv(rotation, translation, vector_set(0.001F, 0.1F, 1000.0F))),
+		};
+
+		for (const matrix3x4f& result : results)
+		{
+			const float x_length = vector_length3(result.x_axis);
+			const float y_length = vector_length3(result.y_axis);
+			const float z_length = vector_length3(result.z_axis);
+			const float xy_dot = vector_dot3(result.x_axis, result.y_axis);
+			const float xz_dot = vector_dot3(result.x_axis, result.z_axis);
+			const float yz_dot = vector_dot3(result.y_axis, result.z_axis);
+			CHECK(scalar_near_equal(x_length, 1.0F, 1.0E-5F));
+			CHECK(scalar_near_equal(y_length, 1.0F, 1.0E-5F));
+			CHECK(scalar_near_equal(z_length, 1.0F, 1.0E-5F));
+			CHECK(scalar_near_equal(xy_dot, 0.0F, 1.0E-5F));
+			CHECK(scalar_near_equal(xz_dot, 0.0F, 1.0E-5F));
+			CHECK(scalar_near_equal(yz_dot, 0.0F, 1.0E-5F));
+			CHECK(scalar_near_equal(scalar_cast(matrix_determinant(result)), 1.0F, 1.0E-4F));
+			CHECK(vector_all_near_equal3(result.w_axis, translation, 0.0F));
+		}
+
+		// Gram-Schmidt keeps the X axis direction, polar spreads the error over every axis
+		CHECK(vector_all_near_equal3(results[0].x_axis, rigid.x_axis, 1.0E-5F));
+		CHECK(matrix_near_equal(results[0], rigid, 0.02F));
+		CHECK(matrix_near_equal(results[1], rigid, 0.02F));
+		const float rotation_alignment = quat_dot(quat_from_matrix(results[1]), rotation);
+		CHECK(scalar_abs(rotation_alignment) > 0.9999F);
+
+		// Polar also removes a large non-uniform scale
+		CHECK(matrix_near_equal(results[2], rigid, 1.0E-4F));
+		CHECK(matrix_near_equal(matrix_orthonormalize(scaled), rigid, 1.0E-5F));
+		CHECK(matrix_near_equal(matrix_orthonormalize_polar(scaled), rigid, 1.0E-5F));
+
+		// Reflections are retained
+		CHECK(matrix_near_equal(matrix_orthonormalize(scaled_reflected), reflected, 1.0E-5F));
+		CHECK(matrix_near_equal(matrix_orthonormalize_polar(scaled_reflected), reflected, 1.0E-5F));
+
+		// Singular matrices fall back to Gram-Schmidt
+		matrix3x4f singular = rigid;
+		singular.z_axis = vector_zero();
+		CHECK(matrix_near_equal(matrix_orthonormalize_polar(singular), matrix_orthonormalize(singular), 0.0F));
+	}
 }
 
 TEST_CASE("matrix3x4d math", "[math][matrix3x4]")
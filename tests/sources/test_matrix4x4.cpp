@@ -173,6 +173,41 @@ static void test_matrix4x4_transformations(const FloatType threshold)
 		CHECK(vector_all_near_equal(identity.y_axis, inv_mtx.y_axis, threshold));
 		CHECK(vector_all_near_equal(identity.z_axis, inv_mtx.z_axis, threshold));
 		CHECK(vector_all_near_equal(identity.w_axis, inv_mtx.w_axis, threshold));
+
+		inv_mtx = matrix_inverse(mtx, identity, scalar_set(FloatType(1.0E-8)));
+		CHECK(vector_all_near_equal(identity.x_axis, inv_mtx.x_axis, threshold));
+		CHECK(vector_all_near_equal(identity.w_axis, inv_mtx.w_axis, threshold));
+	}
+
+	{
+		QuatType rotation = quat_from_euler(scalar_deg_to_rad(FloatType(12.3)), scalar_deg_to_rad(FloatType(42.8)), scalar_deg_to_rad(FloatType(33.41)));
+		Vector4Type translation = vector_set(FloatType(1.0), FloatType(2.0), FloatType(3.0));
+
+		Matrix3x4Type mtx3x4 = matrix_from_qvv(rotation, translation, vector_set(FloatType(1.0)));
+		mtx3x4.w_axis = vector_set(FloatType(1.0), FloatType(2.0), FloatType(3.0), FloatType(1.0));
+		Matrix4x4Type mtx = matrix_cast(mtx3x4);
+		Matrix4x4Type inv_mtx = matrix_inverse_rigid(mtx);
+		Matrix4x4Type expected = matrix_inverse(mtx);
+		CHECK(vector_all_near_equal(expected.x_axis, inv_mtx.x_axis, threshold));
+		CHECK(vector_all_near_equal(expected.y_axis, inv_mtx.y_axis, threshold));
+		CHECK(vector_all_near_equal(expected.z_axis, inv_mtx.z_axis, threshold));
+		CHECK(vector_all_near_equal(expected.w_axis, inv_mtx.w_axis, threshold));
+
+		mtx3x4 = matrix_from_qvv(rotation, translation, vector_set(FloatType(2.5)));
+		mtx3x4.w_axis = vector_set(FloatType(1.0), FloatType(2.0), FloatType(3.0), FloatType(1.0));
+		mtx = matrix_cast(mtx3x4);
+		inv_mtx = matrix_inverse_uniform_scale(mtx);
+		expected = matrix_inverse(mtx);
+		CHECK(vector_all_near_equal(expected.x_axis, inv_mtx.x_axis, threshold));
+		CHECK(vector_all_near_equal(expected.y_axis, inv_mtx.y_axis, threshold));
+		CHECK(vector_all_near_equal(expected.z_axis, inv_mtx.z_axis, threshold));
+		CHECK(vector_all_near_equal(expected.w_axis, inv_mtx.w_axis, threshold));
+
+		Matrix4x4Type result = matrix_mul(mtx, inv_mtx);
+		CHECK(vector_all_near_equal(identity.x_axis, result.x_axis, threshold));
+		CHECK(vector_all_near_equal(identity.y_axis, result.y_axis, threshold));
+		CHECK(vector_all_near_equal(identity.z_axis, result.z_axis, threshold));
+		CHECK(vector_all_near_equal(identity.w_axis, result.w_axis, threshold));
 	}
 }
 
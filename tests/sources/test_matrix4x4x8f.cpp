@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <catch.hpp>
+
+#include <rtm/matrix4x4f.h>
+#include <rtm/matrix4x4x8f.h>
+#include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+
+using namespace rtm;
+
+static bool matrix_near_equal(const matrix4x4f& lhs, const matrix4x4f& rhs, float threshold)
+{
+	return vector_all_near_equal(lhs.x_axis, rhs.x_axis, threshold)
+		&& vector_all_near_equal(lhs.y_axis, rhs.y_axis, threshold)
+		&& vector_all_near_equal(lhs.z_axis, rhs.z_axis, threshold)
+		&& vector_all_near_equal(lhs.w_axis, rhs.w_axis, threshold);
+}
+
+// matrix_cast(..) leaves the [w] component of the translation at zero
+static matrix4x4f make_affine(const matrix3x4f& input)
+{
+	const matrix4x4f result = matrix_cast(input);
+	return matrix_set(result.x_axis, result.y_axis, result.z_axis, vector_set_w(result.w_axis, 1.0F));
+}
+
+// The full 4x4 product, matrix_mul(matrix4x4f, matrix4x4f) assumes the left matrix is affine
+static matrix4x4f matrix_mul_reference(const matrix4x4f& lhs, const matrix4x4f& rhs)
+{
+	return matrix_set(matrix_mul_vector(lhs.x_axis, rhs), matrix_mul_vector(lhs.y_axis, rhs), matrix_mul_vector(lhs.z_axis, rhs), matrix_mul_vector(lhs.w_axis, rhs));
+}
+
+TEST_CASE("matrix4x4x8f math", "[math][matrix4x4][matrix4x4x8]")
+{
+	const float threshold = 1.0E-4F;
+
+	// Affine transforms and perspective projections with various scales
+	matrix4x4f lhs[8];
+	matrix4x4f rhs[8];
+	for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+	{
+		const float angle = float(matrix_index) * 0.41F;
+		const vector4f translation = vector_set(angle, 1.0F - angle, angle * 0.5F);
+		lhs[matrix_index] = make_affine(matrix_from_qvv(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), translation, vector_set(1.0F, 1.5F, 0.5F)));
+
+		if ((matrix_index % 2) == 0)
+		{
+			const float depth_scale = 100.0F / 99.0F;
+			rhs[matrix_index] = matrix_set(
+				vector_set(1.0F + angle, 0.0F, 0.0F, 0.0F),
+				vector_set(0.0F, 2.0F - angle * 0.5F, 0.0F, 0.0F),
+				vector_set(0.1F * angle, -0.2F, depth_scale, 1.0F),
+				vector_set(0.0F, 0.0F, -depth_scale, 0.0F));
+		}
+		else
+			rhs[matrix_index] = make_affine(matrix_from_qvv(quat_from_euler(0.2F - angle, angle, angle * 0.5F), vector_neg(translation), vector_set(2.0F)));
+	}
+
+	// A projection on the left side needs every component
+	lhs[3] = rhs[2];
+
+	const matrix4x4x8f lhs8 = matrix4x4x8_load(lhs);
+	const matrix4x4x8f rhs8 = matrix4x4x8_load(rhs);
+
+	{
+		matrix4x4f output[8];
+		matrix_store(lhs8, output);
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+			CHECK(matrix_near_equal(output[matrix_index], lhs[matrix_index], 0.0F));
+
+		// Partial loads are padded with the identity, partial stores leave the rest untouched
+		const matrix4x4x8f partial = matrix4x4x8_load(lhs, 3);
+		matrix4x4f sentinel[8];
+		for (matrix4x4f& value : sentinel)
+			value = rhs[0];
+
+		matrix_store(partial, sentinel, 5);
+		for (uint32_t matrix_index = 0; matrix_index < 3; ++matrix_index)
+			CHECK(matrix_near_equal(sentinel[matrix_index], lhs[matrix_index], 0.0F));
+		CHECK(matrix_near_equal(sentinel[3], matrix_identity(), 0.0F));
+		CHECK(matrix_near_equal(sentinel[4], matrix_identity(), 0.0F));
+		CHECK(matrix_near_equal(sentinel[5], rhs[0], 0.0F));
+
+		matrix_store(matrix4x4x8_set(rhs[1]), output);
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+			CHECK(matrix_near_equal(output[matrix_index], rhs[1], 0.0F));
+
+		matrix_store(matrix4x4x8_identity(), output);
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+			CHECK(matrix_near_equal(output[matrix_index], matrix_identity(), 0.0F));
+	}
+
+	{
+		matrix4x4f output[8];
+		matrix_store(matrix_mul(lhs8, rhs8), output);
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+			CHECK(matrix_near_equal(output[matrix_index], matrix_mul_reference(lhs[matrix_index], rhs[matrix_index]), threshold));
+
+		// The affine left matrices match matrix_mul
+		CHECK(matrix_near_equal(output[0], matrix_mul(lhs[0], rhs[0]), threshold));
+		CHECK(matrix_near_equal(output[1], matrix_mul(lhs[1], rhs[1]), threshold));
+
+		matrix_store(matrix_transpose(rhs8), output);
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+			CHECK(matrix_near_equal(output[matrix_index], matrix_transpose(rhs[matrix_index]), 0.0F));
+	}
+
+	{
+		float point_x[8];
+		float point_y[8];
+		float point_z[8];
+		float point_w[8];
+		for (uint32_t point_index = 0; point_index < 8; ++point_index)
+		{
+			point_x[point_index] = float(point_index) - 4.0F;
+			point_y[point_index] = 2.0F * float(point_index);
+			point_z[point_index] = 1.5F + float(point_index);
+			point_w[point_index] = 0.5F * float(point_index);
+		}
+
+		float out_x[8];
+		float out_y[8];
+		float out_z[8];
+		float out_w[8];
+		const float4f_soa output{ out_x, out_y, out_z, out_w };
+
+		vector_store(matrix_mul_vector(vector4x8_load(const_float4f_soa{ point_x, point_y, point_z, point_w }, 0), rhs8), output, 0);
+		for (uint32_t point_index = 0; point_index < 8; ++point_index)
+		{
+			const vector4f expected = matrix_mul_vector(vector_set(point_x[point_index], point_y[point_index], point_z[point_index], point_w[point_index]), rhs[point_index]);
+			CHECK(vector_all_near_equal(vector_set(out_x[point_index], out_y[point_index], out_z[point_index], out_w[point_index]), expected, threshold));
+		}
+
+		vector_store(matrix_mul_point3(vector3x8_load(const_float3f_soa{ point_x, point_y, point_z }, 0), rhs8), output, 0);
+		for (uint32_t point_index = 0; point_index < 8; ++point_index)
+		{
+			const vector4f expected = matrix_mul_vector(vector_set(point_x[point_index], point_y[point_index], point_z[point_index], 1.0F), rhs[point_index]);
+			CHECK(vector_all_near_equal(vector_set(out_x[point_index], out_y[point_index], out_z[point_index], out_w[point_index]), expected, threshold));
+		}
+	}
+
+	{
+		float determinants[8];
+		vector_store(matrix_determinant(lhs8), determinants);
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+			CHECK(scalar_near_equal(determinants[matrix_index], scalar_cast(matrix_determinant(lhs[matrix_index])), threshold));
+
+		matrix4x4f output[8];
+		matrix_store(matrix_inverse(lhs8), output);
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+		{
+			CHECK(matrix_near_equal(output[matrix_index], matrix_inverse(lhs[matrix_index]), threshold));
+			CHECK(matrix_near_equal(matrix_mul_reference(lhs[matrix_index], output[matrix_index]), matrix_identity(), threshold));
+		}
+
+		// Singular matrices are replaced by the fallback
+		matrix4x4f singular[8];
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+			singular[matrix_index] = lhs[matrix_index];
+		singular[2].z_axis = vector_zero();
+		singular[6].y_axis = singular[6].x_axis;
+
+		matrix_store(matrix_inverse(matrix4x4x8_load(singular), matrix4x4x8_set(rhs[0])), output);
+		for (uint32_t matrix_index = 0; matrix_index < 8; ++matrix_index)
+		{
+			const bool is_singular = matrix_index == 2 || matrix_index == 6;
+			CHECK(matrix_near_equal(output[matrix_index], is_singular ? rhs[0] : matrix_inverse(lhs[matrix_index]), threshold));
+		}
+	}
+}
@@ -105,10 +105,30 @@ TEST_CASE("misc tests", "[core][memory]")
 	CHECK(align_to(ptr, 4) == (void*)0x00000004);
 	CHECK(align_to(ptr, 8) == (void*)0x00000008);
 
+	alignas(16) float aligned_floats[4] = { 1.0F, 2.0F, 3.0F, 4.0F };
+	const float* aligned_ptr = assume_aligned<16>(&aligned_floats[0]);
+	CHECK(aligned_ptr == &aligned_floats[0]);
+	CHECK(aligned_ptr[3] == 4.0F);
+
 	int32_t array[8];
 	CHECK(get_array_size(array) == (sizeof(array) / sizeof(array[0])));
 }
 
+TEST_CASE("assume support", "[core][memory]")
+{
+	// The unit tests have assert checks enabled, the assumptions are then regular asserts
+	alignas(16) float aligned_floats[4] = { 1.0F, 2.0F, 3.0F, 4.0F };
+	CHECK(safe_ptr_cast<float>(&aligned_floats[0]) == &aligned_floats[0]);
+	CHECK(safe_ptr_cast<const uint32_t>(reinterpret_cast<uintptr_t>(&aligned_floats[0])) == reinterpret_cast<const uint32_t*>(&aligned_floats[0]));
+
+	uint8_t* unaligned_ptr = reinterpret_cast<uint8_t*>(&aligned_floats[0]) + 1;
+	CHECK_THROWS(safe_ptr_cast<float>(unaligned_ptr));
+
+	const int32_t value = static_cast<int32_t>(aligned_floats[3]);
+	RTM_ASSUME(value == 4);
+	CHECK(value == 4);
+}
+
 TEST_CASE("raw memory support", "[core][memory]")
 {
 	uint32_t value32 = 0xAB78FE04;
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/noise.h>
+#include <rtm/batch/noise.h>
+
+#include <cmath>
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_noise_samples = 1027;
+
+// Positions spread over [-50.0, 50.0) on every axis, irrational steps avoid the lattice
+static void make_noise_positions(float* x, float* y, float* z, float* w, uint32_t count)
+{
+	for (uint32_t index = 0; index < count; ++index)
+	{
+		x[index] = std::fmod(float(index) * 0.7548777F, 100.0F) - 50.0F;
+		y[index] = std::fmod(float(index) * 0.5698403F, 100.0F) - 50.0F;
+		z[index] = std::fmod(float(index) * 0.3141593F, 100.0F) - 50.0F;
+		w[index] = std::fmod(float(index) * 0.1618034F, 100.0F) - 50.0F;
+	}
+}
+
+TEST_CASE("noise perlin", "[math][noise]")
+{
+	float x[k_num_noise_samples];
+	float y[k_num_noise_samples];
+	float z[k_num_noise_samples];
+	float w[k_num_noise_samples];
+	make_noise_positions(x, y, z, w, k_num_noise_samples);
+
+	{
+		// Gradient noise is zero on the lattice, up to the rounding of the interpolation
+		const vector4f lattice_x = vector_set(0.0F, 1.0F, -3.0F, 17.0F);
+		const vector4f lattice_y = vector_set(0.0F, -2.0F, 5.0F, -11.0F);
+		const vector4f lattice_z = vector_set(0.0F, 4.0F, -7.0F, 23.0F);
+		CHECK(vector_all_near_equal(noise_perlin3(lattice_x, lattice_y, lattice_z, 3), vector_zero(), 1.0E-6F));
+		CHECK(vector_all_near_equal(noise_perlin4(lattice_x, lattice_y, lattice_z, lattice_x, 3), vector_zero(), 1.0E-6F));
+	}
+
+	{
+		float min_value = 1.0F;
+		float max_value = -1.0F;
+		uint32_t num_seed_differences = 0;
+		for (uint32_t index = 0; index + 4 <= k_num_noise_samples; index += 4)
+		{
+			const vector4f px = vector_load(x + index);
+			const vector4f py = vector_load(y + index);
+			const vector4f pz = vector_load(z + index);
+			const vector4f pw = vector_load(w + index);
+
+			const vector4f value3 = noise_perlin3(px, py, pz, 7);
+			const vector4f value4 = noise_perlin4(px, py, pz, pw, 7);
+
+			// Within [-1.0, 1.0]
+			CHECK(vector_all_less_equal(vector_abs(value3), vector_set(1.0F)));
+			CHECK(vector_all_less_equal(vector_abs(value4), vector_set(1.0F)));
+			min_value = scalar_min(min_value, float(vector_get_min_component(value3)));
+			max_value = scalar_max(max_value, float(vector_get_max_component(value3)));
+
+			// Continuous: a small step moves the value by at most the step times the largest slope
+			const float step = 1.0E-3F;
+			const vector4f stepped3 = noise_perlin3(vector_add(px, vector_set(step)), py, pz, 7);
+			const vector4f stepped4 = noise_perlin4(px, py, pz, vector_add(pw, vector_set(step)), 7);
+			CHECK(vector_all_less_equal(vector_abs(vector_sub(stepped3, value3)), vector_set(step * 4.0F)));
+			CHECK(vector_all_less_equal(vector_abs(vector_sub(stepped4, value4)), vector_set(step * 4.0F)));
+
+			// Another seed is another field
+			const vector4f other_seed3 = noise_perlin3(px, py, pz, 8);
+			num_seed_differences += vector_all_near_equal(other_seed3, value3, 0.0F) ? 0 : 1;
+		}
+
+		// The range is covered
+		CHECK(min_value < -0.5F);
+		CHECK(max_value > 0.5F);
+		CHECK(num_seed_differences > (k_num_noise_samples / 4) * 9 / 10);
+	}
+
+	{
+		// The batch functions match the 4 wide ones, the last positions do not fill a group of 4
+		float batch3[k_num_noise_samples];
+		float batch4[k_num_noise_samples];
+		noise_perlin3_soa(const_float3f_soa{ x, y, z }, batch3, k_num_noise_samples, -5);
+		noise_perlin4_soa(const_float4f_soa{ x, y, z, w }, batch4, k_num_noise_samples, -5);
+
+		for (uint32_t index = 0; index < k_num_noise_samples; ++index)
+		{
+			const vector4f px = vector_set(x[index]);
+			const vector4f py = vector_set(y[index]);
+			const vector4f pz = vector_set(z[index]);
+			const vector4f pw = vector_set(w[index]);
+
+			CHECK(scalar_near_equal(batch3[index], vector_get_x(noise_perlin3(px, py, pz, -5)), 1.0E-6F));
+			CHECK(scalar_near_equal(batch4[index], vector_get_x(noise_perlin4(px, py, pz, pw, -5)), 1.0E-6F));
+		}
+	}
+}
+
+TEST_CASE("noise fbm", "[math][noise]")
+{
+	float x[k_num_noise_samples];
+	float y[k_num_noise_samples];
+	float z[k_num_noise_samples];
+	float w[k_num_noise_samples];
+	make_noise_positions(x, y, z, w, k_num_noise_samples);
+
+	noise_fractal_settings settings;
+	settings.num_octaves = 5;
+	settings.frequency = 0.37F;
+	settings.seed = 11;
+
+	{
+		// A single octave is the noise at the scaled positions
+		noise_fractal_settings single_octave = settings;
+		single_octave.num_octaves = 1;
+
+		const vector4f px = vector_load(x);
+		const vector4f py = vector_load(y);
+		const vector4f pz = vector_load(z);
+		const vector4f pw = vector_load(w);
+		const float frequency = settings.frequency;
+		CHECK(vector_all_near_equal(noise_fbm3(px, py, pz, single_octave), noise_perlin3(vector_mul(px, frequency), vector_mul(py, frequency), vector_mul(pz, frequency), 11), 1.0E-6F));
+		CHECK(vector_all_near_equal(noise_fbm4(px, py, pz, pw, single_octave), noise_perlin4(vector_mul(px, frequency), vector_mul(py, frequency), vector_mul(pz, frequency), vector_mul(pw, frequency), 11), 1.0E-6F));
+	}
+
+	float batch3[k_num_noise_samples];
+	float batch4[k_num_noise_samples];
+	noise_fbm3_soa(const_float3f_soa{ x, y, z }, batch3, k_num_noise_samples, settings);
+	noise_fbm4_soa(const_float4f_soa{ x, y, z, w }, batch4, k_num_noise_samples, settings);
+
+	for (uint32_t index = 0; index < k_num_noise_samples; ++index)
+	{
+		const vector4f px = vector_set(x[index]);
+		const vector4f py = vector_set(y[index]);
+		const vector4f pz = vector_set(z[index]);
+		const vector4f pw = vector_set(w[index]);
+
+		const float value3 = vector_get_x(noise_fbm3(px, py, pz, settings));
+		const float value4 = vector_get_x(noise_fbm4(px, py, pz, pw, settings));
+
+		// Normalized by the sum of the amplitudes
+		CHECK(scalar_abs(value3) <= 1.0F);
+		CHECK(scalar_abs(value4) <= 1.0F);
+
+		CHECK(scalar_near_equal(batch3[index], value3, 1.0E-6F));
+		CHECK(scalar_near_equal(batch4[index], value4, 1.0E-6F));
+	}
+}
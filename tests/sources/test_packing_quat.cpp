@@ -69,3 +69,94 @@ TEST_CASE("quatd packing math", "[math][quat][packing]")
 {
 	test_quat_impl<double>(1.0E-6);
 }
+
+TEST_CASE("quatf smallest three packing math", "[math][quat][packing]")
+{
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 23;
+
+	quatf rotations[num_quats];
+	uint32_t packed32[num_quats];
+	uint64_t packed48[num_quats];
+	uint64_t packed64[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.83F;
+		quatf rotation = quat_from_euler(angle, 1.3F - angle * 0.7F, angle * 1.9F - 2.0F);
+
+		// Exercise a negative largest component
+		if ((quat_index % 2) == 0)
+			rotation = quat_neg(rotation);
+
+		rotations[quat_index] = rotation;
+		packed32[quat_index] = pack_quat_smallest_three_32(rotation);
+		packed48[quat_index] = pack_quat_smallest_three_48(rotation);
+		packed64[quat_index] = pack_quat_smallest_three_64(rotation);
+
+		CHECK((packed48[quat_index] >> 48) == 0);
+	}
+
+	// Every component can be the largest
+	rotations[0] = quat_set(0.9F, 0.1F, -0.3F, 0.3F);
+	rotations[1] = quat_set(0.1F, -0.9F, -0.3F, 0.3F);
+	rotations[2] = quat_set(0.1F, 0.3F, 0.9F, -0.3F);
+	rotations[3] = quat_set(0.1F, 0.3F, -0.3F, -0.9F);
+	for (uint32_t quat_index = 0; quat_index < 4; ++quat_index)
+	{
+		rotations[quat_index] = quat_normalize(rotations[quat_index]);
+		packed32[quat_index] = pack_quat_smallest_three_32(rotations[quat_index]);
+		packed48[quat_index] = pack_quat_smallest_three_48(rotations[quat_index]);
+		packed64[quat_index] = pack_quat_smallest_three_64(rotations[quat_index]);
+
+		CHECK((packed32[quat_index] & 0x3) == quat_index);
+	}
+
+	// The unpacked rotation always has a positive largest component
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const quatf rotation = rotations[quat_index];
+		const quatf neg_rotation = quat_neg(rotation);
+
+		const quatf unpacked32 = unpack_quat_smallest_three_32(packed32[quat_index]);
+		CHECK((quat_near_equal(unpacked32, rotation, 3.0E-3F) || quat_near_equal(unpacked32, neg_rotation, 3.0E-3F)));
+
+		const quatf unpacked48 = unpack_quat_smallest_three_48(packed48[quat_index]);
+		CHECK((quat_near_equal(unpacked48, rotation, 1.0E-4F) || quat_near_equal(unpacked48, neg_rotation, 1.0E-4F)));
+
+		const quatf unpacked64 = unpack_quat_smallest_three_64(packed64[quat_index]);
+		CHECK((quat_near_equal(unpacked64, rotation, 1.0E-5F) || quat_near_equal(unpacked64, neg_rotation, 1.0E-5F)));
+
+		CHECK(quat_is_normalized(unpacked32, 1.0E-5F));
+
+		// Packing the unpacked value again is stable
+		CHECK(pack_quat_smallest_three_32(unpacked32) == packed32[quat_index]);
+	}
+
+	float out_x[num_quats];
+	float out_y[num_quats];
+	float out_z[num_quats];
+	float out_w[num_quats];
+	const float4f_soa output = { out_x, out_y, out_z, out_w };
+
+	unpack_quat_smallest_three_32_soa(packed32, output, num_quats);
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+		CHECK(quat_near_equal(result, unpack_quat_smallest_three_32(packed32[quat_index]), 1.0E-6F));
+	}
+
+	unpack_quat_smallest_three_48_soa(packed48, output, num_quats);
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+		CHECK(quat_near_equal(result, unpack_quat_smallest_three_48(packed48[quat_index]), 1.0E-6F));
+	}
+
+	unpack_quat_smallest_three_64_soa(packed64, output, num_quats);
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const quatf result = quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]);
+		CHECK(quat_near_equal(result, unpack_quat_smallest_three_64(packed64[quat_index]), 1.0E-6F));
+	}
+}
@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/packing/tangent_frame.h>
+
+using namespace rtm;
+
+// Unit vectors spread over the sphere along with the axes, where the octahedron folds
+static constexpr uint32_t k_num_normals = 47;
+
+static vector4f get_test_normal(uint32_t normal_index)
+{
+	if (normal_index < 6)
+	{
+		const float sign = (normal_index % 2) == 0 ? 1.0F : -1.0F;
+		return vector_set(normal_index / 2 == 0 ? sign : 0.0F, normal_index / 2 == 1 ? sign : 0.0F, normal_index / 2 == 2 ? sign : 0.0F, 0.0F);
+	}
+
+	// Fibonacci sphere
+	const float z = 1.0F - 2.0F * (float(normal_index - 6) + 0.5F) / float(k_num_normals - 6);
+	const float radius = scalar_sqrt(1.0F - z * z);
+	const float angle = float(normal_index) * 2.39996323F;
+	return vector_set(radius * scalar_cos(angle), radius * scalar_sin(angle), z, 0.0F);
+}
+
+TEST_CASE("octahedral normal packing math", "[math][vector4][packing]")
+{
+	float3f normals[k_num_normals];
+	for (uint32_t normal_index = 0; normal_index < k_num_normals; ++normal_index)
+	{
+		const vector4f normal = get_test_normal(normal_index);
+		vector_store3(normal, normals + normal_index);
+
+		const vector4f octahedral = vector_to_octahedral(normal);
+		CHECK(vector_all_less_equal(vector_abs(octahedral), vector_set(1.0F)));
+		CHECK(vector_all_near_equal3(vector_from_octahedral(octahedral), normal, 1.0E-6F));
+
+		CHECK(vector_all_near_equal3(unpack_normal_octahedral_16(pack_normal_octahedral_16(normal)), normal, 2.0E-2F));
+		CHECK(vector_all_near_equal3(unpack_normal_octahedral_24(pack_normal_octahedral_24(normal)), normal, 2.0E-3F));
+		CHECK(vector_all_near_equal3(unpack_normal_octahedral_32(pack_normal_octahedral_32(normal)), normal, 1.0E-4F));
+		CHECK((pack_normal_octahedral_24(normal) & 0xFF000000U) == 0);
+	}
+
+	float input_x[k_num_normals];
+	float input_y[k_num_normals];
+	float input_z[k_num_normals];
+	for (uint32_t normal_index = 0; normal_index < k_num_normals; ++normal_index)
+	{
+		input_x[normal_index] = normals[normal_index].x;
+		input_y[normal_index] = normals[normal_index].y;
+		input_z[normal_index] = normals[normal_index].z;
+	}
+
+	const const_float3f_soa input = { input_x, input_y, input_z };
+
+	float output_x[k_num_normals];
+	float output_y[k_num_normals];
+	float output_z[k_num_normals];
+	const float3f_soa output = { output_x, output_y, output_z };
+
+	uint16_t packed16[k_num_normals];
+	pack_normal_octahedral_16_soa(input, packed16, k_num_normals);
+	unpack_normal_octahedral_16_soa(packed16, output, k_num_normals);
+	for (uint32_t normal_index = 0; normal_index < k_num_normals; ++normal_index)
+	{
+		const vector4f normal = vector_load3(normals + normal_index);
+		CHECK(packed16[normal_index] == pack_normal_octahedral_16(normal));
+		CHECK(vector_all_near_equal3(vector_set(output_x[normal_index], output_y[normal_index], output_z[normal_index]), unpack_normal_octahedral_16(packed16[normal_index]), 1.0E-6F));
+	}
+
+	uint32_t packed24[k_num_normals];
+	pack_normal_octahedral_24_soa(input, packed24, k_num_normals);
+	unpack_normal_octahedral_24_soa(packed24, output, k_num_normals);
+	for (uint32_t normal_index = 0; normal_index < k_num_normals; ++normal_index)
+	{
+		const vector4f normal = vector_load3(normals + normal_index);
+		CHECK(packed24[normal_index] == pack_normal_octahedral_24(normal));
+		CHECK(vector_all_near_equal3(vector_set(output_x[normal_index], output_y[normal_index], output_z[normal_index]), unpack_normal_octahedral_24(packed24[normal_index]), 1.0E-6F));
+	}
+
+	uint32_t packed32[k_num_normals];
+	pack_normal_octahedral_32_soa(input, packed32, k_num_normals);
+	unpack_normal_octahedral_32_soa(packed32, output, k_num_normals);
+	for (uint32_t normal_index = 0; normal_index < k_num_normals; ++normal_index)
+	{
+		const vector4f normal = vector_load3(normals + normal_index);
+		CHECK(packed32[normal_index] == pack_normal_octahedral_32(normal));
+		CHECK(vector_all_near_equal3(vector_set(output_x[normal_index], output_y[normal_index], output_z[normal_index]), unpack_normal_octahedral_32(packed32[normal_index]), 1.0E-6F));
+	}
+}
+
+TEST_CASE("qtangent packing math", "[math][quat][packing]")
+{
+	const float threshold = 1.0E-3F;
+
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_vertices = 23;
+
+	float3f normals[num_vertices];
+	float4f tangents[num_vertices];
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const float angle = float(vertex_index) * 0.83F;
+		const quatf rotation = quat_from_euler(angle, 1.3F - angle * 0.7F, angle * 1.9F - 2.0F);
+		const float bitangent_sign = (vertex_index % 3) == 0 ? -1.0F : 1.0F;
+
+		vector_store3(quat_mul_vector3(vector_set(0.0F, 0.0F, 1.0F), rotation), normals + vertex_index);
+		vector_store(vector_set_w(quat_mul_vector3(vector_set(1.0F, 0.0F, 0.0F), rotation), bitangent_sign), tangents + vertex_index);
+	}
+
+	// A half turn around the tangent has a [w] component of zero, its bias preserves the bitangent sign
+	normals[0] = float3f{ 0.0F, 0.0F, -1.0F };
+	tangents[0] = float4f{ 1.0F, 0.0F, 0.0F, -1.0F };
+	normals[1] = float3f{ 0.0F, 0.0F, -1.0F };
+	tangents[1] = float4f{ 1.0F, 0.0F, 0.0F, 1.0F };
+
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const vector4f normal = vector_load3(normals + vertex_index);
+		const vector4f tangent = vector_load(tangents + vertex_index);
+
+		const quatf qtangent = qtangent_from_tangent_frame(normal, tangent);
+		CHECK(quat_is_normalized(qtangent));
+		CHECK((quat_get_w(qtangent) < 0.0F) == (tangents[vertex_index].w < 0.0F));
+		CHECK(scalar_abs(float(quat_get_w(qtangent))) >= 1.0F / 32767.0F);
+
+		vector4f decoded_normal;
+		vector4f decoded_tangent;
+		qtangent_to_tangent_frame(qtangent, decoded_normal, decoded_tangent);
+		CHECK(vector_all_near_equal3(decoded_normal, normal, threshold));
+		CHECK(vector_all_near_equal(decoded_tangent, tangent, threshold));
+
+		unpack_qtangent_snorm16(pack_qtangent_snorm16(normal, tangent), decoded_normal, decoded_tangent);
+		CHECK(vector_all_near_equal3(decoded_normal, normal, threshold));
+		CHECK(vector_all_near_equal(decoded_tangent, tangent, threshold));
+	}
+
+	// The tangent is made orthogonal to the normal
+	{
+		const vector4f normal = vector_set(0.0F, 0.0F, 1.0F);
+		vector4f decoded_normal;
+		vector4f decoded_tangent;
+		qtangent_to_tangent_frame(qtangent_from_tangent_frame(normal, vector_set(1.0F, 0.0F, 0.5F, 1.0F)), decoded_normal, decoded_tangent);
+		CHECK(vector_all_near_equal3(decoded_normal, normal, threshold));
+		CHECK(vector_all_near_equal(decoded_tangent, vector_set(1.0F, 0.0F, 0.0F, 1.0F), threshold));
+	}
+
+	uint64_t packed[num_vertices];
+	pack_qtangent_snorm16_aos(normals, tangents, packed, num_vertices);
+
+	float output[7][num_vertices];
+	unpack_qtangent_snorm16_soa(packed, float3f_soa{ output[0], output[1], output[2] }, float4f_soa{ output[3], output[4], output[5], output[6] }, num_vertices);
+
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		CHECK(packed[vertex_index] == pack_qtangent_snorm16(vector_load3(normals + vertex_index), vector_load(tangents + vertex_index)));
+
+		vector4f normal;
+		vector4f tangent;
+		unpack_qtangent_snorm16(packed[vertex_index], normal, tangent);
+		CHECK(vector_all_near_equal3(vector_set(output[0][vertex_index], output[1][vertex_index], output[2][vertex_index]), normal, 1.0E-5F));
+		CHECK(vector_all_near_equal(vector_set(output[3][vertex_index], output[4][vertex_index], output[5][vertex_index], output[6][vertex_index]), tangent, 1.0E-5F));
+	}
+}
@@ -0,0 +1,212 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/packing/vector4f.h>
+
+using namespace rtm;
+
+TEST_CASE("vector4f packing math", "[math][vector4][packing]")
+{
+	{
+		CHECK(pack_vector4_unorm8(vector_set(0.0F, 1.0F, 0.5F, 2.0F)) == 0xFF80FF00U);
+		CHECK(pack_vector4_unorm8(vector_set(-1.0F, 1.0F / 255.0F, 0.25F, 0.75F)) == 0xBF400100U);
+		CHECK(vector_all_near_equal(unpack_vector4_unorm8(0xFF80FF00U), vector_set(0.0F, 1.0F, 128.0F / 255.0F, 1.0F), 1.0E-7F));
+		CHECK(vector_get_y(unpack_vector4_unorm8(0xFF80FF00U)) == 1.0F);
+
+		for (uint32_t value = 0; value < 256; ++value)
+		{
+			const uint32_t packed = value | ((255 - value) << 8) | (value << 16) | ((value ^ 0x55) << 24);
+			CHECK(pack_vector4_unorm8(unpack_vector4_unorm8(packed)) == packed);
+		}
+	}
+
+	{
+		CHECK(pack_vector4_snorm8(vector_set(0.0F, 1.0F, -1.0F, -2.0F)) == 0x81817F00U);
+		CHECK(vector_all_near_equal(unpack_vector4_snorm8(0x80817F00U), vector_set(0.0F, 1.0F, -1.0F, -1.0F), 0.0F));
+
+		// -128 unpacks to -1.0 which packs back as -127
+		for (uint32_t value = 1; value < 256; ++value)
+		{
+			const uint32_t packed = value | (value << 8) | (value << 16) | (value << 24);
+			CHECK(pack_vector4_snorm8(unpack_vector4_snorm8(packed)) == (value == 0x80 ? 0x81818181U : packed));
+		}
+	}
+
+	{
+		CHECK(pack_vector4_unorm16(vector_set(0.0F, 1.0F, 0.5F, 2.0F)) == 0xFFFF8000FFFF0000ULL);
+		CHECK(vector_all_near_equal(unpack_vector4_unorm16(0xFFFF8000FFFF0000ULL), vector_set(0.0F, 1.0F, 32768.0F / 65535.0F, 1.0F), 1.0E-7F));
+		CHECK(vector_get_y(unpack_vector4_unorm16(0xFFFF8000FFFF0000ULL)) == 1.0F);
+
+		for (uint64_t value = 0; value < 65536; value += 7)
+		{
+			const uint64_t packed = value | ((65535 - value) << 16) | (value << 32) | ((value ^ 0x5555) << 48);
+			CHECK(pack_vector4_unorm16(unpack_vector4_unorm16(packed)) == packed);
+		}
+	}
+
+	{
+		CHECK(pack_vector4_snorm16(vector_set(0.0F, 1.0F, -1.0F, -2.0F)) == 0x800180017FFF0000ULL);
+		CHECK(vector_all_near_equal(unpack_vector4_snorm16(0x800080017FFF0000ULL), vector_set(0.0F, 1.0F, -1.0F, -1.0F), 0.0F));
+
+		// -32768 unpacks to -1.0 which packs back as -32767
+		for (uint64_t value = 1; value < 65536; value += 7)
+		{
+			const uint64_t packed = value | (value << 16) | (value << 32) | (value << 48);
+			CHECK(pack_vector4_snorm16(unpack_vector4_snorm16(packed)) == (value == 0x8000 ? 0x8001800180018001ULL : packed));
+		}
+	}
+
+	{
+		CHECK(pack_vector4_unorm10_10_10_2(vector_set(0.0F, 1.0F, 0.5F, 1.0F)) == 0xE00FFC00U);
+		CHECK(pack_vector4_unorm10_10_10_2(vector_set(1.0F, 0.0F, 1.0F, 1.0F / 3.0F)) == 0x7FF003FFU);
+		CHECK(vector_all_near_equal(unpack_vector4_unorm10_10_10_2(0xE00FFC00U), vector_set(0.0F, 1.0F, 512.0F / 1023.0F, 1.0F), 1.0E-7F));
+		CHECK(vector_get_y(unpack_vector4_unorm10_10_10_2(0xE00FFC00U)) == 1.0F);
+		CHECK(vector_get_w(unpack_vector4_unorm10_10_10_2(0xE00FFC00U)) == 1.0F);
+
+		for (uint32_t value = 0; value < 1024; ++value)
+		{
+			const uint32_t packed = value | ((1023 - value) << 10) | ((value ^ 0x155) << 20) | ((value & 3) << 30);
+			CHECK(pack_vector4_unorm10_10_10_2(unpack_vector4_unorm10_10_10_2(packed)) == packed);
+		}
+	}
+
+	{
+		CHECK(pack_vector3_unorm11_11_10(vector_set(0.0F, 1.0F, 1.0F, 123.0F)) == 0xFFFFF800U);
+		CHECK(pack_vector3_unorm11_11_10(vector_set(1.0F, 0.0F, 0.5F, 0.0F)) == 0x800007FFU);
+		CHECK(vector_all_near_equal(unpack_vector3_unorm11_11_10(0xFFFFF800U), vector_set(0.0F, 1.0F, 1.0F, 0.0F), 1.0E-7F));
+		CHECK(vector_get_y(unpack_vector3_unorm11_11_10(0xFFFFF800U)) == 1.0F);
+		CHECK(vector_get_z(unpack_vector3_unorm11_11_10(0xFFFFF800U)) == 1.0F);
+
+		for (uint32_t value = 0; value < 2048; ++value)
+		{
+			const uint32_t packed = value | ((2047 - value) << 11) | ((value & 0x3FF) << 22);
+			CHECK(pack_vector3_unorm11_11_10(unpack_vector3_unorm11_11_10(packed)) == packed);
+		}
+	}
+
+	{
+		const vector4f range_min = vector_set(-10.0F, 2.0F, 0.0F, 5.0F);
+		const vector4f range_extent = vector_set(20.0F, 4.0F, 1.0F, 0.0F);
+		const vector4f value = vector_set(5.0F, 3.0F, 0.25F, 5.0F);
+
+		const vector4f reduced = vector_range_reduce(value, range_min, range_extent);
+		CHECK(vector_all_near_equal(reduced, vector_set(0.75F, 0.25F, 0.25F, 0.0F), 1.0E-6F));
+		CHECK(vector_all_near_equal(vector_range_expand(reduced, range_min, range_extent), value, 1.0E-6F));
+	}
+}
+
+TEST_CASE("vector4f packing batch math", "[math][vector4][packing][batch]")
+{
+	constexpr uint32_t num_vectors = 7;
+
+	const vector4f range_min = vector_set(-10.0F, 2.0F, 0.0F, -1.0F);
+	const vector4f range_extent = vector_set(20.0F, 4.0F, 1.0F, 2.0F);
+
+	vector4f unorm_values[num_vectors];
+	vector4f snorm_values[num_vectors];
+	vector4f range_values[num_vectors];
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		const float alpha = float(vector_index) / float(num_vectors - 1);
+		unorm_values[vector_index] = vector_set(alpha, 1.0F - alpha, alpha * alpha, 0.5F);
+		snorm_values[vector_index] = vector_sub(vector_mul(unorm_values[vector_index], 2.0F), vector_set(1.0F));
+		range_values[vector_index] = vector_range_expand(unorm_values[vector_index], range_min, range_extent);
+	}
+
+	uint32_t packed32[num_vectors];
+	uint64_t packed64[num_vectors];
+	vector4f unpacked[num_vectors];
+
+	pack_vector4_unorm8_aos(unorm_values, packed32, num_vectors);
+	unpack_vector4_unorm8_aos(packed32, unpacked, num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		CHECK(packed32[vector_index] == pack_vector4_unorm8(unorm_values[vector_index]));
+		CHECK(vector_all_near_equal(unpacked[vector_index], unorm_values[vector_index], 0.51F / 255.0F));
+	}
+
+	pack_vector4_snorm8_aos(snorm_values, packed32, num_vectors);
+	unpack_vector4_snorm8_aos(packed32, unpacked, num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		CHECK(packed32[vector_index] == pack_vector4_snorm8(snorm_values[vector_index]));
+		CHECK(vector_all_near_equal(unpacked[vector_index], snorm_values[vector_index], 0.51F / 127.0F));
+	}
+
+	pack_vector4_unorm16_aos(unorm_values, packed64, num_vectors);
+	unpack_vector4_unorm16_aos(packed64, unpacked, num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		CHECK(packed64[vector_index] == pack_vector4_unorm16(unorm_values[vector_index]));
+		CHECK(vector_all_near_equal(unpacked[vector_index], unorm_values[vector_index], 0.51F / 65535.0F));
+	}
+
+	pack_vector4_snorm16_aos(snorm_values, packed64, num_vectors);
+	unpack_vector4_snorm16_aos(packed64, unpacked, num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+	{
+		CHECK(packed64[vector_index] == pack_vector4_snorm16(snorm_values[vector_index]));
+		CHECK(vector_all_near_equal(unpacked[vector_index], snorm_values[vector_index], 0.51F / 32767.0F));
+	}
+
+	pack_vector4_unorm16_aos(range_values, range_min, range_extent, packed64, num_vectors);
+	unpack_vector4_unorm16_aos(packed64, range_min, range_extent, unpacked, num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		CHECK(vector_all_near_equal(unpacked[vector_index], range_values[vector_index], 20.0F / 65535.0F));
+
+	pack_vector4_unorm10_10_10_2_aos(range_values, range_min, range_extent, packed32, num_vectors);
+	unpack_vector4_unorm10_10_10_2_aos(packed32, range_min, range_extent, unpacked, num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		CHECK(vector_all_near_equal3(unpacked[vector_index], range_values[vector_index], 20.0F / 1023.0F));
+
+	pack_vector3_unorm11_11_10_aos(range_values, range_min, range_extent, packed32, num_vectors);
+	unpack_vector3_unorm11_11_10_aos(packed32, range_min, range_extent, unpacked, num_vectors);
+	for (uint32_t vector_index = 0; vector_index < num_vectors; ++vector_index)
+		CHECK(vector_all_near_equal3(unpacked[vector_index], range_values[vector_index], 20.0F / 1023.0F));
+}
+
+TEST_CASE("vector4f packing half precision", "[math][vector4][packing]")
+{
+	// Odd count to exercise the wide loops along with the remainder
+	constexpr uint32_t num_values = 23;
+
+	float values[num_values];
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+		values[value_index] = (float(value_index) - 11.3F) * 17.1F;
+
+	uint16_t packed[num_values];
+	pack_half_array(values, packed, num_values);
+
+	float unpacked[num_values];
+	unpack_half_array(packed, unpacked, num_values);
+
+	for (uint32_t value_index = 0; value_index < num_values; ++value_index)
+	{
+		CHECK(packed[value_index] == scalar_float_to_half(values[value_index]));
+		CHECK(unpacked[value_index] == scalar_half_to_float(packed[value_index]));
+	}
+}
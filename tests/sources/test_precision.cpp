@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/precision.h>
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/quatf.h>
+#include <rtm/batch/vector4f.h>
+
+#include <cmath>
+
+using namespace rtm;
+
+// A pipeline written once, specialized for every policy
+template<typename precision_policy>
+static quatf evaluate_rotation(quatf_arg0 start, quatf_arg1 end, float alpha, float angle)
+{
+	const quatf interpolated = quat_interpolate(start, end, alpha, precision_policy());
+	const quatf twist = quat_set(0.0F, 0.0F, scalar_sin(angle * 0.5F, precision_policy()), scalar_cos(angle * 0.5F, precision_policy()));
+	return quat_normalize(quat_mul(interpolated, twist), precision_policy());
+}
+
+TEST_CASE("precision policy trigonometry", "[math][precision]")
+{
+	for (float angle = -10.0F; angle <= 10.0F; angle += 0.37F)
+	{
+		CHECK(scalar_sin(angle, precision::fast()) == scalar_sin_fast(angle));
+		CHECK(scalar_cos(angle, precision::fast()) == scalar_cos_fast(angle));
+		CHECK(scalar_sin(angle, precision::standard()) == scalar_sin(angle));
+		CHECK(scalar_cos(angle, precision::standard()) == scalar_cos(angle));
+		CHECK(scalar_near_equal(scalar_sin(angle, precision::exact()), float(std::sin(double(angle))), 1.0E-7F));
+		CHECK(scalar_near_equal(scalar_cos(angle, precision::exact()), float(std::cos(double(angle))), 1.0E-7F));
+
+		const vector4f angles = vector_set(angle, angle * 0.5F, -angle, angle * 0.1F);
+		CHECK(vector_all_near_equal(vector_sin(angles, precision::fast()), vector_sin_fast(angles), 0.0F));
+		CHECK(vector_all_near_equal(vector_sin(angles, precision::standard()), vector_sin(angles), 0.0F));
+		CHECK(vector_all_near_equal(vector_sin(angles, precision::exact()), vector_set(float(std::sin(double(angle))), float(std::sin(double(angle * 0.5F))), float(std::sin(double(-angle))), float(std::sin(double(angle * 0.1F)))), 1.0E-7F));
+		CHECK(vector_all_near_equal(vector_atan2(angles, vector_set(1.0F), precision::fast()), vector_atan2_fast(angles, vector_set(1.0F)), 0.0F));
+	}
+
+	for (float value = -1.0F; value <= 1.0F; value += 0.1F)
+	{
+		CHECK(scalar_acos(value, precision::fast()) == scalar_acos_fast(value));
+		CHECK(scalar_acos(value, precision::standard()) == scalar_acos(value));
+		CHECK(scalar_near_equal(scalar_acos(value, precision::exact()), float(std::acos(double(value))), 1.0E-6F));
+		CHECK(scalar_near_equal(scalar_atan2(value, 0.5F, precision::exact()), float(std::atan2(double(value), 0.5)), 1.0E-6F));
+	}
+}
+
+TEST_CASE("precision policy quatf", "[math][precision]")
+{
+	const quatf start = quat_from_euler(0.2F, 1.1F, -0.4F);
+	const quatf end = quat_from_euler(-1.3F, 0.4F, 2.2F);
+
+	const quatf scaled = vector_to_quat(vector_mul(quat_to_vector(start), 3.5F));
+	CHECK(quat_near_equal(quat_normalize(scaled, precision::fast()), start, 1.0E-4F));
+	CHECK(quat_near_equal(quat_normalize(scaled, precision::standard()), start, 1.0E-6F));
+	CHECK(quat_near_equal(quat_normalize(scaled, precision::exact()), start, 1.0E-6F));
+
+	for (float alpha = 0.0F; alpha <= 1.0F; alpha += 0.125F)
+	{
+		CHECK(quat_near_equal(quat_interpolate(start, end, alpha, precision::fast()), quat_lerp(start, end, alpha), 0.0F));
+		CHECK(quat_near_equal(quat_interpolate(start, end, alpha, precision::standard()), quat_slerp_fast(start, end, alpha), 0.0F));
+		CHECK(quat_near_equal(quat_interpolate(start, end, alpha, precision::exact()), quat_slerp(start, end, alpha), 0.0F));
+
+		const quatf reference = evaluate_rotation<precision::exact>(start, end, alpha, 0.7F);
+		CHECK(quat_near_equal(evaluate_rotation<precision::standard>(start, end, alpha, 0.7F), reference, 1.0E-4F));
+		CHECK(quat_is_normalized(evaluate_rotation<precision::fast>(start, end, alpha, 0.7F)));
+	}
+}
+
+TEST_CASE("precision policy batch", "[math][precision][batch]")
+{
+	// Odd count to exercise the wide loop along with the remainder
+	constexpr uint32_t num_quats = 11;
+
+	float start_x[num_quats], start_y[num_quats], start_z[num_quats], start_w[num_quats];
+	float end_x[num_quats], end_y[num_quats], end_z[num_quats], end_w[num_quats];
+	float out_x[num_quats], out_y[num_quats], out_z[num_quats], out_w[num_quats];
+	float ref_x[num_quats], ref_y[num_quats], ref_z[num_quats], ref_w[num_quats];
+	float alphas[num_quats];
+
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float value = float(quat_index);
+		const quatf start = quat_from_euler(value * 0.3F, 1.0F - value * 0.2F, value);
+		const quatf end = quat_from_euler(-value * 0.1F, value * 0.4F, 0.5F);
+
+		start_x[quat_index] = quat_get_x(start) * 2.0F;
+		start_y[quat_index] = quat_get_y(start) * 2.0F;
+		start_z[quat_index] = quat_get_z(start) * 2.0F;
+		start_w[quat_index] = quat_get_w(start) * 2.0F;
+		end_x[quat_index] = quat_get_x(end);
+		end_y[quat_index] = quat_get_y(end);
+		end_z[quat_index] = quat_get_z(end);
+		end_w[quat_index] = quat_get_w(end);
+		alphas[quat_index] = value / float(num_quats);
+	}
+
+	const const_float4f_soa start_soa{ start_x, start_y, start_z, start_w };
+	const const_float4f_soa end_soa{ end_x, end_y, end_z, end_w };
+	const float4f_soa output_soa{ out_x, out_y, out_z, out_w };
+	const float4f_soa reference_soa{ ref_x, ref_y, ref_z, ref_w };
+
+	{
+		// The policy selects the same kernel as the runtime precision
+		quat_normalize_soa(start_soa, output_soa, num_quats, precision::fast());
+		quat_normalize_soa(start_soa, reference_soa, num_quats, normalize_precision::refined);
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			CHECK(out_x[quat_index] == ref_x[quat_index]);
+			CHECK(out_w[quat_index] == ref_w[quat_index]);
+		}
+
+		quat_normalize_soa(start_soa, output_soa, num_quats, precision::exact());
+		quat_normalize_soa(start_soa, reference_soa, num_quats, normalize_precision::exact);
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			CHECK(out_x[quat_index] == ref_x[quat_index]);
+			CHECK(out_w[quat_index] == ref_w[quat_index]);
+		}
+
+		const const_float3f_soa vector_soa{ start_x, start_y, start_z };
+		vector_normalize3_soa(vector_soa, float3f_soa{ out_x, out_y, out_z }, num_quats, precision::standard());
+		vector_normalize3_soa(vector_soa, float3f_soa{ ref_x, ref_y, ref_z }, num_quats, normalize_precision::exact);
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+			CHECK(out_y[quat_index] == ref_y[quat_index]);
+	}
+
+	{
+		// Normalize the start rotations for the interpolation
+		quat_normalize_soa(start_soa, float4f_soa{ start_x, start_y, start_z, start_w }, num_quats, precision::exact());
+
+		quat_interpolate_soa(start_soa, end_soa, alphas, output_soa, num_quats, precision::fast());
+		quat_lerp_soa(start_soa, end_soa, alphas, reference_soa, num_quats);
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+			CHECK(out_z[quat_index] == ref_z[quat_index]);
+
+		quat_interpolate_soa(start_soa, end_soa, alphas, output_soa, num_quats, precision::standard());
+		quat_slerp_fast_soa(start_soa, end_soa, alphas, reference_soa, num_quats);
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+			CHECK(out_z[quat_index] == ref_z[quat_index]);
+
+		quat_interpolate_soa(start_soa, end_soa, alphas, output_soa, num_quats, precision::exact());
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf start = quat_set(start_x[quat_index], start_y[quat_index], start_z[quat_index], start_w[quat_index]);
+			const quatf end = quat_set(end_x[quat_index], end_y[quat_index], end_z[quat_index], end_w[quat_index]);
+			const quatf expected = quat_slerp(start, end, alphas[quat_index]);
+			CHECK(quat_near_equal(quat_set(out_x[quat_index], out_y[quat_index], out_z[quat_index], out_w[quat_index]), expected, 0.0F));
+		}
+	}
+}
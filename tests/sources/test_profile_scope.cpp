@@ -0,0 +1,79 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+// Only the error header is included so that the batch functions, compiled by
+// other translation units without profiling scopes, are not redefined here
+namespace
+{
+	struct test_profile_scope
+	{
+		static const char* s_name;
+		static uint64_t s_num_elements;
+		static uint64_t s_num_bytes;
+		static uint32_t s_num_active;
+
+		test_profile_scope(const char* name, uint64_t num_elements, uint64_t num_bytes)
+		{
+			s_name = name;
+			s_num_elements = num_elements;
+			s_num_bytes = num_bytes;
+			s_num_active++;
+		}
+
+		~test_profile_scope() { s_num_active--; }
+	};
+
+	const char* test_profile_scope::s_name = nullptr;
+	uint64_t test_profile_scope::s_num_elements = 0;
+	uint64_t test_profile_scope::s_num_bytes = 0;
+	uint32_t test_profile_scope::s_num_active = 0;
+}
+
+#define RTM_ON_PROFILE_SCOPE_CUSTOM test_profile_scope
+#include <rtm/impl/error.h>
+
+static uint32_t profiled_function(uint32_t num_values)
+{
+	RTM_PROFILE_SCOPE("rtm::profiled_function", num_values, num_values * sizeof(float) * 2);
+	return test_profile_scope::s_num_active;
+}
+
+TEST_CASE("profile scope tests", "[core][error]")
+{
+#if !defined(RTM_HAS_PROFILE_SCOPES)
+	FAIL("RTM_HAS_PROFILE_SCOPES should be defined");
+#endif
+
+	CHECK(test_profile_scope::s_num_active == 0);
+	CHECK(profiled_function(13) == 1);
+	CHECK(test_profile_scope::s_num_active == 0);
+	CHECK(std::strcmp(test_profile_scope::s_name, "rtm::profiled_function") == 0);
+	CHECK(test_profile_scope::s_num_elements == 13);
+	CHECK(test_profile_scope::s_num_bytes == 13 * sizeof(float) * 2);
+}
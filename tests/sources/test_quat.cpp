@@ -396,6 +396,22 @@ static void test_quat_impl(const FloatType threshold)
 		CHECK(quat_near_equal(rotation, rotation_new, threshold));
 	}
 
+	{
+		// The scalar overloads keep the angle and the thresholds in registers
+		QuatType rotation = quat_from_euler(scalar_deg_to_rad(FloatType(0.0)), scalar_deg_to_rad(FloatType(90.0)), scalar_deg_to_rad(FloatType(0.0)));
+		const ScalarType threshold_s = scalar_set(threshold);
+		Vector4Type axis;
+		ScalarType angle;
+		quat_to_axis_angle(rotation, axis, angle);
+		const ScalarType angle_s = quat_get_angle(rotation);
+		CHECK(scalar_near_equal(scalar_cast(angle), scalar_deg_to_rad(FloatType(90.0)), threshold));
+		CHECK(scalar_near_equal(scalar_cast(angle_s), scalar_deg_to_rad(FloatType(90.0)), threshold));
+		CHECK(quat_near_equal(rotation, quat_from_axis_angle(axis, angle), threshold_s));
+		CHECK(quat_is_normalized(rotation, threshold_s));
+		CHECK(quat_near_identity(identity, threshold_s));
+		CHECK(quat_near_identity(rotation, threshold_s) == false);
+	}
+
 	{
 		QuatType rotation = quat_set(FloatType(0.39564531008956383), FloatType(0.044254239301713752), FloatType(0.22768840967675355), FloatType(0.88863059760894492));
 		Vector4Type axis_ref = vector_set(FloatType(1.0), FloatType(0.0), FloatType(0.0));
@@ -409,6 +425,45 @@ static void test_quat_impl(const FloatType threshold)
 		CHECK(scalar_near_equal(angle, angle_ref, threshold));
 	}
 
+	{
+		// Angles within the canonical ranges round trip exactly, gimbal locked rotations fold the roll into the yaw
+		const FloatType angles[][3] =
+		{
+			{ FloatType(12.3), FloatType(42.8), FloatType(33.41) },
+			{ FloatType(-75.0), FloatType(-170.0), FloatType(120.0) },
+			{ FloatType(0.0), FloatType(179.0), FloatType(-179.0) },
+			{ FloatType(89.0), FloatType(-20.0), FloatType(5.0) },
+			{ FloatType(90.0), FloatType(30.0), FloatType(0.0) },
+			{ FloatType(-90.0), FloatType(-45.0), FloatType(0.0) },
+		};
+
+		for (const auto& angle : angles)
+		{
+			INFO("pitch: " << angle[0] << " yaw: " << angle[1] << " roll: " << angle[2]);
+
+			const QuatType rotation = quat_from_euler(scalar_deg_to_rad(angle[0]), scalar_deg_to_rad(angle[1]), scalar_deg_to_rad(angle[2]));
+			FloatType pitch;
+			FloatType yaw;
+			FloatType roll;
+			quat_to_euler(rotation, pitch, yaw, roll);
+			CHECK(scalar_near_equal(pitch, scalar_deg_to_rad(angle[0]), threshold * FloatType(10.0)));
+			CHECK(scalar_near_equal(yaw, scalar_deg_to_rad(angle[1]), threshold * FloatType(10.0)));
+			CHECK(scalar_near_equal(roll, scalar_deg_to_rad(angle[2]), threshold * FloatType(10.0)));
+			CHECK(quat_near_equal(quat_from_euler(pitch, yaw, roll), rotation, threshold));
+		}
+
+		{
+			// In gimbal lock, yaw and roll rotate around the same axis
+			const QuatType rotation = quat_from_euler(scalar_deg_to_rad(FloatType(90.0)), scalar_deg_to_rad(FloatType(30.0)), scalar_deg_to_rad(FloatType(25.0)));
+			FloatType pitch;
+			FloatType yaw;
+			FloatType roll;
+			quat_to_euler(rotation, pitch, yaw, roll);
+			CHECK(roll == FloatType(0.0));
+			CHECK(quat_near_equal(quat_from_euler(pitch, yaw, roll), rotation, threshold));
+		}
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Comparisons and masking
 
@@ -456,6 +511,199 @@ TEST_CASE("quatf math", "[math][quat]")
 {
 	test_quat_impl<float>(1.0E-4F);
 
+	{
+		// The fast slerp weights are accurate to 2.0e-5 for any pair of rotations
+		const float slerp_fast_threshold = 5.0E-5F;
+		const float alphas[] = { 0.0F, 0.1F, 0.33F, 0.5F, 0.75F, 1.0F };
+
+		for (uint32_t pair_index = 0; pair_index < 16; ++pair_index)
+		{
+			const float angle = float(pair_index) * 0.41F;
+			const quatf quat0 = quat_from_euler(angle, 0.5F - angle, angle * 1.5F);
+			quatf quat1 = quat_from_euler(2.0F * angle - 1.0F, angle, 0.3F - angle);
+			if ((pair_index % 3) == 0)
+				quat1 = quat_neg(quat1);
+
+			for (const float alpha : alphas)
+			{
+				INFO("pair: " << pair_index << " alpha: " << alpha);
+
+				const quatf result_ref = quat_slerp(quat0, quat1, alpha);
+				CHECK(quat_near_equal(quat_slerp_fast(quat0, quat1, alpha), result_ref, slerp_fast_threshold));
+				CHECK(quat_near_equal(quat_slerp_fast(quat0, quat1, scalar_set(alpha)), result_ref, slerp_fast_threshold));
+			}
+		}
+
+		// Identical rotations do not divide by zero
+		const quatf quat0 = quat_from_euler(0.3F, -0.2F, 1.1F);
+		CHECK(quat_near_equal(quat_slerp_fast(quat0, quat0, 0.4F), quat0, 1.0E-6F));
+	}
+
+	{
+		// Both the polynomial and the sin/cos paths of quat_exp round trip with quat_log
+		const float angles[] = { 0.0F, 1.0E-4F, 0.1F, 0.9F, 1.9F, 2.1F, 3.0F };
+		const vector4f axis = vector_normalize3(vector_set(0.3F, -0.5F, 0.8F));
+
+		for (const float angle : angles)
+		{
+			INFO("angle: " << angle);
+
+			const quatf rotation = quat_from_axis_angle(axis, angle);
+			const vector4f half_angle_vector = vector_mul(axis, angle * 0.5F);
+			CHECK(quat_near_equal(quat_exp(half_angle_vector), rotation, 1.0E-6F));
+			CHECK(vector_all_near_equal3(quat_log(rotation), half_angle_vector, 1.0E-5F));
+			CHECK(vector_get_w(quat_log(rotation)) == 0.0F);
+		}
+
+		CHECK(quat_near_equal(quat_exp(vector_zero()), quat_identity(), 0.0F));
+	}
+
+	{
+		// Integrating a constant angular velocity matches the axis/angle rotation
+		const quatf rotation = quat_from_euler(0.3F, -0.2F, 1.1F);
+		const vector4f axis = vector_normalize3(vector_set(-0.2F, 0.9F, 0.4F));
+		const float speeds[] = { 0.0F, 2.0F, 30.0F, 150.0F };
+		const float delta_time = 1.0F / 60.0F;
+
+		for (const float speed : speeds)
+		{
+			INFO("speed: " << speed);
+
+			const vector4f angular_velocity = vector_mul(axis, speed);
+			const quatf expected = quat_mul(rotation, quat_from_axis_angle(axis, speed * delta_time));
+			const quatf result = quat_integrate(rotation, angular_velocity, delta_time);
+			CHECK(quat_near_equal(result, expected, 1.0E-6F));
+			CHECK(quat_is_normalized(result));
+
+			quatf integrated = rotation;
+			for (uint32_t step = 0; step < 60; ++step)
+				integrated = quat_integrate(integrated, angular_velocity, delta_time);
+
+			const quatf expected_one_second = quat_mul(rotation, quat_from_axis_angle(axis, speed));
+			CHECK(scalar_abs(float(quat_dot(integrated, expected_one_second))) >= 0.9999F);
+		}
+	}
+
+	{
+		// The twist rotates around the axis, the swing around a perpendicular axis
+		const vector4f twist_axis = vector_normalize3(vector_set(0.2F, 0.9F, -0.3F));
+		const vector4f swing_axis = vector_normalize3(vector_cross3(twist_axis, vector_set(1.0F, 0.0F, 0.0F)));
+		const float angles[] = { 0.0F, 0.3F, -0.8F, 1.5F, -2.5F, 3.1F };
+
+		for (const float twist_angle : angles)
+		{
+			for (const float swing_angle : angles)
+			{
+				INFO("twist: " << twist_angle << " swing: " << swing_angle);
+
+				const quatf twist_ref = quat_from_axis_angle(twist_axis, twist_angle);
+				const quatf swing_ref = quat_from_axis_angle(swing_axis, swing_angle);
+				const quatf rotation = quat_mul(twist_ref, swing_ref);
+
+				quatf swing;
+				quatf twist;
+				quat_swing_twist(rotation, twist_axis, swing, twist);
+				CHECK(quat_near_equal(quat_mul(twist, swing), rotation, 1.0E-5F));
+				CHECK(quat_get_w(twist) >= 0.0F);
+				CHECK(scalar_abs(float(quat_dot(twist, twist_ref))) >= 0.99999F);
+				CHECK(scalar_abs(float(quat_dot(swing, swing_ref))) >= 0.99999F);
+
+				// Limits are in [-1.0, 1.2] for the twist and [0.0, 0.9] for the swing
+				const float clamped_twist_angle = scalar_clamp(twist_angle, -1.0F, 1.2F);
+				const float clamped_swing_angle = scalar_clamp(swing_angle, -0.9F, 0.9F);
+				const quatf expected = quat_mul(quat_from_axis_angle(twist_axis, clamped_twist_angle), quat_from_axis_angle(swing_axis, clamped_swing_angle));
+				const quatf clamped = quat_clamp_swing_twist(rotation, twist_axis, 0.9F, -1.0F, 1.2F);
+				CHECK(scalar_abs(float(quat_dot(clamped, expected))) >= 0.99999F);
+				CHECK(quat_is_normalized(clamped));
+			}
+		}
+
+		// A half turn around a perpendicular axis has no twist
+		quatf swing;
+		quatf twist;
+		const quatf half_turn = quat_from_axis_angle(swing_axis, rtm::constants::pi());
+		quat_swing_twist(half_turn, twist_axis, swing, twist);
+		CHECK(quat_near_equal(twist, quat_identity(), 1.0E-6F));
+		CHECK(quat_near_equal(swing, half_turn, 1.0E-6F));
+	}
+
+	{
+		const vector4f directions[] =
+		{
+			vector_set(1.0F, 0.0F, 0.0F),
+			vector_set(0.0F, 0.0F, 1.0F),
+			vector_set(2.0F, -3.0F, 0.5F),
+			vector_set(-0.1F, 0.2F, 4.0F),
+			vector_set(-2.0F, 3.0F, -0.5F),
+			vector_set(0.3F, 0.3F, -0.3F),
+		};
+
+		for (const vector4f& from : directions)
+		{
+			for (const vector4f& to : directions)
+			{
+				const vector4f from_axis = vector_normalize3(from);
+				const vector4f to_axis = vector_normalize3(to);
+
+				const quatf rotation = quat_from_to(from, to);
+				CHECK(quat_is_normalized(rotation));
+				CHECK(vector_all_near_equal3(quat_mul_vector3(from_axis, rotation), to_axis, 1.0E-5F));
+
+				// The shortest arc matches the axis/angle rotation around their cross product
+				const vector4f axis = vector_cross3(from_axis, to_axis);
+				if (float(vector_length_squared3(axis)) > 1.0E-6F)
+				{
+					const float angle = scalar_acos(scalar_clamp(float(vector_dot3(from_axis, to_axis)), -1.0F, 1.0F));
+					CHECK(quat_near_equal(rotation, quat_from_axis_angle(vector_normalize3(axis), angle), 1.0E-5F));
+				}
+			}
+
+			// Opposite directions rotate by a half turn
+			const quatf half_turn = quat_from_to(from, vector_neg(from));
+			CHECK(quat_is_normalized(half_turn));
+			CHECK(scalar_near_equal(float(quat_get_w(half_turn)), 0.0F, 1.0E-6F));
+			CHECK(vector_all_near_equal3(quat_mul_vector3(vector_normalize3(from), half_turn), vector_neg(vector_normalize3(from)), 1.0E-5F));
+		}
+
+		const vector4f x_axis = vector_set(1.0F, 0.0F, 0.0F);
+		const vector4f y_axis = vector_set(0.0F, 1.0F, 0.0F);
+		const vector4f z_axis = vector_set(0.0F, 0.0F, 1.0F);
+		CHECK(quat_near_equal(quat_look_rotation(x_axis, z_axis), quat_identity(), 1.0E-6F));
+		CHECK(quat_near_equal(quat_look_rotation(vector_set(3.0F, 0.0F, 0.0F), vector_set(0.5F, 0.0F, 2.0F)), quat_identity(), 1.0E-6F));
+
+		for (const vector4f& forward : directions)
+		{
+			const vector4f up = vector_set(0.2F, -0.1F, 1.0F);
+			const quatf rotation = quat_look_rotation(forward, up);
+			const vector4f forward_axis = vector_normalize3(forward);
+			CHECK(quat_is_normalized(rotation));
+			CHECK(vector_all_near_equal3(quat_mul_vector3(x_axis, rotation), forward_axis, 1.0E-5F));
+
+			// The rotated up axis is orthogonal to forward and in the plane of forward and up
+			const vector4f rotated_up = quat_mul_vector3(z_axis, rotation);
+			CHECK(scalar_near_equal(float(vector_dot3(rotated_up, forward_axis)), 0.0F, 1.0E-5F));
+			CHECK(float(vector_dot3(rotated_up, up)) > 0.0F);
+			CHECK(vector_all_near_equal3(quat_mul_vector3(y_axis, rotation), vector_normalize3(vector_cross3(up, forward_axis)), 1.0E-5F));
+		}
+
+		// When up is parallel to forward, the roll is arbitrary
+		for (const vector4f& forward : directions)
+		{
+			const quatf rotation = quat_look_rotation(forward, vector_mul(forward, -2.0F));
+			CHECK(quat_is_normalized(rotation));
+			CHECK(vector_all_near_equal3(quat_mul_vector3(x_axis, rotation), vector_normalize3(forward), 1.0E-5F));
+		}
+	}
+
+	{
+		const quatf rotation = quat_from_euler(0.3F, -0.2F, 1.1F);
+		uint16_t rotation_half[4];
+		quat_store_half(rotation, &rotation_half[0]);
+		CHECK(rotation_half[0] == scalar_float_to_half(quat_get_x(rotation)));
+		CHECK(rotation_half[3] == scalar_float_to_half(quat_get_w(rotation)));
+		CHECK(quat_near_equal(quat_load_half(&rotation_half[0]), rotation, 1.0E-3F));
+	}
+
 	const quatf src = quat_set(0.39564531008956383F, 0.044254239301713752F, 0.22768840967675355F, 0.88863059760894492F);
 	const quatd dst = quat_cast(src);
 	CHECK(scalar_near_equal(double(quat_get_x(dst)), 0.39564531008956383, 1.0E-6));
@@ -0,0 +1,170 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/quatf.h>
+#include <rtm/quat8f.h>
+
+using namespace rtm;
+
+TEST_CASE("quat8f math", "[math][quat8]")
+{
+	const float threshold = 1.0E-5F;
+
+	float lhs_x[8];
+	float lhs_y[8];
+	float lhs_z[8];
+	float lhs_w[8];
+	float rhs_x[8];
+	float rhs_y[8];
+	float rhs_z[8];
+	float rhs_w[8];
+	float out_x[8];
+	float out_y[8];
+	float out_z[8];
+	float out_w[8];
+
+	quatf lhs[8];
+	quatf rhs[8];
+	vector4f points[8];
+	float points_x[8];
+	float points_y[8];
+	float points_z[8];
+
+	for (uint32_t i = 0; i < 8; ++i)
+	{
+		const float angle = float(i) * 0.43F;
+		lhs[i] = quat_from_euler(angle, 0.5F - angle, angle * 1.5F);
+
+		// Some of the rhs rotations are on the opposite side of the hypersphere to test the lerp bias
+		rhs[i] = quat_from_euler(angle + 0.1F, 0.45F - angle, angle * 1.5F - 0.2F);
+		if ((i % 3) == 0)
+			rhs[i] = quat_neg(rhs[i]);
+
+		points[i] = vector_set(float(i) - 4.0F, 2.0F * float(i), 1.5F);
+
+		lhs_x[i] = quat_get_x(lhs[i]);
+		lhs_y[i] = quat_get_y(lhs[i]);
+		lhs_z[i] = quat_get_z(lhs[i]);
+		lhs_w[i] = quat_get_w(lhs[i]);
+		rhs_x[i] = quat_get_x(rhs[i]);
+		rhs_y[i] = quat_get_y(rhs[i]);
+		rhs_z[i] = quat_get_z(rhs[i]);
+		rhs_w[i] = quat_get_w(rhs[i]);
+		points_x[i] = vector_get_x(points[i]);
+		points_y[i] = vector_get_y(points[i]);
+		points_z[i] = vector_get_z(points[i]);
+	}
+
+	const quat8f lhs8 = quat8_load(const_float4f_soa{ lhs_x, lhs_y, lhs_z, lhs_w }, 0);
+	const quat8f rhs8 = quat8_load(const_float4f_soa{ rhs_x, rhs_y, rhs_z, rhs_w }, 0);
+	const float4f_soa output = { out_x, out_y, out_z, out_w };
+
+	{
+		quat_store(quat8_identity(), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_identity(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), threshold));
+	}
+
+	{
+		quat_store(quat_mul(lhs8, rhs8), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), quat_mul(lhs[i], rhs[i]), threshold));
+
+		quat_store(quat_conjugate(lhs8), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), quat_conjugate(lhs[i]), 0.0F));
+
+		quat_store(quat_neg(lhs8), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), quat_neg(lhs[i]), 0.0F));
+
+		quat_store(quat_lerp(lhs8, rhs8, 0.33F), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), quat_lerp(lhs[i], rhs[i], 0.33F), threshold));
+
+		quat_store(quat_slerp_fast(lhs8, rhs8, 0.33F), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), quat_slerp_fast(lhs[i], rhs[i], 0.33F), threshold));
+
+		const quat8f scaled8 = { vector_mul(lhs8.x, 2.5F), vector_mul(lhs8.y, 2.5F), vector_mul(lhs8.z, 2.5F), vector_mul(lhs8.w, 2.5F) };
+		quat_store(quat_normalize(scaled8), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), lhs[i], threshold));
+
+		quat_store(quat_select(vector_less_than(lhs8.x, rhs8.x), lhs8, rhs8), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), lhs_x[i] < rhs_x[i] ? lhs[i] : rhs[i], 0.0F));
+	}
+
+	{
+		float lanes[8];
+		vector_store(quat_dot(lhs8, rhs8), &lanes[0]);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(scalar_near_equal(lanes[i], float(quat_dot(lhs[i], rhs[i])), threshold));
+
+		vector_store(quat_length_squared(lhs8), &lanes[0]);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(scalar_near_equal(lanes[i], float(quat_length_squared(lhs[i])), threshold));
+
+		vector_store(quat_length(lhs8), &lanes[0]);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(scalar_near_equal(lanes[i], float(quat_length(lhs[i])), threshold));
+	}
+
+	{
+		const vector3x8f points8 = vector3x8_load(const_float3f_soa{ points_x, points_y, points_z }, 0);
+		vector_store(quat_mul_vector3(points8, lhs8), float3f_soa{ out_x, out_y, out_z }, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(vector_all_near_equal3(vector_set(out_x[i], out_y[i], out_z[i]), quat_mul_vector3(points[i], lhs[i]), threshold));
+	}
+
+	{
+		// Every other 'to' direction is opposite to its 'from' direction
+		float to_x[8];
+		float to_y[8];
+		float to_z[8];
+		vector4f to[8];
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			to[i] = (i % 2) == 0 ? vector_neg(points[i]) : vector_set(1.0F, -2.0F, float(i));
+			to_x[i] = vector_get_x(to[i]);
+			to_y[i] = vector_get_y(to[i]);
+			to_z[i] = vector_get_z(to[i]);
+		}
+
+		const vector3x8f points8 = vector3x8_load(const_float3f_soa{ points_x, points_y, points_z }, 0);
+		const vector3x8f to8 = vector3x8_load(const_float3f_soa{ to_x, to_y, to_z }, 0);
+		quat_store(quat_from_to(points8, to8), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), quat_from_to(points[i], to[i]), threshold));
+
+		// The opposite 'to' directions are parallel up directions
+		quat_store(quat_look_rotation(points8, to8), output, 0);
+		for (uint32_t i = 0; i < 8; ++i)
+			CHECK(quat_near_equal(quat_set(out_x[i], out_y[i], out_z[i], out_w[i]), quat_look_rotation(points[i], to[i]), threshold));
+	}
+}
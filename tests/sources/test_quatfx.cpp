@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/quatf.h>
+#include <rtm/quatfx.h>
+#include <rtm/vector4f.h>
+#include <rtm/vector4fx.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static bool quat_all_equal(quatfx_arg0 lhs, quatfx_arg1 rhs)
+{
+	const vector4i lhs_raw = quat_fx_to_raw(lhs);
+	const vector4i rhs_raw = quat_fx_to_raw(rhs);
+	return vector_get_x(lhs_raw) == vector_get_x(rhs_raw) && vector_get_y(lhs_raw) == vector_get_y(rhs_raw) && vector_get_z(lhs_raw) == vector_get_z(rhs_raw) && vector_get_w(lhs_raw) == vector_get_w(rhs_raw);
+}
+
+TEST_CASE("quatfx math", "[math][quatfx]")
+{
+	const quatf rotation0 = quat_from_euler(0.3F, -1.2F, 2.1F);
+	const quatf rotation1 = quat_from_euler(-0.7F, 0.4F, -2.9F);
+	const quatfx rotation0_fx = quat_to_fx(rotation0);
+	const quatfx rotation1_fx = quat_to_fx(rotation1);
+
+	CHECK(quat_near_equal(quat_from_fx(rotation0_fx), rotation0, 1.0F / 65536.0F));
+	CHECK(quat_all_equal(quat_fx_identity(), quat_to_fx(quat_identity())));
+	CHECK(vector_get_w(quat_fx_to_raw(quat_fx_identity())) == 65536);
+	CHECK(vector_get_z(quat_fx_to_raw(quat_fx_from_raw(vector_set(1, 2, 3, 4)))) == 3);
+	CHECK(quat_near_equal(quat_from_fx(quat_conjugate(rotation0_fx)), quat_conjugate(quat_from_fx(rotation0_fx)), 0.0F));
+
+	const quatf product = quat_mul(quat_from_fx(rotation0_fx), quat_from_fx(rotation1_fx));
+	CHECK(quat_near_equal(quat_from_fx(quat_mul(rotation0_fx, rotation1_fx)), product, 4.0F / 65536.0F));
+	CHECK(quat_all_equal(quat_mul(quat_fx_identity(), rotation0_fx), rotation0_fx));
+	CHECK(quat_all_equal(quat_mul(rotation0_fx, quat_fx_identity()), rotation0_fx));
+
+	const vector4f point = vector_set(12.5F, -3.25F, 7.0F, 2.0F);
+	const vector4fx rotated = quat_mul_vector3(vector_to_fx(point), rotation0_fx);
+	CHECK(vector_all_near_equal(vector_from_fx(rotated), vector_set_w(quat_mul_vector3(point, quat_from_fx(rotation0_fx)), 2.0F), 32.0F / 65536.0F));
+
+	const quatf scaled = vector_to_quat(vector_mul(quat_to_vector(rotation1), 1.5F));
+	CHECK(quat_near_equal(quat_from_fx(quat_normalize(quat_to_fx(scaled))), rotation1, 3.0F / 65536.0F));
+
+	// Applying many rotations in a row and renormalizing keeps a unit quaternion
+	quatfx accumulated = quat_fx_identity();
+	quatf accumulated_reference = quat_identity();
+	for (uint32_t iteration = 0; iteration < 100; ++iteration)
+	{
+		accumulated = quat_normalize(quat_mul(accumulated, rotation1_fx));
+		accumulated_reference = quat_normalize(quat_mul(accumulated_reference, quat_from_fx(rotation1_fx)));
+	}
+	CHECK(quat_near_equal(quat_from_fx(accumulated), accumulated_reference, 1.0E-3F));
+
+	const vector4fx axis = vector_normalize3(vector_to_fx(vector_set(1.0F, 2.0F, -2.0F, 0.0F)));
+	const float angle = 1.3F;
+	const quatfx from_axis_angle = quat_from_axis_angle(axis, vector_get_x(vector_fx_to_raw(vector_to_fx(vector_set(angle)))));
+	CHECK(quat_near_equal(quat_from_fx(from_axis_angle), quat_from_axis_angle(vector_from_fx(axis), angle), 2.0F / 65536.0F));
+}
@@ -0,0 +1,147 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/qvsf.h>
+#include <rtm/qvsd.h>
+#include <rtm/qvvf.h>
+#include <rtm/qvvd.h>
+
+using namespace rtm;
+
+template<typename TransformType, typename FloatType>
+static void test_qvs_impl(const TransformType& identity, const FloatType threshold)
+{
+	using QuatType = decltype(TransformType::rotation);
+	using Vector4Type = decltype(TransformType::translation_scale);
+	using QVVType = decltype(qvv_from_qvs(identity));
+
+	{
+		const QuatType q_identity = quat_set(FloatType(0.0), FloatType(0.0), FloatType(0.0), FloatType(1.0));
+		const TransformType tmp = qvs_set(q_identity, vector_zero(), FloatType(1.0));
+		CHECK(quat_near_equal(identity.rotation, tmp.rotation, threshold));
+		CHECK(vector_all_near_equal(identity.translation_scale, tmp.translation_scale, threshold));
+		CHECK(vector_all_near_equal3(qvs_get_translation(tmp), vector_zero(), threshold));
+		CHECK(scalar_near_equal(qvs_get_scale(tmp), FloatType(1.0), threshold));
+		CHECK(vector_get_w(qvs_get_translation(qvs_set(q_identity, vector_set(FloatType(1.0)), FloatType(2.0)))) == FloatType(0.0));
+	}
+
+	const QuatType rotation_a = quat_from_euler(scalar_deg_to_rad(FloatType(12.0)), scalar_deg_to_rad(FloatType(90.0)), scalar_deg_to_rad(FloatType(-31.0)));
+	const QuatType rotation_b = quat_from_euler(scalar_deg_to_rad(FloatType(-45.0)), scalar_deg_to_rad(FloatType(8.0)), scalar_deg_to_rad(FloatType(60.0)));
+	const Vector4Type translation_a = vector_set(FloatType(1.0), FloatType(-2.5), FloatType(0.25), FloatType(0.0));
+	const Vector4Type translation_b = vector_set(FloatType(-3.0), FloatType(0.5), FloatType(7.0), FloatType(0.0));
+	const Vector4Type point = vector_set(FloatType(0.5), FloatType(1.5), FloatType(-2.0), FloatType(0.0));
+
+	// Positive scale matches the QVV results, negative scale matches the matrix results
+	const FloatType scales[] = { FloatType(1.0), FloatType(1.5), FloatType(0.25), FloatType(-2.0) };
+
+	for (FloatType scale_a : scales)
+	{
+		for (FloatType scale_b : scales)
+		{
+			INFO("scale_a: " << scale_a << " scale_b: " << scale_b);
+
+			const TransformType transform_a = qvs_set(rotation_a, translation_a, scale_a);
+			const TransformType transform_b = qvs_set(rotation_b, translation_b, scale_b);
+
+			const auto mtx_a = matrix_from_qvs(transform_a);
+			const auto mtx_b = matrix_from_qvs(transform_b);
+			const auto mtx_ab = matrix_mul(mtx_a, mtx_b);
+
+			{
+				const TransformType result = qvs_mul(transform_a, transform_b);
+				CHECK(scalar_near_equal(qvs_get_scale(result), scale_a * scale_b, threshold));
+				CHECK(vector_all_near_equal3(qvs_mul_point3(point, result), matrix_mul_point3(point, mtx_ab), threshold));
+				CHECK(vector_all_near_equal3(qvs_mul_point3(point, result), qvs_mul_point3(qvs_mul_point3(point, transform_a), transform_b), threshold));
+
+				if (scale_a > FloatType(0.0) && scale_b > FloatType(0.0))
+				{
+					const QVVType qvv_result = qvv_mul(qvv_from_qvs(transform_a), qvv_from_qvs(transform_b));
+					CHECK(quat_near_equal(result.rotation, qvv_result.rotation, threshold));
+					CHECK(vector_all_near_equal3(qvs_get_translation(result), qvv_result.translation, threshold));
+				}
+			}
+
+			{
+				const TransformType inv_a = qvs_inverse(transform_a);
+				CHECK(scalar_near_equal(qvs_get_scale(inv_a), FloatType(1.0) / scale_a, threshold));
+				CHECK(vector_all_near_equal3(qvs_mul_point3(qvs_mul_point3(point, transform_a), inv_a), point, threshold));
+
+				const TransformType identity_result = qvs_mul(transform_a, inv_a);
+				CHECK(scalar_near_equal(qvs_get_scale(identity_result), FloatType(1.0), threshold));
+				CHECK(vector_all_near_equal3(qvs_get_translation(identity_result), vector_zero(), threshold));
+			}
+
+			{
+				const TransformType result = qvs_from_matrix(mtx_a);
+				CHECK(scalar_near_equal(qvs_get_scale(result), scale_a, threshold));
+				CHECK(vector_all_near_equal3(qvs_get_translation(result), translation_a, threshold));
+				CHECK(vector_all_near_equal3(qvs_mul_point3(point, result), qvs_mul_point3(point, transform_a), threshold));
+			}
+		}
+	}
+
+	{
+		const TransformType transform = qvs_set(rotation_a, translation_a, FloatType(1.5));
+		const QVVType qvv = qvv_from_qvs(transform);
+		CHECK(vector_all_near_equal3(qvv.translation, translation_a, threshold));
+		CHECK(vector_all_near_equal3(qvv.scale, vector_set(FloatType(1.5)), threshold));
+		CHECK(vector_all_near_equal3(qvv_mul_point3(point, qvv), qvs_mul_point3(point, transform), threshold));
+
+		const TransformType result = qvs_from_qvv(qvv);
+		CHECK(quat_near_equal(result.rotation, transform.rotation, threshold));
+		CHECK(vector_all_near_equal(result.translation_scale, transform.translation_scale, threshold));
+
+		CHECK(vector_all_near_equal3(qvs_mul_point3_no_scale(point, transform), qvv_mul_point3_no_scale(point, qvv), threshold));
+	}
+
+	{
+		const QuatType unnormalized = quat_set(FloatType(0.0), FloatType(0.0), FloatType(0.0), FloatType(2.0));
+		const TransformType result = qvs_normalize(qvs_set(unnormalized, translation_a, FloatType(3.0)));
+		CHECK(quat_near_equal(result.rotation, quat_identity(), threshold));
+		CHECK(scalar_near_equal(qvs_get_scale(result), FloatType(3.0), threshold));
+	}
+}
+
+TEST_CASE("qvsf math", "[math][qvs]")
+{
+	test_qvs_impl<qvsf, float>(qvs_identity(), 1.0E-4F);
+
+	const qvsf src = qvs_set(quat_from_euler(0.1F, -0.4F, 1.2F), vector_set(-2.65F, 2.996113F, 0.68123521F), 1.25F);
+	const qvsd dst = qvs_cast(src);
+	CHECK(quat_near_equal(src.rotation, quat_cast(dst.rotation), 1.0E-6F));
+	CHECK(vector_all_near_equal(src.translation_scale, vector_cast(dst.translation_scale), 1.0E-6F));
+}
+
+TEST_CASE("qvsd math", "[math][qvs]")
+{
+	test_qvs_impl<qvsd, double>(qvs_identity(), 1.0E-6);
+
+	const qvsd src = qvs_set(quat_from_euler(0.1, -0.4, 1.2), vector_set(-2.65, 2.996113, 0.68123521), 1.25);
+	const qvsf dst = qvs_cast(src);
+	CHECK(quat_near_equal(src.rotation, quat_cast(dst.rotation), 1.0E-6));
+	CHECK(vector_all_near_equal(src.translation_scale, vector_cast(dst.translation_scale), 1.0E-6));
+}
@@ -162,6 +162,108 @@ static void test_qvv_impl(const TransformType& identity, const FloatType thresho
 		CHECK(!quat_is_normalized(transform_b.rotation, threshold));
 		CHECK(quat_is_normalized(qvv_normalize(transform_b).rotation, threshold));
 	}
+
+	{
+		QuatType rotation = quat_from_euler(FloatType(0.5), FloatType(-1.2), FloatType(2.0));
+		Vector4Type translation = vector_set(FloatType(-2.65), FloatType(2.996113), FloatType(0.68123521));
+
+		TransformType transform = qvv_set(rotation, translation, vector_set(FloatType(1.2), FloatType(0.8), FloatType(2.1)));
+		TransformType result = qvv_from_matrix(matrix_from_qvv(transform));
+		CHECK((quat_near_equal(result.rotation, rotation, threshold) || quat_near_equal(quat_neg(result.rotation), rotation, threshold)));
+		CHECK(vector_all_near_equal3(result.translation, translation, threshold));
+		CHECK(vector_all_near_equal3(result.scale, transform.scale, threshold));
+
+		// A reflection ends up in the X scale
+		transform = qvv_set(rotation, translation, vector_set(FloatType(-1.2), FloatType(0.8), FloatType(2.1)));
+		result = qvv_from_matrix(matrix_from_qvv(transform));
+		CHECK((quat_near_equal(result.rotation, rotation, threshold) || quat_near_equal(quat_neg(result.rotation), rotation, threshold)));
+		CHECK(vector_all_near_equal3(result.scale, transform.scale, threshold));
+
+		transform = qvv_set(rotation, translation, vector_set(FloatType(1.2), FloatType(0.8), FloatType(-2.1)));
+		result = qvv_from_matrix(matrix_from_qvv(transform));
+		CHECK(vector_all_near_equal3(result.scale, vector_set(FloatType(-1.2), FloatType(0.8), FloatType(2.1)), threshold));
+		Vector4Type point = vector_set(FloatType(1.0), FloatType(-2.0), FloatType(0.5));
+		CHECK(vector_all_near_equal3(qvv_mul_point3(point, result), qvv_mul_point3(point, transform), threshold));
+
+		// Zero scale has an identity rotation
+		transform = qvv_set(rotation, translation, vector_set(FloatType(1.2), FloatType(0.0), FloatType(2.1)));
+		result = qvv_from_matrix(matrix_from_qvv(transform));
+		CHECK(quat_near_equal(result.rotation, identity.rotation, threshold));
+		CHECK(vector_all_near_equal3(result.scale, transform.scale, threshold));
+	}
+
+	{
+		QuatType rotation_a = quat_from_euler(FloatType(0.5), FloatType(-1.2), FloatType(2.0));
+		QuatType rotation_b = quat_from_euler(FloatType(0.7), FloatType(-1.0), FloatType(1.6));
+		TransformType start = qvv_set(rotation_a, vector_set(FloatType(1.0), FloatType(2.0), FloatType(-3.0)), vector_set(FloatType(1.0), FloatType(2.0), FloatType(0.5)));
+		TransformType end = qvv_set(rotation_b, vector_set(FloatType(-1.0), FloatType(4.0), FloatType(1.0)), vector_set(FloatType(3.0), FloatType(1.0), FloatType(0.5)));
+
+		TransformType result = qvv_lerp(start, end, FloatType(0.0));
+		CHECK(quat_near_equal(result.rotation, start.rotation, threshold));
+		CHECK(vector_all_near_equal3(result.translation, start.translation, threshold));
+		CHECK(vector_all_near_equal3(result.scale, start.scale, threshold));
+
+		result = qvv_lerp(start, end, FloatType(0.25));
+		CHECK(quat_near_equal(result.rotation, quat_lerp(rotation_a, rotation_b, FloatType(0.25)), threshold));
+		CHECK(vector_all_near_equal3(result.translation, vector_set(FloatType(0.5), FloatType(2.5), FloatType(-2.0)), threshold));
+		CHECK(vector_all_near_equal3(result.scale, vector_set(FloatType(1.5), FloatType(1.75), FloatType(0.5)), threshold));
+
+		// The scalar overloads match the float ones
+		const TransformType result_s = qvv_lerp(start, end, scalar_set(FloatType(0.25)));
+		CHECK(quat_near_equal(result_s.rotation, result.rotation, threshold));
+		CHECK(vector_all_near_equal3(result_s.translation, result.translation, threshold));
+		CHECK(vector_all_near_equal3(result_s.scale, result.scale, threshold));
+
+		// The end rotation on the other side of the hypersphere takes the shortest path
+		const TransformType end_neg = qvv_set(quat_neg(rotation_b), end.translation, end.scale);
+		CHECK(quat_near_equal(qvv_lerp(start, end_neg, FloatType(0.25)).rotation, result.rotation, threshold));
+
+		// Additive transforms
+		const TransformType additive = qvv_set(quat_from_euler(FloatType(0.2), FloatType(0.0), FloatType(-0.4)), vector_set(FloatType(0.5), FloatType(0.0), FloatType(-1.0)), vector_set(FloatType(2.0), FloatType(1.0), FloatType(0.5)));
+
+		result = qvv_apply_additive(start, additive, FloatType(0.0));
+		CHECK(quat_near_equal(result.rotation, start.rotation, threshold));
+		CHECK(vector_all_near_equal3(result.translation, start.translation, threshold));
+		CHECK(vector_all_near_equal3(result.scale, start.scale, threshold));
+
+		result = qvv_apply_additive(start, additive, FloatType(1.0));
+		CHECK(quat_near_equal(result.rotation, quat_mul(additive.rotation, start.rotation), threshold));
+		CHECK(vector_all_near_equal3(result.translation, vector_set(FloatType(1.5), FloatType(2.0), FloatType(-4.0)), threshold));
+		CHECK(vector_all_near_equal3(result.scale, vector_set(FloatType(2.0), FloatType(2.0), FloatType(0.25)), threshold));
+
+		const TransformType additive_result_s = qvv_apply_additive(start, additive, scalar_set(FloatType(1.0)));
+		CHECK(quat_near_equal(additive_result_s.rotation, result.rotation, threshold));
+		CHECK(vector_all_near_equal3(additive_result_s.translation, result.translation, threshold));
+		CHECK(vector_all_near_equal3(additive_result_s.scale, result.scale, threshold));
+
+		result = qvv_apply_additive(start, qvv_set(quat_neg(additive.rotation), additive.translation, additive.scale), FloatType(0.5));
+		CHECK(quat_near_equal(result.rotation, quat_mul(quat_lerp(identity.rotation, additive.rotation, FloatType(0.5)), start.rotation), threshold));
+		CHECK(vector_all_near_equal3(result.translation, vector_set(FloatType(1.25), FloatType(2.0), FloatType(-3.5)), threshold));
+		CHECK(vector_all_near_equal3(result.scale, vector_set(FloatType(1.5), FloatType(2.0), FloatType(0.375)), threshold));
+
+		// Extracting the additive transform of a pose from its reference and applying it back
+		TransformType extracted = qvv_extract_additive(qvv_apply_additive(start, additive, FloatType(1.0)), start);
+		CHECK(quat_near_equal(extracted.rotation, additive.rotation, threshold));
+		CHECK(vector_all_near_equal3(extracted.translation, additive.translation, threshold));
+		CHECK(vector_all_near_equal3(extracted.scale, additive.scale, threshold));
+
+		extracted = qvv_extract_additive(end, start);
+		CHECK(quat_get_w(extracted.rotation) >= FloatType(0.0));
+		result = qvv_apply_additive(start, extracted, FloatType(1.0));
+		CHECK(quat_near_equal(result.rotation, end.rotation, threshold));
+		CHECK(vector_all_near_equal3(result.translation, end.translation, threshold));
+		CHECK(vector_all_near_equal3(result.scale, end.scale, threshold));
+
+		// The rotation is flipped to have a positive W
+		extracted = qvv_extract_additive(qvv_set(quat_neg(rotation_b), end.translation, end.scale), start);
+		CHECK(quat_get_w(extracted.rotation) >= FloatType(0.0));
+		CHECK(quat_near_equal(extracted.rotation, qvv_extract_additive(end, start).rotation, threshold));
+
+		extracted = qvv_extract_additive(start, start);
+		CHECK(quat_near_equal(extracted.rotation, identity.rotation, threshold));
+		CHECK(vector_all_near_equal3(extracted.translation, vector_zero(), threshold));
+		CHECK(vector_all_near_equal3(extracted.scale, vector_set(FloatType(1.0)), threshold));
+	}
 }
 
 TEST_CASE("qvvf math", "[math][qvv]")
@@ -178,6 +280,48 @@ TEST_CASE("qvvf math", "[math][qvv]")
 	CHECK(vector_all_near_equal3(src.scale, vector_cast(dst.scale), 1.0E-6F));
 }
 
+TEST_CASE("qvvf packed storage", "[math][qvv]")
+{
+	CHECK(sizeof(qvvf_packed) == 40);
+	CHECK(sizeof(qvvf_packed_uniform_scale) == 32);
+
+	const quatf rotation = quat_set(0.39564531008956383F, 0.044254239301713752F, 0.22768840967675355F, 0.88863059760894492F);
+	const vector4f translation = vector_set(-2.65F, 2.996113F, 0.68123521F, 0.0F);
+	const vector4f scale = vector_set(1.2F, 0.8F, 2.1F, 0.0F);
+	const qvvf src = qvv_set(rotation, translation, scale);
+
+	{
+		// One extra entry to catch out of bounds writes
+		qvvf_packed packed[2];
+		packed[1].rotation = float4f{ -1.0F, -1.0F, -1.0F, -1.0F };
+		qvv_store_packed(src, &packed[0]);
+		CHECK(packed[0].translation.z == vector_get_z(translation));
+		CHECK(packed[0].scale.x == vector_get_x(scale));
+		CHECK(packed[0].scale.z == vector_get_z(scale));
+		CHECK(packed[1].rotation.x == -1.0F);
+
+		const qvvf dst = qvv_load_packed(&packed[0]);
+		CHECK(quat_near_equal(dst.rotation, rotation, 0.0F));
+		CHECK(vector_all_near_equal(dst.translation, translation, 0.0F));
+		CHECK(vector_all_near_equal(dst.scale, scale, 0.0F));
+	}
+
+	{
+		const qvvf uniform = qvv_set(rotation, translation, vector_set(1.5F, 1.5F, 1.5F, 0.0F));
+
+		qvvf_packed_uniform_scale packed[2];
+		packed[1].rotation = float4f{ -1.0F, -1.0F, -1.0F, -1.0F };
+		qvv_store_packed(uniform, &packed[0]);
+		CHECK(packed[0].scale == 1.5F);
+		CHECK(packed[1].rotation.x == -1.0F);
+
+		const qvvf dst = qvv_load_packed(&packed[0]);
+		CHECK(quat_near_equal(dst.rotation, rotation, 0.0F));
+		CHECK(vector_all_near_equal(dst.translation, translation, 0.0F));
+		CHECK(vector_all_near_equal(dst.scale, uniform.scale, 0.0F));
+	}
+}
+
 TEST_CASE("qvvd math", "[math][qvv]")
 {
 	test_qvv_impl<qvvd, double>(qvv_identity(), 1.0E-6);
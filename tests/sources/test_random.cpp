@@ -0,0 +1,239 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/random.h>
+#include <rtm/batch/random.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_samples = 4099;
+
+// Reference scalar xoshiro128+
+static uint32_t xoshiro128plus_next(uint32_t state[4])
+{
+	const uint32_t result = state[0] + state[3];
+	const uint32_t t = state[1] << 9;
+
+	state[2] ^= state[0];
+	state[3] ^= state[1];
+	state[1] ^= state[2];
+	state[0] ^= state[3];
+	state[2] ^= t;
+	state[3] = (state[3] << 11) | (state[3] >> 21);
+	return result;
+}
+
+TEST_CASE("random generator bits", "[math][random]")
+{
+	random_generator generator = random_init(1234);
+
+	uint32_t lane_states[4][4];
+	for (uint32_t word_index = 0; word_index < 4; ++word_index)
+	{
+		int32_t words[4];
+		vector_store(generator.state[word_index], &words[0]);
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			lane_states[lane_index][word_index] = uint32_t(words[lane_index]);
+	}
+
+	// Every lane is an independent xoshiro128+ stream
+	CHECK(lane_states[0][0] != lane_states[1][0]);
+	CHECK(lane_states[0][0] != lane_states[2][0]);
+	CHECK(lane_states[0][0] != lane_states[3][0]);
+
+	for (uint32_t iteration = 0; iteration < 100; ++iteration)
+	{
+		int32_t bits[4];
+		vector_store(random_next_bits(generator), &bits[0]);
+
+		for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+			CHECK(uint32_t(bits[lane_index]) == xoshiro128plus_next(lane_states[lane_index]));
+	}
+
+	// The same seed generates the same values, another seed does not
+	random_generator generator0 = random_init(42);
+	random_generator generator1 = random_init(42);
+	random_generator generator2 = random_init(43);
+	const vector4i bits0 = random_next_bits(generator0);
+	CHECK(mask_all_true(vector_equal(bits0, random_next_bits(generator1))));
+	CHECK(!mask_any_true(vector_equal(bits0, random_next_bits(generator2))));
+}
+
+TEST_CASE("random uniform values", "[math][random]")
+{
+	random_generator generator = random_init(0);
+
+	vector4f sum = vector_zero();
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const vector4f value = random_next_uniform(generator);
+		CHECK(vector_all_greater_equal(value, vector_zero()));
+		CHECK(vector_all_less_than(value, vector_set(1.0F)));
+		sum = vector_add(sum, value);
+	}
+
+	CHECK(vector_all_near_equal(vector_div(sum, vector_set(float(k_num_samples))), vector_set(0.5F), 0.02F));
+
+	const vector4f min_value = vector_set(-2.0F, 0.0F, 10.0F, -1.0F);
+	const vector4f max_value = vector_set(2.0F, 0.5F, 20.0F, -0.5F);
+	for (uint32_t sample_index = 0; sample_index < 37; ++sample_index)
+	{
+		const vector4f value = random_next_uniform(generator, min_value, max_value);
+		CHECK(vector_all_greater_equal(value, min_value));
+		CHECK(vector_all_less_equal(value, max_value));
+	}
+
+	// The batch output matches the values generated 4 at a time, including the last partial group
+	random_generator batch_generator = random_init(7);
+	random_generator reference_generator = random_init(7);
+
+	float values[37];
+	random_uniform_soa(batch_generator, values, 37);
+	for (uint32_t index = 0; index < 37; index += 4)
+	{
+		float reference[4];
+		vector_store(random_next_uniform(reference_generator), &reference[0]);
+		for (uint32_t lane_index = 0; lane_index < 4 && index + lane_index < 37; ++lane_index)
+			CHECK(values[index + lane_index] == reference[lane_index]);
+	}
+}
+
+TEST_CASE("random unit sphere", "[math][random]")
+{
+	random_generator generator = random_init(1);
+
+	vector4f sum = vector_zero();
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const vector4f direction = random_next_unit_sphere(generator);
+		CHECK(scalar_near_equal(float(vector_length3(direction)), 1.0F, 1.0E-5F));
+		CHECK(float(vector_get_w(direction)) == 0.0F);
+		sum = vector_add(sum, direction);
+	}
+
+	CHECK(vector_all_near_equal3(vector_div(sum, vector_set(float(k_num_samples))), vector_zero(), 0.05F));
+
+	float x[k_num_samples];
+	float y[k_num_samples];
+	float z[k_num_samples];
+	random_unit_sphere_soa(generator, float3f_soa{ x, y, z }, k_num_samples);
+
+	float sum_z = 0.0F;
+	uint32_t num_upper_cap = 0;
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const float length = scalar_sqrt(x[sample_index] * x[sample_index] + y[sample_index] * y[sample_index] + z[sample_index] * z[sample_index]);
+		CHECK(scalar_near_equal(length, 1.0F, 1.0E-5F));
+		sum_z += z[sample_index];
+
+		// The cap above z = 0.5 covers a quarter of the sphere's area
+		if (z[sample_index] > 0.5F)
+			num_upper_cap++;
+	}
+
+	CHECK(scalar_near_equal(sum_z / float(k_num_samples), 0.0F, 0.05F));
+	CHECK(scalar_near_equal(float(num_upper_cap) / float(k_num_samples), 0.25F, 0.03F));
+}
+
+TEST_CASE("random unit disk", "[math][random]")
+{
+	random_generator generator = random_init(2);
+
+	uint32_t num_inner = 0;
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const vector4f point = random_next_unit_disk(generator);
+		const float length = vector_length(point);
+		CHECK(length <= 1.0F);
+		CHECK(float(vector_get_z(point)) == 0.0F);
+		CHECK(float(vector_get_w(point)) == 0.0F);
+
+		// The inner disk of radius 0.5 covers a quarter of the area
+		if (length < 0.5F)
+			num_inner++;
+	}
+
+	CHECK(scalar_near_equal(float(num_inner) / float(k_num_samples), 0.25F, 0.03F));
+
+	float x[k_num_samples];
+	float y[k_num_samples];
+	random_unit_disk_soa(generator, x, y, k_num_samples);
+
+	num_inner = 0;
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const float length_squared = x[sample_index] * x[sample_index] + y[sample_index] * y[sample_index];
+		CHECK(length_squared <= 1.0F + 1.0E-6F);
+
+		if (length_squared < 0.25F)
+			num_inner++;
+	}
+
+	CHECK(scalar_near_equal(float(num_inner) / float(k_num_samples), 0.25F, 0.03F));
+}
+
+TEST_CASE("random quaternions", "[math][quat][random]")
+{
+	random_generator generator = random_init(3);
+
+	// For uniform rotations, every component squared averages to 0.25
+	vector4f sum_squared = vector_zero();
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const quatf rotation = random_next_quat(generator);
+		CHECK(quat_is_normalized(rotation));
+
+		const vector4f components = quat_to_vector(rotation);
+		sum_squared = vector_mul_add(components, components, sum_squared);
+	}
+
+	CHECK(vector_all_near_equal(vector_div(sum_squared, vector_set(float(k_num_samples))), vector_set(0.25F), 0.02F));
+
+	float x[k_num_samples];
+	float y[k_num_samples];
+	float z[k_num_samples];
+	float w[k_num_samples];
+	random_quat_soa(generator, float4f_soa{ x, y, z, w }, k_num_samples);
+
+	// The rotated X axis is uniformly distributed on the sphere
+	sum_squared = vector_zero();
+	float sum_rotated_x = 0.0F;
+	for (uint32_t sample_index = 0; sample_index < k_num_samples; ++sample_index)
+	{
+		const quatf rotation = quat_set(x[sample_index], y[sample_index], z[sample_index], w[sample_index]);
+		CHECK(quat_is_normalized(rotation));
+
+		const vector4f components = quat_to_vector(rotation);
+		sum_squared = vector_mul_add(components, components, sum_squared);
+		sum_rotated_x += float(vector_get_x(quat_mul_vector3(vector_set(1.0F, 0.0F, 0.0F), rotation)));
+	}
+
+	CHECK(vector_all_near_equal(vector_div(sum_squared, vector_set(float(k_num_samples))), vector_set(0.25F), 0.02F));
+	CHECK(scalar_near_equal(sum_rotated_x / float(k_num_samples), 0.0F, 0.05F));
+}
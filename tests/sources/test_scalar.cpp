@@ -31,6 +31,9 @@
 #include <rtm/vector4f.h>
 #include <rtm/vector4d.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <limits>
 
 using namespace rtm;
@@ -476,6 +479,134 @@ TEST_CASE("scalarf math", "[math][scalar]")
 	CHECK(scalar_cast(scalar_round_bankers(scalar_set(-1073741824.5F))) == -1073741824.0F);
 }
 
+TEST_CASE("scalarf math fast trigonometry", "[math][scalar]")
+{
+	const float sin_threshold = 2.0E-6F;
+	const float cos_threshold = 1.0E-5F;
+	const float tan_threshold = 1.0E-4F;
+	const float asin_threshold = 5.0E-5F;
+	const float atan_threshold = 2.0E-5F;
+
+	const float half_pi = rtm::constants::half_pi();
+	const float pi = rtm::constants::pi();
+
+	const float angles[] = { 0.0F, pi, -pi, half_pi, -half_pi, 0.5F, 32.5F, -0.5F, -32.5F, 2.1F, -2.1F };
+	for (const float angle : angles)
+	{
+		INFO("angle: " << angle);
+
+		CHECK(scalar_near_equal(scalar_sin_fast(angle), std::sin(angle), sin_threshold));
+		CHECK(scalar_near_equal(scalar_cast(scalar_sin_fast(scalar_set(angle))), std::sin(angle), sin_threshold));
+		CHECK(scalar_near_equal(scalar_cos_fast(angle), std::cos(angle), cos_threshold));
+		CHECK(scalar_near_equal(scalar_cast(scalar_cos_fast(scalar_set(angle))), std::cos(angle), cos_threshold));
+
+		// For +-PI/2, we only test that the value is really large or really small
+		if (scalar_abs(angle) == half_pi)
+		{
+			CHECK(scalar_abs(scalar_tan_fast(angle)) >= 1.0E4F);
+		}
+		else
+		{
+			CHECK(scalar_near_equal(scalar_tan_fast(angle), std::tan(angle), tan_threshold));
+			CHECK(scalar_near_equal(scalar_cast(scalar_tan_fast(scalar_set(angle))), std::tan(angle), tan_threshold));
+		}
+	}
+
+	{
+		// The documented error bounds hold when abs(angle) <= 100.0
+		double max_sin_error = 0.0;
+		double max_cos_error = 0.0;
+		for (int32_t i = -100000; i <= 100000; ++i)
+		{
+			const float angle = float(i) * 0.001F;
+			max_sin_error = std::max(max_sin_error, std::fabs(double(scalar_sin_fast(angle)) - std::sin(double(angle))));
+			max_cos_error = std::max(max_cos_error, std::fabs(double(scalar_cos_fast(angle)) - std::cos(double(angle))));
+		}
+
+		CHECK(max_sin_error <= 5.5E-6);
+		CHECK(max_cos_error <= 1.4E-5);
+	}
+
+	const float values_asin[] = { -1.0F, -0.75F, -0.5F, -0.25F, 0.0F, 0.25F, 0.5F, 0.75F, 1.0F };
+	for (const float value : values_asin)
+	{
+		CHECK(scalar_near_equal(scalar_asin_fast(value), std::asin(value), asin_threshold));
+		CHECK(scalar_near_equal(scalar_cast(scalar_asin_fast(scalar_set(value))), std::asin(value), asin_threshold));
+		CHECK(scalar_near_equal(scalar_acos_fast(value), std::acos(value), asin_threshold));
+		CHECK(scalar_near_equal(scalar_cast(scalar_acos_fast(scalar_set(value))), std::acos(value), asin_threshold));
+	}
+
+	const float values_atan[] = { -10.0F, -5.0F, -1.0F, -0.5F, -0.25F, 0.0F, 0.25F, 0.5F, 0.75F, 1.0F, 81.0F };
+	for (const float value : values_atan)
+	{
+		CHECK(scalar_near_equal(scalar_atan_fast(value), std::atan(value), atan_threshold));
+		CHECK(scalar_near_equal(scalar_cast(scalar_atan_fast(scalar_set(value))), std::atan(value), atan_threshold));
+	}
+
+	CHECK(scalar_near_equal(scalar_atan2_fast(-2.0F, -2.0F), std::atan2(-2.0F, -2.0F), atan_threshold));
+	CHECK(scalar_near_equal(scalar_atan2_fast(-1.0F, -2.0F), std::atan2(-1.0F, -2.0F), atan_threshold));
+	CHECK(scalar_near_equal(scalar_atan2_fast(2.0F, 1.0F), std::atan2(2.0F, 1.0F), atan_threshold));
+	CHECK(scalar_near_equal(scalar_atan2_fast(2.0F, 0.0F), std::atan2(2.0F, 0.0F), atan_threshold));
+	CHECK(scalar_near_equal(scalar_atan2_fast(-2.0F, 0.0F), std::atan2(-2.0F, 0.0F), atan_threshold));
+	CHECK(scalar_near_equal(scalar_atan2_fast(0.0F, -2.0F), std::atan2(0.0F, -2.0F), atan_threshold));
+	CHECK(scalar_near_equal(scalar_atan2_fast(-0.0F, -2.0F), std::atan2(-0.0F, -2.0F), atan_threshold));
+	CHECK(scalar_near_equal(scalar_cast(scalar_atan2_fast(scalar_set(2.0F), scalar_set(-1.0F))), std::atan2(2.0F, -1.0F), atan_threshold));
+	CHECK(scalar_atan2_fast(0.0F, 0.0F) == 0.0F);
+}
+
+TEST_CASE("scalarf polynomial", "[math][scalar]")
+{
+	const float threshold = 1.0E-5F;
+
+	for (float x = -1.0F; x <= 1.0F; x += 0.125F)
+	{
+		INFO("x: " << x);
+		CHECK(scalar_near_equal(scalar_polynomial(x, 1.0F, 2.0F, 3.0F, 4.0F), 1.0F + x * (2.0F + x * (3.0F + x * 4.0F)), threshold));
+		CHECK(scalar_near_equal(scalar_polynomial(x, 1.0F, -1.0F, 0.5F, 0.25F, -0.125F), 1.0F + x * (-1.0F + x * (0.5F + x * (0.25F + x * -0.125F))), threshold));
+		CHECK(scalar_near_equal(scalar_polynomial(x, 0.5F, 1.0F, -0.5F, 0.25F, 0.125F, -0.25F), 0.5F + x * (1.0F + x * (-0.5F + x * (0.25F + x * (0.125F + x * -0.25F)))), threshold));
+		CHECK(scalar_near_equal(scalar_polynomial(x, 0.0F, 1.0F, 0.0F, -0.5F, 0.0F, 0.25F, 0.125F), x * (1.0F + x * (0.0F + x * (-0.5F + x * (0.0F + x * (0.25F + x * 0.125F))))), threshold));
+		CHECK(scalar_near_equal(scalar_polynomial(x, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F), 1.0F + x * (1.0F + x * (1.0F + x * (1.0F + x * (1.0F + x * (1.0F + x * (1.0F + x)))))), threshold));
+	}
+}
+
+TEST_CASE("scalarf half precision", "[math][scalar]")
+{
+	CHECK(scalar_half_to_float(0x0000) == 0.0F);
+	CHECK(scalar_half_to_float(0x3C00) == 1.0F);
+	CHECK(scalar_half_to_float(0xC000) == -2.0F);
+	CHECK(scalar_half_to_float(0x7BFF) == 65504.0F);
+	CHECK(scalar_half_to_float(0x0001) == std::ldexp(1.0F, -24));
+	CHECK(scalar_half_to_float(0x83FF) == -std::ldexp(1023.0F, -24));
+	CHECK(scalar_half_to_float(0x7C00) == std::numeric_limits<float>::infinity());
+	CHECK(scalar_half_to_float(0xFC00) == -std::numeric_limits<float>::infinity());
+	CHECK(std::isnan(scalar_half_to_float(0x7E00)));
+
+	CHECK(scalar_float_to_half(1.0F) == 0x3C00);
+	CHECK(scalar_float_to_half(-0.0F) == 0x8000);
+	CHECK(scalar_float_to_half(65504.0F) == 0x7BFF);
+	CHECK(scalar_float_to_half(65520.0F) == 0x7C00);
+	CHECK(scalar_float_to_half(-1.0E10F) == 0xFC00);
+	CHECK(scalar_float_to_half(std::ldexp(1.0F, -26)) == 0x0000);
+	CHECK(scalar_float_to_half(std::ldexp(3.0F, -26)) == 0x0001);
+	CHECK(scalar_float_to_half(std::numeric_limits<float>::infinity()) == 0x7C00);
+	CHECK((scalar_float_to_half(std::numeric_limits<float>::quiet_NaN()) & 0x7FFF) > 0x7C00);
+
+	// Ties round to the nearest even mantissa
+	CHECK(scalar_float_to_half(1.0F + std::ldexp(1.0F, -11)) == 0x3C00);
+	CHECK(scalar_float_to_half(1.0F + std::ldexp(3.0F, -11)) == 0x3C02);
+	CHECK(scalar_float_to_half(1.0F + std::ldexp(1.0F, -11) + std::ldexp(1.0F, -20)) == 0x3C01);
+
+	// Every half value that isn't NaN round trips exactly
+	for (uint32_t value = 0; value < 65536; ++value)
+	{
+		if ((value & 0x7FFF) > 0x7C00)
+			continue;
+
+		INFO("value: " << value);
+		CHECK(scalar_float_to_half(scalar_half_to_float(uint16_t(value))) == value);
+	}
+}
+
 TEST_CASE("scalard math", "[math][scalar]")
 {
 	test_scalar_impl<double>(1.0E-9, 1.0E-9);
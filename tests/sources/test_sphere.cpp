@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/aabbf.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvsf.h>
+#include <rtm/qvvf.h>
+#include <rtm/scalarf.h>
+#include <rtm/spheref.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+TEST_CASE("spheref math", "[math][sphere]")
+{
+	const float threshold = 1.0E-5F;
+
+	{
+		const spheref sphere = sphere_set(vector_set(1.0F, 2.0F, 3.0F), 2.0F);
+		CHECK(vector_all_near_equal(sphere_get_center(sphere), vector_set(1.0F, 2.0F, 3.0F, 0.0F), threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(sphere), 2.0F, threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(sphere_expand(sphere, 0.5F)), 2.5F, threshold));
+
+		CHECK(sphere_contains_point(sphere, vector_set(1.0F, 2.0F, 5.0F)));
+		CHECK_FALSE(sphere_contains_point(sphere, vector_set(2.5F, 3.5F, 3.0F)));
+
+		CHECK(sphere_intersects(sphere, sphere_set(vector_set(4.0F, 2.0F, 3.0F), 1.0F)));
+		CHECK_FALSE(sphere_intersects(sphere, sphere_set(vector_set(4.5F, 2.0F, 3.0F), 1.0F)));
+	}
+
+	{
+		const spheref sphere0 = sphere_set(vector_set(0.0F, 0.0F, 0.0F), 1.0F);
+		const spheref sphere1 = sphere_set(vector_set(4.0F, 0.0F, 0.0F), 2.0F);
+		const spheref merged = sphere_merge(sphere0, sphere1);
+		CHECK(vector_all_near_equal3(merged.center_radius, vector_set(2.5F, 0.0F, 0.0F), threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(merged), 3.5F, threshold));
+
+		// Containment returns the larger sphere unchanged
+		const spheref inner = sphere_set(vector_set(3.5F, 0.5F, 0.0F), 0.5F);
+		CHECK(vector_all_near_equal(sphere_merge(sphere1, inner).center_radius, sphere1.center_radius, 0.0F));
+		CHECK(vector_all_near_equal(sphere_merge(inner, sphere1).center_radius, sphere1.center_radius, 0.0F));
+
+		const spheref merged_point = sphere_merge_point(sphere0, vector_set(0.0F, 3.0F, 0.0F));
+		CHECK(vector_all_near_equal3(merged_point.center_radius, vector_set(0.0F, 1.0F, 0.0F), threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(merged_point), 2.0F, threshold));
+	}
+
+	{
+		const spheref sphere = sphere_set(vector_set(1.0F, 2.0F, 3.0F), 2.0F);
+		const quatf rotation = quat_from_euler(scalar_deg_to_rad(20.0F), scalar_deg_to_rad(-35.0F), scalar_deg_to_rad(70.0F));
+		const vector4f translation = vector_set(-2.0F, 5.0F, 1.0F);
+		const qvvf transform = qvv_set(rotation, translation, vector_set(1.5F, -3.0F, 0.5F));
+		const vector4f expected_center = qvv_mul_point3(vector_set(1.0F, 2.0F, 3.0F), transform);
+
+		const spheref result_qvv = sphere_mul(sphere, transform);
+		CHECK(vector_all_near_equal3(result_qvv.center_radius, expected_center, threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(result_qvv), 6.0F, threshold));
+
+		const spheref result_mtx = sphere_mul(sphere, matrix_from_qvv(transform));
+		CHECK(vector_all_near_equal3(result_mtx.center_radius, expected_center, threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(result_mtx), 6.0F, threshold));
+
+		const qvsf transform_qvs = qvs_set(rotation, translation, -2.0F);
+		const spheref result_qvs = sphere_mul(sphere, transform_qvs);
+		CHECK(vector_all_near_equal3(result_qvs.center_radius, qvs_mul_point3(vector_set(1.0F, 2.0F, 3.0F), transform_qvs), threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(result_qvs), 4.0F, threshold));
+	}
+
+	{
+		const aabbf box = aabb_set(vector_set(1.0F, 2.0F, 3.0F), vector_set(1.0F, 2.0F, 2.0F));
+		const spheref sphere = sphere_from_aabb(box);
+		CHECK(vector_all_near_equal3(sphere.center_radius, box.center, threshold));
+		CHECK(scalar_near_equal(sphere_get_radius(sphere), 3.0F, threshold));
+
+		const aabbf sphere_box = aabb_from_sphere(sphere);
+		CHECK(vector_all_near_equal3(sphere_box.center, box.center, threshold));
+		CHECK(vector_all_near_equal3(sphere_box.extent, vector_set(3.0F), threshold));
+	}
+}
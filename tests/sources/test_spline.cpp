@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/quatf.h>
+#include <rtm/splinef.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+TEST_CASE("vector4f spline math", "[math][vector4][spline]")
+{
+	const float threshold = 1.0E-5F;
+
+	const vector4f p0 = vector_set(-1.0F, 2.0F, 0.5F, 3.0F);
+	const vector4f p1 = vector_set(0.0F, 1.0F, 1.5F, -2.0F);
+	const vector4f p2 = vector_set(2.0F, -1.0F, 0.25F, 1.0F);
+	const vector4f p3 = vector_set(3.5F, 0.5F, -1.0F, 4.0F);
+
+	{
+		// Bezier curves go through their end points
+		CHECK(vector_all_near_equal(vector_bezier(p0, p1, p2, p3, 0.0F), p0, threshold));
+		CHECK(vector_all_near_equal(vector_bezier(p0, p1, p2, p3, 1.0F), p3, threshold));
+
+		// De Casteljau construction
+		const float t = 0.3F;
+		const vector4f p01 = vector_lerp(p0, p1, t);
+		const vector4f p12 = vector_lerp(p1, p2, t);
+		const vector4f p23 = vector_lerp(p2, p3, t);
+		const vector4f expected = vector_lerp(vector_lerp(p01, p12, t), vector_lerp(p12, p23, t), t);
+		CHECK(vector_all_near_equal(vector_bezier(p0, p1, p2, p3, t), expected, threshold));
+	}
+
+	{
+		CHECK(vector_all_near_equal(vector_hermite(p0, p1, p2, p3, 0.0F), p0, threshold));
+		CHECK(vector_all_near_equal(vector_hermite(p0, p1, p2, p3, 1.0F), p2, threshold));
+
+		// A Hermite curve is a Bezier curve with its inner control points a third of the tangents away
+		const float t = 0.65F;
+		const vector4f expected = vector_bezier(p0, vector_add(p0, vector_mul(p1, 1.0F / 3.0F)), vector_sub(p2, vector_mul(p3, 1.0F / 3.0F)), p2, t);
+		CHECK(vector_all_near_equal(vector_hermite(p0, p1, p2, p3, t), expected, threshold));
+	}
+
+	{
+		// Catmull-Rom curves go through the inner control points
+		CHECK(vector_all_near_equal(vector_catmull_rom(p0, p1, p2, p3, 0.0F), p1, threshold));
+		CHECK(vector_all_near_equal(vector_catmull_rom(p0, p1, p2, p3, 1.0F), p2, threshold));
+
+		// A Catmull-Rom curve is a Hermite curve with tangents (p2 - p0) / 2 and (p3 - p1) / 2
+		const float t = 0.4F;
+		const vector4f start_tangent = vector_mul(vector_sub(p2, p0), 0.5F);
+		const vector4f end_tangent = vector_mul(vector_sub(p3, p1), 0.5F);
+		CHECK(vector_all_near_equal(vector_catmull_rom(p0, p1, p2, p3, t), vector_hermite(p1, start_tangent, p2, end_tangent, t), threshold));
+
+		// Evenly spaced points on a line are interpolated linearly
+		const vector4f step = vector_set(1.0F, -2.0F, 0.5F, 0.0F);
+		const vector4f line1 = vector_add(p0, step);
+		const vector4f line2 = vector_add(line1, step);
+		const vector4f line3 = vector_add(line2, step);
+		CHECK(vector_all_near_equal(vector_catmull_rom(p0, line1, line2, line3, t), vector_lerp(line1, line2, t), threshold));
+	}
+}
+
+TEST_CASE("quatf squad math", "[math][quat][spline]")
+{
+	const float threshold = 1.0E-4F;
+
+	const quatf q0 = quat_from_euler(0.1F, -0.4F, 0.3F);
+	const quatf q1 = quat_from_euler(0.8F, 0.2F, -0.5F);
+	const quatf q2 = quat_from_euler(1.3F, 0.9F, 0.1F);
+	const quatf q3 = quat_from_euler(1.1F, 1.7F, 0.6F);
+
+	const quatf control1 = quat_squad_control(q0, q1, q2);
+	const quatf control2 = quat_squad_control(q1, q2, q3);
+	CHECK(quat_is_normalized(control1));
+	CHECK(quat_is_normalized(control2));
+
+	{
+		// Squad goes through its end points
+		CHECK(quat_near_equal(quat_squad(q1, control1, control2, q2, 0.0F), q1, threshold));
+		CHECK(quat_near_equal(quat_squad(q1, control1, control2, q2, 1.0F), q2, threshold));
+		CHECK(quat_is_normalized(quat_squad(q1, control1, control2, q2, 0.35F), threshold));
+	}
+
+	{
+		// With the end points as control points, squad is a slerp
+		const float t = 0.7F;
+		CHECK(quat_near_equal(quat_squad(q1, q1, q2, q2, t), quat_slerp(q1, q2, t), threshold));
+
+		// Constant curves are well defined
+		CHECK(quat_near_equal(quat_squad(q1, q1, q1, q1, t), q1, threshold));
+		CHECK(quat_near_equal(quat_squad_control(q1, q1, q1), q1, threshold));
+	}
+
+	{
+		// Rotations evenly spaced around an axis are their own control points
+		const vector4f axis = vector_normalize3(vector_set(1.0F, 2.0F, -0.5F));
+		const quatf r0 = quat_from_axis_angle(axis, 0.2F);
+		const quatf r1 = quat_from_axis_angle(axis, 0.7F);
+		const quatf r2 = quat_from_axis_angle(axis, 1.2F);
+		CHECK(quat_near_equal(quat_squad_control(r0, r1, r2), r1, threshold));
+
+		// Neighbors on the opposite hemisphere are flipped
+		CHECK(quat_near_equal(quat_squad_control(quat_neg(r0), r1, quat_neg(r2)), r1, threshold));
+	}
+}
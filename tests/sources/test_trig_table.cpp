@@ -0,0 +1,98 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/scalarf.h>
+#include <rtm/trig_table.h>
+#include <rtm/vector4f.h>
+
+#include <cmath>
+
+using namespace rtm;
+
+TEST_CASE("trig table sin/cos", "[math][trig_table]")
+{
+	const float threshold = 1.0E-4F;
+
+	for (float angle = -100.0F; angle <= 100.0F; angle += 0.0173F)
+	{
+		CHECK(scalar_near_equal(scalar_sin_table(angle), float(std::sin(double(angle))), threshold));
+		CHECK(scalar_near_equal(scalar_cos_table(angle), float(std::cos(double(angle))), threshold));
+	}
+
+	for (float angle = -20.0F; angle <= 20.0F; angle += 0.11F)
+	{
+		const vector4f angles = vector_set(angle, angle * 0.5F, -angle, angle + 0.05F);
+		const vector4f reference_sin = vector_set(float(std::sin(double(angle))), float(std::sin(double(angle * 0.5F))), float(std::sin(double(-angle))), float(std::sin(double(angle + 0.05F))));
+		const vector4f reference_cos = vector_set(float(std::cos(double(angle))), float(std::cos(double(angle * 0.5F))), float(std::cos(double(-angle))), float(std::cos(double(angle + 0.05F))));
+
+		CHECK(vector_all_near_equal(vector_sin_table(angles), reference_sin, threshold));
+		CHECK(vector_all_near_equal(vector_cos_table(angles), reference_cos, threshold));
+
+		vector4f sin_;
+		vector4f cos_;
+		vector_sincos_table(angles, sin_, cos_);
+		CHECK(vector_all_near_equal(sin_, vector_sin_table(angles), 0.0F));
+		CHECK(vector_all_near_equal(cos_, vector_cos_table(angles), 0.0F));
+	}
+
+	// Table entries are exact
+	CHECK(scalar_sin_table(0.0F) == 0.0F);
+	CHECK(scalar_cos_table(0.0F) == 1.0F);
+	CHECK(vector_get_x(vector_sin_table(vector_set(float(rtm::constants::half_pi())))) == scalar_sin_table(float(rtm::constants::half_pi())));
+}
+
+TEST_CASE("trig table atan2", "[math][trig_table]")
+{
+	const float threshold = 1.0E-4F;
+
+	for (float angle = -3.1F; angle <= 3.1F; angle += 0.013F)
+	{
+		for (float radius = 0.01F; radius <= 100.0F; radius *= 10.0F)
+		{
+			const float y = std::sin(angle) * radius;
+			const float x = std::cos(angle) * radius;
+			const float reference = float(std::atan2(double(y), double(x)));
+
+			CHECK(scalar_near_equal(scalar_atan2_table(y, x), reference, threshold));
+
+			const vector4f result = vector_atan2_table(vector_set(y, -y, y, -y), vector_set(x, x, -x, -x));
+			CHECK(scalar_near_equal(vector_get_x(result), reference, threshold));
+			CHECK(scalar_near_equal(vector_get_y(result), float(std::atan2(double(-y), double(x))), threshold));
+			CHECK(scalar_near_equal(vector_get_z(result), float(std::atan2(double(y), double(-x))), threshold));
+			CHECK(scalar_near_equal(vector_get_w(result), float(std::atan2(double(-y), double(-x))), threshold));
+		}
+	}
+
+	// Axes and the origin
+	const vector4f zero = vector_zero();
+	CHECK(scalar_atan2_table(0.0F, 0.0F) == 0.0F);
+	CHECK(scalar_near_equal(scalar_atan2_table(2.0F, 0.0F), float(rtm::constants::half_pi()), threshold));
+	CHECK(scalar_near_equal(scalar_atan2_table(-2.0F, 0.0F), -float(rtm::constants::half_pi()), threshold));
+	CHECK(scalar_near_equal(scalar_atan2_table(0.0F, -2.0F), float(rtm::constants::pi()), threshold));
+	CHECK(vector_all_near_equal(vector_atan2_table(zero, zero), zero, 0.0F));
+	CHECK(vector_all_near_equal(vector_atan2_table(vector_set(0.0F, 1.0F, 0.0F, -1.0F), vector_set(1.0F, 0.0F, -1.0F, 0.0F)), vector_set(0.0F, float(rtm::constants::half_pi()), float(rtm::constants::pi()), -float(rtm::constants::half_pi())), threshold));
+}
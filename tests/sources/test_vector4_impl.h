@@ -455,6 +455,11 @@ void test_vector4_arithmetic_impl(const FloatType threshold)
 	CHECK(scalar_near_equal(vector_get_z(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[2])), threshold));
 	CHECK(scalar_near_equal(vector_get_w(vector_sqrt(vector_abs(test_value0))), scalar_sqrt(scalar_abs(test_value0_flt[3])), threshold));
 
+	CHECK(scalar_near_equal(vector_get_x(vector_sqrt_reciprocal(vector_abs(test_value0))), scalar_sqrt_reciprocal(scalar_abs(test_value0_flt[0])), threshold));
+	CHECK(scalar_near_equal(vector_get_y(vector_sqrt_reciprocal(vector_abs(test_value0))), scalar_sqrt_reciprocal(scalar_abs(test_value0_flt[1])), threshold));
+	CHECK(scalar_near_equal(vector_get_z(vector_sqrt_reciprocal(vector_abs(test_value0))), scalar_sqrt_reciprocal(scalar_abs(test_value0_flt[2])), threshold));
+	CHECK(scalar_near_equal(vector_get_w(vector_sqrt_reciprocal(vector_abs(test_value0))), scalar_sqrt_reciprocal(scalar_abs(test_value0_flt[3])), threshold));
+
 	CHECK(FloatType(vector_get_x(vector_floor(test_value0))) == scalar_floor(test_value0_flt[0]));
 	CHECK(FloatType(vector_get_y(vector_floor(test_value0))) == scalar_floor(test_value0_flt[1]));
 	CHECK(FloatType(vector_get_z(vector_floor(test_value0))) == scalar_floor(test_value0_flt[2]));
@@ -544,6 +549,42 @@ void test_vector4_arithmetic_impl(const FloatType threshold)
 	CHECK(scalar_near_equal(rtm::scalar_sqrt(scalar_dot3<Vector4Type, FloatType>(test_value_diff, test_value_diff)), vector_distance3_result, threshold));
 	const ScalarType vector_distance3_result_scalar = vector_distance3(test_value0, test_value1);
 	CHECK(scalar_equal(vector_distance3_result, scalar_cast(vector_distance3_result_scalar)));
+	const FloatType vector_distance_squared3_result = vector_distance_squared3(test_value0, test_value1);
+	CHECK(scalar_near_equal(scalar_dot3<Vector4Type, FloatType>(test_value_diff, test_value_diff), vector_distance_squared3_result, threshold));
+
+	// Length comparisons skip the square root but must match comparing the length
+	{
+		const FloatType length3 = rtm::scalar_sqrt(scalar_dot3<Vector4Type, FloatType>(test_value0, test_value0));
+		const FloatType length4 = rtm::scalar_sqrt(scalar_dot<Vector4Type, FloatType>(test_value0, test_value0));
+		const FloatType distance3 = rtm::scalar_sqrt(scalar_dot3<Vector4Type, FloatType>(test_value_diff, test_value_diff));
+		const FloatType thresholds[] = { FloatType(-1.0), FloatType(0.0), length3 * FloatType(0.5), length3 * FloatType(2.0), distance3 * FloatType(0.5), distance3 * FloatType(2.0), length4 * FloatType(0.5), length4 * FloatType(2.0), std::numeric_limits<FloatType>::infinity() };
+
+		for (const FloatType comparison_threshold : thresholds)
+		{
+			CHECK((vector_length3(test_value0) < comparison_threshold) == (length3 < comparison_threshold));
+			CHECK((vector_length3(test_value0) <= comparison_threshold) == (length3 <= comparison_threshold));
+			CHECK((vector_length3(test_value0) > comparison_threshold) == (length3 > comparison_threshold));
+			CHECK((vector_length3(test_value0) >= comparison_threshold) == (length3 >= comparison_threshold));
+			CHECK((comparison_threshold < vector_length3(test_value0)) == (comparison_threshold < length3));
+			CHECK((comparison_threshold >= vector_length3(test_value0)) == (comparison_threshold >= length3));
+
+			CHECK((vector_length(test_value0) < comparison_threshold) == (length4 < comparison_threshold));
+			CHECK((vector_length(test_value0) >= comparison_threshold) == (length4 >= comparison_threshold));
+
+			CHECK((vector_distance3(test_value0, test_value1) < comparison_threshold) == (distance3 < comparison_threshold));
+			CHECK((vector_distance3(test_value0, test_value1) > comparison_threshold) == (distance3 > comparison_threshold));
+		}
+
+		// A zero length is never below zero but it is below any positive threshold
+		CHECK_FALSE(vector_length3(zero) < FloatType(0.0));
+		CHECK(vector_length3(zero) <= FloatType(0.0));
+		CHECK(vector_length3(zero) < FloatType(1.0e-3));
+		CHECK(vector_length3(zero) > FloatType(-1.0));
+
+		// Integer thresholds are supported as well
+		CHECK(vector_length3(zero) < 1);
+		CHECK(2 > vector_length3(zero));
+	}
 
 	const Vector4Type scalar_normalize3_result = scalar_normalize3<Vector4Type, FloatType>(test_value0, zero, threshold);
 	const Vector4Type vector_normalize3_result = vector_normalize3(test_value0);
@@ -562,6 +603,15 @@ void test_vector4_arithmetic_impl(const FloatType threshold)
 	CHECK(scalar_near_equal(vector_get_y(vector_normalize3_result0), vector_get_y(scalar_normalize3_result0), threshold));
 	CHECK(scalar_near_equal(vector_get_z(vector_normalize3_result0), vector_get_z(scalar_normalize3_result0), threshold));
 
+	const Vector4Type vector_normalize3_if_needed_result = vector_normalize3_if_needed(test_value0, zero, threshold);
+	CHECK(scalar_near_equal(vector_get_x(vector_normalize3_if_needed_result), vector_get_x(scalar_normalize3_result), threshold));
+	CHECK(scalar_near_equal(vector_get_y(vector_normalize3_if_needed_result), vector_get_y(scalar_normalize3_result), threshold));
+	CHECK(scalar_near_equal(vector_get_z(vector_normalize3_if_needed_result), vector_get_z(scalar_normalize3_result), threshold));
+
+	// Already normalized inputs are returned as-is
+	CHECK(vector_all_near_equal(vector_normalize3_if_needed(vector_normalize3_if_needed_result, zero, threshold), vector_normalize3_if_needed_result, FloatType(0.0)));
+	CHECK(vector_all_near_equal3(vector_normalize3_if_needed(zero, test_value1, threshold), test_value1, FloatType(0.0)));
+
 	CHECK(scalar_near_equal(vector_get_x(vector_lerp(test_value10, test_value11, FloatType(0.33))), ((test_value11_flt[0] - test_value10_flt[0]) * FloatType(0.33)) + test_value10_flt[0], threshold));
 	CHECK(scalar_near_equal(vector_get_y(vector_lerp(test_value10, test_value11, FloatType(0.33))), ((test_value11_flt[1] - test_value10_flt[1]) * FloatType(0.33)) + test_value10_flt[1], threshold));
 	CHECK(scalar_near_equal(vector_get_z(vector_lerp(test_value10, test_value11, FloatType(0.33))), ((test_value11_flt[2] - test_value10_flt[2]) * FloatType(0.33)) + test_value10_flt[2], threshold));
@@ -578,6 +628,15 @@ void test_vector4_arithmetic_impl(const FloatType threshold)
 	CHECK(vector_all_near_equal(vector_lerp(test_value10, test_value11, scalar_set(FloatType(0.0))), test_value10, FloatType(0.0)));
 	CHECK(vector_all_near_equal(vector_lerp(test_value10, test_value11, scalar_set(FloatType(1.0))), test_value11, FloatType(0.0)));
 
+	{
+		const Vector4Type alpha = vector_set(FloatType(0.0), FloatType(0.33), FloatType(0.75), FloatType(1.0));
+		const Vector4Type lerp_result = vector_lerp(test_value10, test_value11, alpha);
+		CHECK(vector_get_x(lerp_result) == test_value10_flt[0]);
+		CHECK(scalar_near_equal(vector_get_y(lerp_result), ((test_value11_flt[1] - test_value10_flt[1]) * FloatType(0.33)) + test_value10_flt[1], threshold));
+		CHECK(scalar_near_equal(vector_get_z(lerp_result), ((test_value11_flt[2] - test_value10_flt[2]) * FloatType(0.75)) + test_value10_flt[2], threshold));
+		CHECK(vector_get_w(lerp_result) == test_value11_flt[3]);
+	}
+
 	CHECK(scalar_near_equal(vector_get_x(vector_fraction(test_value0)), scalar_fraction(test_value0_flt[0]), threshold));
 	CHECK(scalar_near_equal(vector_get_y(vector_fraction(test_value0)), scalar_fraction(test_value0_flt[1]), threshold));
 	CHECK(scalar_near_equal(vector_get_z(vector_fraction(test_value0)), scalar_fraction(test_value0_flt[2]), threshold));
@@ -1128,6 +1187,10 @@ void test_vector4_impl(const FloatType threshold)
 			const Vector4Type rtm_asin = vector_asin(vector_set(ref_sin));
 			const Vector4Type rtm_acos = vector_acos(vector_set(ref_cos));
 
+			Vector4Type rtm_sincos_sin;
+			Vector4Type rtm_sincos_cos;
+			vector_sincos(angle_v, rtm_sincos_sin, rtm_sincos_cos);
+
 			CHECK(scalar_near_equal(FloatType(vector_get_x(rtm_sin)), ref_sin, threshold));
 			CHECK(scalar_near_equal(FloatType(vector_get_y(rtm_sin)), ref_sin, threshold));
 			CHECK(scalar_near_equal(FloatType(vector_get_z(rtm_sin)), ref_sin, threshold));
@@ -1148,6 +1211,9 @@ void test_vector4_impl(const FloatType threshold)
 			CHECK(scalar_near_equal(FloatType(vector_get_z(rtm_acos)), ref_acos, threshold));
 			CHECK(scalar_near_equal(FloatType(vector_get_w(rtm_acos)), ref_acos, threshold));
 
+			CHECK(vector_all_near_equal(rtm_sincos_sin, rtm_sin, FloatType(0.0)));
+			CHECK(vector_all_near_equal(rtm_sincos_cos, rtm_cos, FloatType(0.0)));
+
 			// For +-PI/2, we only test that the value is really large or really small
 			if (scalar_abs(angle) == half_pi)
 			{
@@ -1202,3 +1268,119 @@ void test_vector4_impl(const FloatType threshold)
 		}
 	}
 }
+
+template<typename FloatType>
+void test_vector4_exp_log_impl(const FloatType threshold)
+{
+	using Vector4Type = typename float_traits<FloatType>::vector4;
+
+	const FloatType inf = std::numeric_limits<FloatType>::infinity();
+	const FloatType nan = std::numeric_limits<FloatType>::quiet_NaN();
+
+	// Results are checked with a relative threshold since they span many orders of magnitude
+	const auto is_near_relative = [threshold](FloatType value, FloatType reference)
+	{
+		return scalar_abs(value - reference) <= threshold * scalar_max(FloatType(1.0), scalar_abs(reference));
+	};
+
+	{
+		const FloatType values[] = { FloatType(0.0), FloatType(-0.0), FloatType(1.0), FloatType(-1.0), FloatType(0.5), FloatType(-0.5), FloatType(0.34657359), FloatType(3.7), FloatType(-3.7), FloatType(12.25), FloatType(-12.25), FloatType(41.0), FloatType(-41.0), FloatType(88.5), FloatType(-87.0) };
+
+		for (const FloatType value : values)
+		{
+			INFO("value: " << value);
+
+			const Vector4Type value_v = vector_set(value, value * FloatType(0.5), -value, value * FloatType(-0.25));
+			const Vector4Type rtm_exp = vector_exp(value_v);
+			const Vector4Type rtm_exp2 = vector_exp2(value_v);
+
+			CHECK(is_near_relative(FloatType(vector_get_x(rtm_exp)), scalar_exp(value)));
+			CHECK(is_near_relative(FloatType(vector_get_y(rtm_exp)), scalar_exp(value * FloatType(0.5))));
+			CHECK(is_near_relative(FloatType(vector_get_z(rtm_exp)), scalar_exp(-value)));
+			CHECK(is_near_relative(FloatType(vector_get_w(rtm_exp)), scalar_exp(value * FloatType(-0.25))));
+
+			CHECK(is_near_relative(FloatType(vector_get_x(rtm_exp2)), scalar_exp2(value)));
+			CHECK(is_near_relative(FloatType(vector_get_y(rtm_exp2)), scalar_exp2(value * FloatType(0.5))));
+			CHECK(is_near_relative(FloatType(vector_get_z(rtm_exp2)), scalar_exp2(-value)));
+			CHECK(is_near_relative(FloatType(vector_get_w(rtm_exp2)), scalar_exp2(value * FloatType(-0.25))));
+		}
+
+		CHECK(FloatType(vector_get_x(vector_exp2(vector_set(FloatType(10.0))))) == FloatType(1024.0));
+		CHECK(FloatType(vector_get_x(vector_exp2(vector_set(FloatType(-3.0))))) == FloatType(0.125));
+		CHECK(FloatType(vector_get_x(vector_exp(vector_set(FloatType(0.0))))) == FloatType(1.0));
+		CHECK(FloatType(vector_get_x(vector_exp(vector_set(FloatType(1000.0))))) == inf);
+		CHECK(FloatType(vector_get_x(vector_exp(vector_set(FloatType(-1000.0))))) == FloatType(0.0));
+		CHECK(FloatType(vector_get_x(vector_exp(vector_set(inf)))) == inf);
+		CHECK(FloatType(vector_get_x(vector_exp(vector_set(-inf)))) == FloatType(0.0));
+		CHECK(std::isnan(FloatType(vector_get_x(vector_exp(vector_set(nan))))));
+		CHECK(std::isnan(FloatType(vector_get_x(vector_exp2(vector_set(nan))))));
+	}
+
+	{
+		const FloatType values[] = { FloatType(1.0), FloatType(2.0), FloatType(0.5), FloatType(0.7), FloatType(1.4142), FloatType(3.7), FloatType(10.0), FloatType(1234.5), FloatType(1.0E-3), FloatType(1.0E-20), FloatType(1.0E20), FloatType(1.0E-40) };
+
+		for (const FloatType value : values)
+		{
+			INFO("value: " << value);
+
+			const Vector4Type value_v = vector_set(value, value * FloatType(4.0), value * FloatType(0.5), value * FloatType(3.0));
+			const Vector4Type rtm_log = vector_log(value_v);
+			const Vector4Type rtm_log2 = vector_log2(value_v);
+
+			CHECK(is_near_relative(FloatType(vector_get_x(rtm_log)), scalar_log(value)));
+			CHECK(is_near_relative(FloatType(vector_get_y(rtm_log)), scalar_log(value * FloatType(4.0))));
+			CHECK(is_near_relative(FloatType(vector_get_z(rtm_log)), scalar_log(value * FloatType(0.5))));
+			CHECK(is_near_relative(FloatType(vector_get_w(rtm_log)), scalar_log(value * FloatType(3.0))));
+
+			CHECK(is_near_relative(FloatType(vector_get_x(rtm_log2)), scalar_log2(value)));
+			CHECK(is_near_relative(FloatType(vector_get_y(rtm_log2)), scalar_log2(value * FloatType(4.0))));
+			CHECK(is_near_relative(FloatType(vector_get_z(rtm_log2)), scalar_log2(value * FloatType(0.5))));
+			CHECK(is_near_relative(FloatType(vector_get_w(rtm_log2)), scalar_log2(value * FloatType(3.0))));
+		}
+
+		CHECK(FloatType(vector_get_x(vector_log2(vector_set(FloatType(1024.0))))) == FloatType(10.0));
+		CHECK(FloatType(vector_get_x(vector_log2(vector_set(FloatType(0.125))))) == FloatType(-3.0));
+		CHECK(FloatType(vector_get_x(vector_log(vector_set(FloatType(1.0))))) == FloatType(0.0));
+		CHECK(FloatType(vector_get_x(vector_log(vector_set(FloatType(0.0))))) == -inf);
+		CHECK(FloatType(vector_get_x(vector_log2(vector_set(FloatType(-0.0))))) == -inf);
+		CHECK(FloatType(vector_get_x(vector_log(vector_set(inf)))) == inf);
+		CHECK(std::isnan(FloatType(vector_get_x(vector_log(vector_set(FloatType(-1.0)))))));
+		CHECK(std::isnan(FloatType(vector_get_x(vector_log2(vector_set(nan))))));
+	}
+
+	{
+		const std::pair<FloatType, FloatType> values[] =
+		{
+			{ FloatType(2.0), FloatType(10.0) },
+			{ FloatType(2.0), FloatType(-2.0) },
+			{ FloatType(10.0), FloatType(0.5) },
+			{ FloatType(0.25), FloatType(1.5) },
+			{ FloatType(7.5), FloatType(3.25) },
+			{ FloatType(1.0E-3), FloatType(2.0) },
+			{ FloatType(-2.0), FloatType(3.0) },
+			{ FloatType(-2.0), FloatType(4.0) },
+			{ FloatType(-0.5), FloatType(-3.0) },
+			{ FloatType(0.0), FloatType(2.0) },
+			{ FloatType(123.0), FloatType(0.0) },
+			{ FloatType(1.0), FloatType(123.0) },
+		};
+
+		for (const std::pair<FloatType, FloatType>& value : values)
+		{
+			INFO("base: " << value.first << " exponent: " << value.second);
+
+			const Vector4Type base_v = vector_set(value.first);
+			const Vector4Type exponent_v = vector_set(value.second);
+			const FloatType ref_pow = scalar_pow(value.first, value.second);
+
+			CHECK(is_near_relative(FloatType(vector_get_x(vector_pow(base_v, exponent_v))), ref_pow));
+			CHECK(is_near_relative(FloatType(vector_get_y(vector_pow(base_v, exponent_v))), ref_pow));
+			CHECK(is_near_relative(FloatType(vector_get_z(vector_pow(base_v, value.second))), ref_pow));
+			CHECK(is_near_relative(FloatType(vector_get_w(vector_pow(base_v, value.second))), ref_pow));
+		}
+
+		CHECK(FloatType(vector_get_x(vector_pow(vector_set(FloatType(0.0)), vector_set(FloatType(-1.0))))) == inf);
+		CHECK(FloatType(vector_get_x(vector_pow(vector_set(nan), vector_set(FloatType(0.0))))) == FloatType(1.0));
+		CHECK(std::isnan(FloatType(vector_get_x(vector_pow(vector_set(FloatType(-2.0)), vector_set(FloatType(0.5)))))));
+	}
+}
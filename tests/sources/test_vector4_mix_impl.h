@@ -100,3 +100,108 @@ void test_vector_mix_impl(const FloatType threshold)
 #undef RTM_TEST_MIX_XY
 #undef RTM_TEST_MIX_XYZ
 }
+
+template<mix4 XArg>
+void test_vector_swizzle_impl(const float threshold)
+{
+	const float test_value0_flt[4] = { 2.0F, 9.34F, -54.12F, 6000.0F };
+	const vector4f test_value0 = vector_set(test_value0_flt[0], test_value0_flt[1], test_value0_flt[2], test_value0_flt[3]);
+
+	vector4f results[4 * 4 * 4];
+	uint32_t index = 0;
+
+#define RTM_TEST_SWIZZLE_XY(comp0, comp1) \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::x, mix4::x>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::x, mix4::y>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::x, mix4::z>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::x, mix4::w>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::y, mix4::x>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::y, mix4::y>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::y, mix4::z>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::y, mix4::w>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::z, mix4::x>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::z, mix4::y>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::z, mix4::z>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::z, mix4::w>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::w, mix4::x>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::w, mix4::y>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::w, mix4::z>(test_value0); \
+	results[index++] = vector_swizzle<comp0, comp1, mix4::w, mix4::w>(test_value0)
+
+	RTM_TEST_SWIZZLE_XY(XArg, mix4::x);
+	RTM_TEST_SWIZZLE_XY(XArg, mix4::y);
+	RTM_TEST_SWIZZLE_XY(XArg, mix4::z);
+	RTM_TEST_SWIZZLE_XY(XArg, mix4::w);
+
+	index = 0;
+
+	const int comp0 = (int)XArg;
+	for (int comp1 = 0; comp1 < 4; ++comp1)
+		for (int comp2 = 0; comp2 < 4; ++comp2)
+			for (int comp3 = 0; comp3 < 4; ++comp3)
+			{
+				INFO("vector_swizzle<" << comp0 << ", " << comp1 << ", " << comp2 << ", " << comp3 << ">");
+
+				const vector4f expected = vector_set(test_value0_flt[comp0], test_value0_flt[comp1], test_value0_flt[comp2], test_value0_flt[comp3]);
+
+				CHECK(vector_all_near_equal(expected, results[index], threshold));
+
+				++index;
+			}
+
+#undef RTM_TEST_SWIZZLE_XY
+}
+
+template<mix4 XArg>
+void test_vector_shuffle_impl(const float threshold)
+{
+	const float test_value0_flt[4] = { 2.0F, 9.34F, -54.12F, 6000.0F };
+	const float test_value1_flt[4] = { 0.75F, -4.52F, 44.68F, -54225.0F };
+
+	const vector4f test_value0 = vector_set(test_value0_flt[0], test_value0_flt[1], test_value0_flt[2], test_value0_flt[3]);
+	const vector4f test_value1 = vector_set(test_value1_flt[0], test_value1_flt[1], test_value1_flt[2], test_value1_flt[3]);
+
+	vector4f results[4 * 4 * 4];
+	uint32_t index = 0;
+
+#define RTM_TEST_SHUFFLE_XY(comp0, comp1) \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::a, mix4::a>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::a, mix4::b>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::a, mix4::c>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::a, mix4::d>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::b, mix4::a>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::b, mix4::b>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::b, mix4::c>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::b, mix4::d>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::c, mix4::a>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::c, mix4::b>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::c, mix4::c>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::c, mix4::d>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::d, mix4::a>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::d, mix4::b>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::d, mix4::c>(test_value0, test_value1); \
+	results[index++] = vector_shuffle<comp0, comp1, mix4::d, mix4::d>(test_value0, test_value1)
+
+	RTM_TEST_SHUFFLE_XY(XArg, mix4::x);
+	RTM_TEST_SHUFFLE_XY(XArg, mix4::y);
+	RTM_TEST_SHUFFLE_XY(XArg, mix4::z);
+	RTM_TEST_SHUFFLE_XY(XArg, mix4::w);
+
+	index = 0;
+
+	const int comp0 = (int)XArg;
+	for (int comp1 = 0; comp1 < 4; ++comp1)
+		for (int comp2 = 0; comp2 < 4; ++comp2)
+			for (int comp3 = 0; comp3 < 4; ++comp3)
+			{
+				INFO("vector_shuffle<" << comp0 << ", " << comp1 << ", " << (comp2 + 4) << ", " << (comp3 + 4) << ">");
+
+				const vector4f expected = vector_set(test_value0_flt[comp0], test_value0_flt[comp1], test_value1_flt[comp2], test_value1_flt[comp3]);
+
+				CHECK(vector_all_near_equal(expected, results[index], threshold));
+
+				++index;
+			}
+
+#undef RTM_TEST_SHUFFLE_XY
+}
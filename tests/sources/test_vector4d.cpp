@@ -40,6 +40,11 @@ TEST_CASE("vector4d math relational", "[math][vector4]")
 	test_vector4_relational_impl<double>(1.0E-9);
 }
 
+TEST_CASE("vector4d math exponential", "[math][vector4]")
+{
+	test_vector4_exp_log_impl<double>(1.0E-12);
+}
+
 TEST_CASE("vector4d math misc", "[math][vector4]")
 {
 	test_vector4_impl<double>(1.0E-9);
@@ -62,3 +67,47 @@ TEST_CASE("vector4d math misc", "[math][vector4]")
 	CHECK(double(vector_get_z(vector_ceil(large_values))) == scalar_ceil(double(vector_get_z(large_values))));
 	CHECK(double(vector_get_w(vector_ceil(large_values))) == scalar_ceil(double(vector_get_w(large_values))));
 }
+
+TEST_CASE("vector4d math trigonometry precision", "[math][vector4]")
+{
+	// The SIMD code paths must remain as accurate as the C math library to a few ULPs
+	const double threshold = 1.0E-15;
+
+	for (int32_t step = -1000; step <= 1000; ++step)
+	{
+		const double angle = double(step) * 0.0131;
+		const vector4d angles = vector_set(angle, -angle * 7.3, angle * 0.001, angle + 0.5);
+
+		vector4d sin_;
+		vector4d cos_;
+		vector_sincos(angles, sin_, cos_);
+
+		CHECK(scalar_near_equal(double(vector_get_x(vector_sin(angles))), std::sin(angle), threshold));
+		CHECK(scalar_near_equal(double(vector_get_y(vector_sin(angles))), std::sin(-angle * 7.3), threshold * 4.0));
+		CHECK(scalar_near_equal(double(vector_get_z(vector_cos(angles))), std::cos(angle * 0.001), threshold));
+		CHECK(scalar_near_equal(double(vector_get_w(vector_cos(angles))), std::cos(angle + 0.5), threshold));
+		CHECK(vector_all_near_equal(sin_, vector_sin(angles), 0.0));
+		CHECK(vector_all_near_equal(cos_, vector_cos(angles), 0.0));
+
+		const double value = double(step) * 0.001;
+		const vector4d values = vector_set(value, -value, value * 0.5, 1.0 - std::abs(value));
+		CHECK(scalar_near_equal(double(vector_get_x(vector_acos(values))), std::acos(value), threshold * 4.0));
+		CHECK(scalar_near_equal(double(vector_get_y(vector_acos(values))), std::acos(-value), threshold * 4.0));
+		CHECK(scalar_near_equal(double(vector_get_w(vector_acos(values))), std::acos(1.0 - std::abs(value)), threshold * 4.0));
+
+		const vector4d y = vector_set(value, -value * 100.0, 3.0, -0.25);
+		const vector4d x = vector_set(-0.5, 0.75, value, value * 10.0);
+		const vector4d atan2_ = vector_atan2(y, x);
+		CHECK(scalar_near_equal(double(vector_get_x(atan2_)), std::atan2(value, -0.5), threshold * 4.0));
+		CHECK(scalar_near_equal(double(vector_get_y(atan2_)), std::atan2(-value * 100.0, 0.75), threshold * 4.0));
+		CHECK(scalar_near_equal(double(vector_get_z(atan2_)), std::atan2(3.0, value), threshold * 4.0));
+		CHECK(scalar_near_equal(double(vector_get_w(atan2_)), std::atan2(-0.25, value * 10.0), threshold * 4.0));
+	}
+
+	const quatd start = quat_from_euler(0.2, -1.1, 0.4);
+	const quatd end = quat_from_euler(-0.9, 0.3, 2.2);
+	const quatd result = quat_slerp(start, end, 0.37);
+	const quatd result_s = quat_slerp(start, end, scalar_set(0.37));
+	CHECK(quat_near_equal(result, result_s, 0.0));
+	CHECK(scalar_near_equal(quat_length(result), 1.0, 1.0E-14));
+}
@@ -25,6 +25,10 @@
 
 #include "test_vector4_impl.h"
 
+#include <cmath>
+#include <cstring>
+#include <limits>
+
 TEST_CASE("vector4f math get/set", "[math][vector4]")
 {
 	test_vector4_getset_impl<float>();
@@ -80,3 +84,322 @@ TEST_CASE("vector4f math misc", "[math][vector4]")
 	CHECK(float(vector_get_z(vector_ceil(large_values))) == scalar_ceil(float(vector_get_z(large_values))));
 	CHECK(float(vector_get_w(vector_ceil(large_values))) == scalar_ceil(float(vector_get_w(large_values))));
 }
+
+TEST_CASE("vector4f math reciprocal estimates", "[math][vector4]")
+{
+	// The hardware estimates have 12 bits of precision with SSE and 8 bits with NEON
+	const float estimate_threshold = 4.0E-3F;
+	const float refined_threshold = 1.0E-4F;
+	const float exact_threshold = 1.0E-6F;
+
+	float inputs[] = { 0.001F, 0.3F, 1.0F, 2.5F, 17.0F, 1234.5F, 1.0E6F, 3.0E-20F };
+	for (float input : inputs)
+	{
+		const float reciprocal = 1.0F / input;
+		const float sqrt_reciprocal = 1.0F / std::sqrt(input);
+		const vector4f value = vector_set(input, -input, input, -input);
+
+		const vector4f reciprocal0 = vector_reciprocal_estimate(value);
+		const vector4f reciprocal1 = vector_reciprocal_estimate<1>(value);
+		const vector4f reciprocal2 = vector_reciprocal_estimate<2>(value);
+		CHECK(scalar_abs(float(vector_get_x(reciprocal0)) / reciprocal - 1.0F) < estimate_threshold);
+		CHECK(scalar_abs(float(vector_get_y(reciprocal0)) / -reciprocal - 1.0F) < estimate_threshold);
+		CHECK(scalar_abs(float(vector_get_x(reciprocal1)) / reciprocal - 1.0F) < refined_threshold);
+		CHECK(scalar_abs(float(vector_get_y(reciprocal1)) / -reciprocal - 1.0F) < refined_threshold);
+		CHECK(scalar_abs(float(vector_get_x(reciprocal2)) / reciprocal - 1.0F) < exact_threshold);
+		CHECK(scalar_abs(float(vector_get_y(reciprocal2)) / -reciprocal - 1.0F) < exact_threshold);
+
+		const vector4f abs_value = vector_abs(value);
+		const vector4f sqrt_reciprocal0 = vector_sqrt_reciprocal_estimate(abs_value);
+		const vector4f sqrt_reciprocal1 = vector_sqrt_reciprocal_estimate<1>(abs_value);
+		const vector4f sqrt_reciprocal2 = vector_sqrt_reciprocal_estimate<2>(abs_value);
+		CHECK(scalar_abs(float(vector_get_w(sqrt_reciprocal0)) / sqrt_reciprocal - 1.0F) < estimate_threshold);
+		CHECK(scalar_abs(float(vector_get_w(sqrt_reciprocal1)) / sqrt_reciprocal - 1.0F) < refined_threshold);
+		CHECK(scalar_abs(float(vector_get_w(sqrt_reciprocal2)) / sqrt_reciprocal - 1.0F) < exact_threshold);
+		CHECK(scalar_abs(float(vector_get_z(vector_sqrt_reciprocal(abs_value))) / sqrt_reciprocal - 1.0F) < exact_threshold);
+	}
+
+	// The unrefined estimates keep the infinities of the exact values
+	CHECK(std::isinf(float(vector_get_x(vector_reciprocal_estimate(vector_zero())))));
+	CHECK(std::isinf(float(vector_get_x(vector_sqrt_reciprocal_estimate(vector_zero())))));
+}
+
+TEST_CASE("vector4f math fast trigonometry", "[math][vector4]")
+{
+	const float sin_threshold = 2.0E-6F;
+	const float cos_threshold = 1.0E-5F;
+	const float tan_threshold = 1.0E-4F;
+	const float asin_threshold = 5.0E-5F;
+	const float atan_threshold = 2.0E-5F;
+
+	const float half_pi = rtm::constants::half_pi();
+	const float pi = rtm::constants::pi();
+
+	{
+		const float angles[] = { 0.0F, pi, -pi, half_pi, -half_pi, 0.5F, 32.5F, -0.5F, -32.5F, 2.1F, -2.1F };
+
+		for (const float angle : angles)
+		{
+			INFO("angle: " << angle);
+
+			const vector4f angle_v = vector_set(angle, -angle, angle + 0.25F, angle - 0.25F);
+			const vector4f rtm_sin = vector_sin_fast(angle_v);
+			const vector4f rtm_cos = vector_cos_fast(angle_v);
+
+			vector4f rtm_sincos_sin;
+			vector4f rtm_sincos_cos;
+			vector_sincos_fast(angle_v, rtm_sincos_sin, rtm_sincos_cos);
+
+			CHECK(vector_all_near_equal(rtm_sin, vector_sin(angle_v), sin_threshold));
+			CHECK(vector_all_near_equal(rtm_cos, vector_cos(angle_v), cos_threshold));
+			CHECK(vector_all_near_equal(rtm_sincos_sin, rtm_sin, 0.0F));
+			CHECK(vector_all_near_equal(rtm_sincos_cos, rtm_cos, 0.0F));
+
+			CHECK(scalar_near_equal(float(vector_get_x(rtm_sin)), std::sin(angle), sin_threshold));
+			CHECK(scalar_near_equal(float(vector_get_y(rtm_sin)), std::sin(-angle), sin_threshold));
+			CHECK(scalar_near_equal(float(vector_get_x(rtm_cos)), std::cos(angle), cos_threshold));
+			CHECK(scalar_near_equal(float(vector_get_y(rtm_cos)), std::cos(-angle), cos_threshold));
+
+			// For +-PI/2, we only test that the value is really large or really small
+			const vector4f rtm_tan = vector_tan_fast(vector_set(angle));
+			if (scalar_abs(angle) == half_pi)
+				CHECK(vector_all_greater_equal(vector_abs(rtm_tan), vector_set(1.0e4F)));
+			else
+				CHECK(vector_all_near_equal(rtm_tan, vector_set(std::tan(angle)), tan_threshold));
+		}
+	}
+
+	{
+		const float values[] = { -1.0F, -0.75F, -0.5F, -0.25F, 0.0F, 0.25F, 0.5F, 0.75F, 1.0F };
+
+		for (const float value : values)
+		{
+			INFO("value: " << value);
+
+			const vector4f value_v = vector_set(value);
+			CHECK(vector_all_near_equal(vector_asin_fast(value_v), vector_set(std::asin(value)), asin_threshold));
+			CHECK(vector_all_near_equal(vector_acos_fast(value_v), vector_set(std::acos(value)), asin_threshold));
+		}
+	}
+
+	{
+		const float values[] = { -10.0F, -5.0F, -1.0F, -0.5F, -0.25F, 0.0F, 0.25F, 0.5F, 0.75F, 1.0F, 81.0F };
+
+		for (const float value : values)
+		{
+			INFO("value: " << value);
+
+			const vector4f value_v = vector_set(value);
+			CHECK(vector_all_near_equal(vector_atan_fast(value_v), vector_set(std::atan(value)), atan_threshold));
+		}
+	}
+
+	{
+		const vector4f y0 = vector_set(-2.0F, -1.0F, -2.0F, 2.0F);
+		const vector4f x0 = vector_set(-2.0F, -2.0F, -1.0F, 2.0F);
+		const vector4f ref0 = vector_set(std::atan2(-2.0F, -2.0F), std::atan2(-1.0F, -2.0F), std::atan2(-2.0F, -1.0F), std::atan2(2.0F, 2.0F));
+		CHECK(vector_all_near_equal(vector_atan2_fast(y0, x0), ref0, atan_threshold));
+
+		const vector4f y1 = vector_set(1.0F, 2.0F, 2.0F, 0.0F);
+		const vector4f x1 = vector_set(2.0F, 1.0F, 0.0F, 0.0F);
+		const vector4f ref1 = vector_set(std::atan2(1.0F, 2.0F), std::atan2(2.0F, 1.0F), std::atan2(2.0F, 0.0F), std::atan2(0.0F, 0.0F));
+		CHECK(vector_all_near_equal(vector_atan2_fast(y1, x1), ref1, atan_threshold));
+
+		const vector4f y2 = vector_set(-2.0F, 2.0F, -2.0F, 2.0F);
+		const vector4f x2 = vector_set(0.0F, -1.0F, 1.0F, -0.5F);
+		const vector4f ref2 = vector_set(std::atan2(-2.0F, 0.0F), std::atan2(2.0F, -1.0F), std::atan2(-2.0F, 1.0F), std::atan2(2.0F, -0.5F));
+		CHECK(vector_all_near_equal(vector_atan2_fast(y2, x2), ref2, atan_threshold));
+	}
+}
+
+TEST_CASE("vector4f math half precision", "[math][vector4]")
+{
+	// Every half value converts like the scalar version
+	for (uint32_t value = 0; value < 65536; value += 4)
+	{
+		const uint16_t input[4] = { uint16_t(value), uint16_t(value + 1), uint16_t(value + 2), uint16_t(value + 3) };
+		if ((value & 0x7FFF) >= 0x7C00)
+			continue;	// Skip infinities and NaN, they are tested below
+
+		INFO("value: " << value);
+
+		const vector4f result = vector_load_half(&input[0]);
+		CHECK(vector_get_x(result) == scalar_half_to_float(input[0]));
+		CHECK(vector_get_y(result) == scalar_half_to_float(input[1]));
+		CHECK(vector_get_z(result) == scalar_half_to_float(input[2]));
+		CHECK(vector_get_w(result) == scalar_half_to_float(input[3]));
+
+		uint16_t output[4];
+		vector_store_half(result, &output[0]);
+		CHECK(output[0] == input[0]);
+		CHECK(output[1] == input[1]);
+		CHECK(output[2] == input[2]);
+		CHECK(output[3] == input[3]);
+	}
+
+	{
+		// Sweep float values including subnormal halves, overflows, and ties
+		for (uint32_t bits = 0; bits < 0x7F800000U; bits += 0x3FF1)
+		{
+			float value;
+			std::memcpy(&value, &bits, sizeof(float));
+
+			INFO("value: " << value);
+
+			uint16_t output[4];
+			vector_store_half(vector_set(value, -value, value * 0.5F, value * 2.0F), &output[0]);
+			CHECK(output[0] == scalar_float_to_half(value));
+			CHECK(output[1] == scalar_float_to_half(-value));
+			CHECK(output[2] == scalar_float_to_half(value * 0.5F));
+			CHECK(output[3] == scalar_float_to_half(value * 2.0F));
+		}
+	}
+
+	{
+		const uint16_t input[4] = { 0x7C00, 0xFC00, 0x3C00, 0x7E00 };
+		const vector4f result = vector_load_half(&input[0]);
+		CHECK(vector_get_x(result) == std::numeric_limits<float>::infinity());
+		CHECK(vector_get_y(result) == -std::numeric_limits<float>::infinity());
+		CHECK(vector_get_z(result) == 1.0F);
+		CHECK(std::isnan(vector_get_w(result)));
+
+		uint16_t output[4];
+		vector_store_half(result, &output[0]);
+		CHECK(output[0] == 0x7C00);
+		CHECK(output[1] == 0xFC00);
+		CHECK(output[2] == 0x3C00);
+		CHECK((output[3] & 0x7FFF) > 0x7C00);
+	}
+
+	{
+		const uint16_t input[4] = { 0x3C00, 0xC000, 0x3800, 0x7BFF };
+		CHECK(vector_all_near_equal(vector_load3_half(&input[0]), vector_set(1.0F, -2.0F, 0.5F, 0.0F), 0.0F));
+
+		uint16_t output[4] = { 0, 0, 0, 0x1234 };
+		vector_store3_half(vector_set(1.0F, -2.0F, 0.5F, 3.0F), &output[0]);
+		CHECK(output[0] == 0x3C00);
+		CHECK(output[1] == 0xC000);
+		CHECK(output[2] == 0x3800);
+		CHECK(output[3] == 0x1234);
+	}
+}
+
+TEST_CASE("vector4f math masked stores", "[math][vector4]")
+{
+	const vector4f input = vector_set(10.0F, 11.0F, 12.0F, 13.0F);
+
+	for (uint32_t mask_bits = 0; mask_bits < 16; ++mask_bits)
+	{
+		const mask4f mask = vector_less_than(vector_set((mask_bits & 1) ? 0.0F : 2.0F, (mask_bits & 2) ? 0.0F : 2.0F, (mask_bits & 4) ? 0.0F : 2.0F, (mask_bits & 8) ? 0.0F : 2.0F), vector_set(1.0F));
+
+		float masked_output[4] = { -1.0F, -1.0F, -1.0F, -1.0F };
+		vector_store_masked(input, mask, &masked_output[0]);
+
+		float compressed_output[4] = { -1.0F, -1.0F, -1.0F, -1.0F };
+		const uint32_t num_written = vector_compress_store(input, mask, &compressed_output[0]);
+
+		uint32_t expected_num_written = 0;
+		for (uint32_t component_index = 0; component_index < 4; ++component_index)
+		{
+			const float expected_value = 10.0F + float(component_index);
+			const bool is_selected = (mask_bits & (1U << component_index)) != 0;
+
+			CHECK(masked_output[component_index] == (is_selected ? expected_value : -1.0F));
+
+			if (is_selected)
+				CHECK(compressed_output[expected_num_written++] == expected_value);
+		}
+
+		CHECK(num_written == expected_num_written);
+	}
+}
+
+TEST_CASE("vector4f math exponential", "[math][vector4]")
+{
+	test_vector4_exp_log_impl<float>(1.0E-5F);
+}
+
+TEST_CASE("vector4f math polynomial", "[math][vector4]")
+{
+	const float threshold = 1.0E-5F;
+
+	for (float x = -1.0F; x <= 1.0F; x += 0.125F)
+	{
+		INFO("x: " << x);
+		const vector4f input = vector_set(x, x * 0.5F, -x, x * -0.25F);
+
+		CHECK(vector_all_near_equal(vector_polynomial(input, 1.0F, 2.0F, 3.0F, 4.0F), vector_set(
+			scalar_polynomial(vector_get_x(input), 1.0F, 2.0F, 3.0F, 4.0F),
+			scalar_polynomial(vector_get_y(input), 1.0F, 2.0F, 3.0F, 4.0F),
+			scalar_polynomial(vector_get_z(input), 1.0F, 2.0F, 3.0F, 4.0F),
+			scalar_polynomial(vector_get_w(input), 1.0F, 2.0F, 3.0F, 4.0F)), threshold));
+
+		CHECK(vector_all_near_equal(vector_polynomial(input, 1.0F, -1.0F, 0.5F, 0.25F, -0.125F), vector_set(
+			scalar_polynomial(vector_get_x(input), 1.0F, -1.0F, 0.5F, 0.25F, -0.125F),
+			scalar_polynomial(vector_get_y(input), 1.0F, -1.0F, 0.5F, 0.25F, -0.125F),
+			scalar_polynomial(vector_get_z(input), 1.0F, -1.0F, 0.5F, 0.25F, -0.125F),
+			scalar_polynomial(vector_get_w(input), 1.0F, -1.0F, 0.5F, 0.25F, -0.125F)), threshold));
+
+		CHECK(vector_all_near_equal(vector_polynomial(input, 0.5F, 1.0F, -0.5F, 0.25F, 0.125F, -0.25F), vector_set(
+			scalar_polynomial(vector_get_x(input), 0.5F, 1.0F, -0.5F, 0.25F, 0.125F, -0.25F),
+			scalar_polynomial(vector_get_y(input), 0.5F, 1.0F, -0.5F, 0.25F, 0.125F, -0.25F),
+			scalar_polynomial(vector_get_z(input), 0.5F, 1.0F, -0.5F, 0.25F, 0.125F, -0.25F),
+			scalar_polynomial(vector_get_w(input), 0.5F, 1.0F, -0.5F, 0.25F, 0.125F, -0.25F)), threshold));
+
+		CHECK(vector_all_near_equal(vector_polynomial(input, 0.0F, 1.0F, 0.0F, -0.5F, 0.0F, 0.25F, 0.125F), vector_set(
+			scalar_polynomial(vector_get_x(input), 0.0F, 1.0F, 0.0F, -0.5F, 0.0F, 0.25F, 0.125F),
+			scalar_polynomial(vector_get_y(input), 0.0F, 1.0F, 0.0F, -0.5F, 0.0F, 0.25F, 0.125F),
+			scalar_polynomial(vector_get_z(input), 0.0F, 1.0F, 0.0F, -0.5F, 0.0F, 0.25F, 0.125F),
+			scalar_polynomial(vector_get_w(input), 0.0F, 1.0F, 0.0F, -0.5F, 0.0F, 0.25F, 0.125F)), threshold));
+
+		CHECK(vector_all_near_equal(vector_polynomial(input, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F), vector_set(
+			scalar_polynomial(vector_get_x(input), 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F),
+			scalar_polynomial(vector_get_y(input), 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F),
+			scalar_polynomial(vector_get_z(input), 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F),
+			scalar_polynomial(vector_get_w(input), 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F, 1.0F)), threshold));
+	}
+}
+
+TEST_CASE("vector4f math transpose", "[math][vector4]")
+{
+	{
+		vector4f v0 = vector_set(0.0F, 1.0F, 2.0F, 3.0F);
+		vector4f v1 = vector_set(4.0F, 5.0F, 6.0F, 7.0F);
+		vector4f v2 = vector_set(8.0F, 9.0F, 10.0F, 11.0F);
+		vector4f v3 = vector_set(12.0F, 13.0F, 14.0F, 15.0F);
+
+		vector_transpose4x4(v0, v1, v2, v3);
+		CHECK(vector_all_near_equal(v0, vector_set(0.0F, 4.0F, 8.0F, 12.0F), 0.0F));
+		CHECK(vector_all_near_equal(v1, vector_set(1.0F, 5.0F, 9.0F, 13.0F), 0.0F));
+		CHECK(vector_all_near_equal(v2, vector_set(2.0F, 6.0F, 10.0F, 14.0F), 0.0F));
+		CHECK(vector_all_near_equal(v3, vector_set(3.0F, 7.0F, 11.0F, 15.0F), 0.0F));
+	}
+
+	{
+		// One extra entry on each side to catch out of bounds writes
+		float3f input[6];
+		for (uint32_t i = 0; i < 6; ++i)
+			input[i] = float3f{ float(i), float(i) + 10.0F, float(i) + 20.0F };
+
+		vector4f x;
+		vector4f y;
+		vector4f z;
+		vector_deinterleave3(&input[1], x, y, z);
+		CHECK(vector_all_near_equal(x, vector_set(1.0F, 2.0F, 3.0F, 4.0F), 0.0F));
+		CHECK(vector_all_near_equal(y, vector_set(11.0F, 12.0F, 13.0F, 14.0F), 0.0F));
+		CHECK(vector_all_near_equal(z, vector_set(21.0F, 22.0F, 23.0F, 24.0F), 0.0F));
+
+		float3f output[6];
+		for (uint32_t i = 0; i < 6; ++i)
+			output[i] = float3f{ -1.0F, -1.0F, -1.0F };
+
+		vector_interleave3(x, y, z, &output[1]);
+		for (uint32_t i = 0; i < 6; ++i)
+		{
+			const bool is_written = i >= 1 && i <= 4;
+			CHECK(output[i].x == (is_written ? input[i].x : -1.0F));
+			CHECK(output[i].y == (is_written ? input[i].y : -1.0F));
+			CHECK(output[i].z == (is_written ? input[i].z : -1.0F));
+		}
+	}
+}
@@ -29,3 +29,13 @@ TEST_CASE("vector4f vector_mix<w * * *>", "[math][vector4]")
 {
 	test_vector_mix_impl<vector4f, float, mix4::w>(1.0E-6F);
 }
+
+TEST_CASE("vector4f vector_swizzle<w * * *>", "[math][vector4]")
+{
+	test_vector_swizzle_impl<mix4::w>(1.0E-6F);
+}
+
+TEST_CASE("vector4f vector_shuffle<w * * *>", "[math][vector4]")
+{
+	test_vector_shuffle_impl<mix4::w>(1.0E-6F);
+}
@@ -29,3 +29,13 @@ TEST_CASE("vector4f vector_mix<z * * *>", "[math][vector4]")
 {
 	test_vector_mix_impl<vector4f, float, mix4::z>(1.0E-6F);
 }
+
+TEST_CASE("vector4f vector_swizzle<z * * *>", "[math][vector4]")
+{
+	test_vector_swizzle_impl<mix4::z>(1.0E-6F);
+}
+
+TEST_CASE("vector4f vector_shuffle<z * * *>", "[math][vector4]")
+{
+	test_vector_shuffle_impl<mix4::z>(1.0E-6F);
+}
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/constants.h>
+#include <rtm/vector4f.h>
+#include <rtm/vector4fx.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+using namespace rtm;
+
+static bool vector_all_equal(vector4fx_arg0 lhs, int32_t x, int32_t y, int32_t z, int32_t w)
+{
+	const vector4i raw = vector_fx_to_raw(lhs);
+	return vector_get_x(raw) == x && vector_get_y(raw) == y && vector_get_z(raw) == z && vector_get_w(raw) == w;
+}
+
+// Within 'num_steps' Q16.16 steps of the floating point value
+static bool vector_all_near_equal(vector4fx_arg0 lhs, vector4f_arg1 rhs, float num_steps)
+{
+	return vector_all_near_equal(vector_from_fx(lhs), rhs, num_steps / 65536.0F);
+}
+
+TEST_CASE("vector4fx setters, getters, and casts", "[math][vector4fx]")
+{
+	CHECK(vector_all_equal(vector_to_fx(vector_set(1.0F, -0.5F, 1.0F / 65536.0F, -32768.0F)), 65536, -32768, 1, int32_t(0x80000000)));
+	CHECK(vector_all_equal(vector_fx_zero(), 0, 0, 0, 0));
+
+	// Banker's rounding like vector_round_to_int
+	CHECK(vector_all_equal(vector_to_fx(vector_set(0.5F / 65536.0F, 1.5F / 65536.0F, -0.5F / 65536.0F, -1.5F / 65536.0F)), 0, 2, 0, -2));
+
+	const vector4f value = vector_set(123.25F, -7.125F, 0.0F, 32767.5F);
+	CHECK(vector_all_near_equal(vector_to_fx(value), value, 0.0F));
+
+	const int32_t data[5] = { 0, 65536, -65536, 3, -3 };
+	const vector4fx loaded = vector_fx_load(&data[1]);
+	CHECK(vector_all_equal(loaded, 65536, -65536, 3, -3));
+	CHECK(vector_all_equal(vector_fx_from_raw(vector_set(1, 2, 3, 4)), 1, 2, 3, 4));
+
+	int32_t output[4];
+	vector_store(loaded, &output[0]);
+	CHECK(output[0] == 65536);
+	CHECK(output[3] == -3);
+}
+
+TEST_CASE("vector4fx arithmetic", "[math][vector4fx]")
+{
+	const vector4fx lhs = vector_to_fx(vector_set(1.5F, -2.25F, 3.0F, -0.5F));
+	const vector4fx rhs = vector_to_fx(vector_set(-2.0F, 0.5F, 1.0F / 3.0F, -0.5F));
+
+	CHECK(vector_all_near_equal(vector_add(lhs, rhs), vector_add(vector_from_fx(lhs), vector_from_fx(rhs)), 0.0F));
+	CHECK(vector_all_near_equal(vector_sub(lhs, rhs), vector_sub(vector_from_fx(lhs), vector_from_fx(rhs)), 0.0F));
+	CHECK(vector_all_equal(vector_neg(lhs), -98304, 147456, -196608, 32768));
+	CHECK(vector_all_equal(vector_mul(lhs, rhs), -196608, -73728, 65535, 16384));
+
+	// Products are rounded to the nearest value: 1.5 * 1/65536 and -1.5 * 1/65536
+	const vector4fx epsilon = vector_fx_from_raw(vector_set(1));
+	CHECK(vector_all_equal(vector_mul(vector_to_fx(vector_set(1.5F, -1.5F, 0.25F, 100.0F)), epsilon), 2, -1, 0, 100));
+
+	// Large values use the full 64 bit product
+	CHECK(vector_all_near_equal(vector_mul(vector_to_fx(vector_set(300.0F, -181.0F, 0.001F, 1000.5F)), vector_to_fx(vector_set(100.0F, 181.0F, 0.001F, -2.0F))), vector_set(30000.0F, -32761.0F, 0.0F, -2001.0F), 1.0F));
+
+	CHECK(vector_dot(lhs, rhs) == -196608 - 73728 + 65535 + 16384);
+	CHECK(vector_dot3(lhs, rhs) == -196608 - 73728 + 65535);
+
+	const vector4fx x_axis = vector_to_fx(vector_set(1.0F, 0.0F, 0.0F, 5.0F));
+	const vector4fx y_axis = vector_to_fx(vector_set(0.0F, 1.0F, 0.0F, 7.0F));
+	CHECK(vector_all_equal(vector_cross3(x_axis, y_axis), 0, 0, 65536, 0));
+	CHECK(vector_all_near_equal(vector_cross3(lhs, rhs), vector_cross3(vector_from_fx(lhs), vector_from_fx(rhs)), 2.0F));
+}
+
+TEST_CASE("vector4fx normalize", "[math][vector4fx]")
+{
+	CHECK(vector_all_equal(vector_normalize3(vector_to_fx(vector_set(3.0F, 0.0F, -4.0F, 9.0F))), 39322, 0, -52429, 0));
+	CHECK(vector_all_equal(vector_normalize3(vector_fx_zero()), 0, 0, 0, 0));
+
+	for (uint32_t index = 1; index < 1000; ++index)
+	{
+		const float t = float(index);
+		const vector4f value = vector_set(std::sin(t * 0.1F) * 3.0F, std::cos(t * 0.37F) * 2.0F, 0.5F + float(index % 7), 0.0F);
+		CHECK(vector_all_near_equal(vector_normalize3(vector_to_fx(value)), vector_normalize3(vector_from_fx(vector_to_fx(value))), 2.0F));
+	}
+
+	// Up to the largest supported squared length
+	const vector4f large = vector_set(100.0F, -120.0F, 90.0F, 0.0F);
+	CHECK(vector_all_near_equal(vector_normalize3(vector_to_fx(large)), vector_normalize3(large), 2.0F));
+}
+
+TEST_CASE("vector4fx trigonometry", "[math][vector4fx]")
+{
+	// Exact at multiples of PI / 2
+	const vector4fx quarter_turns = vector_to_fx(vector_set(0.0F, float(constants::half_pi()), float(constants::pi()), -float(constants::half_pi())));
+	CHECK(vector_all_equal(vector_sin(quarter_turns), 0, 65536, 0, -65536));
+	CHECK(vector_all_equal(vector_cos(quarter_turns), 65536, 0, -65536, 0));
+
+	for (int32_t raw_angle = -20000000; raw_angle < 20000000; raw_angle += 9973)
+	{
+		const vector4fx angles = vector_fx_from_raw(vector_set(raw_angle, -raw_angle, raw_angle / 7, raw_angle + 12345));
+
+		vector4fx sine;
+		vector4fx cosine;
+		vector_sincos(angles, sine, cosine);
+
+		// Large angles are not representable as floats with Q16.16 precision, compute the reference with doubles
+		const int32_t raw_angles[4] = { raw_angle, -raw_angle, raw_angle / 7, raw_angle + 12345 };
+		float reference_sines[4];
+		float reference_cosines[4];
+		for (uint32_t component = 0; component < 4; ++component)
+		{
+			reference_sines[component] = float(std::sin(double(raw_angles[component]) / 65536.0));
+			reference_cosines[component] = float(std::cos(double(raw_angles[component]) / 65536.0));
+		}
+
+		const vector4f reference_sine = vector_load(&reference_sines[0]);
+		const vector4f reference_cosine = vector_load(&reference_cosines[0]);
+		CHECK(vector_all_near_equal(sine, reference_sine, 1.0F));
+		CHECK(vector_all_near_equal(cosine, reference_cosine, 1.0F));
+
+		// Exactly odd and even
+		const vector4i sine_raw = vector_fx_to_raw(sine);
+		const vector4i cosine_raw = vector_fx_to_raw(cosine);
+		CHECK(vector_get_x(sine_raw) == -vector_get_y(sine_raw));
+		CHECK(vector_get_x(cosine_raw) == vector_get_y(cosine_raw));
+	}
+
+	// The whole range, where an imprecise conversion into turns is multiplied by the angle
+	double max_error = 0.0;
+	for (int64_t raw_angle = INT32_MIN; raw_angle <= INT32_MAX; raw_angle += 4 * 99991)
+	{
+		int32_t raw_angles[4];
+		for (uint32_t component = 0; component < 4; ++component)
+			raw_angles[component] = int32_t(std::min<int64_t>(raw_angle + component * 99991, INT32_MAX));
+
+		vector4fx sine;
+		vector4fx cosine;
+		vector_sincos(vector_fx_from_raw(vector_load(&raw_angles[0])), sine, cosine);
+
+		int32_t sines[4];
+		int32_t cosines[4];
+		vector_store(vector_fx_to_raw(sine), &sines[0]);
+		vector_store(vector_fx_to_raw(cosine), &cosines[0]);
+
+		for (uint32_t component = 0; component < 4; ++component)
+		{
+			const double angle = double(raw_angles[component]) / 65536.0;
+			max_error = std::max(max_error, std::fabs(double(sines[component]) / 65536.0 - std::sin(angle)));
+			max_error = std::max(max_error, std::fabs(double(cosines[component]) / 65536.0 - std::cos(angle)));
+		}
+	}
+
+	CHECK(max_error <= 1.0 / 65536.0);
+}
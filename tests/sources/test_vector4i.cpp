@@ -0,0 +1,196 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 Nicholas Frechette & Animation Compression Library contributors
+// Copyright (c) 2018 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <catch.hpp>
+
+#include <rtm/mask4i.h>
+#include <rtm/vector4f.h>
+#include <rtm/vector4i.h>
+
+#include <cstdint>
+#include <limits>
+
+using namespace rtm;
+
+static bool vector_all_equal(vector4i_arg0 lhs, int32_t x, int32_t y, int32_t z, int32_t w)
+{
+	return vector_get_x(lhs) == x && vector_get_y(lhs) == y && vector_get_z(lhs) == z && vector_get_w(lhs) == w;
+}
+
+TEST_CASE("vector4i setters, getters, and casts", "[math][vector4i]")
+{
+	{
+		const vector4i value = vector_set(1, -2, 3, -4);
+		CHECK(vector_get_x(value) == 1);
+		CHECK(vector_get_y(value) == -2);
+		CHECK(vector_get_z(value) == 3);
+		CHECK(vector_get_w(value) == -4);
+
+		CHECK(vector_all_equal(vector_set(7), 7, 7, 7, 7));
+	}
+
+	{
+		const int32_t data[5] = { 10, 11, 12, 13, 14 };
+		CHECK(vector_all_equal(vector_load(&data[1]), 11, 12, 13, 14));
+
+		int32_t output[5] = { 0, 0, 0, 0, 0 };
+		vector_store(vector_set(5, 6, 7, 8), &output[1]);
+		CHECK(output[0] == 0);
+		CHECK(output[1] == 5);
+		CHECK(output[2] == 6);
+		CHECK(output[3] == 7);
+		CHECK(output[4] == 8);
+	}
+
+	{
+		const vector4f input = vector_set(1.75F, -1.75F, 2.5F, -3.5F);
+		CHECK(vector_all_equal(vector_truncate_to_int(input), 1, -1, 2, -3));
+		CHECK(vector_all_equal(vector_round_to_int(input), 2, -2, 2, -4));
+
+		const vector4f result = vector_int_to_float(vector_set(1, -2, 100000, -7));
+		CHECK(vector_get_x(result) == 1.0F);
+		CHECK(vector_get_y(result) == -2.0F);
+		CHECK(vector_get_z(result) == 100000.0F);
+		CHECK(vector_get_w(result) == -7.0F);
+	}
+
+	{
+		const float float_data[8] = { 0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F, 6.0F, 7.0F };
+		const int32_t int_data[8] = { 0, -1, -2, -3, -4, -5, -6, -7 };
+		const vector4i indices = vector_set(7, 0, 3, 3);
+
+		const vector4f result = vector_gather(&float_data[0], indices);
+		CHECK(vector_get_x(result) == 7.0F);
+		CHECK(vector_get_y(result) == 0.0F);
+		CHECK(vector_get_z(result) == 3.0F);
+		CHECK(vector_get_w(result) == 3.0F);
+
+		CHECK(vector_all_equal(vector_gather(&int_data[0], indices), -7, 0, -3, -3));
+	}
+}
+
+TEST_CASE("vector4i arithmetic", "[math][vector4i]")
+{
+	const int32_t int_max = std::numeric_limits<int32_t>::max();
+	const int32_t int_min = std::numeric_limits<int32_t>::min();
+
+	const vector4i lhs = vector_set(1, -2, 30000, int_max);
+	const vector4i rhs = vector_set(5, 7, -40000, 1);
+
+	CHECK(vector_all_equal(vector_add(lhs, rhs), 6, 5, -10000, int_min));
+	CHECK(vector_all_equal(vector_sub(lhs, rhs), -4, -9, 70000, int_max - 1));
+	CHECK(vector_all_equal(vector_mul(lhs, rhs), 5, -14, -1200000000, int_max));
+	CHECK(vector_all_equal(vector_mul(vector_set(65536, -65536, 3, -3), vector_set(65536, 3, -3, -3)), 0, -196608, -9, 9));
+	CHECK(vector_all_equal(vector_neg(lhs), -1, 2, -30000, -int_max));
+	CHECK(vector_all_equal(vector_abs(vector_set(-1, 2, 0, int_min)), 1, 2, 0, int_min));
+
+	CHECK(vector_all_equal(vector_min(lhs, rhs), 1, -2, -40000, 1));
+	CHECK(vector_all_equal(vector_max(lhs, rhs), 5, 7, 30000, int_max));
+	CHECK(vector_all_equal(vector_clamp(vector_set(-5, 5, 50, 0), vector_set(0), vector_set(10)), 0, 5, 10, 0));
+}
+
+TEST_CASE("vector4i bitwise operations", "[math][vector4i]")
+{
+	const vector4i lhs = vector_set(0x0F0F, -1, 0x1234, int32_t(0x80000000U));
+	const vector4i rhs = vector_set(0x00FF, 0x55, 0x4321, -1);
+
+	CHECK(vector_all_equal(vector_and(lhs, rhs), 0x000F, 0x55, 0x0220, int32_t(0x80000000U)));
+	CHECK(vector_all_equal(vector_or(lhs, rhs), 0x0FFF, -1, 0x5335, -1));
+	CHECK(vector_all_equal(vector_xor(lhs, rhs), 0x0FF0, ~0x55, 0x5115, 0x7FFFFFFF));
+
+	const vector4i input = vector_set(1, -8, 0x40000000, int32_t(0x80000000U));
+	CHECK(vector_all_equal(vector_shift_left(input, 0), 1, -8, 0x40000000, int32_t(0x80000000U)));
+	CHECK(vector_all_equal(vector_shift_left(input, 1), 2, -16, int32_t(0x80000000U), 0));
+	CHECK(vector_all_equal(vector_shift_right(input, 2), 0, -2, 0x10000000, int32_t(0xE0000000U)));
+	CHECK(vector_all_equal(vector_shift_right_logical(input, 2), 0, 0x3FFFFFFE, 0x10000000, 0x20000000));
+	CHECK(vector_all_equal(vector_shift_right(input, 31), 0, -1, 0, -1));
+}
+
+TEST_CASE("vector4i comparisons and masking", "[math][vector4i]")
+{
+	const vector4i lhs = vector_set(-1, 2, 3, 4);
+	const vector4i rhs = vector_set(1, 2, -3, 5);
+
+	CHECK(mask_get_x(vector_equal(lhs, rhs)) == 0);
+	CHECK(mask_get_y(vector_equal(lhs, rhs)) == 0xFFFFFFFFU);
+	CHECK(mask_get_z(vector_equal(lhs, rhs)) == 0);
+	CHECK(mask_get_w(vector_equal(lhs, rhs)) == 0);
+
+	CHECK(mask_get_x(vector_less_than(lhs, rhs)) == 0xFFFFFFFFU);
+	CHECK(mask_get_y(vector_less_than(lhs, rhs)) == 0);
+	CHECK(mask_get_z(vector_less_than(lhs, rhs)) == 0);
+	CHECK(mask_get_w(vector_less_than(lhs, rhs)) == 0xFFFFFFFFU);
+
+	CHECK(mask_get_x(vector_less_equal(lhs, rhs)) == 0xFFFFFFFFU);
+	CHECK(mask_get_y(vector_less_equal(lhs, rhs)) == 0xFFFFFFFFU);
+	CHECK(mask_get_z(vector_less_equal(lhs, rhs)) == 0);
+	CHECK(mask_get_w(vector_less_equal(lhs, rhs)) == 0xFFFFFFFFU);
+
+	CHECK(mask_get_x(vector_greater_than(lhs, rhs)) == 0);
+	CHECK(mask_get_y(vector_greater_than(lhs, rhs)) == 0);
+	CHECK(mask_get_z(vector_greater_than(lhs, rhs)) == 0xFFFFFFFFU);
+	CHECK(mask_get_w(vector_greater_than(lhs, rhs)) == 0);
+
+	CHECK(mask_get_x(vector_greater_equal(lhs, rhs)) == 0);
+	CHECK(mask_get_y(vector_greater_equal(lhs, rhs)) == 0xFFFFFFFFU);
+	CHECK(mask_get_z(vector_greater_equal(lhs, rhs)) == 0xFFFFFFFFU);
+	CHECK(mask_get_w(vector_greater_equal(lhs, rhs)) == 0);
+
+	CHECK(mask_all_true(vector_equal(lhs, lhs)));
+	CHECK(mask_any_true(vector_less_than(lhs, rhs)));
+
+	CHECK(vector_all_equal(vector_select(vector_less_than(lhs, rhs), lhs, rhs), -1, 2, -3, 4));
+}
+
+TEST_CASE("vector4i masked stores", "[math][vector4i]")
+{
+	const vector4i input = vector_set(10, 11, 12, 13);
+
+	for (uint32_t mask_bits = 0; mask_bits < 16; ++mask_bits)
+	{
+		const mask4i mask = vector_less_than(vector_set((mask_bits & 1) ? 0 : 2, (mask_bits & 2) ? 0 : 2, (mask_bits & 4) ? 0 : 2, (mask_bits & 8) ? 0 : 2), vector_set(1));
+		CHECK(mask_get_bits(mask) == mask_bits);
+
+		int32_t masked_output[4] = { -1, -1, -1, -1 };
+		vector_store_masked(input, mask, &masked_output[0]);
+
+		int32_t compressed_output[4] = { -1, -1, -1, -1 };
+		const uint32_t num_written = vector_compress_store(input, mask, &compressed_output[0]);
+
+		uint32_t expected_num_written = 0;
+		for (uint32_t component_index = 0; component_index < 4; ++component_index)
+		{
+			const int32_t expected_value = 10 + int32_t(component_index);
+			const bool is_selected = (mask_bits & (1U << component_index)) != 0;
+
+			CHECK(masked_output[component_index] == (is_selected ? expected_value : -1));
+
+			if (is_selected)
+				CHECK(compressed_output[expected_num_written++] == expected_value);
+		}
+
+		CHECK(num_written == expected_num_written);
+	}
+}
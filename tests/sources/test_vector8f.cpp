@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <catch.hpp>
+
+#include <rtm/scalarf.h>
+#include <rtm/impl/memory_utils.h>
+#include <rtm/vector8f.h>
+
+using namespace rtm;
+
+static void check_lanes(vector8f_arg0 input, const float* expected, float threshold)
+{
+	float lanes[8];
+	vector_store(input, &lanes[0]);
+
+	for (uint32_t lane_index = 0; lane_index < 8; ++lane_index)
+		CHECK(scalar_near_equal(lanes[lane_index], expected[lane_index], threshold));
+}
+
+TEST_CASE("vector8f math", "[math][vector8]")
+{
+	const float threshold = 1.0E-6F;
+
+	const float values0[8] = { -3.5F, 2.0F, 0.25F, -0.0F, 11.0F, -7.25F, 1.0F, 4.5F };
+	const float values1[8] = { 1.5F, -2.0F, 8.0F, 3.0F, -11.0F, 0.5F, 1.0F, 2.25F };
+	const float values2[8] = { 0.5F, 1.0F, -1.0F, 2.0F, 3.0F, -4.0F, 5.0F, 6.0F };
+
+	const vector8f vec0 = vector8_load(&values0[0]);
+	const vector8f vec1 = vector8_load(&values1[0]);
+	const vector8f vec2 = vector8_load(&values2[0]);
+
+	float expected[8];
+
+	{
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = 0.0F;
+		check_lanes(vector8_zero(), expected, 0.0F);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = 2.5F;
+		check_lanes(vector8_set(2.5F), expected, 0.0F);
+
+		check_lanes(vector8_set(vector_get_low(vec0), vector_get_high(vec0)), values0, 0.0F);
+		CHECK(vector_get_x(vector_get_low(vec0)) == values0[0]);
+		CHECK(vector_get_x(vector_get_high(vec0)) == values0[4]);
+	}
+
+	{
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] + values1[i];
+		check_lanes(vector_add(vec0, vec1), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] - values1[i];
+		check_lanes(vector_sub(vec0, vec1), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] * values1[i];
+		check_lanes(vector_mul(vec0, vec1), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] * 2.5F;
+		check_lanes(vector_mul(vec0, 2.5F), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] / values1[i];
+		check_lanes(vector_div(vec0, vec1), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_max(values0[i], values1[i]);
+		check_lanes(vector_max(vec0, vec1), expected, 0.0F);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_min(values0[i], values1[i]);
+		check_lanes(vector_min(vec0, vec1), expected, 0.0F);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_abs(values0[i]);
+		check_lanes(vector_abs(vec0), expected, 0.0F);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = -values0[i];
+		check_lanes(vector_neg(vec0), expected, 0.0F);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = 1.0F / values1[i];
+		check_lanes(vector_reciprocal(vec1), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_sqrt(scalar_abs(values0[i]));
+		check_lanes(vector_sqrt(vector_abs(vec0)), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = (values0[i] * values1[i]) + values2[i];
+		check_lanes(vector_mul_add(vec0, vec1, vec2), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = (values0[i] * 2.5F) + values2[i];
+		check_lanes(vector_mul_add(vec0, 2.5F, vec2), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values2[i] - (values0[i] * values1[i]);
+		check_lanes(vector_neg_mul_sub(vec0, vec1, vec2), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values2[i] - (values0[i] * 2.5F);
+		check_lanes(vector_neg_mul_sub(vec0, 2.5F, vec2), expected, threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_lerp(values0[i], values1[i], 0.33F);
+		check_lanes(vector_lerp(vec0, vec1, 0.33F), expected, threshold);
+
+		check_lanes(vector_lerp(vec0, vec1, 0.0F), values0, 0.0F);
+		check_lanes(vector_lerp(vec0, vec1, 1.0F), values1, 0.0F);
+	}
+
+	{
+		CHECK(mask_all_true(vector_less_equal(vec0, vec0)));
+		CHECK(mask_all_true(vector_greater_equal(vec0, vec0)));
+		CHECK(!mask_any_true(vector_less_than(vec0, vec0)));
+		CHECK(!mask_any_true(vector_greater_than(vec0, vec0)));
+		CHECK(mask_any_true(vector_less_than(vec0, vec1)));
+		CHECK(!mask_all_true(vector_less_than(vec0, vec1)));
+		CHECK(mask_get_bits(vector_less_equal(vec0, vec0)) == 0xFFU);
+		CHECK(mask_get_bits(vector_less_than(vec0, vec0)) == 0x00U);
+		CHECK(mask_get_bits(vector_less_than(vec0, vec1)) == 0x2DU);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] < values1[i] ? values0[i] : values2[i];
+		check_lanes(vector_select(vector_less_than(vec0, vec1), vec0, vec2), expected, 0.0F);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] <= values1[i] ? values0[i] : values2[i];
+		check_lanes(vector_select(vector_less_equal(vec0, vec1), vec0, vec2), expected, 0.0F);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] > values1[i] ? values0[i] : values2[i];
+		check_lanes(vector_select(vector_greater_than(vec0, vec1), vec0, vec2), expected, 0.0F);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = values0[i] >= values1[i] ? values0[i] : values2[i];
+		check_lanes(vector_select(vector_greater_equal(vec0, vec1), vec0, vec2), expected, 0.0F);
+	}
+
+	{
+		const float trig_threshold = 1.0E-5F;
+		const float acos_values[8] = { -1.0F, -0.75F, -0.134F, 0.0F, 0.134F, 0.5F, 0.999F, 1.0F };
+		const vector8f acos_vec = vector8_load(&acos_values[0]);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_acos(acos_values[i]);
+		check_lanes(vector_acos(acos_vec), expected, trig_threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_atan(values0[i]);
+		check_lanes(vector_atan(vec0), expected, trig_threshold);
+
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_atan2(values0[i], values1[i]);
+		check_lanes(vector_atan2(vec0, vec1), expected, trig_threshold);
+
+		// Zero inputs along each axis
+		const float zero_y[8] = { 0.0F, 1.0F, -1.0F, 0.0F, 0.0F, 2.0F, -2.0F, 0.5F };
+		const float zero_x[8] = { 0.0F, 0.0F, 0.0F, 1.0F, -1.0F, -3.0F, -3.0F, 0.0F };
+		for (uint32_t i = 0; i < 8; ++i) expected[i] = scalar_atan2(zero_y[i], zero_x[i]);
+		check_lanes(vector_atan2(vector8_load(&zero_y[0]), vector8_load(&zero_x[0])), expected, trig_threshold);
+	}
+}
+
+TEST_CASE("vector3x8f math", "[math][vector8]")
+{
+	const float threshold = 1.0E-5F;
+
+	float x[8];
+	float y[8];
+	float z[8];
+	float other_x[8];
+	float other_y[8];
+	float other_z[8];
+	for (uint32_t i = 0; i < 8; ++i)
+	{
+		x[i] = float(i) - 3.5F;
+		y[i] = float(i) * 0.75F + 1.0F;
+		z[i] = 2.0F - float(i) * 0.5F;
+		other_x[i] = float(i) * 0.25F;
+		other_y[i] = -1.0F - float(i);
+		other_z[i] = 0.5F + float(i) * 0.125F;
+	}
+
+	const vector3x8f vec0 = vector3x8_load(const_float3f_soa{ x, y, z }, 0);
+	const vector3x8f vec1 = vector3x8_load(const_float3f_soa{ other_x, other_y, other_z }, 0);
+
+	float out_x[8];
+	float out_y[8];
+	float out_z[8];
+	const float3f_soa output = { out_x, out_y, out_z };
+
+	const vector3x8f results[] =
+	{
+		vector_add(vec0, vec1),
+		vector_sub(vec0, vec1),
+		vector_mul(vec0, vec1),
+		vector_mul(vec0, vec1.x),
+		vector_cross3(vec0, vec1),
+		vector_normalize3(vec0),
+		vector_select(vector_less_than(vec0.x, vec1.x), vec0, vec1),
+	};
+
+	for (uint32_t result_index = 0; result_index < rtm_impl::get_array_size(results); ++result_index)
+	{
+		vector_store(results[result_index], output, 0);
+
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			const vector4f v0 = vector_set(x[i], y[i], z[i]);
+			const vector4f v1 = vector_set(other_x[i], other_y[i], other_z[i]);
+
+			vector4f expected;
+			switch (result_index)
+			{
+			case 0:		expected = vector_add(v0, v1); break;
+			case 1:		expected = vector_sub(v0, v1); break;
+			case 2:		expected = vector_mul(v0, v1); break;
+			case 3:		expected = vector_mul(v0, other_x[i]); break;
+			case 4:		expected = vector_cross3(v0, v1); break;
+			case 5:		expected = vector_normalize3(v0); break;
+			default:	expected = x[i] < other_x[i] ? v0 : v1; break;
+			}
+
+			CHECK(vector_all_near_equal3(vector_set(out_x[i], out_y[i], out_z[i]), expected, threshold));
+		}
+	}
+
+	float lanes[8];
+	vector_store(vector_dot3(vec0, vec1), &lanes[0]);
+	for (uint32_t i = 0; i < 8; ++i)
+		CHECK(scalar_near_equal(lanes[i], float(vector_dot3(vector_set(x[i], y[i], z[i]), vector_set(other_x[i], other_y[i], other_z[i]))), threshold));
+
+	vector_store(vector_length3(vec0), &lanes[0]);
+	for (uint32_t i = 0; i < 8; ++i)
+		CHECK(scalar_near_equal(lanes[i], float(vector_length3(vector_set(x[i], y[i], z[i]))), threshold));
+
+	vector_store(vector_length_squared3(vec0), &lanes[0]);
+	for (uint32_t i = 0; i < 8; ++i)
+		CHECK(scalar_near_equal(lanes[i], float(vector_length_squared3(vector_set(x[i], y[i], z[i]))), threshold));
+}
+
+TEST_CASE("vector8f transpose", "[math][vector8]")
+{
+	{
+		float values[8][8];
+		for (uint32_t row = 0; row < 8; ++row)
+			for (uint32_t column = 0; column < 8; ++column)
+				values[row][column] = float(row * 8 + column);
+
+		vector8f rows[8];
+		for (uint32_t row = 0; row < 8; ++row)
+			rows[row] = vector8_load(&values[row][0]);
+
+		vector_transpose8x8(rows[0], rows[1], rows[2], rows[3], rows[4], rows[5], rows[6], rows[7]);
+
+		for (uint32_t row = 0; row < 8; ++row)
+		{
+			float expected[8];
+			for (uint32_t column = 0; column < 8; ++column)
+				expected[column] = values[column][row];
+
+			check_lanes(rows[row], expected, 0.0F);
+		}
+	}
+
+	{
+		float3f input[8];
+		for (uint32_t i = 0; i < 8; ++i)
+			input[i] = float3f{ float(i), float(i) * 2.0F - 5.0F, float(i) * 0.5F + 3.0F };
+
+		const vector3x8f vec = vector3x8_load(&input[0]);
+
+		float out_x[8];
+		float out_y[8];
+		float out_z[8];
+		vector_store(vec, float3f_soa{ out_x, out_y, out_z }, 0);
+
+		float3f output[8];
+		vector_store(vec, &output[0]);
+
+		for (uint32_t i = 0; i < 8; ++i)
+		{
+			CHECK(out_x[i] == input[i].x);
+			CHECK(out_y[i] == input[i].y);
+			CHECK(out_z[i] == input[i].z);
+			CHECK(output[i].x == input[i].x);
+			CHECK(output[i].y == input[i].y);
+			CHECK(output[i].z == input[i].z);
+		}
+	}
+}
@@ -0,0 +1,99 @@
+import argparse
+import json
+import re
+import sys
+
+# Compares two rtm_accuracy JSON result files (e.g. as written by 'make.py -accuracy')
+# and flags the functions whose error increased or whose throughput regressed.
+# Errors are deterministic for a given ISA, any increase is flagged, timings are
+# noisier and are only flagged above a threshold.
+
+def parse_argv():
+	parser = argparse.ArgumentParser(add_help=False)
+
+	parser.add_argument('baseline', help='JSON results used as the reference')
+	parser.add_argument('contender', help='JSON results compared against the baseline')
+
+	options = parser.add_argument_group(title='Options')
+	options.add_argument('-threshold', type=float, help='Relative ns/op increase in percent above which a function is flagged, defaults to 10')
+	options.add_argument('-filter', help='Only compare functions whose names match this regex')
+	options.add_argument('-all', dest='show_all', action='store_true', help='Show every function instead of only the flagged ones')
+	options.add_argument('-help', action='help', help='Display this usage information')
+
+	parser.set_defaults(threshold=10.0, filter=None, show_all=False)
+
+	return parser.parse_args()
+
+def load_results(filename, name_filter):
+	with open(filename, 'r') as f:
+		data = json.load(f)
+
+	results = {}
+	for entry in data['cases']:
+		if name_filter and not re.search(name_filter, entry['name']):
+			continue
+
+		results[entry['name']] = entry
+
+	return data.get('context', {}), results
+
+def get_context_label(context):
+	return '{} (fma: {}, deterministic: {}, {} samples)'.format(context.get('rtm_isa', 'unknown'), context.get('rtm_fma', False), context.get('rtm_deterministic', False), context.get('num_samples', 0))
+
+if __name__ == "__main__":
+	args = parse_argv()
+
+	baseline_context, baseline = load_results(args.baseline, args.filter)
+	contender_context, contender = load_results(args.contender, args.filter)
+
+	print('Baseline:  {}'.format(get_context_label(baseline_context)))
+	print('Contender: {}'.format(get_context_label(contender_context)))
+	if baseline_context.get('rtm_isa') != contender_context.get('rtm_isa'):
+		print('Warning: the instruction sets differ, the errors are not expected to match')
+	if baseline_context.get('num_samples') != contender_context.get('num_samples'):
+		print('Warning: the number of samples differs, the errors are not expected to match')
+	print('ns/op threshold: {}%'.format(args.threshold))
+	print('')
+
+	names = sorted(set(baseline.keys()) & set(contender.keys()))
+	name_width = max([len(name) for name in names] + [len('Function')])
+
+	print('{}  {:>22}  {:>24}  {:>20}'.format('Function'.ljust(name_width), 'Max ULP', 'Max abs error', 'ns/op'))
+
+	num_regressions = 0
+	for name in names:
+		old_entry = baseline[name]
+		new_entry = contender[name]
+
+		status = []
+		if new_entry['max_ulp'] > old_entry['max_ulp']:
+			status.append('ULP')
+		if new_entry['max_abs_error'] > old_entry['max_abs_error']:
+			status.append('abs error')
+
+		time_change = (new_entry['ns_per_op'] - old_entry['ns_per_op']) / old_entry['ns_per_op'] * 100.0
+		if time_change >= args.threshold:
+			status.append('ns/op')
+
+		if status:
+			num_regressions += 1
+
+		if status or args.show_all:
+			print('{}  {:>10.4g} -> {:<9.4g}  {:>11.4g} -> {:<10.4g}  {:>7.3f} -> {:<7.3f}  {}'.format(name.ljust(name_width),
+				old_entry['max_ulp'], new_entry['max_ulp'],
+				old_entry['max_abs_error'], new_entry['max_abs_error'],
+				old_entry['ns_per_op'], new_entry['ns_per_op'],
+				'REGRESSION ({})'.format(', '.join(status)) if status else ''))
+
+	missing = sorted(set(baseline.keys()) - set(contender.keys()))
+	added = sorted(set(contender.keys()) - set(baseline.keys()))
+
+	print('')
+	print('{} functions compared, {} regressions'.format(len(names), num_regressions))
+	if missing:
+		print('Missing from the contender: {}'.format(', '.join(missing)))
+	if added:
+		print('New in the contender: {}'.format(', '.join(added)))
+
+	# Allows scripts to detect regressions
+	sys.exit(1 if num_regressions != 0 else 0)
@@ -0,0 +1,161 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <rtm/math.h>
+
+#include <cstdint>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+// The accuracy harness sweeps a function over a dense range of inputs, compares
+// every output with a double precision reference, and times the sweep.
+// A case fails when its error exceeds its budget.
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// The maximum error allowed for a case.
+//////////////////////////////////////////////////////////////////////////
+struct accuracy_budget
+{
+	// Maximum error in units in the last place of the reference, see accuracy_case::ulp_floor
+	double max_ulp;
+
+	// Maximum absolute error
+	double max_abs_error;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// A function to sweep. Every sample has 'num_inputs' input floats and 'num_outputs'
+// output floats, stored contiguously. The number of samples is a multiple of 4.
+//////////////////////////////////////////////////////////////////////////
+struct accuracy_case
+{
+	const char* name;
+
+	uint32_t num_inputs;
+	uint32_t num_outputs;
+
+	// Fills the inputs of every sample
+	void (*generate_inputs)(float* inputs, uint32_t num_samples);
+
+	// The function measured, it is also the one timed
+	void (*evaluate)(const float* inputs, float* outputs, uint32_t num_samples);
+
+	// The reference, evaluated in double precision from the same float inputs
+	void (*evaluate_reference)(const float* inputs, double* outputs, uint32_t num_samples);
+
+	// The ULP error is measured in the binade of the reference or of this value, whichever is larger.
+	// Outputs that should be zero (e.g. sin(pi)) otherwise dominate the ULP error of
+	// range reduced functions, their absolute error is reported instead.
+	double ulp_floor;
+
+	accuracy_budget budget;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// The measured error and throughput of a case.
+//////////////////////////////////////////////////////////////////////////
+struct accuracy_result
+{
+	double max_ulp;
+	double max_abs_error;
+	double ns_per_op;
+
+	// The index of the first sample with the largest ULP error
+	uint32_t worst_sample_index;
+
+	bool within_budget;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Fills 'num_samples' inputs spread evenly over [min_value, max_value].
+// 'stride' and 'offset' interleave several inputs per sample.
+//////////////////////////////////////////////////////////////////////////
+inline void accuracy_sweep(float* inputs, uint32_t num_samples, float min_value, float max_value, uint32_t stride = 1, uint32_t offset = 0)
+{
+	const double step = (double(max_value) - double(min_value)) / double(num_samples - 1);
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		inputs[sample_index * stride + offset] = float(double(min_value) + step * double(sample_index));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Fills 'num_samples' inputs with uniformly distributed values in [min_value, max_value].
+// The sequence is deterministic for a given seed on every platform.
+//////////////////////////////////////////////////////////////////////////
+inline void accuracy_random(float* inputs, uint32_t num_samples, float min_value, float max_value, uint32_t seed, uint32_t stride = 1, uint32_t offset = 0)
+{
+	// Scramble the seed so that similar seeds produce unrelated sequences
+	uint32_t state = seed * 0x9E3779B9U;
+	state ^= state >> 16;
+	state *= 0x85EBCA6BU;
+	state ^= state >> 13;
+	state = state != 0 ? state : 1;
+
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+	{
+		// Xorshift32
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+
+		const double alpha = double(state >> 8) / double(1 << 24);
+		inputs[sample_index * stride + offset] = float(double(min_value) + (double(max_value) - double(min_value)) * alpha);
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Returns the name of the instruction set the harness was compiled with.
+//////////////////////////////////////////////////////////////////////////
+inline const char* accuracy_isa_name()
+{
+#if defined(RTM_AVX512_INTRINSICS)
+	return "avx512";
+#elif defined(RTM_AVX2_INTRINSICS)
+	return "avx2";
+#elif defined(RTM_AVX_INTRINSICS)
+	return "avx";
+#elif defined(RTM_SSE4_INTRINSICS)
+	return "sse4";
+#elif defined(RTM_SSE2_INTRINSICS)
+	return "sse2";
+#elif defined(RTM_SVE_INTRINSICS)
+	return "sve";
+#elif defined(RTM_NEON64_INTRINSICS)
+	return "neon64";
+#elif defined(RTM_NEON_INTRINSICS)
+	return "neon";
+#elif defined(RTM_WASM_SIMD128_INTRINSICS)
+	return "wasm_simd128";
+#else
+	return "scalar";
+#endif
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Every source file registers its cases.
+//////////////////////////////////////////////////////////////////////////
+void register_transcendental_cases(std::vector<accuracy_case>& cases);
+void register_quat_cases(std::vector<accuracy_case>& cases);
@@ -0,0 +1,275 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "accuracy_harness.h"
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cmath>
+
+using namespace rtm;
+
+namespace
+{
+	struct quat_reference
+	{
+		double x;
+		double y;
+		double z;
+		double w;
+	};
+
+	quat_reference quat_reference_load(const float* input)
+	{
+		return quat_reference{ double(input[0]), double(input[1]), double(input[2]), double(input[3]) };
+	}
+
+	void quat_reference_store(const quat_reference& input, double* output)
+	{
+		output[0] = input.x;
+		output[1] = input.y;
+		output[2] = input.z;
+		output[3] = input.w;
+	}
+
+	double quat_reference_dot(const quat_reference& lhs, const quat_reference& rhs)
+	{
+		return (lhs.x * rhs.x) + (lhs.y * rhs.y) + (lhs.z * rhs.z) + (lhs.w * rhs.w);
+	}
+
+	quat_reference quat_reference_normalize(const quat_reference& input)
+	{
+		const double inv_length = 1.0 / std::sqrt(quat_reference_dot(input, input));
+		return quat_reference{ input.x * inv_length, input.y * inv_length, input.z * inv_length, input.w * inv_length };
+	}
+
+	// Same convention as quat_mul: the lhs rotation is applied first
+	quat_reference quat_reference_mul(const quat_reference& lhs, const quat_reference& rhs)
+	{
+		return quat_reference
+		{
+			(rhs.w * lhs.x) + (rhs.x * lhs.w) + (rhs.y * lhs.z) - (rhs.z * lhs.y),
+			(rhs.w * lhs.y) - (rhs.x * lhs.z) + (rhs.y * lhs.w) + (rhs.z * lhs.x),
+			(rhs.w * lhs.z) + (rhs.x * lhs.y) - (rhs.y * lhs.x) + (rhs.z * lhs.w),
+			(rhs.w * lhs.w) - (rhs.x * lhs.x) - (rhs.y * lhs.y) - (rhs.z * lhs.z),
+		};
+	}
+
+	// Fills 'num_quats' normalized rotations, 'stride' floats apart
+	void generate_rotations(float* inputs, uint32_t num_quats, uint32_t seed, uint32_t stride, uint32_t offset)
+	{
+		for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			accuracy_random(inputs, num_quats, -1.0F, 1.0F, seed + component_index * 0x9E3779B9U, stride, offset + component_index);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			float* quat = inputs + quat_index * stride + offset;
+			const quat_reference rotation = quat_reference_normalize(quat_reference_load(quat));
+			quat[0] = float(rotation.x);
+			quat[1] = float(rotation.y);
+			quat[2] = float(rotation.z);
+			quat[3] = float(rotation.w);
+		}
+	}
+
+	// Samples hold an unnormalized quaternion
+	void generate_unnormalized(float* inputs, uint32_t num_samples)
+	{
+		for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			accuracy_random(inputs, num_samples, -4.0F, 4.0F, 0x1234567U + component_index, 4, component_index);
+	}
+
+	void normalize_evaluate(const float* inputs, float* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			quat_store(quat_normalize(quat_load(inputs + sample_index * 4)), outputs + sample_index * 4);
+	}
+
+	void normalize_reference(const float* inputs, double* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			quat_reference_store(quat_reference_normalize(quat_reference_load(inputs + sample_index * 4)), outputs + sample_index * 4);
+	}
+
+	// Samples hold [lhs, rhs]
+	void generate_rotation_pairs(float* inputs, uint32_t num_samples)
+	{
+		generate_rotations(inputs, num_samples, 0x2468ACEU, 8, 0);
+		generate_rotations(inputs, num_samples, 0x13579BDU, 8, 4);
+	}
+
+	void mul_evaluate(const float* inputs, float* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+			quat_store(quat_mul(quat_load(inputs + sample_index * 8 + 0), quat_load(inputs + sample_index * 8 + 4)), outputs + sample_index * 4);
+	}
+
+	void mul_reference(const float* inputs, double* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const quat_reference lhs = quat_reference_load(inputs + sample_index * 8 + 0);
+			const quat_reference rhs = quat_reference_load(inputs + sample_index * 8 + 4);
+			quat_reference_store(quat_reference_mul(lhs, rhs), outputs + sample_index * 4);
+		}
+	}
+
+	// Samples hold [rotation, vector]
+	void generate_rotation_vectors(float* inputs, uint32_t num_samples)
+	{
+		generate_rotations(inputs, num_samples, 0xBADC0DEU, 8, 0);
+		for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			accuracy_random(inputs, num_samples, -100.0F, 100.0F, 0xC0FFEEU + component_index, 8, 4 + component_index);
+	}
+
+	void mul_vector3_evaluate(const float* inputs, float* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const quatf rotation = quat_load(inputs + sample_index * 8 + 0);
+			const vector4f vector = vector_load3(inputs + sample_index * 8 + 4);
+			vector_store3(quat_mul_vector3(vector, rotation), outputs + sample_index * 3);
+		}
+	}
+
+	void mul_vector3_reference(const float* inputs, double* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			// conjugate(rotation) * vector * rotation with our multiplication order
+			const quat_reference rotation = quat_reference_load(inputs + sample_index * 8 + 0);
+			const quat_reference conjugate = quat_reference{ -rotation.x, -rotation.y, -rotation.z, rotation.w };
+			const float* vector = inputs + sample_index * 8 + 4;
+			const quat_reference vector_quat{ double(vector[0]), double(vector[1]), double(vector[2]), 0.0 };
+			const quat_reference result = quat_reference_mul(quat_reference_mul(conjugate, vector_quat), rotation);
+
+			outputs[sample_index * 3 + 0] = result.x;
+			outputs[sample_index * 3 + 1] = result.y;
+			outputs[sample_index * 3 + 2] = result.z;
+		}
+	}
+
+	// Samples hold [start, end, alpha]
+	void generate_interpolation(float* inputs, uint32_t num_samples)
+	{
+		generate_rotations(inputs, num_samples, 0xFACADEU, 12, 0);
+		generate_rotations(inputs, num_samples, 0xDECADEU, 12, 4);
+		accuracy_random(inputs, num_samples, 0.0F, 1.0F, 0xA1FA0U, 12, 8);
+	}
+
+	template<rotation_interpolation interpolation>
+	void interpolate_evaluate(const float* inputs, float* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float* sample = inputs + sample_index * 12;
+			const quatf start = quat_load(sample + 0);
+			const quatf end = quat_load(sample + 4);
+			const float alpha = sample[8];
+
+			quatf result;
+			if (interpolation == rotation_interpolation::lerp)
+				result = quat_lerp(start, end, alpha);
+			else if (interpolation == rotation_interpolation::slerp_fast)
+				result = quat_slerp_fast(start, end, alpha);
+			else
+				result = quat_slerp(start, end, alpha);
+
+			quat_store(result, outputs + sample_index * 4);
+		}
+	}
+
+	void lerp_reference(const float* inputs, double* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float* sample = inputs + sample_index * 12;
+			const quat_reference start = quat_reference_load(sample + 0);
+			quat_reference end = quat_reference_load(sample + 4);
+			const double alpha = double(sample[8]);
+
+			if (quat_reference_dot(start, end) < 0.0)
+				end = quat_reference{ -end.x, -end.y, -end.z, -end.w };
+
+			const quat_reference result
+			{
+				start.x + (end.x - start.x) * alpha,
+				start.y + (end.y - start.y) * alpha,
+				start.z + (end.z - start.z) * alpha,
+				start.w + (end.w - start.w) * alpha,
+			};
+			quat_reference_store(quat_reference_normalize(result), outputs + sample_index * 4);
+		}
+	}
+
+	void slerp_reference(const float* inputs, double* outputs, uint32_t num_samples)
+	{
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			const float* sample = inputs + sample_index * 12;
+			const quat_reference start = quat_reference_load(sample + 0);
+			quat_reference end = quat_reference_load(sample + 4);
+			const double alpha = double(sample[8]);
+
+			double cos_angle = quat_reference_dot(start, end);
+			if (cos_angle < 0.0)
+			{
+				end = quat_reference{ -end.x, -end.y, -end.z, -end.w };
+				cos_angle = -cos_angle;
+			}
+
+			double start_weight = 1.0 - alpha;
+			double end_weight = alpha;
+			if (cos_angle < 1.0)
+			{
+				const double angle = std::acos(cos_angle);
+				const double inv_sin_angle = 1.0 / std::sin(angle);
+				start_weight = std::sin((1.0 - alpha) * angle) * inv_sin_angle;
+				end_weight = std::sin(alpha * angle) * inv_sin_angle;
+			}
+
+			const quat_reference result
+			{
+				(start.x * start_weight) + (end.x * end_weight),
+				(start.y * start_weight) + (end.y * end_weight),
+				(start.z * start_weight) + (end.z * end_weight),
+				(start.w * start_weight) + (end.w * end_weight),
+			};
+			quat_reference_store(result, outputs + sample_index * 4);
+		}
+	}
+}
+
+void register_quat_cases(std::vector<accuracy_case>& cases)
+{
+	// The outputs are unit quaternions and vectors up to 100 in length, the ULP error
+	// is measured against the largest component magnitude
+	cases.push_back({ "quat_normalize", 4, 4, generate_unnormalized, normalize_evaluate, normalize_reference, 1.0, { 8.0, 1.0E-6 } });
+	cases.push_back({ "quat_mul", 8, 4, generate_rotation_pairs, mul_evaluate, mul_reference, 1.0, { 8.0, 1.0E-6 } });
+	cases.push_back({ "quat_mul_vector3", 8, 3, generate_rotation_vectors, mul_vector3_evaluate, mul_vector3_reference, 100.0, { 8.0, 1.0E-4 } });
+	cases.push_back({ "quat_lerp", 12, 4, generate_interpolation, interpolate_evaluate<rotation_interpolation::lerp>, lerp_reference, 1.0, { 8.0, 1.0E-6 } });
+	cases.push_back({ "quat_slerp", 12, 4, generate_interpolation, interpolate_evaluate<rotation_interpolation::slerp>, slerp_reference, 1.0, { 512.0, 6.0E-5 } });
+	cases.push_back({ "quat_slerp_fast", 12, 4, generate_interpolation, interpolate_evaluate<rotation_interpolation::slerp_fast>, slerp_reference, 1.0, { 512.0, 6.0E-5 } });
+}
@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "accuracy_harness.h"
+
+#include <rtm/scalarf.h>
+#include <rtm/trig_table.h>
+#include <rtm/vector4f.h>
+
+#include <cmath>
+
+using namespace rtm;
+
+// Evaluates a float function on every sample, one at a time
+#define ACCURACY_SCALAR(function) \
+	[](const float* inputs, float* outputs, uint32_t num_samples) \
+	{ \
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index) \
+			outputs[sample_index] = function(inputs[sample_index]); \
+	}
+
+// Evaluates a vector4f function on every sample, 4 at a time
+#define ACCURACY_VECTOR(function) \
+	[](const float* inputs, float* outputs, uint32_t num_samples) \
+	{ \
+		for (uint32_t sample_index = 0; sample_index < num_samples; sample_index += 4) \
+			vector_store(function(vector_load(inputs + sample_index)), outputs + sample_index); \
+	}
+
+// Evaluates the double precision reference on every sample
+#define ACCURACY_REFERENCE(function) \
+	[](const float* inputs, double* outputs, uint32_t num_samples) \
+	{ \
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index) \
+			outputs[sample_index] = function(double(inputs[sample_index])); \
+	}
+
+// Samples of atan2 hold [y, x]
+static void atan2_scalar(const float* inputs, float* outputs, uint32_t num_samples)
+{
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		outputs[sample_index] = scalar_atan2(inputs[sample_index * 2 + 0], inputs[sample_index * 2 + 1]);
+}
+
+static void atan2_scalar_fast(const float* inputs, float* outputs, uint32_t num_samples)
+{
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		outputs[sample_index] = scalar_atan2_fast(inputs[sample_index * 2 + 0], inputs[sample_index * 2 + 1]);
+}
+
+static void atan2_scalar_table(const float* inputs, float* outputs, uint32_t num_samples)
+{
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		outputs[sample_index] = scalar_atan2_table(inputs[sample_index * 2 + 0], inputs[sample_index * 2 + 1]);
+}
+
+template<bool is_fast>
+static void atan2_vector(const float* inputs, float* outputs, uint32_t num_samples)
+{
+	for (uint32_t sample_index = 0; sample_index < num_samples; sample_index += 4)
+	{
+		// Deinterleave the [y, x] pairs of 4 samples
+		const vector4f y0_x0_y1_x1 = vector_load(inputs + sample_index * 2 + 0);
+		const vector4f y2_x2_y3_x3 = vector_load(inputs + sample_index * 2 + 4);
+		const vector4f y = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(y0_x0_y1_x1, y2_x2_y3_x3);
+		const vector4f x = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(y0_x0_y1_x1, y2_x2_y3_x3);
+
+		vector_store(is_fast ? vector_atan2_fast(y, x) : vector_atan2(y, x), outputs + sample_index);
+	}
+}
+
+static void atan2_vector_table(const float* inputs, float* outputs, uint32_t num_samples)
+{
+	for (uint32_t sample_index = 0; sample_index < num_samples; sample_index += 4)
+	{
+		const vector4f y0_x0_y1_x1 = vector_load(inputs + sample_index * 2 + 0);
+		const vector4f y2_x2_y3_x3 = vector_load(inputs + sample_index * 2 + 4);
+		const vector4f y = vector_mix<mix4::x, mix4::z, mix4::a, mix4::c>(y0_x0_y1_x1, y2_x2_y3_x3);
+		const vector4f x = vector_mix<mix4::y, mix4::w, mix4::b, mix4::d>(y0_x0_y1_x1, y2_x2_y3_x3);
+
+		vector_store(vector_atan2_table(y, x), outputs + sample_index);
+	}
+}
+
+static void atan2_reference(const float* inputs, double* outputs, uint32_t num_samples)
+{
+	for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		outputs[sample_index] = std::atan2(double(inputs[sample_index * 2 + 0]), double(inputs[sample_index * 2 + 1]));
+}
+
+static void generate_angles(float* inputs, uint32_t num_samples) { accuracy_sweep(inputs, num_samples, -100.0F, 100.0F); }
+static void generate_tan_angles(float* inputs, uint32_t num_samples) { accuracy_sweep(inputs, num_samples, -1.5F, 1.5F); }
+static void generate_unit_range(float* inputs, uint32_t num_samples) { accuracy_sweep(inputs, num_samples, -1.0F, 1.0F); }
+static void generate_atan_range(float* inputs, uint32_t num_samples) { accuracy_sweep(inputs, num_samples, -1000.0F, 1000.0F); }
+static void generate_exp_range(float* inputs, uint32_t num_samples) { accuracy_sweep(inputs, num_samples, -80.0F, 80.0F); }
+static void generate_log_range(float* inputs, uint32_t num_samples) { accuracy_sweep(inputs, num_samples, 1.0E-4F, 1.0E4F); }
+
+static void generate_atan2_pairs(float* inputs, uint32_t num_samples)
+{
+	accuracy_random(inputs, num_samples, -100.0F, 100.0F, 0x12345678U, 2, 0);
+	accuracy_random(inputs, num_samples, -100.0F, 100.0F, 0x87654321U, 2, 1);
+}
+
+void register_transcendental_cases(std::vector<accuracy_case>& cases)
+{
+	// Budgets are about twice the error measured on x64 from SSE2 to AVX2 with FMA, and without SIMD
+	cases.push_back({ "scalar_sin", 1, 1, generate_angles, ACCURACY_SCALAR(scalar_sin), ACCURACY_REFERENCE(std::sin), 1.0, { 96.0, 1.2E-5 } });
+	cases.push_back({ "scalar_sin_fast", 1, 1, generate_angles, ACCURACY_SCALAR(scalar_sin_fast), ACCURACY_REFERENCE(std::sin), 1.0, { 256.0, 3.0E-5 } });
+	cases.push_back({ "vector_sin", 1, 1, generate_angles, ACCURACY_VECTOR(vector_sin), ACCURACY_REFERENCE(std::sin), 1.0, { 96.0, 1.2E-5 } });
+	cases.push_back({ "vector_sin_fast", 1, 1, generate_angles, ACCURACY_VECTOR(vector_sin_fast), ACCURACY_REFERENCE(std::sin), 1.0, { 256.0, 3.0E-5 } });
+
+	cases.push_back({ "scalar_cos", 1, 1, generate_angles, ACCURACY_SCALAR(scalar_cos), ACCURACY_REFERENCE(std::cos), 1.0, { 96.0, 1.2E-5 } });
+	cases.push_back({ "scalar_cos_fast", 1, 1, generate_angles, ACCURACY_SCALAR(scalar_cos_fast), ACCURACY_REFERENCE(std::cos), 1.0, { 256.0, 3.0E-5 } });
+	cases.push_back({ "vector_cos", 1, 1, generate_angles, ACCURACY_VECTOR(vector_cos), ACCURACY_REFERENCE(std::cos), 1.0, { 96.0, 1.2E-5 } });
+	cases.push_back({ "vector_cos_fast", 1, 1, generate_angles, ACCURACY_VECTOR(vector_cos_fast), ACCURACY_REFERENCE(std::cos), 1.0, { 256.0, 3.0E-5 } });
+
+	cases.push_back({ "scalar_tan", 1, 1, generate_tan_angles, ACCURACY_SCALAR(scalar_tan), ACCURACY_REFERENCE(std::tan), 1.0, { 32.0, 3.0E-5 } });
+	cases.push_back({ "scalar_tan_fast", 1, 1, generate_tan_angles, ACCURACY_SCALAR(scalar_tan_fast), ACCURACY_REFERENCE(std::tan), 1.0, { 2048.0, 2.5E-3 } });
+	cases.push_back({ "vector_tan", 1, 1, generate_tan_angles, ACCURACY_VECTOR(vector_tan), ACCURACY_REFERENCE(std::tan), 1.0, { 32.0, 3.0E-5 } });
+	cases.push_back({ "vector_tan_fast", 1, 1, generate_tan_angles, ACCURACY_VECTOR(vector_tan_fast), ACCURACY_REFERENCE(std::tan), 1.0, { 2048.0, 2.5E-3 } });
+
+	cases.push_back({ "scalar_asin", 1, 1, generate_unit_range, ACCURACY_SCALAR(scalar_asin), ACCURACY_REFERENCE(std::asin), 1.0, { 8.0, 2.0E-6 } });
+	cases.push_back({ "scalar_asin_fast", 1, 1, generate_unit_range, ACCURACY_SCALAR(scalar_asin_fast), ACCURACY_REFERENCE(std::asin), 1.0, { 1024.0, 2.0E-4 } });
+	cases.push_back({ "vector_asin", 1, 1, generate_unit_range, ACCURACY_VECTOR(vector_asin), ACCURACY_REFERENCE(std::asin), 1.0, { 8.0, 2.0E-6 } });
+	cases.push_back({ "vector_asin_fast", 1, 1, generate_unit_range, ACCURACY_VECTOR(vector_asin_fast), ACCURACY_REFERENCE(std::asin), 1.0, { 1024.0, 2.0E-4 } });
+
+	cases.push_back({ "scalar_acos", 1, 1, generate_unit_range, ACCURACY_SCALAR(scalar_acos), ACCURACY_REFERENCE(std::acos), 1.0, { 8.0, 2.0E-6 } });
+	cases.push_back({ "scalar_acos_fast", 1, 1, generate_unit_range, ACCURACY_SCALAR(scalar_acos_fast), ACCURACY_REFERENCE(std::acos), 1.0, { 1024.0, 2.0E-4 } });
+	cases.push_back({ "vector_acos", 1, 1, generate_unit_range, ACCURACY_VECTOR(vector_acos), ACCURACY_REFERENCE(std::acos), 1.0, { 8.0, 2.0E-6 } });
+	cases.push_back({ "vector_acos_fast", 1, 1, generate_unit_range, ACCURACY_VECTOR(vector_acos_fast), ACCURACY_REFERENCE(std::acos), 1.0, { 1024.0, 2.0E-4 } });
+
+	cases.push_back({ "scalar_atan", 1, 1, generate_atan_range, ACCURACY_SCALAR(scalar_atan), ACCURACY_REFERENCE(std::atan), 1.0, { 8.0, 2.0E-6 } });
+	cases.push_back({ "scalar_atan_fast", 1, 1, generate_atan_range, ACCURACY_SCALAR(scalar_atan_fast), ACCURACY_REFERENCE(std::atan), 1.0, { 1024.0, 2.0E-4 } });
+	cases.push_back({ "vector_atan", 1, 1, generate_atan_range, ACCURACY_VECTOR(vector_atan), ACCURACY_REFERENCE(std::atan), 1.0, { 8.0, 2.0E-6 } });
+	cases.push_back({ "vector_atan_fast", 1, 1, generate_atan_range, ACCURACY_VECTOR(vector_atan_fast), ACCURACY_REFERENCE(std::atan), 1.0, { 1024.0, 2.0E-4 } });
+
+	cases.push_back({ "scalar_atan2", 2, 1, generate_atan2_pairs, atan2_scalar, atan2_reference, 1.0, { 8.0, 2.0E-6 } });
+	cases.push_back({ "scalar_atan2_fast", 2, 1, generate_atan2_pairs, atan2_scalar_fast, atan2_reference, 1.0, { 1024.0, 2.0E-4 } });
+	cases.push_back({ "vector_atan2", 2, 1, generate_atan2_pairs, atan2_vector<false>, atan2_reference, 1.0, { 8.0, 2.0E-6 } });
+	cases.push_back({ "vector_atan2_fast", 2, 1, generate_atan2_pairs, atan2_vector<true>, atan2_reference, 1.0, { 1024.0, 2.0E-4 } });
+
+	// Linear interpolation of lookup tables
+	cases.push_back({ "scalar_sin_table", 1, 1, generate_angles, ACCURACY_SCALAR(scalar_sin_table), ACCURACY_REFERENCE(std::sin), 1.0, { 1280.0, 1.5E-4 } });
+	cases.push_back({ "vector_sin_table", 1, 1, generate_angles, ACCURACY_VECTOR(vector_sin_table), ACCURACY_REFERENCE(std::sin), 1.0, { 1280.0, 1.5E-4 } });
+	cases.push_back({ "scalar_cos_table", 1, 1, generate_angles, ACCURACY_SCALAR(scalar_cos_table), ACCURACY_REFERENCE(std::cos), 1.0, { 1280.0, 1.5E-4 } });
+	cases.push_back({ "vector_cos_table", 1, 1, generate_angles, ACCURACY_VECTOR(vector_cos_table), ACCURACY_REFERENCE(std::cos), 1.0, { 1280.0, 1.5E-4 } });
+	cases.push_back({ "scalar_atan2_table", 2, 1, generate_atan2_pairs, atan2_scalar_table, atan2_reference, 1.0, { 340.0, 5.0E-5 } });
+	cases.push_back({ "vector_atan2_table", 2, 1, generate_atan2_pairs, atan2_vector_table, atan2_reference, 1.0, { 340.0, 5.0E-5 } });
+
+	// The outputs span many binades, the ULP error is relative
+	cases.push_back({ "vector_exp", 1, 1, generate_exp_range, ACCURACY_VECTOR(vector_exp), ACCURACY_REFERENCE(std::exp), 1.0E-30, { 8.0, 1.0E30 } });
+	cases.push_back({ "vector_log", 1, 1, generate_log_range, ACCURACY_VECTOR(vector_log), ACCURACY_REFERENCE(std::log), 1.0, { 8.0, 2.0E-6 } });
+}
@@ -0,0 +1,217 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "accuracy_harness.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+// Usage: rtm_accuracy [-filter=<substring>] [-samples=<count>] [-output=<results.json>]
+// Returns 1 when a case exceeds its error budget.
+
+namespace
+{
+	constexpr uint32_t k_default_num_samples = 1 << 20;
+	constexpr uint32_t k_num_timing_runs = 5;
+
+	// Returns the size of one unit in the last place of a float in the binade of the input
+	double get_ulp_size(double value, double ulp_floor)
+	{
+		const double magnitude = std::max(std::fabs(value), ulp_floor);
+		int exponent;
+		std::frexp(magnitude, &exponent);
+
+		// frexp returns a mantissa in [0.5, 1.0), a float has 23 explicit mantissa bits
+		return std::ldexp(1.0, exponent - 24);
+	}
+
+	accuracy_result run_case(const accuracy_case& test_case, uint32_t num_samples)
+	{
+		std::vector<float> inputs(size_t(num_samples) * test_case.num_inputs + 4);
+		std::vector<float> outputs(size_t(num_samples) * test_case.num_outputs + 4);
+		std::vector<double> reference_outputs(size_t(num_samples) * test_case.num_outputs);
+
+		test_case.generate_inputs(inputs.data(), num_samples);
+		test_case.evaluate_reference(inputs.data(), reference_outputs.data(), num_samples);
+
+		// The fastest run is the least disturbed by the rest of the system
+		double best_duration_ns = 1.0E30;
+		for (uint32_t run_index = 0; run_index < k_num_timing_runs; ++run_index)
+		{
+			const auto start_time = std::chrono::steady_clock::now();
+			test_case.evaluate(inputs.data(), outputs.data(), num_samples);
+			const auto end_time = std::chrono::steady_clock::now();
+
+			best_duration_ns = std::min(best_duration_ns, std::chrono::duration<double, std::nano>(end_time - start_time).count());
+		}
+
+		accuracy_result result = {};
+		result.ns_per_op = best_duration_ns / double(num_samples);
+
+		for (uint32_t sample_index = 0; sample_index < num_samples; ++sample_index)
+		{
+			for (uint32_t output_index = 0; output_index < test_case.num_outputs; ++output_index)
+			{
+				const size_t offset = size_t(sample_index) * test_case.num_outputs + output_index;
+				const double reference = reference_outputs[offset];
+				const double value = double(outputs[offset]);
+
+				// NaN or infinity where the reference is finite is as wrong as it gets
+				const double abs_error = std::isfinite(value) || !std::isfinite(reference) ? std::fabs(value - reference) : 1.0E30;
+				const double ulp_error = abs_error / get_ulp_size(reference, test_case.ulp_floor);
+
+				result.max_abs_error = std::max(result.max_abs_error, abs_error);
+				if (ulp_error > result.max_ulp)
+				{
+					result.max_ulp = ulp_error;
+					result.worst_sample_index = sample_index;
+				}
+			}
+		}
+
+		result.within_budget = result.max_ulp <= test_case.budget.max_ulp && result.max_abs_error <= test_case.budget.max_abs_error;
+		return result;
+	}
+
+	void write_json(const char* filename, uint32_t num_samples, const std::vector<accuracy_case>& cases, const std::vector<accuracy_result>& results)
+	{
+		std::FILE* file = std::fopen(filename, "w");
+		if (file == nullptr)
+		{
+			std::printf("Failed to open '%s' for writing\n", filename);
+			return;
+		}
+
+		std::fprintf(file, "{\n");
+		std::fprintf(file, "  \"context\": {\n");
+		std::fprintf(file, "    \"rtm_isa\": \"%s\",\n", accuracy_isa_name());
+#if defined(RTM_IMPL_USE_FMA)
+		std::fprintf(file, "    \"rtm_fma\": true,\n");
+#else
+		std::fprintf(file, "    \"rtm_fma\": false,\n");
+#endif
+#if defined(RTM_DETERMINISTIC)
+		std::fprintf(file, "    \"rtm_deterministic\": true,\n");
+#else
+		std::fprintf(file, "    \"rtm_deterministic\": false,\n");
+#endif
+		std::fprintf(file, "    \"num_samples\": %u\n", num_samples);
+		std::fprintf(file, "  },\n");
+		std::fprintf(file, "  \"cases\": [\n");
+
+		for (size_t case_index = 0; case_index < cases.size(); ++case_index)
+		{
+			const accuracy_case& test_case = cases[case_index];
+			const accuracy_result& result = results[case_index];
+
+			std::fprintf(file, "    {\n");
+			std::fprintf(file, "      \"name\": \"%s\",\n", test_case.name);
+			std::fprintf(file, "      \"max_ulp\": %.17g,\n", result.max_ulp);
+			std::fprintf(file, "      \"max_abs_error\": %.17g,\n", result.max_abs_error);
+			std::fprintf(file, "      \"ns_per_op\": %.17g,\n", result.ns_per_op);
+			std::fprintf(file, "      \"budget_max_ulp\": %.17g,\n", test_case.budget.max_ulp);
+			std::fprintf(file, "      \"budget_max_abs_error\": %.17g,\n", test_case.budget.max_abs_error);
+			std::fprintf(file, "      \"within_budget\": %s\n", result.within_budget ? "true" : "false");
+			std::fprintf(file, "    }%s\n", case_index + 1 < cases.size() ? "," : "");
+		}
+
+		std::fprintf(file, "  ]\n");
+		std::fprintf(file, "}\n");
+		std::fclose(file);
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	const char* filter = nullptr;
+	const char* output_filename = nullptr;
+	uint32_t num_samples = k_default_num_samples;
+
+	for (int arg_index = 1; arg_index < argc; ++arg_index)
+	{
+		const char* arg = argv[arg_index];
+		if (std::strncmp(arg, "-filter=", 8) == 0)
+			filter = arg + 8;
+		else if (std::strncmp(arg, "-output=", 8) == 0)
+			output_filename = arg + 8;
+		else if (std::strncmp(arg, "-samples=", 9) == 0)
+			num_samples = uint32_t(std::strtoul(arg + 9, nullptr, 10));
+		else
+		{
+			std::printf("Usage: rtm_accuracy [-filter=<substring>] [-samples=<count>] [-output=<results.json>]\n");
+			return 1;
+		}
+	}
+
+	// Vector cases evaluate 4 samples at a time
+	num_samples = std::max<uint32_t>((num_samples + 3) & ~3U, 4);
+
+	std::vector<accuracy_case> all_cases;
+	register_transcendental_cases(all_cases);
+	register_quat_cases(all_cases);
+
+	std::vector<accuracy_case> cases;
+	for (const accuracy_case& test_case : all_cases)
+	{
+		if (filter == nullptr || std::strstr(test_case.name, filter) != nullptr)
+			cases.push_back(test_case);
+	}
+
+	std::printf("ISA: %s, %u samples per case\n\n", accuracy_isa_name(), num_samples);
+	std::printf("%-20s %12s %12s %12s %12s %10s\n", "Case", "Max ULP", "Budget", "Max abs", "Budget", "ns/op");
+
+	std::vector<accuracy_result> results;
+	uint32_t num_failures = 0;
+	for (const accuracy_case& test_case : cases)
+	{
+		const accuracy_result result = run_case(test_case, num_samples);
+		results.push_back(result);
+
+		std::printf("%-20s %12.4g %12.4g %12.4g %12.4g %10.3f%s\n", test_case.name, result.max_ulp, test_case.budget.max_ulp, result.max_abs_error, test_case.budget.max_abs_error, result.ns_per_op, result.within_budget ? "" : "  OVER BUDGET");
+
+		if (!result.within_budget)
+		{
+			std::printf("    worst sample %u:", result.worst_sample_index);
+			// Inputs are regenerated for the report, they are deterministic
+			std::vector<float> inputs(size_t(num_samples) * test_case.num_inputs + 4);
+			test_case.generate_inputs(inputs.data(), num_samples);
+			for (uint32_t input_index = 0; input_index < test_case.num_inputs; ++input_index)
+				std::printf(" %.9g", inputs[size_t(result.worst_sample_index) * test_case.num_inputs + input_index]);
+			std::printf("\n");
+
+			num_failures++;
+		}
+	}
+
+	if (output_filename != nullptr)
+		write_json(output_filename, num_samples, cases, results);
+
+	std::printf("\n%u cases, %u over budget\n", uint32_t(cases.size()), num_failures);
+	return num_failures != 0 ? 1 : 0;
+}
@@ -0,0 +1,75 @@
+import argparse
+import re
+import sys
+
+from compare_results import load_results
+
+# Compares RTM with the other math libraries benchmarked with 'make.py -bench -bench_competitors'.
+# Their benchmarks are named bm_lib_<operation>_<library>, the throughput of every library is
+# reported relative to RTM: above 1.0x, the library is faster. Pass one result file per ISA
+# (e.g. with and without '-avx2') to see how the gap changes with the instruction set.
+
+LIBRARIES = [ ('rtm', 'RTM'), ('dxm', 'DirectXMath'), ('glm', 'GLM'), ('eigen', 'Eigen') ]
+BENCHMARK_PATTERN = re.compile(r'^bm_lib_(\w+)_({})$'.format('|'.join(library for library, _ in LIBRARIES)))
+
+def parse_argv():
+	parser = argparse.ArgumentParser(add_help=False)
+
+	parser.add_argument('results', nargs='+', help='JSON results, one file per ISA')
+
+	options = parser.add_argument_group(title='Options')
+	options.add_argument('-help', action='help', help='Display this usage information')
+
+	return parser.parse_args()
+
+def get_isa_label(context):
+	simd = context.get('rtm_simd', 'unknown')
+	if context.get('rtm_fma', False):
+		simd += ' + fma'
+	device = context.get('rtm_device', context.get('host_name', 'unknown'))
+	return '{} on {} ({})'.format(simd, device, context.get('rtm_cpu', 'unknown cpu'))
+
+def print_comparison(filename):
+	context, results = load_results(filename, 'items_per_second', r'^bm_lib_')
+
+	# operation -> library -> items per second
+	operations = {}
+	for name, value in results.items():
+		match = BENCHMARK_PATTERN.match(name)
+		if match:
+			operations.setdefault(match.group(1), {})[match.group(2)] = value
+
+	print('ISA: {}'.format(get_isa_label(context)))
+	if not operations:
+		print('No library benchmarks found, build with -bench_competitors')
+		print('')
+		return
+
+	found_libraries = [ (library, label) for library, label in LIBRARIES if any(library in values for values in operations.values()) ]
+	operation_width = max([len(operation) for operation in operations] + [len('Operation')])
+
+	print('{}  {:>12}'.format('Operation'.ljust(operation_width), 'RTM') + ''.join('  {:>12}'.format(label) for library, label in found_libraries if library != 'rtm'))
+	for operation in sorted(operations.keys()):
+		values = operations[operation]
+		rtm_value = values.get('rtm')
+
+		# One item is one operation, the RTM throughput is in millions per second
+		line = '{}  {:>12}'.format(operation.ljust(operation_width), '{:.1f} M/s'.format(rtm_value / 1.0e6) if rtm_value else '-')
+		for library, _ in found_libraries:
+			if library == 'rtm':
+				continue
+
+			value = values.get(library)
+			line += '  {:>12}'.format('{:.2f}x'.format(value / rtm_value) if value and rtm_value else '-')
+
+		print(line)
+
+	print('')
+
+if __name__ == "__main__":
+	args = parse_argv()
+
+	for filename in args.results:
+		print_comparison(filename)
+
+	sys.exit(0)
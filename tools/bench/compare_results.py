@@ -0,0 +1,128 @@
+import argparse
+import json
+import re
+import sys
+
+# Compares two Google Benchmark JSON result files (e.g. as written by 'make.py -bench')
+# and flags the benchmarks that regressed. The two runs can come from different
+# RTM releases on the same device or from different devices.
+
+TIME_UNIT_TO_NS = { 'ns': 1.0, 'us': 1.0e3, 'ms': 1.0e6, 's': 1.0e9 }
+
+def parse_argv():
+	parser = argparse.ArgumentParser(add_help=False)
+
+	parser.add_argument('baseline', help='JSON results used as the reference')
+	parser.add_argument('contender', help='JSON results compared against the baseline')
+
+	options = parser.add_argument_group(title='Options')
+	options.add_argument('-metric', choices=['cpu_time', 'real_time', 'items_per_second'], help='Defaults to cpu_time')
+	options.add_argument('-threshold', type=float, help='Relative change in percent above which a benchmark is flagged, defaults to 5')
+	options.add_argument('-filter', help='Only compare benchmarks whose names match this regex')
+	options.add_argument('-all', dest='show_all', action='store_true', help='Show every benchmark instead of only the flagged ones')
+	options.add_argument('-help', action='help', help='Display this usage information')
+
+	parser.set_defaults(metric='cpu_time', threshold=5.0, filter=None, show_all=False)
+
+	return parser.parse_args()
+
+def get_metric_value(entry, metric):
+	if metric == 'items_per_second':
+		return entry.get('items_per_second')
+
+	value = entry.get(metric)
+	if value is None:
+		return None
+
+	# Normalize everything to nanoseconds in case the time units differ between runs
+	return value * TIME_UNIT_TO_NS.get(entry.get('time_unit', 'ns'), 1.0)
+
+def load_results(filename, metric, name_filter):
+	with open(filename, 'r') as f:
+		data = json.load(f)
+
+	# When benchmarks were repeated, only the median aggregate is kept as it is the most stable
+	has_aggregates = any(entry.get('run_type') == 'aggregate' for entry in data['benchmarks'])
+
+	results = {}
+	for entry in data['benchmarks']:
+		if entry.get('error_occurred', False):
+			continue
+
+		if has_aggregates:
+			if entry.get('run_type') != 'aggregate' or entry.get('aggregate_name') != 'median':
+				continue
+			name = entry['run_name']
+		else:
+			name = entry['name']
+
+		if name_filter and not re.search(name_filter, name):
+			continue
+
+		value = get_metric_value(entry, metric)
+		if value is not None and value > 0.0:
+			results[name] = value
+
+	return data.get('context', {}), results
+
+def get_context_label(context):
+	device = context.get('rtm_device', context.get('host_name', 'unknown'))
+	return '{} ({}, {})'.format(device, context.get('rtm_cpu', 'unknown cpu'), context.get('date', 'unknown date'))
+
+def format_value(value, metric):
+	if metric == 'items_per_second':
+		return '{:.4g}/s'.format(value)
+	return '{:.4g} ns'.format(value)
+
+if __name__ == "__main__":
+	args = parse_argv()
+
+	baseline_context, baseline = load_results(args.baseline, args.metric, args.filter)
+	contender_context, contender = load_results(args.contender, args.metric, args.filter)
+
+	print('Baseline:  {}'.format(get_context_label(baseline_context)))
+	print('Contender: {}'.format(get_context_label(contender_context)))
+	print('Metric: {}, threshold: {}%'.format(args.metric, args.threshold))
+	print('')
+
+	higher_is_better = args.metric == 'items_per_second'
+	names = sorted(set(baseline.keys()) & set(contender.keys()))
+	name_width = max([len(name) for name in names] + [len('Benchmark')])
+
+	print('{}  {:>14}  {:>14}  {:>9}'.format('Benchmark'.ljust(name_width), 'Baseline', 'Contender', 'Change'))
+
+	num_regressions = 0
+	num_improvements = 0
+	for name in names:
+		old_value = baseline[name]
+		new_value = contender[name]
+
+		# A positive change is always an improvement regardless of the metric
+		if higher_is_better:
+			change = (new_value - old_value) / old_value * 100.0
+		else:
+			change = (old_value - new_value) / old_value * 100.0
+
+		status = ''
+		if change <= -args.threshold:
+			status = 'REGRESSION'
+			num_regressions += 1
+		elif change >= args.threshold:
+			status = 'improvement'
+			num_improvements += 1
+
+		if status or args.show_all:
+			print('{}  {:>14}  {:>14}  {:>+8.1f}%  {}'.format(name.ljust(name_width), format_value(old_value, args.metric), format_value(new_value, args.metric), change, status))
+
+	missing = sorted(set(baseline.keys()) - set(contender.keys()))
+	added = sorted(set(contender.keys()) - set(baseline.keys()))
+
+	print('')
+	print('{} benchmarks compared, {} regressions, {} improvements'.format(len(names), num_regressions, num_improvements))
+	if missing:
+		print('Missing from the contender: {}'.format(', '.join(missing)))
+	if added:
+		print('New in the contender: {}'.format(', '.join(added)))
+
+	# Allows scripts to detect regressions
+	sys.exit(1 if num_regressions != 0 else 0)
@@ -0,0 +1,95 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdint>
+
+// The same operations are benchmarked with RTM and with the other math libraries found at
+// configure time. Every library converts the same inputs into its own types before the timed
+// loop and writes its results into an array of its own types, the benchmarks are named
+// bm_lib_<operation>_<library> for tools/bench/compare_libraries.py.
+
+constexpr uint32_t k_num_competitor_elements = 256;
+
+struct competitor_inputs
+{
+	float quats_a[k_num_competitor_elements][4];		// [x, y, z, w], normalized
+	float quats_b[k_num_competitor_elements][4];
+	float vectors[k_num_competitor_elements][4];		// [x, y, z, 0]
+	float matrices[k_num_competitor_elements][16];		// Row major affine transforms, the translation in the last row
+	float angles[k_num_competitor_elements][4];
+	float alphas[k_num_competitor_elements];
+};
+
+inline const competitor_inputs& get_competitor_inputs()
+{
+	static competitor_inputs inputs;
+	static bool is_initialized = false;
+
+	if (!is_initialized)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		{
+			const float value = float(element_index);
+
+			const float half_angle_a = value * 0.013F;
+			const float axis_a_length = std::sqrt(1.0F + value * value * 0.0001F + 4.0F);
+			inputs.quats_a[element_index][0] = std::sin(half_angle_a) * 1.0F / axis_a_length;
+			inputs.quats_a[element_index][1] = std::sin(half_angle_a) * value * 0.01F / axis_a_length;
+			inputs.quats_a[element_index][2] = std::sin(half_angle_a) * 2.0F / axis_a_length;
+			inputs.quats_a[element_index][3] = std::cos(half_angle_a);
+
+			const float half_angle_b = 1.3F - value * 0.007F;
+			inputs.quats_b[element_index][0] = 0.0F;
+			inputs.quats_b[element_index][1] = std::sin(half_angle_b);
+			inputs.quats_b[element_index][2] = 0.0F;
+			inputs.quats_b[element_index][3] = std::cos(half_angle_b);
+
+			inputs.vectors[element_index][0] = value;
+			inputs.vectors[element_index][1] = 1.0F - value;
+			inputs.vectors[element_index][2] = value * 0.5F;
+			inputs.vectors[element_index][3] = 0.0F;
+
+			// A rotation around Z scaled by a factor and translated, always invertible
+			const float angle = value * 0.021F;
+			const float scale = 1.0F + value * 0.01F;
+			float* matrix = inputs.matrices[element_index];
+			matrix[0] = std::cos(angle) * scale;	matrix[1] = std::sin(angle) * scale;	matrix[2] = 0.0F;	matrix[3] = 0.0F;
+			matrix[4] = -std::sin(angle) * scale;	matrix[5] = std::cos(angle) * scale;	matrix[6] = 0.0F;	matrix[7] = 0.0F;
+			matrix[8] = 0.0F;						matrix[9] = 0.0F;						matrix[10] = scale;	matrix[11] = 0.0F;
+			matrix[12] = value;						matrix[13] = -value;					matrix[14] = 2.0F;	matrix[15] = 1.0F;
+
+			for (uint32_t lane_index = 0; lane_index < 4; ++lane_index)
+				inputs.angles[element_index][lane_index] = (value + float(lane_index) * 0.25F) * 0.05F - 6.0F;
+
+			inputs.alphas[element_index] = float(element_index % 17) / 16.0F;
+		}
+
+		is_initialized = true;
+	}
+
+	return inputs;
+}
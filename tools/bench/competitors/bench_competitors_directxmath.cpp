@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_competitors.h"
+
+#include <benchmark/benchmark.h>
+
+#if defined(RTM_NO_INTRINSICS)
+	// Compare against the scalar code of DirectXMath as well
+	#define _XM_NO_INTRINSICS_
+#endif
+
+#include <DirectXMath.h>
+
+#include <cstdint>
+
+using namespace DirectX;
+
+// DirectXMath uses row vectors and the [x, y, z, w] quaternion layout like RTM
+static XMVECTOR load_dxm_vector(const float* input)
+{
+	return XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(input));
+}
+
+static XMMATRIX load_dxm_matrix(const float* input)
+{
+	return XMLoadFloat4x4(reinterpret_cast<const XMFLOAT4X4*>(input));
+}
+
+static void bm_lib_quat_mul_dxm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	XMVECTOR lhs[k_num_competitor_elements];
+	XMVECTOR rhs[k_num_competitor_elements];
+	XMVECTOR output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		lhs[element_index] = load_dxm_vector(inputs.quats_a[element_index]);
+		rhs[element_index] = load_dxm_vector(inputs.quats_b[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&lhs[0]);
+	benchmark::DoNotOptimize(&rhs[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = XMQuaternionMultiply(lhs[element_index], rhs[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_mul_dxm);
+
+static void bm_lib_quat_rotate_dxm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	XMVECTOR rotations[k_num_competitor_elements];
+	XMVECTOR vectors[k_num_competitor_elements];
+	XMVECTOR output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		rotations[element_index] = load_dxm_vector(inputs.quats_a[element_index]);
+		vectors[element_index] = load_dxm_vector(inputs.vectors[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&rotations[0]);
+	benchmark::DoNotOptimize(&vectors[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = XMVector3Rotate(vectors[element_index], rotations[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_rotate_dxm);
+
+static void bm_lib_quat_slerp_dxm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	XMVECTOR starts[k_num_competitor_elements];
+	XMVECTOR ends[k_num_competitor_elements];
+	XMVECTOR output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		starts[element_index] = load_dxm_vector(inputs.quats_a[element_index]);
+		ends[element_index] = load_dxm_vector(inputs.quats_b[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&starts[0]);
+	benchmark::DoNotOptimize(&ends[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = XMQuaternionSlerp(starts[element_index], ends[element_index], inputs.alphas[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_slerp_dxm);
+
+static void bm_lib_matrix_mul_dxm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	XMMATRIX lhs[k_num_competitor_elements];
+	XMMATRIX rhs[k_num_competitor_elements];
+	XMMATRIX output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		lhs[element_index] = load_dxm_matrix(inputs.matrices[element_index]);
+		rhs[element_index] = load_dxm_matrix(inputs.matrices[k_num_competitor_elements - element_index - 1]);
+	}
+
+	benchmark::DoNotOptimize(&lhs[0]);
+	benchmark::DoNotOptimize(&rhs[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = XMMatrixMultiply(lhs[element_index], rhs[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_matrix_mul_dxm);
+
+static void bm_lib_matrix_inverse_dxm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	XMMATRIX matrices[k_num_competitor_elements];
+	XMMATRIX output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		matrices[element_index] = load_dxm_matrix(inputs.matrices[element_index]);
+
+	benchmark::DoNotOptimize(&matrices[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = XMMatrixInverse(nullptr, matrices[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_matrix_inverse_dxm);
+
+static void bm_lib_sincos_dxm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	XMVECTOR angles[k_num_competitor_elements];
+	XMVECTOR sines[k_num_competitor_elements];
+	XMVECTOR cosines[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		angles[element_index] = load_dxm_vector(inputs.angles[element_index]);
+
+	benchmark::DoNotOptimize(&angles[0]);
+	benchmark::DoNotOptimize(&sines[0]);
+	benchmark::DoNotOptimize(&cosines[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			XMVectorSinCos(&sines[element_index], &cosines[element_index], angles[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	// Every element is 4 angles
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_sincos_dxm);
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_competitors.h"
+
+#include <benchmark/benchmark.h>
+
+#if defined(RTM_NO_INTRINSICS)
+	// Compare against the scalar code of Eigen as well
+	#define EIGEN_DONT_VECTORIZE
+#endif
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <Eigen/LU>
+
+#include <cstdint>
+
+// Eigen quaternions are constructed from [w, x, y, z]
+static Eigen::Quaternionf load_eigen_quat(const float* input)
+{
+	return Eigen::Quaternionf(input[3], input[0], input[1], input[2]);
+}
+
+// Eigen matrices are column major by default, the same values are read as rows
+static Eigen::Matrix4f load_eigen_matrix(const float* input)
+{
+	return Eigen::Map<const Eigen::Matrix<float, 4, 4, Eigen::RowMajor>>(input);
+}
+
+static void bm_lib_quat_mul_eigen(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	Eigen::Quaternionf lhs[k_num_competitor_elements];
+	Eigen::Quaternionf rhs[k_num_competitor_elements];
+	Eigen::Quaternionf output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		lhs[element_index] = load_eigen_quat(inputs.quats_a[element_index]);
+		rhs[element_index] = load_eigen_quat(inputs.quats_b[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&lhs[0]);
+	benchmark::DoNotOptimize(&rhs[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = rhs[element_index] * lhs[element_index];
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_mul_eigen);
+
+static void bm_lib_quat_rotate_eigen(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	Eigen::Quaternionf rotations[k_num_competitor_elements];
+	Eigen::Vector3f vectors[k_num_competitor_elements];
+	Eigen::Vector3f output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		rotations[element_index] = load_eigen_quat(inputs.quats_a[element_index]);
+		vectors[element_index] = Eigen::Vector3f(inputs.vectors[element_index][0], inputs.vectors[element_index][1], inputs.vectors[element_index][2]);
+	}
+
+	benchmark::DoNotOptimize(&rotations[0]);
+	benchmark::DoNotOptimize(&vectors[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = rotations[element_index] * vectors[element_index];
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_rotate_eigen);
+
+static void bm_lib_quat_slerp_eigen(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	Eigen::Quaternionf starts[k_num_competitor_elements];
+	Eigen::Quaternionf ends[k_num_competitor_elements];
+	Eigen::Quaternionf output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		starts[element_index] = load_eigen_quat(inputs.quats_a[element_index]);
+		ends[element_index] = load_eigen_quat(inputs.quats_b[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&starts[0]);
+	benchmark::DoNotOptimize(&ends[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = starts[element_index].slerp(inputs.alphas[element_index], ends[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_slerp_eigen);
+
+static void bm_lib_matrix_mul_eigen(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	Eigen::Matrix4f lhs[k_num_competitor_elements];
+	Eigen::Matrix4f rhs[k_num_competitor_elements];
+	Eigen::Matrix4f output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		lhs[element_index] = load_eigen_matrix(inputs.matrices[element_index]);
+		rhs[element_index] = load_eigen_matrix(inputs.matrices[k_num_competitor_elements - element_index - 1]);
+	}
+
+	benchmark::DoNotOptimize(&lhs[0]);
+	benchmark::DoNotOptimize(&rhs[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index].noalias() = lhs[element_index] * rhs[element_index];
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_matrix_mul_eigen);
+
+static void bm_lib_matrix_inverse_eigen(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	Eigen::Matrix4f matrices[k_num_competitor_elements];
+	Eigen::Matrix4f output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		matrices[element_index] = load_eigen_matrix(inputs.matrices[element_index]);
+
+	benchmark::DoNotOptimize(&matrices[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = matrices[element_index].inverse();
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_matrix_inverse_eigen);
+
+static void bm_lib_sincos_eigen(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	Eigen::Array4f angles[k_num_competitor_elements];
+	Eigen::Array4f sines[k_num_competitor_elements];
+	Eigen::Array4f cosines[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		angles[element_index] = Eigen::Map<const Eigen::Array4f>(inputs.angles[element_index]);
+
+	benchmark::DoNotOptimize(&angles[0]);
+	benchmark::DoNotOptimize(&sines[0]);
+	benchmark::DoNotOptimize(&cosines[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		{
+			sines[element_index] = angles[element_index].sin();
+			cosines[element_index] = angles[element_index].cos();
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	// Every element is 4 angles
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_sincos_eigen);
@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_competitors.h"
+
+#include <benchmark/benchmark.h>
+
+#if !defined(RTM_NO_INTRINSICS)
+	// GLM only uses SIMD intrinsics when asked to
+	#define GLM_FORCE_INTRINSICS
+	#define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES
+#endif
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cstdint>
+
+// GLM quaternions are constructed from [w, x, y, z]
+static glm::quat load_glm_quat(const float* input)
+{
+	return glm::quat(input[3], input[0], input[1], input[2]);
+}
+
+static void bm_lib_quat_mul_glm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	glm::quat lhs[k_num_competitor_elements];
+	glm::quat rhs[k_num_competitor_elements];
+	glm::quat output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		lhs[element_index] = load_glm_quat(inputs.quats_a[element_index]);
+		rhs[element_index] = load_glm_quat(inputs.quats_b[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&lhs[0]);
+	benchmark::DoNotOptimize(&rhs[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = rhs[element_index] * lhs[element_index];
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_mul_glm);
+
+static void bm_lib_quat_rotate_glm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	glm::quat rotations[k_num_competitor_elements];
+	glm::vec3 vectors[k_num_competitor_elements];
+	glm::vec3 output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		rotations[element_index] = load_glm_quat(inputs.quats_a[element_index]);
+		vectors[element_index] = glm::make_vec3(inputs.vectors[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&rotations[0]);
+	benchmark::DoNotOptimize(&vectors[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = rotations[element_index] * vectors[element_index];
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_rotate_glm);
+
+static void bm_lib_quat_slerp_glm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	glm::quat starts[k_num_competitor_elements];
+	glm::quat ends[k_num_competitor_elements];
+	glm::quat output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		starts[element_index] = load_glm_quat(inputs.quats_a[element_index]);
+		ends[element_index] = load_glm_quat(inputs.quats_b[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&starts[0]);
+	benchmark::DoNotOptimize(&ends[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = glm::slerp(starts[element_index], ends[element_index], inputs.alphas[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_slerp_glm);
+
+static void bm_lib_matrix_mul_glm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	// GLM matrices are column major, the same values are read as columns
+	glm::mat4 lhs[k_num_competitor_elements];
+	glm::mat4 rhs[k_num_competitor_elements];
+	glm::mat4 output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		lhs[element_index] = glm::make_mat4(inputs.matrices[element_index]);
+		rhs[element_index] = glm::make_mat4(inputs.matrices[k_num_competitor_elements - element_index - 1]);
+	}
+
+	benchmark::DoNotOptimize(&lhs[0]);
+	benchmark::DoNotOptimize(&rhs[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = rhs[element_index] * lhs[element_index];
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_matrix_mul_glm);
+
+static void bm_lib_matrix_inverse_glm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	glm::mat4 matrices[k_num_competitor_elements];
+	glm::mat4 output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		matrices[element_index] = glm::make_mat4(inputs.matrices[element_index]);
+
+	benchmark::DoNotOptimize(&matrices[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = glm::inverse(matrices[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_matrix_inverse_glm);
+
+static void bm_lib_sincos_glm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	glm::vec4 angles[k_num_competitor_elements];
+	glm::vec4 sines[k_num_competitor_elements];
+	glm::vec4 cosines[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		angles[element_index] = glm::make_vec4(inputs.angles[element_index]);
+
+	benchmark::DoNotOptimize(&angles[0]);
+	benchmark::DoNotOptimize(&sines[0]);
+	benchmark::DoNotOptimize(&cosines[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		{
+			sines[element_index] = glm::sin(angles[element_index]);
+			cosines[element_index] = glm::cos(angles[element_index]);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	// Every element is 4 angles
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_sincos_glm);
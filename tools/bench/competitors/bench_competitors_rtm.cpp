@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_competitors.h"
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix4x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static void bm_lib_quat_mul_rtm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	quatf lhs[k_num_competitor_elements];
+	quatf rhs[k_num_competitor_elements];
+	quatf output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		lhs[element_index] = quat_load(inputs.quats_a[element_index]);
+		rhs[element_index] = quat_load(inputs.quats_b[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&lhs[0]);
+	benchmark::DoNotOptimize(&rhs[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = quat_mul(lhs[element_index], rhs[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_mul_rtm);
+
+static void bm_lib_quat_rotate_rtm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	quatf rotations[k_num_competitor_elements];
+	vector4f vectors[k_num_competitor_elements];
+	vector4f output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		rotations[element_index] = quat_load(inputs.quats_a[element_index]);
+		vectors[element_index] = vector_load(inputs.vectors[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&rotations[0]);
+	benchmark::DoNotOptimize(&vectors[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = quat_mul_vector3(vectors[element_index], rotations[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_rotate_rtm);
+
+static void bm_lib_quat_slerp_rtm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	quatf starts[k_num_competitor_elements];
+	quatf ends[k_num_competitor_elements];
+	quatf output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		starts[element_index] = quat_load(inputs.quats_a[element_index]);
+		ends[element_index] = quat_load(inputs.quats_b[element_index]);
+	}
+
+	benchmark::DoNotOptimize(&starts[0]);
+	benchmark::DoNotOptimize(&ends[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = quat_slerp(starts[element_index], ends[element_index], inputs.alphas[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_quat_slerp_rtm);
+
+static matrix4x4f load_competitor_matrix(const float* input)
+{
+	return matrix_set(vector_load(input + 0), vector_load(input + 4), vector_load(input + 8), vector_load(input + 12));
+}
+
+static void bm_lib_matrix_mul_rtm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	matrix4x4f lhs[k_num_competitor_elements];
+	matrix4x4f rhs[k_num_competitor_elements];
+	matrix4x4f output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+	{
+		lhs[element_index] = load_competitor_matrix(inputs.matrices[element_index]);
+		rhs[element_index] = load_competitor_matrix(inputs.matrices[k_num_competitor_elements - element_index - 1]);
+	}
+
+	benchmark::DoNotOptimize(&lhs[0]);
+	benchmark::DoNotOptimize(&rhs[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = matrix_mul(lhs[element_index], rhs[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_matrix_mul_rtm);
+
+static void bm_lib_matrix_inverse_rtm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	matrix4x4f matrices[k_num_competitor_elements];
+	matrix4x4f output[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		matrices[element_index] = load_competitor_matrix(inputs.matrices[element_index]);
+
+	benchmark::DoNotOptimize(&matrices[0]);
+	benchmark::DoNotOptimize(&output[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			output[element_index] = matrix_inverse(matrices[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_matrix_inverse_rtm);
+
+static void bm_lib_sincos_rtm(benchmark::State& state)
+{
+	const competitor_inputs& inputs = get_competitor_inputs();
+
+	vector4f angles[k_num_competitor_elements];
+	vector4f sines[k_num_competitor_elements];
+	vector4f cosines[k_num_competitor_elements];
+	for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+		angles[element_index] = vector_load(inputs.angles[element_index]);
+
+	benchmark::DoNotOptimize(&angles[0]);
+	benchmark::DoNotOptimize(&sines[0]);
+	benchmark::DoNotOptimize(&cosines[0]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t element_index = 0; element_index < k_num_competitor_elements; ++element_index)
+			vector_sincos(angles[element_index], sines[element_index], cosines[element_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	// Every element is 4 angles
+	state.SetItemsProcessed(state.iterations() * k_num_competitor_elements);
+}
+
+BENCHMARK(bm_lib_sincos_rtm);
@@ -25,9 +25,11 @@
 #include <benchmark/benchmark.h>
 
 #include <android/log.h>
+#include <cstdio>
 #include <iostream>
 #include <jni.h>
 #include <streambuf>
+#include <string>
 
 // Inspired from https://stackoverflow.com/questions/8870174/is-stdcout-usable-in-android-ndk
 class androidbuf final : public std::streambuf
@@ -68,14 +70,29 @@ private:
 	char buffer[bufsize];
 };
 
-extern "C" jint Java_com_rtm_benchmark_MainActivity_runBenchmark(JNIEnv* env, jobject caller)
+extern "C" jint Java_com_rtm_benchmark_MainActivity_runBenchmark(JNIEnv* env, jobject caller, jstring output_path)
 {
 	std::cout.rdbuf(new androidbuf());
 
-	int argc = 0;
-	benchmark::Initialize(&argc, nullptr);
+	// The JSON results are written to a temporary file first and renamed once every benchmark ran.
+	// make.py waits for the final file to show up before pulling it back from the device.
+	const char* output_path_str = env->GetStringUTFChars(output_path, nullptr);
+	const std::string json_path(output_path_str);
+	env->ReleaseStringUTFChars(output_path, output_path_str);
 
+	const std::string tmp_json_path = json_path + ".tmp";
+	std::remove(json_path.c_str());
+
+	std::string out_arg = "--benchmark_out=" + tmp_json_path;
+	std::string out_format_arg = "--benchmark_out_format=json";
+	std::string exe_name = "rtm_bench";
+	char* argv[] = { &exe_name[0], &out_arg[0], &out_format_arg[0], nullptr };
+	int argc = 3;
+
+	benchmark::Initialize(&argc, argv);
+
+	// The output file is closed when this returns
 	benchmark::RunSpecifiedBenchmarks();
 
-	return 0;
+	return std::rename(tmp_json_path.c_str(), json_path.c_str()) == 0 ? 0 : -1;
 }
@@ -39,13 +39,16 @@ public class MainActivity extends Activity {
 
 		TextView resultTextView = new TextView(this);
 
-		int result = runBenchmark();
+		// Written to the external files directory so that it can be pulled with adb
+		String outputPath = getExternalFilesDir(null).getAbsolutePath() + "/rtm_bench.json";
+
+		int result = runBenchmark(outputPath);
 
 		if (result == 0)
-			resultTextView.setText("All benchmarks ran successfully!");
+			resultTextView.setText("All benchmarks ran successfully!\nResults written to: " + outputPath);
 
 		setContentView(resultTextView);
 	}
 
-	public native int runBenchmark();
+	public native int runBenchmark(String outputPath);
 }
@@ -22,8 +22,13 @@
 // SOFTWARE.
 ////////////////////////////////////////////////////////////////////////////////
 
+#include "../sources/bench_perf_counters.h"
+
 #include <benchmark/benchmark.h>
 
+#include <cstdio>
+#include <cstring>
+
 #ifdef _WIN32
 #include <conio.h>
 
@@ -32,6 +37,21 @@ extern "C" __declspec(dllimport) int __stdcall IsDebuggerPresent();
 
 int main(int argc, char* argv[])
 {
+	// Our own arguments are removed before Google Benchmark parses the others
+	int num_args = 0;
+	for (int arg_index = 0; arg_index < argc; ++arg_index)
+	{
+		if (std::strcmp(argv[arg_index], "--rtm_perf_counters") == 0)
+			bench_perf_counters_enabled() = true;
+		else
+			argv[num_args++] = argv[arg_index];
+	}
+
+	argc = num_args;
+
+	if (bench_perf_counters_enabled() && !bench_perf_counters::is_supported())
+		printf("Hardware performance counters are not available, they will not be reported\n");
+
 	benchmark::Initialize(&argc, argv);
 
 	benchmark::RunSpecifiedBenchmarks();
@@ -24,8 +24,24 @@
 
 #include <benchmark/benchmark.h>
 
+#include <cstdlib>
+#include <string>
+
 int main(int argc, char* argv[])
 {
+	// When launched without arguments, the JSON results are written in the Documents
+	// directory of the application container where they can be copied from the device
+	const char* home_dir = std::getenv("HOME");
+	std::string out_arg = std::string("--benchmark_out=") + (home_dir != nullptr ? home_dir : ".") + "/Documents/rtm_bench.json";
+	std::string out_format_arg = "--benchmark_out_format=json";
+	char* default_argv[] = { argv[0], &out_arg[0], &out_format_arg[0], nullptr };
+
+	if (argc <= 1)
+	{
+		argc = 3;
+		argv = default_argv;
+	}
+
 	benchmark::Initialize(&argc, argv);
 
 	benchmark::RunSpecifiedBenchmarks();
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/aabbf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/aabbf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Roughly the vertex count of a skinned character
+static constexpr uint32_t k_num_bound_points = 8192;
+
+static float3f g_bound_points[k_num_bound_points];
+
+static void fill_bound_points()
+{
+	for (uint32_t index = 0; index < k_num_bound_points; ++index)
+	{
+		const float value = float(index);
+		g_bound_points[index] = float3f{ scalar_sin(value * 0.37F), scalar_cos(value * 0.73F) * 2.0F, value * 0.001F };
+	}
+}
+
+static void bm_aabb_from_points_loop(benchmark::State& state)
+{
+	fill_bound_points();
+
+	for (auto _ : state)
+	{
+		// One point at a time, the reference for the batched version
+		vector4f min_point = vector_load3(&g_bound_points[0]);
+		vector4f max_point = min_point;
+		for (uint32_t index = 1; index < k_num_bound_points; ++index)
+		{
+			const vector4f point = vector_load3(&g_bound_points[index]);
+			min_point = vector_min(min_point, point);
+			max_point = vector_max(max_point, point);
+		}
+
+		aabbf bounds = aabb_from_min_max(min_point, max_point);
+		benchmark::DoNotOptimize(bounds);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bound_points);
+}
+
+BENCHMARK(bm_aabb_from_points_loop);
+
+static void bm_aabb_from_points(benchmark::State& state)
+{
+	fill_bound_points();
+
+	for (auto _ : state)
+	{
+		aabbf bounds = aabb_from_points(&g_bound_points[0], k_num_bound_points);
+		benchmark::DoNotOptimize(bounds);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bound_points);
+}
+
+BENCHMARK(bm_aabb_from_points);
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/archive.h>
+#include <rtm/batch/archive_file.h>
+#include <rtm/batch/qvvf.h>
+
+#include <cstdint>
+#include <cstdio>
+
+using namespace rtm;
+
+// A pose cache of 64 poses of 256 transforms, the first pose is used after loading
+constexpr uint32_t k_num_archive_poses = 64;
+constexpr uint32_t k_num_archive_pose_transforms = 256;
+constexpr uint32_t k_num_archive_transforms = k_num_archive_poses * k_num_archive_pose_transforms;
+
+static const char* k_bench_packed_filename = "rtm_bench_poses.bin";
+static const char* k_bench_archive_filename = "rtm_bench_poses.rtma";
+
+alignas(64) static qvvf s_bench_archive_transforms[k_num_archive_transforms];
+alignas(64) static qvvf s_bench_archive_output[k_num_archive_pose_transforms];
+alignas(64) static qvvf_packed s_bench_archive_packed[k_num_archive_transforms];
+alignas(64) static uint8_t s_bench_archive_buffer[k_num_archive_transforms * sizeof(qvvf) + 4096];
+
+// Writes the poses once as raw packed transforms and as an archive of one qvvf array per pose
+static bool write_bench_archive_files()
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_archive_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		s_bench_archive_transforms[transform_index] = qvv_set(quat_from_euler(value * 0.1F, 0.2F, value * 0.3F), vector_set(value, 1.0F, 2.0F), vector_set(1.0F));
+	}
+
+	qvv_store_array(s_bench_archive_transforms, s_bench_archive_packed, k_num_archive_transforms);
+
+	archive_writer writer(s_bench_archive_buffer, sizeof(s_bench_archive_buffer), k_num_archive_poses);
+	for (uint32_t pose_index = 0; pose_index < k_num_archive_poses; ++pose_index)
+		writer.add_qvvf_array(pose_index, s_bench_archive_transforms + pose_index * k_num_archive_pose_transforms, k_num_archive_pose_transforms);
+
+	const size_t archive_size = writer.finalize();
+
+	std::FILE* packed_file = std::fopen(k_bench_packed_filename, "wb");
+	std::FILE* archive_file = std::fopen(k_bench_archive_filename, "wb");
+	bool is_written = packed_file != nullptr && archive_file != nullptr;
+	is_written = is_written && std::fwrite(s_bench_archive_packed, sizeof(qvvf_packed), k_num_archive_transforms, packed_file) == k_num_archive_transforms;
+	is_written = is_written && std::fwrite(s_bench_archive_buffer, 1, archive_size, archive_file) == archive_size;
+
+	if (packed_file != nullptr)
+		std::fclose(packed_file);
+	if (archive_file != nullptr)
+		std::fclose(archive_file);
+
+	return is_written;
+}
+
+static bool are_bench_archive_files_written()
+{
+	static const bool is_written = write_bench_archive_files();
+	return is_written;
+}
+
+// Reads the whole file and converts every transform before the first pose is used
+static void bm_archive_load_convert(benchmark::State& state)
+{
+	if (!are_bench_archive_files_written())
+	{
+		state.SkipWithError("Failed to write the pose files");
+		return;
+	}
+
+	for (auto _ : state)
+	{
+		std::FILE* file = std::fopen(k_bench_packed_filename, "rb");
+		const size_t num_read = std::fread(s_bench_archive_packed, sizeof(qvvf_packed), k_num_archive_transforms, file);
+		std::fclose(file);
+
+		qvv_load_array(s_bench_archive_packed, s_bench_archive_transforms, uint32_t(num_read));
+		qvv_mul_aos(s_bench_archive_transforms, s_bench_archive_transforms, s_bench_archive_output, k_num_archive_pose_transforms);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_archive_transforms);
+}
+
+BENCHMARK(bm_archive_load_convert);
+
+// Maps the archive and uses the first pose in place, the other poses are never paged in
+static void bm_archive_load_mapped(benchmark::State& state)
+{
+	if (!are_bench_archive_files_written())
+	{
+		state.SkipWithError("Failed to write the pose files");
+		return;
+	}
+
+	for (auto _ : state)
+	{
+		archive_file file;
+		file.open(k_bench_archive_filename);
+
+		archive_reader reader;
+		reader.open(file.get_data(), file.get_size());
+
+		const qvvf* pose = reader.get_qvvf_array(reader.get_block(0));
+		qvv_mul_aos(pose, pose, s_bench_archive_output, k_num_archive_pose_transforms);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_archive_transforms);
+}
+
+BENCHMARK(bm_archive_load_mapped);
@@ -0,0 +1,181 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+// Plain loops over arrays of vectors and quaternions, the way user code processes them.
+// Without SIMD (make.py -nosimd), they measure how well the compiler auto-vectorizes
+// the scalar code path. Compare the results with and without -nosimd.
+
+constexpr uint32_t k_num_array_elements = 1024;
+
+RTM_FORCE_NOINLINE void vector_select_less_than_array(const vector4f* RTM_RESTRICT lhs, const vector4f* RTM_RESTRICT rhs, vector4f* RTM_RESTRICT output, uint32_t num_elements)
+{
+	for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+		output[element_index] = vector_select(vector_less_than(lhs[element_index], rhs[element_index]), lhs[element_index], rhs[element_index]);
+}
+
+RTM_FORCE_NOINLINE void vector_lerp_array(const vector4f* RTM_RESTRICT start, const vector4f* RTM_RESTRICT end, vector4f* RTM_RESTRICT output, uint32_t num_elements)
+{
+	for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+		output[element_index] = vector_lerp(start[element_index], end[element_index], 0.33F);
+}
+
+RTM_FORCE_NOINLINE void vector_normalize3_array(const vector4f* RTM_RESTRICT input, vector4f* RTM_RESTRICT output, uint32_t num_elements)
+{
+	for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+		output[element_index] = vector_normalize3(input[element_index]);
+}
+
+RTM_FORCE_NOINLINE void quat_mul_array(const quatf* RTM_RESTRICT lhs, const quatf* RTM_RESTRICT rhs, quatf* RTM_RESTRICT output, uint32_t num_elements)
+{
+	for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+		output[element_index] = quat_mul(lhs[element_index], rhs[element_index]);
+}
+
+RTM_FORCE_NOINLINE void quat_normalize_array(const quatf* RTM_RESTRICT input, quatf* RTM_RESTRICT output, uint32_t num_elements)
+{
+	for (uint32_t element_index = 0; element_index < num_elements; ++element_index)
+		output[element_index] = quat_normalize(input[element_index]);
+}
+
+static void fill_vectors(vector4f* vectors, float offset)
+{
+	for (uint32_t element_index = 0; element_index < k_num_array_elements; ++element_index)
+	{
+		const float value = float(element_index) * (1.0F / k_num_array_elements) + offset;
+		vectors[element_index] = vector_set(value, 1.0F - value, value * 0.5F, -value);
+	}
+}
+
+static void fill_quats(quatf* quats, float angle_offset)
+{
+	for (uint32_t element_index = 0; element_index < k_num_array_elements; ++element_index)
+	{
+		const float angle = float(element_index) * (1.0F / k_num_array_elements) + angle_offset;
+		quats[element_index] = quat_from_axis_angle(vector_normalize3(vector_set(1.0F, angle, -0.5F)), angle);
+	}
+}
+
+static void bm_array_vector_select(benchmark::State& state)
+{
+	alignas(64) vector4f lhs[k_num_array_elements];
+	alignas(64) vector4f rhs[k_num_array_elements];
+	alignas(64) vector4f output[k_num_array_elements];
+	fill_vectors(lhs, 0.0F);
+	fill_vectors(rhs, 0.25F);
+
+	for (auto _ : state)
+	{
+		vector_select_less_than_array(lhs, rhs, output, k_num_array_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_array_vector_select);
+
+static void bm_array_vector_lerp(benchmark::State& state)
+{
+	alignas(64) vector4f start[k_num_array_elements];
+	alignas(64) vector4f end[k_num_array_elements];
+	alignas(64) vector4f output[k_num_array_elements];
+	fill_vectors(start, 0.0F);
+	fill_vectors(end, 0.25F);
+
+	for (auto _ : state)
+	{
+		vector_lerp_array(start, end, output, k_num_array_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_array_vector_lerp);
+
+static void bm_array_vector_normalize3(benchmark::State& state)
+{
+	alignas(64) vector4f input[k_num_array_elements];
+	alignas(64) vector4f output[k_num_array_elements];
+	fill_vectors(input, 0.5F);
+
+	for (auto _ : state)
+	{
+		vector_normalize3_array(input, output, k_num_array_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_array_vector_normalize3);
+
+static void bm_array_quat_mul(benchmark::State& state)
+{
+	alignas(64) quatf lhs[k_num_array_elements];
+	alignas(64) quatf rhs[k_num_array_elements];
+	alignas(64) quatf output[k_num_array_elements];
+	fill_quats(lhs, 0.0F);
+	fill_quats(rhs, 1.0F);
+
+	for (auto _ : state)
+	{
+		quat_mul_array(lhs, rhs, output, k_num_array_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_array_quat_mul);
+
+static void bm_array_quat_normalize(benchmark::State& state)
+{
+	alignas(64) quatf input[k_num_array_elements];
+	alignas(64) quatf output[k_num_array_elements];
+	fill_quats(input, 0.0F);
+
+	for (auto _ : state)
+	{
+		quat_normalize_array(input, output, k_num_array_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_array_quat_normalize);
@@ -0,0 +1,183 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/quatf.h>
+#include <rtm/batch/vector4f.h>
+
+using namespace rtm;
+
+// Normalizes 256 elements per iteration, like re-normalizing a blended pose
+constexpr uint32_t k_num_batch_elements = 256;
+
+// The benchmark argument selects the precision
+static void normalize_precisions(benchmark::internal::Benchmark* bench)
+{
+	bench->Arg(int64_t(normalize_precision::estimate));
+	bench->Arg(int64_t(normalize_precision::refined));
+	bench->Arg(int64_t(normalize_precision::exact));
+}
+
+static const char* get_precision_name(normalize_precision precision)
+{
+	switch (precision)
+	{
+	case normalize_precision::estimate:	return "estimate";
+	case normalize_precision::refined:	return "refined";
+	case normalize_precision::exact:
+	default:							return "exact";
+	}
+}
+
+static void fill_bench_streams(float* x, float* y, float* z, float* w)
+{
+	for (uint32_t element_index = 0; element_index < k_num_batch_elements; ++element_index)
+	{
+		const float value = float(element_index) * 0.37F;
+		x[element_index] = value + 0.1F;
+		y[element_index] = 2.0F - value;
+		z[element_index] = value * 0.5F - 3.0F;
+		w[element_index] = 1.5F - value * 0.25F;
+	}
+}
+
+static void bm_quat_normalize_aos(benchmark::State& state)
+{
+	float x[k_num_batch_elements];
+	float y[k_num_batch_elements];
+	float z[k_num_batch_elements];
+	float w[k_num_batch_elements];
+	fill_bench_streams(x, y, z, w);
+
+	quatf input[k_num_batch_elements];
+	quatf output[k_num_batch_elements];
+	for (uint32_t quat_index = 0; quat_index < k_num_batch_elements; ++quat_index)
+		input[quat_index] = quat_set(x[quat_index], y[quat_index], z[quat_index], w[quat_index]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t quat_index = 0; quat_index < k_num_batch_elements; ++quat_index)
+			output[quat_index] = quat_normalize(input[quat_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_elements);
+}
+
+BENCHMARK(bm_quat_normalize_aos);
+
+static void bm_quat_normalize_soa(benchmark::State& state)
+{
+	const normalize_precision precision = normalize_precision(state.range(0));
+	state.SetLabel(get_precision_name(precision));
+
+	float x[k_num_batch_elements];
+	float y[k_num_batch_elements];
+	float z[k_num_batch_elements];
+	float w[k_num_batch_elements];
+	fill_bench_streams(x, y, z, w);
+
+	float out_x[k_num_batch_elements];
+	float out_y[k_num_batch_elements];
+	float out_z[k_num_batch_elements];
+	float out_w[k_num_batch_elements];
+
+	for (auto _ : state)
+	{
+		quat_normalize_soa(const_float4f_soa{ x, y, z, w }, float4f_soa{ out_x, out_y, out_z, out_w }, k_num_batch_elements, precision);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	benchmark::DoNotOptimize(out_w);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_elements);
+}
+
+BENCHMARK(bm_quat_normalize_soa)->Apply(normalize_precisions);
+
+static void bm_vector_normalize3_aos(benchmark::State& state)
+{
+	float x[k_num_batch_elements];
+	float y[k_num_batch_elements];
+	float z[k_num_batch_elements];
+	float w[k_num_batch_elements];
+	fill_bench_streams(x, y, z, w);
+
+	vector4f input[k_num_batch_elements];
+	vector4f output[k_num_batch_elements];
+	for (uint32_t vector_index = 0; vector_index < k_num_batch_elements; ++vector_index)
+		input[vector_index] = vector_set(x[vector_index], y[vector_index], z[vector_index], 0.0F);
+
+	for (auto _ : state)
+	{
+		for (uint32_t vector_index = 0; vector_index < k_num_batch_elements; ++vector_index)
+			output[vector_index] = vector_normalize3(input[vector_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_elements);
+}
+
+BENCHMARK(bm_vector_normalize3_aos);
+
+static void bm_vector_normalize3_soa(benchmark::State& state)
+{
+	const normalize_precision precision = normalize_precision(state.range(0));
+	state.SetLabel(get_precision_name(precision));
+
+	float x[k_num_batch_elements];
+	float y[k_num_batch_elements];
+	float z[k_num_batch_elements];
+	float w[k_num_batch_elements];
+	fill_bench_streams(x, y, z, w);
+
+	float out_x[k_num_batch_elements];
+	float out_y[k_num_batch_elements];
+	float out_z[k_num_batch_elements];
+
+	for (auto _ : state)
+	{
+		vector_normalize3_soa(const_float3f_soa{ x, y, z }, float3f_soa{ out_x, out_y, out_z }, k_num_batch_elements, precision);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_elements);
+}
+
+BENCHMARK(bm_vector_normalize3_soa)->Apply(normalize_precisions);
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/batch/parallel.h>
+
+#include <vector>
+
+using namespace rtm;
+
+// Large arrays split into chunks and processed by a thread pool. The argument is
+// the number of worker threads in addition to the calling thread, 0 being single threaded.
+// Real time is measured since the work happens on other threads.
+
+constexpr uint32_t k_num_parallel_elements = 256 * 1024;
+
+static void bm_qvv_mul_aos_parallel(benchmark::State& state)
+{
+	std::vector<qvvf> lhs(k_num_parallel_elements);
+	std::vector<qvvf> rhs(k_num_parallel_elements);
+	std::vector<qvvf> output(k_num_parallel_elements);
+
+	for (uint32_t element_index = 0; element_index < k_num_parallel_elements; ++element_index)
+	{
+		const float angle = float(element_index) * 0.001F;
+		lhs[element_index] = qvv_set(quat_from_euler(angle, angle * 0.5F, 0.1F), vector_set(angle), vector_set(1.0F));
+		rhs[element_index] = qvv_set(quat_from_euler(0.2F, -angle, angle), vector_set(-angle), vector_set(1.0F));
+	}
+
+	thread_pool pool(uint32_t(state.range(0)));
+
+	for (auto _ : state)
+	{
+		qvv_mul_aos_parallel(pool, lhs.data(), rhs.data(), output.data(), k_num_parallel_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output.data());
+	state.SetItemsProcessed(state.iterations() * k_num_parallel_elements);
+	state.SetBytesProcessed(state.iterations() * k_num_parallel_elements * sizeof(qvvf) * 3);
+}
+
+BENCHMARK(bm_qvv_mul_aos_parallel)->Arg(0)->Arg(1)->Arg(3)->Arg(7)->UseRealTime();
+
+static void bm_matrix_mul_aos_parallel(benchmark::State& state)
+{
+	std::vector<matrix3x4f> palette(k_num_parallel_elements);
+	std::vector<matrix3x4f> output(k_num_parallel_elements);
+
+	for (uint32_t element_index = 0; element_index < k_num_parallel_elements; ++element_index)
+	{
+		const float angle = float(element_index) * 0.001F;
+		palette[element_index] = matrix_from_qvv(quat_from_euler(angle, angle * 0.5F, 0.1F), vector_set(angle), vector_set(1.0F));
+	}
+
+	const matrix3x4f object_to_world = matrix_from_qvv(quat_from_euler(0.2F, 0.4F, 0.6F), vector_set(1.0F, 2.0F, 3.0F), vector_set(1.0F));
+	thread_pool pool(uint32_t(state.range(0)));
+
+	for (auto _ : state)
+	{
+		matrix_mul_aos_parallel(pool, palette.data(), object_to_world, output.data(), k_num_parallel_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output.data());
+	state.SetItemsProcessed(state.iterations() * k_num_parallel_elements);
+	state.SetBytesProcessed(state.iterations() * k_num_parallel_elements * sizeof(matrix3x4f) * 2);
+}
+
+BENCHMARK(bm_matrix_mul_aos_parallel)->Arg(0)->Arg(1)->Arg(3)->Arg(7)->UseRealTime();
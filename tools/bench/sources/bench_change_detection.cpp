@@ -0,0 +1,149 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/matrix3x4f.h>
+#include <rtm/batch/qvvf.h>
+
+using namespace rtm;
+
+// Compares a 256 bone pose with the previous frame per iteration, one bone in 8 moved
+constexpr uint32_t k_num_change_transforms = 256;
+
+static void fill_change_transforms(qvvf* previous, qvvf* current)
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_change_transforms; ++transform_index)
+	{
+		const float angle = float(transform_index) * 0.37F;
+		previous[transform_index] = qvv_set(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, 1.0F - angle, angle * 0.5F), vector_set(1.0F));
+		current[transform_index] = previous[transform_index];
+
+		if (transform_index % 8 == 3)
+			current[transform_index].translation = vector_add(current[transform_index].translation, vector_set(0.01F, 0.0F, 0.0F));
+	}
+}
+
+// The dirty bits and the count built one transform at a time
+static void bm_qvv_detect_changes_loop(benchmark::State& state)
+{
+	qvvf previous[k_num_change_transforms];
+	qvvf current[k_num_change_transforms];
+	fill_change_transforms(previous, current);
+	benchmark::DoNotOptimize(previous);
+	benchmark::DoNotOptimize(current);
+
+	uint32_t dirty_bits[k_num_change_transforms / 32];
+
+	for (auto _ : state)
+	{
+		uint32_t num_changed = 0;
+		for (uint32_t word_index = 0; word_index < k_num_change_transforms / 32; ++word_index)
+		{
+			uint32_t word = 0;
+			for (uint32_t bit_index = 0; bit_index < 32; ++bit_index)
+			{
+				const qvvf& current_transform = current[word_index * 32 + bit_index];
+				const qvvf& previous_transform = previous[word_index * 32 + bit_index];
+				const bool is_clean = quat_near_equal(current_transform.rotation, previous_transform.rotation, 1.0E-4F)
+					&& vector_all_near_equal3(current_transform.translation, previous_transform.translation, 1.0E-3F)
+					&& vector_all_near_equal3(current_transform.scale, previous_transform.scale, 1.0E-3F);
+
+				if (!is_clean)
+				{
+					word |= 1U << bit_index;
+					num_changed++;
+				}
+			}
+
+			dirty_bits[word_index] = word;
+		}
+
+		benchmark::DoNotOptimize(num_changed);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(dirty_bits);
+	state.SetItemsProcessed(state.iterations() * k_num_change_transforms);
+}
+
+BENCHMARK(bm_qvv_detect_changes_loop);
+
+static void bm_qvv_detect_changes_aos(benchmark::State& state)
+{
+	qvvf previous[k_num_change_transforms];
+	qvvf current[k_num_change_transforms];
+	fill_change_transforms(previous, current);
+	benchmark::DoNotOptimize(previous);
+	benchmark::DoNotOptimize(current);
+
+	uint32_t dirty_bits[k_num_change_transforms / 32];
+
+	for (auto _ : state)
+	{
+		const uint32_t num_changed = qvv_detect_changes_aos(current, previous, k_num_change_transforms, 1.0E-4F, 1.0E-3F, 1.0E-3F, dirty_bits);
+		benchmark::DoNotOptimize(num_changed);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(dirty_bits);
+	state.SetItemsProcessed(state.iterations() * k_num_change_transforms);
+}
+
+BENCHMARK(bm_qvv_detect_changes_aos);
+
+static void bm_matrix_detect_changes_aos(benchmark::State& state)
+{
+	qvvf previous_transforms[k_num_change_transforms];
+	qvvf current_transforms[k_num_change_transforms];
+	fill_change_transforms(previous_transforms, current_transforms);
+
+	matrix3x4f previous[k_num_change_transforms];
+	matrix3x4f current[k_num_change_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_change_transforms; ++transform_index)
+	{
+		previous[transform_index] = matrix_from_qvv(previous_transforms[transform_index]);
+		current[transform_index] = matrix_from_qvv(current_transforms[transform_index]);
+	}
+
+	benchmark::DoNotOptimize(previous);
+	benchmark::DoNotOptimize(current);
+
+	uint32_t dirty_bits[k_num_change_transforms / 32];
+
+	for (auto _ : state)
+	{
+		const uint32_t num_changed = matrix_detect_changes_aos(current, previous, k_num_change_transforms, 1.0E-4F, 1.0E-3F, dirty_bits);
+		benchmark::DoNotOptimize(num_changed);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(dirty_bits);
+	state.SetItemsProcessed(state.iterations() * k_num_change_transforms);
+}
+
+BENCHMARK(bm_matrix_detect_changes_aos);
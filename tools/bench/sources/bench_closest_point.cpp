@@ -0,0 +1,195 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/closest_pointf.h>
+#include <rtm/batch/closest_pointf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_primitives = 4096;
+
+struct mesh_data
+{
+	vector4f vertices0[k_num_primitives];
+	vector4f vertices1[k_num_primitives];
+	vector4f vertices2[k_num_primitives];
+	alignas(16) float vertex0_x[k_num_primitives];
+	alignas(16) float vertex0_y[k_num_primitives];
+	alignas(16) float vertex0_z[k_num_primitives];
+	alignas(16) float vertex1_x[k_num_primitives];
+	alignas(16) float vertex1_y[k_num_primitives];
+	alignas(16) float vertex1_z[k_num_primitives];
+	alignas(16) float vertex2_x[k_num_primitives];
+	alignas(16) float vertex2_y[k_num_primitives];
+	alignas(16) float vertex2_z[k_num_primitives];
+	alignas(16) float distances_sq[k_num_primitives];
+};
+
+static mesh_data g_mesh;
+
+static void fill_mesh(mesh_data& data)
+{
+	uint32_t seed = 7;
+	for (uint32_t index = 0; index < k_num_primitives; ++index)
+	{
+		// Candidates in no particular order, like a broad phase returns them, the query point lands in every Voronoi region
+		seed = seed * 1664525U + 1013904223U;
+		const float value = float(seed >> 20) * (1.0F / 409.6F);
+		data.vertices0[index] = vector_set(value, scalar_sin(value), 0.0F);
+		data.vertices1[index] = vector_set(value + 1.0F, scalar_cos(value), 0.5F);
+		data.vertices2[index] = vector_set(value, 1.5F, scalar_sin(value * 2.0F));
+
+		data.vertex0_x[index] = vector_get_x(data.vertices0[index]);
+		data.vertex0_y[index] = vector_get_y(data.vertices0[index]);
+		data.vertex0_z[index] = vector_get_z(data.vertices0[index]);
+		data.vertex1_x[index] = vector_get_x(data.vertices1[index]);
+		data.vertex1_y[index] = vector_get_y(data.vertices1[index]);
+		data.vertex1_z[index] = vector_get_z(data.vertices1[index]);
+		data.vertex2_x[index] = vector_get_x(data.vertices2[index]);
+		data.vertex2_y[index] = vector_get_y(data.vertices2[index]);
+		data.vertex2_z[index] = vector_get_z(data.vertices2[index]);
+	}
+}
+
+static const vector4f k_query_point = vector_set(5.0F, 0.5F, 0.25F);
+static const vector4f k_query_end = vector_set(2.0F, -1.0F, 1.0F);
+
+static void bm_point_segment_loop(benchmark::State& state)
+{
+	fill_mesh(g_mesh);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_primitives; ++index)
+			g_mesh.distances_sq[index] = point_segment_distance_squared(k_query_point, g_mesh.vertices0[index], g_mesh.vertices1[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_mesh.distances_sq);
+	state.SetItemsProcessed(state.iterations() * k_num_primitives);
+}
+
+BENCHMARK(bm_point_segment_loop);
+
+static void bm_point_segment_soa(benchmark::State& state)
+{
+	fill_mesh(g_mesh);
+
+	const const_float3f_soa starts{ g_mesh.vertex0_x, g_mesh.vertex0_y, g_mesh.vertex0_z };
+	const const_float3f_soa ends{ g_mesh.vertex1_x, g_mesh.vertex1_y, g_mesh.vertex1_z };
+
+	for (auto _ : state)
+	{
+		point_segment_distance_squared_soa(k_query_point, starts, ends, g_mesh.distances_sq, k_num_primitives);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_mesh.distances_sq);
+	state.SetItemsProcessed(state.iterations() * k_num_primitives);
+}
+
+BENCHMARK(bm_point_segment_soa);
+
+static void bm_point_triangle_loop(benchmark::State& state)
+{
+	fill_mesh(g_mesh);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_primitives; ++index)
+			g_mesh.distances_sq[index] = point_triangle_distance_squared(k_query_point, g_mesh.vertices0[index], g_mesh.vertices1[index], g_mesh.vertices2[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_mesh.distances_sq);
+	state.SetItemsProcessed(state.iterations() * k_num_primitives);
+}
+
+BENCHMARK(bm_point_triangle_loop);
+
+static void bm_point_triangle_soa(benchmark::State& state)
+{
+	fill_mesh(g_mesh);
+
+	const const_float3f_soa vertices0{ g_mesh.vertex0_x, g_mesh.vertex0_y, g_mesh.vertex0_z };
+	const const_float3f_soa vertices1{ g_mesh.vertex1_x, g_mesh.vertex1_y, g_mesh.vertex1_z };
+	const const_float3f_soa vertices2{ g_mesh.vertex2_x, g_mesh.vertex2_y, g_mesh.vertex2_z };
+
+	for (auto _ : state)
+	{
+		point_triangle_distance_squared_soa(k_query_point, vertices0, vertices1, vertices2, g_mesh.distances_sq, k_num_primitives);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_mesh.distances_sq);
+	state.SetItemsProcessed(state.iterations() * k_num_primitives);
+}
+
+BENCHMARK(bm_point_triangle_soa);
+
+static void bm_segment_segment_loop(benchmark::State& state)
+{
+	fill_mesh(g_mesh);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_primitives; ++index)
+			g_mesh.distances_sq[index] = segment_segment_distance_squared(k_query_point, k_query_end, g_mesh.vertices0[index], g_mesh.vertices2[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_mesh.distances_sq);
+	state.SetItemsProcessed(state.iterations() * k_num_primitives);
+}
+
+BENCHMARK(bm_segment_segment_loop);
+
+static void bm_segment_segment_soa(benchmark::State& state)
+{
+	fill_mesh(g_mesh);
+
+	const const_float3f_soa starts{ g_mesh.vertex0_x, g_mesh.vertex0_y, g_mesh.vertex0_z };
+	const const_float3f_soa ends{ g_mesh.vertex2_x, g_mesh.vertex2_y, g_mesh.vertex2_z };
+
+	for (auto _ : state)
+	{
+		segment_segment_distance_squared_soa(k_query_point, k_query_end, starts, ends, g_mesh.distances_sq, k_num_primitives);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_mesh.distances_sq);
+	state.SetItemsProcessed(state.iterations() * k_num_primitives);
+}
+
+BENCHMARK(bm_segment_segment_soa);
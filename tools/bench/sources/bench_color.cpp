@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/color.h>
+#include <rtm/batch/color.h>
+
+#include <cmath>
+#include <cstdint>
+
+using namespace rtm;
+
+// A 64x64 image
+constexpr uint32_t k_num_color_pixels = 64 * 64;
+
+static void make_color_pixels(uint8_t* pixels)
+{
+	for (uint32_t value_index = 0; value_index < k_num_color_pixels * 4; ++value_index)
+		pixels[value_index] = uint8_t((value_index * 2654435761U) >> 24);
+}
+
+// The scalar baseline, with std::pow per component
+static float reference_srgb_to_linear(float value)
+{
+	return value <= 0.04045F ? (value / 12.92F) : std::pow((value + 0.055F) / 1.055F, 2.4F);
+}
+
+static float reference_linear_to_srgb(float value)
+{
+	value = value < 0.0F ? 0.0F : (value > 1.0F ? 1.0F : value);
+	return value <= 0.0031308F ? (value * 12.92F) : (1.055F * std::pow(value, 1.0F / 2.4F) - 0.055F);
+}
+
+static void bm_color_srgb8_to_linear_pow(benchmark::State& state)
+{
+	uint8_t input[k_num_color_pixels * 4];
+	make_color_pixels(input);
+	float4f output[k_num_color_pixels];
+
+	benchmark::DoNotOptimize(input);
+
+	for (auto _ : state)
+	{
+		for (uint32_t pixel_index = 0; pixel_index < k_num_color_pixels; ++pixel_index)
+		{
+			const uint8_t* pixel = input + pixel_index * 4;
+			output[pixel_index].x = reference_srgb_to_linear(pixel[0] / 255.0F);
+			output[pixel_index].y = reference_srgb_to_linear(pixel[1] / 255.0F);
+			output[pixel_index].z = reference_srgb_to_linear(pixel[2] / 255.0F);
+			output[pixel_index].w = pixel[3] / 255.0F;
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_color_pixels);
+}
+
+BENCHMARK(bm_color_srgb8_to_linear_pow);
+
+static void bm_color_srgb8_to_linear(benchmark::State& state)
+{
+	uint8_t input[k_num_color_pixels * 4];
+	make_color_pixels(input);
+	float4f output[k_num_color_pixels];
+
+	benchmark::DoNotOptimize(input);
+
+	for (auto _ : state)
+	{
+		color_srgb8_to_linear(input, output, k_num_color_pixels);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_color_pixels);
+}
+
+BENCHMARK(bm_color_srgb8_to_linear);
+
+static void bm_color_linear_to_srgb8_pow(benchmark::State& state)
+{
+	uint8_t pixels[k_num_color_pixels * 4];
+	make_color_pixels(pixels);
+	float4f input[k_num_color_pixels];
+	color_srgb8_to_linear(pixels, input, k_num_color_pixels);
+	uint8_t output[k_num_color_pixels * 4];
+
+	benchmark::DoNotOptimize(input);
+
+	for (auto _ : state)
+	{
+		for (uint32_t pixel_index = 0; pixel_index < k_num_color_pixels; ++pixel_index)
+		{
+			uint8_t* pixel = output + pixel_index * 4;
+			pixel[0] = uint8_t(reference_linear_to_srgb(input[pixel_index].x) * 255.0F + 0.5F);
+			pixel[1] = uint8_t(reference_linear_to_srgb(input[pixel_index].y) * 255.0F + 0.5F);
+			pixel[2] = uint8_t(reference_linear_to_srgb(input[pixel_index].z) * 255.0F + 0.5F);
+			pixel[3] = uint8_t(input[pixel_index].w * 255.0F + 0.5F);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_color_pixels);
+}
+
+BENCHMARK(bm_color_linear_to_srgb8_pow);
+
+static void bm_color_linear_to_srgb8(benchmark::State& state)
+{
+	uint8_t pixels[k_num_color_pixels * 4];
+	make_color_pixels(pixels);
+	float4f input[k_num_color_pixels];
+	color_srgb8_to_linear(pixels, input, k_num_color_pixels);
+	uint8_t output[k_num_color_pixels * 4];
+
+	benchmark::DoNotOptimize(input);
+
+	for (auto _ : state)
+	{
+		color_linear_to_srgb8(input, output, k_num_color_pixels);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_color_pixels);
+}
+
+BENCHMARK(bm_color_linear_to_srgb8);
+
+static void bm_color_rgba8_to_ycocg8(benchmark::State& state)
+{
+	uint8_t input[k_num_color_pixels * 4];
+	make_color_pixels(input);
+	uint8_t output[k_num_color_pixels * 4];
+
+	benchmark::DoNotOptimize(input);
+
+	for (auto _ : state)
+	{
+		color_rgba8_to_ycocg8(input, output, k_num_color_pixels);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_color_pixels);
+}
+
+BENCHMARK(bm_color_rgba8_to_ycocg8);
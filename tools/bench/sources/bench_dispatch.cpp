@@ -0,0 +1,151 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/dispatch.h>
+
+using namespace rtm;
+
+// Processes a 256 bone pose per iteration with every available batch dispatch variant
+constexpr uint32_t k_num_batch_elements = 256;
+
+static void dispatch_variants(benchmark::internal::Benchmark* bench)
+{
+	for (uint32_t isa_index = 0; isa_index < rtm_impl::k_num_cpu_isa; ++isa_index)
+	{
+		if (is_dispatch_isa_available(cpu_isa(isa_index)))
+			bench->Arg(int64_t(isa_index));
+	}
+}
+
+// Selects the variant of the benchmark argument and reports it
+static void set_dispatch_variant(benchmark::State& state)
+{
+	set_dispatch_isa(cpu_isa(state.range(0)));
+	state.SetLabel(get_dispatch_name());
+}
+
+static void fill_bench_transforms(qvvf* transforms, quatf* rotations, matrix3x4f* matrices)
+{
+	for (uint32_t element_index = 0; element_index < k_num_batch_elements; ++element_index)
+	{
+		const float angle = float(element_index) * 0.37F;
+		rotations[element_index] = quat_from_euler(angle, 0.5F - angle, angle * 1.5F);
+		transforms[element_index] = qvv_set(rotations[element_index], vector_set(angle, 1.0F - angle, angle * 0.5F), vector_set(1.0F, 1.5F, 0.5F));
+		matrices[element_index] = matrix_from_qvv(transforms[element_index]);
+	}
+}
+
+static void bm_quat_mul_soa_dispatch(benchmark::State& state)
+{
+	set_dispatch_variant(state);
+
+	qvvf transforms[k_num_batch_elements];
+	quatf rotations[k_num_batch_elements];
+	matrix3x4f matrices[k_num_batch_elements];
+	fill_bench_transforms(transforms, rotations, matrices);
+
+	float quat_x[k_num_batch_elements];
+	float quat_y[k_num_batch_elements];
+	float quat_z[k_num_batch_elements];
+	float quat_w[k_num_batch_elements];
+	float out_x[k_num_batch_elements];
+	float out_y[k_num_batch_elements];
+	float out_z[k_num_batch_elements];
+	float out_w[k_num_batch_elements];
+	for (uint32_t element_index = 0; element_index < k_num_batch_elements; ++element_index)
+	{
+		quat_x[element_index] = quat_get_x(rotations[element_index]);
+		quat_y[element_index] = quat_get_y(rotations[element_index]);
+		quat_z[element_index] = quat_get_z(rotations[element_index]);
+		quat_w[element_index] = quat_get_w(rotations[element_index]);
+	}
+
+	const const_float4f_soa input = { quat_x, quat_y, quat_z, quat_w };
+	const float4f_soa output = { out_x, out_y, out_z, out_w };
+
+	for (auto _ : state)
+	{
+		quat_mul_soa_dispatch(input, input, output, k_num_batch_elements);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	benchmark::DoNotOptimize(out_w);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_elements);
+}
+
+BENCHMARK(bm_quat_mul_soa_dispatch)->Apply(dispatch_variants);
+
+static void bm_quat_from_matrix_aos_dispatch(benchmark::State& state)
+{
+	set_dispatch_variant(state);
+
+	qvvf transforms[k_num_batch_elements];
+	quatf rotations[k_num_batch_elements];
+	matrix3x4f matrices[k_num_batch_elements];
+	fill_bench_transforms(transforms, rotations, matrices);
+
+	for (auto _ : state)
+	{
+		quat_from_matrix_aos_dispatch(matrices, rotations, k_num_batch_elements);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_elements);
+}
+
+BENCHMARK(bm_quat_from_matrix_aos_dispatch)->Apply(dispatch_variants);
+
+static void bm_qvv_mul_aos_dispatch(benchmark::State& state)
+{
+	set_dispatch_variant(state);
+
+	qvvf transforms[k_num_batch_elements];
+	quatf rotations[k_num_batch_elements];
+	matrix3x4f matrices[k_num_batch_elements];
+	fill_bench_transforms(transforms, rotations, matrices);
+
+	qvvf output[k_num_batch_elements];
+
+	for (auto _ : state)
+	{
+		qvv_mul_aos_dispatch(transforms, transforms, output, k_num_batch_elements);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_elements);
+}
+
+BENCHMARK(bm_qvv_mul_aos_dispatch)->Apply(dispatch_variants);
@@ -0,0 +1,280 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4d.h>
+#include <rtm/matrix4x4d.h>
+#include <rtm/quatd.h>
+
+using namespace rtm;
+
+// Double precision types are backed by a single __m256d with AVX and by two __m128d otherwise.
+// These are throughput bound and let the compiler inline everything, build with and without AVX to compare.
+static constexpr uint32_t k_num_array_items = 64;
+
+static void bm_quatd_mul_array(benchmark::State& state)
+{
+	quatd lhs[k_num_array_items];
+	quatd rhs[k_num_array_items];
+	quatd output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+	{
+		lhs[i] = quat_from_euler(double(i) * 0.1, double(i) * 0.2, double(i) * 0.3);
+		rhs[i] = quat_from_euler(double(i) * 0.3, double(i) * 0.1, double(i) * 0.2);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = quat_mul(lhs[i], rhs[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_quatd_mul_array);
+
+static void bm_quatd_mul_vector3_array(benchmark::State& state)
+{
+	vector4d vectors[k_num_array_items];
+	quatd rotations[k_num_array_items];
+	vector4d output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+	{
+		vectors[i] = vector_set(double(i), double(i) * -0.5, 12.0);
+		rotations[i] = quat_from_euler(double(i) * 0.1, double(i) * 0.2, double(i) * 0.3);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = quat_mul_vector3(vectors[i], rotations[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_quatd_mul_vector3_array);
+
+static void bm_vector4d_mul_add_array(benchmark::State& state)
+{
+	vector4d inputs[k_num_array_items];
+	vector4d output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+		inputs[i] = vector_set(double(i), double(i) * -0.5, 12.0, 0.25);
+
+	const vector4d scale = vector_set(0.5, 2.0, -1.0, 4.0);
+	const vector4d bias = vector_set(1.0, -1.0, 0.5, 0.0);
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = vector_mul_add(vector_add(inputs[i], bias), scale, inputs[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_vector4d_mul_add_array);
+
+static void bm_vector4d_dot_array(benchmark::State& state)
+{
+	vector4d lhs[k_num_array_items];
+	vector4d rhs[k_num_array_items];
+	double output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+	{
+		lhs[i] = vector_set(double(i), double(i) * -0.5, 12.0, 0.25);
+		rhs[i] = vector_set(0.5, double(i), -1.0, double(i) * 2.0);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = vector_dot(lhs[i], rhs[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_vector4d_dot_array);
+
+static void bm_matrix3x4d_mul_array(benchmark::State& state)
+{
+	matrix3x4d lhs[k_num_array_items];
+	matrix3x4d rhs[k_num_array_items];
+	matrix3x4d output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+	{
+		lhs[i] = matrix_from_qvv(quat_from_euler(double(i) * 0.1, double(i) * 0.2, double(i) * 0.3), vector_set(double(i)), vector_set(1.0));
+		rhs[i] = matrix_from_qvv(quat_from_euler(double(i) * 0.3, double(i) * 0.1, double(i) * 0.2), vector_set(-double(i)), vector_set(2.0));
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = matrix_mul(lhs[i], rhs[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_matrix3x4d_mul_array);
+
+static void bm_matrix4x4d_mul_array(benchmark::State& state)
+{
+	matrix4x4d lhs[k_num_array_items];
+	matrix4x4d rhs[k_num_array_items];
+	matrix4x4d output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+	{
+		const double value = double(i);
+		lhs[i] = matrix_set(vector_set(value, 1.0, 2.0, 0.0), vector_set(0.5, value, -1.0, 0.0), vector_set(0.25, 4.0, value, 0.0), vector_set(1.0, 2.0, 3.0, 1.0));
+		rhs[i] = matrix_set(vector_set(-value, 0.5, 1.0, 0.0), vector_set(2.0, value, 0.5, 0.0), vector_set(1.0, -4.0, value, 0.0), vector_set(-1.0, 0.0, 3.0, 1.0));
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = matrix_mul(lhs[i], rhs[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_matrix4x4d_mul_array);
+
+static void bm_vector4d_sin_array(benchmark::State& state)
+{
+	vector4d inputs[k_num_array_items];
+	vector4d output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+		inputs[i] = vector_set(double(i) * 0.1, double(i) * -0.7, double(i) * 3.1, 0.25);
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = vector_sin(inputs[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_vector4d_sin_array);
+
+static void bm_vector4d_acos_array(benchmark::State& state)
+{
+	vector4d inputs[k_num_array_items];
+	vector4d output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+	{
+		const double value = double(i) / double(k_num_array_items);
+		inputs[i] = vector_set(value, -value, value * 0.5, 1.0 - value);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = vector_acos(inputs[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_vector4d_acos_array);
+
+static void bm_vector4d_atan2_array(benchmark::State& state)
+{
+	vector4d y[k_num_array_items];
+	vector4d x[k_num_array_items];
+	vector4d output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+	{
+		y[i] = vector_set(double(i), double(i) * -0.5, 12.0, 0.25);
+		x[i] = vector_set(-1.5, 2.0, double(i) * 0.1, double(i) * -3.0);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = vector_atan2(y[i], x[i]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_vector4d_atan2_array);
+
+static void bm_quatd_slerp_array(benchmark::State& state)
+{
+	quatd lhs[k_num_array_items];
+	quatd rhs[k_num_array_items];
+	quatd output[k_num_array_items];
+	for (uint32_t i = 0; i < k_num_array_items; ++i)
+	{
+		lhs[i] = quat_from_euler(double(i) * 0.1, double(i) * 0.2, double(i) * 0.3);
+		rhs[i] = quat_from_euler(double(i) * 0.3, double(i) * 0.1, double(i) * 0.2 + 0.5);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t i = 0; i < k_num_array_items; ++i)
+			output[i] = quat_slerp(lhs[i], rhs[i], 0.33);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_items);
+}
+
+BENCHMARK(bm_quatd_slerp_array);
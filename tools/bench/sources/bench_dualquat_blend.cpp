@@ -0,0 +1,114 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/dualquatf.h>
+#include <rtm/batch/dualquatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Blends 256 vertices with 4 influences each per iteration
+constexpr uint32_t k_num_batch_vertices = 256;
+constexpr uint32_t k_num_bench_bones = 64;
+
+static void fill_bench_skinning(dualquatf* palette, uint16_t* bone_indices, float* bone_weights)
+{
+	for (uint32_t bone_index = 0; bone_index < k_num_bench_bones; ++bone_index)
+	{
+		const float angle = float(bone_index) * 0.37F;
+		palette[bone_index] = dualquat_from_rotation_translation(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, 1.0F - angle, angle * 0.5F));
+	}
+
+	for (uint32_t vertex_index = 0; vertex_index < k_num_batch_vertices; ++vertex_index)
+	{
+		for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+		{
+			bone_indices[vertex_index * 4 + influence_index] = uint16_t((vertex_index * 7 + influence_index * 13) % k_num_bench_bones);
+			bone_weights[vertex_index * 4 + influence_index] = float(4 - influence_index) * 0.1F;
+		}
+	}
+}
+
+static void bm_dualquat_blend4_loop(benchmark::State& state)
+{
+	dualquatf palette[k_num_bench_bones];
+	uint16_t bone_indices[k_num_batch_vertices * 4];
+	float bone_weights[k_num_batch_vertices * 4];
+	dualquatf output[k_num_batch_vertices];
+	fill_bench_skinning(palette, bone_indices, bone_weights);
+
+	for (auto _ : state)
+	{
+		for (uint32_t vertex_index = 0; vertex_index < k_num_batch_vertices; ++vertex_index)
+		{
+			const uint16_t* vertex_bone_indices = bone_indices + vertex_index * 4;
+			const float* vertex_bone_weights = bone_weights + vertex_index * 4;
+			const quatf pivot = palette[vertex_bone_indices[0]].real;
+
+			vector4f real = vector_zero();
+			vector4f dual = vector_zero();
+			for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+			{
+				const dualquatf& influence = palette[vertex_bone_indices[influence_index]];
+				const float weight = quat_dot(influence.real, pivot) >= 0.0F ? vertex_bone_weights[influence_index] : -vertex_bone_weights[influence_index];
+				real = vector_mul_add(quat_to_vector(influence.real), weight, real);
+				dual = vector_mul_add(quat_to_vector(influence.dual), weight, dual);
+			}
+
+			output[vertex_index] = dualquat_normalize(dualquat_set(vector_to_quat(real), vector_to_quat(dual)));
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_vertices);
+}
+
+BENCHMARK(bm_dualquat_blend4_loop);
+
+static void bm_dualquat_blend4_aos(benchmark::State& state)
+{
+	dualquatf palette[k_num_bench_bones];
+	uint16_t bone_indices[k_num_batch_vertices * 4];
+	float bone_weights[k_num_batch_vertices * 4];
+	dualquatf output[k_num_batch_vertices];
+	fill_bench_skinning(palette, bone_indices, bone_weights);
+
+	for (auto _ : state)
+	{
+		dualquat_blend4_aos(palette, bone_indices, bone_weights, output, k_num_batch_vertices);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_vertices);
+}
+
+BENCHMARK(bm_dualquat_blend4_aos);
@@ -0,0 +1,227 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/quatfx.h>
+#include <rtm/vector4i.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bodies = 1024;
+
+// A typical scalar Q16.16 library: one component at a time with 64 bit products
+struct scalar_fx_quat
+{
+	int32_t x;
+	int32_t y;
+	int32_t z;
+	int32_t w;
+};
+
+static int32_t scalar_fx_mul(int32_t lhs, int32_t rhs)
+{
+	return int32_t((int64_t(lhs) * int64_t(rhs) + (int64_t(1) << 15)) >> 16);
+}
+
+// Bit by bit integer square root of a Q16.16 value
+static int32_t scalar_fx_sqrt(int32_t input)
+{
+	uint64_t value = uint64_t(uint32_t(input)) << 16;
+	uint64_t result = 0;
+	uint64_t bit = uint64_t(1) << 62;
+	while (bit > value)
+		bit >>= 2;
+
+	while (bit != 0)
+	{
+		if (value >= result + bit)
+		{
+			value -= result + bit;
+			result = (result >> 1) + bit;
+		}
+		else
+			result >>= 1;
+		bit >>= 2;
+	}
+
+	return int32_t(result);
+}
+
+static int32_t scalar_fx_div(int32_t lhs, int32_t rhs)
+{
+	return int32_t((int64_t(lhs) << 16) / rhs);
+}
+
+static scalar_fx_quat scalar_fx_quat_mul(const scalar_fx_quat& lhs, const scalar_fx_quat& rhs)
+{
+	scalar_fx_quat result;
+	result.x = scalar_fx_mul(rhs.w, lhs.x) + scalar_fx_mul(rhs.x, lhs.w) + scalar_fx_mul(rhs.y, lhs.z) - scalar_fx_mul(rhs.z, lhs.y);
+	result.y = scalar_fx_mul(rhs.w, lhs.y) - scalar_fx_mul(rhs.x, lhs.z) + scalar_fx_mul(rhs.y, lhs.w) + scalar_fx_mul(rhs.z, lhs.x);
+	result.z = scalar_fx_mul(rhs.w, lhs.z) + scalar_fx_mul(rhs.x, lhs.y) - scalar_fx_mul(rhs.y, lhs.x) + scalar_fx_mul(rhs.z, lhs.w);
+	result.w = scalar_fx_mul(rhs.w, lhs.w) - scalar_fx_mul(rhs.x, lhs.x) - scalar_fx_mul(rhs.y, lhs.y) - scalar_fx_mul(rhs.z, lhs.z);
+	return result;
+}
+
+static scalar_fx_quat scalar_fx_quat_normalize(const scalar_fx_quat& input)
+{
+	const int32_t length_squared = scalar_fx_mul(input.x, input.x) + scalar_fx_mul(input.y, input.y) + scalar_fx_mul(input.z, input.z) + scalar_fx_mul(input.w, input.w);
+	const int32_t length = scalar_fx_sqrt(length_squared);
+	return scalar_fx_quat{ scalar_fx_div(input.x, length), scalar_fx_div(input.y, length), scalar_fx_div(input.z, length), scalar_fx_div(input.w, length) };
+}
+
+// Same cross product form as quat_mul_vector3
+static scalar_fx_quat scalar_fx_quat_mul_vector3(const scalar_fx_quat& vector, const scalar_fx_quat& rotation)
+{
+	const int32_t cross_x = scalar_fx_mul(rotation.y, vector.z) - scalar_fx_mul(rotation.z, vector.y);
+	const int32_t cross_y = scalar_fx_mul(rotation.z, vector.x) - scalar_fx_mul(rotation.x, vector.z);
+	const int32_t cross_z = scalar_fx_mul(rotation.x, vector.y) - scalar_fx_mul(rotation.y, vector.x);
+	const int32_t t_x = cross_x * 2;
+	const int32_t t_y = cross_y * 2;
+	const int32_t t_z = cross_z * 2;
+
+	scalar_fx_quat result;
+	result.x = vector.x + scalar_fx_mul(rotation.w, t_x) + scalar_fx_mul(rotation.y, t_z) - scalar_fx_mul(rotation.z, t_y);
+	result.y = vector.y + scalar_fx_mul(rotation.w, t_y) + scalar_fx_mul(rotation.z, t_x) - scalar_fx_mul(rotation.x, t_z);
+	result.z = vector.z + scalar_fx_mul(rotation.w, t_z) + scalar_fx_mul(rotation.x, t_y) - scalar_fx_mul(rotation.y, t_x);
+	result.w = vector.w;
+	return result;
+}
+
+static scalar_fx_quat make_delta_rotation(uint32_t body_index)
+{
+	const float angle = float(body_index) * 0.01F;
+	const vector4i delta = quat_fx_to_raw(quat_to_fx(quat_from_euler(angle, angle * 0.5F, -angle)));
+	return scalar_fx_quat{ vector_get_x(delta), vector_get_y(delta), vector_get_z(delta), vector_get_w(delta) };
+}
+
+static void bm_fixed_point_integrate_scalar(benchmark::State& state)
+{
+	// Every body rotates by its angular step and renormalizes, like a lockstep simulation tick
+	std::vector<scalar_fx_quat> rotations(k_num_bodies, scalar_fx_quat{ 0, 0, 0, 65536 });
+	std::vector<scalar_fx_quat> deltas(k_num_bodies);
+	for (uint32_t body_index = 0; body_index < k_num_bodies; ++body_index)
+		deltas[body_index] = make_delta_rotation(body_index);
+
+	for (auto _ : state)
+	{
+		for (uint32_t body_index = 0; body_index < k_num_bodies; ++body_index)
+			rotations[body_index] = scalar_fx_quat_normalize(scalar_fx_quat_mul(rotations[body_index], deltas[body_index]));
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations.data());
+	state.SetItemsProcessed(state.iterations() * k_num_bodies);
+}
+
+BENCHMARK(bm_fixed_point_integrate_scalar);
+
+static void bm_fixed_point_integrate_simd(benchmark::State& state)
+{
+	std::vector<scalar_fx_quat> rotations(k_num_bodies, scalar_fx_quat{ 0, 0, 0, 65536 });
+	std::vector<scalar_fx_quat> deltas(k_num_bodies);
+	for (uint32_t body_index = 0; body_index < k_num_bodies; ++body_index)
+		deltas[body_index] = make_delta_rotation(body_index);
+
+	for (auto _ : state)
+	{
+		for (uint32_t body_index = 0; body_index < k_num_bodies; ++body_index)
+		{
+			const quatfx rotation = quat_fx_from_raw(vector_load(&rotations[body_index].x));
+			const quatfx delta = quat_fx_from_raw(vector_load(&deltas[body_index].x));
+			vector_store(quat_fx_to_raw(quat_normalize(quat_mul(rotation, delta))), &rotations[body_index].x);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations.data());
+	state.SetItemsProcessed(state.iterations() * k_num_bodies);
+}
+
+BENCHMARK(bm_fixed_point_integrate_simd);
+
+static void bm_fixed_point_transform_scalar(benchmark::State& state)
+{
+	// Every body moves its collision points into world space
+	std::vector<scalar_fx_quat> rotations(k_num_bodies);
+	std::vector<scalar_fx_quat> points(k_num_bodies * 4);
+	std::vector<scalar_fx_quat> world_points(k_num_bodies * 4);
+	for (uint32_t body_index = 0; body_index < k_num_bodies; ++body_index)
+	{
+		rotations[body_index] = make_delta_rotation(body_index);
+		for (uint32_t point_index = 0; point_index < 4; ++point_index)
+			points[body_index * 4 + point_index] = scalar_fx_quat{ int32_t(point_index) << 16, int32_t(body_index) << 6, -(int32_t(point_index) << 15), 0 };
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < k_num_bodies * 4; ++point_index)
+			world_points[point_index] = scalar_fx_quat_mul_vector3(points[point_index], rotations[point_index / 4]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(world_points.data());
+	state.SetItemsProcessed(state.iterations() * k_num_bodies * 4);
+}
+
+BENCHMARK(bm_fixed_point_transform_scalar);
+
+static void bm_fixed_point_transform_simd(benchmark::State& state)
+{
+	std::vector<scalar_fx_quat> rotations(k_num_bodies);
+	std::vector<scalar_fx_quat> points(k_num_bodies * 4);
+	std::vector<scalar_fx_quat> world_points(k_num_bodies * 4);
+	for (uint32_t body_index = 0; body_index < k_num_bodies; ++body_index)
+	{
+		rotations[body_index] = make_delta_rotation(body_index);
+		for (uint32_t point_index = 0; point_index < 4; ++point_index)
+			points[body_index * 4 + point_index] = scalar_fx_quat{ int32_t(point_index) << 16, int32_t(body_index) << 6, -(int32_t(point_index) << 15), 0 };
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < k_num_bodies * 4; ++point_index)
+		{
+			const vector4fx point = vector_fx_load(&points[point_index].x);
+			const quatfx rotation = quat_fx_from_raw(vector_load(&rotations[point_index / 4].x));
+			vector_store(quat_mul_vector3(point, rotation), &world_points[point_index].x);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(world_points.data());
+	state.SetItemsProcessed(state.iterations() * k_num_bodies * 4);
+}
+
+BENCHMARK(bm_fixed_point_transform_simd);
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/frustumf.h>
+#include <rtm/matrix4x4f.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/frustumf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_cull_objects = 16384;
+
+struct cull_bench_data
+{
+	alignas(32) float center_x[k_num_cull_objects];
+	alignas(32) float center_y[k_num_cull_objects];
+	alignas(32) float center_z[k_num_cull_objects];
+	alignas(32) float extent_x[k_num_cull_objects];
+	alignas(32) float extent_y[k_num_cull_objects];
+	alignas(32) float extent_z[k_num_cull_objects];
+	alignas(32) float radii[k_num_cull_objects];
+	uint32_t visible_bits[k_num_cull_objects / 32];
+};
+
+static cull_bench_data g_cull_data;
+
+static frustumf make_cull_frustum()
+{
+	// 90 degree field of view looking down +Z with the near plane at 1.0 and the far plane at 100.0
+	const float depth_scale = 100.0F / 99.0F;
+	const matrix4x4f projection = matrix_set(
+		vector_set(1.0F, 0.0F, 0.0F, 0.0F),
+		vector_set(0.0F, 1.0F, 0.0F, 0.0F),
+		vector_set(0.0F, 0.0F, depth_scale, 1.0F),
+		vector_set(0.0F, 0.0F, -depth_scale, 0.0F));
+	return frustum_from_matrix(projection);
+}
+
+static void fill_cull_data(cull_bench_data& data)
+{
+	// Roughly half the objects are visible
+	for (uint32_t index = 0; index < k_num_cull_objects; ++index)
+	{
+		const float value = float(index);
+		data.center_x[index] = scalar_sin(value * 0.37F) * 120.0F;
+		data.center_y[index] = scalar_cos(value * 0.73F) * 80.0F;
+		data.center_z[index] = float(index % 150) - 20.0F;
+		data.extent_x[index] = 0.5F + float(index % 3);
+		data.extent_y[index] = 0.5F + float(index % 5);
+		data.extent_z[index] = 0.5F + float(index % 7);
+		data.radii[index] = 1.0F + float(index % 4);
+	}
+}
+
+static void bm_frustum_cull_spheres_loop(benchmark::State& state)
+{
+	const frustumf frustum = make_cull_frustum();
+	fill_cull_data(g_cull_data);
+
+	for (auto _ : state)
+	{
+		// One sphere at a time, the reference for the batched version
+		for (uint32_t index = 0; index < k_num_cull_objects; ++index)
+		{
+			const vector4f center = vector_set(g_cull_data.center_x[index], g_cull_data.center_y[index], g_cull_data.center_z[index]);
+			const uint32_t is_visible = frustum_intersects_sphere(frustum, center, g_cull_data.radii[index]) ? 1 : 0;
+			if (index % 32 == 0)
+				g_cull_data.visible_bits[index / 32] = 0;
+			g_cull_data.visible_bits[index / 32] |= is_visible << (index % 32);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_cull_data.visible_bits);
+	state.SetItemsProcessed(state.iterations() * k_num_cull_objects);
+}
+
+BENCHMARK(bm_frustum_cull_spheres_loop);
+
+static void bm_frustum_cull_spheres_soa(benchmark::State& state)
+{
+	const frustumf frustum = make_cull_frustum();
+	fill_cull_data(g_cull_data);
+
+	const const_float3f_soa centers{ g_cull_data.center_x, g_cull_data.center_y, g_cull_data.center_z };
+
+	for (auto _ : state)
+	{
+		frustum_cull_spheres_soa(frustum, centers, g_cull_data.radii, g_cull_data.visible_bits, k_num_cull_objects);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_cull_data.visible_bits);
+	state.SetItemsProcessed(state.iterations() * k_num_cull_objects);
+}
+
+BENCHMARK(bm_frustum_cull_spheres_soa);
+
+static void bm_frustum_cull_aabbs_loop(benchmark::State& state)
+{
+	const frustumf frustum = make_cull_frustum();
+	fill_cull_data(g_cull_data);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_cull_objects; ++index)
+		{
+			const vector4f center = vector_set(g_cull_data.center_x[index], g_cull_data.center_y[index], g_cull_data.center_z[index]);
+			const vector4f extent = vector_set(g_cull_data.extent_x[index], g_cull_data.extent_y[index], g_cull_data.extent_z[index]);
+			const uint32_t is_visible = frustum_intersects_aabb(frustum, center, extent) ? 1 : 0;
+			if (index % 32 == 0)
+				g_cull_data.visible_bits[index / 32] = 0;
+			g_cull_data.visible_bits[index / 32] |= is_visible << (index % 32);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_cull_data.visible_bits);
+	state.SetItemsProcessed(state.iterations() * k_num_cull_objects);
+}
+
+BENCHMARK(bm_frustum_cull_aabbs_loop);
+
+static void bm_frustum_cull_aabbs_soa(benchmark::State& state)
+{
+	const frustumf frustum = make_cull_frustum();
+	fill_cull_data(g_cull_data);
+
+	const const_float3f_soa centers{ g_cull_data.center_x, g_cull_data.center_y, g_cull_data.center_z };
+	const const_float3f_soa extents{ g_cull_data.extent_x, g_cull_data.extent_y, g_cull_data.extent_z };
+
+	for (auto _ : state)
+	{
+		frustum_cull_aabbs_soa(frustum, centers, extents, g_cull_data.visible_bits, k_num_cull_objects);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_cull_data.visible_bits);
+	state.SetItemsProcessed(state.iterations() * k_num_cull_objects);
+}
+
+BENCHMARK(bm_frustum_cull_aabbs_soa);
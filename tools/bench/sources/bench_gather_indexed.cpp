@@ -0,0 +1,174 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/matrix3x4f.h>
+#include <rtm/batch/qvvf.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+// Indices remap the outputs onto a rig of transforms at random. 4096 outputs from 1024 transforms
+// stay in the L2 cache while 1M outputs from 4M transforms (192 MB) mostly miss every cache level.
+static std::vector<uint32_t> make_indices(uint32_t num_transforms, uint32_t num_outputs)
+{
+	std::vector<uint32_t> indices(num_outputs);
+	uint32_t state = 12345;
+	for (uint32_t& index : indices)
+	{
+		state = state * 1664525 + 1013904223;
+		index = (state >> 8) % num_transforms;
+	}
+
+	return indices;
+}
+
+static std::vector<qvvf> make_transforms(uint32_t num_transforms)
+{
+	std::vector<qvvf> transforms(num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index % 1024);
+		transforms[transform_index] = qvv_set(quat_from_euler(value * 0.1F, 0.2F, value * 0.3F), vector_set(value, 1.0F, 2.0F), vector_set(1.0F + value * 0.01F));
+	}
+
+	return transforms;
+}
+
+static void bm_qvv_mul_point3_gather_loop(benchmark::State& state)
+{
+	const uint32_t num_transforms = uint32_t(state.range(0));
+	const uint32_t num_outputs = uint32_t(state.range(1));
+	const std::vector<qvvf> transforms = make_transforms(num_transforms);
+	const std::vector<uint32_t> indices = make_indices(num_transforms, num_outputs);
+	std::vector<float3f> points(num_outputs, float3f{ 1.0F, 2.0F, 3.0F });
+	std::vector<float3f> output(num_outputs);
+
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < num_outputs; ++point_index)
+			vector_store3(qvv_mul_point3(vector_load3(&points[point_index]), transforms[indices[point_index]]), &output[point_index]);
+
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * num_outputs);
+}
+
+BENCHMARK(bm_qvv_mul_point3_gather_loop)->Args({ 1024, 4096 })->Args({ 4 * 1024 * 1024, 1024 * 1024 });
+
+static void bm_qvv_mul_point3_indexed_aos(benchmark::State& state)
+{
+	const uint32_t num_transforms = uint32_t(state.range(0));
+	const uint32_t num_outputs = uint32_t(state.range(1));
+	const uint32_t prefetch_distance = uint32_t(state.range(2));
+	const std::vector<qvvf> transforms = make_transforms(num_transforms);
+	const std::vector<uint32_t> indices = make_indices(num_transforms, num_outputs);
+	std::vector<float3f> points(num_outputs, float3f{ 1.0F, 2.0F, 3.0F });
+	std::vector<float3f> output(num_outputs);
+
+	for (auto _ : state)
+	{
+		qvv_mul_point3_indexed_aos(transforms.data(), indices.data(), points.data(), output.data(), num_outputs, prefetch_distance);
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * num_outputs);
+}
+
+BENCHMARK(bm_qvv_mul_point3_indexed_aos)->Args({ 1024, 4096, 0 })->Args({ 1024, 4096, 16 })->Args({ 4 * 1024 * 1024, 1024 * 1024, 0 })->Args({ 4 * 1024 * 1024, 1024 * 1024, 16 });
+
+static void bm_qvv_mul_gather_loop(benchmark::State& state)
+{
+	const uint32_t num_transforms = uint32_t(state.range(0));
+	const uint32_t num_outputs = uint32_t(state.range(1));
+	const std::vector<qvvf> lhs = make_transforms(num_transforms);
+	const std::vector<qvvf> rhs = make_transforms(num_outputs);
+	const std::vector<uint32_t> indices = make_indices(num_transforms, num_outputs);
+	std::vector<qvvf> output(num_outputs);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < num_outputs; ++transform_index)
+			output[transform_index] = qvv_mul(lhs[indices[transform_index]], rhs[transform_index]);
+
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * num_outputs);
+}
+
+BENCHMARK(bm_qvv_mul_gather_loop)->Args({ 1024, 4096 })->Args({ 4 * 1024 * 1024, 1024 * 1024 });
+
+static void bm_qvv_mul_indexed_aos(benchmark::State& state)
+{
+	const uint32_t num_transforms = uint32_t(state.range(0));
+	const uint32_t num_outputs = uint32_t(state.range(1));
+	const uint32_t prefetch_distance = uint32_t(state.range(2));
+	const std::vector<qvvf> lhs = make_transforms(num_transforms);
+	const std::vector<qvvf> rhs = make_transforms(num_outputs);
+	const std::vector<uint32_t> indices = make_indices(num_transforms, num_outputs);
+	std::vector<qvvf> output(num_outputs);
+
+	for (auto _ : state)
+	{
+		qvv_mul_indexed_aos(lhs.data(), indices.data(), rhs.data(), output.data(), num_outputs, prefetch_distance);
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * num_outputs);
+}
+
+BENCHMARK(bm_qvv_mul_indexed_aos)->Args({ 1024, 4096, 0 })->Args({ 1024, 4096, 16 })->Args({ 4 * 1024 * 1024, 1024 * 1024, 0 })->Args({ 4 * 1024 * 1024, 1024 * 1024, 16 });
+
+static void bm_matrix_mul_indexed_aos(benchmark::State& state)
+{
+	const uint32_t num_transforms = uint32_t(state.range(0));
+	const uint32_t num_outputs = uint32_t(state.range(1));
+	const std::vector<qvvf> transforms = make_transforms(num_transforms);
+	const std::vector<uint32_t> indices = make_indices(num_transforms, num_outputs);
+
+	std::vector<matrix3x4f> lhs(num_transforms);
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		lhs[transform_index] = matrix_from_qvv(transforms[transform_index]);
+
+	const std::vector<matrix3x4f> rhs(num_outputs, matrix_identity());
+	std::vector<matrix3x4f> output(num_outputs);
+
+	for (auto _ : state)
+	{
+		matrix_mul_indexed_aos(lhs.data(), indices.data(), rhs.data(), output.data(), num_outputs);
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * num_outputs);
+}
+
+BENCHMARK(bm_matrix_mul_indexed_aos)->Args({ 1024, 4096 })->Args({ 4 * 1024 * 1024, 1024 * 1024 });
@@ -0,0 +1,179 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/batch/matrix3x4f.h>
+
+using namespace rtm;
+
+// Inverts a 256 bone palette per iteration
+constexpr uint32_t k_num_batch_matrices = 256;
+
+static void fill_bench_rigid_matrices(matrix3x4f* matrices)
+{
+	for (uint32_t matrix_index = 0; matrix_index < k_num_batch_matrices; ++matrix_index)
+	{
+		const float angle = float(matrix_index) * 0.37F;
+		matrices[matrix_index] = matrix_from_qvv(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, 1.0F - angle, angle * 0.5F), vector_set(1.0F));
+	}
+}
+
+// Latency: every inverse depends on the previous result
+static void bm_matrix3x4_inverse_latency(benchmark::State& state)
+{
+	matrix3x4f input[k_num_batch_matrices];
+	fill_bench_rigid_matrices(input);
+
+	matrix3x4f result = input[1];
+
+	for (auto _ : state)
+		result = matrix_inverse(result);
+
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_matrix3x4_inverse_latency);
+
+// Throughput: every inverse is independent
+static void bm_matrix3x4_inverse_loop(benchmark::State& state)
+{
+	matrix3x4f input[k_num_batch_matrices];
+	matrix3x4f output[k_num_batch_matrices];
+	fill_bench_rigid_matrices(input);
+
+	for (auto _ : state)
+	{
+		for (uint32_t matrix_index = 0; matrix_index < k_num_batch_matrices; ++matrix_index)
+			output[matrix_index] = matrix_inverse(input[matrix_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix3x4_inverse_loop);
+
+static void bm_matrix3x4_inverse_rigid_loop(benchmark::State& state)
+{
+	matrix3x4f input[k_num_batch_matrices];
+	matrix3x4f output[k_num_batch_matrices];
+	fill_bench_rigid_matrices(input);
+
+	for (auto _ : state)
+	{
+		for (uint32_t matrix_index = 0; matrix_index < k_num_batch_matrices; ++matrix_index)
+			output[matrix_index] = matrix_inverse_rigid(input[matrix_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix3x4_inverse_rigid_loop);
+
+static void bm_matrix3x4_inverse_rigid_aos(benchmark::State& state)
+{
+	matrix3x4f input[k_num_batch_matrices];
+	matrix3x4f output[k_num_batch_matrices];
+	fill_bench_rigid_matrices(input);
+
+	for (auto _ : state)
+	{
+		matrix_inverse_rigid_aos(input, output, k_num_batch_matrices);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix3x4_inverse_rigid_aos);
+
+static void bm_matrix3x4_inverse_uniform_scale_aos(benchmark::State& state)
+{
+	matrix3x4f input[k_num_batch_matrices];
+	matrix3x4f output[k_num_batch_matrices];
+	fill_bench_rigid_matrices(input);
+
+	for (auto _ : state)
+	{
+		matrix_inverse_uniform_scale_aos(input, output, k_num_batch_matrices);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix3x4_inverse_uniform_scale_aos);
+
+static void bm_matrix3x4_inverse_aos(benchmark::State& state)
+{
+	matrix3x4f input[k_num_batch_matrices];
+	matrix3x4f output[k_num_batch_matrices];
+	fill_bench_rigid_matrices(input);
+
+	for (auto _ : state)
+	{
+		matrix_inverse_aos(input, output, k_num_batch_matrices);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix3x4_inverse_aos);
+
+static void bm_matrix3x4_inverse_fallback_aos(benchmark::State& state)
+{
+	matrix3x4f input[k_num_batch_matrices];
+	matrix3x4f output[k_num_batch_matrices];
+	fill_bench_rigid_matrices(input);
+
+	const matrix3x4f fallback = matrix_identity();
+
+	for (auto _ : state)
+	{
+		matrix_inverse_aos(input, output, k_num_batch_matrices, fallback);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix3x4_inverse_fallback_aos);
@@ -0,0 +1,223 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix4x4f.h>
+#include <rtm/matrix4x4x8f.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/matrix4x4f.h>
+
+using namespace rtm;
+
+// Processes 256 matrices per iteration for the throughput variants
+constexpr uint32_t k_num_batch_matrices = 256;
+
+static void fill_bench_matrices(matrix4x4f* lhs, matrix4x4f* rhs)
+{
+	for (uint32_t matrix_index = 0; matrix_index < k_num_batch_matrices; ++matrix_index)
+	{
+		const float angle = float(matrix_index) * 0.37F;
+		const vector4f translation = vector_set(angle, 1.0F - angle, angle * 0.5F);
+		lhs[matrix_index] = matrix_cast(matrix_from_qvv(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), translation, vector_set(1.0F, 1.5F, 0.5F)));
+		rhs[matrix_index] = matrix_cast(matrix_from_qvv(quat_from_euler(0.2F - angle, angle, angle * 0.5F), vector_neg(translation), vector_set(1.0F)));
+	}
+}
+
+// Latency: every multiplication depends on the previous result
+static void bm_matrix4x4_mul_latency(benchmark::State& state)
+{
+	matrix4x4f lhs[k_num_batch_matrices];
+	matrix4x4f rhs[k_num_batch_matrices];
+	fill_bench_matrices(lhs, rhs);
+
+	matrix4x4f result = lhs[0];
+	const matrix4x4f delta = rhs[1];
+
+	for (auto _ : state)
+		result = matrix_mul(result, delta);
+
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_matrix4x4_mul_latency);
+
+// Throughput: every multiplication is independent
+static void bm_matrix4x4_mul_loop(benchmark::State& state)
+{
+	matrix4x4f lhs[k_num_batch_matrices];
+	matrix4x4f rhs[k_num_batch_matrices];
+	matrix4x4f output[k_num_batch_matrices];
+	fill_bench_matrices(lhs, rhs);
+
+	for (auto _ : state)
+	{
+		for (uint32_t matrix_index = 0; matrix_index < k_num_batch_matrices; ++matrix_index)
+			output[matrix_index] = matrix_mul(lhs[matrix_index], rhs[matrix_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix4x4_mul_loop);
+
+// Latency: every inverse depends on the previous result
+static void bm_matrix4x4_inverse_latency(benchmark::State& state)
+{
+	matrix4x4f lhs[k_num_batch_matrices];
+	matrix4x4f rhs[k_num_batch_matrices];
+	fill_bench_matrices(lhs, rhs);
+
+	matrix4x4f result = lhs[1];
+
+	for (auto _ : state)
+		result = matrix_inverse(result);
+
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_matrix4x4_inverse_latency);
+
+// Throughput: every inverse is independent
+static void bm_matrix4x4_inverse_loop(benchmark::State& state)
+{
+	matrix4x4f input[k_num_batch_matrices];
+	matrix4x4f unused[k_num_batch_matrices];
+	matrix4x4f output[k_num_batch_matrices];
+	fill_bench_matrices(input, unused);
+
+	for (auto _ : state)
+	{
+		for (uint32_t matrix_index = 0; matrix_index < k_num_batch_matrices; ++matrix_index)
+			output[matrix_index] = matrix_inverse(input[matrix_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix4x4_inverse_loop);
+
+static void bm_matrix4x4_inverse_aos(benchmark::State& state)
+{
+	matrix4x4f input[k_num_batch_matrices];
+	matrix4x4f unused[k_num_batch_matrices];
+	matrix4x4f output[k_num_batch_matrices];
+	fill_bench_matrices(input, unused);
+
+	for (auto _ : state)
+	{
+		matrix_inverse_aos(input, output, k_num_batch_matrices);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix4x4_inverse_aos);
+
+// The matrices stay as structure of arrays between operations
+static void bm_matrix4x4x8_mul(benchmark::State& state)
+{
+	matrix4x4f lhs[k_num_batch_matrices];
+	matrix4x4f rhs[k_num_batch_matrices];
+	fill_bench_matrices(lhs, rhs);
+
+	matrix4x4x8f lhs8[k_num_batch_matrices / 8];
+	matrix4x4x8f rhs8[k_num_batch_matrices / 8];
+	matrix4x4x8f output[k_num_batch_matrices / 8];
+	for (uint32_t group_index = 0; group_index < k_num_batch_matrices / 8; ++group_index)
+	{
+		lhs8[group_index] = matrix4x4x8_load(lhs + group_index * 8);
+		rhs8[group_index] = matrix4x4x8_load(rhs + group_index * 8);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t group_index = 0; group_index < k_num_batch_matrices / 8; ++group_index)
+			output[group_index] = matrix_mul(lhs8[group_index], rhs8[group_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix4x4x8_mul);
+
+static void bm_matrix4x4x8_inverse(benchmark::State& state)
+{
+	matrix4x4f input[k_num_batch_matrices];
+	matrix4x4f unused[k_num_batch_matrices];
+	fill_bench_matrices(input, unused);
+
+	matrix4x4x8f input8[k_num_batch_matrices / 8];
+	matrix4x4x8f output[k_num_batch_matrices / 8];
+	for (uint32_t group_index = 0; group_index < k_num_batch_matrices / 8; ++group_index)
+		input8[group_index] = matrix4x4x8_load(input + group_index * 8);
+
+	for (auto _ : state)
+	{
+		for (uint32_t group_index = 0; group_index < k_num_batch_matrices / 8; ++group_index)
+			output[group_index] = matrix_inverse(input8[group_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix4x4x8_inverse);
+
+// Converting from and to matrix4x4f around each multiplication
+static void bm_matrix4x4x8_mul_aos(benchmark::State& state)
+{
+	matrix4x4f lhs[k_num_batch_matrices];
+	matrix4x4f rhs[k_num_batch_matrices];
+	matrix4x4f output[k_num_batch_matrices];
+	fill_bench_matrices(lhs, rhs);
+
+	for (auto _ : state)
+	{
+		for (uint32_t matrix_index = 0; matrix_index < k_num_batch_matrices; matrix_index += 8)
+			matrix_store(matrix_mul(matrix4x4x8_load(lhs + matrix_index), matrix4x4x8_load(rhs + matrix_index)), output + matrix_index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_matrices);
+}
+
+BENCHMARK(bm_matrix4x4x8_mul_aos);
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/matrix3x4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_matrices = 4096;
+
+struct matrices_data
+{
+	matrix3x4f input[k_num_matrices];
+	matrix3x4f output[k_num_matrices];
+};
+
+static matrices_data g_matrices;
+
+static void fill_matrices(matrices_data& data)
+{
+	for (uint32_t index = 0; index < k_num_matrices; ++index)
+	{
+		// Matrices that drifted after being composed repeatedly
+		const float value = float(index % 97) * 0.03F;
+		matrix3x4f mtx = matrix_from_qvv(quat_from_euler(value - 1.5F, 0.4F - value * 0.5F, value * 0.7F - 1.0F), vector_set(value, 1.0F, -value), vector_set(1.0F + value * 0.01F));
+		mtx.y_axis = vector_mul_add(mtx.x_axis, value * 0.01F, mtx.y_axis);
+		data.input[index] = mtx;
+	}
+}
+
+RTM_FORCE_NOINLINE matrix3x4f RTM_SIMD_CALL matrix_orthonormalize_scalar(const matrix3x4f& input) RTM_NO_EXCEPT
+{
+	// The naive version with one component at a time
+	float4f x;
+	float4f y;
+	float4f z;
+	vector_store(input.x_axis, &x);
+	vector_store(input.y_axis, &y);
+	vector_store(input.z_axis, &z);
+
+	const float inv_x_length = 1.0F / scalar_sqrt(x.x * x.x + x.y * x.y + x.z * x.z);
+	x.x *= inv_x_length;
+	x.y *= inv_x_length;
+	x.z *= inv_x_length;
+
+	const float y_dot_x = y.x * x.x + y.y * x.y + y.z * x.z;
+	y.x -= x.x * y_dot_x;
+	y.y -= x.y * y_dot_x;
+	y.z -= x.z * y_dot_x;
+
+	const float inv_y_length = 1.0F / scalar_sqrt(y.x * y.x + y.y * y.y + y.z * y.z);
+	y.x *= inv_y_length;
+	y.y *= inv_y_length;
+	y.z *= inv_y_length;
+
+	const float z_x = x.y * y.z - x.z * y.y;
+	const float z_y = x.z * y.x - x.x * y.z;
+	const float z_z = x.x * y.y - x.y * y.x;
+	const float z_sign = (z.x * z_x + z.y * z_y + z.z * z_z) >= 0.0F ? 1.0F : -1.0F;
+
+	matrix3x4f result;
+	result.x_axis = vector_set(x.x, x.y, x.z, 0.0F);
+	result.y_axis = vector_set(y.x, y.y, y.z, 0.0F);
+	result.z_axis = vector_set(z_x * z_sign, z_y * z_sign, z_z * z_sign, 0.0F);
+	result.w_axis = input.w_axis;
+	return result;
+}
+
+RTM_FORCE_NOINLINE matrix3x4f RTM_SIMD_CALL matrix_orthonormalize_rtm(const matrix3x4f& input) RTM_NO_EXCEPT
+{
+	return matrix_orthonormalize(input);
+}
+
+RTM_FORCE_NOINLINE matrix3x4f RTM_SIMD_CALL matrix_orthonormalize_polar_rtm(const matrix3x4f& input) RTM_NO_EXCEPT
+{
+	return matrix_orthonormalize_polar(input);
+}
+
+static void bm_matrix_orthonormalize_scalar(benchmark::State& state)
+{
+	fill_matrices(g_matrices);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_matrices; ++index)
+			g_matrices.output[index] = matrix_orthonormalize_scalar(g_matrices.input[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_matrices.output);
+	state.SetItemsProcessed(state.iterations() * k_num_matrices);
+}
+
+BENCHMARK(bm_matrix_orthonormalize_scalar);
+
+static void bm_matrix_orthonormalize_loop(benchmark::State& state)
+{
+	fill_matrices(g_matrices);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_matrices; ++index)
+			g_matrices.output[index] = matrix_orthonormalize_rtm(g_matrices.input[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_matrices.output);
+	state.SetItemsProcessed(state.iterations() * k_num_matrices);
+}
+
+BENCHMARK(bm_matrix_orthonormalize_loop);
+
+static void bm_matrix_orthonormalize_aos(benchmark::State& state)
+{
+	fill_matrices(g_matrices);
+
+	for (auto _ : state)
+	{
+		matrix_orthonormalize_aos(g_matrices.input, g_matrices.output, k_num_matrices);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_matrices.output);
+	state.SetItemsProcessed(state.iterations() * k_num_matrices);
+}
+
+BENCHMARK(bm_matrix_orthonormalize_aos);
+
+static void bm_matrix_orthonormalize_polar_loop(benchmark::State& state)
+{
+	fill_matrices(g_matrices);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_matrices; ++index)
+			g_matrices.output[index] = matrix_orthonormalize_polar_rtm(g_matrices.input[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_matrices.output);
+	state.SetItemsProcessed(state.iterations() * k_num_matrices);
+}
+
+BENCHMARK(bm_matrix_orthonormalize_polar_loop);
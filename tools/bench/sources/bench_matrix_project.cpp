@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix4x4f.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/matrix4x4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_project_points = 16384;
+
+struct project_bench_data
+{
+	float3f points[k_num_project_points];
+	float3f ndc_points[k_num_project_points];
+	alignas(32) float points_x[k_num_project_points];
+	alignas(32) float points_y[k_num_project_points];
+	alignas(32) float points_z[k_num_project_points];
+	alignas(32) float ndc_x[k_num_project_points];
+	alignas(32) float ndc_y[k_num_project_points];
+	alignas(32) float ndc_z[k_num_project_points];
+	uint32_t visible_bits[k_num_project_points / 32];
+};
+
+static project_bench_data g_project_data;
+
+static matrix4x4f make_bench_projection()
+{
+	// 90 degree field of view looking down +Z with the near plane at 1.0 and the far plane at 100.0
+	const float depth_scale = 100.0F / 99.0F;
+	return matrix_set(
+		vector_set(1.0F, 0.0F, 0.0F, 0.0F),
+		vector_set(0.0F, 1.0F, 0.0F, 0.0F),
+		vector_set(0.0F, 0.0F, depth_scale, 1.0F),
+		vector_set(0.0F, 0.0F, -depth_scale, 0.0F));
+}
+
+static void fill_project_data(project_bench_data& data)
+{
+	for (uint32_t index = 0; index < k_num_project_points; ++index)
+	{
+		const float value = float(index);
+		data.points[index] = float3f{ scalar_sin(value * 0.37F) * 120.0F, scalar_cos(value * 0.73F) * 80.0F, float(index % 150) - 20.5F };
+		data.points_x[index] = data.points[index].x;
+		data.points_y[index] = data.points[index].y;
+		data.points_z[index] = data.points[index].z;
+	}
+}
+
+static void bm_matrix_project_points_loop(benchmark::State& state)
+{
+	const matrix4x4f projection = make_bench_projection();
+	fill_project_data(g_project_data);
+
+	for (auto _ : state)
+	{
+		// One point at a time, the reference for the batched version
+		for (uint32_t index = 0; index < k_num_project_points; ++index)
+		{
+			const float3f& point = g_project_data.points[index];
+			const vector4f clip = matrix_mul_vector(vector_set(point.x, point.y, point.z, 1.0F), projection);
+			vector_store3(vector_div(clip, vector_dup_w(clip)), &g_project_data.ndc_points[index]);
+
+			const float clip_z = vector_get_z(clip);
+			const uint32_t is_visible = clip_z >= 0.0F && clip_z <= vector_get_w(clip) ? 1 : 0;
+			if (index % 32 == 0)
+				g_project_data.visible_bits[index / 32] = 0;
+			g_project_data.visible_bits[index / 32] |= is_visible << (index % 32);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_project_data.ndc_points);
+	state.SetItemsProcessed(state.iterations() * k_num_project_points);
+}
+
+BENCHMARK(bm_matrix_project_points_loop);
+
+static void bm_matrix_project_points_aos(benchmark::State& state)
+{
+	const matrix4x4f projection = make_bench_projection();
+	fill_project_data(g_project_data);
+
+	for (auto _ : state)
+	{
+		matrix_project_points_aos(g_project_data.points, projection, g_project_data.ndc_points, g_project_data.visible_bits, k_num_project_points);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_project_data.ndc_points);
+	state.SetItemsProcessed(state.iterations() * k_num_project_points);
+}
+
+BENCHMARK(bm_matrix_project_points_aos);
+
+static void bm_matrix_project_points_soa(benchmark::State& state)
+{
+	const matrix4x4f projection = make_bench_projection();
+	fill_project_data(g_project_data);
+
+	const const_float3f_soa points{ g_project_data.points_x, g_project_data.points_y, g_project_data.points_z };
+	const float3f_soa output{ g_project_data.ndc_x, g_project_data.ndc_y, g_project_data.ndc_z };
+
+	for (auto _ : state)
+	{
+		matrix_project_points_soa(points, projection, output, g_project_data.visible_bits, k_num_project_points);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_project_data.ndc_x);
+	state.SetItemsProcessed(state.iterations() * k_num_project_points);
+}
+
+BENCHMARK(bm_matrix_project_points_soa);
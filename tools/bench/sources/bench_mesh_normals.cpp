@@ -0,0 +1,140 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/mesh.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+// A bent grid of 128 x 128 vertices, like a cloth simulation output
+static constexpr uint32_t k_grid_size = 128;
+static constexpr uint32_t k_num_vertices = k_grid_size * k_grid_size;
+static constexpr uint32_t k_num_faces = (k_grid_size - 1) * (k_grid_size - 1) * 2;
+
+struct mesh_data
+{
+	mesh_data()
+		: positions(k_num_vertices * 3)
+		, indices()
+		, offsets(k_num_vertices + 1)
+		, face_indices(k_num_faces * 3)
+		, face_normals(k_num_faces)
+		, normals(k_num_vertices * 3)
+		, accumulated_normals(k_num_vertices)
+		, normals_aos(k_num_vertices)
+	{
+		for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+		{
+			const float column = float(vertex_index % k_grid_size);
+			const float row = float(vertex_index / k_grid_size);
+			positions[vertex_index] = column;
+			positions[vertex_index + k_num_vertices] = row;
+			positions[vertex_index + k_num_vertices * 2] = scalar_sin(column * 0.1F) * scalar_cos(row * 0.07F) * 4.0F;
+
+			if (column + 1.0F < float(k_grid_size) && row + 1.0F < float(k_grid_size))
+			{
+				const uint32_t cell_indices[] = { vertex_index, vertex_index + 1, vertex_index + k_grid_size + 1, vertex_index, vertex_index + k_grid_size + 1, vertex_index + k_grid_size };
+				indices.insert(indices.end(), cell_indices, cell_indices + 6);
+			}
+		}
+
+		mesh_build_vertex_faces(indices.data(), k_num_faces, k_num_vertices, offsets.data(), face_indices.data());
+	}
+
+	std::vector<float> positions;
+	std::vector<uint32_t> indices;
+	std::vector<uint32_t> offsets;
+	std::vector<uint32_t> face_indices;
+	std::vector<float4f> face_normals;
+	std::vector<float> normals;
+	std::vector<float4f> accumulated_normals;
+	std::vector<float3f> normals_aos;
+};
+
+static void bm_mesh_normals_scatter(benchmark::State& state)
+{
+	mesh_data mesh;
+	const float* positions_x = &mesh.positions[0];
+	const float* positions_y = &mesh.positions[k_num_vertices];
+	const float* positions_z = &mesh.positions[k_num_vertices * 2];
+
+	for (auto _ : state)
+	{
+		// The usual approach: one cross product per face added to its 3 vertices, then one normalization per vertex
+		for (float4f& normal : mesh.accumulated_normals)
+			vector_store(vector_zero(), &normal);
+
+		for (uint32_t face_index = 0; face_index < k_num_faces; ++face_index)
+		{
+			const uint32_t* face = &mesh.indices[face_index * 3];
+			const vector4f position0 = vector_set(positions_x[face[0]], positions_y[face[0]], positions_z[face[0]]);
+			const vector4f position1 = vector_set(positions_x[face[1]], positions_y[face[1]], positions_z[face[1]]);
+			const vector4f position2 = vector_set(positions_x[face[2]], positions_y[face[2]], positions_z[face[2]]);
+			const vector4f face_normal = vector_cross3(vector_sub(position1, position0), vector_sub(position2, position0));
+
+			for (uint32_t corner = 0; corner < 3; ++corner)
+			{
+				float4f& normal = mesh.accumulated_normals[face[corner]];
+				vector_store(vector_add(vector_load(&normal), face_normal), &normal);
+			}
+		}
+
+		for (uint32_t vertex_index = 0; vertex_index < k_num_vertices; ++vertex_index)
+			vector_store3(vector_normalize3(vector_load(&mesh.accumulated_normals[vertex_index])), &mesh.normals_aos[vertex_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(mesh.normals_aos.data());
+	state.SetItemsProcessed(state.iterations() * k_num_vertices);
+}
+
+BENCHMARK(bm_mesh_normals_scatter);
+
+static void bm_mesh_normals_soa(benchmark::State& state)
+{
+	mesh_data mesh;
+	const const_float3f_soa positions{ &mesh.positions[0], &mesh.positions[k_num_vertices], &mesh.positions[k_num_vertices * 2] };
+	const float3f_soa normals{ &mesh.normals[0], &mesh.normals[k_num_vertices], &mesh.normals[k_num_vertices * 2] };
+	const mesh_vertex_faces vertex_faces{ mesh.offsets.data(), mesh.face_indices.data() };
+
+	for (auto _ : state)
+	{
+		mesh_face_normals_soa(positions, mesh.indices.data(), mesh.face_normals.data(), k_num_faces);
+		mesh_vertex_normals_soa(mesh.face_normals.data(), vertex_faces, normals, k_num_vertices);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(mesh.normals.data());
+	state.SetItemsProcessed(state.iterations() * k_num_vertices);
+}
+
+BENCHMARK(bm_mesh_normals_soa);
@@ -0,0 +1,254 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/noise.h>
+#include <rtm/batch/noise.h>
+
+#include <cmath>
+#include <cstdint>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_noise_samples = 1024;
+
+// The scalar baseline: Ken Perlin's reference improved noise with its permutation table
+static uint8_t s_noise_permutation[512];
+
+static void init_noise_permutation()
+{
+	uint32_t state = 1234;
+	for (uint32_t index = 0; index < 256; ++index)
+		s_noise_permutation[index] = uint8_t(index);
+
+	for (uint32_t index = 255; index > 0; --index)
+	{
+		state = state * 1664525U + 1013904223U;
+		const uint32_t swap_index = (state >> 8) % (index + 1);
+		const uint8_t value = s_noise_permutation[index];
+		s_noise_permutation[index] = s_noise_permutation[swap_index];
+		s_noise_permutation[swap_index] = value;
+	}
+
+	for (uint32_t index = 0; index < 256; ++index)
+		s_noise_permutation[index + 256] = s_noise_permutation[index];
+}
+
+static float reference_fade(float t) { return t * t * t * (t * (t * 6.0F - 15.0F) + 10.0F); }
+static float reference_lerp(float t, float a, float b) { return a + t * (b - a); }
+
+static float reference_grad(int hash, float x, float y, float z)
+{
+	const int h = hash & 15;
+	const float u = h < 8 ? x : y;
+	const float v = h < 4 ? y : (h == 12 || h == 14 ? x : z);
+	return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
+}
+
+static float reference_perlin3(float x, float y, float z)
+{
+	const float floor_x = std::floor(x);
+	const float floor_y = std::floor(y);
+	const float floor_z = std::floor(z);
+	const int X = int(floor_x) & 255;
+	const int Y = int(floor_y) & 255;
+	const int Z = int(floor_z) & 255;
+	x -= floor_x;
+	y -= floor_y;
+	z -= floor_z;
+
+	const float u = reference_fade(x);
+	const float v = reference_fade(y);
+	const float w = reference_fade(z);
+
+	const uint8_t* p = s_noise_permutation;
+	const int A = p[X] + Y;
+	const int AA = p[A] + Z;
+	const int AB = p[A + 1] + Z;
+	const int B = p[X + 1] + Y;
+	const int BA = p[B] + Z;
+	const int BB = p[B + 1] + Z;
+
+	return reference_lerp(w,
+		reference_lerp(v, reference_lerp(u, reference_grad(p[AA], x, y, z), reference_grad(p[BA], x - 1.0F, y, z)),
+			reference_lerp(u, reference_grad(p[AB], x, y - 1.0F, z), reference_grad(p[BB], x - 1.0F, y - 1.0F, z))),
+		reference_lerp(v, reference_lerp(u, reference_grad(p[AA + 1], x, y, z - 1.0F), reference_grad(p[BA + 1], x - 1.0F, y, z - 1.0F)),
+			reference_lerp(u, reference_grad(p[AB + 1], x, y - 1.0F, z - 1.0F), reference_grad(p[BB + 1], x - 1.0F, y - 1.0F, z - 1.0F))));
+}
+
+static void make_noise_positions(float* x, float* y, float* z, float* w)
+{
+	for (uint32_t index = 0; index < k_num_noise_samples; ++index)
+	{
+		x[index] = std::fmod(float(index) * 0.7548777F, 100.0F) - 50.0F;
+		y[index] = std::fmod(float(index) * 0.5698403F, 100.0F) - 50.0F;
+		z[index] = std::fmod(float(index) * 0.3141593F, 100.0F) - 50.0F;
+		w[index] = std::fmod(float(index) * 0.1618034F, 100.0F) - 50.0F;
+	}
+}
+
+static void bm_noise_perlin3_reference(benchmark::State& state)
+{
+	init_noise_permutation();
+
+	float x[k_num_noise_samples];
+	float y[k_num_noise_samples];
+	float z[k_num_noise_samples];
+	float w[k_num_noise_samples];
+	make_noise_positions(x, y, z, w);
+
+	float output[k_num_noise_samples];
+
+	benchmark::DoNotOptimize(x);
+	benchmark::DoNotOptimize(y);
+	benchmark::DoNotOptimize(z);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_noise_samples; ++index)
+			output[index] = reference_perlin3(x[index], y[index], z[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_noise_samples);
+}
+
+BENCHMARK(bm_noise_perlin3_reference);
+
+static void bm_noise_perlin3_loop(benchmark::State& state)
+{
+	float x[k_num_noise_samples];
+	float y[k_num_noise_samples];
+	float z[k_num_noise_samples];
+	float w[k_num_noise_samples];
+	make_noise_positions(x, y, z, w);
+
+	float output[k_num_noise_samples];
+
+	benchmark::DoNotOptimize(x);
+	benchmark::DoNotOptimize(y);
+	benchmark::DoNotOptimize(z);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_noise_samples; index += 4)
+			vector_store(noise_perlin3(vector_load(x + index), vector_load(y + index), vector_load(z + index)), output + index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_noise_samples);
+}
+
+BENCHMARK(bm_noise_perlin3_loop);
+
+static void bm_noise_perlin3_soa(benchmark::State& state)
+{
+	float x[k_num_noise_samples];
+	float y[k_num_noise_samples];
+	float z[k_num_noise_samples];
+	float w[k_num_noise_samples];
+	make_noise_positions(x, y, z, w);
+
+	float output[k_num_noise_samples];
+
+	benchmark::DoNotOptimize(x);
+	benchmark::DoNotOptimize(y);
+	benchmark::DoNotOptimize(z);
+
+	for (auto _ : state)
+	{
+		noise_perlin3_soa(const_float3f_soa{ x, y, z }, output, k_num_noise_samples);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_noise_samples);
+}
+
+BENCHMARK(bm_noise_perlin3_soa);
+
+static void bm_noise_perlin4_soa(benchmark::State& state)
+{
+	float x[k_num_noise_samples];
+	float y[k_num_noise_samples];
+	float z[k_num_noise_samples];
+	float w[k_num_noise_samples];
+	make_noise_positions(x, y, z, w);
+
+	float output[k_num_noise_samples];
+
+	benchmark::DoNotOptimize(x);
+	benchmark::DoNotOptimize(y);
+	benchmark::DoNotOptimize(z);
+	benchmark::DoNotOptimize(w);
+
+	for (auto _ : state)
+	{
+		noise_perlin4_soa(const_float4f_soa{ x, y, z, w }, output, k_num_noise_samples);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_noise_samples);
+}
+
+BENCHMARK(bm_noise_perlin4_soa);
+
+static void bm_noise_fbm3_soa(benchmark::State& state)
+{
+	float x[k_num_noise_samples];
+	float y[k_num_noise_samples];
+	float z[k_num_noise_samples];
+	float w[k_num_noise_samples];
+	make_noise_positions(x, y, z, w);
+
+	float output[k_num_noise_samples];
+
+	noise_fractal_settings settings;
+	settings.num_octaves = 4;
+
+	benchmark::DoNotOptimize(x);
+	benchmark::DoNotOptimize(y);
+	benchmark::DoNotOptimize(z);
+
+	for (auto _ : state)
+	{
+		noise_fbm3_soa(const_float3f_soa{ x, y, z }, output, k_num_noise_samples, settings);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_noise_samples);
+}
+
+BENCHMARK(bm_noise_fbm3_soa);
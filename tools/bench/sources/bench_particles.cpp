@@ -0,0 +1,136 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/batch/particles.h>
+
+#include <vector>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_bench_particles = 16 * 1024;
+
+static particle_integration_settings get_bench_settings(const vector4f* planes)
+{
+	particle_integration_settings settings;
+	settings.acceleration = { 0.0F, 0.0F, -9.81F };
+	settings.max_velocity = { 10.0F, 10.0F, 50.0F };
+	settings.delta_time = 1.0F / 60.0F;
+	// Without drag, the velocities of the same particles stepped millions of times never decay into denormals
+	settings.drag = 0.0F;
+	settings.restitution = 0.3F;
+	settings.collision_planes = planes;
+	settings.num_collision_planes = 2;
+	return settings;
+}
+
+static void bm_particle_euler_aos_loop(benchmark::State& state)
+{
+	// The typical hand written loop: one particle at a time with vector4f positions and velocities
+	const vector4f planes[2] = { vector_set(0.0F, 0.0F, 1.0F, 0.0F), vector_set(-0.6F, 0.0F, 0.8F, 20.0F) };
+	const particle_integration_settings settings = get_bench_settings(planes);
+
+	std::vector<float4f> positions(k_num_bench_particles);
+	std::vector<float4f> velocities(k_num_bench_particles);
+	for (uint32_t particle_index = 0; particle_index < k_num_bench_particles; ++particle_index)
+	{
+		vector_store(vector_set(float(particle_index % 64), float(particle_index / 64), 10.0F, 0.0F), &positions[particle_index]);
+		vector_store(vector_set(1.0F, -1.0F, 5.0F, 0.0F), &velocities[particle_index]);
+	}
+
+	const vector4f acceleration = vector_load3(&settings.acceleration);
+	const vector4f max_velocity = vector_load3(&settings.max_velocity);
+	const float drag_factor = scalar_max(1.0F - settings.drag * settings.delta_time, 0.0F);
+
+	for (auto _ : state)
+	{
+		for (uint32_t particle_index = 0; particle_index < k_num_bench_particles; ++particle_index)
+		{
+			vector4f velocity = vector_mul_add(vector_load(&velocities[particle_index]), drag_factor, vector_mul(acceleration, settings.delta_time));
+			velocity = vector_clamp(velocity, vector_neg(max_velocity), max_velocity);
+			vector4f position = vector_mul_add(velocity, settings.delta_time, vector_load(&positions[particle_index]));
+
+			for (const vector4f& plane : planes)
+			{
+				const float distance = float(vector_dot3(plane, position)) + float(vector_get_w(plane));
+				if (distance < 0.0F)
+				{
+					position = vector_neg_mul_sub(plane, distance, position);
+					const float normal_velocity = vector_dot3(plane, velocity);
+					if (normal_velocity < 0.0F)
+						velocity = vector_neg_mul_sub(plane, normal_velocity * (1.0F + settings.restitution), velocity);
+				}
+			}
+
+			vector_store(position, &positions[particle_index]);
+			vector_store(velocity, &velocities[particle_index]);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(positions.data());
+	state.SetItemsProcessed(state.iterations() * k_num_bench_particles);
+}
+
+BENCHMARK(bm_particle_euler_aos_loop);
+
+static void bm_particle_integrate_soa(benchmark::State& state, bool is_verlet)
+{
+	const vector4f planes[2] = { vector_set(0.0F, 0.0F, 1.0F, 0.0F), vector_set(-0.6F, 0.0F, 0.8F, 20.0F) };
+	const particle_integration_settings settings = get_bench_settings(planes);
+
+	std::vector<float> streams(k_num_bench_particles * 6);
+	float* data = streams.data();
+	const float3f_soa positions = { data, data + k_num_bench_particles, data + k_num_bench_particles * 2 };
+	const float3f_soa motions = { data + k_num_bench_particles * 3, data + k_num_bench_particles * 4, data + k_num_bench_particles * 5 };
+	for (uint32_t particle_index = 0; particle_index < k_num_bench_particles; ++particle_index)
+	{
+		positions.x[particle_index] = float(particle_index % 64);
+		positions.y[particle_index] = float(particle_index / 64);
+		positions.z[particle_index] = 10.0F;
+		motions.x[particle_index] = is_verlet ? positions.x[particle_index] - settings.delta_time : 1.0F;
+		motions.y[particle_index] = is_verlet ? positions.y[particle_index] + settings.delta_time : -1.0F;
+		motions.z[particle_index] = is_verlet ? positions.z[particle_index] - settings.delta_time * 5.0F : 5.0F;
+	}
+
+	const const_float3f_soa no_accelerations = { nullptr, nullptr, nullptr };
+
+	for (auto _ : state)
+	{
+		if (is_verlet)
+			particle_integrate_verlet_soa(positions, motions, no_accelerations, settings, k_num_bench_particles);
+		else
+			particle_integrate_euler_soa(positions, motions, no_accelerations, settings, k_num_bench_particles);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(data);
+	state.SetItemsProcessed(state.iterations() * k_num_bench_particles);
+}
+
+BENCHMARK_CAPTURE(bm_particle_integrate_soa, euler, false);
+BENCHMARK_CAPTURE(bm_particle_integrate_soa, verlet, true);
@@ -0,0 +1,220 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+
+#if defined(__linux__)
+	#include <linux/perf_event.h>
+	#include <sys/ioctl.h>
+	#include <sys/syscall.h>
+	#include <unistd.h>
+
+	#define RTM_BENCH_PERF_COUNTERS_SUPPORTED
+#endif
+
+//////////////////////////////////////////////////////////////////////////
+// Hardware performance counters reported as benchmark user counters.
+//
+// Wall time alone does not tell whether a kernel is bound by latency, throughput, or memory.
+// With --rtm_perf_counters on the rtm_bench command line, the benchmarks that measure their loop
+// with a bench_perf_counters instance also report per element: the cycles, the instructions
+// retired, the L1 data cache read misses, and the last level cache read misses, along with
+// the instructions per cycle:
+//
+//     bench_perf_counters counters;
+//     for (auto _ : state) { ... }
+//     counters.report(state, num_elements);
+//
+// Only Linux is supported, through perf_event_open. Only user space events of the calling thread
+// are counted. Counters the CPU, the kernel, or a virtual machine does not expose are omitted:
+// lower /proc/sys/kernel/perf_event_paranoid if none are reported. Elsewhere, nothing is reported.
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// Returns whether the counters were requested on the command line.
+//////////////////////////////////////////////////////////////////////////
+inline bool& bench_perf_counters_enabled()
+{
+	static bool s_enabled = false;
+	return s_enabled;
+}
+
+class bench_perf_counters
+{
+public:
+	//////////////////////////////////////////////////////////////////////////
+	// Opens the counters and starts counting when they are enabled.
+	bench_perf_counters()
+	{
+		for (uint32_t event_index = 0; event_index < k_num_events; ++event_index)
+			m_fds[event_index] = -1;
+
+#if defined(RTM_BENCH_PERF_COUNTERS_SUPPORTED)
+		if (!bench_perf_counters_enabled())
+			return;
+
+		for (uint32_t event_index = 0; event_index < k_num_events; ++event_index)
+			m_fds[event_index] = open_event(event_index);
+
+		for (uint32_t event_index = 0; event_index < k_num_events; ++event_index)
+		{
+			if (m_fds[event_index] >= 0)
+				ioctl(m_fds[event_index], PERF_EVENT_IOC_ENABLE, 0);
+		}
+#endif
+	}
+
+	~bench_perf_counters()
+	{
+#if defined(RTM_BENCH_PERF_COUNTERS_SUPPORTED)
+		for (uint32_t event_index = 0; event_index < k_num_events; ++event_index)
+		{
+			if (m_fds[event_index] >= 0)
+				close(m_fds[event_index]);
+		}
+#endif
+	}
+
+	bench_perf_counters(const bench_perf_counters&) = delete;
+	bench_perf_counters& operator=(const bench_perf_counters&) = delete;
+
+	//////////////////////////////////////////////////////////////////////////
+	// Stops counting and adds the counters to the benchmark, divided by the number of
+	// elements processed: 'num_elements' per iteration.
+	void report(benchmark::State& state, int64_t num_elements)
+	{
+#if defined(RTM_BENCH_PERF_COUNTERS_SUPPORTED)
+		double values[k_num_events];
+		bool is_valid[k_num_events];
+		for (uint32_t event_index = 0; event_index < k_num_events; ++event_index)
+		{
+			is_valid[event_index] = false;
+			values[event_index] = 0.0;
+
+			if (m_fds[event_index] < 0)
+				continue;
+
+			ioctl(m_fds[event_index], PERF_EVENT_IOC_DISABLE, 0);
+
+			// The kernel multiplexes events when there are more than hardware counters, scale them
+			// by the fraction of the time they were counted
+			uint64_t read_values[3];
+			if (read(m_fds[event_index], read_values, sizeof(read_values)) != ssize_t(sizeof(read_values)) || read_values[2] == 0)
+				continue;
+
+			values[event_index] = double(read_values[0]) * (double(read_values[1]) / double(read_values[2]));
+			is_valid[event_index] = true;
+		}
+
+		const double num_total_elements = double(state.iterations()) * double(num_elements);
+		if (num_total_elements <= 0.0)
+			return;
+
+		static const char* k_counter_names[k_num_events] = { "cycles_per_elem", "instructions_per_elem", "l1d_misses_per_elem", "llc_misses_per_elem" };
+		for (uint32_t event_index = 0; event_index < k_num_events; ++event_index)
+		{
+			if (is_valid[event_index])
+				state.counters[k_counter_names[event_index]] = values[event_index] / num_total_elements;
+		}
+
+		if (is_valid[k_cycles] && is_valid[k_instructions] && values[k_cycles] > 0.0)
+			state.counters["ipc"] = values[k_instructions] / values[k_cycles];
+#else
+		(void)state;
+		(void)num_elements;
+#endif
+	}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Returns whether the cycle counter can be opened on this machine.
+	static bool is_supported()
+	{
+#if defined(RTM_BENCH_PERF_COUNTERS_SUPPORTED)
+		const int fd = open_event(k_cycles);
+		if (fd < 0)
+			return false;
+
+		close(fd);
+		return true;
+#else
+		return false;
+#endif
+	}
+
+private:
+	enum event_type : uint32_t
+	{
+		k_cycles,
+		k_instructions,
+		k_l1d_misses,
+		k_llc_misses,
+
+		k_num_events,
+	};
+
+#if defined(RTM_BENCH_PERF_COUNTERS_SUPPORTED)
+	static int open_event(uint32_t event_index)
+	{
+		perf_event_attr attr;
+		std::memset(&attr, 0, sizeof(attr));
+		attr.size = sizeof(attr);
+		attr.disabled = 1;
+		attr.exclude_kernel = 1;
+		attr.exclude_hv = 1;
+		attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+		const uint64_t cache_read_miss = (uint64_t(PERF_COUNT_HW_CACHE_OP_READ) << 8) | (uint64_t(PERF_COUNT_HW_CACHE_RESULT_MISS) << 16);
+
+		switch (event_index)
+		{
+		case k_cycles:
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.config = PERF_COUNT_HW_CPU_CYCLES;
+			break;
+		case k_instructions:
+			attr.type = PERF_TYPE_HARDWARE;
+			attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+			break;
+		case k_l1d_misses:
+			attr.type = PERF_TYPE_HW_CACHE;
+			attr.config = uint64_t(PERF_COUNT_HW_CACHE_L1D) | cache_read_miss;
+			break;
+		default:
+			attr.type = PERF_TYPE_HW_CACHE;
+			attr.config = uint64_t(PERF_COUNT_HW_CACHE_LL) | cache_read_miss;
+			break;
+		}
+
+		// This thread, on any CPU
+		return int(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+	}
+#endif
+
+	int		m_fds[k_num_events];
+};
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
+
+using namespace rtm;
+
+// Smooths a track of 4096 rotations with sliding windows of 16 samples
+constexpr uint32_t k_num_bench_average_windows = 4096;
+constexpr uint32_t k_bench_average_window_size = 16;
+constexpr uint32_t k_num_bench_average_quats = k_num_bench_average_windows + k_bench_average_window_size;
+
+static quatf s_bench_average_rotations[k_num_bench_average_quats];
+static float s_bench_average_weights[k_num_bench_average_quats];
+static uint32_t s_bench_average_window_offsets[k_num_bench_average_windows];
+static uint32_t s_bench_average_window_sizes[k_num_bench_average_windows];
+static quatf s_bench_average_output[k_num_bench_average_windows];
+
+static void fill_bench_average_track()
+{
+	for (uint32_t quat_index = 0; quat_index < k_num_bench_average_quats; ++quat_index)
+	{
+		const float t = float(quat_index) * 0.01F;
+		const float noise = float(int32_t(quat_index % 7) - 3) * 0.01F;
+		s_bench_average_rotations[quat_index] = quat_from_euler(t + noise, t * 0.5F - noise, 0.3F + noise);
+		s_bench_average_weights[quat_index] = 1.0F + float(quat_index % 3);
+	}
+
+	for (uint32_t window_index = 0; window_index < k_num_bench_average_windows; ++window_index)
+	{
+		s_bench_average_window_offsets[window_index] = window_index;
+		s_bench_average_window_sizes[window_index] = k_bench_average_window_size;
+	}
+}
+
+// The loop every call site writes: flip onto the first rotation, accumulate, and normalize
+static quatf quat_average_loop(const quatf* rotations, const float* weights, uint32_t num_quats)
+{
+	vector4f sum = vector_zero();
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float weight = quat_dot(rotations[quat_index], rotations[0]) < 0.0F ? -weights[quat_index] : weights[quat_index];
+		sum = vector_mul_add(quat_to_vector(rotations[quat_index]), weight, sum);
+	}
+
+	return quat_normalize(vector_to_quat(sum));
+}
+
+static void bm_quat_average_windows_loop(benchmark::State& state)
+{
+	fill_bench_average_track();
+
+	for (auto _ : state)
+	{
+		for (uint32_t window_index = 0; window_index < k_num_bench_average_windows; ++window_index)
+			s_bench_average_output[window_index] = quat_average_loop(s_bench_average_rotations + window_index, s_bench_average_weights + window_index, k_bench_average_window_size);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_average_windows);
+}
+
+BENCHMARK(bm_quat_average_windows_loop);
+
+template<quat_average_precision precision>
+static void bm_quat_average_windows(benchmark::State& state)
+{
+	fill_bench_average_track();
+
+	for (auto _ : state)
+	{
+		quat_average_groups_aos(s_bench_average_rotations, s_bench_average_weights, s_bench_average_window_offsets, s_bench_average_window_sizes, k_num_bench_average_windows, s_bench_average_output, precision);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_average_windows);
+}
+
+BENCHMARK_TEMPLATE(bm_quat_average_windows, quat_average_precision::fast);
+BENCHMARK_TEMPLATE(bm_quat_average_windows, quat_average_precision::exact);
+
+static void bm_quat_average_track_loop(benchmark::State& state)
+{
+	fill_bench_average_track();
+
+	for (auto _ : state)
+	{
+		const quatf average = quat_average_loop(s_bench_average_rotations, s_bench_average_weights, k_num_bench_average_quats);
+		benchmark::DoNotOptimize(average);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_average_quats);
+}
+
+BENCHMARK(bm_quat_average_track_loop);
+
+template<quat_average_precision precision>
+static void bm_quat_average_track(benchmark::State& state)
+{
+	fill_bench_average_track();
+
+	for (auto _ : state)
+	{
+		const quatf average = quat_average_aos(s_bench_average_rotations, s_bench_average_weights, k_num_bench_average_quats, precision);
+		benchmark::DoNotOptimize(average);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_average_quats);
+}
+
+BENCHMARK_TEMPLATE(bm_quat_average_track, quat_average_precision::fast);
+BENCHMARK_TEMPLATE(bm_quat_average_track, quat_average_precision::exact);
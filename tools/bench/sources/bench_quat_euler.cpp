@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_rotations = 4096;
+
+struct euler_data
+{
+	quatf rotations[k_num_rotations];
+	alignas(32) float pitch[k_num_rotations];
+	alignas(32) float yaw[k_num_rotations];
+	alignas(32) float roll[k_num_rotations];
+	alignas(32) float rotations_x[k_num_rotations];
+	alignas(32) float rotations_y[k_num_rotations];
+	alignas(32) float rotations_z[k_num_rotations];
+	alignas(32) float rotations_w[k_num_rotations];
+};
+
+static euler_data g_euler;
+
+static void fill_euler(euler_data& data)
+{
+	for (uint32_t index = 0; index < k_num_rotations; ++index)
+	{
+		const float value = float(index % 256) * (1.0F / 256.0F);
+		data.pitch[index] = value * 3.0F - 1.5F;
+		data.yaw[index] = 3.0F - value * 6.0F;
+		data.roll[index] = value * 5.0F - 2.5F;
+	}
+
+	for (uint32_t index = 0; index < k_num_rotations; ++index)
+	{
+		data.rotations[index] = quat_from_euler(data.pitch[index], data.yaw[index], data.roll[index]);
+		data.rotations_x[index] = quat_get_x(data.rotations[index]);
+		data.rotations_y[index] = quat_get_y(data.rotations[index]);
+		data.rotations_z[index] = quat_get_z(data.rotations[index]);
+		data.rotations_w[index] = quat_get_w(data.rotations[index]);
+	}
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_from_euler_scalar(float pitch, float yaw, float roll) RTM_NO_EXCEPT
+{
+	// The previous implementation: a single sin/cos followed by scalar products
+	vector4f sin_;
+	vector4f cos_;
+	vector_sincos(vector_mul(vector_set(pitch, yaw, roll, 0.0F), 0.5F), sin_, cos_);
+
+	const float sp = vector_get_x(sin_);
+	const float sy = vector_get_y(sin_);
+	const float sr = vector_get_z(sin_);
+	const float cp = vector_get_x(cos_);
+	const float cy = vector_get_y(cos_);
+	const float cr = vector_get_z(cos_);
+
+	return quat_set(cr * sp * sy - sr * cp * cy,
+		-cr * sp * cy - sr * cp * sy,
+		cr * cp * sy - sr * sp * cy,
+		cr * cp * cy + sr * sp * sy);
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_from_euler_rtm(float pitch, float yaw, float roll) RTM_NO_EXCEPT
+{
+	return quat_from_euler(pitch, yaw, roll);
+}
+
+RTM_FORCE_NOINLINE void RTM_SIMD_CALL quat_to_euler_rtm(quatf_arg0 input, float& out_pitch, float& out_yaw, float& out_roll) RTM_NO_EXCEPT
+{
+	quat_to_euler(input, out_pitch, out_yaw, out_roll);
+}
+
+static void bm_quat_from_euler_scalar(benchmark::State& state)
+{
+	fill_euler(g_euler);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_rotations; ++index)
+			g_euler.rotations[index] = quat_from_euler_scalar(g_euler.pitch[index], g_euler.yaw[index], g_euler.roll[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_euler.rotations);
+	state.SetItemsProcessed(state.iterations() * k_num_rotations);
+}
+
+BENCHMARK(bm_quat_from_euler_scalar);
+
+static void bm_quat_from_euler(benchmark::State& state)
+{
+	fill_euler(g_euler);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_rotations; ++index)
+			g_euler.rotations[index] = quat_from_euler_rtm(g_euler.pitch[index], g_euler.yaw[index], g_euler.roll[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_euler.rotations);
+	state.SetItemsProcessed(state.iterations() * k_num_rotations);
+}
+
+BENCHMARK(bm_quat_from_euler);
+
+static void bm_quat_from_euler_soa(benchmark::State& state)
+{
+	fill_euler(g_euler);
+
+	const const_float3f_soa angles{ g_euler.pitch, g_euler.yaw, g_euler.roll };
+	const float4f_soa output{ g_euler.rotations_x, g_euler.rotations_y, g_euler.rotations_z, g_euler.rotations_w };
+
+	for (auto _ : state)
+	{
+		quat_from_euler_soa(angles, output, k_num_rotations);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_euler.rotations_x);
+	state.SetItemsProcessed(state.iterations() * k_num_rotations);
+}
+
+BENCHMARK(bm_quat_from_euler_soa);
+
+static void bm_quat_to_euler(benchmark::State& state)
+{
+	fill_euler(g_euler);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_rotations; ++index)
+			quat_to_euler_rtm(g_euler.rotations[index], g_euler.pitch[index], g_euler.yaw[index], g_euler.roll[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_euler.pitch);
+	state.SetItemsProcessed(state.iterations() * k_num_rotations);
+}
+
+BENCHMARK(bm_quat_to_euler);
+
+static void bm_quat_to_euler_soa(benchmark::State& state)
+{
+	fill_euler(g_euler);
+
+	const const_float4f_soa input{ g_euler.rotations_x, g_euler.rotations_y, g_euler.rotations_z, g_euler.rotations_w };
+	const float3f_soa output{ g_euler.pitch, g_euler.yaw, g_euler.roll };
+
+	for (auto _ : state)
+	{
+		quat_to_euler_soa(input, output, k_num_rotations);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_euler.pitch);
+	state.SetItemsProcessed(state.iterations() * k_num_rotations);
+}
+
+BENCHMARK(bm_quat_to_euler_soa);
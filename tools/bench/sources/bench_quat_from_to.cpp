@@ -0,0 +1,188 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/batch/quatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_constraints = 4096;
+
+struct aim_data
+{
+	vector4f forward[k_num_constraints];
+	vector4f targets[k_num_constraints];
+	quatf output[k_num_constraints];
+	alignas(32) float forward_x[k_num_constraints];
+	alignas(32) float forward_y[k_num_constraints];
+	alignas(32) float forward_z[k_num_constraints];
+	alignas(32) float targets_x[k_num_constraints];
+	alignas(32) float targets_y[k_num_constraints];
+	alignas(32) float targets_z[k_num_constraints];
+	alignas(32) float output_x[k_num_constraints];
+	alignas(32) float output_y[k_num_constraints];
+	alignas(32) float output_z[k_num_constraints];
+	alignas(32) float output_w[k_num_constraints];
+};
+
+static aim_data g_aim;
+
+static void fill_aim(aim_data& data)
+{
+	for (uint32_t index = 0; index < k_num_constraints; ++index)
+	{
+		// Aim directions are not normalized, like a target position minus the joint position
+		const float value = float(index % 97) * 0.065F;
+		data.forward[index] = vector_normalize3(vector_set(scalar_cos(value), scalar_sin(value), 0.2F));
+		data.targets[index] = vector_set(3.0F - value, value * 0.5F - 1.0F, 2.0F * scalar_sin(value * 1.3F));
+
+		data.forward_x[index] = vector_get_x(data.forward[index]);
+		data.forward_y[index] = vector_get_y(data.forward[index]);
+		data.forward_z[index] = vector_get_z(data.forward[index]);
+		data.targets_x[index] = vector_get_x(data.targets[index]);
+		data.targets_y[index] = vector_get_y(data.targets[index]);
+		data.targets_z[index] = vector_get_z(data.targets[index]);
+	}
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_from_to_axis_angle(vector4f_arg0 from, vector4f_arg1 to) RTM_NO_EXCEPT
+{
+	// The usual approach: the angle with an arc-cosine and the rotation with sin/cos
+	const vector4f from_axis = vector_normalize3(from);
+	const vector4f to_axis = vector_normalize3(to);
+	const float angle = scalar_acos(scalar_clamp(float(vector_dot3(from_axis, to_axis)), -1.0F, 1.0F));
+	return quat_from_axis_angle(vector_normalize3(vector_cross3(from_axis, to_axis), vector_set(0.0F, 0.0F, 1.0F)), angle);
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_from_to_rtm(vector4f_arg0 from, vector4f_arg1 to) RTM_NO_EXCEPT
+{
+	return quat_from_to(from, to);
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_look_rotation_rtm(vector4f_arg0 forward, vector4f_arg1 up) RTM_NO_EXCEPT
+{
+	return quat_look_rotation(forward, up);
+}
+
+static void bm_quat_from_to_axis_angle(benchmark::State& state)
+{
+	fill_aim(g_aim);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_constraints; ++index)
+			g_aim.output[index] = quat_from_to_axis_angle(g_aim.forward[index], g_aim.targets[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_aim.output);
+	state.SetItemsProcessed(state.iterations() * k_num_constraints);
+}
+
+BENCHMARK(bm_quat_from_to_axis_angle);
+
+static void bm_quat_from_to_loop(benchmark::State& state)
+{
+	fill_aim(g_aim);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_constraints; ++index)
+			g_aim.output[index] = quat_from_to_rtm(g_aim.forward[index], g_aim.targets[index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_aim.output);
+	state.SetItemsProcessed(state.iterations() * k_num_constraints);
+}
+
+BENCHMARK(bm_quat_from_to_loop);
+
+static void bm_quat_from_to_soa(benchmark::State& state)
+{
+	fill_aim(g_aim);
+
+	const const_float3f_soa from{ g_aim.forward_x, g_aim.forward_y, g_aim.forward_z };
+	const const_float3f_soa to{ g_aim.targets_x, g_aim.targets_y, g_aim.targets_z };
+	const float4f_soa output{ g_aim.output_x, g_aim.output_y, g_aim.output_z, g_aim.output_w };
+
+	for (auto _ : state)
+	{
+		quat_from_to_soa(from, to, output, k_num_constraints);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_aim.output_x);
+	state.SetItemsProcessed(state.iterations() * k_num_constraints);
+}
+
+BENCHMARK(bm_quat_from_to_soa);
+
+static void bm_quat_look_rotation_loop(benchmark::State& state)
+{
+	fill_aim(g_aim);
+	const vector4f up = vector_set(0.0F, 0.0F, 1.0F);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_constraints; ++index)
+			g_aim.output[index] = quat_look_rotation_rtm(g_aim.targets[index], up);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_aim.output);
+	state.SetItemsProcessed(state.iterations() * k_num_constraints);
+}
+
+BENCHMARK(bm_quat_look_rotation_loop);
+
+static void bm_quat_look_rotation_soa(benchmark::State& state)
+{
+	fill_aim(g_aim);
+
+	// The forward directions serve as per constraint up directions
+	const const_float3f_soa forward{ g_aim.targets_x, g_aim.targets_y, g_aim.targets_z };
+	const const_float3f_soa up{ g_aim.forward_x, g_aim.forward_y, g_aim.forward_z };
+	const float4f_soa output{ g_aim.output_x, g_aim.output_y, g_aim.output_z, g_aim.output_w };
+
+	for (auto _ : state)
+	{
+		quat_look_rotation_soa(forward, up, output, k_num_constraints);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_aim.output_x);
+	state.SetItemsProcessed(state.iterations() * k_num_constraints);
+}
+
+BENCHMARK(bm_quat_look_rotation_soa);
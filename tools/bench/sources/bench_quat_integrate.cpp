@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_bodies = 4096;
+static constexpr float k_delta_time = 1.0F / 60.0F;
+
+struct rigid_bodies_data
+{
+	quatf rotations[k_num_bodies];
+	vector4f angular_velocities[k_num_bodies];
+	alignas(32) float rotations_x[k_num_bodies];
+	alignas(32) float rotations_y[k_num_bodies];
+	alignas(32) float rotations_z[k_num_bodies];
+	alignas(32) float rotations_w[k_num_bodies];
+	alignas(32) float angular_velocities_x[k_num_bodies];
+	alignas(32) float angular_velocities_y[k_num_bodies];
+	alignas(32) float angular_velocities_z[k_num_bodies];
+};
+
+static rigid_bodies_data g_rigid_bodies;
+
+static void fill_rigid_bodies(rigid_bodies_data& data)
+{
+	for (uint32_t index = 0; index < k_num_bodies; ++index)
+	{
+		const float value = float(index);
+		data.rotations[index] = quat_from_euler(value * 0.01F, 1.0F - value * 0.02F, 0.3F);
+		data.angular_velocities[index] = vector_set(value * 0.001F, 4.0F - value * 0.002F, -2.0F);
+	}
+
+	for (uint32_t index = 0; index < k_num_bodies; ++index)
+	{
+		data.rotations_x[index] = quat_get_x(data.rotations[index]);
+		data.rotations_y[index] = quat_get_y(data.rotations[index]);
+		data.rotations_z[index] = quat_get_z(data.rotations[index]);
+		data.rotations_w[index] = quat_get_w(data.rotations[index]);
+		data.angular_velocities_x[index] = vector_get_x(data.angular_velocities[index]);
+		data.angular_velocities_y[index] = vector_get_y(data.angular_velocities[index]);
+		data.angular_velocities_z[index] = vector_get_z(data.angular_velocities[index]);
+	}
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_integrate_axis_angle(quatf_arg0 rotation, vector4f_arg1 angular_velocity, float delta_time) RTM_NO_EXCEPT
+{
+	// The usual approach: extract the axis and the angle then build the delta rotation with sin/cos
+	const float speed = vector_length3(angular_velocity);
+	if (speed < 1.0E-8F)
+		return rotation;
+
+	const vector4f axis = vector_div(angular_velocity, vector_set(speed));
+	return quat_normalize(quat_mul(rotation, quat_from_axis_angle(axis, speed * delta_time)));
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_integrate_rtm(quatf_arg0 rotation, vector4f_arg1 angular_velocity, float delta_time) RTM_NO_EXCEPT
+{
+	return quat_integrate(rotation, angular_velocity, delta_time);
+}
+
+static void bm_quat_integrate_axis_angle(benchmark::State& state)
+{
+	fill_rigid_bodies(g_rigid_bodies);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_bodies; ++index)
+			g_rigid_bodies.rotations[index] = quat_integrate_axis_angle(g_rigid_bodies.rotations[index], g_rigid_bodies.angular_velocities[index], k_delta_time);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_rigid_bodies.rotations);
+	state.SetItemsProcessed(state.iterations() * k_num_bodies);
+}
+
+BENCHMARK(bm_quat_integrate_axis_angle);
+
+static void bm_quat_integrate_loop(benchmark::State& state)
+{
+	fill_rigid_bodies(g_rigid_bodies);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_bodies; ++index)
+			g_rigid_bodies.rotations[index] = quat_integrate_rtm(g_rigid_bodies.rotations[index], g_rigid_bodies.angular_velocities[index], k_delta_time);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_rigid_bodies.rotations);
+	state.SetItemsProcessed(state.iterations() * k_num_bodies);
+}
+
+BENCHMARK(bm_quat_integrate_loop);
+
+static void bm_quat_integrate_aos(benchmark::State& state)
+{
+	fill_rigid_bodies(g_rigid_bodies);
+
+	for (auto _ : state)
+	{
+		quat_integrate_aos(g_rigid_bodies.rotations, g_rigid_bodies.angular_velocities, k_delta_time, g_rigid_bodies.rotations, k_num_bodies);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_rigid_bodies.rotations);
+	state.SetItemsProcessed(state.iterations() * k_num_bodies);
+}
+
+BENCHMARK(bm_quat_integrate_aos);
+
+static void bm_quat_integrate_soa(benchmark::State& state)
+{
+	fill_rigid_bodies(g_rigid_bodies);
+
+	const const_float4f_soa rotations{ g_rigid_bodies.rotations_x, g_rigid_bodies.rotations_y, g_rigid_bodies.rotations_z, g_rigid_bodies.rotations_w };
+	const const_float3f_soa angular_velocities{ g_rigid_bodies.angular_velocities_x, g_rigid_bodies.angular_velocities_y, g_rigid_bodies.angular_velocities_z };
+	const float4f_soa output{ g_rigid_bodies.rotations_x, g_rigid_bodies.rotations_y, g_rigid_bodies.rotations_z, g_rigid_bodies.rotations_w };
+
+	for (auto _ : state)
+	{
+		quat_integrate_soa(rotations, angular_velocities, k_delta_time, output, k_num_bodies);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_rigid_bodies.rotations_x);
+	state.SetItemsProcessed(state.iterations() * k_num_bodies);
+}
+
+BENCHMARK(bm_quat_integrate_soa);
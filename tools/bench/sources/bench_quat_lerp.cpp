@@ -0,0 +1,143 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
+
+using namespace rtm;
+
+// Interpolates 64 quaternion pairs per iteration, each with its own alpha
+constexpr uint32_t k_num_batch_quats = 64;
+
+static void fill_bench_rotations(quatf* start, quatf* end, float* alphas)
+{
+	for (uint32_t quat_index = 0; quat_index < k_num_batch_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.37F;
+		start[quat_index] = quat_from_euler(angle, 0.5F - angle, angle * 1.5F);
+		end[quat_index] = quat_from_euler(angle + 0.3F, 0.2F - angle, angle * 1.5F - 0.4F);
+		alphas[quat_index] = float(quat_index) / float(k_num_batch_quats);
+	}
+}
+
+// Latency: every interpolation starts from the previous result
+// The end rotation alternates so the chain never converges
+static void bm_quat_lerp_latency(benchmark::State& state)
+{
+	quatf start[k_num_batch_quats];
+	quatf end[k_num_batch_quats];
+	float alphas[k_num_batch_quats];
+	fill_bench_rotations(start, end, alphas);
+
+	quatf result = start[0];
+	const quatf end0 = end[1];
+	const quatf end1 = end[7];
+
+	for (auto _ : state)
+	{
+		result = quat_lerp(result, end0, 0.6F);
+		result = quat_lerp(result, end1, 0.6F);
+	}
+
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK(bm_quat_lerp_latency);
+
+// Throughput: every interpolation is independent
+static void bm_quat_lerp_aos_loop(benchmark::State& state)
+{
+	quatf start[k_num_batch_quats];
+	quatf end[k_num_batch_quats];
+	quatf output[k_num_batch_quats];
+	float alphas[k_num_batch_quats];
+	fill_bench_rotations(start, end, alphas);
+
+	for (auto _ : state)
+	{
+		for (uint32_t quat_index = 0; quat_index < k_num_batch_quats; ++quat_index)
+			output[quat_index] = quat_lerp(start[quat_index], end[quat_index], alphas[quat_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_quats);
+}
+
+BENCHMARK(bm_quat_lerp_aos_loop);
+
+static void bm_quat_lerp_soa(benchmark::State& state)
+{
+	quatf start[k_num_batch_quats];
+	quatf end[k_num_batch_quats];
+	float alphas[k_num_batch_quats];
+	fill_bench_rotations(start, end, alphas);
+
+	float start_x[k_num_batch_quats];
+	float start_y[k_num_batch_quats];
+	float start_z[k_num_batch_quats];
+	float start_w[k_num_batch_quats];
+	float end_x[k_num_batch_quats];
+	float end_y[k_num_batch_quats];
+	float end_z[k_num_batch_quats];
+	float end_w[k_num_batch_quats];
+	float out_x[k_num_batch_quats];
+	float out_y[k_num_batch_quats];
+	float out_z[k_num_batch_quats];
+	float out_w[k_num_batch_quats];
+	for (uint32_t quat_index = 0; quat_index < k_num_batch_quats; ++quat_index)
+	{
+		start_x[quat_index] = quat_get_x(start[quat_index]);
+		start_y[quat_index] = quat_get_y(start[quat_index]);
+		start_z[quat_index] = quat_get_z(start[quat_index]);
+		start_w[quat_index] = quat_get_w(start[quat_index]);
+		end_x[quat_index] = quat_get_x(end[quat_index]);
+		end_y[quat_index] = quat_get_y(end[quat_index]);
+		end_z[quat_index] = quat_get_z(end[quat_index]);
+		end_w[quat_index] = quat_get_w(end[quat_index]);
+	}
+
+	const const_float4f_soa start_soa = { start_x, start_y, start_z, start_w };
+	const const_float4f_soa end_soa = { end_x, end_y, end_z, end_w };
+	const float4f_soa output = { out_x, out_y, out_z, out_w };
+
+	for (auto _ : state)
+	{
+		quat_lerp_soa(start_soa, end_soa, alphas, output, k_num_batch_quats);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	benchmark::DoNotOptimize(out_w);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_quats);
+}
+
+BENCHMARK(bm_quat_lerp_soa);
@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
+
+using namespace rtm;
+
+// Converts a 256 bone palette per iteration
+constexpr uint32_t k_num_batch_rotations = 256;
+
+static void fill_bench_rotations(quatf* rotations, matrix3x4f* matrices)
+{
+	for (uint32_t rotation_index = 0; rotation_index < k_num_batch_rotations; ++rotation_index)
+	{
+		// Wide angles so every quat_from_matrix pivot is used
+		const float angle = float(rotation_index) * 0.37F;
+		rotations[rotation_index] = quat_from_euler(angle, 0.5F - angle, angle * 1.5F);
+		matrices[rotation_index] = matrix_from_quat(rotations[rotation_index]);
+	}
+}
+
+static void bm_matrix_from_quat_loop(benchmark::State& state)
+{
+	quatf rotations[k_num_batch_rotations];
+	matrix3x4f matrices[k_num_batch_rotations];
+	fill_bench_rotations(rotations, matrices);
+
+	for (auto _ : state)
+	{
+		for (uint32_t rotation_index = 0; rotation_index < k_num_batch_rotations; ++rotation_index)
+			matrices[rotation_index] = matrix_from_quat(rotations[rotation_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(matrices);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_rotations);
+}
+
+BENCHMARK(bm_matrix_from_quat_loop);
+
+static void bm_matrix_from_quat_aos(benchmark::State& state)
+{
+	quatf rotations[k_num_batch_rotations];
+	matrix3x4f matrices[k_num_batch_rotations];
+	fill_bench_rotations(rotations, matrices);
+
+	for (auto _ : state)
+	{
+		matrix_from_quat_aos(rotations, matrices, k_num_batch_rotations);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(matrices);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_rotations);
+}
+
+BENCHMARK(bm_matrix_from_quat_aos);
+
+static void bm_quat_from_matrix_loop(benchmark::State& state)
+{
+	quatf rotations[k_num_batch_rotations];
+	matrix3x4f matrices[k_num_batch_rotations];
+	fill_bench_rotations(rotations, matrices);
+
+	for (auto _ : state)
+	{
+		for (uint32_t rotation_index = 0; rotation_index < k_num_batch_rotations; ++rotation_index)
+			rotations[rotation_index] = quat_from_matrix(matrices[rotation_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_rotations);
+}
+
+BENCHMARK(bm_quat_from_matrix_loop);
+
+static void bm_quat_from_matrix_aos(benchmark::State& state)
+{
+	quatf rotations[k_num_batch_rotations];
+	matrix3x4f matrices[k_num_batch_rotations];
+	fill_bench_rotations(rotations, matrices);
+
+	for (auto _ : state)
+	{
+		quat_from_matrix_aos(matrices, rotations, k_num_batch_rotations);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotations);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_rotations);
+}
+
+BENCHMARK(bm_quat_from_matrix_aos);
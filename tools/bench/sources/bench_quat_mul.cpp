@@ -25,6 +25,7 @@
 #include <benchmark/benchmark.h>
 
 #include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
 
 using namespace rtm;
 
@@ -476,3 +477,66 @@ static void bm_quat_mul_neon_neg(benchmark::State& state)
 
 BENCHMARK(bm_quat_mul_neon_neg);
 #endif
+
+// Multiplies 64 quaternion pairs per iteration, comparing an AOS loop against the SOA batch version
+constexpr uint32_t k_num_batch_quats = 64;
+
+static void bm_quat_mul_aos_loop(benchmark::State& state)
+{
+	quatf lhs[k_num_batch_quats];
+	quatf rhs[k_num_batch_quats];
+	for (uint32_t quat_index = 0; quat_index < k_num_batch_quats; ++quat_index)
+	{
+		lhs[quat_index] = quat_identity();
+		rhs[quat_index] = quat_identity();
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t quat_index = 0; quat_index < k_num_batch_quats; ++quat_index)
+			lhs[quat_index] = quat_mul(lhs[quat_index], rhs[quat_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(lhs);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_quats);
+}
+
+BENCHMARK(bm_quat_mul_aos_loop);
+
+static void bm_quat_mul_soa(benchmark::State& state)
+{
+	float lhs_x[k_num_batch_quats];
+	float lhs_y[k_num_batch_quats];
+	float lhs_z[k_num_batch_quats];
+	float lhs_w[k_num_batch_quats];
+	float rhs_x[k_num_batch_quats];
+	float rhs_y[k_num_batch_quats];
+	float rhs_z[k_num_batch_quats];
+	float rhs_w[k_num_batch_quats];
+	for (uint32_t quat_index = 0; quat_index < k_num_batch_quats; ++quat_index)
+	{
+		lhs_x[quat_index] = lhs_y[quat_index] = lhs_z[quat_index] = 0.0F;
+		rhs_x[quat_index] = rhs_y[quat_index] = rhs_z[quat_index] = 0.0F;
+		lhs_w[quat_index] = rhs_w[quat_index] = 1.0F;
+	}
+
+	const float4f_soa lhs = { lhs_x, lhs_y, lhs_z, lhs_w };
+	const const_float4f_soa rhs = { rhs_x, rhs_y, rhs_z, rhs_w };
+
+	for (auto _ : state)
+	{
+		quat_mul_soa(lhs, rhs, lhs, k_num_batch_quats);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(lhs_x);
+	benchmark::DoNotOptimize(lhs_y);
+	benchmark::DoNotOptimize(lhs_z);
+	benchmark::DoNotOptimize(lhs_w);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_quats);
+}
+
+BENCHMARK(bm_quat_mul_soa);
@@ -25,6 +25,9 @@
 #include <benchmark/benchmark.h>
 
 #include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
+
+#include <cstdint>
 
 using namespace rtm;
 
@@ -150,8 +153,36 @@ RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL quat_mul_vector3_sse2(vector4f_arg0 ve
 		return _mm_add_ps(result0, result1);
 	}
 }
+
+// Rodrigues form: v + 2w(q x v) + 2q x (q x v)
+// Wins on Ice Lake Xeon x64 SSE4 and AVX2 with GCC
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL quat_mul_vector3_cross_sse2(vector4f_arg0 vector, quatf_arg1 rotation) RTM_NO_EXCEPT
+{
+	const __m128 r_yzx = _mm_shuffle_ps(rotation, rotation, _MM_SHUFFLE(3, 0, 2, 1));
+	const __m128 r_zxy = _mm_shuffle_ps(rotation, rotation, _MM_SHUFFLE(3, 1, 0, 2));
+	const __m128 r_wwww = _mm_shuffle_ps(rotation, rotation, _MM_SHUFFLE(3, 3, 3, 3));
+	const __m128 v_yzx = _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 0, 2, 1));
+
+	// t = 2 * cross(r, v), computed in zxy order
+	const __m128 cross_zxy = _mm_sub_ps(_mm_mul_ps(rotation, v_yzx), _mm_mul_ps(r_yzx, vector));
+	const __m128 t_zxy = _mm_add_ps(cross_zxy, cross_zxy);
+	const __m128 t = _mm_shuffle_ps(t_zxy, t_zxy, _MM_SHUFFLE(3, 0, 2, 1));
+	const __m128 t_yzx = _mm_shuffle_ps(t_zxy, t_zxy, _MM_SHUFFLE(3, 1, 0, 2));
+
+	// result = v + w * t + cross(r, t)
+	const __m128 r_cross_t = _mm_sub_ps(_mm_mul_ps(r_yzx, t_zxy), _mm_mul_ps(r_zxy, t_yzx));
+	return _mm_add_ps(_mm_add_ps(vector, _mm_mul_ps(r_wwww, t)), r_cross_t);
+}
 #endif
 
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL quat_mul_vector3_cross(vector4f_arg0 vector, quatf_arg1 rotation) RTM_NO_EXCEPT
+{
+	// Rodrigues form with the generic vector functions
+	const vector4f rotation_v = quat_to_vector(rotation);
+	const vector4f t = vector_cross3(vector_add(rotation_v, rotation_v), vector);
+	return vector_add(vector_mul_add(t, vector_dup_w(rotation_v), vector), vector_cross3(rotation_v, t));
+}
+
 // Wins on Pixel 3 ARMv7
 // Wins on Pixel 3 ARM64
 // Scalar is much faster. The zipping impl isn't faster here unlike quat_mul for ARM64, it doesn't reduce the instruction
@@ -165,7 +196,7 @@ RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL quat_mul_vector3_scalar(vector4f_arg0
 #if defined(RTM_NEON_INTRINSICS)
 	const float32x4_t n_rotation = vnegq_f32(rotation);
 #else
-	const vector4f n_rotation = quat_conjugate(rotation);
+	const quatf n_rotation = quat_conjugate(rotation);
 #endif
 
 	// temp = quat_mul(inv_rotation, vector_quat)
@@ -179,9 +210,9 @@ RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL quat_mul_vector3_scalar(vector4f_arg0
 		const float lhs_z = quat_get_z(n_rotation);
 		const float lhs_w = quat_get_w(rotation);
 
-		const float rhs_x = quat_get_x(vector);
-		const float rhs_y = quat_get_y(vector);
-		const float rhs_z = quat_get_z(vector);
+		const float rhs_x = vector_get_x(vector);
+		const float rhs_y = vector_get_y(vector);
+		const float rhs_z = vector_get_z(vector);
 
 		temp_x = (rhs_x * lhs_w) + (rhs_y * lhs_z) - (rhs_z * lhs_y);
 		temp_y =  -(rhs_x * lhs_z) + (rhs_y * lhs_w) + (rhs_z * lhs_x);
@@ -414,6 +445,37 @@ static void bm_quat_mul_vector3_scalar(benchmark::State& state)
 
 BENCHMARK(bm_quat_mul_vector3_scalar);
 
+static void bm_quat_mul_vector3_cross(benchmark::State& state)
+{
+	vector4f v0 = vector_set(12.0f, 32.0f, -2.0f);
+	vector4f v1 = vector_set(12.0f, 32.0f, -2.0f);
+	vector4f v2 = vector_set(12.0f, 32.0f, -2.0f);
+	vector4f v3 = vector_set(12.0f, 32.0f, -2.0f);
+	quatf q0 = quat_identity();
+	quatf q1 = quat_identity();
+	quatf q2 = quat_identity();
+	quatf q3 = quat_identity();
+
+	for (auto _ : state)
+	{
+		v0 = quat_mul_vector3_cross(v0, q0);
+		v1 = quat_mul_vector3_cross(v1, q1);
+		v2 = quat_mul_vector3_cross(v2, q2);
+		v3 = quat_mul_vector3_cross(v3, q3);
+	}
+
+	benchmark::DoNotOptimize(q0);
+	benchmark::DoNotOptimize(q1);
+	benchmark::DoNotOptimize(q2);
+	benchmark::DoNotOptimize(q3);
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+}
+
+BENCHMARK(bm_quat_mul_vector3_cross);
+
 #if defined(RTM_FMA_INTRINSICS)
 static void bm_quat_mul_vector3_fma(benchmark::State& state)
 {
@@ -478,6 +540,37 @@ static void bm_quat_mul_vector3_sse2(benchmark::State& state)
 }
 
 BENCHMARK(bm_quat_mul_vector3_sse2);
+
+static void bm_quat_mul_vector3_cross_sse2(benchmark::State& state)
+{
+	vector4f v0 = vector_set(12.0f, 32.0f, -2.0f);
+	vector4f v1 = vector_set(12.0f, 32.0f, -2.0f);
+	vector4f v2 = vector_set(12.0f, 32.0f, -2.0f);
+	vector4f v3 = vector_set(12.0f, 32.0f, -2.0f);
+	quatf q0 = quat_identity();
+	quatf q1 = quat_identity();
+	quatf q2 = quat_identity();
+	quatf q3 = quat_identity();
+
+	for (auto _ : state)
+	{
+		v0 = quat_mul_vector3_cross_sse2(v0, q0);
+		v1 = quat_mul_vector3_cross_sse2(v1, q1);
+		v2 = quat_mul_vector3_cross_sse2(v2, q2);
+		v3 = quat_mul_vector3_cross_sse2(v3, q3);
+	}
+
+	benchmark::DoNotOptimize(q0);
+	benchmark::DoNotOptimize(q1);
+	benchmark::DoNotOptimize(q2);
+	benchmark::DoNotOptimize(q3);
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+}
+
+BENCHMARK(bm_quat_mul_vector3_cross_sse2);
 #endif
 
 #if defined(RTM_NEON_INTRINSICS)
@@ -543,3 +636,87 @@ static void bm_quat_mul_vector3_neon(benchmark::State& state)
 
 BENCHMARK(bm_quat_mul_vector3_neon);
 #endif
+
+static constexpr uint32_t k_num_rotated_vectors = 4096;
+
+struct rotated_vectors_data
+{
+	float3f vectors[k_num_rotated_vectors];
+	alignas(32) float vectors_x[k_num_rotated_vectors];
+	alignas(32) float vectors_y[k_num_rotated_vectors];
+	alignas(32) float vectors_z[k_num_rotated_vectors];
+};
+
+static rotated_vectors_data g_rotated_vectors;
+
+static void fill_rotated_vectors(rotated_vectors_data& data)
+{
+	for (uint32_t index = 0; index < k_num_rotated_vectors; ++index)
+	{
+		const float value = float(index);
+		data.vectors[index] = float3f{ value * 0.01F, 32.0F - value * 0.02F, -2.0F };
+		data.vectors_x[index] = data.vectors[index].x;
+		data.vectors_y[index] = data.vectors[index].y;
+		data.vectors_z[index] = data.vectors[index].z;
+	}
+}
+
+static void bm_quat_mul_vector3_aos_loop(benchmark::State& state)
+{
+	fill_rotated_vectors(g_rotated_vectors);
+	const uint32_t num_vectors = static_cast<uint32_t>(state.range(0));
+	const quatf rotation = quat_from_euler(0.7F, -1.3F, 2.1F);
+
+	for (auto _ : state)
+	{
+		// One vector at a time with the quaternion, the reference for the batched version
+		for (uint32_t index = 0; index < num_vectors; ++index)
+			vector_store3(quat_mul_vector3(vector_load3(g_rotated_vectors.vectors + index), rotation), g_rotated_vectors.vectors + index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_rotated_vectors.vectors);
+	state.SetItemsProcessed(state.iterations() * num_vectors);
+}
+
+BENCHMARK(bm_quat_mul_vector3_aos_loop)->Arg(2)->Arg(4)->Arg(16)->Arg(k_num_rotated_vectors);
+
+static void bm_quat_mul_vector3_aos(benchmark::State& state)
+{
+	fill_rotated_vectors(g_rotated_vectors);
+	const uint32_t num_vectors = static_cast<uint32_t>(state.range(0));
+	const quatf rotation = quat_from_euler(0.7F, -1.3F, 2.1F);
+
+	for (auto _ : state)
+	{
+		quat_mul_vector3_aos(g_rotated_vectors.vectors, rotation, g_rotated_vectors.vectors, num_vectors);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_rotated_vectors.vectors);
+	state.SetItemsProcessed(state.iterations() * num_vectors);
+}
+
+BENCHMARK(bm_quat_mul_vector3_aos)->Arg(2)->Arg(4)->Arg(16)->Arg(k_num_rotated_vectors);
+
+static void bm_quat_mul_vector3_soa(benchmark::State& state)
+{
+	fill_rotated_vectors(g_rotated_vectors);
+	const uint32_t num_vectors = static_cast<uint32_t>(state.range(0));
+	const quatf rotation = quat_from_euler(0.7F, -1.3F, 2.1F);
+
+	const const_float3f_soa input{ g_rotated_vectors.vectors_x, g_rotated_vectors.vectors_y, g_rotated_vectors.vectors_z };
+	const float3f_soa output{ g_rotated_vectors.vectors_x, g_rotated_vectors.vectors_y, g_rotated_vectors.vectors_z };
+
+	for (auto _ : state)
+	{
+		quat_mul_vector3_soa(input, rotation, output, num_vectors);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_rotated_vectors.vectors_x);
+	state.SetItemsProcessed(state.iterations() * num_vectors);
+}
+
+BENCHMARK(bm_quat_mul_vector3_soa)->Arg(2)->Arg(4)->Arg(16)->Arg(k_num_rotated_vectors);
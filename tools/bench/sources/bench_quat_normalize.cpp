@@ -0,0 +1,72 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+
+using namespace rtm;
+
+// Normalizes 256 quaternions per iteration for the throughput variant
+constexpr uint32_t k_num_batch_quats = 256;
+
+// Latency: every normalization depends on the previous result
+static void bm_quat_normalize_latency(benchmark::State& state)
+{
+	quatf result = quat_set(0.3F, -0.5F, 0.7F, 0.4F);
+
+	for (auto _ : state)
+		result = quat_normalize(result);
+
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_quat_normalize_latency);
+
+// Throughput: every normalization is independent
+static void bm_quat_normalize_loop(benchmark::State& state)
+{
+	quatf input[k_num_batch_quats];
+	quatf output[k_num_batch_quats];
+
+	for (uint32_t quat_index = 0; quat_index < k_num_batch_quats; ++quat_index)
+	{
+		// Slightly denormalized like the result of blending or integrating rotations
+		const float angle = float(quat_index) * 0.37F;
+		input[quat_index] = vector_to_quat(vector_mul(quat_to_vector(quat_from_euler(angle, 0.5F - angle, angle * 1.5F)), 1.0F + float(quat_index % 7) * 0.01F));
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t quat_index = 0; quat_index < k_num_batch_quats; ++quat_index)
+			output[quat_index] = quat_normalize(input[quat_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_quats);
+}
+
+BENCHMARK(bm_quat_normalize_loop);
@@ -0,0 +1,87 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/packing/quatf.h>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_packed_quats = 64;
+
+static void fill_packed_rotations(uint32_t* packed)
+{
+	for (uint32_t quat_index = 0; quat_index < k_num_packed_quats; ++quat_index)
+	{
+		const float angle = float(quat_index) * 0.37F;
+		packed[quat_index] = pack_quat_smallest_three_32(quat_from_euler(angle, 0.5F - angle, angle * 1.5F));
+	}
+}
+
+static void bm_quat_smallest_three_32_aos_loop(benchmark::State& state)
+{
+	uint32_t packed[k_num_packed_quats];
+	quatf output[k_num_packed_quats];
+	fill_packed_rotations(packed);
+
+	for (auto _ : state)
+	{
+		for (uint32_t quat_index = 0; quat_index < k_num_packed_quats; ++quat_index)
+			output[quat_index] = unpack_quat_smallest_three_32(packed[quat_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_packed_quats);
+}
+
+BENCHMARK(bm_quat_smallest_three_32_aos_loop);
+
+static void bm_quat_smallest_three_32_soa(benchmark::State& state)
+{
+	uint32_t packed[k_num_packed_quats];
+	fill_packed_rotations(packed);
+
+	float out_x[k_num_packed_quats];
+	float out_y[k_num_packed_quats];
+	float out_z[k_num_packed_quats];
+	float out_w[k_num_packed_quats];
+	const float4f_soa output = { out_x, out_y, out_z, out_w };
+
+	for (auto _ : state)
+	{
+		unpack_quat_smallest_three_32_soa(packed, output, k_num_packed_quats);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	benchmark::DoNotOptimize(out_w);
+	state.SetItemsProcessed(state.iterations() * k_num_packed_quats);
+}
+
+BENCHMARK(bm_quat_smallest_three_32_soa);
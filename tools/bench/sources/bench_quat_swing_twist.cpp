@@ -0,0 +1,168 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/batch/quatf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_joints = 4096;
+static constexpr float k_max_swing_angle = 0.8F;
+static constexpr float k_min_twist_angle = -0.5F;
+static constexpr float k_max_twist_angle = 1.0F;
+
+struct joints_data
+{
+	quatf rotations[k_num_joints];
+	quatf output[k_num_joints];
+	alignas(32) float rotations_x[k_num_joints];
+	alignas(32) float rotations_y[k_num_joints];
+	alignas(32) float rotations_z[k_num_joints];
+	alignas(32) float rotations_w[k_num_joints];
+	alignas(32) float output_x[k_num_joints];
+	alignas(32) float output_y[k_num_joints];
+	alignas(32) float output_z[k_num_joints];
+	alignas(32) float output_w[k_num_joints];
+};
+
+static joints_data g_joints;
+
+static void fill_joints(joints_data& data)
+{
+	for (uint32_t index = 0; index < k_num_joints; ++index)
+	{
+		// About half of the joints violate a limit
+		const float value = float(index % 97) * 0.03F;
+		data.rotations[index] = quat_from_euler(value - 1.5F, 0.4F - value * 0.5F, value * 0.7F - 1.0F);
+
+		data.rotations_x[index] = quat_get_x(data.rotations[index]);
+		data.rotations_y[index] = quat_get_y(data.rotations[index]);
+		data.rotations_z[index] = quat_get_z(data.rotations[index]);
+		data.rotations_w[index] = quat_get_w(data.rotations[index]);
+	}
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_clamp_swing_twist_angles(quatf_arg0 rotation, vector4f_arg1 twist_axis, float max_swing_angle, float min_twist_angle, float max_twist_angle) RTM_NO_EXCEPT
+{
+	// The usual approach: extract the swing and twist angles with inverse trigonometry,
+	// clamp them and rebuild both rotations with sin/cos
+	quatf swing;
+	quatf twist;
+	quat_swing_twist(rotation, twist_axis, swing, twist);
+
+	const float twist_sin = vector_dot3(quat_to_vector(twist), twist_axis);
+	const float twist_angle = 2.0F * scalar_atan2(twist_sin, float(quat_get_w(twist)));
+	const float clamped_twist_angle = scalar_clamp(twist_angle, min_twist_angle, max_twist_angle);
+
+	vector4f swing_axis;
+	float swing_angle;
+	quat_to_axis_angle(quat_get_w(swing) >= 0.0F ? swing : quat_neg(swing), swing_axis, swing_angle);
+	const float clamped_swing_angle = scalar_min(swing_angle, max_swing_angle);
+
+	return quat_mul(quat_from_axis_angle(twist_axis, clamped_twist_angle), quat_from_axis_angle(swing_axis, clamped_swing_angle));
+}
+
+RTM_FORCE_NOINLINE quatf RTM_SIMD_CALL quat_clamp_swing_twist_rtm(quatf_arg0 rotation, vector4f_arg1 twist_axis, float max_swing_angle, float min_twist_angle, float max_twist_angle) RTM_NO_EXCEPT
+{
+	return quat_clamp_swing_twist(rotation, twist_axis, max_swing_angle, min_twist_angle, max_twist_angle);
+}
+
+static void bm_quat_clamp_swing_twist_angles(benchmark::State& state)
+{
+	fill_joints(g_joints);
+	const vector4f twist_axis = vector_set(1.0F, 0.0F, 0.0F);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_joints; ++index)
+			g_joints.output[index] = quat_clamp_swing_twist_angles(g_joints.rotations[index], twist_axis, k_max_swing_angle, k_min_twist_angle, k_max_twist_angle);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_joints.output);
+	state.SetItemsProcessed(state.iterations() * k_num_joints);
+}
+
+BENCHMARK(bm_quat_clamp_swing_twist_angles);
+
+static void bm_quat_clamp_swing_twist_loop(benchmark::State& state)
+{
+	fill_joints(g_joints);
+	const vector4f twist_axis = vector_set(1.0F, 0.0F, 0.0F);
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_joints; ++index)
+			g_joints.output[index] = quat_clamp_swing_twist_rtm(g_joints.rotations[index], twist_axis, k_max_swing_angle, k_min_twist_angle, k_max_twist_angle);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_joints.output);
+	state.SetItemsProcessed(state.iterations() * k_num_joints);
+}
+
+BENCHMARK(bm_quat_clamp_swing_twist_loop);
+
+static void bm_quat_clamp_swing_twist_aos(benchmark::State& state)
+{
+	fill_joints(g_joints);
+	const vector4f twist_axis = vector_set(1.0F, 0.0F, 0.0F);
+
+	for (auto _ : state)
+	{
+		quat_clamp_swing_twist_aos(g_joints.rotations, twist_axis, k_max_swing_angle, k_min_twist_angle, k_max_twist_angle, g_joints.output, k_num_joints);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_joints.output);
+	state.SetItemsProcessed(state.iterations() * k_num_joints);
+}
+
+BENCHMARK(bm_quat_clamp_swing_twist_aos);
+
+static void bm_quat_clamp_swing_twist_soa(benchmark::State& state)
+{
+	fill_joints(g_joints);
+	const vector4f twist_axis = vector_set(1.0F, 0.0F, 0.0F);
+
+	const const_float4f_soa rotations{ g_joints.rotations_x, g_joints.rotations_y, g_joints.rotations_z, g_joints.rotations_w };
+	const float4f_soa output{ g_joints.output_x, g_joints.output_y, g_joints.output_z, g_joints.output_w };
+
+	for (auto _ : state)
+	{
+		quat_clamp_swing_twist_soa(rotations, twist_axis, k_max_swing_angle, k_min_twist_angle, k_max_twist_angle, output, k_num_joints);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_joints.output_x);
+	state.SetItemsProcessed(state.iterations() * k_num_joints);
+}
+
+BENCHMARK(bm_quat_clamp_swing_twist_soa);
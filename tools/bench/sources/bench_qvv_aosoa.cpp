@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/aosoa.h>
+#include <rtm/batch/qvvf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_transforms = 256;
+constexpr uint32_t k_num_blocks = qvv_aosoa_num_blocks(k_num_transforms);
+constexpr uint32_t k_num_lookups = 64;
+
+static void fill_transforms(qvvf* transforms)
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		transforms[transform_index] = qvv_set(quat_from_euler(value * 0.1F, 0.2F, value * 0.3F), vector_set(value, 1.0F, 2.0F), vector_set(1.0F + value * 0.01F));
+	}
+}
+
+static void bm_qvv_mul_aos_layout(benchmark::State& state)
+{
+	alignas(64) qvvf lhs[k_num_transforms];
+	alignas(64) qvvf rhs[k_num_transforms];
+	alignas(64) qvvf output[k_num_transforms];
+	fill_transforms(lhs);
+	fill_transforms(rhs);
+
+	for (auto _ : state)
+	{
+		qvv_mul_aos(lhs, rhs, output, k_num_transforms);
+		benchmark::DoNotOptimize(output);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_qvv_mul_aos_layout);
+
+static void bm_qvv_mul_aosoa_layout(benchmark::State& state)
+{
+	qvvf transforms[k_num_transforms];
+	fill_transforms(transforms);
+
+	qvvf_aosoa8 lhs[k_num_blocks];
+	qvvf_aosoa8 rhs[k_num_blocks];
+	qvvf_aosoa8 output[k_num_blocks];
+	qvv_pack_aosoa(transforms, k_num_transforms, lhs);
+	qvv_pack_aosoa(transforms, k_num_transforms, rhs);
+
+	for (auto _ : state)
+	{
+		qvv_mul_aosoa(lhs, rhs, output, k_num_transforms);
+		benchmark::DoNotOptimize(output);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_qvv_mul_aosoa_layout);
+
+static void bm_qvv_inverse_aos_layout(benchmark::State& state)
+{
+	alignas(64) qvvf input[k_num_transforms];
+	alignas(64) qvvf output[k_num_transforms];
+	fill_transforms(input);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+			output[transform_index] = qvv_inverse(input[transform_index]);
+		benchmark::DoNotOptimize(output);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_qvv_inverse_aos_layout);
+
+static void bm_qvv_inverse_aosoa_layout(benchmark::State& state)
+{
+	qvvf transforms[k_num_transforms];
+	fill_transforms(transforms);
+
+	qvvf_aosoa8 input[k_num_blocks];
+	qvvf_aosoa8 output[k_num_blocks];
+	qvv_pack_aosoa(transforms, k_num_transforms, input);
+
+	for (auto _ : state)
+	{
+		qvv_inverse_aosoa(input, output, k_num_transforms);
+		benchmark::DoNotOptimize(output);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_qvv_inverse_aosoa_layout);
+
+// Reads a few bones at random, like IK or attachments do
+static void bm_qvv_lookup_aos_layout(benchmark::State& state)
+{
+	alignas(64) qvvf transforms[k_num_transforms];
+	fill_transforms(transforms);
+
+	for (auto _ : state)
+	{
+		vector4f sum = vector_zero();
+		uint32_t transform_index = 7;
+		for (uint32_t lookup_index = 0; lookup_index < k_num_lookups; ++lookup_index)
+		{
+			transform_index = (transform_index * 97 + 13) % k_num_transforms;
+			sum = vector_add(sum, transforms[transform_index].translation);
+		}
+
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_lookups);
+}
+
+BENCHMARK(bm_qvv_lookup_aos_layout);
+
+static void bm_qvv_lookup_aosoa_layout(benchmark::State& state)
+{
+	qvvf transforms[k_num_transforms];
+	fill_transforms(transforms);
+
+	qvvf_aosoa8 blocks[k_num_blocks];
+	qvv_pack_aosoa(transforms, k_num_transforms, blocks);
+
+	for (auto _ : state)
+	{
+		vector4f sum = vector_zero();
+		uint32_t transform_index = 7;
+		for (uint32_t lookup_index = 0; lookup_index < k_num_lookups; ++lookup_index)
+		{
+			transform_index = (transform_index * 97 + 13) % k_num_transforms;
+			sum = vector_add(sum, qvv_aosoa_get(blocks, transform_index).translation);
+		}
+
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_lookups);
+}
+
+BENCHMARK(bm_qvv_lookup_aosoa_layout);
@@ -0,0 +1,283 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/qvvf.h>
+
+using namespace rtm;
+
+// Blends poses of 256 bones per iteration
+constexpr uint32_t k_num_blend_transforms = 256;
+constexpr uint32_t k_num_blend_poses = 4;
+
+static void fill_bench_poses(qvvf (&poses)[k_num_blend_poses][k_num_blend_transforms])
+{
+	for (uint32_t pose_index = 0; pose_index < k_num_blend_poses; ++pose_index)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_blend_transforms; ++transform_index)
+		{
+			const float angle = float(transform_index) * 0.37F + float(pose_index) * 0.2F;
+			poses[pose_index][transform_index] = qvv_set(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, 1.0F - angle, angle * 0.5F), vector_set(1.0F, 1.5F, 0.5F));
+		}
+	}
+}
+
+static void bm_qvv_lerp_separate_loop(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	qvvf output[k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_blend_transforms; ++transform_index)
+		{
+			const qvvf& start = poses[0][transform_index];
+			const qvvf& end = poses[1][transform_index];
+			output[transform_index].rotation = quat_lerp(start.rotation, end.rotation, 0.3F);
+			output[transform_index].translation = vector_lerp(start.translation, end.translation, 0.3F);
+			output[transform_index].scale = vector_lerp(start.scale, end.scale, 0.3F);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_lerp_separate_loop);
+
+static void bm_qvv_lerp_aos(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	qvvf output[k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	for (auto _ : state)
+	{
+		qvv_lerp_aos(poses[0], poses[1], 0.3F, output, k_num_blend_transforms);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_lerp_aos);
+
+// Blending 4 poses with chained qvv_lerp calls, the usual blend tree evaluation
+static void bm_qvv_blend4_lerp_chain(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	qvvf output[k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_blend_transforms; ++transform_index)
+		{
+			qvvf result = qvv_lerp(poses[0][transform_index], poses[1][transform_index], 0.5F);
+			result = qvv_lerp(result, poses[2][transform_index], 1.0F / 3.0F);
+			output[transform_index] = qvv_lerp(result, poses[3][transform_index], 0.25F);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_blend4_lerp_chain);
+
+static void bm_qvv_blend4_aos(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	qvvf output[k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	const qvvf* pose_ptrs[k_num_blend_poses] = { poses[0], poses[1], poses[2], poses[3] };
+	const float weights[k_num_blend_poses] = { 0.25F, 0.25F, 0.25F, 0.25F };
+
+	for (auto _ : state)
+	{
+		qvv_blend_aos(pose_ptrs, weights, k_num_blend_poses, output, k_num_blend_transforms);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_blend4_aos);
+
+static void bm_qvv_apply_additive_loop(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	qvvf output[k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_blend_transforms; ++transform_index)
+			output[transform_index] = qvv_apply_additive(poses[0][transform_index], poses[1][transform_index], 0.6F);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_apply_additive_loop);
+
+static void bm_qvv_apply_additive_aos(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	qvvf output[k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	for (auto _ : state)
+	{
+		qvv_apply_additive_aos(poses[0], poses[1], 0.6F, output, k_num_blend_transforms);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_apply_additive_aos);
+
+// Additive poses stored as structure of arrays, one stream per component
+struct bench_qvv_soa_streams
+{
+	float components[10][k_num_blend_transforms];
+
+	qvvf_soa get() { return qvvf_soa{ float4f_soa{ components[0], components[1], components[2], components[3] }, float3f_soa{ components[4], components[5], components[6] }, float3f_soa{ components[7], components[8], components[9] } }; }
+};
+
+static void fill_bench_soa(const qvvf (&poses)[k_num_blend_transforms], bench_qvv_soa_streams& streams)
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_blend_transforms; ++transform_index)
+	{
+		const qvvf& pose = poses[transform_index];
+		const float values[10] =
+		{
+			quat_get_x(pose.rotation), quat_get_y(pose.rotation), quat_get_z(pose.rotation), quat_get_w(pose.rotation),
+			vector_get_x(pose.translation), vector_get_y(pose.translation), vector_get_z(pose.translation),
+			vector_get_x(pose.scale), vector_get_y(pose.scale), vector_get_z(pose.scale),
+		};
+
+		for (uint32_t component_index = 0; component_index < 10; ++component_index)
+			streams.components[component_index][transform_index] = values[component_index];
+	}
+}
+
+static void bm_qvv_apply_additive_soa(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	bench_qvv_soa_streams base;
+	bench_qvv_soa_streams additive;
+	bench_qvv_soa_streams output;
+	fill_bench_soa(poses[0], base);
+	fill_bench_soa(poses[1], additive);
+
+	for (auto _ : state)
+	{
+		qvv_apply_additive_soa(base.get(), additive.get(), 0.6F, output.get(), k_num_blend_transforms);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_apply_additive_soa);
+
+static void bm_qvv_extract_additive_loop(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	qvvf output[k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_blend_transforms; ++transform_index)
+			output[transform_index] = qvv_extract_additive(poses[0][transform_index], poses[1][transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_extract_additive_loop);
+
+static void bm_qvv_extract_additive_aos(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	qvvf output[k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	for (auto _ : state)
+	{
+		qvv_extract_additive_aos(poses[0], poses[1], output, k_num_blend_transforms);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_extract_additive_aos);
+
+static void bm_qvv_extract_additive_soa(benchmark::State& state)
+{
+	qvvf poses[k_num_blend_poses][k_num_blend_transforms];
+	fill_bench_poses(poses);
+
+	bench_qvv_soa_streams pose;
+	bench_qvv_soa_streams reference;
+	bench_qvv_soa_streams output;
+	fill_bench_soa(poses[0], pose);
+	fill_bench_soa(poses[1], reference);
+
+	for (auto _ : state)
+	{
+		qvv_extract_additive_soa(pose.get(), reference.get(), output.get(), k_num_blend_transforms);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_blend_transforms);
+}
+
+BENCHMARK(bm_qvv_extract_additive_soa);
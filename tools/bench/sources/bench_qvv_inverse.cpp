@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/qvvf.h>
+
+using namespace rtm;
+
+// Inverts a 256 bone pose per iteration for the throughput variants
+constexpr uint32_t k_num_batch_transforms = 256;
+
+static void fill_bench_transforms(qvvf* transforms)
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+	{
+		const float angle = float(transform_index) * 0.37F;
+		transforms[transform_index] = qvv_set(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, 1.0F - angle, angle * 0.5F), vector_set(1.0F, 1.5F, 0.5F));
+	}
+}
+
+// Latency: every inverse depends on the previous result
+static void bm_qvv_inverse_latency(benchmark::State& state)
+{
+	qvvf transforms[k_num_batch_transforms];
+	fill_bench_transforms(transforms);
+
+	qvvf result = transforms[1];
+
+	for (auto _ : state)
+		result = qvv_inverse(result);
+
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_qvv_inverse_latency);
+
+// Throughput: every inverse is independent
+static void bm_qvv_inverse_loop(benchmark::State& state)
+{
+	qvvf input[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(input);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+			output[transform_index] = qvv_inverse(input[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_inverse_loop);
+
+static void bm_qvv_inverse_no_scale_loop(benchmark::State& state)
+{
+	qvvf input[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(input);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+			output[transform_index] = qvv_inverse_no_scale(input[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_inverse_no_scale_loop);
+
+static void bm_qvv_inverse_aos(benchmark::State& state)
+{
+	qvvf input[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(input);
+
+	for (auto _ : state)
+	{
+		qvv_inverse_aos(input, output, k_num_batch_transforms);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_inverse_aos);
+
+static void bm_qvv_inverse_no_scale_aos(benchmark::State& state)
+{
+	qvvf input[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(input);
+
+	for (auto _ : state)
+	{
+		qvv_inverse_no_scale_aos(input, output, k_num_batch_transforms);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_inverse_no_scale_aos);
@@ -0,0 +1,216 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/qvvf.h>
+
+#include <vector>
+
+using namespace rtm;
+
+// A root with 12 chains of 16 transforms, stored depth first like most rigs
+static constexpr uint32_t k_num_chains = 12;
+static constexpr uint32_t k_chain_length = 16;
+static constexpr uint32_t k_num_transforms = 1 + k_num_chains * k_chain_length;
+
+static void build_bench_rig(uint32_t* parent_indices, qvvf* local_transforms)
+{
+	parent_indices[0] = k_hierarchy_root_index;
+
+	uint32_t transform_index = 1;
+	for (uint32_t chain_index = 0; chain_index < k_num_chains; ++chain_index)
+	{
+		uint32_t parent_index = 0;
+		for (uint32_t link_index = 0; link_index < k_chain_length; ++link_index)
+		{
+			parent_indices[transform_index] = parent_index;
+			parent_index = transform_index++;
+		}
+	}
+
+	for (transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		local_transforms[transform_index] = qvv_set(quat_from_euler(value * 0.1F, 0.2F, value * -0.05F), vector_set(1.0F, value * 0.5F, 0.0F), vector_set(1.0F));
+	}
+}
+
+static void bm_qvv_local_to_object_loop(benchmark::State& state)
+{
+	uint32_t parent_indices[k_num_transforms];
+	qvvf local_transforms[k_num_transforms];
+	qvvf object_transforms[k_num_transforms];
+	build_bench_rig(parent_indices, local_transforms);
+
+	for (auto _ : state)
+	{
+		object_transforms[0] = local_transforms[0];
+		for (uint32_t transform_index = 1; transform_index < k_num_transforms; ++transform_index)
+			object_transforms[transform_index] = qvv_mul(local_transforms[transform_index], object_transforms[parent_indices[transform_index]]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(object_transforms);
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_qvv_local_to_object_loop);
+
+static void bm_qvv_local_to_object(benchmark::State& state)
+{
+	uint32_t parent_indices[k_num_transforms];
+	qvvf local_transforms[k_num_transforms];
+	qvvf object_transforms[k_num_transforms];
+	build_bench_rig(parent_indices, local_transforms);
+
+	uint32_t depths[k_num_transforms];
+	uint32_t sorted_indices[k_num_transforms];
+	uint32_t depth_offsets[k_num_transforms + 1];
+	const transform_hierarchy hierarchy = hierarchy_sort_by_depth(parent_indices, k_num_transforms, depths, sorted_indices, depth_offsets);
+
+	for (auto _ : state)
+	{
+		qvv_local_to_object(hierarchy, local_transforms, object_transforms);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(object_transforms);
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_qvv_local_to_object);
+
+static void bm_qvv_local_to_object_no_scale(benchmark::State& state)
+{
+	uint32_t parent_indices[k_num_transforms];
+	qvvf local_transforms[k_num_transforms];
+	qvvf object_transforms[k_num_transforms];
+	build_bench_rig(parent_indices, local_transforms);
+
+	uint32_t depths[k_num_transforms];
+	uint32_t sorted_indices[k_num_transforms];
+	uint32_t depth_offsets[k_num_transforms + 1];
+	const transform_hierarchy hierarchy = hierarchy_sort_by_depth(parent_indices, k_num_transforms, depths, sorted_indices, depth_offsets);
+
+	for (auto _ : state)
+	{
+		qvv_local_to_object_no_scale(hierarchy, local_transforms, object_transforms);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(object_transforms);
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_qvv_local_to_object_no_scale);
+
+// A 200000 transform scene: 2000 roots with 4 children per transform, a few percent of them move per frame
+static constexpr uint32_t k_num_scene_roots = 2000;
+static constexpr uint32_t k_num_scene_transforms = 200000;
+
+struct bench_scene
+{
+	std::vector<uint32_t> parent_indices;
+	std::vector<uint32_t> depths;
+	std::vector<uint32_t> sorted_indices;
+	std::vector<uint32_t> depth_offsets;
+	std::vector<qvvf> local_transforms;
+	std::vector<qvvf> object_transforms;
+	std::vector<uint32_t> changed_bits;
+	transform_hierarchy hierarchy;
+};
+
+static void build_bench_scene(bench_scene& scene)
+{
+	scene.parent_indices.resize(k_num_scene_transforms);
+	scene.depths.resize(k_num_scene_transforms);
+	scene.sorted_indices.resize(k_num_scene_transforms);
+	scene.depth_offsets.resize(k_num_scene_transforms + 1);
+	scene.local_transforms.resize(k_num_scene_transforms);
+	scene.object_transforms.resize(k_num_scene_transforms);
+	scene.changed_bits.assign((k_num_scene_transforms + 31) / 32, 0);
+
+	for (uint32_t transform_index = 0; transform_index < k_num_scene_transforms; ++transform_index)
+	{
+		scene.parent_indices[transform_index] = transform_index < k_num_scene_roots ? k_hierarchy_root_index : (transform_index - k_num_scene_roots) / 4;
+
+		const float value = float(transform_index % 1024);
+		scene.local_transforms[transform_index] = qvv_set(quat_from_euler(value * 0.1F, 0.2F, value * -0.05F), vector_set(1.0F, value * 0.5F, 0.0F), vector_set(1.0F));
+
+		// Roughly 1 in 100 transforms move, with their descendants about 4% of the scene is updated
+		if ((transform_index * 2654435761U) % 100 == 0)
+			scene.changed_bits[transform_index / 32] |= 1U << (transform_index % 32);
+	}
+
+	scene.hierarchy = hierarchy_sort_by_depth(scene.parent_indices.data(), k_num_scene_transforms, scene.depths.data(), scene.sorted_indices.data(), scene.depth_offsets.data());
+	qvv_local_to_object(scene.hierarchy, scene.local_transforms.data(), scene.object_transforms.data());
+}
+
+static void bm_qvv_local_to_object_scene(benchmark::State& state)
+{
+	bench_scene scene;
+	build_bench_scene(scene);
+
+	for (auto _ : state)
+	{
+		qvv_local_to_object(scene.hierarchy, scene.local_transforms.data(), scene.object_transforms.data());
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(scene.object_transforms.data());
+	state.SetItemsProcessed(state.iterations() * k_num_scene_transforms);
+}
+
+BENCHMARK(bm_qvv_local_to_object_scene);
+
+static void bm_qvv_local_to_object_scene_dirty(benchmark::State& state)
+{
+	bench_scene scene;
+	build_bench_scene(scene);
+
+	std::vector<uint32_t> dirty_bits(scene.changed_bits.size());
+	uint32_t num_updated = 0;
+
+	for (auto _ : state)
+	{
+		// The changed transforms are usually flagged by qvv_detect_changes_aos(..)
+		dirty_bits = scene.changed_bits;
+		num_updated = qvv_local_to_object_dirty(scene.hierarchy, scene.local_transforms.data(), scene.object_transforms.data(), dirty_bits.data());
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(scene.object_transforms.data());
+	state.SetItemsProcessed(state.iterations() * k_num_scene_transforms);
+	state.counters["updated"] = float(num_updated);
+}
+
+BENCHMARK(bm_qvv_local_to_object_scene_dirty);
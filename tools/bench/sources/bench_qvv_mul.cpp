@@ -24,7 +24,9 @@
 
 #include <benchmark/benchmark.h>
 
+#include <rtm/qvsf.h>
 #include <rtm/qvvf.h>
+#include <rtm/batch/qvvf.h>
 
 using namespace rtm;
 
@@ -138,3 +140,88 @@ static void bm_qvv_mul_sse2(benchmark::State& state)
 
 BENCHMARK(bm_qvv_mul_sse2);
 #endif
+
+static constexpr uint32_t k_num_batch_transforms = 256;
+
+// Every 8th transform has a negative scale when requested, enough to defeat branch prediction
+static void fill_bench_transforms(qvvf* lhs, qvvf* rhs, bool with_negative_scale)
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		const bool is_negative = with_negative_scale && ((transform_index * 2654435761U) >> 29) == 0;
+		lhs[transform_index] = qvv_set(quat_from_euler(value * 0.1F, 0.2F, -0.3F), vector_set(value, 1.0F, 0.0F), vector_set(is_negative ? -1.0F : 1.0F, 1.0F, 1.0F));
+		rhs[transform_index] = qvv_set(quat_from_euler(0.5F, value * -0.2F, 0.1F), vector_set(0.0F, 2.0F, value), vector_set(1.0F));
+	}
+}
+
+static void bm_qvv_mul_loop(benchmark::State& state)
+{
+	qvvf lhs[k_num_batch_transforms];
+	qvvf rhs[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(lhs, rhs, state.range(0) != 0);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+			output[transform_index] = qvv_mul(lhs[transform_index], rhs[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_mul_loop)->Arg(0)->Arg(1);
+
+static void bm_qvv_mul_aos(benchmark::State& state)
+{
+	qvvf lhs[k_num_batch_transforms];
+	qvvf rhs[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(lhs, rhs, state.range(0) != 0);
+
+	for (auto _ : state)
+	{
+		qvv_mul_aos(lhs, rhs, output, k_num_batch_transforms);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_mul_aos)->Arg(0)->Arg(1);
+
+// The uniform scale variant has no negative scale branch, the argument only changes the data
+static void bm_qvs_mul_loop(benchmark::State& state)
+{
+	qvvf lhs_qvv[k_num_batch_transforms];
+	qvvf rhs_qvv[k_num_batch_transforms];
+	fill_bench_transforms(lhs_qvv, rhs_qvv, state.range(0) != 0);
+
+	qvsf lhs[k_num_batch_transforms];
+	qvsf rhs[k_num_batch_transforms];
+	qvsf output[k_num_batch_transforms];
+	for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+	{
+		lhs[transform_index] = qvs_from_qvv(lhs_qvv[transform_index]);
+		rhs[transform_index] = qvs_from_qvv(rhs_qvv[transform_index]);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+			output[transform_index] = qvs_mul(lhs[transform_index], rhs[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvs_mul_loop)->Arg(0)->Arg(1);
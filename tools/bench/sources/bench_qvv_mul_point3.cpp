@@ -0,0 +1,123 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/qvvf.h>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_batch_points = 1024;
+
+static qvvf make_bench_transform()
+{
+	return qvv_set(quat_from_euler(0.3F, -1.2F, 2.1F), vector_set(-1.5F, 12.0F, 0.25F), vector_set(1.5F, 0.5F, 2.0F));
+}
+
+static void bm_qvv_mul_point3_loop(benchmark::State& state)
+{
+	const qvvf transform = make_bench_transform();
+
+	alignas(16) float3f points[k_num_batch_points];
+	for (uint32_t point_index = 0; point_index < k_num_batch_points; ++point_index)
+		points[point_index] = float3f{ float(point_index), 1.0F, -2.0F };
+
+	alignas(16) float3f output[k_num_batch_points];
+
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < k_num_batch_points; ++point_index)
+			vector_store3(qvv_mul_point3(vector_load3(&points[point_index]), transform), &output[point_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_points);
+}
+
+BENCHMARK(bm_qvv_mul_point3_loop);
+
+static void bm_qvv_mul_point3_aos(benchmark::State& state)
+{
+	const qvvf transform = make_bench_transform();
+	const store_mode mode = state.range(0) != 0 ? store_mode::non_temporal : store_mode::cached;
+
+	alignas(16) float3f points[k_num_batch_points];
+	for (uint32_t point_index = 0; point_index < k_num_batch_points; ++point_index)
+		points[point_index] = float3f{ float(point_index), 1.0F, -2.0F };
+
+	alignas(16) float3f output[k_num_batch_points];
+
+	for (auto _ : state)
+	{
+		qvv_mul_point3_aos(transform, points, output, k_num_batch_points, mode);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_points);
+}
+
+BENCHMARK(bm_qvv_mul_point3_aos)->Arg(0)->Arg(1);
+
+static void bm_qvv_mul_point3_soa(benchmark::State& state)
+{
+	const qvvf transform = make_bench_transform();
+	const store_mode mode = state.range(0) != 0 ? store_mode::non_temporal : store_mode::cached;
+
+	alignas(16) float points_x[k_num_batch_points];
+	alignas(16) float points_y[k_num_batch_points];
+	alignas(16) float points_z[k_num_batch_points];
+	for (uint32_t point_index = 0; point_index < k_num_batch_points; ++point_index)
+	{
+		points_x[point_index] = float(point_index);
+		points_y[point_index] = 1.0F;
+		points_z[point_index] = -2.0F;
+	}
+
+	alignas(16) float out_x[k_num_batch_points];
+	alignas(16) float out_y[k_num_batch_points];
+	alignas(16) float out_z[k_num_batch_points];
+
+	const const_float3f_soa points = { points_x, points_y, points_z };
+	const float3f_soa output = { out_x, out_y, out_z };
+
+	for (auto _ : state)
+	{
+		qvv_mul_point3_soa(transform, points, output, k_num_batch_points, mode);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_points);
+}
+
+BENCHMARK(bm_qvv_mul_point3_soa)->Arg(0)->Arg(1);
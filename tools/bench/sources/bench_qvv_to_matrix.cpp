@@ -0,0 +1,198 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/qvvf.h>
+
+using namespace rtm;
+
+// Converts a 256 bone palette per iteration
+constexpr uint32_t k_num_batch_transforms = 256;
+
+static void fill_bench_transforms(qvvf* transforms)
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+	{
+		const float angle = float(transform_index) * 0.37F;
+		transforms[transform_index] = qvv_set(quat_from_euler(angle, 0.5F - angle, angle * 1.5F), vector_set(angle, 1.0F - angle, angle * 0.5F), vector_set(1.0F, 1.5F, 0.5F));
+	}
+}
+
+// Latency: the rotation of every conversion comes from the previous result
+static void bm_matrix_from_qvv_latency(benchmark::State& state)
+{
+	qvvf transform = qvv_set(quat_from_euler(0.37F, 0.13F, 0.55F), vector_set(1.0F, 2.0F, 3.0F), vector_set(1.0F));
+
+	for (auto _ : state)
+	{
+		// Without scale, the X axis of a rotation matrix is a unit length 3D vector with a zero W
+		// and thus it is also a valid rotation quaternion
+		const matrix3x4f result = matrix_from_qvv(transform);
+		transform.rotation = vector_to_quat(result.x_axis);
+	}
+
+	benchmark::DoNotOptimize(transform);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_matrix_from_qvv_latency);
+
+static void bm_matrix_from_qvv_loop(benchmark::State& state)
+{
+	qvvf transforms[k_num_batch_transforms];
+	matrix3x4f output[k_num_batch_transforms];
+	fill_bench_transforms(transforms);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+			output[transform_index] = matrix_from_qvv(transforms[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_matrix_from_qvv_loop);
+
+static void bm_matrix_from_qvv_transpose_loop(benchmark::State& state)
+{
+	qvvf transforms[k_num_batch_transforms];
+	float3x4f output[k_num_batch_transforms];
+	fill_bench_transforms(transforms);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+			output[transform_index] = matrix_cast(matrix_from_qvv(transforms[transform_index]));
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_matrix_from_qvv_transpose_loop);
+
+static void bm_matrix_from_qvv_aos(benchmark::State& state)
+{
+	qvvf transforms[k_num_batch_transforms];
+	float3x4f output[k_num_batch_transforms];
+	fill_bench_transforms(transforms);
+
+	for (auto _ : state)
+	{
+		matrix_from_qvv_aos(transforms, output, k_num_batch_transforms);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_matrix_from_qvv_aos);
+
+static void bm_qvv_from_matrix_separate_loop(benchmark::State& state)
+{
+	qvvf transforms[k_num_batch_transforms];
+	matrix3x4f input[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(transforms);
+	for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+		input[transform_index] = matrix_from_qvv(transforms[transform_index]);
+
+	for (auto _ : state)
+	{
+		// The usual separate calls, every axis length is computed twice
+		for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+		{
+			const matrix3x4f& mtx = input[transform_index];
+			const float scale_x = vector_length3(mtx.x_axis);
+			const float scale_y = vector_length3(mtx.y_axis);
+			const float scale_z = vector_length3(mtx.z_axis);
+			const vector4f scale = vector_set(scale_x, scale_y, scale_z);
+			output[transform_index] = qvv_set(quat_from_matrix(matrix_remove_scale(mtx)), mtx.w_axis, scale);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_from_matrix_separate_loop);
+
+static void bm_qvv_from_matrix_loop(benchmark::State& state)
+{
+	qvvf transforms[k_num_batch_transforms];
+	matrix3x4f input[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(transforms);
+	for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+		input[transform_index] = matrix_from_qvv(transforms[transform_index]);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+			output[transform_index] = qvv_from_matrix(input[transform_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_from_matrix_loop);
+
+static void bm_qvv_from_matrix_aos(benchmark::State& state)
+{
+	qvvf transforms[k_num_batch_transforms];
+	matrix3x4f input[k_num_batch_transforms];
+	qvvf output[k_num_batch_transforms];
+	fill_bench_transforms(transforms);
+	for (uint32_t transform_index = 0; transform_index < k_num_batch_transforms; ++transform_index)
+		input[transform_index] = matrix_from_qvv(transforms[transform_index]);
+
+	for (auto _ : state)
+	{
+		qvv_from_matrix_aos(input, output, k_num_batch_transforms);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_transforms);
+}
+
+BENCHMARK(bm_qvv_from_matrix_aos);
@@ -0,0 +1,156 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/random.h>
+#include <rtm/batch/random.h>
+
+#include <random>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_random_samples = 1024;
+
+static void bm_random_unit_sphere_mt19937(benchmark::State& state)
+{
+	// The scalar baseline: std::mt19937 with rejection sampling in the unit ball, then normalized
+	std::mt19937 engine(1234);
+	std::uniform_real_distribution<float> distribution(-1.0F, 1.0F);
+
+	float3f output[k_num_random_samples];
+
+	for (auto _ : state)
+	{
+		for (uint32_t sample_index = 0; sample_index < k_num_random_samples; ++sample_index)
+		{
+			vector4f direction;
+			float length_squared;
+			do
+			{
+				direction = vector_set(distribution(engine), distribution(engine), distribution(engine), 0.0F);
+				length_squared = vector_length_squared3(direction);
+			} while (length_squared > 1.0F || length_squared < 1.0E-8F);
+
+			vector_store3(vector_normalize3(direction), output + sample_index);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_random_samples);
+}
+
+BENCHMARK(bm_random_unit_sphere_mt19937);
+
+static void bm_random_unit_sphere_aos_loop(benchmark::State& state)
+{
+	random_generator generator = random_init(1234);
+
+	float3f output[k_num_random_samples];
+
+	for (auto _ : state)
+	{
+		for (uint32_t sample_index = 0; sample_index < k_num_random_samples; ++sample_index)
+			vector_store3(random_next_unit_sphere(generator), output + sample_index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_random_samples);
+}
+
+BENCHMARK(bm_random_unit_sphere_aos_loop);
+
+static void bm_random_unit_sphere_soa(benchmark::State& state)
+{
+	random_generator generator = random_init(1234);
+
+	float out_x[k_num_random_samples];
+	float out_y[k_num_random_samples];
+	float out_z[k_num_random_samples];
+	const float3f_soa output = { out_x, out_y, out_z };
+
+	for (auto _ : state)
+	{
+		random_unit_sphere_soa(generator, output, k_num_random_samples);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	state.SetItemsProcessed(state.iterations() * k_num_random_samples);
+}
+
+BENCHMARK(bm_random_unit_sphere_soa);
+
+static void bm_random_quat_aos_loop(benchmark::State& state)
+{
+	random_generator generator = random_init(1234);
+
+	float4f output[k_num_random_samples];
+
+	for (auto _ : state)
+	{
+		for (uint32_t sample_index = 0; sample_index < k_num_random_samples; ++sample_index)
+			quat_store(random_next_quat(generator), output + sample_index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_random_samples);
+}
+
+BENCHMARK(bm_random_quat_aos_loop);
+
+static void bm_random_quat_soa(benchmark::State& state)
+{
+	random_generator generator = random_init(1234);
+
+	float out_x[k_num_random_samples];
+	float out_y[k_num_random_samples];
+	float out_z[k_num_random_samples];
+	float out_w[k_num_random_samples];
+	const float4f_soa output = { out_x, out_y, out_z, out_w };
+
+	for (auto _ : state)
+	{
+		random_quat_soa(generator, output, k_num_random_samples);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	benchmark::DoNotOptimize(out_w);
+	state.SetItemsProcessed(state.iterations() * k_num_random_samples);
+}
+
+BENCHMARK(bm_random_quat_soa);
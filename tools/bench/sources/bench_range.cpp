@@ -0,0 +1,235 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/batch/range.h>
+#include <rtm/packing/quatf.h>
+#include <rtm/packing/vector4f.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace rtm;
+
+// A segment of 16 samples for 256 tracks, stored one track after another
+constexpr uint32_t k_num_bench_tracks = 256;
+constexpr uint32_t k_num_bench_samples = 16;
+constexpr uint32_t k_num_bench_values = k_num_bench_tracks * k_num_bench_samples;
+
+static void fill_bench_samples(float* x, float* y, float* z, float* w)
+{
+	for (uint32_t value_index = 0; value_index < k_num_bench_values; ++value_index)
+	{
+		const float t = float(value_index);
+		x[value_index] = std::sin(t * 0.37F) * 12.5F;
+		y[value_index] = std::cos(t * 0.71F) * 0.25F;
+		z[value_index] = std::sin(t * 0.05F) + t * 0.01F;
+		w[value_index] = std::cos(t * 0.13F);
+	}
+}
+
+static void bm_range_compress_aos_loop(benchmark::State& state)
+{
+	// The typical hand written loop: every sample is a vector4f, its range is accumulated and then
+	// it is range reduced and packed with the single value functions
+	std::vector<float> x(k_num_bench_values);
+	std::vector<float> y(k_num_bench_values);
+	std::vector<float> z(k_num_bench_values);
+	std::vector<float> w(k_num_bench_values);
+	fill_bench_samples(x.data(), y.data(), z.data(), w.data());
+
+	std::vector<float4f> samples(k_num_bench_values);
+	for (uint32_t value_index = 0; value_index < k_num_bench_values; ++value_index)
+		vector_store(vector_set(x[value_index], y[value_index], z[value_index], w[value_index]), &samples[value_index]);
+
+	std::vector<uint64_t> packed(k_num_bench_values);
+
+	for (auto _ : state)
+	{
+		for (uint32_t track_index = 0; track_index < k_num_bench_tracks; ++track_index)
+		{
+			const float4f* track_samples = samples.data() + track_index * k_num_bench_samples;
+
+			vector4f range_min = vector_load(&track_samples[0]);
+			vector4f range_max = range_min;
+			for (uint32_t sample_index = 1; sample_index < k_num_bench_samples; ++sample_index)
+			{
+				range_min = vector_min(range_min, vector_load(&track_samples[sample_index]));
+				range_max = vector_max(range_max, vector_load(&track_samples[sample_index]));
+			}
+
+			const vector4f range_extent = vector_sub(range_max, range_min);
+			for (uint32_t sample_index = 0; sample_index < k_num_bench_samples; ++sample_index)
+				packed[track_index * k_num_bench_samples + sample_index] = pack_vector4_unorm16(vector_range_reduce(vector_load(&track_samples[sample_index]), range_min, range_extent));
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_values);
+}
+
+BENCHMARK(bm_range_compress_aos_loop);
+
+static void bm_range_compress_soa(benchmark::State& state)
+{
+	std::vector<float> x(k_num_bench_values);
+	std::vector<float> y(k_num_bench_values);
+	std::vector<float> z(k_num_bench_values);
+	std::vector<float> w(k_num_bench_values);
+	fill_bench_samples(x.data(), y.data(), z.data(), w.data());
+
+	std::vector<uint16_t> quantized(k_num_bench_values * 4);
+
+	for (auto _ : state)
+	{
+		for (uint32_t track_index = 0; track_index < k_num_bench_tracks; ++track_index)
+		{
+			const uint32_t offset = track_index * k_num_bench_samples;
+			const const_float4f_soa track_samples = { x.data() + offset, y.data() + offset, z.data() + offset, w.data() + offset };
+			const quantized4_soa track_quantized = { quantized.data() + offset, quantized.data() + k_num_bench_values + offset, quantized.data() + k_num_bench_values * 2 + offset, quantized.data() + k_num_bench_values * 3 + offset };
+
+			vector4f range_min;
+			vector4f range_extent;
+			vector_range_soa(track_samples, k_num_bench_samples, range_min, range_extent);
+			pack_range_reduce_unorm_soa(track_samples, range_min, range_extent, 16, track_quantized, k_num_bench_samples);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_values);
+}
+
+BENCHMARK(bm_range_compress_soa);
+
+static void bm_range_decompress_aos_loop(benchmark::State& state)
+{
+	std::vector<uint64_t> packed(k_num_bench_values);
+	for (uint32_t value_index = 0; value_index < k_num_bench_values; ++value_index)
+		packed[value_index] = uint64_t(value_index) * 0x0001000300050007ULL;
+
+	const vector4f range_min = vector_set(-1.0F, -2.0F, -3.0F, -4.0F);
+	const vector4f range_extent = vector_set(2.0F, 4.0F, 6.0F, 8.0F);
+	std::vector<float4f> samples(k_num_bench_values);
+
+	for (auto _ : state)
+	{
+		for (uint32_t value_index = 0; value_index < k_num_bench_values; ++value_index)
+			vector_store(vector_range_expand(unpack_vector4_unorm16(packed[value_index]), range_min, range_extent), &samples[value_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_values);
+}
+
+BENCHMARK(bm_range_decompress_aos_loop);
+
+static void bm_range_decompress_soa(benchmark::State& state)
+{
+	std::vector<uint16_t> quantized(k_num_bench_values * 4);
+	for (uint32_t value_index = 0; value_index < k_num_bench_values * 4; ++value_index)
+		quantized[value_index] = uint16_t(value_index * 7);
+
+	const vector4f range_min = vector_set(-1.0F, -2.0F, -3.0F, -4.0F);
+	const vector4f range_extent = vector_set(2.0F, 4.0F, 6.0F, 8.0F);
+	std::vector<float> samples(k_num_bench_values * 4);
+
+	const const_quantized4_soa input = { quantized.data(), quantized.data() + k_num_bench_values, quantized.data() + k_num_bench_values * 2, quantized.data() + k_num_bench_values * 3 };
+	const float4f_soa output = { samples.data(), samples.data() + k_num_bench_values, samples.data() + k_num_bench_values * 2, samples.data() + k_num_bench_values * 3 };
+
+	for (auto _ : state)
+	{
+		unpack_range_expand_unorm_soa(input, 16, range_min, range_extent, output, k_num_bench_values);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_values);
+}
+
+BENCHMARK(bm_range_decompress_soa);
+
+static void bm_range_decompress_rotation_separate(benchmark::State& state)
+{
+	// Dequantize and range expand the [xyz] components, then reconstruct [w] one rotation at a time
+	std::vector<uint16_t> quantized(k_num_bench_values * 3);
+	for (uint32_t value_index = 0; value_index < k_num_bench_values * 3; ++value_index)
+		quantized[value_index] = uint16_t(value_index * 7);
+
+	const vector4f range_min = vector_set(-0.5F, -0.25F, -0.125F, 0.0F);
+	const vector4f range_extent = vector_set(1.0F, 0.5F, 0.25F, 0.0F);
+	std::vector<float> translations(k_num_bench_values * 3);
+	std::vector<float> rotations(k_num_bench_values * 4);
+
+	const const_quantized4_soa input = { quantized.data(), quantized.data() + k_num_bench_values, quantized.data() + k_num_bench_values * 2, nullptr };
+	const float3f_soa dequantized = { translations.data(), translations.data() + k_num_bench_values, translations.data() + k_num_bench_values * 2 };
+	const float4f_soa output = { rotations.data(), rotations.data() + k_num_bench_values, rotations.data() + k_num_bench_values * 2, rotations.data() + k_num_bench_values * 3 };
+
+	for (auto _ : state)
+	{
+		unpack_range_expand_unorm_soa(input, 16, range_min, range_extent, dequantized, k_num_bench_values);
+
+		for (uint32_t value_index = 0; value_index < k_num_bench_values; ++value_index)
+		{
+			const quatf rotation = quat_from_positive_w(vector_set(dequantized.x[value_index], dequantized.y[value_index], dequantized.z[value_index], 0.0F));
+			output.x[value_index] = quat_get_x(rotation);
+			output.y[value_index] = quat_get_y(rotation);
+			output.z[value_index] = quat_get_z(rotation);
+			output.w[value_index] = quat_get_w(rotation);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_values);
+}
+
+BENCHMARK(bm_range_decompress_rotation_separate);
+
+static void bm_range_decompress_rotation_fused(benchmark::State& state)
+{
+	std::vector<uint16_t> quantized(k_num_bench_values * 3);
+	for (uint32_t value_index = 0; value_index < k_num_bench_values * 3; ++value_index)
+		quantized[value_index] = uint16_t(value_index * 7);
+
+	const vector4f range_min = vector_set(-0.5F, -0.25F, -0.125F, 0.0F);
+	const vector4f range_extent = vector_set(1.0F, 0.5F, 0.25F, 0.0F);
+	std::vector<float> rotations(k_num_bench_values * 4);
+
+	const const_quantized4_soa input = { quantized.data(), quantized.data() + k_num_bench_values, quantized.data() + k_num_bench_values * 2, nullptr };
+	const float4f_soa output = { rotations.data(), rotations.data() + k_num_bench_values, rotations.data() + k_num_bench_values * 2, rotations.data() + k_num_bench_values * 3 };
+
+	for (auto _ : state)
+	{
+		unpack_range_expand_quat_unorm_soa(input, 16, range_min, range_extent, output, k_num_bench_values);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_values);
+}
+
+BENCHMARK(bm_range_decompress_rotation_fused);
@@ -0,0 +1,137 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/rayf.h>
+
+#include <cstdint>
+#include <limits>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_ray_spheres = 4096;
+
+struct ray_bench_data
+{
+	alignas(16) float center_x[k_num_ray_spheres];
+	alignas(16) float center_y[k_num_ray_spheres];
+	alignas(16) float center_z[k_num_ray_spheres];
+	alignas(16) float radii[k_num_ray_spheres];
+	alignas(16) float distances[k_num_ray_spheres * 4];
+	uint32_t hit_bits[k_num_ray_spheres * 4 / 32];
+};
+
+static ray_bench_data g_ray_data;
+
+static void fill_ray_data()
+{
+	for (uint32_t index = 0; index < k_num_ray_spheres; ++index)
+	{
+		const float value = float(index);
+		g_ray_data.center_x[index] = value * 0.1F;
+		g_ray_data.center_y[index] = scalar_sin(value * 0.37F) * 3.0F;
+		g_ray_data.center_z[index] = scalar_cos(value * 0.73F) * 3.0F;
+		g_ray_data.radii[index] = 0.5F + float(index % 4);
+	}
+}
+
+static void bm_ray_intersect_spheres_loop(benchmark::State& state)
+{
+	fill_ray_data();
+	const vector4f origin = vector_set(-1.0F, 0.1F, 0.2F);
+	const vector4f direction = vector_normalize3(vector_set(1.0F, 0.01F, 0.02F));
+
+	for (auto _ : state)
+	{
+		// One sphere at a time, the reference for the batched version
+		for (uint32_t index = 0; index < k_num_ray_spheres; ++index)
+		{
+			const vector4f center = vector_set(g_ray_data.center_x[index], g_ray_data.center_y[index], g_ray_data.center_z[index]);
+			const vector4f offset = vector_sub(origin, center);
+			const float half_b = vector_dot3(offset, direction);
+			const float c = float(vector_dot3(offset, offset)) - g_ray_data.radii[index] * g_ray_data.radii[index];
+			const float discriminant = half_b * half_b - c;
+			const float sqrt_discriminant = scalar_sqrt(scalar_max(discriminant, 0.0F));
+			const float t_far = sqrt_discriminant - half_b;
+			const bool is_hit = discriminant >= 0.0F && t_far >= 0.0F;
+			g_ray_data.distances[index] = is_hit ? scalar_max(-half_b - sqrt_discriminant, 0.0F) : std::numeric_limits<float>::infinity();
+			if (index % 32 == 0)
+				g_ray_data.hit_bits[index / 32] = 0;
+			g_ray_data.hit_bits[index / 32] |= (is_hit ? 1U : 0U) << (index % 32);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_ray_spheres);
+}
+
+BENCHMARK(bm_ray_intersect_spheres_loop);
+
+static void bm_ray_intersect_spheres_soa(benchmark::State& state)
+{
+	fill_ray_data();
+	const vector4f origin = vector_set(-1.0F, 0.1F, 0.2F);
+	const vector4f direction = vector_normalize3(vector_set(1.0F, 0.01F, 0.02F));
+	const const_float3f_soa centers{ g_ray_data.center_x, g_ray_data.center_y, g_ray_data.center_z };
+
+	for (auto _ : state)
+	{
+		ray_intersect_spheres_soa(origin, direction, centers, g_ray_data.radii, g_ray_data.distances, g_ray_data.hit_bits, k_num_ray_spheres);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_ray_spheres);
+}
+
+BENCHMARK(bm_ray_intersect_spheres_soa);
+
+static void bm_ray4_intersect_spheres_soa(benchmark::State& state)
+{
+	fill_ray_data();
+	const float origin_x[4] = { -1.0F, -1.0F, -1.0F, -1.0F };
+	const float origin_y[4] = { 0.1F, 0.5F, -0.5F, 1.0F };
+	const float origin_z[4] = { 0.2F, -0.2F, 0.7F, 0.0F };
+	const float direction_x[4] = { 1.0F, 1.0F, 1.0F, 1.0F };
+	const float direction_y[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+	const float direction_z[4] = { 0.0F, 0.0F, 0.0F, 0.0F };
+	const const_float3f_soa origins{ origin_x, origin_y, origin_z };
+	const const_float3f_soa directions{ direction_x, direction_y, direction_z };
+	const const_float3f_soa centers{ g_ray_data.center_x, g_ray_data.center_y, g_ray_data.center_z };
+
+	for (auto _ : state)
+	{
+		ray_intersect_spheres_soa(origins, directions, centers, g_ray_data.radii, g_ray_data.distances, g_ray_data.hit_bits, k_num_ray_spheres);
+		benchmark::ClobberMemory();
+	}
+
+	// Each item is one ray/sphere pair
+	state.SetItemsProcessed(state.iterations() * k_num_ray_spheres * 4);
+}
+
+BENCHMARK(bm_ray4_intersect_spheres_soa);
@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/batch/reduce.h>
+
+#include <vector>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_bench_reduce_values = 16 * 1024;
+
+static std::vector<float> make_bench_reduce_values()
+{
+	std::vector<float> values(k_num_bench_reduce_values);
+	for (uint32_t value_index = 0; value_index < k_num_bench_reduce_values; ++value_index)
+		values[value_index] = float(value_index % 1000) * 0.001F - 0.5F;
+
+	return values;
+}
+
+static void bm_reduce_sum_single_accumulator(benchmark::State& state)
+{
+	const std::vector<float> values = make_bench_reduce_values();
+
+	for (auto _ : state)
+	{
+		// The loop every call site writes: each addition waits on the previous one
+		float sum = 0.0F;
+		for (uint32_t value_index = 0; value_index < k_num_bench_reduce_values; ++value_index)
+			sum += values[value_index];
+
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_reduce_values);
+}
+
+BENCHMARK(bm_reduce_sum_single_accumulator);
+
+template<summation_precision precision>
+static void bm_reduce_sum(benchmark::State& state)
+{
+	const std::vector<float> values = make_bench_reduce_values();
+
+	for (auto _ : state)
+	{
+		const float sum = scalar_sum_array(values.data(), k_num_bench_reduce_values, precision);
+		benchmark::DoNotOptimize(sum);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_reduce_values);
+}
+
+BENCHMARK_TEMPLATE(bm_reduce_sum, summation_precision::fast);
+BENCHMARK_TEMPLATE(bm_reduce_sum, summation_precision::pairwise);
+BENCHMARK_TEMPLATE(bm_reduce_sum, summation_precision::compensated);
+
+static void bm_reduce_min_single_accumulator(benchmark::State& state)
+{
+	const std::vector<float> values = make_bench_reduce_values();
+
+	for (auto _ : state)
+	{
+		float min_value = values[0];
+		for (uint32_t value_index = 1; value_index < k_num_bench_reduce_values; ++value_index)
+			min_value = scalar_min(min_value, values[value_index]);
+
+		benchmark::DoNotOptimize(min_value);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_reduce_values);
+}
+
+BENCHMARK(bm_reduce_min_single_accumulator);
+
+static void bm_reduce_min(benchmark::State& state)
+{
+	const std::vector<float> values = make_bench_reduce_values();
+
+	for (auto _ : state)
+	{
+		const float min_value = scalar_min_array(values.data(), k_num_bench_reduce_values);
+		benchmark::DoNotOptimize(min_value);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_reduce_values);
+}
+
+BENCHMARK(bm_reduce_min);
+
+static void bm_reduce_dot_single_accumulator(benchmark::State& state)
+{
+	const std::vector<float> lhs = make_bench_reduce_values();
+	const std::vector<float> rhs = make_bench_reduce_values();
+
+	for (auto _ : state)
+	{
+		float dot = 0.0F;
+		for (uint32_t value_index = 0; value_index < k_num_bench_reduce_values; ++value_index)
+			dot += lhs[value_index] * rhs[value_index];
+
+		benchmark::DoNotOptimize(dot);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_reduce_values);
+}
+
+BENCHMARK(bm_reduce_dot_single_accumulator);
+
+static void bm_reduce_dot(benchmark::State& state)
+{
+	const std::vector<float> lhs = make_bench_reduce_values();
+	const std::vector<float> rhs = make_bench_reduce_values();
+
+	for (auto _ : state)
+	{
+		const float dot = scalar_dot_array(lhs.data(), rhs.data(), k_num_bench_reduce_values);
+		benchmark::DoNotOptimize(dot);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_reduce_values);
+}
+
+BENCHMARK(bm_reduce_dot);
@@ -0,0 +1,397 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "bench_perf_counters.h"
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/frustumf.h>
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/frustumf.h>
+#include <rtm/batch/matrix3x4f.h>
+#include <rtm/batch/qvvf.h>
+#include <rtm/batch/skinning.h>
+#include <rtm/batch/soa.h>
+#include <rtm/batch/trackf.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// End to end scenarios: the work of one animated character per frame, stage by stage and as a whole,
+// and the visibility of a scene. They show which kernels dominate a frame and catch regressions
+// in how the kernels chain together that the micro benchmarks do not see.
+//
+// The character has 250 bones and 20K vertices with 4 influences each. Two clips of 2 seconds
+// sampled at 30 keys per second are blended every frame.
+
+constexpr uint32_t k_num_scenario_bones = 250;
+constexpr uint32_t k_num_scenario_keys = 60;
+constexpr float k_scenario_sample_rate = 30.0F;
+constexpr float k_scenario_frame_time = 1.0F / 60.0F;
+constexpr uint32_t k_num_scenario_vertices = 20000;
+constexpr uint32_t k_num_scenario_spheres = 100000;
+
+struct scenario_clip
+{
+	// Key major: the bones of a key are contiguous
+	float rotation_x[k_num_scenario_keys * k_num_scenario_bones];
+	float rotation_y[k_num_scenario_keys * k_num_scenario_bones];
+	float rotation_z[k_num_scenario_keys * k_num_scenario_bones];
+	float rotation_w[k_num_scenario_keys * k_num_scenario_bones];
+	float translation_x[k_num_scenario_keys * k_num_scenario_bones];
+	float translation_y[k_num_scenario_keys * k_num_scenario_bones];
+	float translation_z[k_num_scenario_keys * k_num_scenario_bones];
+};
+
+struct scenario_pose_streams
+{
+	alignas(64) float rotation_x[k_num_scenario_bones];
+	alignas(64) float rotation_y[k_num_scenario_bones];
+	alignas(64) float rotation_z[k_num_scenario_bones];
+	alignas(64) float rotation_w[k_num_scenario_bones];
+	alignas(64) float translation_x[k_num_scenario_bones];
+	alignas(64) float translation_y[k_num_scenario_bones];
+	alignas(64) float translation_z[k_num_scenario_bones];
+};
+
+struct scenario_character
+{
+	scenario_clip clips[2];
+	scenario_pose_streams sampled_poses[2];
+	alignas(64) float unit_scale[k_num_scenario_bones];
+
+	qvvf clip_poses[2][k_num_scenario_bones];
+	qvvf local_pose[k_num_scenario_bones];
+	qvvf object_pose[k_num_scenario_bones];
+
+	uint32_t parent_indices[k_num_scenario_bones];
+	uint32_t depths[k_num_scenario_bones];
+	uint32_t sorted_indices[k_num_scenario_bones];
+	uint32_t depth_offsets[k_num_scenario_bones + 1];
+	transform_hierarchy hierarchy;
+
+	matrix3x4f inverse_bind_pose[k_num_scenario_bones];
+	matrix3x4f object_matrices[k_num_scenario_bones];
+	matrix3x4f palette[k_num_scenario_bones];
+
+	float3f positions[k_num_scenario_vertices];
+	float3f normals[k_num_scenario_vertices];
+	float3f skinned_positions[k_num_scenario_vertices];
+	float3f skinned_normals[k_num_scenario_vertices];
+	uint32_t bone_indices[k_num_scenario_vertices * 4];
+	float bone_weights[k_num_scenario_vertices * 4];
+
+	float sample_time;
+};
+
+struct scenario_scene
+{
+	alignas(64) float center_x[k_num_scenario_spheres];
+	alignas(64) float center_y[k_num_scenario_spheres];
+	alignas(64) float center_z[k_num_scenario_spheres];
+	alignas(64) float radii[k_num_scenario_spheres];
+	uint32_t visible_bits[(k_num_scenario_spheres + 31) / 32];
+};
+
+static void fill_scenario_character(scenario_character& character)
+{
+	// A spine of chains: most bones continue the chain of the previous bone and every 8th bone branches
+	// off an earlier one, as limbs and fingers do. Parents always come before their children.
+	for (uint32_t bone_index = 0; bone_index < k_num_scenario_bones; ++bone_index)
+	{
+		if (bone_index == 0)
+			character.parent_indices[bone_index] = k_hierarchy_root_index;
+		else if (bone_index % 8 == 0)
+			character.parent_indices[bone_index] = bone_index / 3;
+		else
+			character.parent_indices[bone_index] = bone_index - 1;
+	}
+
+	character.hierarchy = hierarchy_sort_by_depth(character.parent_indices, k_num_scenario_bones, character.depths, character.sorted_indices, character.depth_offsets);
+
+	// Every bone oscillates around its own axis with its own frequency, its length changes slightly
+	for (uint32_t clip_index = 0; clip_index < 2; ++clip_index)
+	{
+		scenario_clip& clip = character.clips[clip_index];
+		for (uint32_t key_index = 0; key_index < k_num_scenario_keys; ++key_index)
+		{
+			const float key_time = float(key_index) / k_scenario_sample_rate;
+			for (uint32_t bone_index = 0; bone_index < k_num_scenario_bones; ++bone_index)
+			{
+				const float bone_value = float(bone_index);
+				const vector4f axis = vector_normalize3(vector_set(scalar_sin(bone_value), scalar_cos(bone_value * 0.7F), 0.5F + float(clip_index)));
+				const float angle = scalar_sin(key_time * (2.0F + bone_value * 0.01F) + bone_value) * (0.3F + 0.2F * float(clip_index));
+				const quatf rotation = quat_from_axis_angle(axis, angle);
+
+				const uint32_t key_offset = key_index * k_num_scenario_bones + bone_index;
+				clip.rotation_x[key_offset] = quat_get_x(rotation);
+				clip.rotation_y[key_offset] = quat_get_y(rotation);
+				clip.rotation_z[key_offset] = quat_get_z(rotation);
+				clip.rotation_w[key_offset] = quat_get_w(rotation);
+				clip.translation_x[key_offset] = 0.1F + 0.01F * scalar_sin(key_time * 3.0F + bone_value);
+				clip.translation_y[key_offset] = 0.0F;
+				clip.translation_z[key_offset] = 0.02F * float(clip_index);
+			}
+		}
+	}
+
+	for (uint32_t bone_index = 0; bone_index < k_num_scenario_bones; ++bone_index)
+		character.unit_scale[bone_index] = 1.0F;
+
+	// The bind pose is the first key of the first clip
+	for (uint32_t bone_index = 0; bone_index < k_num_scenario_bones; ++bone_index)
+	{
+		const scenario_clip& clip = character.clips[0];
+		const quatf rotation = quat_set(clip.rotation_x[bone_index], clip.rotation_y[bone_index], clip.rotation_z[bone_index], clip.rotation_w[bone_index]);
+		const vector4f translation = vector_set(clip.translation_x[bone_index], clip.translation_y[bone_index], clip.translation_z[bone_index]);
+		character.local_pose[bone_index] = qvv_set(rotation, translation, vector_set(1.0F));
+	}
+
+	qvv_local_to_object(character.hierarchy, character.local_pose, character.object_pose);
+
+	for (uint32_t bone_index = 0; bone_index < k_num_scenario_bones; ++bone_index)
+		character.inverse_bind_pose[bone_index] = matrix_from_qvv(qvv_inverse(character.object_pose[bone_index]));
+
+	// Vertices are spread along the bones, each is influenced by its bone and the next 3 with decreasing weights
+	for (uint32_t vertex_index = 0; vertex_index < k_num_scenario_vertices; ++vertex_index)
+	{
+		const uint32_t bone_index = (vertex_index * k_num_scenario_bones) / k_num_scenario_vertices;
+		const vector4f bone_position = character.object_pose[bone_index].translation;
+		const float vertex_value = float(vertex_index);
+		const vector4f offset = vector_set(scalar_sin(vertex_value) * 0.05F, scalar_cos(vertex_value) * 0.05F, scalar_sin(vertex_value * 0.3F) * 0.05F);
+
+		vector_store3(vector_add(bone_position, offset), &character.positions[vertex_index].x);
+		vector_store3(vector_normalize3(offset), &character.normals[vertex_index].x);
+
+		static const float k_weights[4] = { 0.55F, 0.25F, 0.15F, 0.05F };
+		for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+		{
+			character.bone_indices[vertex_index * 4 + influence_index] = (bone_index + influence_index) % k_num_scenario_bones;
+			character.bone_weights[vertex_index * 4 + influence_index] = k_weights[influence_index];
+		}
+	}
+
+	character.sample_time = 0.0F;
+}
+
+static scenario_character& get_scenario_character()
+{
+	static scenario_character* character = nullptr;
+	if (character == nullptr)
+	{
+		static scenario_character s_character;
+		fill_scenario_character(s_character);
+		character = &s_character;
+	}
+
+	return *character;
+}
+
+static const_float4f_soa get_clip_rotations(const scenario_clip& clip)
+{
+	return const_float4f_soa{ clip.rotation_x, clip.rotation_y, clip.rotation_z, clip.rotation_w };
+}
+
+static const_float3f_soa get_clip_translations(const scenario_clip& clip)
+{
+	return const_float3f_soa{ clip.translation_x, clip.translation_y, clip.translation_z };
+}
+
+// Samples both clips at the current time, converts them to QVV transforms, and blends them
+static void scenario_sample_and_blend(scenario_character& character)
+{
+	const float duration = float(k_num_scenario_keys - 1) / k_scenario_sample_rate;
+	character.sample_time += k_scenario_frame_time;
+	if (character.sample_time > duration)
+		character.sample_time -= duration;
+
+	for (uint32_t clip_index = 0; clip_index < 2; ++clip_index)
+	{
+		const scenario_clip& clip = character.clips[clip_index];
+		scenario_pose_streams& sampled = character.sampled_poses[clip_index];
+
+		const float4f_soa rotations{ sampled.rotation_x, sampled.rotation_y, sampled.rotation_z, sampled.rotation_w };
+		const float3f_soa translations{ sampled.translation_x, sampled.translation_y, sampled.translation_z };
+		quat_sample_uniform_soa(get_clip_rotations(clip), k_num_scenario_keys, k_scenario_sample_rate, character.sample_time, rotations, k_num_scenario_bones);
+		vector_sample_uniform_soa(get_clip_translations(clip), k_num_scenario_keys, k_scenario_sample_rate, character.sample_time, translations, k_num_scenario_bones);
+
+		const const_float3f_soa scales{ character.unit_scale, character.unit_scale, character.unit_scale };
+		soa_unpack(const_qvvf_soa{ rotations, translations, scales }, k_num_scenario_bones, character.clip_poses[clip_index]);
+	}
+
+	const qvvf* poses[2] = { character.clip_poses[0], character.clip_poses[1] };
+	const float weights[2] = { 0.7F, 0.3F };
+	qvv_blend_aos(poses, weights, 2, character.local_pose, k_num_scenario_bones);
+}
+
+static void scenario_build_palette(scenario_character& character)
+{
+	for (uint32_t bone_index = 0; bone_index < k_num_scenario_bones; ++bone_index)
+		character.object_matrices[bone_index] = matrix_from_qvv(character.object_pose[bone_index]);
+
+	matrix_mul_aos(character.inverse_bind_pose, character.object_matrices, character.palette, k_num_scenario_bones);
+}
+
+static void scenario_skin(scenario_character& character)
+{
+	const const_skin_vertex_streams input{ character.positions, character.normals, nullptr, sizeof(float3f), sizeof(float3f), 0 };
+	const skin_vertex_streams output{ character.skinned_positions, character.skinned_normals, nullptr, sizeof(float3f), sizeof(float3f), 0 };
+	matrix_skin_aos(character.palette, character.bone_indices, character.bone_weights, input, output, k_num_scenario_vertices);
+}
+
+static void bm_scenario_pose_sample_blend(benchmark::State& state)
+{
+	scenario_character& character = get_scenario_character();
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		scenario_sample_and_blend(character);
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, k_num_scenario_bones);
+	state.SetItemsProcessed(state.iterations() * k_num_scenario_bones);
+}
+
+BENCHMARK(bm_scenario_pose_sample_blend);
+
+static void bm_scenario_local_to_object(benchmark::State& state)
+{
+	scenario_character& character = get_scenario_character();
+	scenario_sample_and_blend(character);
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		qvv_local_to_object(character.hierarchy, character.local_pose, character.object_pose);
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, k_num_scenario_bones);
+	state.SetItemsProcessed(state.iterations() * k_num_scenario_bones);
+}
+
+BENCHMARK(bm_scenario_local_to_object);
+
+static void bm_scenario_skinning_palette(benchmark::State& state)
+{
+	scenario_character& character = get_scenario_character();
+	scenario_sample_and_blend(character);
+	qvv_local_to_object(character.hierarchy, character.local_pose, character.object_pose);
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		scenario_build_palette(character);
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, k_num_scenario_bones);
+	state.SetItemsProcessed(state.iterations() * k_num_scenario_bones);
+}
+
+BENCHMARK(bm_scenario_skinning_palette);
+
+static void bm_scenario_skin_vertices(benchmark::State& state)
+{
+	scenario_character& character = get_scenario_character();
+	scenario_sample_and_blend(character);
+	qvv_local_to_object(character.hierarchy, character.local_pose, character.object_pose);
+	scenario_build_palette(character);
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		scenario_skin(character);
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, k_num_scenario_vertices);
+	state.SetItemsProcessed(state.iterations() * k_num_scenario_vertices);
+}
+
+BENCHMARK(bm_scenario_skin_vertices);
+
+// Every stage of a character frame, one item is one character
+static void bm_scenario_character_frame(benchmark::State& state)
+{
+	scenario_character& character = get_scenario_character();
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		scenario_sample_and_blend(character);
+		qvv_local_to_object(character.hierarchy, character.local_pose, character.object_pose);
+		scenario_build_palette(character);
+		scenario_skin(character);
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, 1);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_scenario_character_frame);
+
+static void bm_scenario_frustum_cull(benchmark::State& state)
+{
+	static scenario_scene scene;
+
+	// Objects are scattered over a 1 km square around the camera, those within 500 m of it may be visible
+	for (uint32_t sphere_index = 0; sphere_index < k_num_scenario_spheres; ++sphere_index)
+	{
+		const float value = float(sphere_index);
+		scene.center_x[sphere_index] = scalar_sin(value * 12.9898F) * 500.0F;
+		scene.center_y[sphere_index] = scalar_cos(value * 78.233F) * 20.0F;
+		scene.center_z[sphere_index] = scalar_sin(value * 37.719F) * 500.0F;
+		scene.radii[sphere_index] = 0.5F + float(sphere_index % 16) * 0.25F;
+	}
+
+	// A camera at the origin looking down +Z with a 90 degree field of view, from 0.1 m to 500 m
+	const float depth_scale = 500.0F / (500.0F - 0.1F);
+	const matrix4x4f projection = matrix_set(
+		vector_set(1.0F, 0.0F, 0.0F, 0.0F),
+		vector_set(0.0F, 1.0F, 0.0F, 0.0F),
+		vector_set(0.0F, 0.0F, depth_scale, 1.0F),
+		vector_set(0.0F, 0.0F, -depth_scale * 0.1F, 0.0F));
+	const frustumf frustum = frustum_from_matrix(projection);
+
+	const const_float3f_soa centers{ scene.center_x, scene.center_y, scene.center_z };
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		frustum_cull_spheres_soa(frustum, centers, scene.radii, scene.visible_bits, k_num_scenario_spheres);
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, k_num_scenario_spheres);
+	state.SetItemsProcessed(state.iterations() * k_num_scenario_spheres);
+}
+
+BENCHMARK(bm_scenario_frustum_cull);
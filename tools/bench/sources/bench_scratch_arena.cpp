@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/qvvf.h>
+#include <rtm/batch/scratch.h>
+#include <rtm/impl/memory_utils.h>
+
+#include <cstdint>
+#include <cstdlib>
+
+using namespace rtm;
+
+// Every frame, 3 poses of 256 bones and 4 streams of 256 floats are allocated and blended.
+// With an argument of 0, the blend is skipped to measure the allocation overhead alone.
+constexpr uint32_t k_num_bones = 256;
+constexpr uint32_t k_num_poses = 3;
+
+static void fill_and_blend(qvvf* const* poses, const float4f_soa& streams, bool with_blend)
+{
+	if (!with_blend)
+	{
+		poses[0][0] = qvv_identity();
+		streams.w[k_num_bones - 1] = 1.0F;
+		return;
+	}
+
+	for (uint32_t pose_index = 0; pose_index < k_num_poses; ++pose_index)
+	{
+		for (uint32_t bone_index = 0; bone_index < k_num_bones; ++bone_index)
+			poses[pose_index][bone_index] = qvv_identity();
+	}
+
+	for (uint32_t bone_index = 0; bone_index < k_num_bones; ++bone_index)
+		streams.x[bone_index] = streams.y[bone_index] = streams.z[bone_index] = streams.w[bone_index] = 1.0F;
+
+	const float weights[k_num_poses] = { 0.5F, 0.25F, 0.25F };
+	qvv_blend_aos(poses, weights, k_num_poses, poses[0], k_num_bones);
+}
+
+// Over-aligned heap allocations freed every frame
+static void* malloc_aligned(size_t size, void*& out_allocation)
+{
+	out_allocation = std::malloc(size + k_scratch_default_alignment);
+	return rtm_impl::align_to(out_allocation, k_scratch_default_alignment);
+}
+
+static void bm_scratch_malloc(benchmark::State& state)
+{
+	const bool with_blend = state.range(0) != 0;
+
+	for (auto _ : state)
+	{
+		void* allocations[k_num_poses + 1];
+		qvvf* poses[k_num_poses];
+		for (uint32_t pose_index = 0; pose_index < k_num_poses; ++pose_index)
+			poses[pose_index] = static_cast<qvvf*>(malloc_aligned(sizeof(qvvf) * k_num_bones, allocations[pose_index]));
+
+		float* stream_data = static_cast<float*>(malloc_aligned(sizeof(float) * k_num_bones * 4, allocations[k_num_poses]));
+		const float4f_soa streams = { stream_data, stream_data + k_num_bones, stream_data + k_num_bones * 2, stream_data + k_num_bones * 3 };
+
+		fill_and_blend(poses, streams, with_blend);
+		benchmark::DoNotOptimize(poses[0]);
+
+		for (void* allocation : allocations)
+			std::free(allocation);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bones);
+}
+
+BENCHMARK(bm_scratch_malloc)->Arg(0)->Arg(1);
+
+static void bm_scratch_arena(benchmark::State& state)
+{
+	alignas(64) static uint8_t buffer[64 * 1024];
+	scratch_arena arena(buffer, sizeof(buffer));
+	const bool with_blend = state.range(0) != 0;
+
+	for (auto _ : state)
+	{
+		qvvf* poses[k_num_poses];
+		for (uint32_t pose_index = 0; pose_index < k_num_poses; ++pose_index)
+			poses[pose_index] = arena.allocate_array<qvvf>(k_num_bones);
+
+		const float4f_soa streams = arena.allocate_soa4(k_num_bones);
+
+		fill_and_blend(poses, streams, with_blend);
+		benchmark::DoNotOptimize(poses[0]);
+
+		arena.reset();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bones);
+}
+
+BENCHMARK(bm_scratch_arena)->Arg(0)->Arg(1);
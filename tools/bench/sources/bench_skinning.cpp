@@ -0,0 +1,178 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/matrix3x4f.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/skinning.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+namespace
+{
+	// A typical character: 64 bones, 4 influences per vertex, interleaved vertices
+	constexpr uint32_t k_num_bones = 64;
+
+	struct skinned_vertex
+	{
+		float3f position;
+		float3f normal;
+		float4f tangent;
+		float2f uv;
+	};
+
+	struct skinning_bench_data
+	{
+		std::vector<matrix3x4f> palette;
+		std::vector<uint32_t> bone_indices;
+		std::vector<float> bone_weights;
+		std::vector<skinned_vertex> vertices;
+
+		explicit skinning_bench_data(uint32_t num_vertices)
+			: palette(k_num_bones)
+			, bone_indices(num_vertices * 4)
+			, bone_weights(num_vertices * 4)
+			, vertices(num_vertices)
+		{
+			for (uint32_t bone_index = 0; bone_index < k_num_bones; ++bone_index)
+			{
+				const float value = float(bone_index);
+				palette[bone_index] = matrix_from_qvv(quat_from_euler(value * 0.1F, 0.2F, value * 0.3F), vector_set(value, 1.0F, 2.0F), vector_set(1.0F));
+			}
+
+			uint32_t state = 12345;
+			for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+			{
+				state = state * 1664525 + 1013904223;
+				const uint32_t base_bone = (state >> 8) % k_num_bones;
+				for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+				{
+					bone_indices[vertex_index * 4 + influence_index] = (base_bone + influence_index) % k_num_bones;
+					bone_weights[vertex_index * 4 + influence_index] = 0.25F;
+				}
+
+				const float value = float(vertex_index % 1024) * 0.01F;
+				vertices[vertex_index] = skinned_vertex{ float3f{ value, 1.0F, 2.0F }, float3f{ 0.0F, 0.0F, 1.0F }, float4f{ 1.0F, 0.0F, 0.0F, 1.0F }, float2f{ value, value } };
+			}
+		}
+	};
+}
+
+static void bm_skinning_per_influence_loop(benchmark::State& state)
+{
+	const uint32_t num_vertices = uint32_t(state.range(0));
+	const skinning_bench_data data(num_vertices);
+	std::vector<skinned_vertex> output(data.vertices);
+
+	for (auto _ : state)
+	{
+		// Each influence transforms the attributes, the results are blended
+		for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+		{
+			const skinned_vertex& vertex = data.vertices[vertex_index];
+			const vector4f position = vector_load3(&vertex.position);
+			const vector4f normal = vector_load3(&vertex.normal);
+			const vector4f tangent = vector_load(&vertex.tangent);
+
+			vector4f skinned_position = vector_zero();
+			vector4f skinned_normal = vector_zero();
+			vector4f skinned_tangent = vector_zero();
+			for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+			{
+				const matrix3x4f& bone = data.palette[data.bone_indices[vertex_index * 4 + influence_index]];
+				const float weight = data.bone_weights[vertex_index * 4 + influence_index];
+				skinned_position = vector_mul_add(matrix_mul_point3(position, bone), weight, skinned_position);
+				skinned_normal = vector_mul_add(matrix_mul_vector3(normal, bone), weight, skinned_normal);
+				skinned_tangent = vector_mul_add(matrix_mul_vector3(tangent, bone), weight, skinned_tangent);
+			}
+
+			vector_store3(skinned_position, &output[vertex_index].position);
+			vector_store3(vector_normalize3(skinned_normal, normal), &output[vertex_index].normal);
+			vector_store(vector_mix<mix4::x, mix4::y, mix4::z, mix4::d>(vector_normalize3(skinned_tangent, tangent), tangent), &output[vertex_index].tangent);
+		}
+
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * num_vertices);
+}
+
+BENCHMARK(bm_skinning_per_influence_loop)->Arg(4 * 1024)->Arg(256 * 1024);
+
+static void bm_matrix_skin_aos(benchmark::State& state)
+{
+	const uint32_t num_vertices = uint32_t(state.range(0));
+	const skinning_bench_data data(num_vertices);
+	std::vector<skinned_vertex> output(data.vertices);
+
+	const const_skin_vertex_streams input_streams = { &data.vertices[0].position, &data.vertices[0].normal, &data.vertices[0].tangent, sizeof(skinned_vertex), sizeof(skinned_vertex), sizeof(skinned_vertex) };
+	const skin_vertex_streams output_streams = { &output[0].position, &output[0].normal, &output[0].tangent, sizeof(skinned_vertex), sizeof(skinned_vertex), sizeof(skinned_vertex) };
+
+	for (auto _ : state)
+	{
+		matrix_skin_aos(data.palette.data(), data.bone_indices.data(), data.bone_weights.data(), input_streams, output_streams, num_vertices);
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * num_vertices);
+}
+
+BENCHMARK(bm_matrix_skin_aos)->Arg(4 * 1024)->Arg(256 * 1024);
+
+static void bm_matrix_skin_soa(benchmark::State& state)
+{
+	const uint32_t num_vertices = uint32_t(state.range(0));
+	const skinning_bench_data data(num_vertices);
+
+	std::vector<float> input(size_t(num_vertices) * 10);
+	for (uint32_t vertex_index = 0; vertex_index < num_vertices; ++vertex_index)
+	{
+		const skinned_vertex& vertex = data.vertices[vertex_index];
+		const float values[10] = { vertex.position.x, vertex.position.y, vertex.position.z, vertex.normal.x, vertex.normal.y, vertex.normal.z, vertex.tangent.x, vertex.tangent.y, vertex.tangent.z, vertex.tangent.w };
+		for (uint32_t stream_index = 0; stream_index < 10; ++stream_index)
+			input[size_t(stream_index) * num_vertices + vertex_index] = values[stream_index];
+	}
+
+	std::vector<float> output(input);
+	const float* in = input.data();
+	float* out = output.data();
+	const size_t n = num_vertices;
+
+	for (auto _ : state)
+	{
+		matrix_skin_soa(data.palette.data(), data.bone_indices.data(), data.bone_weights.data(),
+			const_float3f_soa{ in, in + n, in + n * 2 }, const_float3f_soa{ in + n * 3, in + n * 4, in + n * 5 }, const_float4f_soa{ in + n * 6, in + n * 7, in + n * 8, in + n * 9 },
+			float3f_soa{ out, out + n, out + n * 2 }, float3f_soa{ out + n * 3, out + n * 4, out + n * 5 }, float4f_soa{ out + n * 6, out + n * 7, out + n * 8, out + n * 9 },
+			num_vertices);
+		benchmark::DoNotOptimize(output.data());
+	}
+
+	state.SetItemsProcessed(state.iterations() * num_vertices);
+}
+
+BENCHMARK(bm_matrix_skin_soa)->Arg(4 * 1024)->Arg(256 * 1024);
@@ -0,0 +1,128 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/qvvf.h>
+#include <rtm/batch/soa.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_transforms = 250;
+
+static void fill_transforms(qvvf* transforms)
+{
+	for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+	{
+		const float value = float(transform_index);
+		transforms[transform_index] = qvv_set(quat_from_euler(value * 0.1F, 0.2F, value * 0.3F), vector_set(value, 1.0F, 2.0F), vector_set(1.0F));
+	}
+}
+
+// Element by element copy into the streams, the padding is filled separately
+static void bm_soa_pack_qvvf_scalar(benchmark::State& state)
+{
+	qvvf transforms[k_num_transforms];
+	fill_transforms(transforms);
+	benchmark::DoNotOptimize(&transforms[0]);
+
+	static soa_qvvf<k_num_transforms> packed;
+	benchmark::DoNotOptimize(&packed);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_transforms; ++transform_index)
+		{
+			const qvvf& transform = transforms[transform_index];
+			packed.rotation.x[transform_index] = quat_get_x(transform.rotation);
+			packed.rotation.y[transform_index] = quat_get_y(transform.rotation);
+			packed.rotation.z[transform_index] = quat_get_z(transform.rotation);
+			packed.rotation.w[transform_index] = quat_get_w(transform.rotation);
+			packed.translation.x[transform_index] = vector_get_x(transform.translation);
+			packed.translation.y[transform_index] = vector_get_y(transform.translation);
+			packed.translation.z[transform_index] = vector_get_z(transform.translation);
+			packed.scale.x[transform_index] = vector_get_x(transform.scale);
+			packed.scale.y[transform_index] = vector_get_y(transform.scale);
+			packed.scale.z[transform_index] = vector_get_z(transform.scale);
+		}
+
+		for (uint32_t transform_index = k_num_transforms; transform_index < packed.k_padded_capacity; ++transform_index)
+		{
+			packed.rotation.x[transform_index] = packed.rotation.y[transform_index] = packed.rotation.z[transform_index] = 0.0F;
+			packed.rotation.w[transform_index] = 1.0F;
+			packed.translation.x[transform_index] = packed.translation.y[transform_index] = packed.translation.z[transform_index] = 0.0F;
+			packed.scale.x[transform_index] = packed.scale.y[transform_index] = packed.scale.z[transform_index] = 1.0F;
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_soa_pack_qvvf_scalar);
+
+static void bm_soa_pack_qvvf(benchmark::State& state)
+{
+	qvvf transforms[k_num_transforms];
+	fill_transforms(transforms);
+	benchmark::DoNotOptimize(&transforms[0]);
+
+	static soa_qvvf<k_num_transforms> packed;
+	benchmark::DoNotOptimize(&packed);
+
+	for (auto _ : state)
+	{
+		soa_pack(transforms, k_num_transforms, packed);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_soa_pack_qvvf);
+
+static void bm_soa_unpack_qvvf(benchmark::State& state)
+{
+	qvvf transforms[k_num_transforms];
+	fill_transforms(transforms);
+	benchmark::DoNotOptimize(&transforms[0]);
+
+	static soa_qvvf<k_num_transforms> packed;
+	benchmark::DoNotOptimize(&packed);
+	soa_pack(transforms, k_num_transforms, packed);
+
+	for (auto _ : state)
+	{
+		soa_unpack(packed, transforms);
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_transforms);
+}
+
+BENCHMARK(bm_soa_unpack_qvvf);
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+#include <rtm/batch/spatial_keys.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_spatial_positions = 16 * 1024;
+
+struct spatial_positions
+{
+	std::vector<float> x;
+	std::vector<float> y;
+	std::vector<float> z;
+
+	spatial_positions()
+		: x(k_num_spatial_positions)
+		, y(k_num_spatial_positions)
+		, z(k_num_spatial_positions)
+	{
+		for (uint32_t index = 0; index < k_num_spatial_positions; ++index)
+		{
+			x[index] = float((index * 2654435761U) >> 16) / 65536.0F * 200.0F;
+			y[index] = float((index * 40503U) & 0xFFFF) / 65536.0F * 200.0F;
+			z[index] = float((index * 2246822519U) >> 16) / 65536.0F * 50.0F;
+		}
+	}
+
+	const_float3f_soa soa() const { return const_float3f_soa{ x.data(), y.data(), z.data() }; }
+};
+
+// The scalar baseline: one position at a time with the usual bit tricks
+static uint32_t reference_spread_bits(uint32_t value)
+{
+	value &= 0x000003FF;
+	value = (value | (value << 16)) & 0x030000FF;
+	value = (value | (value << 8)) & 0x0300F00F;
+	value = (value | (value << 4)) & 0x030C30C3;
+	value = (value | (value << 2)) & 0x09249249;
+	return value;
+}
+
+static uint32_t reference_cell(float position, float origin, float inv_cell_size)
+{
+	const float cell = std::floor((position - origin) * inv_cell_size);
+	return uint32_t(cell < 0.0F ? 0.0F : (cell > 1023.0F ? 1023.0F : cell));
+}
+
+static void bm_spatial_morton32_scalar(benchmark::State& state)
+{
+	const spatial_positions positions;
+	std::vector<uint32_t> keys(k_num_spatial_positions);
+	const float inv_cell_size = 1.0F / 0.25F;
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_spatial_positions; ++index)
+		{
+			const uint32_t cell_x = reference_cell(positions.x[index], 0.0F, inv_cell_size);
+			const uint32_t cell_y = reference_cell(positions.y[index], 0.0F, inv_cell_size);
+			const uint32_t cell_z = reference_cell(positions.z[index], 0.0F, inv_cell_size);
+			keys[index] = reference_spread_bits(cell_x) | (reference_spread_bits(cell_y) << 1) | (reference_spread_bits(cell_z) << 2);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(keys.data());
+	state.SetItemsProcessed(state.iterations() * k_num_spatial_positions);
+}
+
+BENCHMARK(bm_spatial_morton32_scalar);
+
+static void bm_spatial_morton32(benchmark::State& state)
+{
+	const spatial_positions positions;
+	std::vector<uint32_t> keys(k_num_spatial_positions);
+
+	spatial_grid_settings grid;
+	grid.cell_size = 0.25F;
+
+	for (auto _ : state)
+	{
+		spatial_morton32_soa(positions.soa(), grid, keys.data(), k_num_spatial_positions);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(keys.data());
+	state.SetItemsProcessed(state.iterations() * k_num_spatial_positions);
+}
+
+BENCHMARK(bm_spatial_morton32);
+
+static void bm_spatial_morton64(benchmark::State& state)
+{
+	const spatial_positions positions;
+	std::vector<uint64_t> keys(k_num_spatial_positions);
+
+	spatial_grid_settings grid;
+	grid.cell_size = 0.01F;
+
+	for (auto _ : state)
+	{
+		spatial_morton64_soa(positions.soa(), grid, keys.data(), k_num_spatial_positions);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(keys.data());
+	state.SetItemsProcessed(state.iterations() * k_num_spatial_positions);
+}
+
+BENCHMARK(bm_spatial_morton64);
+
+static void bm_spatial_hash_keys(benchmark::State& state)
+{
+	const spatial_positions positions;
+	std::vector<uint32_t> keys(k_num_spatial_positions);
+
+	spatial_grid_settings grid;
+	grid.cell_size = 0.25F;
+
+	for (auto _ : state)
+	{
+		spatial_hash_keys_soa(positions.soa(), grid, keys.data(), k_num_spatial_positions);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(keys.data());
+	state.SetItemsProcessed(state.iterations() * k_num_spatial_positions);
+}
+
+BENCHMARK(bm_spatial_hash_keys);
+
+static void bm_spatial_depth_keys(benchmark::State& state)
+{
+	const spatial_positions positions;
+	std::vector<uint32_t> keys(k_num_spatial_positions);
+
+	const vector4f camera_position = vector_set(-10.0F, 100.0F, 20.0F);
+	const vector4f camera_forward = vector_normalize3(vector_set(1.0F, -0.2F, -0.1F));
+
+	for (auto _ : state)
+	{
+		spatial_depth_keys_soa(positions.soa(), camera_position, camera_forward, keys.data(), k_num_spatial_positions, depth_sort_order::back_to_front);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(keys.data());
+	state.SetItemsProcessed(state.iterations() * k_num_spatial_positions);
+}
+
+BENCHMARK(bm_spatial_depth_keys);
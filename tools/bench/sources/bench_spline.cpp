@@ -0,0 +1,199 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/splinef.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/splinef.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+static constexpr uint32_t k_num_spline_curves = 4096;
+
+struct spline_bench_streams
+{
+	alignas(32) float x[k_num_spline_curves];
+	alignas(32) float y[k_num_spline_curves];
+	alignas(32) float z[k_num_spline_curves];
+	alignas(32) float w[k_num_spline_curves];
+};
+
+struct spline_bench_data
+{
+	spline_bench_streams control_points[4];
+	spline_bench_streams output;
+	alignas(32) float t[k_num_spline_curves];
+};
+
+static spline_bench_data g_spline_data;
+
+static void fill_spline_data(spline_bench_data& data, bool as_rotations)
+{
+	for (uint32_t index = 0; index < k_num_spline_curves; ++index)
+	{
+		for (uint32_t point_index = 0; point_index < 4; ++point_index)
+		{
+			const float value = float(index) * 0.37F + float(point_index) * 0.5F;
+			vector4f point = vector_set(scalar_sin(value) * 10.0F, scalar_cos(value * 0.7F) * 5.0F, value * 0.01F, 1.0F);
+			if (as_rotations)
+				point = quat_to_vector(quat_from_euler(scalar_sin(value), value * 0.1F, scalar_cos(value)));
+
+			spline_bench_streams& streams = data.control_points[point_index];
+			streams.x[index] = vector_get_x(point);
+			streams.y[index] = vector_get_y(point);
+			streams.z[index] = vector_get_z(point);
+			streams.w[index] = vector_get_w(point);
+		}
+
+		data.t[index] = float(index % 64) / 63.0F;
+	}
+}
+
+static vector4f load_point(const spline_bench_streams& streams, uint32_t index)
+{
+	return vector_set(streams.x[index], streams.y[index], streams.z[index], streams.w[index]);
+}
+
+static void store_point(vector4f_arg0 point, spline_bench_streams& streams, uint32_t index)
+{
+	streams.x[index] = vector_get_x(point);
+	streams.y[index] = vector_get_y(point);
+	streams.z[index] = vector_get_z(point);
+	streams.w[index] = vector_get_w(point);
+}
+
+static const_float3f_soa get_const3(const spline_bench_streams& streams)
+{
+	return const_float3f_soa{ streams.x, streams.y, streams.z };
+}
+
+static const_float4f_soa get_const4(const spline_bench_streams& streams)
+{
+	return const_float4f_soa{ streams.x, streams.y, streams.z, streams.w };
+}
+
+static void bm_vector_catmull_rom_loop(benchmark::State& state)
+{
+	fill_spline_data(g_spline_data, false);
+	const spline_bench_streams* points = g_spline_data.control_points;
+
+	for (auto _ : state)
+	{
+		// One curve at a time, the reference for the batched version
+		for (uint32_t index = 0; index < k_num_spline_curves; ++index)
+		{
+			const vector4f result = vector_catmull_rom(load_point(points[0], index), load_point(points[1], index), load_point(points[2], index), load_point(points[3], index), g_spline_data.t[index]);
+			store_point(result, g_spline_data.output, index);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_spline_data.output);
+	state.SetItemsProcessed(state.iterations() * k_num_spline_curves);
+}
+
+BENCHMARK(bm_vector_catmull_rom_loop);
+
+static void bm_vector_catmull_rom_soa3(benchmark::State& state)
+{
+	fill_spline_data(g_spline_data, false);
+	const spline_bench_streams* points = g_spline_data.control_points;
+	const float3f_soa output{ g_spline_data.output.x, g_spline_data.output.y, g_spline_data.output.z };
+
+	for (auto _ : state)
+	{
+		vector_catmull_rom_soa(get_const3(points[0]), get_const3(points[1]), get_const3(points[2]), get_const3(points[3]), g_spline_data.t, output, k_num_spline_curves);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_spline_data.output);
+	state.SetItemsProcessed(state.iterations() * k_num_spline_curves);
+}
+
+BENCHMARK(bm_vector_catmull_rom_soa3);
+
+static void bm_vector_catmull_rom_soa4(benchmark::State& state)
+{
+	fill_spline_data(g_spline_data, false);
+	const spline_bench_streams* points = g_spline_data.control_points;
+	const float4f_soa output{ g_spline_data.output.x, g_spline_data.output.y, g_spline_data.output.z, g_spline_data.output.w };
+
+	for (auto _ : state)
+	{
+		vector_catmull_rom_soa(get_const4(points[0]), get_const4(points[1]), get_const4(points[2]), get_const4(points[3]), g_spline_data.t, output, k_num_spline_curves);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_spline_data.output);
+	state.SetItemsProcessed(state.iterations() * k_num_spline_curves);
+}
+
+BENCHMARK(bm_vector_catmull_rom_soa4);
+
+static void bm_quat_squad_loop(benchmark::State& state)
+{
+	fill_spline_data(g_spline_data, true);
+	const spline_bench_streams* points = g_spline_data.control_points;
+
+	for (auto _ : state)
+	{
+		for (uint32_t index = 0; index < k_num_spline_curves; ++index)
+		{
+			const quatf result = quat_squad(vector_to_quat(load_point(points[0], index)), vector_to_quat(load_point(points[1], index)), vector_to_quat(load_point(points[2], index)), vector_to_quat(load_point(points[3], index)), g_spline_data.t[index]);
+			store_point(quat_to_vector(result), g_spline_data.output, index);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_spline_data.output);
+	state.SetItemsProcessed(state.iterations() * k_num_spline_curves);
+}
+
+BENCHMARK(bm_quat_squad_loop);
+
+static void bm_quat_squad_soa(benchmark::State& state)
+{
+	fill_spline_data(g_spline_data, true);
+	const spline_bench_streams* points = g_spline_data.control_points;
+	const float4f_soa output{ g_spline_data.output.x, g_spline_data.output.y, g_spline_data.output.z, g_spline_data.output.w };
+
+	for (auto _ : state)
+	{
+		quat_squad_soa(get_const4(points[0]), get_const4(points[1]), get_const4(points[2]), get_const4(points[3]), g_spline_data.t, output, k_num_spline_curves);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(g_spline_data.output);
+	state.SetItemsProcessed(state.iterations() * k_num_spline_curves);
+}
+
+BENCHMARK(bm_quat_squad_soa);
@@ -0,0 +1,240 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "bench_streaming.h"
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/qvvf.h>
+#include <rtm/batch/quatf.h>
+#include <rtm/batch/qvvf.h>
+#include <rtm/batch/vector4f.h>
+
+using namespace rtm;
+
+// Each quaternion multiplication reads two quaternions and writes one: 12 floats
+constexpr size_t k_quat_mul_element_size = sizeof(float) * 12;
+
+template<stream_alignment alignment>
+static void bm_quat_mul_aos_stream(benchmark::State& state)
+{
+	const uint32_t num_quats = stream_num_elements(state, k_quat_mul_element_size);
+
+	stream_buffer lhs(num_quats * 4, alignment);
+	stream_buffer rhs(num_quats * 4, alignment);
+	stream_buffer output(num_quats * 4, alignment);
+	stream_fill_quats(lhs.data(), num_quats);
+	stream_fill_quats(rhs.data(), num_quats);
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		const float* lhs_data = lhs.data();
+		const float* rhs_data = rhs.data();
+		float* output_data = output.data();
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf lhs_quat = quat_load(lhs_data + (quat_index * 4));
+			const quatf rhs_quat = quat_load(rhs_data + (quat_index * 4));
+			quat_store(quat_mul(lhs_quat, rhs_quat), output_data + (quat_index * 4));
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, num_quats);
+	stream_set_counters(state, num_quats, k_quat_mul_element_size);
+}
+
+BENCHMARK_TEMPLATE(bm_quat_mul_aos_stream, stream_alignment::aligned)->Apply(stream_buffer_sizes);
+BENCHMARK_TEMPLATE(bm_quat_mul_aos_stream, stream_alignment::unaligned)->Apply(stream_buffer_sizes);
+
+template<stream_alignment alignment>
+static void bm_quat_mul_soa_stream(benchmark::State& state)
+{
+	const uint32_t num_quats = stream_num_elements(state, k_quat_mul_element_size);
+
+	// Each buffer holds the 4 component streams back to back
+	stream_buffer lhs(num_quats * 4, alignment);
+	stream_buffer rhs(num_quats * 4, alignment);
+	stream_buffer output(num_quats * 4, alignment);
+
+	{
+		stream_buffer scratch(num_quats * 4, stream_alignment::aligned);
+		stream_fill_quats(scratch.data(), num_quats);
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			for (uint32_t component_index = 0; component_index < 4; ++component_index)
+			{
+				lhs.data()[(component_index * num_quats) + quat_index] = scratch.data()[(quat_index * 4) + component_index];
+				rhs.data()[(component_index * num_quats) + quat_index] = scratch.data()[(quat_index * 4) + component_index];
+			}
+		}
+	}
+
+	const float* lhs_data = lhs.data();
+	const float* rhs_data = rhs.data();
+	float* output_data = output.data();
+	const const_float4f_soa lhs_soa = { lhs_data, lhs_data + num_quats, lhs_data + (num_quats * 2), lhs_data + (num_quats * 3) };
+	const const_float4f_soa rhs_soa = { rhs_data, rhs_data + num_quats, rhs_data + (num_quats * 2), rhs_data + (num_quats * 3) };
+	const float4f_soa output_soa = { output_data, output_data + num_quats, output_data + (num_quats * 2), output_data + (num_quats * 3) };
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		quat_mul_soa(lhs_soa, rhs_soa, output_soa, num_quats);
+
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, num_quats);
+	stream_set_counters(state, num_quats, k_quat_mul_element_size);
+}
+
+BENCHMARK_TEMPLATE(bm_quat_mul_soa_stream, stream_alignment::aligned)->Apply(stream_buffer_sizes);
+BENCHMARK_TEMPLATE(bm_quat_mul_soa_stream, stream_alignment::unaligned)->Apply(stream_buffer_sizes);
+
+// Each normalization reads one quaternion and writes one: 8 floats
+constexpr size_t k_quat_normalize_element_size = sizeof(float) * 8;
+
+template<stream_alignment alignment>
+static void bm_quat_normalize_stream(benchmark::State& state)
+{
+	const uint32_t num_quats = stream_num_elements(state, k_quat_normalize_element_size);
+
+	stream_buffer input(num_quats * 4, alignment);
+	stream_buffer output(num_quats * 4, alignment);
+	stream_fill_quats(input.data(), num_quats);
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		const float* input_data = input.data();
+		float* output_data = output.data();
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const quatf input_quat = quat_load(input_data + (quat_index * 4));
+			quat_store(quat_normalize(input_quat), output_data + (quat_index * 4));
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, num_quats);
+	stream_set_counters(state, num_quats, k_quat_normalize_element_size);
+}
+
+BENCHMARK_TEMPLATE(bm_quat_normalize_stream, stream_alignment::aligned)->Apply(stream_buffer_sizes);
+BENCHMARK_TEMPLATE(bm_quat_normalize_stream, stream_alignment::unaligned)->Apply(stream_buffer_sizes);
+
+// Each packed vector3 write reads one vector4f and writes 3 floats: 7 floats
+constexpr size_t k_vector_store3_element_size = sizeof(float) * 7;
+
+template<store_mode mode>
+static void bm_vector_store3_array_stream(benchmark::State& state)
+{
+	const uint32_t num_vectors = stream_num_elements(state, k_vector_store3_element_size);
+
+	// Non-temporal stores require an aligned output
+	stream_buffer input(num_vectors * 4, stream_alignment::aligned);
+	stream_buffer output(num_vectors * 3, stream_alignment::aligned);
+	stream_fill_quats(input.data(), num_vectors);
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		vector_store3_array(reinterpret_cast<const vector4f*>(input.data()), reinterpret_cast<float3f*>(output.data()), num_vectors, mode);
+
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, num_vectors);
+	stream_set_counters(state, num_vectors, k_vector_store3_element_size);
+}
+
+BENCHMARK_TEMPLATE(bm_vector_store3_array_stream, store_mode::cached)->Apply(stream_buffer_sizes);
+BENCHMARK_TEMPLATE(bm_vector_store3_array_stream, store_mode::non_temporal)->Apply(stream_buffer_sizes);
+
+// Unpacks a pose into qvvf, the working set covers the packed input and the padded output
+template<typename packed_type>
+static void bm_qvv_load_array_stream(benchmark::State& state)
+{
+	constexpr size_t element_size = sizeof(packed_type) + sizeof(qvvf);
+	const uint32_t num_transforms = stream_num_elements(state, element_size);
+
+	stream_buffer input(num_transforms * (sizeof(packed_type) / sizeof(float)), stream_alignment::aligned);
+	stream_buffer output(num_transforms * (sizeof(qvvf) / sizeof(float)), stream_alignment::aligned);
+
+	const packed_type* input_data = reinterpret_cast<const packed_type*>(input.data());
+	qvvf* output_data = reinterpret_cast<qvvf*>(output.data());
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		qvv_store_packed(qvv_identity(), reinterpret_cast<packed_type*>(input.data()) + transform_index);
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		qvv_load_array(input_data, output_data, num_transforms);
+
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, num_transforms);
+	stream_set_counters(state, num_transforms, element_size);
+}
+
+BENCHMARK_TEMPLATE(bm_qvv_load_array_stream, qvvf_packed)->Apply(stream_buffer_sizes);
+BENCHMARK_TEMPLATE(bm_qvv_load_array_stream, qvvf_packed_uniform_scale)->Apply(stream_buffer_sizes);
+
+// The padded layout for reference, a plain qvvf copy
+static void bm_qvv_copy_array_stream(benchmark::State& state)
+{
+	constexpr size_t element_size = sizeof(qvvf) * 2;
+	const uint32_t num_transforms = stream_num_elements(state, element_size);
+
+	stream_buffer input(num_transforms * (sizeof(qvvf) / sizeof(float)), stream_alignment::aligned);
+	stream_buffer output(num_transforms * (sizeof(qvvf) / sizeof(float)), stream_alignment::aligned);
+
+	const qvvf* input_data = reinterpret_cast<const qvvf*>(input.data());
+	qvvf* output_data = reinterpret_cast<qvvf*>(output.data());
+	for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+		reinterpret_cast<qvvf*>(input.data())[transform_index] = qvv_identity();
+
+	bench_perf_counters counters;
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < num_transforms; ++transform_index)
+			output_data[transform_index] = input_data[transform_index];
+
+		benchmark::ClobberMemory();
+	}
+
+	counters.report(state, num_transforms);
+	stream_set_counters(state, num_transforms, element_size);
+}
+
+BENCHMARK(bm_qvv_copy_array_stream)->Apply(stream_buffer_sizes);
@@ -0,0 +1,136 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include "bench_perf_counters.h"
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+
+//////////////////////////////////////////////////////////////////////////
+// Array streaming benchmarks run a kernel over buffers sized for each level
+// of the memory hierarchy, unlike the register benchmarks that always
+// operate on the same values.
+//
+// Register them with: BENCHMARK_TEMPLATE(bm_foo, stream_alignment::aligned)->Apply(stream_buffer_sizes);
+// and filter them with: --benchmark_filter=_stream
+// Their loop is measured with bench_perf_counters, see --rtm_perf_counters.
+//////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// Whether the streamed buffers start on a cache line or one float past it.
+// Loads and stores are the same in both cases, only the address changes.
+//////////////////////////////////////////////////////////////////////////
+enum class stream_alignment
+{
+	aligned,		// Every vector4f load is 16 byte aligned
+	unaligned,		// Every fourth vector4f load straddles a cache line
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Registers the working set sizes, input and output combined: L1, L2, L3, and DRAM.
+//////////////////////////////////////////////////////////////////////////
+inline void stream_buffer_sizes(benchmark::internal::Benchmark* bench)
+{
+	bench->Arg(16 * 1024);
+	bench->Arg(256 * 1024);
+	bench->Arg(4 * 1024 * 1024);
+	bench->Arg(64 * 1024 * 1024);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// A heap buffer of floats that starts on a cache line, or one float past it when unaligned.
+//////////////////////////////////////////////////////////////////////////
+class stream_buffer
+{
+public:
+	stream_buffer(size_t num_floats, stream_alignment alignment)
+		: m_allocation(std::malloc((num_floats * sizeof(float)) + k_cache_line_size + sizeof(float)))
+		, m_data(nullptr)
+	{
+		const uintptr_t aligned_address = (reinterpret_cast<uintptr_t>(m_allocation) + (k_cache_line_size - 1)) & ~uintptr_t(k_cache_line_size - 1);
+		m_data = reinterpret_cast<float*>(aligned_address) + (alignment == stream_alignment::unaligned ? 1 : 0);
+	}
+
+	~stream_buffer() { std::free(m_allocation); }
+
+	stream_buffer(const stream_buffer&) = delete;
+	stream_buffer& operator=(const stream_buffer&) = delete;
+
+	float* data() const { return m_data; }
+
+private:
+	static constexpr uintptr_t k_cache_line_size = 64;
+
+	void*	m_allocation;
+	float*	m_data;
+};
+
+//////////////////////////////////////////////////////////////////////////
+// Returns how many elements fit in the working set when each element reads and writes
+// 'element_size' bytes overall. The count is a multiple of 16 to keep SoA streams
+// equally aligned.
+//////////////////////////////////////////////////////////////////////////
+inline uint32_t stream_num_elements(const benchmark::State& state, size_t element_size)
+{
+	const size_t num_elements = size_t(state.range(0)) / element_size;
+	return uint32_t(num_elements & ~size_t(15));
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Fills a buffer with 'num_quats' normalized quaternions laid out as [xyzw].
+//////////////////////////////////////////////////////////////////////////
+inline void stream_fill_quats(float* output, uint32_t num_quats)
+{
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const float angle = float(quat_index % 1024) * 0.37F;
+		rtm::quat_store(rtm::quat_from_euler(angle, 0.5F - angle, angle * 1.5F), output + (quat_index * 4));
+	}
+}
+
+//////////////////////////////////////////////////////////////////////////
+// Reports elements and bytes per second along with the memory level of the working set.
+//////////////////////////////////////////////////////////////////////////
+inline void stream_set_counters(benchmark::State& state, uint32_t num_elements, size_t element_size)
+{
+	state.SetItemsProcessed(int64_t(state.iterations()) * num_elements);
+	state.SetBytesProcessed(int64_t(state.iterations()) * num_elements * int64_t(element_size));
+
+	const int64_t working_set_size = state.range(0);
+	if (working_set_size <= 16 * 1024)
+		state.SetLabel("L1");
+	else if (working_set_size <= 256 * 1024)
+		state.SetLabel("L2");
+	else if (working_set_size <= 4 * 1024 * 1024)
+		state.SetLabel("L3");
+	else
+		state.SetLabel("DRAM");
+}
@@ -0,0 +1,148 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/packing/tangent_frame.h>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_packed_vertices = 1024;
+
+static vector4f get_bench_normal(uint32_t vertex_index)
+{
+	const float angle = float(vertex_index) * 0.37F;
+	return quat_mul_vector3(vector_set(0.0F, 0.0F, 1.0F), quat_from_euler(angle, 0.5F - angle, angle * 1.5F));
+}
+
+static void bm_normal_octahedral_32_aos_loop(benchmark::State& state)
+{
+	uint32_t packed[k_num_packed_vertices];
+	for (uint32_t vertex_index = 0; vertex_index < k_num_packed_vertices; ++vertex_index)
+		packed[vertex_index] = pack_normal_octahedral_32(get_bench_normal(vertex_index));
+
+	float3f output[k_num_packed_vertices];
+
+	for (auto _ : state)
+	{
+		for (uint32_t vertex_index = 0; vertex_index < k_num_packed_vertices; ++vertex_index)
+			vector_store3(unpack_normal_octahedral_32(packed[vertex_index]), output + vertex_index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_packed_vertices);
+}
+
+BENCHMARK(bm_normal_octahedral_32_aos_loop);
+
+static void bm_normal_octahedral_32_soa(benchmark::State& state)
+{
+	uint32_t packed[k_num_packed_vertices];
+	for (uint32_t vertex_index = 0; vertex_index < k_num_packed_vertices; ++vertex_index)
+		packed[vertex_index] = pack_normal_octahedral_32(get_bench_normal(vertex_index));
+
+	float out_x[k_num_packed_vertices];
+	float out_y[k_num_packed_vertices];
+	float out_z[k_num_packed_vertices];
+	const float3f_soa output = { out_x, out_y, out_z };
+
+	for (auto _ : state)
+	{
+		unpack_normal_octahedral_32_soa(packed, output, k_num_packed_vertices);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(out_x);
+	benchmark::DoNotOptimize(out_y);
+	benchmark::DoNotOptimize(out_z);
+	state.SetItemsProcessed(state.iterations() * k_num_packed_vertices);
+}
+
+BENCHMARK(bm_normal_octahedral_32_soa);
+
+static void fill_packed_qtangents(uint64_t* packed)
+{
+	for (uint32_t vertex_index = 0; vertex_index < k_num_packed_vertices; ++vertex_index)
+	{
+		const float angle = float(vertex_index) * 0.37F;
+		const quatf rotation = quat_from_euler(angle, 0.5F - angle, angle * 1.5F);
+		const vector4f normal = quat_mul_vector3(vector_set(0.0F, 0.0F, 1.0F), rotation);
+		const vector4f tangent = vector_set_w(quat_mul_vector3(vector_set(1.0F, 0.0F, 0.0F), rotation), (vertex_index % 2) == 0 ? 1.0F : -1.0F);
+		packed[vertex_index] = pack_qtangent_snorm16(normal, tangent);
+	}
+}
+
+static void bm_qtangent_snorm16_aos_loop(benchmark::State& state)
+{
+	uint64_t packed[k_num_packed_vertices];
+	fill_packed_qtangents(packed);
+
+	float3f normals[k_num_packed_vertices];
+	float4f tangents[k_num_packed_vertices];
+
+	for (auto _ : state)
+	{
+		for (uint32_t vertex_index = 0; vertex_index < k_num_packed_vertices; ++vertex_index)
+		{
+			vector4f normal;
+			vector4f tangent;
+			unpack_qtangent_snorm16(packed[vertex_index], normal, tangent);
+			vector_store3(normal, normals + vertex_index);
+			vector_store(tangent, tangents + vertex_index);
+		}
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(normals);
+	benchmark::DoNotOptimize(tangents);
+	state.SetItemsProcessed(state.iterations() * k_num_packed_vertices);
+}
+
+BENCHMARK(bm_qtangent_snorm16_aos_loop);
+
+static void bm_qtangent_snorm16_soa(benchmark::State& state)
+{
+	uint64_t packed[k_num_packed_vertices];
+	fill_packed_qtangents(packed);
+
+	float output[7][k_num_packed_vertices];
+	const float3f_soa normals = { output[0], output[1], output[2] };
+	const float4f_soa tangents = { output[3], output[4], output[5], output[6] };
+
+	for (auto _ : state)
+	{
+		unpack_qtangent_snorm16_soa(packed, normals, tangents, k_num_packed_vertices);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_packed_vertices);
+}
+
+BENCHMARK(bm_qtangent_snorm16_soa);
@@ -0,0 +1,159 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+#include <rtm/batch/trackf.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace rtm;
+
+// 256 rotation and translation tracks with 10 seconds of keys at 30 keys per second
+constexpr uint32_t k_num_tracks = 256;
+constexpr uint32_t k_num_keys = 301;
+constexpr float k_sample_rate = 30.0F;
+
+// Every iteration advances the sample time by one 60 FPS frame and wraps around
+constexpr float k_frame_time = 1.0F / 60.0F;
+constexpr float k_duration = float(k_num_keys - 1) / k_sample_rate;
+
+struct bench_tracks
+{
+	std::vector<float> rotations[4];
+	std::vector<float> translations[3];
+
+	bench_tracks()
+	{
+		const size_t num_values = size_t(k_num_tracks) * k_num_keys;
+		for (std::vector<float>& stream : rotations)
+			stream.resize(num_values);
+		for (std::vector<float>& stream : translations)
+			stream.resize(num_values);
+
+		for (uint32_t key_index = 0; key_index < k_num_keys; ++key_index)
+		{
+			for (uint32_t track_index = 0; track_index < k_num_tracks; ++track_index)
+			{
+				const size_t value_index = size_t(key_index) * k_num_tracks + track_index;
+				const float angle = float(track_index) * 0.37F + float(key_index) * 0.05F;
+				const quatf rotation = quat_from_euler(angle, 0.5F - angle, angle * 1.5F);
+
+				rotations[0][value_index] = quat_get_x(rotation);
+				rotations[1][value_index] = quat_get_y(rotation);
+				rotations[2][value_index] = quat_get_z(rotation);
+				rotations[3][value_index] = quat_get_w(rotation);
+				translations[0][value_index] = angle;
+				translations[1][value_index] = 1.0F - angle;
+				translations[2][value_index] = angle * 0.5F;
+			}
+		}
+	}
+};
+
+static float advance_sample_time(float sample_time)
+{
+	sample_time += k_frame_time;
+	return sample_time > k_duration ? 0.0F : sample_time;
+}
+
+// The key lookup and interpolation of every track is done separately
+static void bm_track_sample_per_track(benchmark::State& state)
+{
+	const bench_tracks tracks;
+	float rotation_output[4][k_num_tracks];
+	float translation_output[3][k_num_tracks];
+	float sample_time = 0.0F;
+
+	for (auto _ : state)
+	{
+		for (uint32_t track_index = 0; track_index < k_num_tracks; ++track_index)
+		{
+			const float key_time = scalar_clamp(sample_time * k_sample_rate, 0.0F, float(k_num_keys - 1));
+			const float key0_time = scalar_floor(key_time);
+			const uint32_t key0 = uint32_t(key0_time);
+			const uint32_t key1 = key0 < k_num_keys - 1 ? key0 + 1 : key0;
+			const float alpha = key_time - key0_time;
+
+			const size_t key0_index = size_t(key0) * k_num_tracks + track_index;
+			const size_t key1_index = size_t(key1) * k_num_tracks + track_index;
+
+			const quatf start_rotation = quat_set(tracks.rotations[0][key0_index], tracks.rotations[1][key0_index], tracks.rotations[2][key0_index], tracks.rotations[3][key0_index]);
+			const quatf end_rotation = quat_set(tracks.rotations[0][key1_index], tracks.rotations[1][key1_index], tracks.rotations[2][key1_index], tracks.rotations[3][key1_index]);
+			const quatf rotation = quat_lerp(start_rotation, end_rotation, alpha);
+			rotation_output[0][track_index] = quat_get_x(rotation);
+			rotation_output[1][track_index] = quat_get_y(rotation);
+			rotation_output[2][track_index] = quat_get_z(rotation);
+			rotation_output[3][track_index] = quat_get_w(rotation);
+
+			const vector4f start_translation = vector_set(tracks.translations[0][key0_index], tracks.translations[1][key0_index], tracks.translations[2][key0_index]);
+			const vector4f end_translation = vector_set(tracks.translations[0][key1_index], tracks.translations[1][key1_index], tracks.translations[2][key1_index]);
+			const vector4f translation = vector_lerp(start_translation, end_translation, alpha);
+			translation_output[0][track_index] = vector_get_x(translation);
+			translation_output[1][track_index] = vector_get_y(translation);
+			translation_output[2][track_index] = vector_get_z(translation);
+		}
+
+		sample_time = advance_sample_time(sample_time);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotation_output);
+	benchmark::DoNotOptimize(translation_output);
+	state.SetItemsProcessed(state.iterations() * k_num_tracks);
+}
+
+BENCHMARK(bm_track_sample_per_track);
+
+static void bm_track_sample_uniform_soa(benchmark::State& state)
+{
+	const bench_tracks tracks;
+	float rotation_output[4][k_num_tracks];
+	float translation_output[3][k_num_tracks];
+	float sample_time = 0.0F;
+
+	const const_float4f_soa rotation_keys = { tracks.rotations[0].data(), tracks.rotations[1].data(), tracks.rotations[2].data(), tracks.rotations[3].data() };
+	const const_float3f_soa translation_keys = { tracks.translations[0].data(), tracks.translations[1].data(), tracks.translations[2].data() };
+	const float4f_soa rotations = { rotation_output[0], rotation_output[1], rotation_output[2], rotation_output[3] };
+	const float3f_soa translations = { translation_output[0], translation_output[1], translation_output[2] };
+
+	for (auto _ : state)
+	{
+		quat_sample_uniform_soa(rotation_keys, k_num_keys, k_sample_rate, sample_time, rotations, k_num_tracks);
+		vector_sample_uniform_soa(translation_keys, k_num_keys, k_sample_rate, sample_time, translations, k_num_tracks);
+
+		sample_time = advance_sample_time(sample_time);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(rotation_output);
+	benchmark::DoNotOptimize(translation_output);
+	state.SetItemsProcessed(state.iterations() * k_num_tracks);
+}
+
+BENCHMARK(bm_track_sample_uniform_soa);
@@ -0,0 +1,122 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/batch/transform_error.h>
+#include <rtm/qvvf.h>
+
+#include <vector>
+
+using namespace rtm;
+
+constexpr uint32_t k_num_bench_error_transforms = 256;
+constexpr uint32_t k_num_bench_shell_points = 16;
+
+struct bench_error_pose
+{
+	std::vector<qvvf> reference_transforms;
+	std::vector<qvvf> approximation_transforms;
+	std::vector<float> shell_x;
+	std::vector<float> shell_y;
+	std::vector<float> shell_z;
+	std::vector<float> shell_distances;
+};
+
+static bench_error_pose make_bench_error_pose()
+{
+	bench_error_pose pose;
+	for (uint32_t transform_index = 0; transform_index < k_num_bench_error_transforms; ++transform_index)
+	{
+		const float t = float(transform_index);
+		const quatf rotation = quat_from_euler(t * 0.1F, t * -0.2F, t * 0.3F);
+		const quatf approximation_rotation = quat_from_euler(t * 0.1F + 0.001F, t * -0.2F, t * 0.3F - 0.002F);
+		pose.reference_transforms.push_back(qvv_set(rotation, vector_set(t, 1.0F, -t), vector_set(1.0F)));
+		pose.approximation_transforms.push_back(qvv_set(approximation_rotation, vector_set(t + 0.001F, 1.0F, -t), vector_set(1.0F)));
+		pose.shell_distances.push_back(1.0F + t * 0.01F);
+	}
+
+	for (uint32_t point_index = 0; point_index < k_num_bench_shell_points; ++point_index)
+	{
+		const float angle = float(point_index) * 0.39F;
+		pose.shell_x.push_back(scalar_cos(angle));
+		pose.shell_y.push_back(scalar_sin(angle));
+		pose.shell_z.push_back(float(point_index & 1) - 0.5F);
+	}
+
+	return pose;
+}
+
+static void bm_transform_error_qvv_mul_point3(benchmark::State& state)
+{
+	const bench_error_pose pose = make_bench_error_pose();
+	std::vector<float> errors(k_num_bench_error_transforms);
+
+	for (auto _ : state)
+	{
+		for (uint32_t transform_index = 0; transform_index < k_num_bench_error_transforms; ++transform_index)
+		{
+			const qvvf& reference = pose.reference_transforms[transform_index];
+			const qvvf& approximation = pose.approximation_transforms[transform_index];
+			const float shell_distance = pose.shell_distances[transform_index];
+
+			float max_error = 0.0F;
+			for (uint32_t point_index = 0; point_index < k_num_bench_shell_points; ++point_index)
+			{
+				const vector4f point = vector_mul(vector_set(pose.shell_x[point_index], pose.shell_y[point_index], pose.shell_z[point_index]), shell_distance);
+				const float error = vector_distance3(qvv_mul_point3(point, reference), qvv_mul_point3(point, approximation));
+				max_error = scalar_max(max_error, error);
+			}
+
+			errors[transform_index] = max_error;
+		}
+
+		benchmark::DoNotOptimize(errors.data());
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_error_transforms);
+}
+
+BENCHMARK(bm_transform_error_qvv_mul_point3);
+
+static void bm_transform_error_soa(benchmark::State& state)
+{
+	const bench_error_pose pose = make_bench_error_pose();
+	const const_float3f_soa shell_points = { pose.shell_x.data(), pose.shell_y.data(), pose.shell_z.data() };
+	std::vector<float> errors_sq(k_num_bench_error_transforms);
+
+	for (auto _ : state)
+	{
+		qvv_point_error_squared_soa(pose.reference_transforms.data(), pose.approximation_transforms.data(), k_num_bench_error_transforms, shell_points, k_num_bench_shell_points, pose.shell_distances.data(), errors_sq.data());
+
+		benchmark::DoNotOptimize(errors_sq.data());
+		benchmark::ClobberMemory();
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_bench_error_transforms);
+}
+
+BENCHMARK(bm_transform_error_soa);
@@ -0,0 +1,197 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/batch/parallel.h>
+#include <rtm/batch/pipeline.h>
+#include <rtm/batch/qvvf.h>
+#include <rtm/batch/skinning.h>
+#include <rtm/batch/soa.h>
+#include <rtm/batch/trackf.h>
+
+#include <vector>
+
+using namespace rtm;
+
+// A crowd of 64 characters with 128 bones and 1024 vertices each, flattened into one
+// pose. Every frame samples and blends the local pose then composes the object space
+// pose, builds the skinning palette, and skins the vertices.
+// The argument is the number of worker threads in addition to the calling thread: with
+// 0, both halves of consecutive frames run one after the other on the calling thread.
+// Real time is measured since the work happens on other threads.
+
+constexpr uint32_t k_num_pipeline_characters = 64;
+constexpr uint32_t k_num_pipeline_character_bones = 128;
+constexpr uint32_t k_num_pipeline_bones = k_num_pipeline_characters * k_num_pipeline_character_bones;
+constexpr uint32_t k_num_pipeline_vertices = k_num_pipeline_characters * 1024;
+constexpr uint32_t k_num_pipeline_keys = 30;
+
+namespace
+{
+	struct pipeline_bench_data
+	{
+		std::vector<float> key_streams[10];
+		std::vector<float> additive_streams[10];
+
+		std::vector<uint32_t> parent_indices;
+		std::vector<uint32_t> depths;
+		std::vector<uint32_t> sorted_indices;
+		std::vector<uint32_t> depth_offsets;
+		transform_hierarchy hierarchy;
+
+		std::vector<matrix3x4f> inverse_bind_pose;
+
+		std::vector<float3f> positions;
+		std::vector<float3f> skinned_positions;
+		std::vector<uint32_t> bone_indices;
+		std::vector<float> bone_weights;
+
+		pipeline_bench_data()
+			: parent_indices(k_num_pipeline_bones)
+			, depths(k_num_pipeline_bones)
+			, sorted_indices(k_num_pipeline_bones)
+			, depth_offsets(k_num_pipeline_bones + 1)
+			, inverse_bind_pose(k_num_pipeline_bones)
+			, positions(k_num_pipeline_vertices)
+			, skinned_positions(k_num_pipeline_vertices)
+			, bone_indices(k_num_pipeline_vertices * 4)
+			, bone_weights(k_num_pipeline_vertices * 4)
+		{
+			for (uint32_t component_index = 0; component_index < 10; ++component_index)
+			{
+				key_streams[component_index].resize(k_num_pipeline_keys * k_num_pipeline_bones);
+				additive_streams[component_index].resize(k_num_pipeline_bones);
+			}
+
+			for (uint32_t key_index = 0; key_index < k_num_pipeline_keys; ++key_index)
+			{
+				for (uint32_t bone_index = 0; bone_index < k_num_pipeline_bones; ++bone_index)
+				{
+					const float value = float(key_index) * 0.05F + float(bone_index % k_num_pipeline_character_bones) * 0.01F;
+					set(key_streams, key_index * k_num_pipeline_bones + bone_index, qvv_set(quat_from_euler(value, 0.5F - value, value * 0.3F), vector_set(value, 1.0F, -value), vector_set(1.0F)));
+				}
+			}
+
+			for (uint32_t bone_index = 0; bone_index < k_num_pipeline_bones; ++bone_index)
+			{
+				const uint32_t character_bone_index = bone_index % k_num_pipeline_character_bones;
+				const float value = float(character_bone_index) * 0.01F;
+				set(additive_streams, bone_index, qvv_set(quat_from_euler(value, -value, 0.1F), vector_set(0.1F, value, 0.0F), vector_set(1.0F)));
+
+				parent_indices[bone_index] = character_bone_index == 0 ? k_hierarchy_root_index : (bone_index - character_bone_index + (character_bone_index - 1) / 2);
+				inverse_bind_pose[bone_index] = matrix_from_qvv(qvv_inverse(qvv_set(quat_from_euler(value, 0.2F, -value), vector_set(0.0F, value, 1.0F), vector_set(1.0F))));
+			}
+
+			hierarchy = hierarchy_sort_by_depth(parent_indices.data(), k_num_pipeline_bones, depths.data(), sorted_indices.data(), depth_offsets.data());
+
+			for (uint32_t vertex_index = 0; vertex_index < k_num_pipeline_vertices; ++vertex_index)
+			{
+				const uint32_t first_bone_index = (vertex_index / 1024) * k_num_pipeline_character_bones;
+				positions[vertex_index] = float3f{ float(vertex_index % 1024) * 0.01F, 1.0F, 0.5F };
+
+				for (uint32_t influence_index = 0; influence_index < 4; ++influence_index)
+				{
+					bone_indices[vertex_index * 4 + influence_index] = first_bone_index + (vertex_index * 7 + influence_index * 11) % k_num_pipeline_character_bones;
+					bone_weights[vertex_index * 4 + influence_index] = 0.25F;
+				}
+			}
+		}
+
+		static void set(std::vector<float> (&streams)[10], uint32_t index, const qvvf& transform)
+		{
+			const float values[10] =
+			{
+				quat_get_x(transform.rotation), quat_get_y(transform.rotation), quat_get_z(transform.rotation), quat_get_w(transform.rotation),
+				vector_get_x(transform.translation), vector_get_y(transform.translation), vector_get_z(transform.translation),
+				vector_get_x(transform.scale), vector_get_y(transform.scale), vector_get_z(transform.scale),
+			};
+
+			for (uint32_t component_index = 0; component_index < 10; ++component_index)
+				streams[component_index][index] = values[component_index];
+		}
+
+		static const_qvvf_soa get(const std::vector<float> (&streams)[10])
+		{
+			return const_qvvf_soa{
+				const_float4f_soa{ streams[0].data(), streams[1].data(), streams[2].data(), streams[3].data() },
+				const_float3f_soa{ streams[4].data(), streams[5].data(), streams[6].data() },
+				const_float3f_soa{ streams[7].data(), streams[8].data(), streams[9].data() } };
+		}
+
+		void produce(const transform_pipeline_frame& frame) const
+		{
+			const const_qvvf_soa keys = get(key_streams);
+			const float sample_time = float(frame.frame_index % 29) * (1.0F / 30.0F);
+			quat_sample_uniform_soa(keys.rotation, k_num_pipeline_keys, 30.0F, sample_time, frame.local_pose.rotation, k_num_pipeline_bones);
+			vector_sample_uniform_soa(keys.translation, k_num_pipeline_keys, 30.0F, sample_time, frame.local_pose.translation, k_num_pipeline_bones);
+			vector_sample_uniform_soa(keys.scale, k_num_pipeline_keys, 30.0F, sample_time, frame.local_pose.scale, k_num_pipeline_bones);
+
+			qvv_apply_additive_soa(frame.local_pose, get(additive_streams), 0.5F, frame.local_pose, k_num_pipeline_bones);
+		}
+
+		void consume(const transform_pipeline_frame& frame)
+		{
+			soa_unpack(frame.local_pose, k_num_pipeline_bones, frame.object_pose);
+			qvv_local_to_object(hierarchy, frame.object_pose, frame.object_pose);
+
+			for (uint32_t bone_index = 0; bone_index < k_num_pipeline_bones; ++bone_index)
+				frame.palette[bone_index] = matrix_from_qvv(frame.object_pose[bone_index]);
+			matrix_mul_aos(inverse_bind_pose.data(), frame.palette, frame.palette, k_num_pipeline_bones);
+
+			const const_skin_vertex_streams input = { positions.data(), nullptr, nullptr, sizeof(float3f), 0, 0 };
+			const skin_vertex_streams output = { skinned_positions.data(), nullptr, nullptr, sizeof(float3f), 0, 0 };
+			matrix_skin_aos(frame.palette, bone_indices.data(), bone_weights.data(), input, output, k_num_pipeline_vertices);
+		}
+	};
+}
+
+static void bm_transform_pipeline(benchmark::State& state)
+{
+	pipeline_bench_data data;
+
+	std::vector<uint8_t> buffer(transform_pipeline::get_required_size(k_num_pipeline_bones));
+	scratch_arena arena(buffer.data(), buffer.size());
+	transform_pipeline pipeline(arena, k_num_pipeline_bones);
+
+	thread_pool pool(uint32_t(state.range(0)));
+
+	const auto produce_stage = [&data](const transform_pipeline_frame& frame) { data.produce(frame); };
+	const auto consume_stage = [&data](const transform_pipeline_frame& frame) { data.consume(frame); };
+
+	for (auto _ : state)
+	{
+		pipeline.run(pool, produce_stage, consume_stage);
+		benchmark::ClobberMemory();
+	}
+
+	pipeline.flush(consume_stage);
+
+	benchmark::DoNotOptimize(data.skinned_positions.data());
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_transform_pipeline)->Arg(0)->Arg(1)->UseRealTime();
@@ -0,0 +1,176 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/trig_table.h>
+#include <rtm/vector4f.h>
+
+#include <cstdint>
+
+using namespace rtm;
+
+// Evaluates 1024 independent inputs per iteration, like an LFO or a noise pass over a buffer
+constexpr uint32_t k_num_trig_inputs = 1024;
+
+static void fill_trig_inputs(float* angles, float* ys, float* xs)
+{
+	for (uint32_t input_index = 0; input_index < k_num_trig_inputs; ++input_index)
+	{
+		const float value = float(input_index) * 0.37F - 150.0F;
+		angles[input_index] = value;
+		ys[input_index] = scalar_sin(value * 1.3F) * 3.0F;
+		xs[input_index] = scalar_cos(value * 0.7F) * 2.0F;
+	}
+}
+
+template<typename function_type>
+static void bench_trig_angles(benchmark::State& state, function_type function)
+{
+	alignas(16) float angles[k_num_trig_inputs];
+	alignas(16) float ys[k_num_trig_inputs];
+	alignas(16) float xs[k_num_trig_inputs];
+	alignas(16) float outputs[k_num_trig_inputs * 2];
+	fill_trig_inputs(angles, ys, xs);
+	benchmark::DoNotOptimize(angles);
+
+	for (auto _ : state)
+	{
+		for (uint32_t input_index = 0; input_index < k_num_trig_inputs; input_index += 4)
+			function(vector_load(angles + input_index), outputs + input_index * 2);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(outputs);
+	state.SetItemsProcessed(state.iterations() * k_num_trig_inputs);
+}
+
+template<typename function_type>
+static void bench_trig_atan2(benchmark::State& state, function_type function)
+{
+	alignas(16) float angles[k_num_trig_inputs];
+	alignas(16) float ys[k_num_trig_inputs];
+	alignas(16) float xs[k_num_trig_inputs];
+	alignas(16) float outputs[k_num_trig_inputs];
+	fill_trig_inputs(angles, ys, xs);
+	benchmark::DoNotOptimize(ys);
+	benchmark::DoNotOptimize(xs);
+
+	for (auto _ : state)
+	{
+		for (uint32_t input_index = 0; input_index < k_num_trig_inputs; input_index += 4)
+			vector_store(function(vector_load(ys + input_index), vector_load(xs + input_index)), outputs + input_index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(outputs);
+	state.SetItemsProcessed(state.iterations() * k_num_trig_inputs);
+}
+
+static void bm_vector_sin_array(benchmark::State& state)
+{
+	bench_trig_angles(state, [](vector4f_arg0 angle, float* output) { vector_store(vector_sin(angle), output); });
+}
+
+BENCHMARK(bm_vector_sin_array);
+
+static void bm_vector_sin_fast_array(benchmark::State& state)
+{
+	bench_trig_angles(state, [](vector4f_arg0 angle, float* output) { vector_store(vector_sin_fast(angle), output); });
+}
+
+BENCHMARK(bm_vector_sin_fast_array);
+
+static void bm_vector_sin_table_array(benchmark::State& state)
+{
+	bench_trig_angles(state, [](vector4f_arg0 angle, float* output) { vector_store(vector_sin_table(angle), output); });
+}
+
+BENCHMARK(bm_vector_sin_table_array);
+
+static void bm_vector_sincos_array(benchmark::State& state)
+{
+	bench_trig_angles(state, [](vector4f_arg0 angle, float* output)
+	{
+		vector4f sin_;
+		vector4f cos_;
+		vector_sincos(angle, sin_, cos_);
+		vector_store(sin_, output);
+		vector_store(cos_, output + 4);
+	});
+}
+
+BENCHMARK(bm_vector_sincos_array);
+
+static void bm_vector_sincos_fast_array(benchmark::State& state)
+{
+	bench_trig_angles(state, [](vector4f_arg0 angle, float* output)
+	{
+		vector4f sin_;
+		vector4f cos_;
+		vector_sincos_fast(angle, sin_, cos_);
+		vector_store(sin_, output);
+		vector_store(cos_, output + 4);
+	});
+}
+
+BENCHMARK(bm_vector_sincos_fast_array);
+
+static void bm_vector_sincos_table_array(benchmark::State& state)
+{
+	bench_trig_angles(state, [](vector4f_arg0 angle, float* output)
+	{
+		vector4f sin_;
+		vector4f cos_;
+		vector_sincos_table(angle, sin_, cos_);
+		vector_store(sin_, output);
+		vector_store(cos_, output + 4);
+	});
+}
+
+BENCHMARK(bm_vector_sincos_table_array);
+
+static void bm_vector_atan2_array(benchmark::State& state)
+{
+	bench_trig_atan2(state, [](vector4f_arg0 y, vector4f_arg1 x) { return vector_atan2(y, x); });
+}
+
+BENCHMARK(bm_vector_atan2_array);
+
+static void bm_vector_atan2_fast_array(benchmark::State& state)
+{
+	bench_trig_atan2(state, [](vector4f_arg0 y, vector4f_arg1 x) { return vector_atan2_fast(y, x); });
+}
+
+BENCHMARK(bm_vector_atan2_fast_array);
+
+static void bm_vector_atan2_table_array(benchmark::State& state)
+{
+	bench_trig_atan2(state, [](vector4f_arg0 y, vector4f_arg1 x) { return vector_atan2_table(y, x); });
+}
+
+BENCHMARK(bm_vector_atan2_table_array);
@@ -25,6 +25,11 @@
 #include <benchmark/benchmark.h>
 
 #include <rtm/vector4f.h>
+#include <rtm/batch/vector4f.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 
 using namespace rtm;
 
@@ -232,3 +237,139 @@ static void bm_vector_acos_neon(benchmark::State& state)
 
 BENCHMARK(bm_vector_acos_neon);
 #endif
+
+template<typename FuncType>
+static float vector_acos_max_error(FuncType func)
+{
+	// Measure against the standard library in double precision
+	float max_error = 0.0F;
+	for (uint32_t i = 0; i <= 100000; ++i)
+	{
+		const float input = -1.0F + ((1.0F - -1.0F) * float(i) / 100000.0F);
+		const float value = vector_get_x(func(vector_set(input)));
+		max_error = std::max(max_error, float(std::fabs(double(value) - std::acos(double(input)))));
+	}
+	return max_error;
+}
+
+static void bm_vector_acos_rtm(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-0.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(-0.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(-0.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(-0.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_acos(v0);
+		v1 = vector_acos(v1);
+		v2 = vector_acos(v2);
+		v3 = vector_acos(v3);
+		v4 = vector_acos(v4);
+		v5 = vector_acos(v5);
+		v6 = vector_acos(v6);
+		v7 = vector_acos(v7);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_acos_max_error([](vector4f_arg0 input) { return vector_acos(input); });
+}
+
+BENCHMARK(bm_vector_acos_rtm);
+
+static void bm_vector_acos_fast(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-0.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(-0.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(-0.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(-0.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_acos_fast(v0);
+		v1 = vector_acos_fast(v1);
+		v2 = vector_acos_fast(v2);
+		v3 = vector_acos_fast(v3);
+		v4 = vector_acos_fast(v4);
+		v5 = vector_acos_fast(v5);
+		v6 = vector_acos_fast(v6);
+		v7 = vector_acos_fast(v7);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_acos_max_error([](vector4f_arg0 input) { return vector_acos_fast(input); });
+}
+
+BENCHMARK(bm_vector_acos_fast);
+
+// Evaluates a whole array per iteration, like the joint limits of a skeleton
+constexpr uint32_t k_num_array_elements = 4096;
+
+static void fill_acos_array(float* input)
+{
+	for (uint32_t index = 0; index < k_num_array_elements; ++index)
+		input[index] = float(index % 201) * 0.01F - 1.0F;
+}
+
+static void bm_vector_acos_array_loop(benchmark::State& state)
+{
+	alignas(32) float input[k_num_array_elements];
+	alignas(32) float output[k_num_array_elements];
+	fill_acos_array(input);
+
+	for (auto _ : state)
+	{
+		// One register at a time, the reference for the batched version
+		for (uint32_t index = 0; index < k_num_array_elements; index += 4)
+			vector_store(vector_acos(vector_load(input + index)), output + index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_vector_acos_array_loop);
+
+static void bm_vector_acos_array(benchmark::State& state)
+{
+	alignas(32) float input[k_num_array_elements];
+	alignas(32) float output[k_num_array_elements];
+	fill_acos_array(input);
+
+	for (auto _ : state)
+	{
+		vector_acos_array(input, output, k_num_array_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_vector_acos_array);
@@ -26,6 +26,10 @@
 
 #include <rtm/vector4f.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
 using namespace rtm;
 
 RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_asin_scalar(vector4f_arg0 input) RTM_NO_EXCEPT
@@ -223,3 +227,91 @@ static void bm_vector_asin_neon(benchmark::State& state)
 
 BENCHMARK(bm_vector_asin_neon);
 #endif
+
+template<typename FuncType>
+static float vector_asin_max_error(FuncType func)
+{
+	// Measure against the standard library in double precision
+	float max_error = 0.0F;
+	for (uint32_t i = 0; i <= 100000; ++i)
+	{
+		const float input = -1.0F + ((1.0F - -1.0F) * float(i) / 100000.0F);
+		const float value = vector_get_x(func(vector_set(input)));
+		max_error = std::max(max_error, float(std::fabs(double(value) - std::asin(double(input)))));
+	}
+	return max_error;
+}
+
+static void bm_vector_asin_rtm(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-0.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(-0.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(-0.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(-0.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_asin(v0);
+		v1 = vector_asin(v1);
+		v2 = vector_asin(v2);
+		v3 = vector_asin(v3);
+		v4 = vector_asin(v4);
+		v5 = vector_asin(v5);
+		v6 = vector_asin(v6);
+		v7 = vector_asin(v7);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_asin_max_error([](vector4f_arg0 input) { return vector_asin(input); });
+}
+
+BENCHMARK(bm_vector_asin_rtm);
+
+static void bm_vector_asin_fast(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-0.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(-0.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(-0.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(-0.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_asin_fast(v0);
+		v1 = vector_asin_fast(v1);
+		v2 = vector_asin_fast(v2);
+		v3 = vector_asin_fast(v3);
+		v4 = vector_asin_fast(v4);
+		v5 = vector_asin_fast(v5);
+		v6 = vector_asin_fast(v6);
+		v7 = vector_asin_fast(v7);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_asin_max_error([](vector4f_arg0 input) { return vector_asin_fast(input); });
+}
+
+BENCHMARK(bm_vector_asin_fast);
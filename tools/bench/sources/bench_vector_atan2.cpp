@@ -25,6 +25,11 @@
 #include <benchmark/benchmark.h>
 
 #include <rtm/vector4f.h>
+#include <rtm/batch/vector4f.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 
 using namespace rtm;
 
@@ -240,3 +245,146 @@ static void bm_vector_atan2_neon(benchmark::State& state)
 
 BENCHMARK(bm_vector_atan2_neon);
 #endif
+
+template<typename FuncType>
+static float vector_atan2_max_error(FuncType func)
+{
+	// Measure against the standard library in double precision, sweeping around the unit circle
+	float max_error = 0.0F;
+	for (uint32_t i = 0; i <= 100000; ++i)
+	{
+		const float angle = -10.0F + ((10.0F - -10.0F) * float(i) / 100000.0F);
+		const float y = std::sin(angle) * 3.0F;
+		const float x = std::cos(angle * 1.3F) * 2.0F;
+		const float value = vector_get_x(func(vector_set(y), vector_set(x)));
+		max_error = std::max(max_error, float(std::fabs(double(value) - std::atan2(double(y), double(x)))));
+	}
+	return max_error;
+}
+
+static void bm_vector_atan2_rtm(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-0.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(-0.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(-0.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(-0.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_atan2(v0, v1);
+		v1 = vector_atan2(v1, v2);
+		v2 = vector_atan2(v2, v3);
+		v3 = vector_atan2(v3, v4);
+		v4 = vector_atan2(v4, v5);
+		v5 = vector_atan2(v5, v6);
+		v6 = vector_atan2(v6, v7);
+		v7 = vector_atan2(v7, v0);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_atan2_max_error([](vector4f_arg0 y, vector4f_arg1 x) { return vector_atan2(y, x); });
+}
+
+BENCHMARK(bm_vector_atan2_rtm);
+
+static void bm_vector_atan2_fast(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-0.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(-0.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(-0.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(-0.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_atan2_fast(v0, v1);
+		v1 = vector_atan2_fast(v1, v2);
+		v2 = vector_atan2_fast(v2, v3);
+		v3 = vector_atan2_fast(v3, v4);
+		v4 = vector_atan2_fast(v4, v5);
+		v5 = vector_atan2_fast(v5, v6);
+		v6 = vector_atan2_fast(v6, v7);
+		v7 = vector_atan2_fast(v7, v0);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_atan2_max_error([](vector4f_arg0 y, vector4f_arg1 x) { return vector_atan2_fast(y, x); });
+}
+
+BENCHMARK(bm_vector_atan2_fast);
+
+// Evaluates a whole array per iteration, like the joints of an IK chain
+constexpr uint32_t k_num_array_elements = 4096;
+
+static void fill_atan2_arrays(float* y, float* x)
+{
+	for (uint32_t index = 0; index < k_num_array_elements; ++index)
+	{
+		y[index] = float(index % 97) * 0.13F - 6.0F;
+		x[index] = float(index % 89) * 0.11F - 4.5F;
+	}
+}
+
+static void bm_vector_atan2_array_loop(benchmark::State& state)
+{
+	alignas(32) float y[k_num_array_elements];
+	alignas(32) float x[k_num_array_elements];
+	alignas(32) float output[k_num_array_elements];
+	fill_atan2_arrays(y, x);
+
+	for (auto _ : state)
+	{
+		// One register at a time, the reference for the batched version
+		for (uint32_t index = 0; index < k_num_array_elements; index += 4)
+			vector_store(vector_atan2(vector_load(y + index), vector_load(x + index)), output + index);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_vector_atan2_array_loop);
+
+static void bm_vector_atan2_array(benchmark::State& state)
+{
+	alignas(32) float y[k_num_array_elements];
+	alignas(32) float x[k_num_array_elements];
+	alignas(32) float output[k_num_array_elements];
+	fill_atan2_arrays(y, x);
+
+	for (auto _ : state)
+	{
+		vector_atan2_array(y, x, output, k_num_array_elements);
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_array_elements);
+}
+
+BENCHMARK(bm_vector_atan2_array);
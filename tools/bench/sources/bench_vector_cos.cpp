@@ -26,6 +26,10 @@
 
 #include <rtm/vector4f.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
 using namespace rtm;
 
 RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_cos_scalar(vector4f_arg0 input) RTM_NO_EXCEPT
@@ -235,3 +239,97 @@ static void bm_vector_cos_neon(benchmark::State& state)
 
 BENCHMARK(bm_vector_cos_neon);
 #endif
+
+template<typename FuncType>
+static float vector_cos_max_error(FuncType func, float max_angle)
+{
+	// Measure against the standard library in double precision over [-max_angle, max_angle]
+	float max_error = 0.0F;
+	for (uint32_t i = 0; i <= 100000; ++i)
+	{
+		const float input = -max_angle + ((max_angle - -max_angle) * float(i) / 100000.0F);
+		const float value = vector_get_x(func(vector_set(input)));
+		max_error = std::max(max_error, float(std::fabs(double(value) - std::cos(double(input)))));
+	}
+	return max_error;
+}
+
+static void bm_vector_cos_rtm(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-123.134f);
+	vector4f v1 = vector_set(123.134f);
+	vector4f v2 = vector_set(-123.134f);
+	vector4f v3 = vector_set(123.134f);
+	vector4f v4 = vector_set(-123.134f);
+	vector4f v5 = vector_set(123.134f);
+	vector4f v6 = vector_set(-123.134f);
+	vector4f v7 = vector_set(123.134f);
+
+	vector4f scale = vector_set(100.0F);
+
+	for (auto _ : state)
+	{
+		v0 = vector_mul(vector_cos(v0), scale);
+		v1 = vector_mul(vector_cos(v1), scale);
+		v2 = vector_mul(vector_cos(v2), scale);
+		v3 = vector_mul(vector_cos(v3), scale);
+		v4 = vector_mul(vector_cos(v4), scale);
+		v5 = vector_mul(vector_cos(v5), scale);
+		v6 = vector_mul(vector_cos(v6), scale);
+		v7 = vector_mul(vector_cos(v7), scale);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_cos_max_error([](vector4f_arg0 input) { return vector_cos(input); }, rtm::constants::pi());
+	state.counters["max_error_100"] = vector_cos_max_error([](vector4f_arg0 input) { return vector_cos(input); }, 100.0F);
+}
+
+BENCHMARK(bm_vector_cos_rtm);
+
+static void bm_vector_cos_fast(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-123.134f);
+	vector4f v1 = vector_set(123.134f);
+	vector4f v2 = vector_set(-123.134f);
+	vector4f v3 = vector_set(123.134f);
+	vector4f v4 = vector_set(-123.134f);
+	vector4f v5 = vector_set(123.134f);
+	vector4f v6 = vector_set(-123.134f);
+	vector4f v7 = vector_set(123.134f);
+
+	vector4f scale = vector_set(100.0F);
+
+	for (auto _ : state)
+	{
+		v0 = vector_mul(vector_cos_fast(v0), scale);
+		v1 = vector_mul(vector_cos_fast(v1), scale);
+		v2 = vector_mul(vector_cos_fast(v2), scale);
+		v3 = vector_mul(vector_cos_fast(v3), scale);
+		v4 = vector_mul(vector_cos_fast(v4), scale);
+		v5 = vector_mul(vector_cos_fast(v5), scale);
+		v6 = vector_mul(vector_cos_fast(v6), scale);
+		v7 = vector_mul(vector_cos_fast(v7), scale);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_cos_max_error([](vector4f_arg0 input) { return vector_cos_fast(input); }, rtm::constants::pi());
+	state.counters["max_error_100"] = vector_cos_max_error([](vector4f_arg0 input) { return vector_cos_fast(input); }, 100.0F);
+}
+
+BENCHMARK(bm_vector_cos_fast);
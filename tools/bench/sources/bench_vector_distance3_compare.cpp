@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/scalarf.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+// Tests 256 points against a sphere per iteration
+constexpr uint32_t k_num_batch_points = 256;
+
+static void fill_bench_points(vector4f* points)
+{
+	for (uint32_t point_index = 0; point_index < k_num_batch_points; ++point_index)
+	{
+		const float value = float(point_index) * 0.37F;
+		points[point_index] = vector_set(value, 10.0F - value, value * 0.5F - 5.0F, 0.0F);
+	}
+}
+
+// Materializes the distance with a square root before comparing it
+static void bm_vector_distance3_compare_sqrt(benchmark::State& state)
+{
+	vector4f points[k_num_batch_points];
+	fill_bench_points(points);
+
+	const vector4f center = vector_set(20.0F, -5.0F, 10.0F, 0.0F);
+	const float radius = 35.0F;
+	uint32_t num_inside = 0;
+
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < k_num_batch_points; ++point_index)
+		{
+			const float distance = scalar_sqrt(float(vector_length_squared3(vector_sub(points[point_index], center))));
+			num_inside += distance < radius ? 1 : 0;
+		}
+
+		benchmark::DoNotOptimize(num_inside);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_batch_points);
+}
+
+BENCHMARK(bm_vector_distance3_compare_sqrt);
+
+// Compares the lazy distance which uses the squared distance and skips the square root
+static void bm_vector_distance3_compare(benchmark::State& state)
+{
+	vector4f points[k_num_batch_points];
+	fill_bench_points(points);
+
+	const vector4f center = vector_set(20.0F, -5.0F, 10.0F, 0.0F);
+	const float radius = 35.0F;
+	uint32_t num_inside = 0;
+
+	for (auto _ : state)
+	{
+		for (uint32_t point_index = 0; point_index < k_num_batch_points; ++point_index)
+			num_inside += vector_distance3(points[point_index], center) < radius ? 1 : 0;
+
+		benchmark::DoNotOptimize(num_inside);
+	}
+
+	state.SetItemsProcessed(state.iterations() * k_num_batch_points);
+}
+
+BENCHMARK(bm_vector_distance3_compare);
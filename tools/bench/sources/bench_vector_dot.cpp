@@ -0,0 +1,129 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <rtm/quatf.h>
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+// The horizontal reductions are the hot part of these, they are most relevant on ARM64
+// where vaddvq_f32/vpaddq_f32 replace the pairwise steps.
+// Every result feeds the next input through a tiny offset to keep the values stable.
+
+// Latency: the scalar result feeds the next dot product
+static void bm_vector_dot_latency(benchmark::State& state)
+{
+	const vector4f base = vector_set(0.3F, -0.5F, 0.7F, 0.4F);
+	const vector4f offset = vector_set(1.0E-6F);
+	vector4f input = base;
+	const vector4f rhs = vector_set(0.99F, 1.01F, 0.98F, 1.02F);
+
+	for (auto _ : state)
+	{
+		const float dot = vector_dot(input, rhs);
+		input = vector_mul_add(offset, dot, base);
+	}
+
+	benchmark::DoNotOptimize(input);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_vector_dot_latency);
+
+// Latency: the result stays in a register and is broadcast to all lanes
+static void bm_vector_dot_as_vector_latency(benchmark::State& state)
+{
+	const vector4f base = vector_set(0.3F, -0.5F, 0.7F, 0.4F);
+	const vector4f offset = vector_set(1.0E-6F);
+	vector4f input = base;
+	const vector4f rhs = vector_set(0.99F, 1.01F, 0.98F, 1.02F);
+
+	for (auto _ : state)
+	{
+		const vector4f dot = vector_dot(input, rhs);
+		input = vector_mul_add(offset, dot, base);
+	}
+
+	benchmark::DoNotOptimize(input);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_vector_dot_as_vector_latency);
+
+static void bm_vector_dot3_latency(benchmark::State& state)
+{
+	const vector4f base = vector_set(0.3F, -0.5F, 0.7F, 0.4F);
+	const vector4f offset = vector_set(1.0E-6F);
+	vector4f input = base;
+	const vector4f rhs = vector_set(0.99F, 1.01F, 0.98F, 1.02F);
+
+	for (auto _ : state)
+	{
+		const float dot = vector_dot3(input, rhs);
+		input = vector_mul_add(offset, dot, base);
+	}
+
+	benchmark::DoNotOptimize(input);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_vector_dot3_latency);
+
+static void bm_vector_length_squared_latency(benchmark::State& state)
+{
+	const vector4f base = vector_set(0.3F, -0.5F, 0.7F, 0.4F);
+	const vector4f offset = vector_set(1.0E-6F);
+	vector4f input = base;
+
+	for (auto _ : state)
+	{
+		const float length_squared = vector_length_squared(input);
+		input = vector_mul_add(offset, length_squared, base);
+	}
+
+	benchmark::DoNotOptimize(input);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_vector_length_squared_latency);
+
+static void bm_quat_dot_latency(benchmark::State& state)
+{
+	const vector4f base = vector_set(0.3F, -0.5F, 0.7F, 0.4F);
+	const vector4f offset = vector_set(1.0E-6F);
+	quatf input = vector_to_quat(base);
+	const quatf rhs = quat_set(0.99F, 1.01F, 0.98F, 1.02F);
+
+	for (auto _ : state)
+	{
+		const float dot = quat_dot(input, rhs);
+		input = vector_to_quat(vector_mul_add(offset, dot, base));
+	}
+
+	benchmark::DoNotOptimize(input);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_quat_dot_latency);
@@ -0,0 +1,116 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+#include <cmath>
+
+using namespace rtm;
+
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_exp_scalar(vector4f_arg0 input) RTM_NO_EXCEPT
+{
+	float x = scalar_exp(float(vector_get_x(input)));
+	float y = scalar_exp(float(vector_get_y(input)));
+	float z = scalar_exp(float(vector_get_z(input)));
+	float w = scalar_exp(float(vector_get_w(input)));
+	return vector_set(x, y, z, w);
+}
+
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_exp_rtm(vector4f_arg0 input) RTM_NO_EXCEPT
+{
+	return vector_exp(input);
+}
+
+static void bm_vector_exp_scalar(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-0.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(-0.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(-0.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(-0.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_neg(vector_exp_scalar(v0));
+		v1 = vector_neg(vector_exp_scalar(v1));
+		v2 = vector_neg(vector_exp_scalar(v2));
+		v3 = vector_neg(vector_exp_scalar(v3));
+		v4 = vector_neg(vector_exp_scalar(v4));
+		v5 = vector_neg(vector_exp_scalar(v5));
+		v6 = vector_neg(vector_exp_scalar(v6));
+		v7 = vector_neg(vector_exp_scalar(v7));
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK(bm_vector_exp_scalar);
+
+static void bm_vector_exp_rtm(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-0.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(-0.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(-0.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(-0.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_neg(vector_exp_rtm(v0));
+		v1 = vector_neg(vector_exp_rtm(v1));
+		v2 = vector_neg(vector_exp_rtm(v2));
+		v3 = vector_neg(vector_exp_rtm(v3));
+		v4 = vector_neg(vector_exp_rtm(v4));
+		v5 = vector_neg(vector_exp_rtm(v5));
+		v6 = vector_neg(vector_exp_rtm(v6));
+		v7 = vector_neg(vector_exp_rtm(v7));
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK(bm_vector_exp_rtm);
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+#include <cmath>
+
+using namespace rtm;
+
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_log_scalar(vector4f_arg0 input) RTM_NO_EXCEPT
+{
+	float x = scalar_log(float(vector_get_x(input)));
+	float y = scalar_log(float(vector_get_y(input)));
+	float z = scalar_log(float(vector_get_z(input)));
+	float w = scalar_log(float(vector_get_w(input)));
+	return vector_set(x, y, z, w);
+}
+
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_log_rtm(vector4f_arg0 input) RTM_NO_EXCEPT
+{
+	return vector_log(input);
+}
+
+static void bm_vector_log_scalar(benchmark::State& state)
+{
+	const vector4f offset = vector_set(1.5f);
+	vector4f v0 = vector_set(0.134f);
+	vector4f v1 = vector_set(2.5f);
+	vector4f v2 = vector_set(0.134f);
+	vector4f v3 = vector_set(2.5f);
+	vector4f v4 = vector_set(0.134f);
+	vector4f v5 = vector_set(2.5f);
+	vector4f v6 = vector_set(0.134f);
+	vector4f v7 = vector_set(2.5f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_log_scalar(vector_add(vector_abs(v0), offset));
+		v1 = vector_log_scalar(vector_add(vector_abs(v1), offset));
+		v2 = vector_log_scalar(vector_add(vector_abs(v2), offset));
+		v3 = vector_log_scalar(vector_add(vector_abs(v3), offset));
+		v4 = vector_log_scalar(vector_add(vector_abs(v4), offset));
+		v5 = vector_log_scalar(vector_add(vector_abs(v5), offset));
+		v6 = vector_log_scalar(vector_add(vector_abs(v6), offset));
+		v7 = vector_log_scalar(vector_add(vector_abs(v7), offset));
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK(bm_vector_log_scalar);
+
+static void bm_vector_log_rtm(benchmark::State& state)
+{
+	const vector4f offset = vector_set(1.5f);
+	vector4f v0 = vector_set(0.134f);
+	vector4f v1 = vector_set(2.5f);
+	vector4f v2 = vector_set(0.134f);
+	vector4f v3 = vector_set(2.5f);
+	vector4f v4 = vector_set(0.134f);
+	vector4f v5 = vector_set(2.5f);
+	vector4f v6 = vector_set(0.134f);
+	vector4f v7 = vector_set(2.5f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_log_rtm(vector_add(vector_abs(v0), offset));
+		v1 = vector_log_rtm(vector_add(vector_abs(v1), offset));
+		v2 = vector_log_rtm(vector_add(vector_abs(v2), offset));
+		v3 = vector_log_rtm(vector_add(vector_abs(v3), offset));
+		v4 = vector_log_rtm(vector_add(vector_abs(v4), offset));
+		v5 = vector_log_rtm(vector_add(vector_abs(v5), offset));
+		v6 = vector_log_rtm(vector_add(vector_abs(v6), offset));
+		v7 = vector_log_rtm(vector_add(vector_abs(v7), offset));
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK(bm_vector_log_rtm);
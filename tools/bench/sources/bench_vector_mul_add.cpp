@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+// Evaluates 256 polynomials per iteration for the throughput variant
+constexpr uint32_t k_num_batch_vectors = 256;
+
+// Evaluates a degree 6 polynomial with Horner's method, the same shape as our minimax approximations
+RTM_FORCE_INLINE vector4f RTM_SIMD_CALL evaluate_polynomial(vector4f_arg0 x) RTM_NO_EXCEPT
+{
+	vector4f result = vector_mul_add(x, vector_set(-2.3828544692960918e-8F), vector_set(2.7521557770526783e-6F));
+	result = vector_mul_add(result, x, vector_set(-1.9840782426250314e-4F));
+	result = vector_mul_add(result, x, vector_set(8.3333303183525942e-3F));
+	result = vector_mul_add(result, x, vector_set(-1.6666666601721269e-1F));
+	result = vector_mul_add(result, x, vector_set(1.0F));
+	return vector_neg_mul_sub(result, x, vector_set(0.5F));
+}
+
+// Latency: every multiplication/addition depends on the previous result
+static void bm_vector_mul_add_latency(benchmark::State& state)
+{
+	vector4f result = vector_set(0.3F, -0.5F, 0.7F, 0.1F);
+
+	for (auto _ : state)
+		result = evaluate_polynomial(result);
+
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_vector_mul_add_latency);
+
+// Throughput: every polynomial is independent
+static void bm_vector_mul_add_loop(benchmark::State& state)
+{
+	vector4f input[k_num_batch_vectors];
+	vector4f output[k_num_batch_vectors];
+
+	for (uint32_t vector_index = 0; vector_index < k_num_batch_vectors; ++vector_index)
+	{
+		const float value = float(vector_index) * (1.0F / k_num_batch_vectors);
+		input[vector_index] = vector_set(value, 1.0F - value, value * 0.5F, -value);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t vector_index = 0; vector_index < k_num_batch_vectors; ++vector_index)
+			output[vector_index] = evaluate_polynomial(input[vector_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_vectors);
+}
+
+BENCHMARK(bm_vector_mul_add_loop);
@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+// Normalizes 256 vectors per iteration for the throughput variant
+constexpr uint32_t k_num_batch_vectors = 256;
+
+// Latency: every normalization depends on the previous result
+static void bm_vector_normalize3_latency(benchmark::State& state)
+{
+	vector4f result = vector_set(0.3F, -0.5F, 0.7F, 0.0F);
+
+	for (auto _ : state)
+		result = vector_normalize3(result);
+
+	benchmark::DoNotOptimize(result);
+	state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(bm_vector_normalize3_latency);
+
+// Throughput: every normalization is independent
+static void bm_vector_normalize3_loop(benchmark::State& state)
+{
+	vector4f input[k_num_batch_vectors];
+	vector4f output[k_num_batch_vectors];
+
+	for (uint32_t vector_index = 0; vector_index < k_num_batch_vectors; ++vector_index)
+	{
+		const float value = float(vector_index) * 0.37F;
+		input[vector_index] = vector_set(value, 1.0F - value, value * 0.5F + 0.1F, 0.0F);
+	}
+
+	for (auto _ : state)
+	{
+		for (uint32_t vector_index = 0; vector_index < k_num_batch_vectors; ++vector_index)
+			output[vector_index] = vector_normalize3(input[vector_index]);
+
+		benchmark::ClobberMemory();
+	}
+
+	benchmark::DoNotOptimize(output);
+	state.SetItemsProcessed(state.iterations() * k_num_batch_vectors);
+}
+
+BENCHMARK(bm_vector_normalize3_loop);
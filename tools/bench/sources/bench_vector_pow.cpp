@@ -0,0 +1,120 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+#include <cmath>
+
+using namespace rtm;
+
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_pow_scalar(vector4f_arg0 base, vector4f_arg1 exponent) RTM_NO_EXCEPT
+{
+	float x = scalar_pow(float(vector_get_x(base)), float(vector_get_x(exponent)));
+	float y = scalar_pow(float(vector_get_y(base)), float(vector_get_y(exponent)));
+	float z = scalar_pow(float(vector_get_z(base)), float(vector_get_z(exponent)));
+	float w = scalar_pow(float(vector_get_w(base)), float(vector_get_w(exponent)));
+	return vector_set(x, y, z, w);
+}
+
+RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_pow_rtm(vector4f_arg0 base, vector4f_arg1 exponent) RTM_NO_EXCEPT
+{
+	return vector_pow(base, exponent);
+}
+
+static void bm_vector_pow_scalar(benchmark::State& state)
+{
+	const vector4f offset = vector_set(1.0f);
+	const vector4f exponent = vector_set(0.75f);
+	vector4f v0 = vector_set(0.134f);
+	vector4f v1 = vector_set(2.5f);
+	vector4f v2 = vector_set(0.134f);
+	vector4f v3 = vector_set(2.5f);
+	vector4f v4 = vector_set(0.134f);
+	vector4f v5 = vector_set(2.5f);
+	vector4f v6 = vector_set(0.134f);
+	vector4f v7 = vector_set(2.5f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_pow_scalar(vector_add(vector_abs(v0), offset), exponent);
+		v1 = vector_pow_scalar(vector_add(vector_abs(v1), offset), exponent);
+		v2 = vector_pow_scalar(vector_add(vector_abs(v2), offset), exponent);
+		v3 = vector_pow_scalar(vector_add(vector_abs(v3), offset), exponent);
+		v4 = vector_pow_scalar(vector_add(vector_abs(v4), offset), exponent);
+		v5 = vector_pow_scalar(vector_add(vector_abs(v5), offset), exponent);
+		v6 = vector_pow_scalar(vector_add(vector_abs(v6), offset), exponent);
+		v7 = vector_pow_scalar(vector_add(vector_abs(v7), offset), exponent);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK(bm_vector_pow_scalar);
+
+static void bm_vector_pow_rtm(benchmark::State& state)
+{
+	const vector4f offset = vector_set(1.0f);
+	const vector4f exponent = vector_set(0.75f);
+	vector4f v0 = vector_set(0.134f);
+	vector4f v1 = vector_set(2.5f);
+	vector4f v2 = vector_set(0.134f);
+	vector4f v3 = vector_set(2.5f);
+	vector4f v4 = vector_set(0.134f);
+	vector4f v5 = vector_set(2.5f);
+	vector4f v6 = vector_set(0.134f);
+	vector4f v7 = vector_set(2.5f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_pow_rtm(vector_add(vector_abs(v0), offset), exponent);
+		v1 = vector_pow_rtm(vector_add(vector_abs(v1), offset), exponent);
+		v2 = vector_pow_rtm(vector_add(vector_abs(v2), offset), exponent);
+		v3 = vector_pow_rtm(vector_add(vector_abs(v3), offset), exponent);
+		v4 = vector_pow_rtm(vector_add(vector_abs(v4), offset), exponent);
+		v5 = vector_pow_rtm(vector_add(vector_abs(v5), offset), exponent);
+		v6 = vector_pow_rtm(vector_add(vector_abs(v6), offset), exponent);
+		v7 = vector_pow_rtm(vector_add(vector_abs(v7), offset), exponent);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK(bm_vector_pow_rtm);
@@ -171,3 +171,114 @@ static void bm_vector_reciprocal_neon(benchmark::State& state)
 
 BENCHMARK(bm_vector_reciprocal_neon);
 #endif
+
+template<uint32_t num_refinement_steps>
+static void bm_vector_reciprocal_estimate(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-123.134f);
+	vector4f v1 = vector_set(123.134f);
+	vector4f v2 = vector_set(-123.134f);
+	vector4f v3 = vector_set(123.134f);
+	vector4f v4 = vector_set(-123.134f);
+	vector4f v5 = vector_set(123.134f);
+	vector4f v6 = vector_set(-123.134f);
+	vector4f v7 = vector_set(123.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_reciprocal_estimate<num_refinement_steps>(v0);
+		v1 = vector_reciprocal_estimate<num_refinement_steps>(v1);
+		v2 = vector_reciprocal_estimate<num_refinement_steps>(v2);
+		v3 = vector_reciprocal_estimate<num_refinement_steps>(v3);
+		v4 = vector_reciprocal_estimate<num_refinement_steps>(v4);
+		v5 = vector_reciprocal_estimate<num_refinement_steps>(v5);
+		v6 = vector_reciprocal_estimate<num_refinement_steps>(v6);
+		v7 = vector_reciprocal_estimate<num_refinement_steps>(v7);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK_TEMPLATE(bm_vector_reciprocal_estimate, 0);
+BENCHMARK_TEMPLATE(bm_vector_reciprocal_estimate, 1);
+BENCHMARK_TEMPLATE(bm_vector_reciprocal_estimate, 2);
+
+static void bm_vector_sqrt_reciprocal_exact(benchmark::State& state)
+{
+	vector4f v0 = vector_set(123.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(123.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(123.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(123.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_reciprocal(vector_sqrt(v0));
+		v1 = vector_reciprocal(vector_sqrt(v1));
+		v2 = vector_reciprocal(vector_sqrt(v2));
+		v3 = vector_reciprocal(vector_sqrt(v3));
+		v4 = vector_reciprocal(vector_sqrt(v4));
+		v5 = vector_reciprocal(vector_sqrt(v5));
+		v6 = vector_reciprocal(vector_sqrt(v6));
+		v7 = vector_reciprocal(vector_sqrt(v7));
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK(bm_vector_sqrt_reciprocal_exact);
+
+template<uint32_t num_refinement_steps>
+static void bm_vector_sqrt_reciprocal_estimate(benchmark::State& state)
+{
+	vector4f v0 = vector_set(123.134f);
+	vector4f v1 = vector_set(0.134f);
+	vector4f v2 = vector_set(123.134f);
+	vector4f v3 = vector_set(0.134f);
+	vector4f v4 = vector_set(123.134f);
+	vector4f v5 = vector_set(0.134f);
+	vector4f v6 = vector_set(123.134f);
+	vector4f v7 = vector_set(0.134f);
+
+	for (auto _ : state)
+	{
+		v0 = vector_sqrt_reciprocal_estimate<num_refinement_steps>(v0);
+		v1 = vector_sqrt_reciprocal_estimate<num_refinement_steps>(v1);
+		v2 = vector_sqrt_reciprocal_estimate<num_refinement_steps>(v2);
+		v3 = vector_sqrt_reciprocal_estimate<num_refinement_steps>(v3);
+		v4 = vector_sqrt_reciprocal_estimate<num_refinement_steps>(v4);
+		v5 = vector_sqrt_reciprocal_estimate<num_refinement_steps>(v5);
+		v6 = vector_sqrt_reciprocal_estimate<num_refinement_steps>(v6);
+		v7 = vector_sqrt_reciprocal_estimate<num_refinement_steps>(v7);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+}
+
+BENCHMARK_TEMPLATE(bm_vector_sqrt_reciprocal_estimate, 0);
+BENCHMARK_TEMPLATE(bm_vector_sqrt_reciprocal_estimate, 1);
+BENCHMARK_TEMPLATE(bm_vector_sqrt_reciprocal_estimate, 2);
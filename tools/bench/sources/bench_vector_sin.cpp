@@ -26,6 +26,10 @@
 
 #include <rtm/vector4f.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
 using namespace rtm;
 
 RTM_FORCE_NOINLINE vector4f RTM_SIMD_CALL vector_sin_scalar(vector4f_arg0 input) RTM_NO_EXCEPT
@@ -235,3 +239,97 @@ static void bm_vector_sin_neon(benchmark::State& state)
 
 BENCHMARK(bm_vector_sin_neon);
 #endif
+
+template<typename FuncType>
+static float vector_sin_max_error(FuncType func, float max_angle)
+{
+	// Measure against the standard library in double precision over [-max_angle, max_angle]
+	float max_error = 0.0F;
+	for (uint32_t i = 0; i <= 100000; ++i)
+	{
+		const float input = -max_angle + ((max_angle - -max_angle) * float(i) / 100000.0F);
+		const float value = vector_get_x(func(vector_set(input)));
+		max_error = std::max(max_error, float(std::fabs(double(value) - std::sin(double(input)))));
+	}
+	return max_error;
+}
+
+static void bm_vector_sin_rtm(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-123.134f);
+	vector4f v1 = vector_set(123.134f);
+	vector4f v2 = vector_set(-123.134f);
+	vector4f v3 = vector_set(123.134f);
+	vector4f v4 = vector_set(-123.134f);
+	vector4f v5 = vector_set(123.134f);
+	vector4f v6 = vector_set(-123.134f);
+	vector4f v7 = vector_set(123.134f);
+
+	vector4f scale = vector_set(100.0F);
+
+	for (auto _ : state)
+	{
+		v0 = vector_mul(vector_sin(v0), scale);
+		v1 = vector_mul(vector_sin(v1), scale);
+		v2 = vector_mul(vector_sin(v2), scale);
+		v3 = vector_mul(vector_sin(v3), scale);
+		v4 = vector_mul(vector_sin(v4), scale);
+		v5 = vector_mul(vector_sin(v5), scale);
+		v6 = vector_mul(vector_sin(v6), scale);
+		v7 = vector_mul(vector_sin(v7), scale);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_sin_max_error([](vector4f_arg0 input) { return vector_sin(input); }, rtm::constants::pi());
+	state.counters["max_error_100"] = vector_sin_max_error([](vector4f_arg0 input) { return vector_sin(input); }, 100.0F);
+}
+
+BENCHMARK(bm_vector_sin_rtm);
+
+static void bm_vector_sin_fast(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-123.134f);
+	vector4f v1 = vector_set(123.134f);
+	vector4f v2 = vector_set(-123.134f);
+	vector4f v3 = vector_set(123.134f);
+	vector4f v4 = vector_set(-123.134f);
+	vector4f v5 = vector_set(123.134f);
+	vector4f v6 = vector_set(-123.134f);
+	vector4f v7 = vector_set(123.134f);
+
+	vector4f scale = vector_set(100.0F);
+
+	for (auto _ : state)
+	{
+		v0 = vector_mul(vector_sin_fast(v0), scale);
+		v1 = vector_mul(vector_sin_fast(v1), scale);
+		v2 = vector_mul(vector_sin_fast(v2), scale);
+		v3 = vector_mul(vector_sin_fast(v3), scale);
+		v4 = vector_mul(vector_sin_fast(v4), scale);
+		v5 = vector_mul(vector_sin_fast(v5), scale);
+		v6 = vector_mul(vector_sin_fast(v6), scale);
+		v7 = vector_mul(vector_sin_fast(v7), scale);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+	benchmark::DoNotOptimize(v4);
+	benchmark::DoNotOptimize(v5);
+	benchmark::DoNotOptimize(v6);
+	benchmark::DoNotOptimize(v7);
+
+	state.counters["max_error"] = vector_sin_max_error([](vector4f_arg0 input) { return vector_sin_fast(input); }, rtm::constants::pi());
+	state.counters["max_error_100"] = vector_sin_max_error([](vector4f_arg0 input) { return vector_sin_fast(input); }, 100.0F);
+}
+
+BENCHMARK(bm_vector_sin_fast);
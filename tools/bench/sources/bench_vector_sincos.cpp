@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2020 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <rtm/vector4f.h>
+
+using namespace rtm;
+
+static void bm_vector_sin_cos(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-123.134f);
+	vector4f v1 = vector_set(123.134f);
+	vector4f v2 = vector_set(-123.134f);
+	vector4f v3 = vector_set(123.134f);
+
+	vector4f scale = vector_set(100.0F);
+
+	for (auto _ : state)
+	{
+		v0 = vector_mul(vector_add(vector_sin(v0), vector_cos(v0)), scale);
+		v1 = vector_mul(vector_add(vector_sin(v1), vector_cos(v1)), scale);
+		v2 = vector_mul(vector_add(vector_sin(v2), vector_cos(v2)), scale);
+		v3 = vector_mul(vector_add(vector_sin(v3), vector_cos(v3)), scale);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+}
+
+BENCHMARK(bm_vector_sin_cos);
+
+static void bm_vector_sincos(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-123.134f);
+	vector4f v1 = vector_set(123.134f);
+	vector4f v2 = vector_set(-123.134f);
+	vector4f v3 = vector_set(123.134f);
+
+	vector4f scale = vector_set(100.0F);
+
+	for (auto _ : state)
+	{
+		vector4f sin0;
+		vector4f sin1;
+		vector4f sin2;
+		vector4f sin3;
+		vector4f cos0;
+		vector4f cos1;
+		vector4f cos2;
+		vector4f cos3;
+
+		vector_sincos(v0, sin0, cos0);
+		vector_sincos(v1, sin1, cos1);
+		vector_sincos(v2, sin2, cos2);
+		vector_sincos(v3, sin3, cos3);
+
+		v0 = vector_mul(vector_add(sin0, cos0), scale);
+		v1 = vector_mul(vector_add(sin1, cos1), scale);
+		v2 = vector_mul(vector_add(sin2, cos2), scale);
+		v3 = vector_mul(vector_add(sin3, cos3), scale);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+}
+
+BENCHMARK(bm_vector_sincos);
+
+static void bm_vector_tan(benchmark::State& state)
+{
+	vector4f v0 = vector_set(-123.134f);
+	vector4f v1 = vector_set(123.134f);
+	vector4f v2 = vector_set(-123.134f);
+	vector4f v3 = vector_set(123.134f);
+
+	vector4f scale = vector_set(100.0F);
+
+	for (auto _ : state)
+	{
+		v0 = vector_mul(vector_tan(v0), scale);
+		v1 = vector_mul(vector_tan(v1), scale);
+		v2 = vector_mul(vector_tan(v2), scale);
+		v3 = vector_mul(vector_tan(v3), scale);
+	}
+
+	benchmark::DoNotOptimize(v0);
+	benchmark::DoNotOptimize(v1);
+	benchmark::DoNotOptimize(v2);
+	benchmark::DoNotOptimize(v3);
+}
+
+BENCHMARK(bm_vector_tan);
@@ -0,0 +1,243 @@
+#ifndef RTM_CAPI_H
+#define RTM_CAPI_H
+
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+//////////////////////////////////////////////////////////////////////////
+// A C interface to the RTM batch functions, compiled as the rtm_capi shared library.
+//
+// It is meant for languages that call native code through a foreign function
+// interface (C#, Python, Lua, etc.) where every call is expensive: each function
+// processes a whole array. The types are plain structures of floats, they match the
+// memory layout of their RTM counterparts.
+//
+// Internally, the batch kernels are selected at runtime for the CPU, see rtm/batch/dispatch.h.
+//
+// Every function returns RTM_RESULT_OK or the reason the arguments were rejected, in
+// which case nothing is written. Pointers can be null when the count is zero.
+// Unless noted otherwise, the output must not overlap the input.
+//////////////////////////////////////////////////////////////////////////
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+	#if defined(RTM_CAPI_BUILD)
+		#define RTM_CAPI __declspec(dllexport)
+	#else
+		#define RTM_CAPI __declspec(dllimport)
+	#endif
+#elif defined(__GNUC__) || defined(__clang__)
+	#define RTM_CAPI __attribute__((visibility("default")))
+#else
+	#define RTM_CAPI
+#endif
+
+// Incremented whenever a type or function signature changes
+#define RTM_CAPI_VERSION 2
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+typedef enum rtm_result
+{
+	RTM_RESULT_OK = 0,
+	RTM_RESULT_NULL_POINTER = 1,		// A required pointer is null
+	RTM_RESULT_MISALIGNED = 2,			// An rtm_qvvf array isn't 16 bytes aligned
+	RTM_RESULT_INVALID_ARGUMENT = 3,	// Another argument is out of range
+} rtm_result;
+
+//////////////////////////////////////////////////////////////////////////
+// A QVV transform: a rotation quaternion [x, y, z, w], a translation, and a
+// scale. The [w] component of the translation and scale is padding (48 bytes).
+// Arrays of rtm_qvvf must be 16 bytes aligned.
+//////////////////////////////////////////////////////////////////////////
+typedef struct rtm_qvvf
+{
+	float rotation[4];
+	float translation[4];
+	float scale[4];
+} rtm_qvvf;
+
+//////////////////////////////////////////////////////////////////////////
+// A QVV transform without the padding (40 bytes), no alignment required.
+//////////////////////////////////////////////////////////////////////////
+typedef struct rtm_qvvf_packed
+{
+	float rotation[4];
+	float translation[3];
+	float scale[3];
+} rtm_qvvf_packed;
+
+typedef struct rtm_float3f
+{
+	float x;
+	float y;
+	float z;
+} rtm_float3f;
+
+typedef struct rtm_float4f
+{
+	float x;
+	float y;
+	float z;
+	float w;
+} rtm_float4f;
+
+//////////////////////////////////////////////////////////////////////////
+// An affine transform stored as 3 rows of [x, y, z, translation], as consumed by shaders.
+//////////////////////////////////////////////////////////////////////////
+typedef struct rtm_float3x4f
+{
+	float x_row[4];
+	float y_row[4];
+	float z_row[4];
+} rtm_float3x4f;
+
+//////////////////////////////////////////////////////////////////////////
+// Structure of arrays views: one pointer per component stream.
+// Where noted, a null [w] stream selects the 3 component variant.
+//////////////////////////////////////////////////////////////////////////
+typedef struct rtm_const_float4f_soa
+{
+	const float* x;
+	const float* y;
+	const float* z;
+	const float* w;
+} rtm_const_float4f_soa;
+
+typedef struct rtm_float4f_soa
+{
+	float* x;
+	float* y;
+	float* z;
+	float* w;
+} rtm_float4f_soa;
+
+typedef struct rtm_const_quantized4_soa
+{
+	const uint16_t* x;
+	const uint16_t* y;
+	const uint16_t* z;
+	const uint16_t* w;
+} rtm_const_quantized4_soa;
+
+typedef struct rtm_quantized4_soa
+{
+	uint16_t* x;
+	uint16_t* y;
+	uint16_t* z;
+	uint16_t* w;
+} rtm_quantized4_soa;
+
+//////////////////////////////////////////////////////////////////////////
+// Returns RTM_CAPI_VERSION as compiled in the library, compare it with the one of this header.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI uint32_t rtm_get_capi_version(void);
+
+//////////////////////////////////////////////////////////////////////////
+// Returns the name of the instruction set selected for the running CPU (e.g. "avx2").
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI const char* rtm_get_isa_name(void);
+
+//////////////////////////////////////////////////////////////////////////
+// Composes transforms: output[i] = lhs[i] * rhs[i], lhs is applied first.
+// The output can alias either input.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_qvv_mul_aos(const rtm_qvvf* lhs, const rtm_qvvf* rhs, rtm_qvvf* output, uint32_t num_transforms);
+
+//////////////////////////////////////////////////////////////////////////
+// Transforms points by a single transform. The output can alias the input points.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_qvv_mul_point3_aos(const rtm_qvvf* transform, const rtm_float3f* points, rtm_float3f* output, uint32_t num_points);
+
+//////////////////////////////////////////////////////////////////////////
+// Transforms every point by the transform at its index: transforms[transform_indices[i]].
+// Every index must be smaller than 'num_transforms', RTM_RESULT_INVALID_ARGUMENT is
+// returned otherwise. The output can alias the input points.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_qvv_mul_point3_indexed_aos(const rtm_qvvf* transforms, uint32_t num_transforms, const uint32_t* transform_indices, const rtm_float3f* points, rtm_float3f* output, uint32_t num_points);
+
+//////////////////////////////////////////////////////////////////////////
+// Converts transforms into 3x4 rows. The rotations must be normalized.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_matrix_from_qvv_aos(const rtm_qvvf* input, rtm_float3x4f* output, uint32_t num_transforms);
+
+//////////////////////////////////////////////////////////////////////////
+// Packs transforms without their padding, and unpacks them back.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_qvv_store_array(const rtm_qvvf* input, rtm_qvvf_packed* output, uint32_t num_transforms);
+RTM_CAPI rtm_result rtm_qvv_load_array(const rtm_qvvf_packed* input, rtm_qvvf* output, uint32_t num_transforms);
+
+//////////////////////////////////////////////////////////////////////////
+// Multiplies quaternions stored as [x, y, z, w]: output[i] = lhs[i] * rhs[i].
+// No alignment is required and the output can alias either input.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_quat_mul_aos(const rtm_float4f* lhs, const rtm_float4f* rhs, rtm_float4f* output, uint32_t num_quats);
+
+//////////////////////////////////////////////////////////////////////////
+// Interpolates quaternions stored as [x, y, z, w], see their structure of arrays variants below.
+// No alignment is required and the output can alias either input.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_quat_lerp_aos(const rtm_float4f* start, const rtm_float4f* end, const float* alphas, rtm_float4f* output, uint32_t num_quats);
+RTM_CAPI rtm_result rtm_quat_slerp_fast_aos(const rtm_float4f* start, const rtm_float4f* end, const float* alphas, rtm_float4f* output, uint32_t num_quats);
+
+//////////////////////////////////////////////////////////////////////////
+// Multiplies quaternions stored as structure of arrays: output[i] = lhs[i] * rhs[i].
+// The output streams can alias the input streams.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_quat_mul_soa(const rtm_const_float4f_soa* lhs, const rtm_const_float4f_soa* rhs, const rtm_float4f_soa* output, uint32_t num_quats);
+
+//////////////////////////////////////////////////////////////////////////
+// Interpolates quaternions stored as structure of arrays with one alpha per quaternion,
+// along the shortest path. The results are normalized.
+// rtm_quat_lerp_soa interpolates linearly, rtm_quat_slerp_fast_soa spherically with a
+// polynomial approximation of the angle.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_quat_lerp_soa(const rtm_const_float4f_soa* start, const rtm_const_float4f_soa* end, const float* alphas, const rtm_float4f_soa* output, uint32_t num_quats);
+RTM_CAPI rtm_result rtm_quat_slerp_fast_soa(const rtm_const_float4f_soa* start, const rtm_const_float4f_soa* end, const float* alphas, const rtm_float4f_soa* output, uint32_t num_quats);
+
+//////////////////////////////////////////////////////////////////////////
+// Computes the range of samples stored as structure of arrays, for the functions below:
+// the smallest value and the extent up to the largest value of every component.
+// A null [w] stream selects 3 components, the [w] component of the outputs is then 0.0.
+// Requires at least one sample.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_vector_range_soa(const rtm_const_float4f_soa* samples, uint32_t num_samples, float out_range_min[4], float out_range_extent[4]);
+
+//////////////////////////////////////////////////////////////////////////
+// Range reduces samples and quantizes them as unsigned normalized integers of 'num_bits'
+// bits, between 1 and 16, and the reverse. A null [w] sample stream selects 3 components,
+// the [w] quantized stream is then unused and can be null.
+//////////////////////////////////////////////////////////////////////////
+RTM_CAPI rtm_result rtm_pack_range_reduce_unorm_soa(const rtm_const_float4f_soa* samples, const float range_min[4], const float range_extent[4], uint32_t num_bits, const rtm_quantized4_soa* output, uint32_t num_samples);
+RTM_CAPI rtm_result rtm_unpack_range_expand_unorm_soa(const rtm_const_quantized4_soa* input, uint32_t num_bits, const float range_min[4], const float range_extent[4], const rtm_float4f_soa* output, uint32_t num_samples);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,390 @@
+# Python bindings of the rtm_capi shared library, see docs/api_conventions.md.
+#
+# Arrays are passed through the buffer protocol: NumPy arrays, memoryviews, array.array,
+# etc. C contiguous float32 inputs are used in place without copying, float64 inputs are
+# converted to float32 first. Results are written to 'out' when provided, otherwise they
+# are allocated and returned as NumPy arrays (memoryviews when NumPy isn't installed).
+# The GIL is released while the kernels run.
+#
+# The library is found with the RTM_CAPI_LIBRARY environment variable, next to this file,
+# or in the system library paths. load_library(path) selects it explicitly.
+
+import array
+import ctypes
+import ctypes.util
+import os
+import struct
+import sys
+
+try:
+	import numpy as _numpy
+except ImportError:
+	_numpy = None
+
+# Must match RTM_CAPI_VERSION in rtm_capi.h
+CAPI_VERSION = 2
+
+_RESULT_MESSAGES = {
+	1: 'a required pointer is null',
+	2: 'transforms must be 16 bytes aligned',
+	3: 'an argument is out of range',
+}
+_RESULT_INVALID_ARGUMENT = 3
+
+# Transforms are [rotation xyzw, translation xyz, padding, scale xyz, padding]
+QVV_NUM_FLOATS = 12
+QVV_PACKED_NUM_FLOATS = 10
+_QVV_ALIGNMENT = 16
+
+class _PyBuffer(ctypes.Structure):
+	_fields_ = [
+		('buf', ctypes.c_void_p),
+		('obj', ctypes.py_object),
+		('len', ctypes.c_ssize_t),
+		('itemsize', ctypes.c_ssize_t),
+		('readonly', ctypes.c_int),
+		('ndim', ctypes.c_int),
+		('format', ctypes.c_char_p),
+		('shape', ctypes.POINTER(ctypes.c_ssize_t)),
+		('strides', ctypes.POINTER(ctypes.c_ssize_t)),
+		('suboffsets', ctypes.POINTER(ctypes.c_ssize_t)),
+		('internal', ctypes.c_void_p),
+	]
+
+_PYBUF_WRITABLE = 0x0001
+_PYBUF_FORMAT = 0x0004
+_PYBUF_C_CONTIGUOUS = 0x0038
+
+_PyObject_GetBuffer = ctypes.pythonapi.PyObject_GetBuffer
+_PyObject_GetBuffer.argtypes = [ctypes.py_object, ctypes.POINTER(_PyBuffer), ctypes.c_int]
+_PyObject_GetBuffer.restype = ctypes.c_int
+
+_PyBuffer_Release = ctypes.pythonapi.PyBuffer_Release
+_PyBuffer_Release.argtypes = [ctypes.POINTER(_PyBuffer)]
+_PyBuffer_Release.restype = None
+
+class _Buffer(object):
+	"""The memory of an object exposing the buffer protocol, held until released."""
+
+	def __init__(self, obj, name, writable):
+		self._view = _PyBuffer()
+		flags = _PYBUF_C_CONTIGUOUS | _PYBUF_FORMAT | (_PYBUF_WRITABLE if writable else 0)
+		try:
+			_PyObject_GetBuffer(obj, ctypes.byref(self._view), flags)
+		except (BufferError, TypeError):
+			raise ValueError("'{}' must be a {}C contiguous buffer".format(name, 'writable ' if writable else ''))
+
+		self.address = self._view.buf or 0
+		self.shape = tuple(self._view.shape[axis] for axis in range(self._view.ndim))
+		self.format = self._view.format.decode('ascii').lstrip('@=<') if self._view.format else 'B'
+
+	def release(self):
+		_PyBuffer_Release(ctypes.byref(self._view))
+
+class _BufferScope(object):
+	"""Releases every buffer acquired within a 'with' block."""
+
+	def __init__(self):
+		self._buffers = []
+
+	def __enter__(self):
+		return self
+
+	def __exit__(self, exc_type, exc_value, traceback):
+		for buffer in reversed(self._buffers):
+			buffer.release()
+
+	def acquire(self, obj, name, writable=False):
+		buffer = _Buffer(obj, name, writable)
+		self._buffers.append(buffer)
+		return buffer
+
+def _matches(size, expected):
+	return expected is None or size == expected or (isinstance(expected, tuple) and size in expected)
+
+def _check_shape(shape, expected_shape, name):
+	"""Validates a shape against the expected one: None matches any size, a tuple any of its sizes."""
+	if len(shape) != len(expected_shape) or not all(_matches(size, expected) for size, expected in zip(shape, expected_shape)):
+		expected = ', '.join('N' if size is None else ' or '.join(str(value) for value in size) if isinstance(size, tuple) else str(size) for size in expected_shape)
+		raise ValueError("'{}' must have the shape ({}), got {}".format(name, expected, shape))
+
+def _num_elements(shape):
+	count = 1
+	for size in shape:
+		count *= size
+	return count
+
+def _allocate(shape, typecode, alignment=_QVV_ALIGNMENT):
+	"""Allocates an aligned array, as a NumPy array when available."""
+	num_bytes = _num_elements(shape) * struct.calcsize(typecode)
+	storage = bytearray(num_bytes + alignment)
+	address = ctypes.addressof((ctypes.c_char * len(storage)).from_buffer(storage))
+	offset = (alignment - address % alignment) % alignment
+
+	view = memoryview(storage)[offset:offset + num_bytes].cast(typecode)
+	if _numpy is not None:
+		return _numpy.asarray(view).reshape(shape)
+
+	# Memoryviews cannot have a dimension of size zero
+	return view.cast('B').cast(typecode, shape) if num_bytes != 0 else view
+
+def _to_float32(obj):
+	if _numpy is not None:
+		return _numpy.asarray(obj, dtype=_numpy.float32)
+	return array.array('f', memoryview(obj).cast('B').cast('d'))
+
+def _get_floats(scope, obj, name, expected_shape, alignment=1):
+	"""Returns the address and shape of float32 values, converting float64 values."""
+	buffer = scope.acquire(obj, name)
+	shape = buffer.shape
+	_check_shape(shape, expected_shape, name)
+
+	if buffer.format == 'd':
+		buffer = scope.acquire(_to_float32(obj), name)
+	elif buffer.format != 'f':
+		raise TypeError("'{}' must hold float32 or float64 values, got format '{}'".format(name, buffer.format))
+
+	if buffer.address % alignment != 0:
+		# Copied into an aligned temporary
+		copy = _allocate((_num_elements(shape),), 'f', alignment)
+		copy_buffer = scope.acquire(copy, name, True)
+		ctypes.memmove(copy_buffer.address, buffer.address, _num_elements(shape) * 4)
+		buffer = copy_buffer
+
+	return buffer.address, shape
+
+def _get_output(scope, out, shape, typecode, alignment=1):
+	"""Returns the output object and its address, allocating it unless provided."""
+	if out is None:
+		out = _allocate(shape, typecode)
+
+	buffer = scope.acquire(out, 'out', True)
+	if _num_elements(shape) != 0:
+		_check_shape(buffer.shape, shape, 'out')
+	if buffer.format != typecode:
+		raise TypeError("'out' must hold values of format '{}', got '{}'".format(typecode, buffer.format))
+	if buffer.address % alignment != 0:
+		raise ValueError("'out' must be {} bytes aligned".format(alignment))
+
+	return out, buffer.address
+
+def _check_result(result):
+	if result != 0:
+		raise ValueError('rtm_capi: ' + _RESULT_MESSAGES.get(result, 'unknown error {}'.format(result)))
+
+_library = None
+
+def _get_default_library_path():
+	path = os.environ.get('RTM_CAPI_LIBRARY')
+	if path:
+		return path
+
+	if sys.platform == 'win32':
+		filename = 'rtm_capi.dll'
+	elif sys.platform == 'darwin':
+		filename = 'librtm_capi.dylib'
+	else:
+		filename = 'librtm_capi.so'
+
+	path = os.path.join(os.path.dirname(os.path.abspath(__file__)), filename)
+	if os.path.isfile(path):
+		return path
+
+	path = ctypes.util.find_library('rtm_capi')
+	if path:
+		return path
+
+	raise OSError('rtm_capi library not found, set RTM_CAPI_LIBRARY or call rtm_capi.load_library(path)')
+
+def load_library(path=None):
+	"""Loads the rtm_capi shared library, it is loaded on first use otherwise."""
+	global _library
+
+	# Functions of a CDLL release the GIL while they run
+	library = ctypes.CDLL(path or _get_default_library_path())
+
+	library.rtm_get_capi_version.restype = ctypes.c_uint32
+	library.rtm_get_isa_name.restype = ctypes.c_char_p
+
+	version = library.rtm_get_capi_version()
+	if version != CAPI_VERSION:
+		raise OSError('rtm_capi version {} is not supported, {} is required'.format(version, CAPI_VERSION))
+
+	pointer = ctypes.c_void_p
+	count = ctypes.c_uint32
+	signatures = {
+		'rtm_qvv_mul_aos': [pointer, pointer, pointer, count],
+		'rtm_qvv_mul_point3_aos': [pointer, pointer, pointer, count],
+		'rtm_qvv_mul_point3_indexed_aos': [pointer, count, pointer, pointer, pointer, count],
+		'rtm_matrix_from_qvv_aos': [pointer, pointer, count],
+		'rtm_qvv_store_array': [pointer, pointer, count],
+		'rtm_qvv_load_array': [pointer, pointer, count],
+		'rtm_quat_mul_aos': [pointer, pointer, pointer, count],
+		'rtm_quat_lerp_aos': [pointer, pointer, pointer, pointer, count],
+		'rtm_quat_slerp_fast_aos': [pointer, pointer, pointer, pointer, count],
+		'rtm_vector_range_soa': [pointer, count, pointer, pointer],
+		'rtm_pack_range_reduce_unorm_soa': [pointer, pointer, pointer, count, pointer, count],
+		'rtm_unpack_range_expand_unorm_soa': [pointer, count, pointer, pointer, pointer, count],
+	}
+	for function_name, argtypes in signatures.items():
+		function = getattr(library, function_name)
+		function.argtypes = argtypes
+		function.restype = ctypes.c_int
+
+	_library = library
+
+def _get_library():
+	if _library is None:
+		load_library()
+	return _library
+
+def get_isa_name():
+	"""Returns the instruction set selected for the running CPU (e.g. 'avx2')."""
+	return _get_library().rtm_get_isa_name().decode('ascii')
+
+def qvv_mul(lhs, rhs, out=None):
+	"""Composes (N, 12) transforms: out[i] = lhs[i] * rhs[i], lhs is applied first."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		lhs_address, shape = _get_floats(scope, lhs, 'lhs', (None, QVV_NUM_FLOATS), _QVV_ALIGNMENT)
+		rhs_address, _ = _get_floats(scope, rhs, 'rhs', shape, _QVV_ALIGNMENT)
+		out, out_address = _get_output(scope, out, shape, 'f', _QVV_ALIGNMENT)
+		_check_result(library.rtm_qvv_mul_aos(lhs_address, rhs_address, out_address, shape[0]))
+	return out
+
+def qvv_mul_point3(transform, points, out=None):
+	"""Transforms (N, 3) points by a single (12,) transform."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		transform_address, _ = _get_floats(scope, transform, 'transform', (QVV_NUM_FLOATS,), _QVV_ALIGNMENT)
+		points_address, shape = _get_floats(scope, points, 'points', (None, 3))
+		out, out_address = _get_output(scope, out, shape, 'f')
+		_check_result(library.rtm_qvv_mul_point3_aos(transform_address, points_address, out_address, shape[0]))
+	return out
+
+def qvv_mul_point3_indexed(transforms, transform_indices, points, out=None):
+	"""Transforms (N, 3) points, each by the transform at its uint32 index. Raises IndexError when an index is out of range."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		transforms_address, transforms_shape = _get_floats(scope, transforms, 'transforms', (None, QVV_NUM_FLOATS), _QVV_ALIGNMENT)
+		points_address, shape = _get_floats(scope, points, 'points', (None, 3))
+
+		indices = scope.acquire(transform_indices, 'transform_indices')
+		_check_shape(indices.shape, (shape[0],), 'transform_indices')
+		if indices.format not in ('I', 'L') or struct.calcsize(indices.format) != 4:
+			raise TypeError("'transform_indices' must hold uint32 values, got format '{}'".format(indices.format))
+
+		out, out_address = _get_output(scope, out, shape, 'f')
+		result = library.rtm_qvv_mul_point3_indexed_aos(transforms_address, transforms_shape[0], indices.address, points_address, out_address, shape[0])
+		if result == _RESULT_INVALID_ARGUMENT:
+			raise IndexError("'transform_indices' must be smaller than the number of transforms ({})".format(transforms_shape[0]))
+		_check_result(result)
+	return out
+
+def matrix_from_qvv(transforms, out=None):
+	"""Converts (N, 12) transforms into (N, 3, 4) rows of [x, y, z, translation]."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		transforms_address, shape = _get_floats(scope, transforms, 'transforms', (None, QVV_NUM_FLOATS), _QVV_ALIGNMENT)
+		out, out_address = _get_output(scope, out, (shape[0], 3, 4), 'f')
+		_check_result(library.rtm_matrix_from_qvv_aos(transforms_address, out_address, shape[0]))
+	return out
+
+def qvv_pack(transforms, out=None):
+	"""Removes the padding of (N, 12) transforms: (N, 10) [rotation xyzw, translation xyz, scale xyz]."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		transforms_address, shape = _get_floats(scope, transforms, 'transforms', (None, QVV_NUM_FLOATS), _QVV_ALIGNMENT)
+		out, out_address = _get_output(scope, out, (shape[0], QVV_PACKED_NUM_FLOATS), 'f')
+		_check_result(library.rtm_qvv_store_array(transforms_address, out_address, shape[0]))
+	return out
+
+def qvv_unpack(packed, out=None):
+	"""Expands (N, 10) packed transforms into (N, 12) transforms."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		packed_address, shape = _get_floats(scope, packed, 'packed', (None, QVV_PACKED_NUM_FLOATS))
+		out, out_address = _get_output(scope, out, (shape[0], QVV_NUM_FLOATS), 'f', _QVV_ALIGNMENT)
+		_check_result(library.rtm_qvv_load_array(packed_address, out_address, shape[0]))
+	return out
+
+def quat_mul(lhs, rhs, out=None):
+	"""Multiplies (N, 4) [x, y, z, w] quaternions: out[i] = lhs[i] * rhs[i]."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		lhs_address, shape = _get_floats(scope, lhs, 'lhs', (None, 4))
+		rhs_address, _ = _get_floats(scope, rhs, 'rhs', shape)
+		out, out_address = _get_output(scope, out, shape, 'f')
+		_check_result(library.rtm_quat_mul_aos(lhs_address, rhs_address, out_address, shape[0]))
+	return out
+
+def _quat_interpolate(function, start, end, alphas, out):
+	with _BufferScope() as scope:
+		start_address, shape = _get_floats(scope, start, 'start', (None, 4))
+		end_address, _ = _get_floats(scope, end, 'end', shape)
+		alphas_address, _ = _get_floats(scope, alphas, 'alphas', (shape[0],))
+		out, out_address = _get_output(scope, out, shape, 'f')
+		_check_result(function(start_address, end_address, alphas_address, out_address, shape[0]))
+	return out
+
+def quat_lerp(start, end, alphas, out=None):
+	"""Linearly interpolates (N, 4) quaternions with (N,) alphas along the shortest path, normalized."""
+	return _quat_interpolate(_get_library().rtm_quat_lerp_aos, start, end, alphas, out)
+
+def quat_slerp_fast(start, end, alphas, out=None):
+	"""Spherically interpolates (N, 4) quaternions with (N,) alphas along the shortest path, normalized."""
+	return _quat_interpolate(_get_library().rtm_quat_slerp_fast_aos, start, end, alphas, out)
+
+def _get_streams(address, shape, item_size):
+	"""Returns the addresses of the rows of a (3, N) or (4, N) array, the [w] one is null with 3 rows."""
+	row_size = shape[1] * item_size
+	streams = [address + row_index * row_size for row_index in range(shape[0])]
+	return streams + [None] * (4 - shape[0])
+
+# Structure of arrays streams have one row per component
+_SOA_SHAPE = ((3, 4), None)
+
+class _Streams(ctypes.Structure):
+	_fields_ = [('x', ctypes.c_void_p), ('y', ctypes.c_void_p), ('z', ctypes.c_void_p), ('w', ctypes.c_void_p)]
+
+def vector_range(samples):
+	"""Returns the range of (3, N) or (4, N) samples, one row per component, as (range_min, range_extent) 4-tuples."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		samples_address, shape = _get_floats(scope, samples, 'samples', _SOA_SHAPE)
+		streams = _Streams(*_get_streams(samples_address, shape, 4))
+		range_min = (ctypes.c_float * 4)()
+		range_extent = (ctypes.c_float * 4)()
+		_check_result(library.rtm_vector_range_soa(ctypes.addressof(streams), shape[1], range_min, range_extent))
+	return tuple(range_min), tuple(range_extent)
+
+def pack_range_reduce_unorm(samples, range_min, range_extent, num_bits, out=None):
+	"""Range reduces (3, N) or (4, N) samples and quantizes them as uint16 values of 'num_bits' bits."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		samples_address, shape = _get_floats(scope, samples, 'samples', _SOA_SHAPE)
+		out, out_address = _get_output(scope, out, shape, 'H')
+		samples_streams = _Streams(*_get_streams(samples_address, shape, 4))
+		out_streams = _Streams(*_get_streams(out_address, shape, 2))
+		range_min_ = (ctypes.c_float * 4)(*range_min)
+		range_extent_ = (ctypes.c_float * 4)(*range_extent)
+		_check_result(library.rtm_pack_range_reduce_unorm_soa(ctypes.addressof(samples_streams), range_min_, range_extent_, num_bits, ctypes.addressof(out_streams), shape[1]))
+	return out
+
+def unpack_range_expand_unorm(packed, num_bits, range_min, range_extent, out=None):
+	"""Dequantizes (3, N) or (4, N) uint16 values of 'num_bits' bits and expands them back into their range."""
+	library = _get_library()
+	with _BufferScope() as scope:
+		packed_buffer = scope.acquire(packed, 'packed')
+		shape = packed_buffer.shape
+		_check_shape(shape, _SOA_SHAPE, 'packed')
+		if packed_buffer.format != 'H':
+			raise TypeError("'packed' must hold uint16 values, got format '{}'".format(packed_buffer.format))
+
+		out, out_address = _get_output(scope, out, shape, 'f')
+		packed_streams = _Streams(*_get_streams(packed_buffer.address, shape, 2))
+		out_streams = _Streams(*_get_streams(out_address, shape, 4))
+		range_min_ = (ctypes.c_float * 4)(*range_min)
+		range_extent_ = (ctypes.c_float * 4)(*range_extent)
+		_check_result(library.rtm_unpack_range_expand_unorm_soa(ctypes.addressof(packed_streams), num_bits, range_min_, range_extent_, ctypes.addressof(out_streams), shape[1]))
+	return out
@@ -0,0 +1,178 @@
+# Tests the Python bindings against the rtm_capi library provided as argument:
+# python test_rtm_capi.py <path to the rtm_capi library>
+# Only the standard library is required, the NumPy tests are skipped without it.
+
+import array
+import math
+import sys
+import unittest
+
+import rtm_capi
+
+try:
+	import numpy
+except ImportError:
+	numpy = None
+
+def make_floats(rows, typecode='f'):
+	"""Returns a 2D buffer of the provided rows without NumPy."""
+	values = array.array(typecode, [value for row in rows for value in row])
+	return memoryview(values).cast('B').cast(typecode, (len(rows), len(rows[0])))
+
+def make_qvv(rotation_z_angle, translation, scale):
+	half_angle = rotation_z_angle * 0.5
+	return [0.0, 0.0, math.sin(half_angle), math.cos(half_angle)] + list(translation) + [0.0] + [scale] * 3 + [0.0]
+
+class RtmCapiTest(unittest.TestCase):
+	def assert_near(self, values, expected, threshold=1.0E-4):
+		self.assertEqual(len(values), len(expected))
+		for value, expected_value in zip(values, expected):
+			self.assertAlmostEqual(value, expected_value, delta=threshold)
+
+	def test_isa_name(self):
+		self.assertTrue(len(rtm_capi.get_isa_name()) > 0)
+
+	def test_transforms(self):
+		half_pi = math.pi * 0.5
+		lhs = make_floats([make_qvv(half_pi, [1.0, 0.0, 0.0], 2.0)] * 5)
+		rhs = make_floats([make_qvv(half_pi, [0.0, 0.0, 3.0], 1.0)] * 5)
+
+		# lhs is applied first
+		result = rtm_capi.qvv_mul(lhs, rhs)
+		for row in range(5):
+			self.assert_near(result.tolist()[row][0:4], [0.0, 0.0, 1.0, 0.0])
+			self.assert_near(result.tolist()[row][4:7], [0.0, 1.0, 3.0])
+			self.assert_near(result.tolist()[row][8:11], [2.0, 2.0, 2.0])
+
+		points = make_floats([[1.0, 0.0, 0.0], [0.0, 1.0, 0.0], [0.0, 0.0, 1.0]])
+		transformed = rtm_capi.qvv_mul_point3(array.array('f', make_qvv(half_pi, [1.0, 0.0, 0.0], 2.0)), points)
+		self.assert_near(transformed.tolist()[0], [1.0, 2.0, 0.0])
+		self.assert_near(transformed.tolist()[1], [-1.0, 0.0, 0.0])
+		self.assert_near(transformed.tolist()[2], [1.0, 0.0, 2.0])
+
+		transforms = make_floats([make_qvv(half_pi, [1.0, 0.0, 0.0], 2.0), make_qvv(half_pi, [0.0, 0.0, 3.0], 1.0)])
+		indices = array.array('I', [1, 0, 1])
+		transformed = rtm_capi.qvv_mul_point3_indexed(transforms, indices, points)
+		self.assert_near(transformed.tolist()[0], [0.0, 1.0, 3.0])
+		self.assert_near(transformed.tolist()[1], [-1.0, 0.0, 0.0])
+		self.assert_near(transformed.tolist()[2], [0.0, 0.0, 4.0])
+
+		matrices = rtm_capi.matrix_from_qvv(lhs)
+		self.assert_near(matrices.tolist()[0][0], [0.0, -2.0, 0.0, 1.0])
+		self.assert_near(matrices.tolist()[0][1], [2.0, 0.0, 0.0, 0.0])
+		self.assert_near(matrices.tolist()[0][2], [0.0, 0.0, 2.0, 0.0])
+
+		packed = rtm_capi.qvv_pack(lhs)
+		self.assert_near(packed.tolist()[3], lhs.tolist()[3][0:7] + [2.0, 2.0, 2.0], 0.0)
+		unpacked = rtm_capi.qvv_unpack(packed)
+		for row in range(5):
+			self.assert_near(unpacked.tolist()[row][0:7], lhs.tolist()[row][0:7], 0.0)
+			self.assert_near(unpacked.tolist()[row][8:11], lhs.tolist()[row][8:11], 0.0)
+
+	def test_quaternions(self):
+		quarter_pi = math.pi * 0.25
+		identity = make_floats([[0.0, 0.0, 0.0, 1.0]] * 5)
+		rotation = make_floats([[0.0, 0.0, math.sin(quarter_pi), math.cos(quarter_pi)]] * 5)
+		alphas = array.array('f', [0.0, 0.25, 0.5, 0.75, 1.0])
+
+		result = rtm_capi.quat_mul(rotation, rotation)
+		for row in range(5):
+			self.assert_near(result.tolist()[row], [0.0, 0.0, 1.0, 0.0])
+
+		# Between the identity and 90 degrees around Z, the half angle is alpha * 45 degrees
+		result = rtm_capi.quat_slerp_fast(identity, rotation, alphas)
+		for row in range(5):
+			half_angle = alphas[row] * quarter_pi
+			self.assert_near(result.tolist()[row], [0.0, 0.0, math.sin(half_angle), math.cos(half_angle)], 1.0E-3)
+
+		# Results are written in place when an output is provided
+		output = make_floats([[0.0] * 4] * 5)
+		result = rtm_capi.quat_lerp(identity, rotation, alphas, out=output)
+		self.assertIs(result, output)
+		for row in (0, 2, 4):
+			half_angle = alphas[row] * quarter_pi
+			self.assert_near(output.tolist()[row], [0.0, 0.0, math.sin(half_angle), math.cos(half_angle)])
+
+	def test_packing(self):
+		samples = make_floats([[0.0, 1.0, 2.0, 3.0, 4.0, 5.0], [-1.0] * 6, [10.0, 8.0, 6.0, 4.0, 2.0, 0.0], [0.5, 0.25, 0.0, 0.25, 0.5, 0.75]])
+
+		range_min, range_extent = rtm_capi.vector_range(samples)
+		self.assert_near(range_min, [0.0, -1.0, 0.0, 0.0])
+		self.assert_near(range_extent, [5.0, 0.0, 10.0, 0.75])
+
+		packed = rtm_capi.pack_range_reduce_unorm(samples, range_min, range_extent, 16)
+		self.assertEqual(packed.tolist()[0][5], 65535)
+		self.assertEqual(packed.tolist()[2][0], 65535)
+		unpacked = rtm_capi.unpack_range_expand_unorm(packed, 16, range_min, range_extent)
+		for row in range(4):
+			self.assert_near(unpacked.tolist()[row], samples.tolist()[row])
+
+		# With 3 rows, only 3 components are processed
+		samples3 = make_floats([[0.0, 1.0, 2.0, 3.0, 4.0, 5.0], [-1.0] * 6, [10.0, 8.0, 6.0, 4.0, 2.0, 0.0]])
+		range_min, range_extent = rtm_capi.vector_range(samples3)
+		self.assert_near(range_extent, [5.0, 0.0, 10.0, 0.0])
+		packed = rtm_capi.pack_range_reduce_unorm(samples3, range_min, range_extent, 10)
+		self.assertEqual(packed.tolist()[0][5], 1023)
+		unpacked = rtm_capi.unpack_range_expand_unorm(packed, 10, range_min, range_extent)
+		for row in range(3):
+			self.assert_near(unpacked.tolist()[row], samples3.tolist()[row], 1.0E-2)
+
+	def test_float64(self):
+		rotation = make_floats([[0.0, 0.0, 1.0, 0.0]] * 3, 'd')
+		result = rtm_capi.quat_mul(rotation, rotation)
+		for row in range(3):
+			self.assert_near(result.tolist()[row], [0.0, 0.0, 0.0, -1.0])
+
+	def test_invalid_arguments(self):
+		quats = make_floats([[0.0, 0.0, 0.0, 1.0]] * 4)
+
+		with self.assertRaises(ValueError):
+			rtm_capi.quat_mul(quats, make_floats([[0.0, 0.0, 0.0, 1.0]] * 3))
+		with self.assertRaises(ValueError):
+			rtm_capi.quat_mul(make_floats([[0.0, 0.0, 1.0]] * 4), make_floats([[0.0, 0.0, 1.0]] * 4))
+		with self.assertRaises(TypeError):
+			rtm_capi.quat_mul(memoryview(array.array('i', [0] * 16)).cast('B').cast('i', (4, 4)), quats)
+		with self.assertRaises(ValueError):
+			rtm_capi.quat_mul(quats[::2], quats[::2])
+		with self.assertRaises(ValueError):
+			rtm_capi.quat_mul(quats, quats, out=memoryview(bytes(64)).cast('f', (4, 4)))
+		with self.assertRaises(ValueError):
+			rtm_capi.pack_range_reduce_unorm(make_floats([[0.0] * 4] * 3), (0.0,) * 4, (1.0,) * 4, 17)
+		with self.assertRaises(ValueError):
+			rtm_capi.vector_range(make_floats([[0.0] * 4] * 2))
+
+		# Out of range indices raise instead of reading past the transforms
+		transforms = make_floats([make_qvv(0.0, [0.0, 0.0, 0.0], 1.0)] * 2)
+		points = make_floats([[1.0, 0.0, 0.0]] * 3)
+		with self.assertRaises(IndexError):
+			rtm_capi.qvv_mul_point3_indexed(transforms, array.array('I', [0, 2, 1]), points)
+		with self.assertRaises(IndexError):
+			rtm_capi.qvv_mul_point3_indexed(transforms, array.array('I', [0, 1, 0xFFFFFFFF]), points)
+
+	@unittest.skipIf(numpy is None, 'NumPy is not installed')
+	def test_numpy(self):
+		points = numpy.random.RandomState(0).uniform(-10.0, 10.0, (1000, 3)).astype(numpy.float32)
+		transform = numpy.array(make_qvv(0.7, [1.0, 2.0, 3.0], 1.5), dtype=numpy.float32)
+
+		transformed = rtm_capi.qvv_mul_point3(transform, points)
+		self.assertIsInstance(transformed, numpy.ndarray)
+		self.assertEqual(transformed.shape, (1000, 3))
+
+		cos_angle = math.cos(0.7)
+		sin_angle = math.sin(0.7)
+		scaled = points * 1.5
+		expected = numpy.stack([scaled[:, 0] * cos_angle - scaled[:, 1] * sin_angle + 1.0, scaled[:, 0] * sin_angle + scaled[:, 1] * cos_angle + 2.0, scaled[:, 2] + 3.0], axis=1)
+		self.assertTrue(numpy.allclose(transformed, expected, atol=1.0E-3))
+
+		# Transposed arrays are not contiguous
+		with self.assertRaises(ValueError):
+			rtm_capi.qvv_mul_point3(transform, numpy.zeros((3, 1000), dtype=numpy.float32).T)
+
+		transforms = numpy.array([make_qvv(0.7, [1.0, 2.0, 3.0], 1.5)] * 4, dtype=numpy.float32)
+		with self.assertRaises(IndexError):
+			rtm_capi.qvv_mul_point3_indexed(transforms, numpy.arange(1000, dtype=numpy.uint32), points)
+
+if __name__ == '__main__':
+	if len(sys.argv) > 1:
+		rtm_capi.load_library(sys.argv.pop(1))
+	unittest.main()
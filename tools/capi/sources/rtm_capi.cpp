@@ -0,0 +1,368 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+
+#include "rtm_capi.h"
+
+#include <rtm/batch/dispatch.h>
+
+#include <cstddef>
+
+// The C types are reinterpreted as their RTM counterparts
+static_assert(sizeof(rtm_qvvf) == sizeof(rtm::qvvf), "rtm_qvvf must match qvvf");
+static_assert(offsetof(rtm_qvvf, translation) == offsetof(rtm::qvvf, translation), "rtm_qvvf must match qvvf");
+static_assert(offsetof(rtm_qvvf, scale) == offsetof(rtm::qvvf, scale), "rtm_qvvf must match qvvf");
+static_assert(sizeof(rtm_qvvf_packed) == sizeof(rtm::qvvf_packed), "rtm_qvvf_packed must match qvvf_packed");
+static_assert(offsetof(rtm_qvvf_packed, translation) == offsetof(rtm::qvvf_packed, translation), "rtm_qvvf_packed must match qvvf_packed");
+static_assert(offsetof(rtm_qvvf_packed, scale) == offsetof(rtm::qvvf_packed, scale), "rtm_qvvf_packed must match qvvf_packed");
+static_assert(sizeof(rtm_float3f) == sizeof(rtm::float3f), "rtm_float3f must match float3f");
+static_assert(sizeof(rtm_float4f) == sizeof(rtm::float4f), "rtm_float4f must match float4f");
+static_assert(sizeof(rtm_float3x4f) == sizeof(rtm::float3x4f), "rtm_float3x4f must match float3x4f");
+
+namespace
+{
+	bool is_aligned(const rtm_qvvf* transforms)
+	{
+		return rtm::rtm_impl::is_aligned_to(transforms, 16);
+	}
+
+	bool has_streams(const rtm_const_float4f_soa* input)
+	{
+		return input != nullptr && input->x != nullptr && input->y != nullptr && input->z != nullptr && input->w != nullptr;
+	}
+
+	bool has_streams(const rtm_float4f_soa* output)
+	{
+		return output != nullptr && output->x != nullptr && output->y != nullptr && output->z != nullptr && output->w != nullptr;
+	}
+
+	bool has_streams3(const rtm_const_float4f_soa* input)
+	{
+		return input != nullptr && input->x != nullptr && input->y != nullptr && input->z != nullptr;
+	}
+
+	bool has_streams3(const rtm_float4f_soa* output)
+	{
+		return output != nullptr && output->x != nullptr && output->y != nullptr && output->z != nullptr;
+	}
+
+	bool has_streams3(const rtm_const_quantized4_soa* input)
+	{
+		return input != nullptr && input->x != nullptr && input->y != nullptr && input->z != nullptr;
+	}
+
+	bool has_streams3(const rtm_quantized4_soa* output)
+	{
+		return output != nullptr && output->x != nullptr && output->y != nullptr && output->z != nullptr;
+	}
+
+	rtm::const_float4f_soa to_rtm(const rtm_const_float4f_soa& input)
+	{
+		return rtm::const_float4f_soa{ input.x, input.y, input.z, input.w };
+	}
+
+	rtm::float4f_soa to_rtm(const rtm_float4f_soa& output)
+	{
+		return rtm::float4f_soa{ output.x, output.y, output.z, output.w };
+	}
+
+	rtm::const_float3f_soa to_rtm3(const rtm_const_float4f_soa& input)
+	{
+		return rtm::const_float3f_soa{ input.x, input.y, input.z };
+	}
+
+	rtm::float3f_soa to_rtm3(const rtm_float4f_soa& output)
+	{
+		return rtm::float3f_soa{ output.x, output.y, output.z };
+	}
+
+	rtm::const_quantized4_soa to_rtm(const rtm_const_quantized4_soa& input)
+	{
+		return rtm::const_quantized4_soa{ input.x, input.y, input.z, input.w };
+	}
+
+	rtm::quantized4_soa to_rtm(const rtm_quantized4_soa& output)
+	{
+		return rtm::quantized4_soa{ output.x, output.y, output.z, output.w };
+	}
+
+	template<typename function_type>
+	rtm_result quat_interpolate_aos(const rtm_float4f* start, const rtm_float4f* end, const float* alphas, rtm_float4f* output, uint32_t num_quats, function_type function)
+	{
+		if (num_quats == 0)
+			return RTM_RESULT_OK;
+
+		if (start == nullptr || end == nullptr || alphas == nullptr || output == nullptr)
+			return RTM_RESULT_NULL_POINTER;
+
+		for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+		{
+			const rtm::quatf result = function(rtm::quat_load(&start[quat_index].x), rtm::quat_load(&end[quat_index].x), alphas[quat_index]);
+			rtm::quat_store(result, &output[quat_index].x);
+		}
+
+		return RTM_RESULT_OK;
+	}
+
+	using quat_interpolate_soa_function = void (*)(const rtm::const_float4f_soa&, const rtm::const_float4f_soa&, const float*, const rtm::float4f_soa&, uint32_t);
+
+	rtm_result quat_interpolate_soa(const rtm_const_float4f_soa* start, const rtm_const_float4f_soa* end, const float* alphas, const rtm_float4f_soa* output, uint32_t num_quats, quat_interpolate_soa_function function)
+	{
+		if (num_quats == 0)
+			return RTM_RESULT_OK;
+
+		if (!has_streams(start) || !has_streams(end) || alphas == nullptr || !has_streams(output))
+			return RTM_RESULT_NULL_POINTER;
+
+		function(to_rtm(*start), to_rtm(*end), alphas, to_rtm(*output), num_quats);
+		return RTM_RESULT_OK;
+	}
+}
+
+uint32_t rtm_get_capi_version(void)
+{
+	return RTM_CAPI_VERSION;
+}
+
+const char* rtm_get_isa_name(void)
+{
+	return rtm::get_dispatch_name();
+}
+
+rtm_result rtm_qvv_mul_aos(const rtm_qvvf* lhs, const rtm_qvvf* rhs, rtm_qvvf* output, uint32_t num_transforms)
+{
+	if (num_transforms == 0)
+		return RTM_RESULT_OK;
+
+	if (lhs == nullptr || rhs == nullptr || output == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	if (!is_aligned(lhs) || !is_aligned(rhs) || !is_aligned(output))
+		return RTM_RESULT_MISALIGNED;
+
+	rtm::qvv_mul_aos_dispatch(reinterpret_cast<const rtm::qvvf*>(lhs), reinterpret_cast<const rtm::qvvf*>(rhs), reinterpret_cast<rtm::qvvf*>(output), num_transforms);
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_qvv_mul_point3_aos(const rtm_qvvf* transform, const rtm_float3f* points, rtm_float3f* output, uint32_t num_points)
+{
+	if (num_points == 0)
+		return RTM_RESULT_OK;
+
+	if (transform == nullptr || points == nullptr || output == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	if (!is_aligned(transform))
+		return RTM_RESULT_MISALIGNED;
+
+	rtm::qvv_mul_point3_aos_dispatch(*reinterpret_cast<const rtm::qvvf*>(transform), reinterpret_cast<const rtm::float3f*>(points), reinterpret_cast<rtm::float3f*>(output), num_points);
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_qvv_mul_point3_indexed_aos(const rtm_qvvf* transforms, uint32_t num_transforms, const uint32_t* transform_indices, const rtm_float3f* points, rtm_float3f* output, uint32_t num_points)
+{
+	if (num_points == 0)
+		return RTM_RESULT_OK;
+
+	if (transforms == nullptr || transform_indices == nullptr || points == nullptr || output == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	if (!is_aligned(transforms))
+		return RTM_RESULT_MISALIGNED;
+
+	// The kernel does not check its indices, an invalid one would read out of bounds
+	for (uint32_t point_index = 0; point_index < num_points; ++point_index)
+	{
+		if (transform_indices[point_index] >= num_transforms)
+			return RTM_RESULT_INVALID_ARGUMENT;
+	}
+
+	rtm::qvv_mul_point3_indexed_aos_dispatch(reinterpret_cast<const rtm::qvvf*>(transforms), transform_indices, reinterpret_cast<const rtm::float3f*>(points), reinterpret_cast<rtm::float3f*>(output), num_points);
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_matrix_from_qvv_aos(const rtm_qvvf* input, rtm_float3x4f* output, uint32_t num_transforms)
+{
+	if (num_transforms == 0)
+		return RTM_RESULT_OK;
+
+	if (input == nullptr || output == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	if (!is_aligned(input))
+		return RTM_RESULT_MISALIGNED;
+
+	rtm::matrix_from_qvv_aos_dispatch(reinterpret_cast<const rtm::qvvf*>(input), reinterpret_cast<rtm::float3x4f*>(output), num_transforms);
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_qvv_store_array(const rtm_qvvf* input, rtm_qvvf_packed* output, uint32_t num_transforms)
+{
+	if (num_transforms == 0)
+		return RTM_RESULT_OK;
+
+	if (input == nullptr || output == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	if (!is_aligned(input))
+		return RTM_RESULT_MISALIGNED;
+
+	rtm::qvv_store_array_dispatch(reinterpret_cast<const rtm::qvvf*>(input), reinterpret_cast<rtm::qvvf_packed*>(output), num_transforms);
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_qvv_load_array(const rtm_qvvf_packed* input, rtm_qvvf* output, uint32_t num_transforms)
+{
+	if (num_transforms == 0)
+		return RTM_RESULT_OK;
+
+	if (input == nullptr || output == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	if (!is_aligned(output))
+		return RTM_RESULT_MISALIGNED;
+
+	rtm::qvv_load_array_dispatch(reinterpret_cast<const rtm::qvvf_packed*>(input), reinterpret_cast<rtm::qvvf*>(output), num_transforms);
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_quat_mul_aos(const rtm_float4f* lhs, const rtm_float4f* rhs, rtm_float4f* output, uint32_t num_quats)
+{
+	if (num_quats == 0)
+		return RTM_RESULT_OK;
+
+	if (lhs == nullptr || rhs == nullptr || output == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	// A single quaternion fills a SIMD register, the batch kernels would only add a transposition
+	for (uint32_t quat_index = 0; quat_index < num_quats; ++quat_index)
+	{
+		const rtm::quatf result = rtm::quat_mul(rtm::quat_load(&lhs[quat_index].x), rtm::quat_load(&rhs[quat_index].x));
+		rtm::quat_store(result, &output[quat_index].x);
+	}
+
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_quat_lerp_aos(const rtm_float4f* start, const rtm_float4f* end, const float* alphas, rtm_float4f* output, uint32_t num_quats)
+{
+	return quat_interpolate_aos(start, end, alphas, output, num_quats, [](rtm::quatf_arg0 start_, rtm::quatf_arg1 end_, float alpha) { return rtm::quat_lerp(start_, end_, alpha); });
+}
+
+rtm_result rtm_quat_slerp_fast_aos(const rtm_float4f* start, const rtm_float4f* end, const float* alphas, rtm_float4f* output, uint32_t num_quats)
+{
+	return quat_interpolate_aos(start, end, alphas, output, num_quats, [](rtm::quatf_arg0 start_, rtm::quatf_arg1 end_, float alpha) { return rtm::quat_slerp_fast(start_, end_, alpha); });
+}
+
+rtm_result rtm_quat_mul_soa(const rtm_const_float4f_soa* lhs, const rtm_const_float4f_soa* rhs, const rtm_float4f_soa* output, uint32_t num_quats)
+{
+	if (num_quats == 0)
+		return RTM_RESULT_OK;
+
+	if (!has_streams(lhs) || !has_streams(rhs) || !has_streams(output))
+		return RTM_RESULT_NULL_POINTER;
+
+	rtm::quat_mul_soa_dispatch(to_rtm(*lhs), to_rtm(*rhs), to_rtm(*output), num_quats);
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_quat_lerp_soa(const rtm_const_float4f_soa* start, const rtm_const_float4f_soa* end, const float* alphas, const rtm_float4f_soa* output, uint32_t num_quats)
+{
+	return quat_interpolate_soa(start, end, alphas, output, num_quats, rtm::quat_lerp_soa_dispatch);
+}
+
+rtm_result rtm_quat_slerp_fast_soa(const rtm_const_float4f_soa* start, const rtm_const_float4f_soa* end, const float* alphas, const rtm_float4f_soa* output, uint32_t num_quats)
+{
+	return quat_interpolate_soa(start, end, alphas, output, num_quats, rtm::quat_slerp_fast_soa_dispatch);
+}
+
+rtm_result rtm_vector_range_soa(const rtm_const_float4f_soa* samples, uint32_t num_samples, float out_range_min[4], float out_range_extent[4])
+{
+	if (num_samples == 0)
+		return RTM_RESULT_INVALID_ARGUMENT;
+
+	if (!has_streams3(samples) || out_range_min == nullptr || out_range_extent == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	rtm::vector4f range_min;
+	rtm::vector4f range_extent;
+	if (samples->w == nullptr)
+		rtm::vector_range_soa_dispatch(to_rtm3(*samples), num_samples, range_min, range_extent);
+	else
+		rtm::vector_range_soa_dispatch(to_rtm(*samples), num_samples, range_min, range_extent);
+
+	rtm::vector_store(range_min, out_range_min);
+	rtm::vector_store(range_extent, out_range_extent);
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_pack_range_reduce_unorm_soa(const rtm_const_float4f_soa* samples, const float range_min[4], const float range_extent[4], uint32_t num_bits, const rtm_quantized4_soa* output, uint32_t num_samples)
+{
+	if (num_bits < 1 || num_bits > 16)
+		return RTM_RESULT_INVALID_ARGUMENT;
+
+	if (num_samples == 0)
+		return RTM_RESULT_OK;
+
+	if (!has_streams3(samples) || range_min == nullptr || range_extent == nullptr || !has_streams3(output))
+		return RTM_RESULT_NULL_POINTER;
+
+	const bool is_vector3 = samples->w == nullptr;
+	if (!is_vector3 && output->w == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	const rtm::vector4f range_min_ = rtm::vector_load(range_min);
+	const rtm::vector4f range_extent_ = rtm::vector_load(range_extent);
+	if (is_vector3)
+		rtm::pack_range_reduce_unorm_soa_dispatch(to_rtm3(*samples), range_min_, range_extent_, num_bits, to_rtm(*output), num_samples);
+	else
+		rtm::pack_range_reduce_unorm_soa_dispatch(to_rtm(*samples), range_min_, range_extent_, num_bits, to_rtm(*output), num_samples);
+
+	return RTM_RESULT_OK;
+}
+
+rtm_result rtm_unpack_range_expand_unorm_soa(const rtm_const_quantized4_soa* input, uint32_t num_bits, const float range_min[4], const float range_extent[4], const rtm_float4f_soa* output, uint32_t num_samples)
+{
+	if (num_bits < 1 || num_bits > 16)
+		return RTM_RESULT_INVALID_ARGUMENT;
+
+	if (num_samples == 0)
+		return RTM_RESULT_OK;
+
+	if (!has_streams3(input) || range_min == nullptr || range_extent == nullptr || !has_streams3(output))
+		return RTM_RESULT_NULL_POINTER;
+
+	const bool is_vector3 = output->w == nullptr;
+	if (!is_vector3 && input->w == nullptr)
+		return RTM_RESULT_NULL_POINTER;
+
+	const rtm::vector4f range_min_ = rtm::vector_load(range_min);
+	const rtm::vector4f range_extent_ = rtm::vector_load(range_extent);
+	if (is_vector3)
+		rtm::unpack_range_expand_unorm_soa_dispatch(to_rtm(*input), num_bits, range_min_, range_extent_, to_rtm3(*output), num_samples);
+	else
+		rtm::unpack_range_expand_unorm_soa_dispatch(to_rtm(*input), num_bits, range_min_, range_extent_, to_rtm(*output), num_samples);
+
+	return RTM_RESULT_OK;
+}
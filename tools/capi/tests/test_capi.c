@@ -0,0 +1,272 @@
+////////////////////////////////////////////////////////////////////////////////
+// The MIT License (MIT)
+//
+// Copyright (c) 2026 Nicholas Frechette & Realtime Math contributors
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+////////////////////////////////////////////////////////////////////////////////
+
+// Exercises the C interface from C, returns the number of failed checks.
+
+#include "rtm_capi.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+static int num_failures = 0;
+
+#define CHECK(expression) do { if (!(expression)) { printf("%s(%d): CHECK(%s) failed\n", __FILE__, __LINE__, #expression); num_failures++; } } while (0)
+
+static int near_equal(float lhs, float rhs)
+{
+	return fabsf(lhs - rhs) <= 1.0E-4F;
+}
+
+static int near_equal4(const float* lhs, float x, float y, float z, float w)
+{
+	return near_equal(lhs[0], x) && near_equal(lhs[1], y) && near_equal(lhs[2], z) && near_equal(lhs[3], w);
+}
+
+static int near_equal3(const float* lhs, float x, float y, float z)
+{
+	return near_equal(lhs[0], x) && near_equal(lhs[1], y) && near_equal(lhs[2], z);
+}
+
+static void set_qvv(rtm_qvvf* transform, float rotation_z_angle, float tx, float ty, float tz, float scale)
+{
+	memset(transform, 0, sizeof(rtm_qvvf));
+	transform->rotation[2] = sinf(rotation_z_angle * 0.5F);
+	transform->rotation[3] = cosf(rotation_z_angle * 0.5F);
+	transform->translation[0] = tx;
+	transform->translation[1] = ty;
+	transform->translation[2] = tz;
+	transform->scale[0] = scale;
+	transform->scale[1] = scale;
+	transform->scale[2] = scale;
+}
+
+// Arrays of rtm_qvvf must be 16 bytes aligned, C89 has no portable way to request it
+static rtm_qvvf* align_qvv(unsigned char* buffer)
+{
+	return (rtm_qvvf*)(buffer + ((16 - ((uintptr_t)buffer & 15)) & 15));
+}
+
+static void test_transforms(void)
+{
+	const float half_pi = 1.57079633F;
+	unsigned char lhs_buffer[sizeof(rtm_qvvf) * 3 + 16];
+	unsigned char rhs_buffer[sizeof(rtm_qvvf) * 3 + 16];
+	unsigned char output_buffer[sizeof(rtm_qvvf) * 3 + 16];
+	rtm_qvvf* lhs = align_qvv(lhs_buffer);
+	rtm_qvvf* rhs = align_qvv(rhs_buffer);
+	rtm_qvvf* output = align_qvv(output_buffer);
+	rtm_qvvf_packed packed[3];
+	rtm_float3x4f matrices[3];
+	rtm_float3f points[3];
+	rtm_float3f transformed_points[3];
+	uint32_t transform_indices[3];
+	uint32_t index;
+
+	for (index = 0; index < 3; ++index)
+	{
+		set_qvv(&lhs[index], half_pi, 1.0F, 0.0F, 0.0F, 2.0F);
+		set_qvv(&rhs[index], half_pi, 0.0F, 0.0F, 3.0F, 1.0F);
+	}
+
+	// lhs is applied first: scale by 2, rotate by 90 degrees, translate along X, then rotate by 90 degrees again, and translate along Z
+	CHECK(rtm_qvv_mul_aos(lhs, rhs, output, 3) == RTM_RESULT_OK);
+	for (index = 0; index < 3; ++index)
+	{
+		CHECK(near_equal4(output[index].rotation, 0.0F, 0.0F, 1.0F, 0.0F));
+		CHECK(near_equal3(output[index].translation, 0.0F, 1.0F, 3.0F));
+		CHECK(near_equal3(output[index].scale, 2.0F, 2.0F, 2.0F));
+	}
+
+	points[0].x = 1.0F; points[0].y = 0.0F; points[0].z = 0.0F;
+	points[1].x = 0.0F; points[1].y = 1.0F; points[1].z = 0.0F;
+	points[2].x = 0.0F; points[2].y = 0.0F; points[2].z = 1.0F;
+
+	CHECK(rtm_qvv_mul_point3_aos(&lhs[0], points, transformed_points, 3) == RTM_RESULT_OK);
+	CHECK(near_equal3(&transformed_points[0].x, 1.0F, 2.0F, 0.0F));
+	CHECK(near_equal3(&transformed_points[1].x, -1.0F, 0.0F, 0.0F));
+	CHECK(near_equal3(&transformed_points[2].x, 1.0F, 0.0F, 2.0F));
+
+	memcpy(&output[0], &lhs[0], sizeof(rtm_qvvf));
+	memcpy(&output[1], &rhs[0], sizeof(rtm_qvvf));
+	transform_indices[0] = 1;
+	transform_indices[1] = 0;
+	transform_indices[2] = 1;
+	CHECK(rtm_qvv_mul_point3_indexed_aos(output, 2, transform_indices, points, transformed_points, 3) == RTM_RESULT_OK);
+	CHECK(near_equal3(&transformed_points[0].x, 0.0F, 1.0F, 3.0F));
+	CHECK(near_equal3(&transformed_points[1].x, -1.0F, 0.0F, 0.0F));
+	CHECK(near_equal3(&transformed_points[2].x, 0.0F, 0.0F, 4.0F));
+
+	// Every index is validated before anything is written
+	memcpy(&transformed_points[0], &points[0], sizeof(rtm_float3f) * 3);
+	transform_indices[2] = 2;
+	CHECK(rtm_qvv_mul_point3_indexed_aos(output, 2, transform_indices, points, transformed_points, 3) == RTM_RESULT_INVALID_ARGUMENT);
+	CHECK(memcmp(&transformed_points[0], &points[0], sizeof(rtm_float3f) * 3) == 0);
+	transform_indices[2] = 0xFFFFFFFFU;
+	CHECK(rtm_qvv_mul_point3_indexed_aos(output, 2, transform_indices, points, transformed_points, 3) == RTM_RESULT_INVALID_ARGUMENT);
+	CHECK(rtm_qvv_mul_point3_indexed_aos(output, 0, transform_indices, points, transformed_points, 3) == RTM_RESULT_INVALID_ARGUMENT);
+
+	CHECK(rtm_qvv_store_array(lhs, packed, 3) == RTM_RESULT_OK);
+	CHECK(near_equal4(packed[2].rotation, lhs[2].rotation[0], lhs[2].rotation[1], lhs[2].rotation[2], lhs[2].rotation[3]));
+	CHECK(near_equal3(packed[2].translation, 1.0F, 0.0F, 0.0F));
+	CHECK(near_equal3(packed[2].scale, 2.0F, 2.0F, 2.0F));
+
+	memset(output, 0, sizeof(rtm_qvvf) * 3);
+	CHECK(rtm_qvv_load_array(packed, output, 3) == RTM_RESULT_OK);
+	CHECK(memcmp(&output[1].rotation, &lhs[1].rotation, sizeof(float) * 4) == 0);
+	CHECK(memcmp(&output[1].translation, &lhs[1].translation, sizeof(float) * 3) == 0);
+	CHECK(memcmp(&output[1].scale, &lhs[1].scale, sizeof(float) * 3) == 0);
+
+	CHECK(rtm_matrix_from_qvv_aos(lhs, matrices, 3) == RTM_RESULT_OK);
+	CHECK(near_equal4(matrices[0].x_row, 0.0F, -2.0F, 0.0F, 1.0F));
+	CHECK(near_equal4(matrices[0].y_row, 2.0F, 0.0F, 0.0F, 0.0F));
+	CHECK(near_equal4(matrices[0].z_row, 0.0F, 0.0F, 2.0F, 0.0F));
+
+	// Invalid arguments are rejected before anything is written
+	CHECK(rtm_qvv_mul_aos(lhs, NULL, output, 3) == RTM_RESULT_NULL_POINTER);
+	CHECK(rtm_qvv_mul_aos(lhs, NULL, output, 0) == RTM_RESULT_OK);
+	CHECK(rtm_qvv_mul_aos((const rtm_qvvf*)((unsigned char*)lhs + 4), rhs, output, 1) == RTM_RESULT_MISALIGNED);
+	CHECK(rtm_qvv_mul_point3_aos((const rtm_qvvf*)((unsigned char*)lhs + 8), points, transformed_points, 1) == RTM_RESULT_MISALIGNED);
+}
+
+static void test_quaternions(void)
+{
+	const float quarter_pi = 0.78539816F;
+	const float sin_45 = 0.70710678F;
+	float lhs_x[5] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+	float lhs_y[5] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+	float lhs_z[5] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+	float lhs_w[5] = { 1.0F, 1.0F, 1.0F, 1.0F, 1.0F };
+	float rhs_x[5] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+	float rhs_y[5] = { 0.0F, 0.0F, 0.0F, 0.0F, 0.0F };
+	float rhs_z[5] = { sin_45, sin_45, sin_45, sin_45, sin_45 };
+	float rhs_w[5] = { sin_45, sin_45, sin_45, sin_45, sin_45 };
+	float alphas[5] = { 0.0F, 0.5F, 1.0F, 0.5F, 0.5F };
+	float out_x[5];
+	float out_y[5];
+	float out_z[5];
+	float out_w[5];
+	rtm_const_float4f_soa lhs;
+	rtm_const_float4f_soa rhs;
+	rtm_float4f_soa output;
+	uint32_t index;
+
+	lhs.x = lhs_x; lhs.y = lhs_y; lhs.z = lhs_z; lhs.w = lhs_w;
+	rhs.x = rhs_x; rhs.y = rhs_y; rhs.z = rhs_z; rhs.w = rhs_w;
+	output.x = out_x; output.y = out_y; output.z = out_z; output.w = out_w;
+
+	CHECK(rtm_quat_mul_soa(&rhs, &rhs, &output, 5) == RTM_RESULT_OK);
+	for (index = 0; index < 5; ++index)
+		CHECK(near_equal(out_x[index], 0.0F) && near_equal(out_y[index], 0.0F) && near_equal(out_z[index], 1.0F) && near_equal(out_w[index], 0.0F));
+
+	// Between the identity and 90 degrees around Z, the half angle is alpha * 45 degrees
+	// Both are exact at these alphas: normalized lerp and slerp agree half way
+	CHECK(rtm_quat_lerp_soa(&lhs, &rhs, alphas, &output, 5) == RTM_RESULT_OK);
+	for (index = 0; index < 5; ++index)
+		CHECK(near_equal(out_z[index], sinf(alphas[index] * quarter_pi)) && near_equal(out_w[index], cosf(alphas[index] * quarter_pi)));
+
+	CHECK(rtm_quat_slerp_fast_soa(&lhs, &rhs, alphas, &output, 5) == RTM_RESULT_OK);
+	for (index = 0; index < 5; ++index)
+		CHECK(fabsf(out_z[index] - sinf(alphas[index] * quarter_pi)) < 1.0E-3F && fabsf(out_w[index] - cosf(alphas[index] * quarter_pi)) < 1.0E-3F);
+
+	rhs.w = NULL;
+	CHECK(rtm_quat_mul_soa(&lhs, &rhs, &output, 5) == RTM_RESULT_NULL_POINTER);
+	CHECK(rtm_quat_lerp_soa(&lhs, &lhs, NULL, &output, 5) == RTM_RESULT_NULL_POINTER);
+}
+
+static void test_packing(void)
+{
+	float x[6] = { 0.0F, 1.0F, 2.0F, 3.0F, 4.0F, 5.0F };
+	float y[6] = { -1.0F, -1.0F, -1.0F, -1.0F, -1.0F, -1.0F };
+	float z[6] = { 10.0F, 8.0F, 6.0F, 4.0F, 2.0F, 0.0F };
+	float w[6] = { 0.5F, 0.25F, 0.0F, 0.25F, 0.5F, 0.75F };
+	float out_x[6];
+	float out_y[6];
+	float out_z[6];
+	float out_w[6];
+	uint16_t packed_x[6];
+	uint16_t packed_y[6];
+	uint16_t packed_z[6];
+	uint16_t packed_w[6];
+	float range_min[4];
+	float range_extent[4];
+	rtm_const_float4f_soa samples;
+	rtm_float4f_soa output;
+	rtm_quantized4_soa packed;
+	rtm_const_quantized4_soa const_packed;
+	uint32_t index;
+
+	samples.x = x; samples.y = y; samples.z = z; samples.w = w;
+	output.x = out_x; output.y = out_y; output.z = out_z; output.w = out_w;
+	packed.x = packed_x; packed.y = packed_y; packed.z = packed_z; packed.w = packed_w;
+	const_packed.x = packed_x; const_packed.y = packed_y; const_packed.z = packed_z; const_packed.w = packed_w;
+
+	CHECK(rtm_vector_range_soa(&samples, 6, range_min, range_extent) == RTM_RESULT_OK);
+	CHECK(near_equal4(range_min, 0.0F, -1.0F, 0.0F, 0.0F));
+	CHECK(near_equal4(range_extent, 5.0F, 0.0F, 10.0F, 0.75F));
+
+	CHECK(rtm_pack_range_reduce_unorm_soa(&samples, range_min, range_extent, 16, &packed, 6) == RTM_RESULT_OK);
+	CHECK(packed_x[0] == 0 && packed_x[5] == 65535 && packed_z[0] == 65535 && packed_y[3] == 0);
+
+	CHECK(rtm_unpack_range_expand_unorm_soa(&const_packed, 16, range_min, range_extent, &output, 6) == RTM_RESULT_OK);
+	for (index = 0; index < 6; ++index)
+		CHECK(near_equal(out_x[index], x[index]) && near_equal(out_y[index], y[index]) && near_equal(out_z[index], z[index]) && near_equal(out_w[index], w[index]));
+
+	// Without a [w] stream, only 3 components are processed
+	samples.w = NULL;
+	output.w = NULL;
+	packed.w = NULL;
+	const_packed.w = NULL;
+	memset(out_x, 0, sizeof(out_x));
+
+	CHECK(rtm_vector_range_soa(&samples, 6, range_min, range_extent) == RTM_RESULT_OK);
+	CHECK(near_equal4(range_extent, 5.0F, 0.0F, 10.0F, 0.0F));
+	CHECK(rtm_pack_range_reduce_unorm_soa(&samples, range_min, range_extent, 10, &packed, 6) == RTM_RESULT_OK);
+	CHECK(packed_x[5] == 1023);
+	CHECK(rtm_unpack_range_expand_unorm_soa(&const_packed, 10, range_min, range_extent, &output, 6) == RTM_RESULT_OK);
+	for (index = 0; index < 6; ++index)
+		CHECK(fabsf(out_x[index] - x[index]) < 1.0E-2F && fabsf(out_z[index] - z[index]) < 1.0E-2F);
+
+	CHECK(rtm_pack_range_reduce_unorm_soa(&samples, range_min, range_extent, 0, &packed, 6) == RTM_RESULT_INVALID_ARGUMENT);
+	CHECK(rtm_pack_range_reduce_unorm_soa(&samples, range_min, range_extent, 17, &packed, 6) == RTM_RESULT_INVALID_ARGUMENT);
+	CHECK(rtm_vector_range_soa(&samples, 0, range_min, range_extent) == RTM_RESULT_INVALID_ARGUMENT);
+
+	// 4 components require every stream
+	samples.w = w;
+	CHECK(rtm_pack_range_reduce_unorm_soa(&samples, range_min, range_extent, 16, &packed, 6) == RTM_RESULT_NULL_POINTER);
+}
+
+int main(void)
+{
+	CHECK(rtm_get_capi_version() == RTM_CAPI_VERSION);
+	CHECK(rtm_get_isa_name() != NULL);
+
+	test_transforms();
+	test_quaternions();
+	test_packing();
+
+	printf("rtm_capi (%s): %d failed checks\n", rtm_get_isa_name(), num_failures);
+	return num_failures;
+}